@@ -0,0 +1,64 @@
+/* bench_audio_profile.cpp
+   Host benchmark: voice engine load at every audio block size and rate
+
+   Full polyphony (DRUM_MAX_VOICES, two layers each, one voice stolen per
+   block) at 16/32/64/128 samples and 44.1/48/96 kHz: render time as a
+   share of the block period on this machine, and the capture-to-codec
+   latency of the output path. The worst block and the blocks over the
+   period are printed as host-only: a preempted block on a desktop OS
+   makes them scheduler noise (a 16-sample block is a few hundred us),
+   not a verdict on the profile.
+
+   The bench_audio_profile target of the CMake host build (it links the
+   whole drum_engine library).
+
+   On the Teensy the same matrix runs from the 'a' serial command, against
+   the 600 MHz budget that matters.
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <chrono>
+#include "audio_profile.h"
+
+#define BENCH_SAMPLE_LEN 44100
+#define BENCH_SECONDS 2 // of audio per combination
+
+static int16_t sample[BENCH_SAMPLE_LEN];
+
+static uint32_t hostNs()
+{
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+int main()
+{
+  for (int i = 0; i < BENCH_SAMPLE_LEN; ++i)
+    sample[i] = (int16_t)(20000.0f * sinf(i * 0.031f) * expf(-i / 8000.0f));
+  HitSample hs = {};
+  for (int l = 0; l < VOICE_LAYERS; ++l)
+  {
+    hs.buf[l] = sample;
+    hs.len[l] = BENCH_SAMPLE_LEN;
+    hs.gain[l] = 16384;
+  }
+  hs.layers = VOICE_LAYERS;
+
+  printf("%5s %6s %9s %9s %16s %10s %10s\n", "block", "rate", "period", "load", "capture->codec", "host max",
+         "host over");
+  for (unsigned int b = 0; b < AUDIO_PROFILE_BLOCK_SIZES; ++b)
+    for (unsigned int r = 0; r < AUDIO_PROFILE_RATES; ++r)
+    {
+      unsigned int n = audioProfileBlockSizes[b];
+      uint32_t rate = audioProfileRates[r];
+      AudioProfileLoad load = audioProfileBench(hs, n, rate, BENCH_SECONDS * rate / n, 1000000000u, hostNs);
+      printf("%5u %6u %7.0fus %8.2f%% %13.0f us %9.2f%% %10u\n", n, (unsigned)rate, n * 1e6 / rate,
+             100.0 * load.cyclesMean / load.budget, audioPathLatencyUs(n, rate), 100.0 * load.cyclesMax / load.budget,
+             (unsigned)load.overruns);
+    }
+  printf("host max / host over: wall clock on this machine, preemption included; the 'a' serial command\n"
+         "measures them against the Teensy's cycle counter\n");
+  return 0;
+}
@@ -0,0 +1,25 @@
+/* bench_clock.h
+   Cycle counter for host benchmarks
+
+   Uses the TSC on x86 and falls back to nanoseconds elsewhere, so numbers
+   are only comparable between runs on the same machine.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static inline uint64_t benchCycles() { return __rdtsc(); }
+static const char *const BENCH_CYCLE_UNIT = "TSC cycles";
+#else
+static inline uint64_t benchCycles()
+{
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+static const char *const BENCH_CYCLE_UNIT = "ns";
+#endif
@@ -0,0 +1,82 @@
+/* bench_mapping.cpp
+   Host check + benchmark of the sensor curve tables
+
+   - every 12-bit flex and piezo reading must map to the same pitch and
+     velocity through the tables as through the curves (continuous pitch,
+     which the build interpolates between knots: within 1 LSB)
+   - cost per hit (one flex -> pitch and one piezo -> velocity) of the
+     tables vs the curves, on random readings
+   - cost of rebuilding both tables (setSensorCurves)
+
+   g++ -O2 -std=gnu++14 -Ilib/drum_engine/src bench/bench_mapping.cpp lib/drum_engine/src/drum_mapping.cpp -o bench_mapping
+   (or the bench_mapping target of the CMake host build)
+
+   bench_mapping --check runs the table check only (ctest mapping_tables).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_clock.h"
+#include "drum_mapping.h"
+
+#define BENCH_HITS 4096
+#define BENCH_REPS 200
+
+static uint16_t flexIn[BENCH_HITS];
+static uint16_t piezoIn[BENCH_HITS];
+
+int main(int argc, char **argv)
+{
+  bool checkOnly = argc > 1 && strcmp(argv[1], "--check") == 0;
+  SensorCurveConfig config = sensorCurveDefaults();
+  setSensorCurves(config);
+
+  const int pitchTolerance = PITCH_CONTINUOUS ? 1 : 0;
+  uint32_t errors = 0;
+  int maxPitchDiff = 0;
+  for (unsigned int i = 0; i < SENSOR_CURVE_SIZE; ++i)
+  {
+    int d = abs(flexToPitchQ8((uint16_t)i) - flexToPitchQ8Ref(config, (float)i));
+    if (d > maxPitchDiff)
+      maxPitchDiff = d;
+    errors += d > pitchTolerance;
+    errors += piezoToVelocityQ15((uint16_t)i) != piezoToVelocityQ15Ref(config, (uint16_t)i);
+  }
+  printf("tables match the curves: %s (%u entries off, pitch max |diff| %d)\n", errors ? "FAIL" : "ok",
+         (unsigned)errors, maxPitchDiff);
+  if (checkOnly)
+    return errors ? 1 : 0;
+
+  uint32_t seed = 0x1234u;
+  for (int i = 0; i < BENCH_HITS; ++i)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    flexIn[i] = (uint16_t)((seed >> 8) % SENSOR_CURVE_SIZE);
+    piezoIn[i] = (uint16_t)((seed >> 20) % SENSOR_CURVE_SIZE);
+  }
+
+  volatile int32_t sink = 0;
+  int32_t acc = 0;
+  uint64_t t0 = benchCycles();
+  for (int r = 0; r < BENCH_REPS; ++r)
+    for (int i = 0; i < BENCH_HITS; ++i)
+      acc += flexToPitchQ8Ref(config, flexIn[i]) + piezoToVelocityQ15Ref(config, piezoIn[i]);
+  uint64_t t1 = benchCycles();
+  for (int r = 0; r < BENCH_REPS; ++r)
+    for (int i = 0; i < BENCH_HITS; ++i)
+      acc += flexToPitchQ8(flexIn[i]) + piezoToVelocityQ15(piezoIn[i]);
+  uint64_t t2 = benchCycles();
+  sink = acc;
+
+  const double hits = (double)BENCH_REPS * BENCH_HITS;
+  printf("%-8s %14s   (%s per hit: pitch + velocity)\n", "mapping", "cost", BENCH_CYCLE_UNIT);
+  printf("%-8s %14.2f\n", "curves", (double)(t1 - t0) / hits);
+  printf("%-8s %14.2f\n", "table", (double)(t2 - t1) / hits);
+
+  uint64_t t3 = benchCycles();
+  for (int r = 0; r < 20; ++r)
+    setSensorCurves(config);
+  printf("table rebuild: %.0f %s\n", (double)(benchCycles() - t3) / 20, BENCH_CYCLE_UNIT);
+  return errors || sink == 12345 ? 1 : 0;
+}
@@ -0,0 +1,78 @@
+/* bench_mix.cpp
+   Host check + benchmark of the voice mix kernel
+
+   - the packed kernel must match the C reference bit for bit, at every
+     block size from 16 to 128 samples
+   - every gain ramp (fades to 0 too) must end on its target gain at the
+     last sample of the block, at every block size
+   - cycles per 128-sample block at 1/4/8/16 voices, packed vs reference
+
+   g++ -O2 -std=gnu++14 -Ilib/drum_engine/src bench/bench_mix.cpp lib/drum_engine/src/mix_kernel.cpp -o bench_mix
+   (or the bench_mix target of the CMake host build)
+
+   On the Teensy the same check and benchmark run from the 'm' serial command.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "bench_clock.h"
+#include "mix_kernel.h"
+
+#define BENCH_BLOCK 128
+#define BENCH_REPS 20000
+
+static uint32_t hostCycles() { return (uint32_t)benchCycles(); }
+
+static int16_t src[16][BENCH_BLOCK] __attribute__((aligned(4)));
+static int32_t acc[BENCH_BLOCK] __attribute__((aligned(4)));
+static int16_t out[BENCH_BLOCK] __attribute__((aligned(4)));
+
+static double refCycles(unsigned int voices)
+{
+  MixInput in[16];
+  for (unsigned int k = 0; k < voices; ++k)
+  {
+    for (int i = 0; i < BENCH_BLOCK; ++i)
+      src[k][i] = (int16_t)((i * 977 + k * 131) & 0xFFFF);
+    in[k].src = src[k];
+    in[k].gain = (int16_t)(MIX_GAIN_UNITY / 2);
+    in[k].gainStep = -3;
+    in[k].gainCarry = 0;
+  }
+  uint64_t t0 = benchCycles();
+  for (int r = 0; r < BENCH_REPS; ++r)
+  {
+    memset(acc, 0, sizeof(acc));
+    mixAccumulateRef(acc, in, voices, BENCH_BLOCK);
+    mixSaturateRef(out, acc, BENCH_BLOCK);
+  }
+  return (double)(benchCycles() - t0) / BENCH_REPS;
+}
+
+int main(int argc, char **argv)
+{
+  bool checkOnly = argc > 1 && strcmp(argv[1], "--check") == 0;
+  uint32_t errors = 0;
+  for (unsigned int n = 16; n <= BENCH_BLOCK; n *= 2)
+    for (uint32_t seed = 1; seed <= 200; ++seed)
+      for (unsigned int voices = 1; voices <= 16; ++voices)
+        errors += mixSelfTest(voices, n, seed * 7919u + voices);
+  printf("bit-exact check: %s (%u differing samples)\n", errors ? "FAIL" : "ok", (unsigned)errors);
+  uint32_t ramps = 0;
+  for (unsigned int n = 16; n <= BENCH_BLOCK; n *= 2)
+    ramps += mixRampTest(n);
+  printf("ramp end check: %s (%u ramps off their end gain)\n", ramps ? "FAIL" : "ok", (unsigned)ramps);
+  errors += ramps;
+  if (checkOnly)
+    return errors ? 1 : 0;
+
+  printf("%6s %16s %16s   (%s per %d-sample block)\n", "voices", "packed", "reference", BENCH_CYCLE_UNIT,
+         BENCH_BLOCK);
+  static const unsigned int counts[] = {1, 4, 8, 16};
+  for (unsigned int voices : counts)
+  {
+    uint32_t packed = mixBenchCycles(voices, BENCH_BLOCK, BENCH_REPS, hostCycles);
+    printf("%6u %16u %16.0f\n", voices, (unsigned)packed, refCycles(voices));
+  }
+  return errors ? 1 : 0;
+}
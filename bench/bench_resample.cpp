@@ -0,0 +1,53 @@
+/* bench_resample.cpp
+   Host benchmark: cost per output sample of each resampler quality
+
+   g++ -O2 -std=gnu++14 -Ilib/drum_engine/src bench/bench_resample.cpp lib/drum_engine/src/resampler.cpp -o bench_resample
+   (or the bench_resample target of the CMake host build)
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include "bench_clock.h"
+#include "resampler.h"
+
+#define BENCH_SAMPLE_LEN 44100
+#define BENCH_BLOCK 128
+
+static int16_t sample[BENCH_SAMPLE_LEN];
+
+int main()
+{
+  resamplerInit();
+  for (int i = 0; i < BENCH_SAMPLE_LEN; ++i)
+    sample[i] = (int16_t)(20000.0f * sinf(i * 0.031f) * expf(-i / 8000.0f));
+
+  static const int16_t pitches[] = {0, 2 << 8, 7 << 8, 12 << 8, (5 << 8) + 77};
+  int16_t out[BENCH_BLOCK];
+  volatile int32_t sink = 0;
+
+  printf("%-8s %8s %14s\n", "mode", "semis", BENCH_CYCLE_UNIT);
+  for (int m = 0; m < INTERP_MODES; ++m)
+  {
+    for (int16_t semis : pitches)
+    {
+      ResampleState st = {sample, BENCH_SAMPLE_LEN, 0, 0, pitchToStepQ16(semis)};
+      uint64_t produced = 0;
+      uint64_t t0 = benchCycles();
+      for (int rep = 0; rep < 20; ++rep)
+      {
+        st.pos = 0;
+        st.frac = 0;
+        unsigned int n;
+        while ((n = resample(st, out, BENCH_BLOCK, (InterpMode)m)) > 0)
+        {
+          produced += n;
+          sink += out[0];
+        }
+      }
+      uint64_t t1 = benchCycles();
+      printf("%-8s %8.2f %14.2f /sample\n", interpModeName((InterpMode)m), semis / 256.0f,
+             (double)(t1 - t0) / (double)produced);
+    }
+  }
+  return sink == 12345 ? 1 : 0;
+}
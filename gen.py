@@ -1,30 +1,46 @@
 #!/usr/bin/env python3
 """
 Generate Teensy header files for low-latency drum sampler
-Input:  drum_base.wav  (mono, 16-bit PCM, short clean hit)
-Output: 15 or 30 .h files in ./headers/
+Input:  one or more mono 16-bit PCM hits per zone (ZONES, softest first)
+Output: one .h file per distinct recording in ./headers/, plus drum_bank.h,
+        the constexpr bank manifest the firmware indexes directly
+
+Pitch, velocity and release are no longer baked in: the voice engine
+resamples the root sample at playback time (see lib/drum_engine/src/resampler.h), scales
+it with a per-voice gain and damps it with a release envelope when the FSR
+is pressed. Only genuinely different velocity recordings get their own
+layer; the engine crossfades between the two nearest ones.
+
+The bank has one sample set per pad (PadArray order) and hit zone (center,
+rim, in HitZone order), each with the same number of velocity layers. A
+zone without recordings of its own can reuse another zone's (or another
+pad's) with its own root pitch and trim; the data is written once and all
+entries point at it.
 """
 
 import os, numpy as np, soundfile as sf
-from scipy.signal import resample
 
 # ===== User config =====
 BASE_WAV = "base.wav"
 OUT_DIR = "headers"
-VEL_LEVELS = [0.6, 0.85, 1.0]     # soft, medium, hard multipliers
-PITCH_STEPS = [0, 2, 4, 7, 12]    # semitones relative to C4
-MAKE_SHORT_RELEASE = True
-SHORT_RELEASE_MS = 120             # how long short variant lasts
+BANK_HEADER = "drum_bank.h"
+# per zone, in HitZone order: recordings (softest first), semitones of the
+# recordings above the instrument root, level trim
+ZONES = [
+    ("center", [BASE_WAV], 0, 1.0),
+    ("rim",    [BASE_WAV], -5, 0.8),  # no rim recording yet: the head sample 5 semitones up
+]
+# per pad, in PadArray order: its ZONES-style list (every pad the same zone count)
+PADS = [
+    ZONES,
+]
 
 # ===== Utility =====
-def semitone_ratio(st):
-    return 2 ** (st / 12.0)
-
-def write_header(name, data):
+def write_header(name, data, source):
     data_i16 = np.clip(data * 32767, -32768, 32767).astype(np.int16)
     header_path = os.path.join(OUT_DIR, f"{name}.h")
     with open(header_path, "w") as f:
-        f.write(f"// Auto-generated from {BASE_WAV}\n")
+        f.write(f"// Auto-generated from {source}\n")
         f.write(f"#pragma once\n#include <Arduino.h>\nconst int16_t {name}[] PROGMEM = {{\n")
 
         for i, v in enumerate(data_i16):
@@ -34,28 +50,57 @@ def write_header(name, data):
         f.write("\n};\n")
         f.write(f"const unsigned int {name}_len = {len(data_i16)};\n")
     print("Wrote", header_path)
+    return len(data_i16)
+
+def write_bank(entries, pads, zones, layers, rate):
+    """entries: list of (name, root_pitch_semitones, gain, flags), pad by pad, zone by zone, layers softest first"""
+    header_path = os.path.join(OUT_DIR, BANK_HEADER)
+    with open(header_path, "w") as f:
+        f.write("// Auto-generated by gen.py, do not edit\n")
+        f.write("#pragma once\n#include \"sample_bank.h\"\n")
+        for name in dict.fromkeys(name for name, _, _, _ in entries):
+            f.write(f"#include \"{name}.h\"\n")
+        f.write(f"\n#define DRUM_BANK_PADS {pads}\n")
+        f.write(f"#define DRUM_BANK_ZONES {zones}\n")
+        f.write(f"#define DRUM_BANK_VEL_LAYERS {layers}\n")
+        f.write(f"#define DRUM_BANK_SAMPLE_RATE {rate} // recording rate; the firmware corrects for its output rate\n\n")
+        f.write("// index = (pad * DRUM_BANK_ZONES + zone (HitZone)) * DRUM_BANK_VEL_LAYERS + velocity layer (softest first)\n")
+        f.write("constexpr DrumSampleDesc drumBank[] = {\n")
+        for name, root, gain, flags in entries:
+            root_q8 = int(round(root * 256))
+            gain_q15 = int(min(max(round(gain * 32767), 0), 32767))
+            f.write(f"    {{{name}, {name}_len, {root_q8}, {gain_q15}, {flags}}},\n")
+        f.write("};\n")
+        f.write("constexpr unsigned int drumBankSize = sizeof(drumBank) / sizeof(drumBank[0]);\n\n")
+        f.write("static_assert(DRUM_BANK_VEL_LAYERS >= 1, \"bank needs at least one velocity layer\");\n")
+        f.write("static_assert(DRUM_BANK_ZONES >= 1, \"bank needs at least one zone\");\n")
+        f.write("static_assert(DRUM_BANK_PADS >= 1, \"bank needs at least one pad\");\n")
+        f.write("static_assert(drumBankSize == DRUM_BANK_PADS * DRUM_BANK_ZONES * DRUM_BANK_VEL_LAYERS, \"bank size does not match its dimensions\");\n")
+    print("Wrote", header_path)
 
 # ===== Main =====
 os.makedirs(OUT_DIR, exist_ok=True)
-data, fs = sf.read(BASE_WAV)
-if data.ndim > 1: data = data[:,0]  # mono
-
-for vi, vscale in enumerate(VEL_LEVELS):
-    for pi, pitch in enumerate(PITCH_STEPS):
-        # pitch-shift by resampling
-        ratio = semitone_ratio(pitch)
-        new_len = int(len(data) / ratio)
-        pitched = resample(data, new_len)
-        # normalize & scale by velocity
-        pitched = pitched / np.max(np.abs(pitched)) * vscale
-
-        # Long version
-        name_long = f"drum_v{vi}_p{pi}_long"
-        write_header(name_long, pitched)
-
-        # Short version (truncated)
-        if MAKE_SHORT_RELEASE:
-            samples_short = int(fs * SHORT_RELEASE_MS / 1000)
-            truncated = pitched[:samples_short]
-            name_short = f"drum_v{vi}_p{pi}_short"
-            write_header(name_short, truncated)
+
+zones = len(PADS[0])
+layers = len(PADS[0][0][1])
+assert all(len(pad) == zones for pad in PADS), "every pad needs the same number of zones"
+assert all(len(wavs) == layers for pad in PADS for _, wavs, _, _ in pad), "every zone needs the same number of layers"
+
+bank = []
+names = {}  # recording -> header, each written once
+rate = None  # every recording at the same rate
+for zone, wavs, root_pitch, gain in (z for pad in PADS for z in pad):
+    for wav in wavs:
+        if wav not in names:
+            data, fs = sf.read(wav)
+            if data.ndim > 1: data = data[:,0]  # mono
+            assert rate in (None, fs), f"{wav} is at {fs} Hz, the bank at {rate} Hz"
+            rate = fs
+            # normalize only, root pitch; loudness comes from the engine gain
+            root = data / np.max(np.abs(data))
+
+            names[wav] = f"drum_v{len(names)}"
+            write_header(names[wav], root, wav)
+        bank.append((names[wav], root_pitch, gain, 0))
+
+write_bank(bank, len(PADS), zones, layers, rate)
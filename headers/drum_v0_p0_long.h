@@ -1,831 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v0_p0_long[] PROGMEM = {
-    -10, 0, 6, 8, 18, 12, 26, 16, 27, 16, 24, 11, 20, 9, 8, 6, 
-    -4, -2, -11, -14, -20, -26, -33, -36, -47, -48, -61, -65, -72, -81, -88, -94, 
-    -106, -111, -121, -132, -137, -150, -158, -168, -179, -191, -197, -211, -218, -230, -243, -248, 
-    -266, -266, -288, -286, -306, -309, -321, -332, -338, -350, -356, -368, -373, -384, -388, -401, 
-    -405, -413, -422, -426, -437, -442, -449, -454, -466, -464, -481, -477, -491, -494, -502, -509, 
-    -513, -523, -526, -537, -539, -550, -552, -564, -565, -577, -580, -590, -591, -604, -603, -617, 
-    -613, -629, -624, -640, -635, -646, -648, -650, -658, -656, -661, -664, -665, -664, -669, -663, 
-    -671, -664, -668, -662, -663, -660, -658, -655, -652, -648, -646, -637, -637, -627, -625, -618, 
-    -613, -605, -599, -592, -582, -580, -567, -560, -553, -540, -535, -519, -515, -500, -491, -479, 
-    -465, -454, -442, -428, -419, -395, -395, -367, -365, -343, -331, -315, -301, -286, -269, -257, 
-    -236, -230, -204, -198, -174, -168, -145, -135, -115, -106, -86, -75, -59, -43, -30, -16, 
-    0, 7, 31, 34, 59, 61, 84, 92, 106, 122, 129, 148, 156, 173, 182, 198, 
-    207, 225, 232, 250, 260, 274, 287, 300, 313, 325, 341, 351, 369, 376, 395, 404, 
-    421, 430, 446, 456, 472, 481, 495, 506, 517, 531, 535, 553, 556, 570, 576, 586, 
-    594, 603, 609, 616, 623, 629, 635, 642, 646, 653, 656, 662, 666, 670, 675, 678, 
-    683, 687, 689, 691, 694, 699, 697, 702, 701, 704, 701, 707, 699, 707, 697, 701, 
-    694, 693, 688, 682, 680, 668, 667, 654, 649, 640, 629, 617, 611, 593, 588, 568, 
-    563, 544, 533, 518, 502, 490, 472, 458, 442, 426, 409, 393, 378, 358, 344, 325, 
-    306, 290, 269, 252, 232, 212, 191, 170, 150, 126, 105, 81, 57, 35, 8, -16, 
-    -39, -69, -90, -120, -144, -174, -198, -227, -255, -280, -310, -335, -365, -390, -420, -442, 
-    -473, -498, -523, -552, -572, -602, -623, -650, -671, -696, -716, -741, -761, -782, -804, -820, 
-    -843, -858, -880, -893, -913, -925, -946, -954, -975, -983, -1002, -1008, -1025, -1032, -1046, -1052, 
-    -1064, -1070, -1080, -1085, -1092, -1097, -1100, -1106, -1107, -1109, -1113, -1107, -1113, -1105, -1107, -1099, 
-    -1099, -1090, -1087, -1072, -1071, -1054, -1049, -1032, -1023, -1006, -993, -975, -958, -940, -921, -901, 
-    -882, -854, -839, -806, -791, -759, -734, -710, -676, -654, -619, -591, -560, -527, -497, -461, 
-    -430, -393, -361, -321, -290, -247, -214, -174, -135, -98, -56, -18, 24, 61, 106, 146, 
-    186, 232, 270, 315, 358, 402, 442, 489, 529, 574, 619, 659, 704, 747, 790, 834, 
-    874, 921, 958, 1006, 1041, 1088, 1123, 1168, 1202, 1247, 1279, 1321, 1352, 1395, 1421, 1462, 
-    1490, 1521, 1557, 1579, 1614, 1636, 1664, 1687, 1714, 1730, 1756, 1772, 1792, 1806, 1825, 1833, 
-    1850, 1858, 1866, 1875, 1879, 1885, 1885, 1889, 1883, 1886, 1877, 1872, 1866, 1850, 1846, 1823, 
-    1816, 1792, 1775, 1753, 1731, 1703, 1679, 1646, 1620, 1584, 1551, 1515, 1474, 1440, 1392, 1353, 
-    1306, 1259, 1213, 1162, 1111, 1057, 1006, 948, 893, 834, 774, 713, 652, 588, 525, 460, 
-    391, 328, 255, 189, 118, 46, -24, -96, -171, -245, -318, -395, -471, -546, -625, -701, 
-    -780, -854, -940, -1008, -1099, -1166, -1254, -1327, -1411, -1484, -1566, -1642, -1722, -1795, -1877, -1946, 
-    -2028, -2099, -2175, -2246, -2319, -2389, -2461, -2529, -2597, -2666, -2731, -2795, -2860, -2922, -2985, -3041, 
-    -3106, -3157, -3220, -3272, -3325, -3379, -3427, -3478, -3525, -3570, -3614, -3657, -3697, -3735, -3770, -3805, 
-    -3835, -3865, -3891, -3914, -3939, -3949, -3972, -3976, -3992, -3992, -3994, -3993, -3985, -3979, -3962, -3947, 
-    -3924, -3900, -3871, -3835, -3799, -3758, -3708, -3661, -3603, -3546, -3482, -3415, -3341, -3268, -3183, -3102, 
-    -3010, -2920, -2818, -2722, -2607, -2507, -2384, -2272, -2147, -2018, -1893, -1753, -1619, -1477, -1329, -1185, 
-    -1029, -876, -717, -554, -395, -222, -59, 116, 286, 464, 636, 821, 991, 1182, 1352, 1541, 
-    1720, 1901, 2084, 2262, 2447, 2620, 2808, 2972, 3161, 3323, 3502, 3668, 3837, 3999, 4164, 4319, 
-    4479, 4626, 4781, 4922, 5067, 5202, 5340, 5466, 5597, 5713, 5838, 5943, 6062, 6157, 6266, 6355, 
-    6450, 6534, 6617, 6695, 6764, 6838, 6894, 6959, 7008, 7060, 7104, 7145, 7178, 7213, 7236, 7261, 
-    7277, 7288, 7302, 7299, 7307, 7296, 7290, 7279, 7260, 7241, 7212, 7188, 7149, 7118, 7073, 7030, 
-    6982, 6926, 6874, 6811, 6749, 6682, 6609, 6534, 6457, 6371, 6290, 6195, 6100, 6005, 5898, 5796, 
-    5680, 5568, 5443, 5323, 5190, 5054, 4918, 4768, 4621, 4462, 4301, 4133, 3959, 3774, 3595, 3395, 
-    3202, 2992, 2780, 2561, 2337, 2102, 1866, 1619, 1370, 1109, 847, 577, 299, 22, -271, -558, 
-    -858, -1162, -1467, -1783, -2097, -2418, -2743, -3070, -3400, -3735, -4070, -4408, -4749, -5093, -5429, -5780, 
-    -6113, -6466, -6798, -7146, -7478, -7820, -8148, -8480, -8804, -9127, -9438, -9753, -10049, -10352, -10635, -10917, 
-    -11189, -11449, -11702, -11947, -12172, -12400, -12603, -12803, -12986, -13159, -13317, -13467, -13599, -13718, -13832, -13920, 
-    -14007, -14075, -14130, -14177, -14208, -14228, -14240, -14235, -14225, -14203, -14169, -14134, -14078, -14028, -13956, -13891, 
-    -13808, -13729, -13633, -13544, -13441, -13336, -13228, -13111, -12996, -12870, -12743, -12608, -12472, -12326, -12176, -12020, 
-    -11854, -11684, -11504, -11313, -11118, -10908, -10691, -10465, -10222, -9978, -9715, -9446, -9166, -8876, -8581, -8272, 
-    -7962, -7641, -7320, -6993, -6665, -6339, -6006, -5687, -5359, -5047, -4731, -4428, -4127, -3837, -3546, -3273, 
-    -2992, -2726, -2453, -2189, -1915, -1644, -1358, -1066, -760, -434, -94, 277, 672, 1094, 1554, 2042, 
-    2571, 3139, 3742, 4389, 5073, 5817, 6587, 7384, 8221, 9070, 9958, 10842, 11753, 12659, 13574, 14476, 
-    15368, 16242, 17109, 17951, 18763, 19541, 19619, 19613, 19619, 19615, 19617, 19618, 19615, 19617, 19617, 19616, 
-    19618, 19617, 19616, 19617, 19616, 19617, 19618, 19615, 19617, 19617, 19615, 19620, 19613, 19621, 19614, 19616, 
-    19618, 19613, 19621, 19612, 19620, 19610, 19621, 19612, 19618, 19617, 19615, 19618, 19616, 19617, 19618, 19615, 
-    19618, 19616, 19617, 19616, 19617, 19617, 19617, 19615, 19619, 19612, 19621, 19613, 18643, 17616, 16585, 15545, 
-    14511, 13472, 12426, 11399, 10375, 9372, 8374, 7398, 6435, 5521, 4624, 3778, 2953, 2175, 1440, 749, 
-    104, -508, -1084, -1646, -2176, -2707, -3210, -3719, -4198, -4694, -5182, -5686, -6196, -6711, -7239, -7768, 
-    -8313, -8866, -9455, -10060, -10693, -11337, -11994, -12661, -13335, -14017, -14698, -15376, -16059, -16733, -17410, -18075, 
-    -18727, -19359, -19654, -19653, -19654, -19654, -19653, -19655, -19653, -19655, -19652, -19655, -19652, -19654, -19652, -19654, 
-    -19653, -19652, -19654, -19651, -19655, -19652, -19656, -19652, -19654, -19652, -19654, -19654, -19655, -19652, -19655, -19654, 
-    -19654, -19654, -19653, -19655, -19652, -19657, -19650, -19656, -19651, -19656, -19652, -19652, -19653, -19650, -19656, -19650, 
-    -19656, -19652, -19656, -19652, -19656, -19651, -19655, -19655, -19649, -19660, -19648, -19658, -19651, -19655, -19652, -19655, 
-    -19652, -19654, -19653, -19652, -19655, -19652, -19656, -19650, -19657, -19653, -19560, -18485, -17392, -16279, -15161, -14021, 
-    -12881, -11729, -10584, -9440, -8311, -7198, -6102, -5037, -3982, -2957, -1944, -951, 24, 983, 1922, 2842, 
-    3744, 4632, 5503, 6369, 7213, 8056, 8870, 9685, 10479, 11263, 12041, 12807, 13568, 14332, 15083, 15853, 
-    16605, 17374, 18135, 18895, 19619, 19613, 19620, 19613, 19619, 19615, 19619, 19614, 19619, 19615, 19617, 19617, 
-    19617, 19616, 19617, 19617, 19617, 19617, 19617, 19617, 19617, 19616, 19617, 19617, 19617, 19616, 19618, 19615, 
-    19619, 19615, 19617, 19616, 19617, 19617, 19617, 19618, 19614, 19619, 19615, 19619, 19616, 19616, 19618, 19615, 
-    19619, 19615, 19616, 19618, 19614, 19619, 19615, 19617, 19617, 19616, 19615, 19619, 19612, 19622, 19611, 19622, 
-    19612, 19620, 19613, 19619, 19615, 19619, 19615, 19618, 19616, 19617, 19617, 19617, 19615, 19619, 19615, 19618, 
-    19615, 19619, 19614, 19620, 19615, 19617, 19616, 18973, 17761, 16544, 15303, 14051, 12786, 11511, 10230, 8946, 
-    7647, 6342, 5029, 3716, 2398, 1090, -219, -1512, -2801, -4076, -5324, -6563, -7768, -8959, -10114, -11249, 
-    -12346, -13424, -14464, -15480, -16471, -17430, -18375, -19289, -19652, -19656, -19652, -19656, -19653, -19654, -19652, -19657, 
-    -19650, -19657, -19652, -19654, -19654, -19653, -19655, -19652, -19656, -19650, -19656, -19650, -19656, -19651, -19655, -19654, 
-    -19652, -19657, -19648, -19658, -19650, -19656, -19654, -19652, -19656, -19650, -19656, -19652, -19654, -19652, -19654, -19653, 
-    -19653, -19656, -19652, -19657, -19651, -19656, -19652, -19655, -19652, -19655, -19650, -19656, -19653, -19653, -19654, -19652, 
-    -19654, -19654, -19654, -19655, -19652, -19654, -19654, -19654, -19655, -19652, -19655, -19650, -19657, -19650, -19658, -19648, 
-    -19659, -19648, -19656, -19651, -19654, -19654, -19654, -19654, -19653, -19655, -19651, -19655, -19652, -19655, -19652, -19655, 
-    -19651, -18554, -16857, -15155, -13429, -11697, -9958, -8207, -6471, -4722, -2997, -1271, 428, 2113, 3778, 5417, 
-    7043, 8632, 10204, 11743, 13252, 14729, 16178, 17588, 18971, 19619, 19613, 19620, 19615, 19617, 19619, 19613, 
-    19621, 19613, 19619, 19617, 19615, 19619, 19614, 19618, 19617, 19616, 19617, 19617, 19614, 19619, 19615, 19617, 
-    19618, 19615, 19618, 19616, 19617, 19617, 19616, 19617, 19617, 19615, 19619, 19616, 19617, 19617, 19615, 19619, 
-    19615, 19619, 19616, 19616, 19619, 19614, 19619, 19615, 19617, 19617, 19617, 19615, 19620, 19613, 19621, 19613, 
-    19619, 19615, 19617, 19616, 19616, 19616, 19617, 19617, 19615, 19618, 19614, 19619, 19617, 19616, 19617, 19617, 
-    19616, 19618, 19617, 19615, 19618, 19617, 19616, 19619, 19615, 19617, 19617, 19616, 19617, 19617, 19615, 19617, 
-    19617, 19615, 19618, 19615, 19618, 19616, 18036, 16431, 14790, 13146, 11473, 9800, 8110, 6419, 4722, 3030, 
-    1333, -343, -2021, -3672, -5317, -6936, -8542, -10121, -11686, -13216, -14738, -16213, -17684, -19106, -19656, -19652, 
-    -19653, -19656, -19651, -19656, -19652, -19654, -19654, -19653, -19654, -19654, -19653, -19654, -19654, -19653, -19654, -19654, 
-    -19651, -19657, -19651, -19656, -19654, -19653, -19654, -19652, -19655, -19654, -19653, -19654, -19654, -19652, -19656, -19652, 
-    -19655, -19654, -19654, -19654, -19653, -19656, -19652, -19655, -19652, -19651, -19656, -19648, -19657, -19650, -19655, -19654, 
-    -19653, -19654, -19652, -19654, -19654, -19654, -19654, -19654, -19652, -19654, -19653, -19653, -19654, -19651, -19655, -19650, 
-    -19656, -19650, -19657, -19651, -19653, -19654, -19652, -19655, -19652, -19656, -19648, -19657, -19649, -19656, -19652, -19657, 
-    -19650, -19657, -19650, -19657, -19650, -19656, -19650, -19654, -19654, -19654, -19654, -19654, -19587, -18182, -16756, -15293, 
-    -13817, -12308, -10791, -9253, -7706, -6154, -4593, -3039, -1490, 49, 1576, 3078, 4574, 6034, 7484, 8899, 
-    10302, 11667, 13025, 14336, 15651, 16913, 18180, 19409, 19618, 19617, 19615, 19619, 19614, 19619, 19615, 19619, 
-    19615, 19617, 19617, 19616, 19618, 19617, 19615, 19619, 19615, 19619, 19615, 19617, 19617, 19615, 19618, 19615, 
-    19616, 19617, 19615, 19617, 19616, 19615, 19617, 19614, 19617, 19617, 19613, 19618, 19615, 19617, 19615, 19617, 
-    19614, 19619, 19615, 19617, 19617, 19617, 19617, 19617, 19615, 19619, 19614, 19619, 19615, 19617, 19617, 19617, 
-    19615, 19619, 19615, 19617, 19618, 19615, 19618, 19615, 19619, 19613, 19620, 19613, 19620, 19613, 19618, 19616, 
-    19617, 19617, 19614, 19618, 19615, 19618, 19617, 19615, 19617, 19618, 19614, 19619, 19613, 19617, 19615, 19616, 
-    19617, 19615, 19609, 18324, 17037, 15731, 14416, 13086, 11748, 10387, 9027, 7637, 6248, 4832, 3414, 1971, 
-    527, -938, -2407, -3892, -5377, -6880, -8376, -9890, -11397, -12910, -14419, -15922, -17423, -18906, -19658, -19650, 
-    -19656, -19652, -19652, -19654, -19653, -19655, -19652, -19653, -19652, -19656, -19650, -19656, -19653, -19652, -19656, -19650, 
-    -19654, -19652, -19654, -19654, -19652, -19656, -19648, -19658, -19649, -19655, -19654, -19652, -19657, -19651, -19656, -19652, 
-    -19656, -19653, -19654, -19654, -19654, -19653, -19653, -19654, -19652, -19655, -19654, -19654, -19654, -19654, -19654, -19654, 
-    -19654, -19652, -19655, -19652, -19654, -19654, -19654, -19652, -19654, -19654, -19653, -19656, -19651, -19656, -19652, -19654, 
-    -19654, -19653, -19654, -19654, -19654, -19653, -19655, -19653, -19654, -19655, -19652, -19656, -19653, -19654, -19652, -19656, 
-    -19650, -19657, -19650, -18627, -17240, -15846, -14440, -13025, -11597, -10168, -8723, -7283, -5831, -4382, -2931, -1483, 
-    -46, 1389, 2803, 4215, 5599, 6975, 8328, 9657, 10973, 12254, 13517, 14754, 15956, 17143, 18287, 19417, 
-    19616, 19615, 19619, 19613, 19620, 19613, 19619, 19616, 19615, 19618, 19616, 19617, 19617, 19614, 19620, 19613, 
-    19620, 19614, 19617, 19617, 19613, 19621, 19612, 19621, 19611, 19621, 19612, 19619, 19614, 19618, 19614, 19619, 
-    19613, 19619, 19616, 19617, 19615, 19620, 19613, 19621, 19613, 19618, 19614, 19618, 19615, 19617, 19618, 19614, 
-    19621, 19613, 19620, 19613, 19619, 19615, 19618, 19617, 19617, 19617, 19615, 19617, 19615, 19619, 19615, 19617, 
-    19617, 19615, 19617, 19617, 19615, 19619, 19615, 19619, 19614, 19618, 19617, 19617, 19617, 19617, 19615, 19619, 
-    19615, 19617, 19616, 19615, 19619, 19615, 18363, 16972, 15598, 14229, 12871, 11521, 10186, 8855, 7540, 6229, 
-    4927, 3626, 2336, 1042, -242, -1535, -2819, -4116, -5402, -6704, -7998, -9302, -10602, -11899, -13198, -14484, 
-    -15768, -17032, -18289, -19518, -19656, -19652, -19656, -19652, -19655, -19652, -19656, -19654, -19653, -19654, -19652, -19653, 
-    -19656, -19650, -19658, -19650, -19656, -19654, -19654, -19654, -19651, -19656, -19650, -19656, -19649, -19656, -19652, -19654, 
-    -19652, -19654, -19654, -19654, -19654, -19652, -19654, -19654, -19652, -19655, -19654, -19654, -19653, -19656, -19651, -19656, 
-    -19652, -19656, -19652, -19655, -19652, -19653, -19656, -19652, -19655, -19652, -19655, -19653, -19654, -19654, -19653, -19654, 
-    -19655, -19652, -19656, -19653, -19652, -19655, -19652, -19654, -19654, -19653, -19654, -19654, -19654, -19653, -19655, -19653, 
-    -19654, -19654, -19652, -19655, -19654, -19652, -19656, -19651, -19656, -19653, -19653, -18645, -17487, -16299, -15097, -13873, 
-    -12624, -11366, -10082, -8792, -7478, -6158, -4817, -3477, -2113, -752, 629, 2016, 3411, 4824, 6234, 7664, 
-    9091, 10525, 11962, 13396, 14836, 16262, 17697, 19109, 19619, 19617, 19616, 19618, 19615, 19617, 19615, 19618, 
-    19615, 19619, 19613, 19619, 19613, 19621, 19611, 19622, 19612, 19621, 19612, 19620, 19613, 19619, 19614, 19618, 
-    19614, 19618, 19614, 19619, 19615, 19617, 19617, 19614, 19619, 19615, 19618, 19616, 19617, 19616, 19619, 19615, 
-    19618, 19615, 19617, 19617, 19616, 19615, 19618, 19613, 19618, 19615, 19617, 19616, 19616, 19619, 19613, 19619, 
-    19614, 19618, 19615, 19616, 19616, 19615, 19618, 19614, 19619, 19613, 19339, 18604, 17882, 17149, 16428, 15700, 
-    14991, 14274, 13582, 12880, 12206, 11526, 10868, 10210, 9566, 8928, 8291, 7668, 7033, 6413, 5775, 5151, 
-    4500, 3855, 3185, 2510, 1809, 1093, 353, -409, -1193, -2006, -2838, -3696, -4577, -5475, -6406, -7339, 
-    -8306, -9281, -10270, -11273, -12290, -13304, -14335, -15355, -16377, -17397, -18397, -19399, -19650, -19655, -19651, -19656, 
-    -19650, -19657, -19652, -19653, -19656, -19652, -19656, -19653, -19652, -19655, -19653, -19654, -19654, -19653, -19653, -19654, 
-    -19652, -19652, -19653, -19652, -19652, -19654, -19655, -19652, -19656, -19652, -19654, -19654, -19653, -19654, -19654, -19654, 
-    -19652, -19654, -19652, -19654, -19653, -19654, -19653, -19654, -19652, -19653, -19654, -19650, -19657, -19648, -19658, -19650, 
-    -19657, -19652, -19653, -19654, -19231, -18340, -17431, -16528, -15616, -14705, -13794, -12882, -11977, -11068, -10170, -9276, 
-    -8384, -7511, -6634, -5780, -4928, -4095, -3268, -2465, -1664, -895, -128, 609, 1336, 2042, 2726, 3397, 
-    4041, 4668, 5275, 5861, 6431, 6983, 7520, 8042, 8555, 9055, 9547, 10036, 10516, 10996, 11475, 11951, 
-    12431, 12917, 13397, 13898, 14388, 14900, 15401, 15925, 16437, 16968, 17496, 18028, 18566, 19096, 19615, 19620, 
-    19613, 19619, 19615, 19617, 19617, 19617, 19615, 19617, 19616, 19615, 19617, 19615, 19618, 19616, 19616, 19618, 
-    19613, 19620, 19613, 19620, 19614, 19621, 19613, 19620, 19615, 19617, 19617, 19614, 19618, 19615, 19617, 19615, 
-    19619, 19614, 19619, 19614, 19618, 19616, 19617, 19617, 19616, 19617, 19485, 19068, 18636, 18180, 17707, 17205, 
-    16680, 16126, 15546, 14932, 14295, 13618, 12922, 12190, 11439, 10658, 9853, 9033, 8183, 7334, 6458, 5587, 
-    4703, 3825, 2947, 2082, 1226, 382, -440, -1246, -2029, -2783, -3519, -4223, -4904, -5551, -6182, -6775, 
-    -7359, -7907, -8453, -8966, -9481, -9970, -10461, -10940, -11413, -11889, -12351, -12828, -13287, -13763, -14223, -14692, 
-    -15155, -15618, -16077, -16534, -16979, -17423, -17851, -18271, -18676, -19065, -19439, -19652, -19654, -19654, -19653, -19655, 
-    -19651, -19655, -19652, -19654, -19654, -19652, -19654, -19652, -19654, -19653, -19654, -19654, -19654, -19654, -19654, -19655, 
-    -19653, -19654, -19654, -19653, -19655, -19654, -19654, -19654, -19654, -19654, -19655, -19652, -19654, -19611, -19332, -19046, 
-    -18727, -18405, -18053, -17686, -17297, -16889, -16454, -15999, -15519, -15016, -14491, -13941, -13368, -12774, -12158, -11520, 
-    -10868, -10193, -9510, -8808, -8102, -7386, -6663, -5939, -5211, -4487, -3759, -3043, -2325, -1621, -924, -232, 
-    440, 1111, 1769, 2414, 3054, 3677, 4299, 4903, 5507, 6093, 6682, 7250, 7828, 8386, 8948, 9495, 
-    10045, 10581, 11112, 11635, 12146, 12650, 13139, 13620, 14081, 14534, 14964, 15381, 15781, 16160, 16520, 16861, 
-    17176, 17476, 17750, 18000, 18236, 18438, 18631, 18787, 18940, 19055, 19166, 19243, 19314, 19356, 19391, 19399, 
-    19399, 19378, 19341, 19292, 19222, 19148, 19048, 18944, 18828, 18691, 18559, 18396, 18238, 18057, 17872, 17674, 
-    17464, 17247, 17019, 16779, 16539, 16280, 16024, 15753, 15482, 15198, 14916, 14618, 14326, 14015, 13712, 13389, 
-    13070, 12737, 12401, 12051, 11699, 11333, 10961, 10580, 10183, 9784, 9365, 8948, 8507, 8067, 7606, 7140, 
-    6659, 6164, 5663, 5143, 4618, 4076, 3523, 2961, 2385, 1806, 1212, 614, 6, -599, -1221, -1834, 
-    -2458, -3080, -3696, -4319, -4929, -5538, -6139, -6728, -7310, -7876, -8431, -8972, -9495, -10002, -10491, -10963, 
-    -11415, -11852, -12261, -12662, -13037, -13395, -13738, -14057, -14371, -14655, -14942, -15201, -15455, -15698, -15923, -16145, 
-    -16353, -16550, -16740, -16919, -17085, -17244, -17387, -17519, -17633, -17736, -17816, -17884, -17926, -17952, -17954, -17930, 
-    -17888, -17816, -17724, -17605, -17466, -17299, -17116, -16910, -16687, -16445, -16192, -15925, -15641, -15357, -15058, -14758, 
-    -14457, -14153, -13848, -13558, -13253, -12975, -12685, -12415, -12140, -11883, -11619, -11370, -11116, -10868, -10617, -10366, 
-    -10111, -9842, -9574, -9285, -8990, -8679, -8351, -8004, -7643, -7258, -6854, -6435, -5992, -5536, -5062, -4577, 
-    -4074, -3565, -3042, -2516, -1983, -1448, -911, -375, 153, 682, 1200, 1708, 2210, 2692, 3165, 3630, 
-    4069, 4510, 4926, 5333, 5734, 6110, 6489, 6843, 7201, 7531, 7875, 8187, 8508, 8816, 9116, 9415, 
-    9706, 9989, 10277, 10548, 10831, 11090, 11363, 11613, 11872, 12115, 12356, 12589, 12817, 13034, 13250, 13449, 
-    13644, 13829, 13995, 14156, 14296, 14421, 14530, 14622, 14690, 14744, 14770, 14783, 14766, 14735, 14673, 14603, 
-    14499, 14387, 14247, 14093, 13924, 13734, 13540, 13323, 13101, 12864, 12620, 12369, 12107, 11842, 11566, 11292, 
-    11006, 10729, 10436, 10158, 9866, 9590, 9299, 9024, 8736, 8462, 8181, 7905, 7629, 7355, 7083, 6809, 
-    6540, 6268, 6004, 5733, 5470, 5204, 4943, 4684, 4424, 4166, 3915, 3658, 3412, 3161, 2914, 2667, 
-    2424, 2173, 1932, 1680, 1435, 1185, 934, 683, 430, 174, -80, -345, -601, -874, -1129, -1409, 
-    -1665, -1950, -2208, -2490, -2759, -3034, -3312, -3587, -3864, -4142, -4418, -4696, -4977, -5253, -5534, -5809, 
-    -6089, -6360, -6637, -6901, -7170, -7429, -7684, -7934, -8174, -8409, -8630, -8849, -9044, -9240, -9411, -9579, 
-    -9722, -9859, -9972, -10078, -10162, -10236, -10290, -10332, -10362, -10371, -10377, -10359, -10343, -10301, -10266, -10207, 
-    -10147, -10085, -10002, -9932, -9843, -9757, -9671, -9573, -9484, -9385, -9283, -9189, -9076, -8977, -8860, -8746, 
-    -8623, -8495, -8355, -8209, -8052, -7880, -7705, -7506, -7306, -7088, -6865, -6628, -6382, -6133, -5872, -5612, 
-    -5343, -5075, -4806, -4538, -4272, -4014, -3755, -3515, -3274, -3056, -2841, -2646, -2464, -2298, -2147, -2019, 
-    -1897, -1804, -1714, -1652, -1590, -1555, -1516, -1500, -1478, -1474, -1461, -1457, -1448, -1436, -1420, -1397, 
-    -1366, -1326, -1278, -1216, -1151, -1065, -977, -872, -757, -639, -498, -362, -204, -51, 115, 283, 
-    459, 636, 823, 1002, 1193, 1378, 1568, 1754, 1944, 2123, 2315, 2488, 2676, 2846, 3029, 3198, 
-    3376, 3545, 3720, 3893, 4065, 4243, 4418, 4593, 4774, 4952, 5132, 5311, 5492, 5667, 5841, 6015, 
-    6175, 6340, 6488, 6628, 6764, 6877, 6984, 7074, 7146, 7206, 7244, 7265, 7270, 7253, 7226, 7174, 
-    7112, 7032, 6939, 6835, 6719, 6596, 6467, 6334, 6198, 6060, 5925, 5795, 5663, 5548, 5431, 5330, 
-    5235, 5155, 5081, 5024, 4978, 4939, 4921, 4905, 4904, 4912, 4922, 4945, 4967, 4992, 5022, 5040, 
-    5068, 5079, 5091, 5093, 5082, 5066, 5034, 4992, 4934, 4865, 4776, 4682, 4565, 4441, 4301, 4151, 
-    3989, 3817, 3638, 3448, 3257, 3054, 2854, 2649, 2439, 2242, 2029, 1843, 1642, 1462, 1286, 1118, 
-    965, 819, 687, 566, 457, 362, 275, 201, 136, 78, 30, -16, -55, -91, -129, -162, 
-    -198, -236, -277, -327, -380, -441, -512, -589, -675, -777, -874, -999, -1116, -1251, -1390, -1535, 
-    -1683, -1844, -1992, -2154, -2305, -2455, -2607, -2741, -2878, -2998, -3117, -3217, -3314, -3392, -3471, -3523, 
-    -3587, -3613, -3659, -3671, -3697, -3702, -3717, -3715, -3727, -3725, -3737, -3745, -3760, -3782, -3803, -3840, 
-    -3877, -3922, -3980, -4036, -4109, -4184, -4264, -4356, -4443, -4543, -4640, -4737, -4838, -4937, -5027, -5121, 
-    -5204, -5280, -5357, -5414, -5469, -5514, -5544, -5568, -5583, -5580, -5581, -5560, -5544, -5515, -5480, -5450, 
-    -5402, -5367, -5318, -5277, -5236, -5188, -5152, -5114, -5074, -5052, -5011, -4998, -4968, -4959, -4936, -4933, 
-    -4917, -4916, -4912, -4905, -4910, -4902, -4905, -4902, -4896, -4891, -4879, -4867, -4850, -4826, -4801, -4765, 
-    -4731, -4680, -4638, -4566, -4511, -4424, -4350, -4249, -4153, -4033, -3920, -3782, -3646, -3493, -3334, -3165, 
-    -2988, -2804, -2609, -2410, -2200, -1984, -1764, -1537, -1306, -1073, -836, -596, -360, -116, 118, 354, 
-    588, 813, 1039, 1253, 1467, 1668, 1868, 2057, 2237, 2415, 2580, 2739, 2899, 3041, 3192, 3328, 
-    3466, 3601, 3731, 3866, 3994, 4130, 4260, 4396, 4531, 4671, 4806, 4952, 5089, 5235, 5381, 5523, 
-    5670, 5811, 5953, 6095, 6229, 6369, 6495, 6629, 6747, 6871, 6986, 7095, 7205, 7303, 7401, 7494, 
-    7579, 7666, 7743, 7824, 7896, 7970, 8040, 8106, 8176, 8237, 8302, 8361, 8420, 8475, 8530, 8578, 
-    8624, 8664, 8699, 8724, 8741, 8754, 8745, 8740, 8709, 8678, 8627, 8563, 8489, 8392, 8287, 8162, 
-    8020, 7868, 7695, 7511, 7312, 7096, 6876, 6627, 6388, 6116, 5853, 5567, 5284, 4984, 4691, 4379, 
-    4076, 3762, 3450, 3140, 2825, 2523, 2214, 1916, 1619, 1327, 1043, 763, 491, 223, -31, -285, 
-    -528, -763, -993, -1212, -1423, -1629, -1823, -2014, -2189, -2364, -2525, -2685, -2832, -2974, -3110, -3238, 
-    -3364, -3483, -3595, -3711, -3811, -3921, -4019, -4114, -4212, -4301, -4390, -4479, -4559, -4643, -4720, -4795, 
-    -4867, -4931, -5003, -5054, -5120, -5170, -5222, -5274, -5314, -5362, -5397, -5439, -5472, -5509, -5542, -5575, 
-    -5610, -5639, -5680, -5708, -5746, -5783, -5816, -5865, -5898, -5945, -5988, -6032, -6081, -6126, -6172, -6219, 
-    -6262, -6307, -6347, -6386, -6423, -6454, -6484, -6508, -6528, -6544, -6551, -6559, -6551, -6552, -6531, -6518, 
-    -6494, -6460, -6435, -6386, -6351, -6299, -6249, -6196, -6133, -6077, -6007, -5941, -5872, -5795, -5725, -5642, 
-    -5569, -5477, -5405, -5306, -5224, -5127, -5028, -4931, -4822, -4714, -4596, -4480, -4352, -4227, -4087, -3950, 
-    -3795, -3646, -3472, -3310, -3124, -2943, -2745, -2545, -2335, -2123, -1901, -1679, -1452, -1220, -989, -753, 
-    -520, -287, -55, 170, 395, 612, 823, 1029, 1218, 1409, 1578, 1745, 1899, 2037, 2171, 2286, 
-    2393, 2489, 2568, 2648, 2704, 2763, 2803, 2841, 2876, 2895, 2922, 2936, 2954, 2968, 2987, 2999, 
-    3024, 3039, 3069, 3097, 3130, 3169, 3212, 3259, 3313, 3373, 3434, 3506, 3575, 3650, 3731, 3809, 
-    3890, 3974, 4051, 4134, 4214, 4289, 4365, 4439, 4505, 4578, 4640, 4703, 4764, 4815, 4877, 4918, 
-    4977, 5016, 5069, 5108, 5159, 5198, 5247, 5297, 5341, 5400, 5450, 5513, 5573, 5640, 5709, 5783, 
-    5861, 5940, 6023, 6108, 6196, 6280, 6370, 6448, 6536, 6610, 6685, 6754, 6811, 6867, 6909, 6944, 
-    6966, 6979, 6980, 6970, 6943, 6906, 6854, 6790, 6715, 6623, 6522, 6408, 6284, 6147, 6004, 5845, 
-    5685, 5510, 5334, 5145, 4957, 4757, 4554, 4352, 4139, 3932, 3716, 3506, 3288, 3078, 2860, 2654, 
-    2438, 2237, 2031, 1833, 1642, 1450, 1271, 1095, 927, 767, 613, 469, 332, 205, 85, -22, 
-    -127, -219, -306, -382, -453, -519, -576, -631, -683, -727, -781, -821, -874, -920, -975, -1030, 
-    -1092, -1155, -1227, -1302, -1387, -1477, -1576, -1685, -1796, -1922, -2046, -2190, -2327, -2482, -2636, -2798, 
-    -2967, -3135, -3311, -3486, -3670, -3848, -4033, -4217, -4397, -4588, -4764, -4952, -5127, -5309, -5486, -5663, 
-    -5840, -6007, -6184, -6343, -6516, -6670, -6835, -6983, -7136, -7279, -7413, -7551, -7667, -7793, -7895, -7999, 
-    -8090, -8172, -8244, -8308, -8358, -8402, -8436, -8455, -8473, -8473, -8470, -8458, -8434, -8407, -8369, -8324, 
-    -8272, -8215, -8149, -8082, -8005, -7927, -7842, -7754, -7660, -7567, -7466, -7361, -7260, -7144, -7042, -6922, 
-    -6810, -6694, -6577, -6459, -6347, -6220, -6114, -5988, -5879, -5760, -5651, -5535, -5429, -5317, -5213, -5108, 
-    -5008, -4907, -4812, -4712, -4620, -4526, -4433, -4341, -4249, -4152, -4062, -3961, -3864, -3758, -3650, -3537, 
-    -3421, -3297, -3167, -3031, -2888, -2737, -2581, -2414, -2245, -2060, -1877, -1673, -1475, -1258, -1038, -810, 
-    -570, -331, -73, 179, 452, 723, 1004, 1294, 1584, 1885, 2185, 2498, 2805, 3125, 3439, 3763, 
-    4084, 4407, 4733, 5052, 5375, 5693, 6008, 6325, 6628, 6940, 7232, 7535, 7820, 8105, 8383, 8653, 
-    8919, 9176, 9430, 9674, 9915, 10144, 10372, 10595, 10804, 11015, 11210, 11410, 11593, 11777, 11947, 12113, 
-    12276, 12425, 12570, 12708, 12836, 12957, 13074, 13174, 13274, 13356, 13437, 13499, 13557, 13601, 13632, 13655, 
-    13659, 13655, 13636, 13599, 13555, 13488, 13415, 13316, 13214, 13081, 12947, 12782, 12616, 12422, 12224, 12000, 
-    11769, 11525, 11261, 10995, 10707, 10419, 10117, 9806, 9494, 9167, 8846, 8516, 8178, 7850, 7508, 7174, 
-    6839, 6497, 6167, 5828, 5496, 5163, 4829, 4501, 4169, 3840, 3508, 3182, 2850, 2526, 2187, 1866, 
-    1527, 1198, 861, 522, 187, -159, -498, -850, -1197, -1557, -1909, -2282, -2640, -3018, -3395, -3776, 
-    -4167, -4559, -4959, -5363, -5774, -6186, -6606, -7024, -7453, -7873, -8305, -8730, -9154, -9580, -9999, -10414, 
-    -10823, -11224, -11617, -11998, -12373, -12730, -13078, -13411, -13730, -14033, -14323, -14597, -14857, -15097, -15326, -15536, 
-    -15733, -15921, -16083, -16247, -16386, -16523, -16647, -16758, -16864, -16957, -17042, -17118, -17186, -17239, -17290, -17318, 
-    -17349, -17353, -17356, -17335, -17305, -17252, -17188, -17102, -16995, -16871, -16718, -16550, -16354, -16138, -15892, -15629, 
-    -15336, -15024, -14688, -14328, -13952, -13550, -13139, -12698, -12255, -11791, -11319, -10841, -10347, -9861, -9360, -8870, 
-    -8368, -7885, -7384, -6917, -6427, -5967, -5501, -5048, -4606, -4166, -3744, -3318, -2911, -2497, -2101, -1697, 
-    -1305, -904, -512, -111, 288, 692, 1105, 1519, 1944, 2376, 2815, 3262, 3723, 4182, 4662, 5136, 
-    5628, 6117, 6616, 7111, 7611, 8106, 8602, 9086, 9575, 10041, 10508, 10959, 11393, 11823, 12226, 12623, 
-    12995, 13356, 13696, 14019, 14328, 14610, 14888, 15139, 15383, 15606, 15820, 16014, 16206, 16375, 16541, 16690, 
-    16836, 16964, 17095, 17206, 17314, 17414, 17506, 17586, 17666, 17727, 17790, 17830, 17874, 17892, 17911, 17907, 
-    17894, 17862, 17819, 17753, 17674, 17574, 17457, 17319, 17164, 16983, 16792, 16568, 16338, 16076, 15801, 15507, 
-    15191, 14862, 14514, 14151, 13776, 13382, 12982, 12562, 12141, 11703, 11261, 10810, 10353, 9891, 9423, 8958, 
-    8479, 8012, 7530, 7061, 6582, 6112, 5633, 5163, 4690, 4217, 3747, 3277, 2803, 2338, 1861, 1392, 
-    920, 442, -30, -516, -994, -1483, -1972, -2463, -2963, -3462, -3962, -4475, -4978, -5495, -6003, -6519, 
-    -7029, -7543, -8051, -8557, -9058, -9555, -10040, -10524, -10990, -11453, -11900, -12335, -12751, -13161, -13542, -13914, 
-    -14266, -14595, -14910, -15204, -15476, -15729, -15965, -16174, -16374, -16545, -16705, -16847, -16964, -17081, -17162, -17252, 
-    -17303, -17363, -17392, -17423, -17431, -17435, -17422, -17404, -17370, -17330, -17278, -17218, -17148, -17067, -16979, -16883, 
-    -16773, -16659, -16528, -16394, -16244, -16085, -15916, -15726, -15539, -15322, -15106, -14867, -14618, -14354, -14078, -13786, 
-    -13479, -13157, -12823, -12469, -12105, -11719, -11324, -10908, -10480, -10037, -9576, -9107, -8618, -8122, -7610, -7090, 
-    -6559, -6021, -5474, -4922, -4365, -3807, -3245, -2682, -2123, -1560, -1008, -452, 94, 639, 1173, 1704, 
-    2225, 2738, 3239, 3737, 4217, 4696, 5158, 5607, 6054, 6476, 6906, 7308, 7713, 8098, 8479, 8851, 
-    9211, 9567, 9912, 10249, 10583, 10900, 11222, 11523, 11829, 12116, 12400, 12677, 12943, 13200, 13452, 13685, 
-    13920, 14131, 14344, 14531, 14719, 14884, 15038, 15180, 15305, 15418, 15515, 15598, 15661, 15723, 15753, 15787, 
-    15789, 15794, 15772, 15751, 15704, 15656, 15587, 15517, 15424, 15334, 15221, 15110, 14979, 14847, 14700, 14546, 
-    14382, 14205, 14020, 13826, 13614, 13397, 13163, 12917, 12658, 12385, 12095, 11792, 11474, 11138, 10788, 10424, 
-    10040, 9648, 9232, 8805, 8370, 7909, 7450, 6966, 6480, 5980, 5473, 4957, 4435, 3906, 3373, 2833, 
-    2294, 1747, 1206, 655, 117, -433, -969, -1514, -2047, -2578, -3110, -3624, -4151, -4652, -5164, -5657, 
-    -6150, -6630, -7105, -7569, -8026, -8469, -8907, -9328, -9742, -10140, -10526, -10896, -11253, -11593, -11916, -12222, 
-    -12511, -12780, -13033, -13262, -13475, -13667, -13840, -13995, -14126, -14242, -14340, -14418, -14481, -14529, -14558, -14578, 
-    -14577, -14571, -14546, -14513, -14470, -14414, -14352, -14282, -14201, -14120, -14023, -13928, -13818, -13710, -13587, -13467, 
-    -13323, -13189, -13030, -12871, -12698, -12511, -12319, -12104, -11882, -11641, -11385, -11118, -10826, -10528, -10201, -9872, 
-    -9518, -9155, -8775, -8384, -7979, -7570, -7141, -6715, -6274, -5828, -5383, -4928, -4476, -4023, -3564, -3119, 
-    -2660, -2222, -1771, -1339, -903, -475, -55, 362, 771, 1177, 1573, 1970, 2356, 2741, 3125, 3497, 
-    3877, 4245, 4616, 4984, 5349, 5711, 6073, 6429, 6787, 7141, 7486, 7834, 8168, 8507, 8833, 9154, 
-    9466, 9771, 10065, 10352, 10624, 10893, 11139, 11381, 11607, 11815, 12018, 12195, 12368, 12515, 12659, 12770, 
-    12885, 12966, 13044, 13100, 13144, 13169, 13183, 13179, 13164, 13136, 13088, 13037, 12961, 12887, 12789, 12687, 
-    12568, 12441, 12307, 12155, 12006, 11829, 11667, 11468, 11288, 11074, 10870, 10644, 10417, 10179, 9928, 9674, 
-    9407, 9136, 8851, 8559, 8258, 7948, 7631, 7301, 6965, 6622, 6268, 5908, 5540, 5162, 4780, 4389, 
-    3992, 3590, 3179, 2770, 2346, 1933, 1500, 1086, 650, 232, -199, -619, -1045, -1465, -1881, -2297, 
-    -2704, -3113, -3508, -3908, -4288, -4677, -5044, -5416, -5771, -6125, -6468, -6799, -7128, -7439, -7749, -8044, 
-    -8333, -8611, -8878, -9143, -9388, -9638, -9866, -10097, -10312, -10526, -10730, -10924, -11114, -11295, -11466, -11636, 
-    -11791, -11948, -12087, -12230, -12354, -12480, -12594, -12695, -12799, -12877, -12965, -13027, -13089, -13136, -13167, -13200, 
-    -13201, -13208, -13188, -13161, -13119, -13057, -12986, -12896, -12789, -12669, -12529, -12374, -12202, -12015, -11805, -11586, 
-    -11344, -11082, -10815, -10518, -10214, -9891, -9553, -9198, -8837, -8448, -8063, -7657, -7245, -6823, -6394, -5958, 
-    -5519, -5073, -4632, -4181, -3737, -3294, -2847, -2421, -1979, -1562, -1138, -728, -320, 71, 467, 845, 
-    1222, 1590, 1948, 2304, 2653, 2995, 3335, 3669, 4002, 4330, 4660, 4982, 5309, 5629, 5953, 6270, 
-    6596, 6902, 7225, 7532, 7836, 8144, 8429, 8728, 9001, 9280, 9539, 9793, 10033, 10261, 10477, 10679, 
-    10870, 11043, 11206, 11350, 11486, 11601, 11712, 11799, 11882, 11947, 11998, 12047, 12074, 12103, 12113, 12119, 
-    12120, 12108, 12098, 12072, 12053, 12012, 11988, 11938, 11903, 11850, 11803, 11749, 11691, 11633, 11566, 11502, 
-    11428, 11353, 11274, 11183, 11097, 10995, 10891, 10780, 10655, 10529, 10386, 10237, 10076, 9902, 9720, 9520, 
-    9308, 9084, 8843, 8590, 8318, 8035, 7736, 7421, 7094, 6750, 6396, 6025, 5647, 5250, 4851, 4435, 
-    4014, 3585, 3146, 2708, 2258, 1811, 1360, 907, 458, 8, -438, -883, -1317, -1756, -2178, -2605, 
-    -3013, -3424, -3817, -4212, -4589, -4963, -5328, -5678, -6026, -6358, -6687, -7001, -7308, -7604, -7893, -8172, 
-    -8444, -8700, -8960, -9196, -9440, -9662, -9886, -10093, -10306, -10494, -10693, -10866, -11047, -11208, -11372, -11519, 
-    -11661, -11798, -11914, -12037, -12135, -12232, -12319, -12388, -12459, -12504, -12556, -12579, -12605, -12614, -12609, -12601, 
-    -12568, -12534, -12481, -12418, -12342, -12256, -12152, -12048, -11918, -11789, -11646, -11486, -11331, -11150, -10973, -10783, 
-    -10580, -10378, -10158, -9936, -9705, -9465, -9219, -8966, -8702, -8437, -8162, -7884, -7600, -7313, -7020, -6727, 
-    -6425, -6133, -5822, -5528, -5217, -4916, -4607, -4307, -3996, -3696, -3389, -3083, -2783, -2474, -2177, -1868, 
-    -1571, -1263, -963, -661, -355, -57, 249, 551, 854, 1158, 1459, 1763, 2065, 2364, 2664, 2957, 
-    3253, 3539, 3829, 4107, 4386, 4656, 4920, 5181, 5433, 5681, 5918, 6149, 6376, 6590, 6800, 7003, 
-    7194, 7384, 7565, 7735, 7907, 8067, 8224, 8378, 8522, 8668, 8804, 8940, 9068, 9196, 9312, 9433, 
-    9541, 9648, 9753, 9838, 9935, 10012, 10087, 10156, 10212, 10259, 10307, 10329, 10358, 10361, 10361, 10351, 
-    10320, 10294, 10234, 10182, 10104, 10021, 9921, 9813, 9687, 9557, 9409, 9256, 9089, 8917, 8733, 8548, 
-    8349, 8154, 7943, 7742, 7522, 7314, 7097, 6879, 6667, 6446, 6233, 6017, 5803, 5593, 5377, 5169, 
-    4955, 4747, 4539, 4327, 4117, 3906, 3694, 3482, 3263, 3045, 2825, 2602, 2374, 2144, 1911, 1675, 
-    1431, 1193, 942, 697, 443, 193, -62, -309, -565, -811, -1061, -1302, -1541, -1774, -2002, -2224, 
-    -2435, -2644, -2842, -3034, -3214, -3392, -3554, -3716, -3861, -4008, -4136, -4268, -4381, -4494, -4603, -4698, 
-    -4793, -4881, -4959, -5044, -5111, -5184, -5246, -5308, -5365, -5421, -5467, -5516, -5558, -5596, -5634, -5660, 
-    -5690, -5711, -5729, -5740, -5750, -5750, -5754, -5744, -5735, -5720, -5704, -5681, -5661, -5630, -5606, -5571, 
-    -5544, -5509, -5478, -5445, -5409, -5379, -5338, -5311, -5268, -5239, -5200, -5160, -5130, -5084, -5046, -5009, 
-    -4959, -4921, -4871, -4822, -4773, -4719, -4665, -4606, -4548, -4482, -4424, -4352, -4288, -4218, -4146, -4075, 
-    -4001, -3926, -3854, -3776, -3702, -3628, -3552, -3478, -3404, -3328, -3257, -3181, -3113, -3037, -2969, -2898, 
-    -2829, -2759, -2691, -2619, -2552, -2478, -2409, -2333, -2263, -2183, -2108, -2026, -1942, -1860, -1770, -1684, 
-    -1588, -1498, -1395, -1302, -1192, -1094, -981, -876, -762, -649, -533, -417, -298, -180, -59, 61, 
-    176, 298, 413, 530, 640, 753, 858, 962, 1061, 1154, 1251, 1331, 1423, 1494, 1572, 1642, 
-    1707, 1771, 1827, 1883, 1933, 1981, 2027, 2069, 2110, 2150, 2187, 2226, 2262, 2298, 2335, 2369, 
-    2407, 2442, 2481, 2515, 2556, 2591, 2632, 2670, 2708, 2751, 2785, 2829, 2860, 2908, 2934, 2978, 
-    3010, 3043, 3082, 3109, 3146, 3178, 3208, 3240, 3268, 3304, 3325, 3367, 3382, 3427, 3448, 3484, 
-    3515, 3546, 3585, 3616, 3660, 3697, 3741, 3788, 3834, 3890, 3944, 4000, 4067, 4128, 4201, 4268, 
-    4345, 4420, 4497, 4573, 4652, 4728, 4803, 4875, 4945, 5013, 5071, 5136, 5179, 5235, 5266, 5307, 
-    5327, 5350, 5353, 5363, 5346, 5338, 5311, 5273, 5241, 5180, 5129, 5059, 4984, 4906, 4814, 4721, 
-    4620, 4510, 4399, 4278, 4155, 4031, 3893, 3766, 3620, 3484, 3338, 3192, 3044, 2888, 2741, 2578, 
-    2430, 2266, 2111, 1949, 1789, 1628, 1465, 1307, 1142, 986, 819, 667, 504, 349, 195, 39, 
-    -109, -261, -408, -555, -699, -839, -981, -1113, -1255, -1377, -1511, -1632, -1756, -1874, -1987, -2103, 
-    -2207, -2317, -2418, -2514, -2613, -2702, -2794, -2878, -2963, -3041, -3116, -3193, -3260, -3331, -3397, -3458, 
-    -3525, -3580, -3646, -3700, -3764, -3819, -3882, -3943, -4004, -4068, -4136, -4203, -4276, -4354, -4424, -4515, 
-    -4591, -4684, -4771, -4869, -4959, -5064, -5161, -5263, -5371, -5472, -5583, -5686, -5792, -5900, -5998, -6106, 
-    -6196, -6299, -6384, -6478, -6554, -6638, -6704, -6774, -6833, -6887, -6933, -6972, -7004, -7028, -7044, -7052, 
-    -7048, -7041, -7018, -6993, -6951, -6905, -6845, -6778, -6698, -6609, -6509, -6399, -6278, -6149, -6003, -5859, 
-    -5694, -5529, -5348, -5161, -4973, -4767, -4564, -4346, -4131, -3908, -3683, -3456, -3224, -2996, -2763, -2532, 
-    -2307, -2076, -1854, -1630, -1413, -1202, -991, -787, -585, -390, -200, -11, 170, 352, 525, 701, 
-    868, 1039, 1202, 1370, 1529, 1696, 1854, 2016, 2181, 2335, 2504, 2658, 2823, 2979, 3141, 3295, 
-    3456, 3607, 3763, 3911, 4059, 4202, 4342, 4477, 4607, 4736, 4848, 4976, 5072, 5185, 5280, 5372, 
-    5462, 5543, 5622, 5695, 5768, 5830, 5900, 5958, 6019, 6079, 6136, 6195, 6252, 6311, 6369, 6426, 
-    6488, 6546, 6605, 6669, 6723, 6788, 6845, 6904, 6962, 7017, 7073, 7124, 7173, 7221, 7260, 7305, 
-    7332, 7368, 7386, 7409, 7415, 7425, 7415, 7411, 7384, 7360, 7320, 7275, 7217, 7154, 7077, 6994, 
-    6898, 6791, 6681, 6550, 6418, 6274, 6113, 5956, 5775, 5597, 5402, 5204, 4996, 4780, 4562, 4332, 
-    4101, 3864, 3622, 3378, 3128, 2881, 2626, 2370, 2119, 1857, 1609, 1347, 1094, 839, 589, 337, 
-    88, -153, -400, -633, -873, -1099, -1328, -1545, -1762, -1972, -2173, -2373, -2560, -2745, -2920, -3091, 
-    -3251, -3406, -3551, -3690, -3818, -3943, -4050, -4165, -4252, -4348, -4427, -4500, -4570, -4630, -4682, -4731, 
-    -4774, -4810, -4844, -4871, -4895, -4918, -4935, -4952, -4966, -4979, -4989, -5001, -5007, -5017, -5025, -5029, 
-    -5038, -5042, -5045, -5053, -5052, -5056, -5057, -5054, -5058, -5048, -5050, -5036, -5029, -5016, -4999, -4981, 
-    -4959, -4929, -4902, -4863, -4828, -4778, -4733, -4675, -4618, -4552, -4488, -4410, -4340, -4256, -4172, -4090, 
-    -4000, -3912, -3824, -3729, -3644, -3550, -3467, -3377, -3291, -3212, -3127, -3055, -2975, -2907, -2833, -2770, 
-    -2704, -2639, -2582, -2517, -2465, -2401, -2348, -2286, -2226, -2170, -2099, -2041, -1963, -1896, -1817, -1735, 
-    -1649, -1555, -1461, -1356, -1251, -1136, -1022, -901, -775, -652, -518, -391, -259, -126, 0, 134, 
-    255, 383, 501, 619, 730, 839, 937, 1035, 1125, 1208, 1284, 1356, 1417, 1477, 1529, 1572, 
-    1614, 1647, 1676, 1702, 1718, 1736, 1747, 1752, 1760, 1759, 1757, 1758, 1745, 1744, 1729, 1721, 
-    1706, 1693, 1677, 1660, 1644, 1625, 1609, 1589, 1573, 1555, 1541, 1523, 1515, 1499, 1493, 1485, 
-    1481, 1479, 1481, 1483, 1490, 1503, 1512, 1530, 1551, 1568, 1594, 1625, 1646, 1689, 1712, 1753, 
-    1787, 1825, 1862, 1903, 1938, 1979, 2015, 2050, 2090, 2118, 2154, 2185, 2210, 2241, 2262, 2286, 
-    2311, 2327, 2353, 2366, 2391, 2405, 2428, 2447, 2467, 2492, 2512, 2544, 2566, 2602, 2632, 2671, 
-    2704, 2749, 2787, 2836, 2881, 2928, 2976, 3028, 3073, 3126, 3170, 3214, 3259, 3298, 3336, 3366, 
-    3396, 3419, 3437, 3452, 3458, 3459, 3462, 3445, 3440, 3417, 3395, 3372, 3337, 3306, 3264, 3228, 
-    3179, 3138, 3087, 3041, 2988, 2941, 2886, 2840, 2785, 2741, 2688, 2640, 2598, 2543, 2508, 2455, 
-    2417, 2375, 2330, 2295, 2250, 2214, 2176, 2136, 2101, 2063, 2023, 1987, 1947, 1906, 1868, 1824, 
-    1780, 1737, 1683, 1642, 1583, 1532, 1473, 1412, 1347, 1284, 1203, 1138, 1048, 974, 881, 788, 
-    696, 586, 491, 372, 263, 137, 18, -113, -245, -382, -524, -668, -816, -971, -1125, -1280, 
-    -1445, -1601, -1771, -1930, -2096, -2262, -2425, -2590, -2754, -2914, -3078, -3233, -3395, -3548, -3704, -3856, 
-    -4004, -4152, -4295, -4435, -4574, -4707, -4836, -4966, -5085, -5206, -5322, -5431, -5544, -5640, -5750, -5838, 
-    -5943, -6023, -6120, -6198, -6283, -6364, -6435, -6513, -6583, -6647, -6717, -6771, -6834, -6888, -6937, -6985, 
-    -7027, -7066, -7098, -7127, -7147, -7166, -7174, -7176, -7168, -7157, -7135, -7104, -7065, -7015, -6959, -6889, 
-    -6811, -6725, -6625, -6521, -6402, -6275, -6145, -5995, -5851, -5683, -5523, -5347, -5170, -4987, -4800, -4605, 
-    -4417, -4214, -4023, -3819, -3624, -3420, -3226, -3022, -2830, -2632, -2437, -2247, -2054, -1868, -1681, -1498, 
-    -1317, -1138, -964, -785, -619, -443, -284, -111, 47, 215, 370, 538, 689, 860, 1006, 1179, 
-    1329, 1497, 1657, 1822, 1990, 2161, 2329, 2514, 2685, 2879, 3064, 3261, 3459, 3669, 3874, 4099, 
-    4315, 4544, 4776, 5009, 5250, 5494, 5733, 5985, 6228, 6476, 6721, 6966, 7202, 7448, 7667, 7908, 
-    8116, 8341, 8540, 8745, 8931, 9116, 9286, 9450, 9604, 9744, 9880, 9999, 10110, 10214, 10301, 10381, 
-    10453, 10507, 10559, 10594, 10619, 10641, 10642, 10643, 10626, 10605, 10568, 10526, 10469, 10408, 10331, 10247, 
-    10154, 10047, 9933, 9809, 9673, 9533, 9380, 9220, 9051, 8875, 8689, 8497, 8295, 8090, 7872, 7651, 
-    7423, 7182, 6947, 6686, 6439, 6170, 5901, 5626, 5339, 5057, 4760, 4459, 4159, 3843, 3535, 3213, 
-    2893, 2569, 2241, 1912, 1580, 1253, 915, 590, 253, -71, -399, -725, -1047, -1365, -1680, -1990, 
-    -2299, -2597, -2900, -3187, -3480, -3761, -4040, -4314, -4588, -4848, -5116, -5369, -5626, -5877, -6126, -6369, 
-    -6617, -6852, -7092, -7327, -7558, -7787, -8014, -8232, -8460, -8664, -8882, -9083, -9285, -9483, -9669, -9853, 
-    -10030, -10197, -10362, -10512, -10660, -10793, -10926, -11040, -11152, -11249, -11340, -11422, -11490, -11551, -11602, -11639, 
-    -11674, -11689, -11702, -11702, -11689, -11671, -11640, -11600, -11551, -11494, -11421, -11350, -11254, -11167, -11052, -10943, 
-    -10814, -10682, -10538, -10386, -10222, -10052, -9873, -9683, -9489, -9279, -9069, -8846, -8619, -8383, -8139, -7894, 
-    -7633, -7378, -7103, -6835, -6553, -6270, -5980, -5686, -5384, -5083, -4772, -4455, -4143, -3813, -3493, -3155, 
-    -2822, -2481, -2138, -1788, -1436, -1082, -720, -362, 5, 371, 741, 1113, 1487, 1858, 2232, 2611, 
-    2976, 3358, 3723, 4093, 4460, 4820, 5182, 5532, 5886, 6223, 6563, 6889, 7214, 7524, 7832, 8125, 
-    8417, 8692, 8962, 9220, 9467, 9707, 9935, 10152, 10359, 10553, 10738, 10911, 11078, 11222, 11369, 11491, 
-    11613, 11715, 11811, 11891, 11966, 12021, 12075, 12108, 12136, 12154, 12154, 12158, 12134, 12117, 12078, 12038, 
-    11984, 11922, 11851, 11772, 11681, 11588, 11475, 11370, 11237, 11111, 10970, 10817, 10663, 10493, 10318, 10135, 
-    9940, 9738, 9530, 9305, 9084, 8841, 8600, 8345, 8086, 7819, 7544, 7262, 6977, 6684, 6389, 6085, 
-    5783, 5473, 5167, 4850, 4542, 4221, 3912, 3593, 3280, 2967, 2650, 2342, 2027, 1716, 1405, 1096, 
-    786, 477, 170, -139, -444, -752, -1065, -1366, -1681, -1983, -2294, -2601, -2905, -3215, -3515, -3822, 
-    -4119, -4418, -4710, -5003, -5286, -5570, -5842, -6113, -6376, -6626, -6882, -7112, -7350, -7567, -7781, -7984, 
-    -8178, -8358, -8538, -8695, -8856, -8997, -9135, -9261, -9378, -9489, -9588, -9683, -9767, -9842, -9916, -9973, 
-    -10034, -10078, -10121, -10154, -10183, -10204, -10216, -10224, -10219, -10214, -10193, -10172, -10133, -10096, -10039, -9981, 
-    -9911, -9827, -9738, -9637, -9524, -9405, -9272, -9128, -8980, -8814, -8645, -8464, -8273, -8075, -7870, -7652, 
-    -7433, -7203, -6968, -6726, -6484, -6229, -5978, -5715, -5456, -5190, -4925, -4653, -4383, -4112, -3836, -3565, 
-    -3289, -3015, -2742, -2465, -2192, -1921, -1646, -1378, -1106, -843, -572, -316, -47, 201, 465, 710, 
-    965, 1206, 1449, 1688, 1920, 2155, 2379, 2603, 2824, 3035, 3253, 3455, 3667, 3860, 4066, 4251, 
-    4447, 4630, 4813, 4994, 5165, 5338, 5505, 5665, 5828, 5979, 6132, 6275, 6418, 6550, 6682, 6807, 
-    6923, 7036, 7140, 7240, 7327, 7415, 7485, 7554, 7612, 7663, 7703, 7738, 7760, 7777, 7782, 7783, 
-    7769, 7754, 7726, 7690, 7650, 7599, 7542, 7476, 7406, 7325, 7246, 7150, 7058, 6954, 6849, 6736, 
-    6622, 6498, 6375, 6245, 6110, 5976, 5829, 5690, 5534, 5389, 5226, 5073, 4906, 4741, 4573, 4397, 
-    4225, 4045, 3863, 3681, 3491, 3305, 3109, 2916, 2716, 2519, 2311, 2109, 1898, 1688, 1474, 1260, 
-    1040, 824, 602, 380, 158, -60, -287, -502, -728, -942, -1160, -1372, -1581, -1787, -1988, -2182, 
-    -2374, -2557, -2733, -2906, -3063, -3224, -3362, -3507, -3631, -3753, -3867, -3967, -4064, -4147, -4228, -4295, 
-    -4358, -4411, -4457, -4495, -4530, -4554, -4577, -4591, -4601, -4606, -4612, -4602, -4604, -4589, -4582, -4565, 
-    -4550, -4531, -4511, -4489, -4465, -4439, -4412, -4387, -4351, -4330, -4288, -4262, -4222, -4185, -4146, -4103, 
-    -4060, -4010, -3961, -3903, -3849, -3782, -3719, -3644, -3568, -3486, -3401, -3305, -3212, -3102, -3002, -2882, 
-    -2770, -2644, -2521, -2389, -2261, -2124, -1990, -1854, -1716, -1583, -1443, -1310, -1177, -1045, -919, -792, 
-    -672, -551, -436, -326, -214, -117, -9, 82, 179, 266, 360, 436, 528, 600, 686, 760, 
-    840, 912, 992, 1068, 1143, 1223, 1296, 1380, 1452, 1539, 1616, 1695, 1780, 1856, 1942, 2021, 
-    2102, 2179, 2258, 2335, 2406, 2479, 2546, 2609, 2668, 2726, 2771, 2822, 2853, 2890, 2911, 2931, 
-    2942, 2943, 2941, 2926, 2910, 2882, 2847, 2809, 2759, 2706, 2649, 2577, 2517, 2432, 2364, 2274, 
-    2195, 2107, 2014, 1931, 1833, 1749, 1651, 1566, 1469, 1381, 1291, 1203, 1117, 1029, 945, 860, 
-    779, 693, 619, 529, 460, 374, 297, 223, 140, 68, -10, -84, -161, -232, -309, -380, 
-    -450, -523, -586, -659, -718, -784, -841, -901, -954, -1008, -1055, -1102, -1148, -1184, -1227, -1259, 
-    -1290, -1323, -1343, -1373, -1388, -1413, -1422, -1441, -1446, -1459, -1462, -1469, -1467, -1469, -1465, -1460, 
-    -1455, -1444, -1436, -1420, -1412, -1390, -1380, -1354, -1339, -1312, -1292, -1264, -1235, -1209, -1173, -1142, 
-    -1107, -1067, -1029, -983, -944, -891, -849, -791, -744, -685, -629, -573, -509, -453, -384, -327, 
-    -260, -197, -129, -67, 4, 58, 139, 189, 268, 321, 393, 449, 517, 573, 640, 695, 
-    760, 814, 877, 934, 996, 1052, 1114, 1170, 1230, 1289, 1346, 1404, 1460, 1518, 1569, 1624, 
-    1672, 1722, 1763, 1810, 1839, 1883, 1903, 1934, 1950, 1968, 1974, 1983, 1981, 1981, 1967, 1961, 
-    1937, 1922, 1900, 1869, 1848, 1812, 1788, 1750, 1725, 1686, 1659, 1629, 1594, 1570, 1537, 1513, 
-    1486, 1460, 1437, 1410, 1387, 1362, 1334, 1308, 1278, 1246, 1212, 1173, 1133, 1085, 1035, 982, 
-    919, 856, 786, 709, 635, 543, 461, 364, 270, 170, 67, -32, -142, -246, -353, -463, 
-    -567, -675, -777, -881, -982, -1080, -1178, -1267, -1362, -1443, -1533, -1608, -1690, -1760, -1833, -1901, 
-    -1965, -2030, -2088, -2147, -2200, -2254, -2307, -2354, -2406, -2447, -2498, -2538, -2580, -2621, -2659, -2696, 
-    -2728, -2763, -2786, -2817, -2840, -2853, -2880, -2881, -2899, -2897, -2903, -2895, -2891, -2877, -2862, -2838, 
-    -2817, -2781, -2747, -2710, -2656, -2616, -2556, -2498, -2433, -2364, -2293, -2214, -2137, -2050, -1962, -1874, 
-    -1778, -1683, -1584, -1481, -1378, -1273, -1164, -1057, -946, -836, -722, -610, -495, -379, -267, -146, 
-    -34, 84, 199, 314, 432, 545, 658, 776, 882, 1003, 1105, 1226, 1326, 1440, 1544, 1651, 
-    1755, 1858, 1957, 2055, 2151, 2247, 2334, 2430, 2509, 2599, 2677, 2757, 2830, 2905, 2971, 3041, 
-    3099, 3164, 3215, 3271, 3319, 3364, 3408, 3444, 3482, 3509, 3539, 3560, 3579, 3596, 3604, 3614, 
-    3613, 3614, 3607, 3598, 3581, 3566, 3540, 3515, 3486, 3449, 3412, 3373, 3323, 3280, 3225, 3172, 
-    3117, 3054, 2994, 2929, 2861, 2794, 2722, 2648, 2575, 2495, 2418, 2337, 2253, 2172, 2082, 2001, 
-    1905, 1822, 1727, 1638, 1545, 1450, 1357, 1261, 1164, 1066, 970, 867, 768, 666, 556, 460, 
-    342, 240, 121, 11, -106, -226, -345, -471, -596, -724, -856, -984, -1123, -1255, -1396, -1535, 
-    -1675, -1817, -1959, -2099, -2243, -2383, -2522, -2665, -2794, -2936, -3060, -3196, -3313, -3442, -3550, -3670, 
-    -3769, -3878, -3972, -4063, -4151, -4229, -4305, -4376, -4437, -4497, -4551, -4596, -4644, -4673, -4713, -4735, 
-    -4762, -4772, -4791, -4791, -4799, -4791, -4781, -4772, -4745, -4726, -4693, -4655, -4622, -4564, -4523, -4457, 
-    -4404, -4324, -4262, -4173, -4093, -4003, -3902, -3804, -3691, -3582, -3454, -3336, -3196, -3063, -2916, -2770, 
-    -2613, -2457, -2292, -2125, -1958, -1780, -1608, -1425, -1248, -1063, -884, -697, -519, -334, -156, 23, 
-    197, 375, 537, 714, 867, 1033, 1185, 1337, 1484, 1625, 1765, 1902, 2034, 2160, 2293, 2410, 
-    2540, 2656, 2777, 2899, 3010, 3132, 3244, 3361, 3475, 3588, 3698, 3814, 3918, 4029, 4136, 4238, 
-    4343, 4444, 4535, 4636, 4721, 4811, 4893, 4971, 5045, 5114, 5175, 5238, 5280, 5339, 5364, 5410, 
-    5429, 5451, 5465, 5468, 5471, 5460, 5449, 5422, 5401, 5358, 5322, 5269, 5219, 5156, 5089, 5019, 
-    4938, 4860, 4768, 4680, 4583, 4484, 4381, 4276, 4168, 4054, 3947, 3825, 3714, 3594, 3473, 3354, 
-    3232, 3107, 2982, 2856, 2725, 2599, 2465, 2330, 2193, 2054, 1911, 1767, 1616, 1465, 1306, 1150, 
-    980, 818, 642, 467, 288, 102, -81, -272, -463, -662, -856, -1060, -1257, -1461, -1663, -1862, 
-    -2068, -2263, -2465, -2661, -2854, -3046, -3233, -3419, -3597, -3774, -3941, -4110, -4268, -4422, -4571, -4712, 
-    -4850, -4976, -5102, -5215, -5328, -5429, -5525, -5618, -5696, -5777, -5842, -5908, -5964, -6014, -6056, -6095, 
-    -6125, -6152, -6171, -6184, -6193, -6196, -6194, -6185, -6172, -6154, -6128, -6100, -6065, -6024, -5981, -5925, 
-    -5872, -5804, -5737, -5660, -5577, -5488, -5390, -5291, -5177, -5062, -4939, -4804, -4675, -4522, -4379, -4214, 
-    -4060, -3882, -3715, -3531, -3348, -3158, -2968, -2766, -2573, -2367, -2164, -1961, -1750, -1547, -1338, -1130, 
-    -927, -718, -516, -316, -110, 82, 283, 473, 666, 854, 1041, 1222, 1405, 1578, 1758, 1928, 
-    2095, 2270, 2425, 2599, 2751, 2918, 3068, 3232, 3379, 3539, 3683, 3838, 3984, 4128, 4278, 4413, 
-    4560, 4693, 4831, 4960, 5093, 5212, 5340, 5450, 5565, 5672, 5770, 5868, 5954, 6038, 6111, 6181, 
-    6239, 6295, 6336, 6377, 6404, 6427, 6441, 6445, 6447, 6435, 6425, 6396, 6370, 6330, 6288, 6235, 
-    6182, 6112, 6046, 5968, 5881, 5797, 5696, 5599, 5491, 5378, 5260, 5139, 5007, 4879, 4737, 4597, 
-    4447, 4299, 4140, 3984, 3820, 3649, 3486, 3307, 3132, 2954, 2767, 2584, 2393, 2202, 2007, 1811, 
-    1608, 1407, 1199, 995, 780, 574, 349, 142, -86, -297, -528, -746, -975, -1198, -1422, -1649, 
-    -1871, -2090, -2316, -2523, -2745, -2945, -3157, -3349, -3548, -3731, -3912, -4085, -4251, -4407, -4558, -4698, 
-    -4831, -4954, -5068, -5178, -5271, -5368, -5438, -5524, -5580, -5645, -5694, -5738, -5776, -5811, -5833, -5859, 
-    -5871, -5883, -5892, -5891, -5892, -5884, -5875, -5863, -5844, -5823, -5798, -5768, -5733, -5698, -5651, -5606, 
-    -5551, -5492, -5432, -5356, -5288, -5198, -5119, -5020, -4925, -4818, -4708, -4595, -4470, -4352, -4212, -4085, 
-    -3941, -3799, -3653, -3500, -3348, -3191, -3034, -2871, -2708, -2546, -2377, -2214, -2040, -1876, -1702, -1535, 
-    -1360, -1191, -1013, -843, -664, -489, -309, -131, 53, 230, 419, 601, 789, 977, 1165, 1356, 
-    1545, 1736, 1928, 2115, 2308, 2495, 2680, 2872, 3046, 3235, 3406, 3585, 3753, 3918, 4081, 4241, 
-    4386, 4544, 4675, 4819, 4948, 5073, 5193, 5307, 5410, 5516, 5606, 5698, 5773, 5854, 5915, 5980, 
-    6032, 6077, 6117, 6147, 6172, 6186, 6192, 6193, 6180, 6167, 6134, 6101, 6055, 5997, 5940, 5859, 
-    5784, 5686, 5592, 5481, 5364, 5243, 5108, 4974, 4827, 4677, 4521, 4363, 4194, 4032, 3852, 3685, 
-    3499, 3324, 3140, 2956, 2774, 2584, 2403, 2210, 2031, 1835, 1657, 1463, 1282, 1090, 909, 718, 
-    539, 348, 171, -20, -191, -386, -555, -743, -915, -1098, -1269, -1449, -1617, -1790, -1959, -2123, 
-    -2290, -2449, -2609, -2764, -2916, -3066, -3211, -3356, -3496, -3628, -3765, -3889, -4019, -4139, -4256, -4372, 
-    -4480, -4587, -4692, -4787, -4885, -4972, -5062, -5138, -5224, -5288, -5364, -5422, -5486, -5538, -5590, -5631, 
-    -5678, -5707, -5743, -5764, -5787, -5800, -5811, -5812, -5814, -5803, -5793, -5772, -5745, -5717, -5674, -5637, 
-    -5579, -5527, -5457, -5389, -5311, -5223, -5136, -5031, -4931, -4813, -4698, -4566, -4434, -4294, -4141, -3992, 
-    -3826, -3659, -3486, -3302, -3118, -2922, -2726, -2519, -2312, -2095, -1876, -1655, -1424, -1199, -960, -726, 
-    -487, -246, -4, 237, 479, 726, 965, 1210, 1449, 1687, 1928, 2156, 2393, 2615, 2846, 3060, 
-    3281, 3490, 3695, 3900, 4091, 4287, 4465, 4651, 4818, 4987, 5149, 5299, 5451, 5591, 5725, 5856, 
-    5975, 6091, 6200, 6300, 6397, 6482, 6562, 6639, 6698, 6767, 6810, 6862, 6896, 6927, 6952, 6969, 
-    6978, 6978, 6976, 6961, 6943, 6916, 6878, 6838, 6788, 6728, 6666, 6589, 6510, 6423, 6324, 6221, 
-    6108, 5988, 5860, 5727, 5582, 5436, 5278, 5116, 4949, 4771, 4597, 4406, 4223, 4024, 3830, 3626, 
-    3426, 3216, 3010, 2797, 2589, 2374, 2163, 1945, 1734, 1518, 1304, 1087, 875, 656, 448, 222, 
-    12, -207, -424, -643, -866, -1085, -1311, -1531, -1763, -1982, -2218, -2436, -2675, -2894, -3129, -3350, 
-    -3580, -3801, -4021, -4239, -4452, -4659, -4865, -5059, -5251, -5436, -5611, -5781, -5940, -6093, -6238, -6372, 
-    -6501, -6618, -6730, -6836, -6927, -7023, -7094, -7182, -7240, -7316, -7365, -7427, -7470, -7520, -7559, -7597, 
-    -7631, -7659, -7684, -7705, -7721, -7730, -7738, -7736, -7727, -7716, -7690, -7663, -7625, -7575, -7518, -7455, 
-    -7371, -7291, -7184, -7082, -6959, -6829, -6688, -6534, -6377, -6200, -6023, -5831, -5634, -5428, -5215, -4992, 
-    -4770, -4531, -4301, -4053, -3811, -3558, -3309, -3050, -2797, -2531, -2276, -2005, -1747, -1472, -1213, -937, 
-    -668, -397, -123, 151, 423, 706, 977, 1262, 1535, 1819, 2097, 2375, 2659, 2931, 3215, 3484, 
-    3762, 4031, 4297, 4564, 4818, 5075, 5322, 5564, 5802, 6028, 6252, 6462, 6670, 6865, 7057, 7234, 
-    7406, 7568, 7719, 7863, 8001, 8119, 8247, 8345, 8452, 8538, 8624, 8695, 8767, 8817, 8878, 8910, 
-    8954, 8977, 8995, 9010, 9006, 9009, 8988, 8973, 8936, 8903, 8849, 8794, 8729, 8648, 8571, 8469, 
-    8373, 8252, 8137, 7998, 7861, 7709, 7547, 7384, 7201, 7022, 6823, 6625, 6417, 6200, 5982, 5751, 
-    5522, 5283, 5040, 4795, 4540, 4295, 4028, 3776, 3508, 3247, 2982, 2712, 2443, 2173, 1903, 1628, 
-    1359, 1081, 810, 531, 261, -22, -292, -573, -849, -1129, -1404, -1683, -1960, -2235, -2514, -2783, 
-    -3058, -3327, -3597, -3860, -4123, -4381, -4636, -4887, -5130, -5373, -5602, -5835, -6053, -6268, -6476, -6675, 
-    -6867, -7052, -7227, -7395, -7556, -7704, -7852, -7981, -8111, -8226, -8339, -8438, -8534, -8617, -8695, -8765, 
-    -8824, -8882, -8923, -8966, -8993, -9018, -9034, -9041, -9042, -9035, -9021, -8999, -8973, -8932, -8894, -8839, 
-    -8784, -8720, -8646, -8571, -8481, -8391, -8287, -8185, -8065, -7947, -7816, -7680, -7538, -7388, -7227, -7067, 
-    -6888, -6717, -6521, -6338, -6126, -5928, -5706, -5489, -5260, -5025, -4784, -4537, -4284, -4025, -3760, -3490, 
-    -3216, -2931, -2654, -2354, -2071, -1767, -1471, -1168, -862, -556, -247, 62, 370, 683, 990, 1302, 
-    1610, 1918, 2224, 2526, 2831, 3127, 3428, 3716, 4009, 4293, 4577, 4853, 5129, 5394, 5659, 5916, 
-    6170, 6417, 6655, 6890, 7118, 7336, 7554, 7754, 7956, 8144, 8326, 8497, 8662, 8812, 8958, 9090, 
-    9213, 9323, 9424, 9512, 9590, 9655, 9707, 9751, 9775, 9794, 9796, 9785, 9767, 9729, 9686, 9626, 
-    9561, 9475, 9390, 9283, 9177, 9054, 8927, 8786, 8643, 8489, 8326, 8161, 7985, 7810, 7619, 7435, 
-    7234, 7038, 6833, 6623, 6412, 6194, 5974, 5749, 5521, 5288, 5051, 4811, 4565, 4317, 4066, 3806, 
-    3550, 3280, 3018, 2742, 2471, 2189, 1911, 1627, 1341, 1058, 765, 485, 188, -89, -382, -658, 
-    -947, -1220, -1499, -1767, -2037, -2297, -2556, -2809, -3051, -3299, -3526, -3761, -3978, -4201, -4404, -4616, 
-    -4810, -5005, -5196, -5373, -5561, -5727, -5904, -6065, -6232, -6386, -6546, -6690, -6850, -6982, -7133, -7265, 
-    -7400, -7529, -7653, -7771, -7890, -7993, -8102, -8193, -8287, -8365, -8442, -8507, -8568, -8612, -8657, -8684, 
-    -8708, -8717, -8719, -8711, -8692, -8662, -8624, -8571, -8516, -8442, -8367, -8276, -8176, -8070, -7952, -7826, 
-    -7694, -7544, -7402, -7234, -7074, -6897, -6715, -6531, -6330, -6136, -5922, -5717, -5490, -5274, -5037, -4810, 
-    -4566, -4326, -4076, -3824, -3569, -3308, -3049, -2779, -2513, -2239, -1969, -1689, -1415, -1134, -854, -574, 
-    -293, -9, 271, 551, 836, 1111, 1391, 1666, 1938, 2210, 2475, 2739, 2996, 3251, 3498, 3746, 
-    3977, 4219, 4435, 4661, 4871, 5079, 5276, 5469, 5652, 5832, 5997, 6165, 6310, 6467, 6592, 6732, 
-    6843, 6962, 7064, 7158, 7244, 7322, 7390, 7450, 7500, 7542, 7576, 7600, 7614, 7625, 7620, 7616, 
-    7596, 7573, 7540, 7505, 7454, 7409, 7345, 7286, 7213, 7141, 7060, 6977, 6889, 6795, 6699, 6598, 
-    6493, 6387, 6272, 6162, 6035, 5921, 5785, 5663, 5521, 5385, 5238, 5095, 4935, 4784, 4614, 4451, 
-    4276, 4100, 3917, 3733, 3540, 3349, 3148, 2949, 2745, 2538, 2329, 2119, 1906, 1693, 1477, 1265, 
-    1046, 837, 614, 408, 186, -18, -241, -444, -664, -870, -1082, -1294, -1503, -1713, -1923, -2130, 
-    -2343, -2546, -2761, -2962, -3174, -3379, -3581, -3792, -3986, -4193, -4387, -4582, -4772, -4960, -5140, -5319, 
-    -5490, -5650, -5814, -5957, -6103, -6233, -6358, -6474, -6575, -6673, -6755, -6829, -6894, -6944, -6986, -7018, 
-    -7039, -7048, -7050, -7040, -7020, -6997, -6953, -6913, -6857, -6796, -6727, -6651, -6569, -6478, -6388, -6281, 
-    -6180, -6067, -5949, -5831, -5702, -5574, -5437, -5300, -5151, -5010, -4848, -4700, -4531, -4373, -4198, -4031, 
-    -3852, -3673, -3492, -3304, -3118, -2927, -2735, -2540, -2342, -2150, -1942, -1751, -1542, -1348, -1142, -942, 
-    -740, -540, -339, -140, 59, 255, 452, 646, 841, 1032, 1222, 1410, 1597, 1781, 1965, 2145, 
-    2321, 2501, 2671, 2844, 3011, 3174, 3337, 3493, 3644, 3797, 3935, 4080, 4206, 4340, 4454, 4579, 
-    4677, 4790, 4880, 4971, 5057, 5128, 5202, 5260, 5322, 5366, 5414, 5445, 5480, 5502, 5523, 5534, 
-    5544, 5543, 5544, 5530, 5524, 5500, 5484, 5452, 5423, 5388, 5346, 5304, 5254, 5200, 5147, 5079, 
-    5017, 4942, 4869, 4787, 4700, 4612, 4513, 4416, 4307, 4199, 4083, 3964, 3835, 3709, 3571, 3433, 
-    3294, 3138, 2998, 2834, 2683, 2523, 2357, 2195, 2030, 1859, 1696, 1522, 1356, 1187, 1017, 852, 
-    684, 521, 356, 195, 38, -121, -272, -427, -576, -724, -868, -1012, -1152, -1294, -1430, -1568, 
-    -1702, -1838, -1971, -2105, -2237, -2369, -2501, -2635, -2759, -2899, -3019, -3154, -3279, -3402, -3529, -3647, 
-    -3767, -3880, -3994, -4095, -4203, -4295, -4387, -4471, -4547, -4620, -4680, -4735, -4783, -4818, -4850, -4869, 
-    -4884, -4885, -4884, -4869, -4850, -4824, -4788, -4748, -4701, -4647, -4591, -4527, -4459, -4387, -4313, -4233, 
-    -4155, -4067, -3983, -3891, -3802, -3708, -3614, -3515, -3418, -3314, -3212, -3107, -2998, -2889, -2777, -2659, 
-    -2547, -2420, -2303, -2173, -2048, -1913, -1780, -1643, -1502, -1359, -1216, -1061, -922, -761, -617, -456, 
-    -306, -149, 4, 158, 315, 463, 620, 763, 917, 1057, 1204, 1338, 1476, 1607, 1734, 1861, 
-    1974, 2096, 2200, 2312, 2408, 2508, 2597, 2687, 2768, 2847, 2922, 2988, 3060, 3116, 3175, 3231, 
-    3276, 3327, 3367, 3408, 3443, 3476, 3506, 3530, 3554, 3572, 3588, 3601, 3609, 3617, 3615, 3618, 
-    3609, 3602, 3588, 3570, 3553, 3524, 3500, 3463, 3432, 3385, 3349, 3291, 3247, 3187, 3128, 3066, 
-    2996, 2928, 2852, 2772, 2695, 2605, 2521, 2428, 2333, 2240, 2138, 2037, 1935, 1825, 1722, 1608, 
-    1504, 1384, 1276, 1157, 1043, 930, 809, 696, 578, 463, 347, 231, 119, 3, -104, -219, 
-    -325, -436, -537, -647, -743, -850, -943, -1042, -1138, -1228, -1323, -1405, -1500, -1578, -1669, -1743, 
-    -1826, -1902, -1977, -2051, -2122, -2189, -2257, -2321, -2381, -2444, -2494, -2556, -2597, -2650, -2691, -2729, 
-    -2771, -2798, -2831, -2849, -2874, -2887, -2899, -2905, -2908, -2905, -2896, -2887, -2866, -2848, -2821, -2789, 
-    -2757, -2718, -2671, -2629, -2571, -2524, -2458, -2403, -2333, -2270, -2198, -2125, -2053, -1974, -1897, -1817, 
-    -1734, -1653, -1568, -1482, -1397, -1312, -1222, -1136, -1047, -956, -871, -778, -691, -600, -512, -418, 
-    -335, -237, -153, -59, 29, 118, 214, 299, 395, 481, 575, 665, 755, 847, 934, 1026, 
-    1112, 1199, 1288, 1368, 1459, 1536, 1619, 1698, 1773, 1852, 1921, 1995, 2062, 2127, 2194, 2250, 
-    2311, 2367, 2416, 2469, 2510, 2557, 2592, 2632, 2661, 2689, 2716, 2733, 2753, 2767, 2773, 2780, 
-    2782, 2776, 2772, 2761, 2743, 2726, 2703, 2674, 2647, 2609, 2574, 2531, 2485, 2439, 2386, 2331, 
-    2277, 2214, 2153, 2089, 2021, 1956, 1881, 1811, 1738, 1660, 1586, 1505, 1425, 1345, 1261, 1177, 
-    1088, 1004, 911, 820, 727, 629, 533, 430, 328, 223, 118, 6, -102, -218, -333, -447, 
-    -569, -685, -807, -928, -1048, -1169, -1293, -1408, -1533, -1647, -1762, -1880, -1988, -2099, -2205, -2305, 
-    -2408, -2500, -2597, -2677, -2770, -2842, -2926, -2989, -3064, -3124, -3185, -3243, -3291, -3344, -3388, -3431, 
-    -3469, -3504, -3540, -3565, -3600, -3613, -3644, -3655, -3671, -3689, -3683, -3706, -3688, -3702, -3688, -3677, 
-    -3666, -3640, -3623, -3589, -3558, -3515, -3473, -3418, -3365, -3299, -3234, -3155, -3079, -2984, -2899, -2790, 
-    -2691, -2574, -2463, -2332, -2213, -2073, -1941, -1798, -1653, -1507, -1354, -1201, -1047, -885, -733, -567, 
-    -409, -250, -86, 72, 234, 391, 549, 709, 861, 1020, 1167, 1322, 1468, 1618, 1759, 1906, 
-    2043, 2185, 2317, 2454, 2584, 2710, 2843, 2960, 3087, 3202, 3317, 3432, 3539, 3648, 3750, 3851, 
-    3945, 4042, 4126, 4215, 4294, 4371, 4444, 4511, 4576, 4633, 4688, 4737, 4781, 4820, 4857, 4884, 
-    4910, 4929, 4942, 4953, 4954, 4956, 4943, 4937, 4914, 4896, 4863, 4832, 4792, 4746, 4703, 4640, 
-    4590, 4519, 4453, 4380, 4299, 4220, 4132, 4039, 3947, 3846, 3744, 3638, 3525, 3416, 3297, 3178, 
-    3053, 2927, 2801, 2667, 2534, 2396, 2256, 2117, 1973, 1824, 1680, 1525, 1377, 1217, 1066, 903, 
-    745, 583, 417, 255, 84, -77, -255, -419, -594, -767, -936, -1116, -1285, -1461, -1637, -1805, 
-    -1986, -2152, -2327, -2494, -2667, -2827, -3001, -3155, -3321, -3476, -3632, -3782, -3932, -4075, -4220, -4351, 
-    -4492, -4614, -4744, -4862, -4977, -5091, -5194, -5298, -5394, -5483, -5572, -5646, -5727, -5791, -5856, -5912, 
-    -5959, -6006, -6042, -6070, -6098, -6108, -6121, -6122, -6114, -6105, -6081, -6056, -6018, -5978, -5925, -5873, 
-    -5802, -5739, -5655, -5577, -5486, -5387, -5292, -5180, -5075, -4953, -4836, -4709, -4582, -4451, -4311, -4174, 
-    -4031, -3884, -3736, -3583, -3428, -3270, -3109, -2944, -2778, -2607, -2436, -2261, -2082, -1903, -1720, -1532, 
-    -1347, -1151, -966, -767, -574, -374, -174, 21, 223, 422, 622, 824, 1021, 1220, 1416, 1610, 
-    1804, 1992, 2183, 2364, 2548, 2726, 2898, 3073, 3236, 3404, 3561, 3716, 3869, 4016, 4162, 4299, 
-    4441, 4568, 4700, 4824, 4944, 5064, 5176, 5288, 5389, 5497, 5586, 5685, 5768, 5851, 5930, 5999, 
-    6067, 6127, 6179, 6228, 6267, 6301, 6330, 6345, 6363, 6365, 6363, 6355, 6336, 6314, 6282, 6246, 
-    6199, 6151, 6091, 6032, 5960, 5890, 5811, 5725, 5642, 5544, 5453, 5353, 5245, 5145, 5030, 4922, 
-    4805, 4686, 4566, 4441, 4315, 4186, 4050, 3920, 3777, 3636, 3493, 3340, 3192, 3034, 2874, 2710, 
-    2543, 2370, 2194, 2014, 1830, 1643, 1449, 1259, 1053, 860, 650, 446, 238, 24, -180, -397, 
-    -608, -817, -1037, -1236, -1455, -1654, -1863, -2062, -2259, -2455, -2641, -2828, -3006, -3180, -3348, -3513, 
-    -3666, -3821, -3963, -4101, -4234, -4361, -4477, -4597, -4698, -4807, -4898, -4995, -5079, -5162, -5237, -5314, 
-    -5377, -5449, -5504, -5562, -5619, -5661, -5716, -5753, -5793, -5828, -5859, -5886, -5910, -5925, -5945, -5947, 
-    -5958, -5955, -5946, -5939, -5917, -5894, -5865, -5823, -5786, -5726, -5679, -5601, -5538, -5455, -5363, -5280, 
-    -5168, -5065, -4951, -4827, -4703, -4570, -4428, -4288, -4139, -3984, -3829, -3666, -3502, -3338, -3164, -2996, 
-    -2817, -2647, -2467, -2294, -2110, -1942, -1752, -1587, -1400, -1228, -1049, -875, -698, -527, -350, -179, 
-    -8, 164, 332, 500, 672, 835, 1004, 1167, 1330, 1493, 1656, 1812, 1975, 2126, 2286, 2434, 
-    2590, 2732, 2884, 3021, 3163, 3301, 3429, 3565, 3681, 3811, 3920, 4037, 4138, 4242, 4334, 4427, 
-    4507, 4587, 4657, 4721, 4780, 4832, 4878, 4919, 4947, 4981, 4994, 5015, 5019, 5025, 5021, 5013, 
-    5002, 4982, 4963, 4933, 4902, 4871, 4826, 4790, 4738, 4692, 4638, 4583, 4524, 4461, 4399, 4327, 
-    4262, 4182, 4110, 4027, 3946, 3859, 3772, 3676, 3584, 3482, 3382, 3278, 3165, 3058, 2935, 2826, 
-    2696, 2579, 2443, 2318, 2182, 2048, 1909, 1767, 1627, 1480, 1338, 1188, 1042, 891, 743, 590, 
-    442, 289, 140, -14, -160, -314, -465, -612, -765, -909, -1061, -1203, -1356, -1491, -1642, -1782, 
-    -1920, -2062, -2197, -2331, -2467, -2593, -2726, -2845, -2970, -3086, -3202, -3311, -3418, -3517, -3618, -3704, 
-    -3795, -3870, -3949, -4015, -4076, -4135, -4177, -4225, -4255, -4286, -4305, -4320, -4326, -4327, -4317, -4305, 
-    -4286, -4255, -4227, -4184, -4140, -4091, -4033, -3974, -3911, -3838, -3770, -3686, -3611, -3523, -3439, -3345, 
-    -3256, -3156, -3062, -2959, -2855, -2753, -2640, -2536, -2420, -2311, -2188, -2076, -1949, -1831, -1704, -1579, 
-    -1448, -1319, -1187, -1053, -917, -781, -643, -506, -364, -226, -85, 54, 191, 334, 470, 606, 
-    742, 875, 1007, 1139, 1261, 1391, 1510, 1629, 1748, 1857, 1970, 2076, 2179, 2278, 2376, 2469, 
-    2557, 2644, 2727, 2803, 2885, 2950, 3023, 3085, 3146, 3206, 3255, 3311, 3352, 3397, 3434, 3470, 
-    3501, 3527, 3550, 3569, 3582, 3595, 3596, 3601, 3595, 3589, 3575, 3559, 3535, 3508, 3479, 3439, 
-    3401, 3352, 3303, 3245, 3188, 3122, 3054, 2982, 2903, 2827, 2741, 2656, 2564, 2475, 2373, 2284, 
-    2179, 2079, 1975, 1871, 1762, 1663, 1547, 1445, 1334, 1225, 1115, 1009, 895, 792, 673, 570, 
-    455, 345, 236, 119, 11, -105, -217, -334, -448, -566, -682, -803, -919, -1041, -1158, -1281, 
-    -1398, -1520, -1638, -1758, -1877, -1994, -2111, -2224, -2339, -2452, -2558, -2667, -2770, -2872, -2971, -3065, 
-    -3155, -3245, -3325, -3410, -3481, -3556, -3622, -3684, -3746, -3797, -3848, -3892, -3935, -3967, -4002, -4025, 
-    -4049, -4068, -4078, -4089, -4089, -4090, -4085, -4074, -4060, -4037, -4015, -3984, -3953, -3910, -3871, -3815, 
-    -3770, -3702, -3649, -3573, -3504, -3426, -3343, -3255, -3165, -3066, -2967, -2863, -2749, -2638, -2521, -2397, 
-    -2277, -2143, -2013, -1879, -1739, -1600, -1453, -1310, -1158, -1012, -854, -705, -544, -390, -231, -71, 
-    88, 248, 412, 572, 732, 899, 1056, 1222, 1380, 1543, 1699, 1864, 2014, 2177, 2327, 2482, 
-    2634, 2779, 2930, 3067, 3212, 3346, 3480, 3607, 3735, 3853, 3969, 4081, 4184, 4287, 4377, 4471, 
-    4545, 4631, 4690, 4762, 4813, 4866, 4910, 4947, 4979, 5004, 5023, 5039, 5043, 5050, 5044, 5041, 
-    5026, 5011, 4991, 4967, 4941, 4906, 4877, 4834, 4799, 4754, 4706, 4659, 4607, 4550, 4494, 4430, 
-    4364, 4297, 4221, 4149, 4061, 3982, 3887, 3795, 3694, 3589, 3481, 3362, 3248, 3116, 2992, 2854, 
-    2714, 2571, 2424, 2267, 2114, 1953, 1788, 1626, 1453, 1286, 1114, 941, 772, 593, 425, 249, 
-    80, -90, -258, -427, -588, -757, -911, -1074, -1230, -1381, -1537, -1680, -1835, -1973, -2121, -2259, 
-    -2399, -2537, -2674, -2809, -2941, -3077, -3203, -3340, -3462, -3598, -3720, -3850, -3972, -4098, -4216, -4342, 
-    -4455, -4573, -4686, -4795, -4902, -5007, -5102, -5198, -5289, -5371, -5451, -5523, -5591, -5650, -5704, -5750, 
-    -5789, -5824, -5843, -5865, -5869, -5876, -5867, -5855, -5834, -5803, -5772, -5722, -5681, -5620, -5558, -5492, 
-    -5414, -5338, -5252, -5162, -5069, -4967, -4869, -4753, -4652, -4527, -4414, -4288, -4163, -4033, -3900, -3762, 
-    -3620, -3480, -3329, -3179, -3026, -2865, -2706, -2543, -2370, -2207, -2026, -1855, -1673, -1492, -1310, -1121, 
-    -936, -747, -555, -367, -172, 17, 209, 402, 592, 781, 973, 1158, 1344, 1529, 1708, 1887, 
-    2062, 2236, 2404, 2571, 2733, 2894, 3047, 3202, 3347, 3494, 3634, 3770, 3906, 4031, 4161, 4276, 
-    4400, 4509, 4622, 4723, 4829, 4921, 5019, 5102, 5189, 5268, 5340, 5414, 5474, 5540, 5589, 5644, 
-    5685, 5727, 5759, 5788, 5811, 5826, 5841, 5842, 5843, 5839, 5822, 5811, 5779, 5755, 5717, 5676, 
-    5631, 5577, 5523, 5457, 5395, 5318, 5247, 5163, 5079, 4993, 4893, 4805, 4697, 4596, 4488, 4370, 
-    4266, 4135, 4022, 3889, 3763, 3630, 3493, 3355, 3214, 3064, 2924, 2763, 2621, 2453, 2307, 2136, 
-    1983, 1811, 1649, 1482, 1312, 1145, 975, 804, 635, 465, 294, 126, -41, -211, -374, -545, 
-    -709, -871, -1035, -1197, -1353, -1518, -1667, -1827, -1981, -2131, -2282, -2430, -2575, -2722, -2862, -3003, 
-    -3141, -3275, -3410, -3537, -3663, -3789, -3904, -4025, -4133, -4242, -4347, -4439, -4540, -4622, -4709, -4785, 
-    -4854, -4922, -4979, -5034, -5081, -5119, -5155, -5182, -5204, -5218, -5228, -5228, -5228, -5214, -5203, -5179, 
-    -5155, -5122, -5084, -5044, -4997, -4945, -4893, -4830, -4770, -4700, -4630, -4556, -4478, -4398, -4311, -4225, 
-    -4134, -4037, -3947, -3838, -3742, -3634, -3523, -3414, -3295, -3179, -3058, -2932, -2808, -2674, -2547, -2406, 
-    -2273, -2131, -1990, -1847, -1699, -1554, -1405, -1255, -1106, -954, -801, -656, -498, -354, -199, -55, 
-    94, 236, 383, 521, 663, 795, 934, 1059, 1190, 1313, 1434, 1551, 1667, 1773, 1884, 1982, 
-    2085, 2177, 2272, 2354, 2442, 2519, 2599, 2671, 2741, 2807, 2870, 2932, 2986, 3045, 3093, 3143, 
-    3192, 3232, 3276, 3314, 3351, 3387, 3419, 3451, 3477, 3504, 3527, 3550, 3569, 3588, 3598, 3615, 
-    3620, 3627, 3632, 3626, 3628, 3616, 3607, 3592, 3569, 3550, 3516, 3491, 3447, 3411, 3360, 3314, 
-    3256, 3198, 3136, 3066, 2998, 2920, 2844, 2760, 2678, 2589, 2499, 2407, 2310, 2219, 2113, 2021, 
-    1915, 1818, 1711, 1611, 1504, 1401, 1296, 1193, 1084, 984, 875, 771, 670, 561, 461, 354, 
-    251, 151, 48, -55, -152, -257, -351, -451, -549, -641, -738, -830, -917, -1014, -1088, -1186, 
-    -1257, -1342, -1416, -1492, -1560, -1632, -1691, -1756, -1812, -1866, -1918, -1963, -2008, -2045, -2082, -2114, 
-    -2139, -2166, -2183, -2199, -2212, -2217, -2222, -2221, -2216, -2208, -2200, -2177, -2167, -2135, -2117, -2084, 
-    -2053, -2020, -1981, -1942, -1902, -1856, -1811, -1764, -1712, -1664, -1609, -1556, -1501, -1442, -1387, -1322, 
-    -1269, -1199, -1143, -1074, -1010, -943, -876, -807, -734, -671, -591, -523, -451, -371, -306, -224, 
-    -156, -76, -6, 68, 143, 210, 285, 354, 419, 491, 551, 615, 679, 734, 796, 845, 
-    904, 947, 1006, 1044, 1094, 1136, 1176, 1219, 1256, 1290, 1334, 1358, 1401, 1426, 1459, 1491, 
-    1516, 1545, 1570, 1593, 1619, 1635, 1658, 1671, 1686, 1697, 1706, 1713, 1715, 1712, 1714, 1698, 
-    1697, 1675, 1660, 1637, 1613, 1579, 1551, 1510, 1473, 1428, 1382, 1331, 1280, 1222, 1162, 1103, 
-    1033, 973, 897, 830, 752, 679, 594, 523, 430, 355, 260, 179, 86, -2, -95, -188, 
-    -281, -376, -472, -565, -660, -755, -850, -942, -1035, -1126, -1216, -1303, -1386, -1473, -1549, -1632, 
-    -1704, -1775, -1849, -1908, -1977, -2033, -2092, -2146, -2194, -2245, -2287, -2331, -2369, -2403, -2440, -2470, 
-    -2500, -2527, -2550, -2573, -2593, -2610, -2627, -2638, -2650, -2662, -2661, -2675, -2667, -2673, -2667, -2661, 
-    -2653, -2642, -2626, -2611, -2587, -2569, -2535, -2514, -2472, -2449, -2396, -2365, -2313, -2269, -2217, -2163, 
-    -2105, -2048, -1986, -1920, -1858, -1783, -1717, -1641, -1567, -1490, -1409, -1329, -1246, -1162, -1074, -986, 
-    -896, -806, -711, -619, -519, -423, -325, -221, -123, -14, 88, 191, 307, 406, 525, 631, 
-    742, 862, 966, 1090, 1199, 1316, 1433, 1546, 1663, 1777, 1894, 2004, 2119, 2231, 2340, 2453, 
-    2555, 2666, 2765, 2872, 2968, 3065, 3161, 3250, 3344, 3425, 3512, 3588, 3668, 3735, 3813, 3871, 
-    3939, 3990, 4051, 4095, 4146, 4183, 4225, 4253, 4288, 4305, 4331, 4342, 4355, 4360, 4361, 4358, 
-    4348, 4337, 4316, 4293, 4266, 4230, 4195, 4149, 4101, 4052, 3990, 3931, 3862, 3792, 3718, 3639, 
-    3556, 3469, 3381, 3286, 3193, 3093, 2993, 2891, 2783, 2679, 2570, 2457, 2350, 2235, 2120, 2008, 
-    1889, 1776, 1656, 1538, 1420, 1300, 1180, 1056, 936, 810, 687, 559, 432, 303, 173, 41, 
-    -91, -228, -360, -504, -634, -782, -916, -1061, -1201, -1343, -1484, -1627, -1766, -1906, -2045, -2181, 
-    -2317, -2451, -2580, -2710, -2834, -2957, -3077, -3194, -3305, -3418, -3521, -3626, -3726, -3819, -3914, -4000, 
-    -4086, -4169, -4246, -4319, -4391, -4459, -4522, -4584, -4638, -4693, -4743, -4784, -4830, -4863, -4898, -4926, 
-    -4949, -4966, -4983, -4987, -4994, -4987, -4984, -4964, -4951, -4922, -4892, -4854, -4812, -4763, -4708, -4651, 
-    -4580, -4517, -4432, -4361, -4266, -4186, -4083, -3991, -3884, -3783, -3670, -3561, -3446, -3326, -3209, -3084, 
-    -2961, -2834, -2703, -2576, -2438, -2311, -2167, -2039, -1891, -1759, -1610, -1471, -1326, -1179, -1035, -882, 
-    -738, -587, -436, -286, -133, 18, 166, 325, 470, 627, 773, 927, 1073, 1221, 1366, 1510, 
-    1652, 1792, 1928, 2062, 2195, 2323, 2450, 2573, 2691, 2808, 2920, 3029, 3135, 3235, 3334, 3426, 
-    3515, 3604, 3679, 3764, 3832, 3904, 3972, 4028, 4091, 4140, 4193, 4238, 4281, 4319, 4354, 4386, 
-    4413, 4438, 4459, 4473, 4492, 4498, 4507, 4509, 4509, 4505, 4499, 4484, 4475, 4452, 4434, 4406, 
-    4378, 4344, 4307, 4264, 4221, 4171, 4117, 4060, 3996, 3931, 3860, 3784, 3708, 3622, 3537, 3443, 
-    3350, 3247, 3147, 3035, 2928, 2811, 2694, 2572, 2449, 2318, 2191, 2055, 1922, 1783, 1641, 1503, 
-    1356, 1214, 1067, 919, 773, 623, 479, 328, 185, 34, -106, -256, -395, -538, -678, -812, 
-    -954, -1082, -1218, -1344, -1471, -1597, -1717, -1837, -1951, -2068, -2175, -2284, -2391, -2488, -2593, -2684, 
-    -2777, -2869, -2951, -3039, -3112, -3189, -3262, -3327, -3394, -3449, -3504, -3554, -3601, -3638, -3673, -3706, 
-    -3725, -3751, -3758, -3770, -3772, -3768, -3764, -3745, -3729, -3706, -3673, -3645, -3601, -3562, -3514, -3463, 
-    -3407, -3350, -3286, -3222, -3153, -3082, -3009, -2930, -2856, -2770, -2691, -2606, -2519, -2433, -2343, -2250, 
-    -2164, -2063, -1976, -1875, -1780, -1683, -1583, -1482, -1385, -1277, -1181, -1072, -972, -861, -763, -650, 
-    -549, -442, -333, -229, -122, -17, 88, 191, 298, 397, 502, 600, 701, 799, 897, 991, 
-    1086, 1177, 1271, 1356, 1447, 1531, 1615, 1699, 1776, 1859, 1930, 2012, 2081, 2154, 2225, 2287, 
-    2360, 2418, 2480, 2539, 2594, 2650, 2698, 2749, 2789, 2836, 2870, 2909, 2937, 2965, 2989, 3006, 
-    3024, 3032, 3039, 3041, 3035, 3033, 3014, 3002, 2979, 2952, 2924, 2884, 2851, 2801, 2759, 2702, 
-    2652, 2585, 2530, 2457, 2391, 2316, 2240, 2158, 2079, 1988, 1908, 1808, 1724, 1619, 1527, 1424, 
-    1321, 1218, 1109, 1001, 891, 775, 666, 544, 434, 309, 198, 68, -43, -170, -288, -411, 
-    -533, -653, -775, -890, -1014, -1125, -1244, -1354, -1466, -1573, -1680, -1782, -1882, -1979, -2071, -2162, 
-    -2249, -2329, -2412, -2486, -2560, -2628, -2691, -2755, -2813, -2867, -2917, -2965, -3011, -3051, -3089, -3124, 
-    -3153, -3186, -3206, -3235, -3249, -3267, -3281, -3290, -3297, -3303, -3301, -3299, -3291, -3284, -3266, -3254, 
-    -3224, -3205, -3172, -3138, -3102, -3053, -3012, -2955, -2902, -2840, -2776, -2706, -2633, -2556, -2474, -2392, 
-    -2300, -2212, -2116, -2023, -1919, -1824, -1713, -1615, -1505, -1398, -1291, -1178, -1071, -959, -849, -735, 
-    -626, -511, -405, -286, -179, -65, 49, 156, 274, 386, 498, 615, 728, 845, 962, 1080, 
-    1196, 1319, 1434, 1560, 1676, 1805, 1921, 2051, 2167, 2295, 2414, 2541, 2656, 2780, 2899, 3013, 
-    3132, 3243, 3352, 3461, 3564, 3665, 3762, 3852, 3945, 4023, 4109, 4176, 4251, 4312, 4371, 4426, 
-    4474, 4515, 4556, 4584, 4612, 4633, 4648, 4658, 4663, 4662, 4655, 4647, 4626, 4608, 4579, 4549, 
-    4511, 4469, 4422, 4369, 4317, 4249, 4191, 4112, 4044, 3959, 3880, 3788, 3699, 3600, 3500, 3397, 
-    3285, 3177, 3059, 2938, 2817, 2687, 2561, 2422, 2291, 2144, 2004, 1858, 1706, 1557, 1399, 1242, 
-    1082, 919, 757, 588, 422, 249, 82, -93, -261, -440, -607, -790, -954, -1133, -1301, -1471, 
-    -1642, -1806, -1971, -2134, -2288, -2447, -2595, -2746, -2887, -3029, -3160, -3294, -3418, -3540, -3659, -3768, 
-    -3878, -3982, -4078, -4179, -4262, -4357, -4432, -4519, -4587, -4666, -4729, -4799, -4860, -4918, -4976, -5027, 
-    -5075, -5125, -5163, -5206, -5239, -5270, -5303, -5320, -5349, -5353, -5375, -5373, -5380, -5372, -5368, -5350, 
-    -5335, -5306, -5280, -5243, -5203, -5154, -5106, -5043, -4987, -4911, -4843, -4760, -4679, -4585, -4495, -4392, 
-    -4291, -4180, -4068, -3949, -3828, -3703, -3568, -3442, -3299, -3160, -3015, -2864, -2718, -2559, -2406, -2243, 
-    -2083, -1915, -1749, -1580, -1405, -1236, -1055, -881, -699, -521, -337, -157, 27, 211, 395, 581, 
-    765, 953, 1134, 1321, 1503, 1687, 1868, 2051, 2226, 2406, 2579, 2753, 2923, 3089, 3255, 3412, 
-    3576, 3720, 3877, 4015, 4159, 4293, 4424, 4546, 4669, 4779, 4891, 4994, 5088, 5184, 5264, 5349, 
-    5417, 5492, 5546, 5609, 5657, 5700, 5746, 5772, 5809, 5826, 5847, 5863, 5868, 5876, 5875, 5865, 
-    5864, 5842, 5830, 5806, 5775, 5752, 5709, 5673, 5626, 5579, 5526, 5468, 5406, 5336, 5269, 5190, 
-    5110, 5025, 4931, 4840, 4736, 4631, 4523, 4404, 4289, 4158, 4033, 3895, 3757, 3613, 3463, 3316, 
-    3149, 3000, 2823, 2667, 2487, 2316, 2138, 1958, 1776, 1591, 1407, 1218, 1031, 842, 651, 465, 
-    272, 86, -100, -292, -471, -662, -838, -1022, -1200, -1376, -1551, -1721, -1893, -2055, -2225, -2381, 
-    -2543, -2698, -2852, -3002, -3151, -3294, -3439, -3576, -3716, -3845, -3979, -4107, -4226, -4354, -4463, -4580, 
-    -4688, -4791, -4893, -4985, -5077, -5161, -5241, -5315, -5380, -5443, -5499, -5546, -5593, -5622, -5658, -5676, 
-    -5694, -5702, -5706, -5698, -5694, -5669, -5654, -5616, -5590, -5540, -5501, -5445, -5389, -5328, -5262, -5190, 
-    -5119, -5033, -4957, -4866, -4778, -4684, -4585, -4490, -4381, -4279, -4167, -4056, -3943, -3821, -3704, -3580, 
-    -3455, -3325, -3196, -3061, -2928, -2788, -2648, -2506, -2362, -2214, -2070, -1914, -1768, -1610, -1461, -1302, 
-    -1146, -990, -827, -675, -509, -351, -192, -26, 129, 295, 452, 615, 774, 935, 1092, 1253, 
-    1406, 1564, 1717, 1869, 2021, 2167, 2315, 2457, 2600, 2735, 2873, 2999, 3131, 3252, 3373, 3486, 
-    3598, 3701, 3805, 3896, 3992, 4072, 4156, 4227, 4296, 4361, 4414, 4472, 4511, 4562, 4589, 4626, 
-    4648, 4669, 4686, 4698, 4700, 4709, 4698, 4698, 4684, 4670, 4653, 4626, 4604, 4571, 4539, 4500, 
-    4458, 4415, 4362, 4315, 4253, 4195, 4130, 4059, 3989, 3912, 3830, 3746, 3656, 3564, 3466, 3369, 
-    3262, 3155, 3045, 2924, 2817, 2687, 2571, 2442, 2314, 2189, 2054, 1924, 1790, 1654, 1524, 1383, 
-    1253, 1113, 982, 845, 712, 578, 447, 313, 187, 53, -70, -200, -323, -450, -570, -697, 
-    -811, -936, -1050, -1169, -1281, -1398, -1507, -1620, -1727, -1834, -1942, -2042, -2146, -2243, -2343, -2436, 
-    -2529, -2617, -2705, -2788, -2868, -2946, -3019, -3089, -3154, -3215, -3276, -3323, -3380, -3415, -3461, -3493, 
-    -3525, -3547, -3574, -3583, -3600, -3603, -3606, -3604, -3597, -3583, -3571, -3546, -3529, -3495, -3466, -3428, 
-    -3391, -3345, -3304, -3249, -3198, -3141, -3083, -3019, -2956, -2885, -2813, -2741, -2663, -2581, -2502, -2411, 
-    -2329, -2235, -2143, -2046, -1950, -1847, -1747, -1641, -1536, -1426, -1317, -1205, -1094, -975, -866, -745, 
-    -634, -513, -399, -279, -167, -44, 63, 188, 290, 416, 516, 635, 740, 848, 956, 1057, 
-    1160, 1259, 1356, 1451, 1539, 1633, 1716, 1800, 1883, 1954, 2037, 2097, 2173, 2232, 2294, 2353, 
-    2403, 2455, 2502, 2542, 2583, 2618, 2647, 2680, 2696, 2727, 2734, 2755, 2760, 2768, 2772, 2770, 
-    2772, 2760, 2755, 2741, 2727, 2711, 2689, 2668, 2643, 2617, 2586, 2556, 2520, 2488, 2444, 2407, 
-    2363, 2316, 2272, 2218, 2167, 2113, 2051, 1996, 1928, 1867, 1795, 1725, 1651, 1575, 1495, 1413, 
-    1329, 1241, 1150, 1059, 964, 868, 769, 668, 568, 463, 359, 255, 147, 43, -63, -170, 
-    -275, -378, -487, -584, -692, -789, -891, -985, -1084, -1177, -1268, -1361, -1446, -1533, -1619, -1696, 
-    -1780, -1854, -1932, -2003, -2075, -2142, -2212, -2272, -2339, -2394, -2455, -2509, -2564, -2614, -2661, -2710, 
-    -2750, -2793, -2827, -2865, -2894, -2923, -2947, -2967, -2984, -2998, -3003, -3014, -3010, -3008, -3003, -2988, 
-    -2974, -2954, -2928, -2903, -2867, -2833, -2791, -2751, -2698, -2652, -2593, -2538, -2475, -2412, -2344, -2272, 
-    -2204, -2121, -2053, -1961, -1891, -1795, -1716, -1626, -1533, -1444, -1350, -1253, -1160, -1059, -961, -863, 
-    -758, -658, -553, -448, -345, -234, -132, -17, 82, 201, 302, 420, 526, 641, 748, 864, 
-    971, 1088, 1195, 1306, 1417, 1527, 1636, 1745, 1850, 1956, 2060, 2163, 2264, 2364, 2457, 2558, 
-    2645, 2737, 2824, 2907, 2988, 3067, 3140, 3212, 3278, 3344, 3402, 3462, 3511, 3564, 3605, 3648, 
-    3685, 3718, 3748, 3770, 3797, 3807, 3827, 3832, 3840, 3840, 3839, 3831, 3824, 3805, 3795, 3766, 
-    3747, 3714, 3685, 3645, 3609, 3563, 3518, 3467, 3410, 3355, 3290, 3229, 3157, 3086, 3008, 2931, 
-    2844, 2762, 2669, 2576, 2484, 2378, 2283, 2173, 2068, 1956, 1846, 1728, 1615, 1490, 1376, 1247, 
-    1129, 998, 876, 745, 621, 490, 361, 232, 102, -25, -154, -281, -411, -534, -662, -785, 
-    -910, -1033, -1152, -1272, -1390, -1508, -1624, -1734, -1852, -1955, -2073, -2170, -2287, -2379, -2492, -2583, 
-    -2687, -2784, -2875, -2973, -3056, -3153, -3233, -3319, -3400, -3478, -3555, -3628, -3694, -3765, -3822, -3888, 
-    -3939, -3992, -4039, -4083, -4120, -4159, -4186, -4212, -4236, -4248, -4266, -4270, -4274, -4272, -4266, -4256, 
-    -4240, -4223, -4197, -4172, -4140, -4101, -4065, -4019, -3974, -3920, -3870, -3802, -3753, -3673, -3617, -3535, 
-    -3463, -3382, -3301, -3212, -3126, -3031, -2934, -2840, -2733, -2634, -2523, -2414, -2305, -2185, -2074, -1952, 
-    -1831, -1711, -1587, -1458, -1337, -1204, -1079, -951, -817, -692, -557, -429, -300, -166, -41, 91, 
-    220, 343, 477, 597, 732, 848, 979, 1097, 1223, 1343, 1463, 1580, 1702, 1813, 1932, 2041, 
-    2156, 2262, 2372, 2477, 2576, 2683, 2774, 2874, 2963, 3050, 3139, 3219, 3297, 3375, 3439, 3511, 
-    3572, 3627, 3688, 3731, 3782, 3820, 3859, 3893, 3921, 3949, 3968, 3988, 4003, 4011, 4023, 4021, 
-    4030, 4021, 4019, 4012, 3996, 3986, 3966, 3947, 3926, 3896, 3868, 3836, 3799, 3762, 3716, 3674, 
-    3620, 3571, 3508, 3453, 3384, 3319, 3243, 3169, 3087, 3004, 2914, 2827, 2724, 2635, 2524, 2427, 
-    2315, 2207, 2093, 1983, 1860, 1751, 1625, 1510, 1387, 1267, 1147, 1024, 907, 782, 667, 545, 
-    430, 311, 194, 84, -36, -138, -260, -360, -475, -577, -686, -787, -893, -990, -1094, -1189, 
-    -1290, -1383, -1478, -1570, -1660, -1749, -1837, -1921, -2005, -2087, -2163, -2243, -2317, -2385, -2460, -2521, 
-    -2588, -2648, -2701, -2765, -2805, -2863, -2899, -2945, -2982, -3016, -3047, -3074, -3097, -3119, -3134, -3149, 
-    -3157, -3163, -3169, -3165, -3165, -3154, -3147, -3135, -3113, -3103, -3071, -3054, -3021, -2994, -2957, -2928, 
-    -2879, -2851, -2795, -2763, -2702, -2663, -2602, -2553, -2494, -2436, -2374, -2314, -2248, -2183, -2113, -2047, 
-    -1969, -1907, -1821, -1757, -1669, -1602, -1512, -1440, -1354, -1272, -1191, -1104, -1020, -936, -847, -764, 
-    -675, -586, -502, -411, -326, -238, -148, -63, 26, 111, 197, 286, 367, 454, 537, 619, 
-    700, 780, 859, 936, 1011, 1086, 1156, 1230, 1290, 1363, 1420, 1486, 1541, 1597, 1650, 1703, 
-    1747, 1795, 1834, 1875, 1912, 1942, 1979, 2000, 2032, 2049, 2072, 2087, 2105, 2111, 2126, 2128, 
-    2136, 2136, 2136, 2132, 2128, 2119, 2108, 2101, 2080, 2069, 2049, 2026, 2005, 1981, 1948, 1928, 
-    1886, 1860, 1821, 1783, 1745, 1702, 1656, 1615, 1562, 1518, 1465, 1411, 1362, 1301, 1250, 1191, 
-    1132, 1072, 1015, 952, 891, 834, 765, 712, 644, 586, 523, 461, 403, 341, 281, 224, 
-    162, 107, 50, -8, -60, -117, -170, -222, -277, -324, -379, -423, -477, -518, -570, -613, 
-    -656, -705, -738, -790, -823, -865, -902, -938, -975, -1009, -1043, -1072, -1105, -1129, -1162, -1183, 
-    -1211, -1233, -1251, -1275, -1289, -1306, -1323, -1330, -1345, -1350, -1359, -1362, -1366, -1366, -1364, -1361, 
-    -1355, -1350, -1337, -1329, -1313, -1299, -1281, -1261, -1241, -1216, -1193, -1162, -1138, -1103, -1072, -1039, 
-    -1000, -966, -923, -884, -841, -797, -752, -705, -658, -607, -561, -506, -458, -401, -351, -294, 
-    -240, -186, -127, -76, -14, 39, 99, 154, 211, 271, 325, 386, 441, 495, 553, 609, 
-    664, 718, 771, 823, 878, 926, 980, 1024, 1076, 1123, 1163, 1214, 1251, 1296, 1333, 1374, 
-    1406, 1446, 1474, 1509, 1533, 1566, 1586, 1613, 1629, 1654, 1664, 1683, 1692, 1702, 1710, 1714, 
-    1716, 1714, 1713, 1705, 1699, 1685, 1671, 1656, 1631, 1615, 1582, 1557, 1525, 1490, 1454, 1411, 
-    1370, 1325, 1277, 1225, 1173, 1117, 1061, 1001, 939, 878, 810, 749, 677, 610, 541, 469, 
-    398, 328, 252, 182, 107, 36, -39, -109, -187, -253, -333, -399, -473, -543, -611, -681, 
-    -749, -814, -882, -945, -1008, -1072, -1129, -1191, -1245, -1304, -1357, -1409, -1457, -1509, -1552, -1599, 
-    -1642, -1680, -1720, -1756, -1792, -1821, -1856, -1877, -1912, -1928, -1958, -1972, -1994, -2008, -2027, -2036, 
-    -2051, -2055, -2068, -2071, -2078, -2078, -2080, -2080, -2078, -2075, -2068, -2065, -2053, -2047, -2032, -2023, 
-    -2006, -1992, -1972, -1954, -1933, -1910, -1883, -1860, -1828, -1800, -1767, -1730, -1697, -1656, -1618, -1574, 
-    -1530, -1481, -1436, -1379, -1330, -1271, -1216, -1154, -1093, -1026, -959, -895, -818, -753, -670, -601, 
-    -516, -442, -358, -277, -193, -108, -22, 63, 152, 236, 331, 413, 506, 592, 681, 770, 
-    854, 946, 1024, 1118, 1194, 1280, 1363, 1437, 1523, 1590, 1673, 1740, 1815, 1883, 1948, 2017, 
-    2072, 2144, 2190, 2257, 2302, 2360, 2407, 2455, 2500, 2541, 2582, 2619, 2652, 2687, 2713, 2738, 
-    2766, 2780, 2803, 2812, 2824, 2830, 2833, 2837, 2827, 2826, 2809, 2798, 2778, 2758, 2730, 2704, 
-    2667, 2637, 2592, 2553, 2506, 2457, 2407, 2352, 2296, 2237, 2177, 2113, 2047, 1983, 1912, 1845, 
-    1774, 1701, 1629, 1555, 1482, 1405, 1332, 1253, 1180, 1096, 1026, 940, 870, 782, 711, 623, 
-    550, 466, 388, 304, 225, 142, 63, -19, -101, -184, -261, -350, -421, -511, -586, -667, 
-    -749, -821, -907, -974, -1059, -1127, -1201, -1278, -1341, -1418, -1481, -1551, -1617, -1677, -1747, -1798, 
-    -1870, -1918, -1982, -2034, -2090, -2142, -2194, -2242, -2293, -2336, -2387, -2424, -2473, -2505, -2553, -2578, 
-    -2625, -2646, -2685, -2709, -2735, -2761, -2777, -2801, -2812, -2827, -2835, -2843, -2846, -2847, -2846, -2837, 
-    -2831, -2817, -2803, -2785, -2759, -2740, -2704, -2680, -2638, -2603, -2562, -2514, -2471, -2418, -2364, -2310, 
-    -2250, -2189, -2126, -2058, -1992, -1918, -1848, -1769, -1696, -1613, -1537, -1449, -1368, -1280, -1195, -1103, 
-    -1018, -919, -835, -735, -644, -549, -452, -358, -260, -164, -67, 28, 123, 222, 315, 410, 
-    506, 594, 689, 781, 865, 958, 1039, 1127, 1206, 1290, 1366, 1444, 1520, 1590, 1666, 1727, 
-    1802, 1861, 1928, 1988, 2043, 2109, 2152, 2215, 2259, 2311, 2355, 2399, 2440, 2481, 2515, 2554, 
-    2578, 2617, 2633, 2664, 2681, 2699, 2718, 2722, 2739, 2738, 2745, 2743, 2738, 2734, 2720, 2711, 
-    2691, 2672, 2654, 2623, 2599, 2566, 2531, 2498, 2456, 2416, 2372, 2327, 2277, 2230, 2173, 2124, 
-    2065, 2011, 1948, 1889, 1827, 1763, 1700, 1631, 1566, 1496, 1430, 1356, 1289, 1213, 1144, 1068, 
-    996, 921, 845, 773, 690, 621, 539, 465, 386, 309, 232, 154, 78, -2, -78, -156, 
-    -233, -309, -387, -463, -540, -613, -691, -763, -838, -910, -981, -1055, -1122, -1197, -1259, -1333, 
-    -1393, -1463, -1524, -1590, -1649, -1709, -1767, -1824, -1879, -1934, -1983, -2037, -2081, -2129, -2173, -2213, 
-    -2257, -2290, -2327, -2360, -2389, -2420, -2442, -2466, -2486, -2501, -2520, -2525, -2539, -2542, -2543, -2546, 
-    -2542, -2533, -2531, -2511, -2503, -2480, -2464, -2438, -2414, -2382, -2355, -2318, -2282, -2245, -2198, -2158, 
-    -2111, -2060, -2012, -1955, -1903, -1840, -1786, -1716, -1658, -1589, -1520, -1455, -1376, -1310, -1230, -1158, 
-    -1075, -1003, -915, -839, -755, -668, -590, -499, -416, -329, -242, -155, -67, 18, 109, 191, 
-    284, 367, 456, 541, 629, 710, 798, 878, 962, 1043, 1123, 1201, 1279, 1355, 1426, 1503, 
-    1568, 1639, 1706, 1765, 1833, 1887, 1948, 2000, 2052, 2102, 2146, 2191, 2232, 2270, 2307, 2335, 
-    2368, 2391, 2416, 2438, 2453, 2469, 2480, 2490, 2496, 2498, 2498, 2497, 2490, 2482, 2472, 2455, 
-    2445, 2417, 2403, 2370, 2350, 2316, 2286, 2250, 2211, 2171, 2132, 2080, 2041, 1983, 1936, 1882, 
-    1824, 1769, 1706, 1646, 1585, 1516, 1456, 1383, 1320, 1247, 1179, 1106, 1037, 962, 894, 814, 
-    751, 668, 601, 524, 452, 380, 305, 234, 160, 90, 15, -53, -127, -197, -267, -340, 
-    -409, -481, -547, -623, -684, -761, -823, -893, -964, -1021, -1097, -1154, -1222, -1285, -1348, -1405, 
-    -1470, -1526, -1586, -1638, -1698, -1742, -1804, -1843, -1899, -1936, -1989, -2023, -2068, -2101, -2137, -2173, 
-    -2199, -2232, -2253, -2278, -2298, -2316, -2333, -2342, -2358, -2356, -2372, -2364, -2369, -2363, -2356, -2350, 
-    -2334, -2323, -2304, -2285, -2263, -2237, -2212, -2177, -2151, -2111, -2076, -2039, -1991, -1955, -1902, -1861, 
-    -1806, -1759, -1699, -1652, -1590, -1535, -1474, -1411, -1353, -1284, -1224, -1154, -1090, -1018, -955, -877, 
-    -815, -738, -669, -596, -524, -449, -379, -302, -232, -154, -84, -8, 62, 135, 210, 278, 
-    353, 422, 493, 563, 629, 700, 764, 833, 895, 959, 1023, 1080, 1145, 1199, 1257, 1317, 
-    1364, 1424, 1473, 1520, 1574, 1615, 1667, 1706, 1750, 1791, 1829, 1866, 1905, 1931, 1974, 1993, 
-    2031, 2050, 2078, 2101, 2118, 2138, 2154, 2165, 2181, 2185, 2195, 2198, 2202, 2200, 2198, 2193, 
-    2185, 2177, 2160, 2152, 2128, 2115, 2086, 2069, 2036, 2014, 1974, 1950, 1906, 1874, 1831, 1792, 
-    1745, 1703, 1652, 1605, 1553, 1502, 1446, 1396, 1334, 1281, 1220, 1164, 1102, 1041, 981, 918, 
-    857, 792, 732, 666, 605, 539, 476, 411, 349, 
-};
-const unsigned int drum_v0_p0_long_len = 13193;
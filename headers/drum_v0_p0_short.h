@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v0_p0_short[] PROGMEM = {
-    -10, 0, 6, 8, 18, 12, 26, 16, 27, 16, 24, 11, 20, 9, 8, 6, 
-    -4, -2, -11, -14, -20, -26, -33, -36, -47, -48, -61, -65, -72, -81, -88, -94, 
-    -106, -111, -121, -132, -137, -150, -158, -168, -179, -191, -197, -211, -218, -230, -243, -248, 
-    -266, -266, -288, -286, -306, -309, -321, -332, -338, -350, -356, -368, -373, -384, -388, -401, 
-    -405, -413, -422, -426, -437, -442, -449, -454, -466, -464, -481, -477, -491, -494, -502, -509, 
-    -513, -523, -526, -537, -539, -550, -552, -564, -565, -577, -580, -590, -591, -604, -603, -617, 
-    -613, -629, -624, -640, -635, -646, -648, -650, -658, -656, -661, -664, -665, -664, -669, -663, 
-    -671, -664, -668, -662, -663, -660, -658, -655, -652, -648, -646, -637, -637, -627, -625, -618, 
-    -613, -605, -599, -592, -582, -580, -567, -560, -553, -540, -535, -519, -515, -500, -491, -479, 
-    -465, -454, -442, -428, -419, -395, -395, -367, -365, -343, -331, -315, -301, -286, -269, -257, 
-    -236, -230, -204, -198, -174, -168, -145, -135, -115, -106, -86, -75, -59, -43, -30, -16, 
-    0, 7, 31, 34, 59, 61, 84, 92, 106, 122, 129, 148, 156, 173, 182, 198, 
-    207, 225, 232, 250, 260, 274, 287, 300, 313, 325, 341, 351, 369, 376, 395, 404, 
-    421, 430, 446, 456, 472, 481, 495, 506, 517, 531, 535, 553, 556, 570, 576, 586, 
-    594, 603, 609, 616, 623, 629, 635, 642, 646, 653, 656, 662, 666, 670, 675, 678, 
-    683, 687, 689, 691, 694, 699, 697, 702, 701, 704, 701, 707, 699, 707, 697, 701, 
-    694, 693, 688, 682, 680, 668, 667, 654, 649, 640, 629, 617, 611, 593, 588, 568, 
-    563, 544, 533, 518, 502, 490, 472, 458, 442, 426, 409, 393, 378, 358, 344, 325, 
-    306, 290, 269, 252, 232, 212, 191, 170, 150, 126, 105, 81, 57, 35, 8, -16, 
-    -39, -69, -90, -120, -144, -174, -198, -227, -255, -280, -310, -335, -365, -390, -420, -442, 
-    -473, -498, -523, -552, -572, -602, -623, -650, -671, -696, -716, -741, -761, -782, -804, -820, 
-    -843, -858, -880, -893, -913, -925, -946, -954, -975, -983, -1002, -1008, -1025, -1032, -1046, -1052, 
-    -1064, -1070, -1080, -1085, -1092, -1097, -1100, -1106, -1107, -1109, -1113, -1107, -1113, -1105, -1107, -1099, 
-    -1099, -1090, -1087, -1072, -1071, -1054, -1049, -1032, -1023, -1006, -993, -975, -958, -940, -921, -901, 
-    -882, -854, -839, -806, -791, -759, -734, -710, -676, -654, -619, -591, -560, -527, -497, -461, 
-    -430, -393, -361, -321, -290, -247, -214, -174, -135, -98, -56, -18, 24, 61, 106, 146, 
-    186, 232, 270, 315, 358, 402, 442, 489, 529, 574, 619, 659, 704, 747, 790, 834, 
-    874, 921, 958, 1006, 1041, 1088, 1123, 1168, 1202, 1247, 1279, 1321, 1352, 1395, 1421, 1462, 
-    1490, 1521, 1557, 1579, 1614, 1636, 1664, 1687, 1714, 1730, 1756, 1772, 1792, 1806, 1825, 1833, 
-    1850, 1858, 1866, 1875, 1879, 1885, 1885, 1889, 1883, 1886, 1877, 1872, 1866, 1850, 1846, 1823, 
-    1816, 1792, 1775, 1753, 1731, 1703, 1679, 1646, 1620, 1584, 1551, 1515, 1474, 1440, 1392, 1353, 
-    1306, 1259, 1213, 1162, 1111, 1057, 1006, 948, 893, 834, 774, 713, 652, 588, 525, 460, 
-    391, 328, 255, 189, 118, 46, -24, -96, -171, -245, -318, -395, -471, -546, -625, -701, 
-    -780, -854, -940, -1008, -1099, -1166, -1254, -1327, -1411, -1484, -1566, -1642, -1722, -1795, -1877, -1946, 
-    -2028, -2099, -2175, -2246, -2319, -2389, -2461, -2529, -2597, -2666, -2731, -2795, -2860, -2922, -2985, -3041, 
-    -3106, -3157, -3220, -3272, -3325, -3379, -3427, -3478, -3525, -3570, -3614, -3657, -3697, -3735, -3770, -3805, 
-    -3835, -3865, -3891, -3914, -3939, -3949, -3972, -3976, -3992, -3992, -3994, -3993, -3985, -3979, -3962, -3947, 
-    -3924, -3900, -3871, -3835, -3799, -3758, -3708, -3661, -3603, -3546, -3482, -3415, -3341, -3268, -3183, -3102, 
-    -3010, -2920, -2818, -2722, -2607, -2507, -2384, -2272, -2147, -2018, -1893, -1753, -1619, -1477, -1329, -1185, 
-    -1029, -876, -717, -554, -395, -222, -59, 116, 286, 464, 636, 821, 991, 1182, 1352, 1541, 
-    1720, 1901, 2084, 2262, 2447, 2620, 2808, 2972, 3161, 3323, 3502, 3668, 3837, 3999, 4164, 4319, 
-    4479, 4626, 4781, 4922, 5067, 5202, 5340, 5466, 5597, 5713, 5838, 5943, 6062, 6157, 6266, 6355, 
-    6450, 6534, 6617, 6695, 6764, 6838, 6894, 6959, 7008, 7060, 7104, 7145, 7178, 7213, 7236, 7261, 
-    7277, 7288, 7302, 7299, 7307, 7296, 7290, 7279, 7260, 7241, 7212, 7188, 7149, 7118, 7073, 7030, 
-    6982, 6926, 6874, 6811, 6749, 6682, 6609, 6534, 6457, 6371, 6290, 6195, 6100, 6005, 5898, 5796, 
-    5680, 5568, 5443, 5323, 5190, 5054, 4918, 4768, 4621, 4462, 4301, 4133, 3959, 3774, 3595, 3395, 
-    3202, 2992, 2780, 2561, 2337, 2102, 1866, 1619, 1370, 1109, 847, 577, 299, 22, -271, -558, 
-    -858, -1162, -1467, -1783, -2097, -2418, -2743, -3070, -3400, -3735, -4070, -4408, -4749, -5093, -5429, -5780, 
-    -6113, -6466, -6798, -7146, -7478, -7820, -8148, -8480, -8804, -9127, -9438, -9753, -10049, -10352, -10635, -10917, 
-    -11189, -11449, -11702, -11947, -12172, -12400, -12603, -12803, -12986, -13159, -13317, -13467, -13599, -13718, -13832, -13920, 
-    -14007, -14075, -14130, -14177, -14208, -14228, -14240, -14235, -14225, -14203, -14169, -14134, -14078, -14028, -13956, -13891, 
-    -13808, -13729, -13633, -13544, -13441, -13336, -13228, -13111, -12996, -12870, -12743, -12608, -12472, -12326, -12176, -12020, 
-    -11854, -11684, -11504, -11313, -11118, -10908, -10691, -10465, -10222, -9978, -9715, -9446, -9166, -8876, -8581, -8272, 
-    -7962, -7641, -7320, -6993, -6665, -6339, -6006, -5687, -5359, -5047, -4731, -4428, -4127, -3837, -3546, -3273, 
-    -2992, -2726, -2453, -2189, -1915, -1644, -1358, -1066, -760, -434, -94, 277, 672, 1094, 1554, 2042, 
-    2571, 3139, 3742, 4389, 5073, 5817, 6587, 7384, 8221, 9070, 9958, 10842, 11753, 12659, 13574, 14476, 
-    15368, 16242, 17109, 17951, 18763, 19541, 19619, 19613, 19619, 19615, 19617, 19618, 19615, 19617, 19617, 19616, 
-    19618, 19617, 19616, 19617, 19616, 19617, 19618, 19615, 19617, 19617, 19615, 19620, 19613, 19621, 19614, 19616, 
-    19618, 19613, 19621, 19612, 19620, 19610, 19621, 19612, 19618, 19617, 19615, 19618, 19616, 19617, 19618, 19615, 
-    19618, 19616, 19617, 19616, 19617, 19617, 19617, 19615, 19619, 19612, 19621, 19613, 18643, 17616, 16585, 15545, 
-    14511, 13472, 12426, 11399, 10375, 9372, 8374, 7398, 6435, 5521, 4624, 3778, 2953, 2175, 1440, 749, 
-    104, -508, -1084, -1646, -2176, -2707, -3210, -3719, -4198, -4694, -5182, -5686, -6196, -6711, -7239, -7768, 
-    -8313, -8866, -9455, -10060, -10693, -11337, -11994, -12661, -13335, -14017, -14698, -15376, -16059, -16733, -17410, -18075, 
-    -18727, -19359, -19654, -19653, -19654, -19654, -19653, -19655, -19653, -19655, -19652, -19655, -19652, -19654, -19652, -19654, 
-    -19653, -19652, -19654, -19651, -19655, -19652, -19656, -19652, -19654, -19652, -19654, -19654, -19655, -19652, -19655, -19654, 
-    -19654, -19654, -19653, -19655, -19652, -19657, -19650, -19656, -19651, -19656, -19652, -19652, -19653, -19650, -19656, -19650, 
-    -19656, -19652, -19656, -19652, -19656, -19651, -19655, -19655, -19649, -19660, -19648, -19658, -19651, -19655, -19652, -19655, 
-    -19652, -19654, -19653, -19652, -19655, -19652, -19656, -19650, -19657, -19653, -19560, -18485, -17392, -16279, -15161, -14021, 
-    -12881, -11729, -10584, -9440, -8311, -7198, -6102, -5037, -3982, -2957, -1944, -951, 24, 983, 1922, 2842, 
-    3744, 4632, 5503, 6369, 7213, 8056, 8870, 9685, 10479, 11263, 12041, 12807, 13568, 14332, 15083, 15853, 
-    16605, 17374, 18135, 18895, 19619, 19613, 19620, 19613, 19619, 19615, 19619, 19614, 19619, 19615, 19617, 19617, 
-    19617, 19616, 19617, 19617, 19617, 19617, 19617, 19617, 19617, 19616, 19617, 19617, 19617, 19616, 19618, 19615, 
-    19619, 19615, 19617, 19616, 19617, 19617, 19617, 19618, 19614, 19619, 19615, 19619, 19616, 19616, 19618, 19615, 
-    19619, 19615, 19616, 19618, 19614, 19619, 19615, 19617, 19617, 19616, 19615, 19619, 19612, 19622, 19611, 19622, 
-    19612, 19620, 19613, 19619, 19615, 19619, 19615, 19618, 19616, 19617, 19617, 19617, 19615, 19619, 19615, 19618, 
-    19615, 19619, 19614, 19620, 19615, 19617, 19616, 18973, 17761, 16544, 15303, 14051, 12786, 11511, 10230, 8946, 
-    7647, 6342, 5029, 3716, 2398, 1090, -219, -1512, -2801, -4076, -5324, -6563, -7768, -8959, -10114, -11249, 
-    -12346, -13424, -14464, -15480, -16471, -17430, -18375, -19289, -19652, -19656, -19652, -19656, -19653, -19654, -19652, -19657, 
-    -19650, -19657, -19652, -19654, -19654, -19653, -19655, -19652, -19656, -19650, -19656, -19650, -19656, -19651, -19655, -19654, 
-    -19652, -19657, -19648, -19658, -19650, -19656, -19654, -19652, -19656, -19650, -19656, -19652, -19654, -19652, -19654, -19653, 
-    -19653, -19656, -19652, -19657, -19651, -19656, -19652, -19655, -19652, -19655, -19650, -19656, -19653, -19653, -19654, -19652, 
-    -19654, -19654, -19654, -19655, -19652, -19654, -19654, -19654, -19655, -19652, -19655, -19650, -19657, -19650, -19658, -19648, 
-    -19659, -19648, -19656, -19651, -19654, -19654, -19654, -19654, -19653, -19655, -19651, -19655, -19652, -19655, -19652, -19655, 
-    -19651, -18554, -16857, -15155, -13429, -11697, -9958, -8207, -6471, -4722, -2997, -1271, 428, 2113, 3778, 5417, 
-    7043, 8632, 10204, 11743, 13252, 14729, 16178, 17588, 18971, 19619, 19613, 19620, 19615, 19617, 19619, 19613, 
-    19621, 19613, 19619, 19617, 19615, 19619, 19614, 19618, 19617, 19616, 19617, 19617, 19614, 19619, 19615, 19617, 
-    19618, 19615, 19618, 19616, 19617, 19617, 19616, 19617, 19617, 19615, 19619, 19616, 19617, 19617, 19615, 19619, 
-    19615, 19619, 19616, 19616, 19619, 19614, 19619, 19615, 19617, 19617, 19617, 19615, 19620, 19613, 19621, 19613, 
-    19619, 19615, 19617, 19616, 19616, 19616, 19617, 19617, 19615, 19618, 19614, 19619, 19617, 19616, 19617, 19617, 
-    19616, 19618, 19617, 19615, 19618, 19617, 19616, 19619, 19615, 19617, 19617, 19616, 19617, 19617, 19615, 19617, 
-    19617, 19615, 19618, 19615, 19618, 19616, 18036, 16431, 14790, 13146, 11473, 9800, 8110, 6419, 4722, 3030, 
-    1333, -343, -2021, -3672, -5317, -6936, -8542, -10121, -11686, -13216, -14738, -16213, -17684, -19106, -19656, -19652, 
-    -19653, -19656, -19651, -19656, -19652, -19654, -19654, -19653, -19654, -19654, -19653, -19654, -19654, -19653, -19654, -19654, 
-    -19651, -19657, -19651, -19656, -19654, -19653, -19654, -19652, -19655, -19654, -19653, -19654, -19654, -19652, -19656, -19652, 
-    -19655, -19654, -19654, -19654, -19653, -19656, -19652, -19655, -19652, -19651, -19656, -19648, -19657, -19650, -19655, -19654, 
-    -19653, -19654, -19652, -19654, -19654, -19654, -19654, -19654, -19652, -19654, -19653, -19653, -19654, -19651, -19655, -19650, 
-    -19656, -19650, -19657, -19651, -19653, -19654, -19652, -19655, -19652, -19656, -19648, -19657, -19649, -19656, -19652, -19657, 
-    -19650, -19657, -19650, -19657, -19650, -19656, -19650, -19654, -19654, -19654, -19654, -19654, -19587, -18182, -16756, -15293, 
-    -13817, -12308, -10791, -9253, -7706, -6154, -4593, -3039, -1490, 49, 1576, 3078, 4574, 6034, 7484, 8899, 
-    10302, 11667, 13025, 14336, 15651, 16913, 18180, 19409, 19618, 19617, 19615, 19619, 19614, 19619, 19615, 19619, 
-    19615, 19617, 19617, 19616, 19618, 19617, 19615, 19619, 19615, 19619, 19615, 19617, 19617, 19615, 19618, 19615, 
-    19616, 19617, 19615, 19617, 19616, 19615, 19617, 19614, 19617, 19617, 19613, 19618, 19615, 19617, 19615, 19617, 
-    19614, 19619, 19615, 19617, 19617, 19617, 19617, 19617, 19615, 19619, 19614, 19619, 19615, 19617, 19617, 19617, 
-    19615, 19619, 19615, 19617, 19618, 19615, 19618, 19615, 19619, 19613, 19620, 19613, 19620, 19613, 19618, 19616, 
-    19617, 19617, 19614, 19618, 19615, 19618, 19617, 19615, 19617, 19618, 19614, 19619, 19613, 19617, 19615, 19616, 
-    19617, 19615, 19609, 18324, 17037, 15731, 14416, 13086, 11748, 10387, 9027, 7637, 6248, 4832, 3414, 1971, 
-    527, -938, -2407, -3892, -5377, -6880, -8376, -9890, -11397, -12910, -14419, -15922, -17423, -18906, -19658, -19650, 
-    -19656, -19652, -19652, -19654, -19653, -19655, -19652, -19653, -19652, -19656, -19650, -19656, -19653, -19652, -19656, -19650, 
-    -19654, -19652, -19654, -19654, -19652, -19656, -19648, -19658, -19649, -19655, -19654, -19652, -19657, -19651, -19656, -19652, 
-    -19656, -19653, -19654, -19654, -19654, -19653, -19653, -19654, -19652, -19655, -19654, -19654, -19654, -19654, -19654, -19654, 
-    -19654, -19652, -19655, -19652, -19654, -19654, -19654, -19652, -19654, -19654, -19653, -19656, -19651, -19656, -19652, -19654, 
-    -19654, -19653, -19654, -19654, -19654, -19653, -19655, -19653, -19654, -19655, -19652, -19656, -19653, -19654, -19652, -19656, 
-    -19650, -19657, -19650, -18627, -17240, -15846, -14440, -13025, -11597, -10168, -8723, -7283, -5831, -4382, -2931, -1483, 
-    -46, 1389, 2803, 4215, 5599, 6975, 8328, 9657, 10973, 12254, 13517, 14754, 15956, 17143, 18287, 19417, 
-    19616, 19615, 19619, 19613, 19620, 19613, 19619, 19616, 19615, 19618, 19616, 19617, 19617, 19614, 19620, 19613, 
-    19620, 19614, 19617, 19617, 19613, 19621, 19612, 19621, 19611, 19621, 19612, 19619, 19614, 19618, 19614, 19619, 
-    19613, 19619, 19616, 19617, 19615, 19620, 19613, 19621, 19613, 19618, 19614, 19618, 19615, 19617, 19618, 19614, 
-    19621, 19613, 19620, 19613, 19619, 19615, 19618, 19617, 19617, 19617, 19615, 19617, 19615, 19619, 19615, 19617, 
-    19617, 19615, 19617, 19617, 19615, 19619, 19615, 19619, 19614, 19618, 19617, 19617, 19617, 19617, 19615, 19619, 
-    19615, 19617, 19616, 19615, 19619, 19615, 18363, 16972, 15598, 14229, 12871, 11521, 10186, 8855, 7540, 6229, 
-    4927, 3626, 2336, 1042, -242, -1535, -2819, -4116, -5402, -6704, -7998, -9302, -10602, -11899, -13198, -14484, 
-    -15768, -17032, -18289, -19518, -19656, -19652, -19656, -19652, -19655, -19652, -19656, -19654, -19653, -19654, -19652, -19653, 
-    -19656, -19650, -19658, -19650, -19656, -19654, -19654, -19654, -19651, -19656, -19650, -19656, -19649, -19656, -19652, -19654, 
-    -19652, -19654, -19654, -19654, -19654, -19652, -19654, -19654, -19652, -19655, -19654, -19654, -19653, -19656, -19651, -19656, 
-    -19652, -19656, -19652, -19655, -19652, -19653, -19656, -19652, -19655, -19652, -19655, -19653, -19654, -19654, -19653, -19654, 
-    -19655, -19652, -19656, -19653, -19652, -19655, -19652, -19654, -19654, -19653, -19654, -19654, -19654, -19653, -19655, -19653, 
-    -19654, -19654, -19652, -19655, -19654, -19652, -19656, -19651, -19656, -19653, -19653, -18645, -17487, -16299, -15097, -13873, 
-    -12624, -11366, -10082, -8792, -7478, -6158, -4817, -3477, -2113, -752, 629, 2016, 3411, 4824, 6234, 7664, 
-    9091, 10525, 11962, 13396, 14836, 16262, 17697, 19109, 19619, 19617, 19616, 19618, 19615, 19617, 19615, 19618, 
-    19615, 19619, 19613, 19619, 19613, 19621, 19611, 19622, 19612, 19621, 19612, 19620, 19613, 19619, 19614, 19618, 
-    19614, 19618, 19614, 19619, 19615, 19617, 19617, 19614, 19619, 19615, 19618, 19616, 19617, 19616, 19619, 19615, 
-    19618, 19615, 19617, 19617, 19616, 19615, 19618, 19613, 19618, 19615, 19617, 19616, 19616, 19619, 19613, 19619, 
-    19614, 19618, 19615, 19616, 19616, 19615, 19618, 19614, 19619, 19613, 19339, 18604, 17882, 17149, 16428, 15700, 
-    14991, 14274, 13582, 12880, 12206, 11526, 10868, 10210, 9566, 8928, 8291, 7668, 7033, 6413, 5775, 5151, 
-    4500, 3855, 3185, 2510, 1809, 1093, 353, -409, -1193, -2006, -2838, -3696, -4577, -5475, -6406, -7339, 
-    -8306, -9281, -10270, -11273, -12290, -13304, -14335, -15355, -16377, -17397, -18397, -19399, -19650, -19655, -19651, -19656, 
-    -19650, -19657, -19652, -19653, -19656, -19652, -19656, -19653, -19652, -19655, -19653, -19654, -19654, -19653, -19653, -19654, 
-    -19652, -19652, -19653, -19652, -19652, -19654, -19655, -19652, -19656, -19652, -19654, -19654, -19653, -19654, -19654, -19654, 
-    -19652, -19654, -19652, -19654, -19653, -19654, -19653, -19654, -19652, -19653, -19654, -19650, -19657, -19648, -19658, -19650, 
-    -19657, -19652, -19653, -19654, -19231, -18340, -17431, -16528, -15616, -14705, -13794, -12882, -11977, -11068, -10170, -9276, 
-    -8384, -7511, -6634, -5780, -4928, -4095, -3268, -2465, -1664, -895, -128, 609, 1336, 2042, 2726, 3397, 
-    4041, 4668, 5275, 5861, 6431, 6983, 7520, 8042, 8555, 9055, 9547, 10036, 10516, 10996, 11475, 11951, 
-    12431, 12917, 13397, 13898, 14388, 14900, 15401, 15925, 16437, 16968, 17496, 18028, 18566, 19096, 19615, 19620, 
-    19613, 19619, 19615, 19617, 19617, 19617, 19615, 19617, 19616, 19615, 19617, 19615, 19618, 19616, 19616, 19618, 
-    19613, 19620, 19613, 19620, 19614, 19621, 19613, 19620, 19615, 19617, 19617, 19614, 19618, 19615, 19617, 19615, 
-    19619, 19614, 19619, 19614, 19618, 19616, 19617, 19617, 19616, 19617, 19485, 19068, 18636, 18180, 17707, 17205, 
-    16680, 16126, 15546, 14932, 14295, 13618, 12922, 12190, 11439, 10658, 9853, 9033, 8183, 7334, 6458, 5587, 
-    4703, 3825, 2947, 2082, 1226, 382, -440, -1246, -2029, -2783, -3519, -4223, -4904, -5551, -6182, -6775, 
-    -7359, -7907, -8453, -8966, -9481, -9970, -10461, -10940, -11413, -11889, -12351, -12828, -13287, -13763, -14223, -14692, 
-    -15155, -15618, -16077, -16534, -16979, -17423, -17851, -18271, -18676, -19065, -19439, -19652, -19654, -19654, -19653, -19655, 
-    -19651, -19655, -19652, -19654, -19654, -19652, -19654, -19652, -19654, -19653, -19654, -19654, -19654, -19654, -19654, -19655, 
-    -19653, -19654, -19654, -19653, -19655, -19654, -19654, -19654, -19654, -19654, -19655, -19652, -19654, -19611, -19332, -19046, 
-    -18727, -18405, -18053, -17686, -17297, -16889, -16454, -15999, -15519, -15016, -14491, -13941, -13368, -12774, -12158, -11520, 
-    -10868, -10193, -9510, -8808, -8102, -7386, -6663, -5939, -5211, -4487, -3759, -3043, -2325, -1621, -924, -232, 
-    440, 1111, 1769, 2414, 3054, 3677, 4299, 4903, 5507, 6093, 6682, 7250, 7828, 8386, 8948, 9495, 
-    10045, 10581, 11112, 11635, 12146, 12650, 13139, 13620, 14081, 14534, 14964, 15381, 15781, 16160, 16520, 16861, 
-    17176, 17476, 17750, 18000, 18236, 18438, 18631, 18787, 18940, 19055, 19166, 19243, 19314, 19356, 19391, 19399, 
-    19399, 19378, 19341, 19292, 19222, 19148, 19048, 18944, 18828, 18691, 18559, 18396, 18238, 18057, 17872, 17674, 
-    17464, 17247, 17019, 16779, 16539, 16280, 16024, 15753, 15482, 15198, 14916, 14618, 14326, 14015, 13712, 13389, 
-    13070, 12737, 12401, 12051, 11699, 11333, 10961, 10580, 10183, 9784, 9365, 8948, 8507, 8067, 7606, 7140, 
-    6659, 6164, 5663, 5143, 4618, 4076, 3523, 2961, 2385, 1806, 1212, 614, 6, -599, -1221, -1834, 
-    -2458, -3080, -3696, -4319, -4929, -5538, -6139, -6728, -7310, -7876, -8431, -8972, -9495, -10002, -10491, -10963, 
-    -11415, -11852, -12261, -12662, -13037, -13395, -13738, -14057, -14371, -14655, -14942, -15201, -15455, -15698, -15923, -16145, 
-    -16353, -16550, -16740, -16919, -17085, -17244, -17387, -17519, -17633, -17736, -17816, -17884, -17926, -17952, -17954, -17930, 
-    -17888, -17816, -17724, -17605, -17466, -17299, -17116, -16910, -16687, -16445, -16192, -15925, -15641, -15357, -15058, -14758, 
-    -14457, -14153, -13848, -13558, -13253, -12975, -12685, -12415, -12140, -11883, -11619, -11370, -11116, -10868, -10617, -10366, 
-    -10111, -9842, -9574, -9285, -8990, -8679, -8351, -8004, -7643, -7258, -6854, -6435, -5992, -5536, -5062, -4577, 
-    -4074, -3565, -3042, -2516, -1983, -1448, -911, -375, 153, 682, 1200, 1708, 2210, 2692, 3165, 3630, 
-    4069, 4510, 4926, 5333, 5734, 6110, 6489, 6843, 7201, 7531, 7875, 8187, 8508, 8816, 9116, 9415, 
-    9706, 9989, 10277, 10548, 10831, 11090, 11363, 11613, 11872, 12115, 12356, 12589, 12817, 13034, 13250, 13449, 
-    13644, 13829, 13995, 14156, 14296, 14421, 14530, 14622, 14690, 14744, 14770, 14783, 14766, 14735, 14673, 14603, 
-    14499, 14387, 14247, 14093, 13924, 13734, 13540, 13323, 13101, 12864, 12620, 12369, 12107, 11842, 11566, 11292, 
-    11006, 10729, 10436, 10158, 9866, 9590, 9299, 9024, 8736, 8462, 8181, 7905, 7629, 7355, 7083, 6809, 
-    6540, 6268, 6004, 5733, 5470, 5204, 4943, 4684, 4424, 4166, 3915, 3658, 3412, 3161, 2914, 2667, 
-    2424, 2173, 1932, 1680, 1435, 1185, 934, 683, 430, 174, -80, -345, -601, -874, -1129, -1409, 
-    -1665, -1950, -2208, -2490, -2759, -3034, -3312, -3587, -3864, -4142, -4418, -4696, -4977, -5253, -5534, -5809, 
-    -6089, -6360, -6637, -6901, -7170, -7429, -7684, -7934, -8174, -8409, -8630, -8849, -9044, -9240, -9411, -9579, 
-    -9722, -9859, -9972, -10078, -10162, -10236, -10290, -10332, -10362, -10371, -10377, -10359, -10343, -10301, -10266, -10207, 
-    -10147, -10085, -10002, -9932, -9843, -9757, -9671, -9573, -9484, -9385, -9283, -9189, -9076, -8977, -8860, -8746, 
-    -8623, -8495, -8355, -8209, -8052, -7880, -7705, -7506, -7306, -7088, -6865, -6628, -6382, -6133, -5872, -5612, 
-    -5343, -5075, -4806, -4538, -4272, -4014, -3755, -3515, -3274, -3056, -2841, -2646, -2464, -2298, -2147, -2019, 
-    -1897, -1804, -1714, -1652, -1590, -1555, -1516, -1500, -1478, -1474, -1461, -1457, -1448, -1436, -1420, -1397, 
-    -1366, -1326, -1278, -1216, -1151, -1065, -977, -872, -757, -639, -498, -362, -204, -51, 115, 283, 
-    459, 636, 823, 1002, 1193, 1378, 1568, 1754, 1944, 2123, 2315, 2488, 2676, 2846, 3029, 3198, 
-    3376, 3545, 3720, 3893, 4065, 4243, 4418, 4593, 4774, 4952, 5132, 5311, 5492, 5667, 5841, 6015, 
-    6175, 6340, 6488, 6628, 6764, 6877, 6984, 7074, 7146, 7206, 7244, 7265, 7270, 7253, 7226, 7174, 
-    7112, 7032, 6939, 6835, 6719, 6596, 6467, 6334, 6198, 6060, 5925, 5795, 5663, 5548, 5431, 5330, 
-    5235, 5155, 5081, 5024, 4978, 4939, 4921, 4905, 4904, 4912, 4922, 4945, 4967, 4992, 5022, 5040, 
-    5068, 5079, 5091, 5093, 5082, 5066, 5034, 4992, 4934, 4865, 4776, 4682, 4565, 4441, 4301, 4151, 
-    3989, 3817, 3638, 3448, 3257, 3054, 2854, 2649, 2439, 2242, 2029, 1843, 1642, 1462, 1286, 1118, 
-    965, 819, 687, 566, 457, 362, 275, 201, 136, 78, 30, -16, -55, -91, -129, -162, 
-    -198, -236, -277, -327, -380, -441, -512, -589, -675, -777, -874, -999, -1116, -1251, -1390, -1535, 
-    -1683, -1844, -1992, -2154, -2305, -2455, -2607, -2741, -2878, -2998, -3117, -3217, -3314, -3392, -3471, -3523, 
-    -3587, -3613, -3659, -3671, -3697, -3702, -3717, -3715, -3727, -3725, -3737, -3745, -3760, -3782, -3803, -3840, 
-    -3877, -3922, -3980, -4036, -4109, -4184, -4264, -4356, -4443, -4543, -4640, -4737, -4838, -4937, -5027, -5121, 
-    -5204, -5280, -5357, -5414, -5469, -5514, -5544, -5568, -5583, -5580, -5581, -5560, -5544, -5515, -5480, -5450, 
-    -5402, -5367, -5318, -5277, -5236, -5188, -5152, -5114, -5074, -5052, -5011, -4998, -4968, -4959, -4936, -4933, 
-    -4917, -4916, -4912, -4905, -4910, -4902, -4905, -4902, -4896, -4891, -4879, -4867, -4850, -4826, -4801, -4765, 
-    -4731, -4680, -4638, -4566, -4511, -4424, -4350, -4249, -4153, -4033, -3920, -3782, -3646, -3493, -3334, -3165, 
-    -2988, -2804, -2609, -2410, -2200, -1984, -1764, -1537, -1306, -1073, -836, -596, -360, -116, 118, 354, 
-    588, 813, 1039, 1253, 1467, 1668, 1868, 2057, 2237, 2415, 2580, 2739, 2899, 3041, 3192, 3328, 
-    3466, 3601, 3731, 3866, 3994, 4130, 4260, 4396, 4531, 4671, 4806, 4952, 5089, 5235, 5381, 5523, 
-    5670, 5811, 5953, 6095, 6229, 6369, 6495, 6629, 6747, 6871, 6986, 7095, 7205, 7303, 7401, 7494, 
-    7579, 7666, 7743, 7824, 7896, 7970, 8040, 8106, 8176, 8237, 8302, 8361, 8420, 8475, 8530, 8578, 
-    8624, 8664, 8699, 8724, 8741, 8754, 8745, 8740, 8709, 8678, 8627, 8563, 8489, 8392, 8287, 8162, 
-    8020, 7868, 7695, 7511, 7312, 7096, 6876, 6627, 6388, 6116, 5853, 5567, 5284, 4984, 4691, 4379, 
-    4076, 3762, 3450, 3140, 2825, 2523, 2214, 1916, 1619, 1327, 1043, 763, 491, 223, -31, -285, 
-    -528, -763, -993, -1212, -1423, -1629, -1823, -2014, -2189, -2364, -2525, -2685, -2832, -2974, -3110, -3238, 
-    -3364, -3483, -3595, -3711, -3811, -3921, -4019, -4114, -4212, -4301, -4390, -4479, -4559, -4643, -4720, -4795, 
-    -4867, -4931, -5003, -5054, -5120, -5170, -5222, -5274, -5314, -5362, -5397, -5439, -5472, -5509, -5542, -5575, 
-    -5610, -5639, -5680, -5708, -5746, -5783, -5816, -5865, -5898, -5945, -5988, -6032, -6081, -6126, -6172, -6219, 
-    -6262, -6307, -6347, -6386, -6423, -6454, -6484, -6508, -6528, -6544, -6551, -6559, -6551, -6552, -6531, -6518, 
-    -6494, -6460, -6435, -6386, -6351, -6299, -6249, -6196, -6133, -6077, -6007, -5941, -5872, -5795, -5725, -5642, 
-    -5569, -5477, -5405, -5306, -5224, -5127, -5028, -4931, -4822, -4714, -4596, -4480, -4352, -4227, -4087, -3950, 
-    -3795, -3646, -3472, -3310, -3124, -2943, -2745, -2545, -2335, -2123, -1901, -1679, -1452, -1220, -989, -753, 
-    -520, -287, -55, 170, 395, 612, 823, 1029, 1218, 1409, 1578, 1745, 1899, 2037, 2171, 2286, 
-    2393, 2489, 2568, 2648, 2704, 2763, 2803, 2841, 2876, 2895, 2922, 2936, 2954, 2968, 2987, 2999, 
-    3024, 3039, 3069, 3097, 3130, 3169, 3212, 3259, 3313, 3373, 3434, 3506, 3575, 3650, 3731, 3809, 
-    3890, 3974, 4051, 4134, 4214, 4289, 4365, 4439, 4505, 4578, 4640, 4703, 4764, 4815, 4877, 4918, 
-    4977, 5016, 5069, 5108, 5159, 5198, 5247, 5297, 5341, 5400, 5450, 5513, 5573, 5640, 5709, 5783, 
-    5861, 5940, 6023, 6108, 6196, 6280, 6370, 6448, 6536, 6610, 6685, 6754, 6811, 6867, 6909, 6944, 
-    6966, 6979, 6980, 6970, 6943, 6906, 6854, 6790, 6715, 6623, 6522, 6408, 6284, 6147, 6004, 5845, 
-    5685, 5510, 5334, 5145, 4957, 4757, 4554, 4352, 4139, 3932, 3716, 3506, 3288, 3078, 2860, 2654, 
-    2438, 2237, 2031, 1833, 1642, 1450, 1271, 1095, 927, 767, 613, 469, 332, 205, 85, -22, 
-    -127, -219, -306, -382, -453, -519, -576, -631, -683, -727, -781, -821, -874, -920, -975, -1030, 
-    -1092, -1155, -1227, -1302, -1387, -1477, -1576, -1685, -1796, -1922, -2046, -2190, -2327, -2482, -2636, -2798, 
-    -2967, -3135, -3311, -3486, -3670, -3848, -4033, -4217, -4397, -4588, -4764, -4952, -5127, -5309, -5486, -5663, 
-    -5840, -6007, -6184, -6343, -6516, -6670, -6835, -6983, -7136, -7279, -7413, -7551, -7667, -7793, -7895, -7999, 
-    -8090, -8172, -8244, -8308, -8358, -8402, -8436, -8455, -8473, -8473, -8470, -8458, -8434, -8407, -8369, -8324, 
-    -8272, -8215, -8149, -8082, -8005, -7927, -7842, -7754, -7660, -7567, -7466, -7361, -7260, -7144, -7042, -6922, 
-    -6810, -6694, -6577, -6459, -6347, -6220, -6114, -5988, -5879, -5760, -5651, -5535, -5429, -5317, -5213, -5108, 
-    -5008, -4907, -4812, -4712, -4620, -4526, -4433, -4341, -4249, -4152, -4062, -3961, -3864, -3758, -3650, -3537, 
-    -3421, -3297, -3167, -3031, -2888, -2737, -2581, -2414, -2245, -2060, -1877, -1673, -1475, -1258, -1038, -810, 
-    -570, -331, -73, 179, 452, 723, 1004, 1294, 1584, 1885, 2185, 2498, 2805, 3125, 3439, 3763, 
-    4084, 4407, 4733, 5052, 5375, 5693, 6008, 6325, 6628, 6940, 7232, 7535, 7820, 8105, 8383, 8653, 
-    8919, 9176, 9430, 9674, 9915, 10144, 10372, 10595, 10804, 11015, 11210, 11410, 11593, 11777, 11947, 12113, 
-    12276, 12425, 12570, 12708, 12836, 12957, 13074, 13174, 13274, 13356, 13437, 13499, 13557, 13601, 13632, 13655, 
-    13659, 13655, 13636, 13599, 13555, 13488, 13415, 13316, 13214, 13081, 12947, 12782, 12616, 12422, 12224, 12000, 
-    11769, 11525, 11261, 10995, 10707, 10419, 10117, 9806, 9494, 9167, 8846, 8516, 8178, 7850, 7508, 7174, 
-    6839, 6497, 6167, 5828, 5496, 5163, 4829, 4501, 4169, 3840, 3508, 3182, 2850, 2526, 2187, 1866, 
-    1527, 1198, 861, 522, 187, -159, -498, -850, -1197, -1557, -1909, -2282, -2640, -3018, -3395, -3776, 
-    -4167, -4559, -4959, -5363, -5774, -6186, -6606, -7024, -7453, -7873, -8305, -8730, -9154, -9580, -9999, -10414, 
-    -10823, -11224, -11617, -11998, -12373, -12730, -13078, -13411, -13730, -14033, -14323, -14597, -14857, -15097, -15326, -15536, 
-    -15733, -15921, -16083, -16247, -16386, -16523, -16647, -16758, -16864, -16957, -17042, -17118, -17186, -17239, -17290, -17318, 
-    -17349, -17353, -17356, -17335, -17305, -17252, -17188, -17102, -16995, -16871, -16718, -16550, -16354, -16138, -15892, -15629, 
-    -15336, -15024, -14688, -14328, -13952, -13550, -13139, -12698, -12255, -11791, -11319, -10841, -10347, -9861, -9360, -8870, 
-    -8368, -7885, -7384, -6917, -6427, -5967, -5501, -5048, -4606, -4166, -3744, -3318, -2911, -2497, -2101, -1697, 
-    -1305, -904, -512, -111, 288, 692, 1105, 1519, 1944, 2376, 2815, 3262, 3723, 4182, 4662, 5136, 
-    5628, 6117, 6616, 7111, 7611, 8106, 8602, 9086, 9575, 10041, 10508, 10959, 11393, 11823, 12226, 12623, 
-    12995, 13356, 13696, 14019, 14328, 14610, 14888, 15139, 15383, 15606, 15820, 16014, 16206, 16375, 16541, 16690, 
-    16836, 16964, 17095, 17206, 17314, 17414, 17506, 17586, 17666, 17727, 17790, 17830, 17874, 17892, 17911, 17907, 
-    17894, 17862, 17819, 17753, 17674, 17574, 17457, 17319, 17164, 16983, 16792, 16568, 16338, 16076, 15801, 15507, 
-    15191, 14862, 14514, 14151, 13776, 13382, 12982, 12562, 12141, 11703, 11261, 10810, 10353, 9891, 9423, 8958, 
-    8479, 8012, 7530, 7061, 6582, 6112, 5633, 5163, 4690, 4217, 3747, 3277, 2803, 2338, 1861, 1392, 
-    920, 442, -30, -516, -994, -1483, -1972, -2463, -2963, -3462, -3962, -4475, -4978, -5495, -6003, -6519, 
-    -7029, -7543, -8051, -8557, -9058, -9555, -10040, -10524, -10990, -11453, -11900, -12335, -12751, -13161, -13542, -13914, 
-    -14266, -14595, -14910, -15204, -15476, -15729, -15965, -16174, -16374, -16545, -16705, -16847, -16964, -17081, -17162, -17252, 
-    -17303, -17363, -17392, -17423, -17431, -17435, -17422, -17404, -17370, -17330, -17278, -17218, -17148, -17067, -16979, -16883, 
-    -16773, -16659, -16528, -16394, -16244, -16085, -15916, -15726, -15539, -15322, -15106, -14867, -14618, -14354, -14078, -13786, 
-    -13479, -13157, -12823, -12469, -12105, -11719, -11324, -10908, -10480, -10037, -9576, -9107, -8618, -8122, -7610, -7090, 
-    -6559, -6021, -5474, -4922, -4365, -3807, -3245, -2682, -2123, -1560, -1008, -452, 94, 639, 1173, 1704, 
-    2225, 2738, 3239, 3737, 4217, 4696, 5158, 5607, 6054, 6476, 6906, 7308, 7713, 8098, 8479, 8851, 
-    9211, 9567, 9912, 10249, 10583, 10900, 11222, 11523, 11829, 12116, 12400, 12677, 12943, 13200, 13452, 13685, 
-    13920, 14131, 14344, 14531, 14719, 14884, 15038, 15180, 15305, 15418, 15515, 15598, 15661, 15723, 15753, 15787, 
-    15789, 15794, 15772, 15751, 15704, 15656, 15587, 15517, 15424, 15334, 15221, 15110, 14979, 14847, 14700, 14546, 
-    14382, 14205, 14020, 13826, 13614, 13397, 13163, 12917, 12658, 12385, 12095, 11792, 11474, 11138, 10788, 10424, 
-    10040, 9648, 9232, 8805, 8370, 7909, 7450, 6966, 6480, 5980, 5473, 4957, 4435, 3906, 3373, 2833, 
-    2294, 1747, 1206, 655, 117, -433, -969, -1514, -2047, -2578, -3110, -3624, -4151, -4652, -5164, -5657, 
-    -6150, -6630, -7105, -7569, -8026, -8469, -8907, -9328, -9742, -10140, -10526, -10896, -11253, -11593, -11916, -12222, 
-    -12511, -12780, -13033, -13262, -13475, -13667, -13840, -13995, -14126, -14242, -14340, -14418, -14481, -14529, -14558, -14578, 
-    -14577, -14571, -14546, -14513, -14470, -14414, -14352, -14282, -14201, -14120, -14023, -13928, -13818, -13710, -13587, -13467, 
-    -13323, -13189, -13030, -12871, -12698, -12511, -12319, -12104, -11882, -11641, -11385, -11118, -10826, -10528, -10201, -9872, 
-    -9518, -9155, -8775, -8384, -7979, -7570, -7141, -6715, -6274, -5828, -5383, -4928, -4476, -4023, -3564, -3119, 
-    -2660, -2222, -1771, -1339, -903, -475, -55, 362, 771, 1177, 1573, 1970, 2356, 2741, 3125, 3497, 
-    3877, 4245, 4616, 4984, 5349, 5711, 6073, 6429, 6787, 7141, 7486, 7834, 8168, 8507, 8833, 9154, 
-    9466, 9771, 10065, 10352, 10624, 10893, 11139, 11381, 11607, 11815, 12018, 12195, 12368, 12515, 12659, 12770, 
-    12885, 12966, 13044, 13100, 13144, 13169, 13183, 13179, 13164, 13136, 13088, 13037, 12961, 12887, 12789, 12687, 
-    12568, 12441, 12307, 12155, 12006, 11829, 11667, 11468, 11288, 11074, 10870, 10644, 10417, 10179, 9928, 9674, 
-    9407, 9136, 8851, 8559, 8258, 7948, 7631, 7301, 6965, 6622, 6268, 5908, 5540, 5162, 4780, 4389, 
-    3992, 3590, 3179, 2770, 2346, 1933, 1500, 1086, 650, 232, -199, -619, -1045, -1465, -1881, -2297, 
-    -2704, -3113, -3508, -3908, -4288, -4677, -5044, -5416, -5771, -6125, -6468, -6799, -7128, -7439, -7749, -8044, 
-    -8333, -8611, -8878, -9143, -9388, -9638, -9866, -10097, -10312, -10526, -10730, -10924, -11114, -11295, -11466, -11636, 
-    -11791, -11948, -12087, -12230, -12354, -12480, -12594, -12695, -12799, -12877, -12965, -13027, -13089, -13136, -13167, -13200, 
-    -13201, -13208, -13188, -13161, -13119, -13057, -12986, -12896, -12789, -12669, -12529, -12374, -12202, -12015, -11805, -11586, 
-    -11344, -11082, -10815, -10518, -10214, -9891, -9553, -9198, -8837, -8448, -8063, -7657, -7245, -6823, -6394, -5958, 
-    -5519, -5073, -4632, -4181, -3737, -3294, -2847, -2421, -1979, -1562, -1138, -728, -320, 71, 467, 845, 
-    1222, 1590, 1948, 2304, 2653, 2995, 3335, 3669, 4002, 4330, 4660, 4982, 5309, 5629, 5953, 6270, 
-    6596, 6902, 7225, 7532, 7836, 8144, 8429, 8728, 9001, 9280, 9539, 9793, 10033, 10261, 10477, 10679, 
-    10870, 11043, 11206, 11350, 11486, 11601, 11712, 11799, 11882, 11947, 11998, 12047, 12074, 12103, 12113, 12119, 
-    12120, 12108, 12098, 12072, 12053, 12012, 11988, 11938, 11903, 11850, 11803, 11749, 11691, 11633, 11566, 11502, 
-    11428, 11353, 11274, 11183, 11097, 10995, 10891, 10780, 10655, 10529, 10386, 10237, 10076, 9902, 9720, 9520, 
-    9308, 9084, 8843, 8590, 8318, 8035, 7736, 7421, 7094, 6750, 6396, 6025, 5647, 5250, 4851, 4435, 
-    4014, 3585, 3146, 2708, 2258, 1811, 1360, 907, 458, 8, -438, -883, -1317, -1756, -2178, -2605, 
-    -3013, -3424, -3817, -4212, -4589, -4963, -5328, -5678, -6026, -6358, -6687, -7001, -7308, -7604, -7893, -8172, 
-    -8444, -8700, -8960, -9196, -9440, -9662, -9886, -10093, -10306, -10494, -10693, -10866, -11047, -11208, -11372, -11519, 
-    -11661, -11798, -11914, -12037, -12135, -12232, -12319, -12388, -12459, -12504, -12556, -12579, -12605, -12614, -12609, -12601, 
-    -12568, -12534, -12481, -12418, -12342, -12256, -12152, -12048, -11918, -11789, -11646, -11486, -11331, -11150, -10973, -10783, 
-    -10580, -10378, -10158, -9936, -9705, -9465, -9219, -8966, -8702, -8437, -8162, -7884, -7600, -7313, -7020, -6727, 
-    -6425, -6133, -5822, -5528, -5217, -4916, -4607, -4307, -3996, -3696, -3389, -3083, -2783, -2474, -2177, -1868, 
-    -1571, -1263, -963, -661, -355, -57, 249, 551, 854, 1158, 1459, 1763, 2065, 2364, 2664, 2957, 
-    3253, 3539, 3829, 4107, 4386, 4656, 4920, 5181, 5433, 5681, 5918, 6149, 6376, 6590, 6800, 7003, 
-    7194, 7384, 7565, 7735, 7907, 8067, 8224, 8378, 8522, 8668, 8804, 8940, 9068, 9196, 9312, 9433, 
-    9541, 9648, 9753, 9838, 9935, 10012, 10087, 10156, 10212, 10259, 10307, 10329, 10358, 10361, 10361, 10351, 
-    10320, 10294, 10234, 10182, 10104, 10021, 9921, 9813, 9687, 9557, 9409, 9256, 9089, 8917, 8733, 8548, 
-    8349, 8154, 7943, 7742, 7522, 7314, 7097, 6879, 6667, 6446, 6233, 6017, 5803, 5593, 5377, 5169, 
-    4955, 4747, 4539, 4327, 4117, 3906, 3694, 3482, 3263, 3045, 2825, 2602, 2374, 2144, 1911, 1675, 
-    1431, 1193, 942, 697, 443, 193, -62, -309, -565, -811, -1061, -1302, -1541, -1774, -2002, -2224, 
-    -2435, -2644, -2842, -3034, -3214, -3392, -3554, -3716, -3861, -4008, -4136, -4268, -4381, -4494, -4603, -4698, 
-    -4793, -4881, -4959, -5044, -5111, -5184, -5246, -5308, -5365, -5421, -5467, -5516, -5558, -5596, -5634, -5660, 
-    -5690, -5711, -5729, -5740, -5750, -5750, -5754, -5744, -5735, -5720, -5704, -5681, -5661, -5630, -5606, -5571, 
-    -5544, -5509, -5478, -5445, -5409, -5379, -5338, -5311, -5268, -5239, -5200, -5160, -5130, -5084, -5046, -5009, 
-    -4959, -4921, -4871, -4822, -4773, -4719, -4665, -4606, -4548, -4482, -4424, -4352, -4288, -4218, -4146, -4075, 
-    -4001, -3926, -3854, -3776, -3702, -3628, -3552, -3478, -3404, -3328, -3257, -3181, -3113, -3037, -2969, -2898, 
-    -2829, -2759, -2691, -2619, -2552, -2478, -2409, -2333, -2263, -2183, -2108, -2026, -1942, -1860, -1770, -1684, 
-    -1588, -1498, -1395, -1302, -1192, -1094, -981, -876, -762, -649, -533, -417, -298, -180, -59, 61, 
-    176, 298, 413, 530, 640, 753, 858, 962, 1061, 1154, 1251, 1331, 1423, 1494, 1572, 1642, 
-    1707, 1771, 1827, 1883, 1933, 1981, 2027, 2069, 2110, 2150, 2187, 2226, 2262, 2298, 2335, 2369, 
-    2407, 2442, 2481, 2515, 2556, 2591, 2632, 2670, 2708, 2751, 2785, 2829, 2860, 2908, 2934, 2978, 
-    3010, 3043, 3082, 3109, 3146, 3178, 3208, 3240, 3268, 3304, 3325, 3367, 3382, 3427, 3448, 3484, 
-    3515, 3546, 3585, 3616, 3660, 3697, 3741, 3788, 3834, 3890, 3944, 4000, 4067, 4128, 4201, 4268, 
-    4345, 4420, 4497, 4573, 4652, 4728, 4803, 4875, 4945, 5013, 5071, 5136, 5179, 5235, 5266, 5307, 
-    5327, 5350, 5353, 5363, 5346, 5338, 5311, 5273, 5241, 5180, 5129, 5059, 4984, 4906, 4814, 4721, 
-    4620, 4510, 4399, 4278, 4155, 4031, 3893, 3766, 3620, 3484, 3338, 3192, 3044, 2888, 2741, 2578, 
-    2430, 2266, 2111, 1949, 1789, 1628, 1465, 1307, 1142, 986, 819, 667, 504, 349, 195, 39, 
-    -109, -261, -408, -555, -699, -839, -981, -1113, -1255, -1377, -1511, -1632, -1756, -1874, -1987, -2103, 
-    -2207, -2317, -2418, -2514, -2613, -2702, -2794, -2878, -2963, -3041, -3116, -3193, -3260, -3331, -3397, -3458, 
-    -3525, -3580, -3646, -3700, -3764, -3819, -3882, -3943, -4004, -4068, -4136, -4203, -4276, -4354, -4424, -4515, 
-    -4591, -4684, -4771, -4869, -4959, -5064, -5161, -5263, -5371, -5472, -5583, -5686, -5792, -5900, -5998, -6106, 
-    -6196, -6299, -6384, -6478, -6554, -6638, -6704, -6774, -6833, -6887, -6933, -6972, -7004, -7028, -7044, -7052, 
-    -7048, -7041, -7018, -6993, -6951, -6905, -6845, -6778, -6698, -6609, -6509, -6399, -6278, -6149, -6003, -5859, 
-    -5694, -5529, -5348, -5161, -4973, -4767, -4564, -4346, -4131, -3908, -3683, -3456, 
-};
-const unsigned int drum_v0_p0_short_len = 5292;
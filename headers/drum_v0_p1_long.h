@@ -1,741 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v0_p1_long[] PROGMEM = {
-    7, -4, 9, 11, 16, 19, 22, 21, 22, 18, 15, 16, 7, 8, 0, -3, 
-    -8, -16, -20, -30, -32, -43, -47, -58, -65, -71, -83, -88, -100, -108, -117, -130, 
-    -137, -149, -160, -170, -184, -192, -206, -216, -229, -241, -252, -263, -274, -287, -296, -310, 
-    -316, -332, -337, -352, -358, -370, -377, -388, -396, -405, -411, -423, -427, -440, -443, -452, 
-    -460, -466, -476, -480, -490, -496, -504, -510, -518, -526, -533, -540, -548, -556, -563, -570, 
-    -579, -584, -592, -599, -606, -612, -619, -625, -631, -636, -641, -648, -648, -657, -653, -663, 
-    -660, -665, -663, -664, -665, -664, -662, -660, -659, -656, -652, -649, -645, -640, -634, -630, 
-    -621, -618, -609, -603, -595, -587, -577, -572, -557, -554, -537, -533, -514, -511, -491, -486, 
-    -464, -458, -438, -430, -409, -397, -381, -364, -350, -331, -316, -300, -281, -266, -246, -233, 
-    -213, -197, -178, -164, -145, -129, -111, -97, -77, -65, -43, -33, -11, -1, 18, 31, 
-    49, 61, 78, 93, 106, 123, 134, 153, 164, 181, 192, 209, 222, 236, 251, 266, 
-    280, 296, 309, 324, 339, 354, 369, 383, 399, 413, 428, 442, 457, 471, 483, 498, 
-    509, 525, 532, 547, 556, 568, 577, 587, 596, 605, 612, 620, 627, 634, 640, 646, 
-    652, 657, 664, 666, 673, 675, 681, 685, 687, 690, 695, 696, 698, 700, 699, 702, 
-    700, 701, 699, 695, 694, 688, 685, 678, 673, 663, 659, 644, 641, 623, 617, 601, 
-    591, 574, 563, 547, 531, 515, 498, 483, 465, 448, 430, 412, 394, 376, 355, 338, 
-    316, 298, 277, 255, 235, 211, 188, 164, 142, 115, 92, 62, 40, 8, -16, -46, 
-    -74, -103, -133, -164, -193, -225, -254, -285, -316, -347, -377, -409, -436, -469, -497, -526, 
-    -555, -582, -612, -638, -665, -690, -715, -741, -763, -788, -809, -831, -852, -872, -892, -909, 
-    -928, -944, -961, -977, -992, -1005, -1018, -1031, -1042, -1053, -1062, -1071, -1080, -1086, -1093, -1096, 
-    -1103, -1103, -1107, -1105, -1106, -1105, -1100, -1098, -1091, -1087, -1075, -1068, -1056, -1045, -1031, -1017, 
-    -1000, -984, -964, -945, -924, -902, -880, -852, -830, -798, -778, -740, -718, -680, -654, -617, 
-    -585, -549, -515, -477, -440, -401, -363, -322, -283, -238, -200, -154, -113, -67, -24, 22, 
-    65, 114, 157, 207, 253, 300, 350, 397, 444, 495, 540, 592, 639, 687, 736, 784, 
-    832, 879, 928, 974, 1022, 1066, 1114, 1156, 1203, 1244, 1288, 1326, 1370, 1406, 1446, 1481, 
-    1516, 1554, 1582, 1617, 1642, 1673, 1699, 1724, 1746, 1770, 1786, 1808, 1821, 1836, 1849, 1858, 
-    1867, 1874, 1876, 1881, 1878, 1877, 1873, 1866, 1859, 1844, 1835, 1813, 1801, 1774, 1755, 1728, 
-    1700, 1670, 1637, 1603, 1564, 1527, 1482, 1441, 1392, 1345, 1295, 1241, 1189, 1131, 1073, 1013, 
-    952, 887, 824, 755, 688, 617, 547, 475, 398, 326, 247, 171, 92, 11, -67, -150, 
-    -233, -315, -400, -486, -570, -658, -744, -830, -921, -1004, -1097, -1181, -1272, -1359, -1448, -1533, 
-    -1623, -1708, -1795, -1881, -1964, -2050, -2131, -2214, -2295, -2374, -2453, -2530, -2606, -2682, -2754, -2826, 
-    -2897, -2967, -3032, -3101, -3161, -3229, -3285, -3347, -3402, -3459, -3511, -3562, -3611, -3657, -3702, -3742, 
-    -3782, -3815, -3851, -3878, -3906, -3926, -3946, -3961, -3971, -3979, -3978, -3978, -3968, -3960, -3940, -3921, 
-    -3891, -3864, -3822, -3783, -3734, -3681, -3623, -3559, -3490, -3415, -3335, -3251, -3159, -3064, -2963, -2855, 
-    -2745, -2624, -2506, -2375, -2245, -2105, -1962, -1817, -1660, -1508, -1341, -1181, -1006, -836, -653, -476, 
-    -288, -101, 89, 283, 477, 677, 875, 1077, 1279, 1480, 1686, 1885, 2091, 2291, 2494, 2694, 
-    2893, 3088, 3286, 3473, 3669, 3849, 4038, 4212, 4393, 4560, 4732, 4892, 5053, 5206, 5357, 5499, 
-    5639, 5772, 5901, 6023, 6141, 6252, 6359, 6457, 6553, 6641, 6723, 6801, 6871, 6936, 6997, 7048, 
-    7100, 7136, 7179, 7203, 7235, 7248, 7267, 7272, 7277, 7273, 7264, 7253, 7234, 7209, 7181, 7147, 
-    7109, 7066, 7016, 6965, 6904, 6843, 6774, 6703, 6627, 6541, 6459, 6362, 6273, 6166, 6062, 5950, 
-    5835, 5712, 5585, 5450, 5314, 5167, 5016, 4859, 4692, 4523, 4342, 4159, 3964, 3760, 3555, 3335, 
-    3113, 2876, 2636, 2386, 2127, 1861, 1587, 1304, 1013, 717, 409, 100, -224, -548, -881, -1223, 
-    -1565, -1920, -2272, -2637, -3000, -3371, -3743, -4121, -4496, -4883, -5259, -5648, -6025, -6414, -6792, -7175, 
-    -7550, -7928, -8295, -8663, -9022, -9375, -9723, -10059, -10390, -10707, -11018, -11314, -11599, -11874, -12129, -12381, 
-    -12606, -12825, -13024, -13209, -13378, -13532, -13664, -13791, -13887, -13981, -14048, -14107, -14146, -14172, -14185, -14181, 
-    -14167, -14138, -14099, -14050, -13988, -13919, -13838, -13754, -13656, -13555, -13446, -13332, -13211, -13085, -12952, -12816, 
-    -12669, -12522, -12363, -12200, -12026, -11846, -11653, -11456, -11238, -11021, -10778, -10537, -10267, -9999, -9705, -9408, 
-    -9090, -8769, -8430, -8088, -7730, -7374, -7006, -6644, -6274, -5909, -5545, -5188, -4836, -4492, -4155, -3829, 
-    -3506, -3199, -2889, -2591, -2287, -1990, -1681, -1369, -1036, -697, -323, 63, 500, 951, 1463, 1998, 
-    2597, 3228, 3923, 4651, 5457, 6303, 7192, 8112, 9075, 10054, 11062, 12068, 13098, 14101, 15117, 16079, 
-    17073, 17976, 18943, 19561, 19521, 19555, 19533, 19548, 19538, 19545, 19540, 19544, 19540, 19545, 19540, 19544, 
-    19541, 19543, 19543, 19541, 19544, 19540, 19545, 19539, 19545, 19539, 19544, 19540, 19544, 19540, 19543, 19538, 
-    19544, 19538, 19544, 19540, 19543, 19541, 19543, 19541, 19543, 19540, 19545, 19537, 19547, 19535, 19551, 19530, 
-    19558, 19515, 19592, 19349, 18149, 17043, 15852, 14717, 13538, 12386, 11221, 10095, 8962, 7868, 6773, 5739, 
-    4729, 3780, 2858, 1999, 1187, 440, -264, -919, -1551, -2149, -2738, -3305, -3863, -4403, -4958, -5509, 
-    -6083, -6654, -7246, -7838, -8451, -9080, -9753, -10444, -11167, -11894, -12645, -13395, -14162, -14919, -15683, -16438, 
-    -17196, -17941, -18674, -19355, -19594, -19572, -19584, -19575, -19582, -19577, -19581, -19576, -19581, -19577, -19580, -19576, 
-    -19580, -19576, -19580, -19576, -19581, -19577, -19581, -19576, -19580, -19576, -19582, -19577, -19580, -19578, -19580, -19578, 
-    -19580, -19578, -19580, -19579, -19579, -19578, -19579, -19579, -19578, -19577, -19577, -19579, -19578, -19578, -19580, -19578, 
-    -19581, -19577, -19580, -19579, -19577, -19582, -19576, -19582, -19576, -19580, -19577, -19581, -19576, -19581, -19576, -19583, 
-    -19574, -19585, -19568, -19602, -19387, -18151, -16939, -15680, -14427, -13142, -11866, -10575, -9304, -8038, -6803, -5586, 
-    -4408, -3242, -2115, -994, 90, 1166, 2204, 3231, 4225, 5213, 6174, 7131, 8062, 8983, 9881, 10771, 
-    11636, 12508, 13349, 14215, 15043, 15918, 16741, 17628, 18436, 19350, 19585, 19521, 19556, 19532, 19550, 19535, 
-    19547, 19537, 19545, 19539, 19545, 19539, 19545, 19539, 19545, 19540, 19544, 19540, 19543, 19540, 19545, 19539, 
-    19545, 19539, 19545, 19541, 19543, 19541, 19544, 19540, 19544, 19539, 19544, 19541, 19544, 19541, 19542, 19542, 
-    19542, 19543, 19540, 19543, 19540, 19544, 19541, 19543, 19543, 19540, 19544, 19539, 19544, 19540, 19544, 19540, 
-    19543, 19540, 19543, 19542, 19543, 19541, 19544, 19540, 19545, 19539, 19544, 19539, 19544, 19539, 19546, 19536, 
-    19552, 19526, 19579, 19172, 17903, 16534, 15147, 13746, 12326, 10899, 9464, 8020, 6560, 5095, 3623, 2154, 
-    688, -769, -2212, -3645, -5050, -6434, -7787, -9111, -10400, -11654, -12870, -14054, -15192, -16311, -17376, -18451, 
-    -19372, -19592, -19576, -19580, -19580, -19578, -19579, -19579, -19578, -19580, -19578, -19579, -19579, -19579, -19579, -19579, 
-    -19579, -19578, -19579, -19579, -19578, -19579, -19578, -19580, -19576, -19581, -19577, -19582, -19576, -19581, -19576, -19581, 
-    -19577, -19579, -19578, -19579, -19578, -19581, -19578, -19581, -19577, -19580, -19578, -19579, -19578, -19578, -19579, -19580, 
-    -19577, -19580, -19577, -19581, -19578, -19581, -19577, -19580, -19578, -19581, -19578, -19579, -19577, -19580, -19577, -19581, 
-    -19576, -19582, -19575, -19581, -19575, -19582, -19577, -19581, -19576, -19582, -19574, -19583, -19574, -19586, -19570, -19586, 
-    -18390, -16464, -14573, -12624, -10696, -8732, -6793, -4836, -2907, -978, 915, 2796, 4641, 6466, 8256, 10014, 
-    11741, 13418, 15075, 16661, 18272, 19425, 19551, 19543, 19539, 19546, 19539, 19544, 19541, 19542, 19543, 19541, 
-    19543, 19541, 19542, 19543, 19540, 19544, 19538, 19545, 19540, 19544, 19541, 19542, 19542, 19542, 19542, 19542, 
-    19542, 19543, 19539, 19545, 19539, 19545, 19539, 19545, 19539, 19545, 19539, 19544, 19540, 19543, 19542, 19542, 
-    19542, 19542, 19541, 19544, 19540, 19545, 19538, 19545, 19538, 19545, 19538, 19545, 19539, 19544, 19539, 19544, 
-    19539, 19547, 19537, 19547, 19537, 19547, 19538, 19545, 19537, 19548, 19535, 19551, 19533, 19551, 19532, 19553, 
-    19531, 19554, 19527, 19561, 19517, 19576, 19487, 19660, 18365, 16431, 14679, 12781, 10951, 9041, 7176, 5259, 
-    3383, 1472, -393, -2276, -4112, -5950, -7747, -9531, -11281, -13002, -14703, -16343, -18019, -19364, -19591, -19579, 
-    -19577, -19582, -19576, -19583, -19575, -19584, -19574, -19584, -19575, -19583, -19576, -19581, -19577, -19581, -19576, -19583, 
-    -19575, -19584, -19574, -19583, -19574, -19584, -19575, -19582, -19576, -19581, -19578, -19581, -19577, -19581, -19577, -19581, 
-    -19578, -19580, -19577, -19580, -19575, -19581, -19574, -19583, -19574, -19585, -19574, -19583, -19574, -19583, -19576, -19583, 
-    -19576, -19581, -19576, -19582, -19575, -19581, -19575, -19581, -19575, -19581, -19576, -19582, -19573, -19584, -19573, -19584, 
-    -19574, -19582, -19573, -19584, -19572, -19587, -19571, -19587, -19570, -19589, -19568, -19590, -19564, -19595, -19559, -19606, 
-    -19538, -19640, -18481, -16768, -15204, -13500, -11847, -10113, -8412, -6657, -4934, -3175, -1461, 277, 1961, 3656, 
-    5295, 6935, 8516, 10101, 11617, 13148, 14591, 16080, 17433, 18946, 19571, 19518, 19558, 19530, 19551, 19535, 
-    19549, 19537, 19547, 19538, 19545, 19540, 19545, 19539, 19545, 19539, 19546, 19538, 19546, 19537, 19547, 19537, 
-    19545, 19538, 19545, 19539, 19543, 19540, 19542, 19540, 19543, 19538, 19545, 19538, 19545, 19538, 19544, 19540, 
-    19544, 19540, 19545, 19539, 19545, 19538, 19546, 19537, 19546, 19537, 19546, 19538, 19544, 19540, 19544, 19539, 
-    19546, 19537, 19546, 19537, 19546, 19538, 19547, 19537, 19546, 19537, 19547, 19536, 19547, 19535, 19549, 19534, 
-    19551, 19531, 19556, 19527, 19557, 19523, 19562, 19515, 19577, 19488, 19649, 18790, 17201, 15828, 14299, 12857, 
-    11318, 9827, 8267, 6732, 5142, 3569, 1948, 339, -1309, -2949, -4617, -6280, -7966, -9643, -11343, -13021, 
-    -14722, -16380, -18102, -19407, -19603, -19570, -19584, -19573, -19582, -19576, -19581, -19576, -19579, -19578, -19577, -19579, 
-    -19579, -19578, -19579, -19576, -19580, -19578, -19580, -19577, -19580, -19576, -19582, -19574, -19583, -19575, -19583, -19576, 
-    -19582, -19576, -19583, -19576, -19581, -19577, -19580, -19577, -19580, -19576, -19581, -19578, -19581, -19578, -19580, -19578, 
-    -19580, -19576, -19581, -19576, -19581, -19577, -19579, -19577, -19580, -19578, -19581, -19576, -19582, -19576, -19583, -19576, 
-    -19582, -19576, -19581, -19576, -19583, -19575, -19585, -19573, -19586, -19572, -19586, -19569, -19592, -19556, -19629, -18691, 
-    -17112, -15575, -13984, -12409, -10802, -9202, -7581, -5969, -4339, -2724, -1102, 499, 2101, 3674, 5239, 6771, 
-    8294, 9772, 11245, 12661, 14074, 15424, 16767, 18049, 19307, 19551, 19538, 19543, 19540, 19543, 19540, 19544, 
-    19539, 19544, 19540, 19544, 19539, 19544, 19540, 19543, 19541, 19542, 19542, 19541, 19543, 19541, 19542, 19540, 
-    19543, 19539, 19544, 19539, 19544, 19540, 19543, 19542, 19542, 19541, 19544, 19539, 19545, 19538, 19544, 19539, 
-    19543, 19540, 19545, 19539, 19546, 19538, 19546, 19537, 19546, 19538, 19547, 19538, 19546, 19537, 19546, 19537, 
-    19547, 19536, 19549, 19534, 19550, 19534, 19550, 19534, 19550, 19533, 19551, 19533, 19552, 19532, 19553, 19529, 
-    19560, 19520, 19571, 19496, 19631, 19145, 17519, 16032, 14461, 12969, 11438, 9962, 8464, 7006, 5536, 4088, 
-    2635, 1196, -247, -1687, -3129, -4575, -6018, -7475, -8920, -10387, -11824, -13293, -14706, -16173, -17524, -19036, 
-    -19633, -19543, -19605, -19560, -19595, -19565, -19593, -19567, -19590, -19568, -19587, -19572, -19585, -19574, -19583, -19575, 
-    -19584, -19574, -19582, -19574, -19582, -19575, -19580, -19576, -19582, -19575, -19582, -19576, -19582, -19576, -19581, -19577, 
-    -19581, -19576, -19583, -19575, -19583, -19576, -19581, -19577, -19582, -19576, -19581, -19576, -19581, -19578, -19580, -19577, 
-    -19581, -19578, -19580, -19578, -19580, -19578, -19581, -19577, -19582, -19575, -19582, -19575, -19582, -19576, -19581, -19577, 
-    -19582, -19575, -19583, -19575, -19582, -19575, -19582, -19576, -19583, -19573, -19587, -19565, -19608, -19467, -18252, -16960, 
-    -15612, -14264, -12867, -11467, -10031, -8587, -7115, -5633, -4131, -2622, -1093, 440, 1998, 3553, 5138, 6714, 
-    8322, 9911, 11529, 13120, 14746, 16316, 17971, 19317, 19556, 19540, 19542, 19543, 19540, 19543, 19541, 19543, 
-    19541, 19542, 19541, 19543, 19540, 19544, 19541, 19543, 19540, 19543, 19541, 19542, 19541, 19542, 19541, 19541, 
-    19543, 19541, 19543, 19540, 19543, 19541, 19542, 19542, 19541, 19543, 19542, 19542, 19541, 19541, 19544, 19540, 
-    19543, 19540, 19542, 19541, 19542, 19541, 19543, 19542, 19541, 19542, 19541, 19542, 19541, 19541, 19542, 19542, 
-    19540, 19549, 19445, 18786, 17936, 17143, 16316, 15520, 14712, 13931, 13144, 12382, 11621, 10883, 10146, 9430, 
-    8713, 8011, 7304, 6606, 5899, 5195, 4474, 3747, 2998, 2235, 1441, 629, -218, -1088, -1997, -2926, 
-    -3895, -4881, -5905, -6946, -8013, -9105, -10207, -11331, -12467, -13606, -14758, -15894, -17043, -18161, -19281, -19589, 
-    -19572, -19583, -19575, -19581, -19578, -19578, -19580, -19578, -19580, -19578, -19578, -19580, -19578, -19580, -19578, -19579, 
-    -19578, -19578, -19577, -19579, -19577, -19579, -19579, -19578, -19580, -19578, -19580, -19579, -19578, -19580, -19579, -19578, 
-    -19578, -19578, -19578, -19580, -19578, -19580, -19577, -19579, -19578, -19578, -19579, -19578, -19581, -19577, -19581, -19576, 
-    -19568, -18997, -17965, -16964, -15942, -14927, -13904, -12888, -11872, -10860, -9855, -8857, -7869, -6893, -5925, -4979, 
-    -4039, -3126, -2220, -1343, -481, 355, 1173, 1965, 2734, 3479, 4196, 4889, 5559, 6201, 6827, 7427, 
-    8016, 8584, 9145, 9690, 10237, 10768, 11311, 11836, 12381, 12913, 13466, 14012, 14579, 15137, 15722, 16290, 
-    16890, 17467, 18084, 18652, 19302, 19590, 19518, 19558, 19531, 19550, 19536, 19548, 19535, 19547, 19536, 19547, 
-    19537, 19547, 19537, 19546, 19538, 19545, 19539, 19544, 19540, 19545, 19538, 19546, 19538, 19545, 19539, 19544, 
-    19540, 19543, 19541, 19544, 19540, 19544, 19539, 19546, 19538, 19547, 19537, 19539, 19282, 18785, 18299, 17769, 
-    17222, 16631, 16016, 15356, 14668, 13933, 13168, 12362, 11528, 10657, 9760, 8835, 7887, 6925, 5947, 4966, 
-    3979, 2999, 2030, 1075, 135, -776, -1667, -2523, -3350, -4145, -4903, -5630, -6322, -6985, -7618, -8229, 
-    -8815, -9387, -9939, -10485, -11019, -11550, -12075, -12600, -13123, -13646, -14168, -14687, -15208, -15722, -16237, -16739, 
-    -17237, -17720, -18190, -18642, -19076, -19465, -19591, -19574, -19582, -19577, -19579, -19578, -19579, -19579, -19579, -19578, 
-    -19579, -19578, -19579, -19579, -19579, -19579, -19579, -19580, -19579, -19578, -19579, -19578, -19580, -19579, -19578, -19580, 
-    -19577, -19582, -19575, -19585, -19505, -19183, -18857, -18493, -18121, -17709, -17285, -16824, -16341, -15823, -15283, -14706, 
-    -14108, -13471, -12816, -12125, -11416, -10678, -9924, -9149, -8363, -7565, -6759, -5948, -5136, -4323, -3514, -2713, 
-    -1916, -1135, -359, 396, 1145, 1879, 2599, 3309, 4003, 4689, 5360, 6024, 6675, 7318, 7955, 8583, 
-    9203, 9816, 10421, 11015, 11600, 12172, 12731, 13276, 13803, 14313, 14805, 15270, 15721, 16142, 16543, 16913, 
-    17259, 17579, 17868, 18133, 18366, 18575, 18753, 18909, 19037, 19142, 19221, 19278, 19314, 19327, 19322, 19294, 
-    19248, 19180, 19099, 18995, 18878, 18748, 18597, 18441, 18258, 18073, 17862, 17650, 17413, 17174, 16913, 16649, 
-    16371, 16083, 15788, 15483, 15171, 14850, 14522, 14189, 13845, 13496, 13136, 12771, 12394, 12006, 11609, 11199, 
-    10781, 10346, 9901, 9441, 8971, 8485, 7987, 7473, 6947, 6402, 5845, 5271, 4684, 4082, 3462, 2832, 
-    2186, 1534, 865, 190, -489, -1179, -1869, -2564, -3259, -3950, -4642, -5320, -5998, -6656, -7310, -7938, 
-    -8558, -9154, -9733, -10286, -10821, -11328, -11818, -12274, -12718, -13128, -13525, -13889, -14244, -14567, -14886, -15176, 
-    -15459, -15723, -15973, -16214, -16437, -16651, -16852, -17038, -17213, -17369, -17508, -17629, -17728, -17806, -17858, -17884, 
-    -17883, -17850, -17791, -17697, -17577, -17424, -17244, -17036, -16806, -16549, -16275, -15983, -15673, -15353, -15025, -14685, 
-    -14353, -14007, -13677, -13341, -13018, -12700, -12390, -12088, -11796, -11507, -11227, -10945, -10667, -10386, -10102, -9802, 
-    -9500, -9176, -8841, -8485, -8106, -7708, -7284, -6832, -6363, -5864, -5349, -4812, -4260, -3691, -3112, -2521, 
-    -1928, -1327, -728, -130, 458, 1046, 1613, 2178, 2714, 3247, 3755, 4248, 4729, 5186, 5636, 6063, 
-    6480, 6882, 7271, 7647, 8017, 8366, 8721, 9052, 9392, 9711, 10034, 10345, 10657, 10957, 11255, 11545, 
-    11828, 12104, 12368, 12630, 12877, 13121, 13349, 13568, 13775, 13961, 14137, 14288, 14421, 14533, 14618, 14680, 
-    14715, 14724, 14706, 14659, 14588, 14489, 14366, 14219, 14046, 13858, 13644, 13422, 13175, 12920, 12648, 12370, 
-    12078, 11781, 11474, 11163, 10848, 10530, 10210, 9892, 9573, 9257, 8942, 8627, 8317, 8005, 7696, 7390, 
-    7084, 6780, 6477, 6176, 5877, 5578, 5283, 4987, 4700, 4407, 4121, 3838, 3554, 3278, 2998, 2723, 
-    2449, 2171, 1899, 1619, 1345, 1063, 784, 500, 217, -71, -362, -656, -952, -1250, -1550, -1852, 
-    -2156, -2459, -2769, -3070, -3386, -3689, -4004, -4309, -4623, -4932, -5247, -5555, -5869, -6174, -6484, -6783, 
-    -7083, -7374, -7661, -7937, -8207, -8462, -8711, -8940, -9157, -9357, -9540, -9704, -9850, -9975, -10082, -10170, 
-    -10239, -10287, -10321, -10334, -10334, -10315, -10286, -10240, -10189, -10116, -10051, -9956, -9879, -9774, -9685, -9576, 
-    -9476, -9367, -9255, -9144, -9025, -8907, -8778, -8645, -8506, -8352, -8190, -8013, -7823, -7619, -7397, -7164, 
-    -6916, -6657, -6383, -6103, -5812, -5519, -5218, -4918, -4618, -4319, -4029, -3741, -3471, -3206, -2964, -2731, 
-    -2524, -2329, -2160, -2011, -1882, -1774, -1685, -1614, -1562, -1521, -1495, -1475, -1466, -1455, -1449, -1437, 
-    -1422, -1400, -1367, -1324, -1269, -1201, -1121, -1023, -918, -790, -661, -508, -352, -178, -3, 184, 
-    375, 574, 778, 983, 1191, 1403, 1610, 1824, 2028, 2238, 2439, 2643, 2839, 3038, 3231, 3427, 
-    3617, 3814, 4005, 4203, 4398, 4596, 4797, 4997, 5197, 5400, 5597, 5792, 5987, 6167, 6349, 6510, 
-    6667, 6806, 6926, 7034, 7115, 7183, 7220, 7242, 7236, 7213, 7165, 7098, 7012, 6907, 6790, 6658, 
-    6518, 6371, 6220, 6066, 5915, 5768, 5624, 5494, 5368, 5260, 5161, 5079, 5010, 4959, 4916, 4899, 
-    4883, 4891, 4897, 4921, 4944, 4974, 5003, 5028, 5054, 5065, 5075, 5067, 5050, 5017, 4967, 4903, 
-    4817, 4717, 4598, 4461, 4310, 4142, 3961, 3769, 3563, 3352, 3131, 2906, 2678, 2445, 2220, 1989, 
-    1776, 1557, 1362, 1167, 993, 828, 680, 546, 428, 324, 234, 158, 90, 34, -16, -59, 
-    -101, -141, -179, -221, -265, -319, -379, -447, -528, -615, -722, -832, -959, -1096, -1241, -1401, 
-    -1559, -1733, -1905, -2079, -2254, -2420, -2590, -2742, -2891, -3025, -3152, -3260, -3358, -3442, -3511, -3571, 
-    -3611, -3649, -3669, -3687, -3698, -3703, -3710, -3713, -3723, -3734, -3754, -3778, -3810, -3855, -3901, -3966, 
-    -4030, -4114, -4196, -4296, -4393, -4500, -4611, -4719, -4832, -4940, -5042, -5144, -5230, -5317, -5387, -5446, 
-    -5497, -5528, -5555, -5560, -5561, -5547, -5525, -5496, -5456, -5421, -5368, -5328, -5271, -5232, -5174, -5137, 
-    -5089, -5054, -5017, -4986, -4962, -4942, -4923, -4913, -4900, -4897, -4890, -4888, -4888, -4884, -4886, -4877, 
-    -4873, -4858, -4846, -4822, -4796, -4761, -4721, -4671, -4617, -4545, -4472, -4381, -4285, -4174, -4052, -3919, 
-    -3773, -3615, -3446, -3263, -3072, -2868, -2656, -2433, -2201, -1958, -1711, -1455, -1197, -933, -666, -400, 
-    -130, 133, 397, 656, 908, 1155, 1392, 1624, 1844, 2059, 2256, 2457, 2634, 2817, 2981, 3148, 
-    3303, 3457, 3606, 3754, 3901, 4048, 4198, 4346, 4499, 4653, 4807, 4968, 5123, 5289, 5447, 5611, 
-    5769, 5929, 6085, 6239, 6389, 6534, 6676, 6809, 6943, 7063, 7187, 7295, 7406, 7503, 7602, 7690, 
-    7781, 7863, 7945, 8022, 8097, 8172, 8241, 8311, 8376, 8440, 8500, 8554, 8603, 8646, 8681, 8702, 
-    8719, 8714, 8705, 8673, 8634, 8570, 8495, 8396, 8281, 8146, 7988, 7817, 7619, 7411, 7177, 6936, 
-    6667, 6394, 6100, 5797, 5482, 5156, 4826, 4487, 4143, 3797, 3446, 3100, 2749, 2410, 2068, 1737, 
-    1406, 1089, 774, 470, 171, -111, -393, -658, -919, -1165, -1404, -1632, -1851, -2058, -2255, -2443, 
-    -2622, -2792, -2950, -3103, -3245, -3386, -3514, -3643, -3762, -3880, -3994, -4099, -4210, -4306, -4409, -4501, 
-    -4595, -4683, -4768, -4846, -4922, -4996, -5058, -5127, -5180, -5242, -5288, -5340, -5381, -5426, -5462, -5505, 
-    -5539, -5580, -5612, -5656, -5688, -5733, -5770, -5816, -5862, -5906, -5959, -6005, -6061, -6110, -6163, -6214, 
-    -6263, -6311, -6353, -6396, -6430, -6465, -6488, -6511, -6523, -6533, -6528, -6527, -6506, -6491, -6459, -6427, 
-    -6387, -6338, -6291, -6230, -6173, -6102, -6039, -5958, -5887, -5802, -5723, -5633, -5548, -5451, -5363, -5256, 
-    -5162, -5048, -4942, -4821, -4700, -4570, -4437, -4296, -4150, -3994, -3830, -3658, -3474, -3283, -3081, -2871, 
-    -2651, -2420, -2186, -1939, -1692, -1436, -1179, -918, -655, -395, -135, 119, 370, 614, 849, 1076, 
-    1287, 1493, 1676, 1858, 2011, 2164, 2288, 2411, 2507, 2601, 2672, 2738, 2787, 2830, 2866, 2891, 
-    2917, 2933, 2951, 2970, 2986, 3010, 3031, 3063, 3095, 3135, 3180, 3232, 3290, 3357, 3426, 3506, 
-    3583, 3672, 3759, 3849, 3942, 4031, 4121, 4212, 4293, 4381, 4455, 4537, 4608, 4680, 4745, 4809, 
-    4868, 4924, 4978, 5030, 5080, 5132, 5180, 5233, 5287, 5342, 5405, 5466, 5537, 5607, 5687, 5768, 
-    5857, 5946, 6041, 6137, 6233, 6331, 6422, 6517, 6601, 6683, 6756, 6817, 6872, 6911, 6940, 6952, 
-    6954, 6935, 6902, 6852, 6786, 6704, 6606, 6491, 6364, 6220, 6067, 5897, 5719, 5528, 5330, 5121, 
-    4909, 4684, 4458, 4226, 3991, 3755, 3515, 3276, 3037, 2798, 2563, 2328, 2102, 1875, 1662, 1447, 
-    1248, 1051, 867, 690, 524, 368, 224, 88, -32, -147, -247, -341, -421, -499, -563, -627, 
-    -682, -736, -790, -841, -897, -952, -1016, -1082, -1155, -1235, -1322, -1419, -1523, -1641, -1765, -1902, 
-    -2044, -2202, -2360, -2534, -2708, -2896, -3083, -3279, -3475, -3680, -3879, -4089, -4289, -4500, -4701, -4908, 
-    -5107, -5309, -5506, -5706, -5897, -6091, -6277, -6464, -6643, -6822, -6990, -7158, -7312, -7466, -7605, -7740, 
-    -7863, -7973, -8078, -8164, -8244, -8305, -8357, -8398, -8423, -8440, -8441, -8435, -8418, -8387, -8352, -8301, 
-    -8246, -8181, -8109, -8030, -7945, -7853, -7757, -7652, -7549, -7435, -7321, -7202, -7078, -6957, -6824, -6700, 
-    -6565, -6438, -6305, -6172, -6045, -5911, -5786, -5657, -5532, -5409, -5288, -5169, -5055, -4941, -4833, -4723, 
-    -4617, -4514, -4409, -4307, -4201, -4097, -3990, -3878, -3765, -3643, -3518, -3386, -3246, -3098, -2942, -2777, 
-    -2604, -2420, -2229, -2024, -1813, -1586, -1358, -1110, -861, -593, -325, -37, 248, 556, 860, 1183, 
-    1505, 1841, 2176, 2525, 2871, 3229, 3581, 3946, 4302, 4670, 5024, 5389, 5739, 6097, 6441, 6789, 
-    7121, 7457, 7780, 8097, 8406, 8707, 9000, 9287, 9562, 9834, 10091, 10348, 10592, 10829, 11057, 11278, 
-    11491, 11694, 11889, 12073, 12254, 12419, 12580, 12729, 12867, 12999, 13115, 13224, 13318, 13403, 13471, 13530, 
-    13569, 13600, 13607, 13603, 13580, 13539, 13480, 13403, 13306, 13191, 13053, 12897, 12720, 12524, 12308, 12075, 
-    11818, 11552, 11262, 10963, 10642, 10318, 9976, 9630, 9272, 8908, 8545, 8166, 7799, 7415, 7045, 6664, 
-    6291, 5915, 5540, 5170, 4796, 4428, 4058, 3689, 3321, 2953, 2587, 2214, 1848, 1473, 1103, 725, 
-    348, -32, -417, -803, -1198, -1593, -1996, -2406, -2815, -3239, -3662, -4098, -4537, -4983, -5437, -5896, 
-    -6361, -6829, -7305, -7778, -8257, -8734, -9208, -9683, -10149, -10611, -11062, -11504, -11932, -12350, -12749, -13134, 
-    -13500, -13849, -14178, -14489, -14781, -15051, -15305, -15535, -15754, -15948, -16130, -16297, -16446, -16588, -16709, -16828, 
-    -16926, -17019, -17097, -17163, -17217, -17256, -17282, -17291, -17283, -17257, -17208, -17141, -17049, -16932, -16790, -16618, 
-    -16420, -16193, -15931, -15645, -15324, -14977, -14599, -14196, -13765, -13314, -12835, -12340, -11828, -11301, -10764, -10214, 
-    -9665, -9110, -8555, -8006, -7454, -6919, -6381, -5862, -5346, -4843, -4350, -3869, -3397, -2933, -2478, -2028, 
-    -1584, -1140, -697, -253, 194, 645, 1105, 1570, 2046, 2532, 3026, 3536, 4050, 4581, 5115, 5661, 
-    6212, 6768, 7325, 7881, 8436, 8979, 9524, 10047, 10568, 11065, 11550, 12016, 12460, 12885, 13288, 13668, 
-    14028, 14365, 14678, 14976, 15248, 15508, 15743, 15967, 16173, 16365, 16541, 16708, 16858, 17003, 17132, 17251, 
-    17364, 17462, 17553, 17631, 17701, 17755, 17800, 17827, 17842, 17838, 17815, 17775, 17712, 17628, 17522, 17390, 
-    17237, 17056, 16852, 16623, 16366, 16089, 15780, 15457, 15100, 14732, 14334, 13926, 13493, 13050, 12584, 12113, 
-    11624, 11129, 10621, 10109, 9587, 9068, 8536, 8010, 7475, 6947, 6414, 5886, 5353, 4828, 4296, 3773, 
-    3244, 2719, 2194, 1663, 1139, 606, 75, -463, -1001, -1545, -2094, -2644, -3207, -3761, -4333, -4897, 
-    -5473, -6043, -6619, -7190, -7764, -8328, -8893, -9447, -9994, -10530, -11054, -11564, -12062, -12534, -12997, -13429, 
-    -13847, -14239, -14606, -14951, -15271, -15562, -15836, -16074, -16301, -16491, -16671, -16818, -16953, -17062, -17158, -17230, 
-    -17290, -17330, -17357, -17368, -17364, -17347, -17317, -17274, -17219, -17150, -17073, -16979, -16880, -16762, -16639, -16497, 
-    -16348, -16182, -16005, -15808, -15599, -15376, -15131, -14876, -14596, -14306, -13993, -13666, -13315, -12953, -12565, -12163, 
-    -11737, -11295, -10830, -10350, -9848, -9329, -8794, -8240, -7674, -7092, -6500, -5895, -5284, -4662, -4040, -3412, 
-    -2783, -2157, -1530, -909, -291, 319, 923, 1517, 2104, 2678, 3241, 3795, 4331, 4862, 5369, 5872, 
-    6352, 6829, 7284, 7733, 8163, 8587, 8997, 9396, 9787, 10165, 10538, 10895, 11250, 11586, 11923, 12238, 
-    12555, 12851, 13144, 13420, 13685, 13937, 14176, 14400, 14607, 14801, 14972, 15132, 15269, 15391, 15494, 15576, 
-    15644, 15690, 15721, 15733, 15728, 15709, 15672, 15620, 15552, 15473, 15376, 15271, 15148, 15017, 14870, 14716, 
-    14545, 14367, 14171, 13965, 13745, 13509, 13260, 12991, 12709, 12408, 12088, 11750, 11394, 11014, 10620, 10202, 
-    9768, 9313, 8836, 8350, 7837, 7320, 6776, 6229, 5662, 5091, 4507, 3918, 3319, 2720, 2110, 1505, 
-    890, 285, -326, -929, -1537, -2131, -2729, -3313, -3897, -4470, -5035, -5595, -6141, -6681, -7206, -7725, 
-    -8227, -8720, -9196, -9660, -10107, -10537, -10948, -11341, -11713, -12064, -12393, -12698, -12981, -13238, -13471, -13679, 
-    -13864, -14024, -14158, -14273, -14361, -14432, -14481, -14511, -14524, -14519, -14500, -14463, -14417, -14354, -14285, -14201, 
-    -14112, -14013, -13904, -13788, -13664, -13530, -13389, -13233, -13074, -12893, -12710, -12502, -12289, -12049, -11801, -11525, 
-    -11238, -10923, -10594, -10238, -9868, -9477, -9067, -8642, -8197, -7744, -7274, -6794, -6307, -5806, -5310, -4798, 
-    -4297, -3782, -3281, -2772, -2276, -1776, -1290, -804, -328, 140, 601, 1057, 1502, 1946, 2377, 2809, 
-    3234, 3653, 4073, 4484, 4898, 5306, 5712, 6115, 6514, 6913, 7303, 7691, 8070, 8446, 8813, 9169, 
-    9519, 9854, 10181, 10490, 10793, 11072, 11343, 11592, 11826, 12042, 12238, 12416, 12575, 12712, 12832, 12930, 
-    13008, 13070, 13106, 13131, 13131, 13118, 13084, 13036, 12970, 12889, 12793, 12681, 12555, 12416, 12263, 12100, 
-    11922, 11733, 11534, 11321, 11100, 10863, 10620, 10360, 10095, 9812, 9525, 9221, 8912, 8584, 8252, 7902, 
-    7549, 7176, 6800, 6408, 6010, 5600, 5180, 4752, 4315, 3870, 3416, 2957, 2492, 2023, 1548, 1075, 
-    598, 122, -353, -828, -1299, -1767, -2230, -2690, -3141, -3589, -4026, -4458, -4879, -5292, -5695, -6089, 
-    -6472, -6843, -7205, -7552, -7891, -8215, -8531, -8830, -9125, -9401, -9674, -9928, -10181, -10416, -10652, -10866, 
-    -11083, -11279, -11475, -11655, -11832, -11994, -12154, -12296, -12436, -12560, -12677, -12781, -12874, -12958, -13023, -13082, 
-    -13117, -13151, -13152, -13155, -13123, -13089, -13023, -12948, -12847, -12729, -12589, -12429, -12245, -12047, -11819, -11577, 
-    -11308, -11017, -10712, -10378, -10029, -9660, -9269, -8866, -8438, -8003, -7549, -7085, -6611, -6126, -5638, -5139, 
-    -4646, -4141, -3647, -3148, -2658, -2174, -1692, -1226, -759, -309, 134, 569, 992, 1410, 1816, 2212, 
-    2606, 2987, 3368, 3740, 4111, 4478, 4844, 5205, 5568, 5925, 6286, 6642, 6992, 7347, 7685, 8030, 
-    8356, 8684, 8996, 9300, 9590, 9867, 10130, 10374, 10606, 10818, 11016, 11191, 11354, 11493, 11622, 11728, 
-    11822, 11897, 11957, 12006, 12037, 12063, 12070, 12075, 12066, 12051, 12028, 11999, 11962, 11923, 11873, 11826, 
-    11767, 11711, 11645, 11580, 11505, 11432, 11345, 11263, 11162, 11066, 10954, 10837, 10709, 10570, 10422, 10256, 
-    10083, 9890, 9688, 9463, 9226, 8968, 8694, 8399, 8088, 7756, 7408, 7040, 6656, 6253, 5836, 5402, 
-    4956, 4496, 4025, 3545, 3056, 2562, 2059, 1559, 1052, 547, 46, -455, -948, -1438, -1920, -2396, 
-    -2862, -3318, -3764, -4202, -4625, -5041, -5443, -5834, -6214, -6581, -6937, -7279, -7612, -7931, -8243, -8537, 
-    -8826, -9101, -9367, -9624, -9867, -10106, -10331, -10549, -10756, -10954, -11141, -11322, -11487, -11646, -11791, -11925, 
-    -12050, -12155, -12258, -12337, -12414, -12467, -12518, -12541, -12567, -12561, -12556, -12523, -12484, -12424, -12350, -12262, 
-    -12155, -12039, -11904, -11756, -11599, -11420, -11243, -11037, -10839, -10611, -10390, -10145, -9898, -9637, -9369, -9091, 
-    -8804, -8506, -8205, -7891, -7578, -7252, -6929, -6594, -6265, -5925, -5589, -5248, -4907, -4565, -4225, -3881, 
-    -3544, -3199, -2863, -2520, -2184, -1842, -1508, -1164, -831, -488, -152, 187, 527, 865, 1205, 1542, 
-    1882, 2216, 2552, 2883, 3212, 3535, 3855, 4167, 4476, 4775, 5068, 5353, 5631, 5898, 6155, 6407, 
-    6643, 6877, 7095, 7307, 7512, 7704, 7895, 8072, 8248, 8415, 8576, 8734, 8884, 9031, 9170, 9303, 
-    9434, 9553, 9673, 9776, 9879, 9972, 10051, 10131, 10186, 10245, 10280, 10310, 10322, 10322, 10309, 10278, 
-    10238, 10174, 10105, 10010, 9908, 9784, 9649, 9497, 9334, 9155, 8967, 8766, 8559, 8341, 8119, 7887, 
-    7657, 7414, 7180, 6933, 6696, 6450, 6212, 5970, 5732, 5494, 5257, 5021, 4785, 4554, 4316, 4082, 
-    3845, 3609, 3368, 3124, 2880, 2630, 2377, 2119, 1859, 1591, 1321, 1048, 770, 492, 208, -73, 
-    -354, -636, -913, -1188, -1456, -1719, -1974, -2222, -2459, -2690, -2909, -3117, -3317, -3504, -3683, -3850, 
-    -4009, -4155, -4297, -4420, -4547, -4656, -4763, -4861, -4951, -5041, -5117, -5195, -5263, -5330, -5392, -5446, 
-    -5499, -5546, -5588, -5625, -5656, -5685, -5703, -5720, -5726, -5730, -5729, -5719, -5705, -5687, -5664, -5640, 
-    -5608, -5578, -5542, -5508, -5470, -5436, -5395, -5361, -5318, -5284, -5238, -5207, -5157, -5122, -5075, -5031, 
-    -4988, -4936, -4890, -4833, -4779, -4722, -4660, -4597, -4530, -4459, -4390, -4312, -4239, -4157, -4079, -3997, 
-    -3913, -3832, -3745, -3663, -3578, -3494, -3412, -3328, -3247, -3164, -3086, -3003, -2927, -2847, -2771, -2693, 
-    -2614, -2537, -2457, -2377, -2295, -2211, -2124, -2036, -1942, -1849, -1750, -1650, -1545, -1438, -1328, -1214, 
-    -1097, -978, -855, -731, -600, -474, -339, -209, -72, 59, 193, 324, 456, 581, 708, 826, 
-    945, 1054, 1162, 1263, 1359, 1452, 1534, 1618, 1690, 1762, 1825, 1886, 1942, 1994, 2044, 2089, 
-    2136, 2176, 2221, 2259, 2301, 2340, 2382, 2421, 2464, 2503, 2548, 2587, 2634, 2674, 2722, 2762, 
-    2809, 2847, 2896, 2929, 2978, 3009, 3054, 3087, 3126, 3162, 3197, 3229, 3267, 3297, 3335, 3364, 
-    3400, 3435, 3467, 3506, 3540, 3583, 3620, 3670, 3711, 3768, 3816, 3882, 3938, 4009, 4078, 4154, 
-    4232, 4314, 4400, 4484, 4571, 4658, 4743, 4824, 4905, 4980, 5050, 5116, 5171, 5224, 5264, 5299, 
-    5322, 5334, 5341, 5328, 5315, 5280, 5242, 5192, 5126, 5060, 4971, 4888, 4782, 4680, 4560, 4440, 
-    4308, 4172, 4032, 3882, 3735, 3575, 3420, 3255, 3092, 2920, 2752, 2576, 2404, 2225, 2049, 1869, 
-    1689, 1508, 1329, 1147, 969, 787, 614, 433, 263, 87, -79, -249, -414, -579, -737, -896, 
-    -1048, -1203, -1347, -1492, -1631, -1767, -1899, -2026, -2151, -2267, -2387, -2493, -2605, -2703, -2807, -2898, 
-    -2993, -3074, -3163, -3238, -3319, -3389, -3463, -3530, -3599, -3665, -3731, -3798, -3864, -3934, -4002, -4076, 
-    -4151, -4229, -4315, -4396, -4491, -4582, -4682, -4784, -4890, -4998, -5112, -5222, -5344, -5457, -5581, -5694, 
-    -5817, -5929, -6048, -6155, -6264, -6366, -6464, -6554, -6640, -6714, -6788, -6848, -6903, -6946, -6982, -7006, 
-    -7023, -7024, -7019, -6998, -6969, -6925, -6872, -6803, -6725, -6631, -6525, -6405, -6273, -6128, -5968, -5801, 
-    -5616, -5427, -5218, -5010, -4784, -4555, -4314, -4071, -3821, -3569, -3312, -3055, -2797, -2537, -2284, -2027, 
-    -1779, -1530, -1293, -1056, -826, -599, -381, -168, 40, 244, 442, 637, 829, 1016, 1202, 1386, 
-    1568, 1751, 1928, 2113, 2289, 2472, 2650, 2830, 3008, 3184, 3362, 3535, 3707, 3875, 4040, 4200, 
-    4357, 4504, 4652, 4783, 4921, 5039, 5158, 5269, 5369, 5469, 5557, 5643, 5723, 5797, 5871, 5940, 
-    6007, 6075, 6137, 6204, 6266, 6335, 6396, 6467, 6529, 6600, 6665, 6732, 6800, 6865, 6930, 6991, 
-    7054, 7110, 7165, 7213, 7261, 7299, 7333, 7361, 7379, 7392, 7393, 7386, 7368, 7338, 7300, 7248, 
-    7184, 7110, 7021, 6925, 6808, 6688, 6546, 6399, 6236, 6058, 5875, 5672, 5467, 5243, 5017, 4774, 
-    4531, 4272, 4014, 3744, 3475, 3195, 2920, 2634, 2352, 2066, 1779, 1495, 1206, 923, 641, 360, 
-    82, -190, -461, -725, -987, -1240, -1490, -1729, -1967, -2190, -2412, -2618, -2824, -3014, -3200, -3370, 
-    -3538, -3687, -3836, -3964, -4091, -4203, -4304, -4400, -4480, -4560, -4623, -4681, -4733, -4777, -4816, -4848, 
-    -4875, -4901, -4919, -4938, -4953, -4966, -4978, -4987, -4997, -5007, -5011, -5021, -5023, -5031, -5033, -5036, 
-    -5038, -5036, -5036, -5029, -5027, -5011, -5004, -4983, -4966, -4939, -4908, -4872, -4833, -4785, -4732, -4673, 
-    -4607, -4537, -4461, -4377, -4295, -4199, -4108, -4010, -3911, -3812, -3708, -3610, -3508, -3415, -3312, -3224, 
-    -3129, -3046, -2959, -2882, -2800, -2732, -2655, -2592, -2519, -2459, -2389, -2329, -2258, -2197, -2122, -2053, 
-    -1974, -1894, -1808, -1715, -1617, -1512, -1402, -1283, -1160, -1030, -897, -755, -616, -467, -325, -173, 
-    -32, 116, 254, 395, 528, 657, 780, 897, 1004, 1109, 1200, 1287, 1364, 1433, 1497, 1549, 
-    1596, 1636, 1668, 1698, 1714, 1735, 1742, 1751, 1753, 1751, 1750, 1740, 1734, 1720, 1708, 1692, 
-    1676, 1657, 1639, 1618, 1599, 1579, 1559, 1542, 1524, 1510, 1496, 1486, 1479, 1473, 1475, 1476, 
-    1481, 1493, 1506, 1523, 1548, 1566, 1602, 1627, 1666, 1700, 1738, 1781, 1820, 1865, 1907, 1950, 
-    1993, 2032, 2076, 2109, 2148, 2181, 2211, 2244, 2265, 2296, 2315, 2342, 2359, 2384, 2402, 2428, 
-    2448, 2475, 2499, 2531, 2559, 2596, 2633, 2673, 2717, 2764, 2812, 2866, 2917, 2973, 3028, 3082, 
-    3137, 3185, 3237, 3281, 3323, 3358, 3389, 3413, 3432, 3444, 3446, 3449, 3434, 3424, 3399, 3375, 
-    3343, 3306, 3265, 3220, 3172, 3120, 3068, 3010, 2957, 2897, 2844, 2784, 2733, 2674, 2624, 2570, 
-    2518, 2470, 2417, 2377, 2324, 2285, 2234, 2196, 2150, 2109, 2068, 2024, 1983, 1939, 1893, 1850, 
-    1799, 1752, 1696, 1644, 1586, 1523, 1463, 1388, 1322, 1237, 1160, 1068, 980, 880, 776, 668, 
-    551, 435, 304, 174, 35, -105, -258, -408, -572, -730, -903, -1074, -1248, -1429, -1607, -1794, 
-    -1974, -2160, -2344, -2527, -2712, -2891, -3074, -3249, -3428, -3598, -3773, -3938, -4104, -4265, -4422, -4577, 
-    -4724, -4869, -5009, -5143, -5274, -5398, -5522, -5635, -5750, -5855, -5962, -6058, -6158, -6245, -6341, -6416, 
-    -6508, -6577, -6658, -6723, -6791, -6853, -6909, -6962, -7010, -7050, -7086, -7112, -7134, -7145, -7149, -7140, 
-    -7127, -7098, -7062, -7011, -6951, -6877, -6791, -6695, -6582, -6463, -6324, -6183, -6023, -5859, -5679, -5495, 
-    -5301, -5099, -4896, -4680, -4468, -4246, -4028, -3804, -3581, -3358, -3136, -2914, -2697, -2475, -2264, -2048, 
-    -1840, -1631, -1428, -1225, -1029, -831, -640, -449, -264, -77, 104, 285, 467, 643, 826, 999, 
-    1183, 1358, 1542, 1723, 1908, 2100, 2288, 2490, 2687, 2900, 3111, 3331, 3560, 3791, 4034, 4281, 
-    4533, 4795, 5055, 5329, 5597, 5874, 6150, 6423, 6701, 6969, 7241, 7503, 7759, 8011, 8250, 8487, 
-    8707, 8922, 9121, 9313, 9489, 9655, 9805, 9946, 10067, 10186, 10278, 10370, 10438, 10499, 10544, 10576, 
-    10598, 10604, 10598, 10581, 10548, 10507, 10447, 10381, 10297, 10203, 10096, 9975, 9844, 9699, 9543, 9378, 
-    9197, 9011, 8811, 8604, 8383, 8157, 7919, 7673, 7418, 7152, 6883, 6596, 6314, 6008, 5708, 5388, 
-    5074, 4741, 4407, 4066, 3716, 3367, 3005, 2647, 2279, 1912, 1542, 1173, 798, 431, 58, -302, 
-    -672, -1028, -1388, -1735, -2085, -2422, -2761, -3088, -3413, -3731, -4041, -4349, -4650, -4944, -5238, -5520, 
-    -5806, -6081, -6357, -6629, -6895, -7161, -7422, -7678, -7934, -8179, -8431, -8663, -8904, -9125, -9354, -9564, 
-    -9773, -9969, -10161, -10340, -10511, -10669, -10819, -10955, -11081, -11193, -11295, -11386, -11460, -11527, -11576, -11617, 
-    -11642, -11655, -11659, -11643, -11622, -11583, -11536, -11476, -11401, -11318, -11220, -11114, -10992, -10861, -10718, -10562, 
-    -10397, -10216, -10028, -9825, -9616, -9392, -9160, -8916, -8665, -8402, -8133, -7855, -7568, -7275, -6972, -6665, 
-    -6349, -6026, -5700, -5361, -5025, -4673, -4325, -3964, -3602, -3232, -2856, -2477, -2092, -1700, -1307, -906, 
-    -504, -97, 313, 726, 1141, 1560, 1974, 2398, 2810, 3232, 3646, 4057, 4468, 4871, 5272, 5665, 
-    6053, 6429, 6801, 7161, 7513, 7852, 8181, 8500, 8805, 9100, 9379, 9649, 9903, 10145, 10373, 10587, 
-    10788, 10978, 11147, 11308, 11451, 11581, 11697, 11796, 11885, 11955, 12016, 12059, 12089, 12108, 12110, 12105, 
-    12079, 12051, 12001, 11950, 11876, 11802, 11705, 11609, 11491, 11372, 11235, 11090, 10936, 10765, 10591, 10398, 
-    10200, 9989, 9765, 9534, 9286, 9036, 8766, 8493, 8205, 7912, 7607, 7295, 6975, 6650, 6317, 5980, 
-    5637, 5294, 4944, 4596, 4241, 3892, 3537, 3188, 2836, 2485, 2137, 1787, 1441, 1094, 748, 403, 
-    59, -287, -626, -977, -1316, -1665, -2005, -2353, -2694, -3038, -3378, -3717, -4055, -4386, -4716, -5039, 
-    -5358, -5670, -5973, -6271, -6555, -6838, -7101, -7360, -7604, -7837, -8062, -8267, -8469, -8650, -8827, -8985, 
-    -9137, -9273, -9403, -9517, -9625, -9720, -9807, -9886, -9952, -10014, -10062, -10105, -10137, -10163, -10177, -10184, 
-    -10180, -10168, -10145, -10111, -10067, -10011, -9943, -9866, -9769, -9669, -9548, -9419, -9276, -9118, -8952, -8768, 
-    -8576, -8371, -8154, -7929, -7691, -7445, -7191, -6927, -6658, -6382, -6099, -5812, -5519, -5226, -4927, -4625, 
-    -4323, -4019, -3711, -3407, -3096, -2794, -2482, -2180, -1873, -1570, -1267, -969, -668, -376, -81, 203, 
-    491, 770, 1050, 1319, 1592, 1851, 2115, 2364, 2617, 2859, 3101, 3335, 3567, 3792, 4015, 4230, 
-    4444, 4651, 4854, 5053, 5243, 5435, 5614, 5797, 5966, 6135, 6295, 6452, 6597, 6742, 6873, 7001, 
-    7117, 7228, 7325, 7418, 7492, 7566, 7622, 7672, 7707, 7735, 7748, 7755, 7747, 7731, 7704, 7666, 
-    7620, 7564, 7497, 7424, 7338, 7250, 7149, 7043, 6930, 6811, 6685, 6554, 6415, 6274, 6124, 5974, 
-    5813, 5653, 5484, 5315, 5136, 4960, 4770, 4587, 4389, 4198, 3994, 3794, 3584, 3375, 3160, 2943, 
-    2722, 2500, 2268, 2040, 1804, 1568, 1327, 1085, 840, 595, 344, 100, -151, -396, -644, -889, 
-    -1129, -1369, -1601, -1832, -2053, -2270, -2479, -2678, -2872, -3051, -3226, -3383, -3540, -3674, -3809, -3924, 
-    -4035, -4129, -4219, -4292, -4361, -4415, -4463, -4502, -4535, -4556, -4576, -4582, -4593, -4589, -4586, -4577, 
-    -4565, -4550, -4531, -4511, -4487, -4462, -4434, -4404, -4376, -4339, -4311, -4268, -4236, -4190, -4150, -4102, 
-    -4055, -4001, -3945, -3881, -3818, -3743, -3670, -3582, -3495, -3397, -3296, -3185, -3069, -2947, -2818, -2684, 
-    -2545, -2401, -2256, -2103, -1954, -1799, -1649, -1496, -1344, -1196, -1048, -906, -765, -631, -497, -372, 
-    -248, -133, -19, 90, 191, 296, 389, 485, 575, 664, 752, 838, 921, 1010, 1093, 1181, 
-    1265, 1356, 1440, 1533, 1620, 1711, 1803, 1891, 1985, 2073, 2162, 2248, 2335, 2414, 2495, 2567, 
-    2635, 2701, 2755, 2808, 2847, 2884, 2907, 2926, 2932, 2931, 2919, 2899, 2869, 2828, 2784, 2724, 
-    2666, 2589, 2518, 2430, 2348, 2251, 2162, 2059, 1962, 1859, 1758, 1655, 1554, 1451, 1349, 1251, 
-    1152, 1057, 959, 867, 772, 683, 592, 500, 416, 322, 241, 150, 67, -18, -103, -186, 
-    -269, -352, -430, -510, -584, -661, -731, -801, -866, -929, -989, -1044, -1096, -1147, -1188, -1234, 
-    -1267, -1306, -1332, -1361, -1384, -1406, -1422, -1436, -1447, -1455, -1462, -1463, -1463, -1459, -1454, -1446, 
-    -1436, -1422, -1410, -1391, -1375, -1350, -1330, -1301, -1277, -1244, -1215, -1177, -1142, -1102, -1059, -1013, 
-    -966, -915, -862, -805, -746, -685, -620, -557, -487, -421, -346, -281, -202, -136, -56, 11, 
-    87, 160, 232, 306, 375, 448, 515, 586, 653, 721, 787, 853, 919, 986, 1052, 1119, 
-    1183, 1250, 1314, 1379, 1442, 1506, 1565, 1624, 1680, 1731, 1782, 1822, 1863, 1897, 1923, 1948, 
-    1960, 1972, 1974, 1975, 1962, 1955, 1930, 1914, 1884, 1856, 1823, 1791, 1755, 1721, 1682, 1650, 
-    1616, 1580, 1550, 1516, 1490, 1458, 1434, 1402, 1378, 1347, 1319, 1286, 1252, 1214, 1171, 1127, 
-    1073, 1016, 953, 882, 809, 722, 640, 540, 445, 336, 231, 115, 3, -115, -233, -353, 
-    -474, -592, -711, -826, -941, -1051, -1160, -1263, -1365, -1459, -1554, -1641, -1727, -1805, -1885, -1955, 
-    -2028, -2092, -2158, -2215, -2278, -2330, -2389, -2435, -2491, -2536, -2585, -2626, -2671, -2707, -2747, -2773, 
-    -2809, -2829, -2852, -2870, -2879, -2889, -2889, -2887, -2877, -2866, -2843, -2820, -2788, -2748, -2710, -2653, 
-    -2604, -2539, -2473, -2397, -2320, -2236, -2148, -2054, -1955, -1857, -1748, -1642, -1529, -1414, -1297, -1176, 
-    -1056, -933, -808, -681, -556, -425, -299, -166, -38, 92, 221, 350, 481, 606, 737, 860, 
-    989, 1109, 1239, 1355, 1480, 1595, 1715, 1828, 1942, 2049, 2160, 2261, 2365, 2463, 2557, 2651, 
-    2736, 2823, 2901, 2980, 3051, 3120, 3185, 3244, 3301, 3351, 3399, 3440, 3479, 3510, 3540, 3560, 
-    3581, 3590, 3600, 3599, 3599, 3589, 3575, 3556, 3533, 3501, 3471, 3427, 3388, 3337, 3287, 3230, 
-    3170, 3108, 3039, 2971, 2898, 2822, 2745, 2661, 2582, 2491, 2407, 2313, 2223, 2126, 2032, 1932, 
-    1833, 1731, 1629, 1526, 1420, 1315, 1207, 1097, 990, 876, 766, 649, 532, 416, 290, 169, 
-    38, -86, -224, -355, -499, -635, -785, -927, -1080, -1229, -1385, -1540, -1697, -1857, -2014, -2173, 
-    -2332, -2487, -2645, -2794, -2947, -3090, -3235, -3370, -3504, -3629, -3751, -3864, -3974, -4071, -4170, -4251, 
-    -4339, -4404, -4477, -4532, -4589, -4632, -4674, -4705, -4736, -4751, -4771, -4773, -4781, -4768, -4763, -4739, 
-    -4716, -4684, -4644, -4602, -4546, -4489, -4424, -4349, -4271, -4184, -4089, -3992, -3879, -3766, -3642, -3511, 
-    -3373, -3228, -3073, -2915, -2748, -2575, -2397, -2211, -2025, -1831, -1635, -1435, -1233, -1030, -826, -621, 
-    -419, -214, -16, 181, 375, 563, 752, 929, 1109, 1277, 1444, 1603, 1759, 1913, 2057, 2203, 
-    2342, 2480, 2618, 2749, 2886, 3011, 3147, 3272, 3404, 3529, 3654, 3781, 3902, 4023, 4143, 4255, 
-    4375, 4479, 4589, 4689, 4787, 4881, 4965, 5050, 5120, 5193, 5247, 5307, 5345, 5388, 5413, 5435, 
-    5447, 5449, 5444, 5429, 5406, 5376, 5334, 5287, 5230, 5167, 5094, 5017, 4929, 4839, 4739, 4637, 
-    4529, 4416, 4299, 4180, 4054, 3932, 3798, 3673, 3537, 3403, 3268, 3129, 2990, 2849, 2703, 2561, 
-    2410, 2259, 2104, 1947, 1784, 1618, 1446, 1272, 1091, 905, 718, 519, 322, 114, -91, -304, 
-    -521, -741, -963, -1188, -1411, -1640, -1862, -2091, -2310, -2536, -2751, -2968, -3178, -3386, -3586, -3783, 
-    -3970, -4156, -4329, -4500, -4659, -4814, -4957, -5096, -5221, -5346, -5454, -5562, -5653, -5743, -5819, -5891, 
-    -5953, -6006, -6052, -6091, -6121, -6145, -6160, -6171, -6172, -6169, -6155, -6140, -6113, -6083, -6044, -6000, 
-    -5948, -5888, -5822, -5746, -5665, -5573, -5475, -5366, -5253, -5125, -4996, -4848, -4703, -4541, -4375, -4198, 
-    -4018, -3825, -3631, -3425, -3216, -3004, -2781, -2563, -2334, -2107, -1877, -1644, -1416, -1179, -954, -719, 
-    -495, -268, -43, 175, 395, 607, 821, 1028, 1233, 1434, 1631, 1829, 2015, 2207, 2389, 2575, 
-    2755, 2931, 3108, 3281, 3455, 3623, 3791, 3958, 4119, 4284, 4438, 4598, 4747, 4898, 5043, 5182, 
-    5320, 5447, 5573, 5690, 5798, 5902, 5994, 6081, 6155, 6225, 6281, 6329, 6367, 6394, 6414, 6422, 
-    6421, 6412, 6393, 6363, 6328, 6282, 6227, 6167, 6092, 6017, 5927, 5832, 5731, 5618, 5505, 5377, 
-    5249, 5110, 4966, 4816, 4659, 4497, 4331, 4157, 3980, 3798, 3608, 3423, 3221, 3028, 2820, 2615, 
-    2403, 2189, 1971, 1750, 1523, 1296, 1065, 830, 593, 350, 110, -137, -381, -635, -882, -1138, 
-    -1384, -1641, -1885, -2137, -2379, -2619, -2855, -3084, -3309, -3524, -3735, -3932, -4127, -4305, -4480, -4638, 
-    -4791, -4927, -5059, -5174, -5285, -5377, -5466, -5544, -5608, -5672, -5716, -5762, -5795, -5822, -5844, -5857, 
-    -5869, -5869, -5870, -5860, -5850, -5833, -5812, -5785, -5754, -5715, -5676, -5623, -5573, -5506, -5444, -5364, 
-    -5286, -5192, -5099, -4991, -4883, -4760, -4639, -4502, -4368, -4218, -4072, -3914, -3753, -3588, -3418, -3245, 
-    -3069, -2889, -2706, -2524, -2337, -2151, -1960, -1773, -1580, -1390, -1196, -1003, -807, -611, -411, -213, 
-    -8, 191, 400, 605, 815, 1026, 1236, 1450, 1660, 1877, 2086, 2302, 2509, 2721, 2927, 3129, 
-    3331, 3523, 3720, 3899, 4087, 4257, 4428, 4591, 4743, 4897, 5033, 5172, 5295, 5415, 5525, 5629, 
-    5721, 5808, 5884, 5953, 6013, 6062, 6105, 6135, 6159, 6167, 6171, 6157, 6143, 6104, 6067, 6006, 
-    5946, 5864, 5777, 5674, 5566, 5443, 5310, 5170, 5018, 4863, 4692, 4523, 4341, 4158, 3968, 3775, 
-    3578, 3375, 3175, 2968, 2764, 2554, 2347, 2137, 1929, 1718, 1512, 1300, 1095, 883, 679, 469, 
-    266, 56, -141, -350, -549, -751, -950, -1148, -1345, -1540, -1729, -1922, -2105, -2291, -2468, -2647, 
-    -2818, -2988, -3152, -3314, -3471, -3620, -3771, -3910, -4055, -4184, -4316, -4439, -4560, -4675, -4784, -4888, 
-    -4989, -5081, -5173, -5254, -5332, -5404, -5469, -5532, -5583, -5634, -5675, -5711, -5740, -5763, -5781, -5789, 
-    -5792, -5787, -5775, -5758, -5728, -5696, -5651, -5604, -5541, -5477, -5396, -5317, -5219, -5122, -5006, -4891, 
-    -4759, -4626, -4474, -4326, -4155, -3990, -3804, -3619, -3419, -3216, -3002, -2784, -2555, -2324, -2082, -1838, 
-    -1586, -1332, -1073, -808, -544, -274, -3, 266, 539, 811, 1081, 1353, 1619, 1887, 2146, 2406, 
-    2659, 2911, 3152, 3395, 3622, 3854, 4069, 4286, 4487, 4690, 4875, 5063, 5234, 5404, 5562, 5712, 
-    5857, 5988, 6117, 6232, 6343, 6441, 6532, 6615, 6686, 6755, 6805, 6857, 6889, 6922, 6940, 6953, 
-    6951, 6947, 6927, 6905, 6865, 6823, 6768, 6703, 6631, 6545, 6454, 6350, 6237, 6115, 5981, 5841, 
-    5689, 5528, 5361, 5181, 4998, 4803, 4605, 4398, 4187, 3969, 3747, 3522, 3292, 3060, 2824, 2589, 
-    2352, 2113, 1871, 1634, 1392, 1153, 912, 671, 432, 187, -52, -297, -540, -787, -1035, -1283, 
-    -1535, -1787, -2041, -2295, -2551, -2806, -3060, -3315, -3567, -3817, -4060, -4305, -4538, -4770, -4992, -5205, 
-    -5414, -5609, -5798, -5972, -6142, -6295, -6443, -6574, -6703, -6816, -6924, -7019, -7109, -7191, -7264, -7332, 
-    -7392, -7448, -7498, -7544, -7582, -7619, -7647, -7673, -7689, -7702, -7708, -7705, -7693, -7675, -7641, -7607, 
-    -7549, -7490, -7412, -7324, -7221, -7105, -6978, -6833, -6679, -6507, -6330, -6132, -5929, -5710, -5486, -5248, 
-    -5003, -4752, -4489, -4225, -3951, -3675, -3393, -3110, -2822, -2531, -2238, -1943, -1646, -1346, -1049, -742, 
-    -443, -133, 169, 480, 789, 1099, 1412, 1723, 2038, 2347, 2665, 2970, 3286, 3586, 3897, 4191, 
-    4493, 4777, 5066, 5339, 5612, 5870, 6124, 6365, 6598, 6819, 7033, 7231, 7421, 7598, 7764, 7921, 
-    8061, 8198, 8317, 8428, 8529, 8615, 8701, 8763, 8829, 8872, 8918, 8944, 8966, 8974, 8975, 8964, 
-    8943, 8909, 8869, 8812, 8749, 8669, 8583, 8482, 8370, 8245, 8111, 7961, 7804, 7631, 7450, 7257, 
-    7053, 6840, 6615, 6385, 6141, 5895, 5635, 5377, 5104, 4833, 4549, 4272, 3977, 3692, 3392, 3101, 
-    2800, 2500, 2197, 1896, 1589, 1286, 977, 671, 363, 54, -255, -563, -877, -1185, -1497, -1806, 
-    -2115, -2425, -2731, -3034, -3339, -3636, -3933, -4223, -4512, -4792, -5068, -5337, -5598, -5853, -6098, -6334, 
-    -6564, -6778, -6990, -7184, -7376, -7550, -7720, -7875, -8022, -8156, -8284, -8396, -8504, -8595, -8683, -8754, 
-    -8822, -8875, -8923, -8957, -8983, -9001, -9008, -9005, -8995, -8973, -8947, -8904, -8861, -8800, -8738, -8661, 
-    -8579, -8485, -8385, -8272, -8157, -8025, -7890, -7742, -7588, -7423, -7249, -7067, -6875, -6676, -6464, -6248, 
-    -6017, -5785, -5536, -5287, -5022, -4755, -4477, -4194, -3900, -3601, -3297, -2982, -2669, -2340, -2017, -1679, 
-    -1347, -1005, -664, -319, 26, 371, 720, 1065, 1413, 1756, 2101, 2440, 2779, 3113, 3446, 3771, 
-    4095, 4413, 4726, 5034, 5333, 5629, 5918, 6199, 6473, 6738, 6998, 7244, 7488, 7716, 7938, 8150, 
-    8349, 8538, 8714, 8879, 9031, 9169, 9293, 9405, 9500, 9583, 9647, 9701, 9733, 9755, 9758, 9746, 
-    9720, 9676, 9620, 9548, 9461, 9363, 9249, 9125, 8989, 8840, 8682, 8515, 8336, 8151, 7957, 7757, 
-    7547, 7336, 7111, 6890, 6654, 6421, 6176, 5931, 5677, 5422, 5158, 4894, 4619, 4344, 4062, 3774, 
-    3483, 3185, 2885, 2579, 2269, 1956, 1639, 1321, 1001, 679, 358, 35, -282, -601, -915, -1229, 
-    -1533, -1838, -2133, -2425, -2710, -2986, -3257, -3520, -3774, -4023, -4262, -4494, -4721, -4937, -5152, -5354, 
-    -5558, -5748, -5940, -6122, -6303, -6478, -6646, -6817, -6973, -7134, -7284, -7432, -7574, -7708, -7841, -7959, 
-    -8078, -8182, -8282, -8368, -8448, -8517, -8573, -8620, -8655, -8676, -8686, -8683, -8669, -8639, -8601, -8543, 
-    -8481, -8398, -8312, -8204, -8091, -7963, -7826, -7678, -7515, -7349, -7165, -6981, -6778, -6575, -6357, -6135, 
-    -5903, -5665, -5419, -5167, -4908, -4644, -4372, -4097, -3815, -3529, -3238, -2944, -2644, -2342, -2038, -1730, 
-    -1420, -1108, -793, -481, -165, 151, 463, 781, 1091, 1402, 1710, 2014, 2316, 2610, 2902, 3187, 
-    3466, 3740, 4003, 4265, 4510, 4757, 4987, 5215, 5427, 5637, 5831, 6022, 6196, 6368, 6523, 6672, 
-    6807, 6933, 7051, 7152, 7247, 7328, 7401, 7459, 7508, 7547, 7573, 7589, 7596, 7589, 7578, 7550, 
-    7519, 7476, 7424, 7366, 7299, 7226, 7145, 7058, 6965, 6868, 6763, 6655, 6540, 6424, 6299, 6174, 
-    6039, 5905, 5760, 5616, 5463, 5304, 5143, 4971, 4798, 4615, 4428, 4236, 4034, 3831, 3619, 3406, 
-    3185, 2960, 2733, 2502, 2268, 2032, 1793, 1554, 1315, 1073, 834, 591, 354, 113, -124, -363, 
-    -598, -837, -1068, -1310, -1539, -1779, -2007, -2247, -2475, -2714, -2940, -3177, -3403, -3635, -3862, -4085, 
-    -4310, -4526, -4741, -4950, -5151, -5350, -5535, -5717, -5888, -6048, -6199, -6336, -6466, -6577, -6683, -6767, 
-    -6847, -6906, -6956, -6991, -7015, -7022, -7022, -7002, -6982, -6938, -6892, -6832, -6763, -6683, -6598, -6500, 
-    -6400, -6287, -6171, -6047, -5916, -5782, -5637, -5491, -5337, -5176, -5014, -4841, -4667, -4485, -4301, -4109, 
-    -3917, -3714, -3515, -3304, -3097, -2882, -2668, -2446, -2230, -2004, -1784, -1557, -1333, -1108, -882, -658, 
-    -432, -210, 13, 233, 453, 670, 887, 1100, 1312, 1521, 1729, 1933, 2136, 2333, 2533, 2722, 
-    2916, 3097, 3282, 3455, 3629, 3794, 3954, 4106, 4253, 4390, 4526, 4645, 4765, 4870, 4970, 5061, 
-    5141, 5217, 5281, 5340, 5388, 5430, 5462, 5490, 5506, 5520, 5522, 5523, 5511, 5501, 5477, 5456, 
-    5418, 5387, 5340, 5295, 5238, 5181, 5117, 5044, 4970, 4887, 4799, 4704, 4605, 4498, 4385, 4266, 
-    4140, 4011, 3870, 3729, 3577, 3424, 3265, 3096, 2932, 2751, 2582, 2394, 2215, 2028, 1840, 1655, 
-    1462, 1277, 1085, 900, 712, 529, 345, 166, -11, -186, -356, -526, -690, -854, -1014, -1171, 
-    -1328, -1481, -1633, -1783, -1935, -2082, -2233, -2377, -2529, -2671, -2821, -2965, -3108, -3253, -3389, -3531, 
-    -3662, -3795, -3921, -4042, -4158, -4267, -4367, -4463, -4545, -4626, -4687, -4748, -4790, -4828, -4850, -4866, 
-    -4866, -4862, -4841, -4819, -4780, -4738, -4685, -4627, -4561, -4490, -4411, -4331, -4242, -4155, -4059, -3964, 
-    -3862, -3761, -3656, -3548, -3438, -3325, -3209, -3094, -2970, -2850, -2719, -2593, -2457, -2322, -2181, -2038, 
-    -1889, -1739, -1585, -1425, -1267, -1098, -937, -763, -596, -421, -250, -75, 95, 270, 439, 610, 
-    775, 942, 1102, 1261, 1412, 1563, 1705, 1846, 1976, 2107, 2227, 2346, 2454, 2560, 2658, 2753, 
-    2839, 2923, 2997, 3074, 3133, 3202, 3253, 3311, 3355, 3401, 3438, 3476, 3504, 3533, 3554, 3573, 
-    3587, 3598, 3602, 3603, 3600, 3591, 3578, 3560, 3538, 3510, 3477, 3440, 3397, 3351, 3296, 3240, 
-    3179, 3109, 3041, 2961, 2885, 2793, 2709, 2610, 2516, 2412, 2307, 2200, 2085, 1973, 1853, 1735, 
-    1612, 1490, 1361, 1237, 1104, 979, 847, 717, 587, 457, 328, 199, 72, -53, -176, -301, 
-    -420, -539, -655, -769, -882, -989, -1098, -1201, -1304, -1402, -1501, -1594, -1689, -1775, -1866, -1949, 
-    -2032, -2112, -2187, -2263, -2331, -2403, -2463, -2529, -2581, -2637, -2684, -2728, -2770, -2802, -2832, -2854, 
-    -2875, -2886, -2895, -2895, -2892, -2881, -2867, -2842, -2819, -2779, -2747, -2698, -2652, -2594, -2538, -2472, 
-    -2406, -2333, -2259, -2180, -2099, -2016, -1927, -1841, -1748, -1657, -1562, -1466, -1372, -1274, -1175, -1078, 
-    -977, -879, -779, -678, -580, -476, -379, -276, -176, -76, 26, 125, 230, 328, 433, 531, 
-    637, 734, 839, 935, 1040, 1132, 1235, 1326, 1424, 1515, 1606, 1695, 1779, 1865, 1943, 2025, 
-    2095, 2172, 2235, 2303, 2364, 2421, 2475, 2524, 2570, 2611, 2648, 2678, 2709, 2727, 2749, 2759, 
-    2767, 2771, 2767, 2760, 2749, 2728, 2710, 2678, 2649, 2610, 2570, 2523, 2472, 2420, 2359, 2299, 
-    2233, 2163, 2094, 2017, 1944, 1860, 1783, 1697, 1613, 1526, 1436, 1346, 1254, 1157, 1061, 962, 
-    859, 757, 648, 540, 427, 311, 195, 74, -49, -174, -304, -432, -566, -698, -834, -969, 
-    -1102, -1242, -1372, -1509, -1639, -1768, -1898, -2019, -2142, -2256, -2370, -2477, -2582, -2677, -2773, -2860, 
-    -2945, -3019, -3097, -3160, -3229, -3281, -3342, -3387, -3437, -3473, -3518, -3545, -3584, -3600, -3635, -3642, 
-    -3670, -3669, -3686, -3680, -3684, -3675, -3661, -3646, -3619, -3594, -3554, -3514, -3463, -3408, -3342, -3273, 
-    -3191, -3108, -3009, -2909, -2797, -2680, -2554, -2422, -2282, -2140, -1985, -1833, -1667, -1508, -1333, -1167, 
-    -988, -814, -635, -454, -278, -95, 83, 263, 438, 617, 791, 965, 1136, 1303, 1472, 1634, 
-    1797, 1955, 2112, 2264, 2416, 2562, 2705, 2849, 2984, 3122, 3249, 3379, 3501, 3621, 3738, 3848, 
-    3956, 4058, 4155, 4249, 4335, 4418, 4493, 4565, 4629, 4688, 4741, 4786, 4829, 4861, 4891, 4910, 
-    4927, 4934, 4938, 4930, 4920, 4900, 4877, 4843, 4806, 4759, 4711, 4650, 4587, 4518, 4439, 4361, 
-    4267, 4181, 4076, 3976, 3864, 3752, 3633, 3510, 3384, 3252, 3116, 2976, 2835, 2689, 2538, 2386, 
-    2228, 2074, 1907, 1747, 1576, 1409, 1233, 1062, 881, 705, 520, 338, 150, -32, -227, -414, 
-    -608, -800, -993, -1191, -1381, -1581, -1770, -1969, -2158, -2350, -2541, -2727, -2914, -3098, -3275, -3456, 
-    -3624, -3797, -3958, -4124, -4274, -4429, -4571, -4714, -4848, -4976, -5101, -5216, -5330, -5431, -5531, -5617, 
-    -5706, -5778, -5849, -5908, -5960, -6008, -6039, -6072, -6085, -6099, -6096, -6089, -6071, -6043, -6007, -5960, 
-    -5905, -5843, -5767, -5690, -5596, -5505, -5394, -5288, -5166, -5045, -4910, -4778, -4634, -4492, -4337, -4184, 
-    -4024, -3861, -3694, -3523, -3347, -3170, -2987, -2802, -2612, -2419, -2223, -2023, -1822, -1614, -1406, -1191, 
-    -980, -761, -543, -320, -97, 122, 349, 570, 797, 1016, 1240, 1457, 1677, 1889, 2102, 2307, 
-    2513, 2711, 2906, 3098, 3282, 3465, 3639, 3812, 3978, 4140, 4295, 4450, 4594, 4739, 4874, 5009, 
-    5137, 5260, 5377, 5492, 5596, 5700, 5791, 5883, 5963, 6038, 6106, 6164, 6217, 6257, 6295, 6316, 
-    6335, 6341, 6339, 6328, 6307, 6278, 6240, 6193, 6140, 6075, 6008, 5929, 5849, 5756, 5663, 5561, 
-    5455, 5348, 5227, 5114, 4986, 4864, 4729, 4598, 4459, 4319, 4175, 4024, 3876, 3715, 3559, 3392, 
-    3225, 3051, 2871, 2689, 2501, 2307, 2108, 1904, 1697, 1482, 1268, 1041, 822, 586, 361, 121, 
-    -109, -348, -585, -821, -1061, -1291, -1529, -1754, -1985, -2203, -2424, -2632, -2841, -3038, -3232, -3418, 
-    -3596, -3766, -3931, -4082, -4234, -4370, -4505, -4628, -4745, -4857, -4960, -5059, -5147, -5236, -5314, -5390, 
-    -5462, -5523, -5589, -5638, -5697, -5739, -5782, -5820, -5851, -5881, -5900, -5921, -5926, -5935, -5929, -5922, 
-    -5906, -5879, -5850, -5806, -5760, -5698, -5637, -5552, -5479, -5373, -5281, -5161, -5044, -4916, -4777, -4636, 
-    -4482, -4324, -4162, -3988, -3816, -3633, -3451, -3263, -3071, -2878, -2682, -2487, -2288, -2089, -1891, -1690, 
-    -1497, -1292, -1099, -900, -706, -511, -316, -123, 67, 259, 445, 638, 820, 1009, 1191, 1373, 
-    1556, 1734, 1913, 2088, 2261, 2433, 2600, 2765, 2928, 3083, 3242, 3387, 3536, 3672, 3810, 3937, 
-    4061, 4175, 4285, 4387, 4481, 4568, 4648, 4717, 4783, 4836, 4886, 4921, 4957, 4976, 4996, 5002, 
-    5006, 4998, 4989, 4968, 4948, 4915, 4882, 4842, 4796, 4750, 4693, 4638, 4575, 4511, 4441, 4369, 
-    4291, 4213, 4126, 4042, 3946, 3854, 3752, 3649, 3541, 3429, 3315, 3193, 3069, 2939, 2810, 2671, 
-    2533, 2386, 2241, 2090, 1936, 1778, 1621, 1458, 1296, 1130, 965, 798, 629, 461, 292, 123, 
-    -47, -212, -385, -549, -718, -883, -1050, -1212, -1378, -1533, -1701, -1852, -2013, -2163, -2315, -2464, 
-    -2608, -2752, -2887, -3024, -3152, -3278, -3395, -3510, -3617, -3718, -3812, -3897, -3979, -4046, -4114, -4163, 
-    -4214, -4247, -4279, -4297, -4309, -4310, -4303, -4288, -4266, -4231, -4197, -4145, -4097, -4032, -3969, -3895, 
-    -3818, -3735, -3647, -3556, -3461, -3359, -3258, -3148, -3042, -2926, -2812, -2692, -2570, -2447, -2320, -2189, 
-    -2058, -1921, -1785, -1643, -1502, -1355, -1209, -1059, -908, -754, -601, -445, -289, -133, 24, 177, 
-    336, 488, 640, 792, 939, 1088, 1227, 1371, 1505, 1638, 1769, 1892, 2016, 2131, 2245, 2353, 
-    2459, 2555, 2655, 2742, 2832, 2913, 2990, 3065, 3132, 3198, 3254, 3314, 3358, 3408, 3445, 3484, 
-    3511, 3540, 3557, 3575, 3582, 3586, 3584, 3577, 3563, 3545, 3517, 3487, 3449, 3406, 3357, 3300, 
-    3239, 3174, 3100, 3023, 2940, 2853, 2763, 2665, 2566, 2463, 2353, 2249, 2133, 2020, 1903, 1783, 
-    1669, 1545, 1426, 1305, 1180, 1062, 935, 818, 689, 570, 444, 321, 196, 69, -55, -185, 
-    -311, -443, -571, -704, -836, -969, -1102, -1237, -1370, -1505, -1638, -1772, -1905, -2036, -2164, -2292, 
-    -2419, -2539, -2660, -2775, -2888, -2998, -3100, -3201, -3294, -3388, -3469, -3552, -3624, -3695, -3758, -3814, 
-    -3867, -3914, -3953, -3990, -4015, -4042, -4057, -4069, -4074, -4074, -4070, -4057, -4040, -4015, -3986, -3950, 
-    -3909, -3861, -3806, -3748, -3680, -3612, -3528, -3448, -3356, -3259, -3159, -3049, -2938, -2819, -2692, -2566, 
-    -2429, -2294, -2147, -2001, -1850, -1693, -1535, -1372, -1207, -1040, -869, -697, -522, -346, -170, 11, 
-    186, 371, 548, 730, 913, 1093, 1274, 1455, 1631, 1814, 1985, 2164, 2333, 2507, 2673, 2839, 
-    3000, 3158, 3313, 3460, 3605, 3744, 3877, 4005, 4124, 4239, 4346, 4446, 4535, 4623, 4695, 4768, 
-    4823, 4880, 4920, 4959, 4984, 5008, 5020, 5028, 5028, 5023, 5011, 4994, 4972, 4945, 4912, 4877, 
-    4838, 4793, 4749, 4693, 4642, 4582, 4519, 4454, 4381, 4307, 4225, 4142, 4049, 3956, 3852, 3746, 
-    3631, 3512, 3384, 3254, 3111, 2968, 2816, 2657, 2497, 2325, 2153, 1975, 1792, 1609, 1417, 1229, 
-    1035, 845, 649, 456, 264, 71, -115, -308, -489, -677, -855, -1034, -1210, -1381, -1551, -1716, 
-    -1882, -2041, -2202, -2356, -2512, -2664, -2815, -2964, -3112, -3258, -3403, -3547, -3692, -3830, -3973, -4107, 
-    -4246, -4379, -4509, -4637, -4760, -4879, -4996, -5102, -5210, -5306, -5398, -5480, -5559, -5625, -5686, -5734, 
-    -5780, -5810, -5834, -5846, -5853, -5846, -5832, -5806, -5773, -5730, -5678, -5622, -5549, -5480, -5391, -5307, 
-    -5207, -5108, -4996, -4887, -4763, -4645, -4511, -4381, -4241, -4098, -3952, -3801, -3643, -3485, -3319, -3150, 
-    -2978, -2797, -2621, -2429, -2245, -2047, -1853, -1651, -1448, -1243, -1032, -824, -609, -399, -182, 30, 
-    245, 461, 672, 885, 1096, 1302, 1510, 1710, 1911, 2106, 2298, 2485, 2669, 2849, 3022, 3194, 
-    3357, 3520, 3674, 3827, 3972, 4114, 4250, 4382, 4509, 4629, 4747, 4856, 4964, 5062, 5158, 5246, 
-    5329, 5407, 5477, 5544, 5600, 5654, 5698, 5737, 5768, 5794, 5809, 5822, 5819, 5821, 5802, 5789, 
-    5755, 5727, 5681, 5637, 5579, 5520, 5449, 5379, 5294, 5213, 5117, 5027, 4919, 4816, 4703, 4587, 
-    4467, 4338, 4214, 4072, 3941, 3790, 3651, 3491, 3344, 3178, 3020, 2850, 2682, 2507, 2333, 2152, 
-    1973, 1786, 1603, 1416, 1225, 1039, 846, 658, 467, 276, 89, -99, -286, -472, -661, -839, 
-    -1025, -1203, -1382, -1561, -1730, -1908, -2076, -2245, -2411, -2574, -2737, -2893, -3051, -3202, -3353, -3498, 
-    -3638, -3779, -3909, -4041, -4160, -4284, -4390, -4500, -4596, -4692, -4777, -4854, -4927, -4988, -5046, -5090, 
-    -5131, -5162, -5186, -5202, -5208, -5209, -5201, -5186, -5164, -5134, -5100, -5055, -5011, -4953, -4897, -4829, 
-    -4762, -4685, -4606, -4523, -4435, -4343, -4245, -4148, -4039, -3938, -3818, -3709, -3585, -3464, -3336, -3204, 
-    -3071, -2931, -2791, -2644, -2497, -2342, -2191, -2030, -1873, -1707, -1545, -1378, -1211, -1043, -872, -706, 
-    -535, -368, -200, -34, 127, 291, 449, 607, 757, 911, 1054, 1198, 1336, 1470, 1601, 1724, 
-    1845, 1961, 2071, 2178, 2279, 2375, 2468, 2556, 2640, 2718, 2792, 2864, 2931, 2993, 3055, 3107, 
-    3165, 3211, 3261, 3303, 3345, 3383, 3420, 3452, 3482, 3509, 3534, 3557, 3575, 3589, 3605, 3608, 
-    3619, 3613, 3615, 3602, 3593, 3572, 3550, 3520, 3487, 3447, 3401, 3350, 3294, 3231, 3164, 3091, 
-    3014, 2932, 2844, 2754, 2659, 2560, 2459, 2354, 2249, 2138, 2027, 1917, 1801, 1688, 1569, 1455, 
-    1336, 1223, 1100, 988, 866, 753, 634, 518, 402, 285, 172, 58, -58, -166, -283, -387, 
-    -503, -603, -714, -815, -918, -1017, -1110, -1209, -1293, -1385, -1466, -1546, -1623, -1693, -1763, -1824, 
-    -1885, -1937, -1988, -2032, -2073, -2108, -2137, -2164, -2182, -2199, -2208, -2212, -2214, -2205, -2201, -2182, 
-    -2166, -2142, -2113, -2085, -2047, -2011, -1967, -1924, -1876, -1825, -1774, -1716, -1663, -1600, -1543, -1478, 
-    -1417, -1347, -1283, -1212, -1144, -1071, -997, -922, -848, -766, -693, -610, -529, -450, -362, -286, 
-    -197, -119, -31, 45, 133, 206, 292, 365, 443, 518, 586, 658, 723, 788, 849, 908, 
-    963, 1020, 1066, 1121, 1162, 1213, 1251, 1295, 1336, 1370, 1411, 1440, 1481, 1507, 1541, 1566, 
-    1596, 1619, 1641, 1661, 1675, 1691, 1699, 1708, 1706, 1708, 1699, 1690, 1676, 1653, 1633, 1601, 
-    1568, 1530, 1487, 1441, 1389, 1333, 1277, 1211, 1146, 1075, 1002, 927, 844, 765, 677, 589, 
-    500, 405, 312, 212, 116, 12, -87, -194, -296, -404, -509, -616, -721, -828, -931, -1035, 
-    -1136, -1237, -1331, -1427, -1517, -1607, -1690, -1770, -1850, -1919, -1993, -2054, -2120, -2173, -2231, -2278, 
-    -2328, -2368, -2409, -2446, -2479, -2510, -2538, -2562, -2585, -2603, -2622, -2632, -2650, -2650, -2663, -2659, 
-    -2662, -2655, -2649, -2638, -2623, -2605, -2584, -2557, -2528, -2494, -2458, -2417, -2369, -2323, -2267, -2215, 
-    -2151, -2089, -2023, -1951, -1881, -1803, -1724, -1644, -1558, -1473, -1382, -1293, -1198, -1103, -1003, -904, 
-    -802, -697, -592, -481, -374, -259, -148, -30, 86, 203, 329, 444, 577, 691, 828, 945, 
-    1082, 1203, 1337, 1464, 1594, 1721, 1853, 1976, 2106, 2229, 2354, 2475, 2594, 2711, 2826, 2939, 
-    3046, 3153, 3254, 3355, 3448, 3540, 3626, 3708, 3788, 3861, 3930, 3994, 4053, 4107, 4155, 4199, 
-    4235, 4270, 4294, 4318, 4331, 4342, 4344, 4343, 4333, 4321, 4297, 4272, 4237, 4198, 4153, 4099, 
-    4045, 3977, 3910, 3833, 3754, 3668, 3578, 3482, 3384, 3279, 3174, 3062, 2950, 2833, 2714, 2596, 
-    2469, 2349, 2220, 2093, 1966, 1835, 1706, 1571, 1441, 1306, 1172, 1034, 898, 757, 619, 475, 
-    333, 186, 41, -111, -258, -414, -566, -723, -880, -1036, -1197, -1352, -1513, -1670, -1827, -1983, 
-    -2136, -2287, -2438, -2582, -2727, -2865, -3002, -3134, -3261, -3386, -3503, -3619, -3731, -3835, -3938, -4033, 
-    -4128, -4215, -4299, -4378, -4454, -4523, -4591, -4649, -4711, -4757, -4808, -4846, -4884, -4914, -4937, -4956, 
-    -4968, -4973, -4972, -4962, -4946, -4924, -4893, -4854, -4811, -4756, -4699, -4631, -4558, -4478, -4392, -4299, 
-    -4201, -4097, -3988, -3874, -3757, -3633, -3509, -3377, -3246, -3109, -2970, -2828, -2684, -2537, -2390, -2238, 
-    -2086, -1931, -1775, -1616, -1456, -1296, -1131, -968, -798, -638, -463, -300, -124, 39, 213, 381, 
-    551, 720, 888, 1055, 1218, 1381, 1542, 1700, 1854, 2005, 2154, 2299, 2440, 2578, 2709, 2839, 
-    2962, 3083, 3196, 3308, 3411, 3511, 3607, 3695, 3784, 3858, 3939, 4003, 4072, 4129, 4187, 4236, 
-    4283, 4322, 4361, 4391, 4420, 4442, 4460, 4477, 4484, 4492, 4491, 4490, 4482, 4468, 4454, 4430, 
-    4406, 4374, 4340, 4299, 4253, 4203, 4147, 4087, 4021, 3948, 3873, 3788, 3704, 3608, 3511, 3407, 
-    3300, 3186, 3068, 2944, 2818, 2684, 2551, 2409, 2266, 2119, 1968, 1816, 1657, 1502, 1339, 1180, 
-    1014, 850, 685, 520, 355, 191, 26, -134, -298, -454, -615, -765, -923, -1069, -1219, -1360, 
-    -1503, -1641, -1775, -1905, -2034, -2157, -2277, -2397, -2506, -2621, -2719, -2827, -2919, -3018, -3100, -3188, 
-    -3265, -3340, -3408, -3470, -3528, -3581, -3624, -3664, -3695, -3720, -3742, -3749, -3759, -3753, -3750, -3729, 
-    -3712, -3681, -3648, -3607, -3559, -3510, -3452, -3391, -3325, -3254, -3180, -3102, -3021, -2935, -2850, -2756, 
-    -2667, -2571, -2473, -2377, -2272, -2175, -2065, -1965, -1854, -1747, -1638, -1524, -1415, -1298, -1185, -1069, 
-    -952, -834, -718, -596, -482, -359, -242, -123, -5, 111, 228, 345, 457, 572, 682, 794, 
-    901, 1009, 1111, 1216, 1315, 1415, 1511, 1605, 1698, 1786, 1874, 1958, 2045, 2121, 2205, 2273, 
-    2354, 2419, 2490, 2552, 2615, 2671, 2728, 2776, 2825, 2865, 2907, 2936, 2968, 2988, 3009, 3019, 
-    3028, 3028, 3025, 3014, 2996, 2978, 2947, 2917, 2874, 2834, 2781, 2729, 2668, 2604, 2533, 2462, 
-    2381, 2303, 2211, 2127, 2027, 1936, 1830, 1731, 1619, 1513, 1398, 1284, 1165, 1044, 922, 795, 
-    669, 539, 408, 276, 142, 6, -126, -263, -398, -535, -670, -804, -936, -1069, -1196, -1326, 
-    -1447, -1570, -1687, -1802, -1912, -2019, -2119, -2220, -2310, -2403, -2485, -2567, -2640, -2713, -2780, -2842, 
-    -2899, -2952, -3004, -3047, -3090, -3125, -3162, -3188, -3217, -3238, -3255, -3271, -3279, -3288, -3289, -3287, 
-    -3281, -3271, -3254, -3236, -3206, -3181, -3140, -3104, -3051, -3004, -2942, -2881, -2811, -2738, -2657, -2573, 
-    -2483, -2391, -2291, -2189, -2085, -1974, -1864, -1748, -1631, -1514, -1392, -1273, -1147, -1027, -901, -777, 
-    -652, -527, -403, -275, -153, -25, 99, 223, 355, 476, 609, 734, 866, 996, 1128, 1261, 
-    1395, 1529, 1666, 1802, 1940, 2077, 2215, 2351, 2491, 2624, 2759, 2893, 3021, 3153, 3275, 3398, 
-    3515, 3629, 3738, 3841, 3940, 4031, 4121, 4198, 4277, 4338, 4405, 4455, 4505, 4545, 4578, 4605, 
-    4626, 4637, 4647, 4643, 4639, 4623, 4604, 4577, 4545, 4504, 4460, 4405, 4350, 4285, 4215, 4140, 
-    4058, 3971, 3879, 3780, 3678, 3568, 3456, 3336, 3213, 3086, 2951, 2815, 2672, 2527, 2375, 2223, 
-    2060, 1903, 1731, 1566, 1389, 1214, 1034, 853, 667, 480, 290, 99, -92, -285, -479, -673, 
-    -869, -1059, -1256, -1441, -1635, -1815, -2003, -2179, -2356, -2526, -2694, -2855, -3012, -3160, -3309, -3445, 
-    -3582, -3708, -3831, -3948, -4059, -4167, -4265, -4364, -4453, -4542, -4622, -4702, -4773, -4847, -4907, -4975, 
-    -5026, -5086, -5129, -5179, -5215, -5254, -5283, -5310, -5330, -5344, -5355, -5356, -5355, -5345, -5330, -5307, 
-    -5277, -5243, -5199, -5148, -5091, -5027, -4958, -4878, -4795, -4704, -4605, -4503, -4392, -4277, -4154, -4027, 
-    -3893, -3758, -3610, -3466, -3311, -3154, -2993, -2825, -2657, -2482, -2306, -2124, -1941, -1753, -1565, -1370, 
-    -1178, -977, -781, -577, -376, -171, 32, 240, 445, 653, 859, 1068, 1271, 1480, 1681, 1888, 
-    2087, 2288, 2483, 2679, 2869, 3058, 3239, 3421, 3595, 3763, 3930, 4086, 4242, 4387, 4527, 4662, 
-    4785, 4910, 5018, 5126, 5222, 5314, 5395, 5474, 5538, 5605, 5653, 5706, 5742, 5780, 5804, 5825, 
-    5843, 5847, 5857, 5846, 5844, 5825, 5808, 5783, 5750, 5719, 5671, 5629, 5573, 5519, 5452, 5385, 
-    5306, 5230, 5138, 5050, 4946, 4845, 4730, 4615, 4490, 4361, 4225, 4082, 3935, 3779, 3620, 3455, 
-    3285, 3106, 2928, 2738, 2554, 2353, 2162, 1956, 1757, 1546, 1342, 1128, 922, 705, 499, 281, 
-    76, -137, -344, -552, -757, -958, -1160, -1356, -1551, -1744, -1932, -2117, -2300, -2476, -2655, -2824, 
-    -2995, -3158, -3322, -3478, -3635, -3784, -3931, -4076, -4211, -4351, -4474, -4604, -4720, -4837, -4942, -5045, 
-    -5140, -5229, -5310, -5382, -5450, -5506, -5559, -5598, -5633, -5658, -5673, -5684, -5680, -5676, -5656, -5634, 
-    -5599, -5563, -5513, -5464, -5400, -5336, -5264, -5185, -5105, -5011, -4923, -4822, -4723, -4612, -4506, -4389, 
-    -4272, -4149, -4024, -3896, -3760, -3627, -3487, -3345, -3198, -3050, -2898, -2744, -2585, -2427, -2261, -2100, 
-    -1928, -1763, -1588, -1420, -1241, -1070, -888, -715, -533, -355, -176, 6, 183, 366, 543, 724, 
-    902, 1080, 1257, 1431, 1606, 1776, 1946, 2113, 2277, 2438, 2595, 2749, 2899, 3042, 3186, 3318, 
-    3450, 3572, 3692, 3803, 3909, 4008, 4100, 4186, 4263, 4337, 4399, 4459, 4508, 4556, 4588, 4625, 
-    4644, 4668, 4678, 4686, 4688, 4681, 4675, 4657, 4642, 4613, 4587, 4551, 4514, 4469, 4423, 4368, 
-    4312, 4249, 4181, 4110, 4029, 3951, 3860, 3770, 3670, 3569, 3459, 3351, 3229, 3113, 2982, 2856, 
-    2722, 2584, 2447, 2300, 2161, 2009, 1866, 1711, 1566, 1410, 1262, 1108, 960, 808, 659, 510, 
-    362, 217, 72, -71, -212, -354, -490, -630, -764, -897, -1030, -1160, -1288, -1416, -1540, -1664, 
-    -1782, -1904, -2017, -2133, -2242, -2353, -2457, -2559, -2657, -2753, -2842, -2930, -3010, -3090, -3159, -3230, 
-    -3288, -3348, -3397, -3442, -3483, -3513, -3543, -3564, -3578, -3590, -3590, -3592, -3582, -3569, -3550, -3527, 
-    -3499, -3463, -3426, -3382, -3334, -3284, -3225, -3166, -3102, -3033, -2961, -2885, -2803, -2724, -2633, -2546, 
-    -2450, -2353, -2255, -2149, -2044, -1933, -1821, -1706, -1588, -1468, -1345, -1222, -1096, -967, -840, -708, 
-    -581, -448, -318, -188, -57, 71, 201, 326, 456, 575, 704, 818, 943, 1053, 1171, 1278, 
-    1390, 1489, 1594, 1688, 1784, 1874, 1959, 2043, 2117, 2196, 2260, 2330, 2386, 2445, 2497, 2541, 
-    2587, 2620, 2658, 2681, 2711, 2725, 2744, 2751, 2760, 2760, 2761, 2754, 2744, 2732, 2715, 2698, 
-    2672, 2648, 2618, 2587, 2552, 2514, 2475, 2429, 2386, 2334, 2284, 2229, 2169, 2111, 2042, 1979, 
-    1905, 1833, 1752, 1673, 1587, 1500, 1407, 1314, 1213, 1113, 1008, 902, 792, 680, 567, 451, 
-    334, 217, 97, -18, -140, -256, -375, -492, -605, -721, -832, -942, -1050, -1157, -1258, -1362, 
-    -1456, -1555, -1646, -1736, -1825, -1908, -1992, -2068, -2147, -2220, -2291, -2360, -2425, -2489, -2548, -2605, 
-    -2659, -2711, -2756, -2801, -2840, -2878, -2907, -2937, -2957, -2978, -2988, -2998, -3002, -2996, -2993, -2976, 
-    -2961, -2936, -2908, -2876, -2836, -2794, -2745, -2692, -2635, -2573, -2507, -2438, -2364, -2286, -2206, -2120, 
-    -2036, -1942, -1854, -1752, -1662, -1555, -1456, -1352, -1244, -1139, -1025, -918, -803, -690, -574, -457, 
-    -339, -220, -99, 21, 143, 267, 388, 515, 637, 763, 887, 1012, 1138, 1259, 1384, 1506, 
-    1629, 1750, 1867, 1986, 2101, 2215, 2329, 2433, 2544, 2644, 2745, 2842, 2933, 3023, 3107, 3187, 
-    3264, 3335, 3402, 3464, 3521, 3574, 3621, 3665, 3701, 3735, 3761, 3786, 3801, 3818, 3820, 3828, 
-    3822, 3819, 3804, 3790, 3768, 3742, 3713, 3677, 3636, 3594, 3544, 3493, 3432, 3370, 3303, 3231, 
-    3155, 3073, 2989, 2899, 2804, 2708, 2602, 2501, 2385, 2275, 2156, 2035, 1912, 1784, 1655, 1521, 
-    1388, 1251, 1113, 971, 830, 687, 545, 399, 256, 111, -33, -175, -319, -461, -602, -742, 
-    -880, -1019, -1152, -1287, -1417, -1551, -1675, -1804, -1925, -2050, -2167, -2289, -2400, -2519, -2624, -2741, 
-    -2839, -2950, -3045, -3151, -3241, -3338, -3424, -3513, -3594, -3672, -3747, -3816, -3884, -3943, -3999, -4051, 
-    -4094, -4137, -4169, -4199, -4222, -4238, -4252, -4256, -4257, -4251, -4240, -4224, -4202, -4174, -4143, -4104, 
-    -4061, -4015, -3960, -3906, -3841, -3776, -3706, -3628, -3553, -3463, -3380, -3284, -3189, -3089, -2982, -2876, 
-    -2762, -2647, -2528, -2404, -2282, -2149, -2023, -1884, -1752, -1613, -1471, -1333, -1187, -1046, -901, -754, 
-    -612, -461, -322, -169, -32, 120, 257, 404, 543, 688, 825, 965, 1103, 1240, 1376, 1507, 
-    1642, 1770, 1901, 2026, 2152, 2272, 2394, 2508, 2624, 2734, 2840, 2945, 3039, 3141, 3226, 3317, 
-    3394, 3471, 3545, 3607, 3672, 3724, 3778, 3820, 3862, 3895, 3927, 3950, 3973, 3988, 4000, 4007, 
-    4010, 4011, 4002, 4000, 3980, 3971, 3945, 3927, 3897, 3866, 3830, 3792, 3748, 3701, 3648, 3592, 
-    3530, 3464, 3394, 3319, 3238, 3152, 3063, 2965, 2868, 2761, 2655, 2541, 2424, 2307, 2178, 2058, 
-    1925, 1798, 1664, 1531, 1396, 1262, 1126, 992, 856, 722, 589, 457, 325, 196, 69, -58, 
-    -181, -308, -425, -549, -664, -784, -896, -1011, -1121, -1231, -1339, -1444, -1548, -1649, -1749, -1847, 
-    -1940, -2034, -2122, -2209, -2295, -2371, -2454, -2522, -2598, -2658, -2727, -2781, -2838, -2888, -2933, -2978, 
-    -3012, -3049, -3073, -3101, -3117, -3137, -3144, -3154, -3155, -3154, -3148, -3138, -3127, -3105, -3089, -3059, 
-    -3034, -3001, -2964, -2929, -2883, -2842, -2790, -2743, -2685, -2633, -2568, -2511, -2442, -2378, -2306, -2237, 
-    -2159, -2087, -2003, -1928, -1842, -1761, -1672, -1588, -1495, -1409, -1314, -1223, -1129, -1033, -940, -841, 
-    -748, -647, -551, -453, -354, -258, -156, -62, 38, 132, 230, 326, 419, 515, 606, 697, 
-    786, 875, 959, 1044, 1124, 1205, 1277, 1354, 1422, 1492, 1555, 1615, 1676, 1728, 1781, 1825, 
-    1872, 1910, 1948, 1982, 2010, 2038, 2058, 2081, 2095, 2108, 2118, 2123, 2128, 2128, 2125, 2120, 
-    2110, 2100, 2088, 2067, 2053, 2025, 2003, 1975, 1943, 1913, 1872, 1839, 1794, 1753, 1706, 1655, 
-    1609, 1550, 1501, 1438, 1383, 1319, 1258, 1195, 1129, 1062, 998, 926, 863, 790, 724, 654, 
-    585, 517, 447, 382, 312, 248, 180, 116, 53, -11, -70, -134, -191, -252, -307, -366, 
-    -419, -476, -525, -581, -626, -681, -724, -774, -818, -861, -904, -943, -985, -1022, -1057, -1092, 
-    -1123, -1157, -1183, -1212, -1235, -1258, -1280, -1295, -1316, -1325, -1341, -1346, -1356, -1358, -1362, -1358, 
-    -1357, -1350, -1344, -1330, -1319, -1301, -1285, -1261, -1241, -1212, -1187, -1153, -1124, -1083, -1052, -1007, 
-    -970, -922, -879, -830, -782, -729, -679, -621, -569, -509, -454, -392, -336, -270, -213, -146, 
-    -88, -21, 40, 106, 167, 234, 296, 361, 426, 486, 550, 613, 674, 734, 792, 854, 
-    909, 968, 1019, 1076, 1126, 1175, 1227, 1271, 1319, 1359, 1401, 1440, 1477, 1510, 1543, 1571, 
-    1599, 1620, 1644, 1660, 1678, 1689, 1700, 1706, 1709, 1708, 1707, 1698, 1691, 1674, 1660, 1636, 
-    1615, 1585, 1553, 1520, 1479, 1438, 1390, 1343, 1290, 1234, 1175, 1114, 1051, 983, 914, 842, 
-    769, 696, 616, 542, 459, 383, 300, 219, 137, 56, -25, -106, -190, -268, -353, -428, 
-    -512, -586, -666, -741, -815, -889, -960, -1031, -1099, -1166, -1230, -1292, -1355, -1410, -1467, -1520, 
-    -1571, -1621, -1665, -1708, -1751, -1787, -1825, -1856, -1888, -1916, -1941, -1965, -1984, -2005, -2020, -2035, 
-    -2045, -2055, -2063, -2068, -2071, -2072, -2072, -2069, -2064, -2058, -2050, -2039, -2026, -2013, -1996, -1977, 
-    -1957, -1935, -1911, -1880, -1855, -1820, -1789, -1749, -1710, -1669, -1624, -1578, -1527, -1475, -1420, -1361, 
-    -1301, -1237, -1172, -1103, -1030, -955, -880, -798, -719, -631, -548, -456, -371, -273, -185, -84, 
-    5, 109, 200, 306, 398, 503, 597, 700, 793, 896, 987, 1088, 1177, 1271, 1362, 1450, 
-    1539, 1621, 1706, 1784, 1864, 1937, 2011, 2079, 2150, 2209, 2276, 2329, 2392, 2439, 2494, 2536, 
-    2585, 2621, 2662, 2694, 2722, 2752, 2771, 2793, 2805, 2816, 2821, 2825, 2820, 2814, 2801, 2783, 
-    2764, 2736, 2709, 2670, 2635, 2589, 2543, 2492, 2437, 2379, 2317, 2252, 2186, 2115, 2042, 1969, 
-    1891, 1815, 1735, 1653, 1572, 1489, 1406, 1320, 1236, 1148, 1063, 975, 888, 799, 711, 621, 
-    532, 443, 351, 261, 170, 79, -10, -104, -193, -285, -377, -464, -559, -643, -738, -818, 
-    -913, -989, -1084, -1155, -1248, -1318, -1404, -1474, -1554, -1622, -1698, -1763, -1834, -1899, -1963, -2026, 
-    -2085, -2146, -2201, -2257, -2309, -2362, -2410, -2458, -2502, -2545, -2584, -2625, -2656, -2694, -2717, -2749, 
-    -2767, -2793, -2805, -2821, -2827, -2836, -2835, -2837, -2825, -2820, -2801, -2788, -2759, -2738, -2702, -2672, 
-    -2629, -2588, -2540, -2488, -2437, -2375, -2316, -2249, -2182, -2110, -2036, -1958, -1878, -1794, -1709, -1621, 
-    -1532, -1438, -1343, -1248, -1147, -1051, -946, -845, -739, -634, -529, -420, -314, -205, -98, 11, 
-    115, 227, 329, 438, 541, 642, 748, 844, 945, 1039, 1134, 1225, 1316, 1400, 1489, 1567, 
-    1651, 1723, 1803, 1870, 1946, 2006, 2077, 2134, 2196, 2253, 2305, 2358, 2403, 2453, 2491, 2535, 
-    2564, 2605, 2626, 2659, 2675, 2700, 2709, 2724, 2729, 2734, 2732, 2727, 2719, 2705, 2692, 2666, 
-    2648, 2615, 2587, 2550, 2512, 2472, 2424, 2379, 2327, 2274, 2218, 2159, 2099, 2036, 1971, 1902, 
-    1835, 1764, 1692, 1617, 1542, 1466, 1387, 1309, 1228, 1148, 1064, 984, 898, 817, 729, 645, 
-    561, 473, 388, 300, 215, 127, 41, -47, -132, -220, -304, -391, -476, -561, -645, -729, 
-    -811, -894, -973, -1055, -1132, -1211, -1285, -1363, -1433, -1508, -1576, -1647, -1710, -1779, -1837, -1903, 
-    -1957, -2018, -2068, -2123, -2169, -2218, -2261, -2300, -2340, -2373, -2407, -2433, -2459, -2480, -2499, -2514, 
-    -2522, -2535, -2531, -2539, -2529, -2526, -2513, -2499, -2480, -2459, -2434, -2406, -2371, -2340, -2296, -2259, 
-    -2209, -2163, -2112, -2057, -1999, -1940, -1875, -1811, -1740, -1671, -1598, -1520, -1445, -1361, -1282, -1196, 
-    -1109, -1024, -932, -842, -750, -654, -564, -464, -372, -272, -176, -77, 18, 118, 213, 314, 
-    409, 507, 602, 697, 792, 885, 976, 1068, 1155, 1243, 1329, 1409, 1494, 1568, 1647, 1718, 
-    1790, 1858, 1920, 1985, 2040, 2098, 2145, 2198, 2238, 2283, 2316, 2353, 2380, 2408, 2431, 2449, 
-    2465, 2476, 2485, 2489, 2488, 2488, 2478, 2472, 2454, 2442, 2418, 2396, 2368, 2339, 2305, 2267, 
-    2229, 2181, 2140, 2085, 2038, 1978, 1923, 1861, 1798, 1733, 1663, 1597, 1521, 1451, 1373, 1299, 
-    1220, 1142, 1062, 981, 901, 818, 740, 653, 575, 490, 411, 328, 246, 166, 86, 3, 
-    -74, -156, -234, -314, -393, -472, -549, -629, -702, -785, -853, -938, -1003, -1084, -1152, -1226, 
-    -1296, -1365, -1431, -1501, -1563, -1627, -1687, -1746, -1804, -1857, -1910, -1960, -2007, -2052, -2093, -2132, 
-    -2170, -2201, -2234, -2258, -2285, -2304, -2323, -2335, -2348, -2352, -2362, -2355, -2360, -2346, -2343, -2323, 
-    -2313, -2288, -2270, -2238, -2214, -2175, -2146, -2101, -2064, -2017, -1970, -1920, -1868, -1813, -1756, -1695, 
-    -1636, -1570, -1507, -1436, -1370, -1297, -1226, -1152, -1075, -1002, -922, -844, -767, -683, -606, -522, 
-    -442, -360, -277, -195, -112, -31, 50, 131, 215, 291, 375, 451, 533, 605, 685, 757, 
-    833, 902, 975, 1043, 1111, 1178, 1239, 1307, 1361, 1427, 1479, 1537, 1590, 1641, 1693, 1737, 
-    1787, 1824, 1873, 1906, 1947, 1979, 2012, 2042, 2068, 2096, 2113, 2138, 2150, 2167, 2176, 2185, 
-    2190, 2193, 2192, 2188, 2181, 2172, 2158, 2144, 2124, 2102, 2077, 2049, 2020, 1984, 1949, 1909, 
-    1867, 1824, 1775, 1726, 1675, 1619, 1565, 1506, 1447, 1387, 1321, 1258, 1193, 1127, 1059, 990, 
-    922, 851, 782, 710, 641, 568, 500, 422, 361, 
-};
-const unsigned int drum_v0_p1_long_len = 11753;
@@ -1,661 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v0_p2_long[] PROGMEM = {
-    24, -9, 14, 10, 20, 20, 23, 21, 19, 15, 15, 6, 5, -4, -5, -16, 
-    -19, -31, -34, -46, -50, -64, -68, -82, -87, -101, -109, -122, -133, -144, -157, -168, 
-    -182, -194, -207, -220, -234, -247, -259, -273, -285, -298, -310, -321, -335, -344, -357, -366, 
-    -378, -386, -399, -405, -417, -424, -435, -443, -451, -460, -467, -478, -483, -494, -501, -510, 
-    -517, -526, -534, -543, -550, -560, -567, -577, -584, -592, -600, -608, -615, -622, -629, -635, 
-    -641, -647, -650, -656, -656, -664, -662, -666, -663, -667, -664, -663, -660, -659, -654, -651, 
-    -646, -642, -634, -630, -621, -617, -605, -600, -588, -581, -570, -560, -549, -538, -524, -513, 
-    -498, -486, -468, -454, -438, -424, -403, -389, -369, -354, -332, -316, -296, -277, -258, -239, 
-    -221, -199, -181, -162, -143, -123, -106, -86, -69, -49, -32, -13, 2, 21, 38, 56, 
-    71, 89, 105, 123, 137, 156, 170, 187, 202, 220, 234, 252, 267, 284, 300, 316, 
-    333, 350, 367, 383, 400, 417, 433, 449, 465, 480, 496, 509, 525, 536, 551, 561, 
-    574, 584, 595, 604, 613, 622, 630, 637, 644, 651, 656, 663, 668, 673, 678, 683, 
-    687, 689, 695, 696, 699, 701, 701, 702, 701, 701, 697, 695, 690, 684, 679, 670, 
-    662, 651, 642, 629, 616, 603, 587, 572, 556, 539, 520, 503, 484, 465, 445, 426, 
-    404, 386, 362, 342, 319, 297, 273, 250, 225, 199, 173, 147, 118, 91, 60, 32, 
-    -1, -30, -65, -95, -130, -164, -197, -232, -266, -300, -336, -369, -405, -436, -472, -504, 
-    -538, -568, -600, -631, -661, -689, -718, -746, -772, -798, -822, -847, -869, -892, -912, -932, 
-    -951, -969, -986, -1002, -1017, -1031, -1044, -1056, -1066, -1076, -1084, -1092, -1097, -1103, -1105, -1108, 
-    -1106, -1107, -1103, -1099, -1094, -1088, -1078, -1067, -1056, -1041, -1026, -1008, -990, -967, -947, -922, 
-    -899, -870, -844, -812, -784, -749, -718, -681, -647, -608, -570, -530, -490, -447, -405, -360, 
-    -316, -269, -223, -176, -126, -78, -27, 22, 74, 127, 177, 233, 283, 339, 392, 446, 
-    501, 554, 611, 663, 718, 773, 827, 880, 934, 987, 1039, 1090, 1141, 1191, 1240, 1287, 
-    1333, 1379, 1421, 1465, 1502, 1545, 1579, 1616, 1647, 1680, 1709, 1735, 1762, 1783, 1805, 1823, 
-    1838, 1853, 1862, 1873, 1876, 1883, 1880, 1880, 1874, 1868, 1855, 1843, 1825, 1807, 1783, 1758, 
-    1730, 1697, 1663, 1626, 1585, 1542, 1495, 1447, 1395, 1341, 1284, 1224, 1163, 1097, 1031, 961, 
-    891, 818, 741, 665, 585, 506, 421, 339, 251, 165, 76, -13, -104, -198, -290, -384, 
-    -481, -575, -674, -769, -870, -967, -1066, -1165, -1264, -1364, -1462, -1560, -1659, -1755, -1853, -1947, 
-    -2043, -2135, -2228, -2318, -2407, -2495, -2580, -2666, -2748, -2828, -2909, -2984, -3061, -3132, -3205, -3274, 
-    -3340, -3405, -3466, -3527, -3582, -3637, -3687, -3735, -3778, -3819, -3856, -3888, -3917, -3939, -3958, -3972, 
-    -3981, -3983, -3981, -3972, -3958, -3937, -3909, -3877, -3836, -3789, -3737, -3675, -3610, -3535, -3456, -3367, 
-    -3275, -3172, -3067, -2951, -2832, -2701, -2569, -2427, -2281, -2126, -1966, -1800, -1627, -1450, -1265, -1077, 
-    -882, -683, -480, -272, -59, 154, 373, 594, 819, 1042, 1271, 1496, 1728, 1952, 2184, 2406, 
-    2636, 2856, 3080, 3297, 3513, 3725, 3933, 4137, 4337, 4530, 4720, 4904, 5081, 5254, 5419, 5579, 
-    5731, 5877, 6016, 6148, 6273, 6391, 6500, 6605, 6699, 6789, 6869, 6944, 7009, 7069, 7120, 7165, 
-    7202, 7233, 7256, 7271, 7282, 7283, 7279, 7266, 7251, 7223, 7195, 7155, 7114, 7062, 7008, 6945, 
-    6878, 6803, 6724, 6638, 6545, 6448, 6344, 6236, 6116, 5995, 5865, 5730, 5586, 5435, 5280, 5112, 
-    4941, 4757, 4568, 4367, 4161, 3941, 3713, 3476, 3227, 2969, 2699, 2423, 2131, 1832, 1523, 1202, 
-    873, 532, 185, -173, -539, -913, -1297, -1686, -2084, -2485, -2897, -3308, -3730, -4150, -4578, -5006, 
-    -5436, -5866, -6297, -6727, -7154, -7579, -8000, -8413, -8824, -9223, -9617, -9997, -10371, -10728, -11076, -11405, 
-    -11723, -12021, -12304, -12569, -12812, -13041, -13244, -13435, -13596, -13744, -13867, -13972, -14056, -14120, -14164, -14191, 
-    -14200, -14190, -14166, -14125, -14073, -14004, -13926, -13834, -13736, -13623, -13507, -13380, -13247, -13104, -12957, -12801, 
-    -12636, -12466, -12284, -12095, -11892, -11680, -11455, -11214, -10961, -10689, -10405, -10099, -9782, -9443, -9093, -8724, 
-    -8347, -7953, -7554, -7145, -6736, -6322, -5911, -5503, -5103, -4710, -4327, -3955, -3592, -3242, -2897, -2558, 
-    -2221, -1881, -1535, -1172, -792, -384, 54, 538, 1060, 1640, 2268, 2962, 3713, 4528, 5415, 6376, 
-    7370, 8424, 9508, 10630, 11759, 12910, 14045, 15178, 16270, 17363, 18390, 19393, 19582, 19551, 19568, 19557, 
-    19566, 19558, 19565, 19559, 19565, 19559, 19564, 19560, 19564, 19561, 19563, 19561, 19563, 19561, 19563, 19561, 
-    19561, 19562, 19561, 19562, 19559, 19562, 19560, 19562, 19561, 19562, 19561, 19563, 19561, 19562, 19562, 19562, 
-    19560, 19564, 19559, 19565, 19554, 19577, 19488, 18282, 16986, 15681, 14382, 13071, 11768, 10483, 9218, 7973, 
-    6754, 5586, 4472, 3412, 2408, 1474, 611, -185, -927, -1631, -2303, -2955, -3588, -4203, -4818, -5442, 
-    -6079, -6728, -7389, -8063, -8755, -9490, -10260, -11064, -11884, -12723, -13572, -14430, -15283, -16138, -16987, -17830, 
-    -18655, -19406, -19616, -19592, -19603, -19596, -19602, -19597, -19600, -19597, -19600, -19597, -19600, -19597, -19599, -19597, 
-    -19599, -19598, -19600, -19597, -19599, -19598, -19601, -19597, -19601, -19598, -19600, -19598, -19600, -19598, -19600, -19597, 
-    -19600, -19597, -19599, -19596, -19600, -19597, -19599, -19598, -19600, -19598, -19599, -19598, -19599, -19597, -19601, -19596, 
-    -19602, -19594, -19604, -19593, -19605, -19591, -19608, -19587, -19615, -19574, -19646, -19236, -17796, -16450, -15011, -13604, 
-    -12146, -10719, -9269, -7868, -6468, -5129, -3801, -2525, -1258, -35, 1174, 2339, 3489, 4599, 5701, 6771, 
-    7836, 8862, 9885, 10871, 11857, 12814, 13779, 14724, 15688, 16635, 17602, 18553, 19479, 19580, 19554, 19566, 
-    19559, 19564, 19560, 19563, 19560, 19564, 19561, 19562, 19561, 19563, 19562, 19562, 19562, 19562, 19562, 19562, 
-    19562, 19562, 19562, 19563, 19561, 19563, 19561, 19563, 19561, 19562, 19562, 19563, 19561, 19563, 19561, 19563, 
-    19560, 19563, 19560, 19563, 19560, 19564, 19560, 19563, 19561, 19563, 19561, 19563, 19561, 19562, 19560, 19563, 
-    19561, 19563, 19561, 19563, 19561, 19563, 19560, 19564, 19558, 19567, 19555, 19573, 19546, 19592, 18883, 17339, 
-    15820, 14231, 12659, 11042, 9443, 7806, 6175, 4517, 2872, 1215, -417, -2050, -3652, -5238, -6778, -8297, 
-    -9759, -11195, -12565, -13913, -15185, -16452, -17627, -18854, -19573, -19596, -19603, -19597, -19600, -19597, -19601, -19598, 
-    -19600, -19597, -19601, -19598, -19600, -19598, -19599, -19598, -19599, -19598, -19599, -19598, -19599, -19597, -19600, -19599, 
-    -19600, -19598, -19599, -19598, -19600, -19596, -19600, -19597, -19600, -19598, -19601, -19598, -19600, -19598, -19599, -19598, 
-    -19598, -19599, -19599, -19598, -19599, -19598, -19600, -19598, -19599, -19598, -19600, -19598, -19599, -19597, -19600, -19598, 
-    -19600, -19597, -19600, -19596, -19601, -19596, -19603, -19595, -19603, -19593, -19604, -19593, -19606, -19593, -19572, -18108, 
-    -15924, -13793, -11600, -9422, -7221, -5039, -2857, -703, 1427, 3524, 5588, 7619, 9600, 11552, 13436, 15297, 
-    17072, 18834, 19594, 19543, 19575, 19552, 19570, 19555, 19568, 19556, 19568, 19556, 19567, 19557, 19567, 19557, 
-    19567, 19556, 19568, 19556, 19567, 19556, 19567, 19557, 19567, 19557, 19567, 19557, 19567, 19558, 19566, 19558, 
-    19566, 19558, 19566, 19558, 19566, 19557, 19567, 19557, 19567, 19557, 19567, 19557, 19567, 19557, 19566, 19557, 
-    19566, 19557, 19566, 19557, 19566, 19557, 19566, 19558, 19565, 19558, 19565, 19559, 19566, 19557, 19568, 19556, 
-    19569, 19554, 19570, 19553, 19572, 19551, 19575, 19546, 19582, 19532, 19620, 19321, 17283, 15273, 13180, 11101, 
-    8977, 6862, 4724, 2602, 473, -1626, -3715, -5767, -7801, -9793, -11759, -13681, -15567, -17417, -19147, -19630, 
-    -19585, -19607, -19593, -19604, -19595, -19603, -19595, -19602, -19596, -19602, -19596, -19601, -19597, -19600, -19598, -19600, 
-    -19598, -19600, -19597, -19601, -19598, -19600, -19598, -19600, -19598, -19601, -19597, -19601, -19596, -19602, -19596, -19602, 
-    -19595, -19600, -19595, -19601, -19596, -19602, -19597, -19601, -19596, -19601, -19597, -19602, -19596, -19601, -19596, -19601, 
-    -19595, -19601, -19595, -19602, -19594, -19603, -19593, -19604, -19593, -19604, -19593, -19603, -19592, -19604, -19593, -19607, 
-    -19590, -19608, -19588, -19611, -19584, -19614, -19579, -19626, -19558, -19660, -18408, -16485, -14713, -12792, -10917, -8962, 
-    -7035, -5065, -3120, -1167, 757, 2662, 4535, 6374, 8180, 9941, 11678, 13353, 15024, 16605, 18253, 19506, 
-    19546, 19576, 19550, 19572, 19553, 19571, 19554, 19569, 19555, 19569, 19556, 19568, 19557, 19567, 19557, 19566, 
-    19557, 19566, 19557, 19565, 19557, 19566, 19557, 19565, 19557, 19565, 19558, 19563, 19560, 19563, 19560, 19562, 
-    19561, 19563, 19560, 19564, 19560, 19563, 19561, 19563, 19560, 19563, 19560, 19563, 19559, 19565, 19558, 19565, 
-    19559, 19564, 19560, 19563, 19560, 19564, 19560, 19563, 19561, 19563, 19559, 19563, 19561, 19564, 19560, 19563, 
-    19561, 19561, 19562, 19559, 19565, 19554, 19580, 19459, 17891, 16262, 14607, 12946, 11250, 9547, 7809, 6061, 
-    4279, 2487, 664, -1166, -3027, -4885, -6774, -8651, -10561, -12444, -14361, -16220, -18161, -19508, -19605, -19600, 
-    -19596, -19600, -19598, -19601, -19596, -19599, -19598, -19598, -19599, -19598, -19599, -19597, -19599, -19599, -19599, -19599, 
-    -19597, -19599, -19597, -19599, -19598, -19600, -19599, -19599, -19600, -19599, -19598, -19599, -19598, -19599, -19598, -19598, 
-    -19600, -19599, -19600, -19599, -19600, -19598, -19598, -19599, -19598, -19600, -19597, -19599, -19598, -19600, -19599, -19599, 
-    -19599, -19599, -19599, -19599, -19599, -19598, -19599, -19599, -19599, -19601, -19597, -19602, -19594, -19605, -19587, -19625, 
-    -19462, -17983, -16221, -14461, -12680, -10885, -9080, -7264, -5445, -3620, -1802, 9, 1804, 3582, 5333, 7059, 
-    8754, 10414, 12041, 13622, 15173, 16658, 18145, 19419, 19565, 19563, 19559, 19564, 19559, 19564, 19559, 19564, 
-    19560, 19564, 19559, 19564, 19560, 19564, 19560, 19563, 19560, 19564, 19559, 19563, 19560, 19562, 19560, 19562, 
-    19561, 19562, 19561, 19563, 19559, 19565, 19559, 19565, 19558, 19564, 19559, 19564, 19560, 19564, 19560, 19563, 
-    19560, 19563, 19560, 19564, 19560, 19563, 19559, 19563, 19560, 19564, 19560, 19564, 19559, 19565, 19559, 19566, 
-    19558, 19565, 19558, 19567, 19557, 19567, 19555, 19571, 19551, 19575, 19543, 19587, 18222, 16418, 14730, 12996, 
-    11319, 9629, 7977, 6322, 4691, 3056, 1438, -185, -1800, -3424, -5044, -6674, -8305, -9940, -11574, -13200, 
-    -14823, -16416, -18021, -19463, -19606, -19599, -19599, -19599, -19598, -19601, -19597, -19600, -19597, -19601, -19597, -19601, 
-    -19597, -19601, -19598, -19599, -19597, -19599, -19597, -19598, -19598, -19599, -19598, -19600, -19598, -19600, -19597, -19600, 
-    -19598, -19600, -19599, -19599, -19599, -19598, -19599, -19599, -19598, -19599, -19598, -19600, -19599, -19598, -19599, -19599, 
-    -19599, -19599, -19598, -19600, -19598, -19600, -19598, -19599, -19598, -19598, -19599, -19598, -19600, -19597, -19600, -19598, 
-    -19600, -19598, -19599, -19599, -19598, -19600, -19596, -19608, -19546, -18299, -16808, -15313, -13771, -12204, -10608, -8986, 
-    -7343, -5674, -3991, -2287, -572, 1165, 2911, 4681, 6456, 8254, 10048, 11857, 13655, 15465, 17254, 19022, 
-    19594, 19546, 19572, 19555, 19567, 19557, 19566, 19559, 19564, 19559, 19564, 19559, 19564, 19560, 19563, 19560, 
-    19563, 19560, 19563, 19560, 19562, 19561, 19563, 19561, 19562, 19561, 19563, 19561, 19563, 19560, 19564, 19561, 
-    19563, 19560, 19564, 19559, 19564, 19559, 19563, 19560, 19563, 19561, 19563, 19560, 19563, 19560, 19562, 19560, 
-    19562, 19562, 19559, 19573, 19387, 18544, 17620, 16708, 15799, 14898, 14011, 13133, 12273, 11426, 10596, 9778, 
-    8976, 8178, 7391, 6599, 5812, 5012, 4205, 3374, 2526, 1644, 737, -213, -1193, -2219, -3274, -4375, 
-    -5501, -6671, -7856, -9088, -10320, -11595, -12862, -14159, -15434, -16730, -17985, -19250, -19619, -19587, -19606, -19593, 
-    -19604, -19594, -19603, -19596, -19602, -19596, -19601, -19597, -19600, -19598, -19599, -19598, -19598, -19598, -19598, -19597, 
-    -19600, -19598, -19599, -19599, -19599, -19599, -19598, -19600, -19598, -19599, -19597, -19599, -19598, -19599, -19598, -19599, 
-    -19598, -19599, -19597, -19600, -19597, -19603, -19592, -19617, -19416, -18425, -17270, -16136, -14989, -13844, -12700, -11561, 
-    -10425, -9301, -8185, -7086, -5997, -4933, -3880, -2857, -1849, -874, 80, 1001, 1899, 2760, 3597, 4394, 
-    5167, 5902, 6615, 7297, 7960, 8601, 9228, 9842, 10451, 11050, 11654, 12251, 12863, 13468, 14098, 14719, 
-    15368, 16006, 16673, 17323, 18011, 18655, 19373, 19601, 19542, 19575, 19552, 19570, 19556, 19566, 19557, 19565, 
-    19558, 19565, 19559, 19564, 19559, 19564, 19560, 19563, 19562, 19563, 19561, 19563, 19560, 19563, 19560, 19564, 
-    19560, 19564, 19560, 19564, 19559, 19564, 19560, 19563, 19563, 19505, 19060, 18500, 17927, 17310, 16656, 15957, 
-    15213, 14423, 13584, 12699, 11771, 10803, 9796, 8756, 7688, 6603, 5500, 4396, 3289, 2199, 1122, 70, 
-    -954, -1944, -2894, -3805, -4674, -5497, -6282, -7025, -7735, -8412, -9067, -9697, -10314, -10917, -11514, -12103, 
-    -12694, -13280, -13869, -14452, -15039, -15617, -16197, -16761, -17322, -17858, -18385, -18876, -19359, -19605, -19594, -19602, 
-    -19596, -19600, -19597, -19600, -19598, -19599, -19597, -19599, -19598, -19600, -19598, -19600, -19598, -19600, -19597, -19600, 
-    -19597, -19601, -19597, -19601, -19596, -19603, -19593, -19608, -19508, -19147, -18771, -18357, -17922, -17445, -16945, -16400, 
-    -15826, -15209, -14561, -13870, -13148, -12387, -11596, -10773, -9925, -9054, -8168, -7269, -6360, -5448, -4535, -3625, 
-    -2723, -1830, -953, -87, 757, 1591, 2403, 3205, 3986, 4756, 5508, 6251, 6977, 7698, 8406, 9105, 
-    9795, 10475, 11140, 11795, 12431, 13053, 13651, 14231, 14784, 15311, 15811, 16280, 16718, 17121, 17492, 17827, 
-    18127, 18392, 18622, 18819, 18981, 19115, 19214, 19286, 19330, 19348, 19338, 19304, 19244, 19162, 19056, 18929, 
-    18784, 18619, 18438, 18236, 18017, 17780, 17527, 17258, 16973, 16673, 16362, 16036, 15703, 15355, 15002, 14634, 
-    14262, 13877, 13485, 13079, 12666, 12237, 11797, 11341, 10874, 10389, 9888, 9371, 8838, 8287, 7719, 7133, 
-    6528, 5903, 5260, 4598, 3917, 3216, 2501, 1770, 1026, 266, -495, -1272, -2046, -2830, -3606, -4386, 
-    -5152, -5913, -6657, -7387, -8093, -8782, -9442, -10079, -10685, -11264, -11812, -12330, -12819, -13278, -13707, -14111, 
-    -14488, -14846, -15178, -15493, -15789, -16066, -16330, -16575, -16807, -17020, -17218, -17394, -17548, -17678, -17782, -17855, 
-    -17896, -17904, -17873, -17807, -17699, -17556, -17374, -17157, -16908, -16629, -16323, -15997, -15647, -15287, -14912, -14536, 
-    -14153, -13774, -13401, -13034, -12680, -12331, -11997, -11669, -11350, -11035, -10721, -10406, -10085, -9750, -9403, -9034, 
-    -8647, -8229, -7788, -7314, -6808, -6275, -5710, -5123, -4510, -3878, -3229, -2568, -1900, -1226, -552, 114, 
-    777, 1424, 2058, 2669, 3263, 3835, 4385, 4917, 5425, 5919, 6387, 6846, 7279, 7706, 8112, 8510, 
-    8895, 9272, 9640, 9999, 10353, 10700, 11038, 11370, 11692, 12007, 12307, 12602, 12882, 13155, 13410, 13653, 
-    13876, 14079, 14261, 14413, 14543, 14637, 14705, 14735, 14735, 14697, 14629, 14525, 14391, 14224, 14031, 13810, 
-    13568, 13305, 13021, 12722, 12409, 12083, 11747, 11402, 11050, 10695, 10335, 9978, 9620, 9265, 8910, 8557, 
-    8209, 7859, 7514, 7171, 6828, 6487, 6151, 5813, 5480, 5147, 4820, 4494, 4169, 3851, 3533, 3223, 
-    2909, 2602, 2290, 1983, 1671, 1360, 1046, 731, 413, 92, -233, -562, -894, -1229, -1565, -1907, 
-    -2245, -2591, -2933, -3281, -3628, -3975, -4324, -4672, -5024, -5373, -5723, -6070, -6416, -6756, -7091, -7419, 
-    -7738, -8048, -8343, -8626, -8891, -9137, -9364, -9568, -9749, -9906, -10038, -10147, -10232, -10292, -10330, -10346, 
-    -10341, -10318, -10277, -10223, -10149, -10071, -9975, -9879, -9769, -9661, -9542, -9427, -9300, -9176, -9043, -8911, 
-    -8765, -8615, -8452, -8275, -8083, -7873, -7647, -7399, -7135, -6854, -6557, -6246, -5925, -5595, -5259, -4922, 
-    -4584, -4251, -3924, -3609, -3310, -3028, -2766, -2528, -2314, -2126, -1966, -1829, -1721, -1633, -1571, -1524, 
-    -1494, -1474, -1464, -1453, -1445, -1427, -1407, -1369, -1323, -1257, -1180, -1080, -968, -834, -688, -522, 
-    -343, -150, 50, 263, 480, 709, 938, 1172, 1408, 1644, 1881, 2113, 2345, 2571, 2796, 3016, 
-    3237, 3453, 3671, 3888, 4107, 4328, 4549, 4774, 4999, 5224, 5451, 5671, 5892, 6100, 6305, 6492, 
-    6667, 6824, 6957, 7070, 7155, 7215, 7244, 7247, 7221, 7170, 7089, 6989, 6864, 6725, 6570, 6408, 
-    6238, 6066, 5895, 5732, 5574, 5432, 5299, 5189, 5089, 5016, 4954, 4918, 4895, 4891, 4899, 4920, 
-    4947, 4979, 5011, 5041, 5064, 5076, 5077, 5060, 5028, 4973, 4899, 4800, 4682, 4540, 4377, 4195, 
-    3995, 3780, 3549, 3310, 3060, 2807, 2546, 2290, 2033, 1788, 1547, 1326, 1113, 921, 745, 589, 
-    450, 333, 231, 146, 73, 13, -41, -86, -133, -174, -223, -272, -336, -403, -489, -582, 
-    -696, -819, -961, -1114, -1281, -1460, -1645, -1841, -2034, -2232, -2421, -2608, -2779, -2943, -3089, -3221, 
-    -3334, -3433, -3512, -3578, -3624, -3661, -3680, -3699, -3705, -3713, -3716, -3728, -3741, -3765, -3794, -3839, 
-    -3889, -3956, -4029, -4121, -4217, -4328, -4440, -4564, -4686, -4812, -4935, -5050, -5162, -5259, -5352, -5423, 
-    -5487, -5527, -5558, -5566, -5565, -5547, -5522, -5482, -5441, -5389, -5337, -5280, -5229, -5172, -5125, -5076, 
-    -5038, -4998, -4972, -4947, -4928, -4914, -4903, -4899, -4893, -4894, -4890, -4890, -4883, -4875, -4860, -4842, 
-    -4813, -4779, -4734, -4681, -4618, -4539, -4452, -4347, -4233, -4099, -3954, -3792, -3615, -3423, -3216, -2997, 
-    -2763, -2518, -2260, -1990, -1713, -1425, -1134, -835, -537, -235, 64, 360, 651, 935, 1211, 1476, 
-    1730, 1975, 2204, 2426, 2632, 2832, 3019, 3202, 3376, 3546, 3713, 3878, 4044, 4211, 4378, 4551, 
-    4723, 4901, 5078, 5259, 5441, 5622, 5802, 5979, 6155, 6325, 6491, 6651, 6804, 6951, 7090, 7223, 
-    7346, 7464, 7574, 7678, 7777, 7871, 7963, 8049, 8133, 8214, 8293, 8368, 8439, 8507, 8568, 8622, 
-    8669, 8701, 8723, 8726, 8715, 8685, 8636, 8565, 8473, 8355, 8215, 8047, 7857, 7641, 7403, 7142, 
-    6862, 6558, 6241, 5902, 5554, 5188, 4818, 4435, 4049, 3657, 3266, 2874, 2488, 2106, 1731, 1362, 
-    1005, 657, 317, -8, -324, -627, -918, -1197, -1462, -1716, -1955, -2183, -2396, -2600, -2790, -2970, 
-    -3137, -3298, -3449, -3595, -3732, -3864, -3993, -4113, -4234, -4344, -4456, -4559, -4661, -4757, -4847, -4932, 
-    -5012, -5085, -5156, -5218, -5281, -5332, -5386, -5430, -5477, -5518, -5563, -5601, -5647, -5687, -5734, -5777, 
-    -5829, -5879, -5933, -5989, -6046, -6105, -6162, -6221, -6275, -6328, -6375, -6420, -6457, -6490, -6513, -6531, 
-    -6537, -6537, -6527, -6507, -6480, -6443, -6401, -6347, -6292, -6226, -6157, -6080, -6001, -5913, -5827, -5730, 
-    -5638, -5533, -5433, -5322, -5211, -5091, -4968, -4838, -4699, -4554, -4402, -4241, -4073, -3891, -3702, -3496, 
-    -3283, -3055, -2818, -2565, -2305, -2033, -1755, -1470, -1181, -887, -593, -299, -10, 274, 550, 817, 
-    1071, 1311, 1535, 1743, 1933, 2105, 2258, 2393, 2508, 2608, 2690, 2758, 2810, 2855, 2887, 2915, 
-    2936, 2955, 2976, 2996, 3022, 3050, 3088, 3128, 3181, 3236, 3305, 3378, 3462, 3550, 3643, 3744, 
-    3843, 3948, 4046, 4150, 4247, 4342, 4433, 4520, 4605, 4683, 4759, 4827, 4894, 4955, 5016, 5071, 
-    5130, 5183, 5245, 5303, 5369, 5438, 5514, 5592, 5679, 5770, 5870, 5970, 6079, 6185, 6296, 6400, 
-    6506, 6603, 6695, 6774, 6842, 6897, 6936, 6957, 6961, 6945, 6907, 6850, 6771, 6674, 6554, 6417, 
-    6261, 6089, 5901, 5698, 5483, 5255, 5020, 4773, 4519, 4260, 3996, 3731, 3460, 3192, 2923, 2657, 
-    2393, 2137, 1883, 1641, 1404, 1181, 964, 763, 571, 394, 229, 80, -57, -180, -291, -387, 
-    -477, -552, -623, -686, -747, -806, -865, -928, -995, -1070, -1149, -1239, -1338, -1449, -1571, -1707, 
-    -1854, -2014, -2185, -2367, -2559, -2760, -2970, -3185, -3405, -3632, -3858, -4091, -4319, -4553, -4781, -5010, 
-    -5235, -5460, -5681, -5900, -6114, -6326, -6531, -6734, -6928, -7118, -7295, -7467, -7624, -7774, -7907, -8030, 
-    -8136, -8228, -8303, -8363, -8408, -8435, -8450, -8448, -8436, -8406, -8368, -8315, -8252, -8179, -8095, -8005, 
-    -7904, -7800, -7684, -7568, -7441, -7313, -7176, -7040, -6896, -6753, -6607, -6459, -6313, -6163, -6019, -5871, 
-    -5730, -5586, -5449, -5310, -5178, -5048, -4923, -4800, -4678, -4561, -4444, -4328, -4210, -4092, -3972, -3846, 
-    -3716, -3576, -3432, -3276, -3112, -2936, -2750, -2552, -2343, -2120, -1886, -1637, -1378, -1104, -819, -520, 
-    -210, 111, 446, 791, 1147, 1514, 1887, 2270, 2659, 3054, 3453, 3858, 4262, 4670, 5074, 5478, 
-    5875, 6271, 6659, 7040, 7413, 7781, 8134, 8482, 8816, 9145, 9458, 9766, 10058, 10346, 10621, 10886, 
-    11140, 11385, 11618, 11841, 12051, 12255, 12441, 12621, 12783, 12937, 13077, 13202, 13313, 13409, 13488, 13550, 
-    13593, 13618, 13620, 13605, 13563, 13501, 13415, 13305, 13170, 13009, 12823, 12612, 12377, 12117, 11833, 11530, 
-    11204, 10859, 10498, 10123, 9734, 9335, 8928, 8516, 8095, 7677, 7250, 6831, 6404, 5987, 5562, 5148, 
-    4727, 4316, 3897, 3486, 3070, 2660, 2241, 1830, 1409, 992, 565, 143, -290, -721, -1165, -1607, 
-    -2063, -2520, -2988, -3464, -3947, -4439, -4939, -5448, -5966, -6487, -7018, -7550, -8086, -8623, -9157, -9689, 
-    -10214, -10729, -11235, -11723, -12199, -12654, -13091, -13504, -13895, -14261, -14607, -14923, -15218, -15485, -15734, -15955, 
-    -16160, -16343, -16510, -16660, -16794, -16914, -17018, -17110, -17183, -17243, -17283, -17306, -17306, -17285, -17237, -17166, 
-    -17063, -16929, -16762, -16559, -16322, -16043, -15729, -15377, -14987, -14561, -14102, -13610, -13090, -12540, -11972, -11381, 
-    -10780, -10161, -9545, -8918, -8299, -7679, -7072, -6469, -5881, -5304, -4740, -4190, -3654, -3129, -2614, -2107, 
-    -1607, -1108, -611, -110, 392, 904, 1424, 1956, 2501, 3056, 3629, 4211, 4809, 5416, 6033, 6656, 
-    7282, 7908, 8528, 9141, 9745, 10330, 10903, 11448, 11978, 12477, 12954, 13401, 13822, 14215, 14578, 14917, 
-    15230, 15520, 15787, 16032, 16261, 16467, 16661, 16835, 16999, 17146, 17280, 17403, 17511, 17608, 17691, 17759, 
-    17811, 17844, 17860, 17853, 17822, 17769, 17685, 17576, 17435, 17266, 17063, 16832, 16565, 16270, 15941, 15583, 
-    15194, 14780, 14338, 13873, 13386, 12879, 12352, 11812, 11255, 10690, 10112, 9529, 8940, 8346, 7750, 7152, 
-    6557, 5960, 5365, 4772, 4177, 3588, 2994, 2406, 1811, 1220, 623, 25, -579, -1185, -1800, -2416, 
-    -3043, -3670, -4307, -4945, -5588, -6233, -6876, -7520, -8159, -8793, -9418, -10032, -10634, -11217, -11788, -12332, 
-    -12856, -13353, -13822, -14266, -14674, -15059, -15404, -15725, -16008, -16266, -16490, -16687, -16856, -16999, -17118, -17214, 
-    -17286, -17340, -17372, -17386, -17381, -17359, -17321, -17266, -17196, -17112, -17012, -16899, -16770, -16626, -16465, -16290, 
-    -16097, -15885, -15652, -15403, -15129, -14838, -14520, -14186, -13825, -13443, -13037, -12608, -12153, -11675, -11170, -10643, 
-    -10091, -9516, -8919, -8301, -7664, -7010, -6340, -5659, -4966, -4267, -3564, -2857, -2153, -1449, -752, -60, 
-    623, 1294, 1958, 2605, 3239, 3858, 4462, 5049, 5617, 6170, 6704, 7224, 7725, 8212, 8684, 9142, 
-    9586, 10018, 10438, 10846, 11241, 11625, 11996, 12352, 12699, 13029, 13348, 13648, 13934, 14202, 14451, 14682, 
-    14889, 15076, 15241, 15382, 15501, 15594, 15669, 15716, 15744, 15749, 15734, 15698, 15642, 15568, 15477, 15366, 
-    15242, 15100, 14943, 14772, 14584, 14383, 14164, 13929, 13677, 13405, 13115, 12801, 12469, 12110, 11731, 11325, 
-    10896, 10441, 9962, 9460, 8930, 8384, 7810, 7223, 6611, 5989, 5349, 4699, 4037, 3368, 2691, 2010, 
-    1324, 640, -44, -726, -1407, -2079, -2747, -3406, -4058, -4699, -5331, -5952, -6560, -7155, -7736, -8302, 
-    -8850, -9382, -9895, -10387, -10855, -11301, -11720, -12114, -12478, -12815, -13120, -13394, -13638, -13852, -14033, -14184, 
-    -14308, -14402, -14472, -14515, -14537, -14536, -14516, -14475, -14421, -14348, -14265, -14166, -14060, -13940, -13811, -13670, 
-    -13522, -13357, -13182, -12991, -12786, -12562, -12321, -12057, -11771, -11461, -11127, -10767, -10379, -9967, -9533, -9073, 
-    -8594, -8092, -7577, -7043, -6500, -5942, -5382, -4812, -4243, -3670, -3103, -2537, -1979, -1425, -881, -343, 
-    180, 700, 1206, 1708, 2198, 2683, 3163, 3634, 4105, 4567, 5032, 5488, 5944, 6393, 6842, 7282, 
-    7717, 8143, 8563, 8971, 9368, 9751, 10121, 10473, 10810, 11126, 11424, 11699, 11952, 12182, 12388, 12571, 
-    12725, 12859, 12963, 13047, 13103, 13137, 13146, 13134, 13099, 13042, 12966, 12870, 12756, 12620, 12469, 12300, 
-    12118, 11917, 11705, 11475, 11233, 10975, 10704, 10419, 10119, 9804, 9477, 9136, 8779, 8409, 8024, 7627, 
-    7213, 6788, 6349, 5897, 5433, 4956, 4470, 3971, 3464, 2947, 2425, 1896, 1364, 830, 294, -240, 
-    -773, -1303, -1828, -2349, -2861, -3367, -3864, -4351, -4827, -5291, -5744, -6185, -6611, -7023, -7422, -7804, 
-    -8174, -8527, -8867, -9192, -9503, -9801, -10085, -10358, -10620, -10868, -11105, -11330, -11543, -11746, -11935, -12116, 
-    -12281, -12438, -12579, -12709, -12822, -12924, -13008, -13076, -13125, -13159, -13169, -13162, -13131, -13079, -12999, -12900, 
-    -12771, -12620, -12440, -12234, -12004, -11743, -11459, -11141, -10805, -10435, -10045, -9628, -9188, -8726, -8241, -7743, 
-    -7223, -6693, -6150, -5600, -5041, -4483, -3920, -3364, -2806, -2264, -1720, -1196, -673, -172, 325, 805, 
-    1278, 1737, 2185, 2625, 3055, 3479, 3898, 4311, 4725, 5131, 5539, 5940, 6347, 6742, 7140, 7529, 
-    7914, 8288, 8653, 9007, 9347, 9671, 9976, 10264, 10529, 10776, 11000, 11201, 11380, 11537, 11673, 11786, 
-    11881, 11953, 12011, 12049, 12075, 12084, 12085, 12072, 12051, 12020, 11982, 11937, 11883, 11827, 11763, 11695, 
-    11621, 11542, 11458, 11365, 11268, 11159, 11045, 10917, 10781, 10630, 10466, 10284, 10088, 9872, 9639, 9381, 
-    9105, 8804, 8481, 8134, 7764, 7369, 6954, 6514, 6056, 5576, 5079, 4566, 4038, 3497, 2947, 2389, 
-    1825, 1259, 690, 127, -437, -991, -1540, -2080, -2610, -3129, -3633, -4128, -4606, -5072, -5523, -5958, 
-    -6380, -6787, -7178, -7553, -7915, -8264, -8595, -8915, -9221, -9515, -9795, -10063, -10321, -10563, -10797, -11015, 
-    -11225, -11419, -11602, -11769, -11922, -12061, -12182, -12290, -12380, -12454, -12512, -12550, -12575, -12577, -12565, -12528, 
-    -12478, -12403, -12313, -12199, -12071, -11921, -11757, -11573, -11376, -11163, -10935, -10695, -10439, -10173, -9889, -9600, 
-    -9292, -8979, -8647, -8312, -7963, -7611, -7246, -6881, -6505, -6133, -5750, -5373, -4986, -4606, -4220, -3838, 
-    -3454, -3072, -2690, -2309, -1928, -1549, -1166, -788, -405, -27, 355, 735, 1117, 1496, 1877, 2254, 
-    2630, 3001, 3368, 3729, 4084, 4431, 4769, 5097, 5416, 5725, 6021, 6307, 6579, 6841, 7090, 7327, 
-    7556, 7770, 7981, 8177, 8372, 8551, 8732, 8898, 9065, 9216, 9369, 9506, 9644, 9763, 9880, 9983, 
-    10076, 10156, 10221, 10275, 10310, 10332, 10333, 10319, 10285, 10234, 10160, 10071, 9958, 9830, 9678, 9511, 
-    9324, 9123, 8907, 8679, 8440, 8191, 7934, 7672, 7404, 7136, 6863, 6593, 6320, 6050, 5781, 5515, 
-    5248, 4983, 4719, 4457, 4191, 3927, 3660, 3392, 3117, 2842, 2561, 2274, 1983, 1687, 1383, 1078, 
-    765, 452, 133, -182, -499, -813, -1122, -1425, -1721, -2007, -2283, -2547, -2802, -3041, -3268, -3482, 
-    -3683, -3872, -4046, -4210, -4360, -4501, -4632, -4750, -4863, -4963, -5063, -5148, -5233, -5306, -5380, -5441, 
-    -5502, -5553, -5602, -5640, -5675, -5701, -5720, -5731, -5736, -5734, -5722, -5707, -5684, -5657, -5626, -5590, 
-    -5552, -5512, -5472, -5430, -5388, -5344, -5303, -5255, -5215, -5164, -5121, -5069, -5021, -4968, -4912, -4855, 
-    -4791, -4729, -4657, -4588, -4509, -4433, -4348, -4265, -4175, -4086, -3993, -3901, -3807, -3712, -3618, -3524, 
-    -3430, -3337, -3244, -3154, -3064, -2973, -2886, -2798, -2712, -2623, -2536, -2447, -2356, -2263, -2167, -2069, 
-    -1965, -1860, -1750, -1637, -1519, -1397, -1272, -1142, -1008, -872, -731, -586, -441, -292, -143, 8, 
-    156, 306, 453, 596, 735, 869, 998, 1119, 1236, 1345, 1449, 1543, 1634, 1715, 1793, 1862, 
-    1927, 1986, 2043, 2094, 2145, 2192, 2240, 2284, 2330, 2375, 2422, 2466, 2514, 2560, 2609, 2657, 
-    2708, 2757, 2806, 2853, 2902, 2946, 2994, 3034, 3080, 3117, 3163, 3198, 3239, 3276, 3316, 3352, 
-    3389, 3429, 3467, 3507, 3550, 3593, 3642, 3692, 3748, 3807, 3873, 3941, 4017, 4097, 4183, 4272, 
-    4367, 4463, 4560, 4657, 4753, 4843, 4934, 5015, 5093, 5158, 5220, 5266, 5306, 5329, 5344, 5341, 
-    5328, 5299, 5256, 5203, 5131, 5052, 4956, 4854, 4735, 4611, 4473, 4330, 4176, 4019, 3850, 3682, 
-    3502, 3324, 3138, 2950, 2757, 2563, 2366, 2167, 1966, 1765, 1562, 1360, 1157, 955, 753, 556, 
-    357, 164, -29, -216, -405, -587, -768, -942, -1117, -1283, -1446, -1604, -1758, -1905, -2049, -2185, 
-    -2320, -2446, -2568, -2686, -2797, -2905, -3006, -3102, -3195, -3282, -3368, -3447, -3526, -3601, -3677, -3751, 
-    -3826, -3902, -3980, -4060, -4145, -4231, -4327, -4420, -4528, -4631, -4748, -4862, -4986, -5110, -5239, -5371, 
-    -5504, -5637, -5770, -5902, -6031, -6156, -6275, -6391, -6498, -6599, -6688, -6771, -6844, -6905, -6955, -6993, 
-    -7019, -7032, -7029, -7014, -6983, -6938, -6877, -6801, -6708, -6599, -6472, -6330, -6171, -5995, -5806, -5601, 
-    -5382, -5149, -4907, -4649, -4385, -4110, -3831, -3547, -3259, -2969, -2678, -2391, -2104, -1822, -1544, -1274, 
-    -1011, -752, -502, -260, -24, 207, 430, 649, 863, 1073, 1282, 1487, 1692, 1894, 2098, 2299, 
-    2502, 2704, 2905, 3105, 3302, 3500, 3692, 3883, 4065, 4247, 4417, 4585, 4740, 4892, 5031, 5162, 
-    5287, 5399, 5508, 5603, 5700, 5783, 5867, 5943, 6021, 6093, 6167, 6238, 6313, 6384, 6461, 6534, 
-    6611, 6685, 6761, 6836, 6908, 6980, 7049, 7114, 7175, 7230, 7281, 7322, 7357, 7382, 7397, 7401, 
-    7393, 7371, 7336, 7288, 7223, 7145, 7050, 6943, 6814, 6676, 6515, 6345, 6153, 5951, 5731, 5498, 
-    5252, 4992, 4722, 4442, 4152, 3855, 3551, 3241, 2929, 2610, 2292, 1970, 1649, 1328, 1005, 690, 
-    372, 62, -245, -546, -843, -1132, -1413, -1687, -1952, -2206, -2451, -2684, -2908, -3120, -3318, -3506, 
-    -3679, -3843, -3989, -4128, -4248, -4360, -4458, -4546, -4622, -4686, -4745, -4792, -4835, -4867, -4897, -4920, 
-    -4941, -4958, -4972, -4986, -4995, -5008, -5014, -5023, -5028, -5035, -5039, -5042, -5042, -5042, -5038, -5033, 
-    -5020, -5008, -4988, -4965, -4935, -4898, -4856, -4805, -4747, -4682, -4608, -4529, -4440, -4348, -4248, -4142, 
-    -4036, -3923, -3812, -3696, -3585, -3474, -3365, -3256, -3157, -3055, -2964, -2870, -2788, -2703, -2626, -2549, 
-    -2477, -2401, -2330, -2254, -2181, -2099, -2018, -1926, -1835, -1731, -1622, -1503, -1379, -1243, -1102, -953, 
-    -799, -639, -477, -311, -147, 16, 177, 335, 487, 633, 773, 903, 1023, 1139, 1238, 1332, 
-    1410, 1487, 1545, 1600, 1642, 1680, 1706, 1728, 1742, 1751, 1755, 1754, 1750, 1741, 1731, 1716, 
-    1700, 1682, 1661, 1641, 1618, 1596, 1573, 1553, 1532, 1515, 1500, 1488, 1480, 1475, 1477, 1479, 
-    1489, 1504, 1521, 1548, 1571, 1609, 1639, 1684, 1721, 1771, 1813, 1864, 1910, 1961, 2006, 2053, 
-    2096, 2137, 2177, 2211, 2245, 2273, 2303, 2329, 2353, 2377, 2401, 2426, 2452, 2479, 2510, 2544, 
-    2579, 2622, 2665, 2715, 2766, 2822, 2881, 2940, 3003, 3063, 3125, 3182, 3238, 3289, 3334, 3373, 
-    3404, 3428, 3444, 3450, 3451, 3438, 3423, 3395, 3366, 3326, 3281, 3233, 3177, 3122, 3060, 2999, 
-    2934, 2872, 2807, 2747, 2682, 2625, 2564, 2508, 2450, 2399, 2345, 2295, 2244, 2196, 2148, 2100, 
-    2054, 2005, 1959, 1906, 1858, 1801, 1748, 1685, 1627, 1557, 1490, 1410, 1333, 1243, 1152, 1051, 
-    948, 833, 714, 587, 455, 313, 163, 9, -154, -323, -500, -680, -870, -1063, -1259, -1461, 
-    -1664, -1872, -2076, -2285, -2490, -2697, -2900, -3103, -3302, -3499, -3693, -3884, -4069, -4253, -4428, -4602, 
-    -4766, -4928, -5081, -5231, -5373, -5511, -5641, -5766, -5888, -6002, -6113, -6217, -6321, -6413, -6509, -6594, 
-    -6678, -6753, -6827, -6894, -6954, -7009, -7055, -7095, -7124, -7146, -7155, -7152, -7139, -7112, -7071, -7016, 
-    -6946, -6860, -6759, -6642, -6511, -6362, -6202, -6025, -5837, -5635, -5425, -5202, -4974, -4736, -4496, -4249, 
-    -4002, -3752, -3500, -3251, -3000, -2755, -2508, -2268, -2027, -1793, -1560, -1332, -1108, -886, -670, -456, 
-    -247, -38, 165, 369, 569, 772, 971, 1173, 1373, 1578, 1783, 1994, 2207, 2428, 2652, 2886, 
-    3126, 3372, 3632, 3894, 4173, 4450, 4745, 5035, 5343, 5643, 5957, 6263, 6575, 6880, 7185, 7481, 
-    7769, 8050, 8320, 8579, 8824, 9057, 9273, 9477, 9661, 9833, 9984, 10122, 10242, 10344, 10433, 10500, 
-    10555, 10588, 10612, 10613, 10604, 10573, 10532, 10468, 10395, 10301, 10194, 10069, 9930, 9774, 9604, 9420, 
-    9221, 9009, 8786, 8548, 8299, 8038, 7765, 7481, 7186, 6880, 6562, 6237, 5897, 5549, 5192, 4827, 
-    4449, 4068, 3674, 3280, 2873, 2468, 2052, 1640, 1223, 806, 389, -24, -434, -843, -1245, -1641, 
-    -2032, -2415, -2792, -3161, -3523, -3877, -4224, -4566, -4897, -5228, -5545, -5866, -6173, -6485, -6784, -7085, 
-    -7378, -7669, -7952, -8233, -8507, -8773, -9034, -9285, -9530, -9761, -9987, -10197, -10399, -10584, -10759, -10918, 
-    -11063, -11192, -11308, -11407, -11490, -11559, -11609, -11646, -11664, -11671, -11655, -11631, -11584, -11528, -11453, -11365, 
-    -11260, -11143, -11008, -10860, -10696, -10520, -10326, -10119, -9898, -9663, -9414, -9152, -8878, -8592, -8294, -7987, 
-    -7668, -7341, -7002, -6657, -6301, -5938, -5565, -5187, -4799, -4404, -4004, -3594, -3180, -2755, -2329, -1891, 
-    -1451, -1003, -551, -95, 367, 830, 1300, 1766, 2238, 2707, 3176, 3645, 4105, 4567, 5018, 5466, 
-    5903, 6332, 6749, 7157, 7550, 7931, 8296, 8650, 8985, 9307, 9610, 9901, 10170, 10427, 10661, 10885, 
-    11084, 11270, 11435, 11584, 11713, 11825, 11918, 11995, 12053, 12093, 12117, 12124, 12115, 12090, 12050, 11996, 
-    11925, 11842, 11742, 11632, 11503, 11367, 11210, 11046, 10863, 10669, 10460, 10238, 10002, 9751, 9487, 9208, 
-    8919, 8612, 8296, 7966, 7627, 7274, 6916, 6546, 6171, 5788, 5403, 5012, 4619, 4223, 3829, 3432, 
-    3039, 2643, 2251, 1858, 1468, 1080, 690, 304, -85, -468, -858, -1244, -1631, -2017, -2405, -2790, 
-    -3175, -3556, -3937, -4311, -4682, -5045, -5404, -5751, -6092, -6419, -6738, -7041, -7332, -7608, -7870, -8118, 
-    -8348, -8566, -8765, -8952, -9122, -9279, -9422, -9551, -9667, -9771, -9863, -9943, -10013, -10071, -10116, -10154, 
-    -10178, -10192, -10193, -10183, -10161, -10124, -10075, -10010, -9933, -9838, -9727, -9602, -9457, -9301, -9122, -8936, 
-    -8725, -8507, -8268, -8021, -7756, -7482, -7196, -6900, -6596, -6284, -5963, -5639, -5307, -4975, -4634, -4296, 
-    -3951, -3609, -3263, -2919, -2573, -2229, -1887, -1545, -1206, -870, -536, -206, 119, 439, 756, 1067, 
-    1373, 1673, 1968, 2256, 2538, 2815, 3084, 3350, 3608, 3862, 4108, 4349, 4585, 4814, 5039, 5254, 
-    5466, 5669, 5870, 6059, 6245, 6420, 6588, 6748, 6898, 7037, 7168, 7283, 7391, 7481, 7563, 7630, 
-    7683, 7723, 7748, 7760, 7760, 7743, 7718, 7674, 7624, 7557, 7482, 7393, 7296, 7188, 7070, 6944, 
-    6810, 6668, 6518, 6362, 6199, 6028, 5853, 5670, 5484, 5289, 5092, 4886, 4678, 4462, 4244, 4020, 
-    3791, 3558, 3321, 3079, 2833, 2584, 2327, 2069, 1806, 1539, 1270, 994, 722, 440, 164, -115, 
-    -392, -671, -944, -1215, -1481, -1741, -1993, -2238, -2473, -2698, -2912, -3113, -3301, -3478, -3639, -3788, 
-    -3923, -4044, -4152, -4246, -4327, -4397, -4453, -4500, -4536, -4563, -4581, -4591, -4598, -4592, -4587, -4572, 
-    -4557, -4535, -4513, -4485, -4457, -4423, -4391, -4353, -4318, -4274, -4234, -4185, -4137, -4083, -4027, -3963, 
-    -3896, -3822, -3741, -3654, -3556, -3454, -3341, -3222, -3090, -2956, -2809, -2659, -2500, -2339, -2171, -2002, 
-    -1830, -1659, -1488, -1318, -1151, -987, -829, -674, -525, -382, -244, -114, 13, 131, 247, 358, 
-    463, 568, 665, 767, 860, 958, 1053, 1150, 1246, 1345, 1442, 1545, 1644, 1747, 1848, 1950, 
-    2052, 2151, 2250, 2345, 2435, 2523, 2602, 2678, 2743, 2802, 2850, 2888, 2916, 2932, 2936, 2928, 
-    2909, 2878, 2835, 2782, 2718, 2645, 2562, 2473, 2377, 2275, 2169, 2059, 1946, 1833, 1717, 1604, 
-    1487, 1374, 1262, 1152, 1043, 936, 831, 727, 626, 523, 427, 324, 230, 130, 36, -61, 
-    -154, -247, -340, -429, -518, -602, -687, -764, -842, -911, -981, -1042, -1103, -1155, -1206, -1250, 
-    -1290, -1327, -1356, -1385, -1407, -1427, -1441, -1453, -1460, -1465, -1464, -1462, -1455, -1447, -1433, -1419, 
-    -1401, -1382, -1358, -1332, -1303, -1273, -1238, -1202, -1160, -1119, -1070, -1021, -967, -910, -848, -784, 
-    -717, -647, -574, -499, -421, -342, -263, -180, -98, -15, 64, 149, 229, 312, 390, 471, 
-    547, 626, 700, 777, 849, 925, 998, 1074, 1147, 1221, 1295, 1367, 1438, 1510, 1576, 1643, 
-    1702, 1761, 1810, 1856, 1896, 1926, 1951, 1966, 1975, 1977, 1970, 1958, 1937, 1914, 1885, 1848, 
-    1815, 1774, 1737, 1694, 1657, 1617, 1580, 1543, 1509, 1476, 1445, 1413, 1382, 1350, 1317, 1281, 
-    1241, 1196, 1148, 1091, 1028, 958, 879, 793, 699, 599, 488, 374, 252, 127, -2, -134, 
-    -268, -402, -538, -669, -802, -929, -1056, -1175, -1292, -1402, -1510, -1611, -1708, -1798, -1886, -1967, 
-    -2046, -2119, -2189, -2255, -2320, -2381, -2439, -2496, -2551, -2600, -2651, -2694, -2740, -2772, -2810, -2834, 
-    -2860, -2875, -2887, -2892, -2891, -2882, -2870, -2844, -2818, -2778, -2736, -2682, -2622, -2557, -2480, -2398, 
-    -2309, -2214, -2113, -2004, -1893, -1775, -1654, -1529, -1399, -1268, -1131, -995, -855, -714, -571, -427, 
-    -282, -136, 9, 155, 300, 446, 590, 733, 875, 1016, 1156, 1294, 1429, 1565, 1696, 1827, 
-    1951, 2074, 2195, 2310, 2424, 2530, 2636, 2734, 2830, 2919, 3005, 3084, 3160, 3228, 3293, 3351, 
-    3404, 3451, 3492, 3526, 3555, 3577, 3593, 3602, 3604, 3601, 3590, 3571, 3549, 3516, 3483, 3436, 
-    3391, 3334, 3278, 3211, 3144, 3069, 2993, 2911, 2827, 2739, 2647, 2553, 2455, 2355, 2251, 2145, 
-    2037, 1927, 1814, 1700, 1585, 1468, 1348, 1229, 1106, 985, 857, 732, 599, 470, 332, 194, 
-    50, -93, -244, -397, -554, -714, -878, -1045, -1216, -1388, -1564, -1740, -1920, -2096, -2276, -2450, 
-    -2628, -2797, -2967, -3128, -3289, -3439, -3585, -3721, -3853, -3974, -4087, -4191, -4287, -4375, -4451, -4523, 
-    -4583, -4637, -4679, -4719, -4745, -4767, -4778, -4784, -4777, -4766, -4744, -4715, -4677, -4631, -4578, -4511, 
-    -4444, -4359, -4273, -4173, -4068, -3951, -3824, -3691, -3545, -3391, -3229, -3055, -2875, -2684, -2489, -2283, 
-    -2074, -1858, -1637, -1413, -1185, -957, -727, -499, -269, -45, 177, 394, 606, 814, 1014, 1211, 
-    1396, 1580, 1752, 1927, 2087, 2252, 2405, 2563, 2710, 2864, 3007, 3157, 3298, 3446, 3584, 3728, 
-    3865, 4002, 4136, 4266, 4395, 4515, 4635, 4745, 4854, 4952, 5045, 5128, 5204, 5270, 5327, 5372, 
-    5412, 5434, 5452, 5454, 5450, 5429, 5403, 5362, 5312, 5252, 5182, 5102, 5013, 4915, 4811, 4697, 
-    4579, 4453, 4324, 4189, 4050, 3909, 3762, 3618, 3464, 3315, 3158, 3003, 2843, 2681, 2519, 2349, 
-    2177, 2002, 1821, 1635, 1442, 1246, 1040, 832, 615, 392, 164, -70, -306, -552, -798, -1050, 
-    -1301, -1556, -1808, -2063, -2312, -2563, -2806, -3047, -3283, -3512, -3733, -3947, -4154, -4351, -4539, -4718, 
-    -4886, -5045, -5191, -5330, -5456, -5574, -5678, -5774, -5857, -5933, -5996, -6050, -6094, -6129, -6155, -6170, 
-    -6178, -6177, -6167, -6150, -6123, -6087, -6044, -5992, -5931, -5860, -5780, -5690, -5591, -5478, -5358, -5225, 
-    -5083, -4927, -4763, -4588, -4401, -4205, -4000, -3783, -3562, -3327, -3093, -2845, -2599, -2342, -2088, -1827, 
-    -1569, -1308, -1048, -789, -533, -280, -26, 218, 464, 702, 940, 1170, 1398, 1619, 1841, 2051, 
-    2265, 2469, 2677, 2874, 3075, 3268, 3465, 3652, 3843, 4026, 4211, 4388, 4566, 4736, 4905, 5067, 
-    5224, 5375, 5516, 5653, 5777, 5895, 6000, 6096, 6179, 6253, 6311, 6360, 6394, 6418, 6428, 6427, 
-    6415, 6391, 6354, 6309, 6250, 6185, 6102, 6017, 5914, 5808, 5688, 5562, 5424, 5278, 5126, 4962, 
-    4795, 4615, 4433, 4241, 4044, 3841, 3630, 3419, 3195, 2973, 2740, 2508, 2267, 2025, 1776, 1522, 
-    1266, 1006, 742, 472, 200, -72, -351, -631, -914, -1196, -1479, -1761, -2039, -2316, -2585, -2851, 
-    -3109, -3360, -3600, -3831, -4051, -4259, -4454, -4637, -4805, -4960, -5101, -5230, -5344, -5444, -5536, -5610, 
-    -5680, -5730, -5779, -5812, -5842, -5859, -5872, -5875, -5875, -5865, -5852, -5831, -5804, -5771, -5731, -5686, 
-    -5630, -5569, -5497, -5420, -5330, -5234, -5127, -5013, -4886, -4754, -4610, -4460, -4301, -4135, -3963, -3781, 
-    -3597, -3405, -3211, -3012, -2808, -2603, -2395, -2185, -1972, -1761, -1545, -1330, -1112, -894, -674, -451, 
-    -227, 1, 228, 461, 693, 930, 1166, 1405, 1643, 1884, 2122, 2362, 2595, 2832, 3059, 3288, 
-    3506, 3724, 3929, 4135, 4325, 4517, 4690, 4864, 5021, 5174, 5315, 5446, 5570, 5679, 5780, 5870, 
-    5949, 6018, 6073, 6118, 6150, 6170, 6176, 6169, 6151, 6115, 6067, 6003, 5926, 5834, 5726, 5607, 
-    5473, 5326, 5167, 4997, 4818, 4627, 4431, 4224, 4014, 3796, 3576, 3348, 3121, 2889, 2659, 2422, 
-    2190, 1953, 1720, 1484, 1250, 1015, 782, 549, 318, 85, -141, -372, -597, -823, -1046, -1268, 
-    -1488, -1703, -1917, -2125, -2331, -2532, -2728, -2920, -3107, -3289, -3466, -3636, -3801, -3961, -4116, -4262, 
-    -4406, -4540, -4672, -4793, -4912, -5021, -5126, -5223, -5312, -5395, -5469, -5539, -5597, -5652, -5695, -5734, 
-    -5761, -5783, -5794, -5798, -5792, -5777, -5753, -5718, -5675, -5621, -5557, -5481, -5395, -5299, -5191, -5073, 
-    -4943, -4803, -4650, -4486, -4313, -4126, -3933, -3723, -3508, -3280, -3044, -2797, -2543, -2280, -2008, -1730, 
-    -1446, -1157, -861, -564, -262, 42, 346, 654, 957, 1262, 1563, 1863, 2156, 2447, 2732, 3010, 
-    3281, 3546, 3802, 4051, 4289, 4521, 4741, 4953, 5154, 5345, 5528, 5698, 5860, 6010, 6150, 6279, 
-    6398, 6503, 6600, 6682, 6758, 6818, 6871, 6908, 6938, 6956, 6959, 6955, 6936, 6909, 6865, 6814, 
-    6747, 6671, 6580, 6479, 6365, 6237, 6100, 5947, 5785, 5609, 5424, 5226, 5020, 4803, 4579, 4346, 
-    4106, 3858, 3607, 3351, 3090, 2826, 2560, 2295, 2024, 1756, 1486, 1216, 945, 675, 406, 131, 
-    -138, -413, -688, -968, -1245, -1528, -1811, -2097, -2382, -2670, -2956, -3242, -3526, -3807, -4082, -4354, 
-    -4616, -4873, -5117, -5354, -5577, -5789, -5987, -6174, -6346, -6505, -6651, -6786, -6908, -7018, -7118, -7209, 
-    -7290, -7364, -7429, -7488, -7540, -7586, -7626, -7658, -7686, -7702, -7714, -7715, -7705, -7685, -7651, -7608, 
-    -7544, -7472, -7379, -7272, -7145, -7006, -6846, -6670, -6478, -6271, -6047, -5810, -5559, -5297, -5021, -4739, 
-    -4444, -4145, -3835, -3523, -3204, -2882, -2556, -2227, -1895, -1560, -1225, -885, -545, -202, 141, 487, 
-    837, 1185, 1536, 1887, 2239, 2590, 2940, 3287, 3632, 3974, 4310, 4639, 4961, 5275, 5579, 5874, 
-    6156, 6427, 6684, 6929, 7160, 7376, 7579, 7766, 7942, 8098, 8248, 8376, 8498, 8599, 8695, 8770, 
-    8840, 8891, 8937, 8963, 8981, 8984, 8977, 8953, 8918, 8868, 8804, 8726, 8633, 8527, 8404, 8267, 
-    8115, 7947, 7767, 7569, 7360, 7135, 6899, 6649, 6389, 6117, 5836, 5546, 5249, 4942, 4629, 4313, 
-    3988, 3662, 3330, 2998, 2661, 2322, 1983, 1639, 1298, 952, 608, 261, -86, -433, -783, -1132, 
-    -1479, -1830, -2175, -2524, -2864, -3208, -3544, -3878, -4205, -4529, -4843, -5153, -5451, -5741, -6021, -6289, 
-    -6548, -6792, -7026, -7245, -7453, -7646, -7829, -7995, -8150, -8292, -8420, -8535, -8637, -8729, -8805, -8872, 
-    -8925, -8966, -8994, -9013, -9016, -9012, -8992, -8964, -8921, -8871, -8804, -8731, -8643, -8547, -8437, -8316, 
-    -8186, -8042, -7888, -7722, -7545, -7357, -7156, -6946, -6722, -6489, -6242, -5987, -5718, -5441, -5151, -4853, 
-    -4543, -4227, -3897, -3562, -3216, -2864, -2502, -2137, -1764, -1387, -1006, -621, -234, 155, 543, 934, 
-    1323, 1711, 2096, 2479, 2858, 3234, 3603, 3968, 4328, 4680, 5028, 5364, 5695, 6017, 6331, 6632, 
-    6927, 7208, 7481, 7739, 7986, 8221, 8440, 8646, 8835, 9011, 9168, 9308, 9430, 9536, 9621, 9687, 
-    9734, 9761, 9769, 9755, 9725, 9671, 9604, 9514, 9410, 9287, 9150, 8997, 8830, 8650, 8459, 8254, 
-    8041, 7818, 7586, 7345, 7097, 6843, 6580, 6312, 6037, 5756, 5469, 5174, 4875, 4567, 4256, 3936, 
-    3611, 3279, 2943, 2600, 2252, 1899, 1543, 1185, 824, 462, 101, -258, -614, -969, -1318, -1661, 
-    -1998, -2327, -2650, -2961, -3267, -3560, -3845, -4122, -4385, -4644, -4890, -5132, -5361, -5588, -5802, -6015, 
-    -6217, -6419, -6608, -6800, -6977, -7158, -7324, -7491, -7645, -7796, -7934, -8067, -8187, -8297, -8394, -8481, 
-    -8552, -8610, -8654, -8683, -8694, -8692, -8673, -8639, -8585, -8519, -8435, -8338, -8222, -8094, -7949, -7793, 
-    -7619, -7436, -7238, -7029, -6807, -6575, -6333, -6079, -5818, -5545, -5266, -4976, -4681, -4377, -4066, -3749, 
-    -3426, -3098, -2764, -2425, -2084, -1737, -1389, -1038, -685, -333, 23, 374, 730, 1080, 1429, 1774, 
-    2115, 2451, 2781, 3104, 3420, 3726, 4025, 4315, 4591, 4862, 5118, 5365, 5600, 5824, 6034, 6232, 
-    6420, 6592, 6752, 6898, 7033, 7150, 7256, 7347, 7425, 7487, 7537, 7572, 7594, 7603, 7597, 7582, 
-    7551, 7512, 7459, 7397, 7325, 7244, 7154, 7056, 6951, 6839, 6720, 6595, 6464, 6327, 6185, 6035, 
-    5881, 5719, 5554, 5377, 5199, 5008, 4813, 4608, 4397, 4179, 3952, 3719, 3479, 3234, 2981, 2727, 
-    2466, 2203, 1937, 1668, 1399, 1129, 859, 588, 319, 51, -217, -483, -750, -1014, -1280, -1543, 
-    -1806, -2070, -2332, -2594, -2855, -3116, -3376, -3633, -3889, -4140, -4391, -4630, -4872, -5098, -5325, -5533, 
-    -5738, -5926, -6105, -6268, -6419, -6551, -6670, -6770, -6857, -6924, -6974, -7011, -7027, -7030, -7015, -6989, 
-    -6945, -6888, -6821, -6738, -6647, -6541, -6430, -6305, -6175, -6035, -5887, -5733, -5569, -5400, -5221, -5039, 
-    -4847, -4649, -4445, -4235, -4020, -3798, -3571, -3340, -3102, -2865, -2620, -2375, -2126, -1875, -1624, -1371, 
-    -1119, -865, -613, -360, -110, 139, 385, 631, 874, 1114, 1351, 1587, 1818, 2047, 2271, 2494, 
-    2710, 2925, 3131, 3335, 3530, 3721, 3902, 4077, 4242, 4398, 4547, 4682, 4812, 4925, 5035, 5127, 
-    5213, 5286, 5352, 5404, 5448, 5481, 5507, 5522, 5529, 5527, 5518, 5500, 5477, 5444, 5406, 5360, 
-    5308, 5247, 5181, 5108, 5026, 4938, 4843, 4739, 4628, 4509, 4383, 4247, 4107, 3956, 3798, 3632, 
-    3460, 3282, 3094, 2905, 2706, 2510, 2300, 2098, 1883, 1676, 1460, 1251, 1037, 829, 619, 414, 
-    210, 11, -186, -376, -567, -750, -934, -1111, -1288, -1460, -1631, -1801, -1969, -2136, -2302, -2469, 
-    -2634, -2798, -2962, -3122, -3284, -3437, -3595, -3740, -3888, -4022, -4156, -4276, -4391, -4492, -4586, -4665, 
-    -4734, -4788, -4829, -4856, -4871, -4872, -4860, -4835, -4801, -4752, -4698, -4629, -4558, -4473, -4386, -4290, 
-    -4192, -4087, -3980, -3866, -3752, -3634, -3512, -3387, -3258, -3127, -2992, -2854, -2711, -2565, -2414, -2259, 
-    -2100, -1934, -1767, -1593, -1416, -1234, -1047, -861, -668, -477, -281, -88, 106, 300, 492, 681, 
-    868, 1051, 1229, 1402, 1569, 1731, 1885, 2032, 2173, 2307, 2433, 2550, 2664, 2767, 2866, 2954, 
-    3040, 3115, 3188, 3252, 3311, 3366, 3412, 3456, 3493, 3526, 3552, 3574, 3590, 3602, 3606, 3607, 
-    3600, 3588, 3569, 3546, 3514, 3478, 3435, 3386, 3330, 3268, 3201, 3127, 3047, 2961, 2870, 2772, 
-    2671, 2561, 2450, 2331, 2211, 2084, 1956, 1822, 1687, 1550, 1408, 1266, 1120, 977, 830, 683, 
-    538, 392, 248, 103, -37, -177, -315, -450, -582, -712, -839, -962, -1082, -1201, -1314, -1426, 
-    -1534, -1641, -1741, -1842, -1937, -2030, -2120, -2205, -2287, -2366, -2440, -2511, -2575, -2635, -2690, -2738, 
-    -2783, -2817, -2848, -2871, -2889, -2896, -2900, -2892, -2882, -2859, -2835, -2797, -2757, -2707, -2652, -2591, 
-    -2523, -2450, -2372, -2290, -2203, -2111, -2018, -1919, -1821, -1716, -1614, -1505, -1399, -1290, -1179, -1070, 
-    -956, -847, -732, -621, -507, -395, -282, -168, -56, 57, 171, 286, 399, 515, 628, 743, 
-    854, 969, 1079, 1190, 1297, 1404, 1509, 1611, 1709, 1806, 1898, 1988, 2073, 2156, 2232, 2305, 
-    2375, 2437, 2498, 2550, 2600, 2642, 2678, 2710, 2733, 2755, 2765, 2773, 2772, 2765, 2754, 2732, 
-    2710, 2675, 2640, 2593, 2547, 2489, 2432, 2364, 2297, 2221, 2144, 2062, 1979, 1888, 1799, 1706, 
-    1610, 1512, 1410, 1310, 1202, 1094, 984, 869, 754, 632, 509, 381, 251, 118, -20, -160, 
-    -306, -450, -601, -749, -904, -1053, -1208, -1357, -1509, -1655, -1801, -1944, -2081, -2215, -2341, -2465, 
-    -2580, -2690, -2794, -2893, -2982, -3069, -3145, -3220, -3284, -3347, -3402, -3451, -3497, -3538, -3575, -3604, 
-    -3632, -3652, -3671, -3679, -3688, -3685, -3684, -3667, -3651, -3623, -3591, -3547, -3498, -3438, -3370, -3293, 
-    -3204, -3108, -2999, -2884, -2756, -2621, -2475, -2321, -2160, -1990, -1815, -1633, -1446, -1255, -1061, -861, 
-    -663, -459, -261, -56, 144, 344, 542, 742, 936, 1129, 1317, 1506, 1688, 1869, 2046, 2219, 
-    2389, 2555, 2716, 2876, 3028, 3180, 3322, 3466, 3598, 3732, 3854, 3978, 4088, 4198, 4298, 4394, 
-    4480, 4562, 4634, 4700, 4758, 4808, 4851, 4885, 4911, 4930, 4940, 4941, 4934, 4918, 4895, 4862, 
-    4822, 4771, 4717, 4649, 4578, 4496, 4409, 4312, 4210, 4100, 3984, 3862, 3732, 3599, 3457, 3314, 
-    3162, 3007, 2847, 2684, 2514, 2342, 2165, 1987, 1801, 1617, 1423, 1232, 1033, 835, 631, 427, 
-    216, 10, -205, -416, -635, -849, -1071, -1286, -1507, -1724, -1944, -2159, -2374, -2588, -2797, -3006, 
-    -3208, -3409, -3604, -3794, -3979, -4159, -4332, -4500, -4660, -4814, -4960, -5099, -5231, -5354, -5470, -5575, 
-    -5674, -5762, -5842, -5911, -5969, -6019, -6056, -6086, -6099, -6106, -6096, -6080, -6047, -6008, -5951, -5889, 
-    -5810, -5725, -5625, -5520, -5400, -5277, -5142, -5000, -4850, -4694, -4532, -4364, -4189, -4011, -3825, -3638, 
-    -3442, -3245, -3040, -2834, -2620, -2405, -2182, -1959, -1728, -1495, -1256, -1018, -774, -527, -277, -28, 
-    222, 473, 725, 976, 1224, 1471, 1714, 1955, 2190, 2421, 2648, 2867, 3083, 3291, 3496, 3691, 
-    3882, 4067, 4244, 4418, 4583, 4744, 4898, 5047, 5190, 5324, 5455, 5575, 5692, 5797, 5899, 5987, 
-    6070, 6140, 6203, 6253, 6296, 6323, 6342, 6348, 6343, 6326, 6298, 6259, 6208, 6149, 6078, 5999, 
-    5911, 5815, 5710, 5600, 5481, 5361, 5228, 5097, 4955, 4814, 4663, 4512, 4353, 4193, 4024, 3856, 
-    3676, 3498, 3307, 3119, 2916, 2713, 2501, 2285, 2058, 1830, 1591, 1352, 1100, 852, 591, 334, 
-    67, -193, -463, -726, -996, -1257, -1522, -1777, -2033, -2279, -2523, -2755, -2985, -3200, -3413, -3609, 
-    -3804, -3982, -4155, -4315, -4467, -4609, -4742, -4866, -4983, -5090, -5190, -5284, -5370, -5452, -5524, -5595, 
-    -5654, -5715, -5762, -5809, -5846, -5880, -5905, -5925, -5935, -5940, -5933, -5921, -5896, -5863, -5820, -5764, 
-    -5701, -5621, -5535, -5435, -5323, -5204, -5066, -4928, -4768, -4611, -4432, -4257, -4065, -3872, -3669, -3465, 
-    -3253, -3038, -2819, -2600, -2378, -2155, -1932, -1707, -1487, -1261, -1042, -819, -602, -382, -165, 50, 
-    264, 475, 688, 895, 1105, 1309, 1515, 1716, 1916, 2113, 2307, 2499, 2685, 2870, 3046, 3223, 
-    3390, 3554, 3708, 3860, 4000, 4135, 4258, 4377, 4482, 4581, 4667, 4745, 4812, 4871, 4917, 4955, 
-    4982, 5001, 5009, 5009, 5001, 4983, 4960, 4928, 4889, 4845, 4793, 4739, 4675, 4611, 4537, 4462, 
-    4379, 4295, 4203, 4108, 4008, 3903, 3793, 3677, 3557, 3432, 3303, 3166, 3024, 2878, 2728, 2571, 
-    2409, 2244, 2076, 1901, 1725, 1545, 1363, 1178, 992, 805, 615, 426, 236, 45, -143, -332, 
-    -522, -708, -897, -1080, -1268, -1445, -1629, -1806, -1982, -2155, -2324, -2492, -2653, -2812, -2964, -3112, 
-    -3253, -3388, -3516, -3636, -3748, -3850, -3945, -4027, -4102, -4164, -4217, -4257, -4288, -4307, -4315, -4311, 
-    -4297, -4274, -4237, -4195, -4139, -4079, -4006, -3931, -3843, -3754, -3653, -3553, -3442, -3330, -3211, -3091, 
-    -2965, -2835, -2702, -2564, -2426, -2281, -2135, -1984, -1830, -1674, -1513, -1350, -1185, -1017, -845, -673, 
-    -499, -323, -149, 27, 201, 378, 548, 720, 886, 1054, 1212, 1372, 1524, 1673, 1817, 1955, 
-    2091, 2217, 2341, 2458, 2570, 2678, 2777, 2874, 2963, 3047, 3125, 3198, 3264, 3326, 3379, 3429, 
-    3471, 3508, 3537, 3561, 3578, 3587, 3589, 3586, 3573, 3555, 3526, 3493, 3451, 3402, 3344, 3279, 
-    3208, 3130, 3043, 2952, 2853, 2752, 2640, 2530, 2409, 2290, 2164, 2035, 1905, 1771, 1640, 1501, 
-    1369, 1228, 1094, 954, 819, 678, 542, 401, 263, 120, -20, -163, -307, -453, -599, -748, 
-    -897, -1046, -1198, -1348, -1499, -1649, -1799, -1947, -2094, -2237, -2381, -2518, -2653, -2783, -2910, -3031, 
-    -3145, -3255, -3359, -3456, -3547, -3630, -3707, -3778, -3839, -3897, -3942, -3986, -4016, -4045, -4063, -4076, 
-    -4079, -4077, -4067, -4049, -4023, -3991, -3950, -3903, -3846, -3784, -3712, -3635, -3546, -3454, -3352, -3242, 
-    -3127, -3001, -2874, -2732, -2592, -2440, -2287, -2122, -1957, -1784, -1608, -1427, -1242, -1055, -862, -669, 
-    -471, -275, -73, 126, 329, 533, 734, 941, 1141, 1348, 1545, 1749, 1946, 2144, 2337, 2530, 
-    2717, 2902, 3081, 3257, 3425, 3588, 3745, 3894, 4036, 4169, 4295, 4411, 4516, 4614, 4698, 4777, 
-    4841, 4898, 4943, 4980, 5006, 5025, 5032, 5034, 5026, 5012, 4989, 4963, 4928, 4890, 4845, 4797, 
-    4744, 4684, 4623, 4553, 4482, 4402, 4319, 4229, 4132, 4029, 3920, 3803, 3677, 3545, 3403, 3256, 
-    3097, 2935, 2760, 2582, 2394, 2201, 2002, 1797, 1590, 1376, 1163, 946, 730, 510, 295, 79, 
-    -132, -346, -551, -759, -958, -1158, -1351, -1543, -1728, -1914, -2093, -2272, -2444, -2619, -2786, -2956, 
-    -3120, -3286, -3447, -3611, -3769, -3928, -4082, -4236, -4387, -4531, -4676, -4811, -4946, -5069, -5189, -5301, 
-    -5402, -5497, -5580, -5655, -5716, -5769, -5809, -5836, -5853, -5858, -5850, -5829, -5798, -5755, -5699, -5637, 
-    -5559, -5477, -5380, -5280, -5168, -5050, -4925, -4792, -4655, -4510, -4359, -4203, -4039, -3875, -3697, -3522, 
-    -3335, -3148, -2950, -2751, -2545, -2334, -2119, -1897, -1674, -1445, -1214, -978, -742, -502, -263, -20, 
-    218, 462, 698, 939, 1172, 1407, 1634, 1860, 2080, 2297, 2506, 2713, 2912, 3107, 3294, 3477, 
-    3653, 3824, 3988, 4147, 4297, 4445, 4582, 4716, 4842, 4962, 5074, 5180, 5278, 5369, 5452, 5528, 
-    5596, 5655, 5706, 5748, 5783, 5806, 5823, 5827, 5826, 5812, 5792, 5758, 5721, 5670, 5614, 5547, 
-    5474, 5391, 5302, 5205, 5102, 4992, 4874, 4753, 4623, 4489, 4346, 4203, 4048, 3893, 3728, 3562, 
-    3388, 3212, 3026, 2842, 2647, 2455, 2253, 2053, 1845, 1639, 1428, 1216, 1004, 789, 578, 362, 
-    150, -60, -272, -480, -691, -892, -1101, -1297, -1502, -1693, -1893, -2081, -2272, -2456, -2641, -2819, 
-    -2997, -3168, -3338, -3500, -3661, -3813, -3963, -4103, -4241, -4367, -4488, -4600, -4706, -4800, -4885, -4961, 
-    -5028, -5084, -5130, -5167, -5192, -5209, -5215, -5212, -5198, -5177, -5146, -5107, -5059, -5005, -4942, -4874, 
-    -4798, -4716, -4627, -4534, -4437, -4331, -4223, -4107, -3991, -3865, -3737, -3603, -3464, -3322, -3172, -3021, 
-    -2863, -2702, -2535, -2365, -2191, -2015, -1834, -1650, -1465, -1277, -1090, -897, -710, -519, -331, -143, 
-    41, 224, 404, 581, 753, 923, 1084, 1245, 1397, 1547, 1688, 1824, 1956, 2080, 2199, 2311, 
-    2418, 2519, 2615, 2705, 2788, 2870, 2943, 3015, 3079, 3142, 3199, 3252, 3303, 3348, 3392, 3432, 
-    3467, 3500, 3529, 3555, 3577, 3593, 3608, 3616, 3621, 3617, 3613, 3598, 3580, 3553, 3522, 3482, 
-    3436, 3381, 3322, 3253, 3180, 3097, 3011, 2918, 2818, 2715, 2606, 2494, 2376, 2258, 2134, 2010, 
-    1883, 1755, 1625, 1494, 1363, 1233, 1099, 969, 834, 706, 573, 444, 311, 185, 55, -71, 
-    -198, -323, -446, -568, -686, -804, -918, -1029, -1135, -1242, -1338, -1438, -1524, -1615, -1692, -1772, 
-    -1839, -1906, -1962, -2018, -2062, -2106, -2137, -2169, -2186, -2207, -2211, -2218, -2209, -2205, -2185, -2167, 
-    -2138, -2108, -2070, -2030, -1983, -1935, -1882, -1825, -1766, -1704, -1639, -1572, -1503, -1432, -1357, -1282, 
-    -1204, -1125, -1044, -960, -877, -787, -703, -611, -521, -429, -335, -244, -148, -57, 36, 128, 
-    217, 307, 393, 478, 559, 637, 715, 784, 857, 917, 985, 1040, 1100, 1150, 1205, 1250, 
-    1299, 1342, 1385, 1424, 1464, 1501, 1535, 1567, 1598, 1624, 1649, 1668, 1686, 1698, 1708, 1709, 
-    1709, 1700, 1689, 1669, 1645, 1616, 1577, 1538, 1488, 1437, 1377, 1315, 1246, 1173, 1096, 1013, 
-    930, 837, 747, 647, 550, 445, 340, 229, 120, 5, -109, -227, -343, -465, -582, -703, 
-    -821, -939, -1053, -1169, -1277, -1386, -1489, -1591, -1684, -1776, -1862, -1943, -2020, -2091, -2157, -2219, 
-    -2276, -2330, -2376, -2421, -2461, -2498, -2530, -2559, -2584, -2607, -2625, -2641, -2652, -2659, -2665, -2662, 
-    -2661, -2650, -2641, -2621, -2602, -2574, -2544, -2506, -2467, -2421, -2369, -2314, -2253, -2190, -2117, -2047, 
-    -1966, -1888, -1800, -1712, -1619, -1525, -1425, -1324, -1219, -1112, -1001, -890, -773, -657, -534, -413, 
-    -286, -161, -28, 100, 237, 372, 511, 650, 792, 934, 1078, 1223, 1366, 1514, 1656, 1804, 
-    1944, 2089, 2227, 2368, 2503, 2637, 2767, 2896, 3017, 3138, 3253, 3365, 3469, 3573, 3666, 3758, 
-    3842, 3921, 3993, 4060, 4119, 4173, 4218, 4260, 4291, 4317, 4335, 4346, 4350, 4344, 4333, 4313, 
-    4285, 4251, 4206, 4156, 4096, 4032, 3956, 3877, 3787, 3695, 3593, 3487, 3375, 3258, 3137, 3012, 
-    2883, 2749, 2616, 2476, 2339, 2195, 2053, 1907, 1761, 1613, 1463, 1315, 1162, 1009, 854, 698, 
-    539, 378, 215, 50, -118, -286, -460, -632, -810, -984, -1164, -1340, -1519, -1697, -1872, -2047, 
-    -2217, -2387, -2552, -2713, -2870, -3023, -3170, -3312, -3449, -3579, -3707, -3825, -3941, -4048, -4154, -4249, 
-    -4342, -4429, -4510, -4585, -4654, -4719, -4774, -4827, -4868, -4908, -4936, -4958, -4973, -4978, -4975, -4962, 
-    -4942, -4913, -4872, -4825, -4766, -4700, -4624, -4540, -4447, -4346, -4238, -4124, -4002, -3874, -3741, -3602, 
-    -3461, -3311, -3162, -3005, -2848, -2684, -2521, -2353, -2184, -2010, -1836, -1657, -1479, -1297, -1115, -927, 
-    -743, -554, -365, -174, 16, 206, 398, 588, 778, 965, 1152, 1334, 1516, 1693, 1868, 2036, 
-    2203, 2363, 2521, 2671, 2817, 2957, 3091, 3219, 3342, 3457, 3568, 3669, 3769, 3857, 3944, 4019, 
-    4092, 4157, 4217, 4271, 4318, 4361, 4396, 4428, 4451, 4472, 4486, 4494, 4497, 4494, 4487, 4471, 
-    4454, 4426, 4397, 4358, 4316, 4264, 4210, 4146, 4078, 4000, 3918, 3828, 3733, 3629, 3519, 3404, 
-    3281, 3153, 3017, 2878, 2730, 2580, 2422, 2261, 2095, 1926, 1752, 1575, 1396, 1215, 1031, 845, 
-    661, 474, 290, 105, -76, -260, -438, -616, -788, -961, -1127, -1292, -1450, -1608, -1759, -1906, 
-    -2050, -2188, -2323, -2452, -2578, -2697, -2812, -2922, -3026, -3124, -3217, -3304, -3384, -3457, -3521, -3583, 
-    -3630, -3676, -3706, -3736, -3750, -3761, -3759, -3754, -3733, -3711, -3675, -3636, -3585, -3532, -3468, -3401, 
-    -3326, -3247, -3161, -3074, -2979, -2885, -2781, -2680, -2572, -2464, -2352, -2238, -2123, -2004, -1885, -1762, 
-    -1641, -1513, -1389, -1259, -1132, -999, -868, -736, -602, -470, -334, -202, -69, 62, 194, 324, 
-    453, 580, 705, 828, 950, 1068, 1184, 1298, 1409, 1517, 1622, 1726, 1825, 1922, 2018, 2108, 
-    2197, 2280, 2365, 2441, 2517, 2588, 2655, 2717, 2774, 2827, 2875, 2917, 2952, 2981, 3005, 3021, 
-    3030, 3032, 3027, 3013, 2994, 2967, 2932, 2890, 2842, 2788, 2725, 2658, 2582, 2504, 2417, 2329, 
-    2231, 2132, 2025, 1917, 1801, 1685, 1561, 1438, 1307, 1176, 1039, 902, 759, 616, 468, 322, 
-    171, 20, -131, -283, -436, -589, -740, -889, -1039, -1183, -1328, -1465, -1602, -1732, -1859, -1980, 
-    -2096, -2208, -2313, -2414, -2508, -2596, -2678, -2757, -2828, -2893, -2954, -3010, -3061, -3105, -3145, -3181, 
-    -3211, -3238, -3257, -3275, -3284, -3293, -3291, -3288, -3277, -3262, -3240, -3210, -3176, -3134, -3086, -3029, 
-    -2968, -2897, -2822, -2738, -2648, -2551, -2450, -2342, -2228, -2112, -1989, -1865, -1734, -1604, -1470, -1335, 
-    -1196, -1058, -920, -779, -639, -499, -359, -216, -77, 65, 203, 351, 488, 636, 777, 927, 
-    1072, 1223, 1372, 1524, 1676, 1831, 1984, 2140, 2292, 2449, 2600, 2752, 2901, 3048, 3192, 3330, 
-    3465, 3594, 3718, 3836, 3946, 4050, 4145, 4234, 4314, 4385, 4450, 4502, 4551, 4586, 4617, 4635, 
-    4648, 4650, 4645, 4631, 4608, 4579, 4540, 4494, 4439, 4377, 4309, 4230, 4147, 4054, 3957, 3850, 
-    3739, 3618, 3493, 3361, 3223, 3080, 2929, 2773, 2612, 2445, 2274, 2095, 1915, 1727, 1538, 1340, 
-    1141, 938, 732, 521, 309, 94, -120, -338, -555, -775, -991, -1210, -1422, -1636, -1842, -2050, 
-    -2248, -2443, -2633, -2817, -2993, -3162, -3327, -3481, -3632, -3771, -3906, -4032, -4154, -4267, -4376, -4476, 
-    -4573, -4663, -4749, -4829, -4903, -4974, -5037, -5098, -5151, -5200, -5242, -5280, -5310, -5334, -5350, -5361, 
-    -5362, -5358, -5343, -5322, -5289, -5252, -5203, -5146, -5079, -5006, -4923, -4830, -4731, -4622, -4507, -4382, 
-    -4251, -4112, -3965, -3815, -3653, -3489, -3318, -3140, -2958, -2769, -2578, -2379, -2179, -1971, -1763, -1548, 
-    -1333, -1112, -889, -665, -437, -209, 21, 253, 484, 717, 951, 1182, 1414, 1643, 1873, 2099, 
-    2322, 2544, 2760, 2974, 3180, 3385, 3582, 3772, 3957, 4133, 4304, 4464, 4618, 4762, 4899, 5025, 
-    5142, 5252, 5349, 5442, 5519, 5594, 5653, 5710, 5753, 5792, 5817, 5841, 5851, 5860, 5855, 5848, 
-    5831, 5809, 5778, 5742, 5699, 5647, 5591, 5525, 5456, 5374, 5290, 5195, 5095, 4986, 4870, 4746, 
-    4613, 4475, 4326, 4172, 4008, 3838, 3659, 3476, 3283, 3085, 2879, 2670, 2454, 2233, 2010, 1780, 
-    1550, 1314, 1080, 841, 604, 366, 129, -106, -342, -573, -804, -1029, -1256, -1473, -1692, -1903, 
-    -2113, -2316, -2517, -2713, -2905, -3092, -3276, -3453, -3630, -3796, -3964, -4121, -4277, -4424, -4566, -4703, 
-    -4831, -4953, -5066, -5172, -5269, -5354, -5433, -5500, -5559, -5605, -5643, -5669, -5684, -5689, -5683, -5669, 
-    -5641, -5607, -5562, -5508, -5447, -5374, -5298, -5212, -5121, -5020, -4916, -4806, -4689, -4567, -4442, -4309, 
-    -4174, -4032, -3889, -3737, -3586, -3426, -3265, -3097, -2930, -2754, -2579, -2397, -2215, -2028, -1839, -1647, 
-    -1455, -1258, -1062, -861, -664, -460, -261, -56, 144, 348, 548, 751, 951, 1151, 1348, 1544, 
-    1737, 1927, 2116, 2299, 2480, 2655, 2827, 2990, 3151, 3304, 3450, 3589, 3721, 3845, 3960, 4068, 
-    4166, 4256, 4337, 4410, 4473, 4530, 4575, 4615, 4644, 4668, 4683, 4690, 4692, 4684, 4674, 4653, 
-    4629, 4595, 4561, 4515, 4468, 4411, 4351, 4283, 4210, 4130, 4043, 3952, 3853, 3746, 3636, 3516, 
-    3396, 3262, 3130, 2985, 2843, 2690, 2537, 2377, 2217, 2052, 1887, 1718, 1550, 1379, 1210, 1039, 
-    871, 701, 535, 368, 206, 42, -117, -276, -432, -587, -741, -890, -1040, -1184, -1329, -1470, 
-    -1610, -1746, -1881, -2011, -2139, -2263, -2385, -2501, -2614, -2723, -2826, -2924, -3016, -3102, -3182, -3257, 
-    -3322, -3384, -3433, -3483, -3516, -3551, -3571, -3588, -3594, -3596, -3589, -3574, -3554, -3528, -3495, -3454, 
-    -3410, -3357, -3302, -3239, -3171, -3100, -3021, -2941, -2851, -2762, -2664, -2564, -2459, -2349, -2238, -2119, 
-    -2000, -1873, -1746, -1614, -1480, -1341, -1203, -1059, -917, -771, -626, -478, -331, -185, -39, 106, 
-    250, 393, 533, 672, 808, 941, 1071, 1197, 1322, 1439, 1555, 1665, 1772, 1873, 1971, 2061, 
-    2148, 2229, 2304, 2374, 2437, 2497, 2548, 2596, 2636, 2672, 2700, 2726, 2742, 2756, 2761, 2764, 
-    2762, 2753, 2741, 2724, 2704, 2678, 2649, 2616, 2580, 2539, 2497, 2448, 2398, 2343, 2285, 2223, 
-    2157, 2087, 2012, 1935, 1852, 1765, 1673, 1580, 1477, 1376, 1266, 1154, 1038, 918, 795, 669, 
-    542, 411, 280, 146, 14, -120, -252, -384, -516, -643, -773, -895, -1019, -1138, -1254, -1368, 
-    -1476, -1585, -1686, -1787, -1883, -1976, -2065, -2151, -2235, -2313, -2390, -2460, -2531, -2594, -2657, -2713, 
-    -2767, -2813, -2859, -2895, -2930, -2954, -2979, -2991, -3002, -3003, -2999, -2989, -2970, -2947, -2915, -2879, 
-    -2835, -2786, -2730, -2668, -2602, -2528, -2453, -2369, -2283, -2190, -2097, -1995, -1895, -1785, -1680, -1565, 
-    -1451, -1333, -1214, -1092, -967, -843, -713, -585, -452, -321, -185, -50, 85, 223, 361, 502, 
-    640, 780, 921, 1061, 1201, 1338, 1478, 1615, 1752, 1883, 2017, 2144, 2274, 2395, 2517, 2633, 
-    2745, 2854, 2956, 3056, 3148, 3236, 3318, 3395, 3465, 3529, 3587, 3639, 3686, 3724, 3757, 3785, 
-    3805, 3820, 3827, 3830, 3825, 3816, 3798, 3778, 3747, 3716, 3674, 3629, 3577, 3521, 3458, 3387, 
-    3314, 3233, 3147, 3054, 2958, 2854, 2748, 2631, 2516, 2389, 2263, 2129, 1993, 1852, 1708, 1560, 
-    1409, 1256, 1100, 942, 782, 622, 460, 297, 135, -26, -186, -349, -507, -665, -821, -977, 
-    -1129, -1278, -1427, -1574, -1716, -1858, -1996, -2132, -2264, -2395, -2523, -2647, -2770, -2888, -3004, -3117, 
-    -3225, -3329, -3431, -3527, -3619, -3705, -3787, -3863, -3933, -3995, -4055, -4103, -4150, -4184, -4217, -4236, 
-    -4254, -4260, -4262, -4255, -4242, -4221, -4194, -4160, -4121, -4072, -4022, -3959, -3899, -3823, -3752, -3665, 
-    -3582, -3483, -3389, -3282, -3175, -3060, -2940, -2817, -2688, -2556, -2417, -2278, -2132, -1987, -1832, -1683, 
-    -1522, -1367, -1204, -1046, -881, -719, -554, -391, -227, -64, 98, 260, 419, 580, 738, 895, 
-    1049, 1205, 1357, 1507, 1655, 1802, 1945, 2088, 2224, 2362, 2491, 2622, 2743, 2865, 2977, 3089, 
-    3193, 3292, 3384, 3470, 3552, 3623, 3692, 3751, 3806, 3852, 3894, 3928, 3956, 3979, 3996, 4007, 
-    4013, 4015, 4009, 4003, 3987, 3970, 3945, 3920, 3885, 3848, 3806, 3758, 3704, 3646, 3581, 3511, 
-    3434, 3353, 3263, 3169, 3068, 2959, 2848, 2728, 2606, 2475, 2344, 2203, 2065, 1919, 1773, 1624, 
-    1472, 1322, 1169, 1019, 866, 715, 566, 418, 270, 127, -16, -155, -297, -430, -568, -698, 
-    -831, -956, -1084, -1206, -1329, -1446, -1565, -1675, -1790, -1894, -2002, -2101, -2201, -2295, -2385, -2471, 
-    -2553, -2630, -2702, -2771, -2832, -2890, -2941, -2988, -3028, -3064, -3092, -3117, -3136, -3148, -3156, -3158, 
-    -3156, -3146, -3136, -3115, -3095, -3065, -3035, -2998, -2957, -2913, -2863, -2812, -2755, -2695, -2631, -2563, 
-    -2494, -2420, -2343, -2264, -2180, -2096, -2006, -1917, -1824, -1728, -1632, -1532, -1432, -1328, -1225, -1119, 
-    -1013, -905, -797, -688, -577, -468, -357, -248, -136, -28, 82, 189, 299, 403, 511, 613, 
-    716, 815, 913, 1008, 1100, 1191, 1275, 1358, 1437, 1513, 1582, 1650, 1713, 1771, 1824, 1874, 
-    1918, 1960, 1995, 2027, 2054, 2077, 2096, 2109, 2122, 2126, 2131, 2128, 2125, 2115, 2104, 2089, 
-    2068, 2048, 2019, 1993, 1957, 1924, 1880, 1841, 1792, 1745, 1690, 1636, 1577, 1516, 1452, 1385, 
-    1318, 1246, 1177, 1098, 1029, 948, 876, 796, 721, 641, 566, 487, 413, 336, 262, 186, 
-    114, 43, -27, -96, -165, -230, -296, -359, -422, -482, -541, -599, -655, -709, -761, -815, 
-    -861, -911, -953, -1001, -1039, -1081, -1115, -1153, -1183, -1216, -1240, -1269, -1288, -1309, -1324, -1339, 
-    -1349, -1356, -1361, -1362, -1359, -1355, -1347, -1335, -1320, -1303, -1281, -1257, -1230, -1200, -1166, -1131, 
-    -1090, -1050, -1003, -958, -906, -855, -799, -743, -684, -623, -561, -497, -431, -365, -296, -227, 
-    -157, -87, -15, 56, 128, 199, 272, 343, 417, 484, 557, 626, 696, 761, 830, 894, 
-    958, 1018, 1081, 1137, 1193, 1248, 1299, 1349, 1394, 1440, 1480, 1518, 1552, 1585, 1612, 1638, 
-    1659, 1677, 1691, 1702, 1709, 1711, 1710, 1703, 1695, 1678, 1661, 1635, 1610, 1574, 1539, 1496, 
-    1450, 1399, 1345, 1285, 1222, 1155, 1085, 1011, 934, 854, 773, 689, 601, 515, 424, 337, 
-    242, 153, 59, -30, -124, -214, -307, -395, -486, -573, -660, -746, -829, -912, -991, -1070, 
-    -1144, -1218, -1288, -1358, -1420, -1484, -1542, -1599, -1651, -1700, -1748, -1790, -1831, -1866, -1901, -1931, 
-    -1959, -1981, -2004, -2022, -2038, -2050, -2060, -2068, -2072, -2074, -2074, -2071, -2066, -2059, -2049, -2035, 
-    -2021, -2003, -1983, -1960, -1936, -1906, -1875, -1842, -1804, -1765, -1719, -1675, -1623, -1572, -1513, -1455, 
-    -1389, -1323, -1252, -1179, -1102, -1019, -936, -849, -758, -664, -567, -469, -368, -264, -158, -51, 
-    57, 166, 278, 388, 499, 611, 721, 832, 940, 1048, 1155, 1257, 1361, 1460, 1558, 1651, 
-    1744, 1831, 1919, 1999, 2080, 2154, 2227, 2294, 2360, 2421, 2479, 2532, 2583, 2626, 2670, 2705, 
-    2738, 2766, 2788, 2807, 2817, 2825, 2827, 2822, 2812, 2795, 2774, 2747, 2714, 2674, 2631, 2581, 
-    2527, 2467, 2404, 2336, 2263, 2189, 2109, 2028, 1943, 1857, 1769, 1678, 1586, 1493, 1399, 1304, 
-    1208, 1110, 1013, 915, 816, 716, 615, 516, 415, 312, 210, 108, 7, -97, -197, -301, 
-    -402, -504, -605, -705, -804, -901, -997, -1092, -1183, -1276, -1363, -1451, -1535, -1618, -1698, -1775, 
-    -1852, -1925, -1997, -2065, -2132, -2196, -2258, -2318, -2375, -2430, -2481, -2531, -2576, -2621, -2659, -2697, 
-    -2728, -2758, -2781, -2804, -2818, -2831, -2836, -2840, -2836, -2828, -2814, -2797, -2772, -2744, -2709, -2671, 
-    -2625, -2577, -2521, -2464, -2399, -2331, -2259, -2181, -2102, -2016, -1929, -1836, -1742, -1643, -1544, -1438, 
-    -1333, -1223, -1113, -999, -884, -768, -649, -531, -409, -289, -168, -46, 73, 196, 314, 434, 
-    550, 665, 781, 890, 1001, 1106, 1211, 1311, 1409, 1504, 1597, 1683, 1770, 1851, 1932, 2005, 
-    2080, 2147, 2215, 2277, 2336, 2391, 2443, 2492, 2535, 2576, 2612, 2643, 2671, 2694, 2711, 2724, 
-    2733, 2736, 2734, 2728, 2715, 2700, 2676, 2653, 2620, 2585, 2544, 2501, 2453, 2399, 2345, 2284, 
-    2223, 2155, 2089, 2017, 1942, 1865, 1788, 1706, 1623, 1538, 1453, 1364, 1276, 1184, 1093, 1000, 
-    907, 813, 716, 621, 525, 427, 331, 233, 137, 37, -58, -156, -253, -350, -446, -542, 
-    -635, -731, -822, -915, -1004, -1095, -1182, -1268, -1352, -1435, -1515, -1596, -1670, -1745, -1815, -1887, 
-    -1951, -2017, -2075, -2135, -2187, -2241, -2285, -2331, -2370, -2407, -2437, -2466, -2488, -2509, -2520, -2534, 
-    -2535, -2539, -2533, -2526, -2512, -2494, -2472, -2446, -2415, -2377, -2340, -2294, -2249, -2193, -2140, -2079, 
-    -2015, -1948, -1877, -1804, -1725, -1646, -1561, -1476, -1385, -1294, -1200, -1101, -1005, -900, -801, -693, 
-    -591, -481, -374, -265, -155, -46, 64, 173, 283, 393, 501, 610, 715, 823, 924, 1029, 
-    1128, 1228, 1322, 1416, 1507, 1593, 1679, 1758, 1837, 1909, 1979, 2045, 2106, 2163, 2215, 2264, 
-    2307, 2346, 2381, 2410, 2436, 2456, 2472, 2483, 2490, 2491, 2490, 2482, 2472, 2455, 2436, 2411, 
-    2382, 2350, 2313, 2272, 2226, 2176, 2124, 2066, 2007, 1940, 1875, 1803, 1730, 1653, 1575, 1492, 
-    1411, 1324, 1238, 1148, 1060, 969, 878, 787, 695, 601, 511, 418, 328, 234, 146, 53, 
-    -36, -127, -215, -305, -394, -481, -570, -656, -744, -828, -915, -997, -1080, -1163, -1241, -1324, 
-    -1396, -1476, -1546, -1619, -1686, -1753, -1817, -1877, -1934, -1990, -2040, -2089, -2131, -2175, -2210, -2245, 
-    -2270, -2300, -2318, -2337, -2347, -2357, -2361, -2361, -2356, -2347, -2334, -2317, -2295, -2269, -2239, -2205, 
-    -2166, -2127, -2079, -2033, -1976, -1924, -1861, -1803, -1734, -1669, -1596, -1526, -1447, -1372, -1291, -1211, 
-    -1126, -1042, -956, -867, -780, -688, -599, -507, -415, -324, -230, -138, -45, 44, 138, 228, 
-    319, 407, 497, 582, 669, 752, 837, 915, 996, 1071, 1149, 1218, 1293, 1358, 1429, 1489, 
-    1553, 1611, 1671, 1722, 1777, 1823, 1873, 1913, 1957, 1993, 2030, 2060, 2091, 2114, 2138, 2155, 
-    2172, 2181, 2191, 2194, 2195, 2191, 2185, 2172, 2158, 2140, 2117, 2090, 2060, 2027, 1989, 1948, 
-    1904, 1855, 1806, 1749, 1695, 1631, 1572, 1504, 1440, 1369, 1298, 1224, 1152, 1074, 1000, 920, 
-    844, 762, 686, 601, 528, 438, 374, 
-};
-const unsigned int drum_v0_p2_long_len = 10471;
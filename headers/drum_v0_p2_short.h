@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v0_p2_short[] PROGMEM = {
-    24, -9, 14, 10, 20, 20, 23, 21, 19, 15, 15, 6, 5, -4, -5, -16, 
-    -19, -31, -34, -46, -50, -64, -68, -82, -87, -101, -109, -122, -133, -144, -157, -168, 
-    -182, -194, -207, -220, -234, -247, -259, -273, -285, -298, -310, -321, -335, -344, -357, -366, 
-    -378, -386, -399, -405, -417, -424, -435, -443, -451, -460, -467, -478, -483, -494, -501, -510, 
-    -517, -526, -534, -543, -550, -560, -567, -577, -584, -592, -600, -608, -615, -622, -629, -635, 
-    -641, -647, -650, -656, -656, -664, -662, -666, -663, -667, -664, -663, -660, -659, -654, -651, 
-    -646, -642, -634, -630, -621, -617, -605, -600, -588, -581, -570, -560, -549, -538, -524, -513, 
-    -498, -486, -468, -454, -438, -424, -403, -389, -369, -354, -332, -316, -296, -277, -258, -239, 
-    -221, -199, -181, -162, -143, -123, -106, -86, -69, -49, -32, -13, 2, 21, 38, 56, 
-    71, 89, 105, 123, 137, 156, 170, 187, 202, 220, 234, 252, 267, 284, 300, 316, 
-    333, 350, 367, 383, 400, 417, 433, 449, 465, 480, 496, 509, 525, 536, 551, 561, 
-    574, 584, 595, 604, 613, 622, 630, 637, 644, 651, 656, 663, 668, 673, 678, 683, 
-    687, 689, 695, 696, 699, 701, 701, 702, 701, 701, 697, 695, 690, 684, 679, 670, 
-    662, 651, 642, 629, 616, 603, 587, 572, 556, 539, 520, 503, 484, 465, 445, 426, 
-    404, 386, 362, 342, 319, 297, 273, 250, 225, 199, 173, 147, 118, 91, 60, 32, 
-    -1, -30, -65, -95, -130, -164, -197, -232, -266, -300, -336, -369, -405, -436, -472, -504, 
-    -538, -568, -600, -631, -661, -689, -718, -746, -772, -798, -822, -847, -869, -892, -912, -932, 
-    -951, -969, -986, -1002, -1017, -1031, -1044, -1056, -1066, -1076, -1084, -1092, -1097, -1103, -1105, -1108, 
-    -1106, -1107, -1103, -1099, -1094, -1088, -1078, -1067, -1056, -1041, -1026, -1008, -990, -967, -947, -922, 
-    -899, -870, -844, -812, -784, -749, -718, -681, -647, -608, -570, -530, -490, -447, -405, -360, 
-    -316, -269, -223, -176, -126, -78, -27, 22, 74, 127, 177, 233, 283, 339, 392, 446, 
-    501, 554, 611, 663, 718, 773, 827, 880, 934, 987, 1039, 1090, 1141, 1191, 1240, 1287, 
-    1333, 1379, 1421, 1465, 1502, 1545, 1579, 1616, 1647, 1680, 1709, 1735, 1762, 1783, 1805, 1823, 
-    1838, 1853, 1862, 1873, 1876, 1883, 1880, 1880, 1874, 1868, 1855, 1843, 1825, 1807, 1783, 1758, 
-    1730, 1697, 1663, 1626, 1585, 1542, 1495, 1447, 1395, 1341, 1284, 1224, 1163, 1097, 1031, 961, 
-    891, 818, 741, 665, 585, 506, 421, 339, 251, 165, 76, -13, -104, -198, -290, -384, 
-    -481, -575, -674, -769, -870, -967, -1066, -1165, -1264, -1364, -1462, -1560, -1659, -1755, -1853, -1947, 
-    -2043, -2135, -2228, -2318, -2407, -2495, -2580, -2666, -2748, -2828, -2909, -2984, -3061, -3132, -3205, -3274, 
-    -3340, -3405, -3466, -3527, -3582, -3637, -3687, -3735, -3778, -3819, -3856, -3888, -3917, -3939, -3958, -3972, 
-    -3981, -3983, -3981, -3972, -3958, -3937, -3909, -3877, -3836, -3789, -3737, -3675, -3610, -3535, -3456, -3367, 
-    -3275, -3172, -3067, -2951, -2832, -2701, -2569, -2427, -2281, -2126, -1966, -1800, -1627, -1450, -1265, -1077, 
-    -882, -683, -480, -272, -59, 154, 373, 594, 819, 1042, 1271, 1496, 1728, 1952, 2184, 2406, 
-    2636, 2856, 3080, 3297, 3513, 3725, 3933, 4137, 4337, 4530, 4720, 4904, 5081, 5254, 5419, 5579, 
-    5731, 5877, 6016, 6148, 6273, 6391, 6500, 6605, 6699, 6789, 6869, 6944, 7009, 7069, 7120, 7165, 
-    7202, 7233, 7256, 7271, 7282, 7283, 7279, 7266, 7251, 7223, 7195, 7155, 7114, 7062, 7008, 6945, 
-    6878, 6803, 6724, 6638, 6545, 6448, 6344, 6236, 6116, 5995, 5865, 5730, 5586, 5435, 5280, 5112, 
-    4941, 4757, 4568, 4367, 4161, 3941, 3713, 3476, 3227, 2969, 2699, 2423, 2131, 1832, 1523, 1202, 
-    873, 532, 185, -173, -539, -913, -1297, -1686, -2084, -2485, -2897, -3308, -3730, -4150, -4578, -5006, 
-    -5436, -5866, -6297, -6727, -7154, -7579, -8000, -8413, -8824, -9223, -9617, -9997, -10371, -10728, -11076, -11405, 
-    -11723, -12021, -12304, -12569, -12812, -13041, -13244, -13435, -13596, -13744, -13867, -13972, -14056, -14120, -14164, -14191, 
-    -14200, -14190, -14166, -14125, -14073, -14004, -13926, -13834, -13736, -13623, -13507, -13380, -13247, -13104, -12957, -12801, 
-    -12636, -12466, -12284, -12095, -11892, -11680, -11455, -11214, -10961, -10689, -10405, -10099, -9782, -9443, -9093, -8724, 
-    -8347, -7953, -7554, -7145, -6736, -6322, -5911, -5503, -5103, -4710, -4327, -3955, -3592, -3242, -2897, -2558, 
-    -2221, -1881, -1535, -1172, -792, -384, 54, 538, 1060, 1640, 2268, 2962, 3713, 4528, 5415, 6376, 
-    7370, 8424, 9508, 10630, 11759, 12910, 14045, 15178, 16270, 17363, 18390, 19393, 19582, 19551, 19568, 19557, 
-    19566, 19558, 19565, 19559, 19565, 19559, 19564, 19560, 19564, 19561, 19563, 19561, 19563, 19561, 19563, 19561, 
-    19561, 19562, 19561, 19562, 19559, 19562, 19560, 19562, 19561, 19562, 19561, 19563, 19561, 19562, 19562, 19562, 
-    19560, 19564, 19559, 19565, 19554, 19577, 19488, 18282, 16986, 15681, 14382, 13071, 11768, 10483, 9218, 7973, 
-    6754, 5586, 4472, 3412, 2408, 1474, 611, -185, -927, -1631, -2303, -2955, -3588, -4203, -4818, -5442, 
-    -6079, -6728, -7389, -8063, -8755, -9490, -10260, -11064, -11884, -12723, -13572, -14430, -15283, -16138, -16987, -17830, 
-    -18655, -19406, -19616, -19592, -19603, -19596, -19602, -19597, -19600, -19597, -19600, -19597, -19600, -19597, -19599, -19597, 
-    -19599, -19598, -19600, -19597, -19599, -19598, -19601, -19597, -19601, -19598, -19600, -19598, -19600, -19598, -19600, -19597, 
-    -19600, -19597, -19599, -19596, -19600, -19597, -19599, -19598, -19600, -19598, -19599, -19598, -19599, -19597, -19601, -19596, 
-    -19602, -19594, -19604, -19593, -19605, -19591, -19608, -19587, -19615, -19574, -19646, -19236, -17796, -16450, -15011, -13604, 
-    -12146, -10719, -9269, -7868, -6468, -5129, -3801, -2525, -1258, -35, 1174, 2339, 3489, 4599, 5701, 6771, 
-    7836, 8862, 9885, 10871, 11857, 12814, 13779, 14724, 15688, 16635, 17602, 18553, 19479, 19580, 19554, 19566, 
-    19559, 19564, 19560, 19563, 19560, 19564, 19561, 19562, 19561, 19563, 19562, 19562, 19562, 19562, 19562, 19562, 
-    19562, 19562, 19562, 19563, 19561, 19563, 19561, 19563, 19561, 19562, 19562, 19563, 19561, 19563, 19561, 19563, 
-    19560, 19563, 19560, 19563, 19560, 19564, 19560, 19563, 19561, 19563, 19561, 19563, 19561, 19562, 19560, 19563, 
-    19561, 19563, 19561, 19563, 19561, 19563, 19560, 19564, 19558, 19567, 19555, 19573, 19546, 19592, 18883, 17339, 
-    15820, 14231, 12659, 11042, 9443, 7806, 6175, 4517, 2872, 1215, -417, -2050, -3652, -5238, -6778, -8297, 
-    -9759, -11195, -12565, -13913, -15185, -16452, -17627, -18854, -19573, -19596, -19603, -19597, -19600, -19597, -19601, -19598, 
-    -19600, -19597, -19601, -19598, -19600, -19598, -19599, -19598, -19599, -19598, -19599, -19598, -19599, -19597, -19600, -19599, 
-    -19600, -19598, -19599, -19598, -19600, -19596, -19600, -19597, -19600, -19598, -19601, -19598, -19600, -19598, -19599, -19598, 
-    -19598, -19599, -19599, -19598, -19599, -19598, -19600, -19598, -19599, -19598, -19600, -19598, -19599, -19597, -19600, -19598, 
-    -19600, -19597, -19600, -19596, -19601, -19596, -19603, -19595, -19603, -19593, -19604, -19593, -19606, -19593, -19572, -18108, 
-    -15924, -13793, -11600, -9422, -7221, -5039, -2857, -703, 1427, 3524, 5588, 7619, 9600, 11552, 13436, 15297, 
-    17072, 18834, 19594, 19543, 19575, 19552, 19570, 19555, 19568, 19556, 19568, 19556, 19567, 19557, 19567, 19557, 
-    19567, 19556, 19568, 19556, 19567, 19556, 19567, 19557, 19567, 19557, 19567, 19557, 19567, 19558, 19566, 19558, 
-    19566, 19558, 19566, 19558, 19566, 19557, 19567, 19557, 19567, 19557, 19567, 19557, 19567, 19557, 19566, 19557, 
-    19566, 19557, 19566, 19557, 19566, 19557, 19566, 19558, 19565, 19558, 19565, 19559, 19566, 19557, 19568, 19556, 
-    19569, 19554, 19570, 19553, 19572, 19551, 19575, 19546, 19582, 19532, 19620, 19321, 17283, 15273, 13180, 11101, 
-    8977, 6862, 4724, 2602, 473, -1626, -3715, -5767, -7801, -9793, -11759, -13681, -15567, -17417, -19147, -19630, 
-    -19585, -19607, -19593, -19604, -19595, -19603, -19595, -19602, -19596, -19602, -19596, -19601, -19597, -19600, -19598, -19600, 
-    -19598, -19600, -19597, -19601, -19598, -19600, -19598, -19600, -19598, -19601, -19597, -19601, -19596, -19602, -19596, -19602, 
-    -19595, -19600, -19595, -19601, -19596, -19602, -19597, -19601, -19596, -19601, -19597, -19602, -19596, -19601, -19596, -19601, 
-    -19595, -19601, -19595, -19602, -19594, -19603, -19593, -19604, -19593, -19604, -19593, -19603, -19592, -19604, -19593, -19607, 
-    -19590, -19608, -19588, -19611, -19584, -19614, -19579, -19626, -19558, -19660, -18408, -16485, -14713, -12792, -10917, -8962, 
-    -7035, -5065, -3120, -1167, 757, 2662, 4535, 6374, 8180, 9941, 11678, 13353, 15024, 16605, 18253, 19506, 
-    19546, 19576, 19550, 19572, 19553, 19571, 19554, 19569, 19555, 19569, 19556, 19568, 19557, 19567, 19557, 19566, 
-    19557, 19566, 19557, 19565, 19557, 19566, 19557, 19565, 19557, 19565, 19558, 19563, 19560, 19563, 19560, 19562, 
-    19561, 19563, 19560, 19564, 19560, 19563, 19561, 19563, 19560, 19563, 19560, 19563, 19559, 19565, 19558, 19565, 
-    19559, 19564, 19560, 19563, 19560, 19564, 19560, 19563, 19561, 19563, 19559, 19563, 19561, 19564, 19560, 19563, 
-    19561, 19561, 19562, 19559, 19565, 19554, 19580, 19459, 17891, 16262, 14607, 12946, 11250, 9547, 7809, 6061, 
-    4279, 2487, 664, -1166, -3027, -4885, -6774, -8651, -10561, -12444, -14361, -16220, -18161, -19508, -19605, -19600, 
-    -19596, -19600, -19598, -19601, -19596, -19599, -19598, -19598, -19599, -19598, -19599, -19597, -19599, -19599, -19599, -19599, 
-    -19597, -19599, -19597, -19599, -19598, -19600, -19599, -19599, -19600, -19599, -19598, -19599, -19598, -19599, -19598, -19598, 
-    -19600, -19599, -19600, -19599, -19600, -19598, -19598, -19599, -19598, -19600, -19597, -19599, -19598, -19600, -19599, -19599, 
-    -19599, -19599, -19599, -19599, -19599, -19598, -19599, -19599, -19599, -19601, -19597, -19602, -19594, -19605, -19587, -19625, 
-    -19462, -17983, -16221, -14461, -12680, -10885, -9080, -7264, -5445, -3620, -1802, 9, 1804, 3582, 5333, 7059, 
-    8754, 10414, 12041, 13622, 15173, 16658, 18145, 19419, 19565, 19563, 19559, 19564, 19559, 19564, 19559, 19564, 
-    19560, 19564, 19559, 19564, 19560, 19564, 19560, 19563, 19560, 19564, 19559, 19563, 19560, 19562, 19560, 19562, 
-    19561, 19562, 19561, 19563, 19559, 19565, 19559, 19565, 19558, 19564, 19559, 19564, 19560, 19564, 19560, 19563, 
-    19560, 19563, 19560, 19564, 19560, 19563, 19559, 19563, 19560, 19564, 19560, 19564, 19559, 19565, 19559, 19566, 
-    19558, 19565, 19558, 19567, 19557, 19567, 19555, 19571, 19551, 19575, 19543, 19587, 18222, 16418, 14730, 12996, 
-    11319, 9629, 7977, 6322, 4691, 3056, 1438, -185, -1800, -3424, -5044, -6674, -8305, -9940, -11574, -13200, 
-    -14823, -16416, -18021, -19463, -19606, -19599, -19599, -19599, -19598, -19601, -19597, -19600, -19597, -19601, -19597, -19601, 
-    -19597, -19601, -19598, -19599, -19597, -19599, -19597, -19598, -19598, -19599, -19598, -19600, -19598, -19600, -19597, -19600, 
-    -19598, -19600, -19599, -19599, -19599, -19598, -19599, -19599, -19598, -19599, -19598, -19600, -19599, -19598, -19599, -19599, 
-    -19599, -19599, -19598, -19600, -19598, -19600, -19598, -19599, -19598, -19598, -19599, -19598, -19600, -19597, -19600, -19598, 
-    -19600, -19598, -19599, -19599, -19598, -19600, -19596, -19608, -19546, -18299, -16808, -15313, -13771, -12204, -10608, -8986, 
-    -7343, -5674, -3991, -2287, -572, 1165, 2911, 4681, 6456, 8254, 10048, 11857, 13655, 15465, 17254, 19022, 
-    19594, 19546, 19572, 19555, 19567, 19557, 19566, 19559, 19564, 19559, 19564, 19559, 19564, 19560, 19563, 19560, 
-    19563, 19560, 19563, 19560, 19562, 19561, 19563, 19561, 19562, 19561, 19563, 19561, 19563, 19560, 19564, 19561, 
-    19563, 19560, 19564, 19559, 19564, 19559, 19563, 19560, 19563, 19561, 19563, 19560, 19563, 19560, 19562, 19560, 
-    19562, 19562, 19559, 19573, 19387, 18544, 17620, 16708, 15799, 14898, 14011, 13133, 12273, 11426, 10596, 9778, 
-    8976, 8178, 7391, 6599, 5812, 5012, 4205, 3374, 2526, 1644, 737, -213, -1193, -2219, -3274, -4375, 
-    -5501, -6671, -7856, -9088, -10320, -11595, -12862, -14159, -15434, -16730, -17985, -19250, -19619, -19587, -19606, -19593, 
-    -19604, -19594, -19603, -19596, -19602, -19596, -19601, -19597, -19600, -19598, -19599, -19598, -19598, -19598, -19598, -19597, 
-    -19600, -19598, -19599, -19599, -19599, -19599, -19598, -19600, -19598, -19599, -19597, -19599, -19598, -19599, -19598, -19599, 
-    -19598, -19599, -19597, -19600, -19597, -19603, -19592, -19617, -19416, -18425, -17270, -16136, -14989, -13844, -12700, -11561, 
-    -10425, -9301, -8185, -7086, -5997, -4933, -3880, -2857, -1849, -874, 80, 1001, 1899, 2760, 3597, 4394, 
-    5167, 5902, 6615, 7297, 7960, 8601, 9228, 9842, 10451, 11050, 11654, 12251, 12863, 13468, 14098, 14719, 
-    15368, 16006, 16673, 17323, 18011, 18655, 19373, 19601, 19542, 19575, 19552, 19570, 19556, 19566, 19557, 19565, 
-    19558, 19565, 19559, 19564, 19559, 19564, 19560, 19563, 19562, 19563, 19561, 19563, 19560, 19563, 19560, 19564, 
-    19560, 19564, 19560, 19564, 19559, 19564, 19560, 19563, 19563, 19505, 19060, 18500, 17927, 17310, 16656, 15957, 
-    15213, 14423, 13584, 12699, 11771, 10803, 9796, 8756, 7688, 6603, 5500, 4396, 3289, 2199, 1122, 70, 
-    -954, -1944, -2894, -3805, -4674, -5497, -6282, -7025, -7735, -8412, -9067, -9697, -10314, -10917, -11514, -12103, 
-    -12694, -13280, -13869, -14452, -15039, -15617, -16197, -16761, -17322, -17858, -18385, -18876, -19359, -19605, -19594, -19602, 
-    -19596, -19600, -19597, -19600, -19598, -19599, -19597, -19599, -19598, -19600, -19598, -19600, -19598, -19600, -19597, -19600, 
-    -19597, -19601, -19597, -19601, -19596, -19603, -19593, -19608, -19508, -19147, -18771, -18357, -17922, -17445, -16945, -16400, 
-    -15826, -15209, -14561, -13870, -13148, -12387, -11596, -10773, -9925, -9054, -8168, -7269, -6360, -5448, -4535, -3625, 
-    -2723, -1830, -953, -87, 757, 1591, 2403, 3205, 3986, 4756, 5508, 6251, 6977, 7698, 8406, 9105, 
-    9795, 10475, 11140, 11795, 12431, 13053, 13651, 14231, 14784, 15311, 15811, 16280, 16718, 17121, 17492, 17827, 
-    18127, 18392, 18622, 18819, 18981, 19115, 19214, 19286, 19330, 19348, 19338, 19304, 19244, 19162, 19056, 18929, 
-    18784, 18619, 18438, 18236, 18017, 17780, 17527, 17258, 16973, 16673, 16362, 16036, 15703, 15355, 15002, 14634, 
-    14262, 13877, 13485, 13079, 12666, 12237, 11797, 11341, 10874, 10389, 9888, 9371, 8838, 8287, 7719, 7133, 
-    6528, 5903, 5260, 4598, 3917, 3216, 2501, 1770, 1026, 266, -495, -1272, -2046, -2830, -3606, -4386, 
-    -5152, -5913, -6657, -7387, -8093, -8782, -9442, -10079, -10685, -11264, -11812, -12330, -12819, -13278, -13707, -14111, 
-    -14488, -14846, -15178, -15493, -15789, -16066, -16330, -16575, -16807, -17020, -17218, -17394, -17548, -17678, -17782, -17855, 
-    -17896, -17904, -17873, -17807, -17699, -17556, -17374, -17157, -16908, -16629, -16323, -15997, -15647, -15287, -14912, -14536, 
-    -14153, -13774, -13401, -13034, -12680, -12331, -11997, -11669, -11350, -11035, -10721, -10406, -10085, -9750, -9403, -9034, 
-    -8647, -8229, -7788, -7314, -6808, -6275, -5710, -5123, -4510, -3878, -3229, -2568, -1900, -1226, -552, 114, 
-    777, 1424, 2058, 2669, 3263, 3835, 4385, 4917, 5425, 5919, 6387, 6846, 7279, 7706, 8112, 8510, 
-    8895, 9272, 9640, 9999, 10353, 10700, 11038, 11370, 11692, 12007, 12307, 12602, 12882, 13155, 13410, 13653, 
-    13876, 14079, 14261, 14413, 14543, 14637, 14705, 14735, 14735, 14697, 14629, 14525, 14391, 14224, 14031, 13810, 
-    13568, 13305, 13021, 12722, 12409, 12083, 11747, 11402, 11050, 10695, 10335, 9978, 9620, 9265, 8910, 8557, 
-    8209, 7859, 7514, 7171, 6828, 6487, 6151, 5813, 5480, 5147, 4820, 4494, 4169, 3851, 3533, 3223, 
-    2909, 2602, 2290, 1983, 1671, 1360, 1046, 731, 413, 92, -233, -562, -894, -1229, -1565, -1907, 
-    -2245, -2591, -2933, -3281, -3628, -3975, -4324, -4672, -5024, -5373, -5723, -6070, -6416, -6756, -7091, -7419, 
-    -7738, -8048, -8343, -8626, -8891, -9137, -9364, -9568, -9749, -9906, -10038, -10147, -10232, -10292, -10330, -10346, 
-    -10341, -10318, -10277, -10223, -10149, -10071, -9975, -9879, -9769, -9661, -9542, -9427, -9300, -9176, -9043, -8911, 
-    -8765, -8615, -8452, -8275, -8083, -7873, -7647, -7399, -7135, -6854, -6557, -6246, -5925, -5595, -5259, -4922, 
-    -4584, -4251, -3924, -3609, -3310, -3028, -2766, -2528, -2314, -2126, -1966, -1829, -1721, -1633, -1571, -1524, 
-    -1494, -1474, -1464, -1453, -1445, -1427, -1407, -1369, -1323, -1257, -1180, -1080, -968, -834, -688, -522, 
-    -343, -150, 50, 263, 480, 709, 938, 1172, 1408, 1644, 1881, 2113, 2345, 2571, 2796, 3016, 
-    3237, 3453, 3671, 3888, 4107, 4328, 4549, 4774, 4999, 5224, 5451, 5671, 5892, 6100, 6305, 6492, 
-    6667, 6824, 6957, 7070, 7155, 7215, 7244, 7247, 7221, 7170, 7089, 6989, 6864, 6725, 6570, 6408, 
-    6238, 6066, 5895, 5732, 5574, 5432, 5299, 5189, 5089, 5016, 4954, 4918, 4895, 4891, 4899, 4920, 
-    4947, 4979, 5011, 5041, 5064, 5076, 5077, 5060, 5028, 4973, 4899, 4800, 4682, 4540, 4377, 4195, 
-    3995, 3780, 3549, 3310, 3060, 2807, 2546, 2290, 2033, 1788, 1547, 1326, 1113, 921, 745, 589, 
-    450, 333, 231, 146, 73, 13, -41, -86, -133, -174, -223, -272, -336, -403, -489, -582, 
-    -696, -819, -961, -1114, -1281, -1460, -1645, -1841, -2034, -2232, -2421, -2608, -2779, -2943, -3089, -3221, 
-    -3334, -3433, -3512, -3578, -3624, -3661, -3680, -3699, -3705, -3713, -3716, -3728, -3741, -3765, -3794, -3839, 
-    -3889, -3956, -4029, -4121, -4217, -4328, -4440, -4564, -4686, -4812, -4935, -5050, -5162, -5259, -5352, -5423, 
-    -5487, -5527, -5558, -5566, -5565, -5547, -5522, -5482, -5441, -5389, -5337, -5280, -5229, -5172, -5125, -5076, 
-    -5038, -4998, -4972, -4947, -4928, -4914, -4903, -4899, -4893, -4894, -4890, -4890, -4883, -4875, -4860, -4842, 
-    -4813, -4779, -4734, -4681, -4618, -4539, -4452, -4347, -4233, -4099, -3954, -3792, -3615, -3423, -3216, -2997, 
-    -2763, -2518, -2260, -1990, -1713, -1425, -1134, -835, -537, -235, 64, 360, 651, 935, 1211, 1476, 
-    1730, 1975, 2204, 2426, 2632, 2832, 3019, 3202, 3376, 3546, 3713, 3878, 4044, 4211, 4378, 4551, 
-    4723, 4901, 5078, 5259, 5441, 5622, 5802, 5979, 6155, 6325, 6491, 6651, 6804, 6951, 7090, 7223, 
-    7346, 7464, 7574, 7678, 7777, 7871, 7963, 8049, 8133, 8214, 8293, 8368, 8439, 8507, 8568, 8622, 
-    8669, 8701, 8723, 8726, 8715, 8685, 8636, 8565, 8473, 8355, 8215, 8047, 7857, 7641, 7403, 7142, 
-    6862, 6558, 6241, 5902, 5554, 5188, 4818, 4435, 4049, 3657, 3266, 2874, 2488, 2106, 1731, 1362, 
-    1005, 657, 317, -8, -324, -627, -918, -1197, -1462, -1716, -1955, -2183, -2396, -2600, -2790, -2970, 
-    -3137, -3298, -3449, -3595, -3732, -3864, -3993, -4113, -4234, -4344, -4456, -4559, -4661, -4757, -4847, -4932, 
-    -5012, -5085, -5156, -5218, -5281, -5332, -5386, -5430, -5477, -5518, -5563, -5601, -5647, -5687, -5734, -5777, 
-    -5829, -5879, -5933, -5989, -6046, -6105, -6162, -6221, -6275, -6328, -6375, -6420, -6457, -6490, -6513, -6531, 
-    -6537, -6537, -6527, -6507, -6480, -6443, -6401, -6347, -6292, -6226, -6157, -6080, -6001, -5913, -5827, -5730, 
-    -5638, -5533, -5433, -5322, -5211, -5091, -4968, -4838, -4699, -4554, -4402, -4241, -4073, -3891, -3702, -3496, 
-    -3283, -3055, -2818, -2565, -2305, -2033, -1755, -1470, -1181, -887, -593, -299, -10, 274, 550, 817, 
-    1071, 1311, 1535, 1743, 1933, 2105, 2258, 2393, 2508, 2608, 2690, 2758, 2810, 2855, 2887, 2915, 
-    2936, 2955, 2976, 2996, 3022, 3050, 3088, 3128, 3181, 3236, 3305, 3378, 3462, 3550, 3643, 3744, 
-    3843, 3948, 4046, 4150, 4247, 4342, 4433, 4520, 4605, 4683, 4759, 4827, 4894, 4955, 5016, 5071, 
-    5130, 5183, 5245, 5303, 5369, 5438, 5514, 5592, 5679, 5770, 5870, 5970, 6079, 6185, 6296, 6400, 
-    6506, 6603, 6695, 6774, 6842, 6897, 6936, 6957, 6961, 6945, 6907, 6850, 6771, 6674, 6554, 6417, 
-    6261, 6089, 5901, 5698, 5483, 5255, 5020, 4773, 4519, 4260, 3996, 3731, 3460, 3192, 2923, 2657, 
-    2393, 2137, 1883, 1641, 1404, 1181, 964, 763, 571, 394, 229, 80, -57, -180, -291, -387, 
-    -477, -552, -623, -686, -747, -806, -865, -928, -995, -1070, -1149, -1239, -1338, -1449, -1571, -1707, 
-    -1854, -2014, -2185, -2367, -2559, -2760, -2970, -3185, -3405, -3632, -3858, -4091, -4319, -4553, -4781, -5010, 
-    -5235, -5460, -5681, -5900, -6114, -6326, -6531, -6734, -6928, -7118, -7295, -7467, -7624, -7774, -7907, -8030, 
-    -8136, -8228, -8303, -8363, -8408, -8435, -8450, -8448, -8436, -8406, -8368, -8315, -8252, -8179, -8095, -8005, 
-    -7904, -7800, -7684, -7568, -7441, -7313, -7176, -7040, -6896, -6753, -6607, -6459, -6313, -6163, -6019, -5871, 
-    -5730, -5586, -5449, -5310, -5178, -5048, -4923, -4800, -4678, -4561, -4444, -4328, -4210, -4092, -3972, -3846, 
-    -3716, -3576, -3432, -3276, -3112, -2936, -2750, -2552, -2343, -2120, -1886, -1637, -1378, -1104, -819, -520, 
-    -210, 111, 446, 791, 1147, 1514, 1887, 2270, 2659, 3054, 3453, 3858, 4262, 4670, 5074, 5478, 
-    5875, 6271, 6659, 7040, 7413, 7781, 8134, 8482, 8816, 9145, 9458, 9766, 10058, 10346, 10621, 10886, 
-    11140, 11385, 11618, 11841, 12051, 12255, 12441, 12621, 12783, 12937, 13077, 13202, 13313, 13409, 13488, 13550, 
-    13593, 13618, 13620, 13605, 13563, 13501, 13415, 13305, 13170, 13009, 12823, 12612, 12377, 12117, 11833, 11530, 
-    11204, 10859, 10498, 10123, 9734, 9335, 8928, 8516, 8095, 7677, 7250, 6831, 6404, 5987, 5562, 5148, 
-    4727, 4316, 3897, 3486, 3070, 2660, 2241, 1830, 1409, 992, 565, 143, -290, -721, -1165, -1607, 
-    -2063, -2520, -2988, -3464, -3947, -4439, -4939, -5448, -5966, -6487, -7018, -7550, -8086, -8623, -9157, -9689, 
-    -10214, -10729, -11235, -11723, -12199, -12654, -13091, -13504, -13895, -14261, -14607, -14923, -15218, -15485, -15734, -15955, 
-    -16160, -16343, -16510, -16660, -16794, -16914, -17018, -17110, -17183, -17243, -17283, -17306, -17306, -17285, -17237, -17166, 
-    -17063, -16929, -16762, -16559, -16322, -16043, -15729, -15377, -14987, -14561, -14102, -13610, -13090, -12540, -11972, -11381, 
-    -10780, -10161, -9545, -8918, -8299, -7679, -7072, -6469, -5881, -5304, -4740, -4190, -3654, -3129, -2614, -2107, 
-    -1607, -1108, -611, -110, 392, 904, 1424, 1956, 2501, 3056, 3629, 4211, 4809, 5416, 6033, 6656, 
-    7282, 7908, 8528, 9141, 9745, 10330, 10903, 11448, 11978, 12477, 12954, 13401, 13822, 14215, 14578, 14917, 
-    15230, 15520, 15787, 16032, 16261, 16467, 16661, 16835, 16999, 17146, 17280, 17403, 17511, 17608, 17691, 17759, 
-    17811, 17844, 17860, 17853, 17822, 17769, 17685, 17576, 17435, 17266, 17063, 16832, 16565, 16270, 15941, 15583, 
-    15194, 14780, 14338, 13873, 13386, 12879, 12352, 11812, 11255, 10690, 10112, 9529, 8940, 8346, 7750, 7152, 
-    6557, 5960, 5365, 4772, 4177, 3588, 2994, 2406, 1811, 1220, 623, 25, -579, -1185, -1800, -2416, 
-    -3043, -3670, -4307, -4945, -5588, -6233, -6876, -7520, -8159, -8793, -9418, -10032, -10634, -11217, -11788, -12332, 
-    -12856, -13353, -13822, -14266, -14674, -15059, -15404, -15725, -16008, -16266, -16490, -16687, -16856, -16999, -17118, -17214, 
-    -17286, -17340, -17372, -17386, -17381, -17359, -17321, -17266, -17196, -17112, -17012, -16899, -16770, -16626, -16465, -16290, 
-    -16097, -15885, -15652, -15403, -15129, -14838, -14520, -14186, -13825, -13443, -13037, -12608, -12153, -11675, -11170, -10643, 
-    -10091, -9516, -8919, -8301, -7664, -7010, -6340, -5659, -4966, -4267, -3564, -2857, -2153, -1449, -752, -60, 
-    623, 1294, 1958, 2605, 3239, 3858, 4462, 5049, 5617, 6170, 6704, 7224, 7725, 8212, 8684, 9142, 
-    9586, 10018, 10438, 10846, 11241, 11625, 11996, 12352, 12699, 13029, 13348, 13648, 13934, 14202, 14451, 14682, 
-    14889, 15076, 15241, 15382, 15501, 15594, 15669, 15716, 15744, 15749, 15734, 15698, 15642, 15568, 15477, 15366, 
-    15242, 15100, 14943, 14772, 14584, 14383, 14164, 13929, 13677, 13405, 13115, 12801, 12469, 12110, 11731, 11325, 
-    10896, 10441, 9962, 9460, 8930, 8384, 7810, 7223, 6611, 5989, 5349, 4699, 4037, 3368, 2691, 2010, 
-    1324, 640, -44, -726, -1407, -2079, -2747, -3406, -4058, -4699, -5331, -5952, -6560, -7155, -7736, -8302, 
-    -8850, -9382, -9895, -10387, -10855, -11301, -11720, -12114, -12478, -12815, -13120, -13394, -13638, -13852, -14033, -14184, 
-    -14308, -14402, -14472, -14515, -14537, -14536, -14516, -14475, -14421, -14348, -14265, -14166, -14060, -13940, -13811, -13670, 
-    -13522, -13357, -13182, -12991, -12786, -12562, -12321, -12057, -11771, -11461, -11127, -10767, -10379, -9967, -9533, -9073, 
-    -8594, -8092, -7577, -7043, -6500, -5942, -5382, -4812, -4243, -3670, -3103, -2537, -1979, -1425, -881, -343, 
-    180, 700, 1206, 1708, 2198, 2683, 3163, 3634, 4105, 4567, 5032, 5488, 5944, 6393, 6842, 7282, 
-    7717, 8143, 8563, 8971, 9368, 9751, 10121, 10473, 10810, 11126, 11424, 11699, 11952, 12182, 12388, 12571, 
-    12725, 12859, 12963, 13047, 13103, 13137, 13146, 13134, 13099, 13042, 12966, 12870, 12756, 12620, 12469, 12300, 
-    12118, 11917, 11705, 11475, 11233, 10975, 10704, 10419, 10119, 9804, 9477, 9136, 8779, 8409, 8024, 7627, 
-    7213, 6788, 6349, 5897, 5433, 4956, 4470, 3971, 3464, 2947, 2425, 1896, 1364, 830, 294, -240, 
-    -773, -1303, -1828, -2349, -2861, -3367, -3864, -4351, -4827, -5291, -5744, -6185, -6611, -7023, -7422, -7804, 
-    -8174, -8527, -8867, -9192, -9503, -9801, -10085, -10358, -10620, -10868, -11105, -11330, -11543, -11746, -11935, -12116, 
-    -12281, -12438, -12579, -12709, -12822, -12924, -13008, -13076, -13125, -13159, -13169, -13162, -13131, -13079, -12999, -12900, 
-    -12771, -12620, -12440, -12234, -12004, -11743, -11459, -11141, -10805, -10435, -10045, -9628, -9188, -8726, -8241, -7743, 
-    -7223, -6693, -6150, -5600, -5041, -4483, -3920, -3364, -2806, -2264, -1720, -1196, -673, -172, 325, 805, 
-    1278, 1737, 2185, 2625, 3055, 3479, 3898, 4311, 4725, 5131, 5539, 5940, 6347, 6742, 7140, 7529, 
-    7914, 8288, 8653, 9007, 9347, 9671, 9976, 10264, 10529, 10776, 11000, 11201, 11380, 11537, 11673, 11786, 
-    11881, 11953, 12011, 12049, 12075, 12084, 12085, 12072, 12051, 12020, 11982, 11937, 11883, 11827, 11763, 11695, 
-    11621, 11542, 11458, 11365, 11268, 11159, 11045, 10917, 10781, 10630, 10466, 10284, 10088, 9872, 9639, 9381, 
-    9105, 8804, 8481, 8134, 7764, 7369, 6954, 6514, 6056, 5576, 5079, 4566, 4038, 3497, 2947, 2389, 
-    1825, 1259, 690, 127, -437, -991, -1540, -2080, -2610, -3129, -3633, -4128, -4606, -5072, -5523, -5958, 
-    -6380, -6787, -7178, -7553, -7915, -8264, -8595, -8915, -9221, -9515, -9795, -10063, -10321, -10563, -10797, -11015, 
-    -11225, -11419, -11602, -11769, -11922, -12061, -12182, -12290, -12380, -12454, -12512, -12550, -12575, -12577, -12565, -12528, 
-    -12478, -12403, -12313, -12199, -12071, -11921, -11757, -11573, -11376, -11163, -10935, -10695, -10439, -10173, -9889, -9600, 
-    -9292, -8979, -8647, -8312, -7963, -7611, -7246, -6881, -6505, -6133, -5750, -5373, -4986, -4606, -4220, -3838, 
-    -3454, -3072, -2690, -2309, -1928, -1549, -1166, -788, -405, -27, 355, 735, 1117, 1496, 1877, 2254, 
-    2630, 3001, 3368, 3729, 4084, 4431, 4769, 5097, 5416, 5725, 6021, 6307, 6579, 6841, 7090, 7327, 
-    7556, 7770, 7981, 8177, 8372, 8551, 8732, 8898, 9065, 9216, 9369, 9506, 9644, 9763, 9880, 9983, 
-    10076, 10156, 10221, 10275, 10310, 10332, 10333, 10319, 10285, 10234, 10160, 10071, 9958, 9830, 9678, 9511, 
-    9324, 9123, 8907, 8679, 8440, 8191, 7934, 7672, 7404, 7136, 6863, 6593, 6320, 6050, 5781, 5515, 
-    5248, 4983, 4719, 4457, 4191, 3927, 3660, 3392, 3117, 2842, 2561, 2274, 1983, 1687, 1383, 1078, 
-    765, 452, 133, -182, -499, -813, -1122, -1425, -1721, -2007, -2283, -2547, -2802, -3041, -3268, -3482, 
-    -3683, -3872, -4046, -4210, -4360, -4501, -4632, -4750, -4863, -4963, -5063, -5148, -5233, -5306, -5380, -5441, 
-    -5502, -5553, -5602, -5640, -5675, -5701, -5720, -5731, -5736, -5734, -5722, -5707, -5684, -5657, -5626, -5590, 
-    -5552, -5512, -5472, -5430, -5388, -5344, -5303, -5255, -5215, -5164, -5121, -5069, -5021, -4968, -4912, -4855, 
-    -4791, -4729, -4657, -4588, -4509, -4433, -4348, -4265, -4175, -4086, -3993, -3901, -3807, -3712, -3618, -3524, 
-    -3430, -3337, -3244, -3154, -3064, -2973, -2886, -2798, -2712, -2623, -2536, -2447, -2356, -2263, -2167, -2069, 
-    -1965, -1860, -1750, -1637, -1519, -1397, -1272, -1142, -1008, -872, -731, -586, -441, -292, -143, 8, 
-    156, 306, 453, 596, 735, 869, 998, 1119, 1236, 1345, 1449, 1543, 1634, 1715, 1793, 1862, 
-    1927, 1986, 2043, 2094, 2145, 2192, 2240, 2284, 2330, 2375, 2422, 2466, 2514, 2560, 2609, 2657, 
-    2708, 2757, 2806, 2853, 2902, 2946, 2994, 3034, 3080, 3117, 3163, 3198, 3239, 3276, 3316, 3352, 
-    3389, 3429, 3467, 3507, 3550, 3593, 3642, 3692, 3748, 3807, 3873, 3941, 4017, 4097, 4183, 4272, 
-    4367, 4463, 4560, 4657, 4753, 4843, 4934, 5015, 5093, 5158, 5220, 5266, 5306, 5329, 5344, 5341, 
-    5328, 5299, 5256, 5203, 5131, 5052, 4956, 4854, 4735, 4611, 4473, 4330, 4176, 4019, 3850, 3682, 
-    3502, 3324, 3138, 2950, 2757, 2563, 2366, 2167, 1966, 1765, 1562, 1360, 1157, 955, 753, 556, 
-    357, 164, -29, -216, -405, -587, -768, -942, -1117, -1283, -1446, -1604, -1758, -1905, -2049, -2185, 
-    -2320, -2446, -2568, -2686, -2797, -2905, -3006, -3102, -3195, -3282, -3368, -3447, -3526, -3601, -3677, -3751, 
-    -3826, -3902, -3980, -4060, -4145, -4231, -4327, -4420, -4528, -4631, -4748, -4862, -4986, -5110, -5239, -5371, 
-    -5504, -5637, -5770, -5902, -6031, -6156, -6275, -6391, -6498, -6599, -6688, -6771, -6844, -6905, -6955, -6993, 
-    -7019, -7032, -7029, -7014, -6983, -6938, -6877, -6801, -6708, -6599, -6472, -6330, -6171, -5995, -5806, -5601, 
-    -5382, -5149, -4907, -4649, -4385, -4110, -3831, -3547, -3259, -2969, -2678, -2391, -2104, -1822, -1544, -1274, 
-    -1011, -752, -502, -260, -24, 207, 430, 649, 863, 1073, 1282, 1487, 1692, 1894, 2098, 2299, 
-    2502, 2704, 2905, 3105, 3302, 3500, 3692, 3883, 4065, 4247, 4417, 4585, 4740, 4892, 5031, 5162, 
-    5287, 5399, 5508, 5603, 5700, 5783, 5867, 5943, 6021, 6093, 6167, 6238, 6313, 6384, 6461, 6534, 
-    6611, 6685, 6761, 6836, 6908, 6980, 7049, 7114, 7175, 7230, 7281, 7322, 7357, 7382, 7397, 7401, 
-    7393, 7371, 7336, 7288, 7223, 7145, 7050, 6943, 6814, 6676, 6515, 6345, 6153, 5951, 5731, 5498, 
-    5252, 4992, 4722, 4442, 4152, 3855, 3551, 3241, 2929, 2610, 2292, 1970, 1649, 1328, 1005, 690, 
-    372, 62, -245, -546, -843, -1132, -1413, -1687, -1952, -2206, -2451, -2684, -2908, -3120, -3318, -3506, 
-    -3679, -3843, -3989, -4128, -4248, -4360, -4458, -4546, -4622, -4686, -4745, -4792, -4835, -4867, -4897, -4920, 
-    -4941, -4958, -4972, -4986, -4995, -5008, -5014, -5023, -5028, -5035, -5039, -5042, -5042, -5042, -5038, -5033, 
-    -5020, -5008, -4988, -4965, -4935, -4898, -4856, -4805, -4747, -4682, -4608, -4529, -4440, -4348, -4248, -4142, 
-    -4036, -3923, -3812, -3696, -3585, -3474, -3365, -3256, -3157, -3055, -2964, -2870, -2788, -2703, -2626, -2549, 
-    -2477, -2401, -2330, -2254, -2181, -2099, -2018, -1926, -1835, -1731, -1622, -1503, -1379, -1243, -1102, -953, 
-    -799, -639, -477, -311, -147, 16, 177, 335, 487, 633, 773, 903, 1023, 1139, 1238, 1332, 
-    1410, 1487, 1545, 1600, 1642, 1680, 1706, 1728, 1742, 1751, 1755, 1754, 1750, 1741, 1731, 1716, 
-    1700, 1682, 1661, 1641, 1618, 1596, 1573, 1553, 1532, 1515, 1500, 1488, 1480, 1475, 1477, 1479, 
-    1489, 1504, 1521, 1548, 1571, 1609, 1639, 1684, 1721, 1771, 1813, 1864, 1910, 1961, 2006, 2053, 
-    2096, 2137, 2177, 2211, 2245, 2273, 2303, 2329, 2353, 2377, 2401, 2426, 2452, 2479, 2510, 2544, 
-    2579, 2622, 2665, 2715, 2766, 2822, 2881, 2940, 3003, 3063, 3125, 3182, 3238, 3289, 3334, 3373, 
-    3404, 3428, 3444, 3450, 3451, 3438, 3423, 3395, 3366, 3326, 3281, 3233, 3177, 3122, 3060, 2999, 
-    2934, 2872, 2807, 2747, 2682, 2625, 2564, 2508, 2450, 2399, 2345, 2295, 2244, 2196, 2148, 2100, 
-    2054, 2005, 1959, 1906, 1858, 1801, 1748, 1685, 1627, 1557, 1490, 1410, 1333, 1243, 1152, 1051, 
-    948, 833, 714, 587, 455, 313, 163, 9, -154, -323, -500, -680, -870, -1063, -1259, -1461, 
-    -1664, -1872, -2076, -2285, -2490, -2697, -2900, -3103, -3302, -3499, -3693, -3884, -4069, -4253, -4428, -4602, 
-    -4766, -4928, -5081, -5231, -5373, -5511, -5641, -5766, -5888, -6002, -6113, -6217, -6321, -6413, -6509, -6594, 
-    -6678, -6753, -6827, -6894, -6954, -7009, -7055, -7095, -7124, -7146, -7155, -7152, -7139, -7112, -7071, -7016, 
-    -6946, -6860, -6759, -6642, -6511, -6362, -6202, -6025, -5837, -5635, -5425, -5202, -4974, -4736, -4496, -4249, 
-    -4002, -3752, -3500, -3251, -3000, -2755, -2508, -2268, -2027, -1793, -1560, -1332, -1108, -886, -670, -456, 
-    -247, -38, 165, 369, 569, 772, 971, 1173, 1373, 1578, 1783, 1994, 2207, 2428, 2652, 2886, 
-    3126, 3372, 3632, 3894, 4173, 4450, 4745, 5035, 5343, 5643, 5957, 6263, 6575, 6880, 7185, 7481, 
-    7769, 8050, 8320, 8579, 8824, 9057, 9273, 9477, 9661, 9833, 9984, 10122, 10242, 10344, 10433, 10500, 
-    10555, 10588, 10612, 10613, 10604, 10573, 10532, 10468, 10395, 10301, 10194, 10069, 9930, 9774, 9604, 9420, 
-    9221, 9009, 8786, 8548, 8299, 8038, 7765, 7481, 7186, 6880, 6562, 6237, 5897, 5549, 5192, 4827, 
-    4449, 4068, 3674, 3280, 2873, 2468, 2052, 1640, 1223, 806, 389, -24, -434, -843, -1245, -1641, 
-    -2032, -2415, -2792, -3161, -3523, -3877, -4224, -4566, -4897, -5228, -5545, -5866, -6173, -6485, -6784, -7085, 
-    -7378, -7669, -7952, -8233, -8507, -8773, -9034, -9285, -9530, -9761, -9987, -10197, -10399, -10584, -10759, -10918, 
-    -11063, -11192, -11308, -11407, -11490, -11559, -11609, -11646, -11664, -11671, -11655, -11631, -11584, -11528, -11453, -11365, 
-    -11260, -11143, -11008, -10860, -10696, -10520, -10326, -10119, -9898, -9663, -9414, -9152, -8878, -8592, -8294, -7987, 
-    -7668, -7341, -7002, -6657, -6301, -5938, -5565, -5187, -4799, -4404, -4004, -3594, -3180, -2755, -2329, -1891, 
-    -1451, -1003, -551, -95, 367, 830, 1300, 1766, 2238, 2707, 3176, 3645, 4105, 4567, 5018, 5466, 
-    5903, 6332, 6749, 7157, 7550, 7931, 8296, 8650, 8985, 9307, 9610, 9901, 10170, 10427, 10661, 10885, 
-    11084, 11270, 11435, 11584, 11713, 11825, 11918, 11995, 12053, 12093, 12117, 12124, 12115, 12090, 12050, 11996, 
-    11925, 11842, 11742, 11632, 11503, 11367, 11210, 11046, 10863, 10669, 10460, 10238, 10002, 9751, 9487, 9208, 
-    8919, 8612, 8296, 7966, 7627, 7274, 6916, 6546, 6171, 5788, 5403, 5012, 4619, 4223, 3829, 3432, 
-    3039, 2643, 2251, 1858, 1468, 1080, 690, 304, -85, -468, -858, -1244, -1631, -2017, -2405, -2790, 
-    -3175, -3556, -3937, -4311, -4682, -5045, -5404, -5751, -6092, -6419, -6738, -7041, -7332, -7608, -7870, -8118, 
-    -8348, -8566, -8765, -8952, -9122, -9279, -9422, -9551, -9667, -9771, -9863, -9943, -10013, -10071, -10116, -10154, 
-    -10178, -10192, -10193, -10183, -10161, -10124, -10075, -10010, -9933, -9838, -9727, -9602, -9457, -9301, -9122, -8936, 
-    -8725, -8507, -8268, -8021, -7756, -7482, -7196, -6900, -6596, -6284, -5963, -5639, -5307, -4975, -4634, -4296, 
-    -3951, -3609, -3263, -2919, -2573, -2229, -1887, -1545, -1206, -870, -536, -206, 119, 439, 756, 1067, 
-    1373, 1673, 1968, 2256, 2538, 2815, 3084, 3350, 3608, 3862, 4108, 4349, 4585, 4814, 5039, 5254, 
-    5466, 5669, 5870, 6059, 6245, 6420, 6588, 6748, 6898, 7037, 7168, 7283, 7391, 7481, 7563, 7630, 
-    7683, 7723, 7748, 7760, 7760, 7743, 7718, 7674, 7624, 7557, 7482, 7393, 7296, 7188, 7070, 6944, 
-    6810, 6668, 6518, 6362, 6199, 6028, 5853, 5670, 5484, 5289, 5092, 4886, 4678, 4462, 4244, 4020, 
-    3791, 3558, 3321, 3079, 2833, 2584, 2327, 2069, 1806, 1539, 1270, 994, 722, 440, 164, -115, 
-    -392, -671, -944, -1215, -1481, -1741, -1993, -2238, -2473, -2698, -2912, -3113, -3301, -3478, -3639, -3788, 
-    -3923, -4044, -4152, -4246, -4327, -4397, -4453, -4500, -4536, -4563, -4581, -4591, -4598, -4592, -4587, -4572, 
-    -4557, -4535, -4513, -4485, -4457, -4423, -4391, -4353, -4318, -4274, -4234, -4185, -4137, -4083, -4027, -3963, 
-    -3896, -3822, -3741, -3654, -3556, -3454, -3341, -3222, -3090, -2956, -2809, -2659, -2500, -2339, -2171, -2002, 
-    -1830, -1659, -1488, -1318, -1151, -987, -829, -674, -525, -382, -244, -114, 13, 131, 247, 358, 
-    463, 568, 665, 767, 860, 958, 1053, 1150, 1246, 1345, 1442, 1545, 1644, 1747, 1848, 1950, 
-    2052, 2151, 2250, 2345, 2435, 2523, 2602, 2678, 2743, 2802, 2850, 2888, 2916, 2932, 2936, 2928, 
-    2909, 2878, 2835, 2782, 2718, 2645, 2562, 2473, 2377, 2275, 2169, 2059, 1946, 1833, 1717, 1604, 
-    1487, 1374, 1262, 1152, 1043, 936, 831, 727, 626, 523, 427, 324, 230, 130, 36, -61, 
-    -154, -247, -340, -429, -518, -602, -687, -764, -842, -911, -981, -1042, -1103, -1155, -1206, -1250, 
-    -1290, -1327, -1356, -1385, -1407, -1427, -1441, -1453, -1460, -1465, -1464, -1462, -1455, -1447, -1433, -1419, 
-    -1401, -1382, -1358, -1332, -1303, -1273, -1238, -1202, -1160, -1119, -1070, -1021, -967, -910, -848, -784, 
-    -717, -647, -574, -499, -421, -342, -263, -180, -98, -15, 64, 149, 229, 312, 390, 471, 
-    547, 626, 700, 777, 849, 925, 998, 1074, 1147, 1221, 1295, 1367, 
-};
-const unsigned int drum_v0_p2_short_len = 5292;
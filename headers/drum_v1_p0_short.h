@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v1_p0_short[] PROGMEM = {
-    -14, 0, 9, 12, 26, 18, 38, 22, 39, 23, 35, 16, 29, 13, 11, 9, 
-    -5, -2, -16, -20, -29, -38, -47, -51, -67, -68, -86, -92, -102, -115, -124, -134, 
-    -150, -158, -172, -187, -195, -213, -225, -239, -253, -270, -279, -300, -309, -327, -345, -351, 
-    -377, -377, -409, -406, -434, -438, -455, -470, -479, -496, -505, -521, -529, -545, -551, -569, 
-    -573, -586, -598, -604, -619, -626, -636, -643, -660, -657, -682, -676, -696, -700, -712, -721, 
-    -727, -741, -745, -761, -763, -779, -782, -799, -801, -818, -821, -836, -838, -856, -854, -875, 
-    -869, -892, -884, -906, -900, -916, -919, -920, -933, -929, -937, -941, -942, -941, -948, -940, 
-    -951, -941, -946, -939, -940, -936, -932, -928, -923, -918, -915, -902, -902, -889, -885, -876, 
-    -868, -857, -849, -839, -824, -821, -803, -794, -783, -765, -758, -736, -730, -708, -696, -678, 
-    -658, -644, -627, -606, -594, -559, -560, -520, -517, -486, -469, -447, -427, -405, -382, -364, 
-    -335, -326, -289, -281, -246, -238, -205, -192, -163, -150, -122, -106, -83, -61, -43, -23, 
-    0, 10, 44, 48, 84, 86, 119, 130, 150, 173, 183, 210, 222, 245, 258, 281, 
-    294, 319, 329, 354, 368, 388, 407, 426, 444, 461, 484, 497, 523, 533, 560, 572, 
-    597, 610, 633, 647, 669, 681, 702, 716, 733, 753, 757, 783, 788, 808, 817, 831, 
-    841, 854, 863, 873, 883, 892, 900, 909, 916, 925, 929, 939, 944, 949, 957, 961, 
-    967, 973, 976, 980, 983, 990, 988, 995, 994, 998, 994, 1002, 990, 1002, 987, 993, 
-    983, 982, 975, 966, 963, 946, 945, 927, 920, 906, 892, 875, 866, 840, 834, 805, 
-    798, 771, 755, 734, 711, 695, 669, 650, 626, 604, 580, 557, 536, 508, 488, 460, 
-    434, 411, 382, 357, 328, 301, 270, 241, 212, 179, 149, 115, 81, 50, 12, -22, 
-    -55, -98, -127, -170, -204, -246, -281, -322, -361, -397, -440, -474, -517, -552, -595, -627, 
-    -671, -706, -741, -782, -811, -853, -883, -921, -951, -986, -1015, -1050, -1078, -1108, -1139, -1162, 
-    -1195, -1215, -1247, -1266, -1294, -1310, -1340, -1352, -1382, -1392, -1419, -1428, -1452, -1462, -1482, -1491, 
-    -1508, -1515, -1530, -1537, -1547, -1555, -1558, -1567, -1569, -1571, -1576, -1568, -1577, -1566, -1568, -1557, 
-    -1556, -1544, -1540, -1519, -1517, -1493, -1487, -1462, -1450, -1425, -1407, -1381, -1357, -1332, -1305, -1276, 
-    -1249, -1209, -1189, -1142, -1121, -1075, -1040, -1005, -958, -926, -878, -838, -794, -747, -704, -654, 
-    -610, -556, -511, -455, -410, -350, -304, -247, -191, -139, -80, -26, 34, 87, 150, 206, 
-    264, 329, 383, 447, 507, 570, 626, 693, 750, 813, 877, 934, 998, 1059, 1120, 1182, 
-    1238, 1305, 1357, 1426, 1474, 1541, 1591, 1656, 1703, 1766, 1812, 1872, 1915, 1976, 2013, 2071, 
-    2110, 2155, 2206, 2237, 2287, 2317, 2358, 2390, 2429, 2452, 2488, 2511, 2538, 2558, 2585, 2597, 
-    2620, 2632, 2644, 2657, 2662, 2670, 2671, 2677, 2667, 2672, 2660, 2653, 2643, 2621, 2616, 2583, 
-    2573, 2539, 2515, 2484, 2453, 2413, 2379, 2332, 2295, 2244, 2197, 2147, 2088, 2040, 1972, 1917, 
-    1851, 1784, 1718, 1647, 1575, 1498, 1425, 1343, 1265, 1182, 1097, 1010, 924, 833, 744, 652, 
-    553, 465, 361, 267, 167, 65, -35, -137, -243, -347, -451, -559, -668, -774, -885, -993, 
-    -1105, -1210, -1332, -1428, -1556, -1653, -1777, -1880, -1999, -2103, -2219, -2326, -2440, -2543, -2660, -2758, 
-    -2873, -2973, -3081, -3182, -3286, -3384, -3486, -3583, -3679, -3777, -3868, -3960, -4051, -4140, -4229, -4309, 
-    -4400, -4472, -4562, -4635, -4710, -4787, -4855, -4928, -4993, -5058, -5120, -5180, -5238, -5291, -5341, -5390, 
-    -5433, -5476, -5513, -5545, -5580, -5595, -5627, -5633, -5655, -5655, -5659, -5657, -5646, -5637, -5613, -5592, 
-    -5559, -5525, -5484, -5433, -5381, -5323, -5254, -5186, -5105, -5024, -4932, -4838, -4733, -4629, -4510, -4395, 
-    -4264, -4137, -3992, -3856, -3694, -3552, -3377, -3218, -3042, -2859, -2682, -2484, -2293, -2092, -1883, -1678, 
-    -1458, -1241, -1016, -785, -559, -315, -83, 164, 405, 657, 901, 1164, 1404, 1675, 1916, 2184, 
-    2436, 2693, 2953, 3205, 3466, 3712, 3978, 4211, 4478, 4708, 4961, 5197, 5436, 5666, 5899, 6118, 
-    6345, 6553, 6773, 6973, 7179, 7370, 7566, 7744, 7930, 8094, 8271, 8420, 8588, 8723, 8877, 9003, 
-    9138, 9256, 9374, 9485, 9582, 9687, 9766, 9859, 9928, 10002, 10065, 10122, 10170, 10218, 10251, 10287, 
-    10309, 10325, 10345, 10341, 10352, 10336, 10328, 10312, 10285, 10258, 10217, 10183, 10129, 10084, 10020, 9959, 
-    9892, 9812, 9739, 9649, 9561, 9467, 9363, 9257, 9147, 9025, 8911, 8777, 8641, 8508, 8355, 8211, 
-    8046, 7888, 7712, 7541, 7353, 7161, 6968, 6754, 6547, 6322, 6093, 5855, 5609, 5347, 5093, 4810, 
-    4536, 4238, 3939, 3628, 3312, 2978, 2643, 2294, 1941, 1572, 1201, 818, 424, 32, -385, -791, 
-    -1216, -1647, -2078, -2526, -2970, -3426, -3886, -4350, -4817, -5292, -5767, -6245, -6729, -7215, -7692, -8188, 
-    -8660, -9161, -9631, -10124, -10594, -11078, -11543, -12013, -12472, -12930, -13370, -13817, -14236, -14665, -15066, -15467, 
-    -15851, -16220, -16578, -16924, -17244, -17567, -17854, -18137, -18396, -18642, -18866, -19079, -19266, -19434, -19595, -19721, 
-    -19843, -19940, -20018, -20084, -20128, -20156, -20174, -20167, -20153, -20121, -20073, -20023, -19944, -19873, -19771, -19680, 
-    -19562, -19450, -19314, -19187, -19041, -18893, -18740, -18574, -18411, -18233, -18052, -17862, -17669, -17462, -17250, -17028, 
-    -16793, -16553, -16298, -16026, -15751, -15453, -15145, -14826, -14481, -14136, -13763, -13383, -12986, -12574, -12156, -11719, 
-    -11280, -10825, -10371, -9906, -9442, -8981, -8509, -8057, -7591, -7150, -6703, -6273, -5847, -5436, -5024, -4637, 
-    -4239, -3863, -3476, -3101, -2713, -2330, -1924, -1510, -1077, -615, -133, 393, 952, 1550, 2202, 2893, 
-    3642, 4447, 5301, 6218, 7186, 8241, 9332, 10460, 11646, 12850, 14107, 15360, 16651, 17934, 19230, 20508, 
-    21772, 23010, 24238, 25431, 26582, 27684, 27793, 27786, 27793, 27788, 27790, 27792, 27789, 27791, 27790, 27789, 
-    27792, 27790, 27789, 27791, 27789, 27790, 27792, 27789, 27791, 27791, 27788, 27795, 27785, 27796, 27787, 27789, 
-    27792, 27786, 27796, 27784, 27795, 27781, 27796, 27784, 27792, 27790, 27789, 27792, 27789, 27790, 27792, 27788, 
-    27792, 27789, 27790, 27789, 27790, 27790, 27791, 27788, 27793, 27784, 27796, 27785, 26412, 24957, 23495, 22022, 
-    20557, 19086, 17603, 16148, 14698, 13278, 11863, 10481, 9116, 7821, 6551, 5352, 4184, 3082, 2040, 1061, 
-    147, -720, -1536, -2332, -3083, -3835, -4548, -5269, -5947, -6650, -7342, -8056, -8778, -9508, -10255, -11005, 
-    -11777, -12560, -13395, -14252, -15148, -16062, -16991, -17937, -18891, -19857, -20823, -21783, -22750, -23705, -24664, -25606, 
-    -26530, -27425, -27844, -27842, -27844, -27843, -27842, -27845, -27842, -27845, -27840, -27845, -27841, -27844, -27841, -27843, 
-    -27842, -27841, -27844, -27839, -27845, -27840, -27846, -27840, -27844, -27840, -27844, -27843, -27845, -27840, -27845, -27843, 
-    -27843, -27844, -27842, -27845, -27840, -27848, -27838, -27847, -27839, -27846, -27841, -27841, -27842, -27838, -27847, -27837, 
-    -27846, -27840, -27846, -27840, -27847, -27839, -27845, -27845, -27836, -27851, -27835, -27850, -27839, -27845, -27840, -27845, 
-    -27841, -27843, -27842, -27841, -27845, -27840, -27847, -27838, -27848, -27842, -27710, -26187, -24638, -23062, -21478, -19863, 
-    -18249, -16616, -14995, -13373, -11774, -10197, -8644, -7136, -5642, -4189, -2755, -1348, 35, 1392, 2723, 4027, 
-    5304, 6563, 7796, 9023, 10218, 11413, 12566, 13721, 14845, 15956, 17058, 18143, 19222, 20304, 21367, 22459, 
-    23524, 24613, 25692, 26768, 27793, 27786, 27795, 27786, 27794, 27788, 27793, 27787, 27793, 27788, 27790, 27790, 
-    27791, 27789, 27790, 27790, 27790, 27791, 27790, 27790, 27790, 27789, 27790, 27791, 27790, 27789, 27792, 27788, 
-    27794, 27789, 27791, 27789, 27791, 27790, 27790, 27792, 27787, 27794, 27788, 27793, 27789, 27789, 27792, 27788, 
-    27793, 27789, 27789, 27792, 27787, 27794, 27788, 27791, 27791, 27789, 27789, 27794, 27784, 27798, 27783, 27798, 
-    27784, 27795, 27786, 27793, 27788, 27794, 27788, 27792, 27789, 27790, 27790, 27791, 27788, 27793, 27788, 27792, 
-    27789, 27793, 27787, 27795, 27788, 27791, 27789, 26878, 25162, 23438, 21679, 19906, 18113, 16308, 14493, 12673, 
-    10834, 8985, 7125, 5264, 3397, 1544, -310, -2143, -3968, -5774, -7543, -9298, -11005, -12692, -14328, -15937, 
-    -17491, -19018, -20491, -21931, -23334, -24693, -26031, -27326, -27840, -27846, -27841, -27846, -27842, -27844, -27840, -27848, 
-    -27838, -27848, -27840, -27843, -27844, -27842, -27845, -27840, -27847, -27838, -27847, -27838, -27847, -27839, -27845, -27843, 
-    -27840, -27848, -27835, -27849, -27838, -27847, -27843, -27841, -27846, -27838, -27847, -27840, -27843, -27841, -27843, -27842, 
-    -27842, -27846, -27840, -27848, -27839, -27846, -27841, -27845, -27840, -27845, -27838, -27846, -27842, -27842, -27844, -27841, 
-    -27843, -27844, -27843, -27845, -27841, -27844, -27843, -27843, -27845, -27840, -27845, -27838, -27848, -27837, -27850, -27834, 
-    -27850, -27835, -27847, -27839, -27843, -27844, -27843, -27844, -27842, -27845, -27839, -27845, -27841, -27845, -27841, -27845, 
-    -27839, -26285, -23881, -21470, -19025, -16571, -14107, -11626, -9167, -6690, -4246, -1800, 606, 2994, 5353, 7674, 
-    9978, 12229, 14456, 16636, 18774, 20867, 22919, 24917, 26875, 27793, 27786, 27795, 27788, 27791, 27793, 27785, 
-    27797, 27785, 27793, 27790, 27788, 27794, 27787, 27792, 27790, 27789, 27790, 27791, 27787, 27794, 27789, 27790, 
-    27792, 27788, 27792, 27789, 27790, 27791, 27789, 27791, 27791, 27788, 27793, 27789, 27790, 27791, 27789, 27793, 
-    27788, 27793, 27789, 27789, 27793, 27787, 27794, 27789, 27791, 27790, 27791, 27788, 27795, 27785, 27797, 27786, 
-    27793, 27789, 27790, 27789, 27789, 27789, 27790, 27790, 27789, 27792, 27787, 27793, 27790, 27789, 27791, 27790, 
-    27789, 27792, 27790, 27788, 27792, 27790, 27789, 27793, 27789, 27790, 27791, 27789, 27791, 27791, 27789, 27791, 
-    27790, 27789, 27792, 27788, 27792, 27789, 25552, 23277, 20953, 18623, 16254, 13883, 11490, 9094, 6690, 4293, 
-    1888, -486, -2864, -5202, -7532, -9826, -12102, -14338, -16555, -18724, -20879, -22968, -25053, -27067, -27847, -27841, 
-    -27842, -27846, -27839, -27847, -27841, -27844, -27844, -27842, -27843, -27844, -27842, -27844, -27843, -27842, -27844, -27844, 
-    -27839, -27848, -27839, -27846, -27843, -27842, -27844, -27841, -27845, -27844, -27842, -27844, -27843, -27841, -27847, -27841, 
-    -27845, -27843, -27843, -27844, -27842, -27846, -27840, -27845, -27841, -27839, -27846, -27835, -27848, -27838, -27845, -27844, 
-    -27842, -27843, -27841, -27843, -27843, -27844, -27843, -27844, -27841, -27844, -27842, -27842, -27843, -27839, -27845, -27838, 
-    -27847, -27837, -27848, -27839, -27842, -27844, -27841, -27845, -27840, -27846, -27835, -27848, -27836, -27847, -27840, -27848, 
-    -27838, -27848, -27838, -27848, -27838, -27846, -27838, -27844, -27843, -27843, -27844, -27843, -27748, -25759, -23737, -21666, 
-    -19575, -17436, -15287, -13108, -10917, -8718, -6507, -4306, -2110, 69, 2233, 4361, 6480, 8548, 10602, 12606, 
-    14594, 16529, 18453, 20309, 22172, 23961, 25756, 27497, 27792, 27790, 27789, 27794, 27787, 27794, 27788, 27793, 
-    27789, 27791, 27790, 27789, 27792, 27790, 27789, 27793, 27788, 27793, 27789, 27790, 27790, 27789, 27792, 27789, 
-    27789, 27790, 27789, 27791, 27789, 27788, 27791, 27787, 27790, 27791, 27786, 27792, 27789, 27790, 27789, 27791, 
-    27787, 27793, 27789, 27791, 27790, 27790, 27790, 27791, 27789, 27793, 27787, 27793, 27788, 27790, 27790, 27790, 
-    27788, 27794, 27788, 27790, 27792, 27789, 27792, 27788, 27793, 27786, 27795, 27786, 27795, 27786, 27792, 27789, 
-    27790, 27790, 27787, 27792, 27789, 27792, 27790, 27789, 27791, 27792, 27787, 27793, 27786, 27791, 27789, 27789, 
-    27791, 27788, 27779, 25960, 24136, 22285, 20422, 18539, 16643, 14715, 12789, 10820, 8852, 6845, 4837, 2792, 
-    747, -1330, -3411, -5514, -7617, -9746, -11867, -14011, -16146, -18289, -20427, -22556, -24683, -26784, -27849, -27838, 
-    -27847, -27841, -27841, -27844, -27842, -27845, -27841, -27842, -27840, -27846, -27837, -27846, -27842, -27840, -27846, -27837, 
-    -27844, -27841, -27844, -27843, -27841, -27846, -27835, -27850, -27836, -27845, -27844, -27840, -27848, -27839, -27847, -27840, 
-    -27847, -27842, -27843, -27843, -27843, -27842, -27842, -27844, -27840, -27845, -27843, -27844, -27843, -27844, -27843, -27844, 
-    -27844, -27840, -27845, -27841, -27843, -27843, -27843, -27841, -27843, -27843, -27842, -27847, -27839, -27846, -27841, -27844, 
-    -27844, -27842, -27844, -27843, -27843, -27842, -27845, -27842, -27844, -27845, -27841, -27846, -27842, -27844, -27841, -27846, 
-    -27837, -27848, -27838, -26389, -24423, -22448, -20457, -18452, -16430, -14406, -12358, -10318, -8261, -6208, -4153, -2102, 
-    -65, 1968, 3971, 5972, 7932, 9882, 11798, 13681, 15545, 17360, 19150, 20902, 22605, 24287, 25906, 27507, 
-    27789, 27789, 27793, 27785, 27795, 27786, 27793, 27789, 27789, 27792, 27789, 27791, 27791, 27787, 27795, 27785, 
-    27795, 27787, 27791, 27791, 27786, 27796, 27784, 27797, 27782, 27796, 27784, 27793, 27787, 27792, 27787, 27794, 
-    27786, 27793, 27789, 27790, 27788, 27795, 27785, 27796, 27786, 27792, 27787, 27792, 27788, 27790, 27792, 27787, 
-    27796, 27785, 27795, 27786, 27793, 27788, 27792, 27790, 27790, 27790, 27789, 27791, 27788, 27793, 27789, 27791, 
-    27791, 27789, 27791, 27791, 27789, 27793, 27788, 27793, 27787, 27792, 27790, 27790, 27790, 27790, 27788, 27794, 
-    27789, 27791, 27789, 27789, 27793, 27788, 26014, 24044, 22097, 20157, 18233, 16322, 14430, 12545, 10681, 8825, 
-    6980, 5137, 3310, 1476, -343, -2174, -3994, -5831, -7653, -9497, -11331, -13178, -15020, -16858, -18697, -20519, 
-    -22338, -24129, -25909, -27650, -27847, -27840, -27847, -27841, -27845, -27841, -27846, -27843, -27842, -27844, -27841, -27842, 
-    -27847, -27838, -27849, -27837, -27846, -27843, -27843, -27843, -27839, -27846, -27837, -27847, -27836, -27846, -27841, -27844, 
-    -27841, -27844, -27843, -27843, -27844, -27841, -27844, -27844, -27841, -27845, -27843, -27843, -27842, -27846, -27839, -27847, 
-    -27840, -27846, -27840, -27845, -27841, -27842, -27846, -27840, -27845, -27841, -27845, -27842, -27844, -27843, -27842, -27843, 
-    -27845, -27841, -27846, -27842, -27841, -27845, -27840, -27844, -27843, -27842, -27844, -27843, -27843, -27842, -27845, -27842, 
-    -27843, -27844, -27841, -27845, -27843, -27841, -27847, -27839, -27846, -27842, -27842, -26414, -24773, -23091, -21388, -19653, 
-    -17885, -16103, -14283, -12455, -10594, -8724, -6824, -4926, -2993, -1065, 891, 2857, 4832, 6834, 8832, 10857, 
-    12879, 14911, 16946, 18978, 21017, 23038, 25071, 27072, 27793, 27790, 27789, 27792, 27789, 27791, 27788, 27792, 
-    27788, 27794, 27786, 27794, 27785, 27796, 27783, 27798, 27784, 27797, 27784, 27795, 27786, 27793, 27787, 27792, 
-    27787, 27792, 27787, 27793, 27789, 27790, 27791, 27787, 27793, 27788, 27792, 27789, 27790, 27789, 27793, 27789, 
-    27792, 27788, 27790, 27791, 27789, 27789, 27792, 27786, 27792, 27788, 27791, 27789, 27789, 27793, 27786, 27794, 
-    27787, 27792, 27788, 27789, 27789, 27789, 27792, 27787, 27794, 27785, 27398, 26356, 25333, 24295, 23273, 22242, 
-    21238, 20221, 19241, 18247, 17291, 16329, 15396, 14464, 13552, 12648, 11746, 10864, 9964, 9085, 8182, 7297, 
-    6375, 5462, 4512, 3556, 2562, 1549, 501, -580, -1690, -2842, -4020, -5237, -6485, -7756, -9075, -10396, 
-    -11766, -13148, -14549, -15970, -17411, -18847, -20308, -21753, -23201, -24646, -26063, -27482, -27837, -27845, -27839, -27846, 
-    -27838, -27848, -27840, -27842, -27846, -27840, -27846, -27842, -27841, -27845, -27842, -27843, -27844, -27842, -27842, -27843, 
-    -27841, -27841, -27842, -27841, -27841, -27843, -27845, -27840, -27846, -27841, -27844, -27844, -27842, -27843, -27843, -27844, 
-    -27840, -27844, -27840, -27843, -27842, -27844, -27842, -27844, -27841, -27842, -27844, -27838, -27848, -27835, -27850, -27837, 
-    -27848, -27840, -27842, -27844, -27244, -25982, -24695, -23414, -22123, -20832, -19542, -18250, -16967, -15680, -14407, -13141, 
-    -11878, -10641, -9398, -8188, -6981, -5801, -4630, -3492, -2357, -1268, -182, 862, 1893, 2893, 3863, 4813, 
-    5725, 6613, 7473, 8304, 9111, 9893, 10654, 11394, 12120, 12828, 13526, 14218, 14897, 15578, 16256, 16931, 
-    17611, 18299, 18980, 19689, 20383, 21109, 21818, 22561, 23287, 24038, 24786, 25539, 26302, 27052, 27788, 27795, 
-    27786, 27794, 27789, 27791, 27790, 27791, 27788, 27790, 27789, 27789, 27791, 27789, 27792, 27789, 27789, 27792, 
-    27786, 27795, 27785, 27795, 27787, 27796, 27785, 27795, 27788, 27790, 27791, 27787, 27792, 27789, 27791, 27789, 
-    27793, 27787, 27794, 27787, 27792, 27789, 27790, 27791, 27789, 27791, 27604, 27013, 26401, 25755, 25086, 24374, 
-    23631, 22845, 22023, 21154, 20251, 19293, 18307, 17270, 16206, 15099, 13959, 12797, 11593, 10391, 9149, 7916, 
-    6663, 5419, 4175, 2949, 1738, 541, -623, -1765, -2875, -3943, -4985, -5982, -6947, -7864, -8758, -9598, 
-    -10426, -11202, -11975, -12702, -13432, -14124, -14819, -15499, -16168, -16843, -17497, -18173, -18824, -19498, -20149, -20814, 
-    -21469, -22125, -22776, -23423, -24054, -24683, -25290, -25885, -26458, -27009, -27539, -27840, -27843, -27843, -27842, -27845, 
-    -27839, -27845, -27840, -27844, -27843, -27841, -27843, -27841, -27843, -27842, -27844, -27843, -27843, -27843, -27843, -27845, 
-    -27842, -27843, -27843, -27842, -27845, -27843, -27843, -27843, -27843, -27843, -27845, -27841, -27844, -27782, -27387, -26982, 
-    -26530, -26074, -25576, -25056, -24504, -23926, -23309, -22665, -21986, -21273, -20529, -19749, -18938, -18097, -17224, -16321, 
-    -15396, -14440, -13472, -12479, -11479, -10463, -9440, -8414, -7383, -6357, -5325, -4312, -3294, -2296, -1309, -328, 
-    624, 1575, 2506, 3419, 4327, 5210, 6091, 6946, 7801, 8632, 9466, 10272, 11090, 11880, 12677, 13452, 
-    14231, 14990, 15742, 16483, 17208, 17922, 18614, 19295, 19948, 20590, 21200, 21790, 22356, 22894, 23403, 23886, 
-    24332, 24758, 25146, 25500, 25834, 26120, 26395, 26616, 26831, 26994, 27153, 27261, 27361, 27421, 27470, 27482, 
-    27482, 27452, 27400, 27331, 27232, 27126, 26985, 26838, 26673, 26479, 26292, 26062, 25837, 25581, 25318, 25038, 
-    24740, 24433, 24110, 23770, 23430, 23063, 22701, 22317, 21933, 21531, 21131, 20709, 20296, 19855, 19425, 18968, 
-    18516, 18044, 17569, 17073, 16574, 16055, 15528, 14989, 14426, 13861, 13267, 12676, 12052, 11428, 10775, 10115, 
-    9434, 8733, 8023, 7285, 6543, 5774, 4991, 4195, 3379, 2559, 1718, 870, 8, -849, -1730, -2598, 
-    -3482, -4363, -5237, -6118, -6982, -7845, -8697, -9532, -10356, -11158, -11944, -12710, -13451, -14170, -14863, -15531, 
-    -16171, -16791, -17371, -17938, -18469, -18977, -19462, -19914, -20359, -20762, -21168, -21535, -21895, -22240, -22558, -22872, 
-    -23167, -23447, -23716, -23968, -24205, -24430, -24632, -24819, -24980, -25127, -25239, -25336, -25395, -25432, -25435, -25401, 
-    -25341, -25240, -25109, -24941, -24743, -24507, -24249, -23956, -23640, -23298, -22939, -22560, -22159, -21755, -21332, -20908, 
-    -20482, -20051, -19619, -19207, -18776, -18381, -17970, -17588, -17198, -16835, -16460, -16108, -15748, -15397, -15041, -14686, 
-    -14324, -13943, -13563, -13155, -12736, -12296, -11830, -11339, -10828, -10283, -9710, -9117, -8489, -7843, -7172, -6484, 
-    -5771, -5051, -4310, -3564, -2810, -2051, -1291, -532, 217, 966, 1700, 2420, 3130, 3814, 4484, 5143, 
-    5765, 6389, 6979, 7555, 8124, 8656, 9192, 9694, 10202, 10669, 11156, 11599, 12053, 12489, 12914, 13339, 
-    13751, 14152, 14560, 14943, 15344, 15711, 16098, 16452, 16820, 17164, 17504, 17835, 18158, 18465, 18771, 19053, 
-    19330, 19591, 19827, 20054, 20253, 20430, 20585, 20715, 20811, 20888, 20924, 20942, 20918, 20874, 20787, 20688, 
-    20540, 20381, 20183, 19965, 19726, 19457, 19182, 18875, 18560, 18225, 17879, 17523, 17151, 16776, 16386, 15997, 
-    15593, 15200, 14785, 14391, 13977, 13586, 13174, 12785, 12376, 11989, 11590, 11199, 10808, 10420, 10035, 9646, 
-    9266, 8881, 8506, 8122, 7750, 7372, 7002, 6636, 6267, 5902, 5546, 5182, 4834, 4479, 4129, 3779, 
-    3434, 3078, 2737, 2380, 2033, 1679, 1324, 968, 609, 247, -114, -490, -852, -1239, -1600, -1997, 
-    -2359, -2762, -3129, -3528, -3909, -4298, -4692, -5082, -5474, -5868, -6260, -6652, -7051, -7442, -7840, -8229, 
-    -8626, -9010, -9403, -9777, -10157, -10524, -10886, -11240, -11580, -11913, -12226, -12537, -12812, -13091, -13332, -13570, 
-    -13772, -13967, -14127, -14277, -14396, -14501, -14578, -14637, -14679, -14692, -14701, -14675, -14652, -14593, -14544, -14461, 
-    -14375, -14287, -14169, -14071, -13944, -13822, -13701, -13562, -13436, -13296, -13151, -13017, -12857, -12718, -12552, -12391, 
-    -12216, -12035, -11837, -11629, -11407, -11163, -10915, -10634, -10351, -10042, -9725, -9391, -9042, -8689, -8319, -7950, 
-    -7570, -7190, -6809, -6429, -6052, -5687, -5320, -4980, -4639, -4329, -4025, -3748, -3491, -3255, -3042, -2861, 
-    -2688, -2557, -2428, -2340, -2253, -2204, -2148, -2126, -2094, -2088, -2069, -2065, -2051, -2034, -2012, -1979, 
-    -1936, -1879, -1811, -1723, -1631, -1509, -1384, -1236, -1072, -905, -706, -512, -289, -73, 163, 401, 
-    651, 901, 1166, 1419, 1690, 1952, 2221, 2485, 2755, 3008, 3280, 3525, 3791, 4032, 4291, 4531, 
-    4783, 5022, 5270, 5516, 5759, 6011, 6259, 6507, 6764, 7016, 7270, 7525, 7780, 8028, 8275, 8522, 
-    8748, 8982, 9191, 9390, 9582, 9742, 9894, 10022, 10124, 10209, 10262, 10293, 10299, 10275, 10237, 10164, 
-    10075, 9963, 9830, 9683, 9518, 9345, 9162, 8973, 8780, 8585, 8393, 8209, 8023, 7859, 7694, 7551, 
-    7416, 7303, 7199, 7118, 7052, 6998, 6972, 6949, 6948, 6959, 6974, 7006, 7037, 7072, 7115, 7140, 
-    7181, 7195, 7213, 7216, 7200, 7178, 7131, 7073, 6990, 6892, 6767, 6632, 6467, 6291, 6094, 5880, 
-    5651, 5408, 5154, 4885, 4614, 4327, 4044, 3753, 3456, 3176, 2875, 2611, 2326, 2071, 1822, 1584, 
-    1367, 1161, 973, 802, 648, 512, 390, 286, 193, 110, 42, -22, -78, -129, -183, -229, 
-    -281, -335, -392, -464, -538, -625, -725, -835, -957, -1101, -1239, -1415, -1581, -1773, -1969, -2175, 
-    -2385, -2612, -2823, -3051, -3266, -3478, -3693, -3883, -4077, -4247, -4416, -4558, -4695, -4806, -4918, -4992, 
-    -5082, -5119, -5184, -5201, -5238, -5245, -5266, -5263, -5280, -5277, -5295, -5305, -5327, -5358, -5388, -5440, 
-    -5493, -5557, -5638, -5718, -5822, -5927, -6041, -6172, -6294, -6436, -6573, -6712, -6855, -6994, -7122, -7255, 
-    -7373, -7480, -7589, -7671, -7748, -7812, -7855, -7888, -7909, -7905, -7907, -7878, -7855, -7813, -7763, -7721, 
-    -7653, -7604, -7534, -7476, -7418, -7350, -7299, -7245, -7188, -7157, -7099, -7080, -7039, -7025, -6993, -6989, 
-    -6966, -6965, -6958, -6949, -6956, -6945, -6949, -6944, -6937, -6930, -6913, -6896, -6872, -6836, -6802, -6751, 
-    -6703, -6630, -6571, -6469, -6391, -6268, -6162, -6019, -5884, -5713, -5554, -5358, -5165, -4949, -4724, -4484, 
-    -4234, -3972, -3697, -3415, -3117, -2811, -2499, -2177, -1851, -1520, -1185, -844, -510, -164, 167, 502, 
-    833, 1152, 1473, 1776, 2079, 2363, 2646, 2914, 3169, 3421, 3656, 3881, 4108, 4309, 4522, 4715, 
-    4911, 5102, 5286, 5477, 5658, 5852, 6036, 6228, 6419, 6617, 6809, 7016, 7210, 7417, 7623, 7825, 
-    8033, 8232, 8433, 8635, 8825, 9023, 9201, 9392, 9558, 9734, 9897, 10051, 10207, 10346, 10485, 10617, 
-    10738, 10861, 10969, 11085, 11187, 11292, 11391, 11483, 11582, 11669, 11761, 11845, 11929, 12007, 12085, 12153, 
-    12217, 12274, 12324, 12359, 12383, 12401, 12389, 12382, 12339, 12295, 12222, 12132, 12026, 11889, 11740, 11562, 
-    11362, 11147, 10901, 10641, 10358, 10053, 9741, 9389, 9050, 8665, 8292, 7886, 7486, 7060, 6646, 6203, 
-    5774, 5330, 4888, 4449, 4003, 3574, 3137, 2715, 2293, 1880, 1478, 1082, 696, 316, -44, -404, 
-    -749, -1082, -1407, -1718, -2016, -2309, -2582, -2853, -3102, -3350, -3578, -3804, -4012, -4214, -4406, -4587, 
-    -4766, -4934, -5094, -5258, -5399, -5555, -5693, -5829, -5968, -6094, -6220, -6345, -6459, -6578, -6687, -6793, 
-    -6895, -6985, -7087, -7161, -7254, -7325, -7398, -7471, -7529, -7596, -7646, -7706, -7752, -7804, -7852, -7898, 
-    -7948, -7989, -8046, -8086, -8141, -8193, -8240, -8309, -8356, -8423, -8484, -8546, -8615, -8678, -8743, -8811, 
-    -8872, -8936, -8992, -9046, -9099, -9143, -9187, -9220, -9248, -9271, -9281, -9291, -9281, -9283, -9252, -9234, 
-    -9200, -9151, -9117, -9046, -8997, -8924, -8853, -8778, -8688, -8609, -8510, -8416, -8319, -8210, -8111, -7993, 
-    -7890, -7759, -7657, -7517, -7401, -7264, -7123, -6985, -6831, -6678, -6511, -6346, -6166, -5988, -5791, -5596, 
-    -5376, -5165, -4919, -4689, -4425, -4169, -3889, -3605, -3309, -3008, -2694, -2379, -2057, -1729, -1402, -1066, 
-    -736, -407, -78, 241, 560, 867, 1166, 1457, 1726, 1996, 2236, 2473, 2690, 2886, 3075, 3238, 
-    3391, 3526, 3639, 3751, 3830, 3915, 3971, 4025, 4074, 4102, 4140, 4160, 4185, 4205, 4232, 4249, 
-    4284, 4306, 4348, 4387, 4435, 4489, 4550, 4618, 4693, 4779, 4866, 4968, 5065, 5172, 5285, 5396, 
-    5511, 5630, 5739, 5857, 5970, 6077, 6183, 6288, 6383, 6486, 6573, 6663, 6750, 6822, 6909, 6968, 
-    7051, 7106, 7182, 7236, 7308, 7365, 7433, 7504, 7567, 7650, 7721, 7811, 7895, 7990, 8088, 8192, 
-    8303, 8415, 8533, 8654, 8778, 8897, 9024, 9135, 9260, 9365, 9471, 9569, 9649, 9728, 9788, 9838, 
-    9869, 9887, 9888, 9874, 9836, 9783, 9710, 9619, 9513, 9383, 9240, 9078, 8902, 8708, 8506, 8281, 
-    8054, 7806, 7556, 7288, 7022, 6739, 6452, 6165, 5864, 5571, 5265, 4967, 4658, 4361, 4051, 3760, 
-    3454, 3170, 2877, 2597, 2326, 2055, 1801, 1552, 1313, 1087, 869, 665, 470, 291, 121, -32, 
-    -180, -310, -433, -541, -642, -736, -816, -894, -968, -1030, -1106, -1164, -1239, -1304, -1381, -1459, 
-    -1547, -1637, -1739, -1845, -1965, -2093, -2232, -2387, -2544, -2723, -2899, -3103, -3297, -3517, -3735, -3964, 
-    -4203, -4441, -4691, -4939, -5199, -5451, -5713, -5975, -6229, -6500, -6749, -7016, -7264, -7522, -7773, -8022, 
-    -8273, -8510, -8761, -8986, -9231, -9450, -9683, -9893, -10109, -10312, -10502, -10698, -10862, -11040, -11185, -11332, 
-    -11461, -11578, -11680, -11770, -11841, -11903, -11951, -11978, -12003, -12004, -11999, -11983, -11949, -11909, -11856, -11792, 
-    -11719, -11639, -11545, -11450, -11341, -11231, -11110, -10986, -10852, -10720, -10578, -10428, -10286, -10121, -9976, -9806, 
-    -9648, -9484, -9318, -9150, -8991, -8812, -8661, -8483, -8328, -8161, -8005, -7841, -7692, -7532, -7386, -7237, 
-    -7095, -6952, -6817, -6675, -6545, -6412, -6281, -6150, -6019, -5882, -5754, -5611, -5474, -5324, -5172, -5011, 
-    -4847, -4670, -4487, -4294, -4092, -3878, -3657, -3420, -3181, -2918, -2660, -2370, -2089, -1782, -1471, -1148, 
-    -808, -470, -103, 254, 641, 1024, 1423, 1833, 2245, 2671, 3095, 3539, 3974, 4427, 4872, 5331, 
-    5786, 6243, 6705, 7157, 7615, 8065, 8512, 8961, 9391, 9832, 10246, 10675, 11079, 11482, 11876, 12258, 
-    12635, 13000, 13359, 13705, 14046, 14371, 14694, 15010, 15306, 15605, 15881, 16165, 16423, 16684, 16924, 17161, 
-    17391, 17602, 17808, 18004, 18185, 18356, 18521, 18663, 18806, 18921, 19035, 19124, 19206, 19268, 19312, 19345, 
-    19350, 19344, 19318, 19266, 19203, 19108, 19005, 18865, 18720, 18532, 18342, 18109, 17873, 17598, 17317, 17001, 
-    16673, 16328, 15954, 15576, 15168, 14760, 14332, 13893, 13450, 12987, 12532, 12064, 11586, 11121, 10637, 10163, 
-    9689, 9205, 8737, 8256, 7786, 7315, 6841, 6377, 5906, 5441, 4970, 4508, 4037, 3579, 3099, 2643, 
-    2163, 1698, 1220, 739, 265, -225, -706, -1205, -1697, -2207, -2704, -3233, -3741, -4276, -4810, -5350, 
-    -5904, -6459, -7026, -7597, -8181, -8763, -9358, -9951, -10559, -11153, -11766, -12367, -12969, -13571, -14165, -14754, 
-    -15332, -15900, -16457, -16997, -17528, -18034, -18528, -18999, -19451, -19881, -20291, -20680, -21047, -21388, -21711, -22010, 
-    -22289, -22554, -22784, -23017, -23214, -23408, -23584, -23740, -23891, -24023, -24144, -24251, -24348, -24422, -24494, -24535, 
-    -24578, -24584, -24588, -24557, -24515, -24441, -24351, -24228, -24076, -23901, -23684, -23447, -23168, -22862, -22513, -22141, 
-    -21726, -21284, -20808, -20299, -19766, -19196, -18614, -17989, -17362, -16704, -16036, -15359, -14658, -13970, -13260, -12565, 
-    -11854, -11171, -10461, -9799, -9105, -8453, -7794, -7152, -6526, -5902, -5304, -4701, -4124, -3538, -2976, -2404, 
-    -1849, -1281, -725, -158, 409, 981, 1565, 2152, 2754, 3366, 3988, 4622, 5274, 5925, 6605, 7277, 
-    7973, 8666, 9372, 10074, 10783, 11484, 12187, 12871, 13565, 14224, 14886, 15526, 16140, 16749, 17321, 17883, 
-    18410, 18922, 19402, 19860, 20299, 20697, 21092, 21446, 21793, 22108, 22412, 22687, 22959, 23198, 23433, 23644, 
-    23852, 24033, 24218, 24375, 24529, 24670, 24801, 24914, 25026, 25113, 25203, 25259, 25322, 25347, 25374, 25368, 
-    25350, 25305, 25244, 25150, 25039, 24897, 24731, 24535, 24316, 24060, 23789, 23471, 23145, 22775, 22386, 21968, 
-    21521, 21055, 20562, 20047, 19516, 18958, 18392, 17797, 17200, 16579, 15953, 15314, 14667, 14012, 13350, 12690, 
-    12012, 11351, 10668, 10003, 9325, 8658, 7980, 7315, 6644, 5975, 5308, 4643, 3971, 3313, 2637, 1972, 
-    1304, 626, -42, -732, -1408, -2101, -2794, -3489, -4197, -4905, -5613, -6340, -7052, -7784, -8505, -9235, 
-    -9958, -10686, -11405, -12123, -12832, -13537, -14223, -14910, -15569, -16226, -16859, -17475, -18064, -18644, -19184, -19712, 
-    -20210, -20677, -21123, -21539, -21924, -22284, -22617, -22913, -23197, -23439, -23665, -23867, -24033, -24198, -24313, -24441, 
-    -24513, -24598, -24638, -24683, -24694, -24700, -24681, -24656, -24608, -24552, -24477, -24392, -24293, -24179, -24054, -23918, 
-    -23761, -23600, -23414, -23226, -23013, -22788, -22548, -22279, -22014, -21707, -21400, -21061, -20709, -20336, -19944, -19530, 
-    -19095, -18640, -18166, -17664, -17149, -16602, -16043, -15453, -14847, -14220, -13566, -12902, -12209, -11506, -10782, -10045, 
-    -9292, -8530, -7755, -6974, -6183, -5394, -4597, -3800, -3008, -2210, -1428, -640, 133, 905, 1661, 2414, 
-    3152, 3879, 4589, 5295, 5975, 6652, 7307, 7943, 8576, 9175, 9783, 10353, 10927, 11472, 12012, 12540, 
-    13050, 13553, 14042, 14520, 14993, 15442, 15899, 16324, 16758, 17165, 17567, 17960, 18335, 18701, 19057, 19387, 
-    19720, 20019, 20320, 20586, 20852, 21086, 21304, 21506, 21682, 21842, 21979, 22098, 22187, 22274, 22317, 22365, 
-    22368, 22375, 22344, 22314, 22247, 22180, 22081, 21983, 21851, 21724, 21564, 21406, 21220, 21034, 20825, 20606, 
-    20375, 20124, 19862, 19586, 19287, 18980, 18647, 18299, 17932, 17545, 17134, 16705, 16255, 15778, 15284, 14767, 
-    14223, 13668, 13079, 12474, 11857, 11204, 10555, 9869, 9180, 8472, 7754, 7022, 6283, 5533, 4778, 4014, 
-    3250, 2476, 1708, 928, 165, -613, -1373, -2145, -2900, -3652, -4406, -5135, -5881, -6590, -7316, -8014, 
-    -8713, -9392, -10066, -10722, -11371, -11998, -12618, -13215, -13801, -14365, -14912, -15436, -15941, -16423, -16882, -17314, 
-    -17724, -18105, -18463, -18788, -19090, -19362, -19606, -19827, -20013, -20177, -20315, -20426, -20515, -20584, -20624, -20652, 
-    -20651, -20642, -20607, -20560, -20499, -20421, -20332, -20233, -20118, -20003, -19867, -19731, -19576, -19423, -19248, -19078, 
-    -18875, -18684, -18459, -18234, -17989, -17724, -17452, -17148, -16833, -16492, -16129, -15751, -15337, -14915, -14451, -13985, 
-    -13485, -12970, -12432, -11878, -11304, -10724, -10117, -9513, -8888, -8257, -7627, -6981, -6342, -5699, -5049, -4419, 
-    -3768, -3149, -2510, -1898, -1279, -674, -78, 512, 1092, 1667, 2229, 2791, 3337, 3884, 4427, 4954, 
-    5492, 6015, 6539, 7060, 7578, 8091, 8604, 9108, 9616, 10116, 10605, 11098, 11572, 12052, 12513, 12968, 
-    13410, 13842, 14260, 14666, 15051, 15431, 15780, 16124, 16443, 16739, 17025, 17276, 17522, 17729, 17933, 18091, 
-    18253, 18369, 18479, 18559, 18621, 18656, 18677, 18671, 18649, 18609, 18541, 18470, 18362, 18257, 18118, 17973, 
-    17805, 17625, 17434, 17220, 17008, 16758, 16528, 16247, 15991, 15688, 15399, 15080, 14757, 14420, 14065, 13706, 
-    13327, 12943, 12539, 12126, 11700, 11259, 10811, 10344, 9867, 9381, 8880, 8370, 7848, 7313, 6773, 6219, 
-    5656, 5086, 4503, 3924, 3324, 2739, 2125, 1538, 921, 328, -282, -878, -1481, -2075, -2665, -3254, 
-    -3830, -4410, -4970, -5537, -6076, -6627, -7146, -7673, -8176, -8677, -9163, -9632, -10098, -10539, -10978, -11396, 
-    -11806, -12199, -12578, -12953, -13301, -13654, -13977, -14304, -14610, -14912, -15201, -15475, -15745, -16002, -16244, -16485, 
-    -16704, -16926, -17124, -17326, -17502, -17680, -17842, -17985, -18132, -18242, -18368, -18455, -18542, -18609, -18653, -18700, 
-    -18702, -18712, -18683, -18645, -18585, -18498, -18396, -18270, -18118, -17948, -17749, -17530, -17286, -17022, -16724, -16413, 
-    -16070, -15700, -15321, -14901, -14469, -14012, -13534, -13031, -12519, -11969, -11423, -10847, -10264, -9666, -9058, -8441, 
-    -7819, -7186, -6562, -5923, -5294, -4667, -4033, -3430, -2804, -2212, -1612, -1032, -453, 101, 661, 1197, 
-    1731, 2253, 2761, 3264, 3759, 4243, 4725, 5197, 5669, 6134, 6602, 7059, 7522, 7975, 8434, 8883, 
-    9344, 9779, 10235, 10670, 11101, 11538, 11941, 12365, 12751, 13147, 13513, 13874, 14213, 14537, 14842, 15129, 
-    15399, 15645, 15875, 16080, 16272, 16435, 16593, 16716, 16833, 16925, 16998, 17067, 17105, 17146, 17160, 17169, 
-    17170, 17153, 17139, 17102, 17075, 17018, 16984, 16912, 16862, 16788, 16721, 16644, 16563, 16480, 16386, 16295, 
-    16189, 16084, 15972, 15842, 15720, 15576, 15429, 15271, 15095, 14917, 14713, 14503, 14275, 14028, 13771, 13486, 
-    13187, 12870, 12527, 12169, 11785, 11383, 10959, 10514, 10050, 9563, 9062, 8535, 8001, 7438, 6873, 6282, 
-    5687, 5078, 4458, 3836, 3199, 2566, 1927, 1285, 649, 11, -620, -1251, -1865, -2488, -3086, -3691, 
-    -4269, -4851, -5407, -5968, -6502, -7031, -7548, -8044, -8537, -9007, -9474, -9918, -10354, -10773, -11182, -11578, 
-    -11963, -12325, -12693, -13028, -13373, -13688, -14006, -14299, -14600, -14867, -15148, -15394, -15651, -15879, -16111, -16319, 
-    -16520, -16714, -16879, -17053, -17191, -17329, -17452, -17550, -17650, -17715, -17787, -17821, -17858, -17870, -17863, -17851, 
-    -17804, -17757, -17681, -17593, -17485, -17363, -17215, -17068, -16884, -16701, -16498, -16272, -16053, -15797, -15546, -15276, 
-    -14988, -14703, -14390, -14076, -13749, -13408, -13060, -12702, -12328, -11952, -11562, -11170, -10767, -10360, -9945, -9531, 
-    -9102, -8689, -8247, -7832, -7390, -6965, -6527, -6101, -5661, -5236, -4801, -4368, -3943, -3505, -3084, -2647, 
-    -2226, -1790, -1365, -937, -503, -81, 353, 781, 1210, 1641, 2067, 2498, 2926, 3349, 3774, 4190, 
-    4609, 5014, 5424, 5818, 6214, 6596, 6971, 7340, 7696, 8048, 8385, 8712, 9033, 9336, 9634, 9922, 
-    10192, 10460, 10717, 10958, 11202, 11428, 11651, 11869, 12073, 12279, 12473, 12665, 12847, 13028, 13193, 13363, 
-    13517, 13668, 13816, 13937, 14075, 14183, 14290, 14387, 14467, 14534, 14602, 14632, 14673, 14678, 14678, 14664, 
-    14620, 14583, 14499, 14425, 14314, 14197, 14055, 13902, 13724, 13539, 13330, 13113, 12876, 12633, 12372, 12110, 
-    11828, 11551, 11253, 10968, 10657, 10361, 10054, 9745, 9445, 9132, 8831, 8525, 8221, 7923, 7618, 7323, 
-    7020, 6726, 6430, 6130, 5832, 5533, 5233, 4932, 4623, 4315, 4003, 3686, 3364, 3038, 2707, 2373, 
-    2027, 1690, 1334, 988, 628, 274, -88, -438, -801, -1149, -1503, -1844, -2184, -2514, -2836, -3151, 
-    -3450, -3746, -4027, -4298, -4554, -4806, -5034, -5264, -5470, -5678, -5859, -6046, -6207, -6367, -6521, -6655, 
-    -6790, -6916, -7025, -7146, -7241, -7344, -7432, -7520, -7600, -7680, -7745, -7815, -7875, -7928, -7981, -8019, 
-    -8062, -8090, -8116, -8132, -8145, -8145, -8151, -8137, -8125, -8103, -8081, -8048, -8020, -7976, -7941, -7893, 
-    -7854, -7804, -7760, -7714, -7663, -7620, -7563, -7525, -7463, -7423, -7367, -7310, -7267, -7203, -7149, -7096, 
-    -7026, -6972, -6901, -6832, -6762, -6686, -6609, -6526, -6444, -6350, -6267, -6166, -6076, -5975, -5873, -5773, 
-    -5668, -5562, -5461, -5350, -5245, -5139, -5032, -4927, -4822, -4715, -4614, -4506, -4411, -4303, -4207, -4106, 
-    -4008, -3909, -3812, -3710, -3616, -3511, -3414, -3306, -3206, -3093, -2987, -2870, -2752, -2636, -2508, -2386, 
-    -2250, -2122, -1976, -1844, -1689, -1550, -1390, -1242, -1080, -920, -756, -591, -422, -255, -84, 86, 
-    250, 423, 585, 752, 907, 1066, 1215, 1363, 1504, 1635, 1773, 1885, 2016, 2117, 2228, 2327, 
-    2418, 2509, 2589, 2667, 2739, 2806, 2871, 2931, 2989, 3047, 3098, 3154, 3205, 3255, 3308, 3356, 
-    3411, 3459, 3515, 3563, 3621, 3671, 3728, 3783, 3837, 3897, 3946, 4009, 4052, 4119, 4157, 4219, 
-    4265, 4312, 4367, 4405, 4458, 4502, 4544, 4590, 4629, 4681, 4711, 4770, 4791, 4855, 4885, 4935, 
-    4980, 5023, 5079, 5122, 5185, 5238, 5300, 5367, 5432, 5511, 5587, 5668, 5762, 5848, 5952, 6047, 
-    6156, 6261, 6371, 6479, 6590, 6698, 6804, 6906, 7006, 7102, 7184, 7276, 7337, 7417, 7461, 7518, 
-    7547, 7580, 7584, 7598, 7574, 7563, 7524, 7470, 7425, 7338, 7266, 7167, 7060, 6950, 6820, 6689, 
-    6545, 6389, 6232, 6061, 5887, 5711, 5515, 5336, 5129, 4936, 4728, 4522, 4313, 4092, 3884, 3653, 
-    3442, 3211, 2990, 2762, 2535, 2307, 2076, 1852, 1617, 1397, 1161, 945, 715, 495, 276, 56, 
-    -154, -369, -578, -786, -990, -1188, -1391, -1577, -1778, -1951, -2141, -2312, -2488, -2656, -2815, -2980, 
-    -3127, -3282, -3425, -3562, -3703, -3828, -3959, -4077, -4197, -4308, -4415, -4523, -4619, -4719, -4812, -4899, 
-    -4994, -5072, -5166, -5241, -5333, -5411, -5500, -5586, -5673, -5764, -5860, -5954, -6058, -6168, -6268, -6396, 
-    -6505, -6636, -6759, -6897, -7026, -7174, -7311, -7456, -7610, -7753, -7909, -8055, -8205, -8358, -8497, -8651, 
-    -8778, -8923, -9044, -9177, -9286, -9404, -9497, -9597, -9680, -9757, -9822, -9878, -9923, -9957, -9980, -9991, 
-    -9986, -9975, -9943, -9906, -9847, -9782, -9697, -9602, -9490, -9363, -9222, -9065, -8894, -8711, -8505, -8300, 
-    -8066, -7833, -7577, -7312, -7045, -6753, -6466, -6158, -5852, -5536, -5218, -4896, 
-};
-const unsigned int drum_v1_p0_short_len = 5292;
@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v1_p1_short[] PROGMEM = {
-    10, -6, 13, 16, 23, 27, 32, 29, 32, 26, 22, 23, 11, 11, 0, -5, 
-    -12, -23, -28, -43, -46, -62, -67, -82, -93, -101, -117, -125, -141, -154, -166, -184, 
-    -194, -212, -227, -240, -261, -272, -292, -306, -324, -341, -357, -373, -388, -407, -419, -440, 
-    -448, -471, -478, -498, -507, -525, -535, -549, -561, -574, -583, -599, -605, -623, -627, -641, 
-    -652, -660, -675, -680, -694, -703, -714, -723, -734, -745, -756, -766, -776, -787, -798, -808, 
-    -820, -828, -839, -849, -859, -868, -878, -886, -894, -901, -909, -918, -918, -931, -925, -940, 
-    -935, -942, -940, -941, -943, -941, -938, -936, -933, -929, -925, -919, -914, -907, -898, -893, 
-    -880, -876, -863, -854, -843, -832, -818, -811, -790, -785, -761, -756, -729, -724, -695, -689, 
-    -657, -649, -620, -610, -579, -562, -539, -516, -496, -469, -447, -425, -398, -378, -348, -330, 
-    -301, -280, -253, -232, -205, -183, -158, -137, -109, -92, -61, -47, -16, -2, 26, 44, 
-    70, 87, 110, 132, 151, 175, 190, 217, 232, 256, 272, 296, 315, 335, 356, 377, 
-    396, 419, 437, 460, 480, 502, 523, 543, 565, 586, 606, 626, 647, 667, 685, 706, 
-    721, 744, 754, 776, 788, 805, 818, 831, 845, 857, 867, 879, 888, 898, 907, 916, 
-    924, 931, 940, 944, 953, 957, 965, 970, 974, 978, 984, 986, 989, 993, 991, 995, 
-    991, 993, 991, 985, 983, 975, 971, 961, 954, 939, 934, 913, 909, 883, 875, 852, 
-    838, 814, 797, 775, 753, 730, 706, 685, 659, 635, 610, 584, 558, 534, 504, 479, 
-    448, 422, 392, 361, 332, 299, 267, 233, 201, 163, 131, 88, 57, 12, -23, -66, 
-    -105, -146, -189, -233, -273, -318, -361, -405, -448, -491, -534, -580, -618, -664, -704, -746, 
-    -787, -824, -867, -904, -942, -978, -1013, -1050, -1082, -1117, -1146, -1178, -1208, -1235, -1264, -1288, 
-    -1315, -1338, -1362, -1384, -1405, -1424, -1443, -1461, -1477, -1492, -1505, -1518, -1530, -1539, -1549, -1553, 
-    -1562, -1562, -1569, -1565, -1567, -1565, -1558, -1555, -1545, -1540, -1523, -1513, -1496, -1481, -1461, -1441, 
-    -1417, -1394, -1366, -1339, -1309, -1278, -1246, -1207, -1177, -1131, -1102, -1049, -1017, -964, -927, -874, 
-    -830, -778, -729, -676, -624, -569, -515, -456, -401, -338, -284, -219, -160, -96, -34, 31, 
-    92, 162, 223, 293, 359, 425, 495, 563, 629, 701, 766, 838, 905, 973, 1043, 1111, 
-    1179, 1246, 1315, 1380, 1448, 1510, 1578, 1639, 1704, 1762, 1825, 1879, 1941, 1992, 2049, 2099, 
-    2148, 2201, 2241, 2291, 2327, 2371, 2408, 2442, 2474, 2508, 2531, 2561, 2579, 2602, 2619, 2633, 
-    2645, 2654, 2659, 2665, 2661, 2660, 2654, 2643, 2633, 2612, 2599, 2569, 2551, 2513, 2487, 2448, 
-    2409, 2365, 2319, 2271, 2215, 2163, 2100, 2042, 1972, 1906, 1835, 1759, 1685, 1603, 1520, 1436, 
-    1348, 1257, 1167, 1069, 975, 874, 775, 673, 565, 462, 349, 243, 130, 16, -95, -213, 
-    -330, -447, -567, -688, -808, -932, -1054, -1175, -1305, -1422, -1554, -1673, -1802, -1925, -2051, -2173, 
-    -2299, -2421, -2543, -2665, -2782, -2905, -3020, -3137, -3251, -3363, -3476, -3585, -3692, -3800, -3901, -4004, 
-    -4104, -4203, -4295, -4393, -4478, -4575, -4653, -4742, -4819, -4900, -4974, -5046, -5116, -5181, -5244, -5301, 
-    -5358, -5405, -5455, -5493, -5534, -5563, -5590, -5611, -5626, -5637, -5635, -5636, -5622, -5610, -5581, -5555, 
-    -5512, -5474, -5414, -5359, -5289, -5215, -5132, -5042, -4945, -4839, -4725, -4605, -4476, -4340, -4198, -4045, 
-    -3889, -3718, -3551, -3364, -3181, -2982, -2780, -2574, -2352, -2137, -1900, -1673, -1425, -1184, -926, -674, 
-    -408, -143, 126, 402, 676, 960, 1240, 1525, 1812, 2096, 2389, 2671, 2963, 3246, 3533, 3817, 
-    4098, 4375, 4655, 4920, 5198, 5453, 5721, 5967, 6224, 6460, 6704, 6931, 7159, 7375, 7589, 7791, 
-    7989, 8177, 8360, 8533, 8700, 8857, 9008, 9148, 9284, 9408, 9525, 9635, 9734, 9827, 9912, 9985, 
-    10059, 10110, 10170, 10205, 10250, 10268, 10295, 10302, 10309, 10304, 10291, 10275, 10249, 10214, 10174, 10125, 
-    10071, 10010, 9939, 9867, 9780, 9695, 9597, 9496, 9388, 9267, 9151, 9014, 8887, 8735, 8589, 8430, 
-    8266, 8092, 7912, 7722, 7528, 7320, 7106, 6884, 6647, 6408, 6151, 5891, 5616, 5327, 5036, 4724, 
-    4410, 4074, 3734, 3381, 3014, 2636, 2249, 1848, 1436, 1016, 579, 141, -317, -776, -1249, -1732, 
-    -2217, -2720, -3219, -3736, -4250, -4776, -5302, -5838, -6370, -6918, -7450, -8001, -8536, -9087, -9622, -10165, 
-    -10696, -11232, -11751, -12273, -12781, -13282, -13774, -14250, -14719, -15169, -15609, -16029, -16432, -16822, -17183, -17539, 
-    -17859, -18169, -18450, -18713, -18952, -19171, -19357, -19537, -19673, -19807, -19901, -19986, -20040, -20078, -20095, -20091, 
-    -20070, -20030, -19974, -19904, -19816, -19719, -19604, -19485, -19346, -19203, -19049, -18887, -18716, -18537, -18349, -18157, 
-    -17948, -17740, -17514, -17283, -17036, -16782, -16509, -16230, -15920, -15614, -15268, -14928, -14545, -14165, -13750, -13329, 
-    -12878, -12423, -11942, -11458, -10952, -10447, -9926, -9412, -8888, -8371, -7856, -7349, -6852, -6364, -5887, -5425, 
-    -4968, -4533, -4093, -3671, -3240, -2819, -2381, -1940, -1468, -987, -457, 90, 709, 1348, 2073, 2830, 
-    3679, 4573, 5558, 6589, 7731, 8930, 10189, 11492, 12856, 14243, 15671, 17097, 18555, 19977, 21416, 22779, 
-    24187, 25466, 26836, 27711, 27655, 27703, 27671, 27693, 27679, 27689, 27681, 27688, 27682, 27689, 27681, 27687, 
-    27683, 27686, 27686, 27683, 27688, 27681, 27689, 27680, 27690, 27680, 27687, 27681, 27687, 27682, 27686, 27679, 
-    27687, 27680, 27687, 27682, 27686, 27684, 27686, 27684, 27686, 27682, 27689, 27678, 27692, 27675, 27697, 27668, 
-    27707, 27647, 27755, 27412, 25712, 24144, 22457, 20849, 19178, 17547, 15896, 14302, 12697, 11146, 9595, 8131, 
-    6700, 5355, 4049, 2833, 1681, 623, -374, -1303, -2198, -3045, -3879, -4682, -5473, -6237, -7023, -7804, 
-    -8618, -9427, -10265, -11104, -11972, -12864, -13817, -14795, -15820, -16851, -17914, -18977, -20063, -21135, -22217, -23288, 
-    -24361, -25417, -26456, -27419, -27758, -27727, -27744, -27731, -27742, -27734, -27740, -27733, -27740, -27734, -27739, -27734, 
-    -27739, -27733, -27739, -27733, -27739, -27734, -27740, -27733, -27739, -27734, -27741, -27735, -27738, -27736, -27739, -27735, 
-    -27739, -27735, -27738, -27737, -27737, -27736, -27737, -27737, -27736, -27734, -27735, -27737, -27735, -27736, -27738, -27735, 
-    -27739, -27734, -27739, -27737, -27734, -27741, -27733, -27742, -27733, -27739, -27734, -27739, -27733, -27739, -27732, -27742, 
-    -27730, -27746, -27722, -27769, -27466, -25714, -23998, -22214, -20438, -18618, -16810, -14982, -13181, -11388, -9638, -7914, 
-    -6245, -4593, -2996, -1408, 127, 1651, 3122, 4577, 5986, 7385, 8747, 10103, 11422, 12726, 13998, 15260, 
-    16485, 17720, 18911, 20138, 21311, 22550, 23716, 24974, 26118, 27413, 27746, 27654, 27704, 27671, 27696, 27675, 
-    27692, 27678, 27689, 27681, 27690, 27680, 27688, 27681, 27689, 27682, 27687, 27682, 27687, 27682, 27688, 27681, 
-    27688, 27681, 27688, 27683, 27686, 27683, 27687, 27682, 27688, 27681, 27687, 27683, 27687, 27683, 27685, 27684, 
-    27684, 27686, 27682, 27687, 27682, 27687, 27683, 27686, 27686, 27682, 27688, 27681, 27688, 27682, 27688, 27682, 
-    27687, 27682, 27686, 27684, 27686, 27683, 27687, 27682, 27689, 27680, 27688, 27681, 27688, 27681, 27691, 27676, 
-    27699, 27662, 27737, 27160, 25362, 23423, 21458, 19473, 17462, 15441, 13407, 11362, 9293, 7219, 5132, 3051, 
-    974, -1089, -3134, -5164, -7154, -9116, -11032, -12908, -14734, -16510, -18233, -19910, -21523, -23108, -24617, -26139, 
-    -27443, -27756, -27733, -27739, -27738, -27735, -27737, -27738, -27736, -27739, -27735, -27738, -27737, -27737, -27737, -27737, 
-    -27736, -27736, -27737, -27737, -27736, -27738, -27735, -27739, -27733, -27740, -27734, -27742, -27733, -27740, -27733, -27740, 
-    -27734, -27737, -27735, -27737, -27735, -27739, -27735, -27740, -27735, -27738, -27736, -27737, -27736, -27735, -27737, -27738, 
-    -27735, -27739, -27734, -27740, -27735, -27740, -27734, -27739, -27735, -27739, -27735, -27738, -27734, -27739, -27735, -27740, 
-    -27733, -27741, -27732, -27740, -27731, -27741, -27734, -27741, -27734, -27741, -27730, -27743, -27729, -27746, -27724, -27748, 
-    -26052, -23324, -20645, -17884, -15153, -12370, -9623, -6851, -4118, -1385, 1296, 3961, 6574, 9161, 11697, 14186, 
-    16633, 19010, 21356, 23603, 25885, 27519, 27698, 27686, 27680, 27690, 27681, 27687, 27683, 27685, 27686, 27683, 
-    27686, 27684, 27685, 27686, 27682, 27688, 27680, 27689, 27682, 27687, 27684, 27685, 27685, 27685, 27685, 27685, 
-    27684, 27687, 27681, 27689, 27681, 27689, 27681, 27689, 27680, 27689, 27681, 27688, 27682, 27686, 27685, 27685, 
-    27685, 27685, 27684, 27687, 27682, 27689, 27680, 27689, 27679, 27689, 27679, 27688, 27681, 27688, 27681, 27688, 
-    27680, 27691, 27678, 27692, 27677, 27692, 27679, 27689, 27678, 27693, 27675, 27697, 27672, 27698, 27671, 27700, 
-    27669, 27702, 27663, 27711, 27649, 27733, 27607, 27851, 26017, 23278, 20796, 18106, 15514, 12809, 10166, 7451, 
-    4793, 2085, -557, -3224, -5825, -8429, -10975, -13502, -15981, -18420, -20830, -23152, -25528, -27432, -27754, -27737, 
-    -27734, -27741, -27733, -27742, -27732, -27744, -27730, -27744, -27731, -27743, -27732, -27740, -27734, -27739, -27733, -27742, 
-    -27732, -27744, -27730, -27743, -27730, -27744, -27732, -27742, -27733, -27739, -27736, -27740, -27735, -27740, -27734, -27740, 
-    -27735, -27739, -27735, -27738, -27732, -27740, -27730, -27743, -27729, -27745, -27730, -27742, -27730, -27742, -27732, -27742, 
-    -27733, -27741, -27733, -27741, -27732, -27740, -27731, -27740, -27732, -27741, -27732, -27742, -27729, -27744, -27729, -27744, 
-    -27729, -27742, -27728, -27744, -27727, -27749, -27726, -27749, -27724, -27751, -27721, -27753, -27715, -27760, -27709, -27776, 
-    -27679, -27824, -26182, -23755, -21540, -19126, -16783, -14327, -11917, -9432, -6991, -4499, -2071, 393, 2778, 5180, 
-    7501, 9825, 12065, 14309, 16458, 18626, 20671, 22780, 24698, 26840, 27726, 27651, 27708, 27668, 27698, 27674, 
-    27694, 27677, 27691, 27679, 27689, 27682, 27688, 27680, 27690, 27680, 27690, 27679, 27690, 27678, 27691, 27678, 
-    27690, 27679, 27689, 27680, 27686, 27681, 27685, 27682, 27686, 27679, 27690, 27679, 27689, 27680, 27687, 27682, 
-    27688, 27682, 27689, 27681, 27689, 27680, 27690, 27678, 27691, 27677, 27691, 27679, 27688, 27682, 27688, 27680, 
-    27691, 27678, 27691, 27678, 27690, 27679, 27691, 27678, 27690, 27678, 27692, 27676, 27691, 27675, 27695, 27674, 
-    27697, 27669, 27704, 27664, 27707, 27658, 27714, 27647, 27734, 27608, 27837, 26620, 24368, 22424, 20257, 18214, 
-    16034, 13921, 11712, 9537, 7285, 5056, 2760, 481, -1854, -4178, -6541, -8897, -11286, -13662, -16069, -18446, 
-    -20857, -23206, -25644, -27493, -27772, -27724, -27744, -27729, -27742, -27733, -27741, -27732, -27737, -27736, -27735, -27737, 
-    -27736, -27735, -27738, -27732, -27739, -27735, -27739, -27735, -27738, -27732, -27742, -27730, -27743, -27731, -27743, -27732, 
-    -27741, -27734, -27742, -27733, -27740, -27735, -27738, -27734, -27739, -27733, -27741, -27735, -27740, -27736, -27739, -27736, 
-    -27739, -27733, -27740, -27733, -27740, -27735, -27737, -27735, -27738, -27736, -27740, -27733, -27741, -27733, -27742, -27732, 
-    -27742, -27733, -27741, -27733, -27742, -27731, -27745, -27729, -27747, -27728, -27747, -27723, -27755, -27705, -27808, -26480, 
-    -24242, -22065, -19811, -17580, -15303, -13037, -10739, -8456, -6148, -3859, -1561, 708, 2976, 5204, 7423, 9592, 
-    11750, 13844, 15931, 17937, 19938, 21851, 23753, 25569, 27352, 27697, 27679, 27687, 27682, 27686, 27682, 27687, 
-    27681, 27688, 27682, 27688, 27681, 27687, 27682, 27686, 27683, 27685, 27684, 27683, 27686, 27683, 27685, 27682, 
-    27686, 27680, 27687, 27680, 27688, 27682, 27686, 27684, 27685, 27683, 27688, 27681, 27689, 27680, 27687, 27681, 
-    27687, 27681, 27688, 27680, 27690, 27679, 27690, 27678, 27690, 27679, 27691, 27678, 27690, 27678, 27690, 27678, 
-    27692, 27677, 27694, 27674, 27696, 27674, 27696, 27674, 27696, 27671, 27697, 27672, 27698, 27670, 27700, 27666, 
-    27710, 27653, 27726, 27620, 27811, 27122, 24818, 22713, 20487, 18372, 16205, 14113, 11991, 9926, 7843, 5792, 
-    3734, 1694, -350, -2390, -4433, -6481, -8525, -10590, -12637, -14716, -16750, -18832, -20834, -22912, -24826, -26967, 
-    -27814, -27686, -27774, -27710, -27760, -27717, -27756, -27720, -27752, -27722, -27749, -27727, -27746, -27730, -27742, -27732, 
-    -27744, -27730, -27741, -27731, -27741, -27731, -27739, -27733, -27741, -27732, -27742, -27733, -27742, -27733, -27740, -27735, 
-    -27740, -27733, -27742, -27731, -27742, -27733, -27741, -27734, -27741, -27733, -27741, -27732, -27740, -27735, -27738, -27735, 
-    -27739, -27735, -27739, -27735, -27738, -27736, -27740, -27734, -27742, -27731, -27742, -27731, -27741, -27733, -27740, -27734, 
-    -27741, -27732, -27743, -27732, -27742, -27732, -27742, -27732, -27743, -27729, -27749, -27717, -27779, -27579, -25858, -24026, 
-    -22117, -20207, -18228, -16246, -14210, -12165, -10079, -7980, -5852, -3714, -1548, 623, 2830, 5034, 7280, 9512, 
-    11789, 14041, 16333, 18587, 20890, 23115, 25460, 27366, 27705, 27681, 27685, 27686, 27682, 27686, 27683, 27687, 
-    27683, 27685, 27683, 27686, 27682, 27687, 27683, 27686, 27683, 27686, 27683, 27685, 27683, 27684, 27683, 27684, 
-    27686, 27683, 27686, 27682, 27686, 27684, 27685, 27685, 27684, 27686, 27685, 27685, 27684, 27683, 27687, 27681, 
-    27687, 27682, 27685, 27683, 27685, 27683, 27686, 27684, 27684, 27685, 27684, 27684, 27683, 27684, 27684, 27685, 
-    27682, 27694, 27547, 26614, 25410, 24286, 23114, 21987, 20842, 19735, 18621, 17541, 16464, 15418, 14373, 13360, 
-    12343, 11349, 10348, 9358, 8357, 7360, 6339, 5309, 4247, 3166, 2042, 892, -310, -1541, -2829, -4146, 
-    -5518, -6915, -8365, -9840, -11352, -12899, -14461, -16053, -17662, -19275, -20908, -22517, -24144, -25728, -27315, -27751, 
-    -27727, -27743, -27731, -27741, -27735, -27736, -27739, -27736, -27739, -27736, -27736, -27739, -27735, -27739, -27735, -27737, 
-    -27736, -27736, -27735, -27737, -27734, -27737, -27738, -27736, -27738, -27736, -27738, -27737, -27736, -27738, -27737, -27736, 
-    -27736, -27736, -27736, -27738, -27736, -27738, -27734, -27737, -27735, -27736, -27737, -27735, -27739, -27734, -27741, -27732, 
-    -27722, -26912, -25451, -24032, -22584, -21147, -19698, -18259, -16819, -15385, -13962, -12548, -11147, -9765, -8393, -7054, 
-    -5722, -4428, -3145, -1902, -681, 504, 1661, 2784, 3873, 4928, 5945, 6926, 7875, 8785, 9672, 10522, 
-    11356, 12161, 12956, 13728, 14503, 15254, 16024, 16768, 17540, 18294, 19077, 19850, 20654, 21444, 22272, 23077, 
-    23927, 24745, 25619, 26424, 27344, 27752, 27651, 27707, 27669, 27697, 27676, 27693, 27675, 27692, 27676, 27691, 
-    27678, 27692, 27678, 27691, 27678, 27689, 27680, 27688, 27682, 27689, 27680, 27690, 27679, 27689, 27680, 27687, 
-    27682, 27686, 27683, 27687, 27682, 27688, 27680, 27690, 27679, 27691, 27678, 27681, 27316, 26612, 25924, 25173, 
-    24398, 23561, 22690, 21754, 20780, 19739, 18655, 17513, 16332, 15098, 13828, 12516, 11174, 9811, 8425, 7035, 
-    5637, 4249, 2876, 1523, 192, -1099, -2362, -3574, -4746, -5872, -6947, -7976, -8957, -9896, -10792, -11658, 
-    -12488, -13299, -14081, -14854, -15611, -16363, -17106, -17850, -18591, -19332, -20071, -20807, -21545, -22273, -23003, -23713, 
-    -24420, -25104, -25769, -26410, -27025, -27576, -27754, -27729, -27741, -27735, -27737, -27736, -27737, -27737, -27737, -27735, 
-    -27737, -27735, -27737, -27737, -27738, -27737, -27737, -27738, -27737, -27736, -27737, -27736, -27738, -27737, -27736, -27738, 
-    -27735, -27741, -27731, -27745, -27632, -27176, -26714, -26198, -25672, -25088, -24487, -23834, -23150, -22417, -21651, -20834, 
-    -19986, -19084, -18156, -17177, -16173, -15127, -14059, -12961, -11848, -10717, -9576, -8426, -7277, -6125, -4979, -3843, 
-    -2714, -1609, -508, 561, 1623, 2662, 3682, 4687, 5671, 6643, 7593, 8534, 9456, 10367, 11269, 12159, 
-    13037, 13907, 14763, 15604, 16434, 17244, 18036, 18807, 19555, 20277, 20973, 21633, 22272, 22868, 23436, 23960, 
-    24451, 24904, 25313, 25688, 26019, 26314, 26568, 26787, 26969, 27118, 27230, 27311, 27362, 27380, 27373, 27333, 
-    27269, 27172, 27057, 26910, 26744, 26560, 26345, 26125, 25866, 25604, 25305, 25004, 24668, 24330, 23961, 23586, 
-    23192, 22785, 22366, 21934, 21492, 21038, 20573, 20101, 19614, 19120, 18609, 18092, 17558, 17009, 16446, 15865, 
-    15273, 14657, 14026, 13375, 12709, 12020, 11315, 10586, 9842, 9070, 8281, 7468, 6636, 5783, 4904, 4012, 
-    3097, 2173, 1225, 270, -693, -1670, -2648, -3633, -4618, -5596, -6577, -7536, -8498, -9430, -10356, -11246, 
-    -12124, -12968, -13788, -14572, -15330, -16048, -16743, -17388, -18018, -18598, -19160, -19676, -20179, -20637, -21089, -21499, 
-    -21900, -22275, -22628, -22970, -23286, -23590, -23873, -24138, -24385, -24606, -24803, -24975, -25115, -25225, -25299, -25336, 
-    -25334, -25287, -25205, -25071, -24901, -24684, -24429, -24135, -23808, -23444, -23056, -22642, -22204, -21750, -21285, -20805, 
-    -20334, -19843, -19376, -18900, -18442, -17992, -17553, -17125, -16712, -16301, -15905, -15506, -15112, -14713, -14311, -13887, 
-    -13459, -12999, -12526, -12020, -11484, -10919, -10319, -9679, -9014, -8307, -7578, -6818, -6035, -5229, -4409, -3572, 
-    -2731, -1880, -1032, -184, 650, 1482, 2286, 3086, 3846, 4600, 5320, 6019, 6699, 7346, 7984, 8590, 
-    9180, 9750, 10301, 10833, 11358, 11852, 12355, 12824, 13305, 13757, 14215, 14656, 15097, 15523, 15945, 16355, 
-    16757, 17147, 17521, 17893, 18242, 18588, 18911, 19221, 19515, 19778, 20028, 20241, 20430, 20588, 20709, 20797, 
-    20847, 20859, 20834, 20766, 20666, 20526, 20351, 20143, 19899, 19632, 19329, 19014, 18665, 18304, 17918, 17525, 
-    17111, 16690, 16255, 15814, 15368, 14917, 14464, 14014, 13563, 13115, 12668, 12222, 11782, 11341, 10903, 10469, 
-    10036, 9605, 9175, 8750, 8326, 7902, 7485, 7065, 6658, 6244, 5838, 5437, 5036, 4644, 4248, 3858, 
-    3470, 3076, 2690, 2294, 1905, 1507, 1111, 709, 308, -100, -513, -930, -1349, -1771, -2196, -2624, 
-    -3055, -3483, -3923, -4349, -4797, -5226, -5672, -6105, -6550, -6988, -7433, -7870, -8314, -8747, -9186, -9610, 
-    -10034, -10446, -10853, -11245, -11627, -11988, -12341, -12665, -12973, -13255, -13515, -13747, -13954, -14131, -14284, -14407, 
-    -14505, -14574, -14622, -14640, -14640, -14613, -14572, -14507, -14435, -14331, -14239, -14105, -13996, -13846, -13721, -13566, 
-    -13425, -13269, -13112, -12954, -12785, -12619, -12436, -12248, -12050, -11832, -11603, -11352, -11082, -10794, -10479, -10150, 
-    -9798, -9430, -9042, -8646, -8234, -7818, -7393, -6968, -6542, -6119, -5707, -5299, -4917, -4542, -4199, -3869, 
-    -3576, -3300, -3061, -2849, -2666, -2513, -2387, -2287, -2213, -2155, -2118, -2090, -2076, -2061, -2053, -2036, 
-    -2014, -1983, -1936, -1876, -1797, -1701, -1589, -1449, -1301, -1120, -936, -720, -499, -253, -5, 261, 
-    531, 813, 1102, 1392, 1687, 1987, 2281, 2585, 2873, 3171, 3455, 3744, 4022, 4304, 4578, 4855, 
-    5124, 5403, 5674, 5954, 6231, 6511, 6796, 7079, 7363, 7650, 7930, 8206, 8481, 8736, 8994, 9222, 
-    9445, 9642, 9812, 9965, 10079, 10176, 10229, 10260, 10251, 10219, 10151, 10055, 9934, 9786, 9619, 9432, 
-    9234, 9025, 8812, 8594, 8379, 8171, 7968, 7783, 7605, 7452, 7312, 7196, 7097, 7025, 6965, 6940, 
-    6917, 6929, 6938, 6972, 7004, 7047, 7088, 7124, 7160, 7176, 7190, 7178, 7154, 7107, 7037, 6945, 
-    6824, 6682, 6514, 6320, 6105, 5869, 5612, 5340, 5048, 4749, 4436, 4117, 3794, 3464, 3145, 2818, 
-    2516, 2206, 1930, 1654, 1407, 1173, 964, 773, 606, 460, 332, 224, 127, 49, -23, -84, 
-    -143, -200, -253, -314, -376, -452, -536, -633, -749, -872, -1023, -1178, -1359, -1553, -1758, -1985, 
-    -2209, -2455, -2699, -2945, -3193, -3429, -3669, -3884, -4096, -4286, -4465, -4618, -4757, -4876, -4974, -5059, 
-    -5116, -5169, -5198, -5223, -5238, -5246, -5256, -5260, -5275, -5291, -5319, -5353, -5398, -5461, -5527, -5619, 
-    -5709, -5829, -5944, -6086, -6224, -6375, -6532, -6685, -6846, -6998, -7143, -7288, -7409, -7532, -7631, -7716, 
-    -7788, -7831, -7869, -7877, -7878, -7858, -7827, -7786, -7730, -7679, -7605, -7549, -7467, -7413, -7330, -7278, 
-    -7209, -7160, -7108, -7064, -7030, -7001, -6974, -6960, -6941, -6938, -6928, -6925, -6925, -6919, -6921, -6909, 
-    -6904, -6883, -6865, -6832, -6794, -6745, -6688, -6618, -6541, -6440, -6336, -6207, -6071, -5914, -5740, -5553, 
-    -5345, -5121, -4882, -4622, -4352, -4063, -3762, -3446, -3118, -2773, -2425, -2061, -1696, -1322, -944, -567, 
-    -185, 189, 562, 929, 1286, 1637, 1973, 2300, 2612, 2917, 3197, 3481, 3731, 3991, 4223, 4459, 
-    4679, 4897, 5109, 5318, 5526, 5736, 5947, 6157, 6373, 6591, 6810, 7038, 7258, 7492, 7717, 7950, 
-    8173, 8400, 8621, 8839, 9051, 9257, 9458, 9646, 9837, 10006, 10182, 10334, 10492, 10630, 10770, 10895, 
-    11023, 11139, 11256, 11364, 11471, 11577, 11675, 11774, 11866, 11956, 12042, 12118, 12188, 12249, 12298, 12328, 
-    12352, 12345, 12332, 12286, 12231, 12141, 12034, 11895, 11731, 11541, 11317, 11074, 10794, 10499, 10167, 9826, 
-    9445, 9058, 8641, 8212, 7766, 7305, 6837, 6357, 5869, 5379, 4882, 4391, 3895, 3415, 2929, 2462, 
-    1992, 1542, 1097, 667, 243, -157, -557, -932, -1302, -1651, -1989, -2313, -2622, -2916, -3195, -3462, 
-    -3714, -3955, -4179, -4396, -4597, -4797, -4978, -5162, -5329, -5496, -5659, -5807, -5964, -6101, -6246, -6377, 
-    -6510, -6634, -6755, -6866, -6972, -7077, -7166, -7264, -7338, -7426, -7491, -7565, -7623, -7688, -7738, -7799, 
-    -7847, -7905, -7950, -8013, -8058, -8122, -8174, -8240, -8305, -8367, -8442, -8508, -8586, -8656, -8731, -8803, 
-    -8873, -8940, -9000, -9061, -9109, -9159, -9192, -9225, -9241, -9255, -9248, -9247, -9218, -9196, -9150, -9106, 
-    -9048, -8979, -8912, -8826, -8746, -8644, -8555, -8440, -8341, -8220, -8108, -7981, -7859, -7722, -7598, -7447, 
-    -7313, -7151, -7001, -6830, -6659, -6474, -6286, -6086, -5879, -5658, -5426, -5182, -4921, -4652, -4366, -4068, 
-    -3756, -3429, -3097, -2748, -2397, -2035, -1671, -1301, -928, -560, -191, 169, 525, 870, 1203, 1524, 
-    1824, 2115, 2375, 2632, 2849, 3066, 3242, 3416, 3552, 3685, 3785, 3880, 3949, 4009, 4061, 4096, 
-    4132, 4156, 4181, 4208, 4230, 4265, 4294, 4339, 4385, 4442, 4506, 4580, 4660, 4756, 4853, 4968, 
-    5076, 5202, 5325, 5453, 5584, 5710, 5838, 5967, 6082, 6206, 6312, 6428, 6528, 6631, 6722, 6812, 
-    6896, 6975, 7053, 7126, 7197, 7270, 7338, 7414, 7490, 7568, 7657, 7744, 7845, 7944, 8057, 8171, 
-    8297, 8423, 8558, 8694, 8830, 8969, 9099, 9233, 9352, 9468, 9571, 9658, 9736, 9791, 9832, 9849, 
-    9851, 9825, 9779, 9707, 9614, 9498, 9359, 9196, 9016, 8812, 8594, 8354, 8102, 7832, 7551, 7254, 
-    6954, 6635, 6316, 5987, 5655, 5320, 4980, 4641, 4302, 3964, 3630, 3298, 2978, 2656, 2355, 2050, 
-    1768, 1488, 1228, 977, 743, 521, 317, 126, -45, -208, -351, -483, -597, -708, -798, -888, 
-    -967, -1043, -1120, -1191, -1271, -1349, -1439, -1533, -1636, -1749, -1873, -2010, -2158, -2325, -2500, -2695, 
-    -2896, -3119, -3343, -3591, -3837, -4103, -4368, -4646, -4923, -5214, -5495, -5793, -6076, -6375, -6660, -6953, 
-    -7235, -7522, -7801, -8084, -8354, -8629, -8892, -9157, -9411, -9664, -9903, -10141, -10359, -10578, -10774, -10966, 
-    -11139, -11296, -11444, -11565, -11679, -11766, -11840, -11897, -11932, -11956, -11959, -11950, -11925, -11882, -11832, -11760, 
-    -11683, -11590, -11489, -11376, -11256, -11125, -10989, -10841, -10694, -10534, -10371, -10203, -10027, -9856, -9667, -9492, 
-    -9301, -9120, -8932, -8744, -8564, -8374, -8197, -8014, -7838, -7663, -7491, -7323, -7162, -7000, -6847, -6691, 
-    -6541, -6395, -6246, -6102, -5951, -5804, -5653, -5495, -5334, -5161, -4984, -4796, -4599, -4389, -4169, -3935, 
-    -3689, -3429, -3157, -2868, -2569, -2247, -1924, -1572, -1220, -840, -461, -53, 352, 787, 1218, 1676, 
-    2133, 2608, 3083, 3577, 4067, 4574, 5074, 5590, 6095, 6616, 7118, 7635, 8131, 8638, 9125, 9617, 
-    10089, 10564, 11021, 11471, 11909, 12336, 12751, 13157, 13547, 13932, 14296, 14660, 15006, 15341, 15664, 15977, 
-    16279, 16567, 16842, 17104, 17361, 17594, 17822, 18032, 18228, 18415, 18580, 18735, 18867, 18988, 19084, 19168, 
-    19223, 19266, 19276, 19271, 19238, 19180, 19097, 18987, 18850, 18687, 18492, 18272, 18020, 17743, 17436, 17106, 
-    16742, 16366, 15954, 15531, 15077, 14618, 14133, 13642, 13135, 12620, 12105, 11569, 11049, 10505, 9981, 9441, 
-    8912, 8380, 7849, 7324, 6795, 6274, 5750, 5226, 4705, 4183, 3665, 3136, 2618, 2087, 1563, 1027, 
-    493, -46, -591, -1138, -1697, -2257, -2827, -3408, -3988, -4589, -5189, -5805, -6427, -7059, -7703, -8353, 
-    -9011, -9675, -10349, -11019, -11698, -12374, -13045, -13718, -14379, -15032, -15671, -16298, -16904, -17496, -18061, -18607, 
-    -19125, -19619, -20085, -20527, -20941, -21323, -21682, -22008, -22318, -22594, -22851, -23087, -23299, -23501, -23672, -23839, 
-    -23979, -24111, -24221, -24315, -24391, -24446, -24483, -24496, -24484, -24447, -24378, -24284, -24154, -23988, -23785, -23543, 
-    -23261, -22940, -22569, -22163, -21709, -21218, -20682, -20112, -19501, -18862, -18184, -17482, -16756, -16009, -15249, -14471, 
-    -13693, -12906, -12119, -11342, -10560, -9803, -9041, -8304, -7573, -6861, -6163, -5481, -4813, -4156, -3511, -2873, 
-    -2244, -1615, -987, -359, 275, 914, 1566, 2225, 2899, 3588, 4287, 5010, 5738, 6489, 7247, 8020, 
-    8801, 9588, 10377, 11164, 11951, 12721, 13493, 14233, 14971, 15675, 16362, 17022, 17652, 18254, 18825, 19364, 
-    19873, 20351, 20794, 21217, 21601, 21970, 22303, 22620, 22912, 23184, 23433, 23670, 23883, 24087, 24271, 24439, 
-    24599, 24737, 24867, 24978, 25076, 25153, 25216, 25255, 25276, 25270, 25237, 25182, 25092, 24973, 24822, 24636, 
-    24419, 24163, 23874, 23549, 23186, 22793, 22356, 21897, 21392, 20871, 20307, 19729, 19115, 18488, 17828, 17161, 
-    16467, 15766, 15047, 14322, 13582, 12846, 12093, 11348, 10590, 9841, 9087, 8338, 7584, 6840, 6087, 5345, 
-    4596, 3852, 3108, 2356, 1614, 858, 107, -656, -1418, -2189, -2967, -3746, -4543, -5329, -6139, -6938, 
-    -7753, -8561, -9377, -10185, -10999, -11798, -12599, -13383, -14159, -14918, -15660, -16383, -17088, -17756, -18412, -19025, 
-    -19617, -20172, -20692, -21181, -21634, -22047, -22435, -22772, -23093, -23363, -23617, -23826, -24017, -24171, -24308, -24410, 
-    -24494, -24552, -24589, -24605, -24600, -24576, -24533, -24471, -24393, -24297, -24186, -24053, -23913, -23747, -23572, -23371, 
-    -23160, -22924, -22674, -22395, -22099, -21783, -21435, -21074, -20677, -20267, -19824, -19361, -18864, -18350, -17800, -17232, 
-    -16627, -16002, -15343, -14663, -13951, -13216, -12458, -11674, -10872, -10047, -9208, -8351, -7486, -6605, -5723, -4835, 
-    -3943, -3056, -2167, -1288, -413, 452, 1307, 2150, 2982, 3795, 4591, 5376, 6135, 6889, 7606, 8319, 
-    8999, 9675, 10320, 10955, 11565, 12165, 12746, 13312, 13865, 14401, 14928, 15434, 15937, 16414, 16892, 17338, 
-    17787, 18206, 18620, 19012, 19387, 19745, 20083, 20400, 20694, 20968, 21211, 21437, 21631, 21805, 21950, 22066, 
-    22163, 22228, 22272, 22289, 22282, 22254, 22203, 22128, 22033, 21921, 21783, 21634, 21460, 21275, 21067, 20849, 
-    20606, 20354, 20075, 19785, 19472, 19137, 18785, 18405, 18004, 17579, 17124, 16646, 16141, 15603, 15045, 14452, 
-    13838, 13194, 12518, 11830, 11102, 10370, 9599, 8824, 8022, 7213, 6384, 5551, 4702, 3853, 2989, 2132, 
-    1262, 404, -463, -1316, -2177, -3019, -3866, -4694, -5520, -6332, -7133, -7926, -8699, -9465, -10209, -10944, 
-    -11656, -12354, -13028, -13686, -14319, -14927, -15510, -16067, -16594, -17090, -17557, -17989, -18390, -18753, -19085, -19379, 
-    -19641, -19868, -20057, -20220, -20345, -20446, -20515, -20558, -20576, -20568, -20542, -20489, -20425, -20335, -20237, -20119, 
-    -19993, -19851, -19698, -19533, -19357, -19168, -18968, -18747, -18522, -18265, -18006, -17711, -17410, -17070, -16718, -16327, 
-    -15920, -15475, -15008, -14504, -13980, -13426, -12845, -12243, -11613, -10971, -10304, -9625, -8935, -8226, -7523, -6797, 
-    -6087, -5358, -4648, -3927, -3224, -2517, -1827, -1139, -465, 198, 852, 1497, 2128, 2757, 3368, 3980, 
-    4581, 5175, 5770, 6352, 6939, 7517, 8092, 8663, 9228, 9794, 10346, 10896, 11433, 11965, 12486, 12990, 
-    13485, 13959, 14424, 14861, 15290, 15686, 16069, 16423, 16754, 17060, 17338, 17590, 17815, 18009, 18179, 18317, 
-    18428, 18516, 18567, 18602, 18602, 18584, 18536, 18468, 18374, 18259, 18124, 17966, 17786, 17589, 17373, 17141, 
-    16889, 16622, 16340, 16038, 15725, 15389, 15045, 14677, 14302, 13900, 13494, 13064, 12625, 12161, 11691, 11195, 
-    10695, 10166, 9633, 9078, 8515, 7933, 7339, 6733, 6113, 5482, 4840, 4190, 3530, 2866, 2193, 1523, 
-    847, 172, -500, -1173, -1841, -2504, -3160, -3810, -4450, -5085, -5704, -6315, -6912, -7497, -8068, -8626, 
-    -9169, -9694, -10208, -10699, -11179, -11638, -12085, -12510, -12927, -13318, -13706, -14065, -14424, -14757, -15090, -15394, 
-    -15701, -15979, -16256, -16512, -16763, -16992, -17218, -17419, -17618, -17794, -17960, -18107, -18238, -18358, -18450, -18534, 
-    -18583, -18630, -18633, -18636, -18592, -18544, -18449, -18343, -18200, -18034, -17834, -17608, -17348, -17067, -16744, -16401, 
-    -16019, -15608, -15175, -14702, -14208, -13685, -13132, -12560, -11954, -11338, -10695, -10037, -9365, -8678, -7987, -7280, 
-    -6581, -5867, -5167, -4459, -3766, -3080, -2398, -1736, -1076, -438, 190, 806, 1406, 1997, 2572, 3134, 
-    3692, 4232, 4771, 5298, 5825, 6344, 6863, 7374, 7889, 8395, 8906, 9409, 9905, 10408, 10888, 11376, 
-    11838, 12302, 12744, 13176, 13587, 13978, 14351, 14697, 15026, 15326, 15606, 15854, 16085, 16282, 16465, 16615, 
-    16748, 16855, 16939, 17009, 17053, 17089, 17100, 17106, 17093, 17073, 17040, 16998, 16946, 16891, 16820, 16754, 
-    16671, 16591, 16498, 16406, 16299, 16196, 16072, 15956, 15813, 15677, 15518, 15353, 15171, 14974, 14765, 14530, 
-    14285, 14010, 13725, 13405, 13070, 12705, 12317, 11899, 11458, 10988, 10495, 9973, 9429, 8858, 8269, 7653, 
-    7022, 6370, 5703, 5023, 4329, 3629, 2918, 2208, 1490, 776, 66, -645, -1343, -2037, -2721, -3394, 
-    -4054, -4701, -5332, -5953, -6553, -7142, -7712, -8265, -8803, -9323, -9828, -10312, -10784, -11235, -11678, -12094, 
-    -12504, -12893, -13270, -13634, -13978, -14317, -14635, -14944, -15237, -15518, -15783, -16039, -16274, -16499, -16705, -16893, 
-    -17072, -17219, -17366, -17477, -17587, -17662, -17733, -17767, -17803, -17796, -17788, -17741, -17686, -17601, -17496, -17372, 
-    -17220, -17055, -16864, -16654, -16432, -16178, -15928, -15636, -15355, -15033, -14719, -14372, -14022, -13653, -13273, -12879, 
-    -12472, -12050, -11624, -11179, -10736, -10274, -9817, -9341, -8875, -8394, -7918, -7435, -6951, -6468, -5986, -5498, 
-    -5021, -4532, -4057, -3570, -3095, -2610, -2136, -1650, -1177, -691, -216, 265, 746, 1225, 1707, 2184, 
-    2666, 3140, 3616, 4084, 4551, 5008, 5462, 5904, 6342, 6764, 7180, 7583, 7977, 8355, 8720, 9077, 
-    9411, 9742, 10052, 10352, 10642, 10914, 11184, 11436, 11685, 11922, 12150, 12374, 12586, 12794, 12992, 13180, 
-    13365, 13533, 13704, 13850, 13995, 14128, 14240, 14353, 14430, 14514, 14563, 14607, 14623, 14623, 14605, 14561, 
-    14505, 14413, 14315, 14181, 14036, 13861, 13669, 13455, 13223, 12970, 12704, 12419, 12126, 11817, 11502, 11174, 
-    10848, 10503, 10172, 9822, 9487, 9138, 8801, 8457, 8121, 7784, 7448, 7114, 6780, 6452, 6115, 5783, 
-    5447, 5113, 4772, 4426, 4080, 3726, 3368, 3002, 2634, 2254, 1872, 1485, 1091, 697, 295, -104, 
-    -502, -901, -1294, -1683, -2063, -2435, -2797, -3148, -3484, -3811, -4122, -4416, -4700, -4964, -5218, -5455, 
-    -5680, -5886, -6087, -6262, -6442, -6596, -6748, -6887, -7014, -7142, -7250, -7360, -7457, -7551, -7639, -7715, 
-    -7791, -7857, -7917, -7970, -8012, -8054, -8079, -8103, -8112, -8118, -8116, -8101, -8083, -8057, -8024, -7990, 
-    -7945, -7902, -7851, -7804, -7749, -7701, -7644, -7594, -7534, -7487, -7421, -7377, -7305, -7257, -7190, -7127, 
-    -7067, -6992, -6928, -6848, -6771, -6689, -6602, -6512, -6418, -6318, -6219, -6109, -6006, -5890, -5779, -5662, 
-    -5543, -5429, -5306, -5189, -5069, -4951, -4834, -4715, -4600, -4483, -4372, -4255, -4147, -4033, -3925, -3815, 
-    -3704, -3594, -3481, -3367, -3251, -3132, -3010, -2884, -2751, -2620, -2479, -2338, -2190, -2038, -1882, -1720, 
-    -1554, -1385, -1211, -1036, -851, -671, -480, -297, -103, 84, 273, 459, 646, 824, 1003, 1171, 
-    1339, 1493, 1646, 1790, 1925, 2058, 2173, 2292, 2394, 2496, 2586, 2672, 2751, 2825, 2896, 2960, 
-    3026, 3083, 3146, 3201, 3260, 3315, 3375, 3430, 3491, 3546, 3609, 3666, 3731, 3788, 3856, 3913, 
-    3980, 4034, 4103, 4150, 4219, 4264, 4327, 4373, 4429, 4479, 4530, 4574, 4628, 4671, 4725, 4765, 
-    4817, 4866, 4912, 4967, 5015, 5077, 5129, 5200, 5258, 5339, 5407, 5499, 5580, 5679, 5777, 5885, 
-    5996, 6111, 6233, 6353, 6476, 6598, 6720, 6834, 6949, 7056, 7154, 7248, 7326, 7401, 7457, 7507, 
-    7540, 7557, 7566, 7548, 7530, 7480, 7426, 7355, 7262, 7169, 7043, 6925, 6775, 6631, 6460, 6290, 
-    6103, 5910, 5712, 5499, 5291, 5065, 4845, 4611, 4381, 4137, 3900, 3649, 3406, 3152, 2902, 2647, 
-    2393, 2136, 1883, 1625, 1373, 1115, 870, 614, 372, 123, -112, -353, -586, -820, -1044, -1270, 
-    -1485, -1704, -1909, -2113, -2311, -2504, -2690, -2870, -3047, -3212, -3382, -3532, -3691, -3830, -3977, -4105, 
-    -4240, -4355, -4482, -4587, -4702, -4801, -4906, -5001, -5098, -5192, -5286, -5380, -5475, -5574, -5670, -5775, 
-    -5881, -5991, -6113, -6228, -6363, -6492, -6633, -6778, -6927, -7081, -7243, -7398, -7571, -7731, -7906, -8067, 
-    -8241, -8400, -8568, -8720, -8874, -9018, -9158, -9285, -9407, -9512, -9617, -9701, -9780, -9840, -9891, -9925, 
-    -9949, -9951, -9943, -9914, -9873, -9811, -9735, -9638, -9527, -9394, -9244, -9074, -8887, -8681, -8454, -8218, 
-    -7956, -7688, -7392, -7098, -6777, -6453, -6111, -5767, -5413, -5057, -4692, -4328, -3962, -3594, -3236, -2872, 
-    -2521, -2168, -1831, -1496, -1170, -849, -540, -239, 56, 346, 627, 903, 1174, 1439, 1703, 1964, 
-    2221, 2481, 2732, 2993, 3243, 3502, 3754, 4009, 4262, 4511, 4763, 5008, 5252, 5490, 5724, 5950, 
-    6173, 6380, 6591, 6777, 6972, 7139, 7308, 7465, 7607, 7749, 7872, 7995, 8108, 8213, 8318, 8415, 
-    8510, 8606, 8694, 8789, 8877, 8975, 9061, 9162, 9250, 9350, 9442, 9537, 9634, 9725, 9817, 9904, 
-    9993, 10073, 10151, 10219, 10286, 10341, 10389, 10428, 10454, 10472, 10473, 10463, 10438, 10396, 10341, 10268, 
-    10178, 10073, 9947, 9810, 9645, 9475, 9274, 9065, 8835, 8583, 8323, 8036, 7745, 7428, 7107, 6763, 
-    6419, 6052, 5687, 5304, 4923, 4527, 4137, 3732, 3332, 2927, 2520, 2118, 1709, 1307, 908, 510, 
-    117, -269, -654, -1027, -1399, -1756, -2111, -2450, -2786, -3102, -3418, -3709, -4001, -4270, -4534, -4775, 
-    -5012, -5224, -5434, -5616, -5796, -5954, -6097, -6234, -6347, -6460, -6549, -6632, -6706, -6768, -6822, -6869, 
-    -6907, -6943, -6969, -6996, -7017, -7035, -7052, -7066, -7079, -7094, -7099, -7114, -7116, -7128, -7131, -7135, 
-    -7137, -7135, -7135, -7125, -7122, -7099, -7089, -7059, -7035, -6997, -6954, -6903, -6847, -6779, -6703, -6621, 
-    -6527, -6428, -6320, -6201, -6085, -5949, -5820, -5681, -5541, -5400, -5253, -5115, -4970, -4838, -4692, -4568, 
-    -4433, -4316, -4192, -4082, -3968, -3870, -3761, -3672, -3569, -3484, -3384, -3300, -3199, -3112, -3006, -2909, 
-    -2796, -2683, -2561, -2430, -2291, -2142, -1986, -1818, -1643, -1459, -1271, -1070, -873, -661, -460, -246, 
-    -46, 165, 360, 560, 748, 931, 1105, 1270, 1422, 1571, 1701, 1823, 1932, 2030, 2121, 2195, 
-    2261, 2318, 2363, 2405, 2429, 2458, 2468, 2480, 2484, 2481, 2480, 2465, 2457, 2437, 2420, 2397, 
-    2375, 2347, 2323, 2293, 2266, 2237, 2209, 2185, 2159, 2140, 2120, 2105, 2096, 2088, 2089, 2092, 
-    2099, 2116, 2134, 2157, 2194, 2218, 2270, 2305, 2360, 2409, 2463, 2524, 2578, 2642, 2702, 2762, 
-    2824, 2878, 2941, 2988, 3044, 3090, 3133, 3179, 3209, 3253, 3280, 3318, 3342, 3378, 3404, 3439, 
-    3468, 3506, 3540, 3585, 3626, 3677, 3731, 3788, 3850, 3916, 3984, 4061, 4132, 4213, 4289, 4366, 
-    4445, 4513, 4585, 4648, 4708, 4757, 4802, 4835, 4862, 4879, 4881, 4886, 4865, 4851, 4815, 4782, 
-    4736, 4683, 4626, 4562, 4493, 4420, 4346, 4265, 4190, 4105, 4029, 3944, 3873, 3788, 3717, 3641, 
-    3568, 3500, 3425, 3367, 3292, 3237, 3166, 3111, 3047, 2988, 2930, 2868, 2809, 2747, 2682, 2621, 
-    2548, 2483, 2404, 2330, 2247, 2158, 2072, 1966, 1873, 1753, 1644, 1513, 1388, 1247, 1099, 947, 
-    781, 616, 432, 247, 49, -149, -366, -578, -810, -1035, -1279, -1521, -1768, -2025, -2277, -2542, 
-    -2797, -3060, -3321, -3580, -3842, -4095, -4354, -4602, -4856, -5097, -5346, -5579, -5815, -6043, -6265, -6484, 
-    -6692, -6898, -7096, -7286, -7472, -7648, -7823, -7983, -8146, -8295, -8447, -8582, -8724, -8847, -8984, -9090, 
-    -9220, -9318, -9432, -9525, -9621, -9709, -9789, -9863, -9930, -9987, -10039, -10075, -10106, -10123, -10127, -10115, 
-    -10096, -10056, -10004, -9932, -9848, -9743, -9620, -9485, -9325, -9156, -8960, -8760, -8532, -8300, -8045, -7785, 
-    -7510, -7224, -6936, -6630, -6330, -6015, -5706, -5389, -5073, -4757, -4443, -4128, -3821, -3507, -3208, -2901, 
-    -2608, -2310, -2023, -1736, -1458, -1177, -907, -636, -374, -110, 148, 404, 661, 911, 1170, 1416, 
-    1676, 1924, 2184, 2442, 2704, 2975, 3242, 3528, 3807, 4109, 4407, 4719, 5044, 5371, 5716, 6065, 
-    6422, 6794, 7161, 7550, 7929, 8321, 8713, 9099, 9494, 9873, 10259, 10629, 10992, 11349, 11688, 12023, 
-    12335, 12640, 12921, 13193, 13442, 13678, 13891, 14091, 14262, 14430, 14560, 14691, 14787, 14874, 14938, 14983, 
-    15014, 15023, 15015, 14990, 14944, 14885, 14800, 14706, 14588, 14454, 14303, 14132, 13946, 13740, 13519, 13285, 
-    13029, 12766, 12482, 12189, 11876, 11556, 11218, 10870, 10509, 10132, 9751, 9344, 
-};
-const unsigned int drum_v1_p1_short_len = 5292;
@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v1_p3_short[] PROGMEM = {
-    65, -19, 28, 14, 36, 25, 35, 21, 25, 11, 8, -6, -10, -27, -35, -51, 
-    -60, -79, -91, -109, -122, -142, -157, -179, -195, -218, -236, -260, -279, -303, -324, -348, 
-    -367, -391, -411, -433, -451, -474, -490, -511, -527, -546, -562, -578, -593, -609, -623, -638, 
-    -651, -667, -679, -694, -708, -721, -734, -750, -763, -777, -791, -806, -820, -833, -846, -860, 
-    -872, -884, -894, -905, -914, -923, -928, -934, -938, -940, -941, -942, -940, -936, -933, -927, 
-    -920, -913, -903, -893, -881, -870, -855, -842, -825, -811, -792, -775, -753, -733, -710, -687, 
-    -660, -635, -609, -579, -550, -521, -491, -459, -428, -396, -363, -332, -300, -266, -235, -202, 
-    -170, -139, -108, -77, -46, -16, 12, 43, 72, 99, 128, 156, 183, 210, 239, 264, 
-    293, 319, 346, 373, 401, 429, 456, 485, 513, 540, 569, 597, 624, 651, 677, 702, 
-    728, 750, 771, 793, 812, 830, 847, 863, 877, 891, 903, 915, 925, 936, 945, 953, 
-    962, 970, 974, 982, 986, 990, 992, 993, 993, 992, 986, 981, 973, 963, 950, 935, 
-    918, 900, 878, 856, 830, 804, 777, 747, 716, 686, 653, 620, 585, 552, 516, 479, 
-    441, 403, 363, 323, 279, 235, 190, 142, 92, 42, -10, -63, -118, -173, -231, -287, 
-    -346, -403, -461, -519, -577, -633, -691, -745, -799, -851, -904, -953, -1001, -1048, -1094, -1136, 
-    -1177, -1217, -1254, -1289, -1323, -1354, -1384, -1411, -1437, -1461, -1482, -1501, -1518, -1534, -1545, -1555, 
-    -1562, -1566, -1567, -1566, -1561, -1553, -1544, -1529, -1511, -1491, -1467, -1440, -1409, -1375, -1337, -1298, 
-    -1255, -1208, -1159, -1108, -1052, -996, -936, -874, -809, -743, -673, -603, -528, -454, -375, -298, 
-    -216, -134, -49, 34, 122, 208, 298, 386, 477, 568, 659, 751, 843, 934, 1025, 1118, 
-    1207, 1298, 1387, 1475, 1561, 1646, 1729, 1810, 1887, 1963, 2036, 2104, 2171, 2234, 2293, 2347, 
-    2400, 2446, 2490, 2527, 2562, 2590, 2615, 2635, 2650, 2659, 2663, 2661, 2655, 2643, 2624, 2600, 
-    2570, 2533, 2490, 2443, 2388, 2328, 2262, 2190, 2113, 2030, 1940, 1847, 1748, 1645, 1534, 1422, 
-    1303, 1182, 1055, 925, 792, 654, 513, 369, 223, 72, -78, -234, -390, -549, -710, -872, 
-    -1036, -1200, -1367, -1532, -1700, -1866, -2033, -2198, -2364, -2526, -2688, -2848, -3006, -3160, -3312, -3461, 
-    -3608, -3751, -3890, -4025, -4159, -4286, -4411, -4530, -4648, -4757, -4866, -4966, -5063, -5152, -5238, -5314, 
-    -5386, -5448, -5505, -5550, -5588, -5614, -5633, -5636, -5633, -5614, -5587, -5543, -5491, -5421, -5342, -5246, 
-    -5139, -5017, -4883, -4733, -4572, -4395, -4208, -4004, -3788, -3558, -3317, -3060, -2793, -2512, -2221, -1916, 
-    -1603, -1276, -941, -597, -245, 115, 480, 853, 1229, 1610, 1991, 2376, 2759, 3143, 3523, 3903, 
-    4275, 4646, 5006, 5364, 5709, 6050, 6377, 6698, 7004, 7301, 7584, 7856, 8112, 8358, 8587, 8805, 
-    9006, 9194, 9366, 9525, 9668, 9797, 9910, 10011, 10095, 10166, 10222, 10264, 10291, 10306, 10305, 10292, 
-    10266, 10226, 10171, 10107, 10028, 9939, 9835, 9721, 9594, 9457, 9305, 9143, 8968, 8782, 8580, 8370, 
-    8143, 7904, 7649, 7382, 7094, 6796, 6474, 6141, 5784, 5410, 5015, 4604, 4166, 3713, 3236, 2739, 
-    2222, 1685, 1126, 552, -44, -655, -1285, -1929, -2590, -3261, -3948, -4642, -5349, -6059, -6781, -7501, 
-    -8227, -8951, -9675, -10390, -11104, -11802, -12494, -13164, -13823, -14454, -15069, -15651, -16210, -16733, -17227, -17682, 
-    -18102, -18480, -18824, -19123, -19383, -19600, -19779, -19914, -20013, -20070, -20096, -20082, -20040, -19964, -19866, -19736, 
-    -19590, -19418, -19232, -19025, -18808, -18569, -18324, -18055, -17779, -17479, -17166, -16825, -16469, -16079, -15666, -15217, 
-    -14742, -14227, -13686, -13104, -12500, -11861, -11207, -10525, -9842, -9144, -8455, -7763, -7096, -6435, -5806, -5185, 
-    -4598, -4013, -3450, -2875, -2304, -1692, -1056, -354, 407, 1268, 2210, 3279, 4450, 5763, 7185, 8783, 
-    10445, 12234, 14064, 15979, 17879, 19831, 21688, 23576, 25313, 27111, 27745, 27651, 27703, 27670, 27695, 27675, 
-    27691, 27679, 27688, 27680, 27687, 27682, 27685, 27683, 27684, 27684, 27683, 27683, 27682, 27685, 27680, 27684, 
-    27680, 27687, 27680, 27689, 27678, 27691, 27675, 27694, 27670, 27700, 27662, 27713, 27635, 27781, 26483, 24158, 
-    22054, 19800, 17645, 15428, 13326, 11197, 9185, 7223, 5417, 3678, 2112, 651, -644, -1880, -3011, -4129, 
-    -5178, -6226, -7251, -8328, -9403, -10529, -11652, -12854, -14111, -15462, -16829, -18256, -19676, -21134, -22550, -24007, 
-    -25389, -26820, -27708, -27733, -27739, -27734, -27739, -27734, -27736, -27736, -27735, -27735, -27735, -27735, -27734, -27737, 
-    -27735, -27736, -27735, -27738, -27734, -27738, -27735, -27737, -27735, -27737, -27735, -27736, -27735, -27736, -27733, -27736, 
-    -27734, -27736, -27736, -27737, -27736, -27736, -27735, -27736, -27737, -27736, -27736, -27735, -27736, -27733, -27738, -27734, 
-    -27738, -27739, -27623, -25664, -23254, -20920, -18480, -16074, -13634, -11263, -8916, -6669, -4461, -2338, -244, 1768, 
-    3744, 5640, 7510, 9320, 11113, 12839, 14547, 16193, 17838, 19436, 21056, 22646, 24276, 25870, 27456, 27726, 
-    27665, 27695, 27676, 27689, 27679, 27686, 27682, 27685, 27682, 27685, 27683, 27684, 27683, 27685, 27684, 27684, 
-    27684, 27685, 27683, 27684, 27684, 27684, 27683, 27684, 27684, 27684, 27684, 27684, 27684, 27683, 27684, 27684, 
-    27684, 27684, 27683, 27684, 27683, 27685, 27683, 27684, 27682, 27685, 27683, 27685, 27682, 27686, 27681, 27686, 
-    27681, 27687, 27680, 27688, 27687, 27575, 25688, 23021, 20433, 17730, 15053, 12315, 9581, 6793, 4025, 1237, 
-    -1503, -4238, -6902, -9524, -12053, -14520, -16877, -19163, -21335, -23440, -25457, -27316, -27772, -27722, -27744, -27731, 
-    -27739, -27734, -27738, -27734, -27737, -27735, -27737, -27735, -27736, -27736, -27736, -27736, -27736, -27735, -27736, -27737, 
-    -27736, -27736, -27736, -27736, -27734, -27736, -27735, -27737, -27736, -27736, -27736, -27736, -27735, -27735, -27737, -27735, 
-    -27736, -27735, -27738, -27735, -27737, -27735, -27738, -27734, -27737, -27734, -27739, -27732, -27740, -27730, -27741, -27729, 
-    -27746, -27725, -27751, -27714, -27767, -27686, -27839, -26145, -22449, -18906, -15163, -11534, -7796, -4176, -503, 3022, 
-    6572, 9964, 13369, 16586, 19822, 22813, 25919, 27673, 27667, 27696, 27676, 27689, 27681, 27685, 27683, 27684, 
-    27684, 27683, 27685, 27681, 27686, 27682, 27686, 27681, 27686, 27681, 27687, 27681, 27686, 27681, 27688, 27680, 
-    27688, 27680, 27688, 27679, 27688, 27679, 27689, 27679, 27689, 27679, 27690, 27678, 27689, 27677, 27689, 27677, 
-    27690, 27676, 27690, 27676, 27692, 27675, 27693, 27674, 27694, 27672, 27697, 27670, 27700, 27665, 27705, 27659, 
-    27714, 27645, 27736, 27601, 27851, 25836, 22154, 18822, 15192, 11711, 8064, 4538, 909, -2583, -6130, -9525, 
-    -12961, -16219, -19531, -22601, -25838, -27712, -27716, -27752, -27724, -27745, -27729, -27742, -27731, -27741, -27732, -27739, 
-    -27733, -27738, -27734, -27739, -27734, -27737, -27734, -27739, -27734, -27738, -27734, -27739, -27734, -27739, -27734, -27739, 
-    -27733, -27737, -27732, -27737, -27732, -27739, -27734, -27738, -27732, -27739, -27734, -27739, -27732, -27739, -27732, -27738, 
-    -27731, -27739, -27731, -27740, -27730, -27742, -27730, -27742, -27727, -27743, -27727, -27747, -27725, -27749, -27721, -27753, 
-    -27712, -27767, -27689, -27833, -27128, -24058, -21035, -17832, -14649, -11360, -8100, -4784, -1530, 1730, 4897, 8041, 
-    11073, 14074, 16951, 19807, 22510, 25274, 27506, 27688, 27687, 27680, 27688, 27680, 27687, 27680, 27687, 27681, 
-    27686, 27682, 27686, 27681, 27686, 27681, 27686, 27680, 27686, 27680, 27685, 27679, 27687, 27679, 27686, 27680, 
-    27686, 27679, 27687, 27680, 27688, 27680, 27688, 27679, 27688, 27678, 27688, 27678, 27689, 27678, 27689, 27679, 
-    27689, 27677, 27690, 27677, 27692, 27674, 27694, 27673, 27694, 27671, 27699, 27667, 27703, 27662, 27709, 27649, 
-    27729, 27612, 27830, 26641, 23696, 21047, 18160, 15374, 12434, 9543, 6527, 3539, 446, -2624, -5782, -8910, 
-    -12115, -15276, -18507, -21645, -24908, -27462, -27767, -27725, -27740, -27732, -27740, -27731, -27738, -27733, -27738, -27734, 
-    -27737, -27733, -27737, -27735, -27737, -27734, -27736, -27734, -27737, -27736, -27737, -27736, -27737, -27736, -27736, -27736, 
-    -27735, -27736, -27735, -27738, -27735, -27738, -27735, -27738, -27733, -27738, -27733, -27739, -27731, -27741, -27732, -27741, 
-    -27730, -27743, -27729, -27744, -27727, -27746, -27725, -27750, -27721, -27756, -27711, -27769, -27684, -27835, -26297, -23254, 
-    -20361, -17310, -14322, -11244, -8206, -5119, -2073, 978, 3979, 6947, 9857, 12703, 15494, 18185, 20838, 23326, 
-    25887, 27651, 27654, 27708, 27662, 27702, 27668, 27698, 27671, 27696, 27672, 27694, 27673, 27693, 27674, 27692, 
-    27675, 27691, 27675, 27690, 27675, 27690, 27676, 27690, 27678, 27689, 27678, 27690, 27678, 27688, 27678, 27688, 
-    27679, 27689, 27679, 27688, 27679, 27688, 27680, 27688, 27679, 27687, 27680, 27688, 27680, 27687, 27681, 27687, 
-    27682, 27685, 27682, 27686, 27682, 27684, 27684, 27684, 27683, 27688, 27608, 25191, 22173, 19341, 16440, 13650, 
-    10825, 8087, 5310, 2601, -148, -2849, -5601, -8312, -11080, -13805, -16581, -19290, -22036, -24683, -27289, -27787, 
-    -27716, -27747, -27730, -27740, -27734, -27736, -27736, -27736, -27738, -27733, -27739, -27733, -27737, -27732, -27738, -27731, 
-    -27740, -27732, -27740, -27733, -27740, -27732, -27741, -27731, -27741, -27731, -27741, -27731, -27742, -27731, -27741, -27730, 
-    -27742, -27730, -27742, -27730, -27743, -27729, -27742, -27730, -27743, -27729, -27743, -27728, -27744, -27728, -27745, -27726, 
-    -27746, -27725, -27748, -27723, -27751, -27719, -27757, -27710, -27753, -25932, -23364, -20859, -18222, -15566, -12835, -10069, 
-    -7256, -4406, -1531, 1390, 4324, 7314, 10300, 13347, 16349, 19432, 22394, 25552, 27618, 27665, 27702, 27669, 
-    27695, 27673, 27693, 27675, 27690, 27677, 27689, 27679, 27688, 27679, 27687, 27679, 27686, 27680, 27687, 27681, 
-    27686, 27681, 27686, 27682, 27685, 27682, 27686, 27681, 27685, 27683, 27684, 27682, 27683, 27683, 27684, 27684, 
-    27683, 27683, 27683, 27683, 27681, 27686, 27678, 27702, 27472, 26108, 24543, 23017, 21489, 19993, 18515, 17071, 
-    15655, 14270, 12911, 11572, 10242, 8915, 7581, 6225, 4836, 3403, 1911, 354, -1278, -2983, -4768, -6621, 
-    -8548, -10532, -12580, -14667, -16800, -18952, -21124, -23276, -25442, -27401, -27765, -27722, -27743, -27731, -27740, -27732, 
-    -27740, -27732, -27739, -27733, -27739, -27733, -27738, -27732, -27737, -27731, -27738, -27733, -27739, -27733, -27740, -27732, 
-    -27740, -27732, -27739, -27731, -27740, -27732, -27741, -27729, -27742, -27727, -27745, -27724, -27753, -27710, -27784, -27074, 
-    -25165, -23272, -21329, -19415, -17480, -15574, -13666, -11792, -9932, -8114, -6324, -4581, -2877, -1228, 369, 1910, 
-    3391, 4812, 6167, 7460, 8690, 9868, 10993, 12082, 13133, 14169, 15182, 16199, 17204, 18231, 19254, 20316, 
-    21371, 22473, 23556, 24700, 25789, 26993, 27732, 27658, 27701, 27671, 27695, 27674, 27691, 27676, 27690, 27678, 
-    27689, 27678, 27688, 27679, 27688, 27681, 27687, 27680, 27687, 27679, 27687, 27680, 27687, 27680, 27688, 27679, 
-    27690, 27675, 27702, 27498, 26649, 25699, 24686, 23590, 22410, 21137, 19770, 18307, 16759, 15127, 13422, 11650, 
-    9835, 7985, 6124, 4267, 2440, 647, -1089, -2761, -4352, -5867, -7291, -8633, -9894, -11085, -12216, -13300, 
-    -14344, -15365, -16368, -17361, -18352, -19340, -20327, -21309, -22287, -23252, -24199, -25117, -26000, -26838, -27576, -27755, 
-    -27727, -27741, -27731, -27739, -27733, -27738, -27733, -27737, -27734, -27738, -27734, -27738, -27735, -27737, -27734, -27738, 
-    -27735, -27737, -27736, -27737, -27738, -27685, -27162, -26508, -25815, -25052, -24229, -23333, -22365, -21324, -20208, -19019, 
-    -17758, -16432, -15044, -13606, -12128, -10622, -9095, -7560, -6023, -4497, -2987, -1504, -49, 1371, 2762, 4117, 
-    5444, 6738, 8006, 9246, 10463, 11662, 12841, 14001, 15139, 16251, 17336, 18385, 19395, 20361, 21276, 22137, 
-    22941, 23679, 24352, 24956, 25491, 25955, 26349, 26674, 26935, 27134, 27271, 27353, 27380, 27356, 27281, 27157, 
-    26988, 26776, 26527, 26239, 25917, 25554, 25160, 24729, 24270, 23776, 23260, 22716, 22152, 21565, 20961, 20336, 
-    19695, 19031, 18348, 17642, 16911, 16150, 15364, 14544, 13692, 12808, 11891, 10938, 9950, 8922, 7857, 6754, 
-    5613, 4434, 3224, 1985, 717, -567, -1868, -3178, -4492, -5801, -7099, -8377, -9630, -10845, -12020, -13148, 
-    -14224, -15243, -16205, -17106, -17947, -18729, -19453, -20123, -20745, -21323, -21859, -22359, -22823, -23257, -23657, -24027, 
-    -24361, -24656, -24904, -25104, -25245, -25325, -25334, -25271, -25131, -24915, -24622, -24259, -23832, -23345, -22812, -22235, 
-    -21627, -20998, -20360, -19718, -19087, -18468, -17870, -17291, -16733, -16190, -15660, -15131, -14601, -14051, -13477, -12866, 
-    -12214, -11508, -10748, -9922, -9038, -8094, -7101, -6061, -4984, -3878, -2755, -1621, -489, 631, 1732, 2802, 
-    3834, 4827, 5777, 6685, 7553, 8382, 9173, 9929, 10654, 11350, 12019, 12668, 13298, 13911, 14509, 15095, 
-    15666, 16221, 16758, 17275, 17772, 18248, 18699, 19124, 19516, 19869, 20177, 20432, 20635, 20772, 20847, 20854, 
-    20791, 20661, 20467, 20208, 19892, 19522, 19109, 18654, 18161, 17641, 17094, 16527, 15942, 15347, 14744, 14141, 
-    13540, 12942, 12346, 11757, 11170, 10588, 10011, 9435, 8865, 8298, 7735, 7177, 6628, 6080, 5541, 5008, 
-    4482, 3959, 3439, 2917, 2396, 1871, 1343, 809, 273, -274, -827, -1387, -1951, -2522, -3094, -3672, 
-    -4251, -4835, -5420, -6006, -6593, -7183, -7772, -8359, -8941, -9517, -10079, -10629, -11160, -11668, -12149, -12598, 
-    -13007, -13377, -13700, -13977, -14203, -14385, -14514, -14599, -14638, -14637, -14595, -14523, -14418, -14288, -14136, -13969, 
-    -13787, -13598, -13400, -13195, -12981, -12762, -12530, -12282, -12016, -11722, -11396, -11037, -10640, -10206, -9739, -9238, 
-    -8711, -8165, -7604, -7036, -6468, -5908, -5364, -4847, -4363, -3919, -3521, -3172, -2878, -2635, -2444, -2300, 
-    -2200, -2133, -2094, -2072, -2057, -2039, -2009, -1960, -1884, -1780, -1642, -1470, -1262, -1022, -750, -445, 
-    -118, 228, 593, 972, 1360, 1754, 2152, 2549, 2943, 3331, 3713, 4088, 4460, 4825, 5192, 5557, 
-    5927, 6298, 6675, 7053, 7434, 7812, 8183, 8544, 8887, 9207, 9495, 9746, 9951, 10109, 10211, 10257, 
-    10246, 10182, 10062, 9896, 9687, 9445, 9177, 8897, 8606, 8321, 8046, 7791, 7561, 7364, 7200, 7075, 
-    6986, 6937, 6921, 6934, 6968, 7018, 7072, 7124, 7164, 7186, 7180, 7141, 7066, 6947, 6783, 6577, 
-    6325, 6034, 5705, 5344, 4955, 4546, 4122, 3689, 3253, 2826, 2412, 2021, 1658, 1327, 1032, 774, 
-    555, 373, 223, 100, 0, -85, -162, -237, -313, -402, -508, -636, -790, -973, -1184, -1426, 
-    -1694, -1987, -2298, -2624, -2953, -3279, -3597, -3894, -4167, -4414, -4625, -4803, -4948, -5060, -5138, -5191, 
-    -5223, -5242, -5252, -5262, -5279, -5310, -5354, -5421, -5509, -5620, -5755, -5914, -6091, -6284, -6489, -6698, 
-    -6907, -7107, -7294, -7462, -7607, -7723, -7808, -7859, -7880, -7870, -7837, -7780, -7709, -7626, -7536, -7445, 
-    -7353, -7266, -7188, -7119, -7061, -7017, -6981, -6956, -6939, -6930, -6925, -6923, -6919, -6911, -6894, -6869, 
-    -6828, -6773, -6700, -6610, -6496, -6357, -6192, -6000, -5777, -5526, -5243, -4930, -4587, -4217, -3822, -3401, 
-    -2956, -2491, -2010, -1517, -1015, -509, -3, 495, 984, 1459, 1915, 2350, 2763, 3152, 3519, 3862, 
-    4187, 4495, 4789, 5074, 5354, 5632, 5913, 6195, 6484, 6777, 7076, 7378, 7685, 7990, 8291, 8589, 
-    8879, 9159, 9428, 9684, 9928, 10155, 10368, 10566, 10750, 10922, 11085, 11240, 11387, 11528, 11664, 11793, 
-    11916, 12031, 12134, 12223, 12292, 12335, 12351, 12331, 12278, 12183, 12046, 11859, 11627, 11342, 11010, 10628, 
-    10203, 9734, 9226, 8682, 8105, 7501, 6878, 6237, 5584, 4925, 4265, 3612, 2970, 2339, 1724, 1131, 
-    554, 3, -527, -1032, -1513, -1967, -2397, -2801, -3179, -3532, -3862, -4167, -4452, -4719, -4971, -5208, 
-    -5433, -5649, -5853, -6051, -6237, -6417, -6587, -6750, -6897, -7039, -7166, -7285, -7392, -7493, -7581, -7665, 
-    -7739, -7813, -7883, -7954, -8025, -8099, -8175, -8260, -8346, -8438, -8534, -8632, -8729, -8827, -8917, -9001, 
-    -9076, -9142, -9193, -9231, -9249, -9252, -9236, -9203, -9152, -9086, -9003, -8908, -8799, -8678, -8548, -8407, 
-    -8259, -8102, -7938, -7766, -7589, -7400, -7203, -6992, -6770, -6530, -6278, -6010, -5725, -5416, -5086, -4730, 
-    -4353, -3951, -3524, -3078, -2614, -2138, -1651, -1156, -661, -170, 310, 777, 1224, 1645, 2037, 2396, 
-    2721, 3008, 3259, 3473, 3650, 3796, 3909, 3995, 4063, 4112, 4151, 4183, 4217, 4254, 4300, 4357, 
-    4427, 4512, 4613, 4731, 4866, 5013, 5171, 5338, 5510, 5682, 5852, 6018, 6176, 6328, 6472, 6608, 
-    6733, 6851, 6958, 7062, 7158, 7254, 7348, 7448, 7552, 7666, 7790, 7924, 8071, 8230, 8398, 8576, 
-    8758, 8941, 9119, 9290, 9446, 9584, 9696, 9783, 9834, 9853, 9832, 9769, 9664, 9520, 9334, 9110, 
-    8849, 8555, 8229, 7878, 7500, 7105, 6688, 6259, 5819, 5372, 4920, 4467, 4016, 3569, 3132, 2705, 
-    2295, 1901, 1529, 1178, 852, 551, 278, 32, -186, -379, -545, -692, -818, -931, -1034, -1134, 
-    -1234, -1341, -1458, -1589, -1735, -1902, -2090, -2305, -2543, -2806, -3092, -3400, -3727, -4073, -4432, -4802, 
-    -5182, -5566, -5954, -6344, -6732, -7115, -7494, -7871, -8241, -8604, -8959, -9306, -9642, -9964, -10271, -10559, 
-    -10826, -11069, -11286, -11476, -11635, -11761, -11856, -11921, -11954, -11958, -11936, -11886, -11812, -11714, -11595, -11457, 
-    -11302, -11132, -10947, -10750, -10542, -10322, -10095, -9859, -9617, -9372, -9125, -8876, -8629, -8383, -8140, -7902, 
-    -7668, -7439, -7218, -7005, -6797, -6594, -6396, -6201, -6004, -5806, -5603, -5390, -5163, -4924, -4668, -4390, 
-    -4093, -3773, -3430, -3062, -2669, -2249, -1806, -1336, -841, -322, 220, 788, 1376, 1987, 2613, 3256, 
-    3913, 4581, 5257, 5939, 6624, 7304, 7981, 8648, 9306, 9948, 10577, 11188, 11779, 12351, 12903, 13434, 
-    13945, 14434, 14907, 15355, 15785, 16194, 16581, 16944, 17289, 17608, 17905, 18176, 18424, 18642, 18833, 18992, 
-    19120, 19211, 19265, 19277, 19249, 19174, 19055, 18888, 18672, 18404, 18086, 17717, 17302, 16836, 16329, 15778, 
-    15190, 14571, 13926, 13257, 12572, 11875, 11168, 10457, 9745, 9034, 8324, 7618, 6915, 6216, 5517, 4820, 
-    4125, 3428, 2729, 2028, 1320, 607, -112, -839, -1580, -2329, -3094, -3870, -4665, -5474, -6302, -7145, 
-    -8008, -8881, -9769, -10666, -11568, -12470, -13367, -14257, -15127, -15976, -16794, -17583, -18329, -19035, -19693, -20306, 
-    -20870, -21383, -21846, -22266, -22638, -22971, -23266, -23528, -23758, -23958, -24129, -24271, -24379, -24454, -24491, -24487, 
-    -24435, -24333, -24174, -23952, -23662, -23304, -22870, -22359, -21774, -21114, -20383, -19584, -18726, -17810, -16850, -15854, 
-    -14829, -13788, -12741, -11693, -10656, -9635, -8634, -7657, -6706, -5783, -4886, -4010, -3154, -2310, -1472, -633, 
-    209, 1065, 1937, 2833, 3751, 4698, 5670, 6670, 7690, 8731, 9781, 10835, 11882, 12917, 13928, 14910, 
-    15853, 16754, 17605, 18404, 19148, 19838, 20470, 21049, 21578, 22059, 22496, 22894, 23253, 23578, 23872, 24139, 
-    24375, 24589, 24775, 24936, 25071, 25173, 25242, 25274, 25263, 25204, 25097, 24930, 24709, 24425, 24081, 23670, 
-    23199, 22662, 22066, 21408, 20698, 19936, 19131, 18282, 17398, 16480, 15539, 14574, 13595, 12603, 11604, 10598, 
-    9595, 8591, 7590, 6590, 5593, 4597, 3603, 2606, 1608, 605, -406, -1425, -2455, -3496, -4549, -5611, 
-    -6685, -7765, -8849, -9933, -11014, -12085, -13142, -14178, -15187, -16166, -17106, -17999, -18845, -19635, -20368, -21039, 
-    -21650, -22196, -22680, -23100, -23464, -23770, -24023, -24226, -24384, -24495, -24569, -24601, -24599, -24560, -24490, -24386, 
-    -24255, -24090, -23900, -23678, -23426, -23142, -22826, -22469, -22076, -21643, -21167, -20647, -20085, -19478, -18823, -18122, 
-    -17373, -16574, -15725, -14829, -13884, -12895, -11862, -10792, -9686, -8553, -7395, -6221, -5038, -3849, -2664, -1485, 
-    -317, 835, 1965, 3076, 4155, 5207, 6228, 7217, 8168, 9087, 9972, 10824, 11643, 12436, 13198, 13936, 
-    14648, 15337, 16000, 16641, 17254, 17844, 18405, 18939, 19439, 19910, 20341, 20737, 21088, 21397, 21660, 21879, 
-    22047, 22174, 22252, 22287, 22278, 22231, 22141, 22015, 21853, 21657, 21430, 21171, 20882, 20563, 20213, 19830, 
-    19412, 18958, 18463, 17926, 17345, 16716, 16040, 15313, 14538, 13714, 12840, 11921, 10961, 9960, 8925, 7860, 
-    6768, 5656, 4527, 3385, 2235, 1081, -69, -1218, -2358, -3487, -4601, -5700, -6779, -7838, -8874, -9883, 
-    -10866, -11818, -12737, -13620, -14463, -15261, -16014, -16715, -17361, -17951, -18481, -18948, -19355, -19700, -19981, -20206, 
-    -20373, -20489, -20555, -20575, -20554, -20495, -20402, -20278, -20128, -19955, -19760, -19543, -19307, -19048, -18763, -18451, 
-    -18108, -17731, -17316, -16856, -16350, -15796, -15189, -14529, -13822, -13068, -12267, -11428, -10554, -9652, -8725, -7781, 
-    -6826, -5866, -4905, -3951, -3006, -2074, -1157, -258, 621, 1483, 2327, 3155, 3969, 4771, 5563, 6348, 
-    7125, 7896, 8657, 9415, 10161, 10893, 11610, 12313, 12991, 13646, 14271, 14866, 15426, 15947, 16426, 16862, 
-    17251, 17593, 17885, 18127, 18319, 18462, 18555, 18599, 18599, 18553, 18465, 18334, 18167, 17959, 17715, 17439, 
-    17131, 16791, 16424, 16026, 15600, 15144, 14662, 14150, 13610, 13044, 12447, 11822, 11171, 10490, 9781, 9047, 
-    8287, 7501, 6693, 5863, 5012, 4144, 3263, 2371, 1473, 572, -327, -1224, -2114, -2994, -3862, -4715, 
-    -5551, -6366, -7160, -7929, -8676, -9393, -10085, -10745, -11378, -11980, -12553, -13098, -13615, -14105, -14570, -15013, 
-    -15430, -15825, -16194, -16542, -16866, -17167, -17445, -17698, -17925, -18123, -18294, -18433, -18537, -18607, -18637, -18626, 
-    -18573, -18471, -18323, -18125, -17876, -17572, -17218, -16809, -16346, -15826, -15256, -14632, -13958, -13236, -12467, -11656, 
-    -10811, -9932, -9029, -8106, -7170, -6227, -5283, -4345, -3421, -2511, -1621, -753, 90, 911, 1709, 2483, 
-    3235, 3970, 4688, 5395, 6094, 6786, 7472, 8153, 8832, 9504, 10169, 10825, 11464, 12086, 12686, 13259, 
-    13798, 14303, 14766, 15191, 15570, 15905, 16195, 16442, 16646, 16809, 16931, 17019, 17074, 17101, 17103, 17083, 
-    17043, 16986, 16915, 16830, 16733, 16626, 16508, 16380, 16240, 16087, 15920, 15735, 15533, 15308, 15059, 14781, 
-    14471, 14127, 13747, 13323, 12858, 12347, 11787, 11183, 10530, 9833, 9090, 8308, 7486, 6631, 5745, 4835, 
-    3905, 2961, 2009, 1054, 103, -841, -1771, -2687, -3584, -4456, -5305, -6128, -6922, -7688, -8425, -9132, 
-    -9809, -10454, -11072, -11661, -12220, -12753, -13260, -13740, -14196, -14629, -15036, -15419, -15779, -16114, -16422, -16701, 
-    -16952, -17171, -17360, -17516, -17639, -17728, -17782, -17802, -17783, -17726, -17630, -17496, -17321, -17110, -16863, -16579, 
-    -16264, -15917, -15542, -15138, -14709, -14252, -13770, -13264, -12735, -12182, -11610, -11021, -10417, -9799, -9173, -8539, 
-    -7900, -7256, -6611, -5966, -5320, -4676, -4033, -3391, -2750, -2110, -1470, -830, -189, 450, 1093, 1732, 
-    2373, 3011, 3643, 4269, 4886, 5490, 6080, 6654, 7208, 7744, 8257, 8748, 9215, 9657, 10076, 10473, 
-    10848, 11203, 11542, 11863, 12170, 12463, 12743, 13009, 13259, 13495, 13715, 13914, 14096, 14254, 14388, 14493, 
-    14571, 14614, 14625, 14599, 14539, 14436, 14298, 14118, 13901, 13643, 13352, 13024, 12669, 12285, 11882, 11459, 
-    11024, 10575, 10123, 9665, 9209, 8752, 8299, 7848, 7401, 6954, 6513, 6067, 5622, 5174, 4721, 4258, 
-    3792, 3311, 2823, 2321, 1812, 1291, 765, 230, -302, -834, -1359, -1875, -2374, -2859, -3319, -3760, 
-    -4174, -4563, -4925, -5261, -5572, -5858, -6118, -6357, -6576, -6774, -6955, -7122, -7274, -7411, -7538, -7654, 
-    -7756, -7848, -7928, -7993, -8047, -8086, -8108, -8117, -8113, -8092, -8060, -8017, -7966, -7905, -7842, -7773, 
-    -7705, -7633, -7562, -7487, -7414, -7337, -7259, -7177, -7092, -7002, -6907, -6805, -6696, -6581, -6457, -6328, 
-    -6191, -6049, -5901, -5749, -5593, -5437, -5276, -5118, -4959, -4803, -4645, -4492, -4340, -4190, -4042, -3895, 
-    -3748, -3600, -3450, -3297, -3139, -2975, -2803, -2626, -2440, -2247, -2045, -1836, -1618, -1392, -1161, -921, 
-    -676, -427, -175, 78, 328, 578, 820, 1054, 1278, 1491, 1690, 1878, 2053, 2212, 2360, 2493, 
-    2614, 2724, 2824, 2916, 3003, 3084, 3164, 3240, 3316, 3392, 3470, 3548, 3627, 3709, 3791, 3875, 
-    3956, 4038, 4118, 4194, 4269, 4341, 4411, 4480, 4545, 4610, 4675, 4738, 4801, 4867, 4932, 5002, 
-    5075, 5155, 5242, 5337, 5442, 5556, 5681, 5817, 5963, 6117, 6278, 6440, 6605, 6764, 6917, 7061, 
-    7191, 7306, 7403, 7479, 7532, 7559, 7560, 7534, 7479, 7398, 7290, 7156, 6997, 6817, 6615, 6392, 
-    6151, 5895, 5624, 5342, 5049, 4747, 4437, 4118, 3794, 3464, 3131, 2792, 2454, 2111, 1772, 1430, 
-    1092, 757, 426, 99, -219, -535, -844, -1146, -1439, -1727, -2001, -2270, -2526, -2773, -3009, -3236, 
-    -3451, -3657, -3851, -4037, -4211, -4375, -4531, -4678, -4817, -4951, -5079, -5206, -5331, -5458, -5586, -5720, 
-    -5860, -6010, -6168, -6336, -6515, -6703, -6901, -7107, -7319, -7538, -7763, -7986, -8210, -8430, -8645, -8848, 
-    -9043, -9223, -9387, -9532, -9662, -9767, -9851, -9910, -9946, -9951, -9930, -9879, -9799, -9686, -9543, -9366, 
-    -9156, -8913, -8637, -8329, -7994, -7626, -7235, -6820, -6381, -5925, -5457, -4978, -4492, -4004, -3517, -3035, 
-    -2558, -2094, -1643, -1204, -778, -370, 26, 411, 784, 1147, 1502, 1852, 2198, 2540, 2881, 3222, 
-    3562, 3902, 4239, 4575, 4906, 5232, 5550, 5858, 6154, 6437, 6702, 6954, 7185, 7402, 7599, 7781, 
-    7947, 8101, 8242, 8377, 8504, 8630, 8751, 8875, 8997, 9122, 9248, 9375, 9501, 9628, 9752, 9872, 
-    9988, 10096, 10194, 10283, 10356, 10414, 10454, 10473, 10468, 10438, 10381, 10296, 10180, 10035, 9860, 9651, 
-    9412, 9140, 8837, 8501, 8139, 7744, 7327, 6882, 6418, 5933, 5435, 4920, 4399, 3867, 3330, 2789, 
-    2250, 1707, 1171, 638, 112, -403, -909, -1403, -1882, -2345, -2790, -3216, -3621, -4005, -4367, -4703, 
-    -5015, -5303, -5564, -5800, -6009, -6193, -6354, -6493, -6609, -6708, -6790, -6855, -6909, -6953, -6988, -7018, 
-    -7042, -7061, -7081, -7095, -7108, -7119, -7128, -7134, -7136, -7135, -7129, -7117, -7096, -7069, -7030, -6981, 
-    -6916, -6841, -6748, -6642, -6519, -6384, -6231, -6071, -5894, -5716, -5527, -5338, -5145, -4960, -4774, -4595, 
-    -4423, -4261, -4105, -3960, -3821, -3689, -3563, -3439, -3316, -3192, -3065, -2929, -2784, -2628, -2459, -2273, 
-    -2072, -1854, -1620, -1373, -1112, -843, -567, -291, -14, 257, 521, 774, 1015, 1239, 1445, 1635, 
-    1801, 1947, 2075, 2183, 2270, 2342, 2396, 2436, 2463, 2478, 2484, 2481, 2469, 2452, 2429, 2401, 
-    2370, 2335, 2298, 2260, 2223, 2187, 2156, 2128, 2107, 2093, 2088, 2091, 2102, 2124, 2155, 2196, 
-    2244, 2303, 2367, 2438, 2514, 2593, 2673, 2756, 2834, 2913, 2984, 3053, 3114, 3171, 3220, 3269, 
-    3311, 3352, 3392, 3434, 3477, 3525, 3579, 3638, 3707, 3782, 3865, 3954, 4052, 4152, 4256, 4360, 
-    4461, 4554, 4644, 4720, 4784, 4833, 4867, 4882, 4883, 4864, 4831, 4783, 4724, 4649, 4567, 4474, 
-    4376, 4271, 4166, 4058, 3952, 3848, 3745, 3646, 3549, 3455, 3366, 3279, 3193, 3111, 3031, 2952, 
-    2872, 2790, 2707, 2621, 2531, 2433, 2332, 2221, 2103, 1974, 1835, 1683, 1520, 1344, 1153, 948, 
-    731, 498, 249, -11, -288, -579, -880, -1194, -1520, -1851, -2192, -2538, -2885, -3233, -3581, -3926, 
-    -4268, -4606, -4937, -5264, -5583, -5893, -6194, -6486, -6765, -7034, -7290, -7534, -7768, -7988, -8199, -8399, 
-    -8588, -8768, -8940, -9100, -9254, -9397, -9530, -9653, -9766, -9865, -9953, -10024, -10078, -10113, -10127, -10115, 
-    -10082, -10019, -9929, -9808, -9657, -9474, -9261, -9016, -8743, -8442, -8115, -7766, -7397, -7011, -6611, -6201, 
-    -5786, -5366, -4944, -4523, -4105, -3690, -3281, -2878, -2482, -2093, -1712, -1338, -971, -613, -260, 87, 
-    430, 769, 1108, 1445, 1784, 2124, 2470, 2822, 3184, 3555, 3941, 4341, 4756, 5189, 5639, 6107, 
-    6589, 7085, 7594, 8109, 8630, 9152, 9669, 10180, 10678, 11159, 11623, 12064, 12481, 12868, 13228, 13556, 
-    13853, 14114, 14344, 14540, 14703, 14832, 14927, 14989, 15020, 15017, 14983, 14916, 14816, 14687, 14523, 14329, 
-    14102, 13844, 13556, 13241, 12896, 12529, 12133, 11714, 11271, 10805, 10316, 9806, 9273, 8722, 8145, 7552, 
-    6941, 6310, 5664, 5003, 4329, 3645, 2951, 2254, 1553, 850, 152, -539, -1226, -1902, -2565, -3217, 
-    -3854, -4476, -5084, -5676, -6256, -6821, -7373, -7914, -8444, -8965, -9479, -9981, -10478, -10963, -11440, -11906, 
-    -12357, -12795, -13219, -13623, -14007, -14371, -14709, -15022, -15308, -15567, -15792, -15991, -16158, -16292, -16396, -16467, 
-    -16506, -16514, -16489, -16433, -16346, -16230, -16082, -15905, -15698, -15461, -15194, -14900, -14574, -14219, -13837, -13427, 
-    -12991, -12530, -12045, -11538, -11010, -10462, -9894, -9310, -8708, -8088, -7454, -6804, -6139, -5461, -4767, -4060, 
-    -3340, -2607, -1862, -1105, -340, 433, 1216, 2004, 2793, 3585, 4374, 5161, 5938, 6710, 7466, 8210, 
-    8932, 9635, 10314, 10967, 11593, 12191, 12757, 13291, 13795, 14265, 14700, 15100, 15468, 15798, 16093, 16351, 
-    16573, 16759, 16909, 17023, 17101, 17146, 17158, 17136, 17084, 17002, 16891, 16750, 16581, 16383, 16160, 15907, 
-    15629, 15322, 14987, 14625, 14235, 13817, 13371, 12899, 12398, 11872, 11322, 10750, 10155, 9544, 8917, 8276, 
-    7626, 6969, 6305, 5641, 4975, 4310, 3647, 2986, 2327, 1672, 1018, 365, -286, -935, -1588, -2238, 
-    -2890, -3540, -4189, -4833, -5475, -6106, -6728, -7338, -7932, -8509, -9064, -9597, -10104, -10582, -11033, -11454, 
-    -11843, -12202, -12531, -12829, -13099, -13340, -13555, -13744, -13909, -14049, -14169, -14264, -14338, -14391, -14420, -14426, 
-    -14409, -14366, -14296, -14198, -14072, -13913, -13723, -13501, -13246, -12959, -12640, -12290, -11910, -11502, -11066, -10607, 
-    -10125, -9623, -9106, -8572, -8025, -7470, -6906, -6334, -5760, -5181, -4601, -4021, -3440, -2862, -2287, -1716, 
-    -1151, -590, -38, 504, 1038, 1562, 2074, 2576, 3065, 3543, 4007, 4461, 4903, 5333, 5752, 6159, 
-    6553, 6938, 7308, 7666, 8011, 8346, 8664, 8969, 9256, 9529, 9780, 10013, 10222, 10410, 10570, 10707, 
-    10817, 10899, 10953, 10981, 10981, 10954, 10902, 10823, 10723, 10596, 10447, 10280, 10091, 9884, 9662, 9423, 
-    9169, 8902, 8622, 8328, 8023, 7706, 7378, 7039, 6689, 6329, 5960, 5582, 5193, 4797, 4391, 3977, 
-    3555, 3123, 2683, 2236, 1782, 1321, 856, 386, -81, -550, -1016, -1476, -1928, -2369, -2796, -3207, 
-    -3600, -3971, -4319, -4640, -4937, -5205, -5448, -5662, -5850, -6010, -6146, -6255, -6342, -6409, -6457, -6485, 
-    -6502, -6504, -6493, -6474, -6445, -6410, -6368, -6321, -6267, -6211, -6150, -6085, -6014, -5938, -5855, -5767, 
-    -5667, -5558, -5436, -5303, -5154, -4989, -4810, -4613, -4398, -4169, -3923, -3664, -3394, -3116, -2829, -2542, 
-    -2253, -1966, -1683, -1407, -1140, -882, -635, -400, -179, 34, 233, 425, 606, 781, 949, 1115, 
-    1274, 1438, 1599, 1762, 1927, 2095, 2264, 2434, 2606, 2778, 2948, 3114, 3278, 3431, 3579, 3711, 
-    3833, 3936, 4023, 4087, 4133, 4153, 4151, 4124, 4075, 4002, 3908, 3794, 3661, 3512, 3351, 3177, 
-    2997, 2808, 2618, 2424, 2232, 2037, 1848, 1661, 1479, 1298, 1122, 949, 778, 611, 444, 280, 
-    117, -43, -203, -359, -515, -664, -809, -951, -1085, -1211, -1330, -1440, -1541, -1633, -1716, -1790, 
-    -1854, -1909, -1956, -1996, -2025, -2048, -2064, -2072, -2072, -2067, -2055, -2037, -2012, -1984, -1949, -1909, 
-    -1863, -1813, -1756, -1694, -1624, -1550, -1466, -1379, -1281, -1178, -1068, -953, -830, -705, -573, -441, 
-    -304, -166, -26, 109, 250, 386, 523, 654, 786, 915, 1043, 1167, 1294, 1418, 1544, 1667, 
-    1793, 1914, 2036, 2153, 2267, 2372, 2472, 2558, 2635, 2697, 2746, 2777, 2795, 2798, 2785, 2758, 
-    2721, 2675, 2617, 2556, 2491, 2423, 2355, 2292, 2227, 2168, 2110, 2057, 2004, 1952, 1898, 1840, 
-    1776, 1703, 1621, 1524, 1415, 1289, 1148, 992, 820, 632, 435, 225, 9, -213, -438, -666, 
-    -890, -1112, -1328, -1538, -1738, -1930, -2110, -2283, -2443, -2595, -2736, -2871, -2995, -3112, -3223, -3330, 
-    -3428, -3527, -3616, -3703, -3781, -3856, -3918, -3976, -4020, -4058, -4080, -4094, -4091, -4078, -4048, -4007, 
-    -3948, -3876, -3786, -3684, -3565, -3430, -3283, -3124, -2951, -2767, -2574, -2371, -2161, -1942, -1718, -1488, 
-    -1256, -1018, -778, -535, -290, -44, 200, 445, 690, 931, 1172, 1408, 1645, 1876, 2104, 2328, 
-    2548, 2760, 2967, 3167, 3359, 3544, 3720, 3887, 4044, 4194, 4331, 4459, 4576, 4682, 4777, 4861, 
-    4932, 4991, 5038, 5072, 5094, 5101, 5097, 5077, 5045, 5000, 4942, 4872, 4790, 4698, 4594, 4482, 
-    4360, 4230, 4093, 3949, 3798, 3640, 3476, 3306, 3131, 2951, 2767, 2578, 2386, 2191, 1992, 1791, 
-    1586, 1379, 1168, 952, 730, 505, 270, 30, -216, -471, -734, -1003, -1279, -1561, -1850, -2143, 
-    -2441, -2741, -3041, -3339, -3635, -3926, -4208, -4482, -4745, -4995, -5230, -5451, -5654, -5840, -6009, -6161, 
-    -6293, -6411, -6512, -6594, -6661, -6713, -6745, -6766, -6767, -6752, -6720, -6673, -6606, -6526, -6425, -6310, 
-    -6176, -6025, -5856, -5671, -5463, -5240, -4996, -4734, -4453, -4155, -3839, -3508, -3163, -2806, -2439, -2062, 
-    -1681, -1295, -909, -524, -143, 230, 597, 952, 1296, 1629, 1948, 2252, 2547, 2830, 3103, 3369, 
-    3628, 3883, 4133, 4380, 4625, 4867, 5105, 5342, 5574, 5801, 6022, 6236, 6440, 6636, 6819, 6989, 
-    7145, 7285, 7406, 7509, 7593, 7657, 7697, 7718, 7717, 7693, 7648, 7581, 7492, 7384, 7256, 7109, 
-    6946, 6766, 6573, 6367, 6151, 5924, 5690, 5449, 5204, 4952, 4697, 4437, 4172, 3902, 3628, 3346, 
-    3056, 2760, 2451, 2132, 1802, 1459, 1105, 737, 357, -33, -433, -844, -1263, -1685, -2112, -2538, 
-    -2965, -3386, -3803, -4209, -4608, -4994, -5365, -5720, -6060, -6380, -6682, -6963, -7224, -7464, -7684, -7881, 
-    -8059, -8214, -8349, -8463, -8556, -8630, -8686, -8722, -8741, -8743, -8727, -8695, -8645, -8578, -8496, -8394, 
-    -8274, -8133, -7975, -7793, -7593, -7369, -7125, -6856, -6570, -6259, -5930, -5580, -5213, -4829, -4431, -4021, 
-    -3600, -3172, -2738, -2301, -1863, -1426, -991, -562, -136, 280, 691, 1093, 1488, 1872, 2249, 2618, 
-    2976, 3329, 3676, 4016, 4348, 4679, 5002, 5320, 5634, 5943, 6244, 6539, 6825, 7103, 7368, 7622, 
-    7859, 8082, 8284, 8469, 8629, 8769, 8883, 8974, 9040, 9082, 9098, 9092, 9062, 9009, 8934, 8837, 
-    8719, 8579, 8420, 8240, 8042, 7825, 7589, 7337, 7069, 6785, 6485, 6172, 5847, 5507, 5156, 4796, 
-    4423, 4041, 3649, 3247, 2838, 2419, 1990, 1555, 1112, 660, 202, -261, -731, -1206, -1681, -2156, 
-    -2629, -3097, -3556, -4003, -4438, -4856, -5255, -5632, -5988, -6317, -6621, -6896, -7145, -7367, -7562, -7730, 
-    -7875, -7996, -8095, -8173, -8234, -8275, -8303, -8314, -8314, -8300, -8275, -8236, -8186, -8120, -8044, -7950, 
-    -7842, -7716, -7574, -7411, -7232, -7032, -6816, -6581, -6331, -6062, -5781, -5485, -5177, -4857, -4529, -4193, 
-    -3849, -3502, -3149, -2793, -2435, -2073, -1708, -1341, -971, -597, -217, 165, 553, 946, 1341, 1742, 
-    2142, 2547, 2948, 3350, 3746, 4139, 4521, 4897, 5259, 5611, 5946, 6269, 6572, 6862, 7131, 7383, 
-    7613, 7827, 8017, 8187, 8336, 8463, 8566, 8647, 8704, 8735, 8739, 8718, 8669, 8590, 8482, 8347, 
-    8181, 7988, 7767, 7520, 7249, 6958, 6645, 6316, 5971, 5615, 5247, 4870, 4487, 4099, 3708, 3313, 
-    2919, 2523, 2129, 1733, 1339, 946, 556, 166, -218, -603, -983, -1362, -1735, -2105, -2467, -2824, 
-    -3173, -3514, -3846, -4168, -4481, -4784, -5075, -5354, -5624, -5882, -6126, -6360, -6581, -6790, -6985, -7167, 
-    -7337, -7491, -7630, -7758, -7868, -7964, -8045, -8109, -8158, -8190, -8204, -8201, -8180, -8139, -8079, -8000, 
-    -7900, -7778, -7636, -7472, -7285, -7076, -6847, -6593, -6317, -6020, -5700, -5360, -4997, -4616, -4214, -3795, 
-    -3358, -2905, -2437, -1959, -1468, -969, -463, 48, 561, 1077, 1589, 2098, 2603, 3097, 3584, 4058, 
-    4521, 4968, 5401, 5816, 6214, 6593, 6953, 7294, 7615, 7916, 8196, 8456, 8693, 8910, 9104, 9276, 
-    9424, 9553, 9657, 9739, 9798, 9837, 9850, 9841, 9810, 9754, 9674, 9571, 9443, 9290, 9114, 8912, 
-    8686, 8435, 8160, 7862, 7542, 7200, 6840, 6462, 6068, 5660, 5239, 4811, 4372, 3928, 3481, 3030, 
-    2576, 2124, 1668, 1213, 760, 301, -156, -616, -1082, -1550, -2023, -2499, -2980, -3460, -3944, -4425, 
-    -4905, -5377, -5841, -6293, -6732, -7151, -7550, -7928, -8278, -8605, -8905, -9177, -9424, -9648, -9846, -10022, 
-    -10179, -10318, -10440, -10547, -10640, -10722, -10790, -10845, -10885, -10910, -10919, -10907, -10872, -10814, -10728, -10611, 
-    -10467, -10284, -10072, -9825, -9543, -9228, -8882, -8504, -8099, -7667, -7213, -6737, -6244, -5734, -5213, -4680, 
-    -4140, -3590, -3037, -2475, -1912, -1343, -769, -192, 387, 972, 1559, 2148, 2740, 3331, 3922, 4508, 
-    5090, 5664, 6228, 6778, 7312, 7829, 8325, 8798, 9246, 9669, 10065, 10432, 10771, 11082, 11363, 11617, 
-    11842, 12041, 12213, 12360, 12480, 12576, 12648, 12694, 12714, 12710, 12678, 12620, 12534, 12420, 12276, 12105, 
-    11903, 11670, 11409, 11117, 10796, 10446, 10071, 9667, 9241, 8793, 8323, 7835, 7333, 6813, 6284, 5742, 
-    5193, 4635, 4074, 3503, 2934, 2358, 1781, 1200, 620, 33, -549, -1137, -1724, -2311, -2896, -3480, 
-    -4058, -4632, -5198, -5754, -6301, -6833, -7351, -7851, -8332, -8791, -9229, -9641, -10030, -10392, -10729, -11040, 
-    -11322, -11579, -11811, -12016, -12195, -12349, -12479, -12584, -12665, -12720, -12753, -12761, 
-};
-const unsigned int drum_v1_p3_short_len = 5292;
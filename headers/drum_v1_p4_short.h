@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v1_p4_short[] PROGMEM = {
-    106, -22, 37, 18, 40, 21, 27, 7, 3, -17, -26, -49, -60, -85, -100, -126, 
-    -145, -173, -195, -226, -251, -283, -309, -342, -367, -399, -425, -454, -478, -506, -527, -552, 
-    -572, -594, -614, -634, -651, -672, -689, -709, -725, -746, -763, -783, -801, -821, -837, -856, 
-    -872, -889, -901, -915, -924, -932, -938, -940, -941, -940, -934, -929, -919, -909, -894, -881, 
-    -863, -845, -824, -802, -777, -751, -722, -692, -656, -624, -585, -547, -507, -466, -424, -381, 
-    -338, -295, -251, -209, -166, -125, -82, -42, -2, 36, 76, 112, 151, 186, 224, 259, 
-    296, 332, 369, 405, 442, 479, 517, 554, 592, 628, 664, 697, 731, 760, 789, 814, 
-    839, 859, 879, 896, 913, 926, 940, 951, 963, 971, 980, 986, 991, 992, 992, 988, 
-    981, 970, 956, 936, 914, 887, 858, 824, 789, 750, 709, 667, 623, 577, 532, 483, 
-    433, 381, 327, 269, 209, 147, 81, 12, -58, -131, -206, -282, -359, -437, -514, -591, 
-    -666, -741, -811, -882, -949, -1013, -1075, -1133, -1187, -1239, -1286, -1330, -1372, -1409, -1443, -1473, 
-    -1499, -1522, -1540, -1553, -1563, -1566, -1565, -1558, -1547, -1529, -1505, -1476, -1440, -1399, -1350, -1299, 
-    -1240, -1176, -1108, -1035, -957, -875, -788, -698, -603, -505, -403, -298, -190, -79, 34, 149, 
-    267, 386, 507, 628, 750, 873, 994, 1117, 1237, 1357, 1474, 1589, 1702, 1809, 1913, 2012, 
-    2104, 2193, 2273, 2347, 2415, 2475, 2527, 2571, 2607, 2634, 2652, 2661, 2660, 2650, 2629, 2597, 
-    2555, 2502, 2439, 2364, 2281, 2185, 2080, 1965, 1840, 1707, 1564, 1414, 1255, 1089, 916, 737, 
-    550, 359, 162, -38, -245, -455, -668, -885, -1103, -1324, -1545, -1768, -1991, -2211, -2431, -2647, 
-    -2861, -3070, -3274, -3473, -3668, -3855, -4037, -4212, -4379, -4541, -4693, -4838, -4974, -5100, -5216, -5320, 
-    -5412, -5490, -5552, -5597, -5626, -5633, -5622, -5589, -5534, -5456, -5355, -5229, -5080, -4907, -4709, -4487, 
-    -4241, -3972, -3677, -3360, -3020, -2657, -2272, -1868, -1444, -1000, -542, -68, 417, 913, 1417, 1927, 
-    2439, 2950, 3460, 3965, 4461, 4948, 5422, 5882, 6324, 6750, 7154, 7539, 7899, 8237, 8550, 8839, 
-    9101, 9338, 9548, 9732, 9890, 10023, 10128, 10210, 10264, 10295, 10300, 10281, 10239, 10172, 10085, 9974, 
-    9842, 9688, 9513, 9317, 9098, 8861, 8597, 8314, 8004, 7671, 7311, 6922, 6503, 6053, 5568, 5050, 
-    4496, 3904, 3277, 2611, 1910, 1173, 402, -401, -1235, -2097, -2984, -3894, -4824, -5768, -6727, -7690, 
-    -8657, -9622, -10579, -11522, -12444, -13340, -14202, -15025, -15801, -16525, -17191, -17795, -18330, -18797, -19191, -19511, 
-    -19759, -19935, -20040, -20081, -20060, -19983, -19855, -19682, -19471, -19224, -18948, -18644, -18315, -17959, -17576, -17159, 
-    -16704, -16208, -15659, -15059, -14398, -13680, -12901, -12073, -11198, -10294, -9370, -8446, -7532, -6648, -5793, -4981, 
-    -4198, -3440, -2677, -1893, -1039, -99, 989, 2229, 3683, 5332, 7234, 9357, 11677, 14112, 16671, 19213, 
-    21782, 24170, 26621, 27748, 27617, 27700, 27640, 27688, 27647, 27683, 27650, 27682, 27651, 27681, 27652, 27680, 
-    27651, 27681, 27649, 27680, 27649, 27684, 27647, 27687, 27642, 27694, 27632, 27711, 27599, 27791, 26302, 23225, 
-    20394, 17397, 14550, 11696, 8996, 6428, 4093, 1949, 85, -1597, -3126, -4590, -5977, -7365, -8792, -10263, 
-    -11780, -13392, -15151, -16981, -18887, -20792, -22732, -24601, -26530, -27713, -27701, -27733, -27707, -27727, -27710, -27725, 
-    -27711, -27723, -27713, -27723, -27713, -27722, -27715, -27721, -27716, -27721, -27717, -27720, -27717, -27719, -27715, -27718, 
-    -27717, -27719, -27718, -27718, -27719, -27717, -27721, -27714, -27723, -27710, -27730, -27697, -27772, -27312, -24411, -21248, 
-    -18028, -14795, -11586, -8486, -5495, -2628, 151, 2819, 5388, 7865, 10277, 12612, 14872, 17073, 19225, 21376, 
-    23503, 25703, 27554, 27674, 27668, 27663, 27669, 27662, 27670, 27662, 27670, 27663, 27669, 27663, 27669, 27663, 
-    27670, 27663, 27669, 27664, 27668, 27664, 27668, 27664, 27668, 27664, 27668, 27665, 27668, 27664, 27667, 27665, 
-    27667, 27665, 27666, 27667, 27665, 27668, 27663, 27669, 27662, 27672, 27667, 27540, 24986, 21378, 17897, 14239, 
-    10638, 6904, 3231, -493, -4100, -7695, -11097, -14439, -17534, -20569, -23310, -26121, -27725, -27695, -27735, -27706, 
-    -27728, -27711, -27724, -27714, -27722, -27715, -27720, -27716, -27720, -27716, -27720, -27718, -27718, -27718, -27717, -27717, 
-    -27718, -27719, -27718, -27719, -27717, -27718, -27718, -27718, -27718, -27719, -27718, -27719, -27719, -27717, -27718, -27718, 
-    -27718, -27717, -27719, -27718, -27719, -27717, -27716, -27739, -27453, -23636, -18649, -13823, -8847, -3996, 867, 5546, 
-    10178, 14594, 18924, 23008, 26821, 27755, 27629, 27687, 27653, 27675, 27659, 27671, 27663, 27668, 27664, 27668, 
-    27665, 27666, 27666, 27666, 27667, 27665, 27668, 27664, 27669, 27664, 27669, 27663, 27670, 27662, 27670, 27662, 
-    27671, 27660, 27671, 27660, 27672, 27658, 27675, 27656, 27677, 27653, 27680, 27650, 27686, 27642, 27697, 27626, 
-    27722, 27576, 27846, 25405, 20498, 16003, 11116, 6451, 1573, -3058, -7798, -12242, -16781, -20931, -25305, -27737, 
-    -27683, -27741, -27703, -27729, -27711, -27724, -27714, -27721, -27716, -27720, -27718, -27718, -27719, -27718, -27719, -27718, 
-    -27720, -27718, -27720, -27717, -27718, -27715, -27719, -27717, -27720, -27715, -27720, -27717, -27720, -27716, -27719, -27715, 
-    -27719, -27716, -27719, -27717, -27719, -27716, -27718, -27719, -27717, -27721, -27712, -27728, -27695, -27784, -27215, -23391, 
-    -19243, -14945, -10625, -6201, -1860, 2497, 6671, 10821, 14723, 18635, 22210, 25979, 27768, 27605, 27707, 27637, 
-    27689, 27647, 27682, 27652, 27678, 27655, 27675, 27658, 27673, 27659, 27672, 27658, 27671, 27660, 27670, 27661, 
-    27670, 27662, 27670, 27663, 27670, 27663, 27669, 27663, 27669, 27663, 27669, 27663, 27668, 27664, 27669, 27663, 
-    27669, 27661, 27671, 27661, 27673, 27657, 27678, 27640, 27728, 27250, 23802, 20097, 16313, 12488, 8542, 4565, 
-    460, -3648, -7881, -12064, -16390, -20549, -24967, -27713, -27679, -27749, -27694, -27738, -27700, -27733, -27705, -27729, 
-    -27706, -27729, -27708, -27726, -27709, -27726, -27711, -27725, -27713, -27725, -27712, -27723, -27712, -27724, -27714, -27724, 
-    -27714, -27722, -27714, -27722, -27714, -27723, -27715, -27722, -27716, -27721, -27716, -27721, -27718, -27719, -27721, -27709, 
-    -27751, -27423, -24106, -20070, -16098, -12018, -7956, -3845, 204, 4243, 8153, 12022, 15699, 19340, 22687, 26126, 
-    27765, 27602, 27710, 27631, 27695, 27641, 27689, 27645, 27686, 27647, 27683, 27649, 27682, 27649, 27681, 27650, 
-    27681, 27650, 27681, 27651, 27681, 27649, 27681, 27650, 27683, 27649, 27683, 27649, 27685, 27646, 27686, 27645, 
-    27688, 27642, 27692, 27638, 27696, 27632, 27706, 27617, 27730, 27574, 27831, 25746, 21648, 17915, 14065, 10380, 
-    6671, 3031, -609, -4250, -7881, -11567, -15197, -18915, -22438, -26172, -27851, -27644, -27770, -27680, -27750, -27691, 
-    -27742, -27697, -27737, -27701, -27733, -27703, -27730, -27706, -27730, -27708, -27729, -27708, -27728, -27709, -27728, -27709, 
-    -27727, -27710, -27726, -27710, -27726, -27711, -27726, -27710, -27727, -27711, -27726, -27709, -27727, -27709, -27728, -27708, 
-    -27730, -27705, -27736, -27692, -27774, -27383, -24440, -21011, -17548, -13931, -10274, -6492, -2702, 1204, 5101, 9132, 
-    13105, 17226, 21169, 25396, 27725, 27610, 27707, 27634, 27692, 27644, 27685, 27649, 27682, 27651, 27679, 27652, 
-    27677, 27654, 27678, 27654, 27677, 27655, 27677, 27656, 27677, 27654, 27677, 27653, 27678, 27653, 27680, 27650, 
-    27683, 27645, 27690, 27631, 27730, 27080, 25043, 23006, 20972, 18991, 17055, 15172, 13347, 11550, 9785, 8002, 
-    6210, 4334, 2398, 317, -1859, -4210, -6648, -9257, -11918, -14737, -17539, -20485, -23283, -26282, -27780, -27674, 
-    -27747, -27697, -27734, -27706, -27728, -27710, -27725, -27712, -27721, -27713, -27720, -27717, -27719, -27719, -27717, -27720, 
-    -27715, -27720, -27714, -27724, -27709, -27728, -27703, -27739, -27684, -27790, -26915, -24346, -21828, -19220, -16685, -14116, 
-    -11627, -9145, -6758, -4410, -2171, 0, 2050, 4015, 5850, 7586, 9202, 10737, 12184, 13586, 14947, 16299, 
-    17649, 19020, 20421, 21849, 23320, 24794, 26341, 27611, 27666, 27670, 27662, 27669, 27661, 27669, 27663, 27668, 
-    27663, 27668, 27665, 27667, 27665, 27666, 27666, 27665, 27668, 27662, 27672, 27654, 27694, 27367, 26161, 24858, 
-    23381, 21780, 19986, 18048, 15933, 13699, 11329, 8898, 6409, 3943, 1512, -824, -3057, -5139, -7084, -8866, 
-    -10519, -12047, -13495, -14872, -16221, -17542, -18866, -20180, -21493, -22791, -24062, -25287, -26441, -27474, -27749, -27702, 
-    -27729, -27708, -27726, -27710, -27725, -27712, -27725, -27712, -27726, -27710, -27727, -27709, -27730, -27705, -27731, -27220, 
-    -26323, -25375, -24287, -23093, -21757, -20297, -18700, -16983, -15151, -13228, -11239, -9208, -7160, -5114, -3096, -1119, 
-    801, 2666, 4471, 6223, 7920, 9572, 11184, 12765, 14307, 15812, 17266, 18661, 19982, 21219, 22358, 23393, 
-    24307, 25104, 25771, 26318, 26739, 27051, 27249, 27350, 27353, 27268, 27092, 26841, 26516, 26128, 25670, 25153, 
-    24572, 23939, 23253, 22526, 21756, 20955, 20117, 19249, 18340, 17396, 16398, 15357, 14255, 13099, 11880, 10603, 
-    9257, 7845, 6364, 4817, 3207, 1548, -157, -1886, -3638, -5386, -7122, -8820, -10468, -12041, -13535, -14928, 
-    -16224, -17408, -18490, -19464, -20346, -21142, -21867, -22521, -23120, -23659, -24144, -24560, -24901, -25149, -25294, -25316, 
-    -25210, -24965, -24588, -24082, -23469, -22761, -21983, -21153, -20304, -19449, -18618, -17815, -17051, -16318, -15609, -14903, 
-    -14184, -13418, -12593, -11680, -10672, -9550, -8325, -7002, -5604, -4141, -2645, -1131, 369, 1841, 3254, 4600, 
-    5870, 7068, 8193, 9253, 10248, 11192, 12086, 12946, 13771, 14572, 15346, 16096, 16812, 17495, 18139, 18745, 
-    19297, 19789, 20200, 20522, 20737, 20839, 20819, 20679, 20420, 20052, 19582, 19032, 18408, 17727, 16998, 16233, 
-    15443, 14641, 13836, 13037, 12242, 11458, 10679, 9909, 9142, 8387, 7634, 6895, 6163, 5444, 4736, 4037, 
-    3342, 2647, 1948, 1244, 530, -193, -933, -1681, -2440, -3204, -3976, -4752, -5534, -6314, -7102, -7886, 
-    -8669, -9438, -10189, -10913, -11601, -12240, -12820, -13327, -13757, -14099, -14358, -14527, -14617, -14628, -14573, -14458, 
-    -14293, -14089, -13859, -13607, -13344, -13065, -12775, -12463, -12124, -11741, -11304, -10804, -10237, -9609, -8927, -8203, 
-    -7454, -6695, -5945, -5222, -4552, -3946, -3422, -2987, -2649, -2398, -2234, -2135, -2086, -2061, -2039, -1996, 
-    -1916, -1784, -1596, -1344, -1034, -664, -244, 214, 702, 1215, 1738, 2270, 2797, 3317, 3824, 4323, 
-    4812, 5300, 5790, 6286, 6788, 7295, 7800, 8294, 8765, 9197, 9574, 9880, 10100, 10226, 10249, 10176, 
-    10006, 9755, 9438, 9079, 8696, 8314, 7951, 7628, 7356, 7148, 7006, 6932, 6918, 6951, 7013, 7087, 
-    7149, 7182, 7165, 7089, 6938, 6709, 6401, 6019, 5572, 5070, 4527, 3959, 3377, 2806, 2259, 1758, 
-    1311, 928, 612, 364, 172, 26, -90, -191, -292, -407, -556, -745, -985, -1276, -1621, -2007, 
-    -2428, -2866, -3302, -3719, -4098, -4429, -4700, -4912, -5064, -5160, -5214, -5239, -5253, -5271, -5310, -5377, 
-    -5483, -5629, -5818, -6045, -6302, -6576, -6856, -7124, -7367, -7572, -7730, -7830, -7873, -7863, -7808, -7720, 
-    -7611, -7489, -7368, -7251, -7151, -7067, -7007, -6963, -6938, -6925, -6919, -6915, -6905, -6879, -6833, -6758, 
-    -6655, -6514, -6330, -6098, -5816, -5479, -5090, -4646, -4153, -3614, -3031, -2410, -1764, -1097, -423, 249, 
-    906, 1539, 2138, 2699, 3218, 3696, 4136, 4547, 4935, 5310, 5681, 6057, 6438, 6831, 7230, 7638, 
-    8044, 8445, 8835, 9209, 9561, 9891, 10194, 10471, 10721, 10951, 11164, 11363, 11550, 11729, 11894, 12047, 
-    12177, 12278, 12334, 12337, 12277, 12148, 11938, 11644, 11261, 10791, 10238, 9610, 8911, 8153, 7345, 6504, 
-    5636, 4757, 3879, 3019, 2179, 1372, 597, -136, -830, -1478, -2082, -2641, -3153, -3620, -4047, -4432, 
-    -4787, -5113, -5418, -5703, -5972, -6224, -6462, -6685, -6887, -7071, -7237, -7384, -7514, -7629, -7732, -7829, 
-    -7922, -8018, -8116, -8223, -8339, -8461, -8592, -8721, -8850, -8966, -9070, -9153, -9214, -9243, -9243, -9210, 
-    -9147, -9054, -8936, -8794, -8631, -8450, -8253, -8043, -7819, -7582, -7330, -7057, -6763, -6441, -6095, -5716, 
-    -5301, -4842, -4343, -3800, -3218, -2602, -1963, -1308, -647, 5, 637, 1238, 1792, 2291, 2730, 3104, 
-    3412, 3655, 3839, 3971, 4062, 4125, 4171, 4216, 4268, 4337, 4429, 4547, 4694, 4872, 5071, 5289, 
-    5518, 5747, 5971, 6183, 6383, 6569, 6738, 6891, 7031, 7162, 7288, 7418, 7556, 7712, 7885, 8079, 
-    8295, 8527, 8770, 9012, 9244, 9455, 9629, 9760, 9831, 9842, 9780, 9644, 9436, 9157, 8812, 8408, 
-    7951, 7451, 6914, 6347, 5761, 5163, 4558, 3956, 3363, 2789, 2240, 1724, 1245, 810, 419, 78, 
-    -215, -461, -665, -835, -980, -1115, -1249, -1395, -1563, -1758, -1990, -2263, -2582, -2942, -3344, -3780, 
-    -4248, -4737, -5244, -5758, -6277, -6794, -7304, -7807, -8301, -8781, -9248, -9696, -10119, -10511, -10867, -11178, 
-    -11444, -11654, -11808, -11906, -11949, -11942, -11887, -11786, -11645, -11468, -11262, -11026, -10768, -10490, -10193, -9881, 
-    -9559, -9231, -8899, -8569, -8243, -7922, -7611, -7310, -7023, -6746, -6477, -6216, -5954, -5687, -5407, -5104, 
-    -4776, -4414, -4015, -3575, -3093, -2565, -1993, -1374, -712, -5, 743, 1532, 2355, 3207, 4085, 4981, 
-    5890, 6802, 7707, 8602, 9476, 10325, 11146, 11932, 12683, 13398, 14075, 14719, 15325, 15893, 16427, 16918, 
-    17373, 17785, 18154, 18479, 18754, 18975, 19138, 19237, 19265, 19219, 19091, 18880, 18583, 18193, 17714, 17149, 
-    16500, 15777, 14986, 14143, 13256, 12340, 11402, 10455, 9505, 8557, 7614, 6677, 5745, 4815, 3887, 2956, 
-    2021, 1076, 120, -849, -1837, -2848, -3882, -4945, -6037, -7160, -8312, -9488, -10683, -11886, -13088, -14275, 
-    -15431, -16543, -17598, -18585, -19492, -20316, -21055, -21703, -22269, -22755, -23171, -23525, -23823, -24069, -24262, -24397, 
-    -24470, -24469, -24385, -24207, -23920, -23513, -22978, -22307, -21503, -20567, -19511, -18346, -17089, -15764, -14391, -12996, 
-    -11599, -10221, -8874, -7568, -6309, -5098, -3928, -2790, -1670, -551, 577, 1732, 2923, 4159, 5443, 6773, 
-    8143, 9540, 10944, 12338, 13700, 15012, 16254, 17416, 18485, 19457, 20329, 21104, 21791, 22396, 22928, 23393, 
-    23800, 24156, 24463, 24725, 24941, 25107, 25215, 25259, 25225, 25105, 24886, 24564, 24132, 23587, 22930, 22161, 
-    21286, 20316, 19260, 18129, 16933, 15688, 14402, 13089, 11759, 10419, 9080, 7743, 6409, 5080, 3753, 2423, 
-    1090, -255, -1616, -2994, -4394, -5812, -7248, -8692, -10139, -11576, -12993, -14374, -15705, -16976, -18166, -19266, 
-    -20266, -21159, -21941, -22610, -23169, -23624, -23981, -24249, -24435, -24546, -24589, -24565, -24483, -24343, -24150, -23905, 
-    -23607, -23253, -22843, -22364, -21819, -21199, -20502, -19727, -18870, -17929, -16903, -15787, -14586, -13300, -11937, -10504, 
-    -9013, -7476, -5909, -4326, -2743, -1172, 377, 1893, 3368, 4793, 6165, 7478, 8727, 9919, 11049, 12126, 
-    13153, 14132, 15068, 15961, 16811, 17614, 18372, 19077, 19727, 20314, 20833, 21275, 21639, 21921, 22119, 22237, 
-    22274, 22238, 22130, 21954, 21716, 21420, 21069, 20664, 20204, 19686, 19106, 18455, 17730, 16923, 16031, 15051, 
-    13985, 12830, 11595, 10286, 8912, 7485, 6014, 4511, 2986, 1448, -88, -1618, -3132, -4622, -6082, -7508, 
-    -8894, -10234, -11525, -12756, -13924, -15017, -16029, -16949, -17771, -18489, -19096, -19594, -19980, -20262, -20448, -20544, 
-    -20559, -20502, -20383, -20209, -19992, -19736, -19440, -19108, -18732, -18307, -17824, -17275, -16647, -15936, -15133, -14238, 
-    -13258, -12196, -11065, -9876, -8642, -7379, -6101, -4819, -3549, -2298, -1074, 118, 1278, 2406, 3505, 4581, 
-    5639, 6683, 7715, 8732, 9738, 10723, 11682, 12610, 13495, 14332, 15112, 15828, 16470, 17034, 17514, 17907, 
-    18210, 18425, 18551, 18593, 18554, 18437, 18249, 17992, 17667, 17286, 16848, 16358, 15816, 15222, 14579, 13884, 
-    13141, 12346, 11501, 10607, 9661, 8671, 7634, 6556, 5439, 4289, 3113, 1920, 720, -480, -1675, -2853, 
-    -4011, -5141, -6238, -7296, -8312, -9282, -10203, -11071, -11887, -12651, -13364, -14029, -14649, -15227, -15762, -16255, 
-    -16707, -17118, -17487, -17813, -18088, -18314, -18482, -18588, -18626, -18591, -18474, -18272, -17982, -17598, -17120, -16547, 
-    -15875, -15109, -14250, -13304, -12274, -11174, -10014, -8806, -7567, -6311, -5053, -3808, -2590, -1404, -259, 843, 
-    1904, 2924, 3910, 4867, 5805, 6730, 7644, 8553, 9452, 10338, 11204, 12038, 12835, 13581, 14264, 14878, 
-    15418, 15877, 16258, 16562, 16790, 16948, 17046, 17089, 17088, 17049, 16978, 16880, 16759, 16619, 16460, 16282, 
-    16082, 15856, 15599, 15305, 14967, 14576, 14126, 13610, 13019, 12348, 11593, 10756, 9836, 8838, 7768, 6634, 
-    5447, 4220, 2963, 1692, 420, -841, -2079, -3288, -4458, -5584, -6663, -7691, -8666, -9589, -10457, -11274, 
-    -12040, -12755, -13425, -14048, -14630, -15167, -15662, -16113, -16516, -16869, -17167, -17410, -17595, -17719, -17782, -17781, 
-    -17712, -17573, -17365, -17088, -16748, -16345, -15889, -15379, -14821, -14216, -13566, -12874, -12140, -11371, -10574, -9751, 
-    -8913, -8064, -7206, -6345, -5484, -4624, -3767, -2911, -2057, -1203, -349, 505, 1361, 2215, 3066, 3908, 
-    4735, 5543, 6325, 7074, 7791, 8468, 9103, 9696, 10246, 10758, 11234, 11679, 12096, 12488, 12856, 13198, 
-    13514, 13799, 14050, 14263, 14430, 14548, 14609, 14608, 14544, 14412, 14210, 13938, 13597, 13193, 12731, 12222, 
-    11675, 11099, 10503, 9896, 9287, 8678, 8074, 7476, 6881, 6291, 5695, 5099, 4489, 3869, 3229, 2572, 
-    1895, 1202, 495, -217, -926, -1623, -2297, -2941, -3546, -4111, -4628, -5099, -5525, -5905, -6242, -6542, 
-    -6806, -7041, -7249, -7432, -7597, -7738, -7861, -7960, -8036, -8086, -8110, -8109, -8081, -8033, -7967, -7887, 
-    -7799, -7707, -7613, -7515, -7417, -7315, -7208, -7096, -6977, -6845, -6703, -6548, -6380, -6200, -6010, -5810, 
-    -5604, -5394, -5181, -4970, -4760, -4552, -4349, -4149, -3953, -3757, -3559, -3357, -3149, -2929, -2696, -2452, 
-    -2192, -1919, -1630, -1329, -1015, -689, -357, -19, 316, 647, 965, 1267, 1548, 1808, 2044, 2255, 
-    2443, 2608, 2753, 2881, 2998, 3106, 3210, 3311, 3414, 3517, 3623, 3732, 3843, 3953, 4061, 4165, 
-    4266, 4361, 4454, 4542, 4628, 4714, 4798, 4885, 4974, 5072, 5180, 5301, 5439, 5594, 5768, 5960, 
-    6168, 6384, 6602, 6814, 7012, 7189, 7338, 7453, 7528, 7558, 7540, 7473, 7357, 7195, 6987, 6741, 
-    6456, 6138, 5792, 5423, 5033, 4628, 4208, 3776, 3335, 2887, 2434, 1979, 1524, 1073, 627, 188, 
-    -238, -658, -1064, -1458, -1837, -2197, -2543, -2867, -3176, -3465, -3735, -3988, -4222, -4438, -4639, -4826, 
-    -5002, -5171, -5339, -5508, -5684, -5870, -6073, -6291, -6529, -6783, -7054, -7337, -7631, -7930, -8229, -8521, 
-    -8799, -9058, -9293, -9496, -9669, -9802, -9893, -9941, -9938, -9886, -9780, -9618, -9399, -9120, -8783, -8387, 
-    -7940, -7440, -6898, -6314, -5700, -5066, -4419, -3767, -3122, -2486, -1873, -1282, -714, -174, 344, 842, 
-    1323, 1791, 2253, 2709, 3164, 3618, 4070, 4518, 4960, 5391, 5807, 6202, 6571, 6912, 7222, 7502, 
-    7750, 7972, 8171, 8353, 8524, 8688, 8851, 9016, 9183, 9352, 9521, 9689, 9850, 10005, 10144, 10266, 
-    10363, 10432, 10465, 10457, 10403, 10300, 10144, 9935, 9670, 9347, 8968, 8533, 8045, 7507, 6924, 6301, 
-    5648, 4967, 4270, 3557, 2837, 2115, 1395, 684, -16, -699, -1362, -1999, -2607, -3182, -3720, -4220, 
-    -4677, -5090, -5459, -5781, -6057, -6288, -6481, -6633, -6755, -6847, -6918, -6971, -7012, -7043, -7069, -7090, 
-    -7107, -7120, -7129, -7131, -7128, -7113, -7084, -7041, -6978, -6891, -6780, -6641, -6476, -6284, -6070, -5836, 
-    -5592, -5338, -5084, -4836, -4594, -4368, -4156, -3959, -3776, -3603, -3438, -3274, -3106, -2927, -2732, -2515, 
-    -2271, -1999, -1697, -1370, -1021, -656, -287, 80, 438, 778, 1095, 1381, 1637, 1854, 2036, 2184, 
-    2296, 2380, 2436, 2468, 2481, 2479, 2462, 2435, 2398, 2355, 2307, 2257, 2207, 2163, 2126, 2100, 
-    2087, 2090, 2108, 2145, 2197, 2265, 2348, 2441, 2543, 2650, 2759, 2864, 2964, 3055, 3137, 3206, 
-    3270, 3326, 3380, 3435, 3494, 3563, 3642, 3735, 3841, 3961, 4092, 4228, 4367, 4499, 4621, 4724, 
-    4804, 4858, 4880, 4873, 4836, 4775, 4689, 4582, 4460, 4327, 4186, 4043, 3902, 3764, 3631, 3503, 
-    3381, 3265, 3153, 3045, 2939, 2832, 2722, 2607, 2483, 2350, 2204, 2041, 1861, 1658, 1436, 1188, 
-    915, 619, 294, -54, -430, -827, -1246, -1683, -2133, -2594, -3058, -3522, -3983, -4437, -4882, -5318, 
-    -5739, -6145, -6533, -6901, -7248, -7574, -7879, -8164, -8431, -8678, -8911, -9125, -9326, -9506, -9671, -9814, 
-    -9936, -10030, -10093, -10120, -10104, -10045, -9935, -9772, -9554, -9281, -8953, -8575, -8147, -7680, -7179, -6650, 
-    -6103, -5546, -4983, -4422, -3866, -3318, -2782, -2257, -1746, -1248, -763, -291, 172, 627, 1079, 1529, 
-    1982, 2440, 2912, 3400, 3910, 4445, 5009, 5605, 6230, 6881, 7556, 8245, 8941, 9633, 10312, 10967, 
-    11591, 12176, 12714, 13202, 13636, 14010, 14325, 14582, 14778, 14914, 14992, 15012, 14975, 14880, 14728, 14520, 
-    14254, 13931, 13556, 13129, 12654, 12134, 11570, 10965, 10319, 9632, 8910, 8148, 7352, 6524, 5665, 4781, 
-    3875, 2952, 2020, 1084, 151, -771, -1680, -2568, -3434, -4273, -5087, -5874, -6638, -7377, -8096, -8797, 
-    -9483, -10152, -10808, -11444, -12063, -12654, -13223, -13756, -14255, -14711, -15121, -15483, -15791, -16047, -16246, -16389, 
-    -16475, -16504, -16477, -16393, -16256, -16063, -15819, -15520, -15169, -14765, -14309, -13803, -13249, -12647, -12004, -11321, 
-    -10601, -9846, -9061, -8244, -7400, -6527, -5630, -4707, -3759, -2789, -1796, -783, 244, 1287, 2338, 3393, 
-    4447, 5494, 6525, 7538, 8521, 9469, 10378, 11239, 12051, 12809, 13511, 14156, 14738, 15260, 15720, 16115, 
-    16446, 16712, 16914, 17052, 17128, 17146, 17105, 17010, 16863, 16664, 16414, 16116, 15769, 15373, 14927, 14433, 
-    13889, 13295, 12652, 11962, 11229, 10456, 9648, 8812, 7952, 7079, 6194, 5307, 4419, 3535, 2654, 1778, 
-    905, 35, -832, -1701, -2569, -3438, -4303, -5161, -6008, -6837, -7644, -8421, -9161, -9860, -10510, -11110, 
-    -11656, -12147, -12585, -12968, -13302, -13587, -13827, -14024, -14181, -14297, -14376, -14414, -14410, -14363, -14268, -14123, 
-    -13923, -13668, -13355, -12983, -12556, -12072, -11538, -10955, -10330, -9667, -8975, -8255, -7518, -6764, -6000, -5229, 
-    -4456, -3681, -2909, -2142, -1383, -634, 101, 820, 1522, 2204, 2867, 3507, 4126, 4725, 5302, 5859, 
-    6395, 6910, 7403, 7873, 8322, 8745, 9142, 9509, 9842, 10138, 10395, 10605, 10772, 10889, 10957, 10977, 
-    10949, 10874, 10756, 10594, 10392, 10155, 9884, 9584, 9256, 8902, 8526, 8127, 7707, 7267, 6808, 6330, 
-    5836, 5324, 4797, 4255, 3697, 3123, 2535, 1933, 1320, 698, 72, -552, -1173, -1781, -2372, -2938, 
-    -3474, -3974, -4431, -4843, -5208, -5523, -5791, -6010, -6184, -6313, -6407, -6464, -6494, -6499, -6483, -6451, 
-    -6404, -6347, -6280, -6205, -6122, -6032, -5930, -5818, -5693, -5548, -5383, -5194, -4976, -4732, -4456, -4151, 
-    -3819, -3465, -3095, -2712, -2328, -1944, -1569, -1208, -863, -537, -234, 50, 314, 562, 794, 1019, 
-    1235, 1451, 1667, 1886, 2109, 2336, 2563, 2793, 3019, 3238, 3445, 3636, 3803, 3945, 4051, 4122, 
-    4152, 4139, 4085, 3990, 3856, 3688, 3491, 3270, 3033, 2783, 2526, 2269, 2011, 1759, 1514, 1273, 
-    1040, 811, 587, 366, 148, -67, -278, -486, -686, -878, -1061, -1229, -1384, -1523, -1646, -1752, 
-    -1843, -1916, -1976, -2020, -2050, -2068, -2071, -2064, -2045, -2015, -1977, -1928, -1870, -1802, -1723, -1634, 
-    -1534, -1420, -1295, -1156, -1007, -847, -678, -502, -323, -137, 46, 231, 415, 594, 769, 942, 
-    1111, 1277, 1445, 1611, 1777, 1940, 2100, 2253, 2394, 2520, 2625, 2708, 2764, 2792, 2794, 2770, 
-    2723, 2660, 2580, 2496, 2404, 2317, 2231, 2152, 2078, 2008, 1937, 1864, 1780, 1682, 1564, 1422, 
-    1253, 1056, 831, 580, 309, 22, -274, -576, -878, -1172, -1457, -1727, -1980, -2217, -2434, -2634, 
-    -2819, -2988, -3143, -3288, -3423, -3551, -3669, -3777, -3873, -3953, -4018, -4063, -4088, -4089, -4068, -4020, 
-    -3947, -3847, -3719, -3565, -3382, -3178, -2951, -2703, -2440, -2160, -1868, -1565, -1255, -937, -615, -289, 
-    38, 365, 691, 1014, 1332, 1647, 1955, 2256, 2550, 2832, 3103, 3361, 3606, 3835, 4047, 4242, 
-    4419, 4577, 4715, 4834, 4931, 5007, 5061, 5091, 5097, 5081, 5039, 4976, 4890, 4783, 4656, 4511, 
-    4350, 4175, 3986, 3786, 3573, 3350, 3117, 2876, 2626, 2371, 2110, 1843, 1570, 1293, 1007, 713, 
-    408, 91, -237, -580, -935, -1303, -1681, -2071, -2467, -2868, -3267, -3662, -4046, -4417, -4768, -5096, 
-    -5398, -5672, -5912, -6125, -6303, -6454, -6573, -6664, -6725, -6758, -6762, -6735, -6680, -6593, -6477, -6330, 
-    -6154, -5944, -5705, -5431, -5125, -4784, -4410, -4004, -3570, -3110, -2629, -2131, -1622, -1107, -593, -85, 
-    410, 890, 1349, 1787, 2200, 2593, 2966, 3323, 3669, 4007, 4337, 4664, 4985, 5302, 5611, 5911, 
-    6200, 6473, 6728, 6961, 7168, 7346, 7491, 7602, 7676, 7712, 7709, 7666, 7586, 7467, 7314, 7125, 
-    6906, 6659, 6390, 6100, 5794, 5475, 5147, 4809, 4464, 4110, 3748, 3375, 2988, 2587, 2165, 1723, 
-    1260, 774, 266, -259, -804, -1363, -1929, -2498, -3066, -3626, -4172, -4702, -5208, -5688, -6139, -6556, 
-    -6938, -7283, -7592, -7863, -8096, -8292, -8450, -8572, -8661, -8715, -8738, -8730, -8692, -8623, -8524, -8394, 
-    -8231, -8033, -7798, -7526, -7215, -6865, -6478, -6051, -5591, -5098, -4577, -4033, -3470, -2895, -2313, -1728, 
-    -1146, -572, -6, 545, 1085, 1609, 2116, 2610, 3087, 3555, 4009, 4453, 4889, 5315, 5733, 6139, 
-    6534, 6914, 7277, 7617, 7932, 8215, 8464, 8674, 8843, 8969, 9051, 9090, 9086, 9040, 8954, 8830, 
-    8666, 8466, 8230, 7960, 7658, 7325, 6963, 6572, 6157, 5719, 5257, 4778, 4278, 3761, 3227, 2678, 
-    2111, 1532, 938, 330, -286, -915, -1549, -2183, -2813, -3430, -4029, -4604, -5147, -5654, -6120, -6540, 
-    -6911, -7234, -7510, -7737, -7923, -8067, -8174, -8248, -8292, -8310, -8304, -8277, -8227, -8154, -8058, -7936, 
-    -7784, -7603, -7389, -7143, -6863, -6551, -6210, -5841, -5448, -5032, -4599, -4151, -3691, -3223, -2748, -2269, 
-    -1784, -1294, -799, -295, 215, 735, 1261, 1794, 2330, 2868, 3403, 3931, 4446, 4946, 5426, 5881, 
-    6311, 6710, 7079, 7414, 7715, 7980, 8207, 8396, 8545, 8653, 8717, 8735, 8706, 8627, 8497, 8315, 
-    8081, 7799, 7469, 7098, 6690, 6250, 5785, 5299, 4796, 4283, 3762, 3236, 2709, 2182, 1655, 1130, 
-    608, 89, -424, -934, -1437, -1934, -2421, -2896, -3358, -3804, -4233, -4646, -5038, -5410, -5765, -6096, 
-    -6406, -6695, -6960, -7202, -7421, -7612, -7780, -7919, -8033, -8117, -8173, -8199, -8192, -8154, -8080, -7973, 
-    -7827, -7644, -7422, -7161, -6861, -6520, -6140, -5721, -5263, -4769, -4240, -3678, -3086, -2466, -1826, -1166, 
-    -492, 189, 875, 1560, 2239, 2906, 3557, 4189, 4797, 5378, 5929, 6449, 6935, 7386, 7802, 8181, 
-    8523, 8827, 9093, 9317, 9503, 9649, 9753, 9820, 9844, 9827, 9770, 9669, 9527, 9340, 9111, 8836, 
-    8518, 8157, 7754, 7313, 6836, 6329, 5794, 5235, 4661, 4071, 3476, 2873, 2269, 1662, 1056, 448, 
-    -163, -778, -1402, -2031, -2668, -3309, -3953, -4595, -5231, -5851, -6451, -7022, -7559, -8055, -8505, -8911, 
-    -9266, -9579, -9848, -10077, -10274, -10439, -10577, -10693, -10786, -10855, -10898, -10912, -10889, -10825, -10714, -10551, 
-    -10330, -10050, -9710, -9307, -8850, -8337, -7776, -7172, -6532, -5861, -5166, -4453, -3725, -2986, -2238, -1481, 
-    -716, 53, 831, 1614, 2401, 3191, 3978, 4759, 5529, 6282, 7010, 7709, 8373, 8995, 9572, 10102, 
-    10581, 11010, 11387, 11715, 11993, 12225, 12410, 12550, 12647, 12698, 12704, 12664, 12575, 12437, 12247, 12006, 
-    11710, 11361, 10960, 10507, 10006, 9458, 8871, 8244, 7588, 6902, 6195, 5470, 4729, 3979, 3219, 2455, 
-    1683, 909, 130, -649, -1433, -2216, -2997, -3773, -4541, -5296, -6033, -6750, -7440, -8099, -8720, -9303, 
-    -9842, -10336, -10784, -11185, -11538, -11846, -12107, -12323, -12494, -12623, -12706, -12748, -12748, -12706, -12623, -12499, 
-    -12335, -12131, -11885, -11601, -11276, -10910, -10504, -10056, -9569, -9041, -8472, -7865, -7220, -6538, -5823, -5074, 
-    -4296, -3490, -2662, -1816, -955, -85, 788, 1663, 2534, 3396, 4247, 5082, 5897, 6693, 7461, 8202, 
-    8913, 9589, 10228, 10827, 11383, 11891, 12347, 12749, 13090, 13369, 13583, 13728, 13804, 13809, 13745, 13611, 
-    13414, 13154, 12839, 12471, 12058, 11601, 11111, 10587, 10035, 9458, 8856, 8233, 7586, 6918, 6226, 5513, 
-    4776, 4020, 3243, 2450, 1646, 835, 24, -779, -1573, -2347, -3099, -3823, -4517, -5177, -5803, -6395, 
-    -6954, -7485, -7988, -8467, -8924, -9361, -9778, -10174, -10549, -10898, -11219, -11508, -11757, -11965, -12125, -12235, 
-    -12291, -12291, -12235, -12119, -11949, -11722, -11440, -11108, -10725, -10295, -9823, -9309, -8759, -8172, -7554, -6906, 
-    -6231, -5530, -4807, -4065, -3306, -2534, -1750, -960, -166, 629, 1420, 2202, 2971, 3722, 4449, 5150, 
-    5820, 6454, 7053, 7611, 8130, 8604, 9036, 9420, 9757, 10048, 10286, 10477, 10616, 10708, 10748, 10744, 
-    10694, 10603, 10473, 10308, 10110, 9885, 9634, 9360, 9064, 8748, 8410, 8051, 7668, 7261, 6826, 6364, 
-    5876, 5362, 4824, 4265, 3689, 3100, 2500, 1895, 1289, 682, 79, -522, -1118, -1713, -2306, -2897, 
-    -3486, -4073, -4657, -5236, -5805, -6361, -6897, -7409, -7888, -8328, -8724, -9071, -9361, -9595, -9769, -9883, 
-    -9938, -9935, -9880, -9771, -9618, -9420, -9186, -8915, -8615, -8285, -7928, -7545, -7137, -6705, -6249, -5772, 
-    -5274, -4758, -4228, -3683, -3129, -2567, -2001, -1432, -865, -300, 259, 812, 1357, 1892, 2418, 2932, 
-    3434, 3923, 4394, 4846, 5276, 5679, 6051, 6393, 6698, 6967, 7198, 7391, 7548, 7666, 7750, 7801, 
-    7820, 7809, 7771, 7706, 7617, 7503, 7363, 7200, 7009, 6793, 6549, 6278, 5978, 5651, 5295, 4914, 
-    4509, 4082, 3638, 3179, 2710, 2236, 1759, 1285, 817, 357, -90, -524, -947, -1355, -1754, -2142, 
-    -2524, -2902, -3275, -3647, -4016, -4381, -4738, -5085, -5417, -5727, -6012, -6264, -6480, -6652, -6780, -6859, 
-    -6891, -6876, -6817, -6718, -6583, -6417, -6224, -6011, -5781, -5535, -5277, -5008, -4726, -4434, -4129, -3811, 
-    -3478, -3130, -2766, -2385, -1989, -1577, -1155, -724, -288, 147, 582, 1007, 1423, 1822, 2202, 2561, 
-    2895, 3205, 3488, 3745, 3978, 4184, 4368, 4528, 4668, 4787, 4886, 4968, 5029, 5073, 5097, 5101, 
-    5084, 5046, 4986, 4904, 4800, 4673, 4525, 4354, 4163, 3951, 3719, 3470, 3204, 2924, 2630, 2325, 
-    2012, 1690, 1365, 1037, 709, 383, 61, -253, -561, -858, -1147, -1423, -1690, -1944, -2190, -2423, 
-    -2645, -2857, -3056, -3242, -3415, -3573, -3713, -3833, -3935, -4011, -4066, -4095, -4099, -4076, -4027, -3951, 
-    -3851, -3727, -3581, -3415, -3232, -3034, -2823, -2601, -2370, -2132, -1890, -1643, -1393, -1142, -890, -636, 
-    -383, -128, 126, 383, 638, 895, 1150, 1403, 1651, 1894, 2131, 2357, 2574, 2779, 2971, 3148, 
-    3311, 3456, 3583, 3693, 3781, 3848, 3895, 3918, 3920, 3899, 3854, 3787, 3699, 3590, 3461, 3316, 
-    3153, 2976, 2788, 2587, 2379, 2160, 1935, 1699, 1454, 1200, 934, 655, 364, 62, -254, -578, 
-    -913, -1252, -1594, -1934, -2270, -2595, -2910, -3206, -3486, -3742, -3977, -4189, -4379, -4546, -4692, -4820, 
-    -4927, -5019, -5093, -5150, -5191, -5211, -5214, -5193, -5149, -5079, -4979, -4848, -4685, -4488, -4255, -3988, 
-    -3686, -3352, -2990, -2601, -2192, -1765, -1326, -876, -425, 30, 480, 925, 1365, 1794, 2213, 2621, 
-    3017, 3399, 3768, 4124, 4464, 4788, 5096, 5385, 5656, 5904, 6131, 6332, 6509, 6659, 6782, 6877, 
-    6943, 6981, 6989, 6964, 6913, 6829, 6717, 6576, 6407, 6210, 5988, 5741, 5470, 5178, 4866, 4536, 
-    4186, 3823, 3441, 3049, 2641, 2222, 1790, 1347, 894, 431, -39, -518, -1002, -1492, -1983, -2473, 
-    -2962, -3444, -3919, -4383, -4834, -5269, -5685, -6081, -6455, -6805, -7129, -7427, -7695, -7933, -8140, -8313, 
-    -8450, -8551, -8613, -8634, -8614, -8553, -8449, -8305, -8121, -7901, -7644, -7358, -7041, -6698, -6334, -5948, 
-    -5543, -5121, -4681, -4225, -3753, -3265, -2762, -2244, -1711, -1170, -615, -54, 508, 1074, 1634, 2187, 
-    2730, 3257, 3767, 4257, 4728, 5175, 5601, 6006, 6389, 6750, 7090, 7409, 7704, 7974, 8218, 8432, 
-    8616, 8763, 8874, 8946, 8977, 8966, 8915, 8825, 8696, 8533, 8337, 8114, 7863, 7592, 7298, 6988, 
-    6661, 6318, 5959, 5583, 5190, 4778, 4347, 3893, 3418, 2918, 2397, 1855, 1294, 717, 127, -467, 
-    -1066, -1663, -2250, -2824, -3379, -3910, -4412, -4885, -5323, -5727, -6097, -6431, -6733, -7004, -7246, -7461, 
-    -7653, -7822, -7970, -8099, -8205, -8291, -8353, -8390, -8399, -8379, -8324, -8233, -8105, -7936, -7727, -7479, 
-    -7188, -6862, -6500, -6107, -5685, -5239, -4775, -4294, -3803, -3307, -2805, -2304, -1803, -1306, -813, -323, 
-    160, 637, 1111, 1578, 2039, 2493, 2938, 3373, 3797, 4205, 4598, 4970, 5320, 5645, 5940, 6205, 
-    6438, 6634, 6795, 6921, 7009, 7064, 7085, 7075, 7036, 6971, 6880, 6769, 6636, 6487, 6319, 6135, 
-    5933, 5715, 5479, 5226, 4953, 4665, 4354, 4028, 3683, 3320, 2943, 2551, 2149, 1737, 1319, 895, 
-    470, 43, -382, -806, -1225, -1642, -2052, -2456, -2851, -3235, -3609, -3966, -4307, -4627, -4923, -5192, 
-    -5431, -5637, -5807, -5939, -6033, -6088, -6102, -6078, -6016, -5919, -5789, -5630, -5444, -5234, -5006, -4757, 
-    -4493, -4215, -3922, -3617, -3301, -2970, -2629, -2276, -1912, -1539, -1156, -767, -373, 20, 414, 802, 
-    1182, 1553, 1910, 2253, 2578, 2887, 3175, 3446, 3695, 3926, 4137, 4327, 4497, 4647, 4774, 4881, 
-    4965, 5026, 5064, 5076, 5065, 5026, 4960, 4868, 4748, 4601, 4430, 4233, 4016, 3779, 3523, 3254, 
-    2972, 2679, 2381, 2077, 1770, 1462, 1154, 842, 531, 215, -103, -426, -753, -1085, -1420, -1758, 
-    -2097, -2434, -2768, -3094, -3414, -3720, -4012, -4287, -4541, -4776, -4987, -5174, -5337, -5474, -5585, -5669, 
-    -5729, -5762, -5769, -5751, -5704, -5632, -5533, -5405, -5252, -5070, -4862, -4626, -4363, -4076, -3763, -3431, 
-    -3074, -2700, -2308, -1901, -1480, -1048, -608, -161, 291, 746, 1203, 1661, 2114, 2565, 3008, 3443, 
-    3868, 4277, 4670, 5042, 5391, 5713, 6007, 6269, 6496, 6689, 6844, 6965, 7049, 7100, 7119, 7110, 
-    7074, 7015, 6935, 6837, 6721, 6588, 6440, 6272, 6084, 5876, 5644, 5386, 5101, 4789, 4447, 4077, 
-    3679, 3258, 2813, 2352, 1875, 1392, 904, 416, -64, -539, -1004, -1455, -1895, -2320, -2735, -3137, 
-    -3529, -3913, -4289, -4658, -5023, -5382, -5733, -6077, -6408, -6725, -7023, -7298, -7547, -7764, -7948, -8093, 
-    -8201, -8263, -8285, -8262, -8198, -8092, -7949, -7769, -7557, -7314, -7044, -6749, -6433, -6094, -5735, -5356, 
-    -4956, -4538, -4100, -3643, -3168, -2676, -2170, -1650, -1120, -583, -42, 498, 1036, 1568, 2090, 2598, 
-    3092, 3568, 4025, 4461, 4876, 5271, 5643, 5994, 6323, 6628, 6911, 7168, 7402, 7608, 7789, 7940, 
-    8062, 8154, 8214, 8241, 8235, 8197, 8124, 8021, 7886, 7722, 7530, 7312, 7070, 6804, 6518, 6209, 
-    5882, 5533, 5166, 4780, 4377, 3957, 3522, 3075, 2615, 2147, 1672, 1193, 714, 235, -238, -710, 
-    -1174, -1632, -2082, -2522, -2955, -3376, -3789, -4187, -4575, -4946, -5300, -5634, -5947, -6233, -6493, -6723, 
-    -6919, -7082, -7208, -7300, -7356, -7376, -7361, -7314, -7235, -7128, -6993, -6835, -6653, -6450, -6229, -5988, 
-    -5730, -5454, -5161, -4850, -4523, -4179, -3819, -3443, -3054, -2652, -2240, -1821, -1396, -970, -545, -124, 
-    288, 691, 1080, 1454, 1811, 2150, 2468, 2765, 3041, 3295, 3529, 3744, 3937, 4115, 4273, 4418, 
-    4547, 4662, 4765, 4856, 4933, 5000, 5053, 5091, 5115, 5119, 5106, 5071, 5011, 4930, 4821, 4688, 
-    4530, 4349, 4146, 3922, 3681, 3424, 3157, 2878, 2594, 2303, 2010, 1715, 1418, 1123, 829, 534, 
-    244, -42, -327, -605, -876, -1141, -1394, -1636, -1866, -2079, -2277, -2456, -2616, -2755, -2874, -2971, 
-    -3045, -3097, -3127, -3133, -3118, -3082, -3025, -2951, -2859, -2753, -2634, -2502, -2362, -2211, -2055, -1888, 
-    -1717, -1537, -1352, -1160, -963, -759, -553, -344, -134, 73, 278, 477, 668, 849, 1020, 1179, 
-    1327, 1463, 1588, 1705, 1812, 1913, 2004, 2092, 2170, 2241, 2303, 2353, 2391, 2414, 2418, 2405, 
-    2371, 2316, 2240, 2145, 2029, 1894, 1742, 1572, 1389, 1191, 978, 756, 520, 275, 23, -236, 
-    -501, -769, -1036, -1302, -1561, -1811, -2049, -2275, -2484, -2677, -2852, -3010, -3149, -3274, -3381, -3476, 
-    -3555, -3622, -3676, -3719, -3748, -3765, -3767, -3756, -3729, -3686, -3626, -3549, -3455, -3342, -3213, -3067, 
-    -2905, -2730, -2540, -2338, -2124, -1899, -1664, -1417, -1163, -899, -626, -345, -54, 242, 548, 859, 
-    1176, 1498, 1822, 2148, 2474, 2796, 3113, 3425, 3725, 4018, 4296, 4560, 4809, 5040, 5252, 5446, 
-    5616, 5766, 5891, 5993, 6071, 6122, 6148, 6147, 6119, 6063, 5979, 5866, 5727, 5561, 5370, 5156, 
-    4919, 4664, 4392, 4106, 3807, 3500, 3185, 2863, 2537, 2204, 1868, 1526, 1179, 826, 465, 96, 
-    -281, -666, -1058, -1455, -1854, -2254, -2649, -3038, -3418, -3785, -4137, -4472, -4788, -5085, -5362, -5618, 
-    -5856, -6072, -6270, -6447, -6604, -6739, -6851, -6940, -7001, -7035, -7038, -7010, 
-};
-const unsigned int drum_v1_p4_short_len = 5292;
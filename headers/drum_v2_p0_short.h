@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v2_p0_short[] PROGMEM = {
-    -16, -1, 11, 14, 31, 21, 44, 26, 45, 28, 41, 19, 34, 15, 13, 11, 
-    -6, -3, -19, -23, -34, -44, -56, -60, -79, -80, -102, -108, -120, -135, -146, -158, 
-    -177, -186, -203, -220, -229, -251, -264, -281, -298, -318, -328, -353, -364, -384, -406, -413, 
-    -444, -444, -481, -477, -511, -515, -536, -554, -564, -584, -594, -613, -622, -641, -648, -669, 
-    -675, -689, -704, -711, -729, -736, -749, -757, -777, -773, -803, -796, -819, -824, -837, -849, 
-    -855, -872, -877, -896, -898, -917, -920, -941, -943, -962, -966, -983, -985, -1007, -1005, -1029, 
-    -1022, -1049, -1040, -1066, -1058, -1077, -1081, -1083, -1098, -1093, -1102, -1107, -1109, -1108, -1116, -1105, 
-    -1119, -1108, -1113, -1104, -1105, -1101, -1096, -1092, -1086, -1080, -1076, -1062, -1062, -1046, -1042, -1030, 
-    -1021, -1008, -999, -988, -970, -966, -945, -934, -922, -900, -892, -865, -859, -833, -819, -798, 
-    -775, -758, -738, -713, -699, -658, -659, -612, -609, -572, -551, -526, -502, -476, -449, -428, 
-    -394, -383, -340, -330, -290, -280, -242, -226, -192, -177, -144, -125, -98, -72, -51, -28, 
-    0, 12, 52, 57, 99, 102, 140, 153, 177, 204, 215, 247, 261, 289, 303, 330, 
-    346, 375, 388, 417, 434, 457, 478, 501, 522, 542, 569, 585, 615, 628, 659, 674, 
-    703, 717, 744, 761, 787, 801, 826, 843, 862, 886, 891, 922, 927, 951, 961, 978, 
-    990, 1005, 1016, 1027, 1039, 1049, 1059, 1070, 1077, 1089, 1093, 1104, 1111, 1117, 1126, 1130, 
-    1138, 1145, 1148, 1153, 1157, 1165, 1163, 1171, 1169, 1174, 1169, 1178, 1165, 1179, 1162, 1168, 
-    1157, 1155, 1147, 1137, 1133, 1113, 1112, 1091, 1082, 1066, 1049, 1029, 1019, 989, 981, 947, 
-    938, 907, 888, 863, 836, 817, 787, 764, 736, 711, 683, 656, 631, 597, 574, 541, 
-    511, 484, 449, 420, 386, 354, 318, 283, 250, 210, 176, 135, 95, 59, 14, -26, 
-    -65, -115, -150, -200, -241, -290, -330, -379, -425, -467, -518, -558, -609, -650, -701, -738, 
-    -789, -831, -872, -920, -954, -1003, -1039, -1084, -1119, -1160, -1194, -1236, -1268, -1304, -1340, -1367, 
-    -1406, -1430, -1467, -1489, -1523, -1542, -1577, -1591, -1626, -1638, -1670, -1680, -1709, -1720, -1744, -1754, 
-    -1774, -1783, -1800, -1809, -1820, -1829, -1833, -1844, -1846, -1848, -1855, -1845, -1856, -1842, -1845, -1832, 
-    -1831, -1817, -1812, -1787, -1785, -1757, -1749, -1720, -1706, -1676, -1655, -1625, -1597, -1568, -1535, -1501, 
-    -1470, -1423, -1399, -1343, -1319, -1265, -1223, -1183, -1127, -1090, -1033, -985, -934, -879, -828, -769, 
-    -717, -655, -602, -536, -483, -412, -357, -291, -225, -163, -94, -31, 40, 103, 177, 243, 
-    310, 388, 450, 526, 596, 670, 736, 815, 882, 956, 1031, 1099, 1174, 1246, 1317, 1390, 
-    1457, 1535, 1597, 1678, 1735, 1813, 1872, 1948, 2004, 2078, 2132, 2202, 2253, 2325, 2368, 2437, 
-    2483, 2536, 2595, 2632, 2690, 2726, 2774, 2811, 2857, 2884, 2927, 2954, 2986, 3010, 3041, 3055, 
-    3083, 3096, 3111, 3126, 3132, 3141, 3142, 3149, 3138, 3144, 3129, 3121, 3110, 3084, 3077, 3039, 
-    3027, 2988, 2958, 2923, 2886, 2838, 2799, 2744, 2700, 2640, 2585, 2525, 2457, 2400, 2320, 2255, 
-    2178, 2099, 2022, 1938, 1852, 1763, 1676, 1580, 1488, 1390, 1291, 1188, 1088, 980, 876, 767, 
-    651, 547, 425, 315, 197, 77, -41, -161, -286, -409, -531, -658, -786, -910, -1042, -1168, 
-    -1300, -1424, -1568, -1680, -1831, -1944, -2090, -2211, -2352, -2474, -2611, -2736, -2871, -2992, -3129, -3244, 
-    -3380, -3498, -3625, -3744, -3866, -3981, -4101, -4216, -4328, -4444, -4551, -4659, -4767, -4871, -4975, -5069, 
-    -5177, -5261, -5367, -5453, -5542, -5631, -5712, -5797, -5875, -5951, -6024, -6095, -6162, -6225, -6284, -6341, 
-    -6392, -6442, -6486, -6523, -6565, -6583, -6621, -6627, -6653, -6653, -6658, -6655, -6642, -6632, -6604, -6579, 
-    -6540, -6500, -6452, -6392, -6331, -6263, -6181, -6101, -6006, -5911, -5803, -5692, -5569, -5446, -5306, -5170, 
-    -5017, -4867, -4697, -4537, -4346, -4179, -3974, -3786, -3579, -3363, -3156, -2923, -2698, -2462, -2216, -1975, 
-    -1716, -1460, -1195, -924, -658, -371, -98, 194, 476, 773, 1061, 1369, 1652, 1970, 2254, 2569, 
-    2866, 3168, 3474, 3771, 4078, 4367, 4680, 4954, 5268, 5539, 5837, 6114, 6395, 6666, 6940, 7198, 
-    7465, 7710, 7969, 8203, 8446, 8671, 8901, 9111, 9329, 9522, 9731, 9906, 10103, 10263, 10443, 10591, 
-    10751, 10890, 11029, 11159, 11273, 11397, 11490, 11599, 11680, 11767, 11841, 11908, 11964, 12021, 12060, 12102, 
-    12128, 12147, 12171, 12166, 12178, 12161, 12150, 12131, 12100, 12069, 12020, 11980, 11916, 11863, 11788, 11716, 
-    11638, 11544, 11457, 11352, 11249, 11138, 11015, 10891, 10762, 10618, 10484, 10325, 10166, 10009, 9830, 9660, 
-    9466, 9280, 9073, 8872, 8651, 8424, 8198, 7946, 7702, 7437, 7168, 6889, 6599, 6291, 5991, 5659, 
-    5336, 4986, 4634, 4269, 3896, 3504, 3110, 2699, 2283, 1849, 1413, 962, 499, 38, -453, -930, 
-    -1431, -1938, -2445, -2972, -3495, -4031, -4571, -5118, -5667, -6226, -6784, -7347, -7916, -8488, -9049, -9633, 
-    -10189, -10778, -11330, -11910, -12463, -13033, -13581, -14134, -14673, -15211, -15730, -16256, -16748, -17253, -17725, -18196, 
-    -18648, -19082, -19504, -19911, -20287, -20667, -21005, -21338, -21643, -21932, -22195, -22446, -22666, -22863, -23053, -23201, 
-    -23345, -23459, -23551, -23628, -23680, -23714, -23734, -23726, -23709, -23672, -23615, -23557, -23463, -23380, -23260, -23153, 
-    -23014, -22882, -22722, -22573, -22401, -22227, -22047, -21852, -21660, -21450, -21238, -21014, -20787, -20544, -20294, -20033, 
-    -19756, -19474, -19174, -18855, -18530, -18180, -17818, -17442, -17036, -16630, -16192, -15744, -15278, -14793, -14302, -13787, 
-    -13271, -12735, -12201, -11655, -11108, -10566, -10010, -9479, -8931, -8412, -7886, -7380, -6879, -6395, -5911, -5455, 
-    -4988, -4544, -4089, -3648, -3192, -2741, -2264, -1776, -1267, -724, -157, 463, 1120, 1823, 2591, 3404, 
-    4285, 5232, 6237, 7315, 8455, 9695, 10979, 12306, 13702, 15117, 16597, 18071, 19589, 21099, 22623, 24127, 
-    25614, 27071, 28515, 29919, 31272, 32569, 32698, 32689, 32698, 32691, 32695, 32697, 32692, 32696, 32695, 32694, 
-    32697, 32695, 32694, 32696, 32694, 32695, 32697, 32692, 32696, 32696, 32691, 32700, 32688, 32701, 32690, 32694, 
-    32697, 32689, 32701, 32687, 32700, 32683, 32701, 32687, 32697, 32695, 32692, 32697, 32694, 32695, 32697, 32691, 
-    32697, 32694, 32695, 32694, 32695, 32695, 32696, 32691, 32698, 32687, 32701, 32688, 31073, 29361, 27642, 25909, 
-    24185, 22454, 20710, 18998, 17292, 15621, 13956, 12331, 10725, 9202, 7708, 6296, 4922, 3626, 2400, 1248, 
-    173, -847, -1808, -2744, -3627, -4512, -5351, -6199, -6996, -7824, -8637, -9478, -10328, -11186, -12065, -12947, 
-    -13855, -14776, -15759, -16767, -17822, -18896, -19990, -21102, -22225, -23361, -24498, -25627, -26765, -27888, -29017, -30125, 
-    -31212, -32265, -32758, -32755, -32758, -32756, -32755, -32759, -32755, -32759, -32753, -32759, -32754, -32758, -32754, -32756, 
-    -32755, -32754, -32758, -32752, -32759, -32753, -32760, -32753, -32758, -32753, -32758, -32756, -32759, -32753, -32759, -32756, 
-    -32756, -32758, -32755, -32759, -32753, -32762, -32751, -32761, -32752, -32760, -32754, -32754, -32755, -32751, -32761, -32750, 
-    -32760, -32753, -32760, -32753, -32761, -32752, -32759, -32759, -32749, -32767, -32747, -32764, -32752, -32759, -32753, -32759, 
-    -32754, -32756, -32755, -32754, -32759, -32753, -32761, -32751, -32762, -32755, -32600, -30808, -28987, -27132, -25268, -23368, 
-    -21469, -19549, -17641, -15733, -13852, -11997, -10170, -8395, -6637, -4928, -3241, -1586, 41, 1638, 3204, 4737, 
-    6240, 7721, 9171, 10615, 12021, 13427, 14784, 16142, 17465, 18772, 20068, 21345, 22614, 23887, 25138, 26422, 
-    27675, 28956, 30226, 31492, 32698, 32689, 32700, 32689, 32699, 32691, 32698, 32690, 32698, 32691, 32695, 32695, 
-    32696, 32694, 32695, 32695, 32695, 32696, 32695, 32695, 32695, 32694, 32695, 32696, 32695, 32694, 32697, 32691, 
-    32699, 32692, 32696, 32694, 32696, 32695, 32695, 32697, 32690, 32699, 32691, 32698, 32694, 32694, 32697, 32691, 
-    32698, 32692, 32694, 32697, 32690, 32699, 32691, 32696, 32696, 32694, 32692, 32699, 32687, 32704, 32686, 32704, 
-    32687, 32700, 32689, 32698, 32691, 32699, 32691, 32697, 32694, 32695, 32695, 32696, 32691, 32698, 32691, 32697, 
-    32692, 32698, 32690, 32700, 32691, 32696, 32694, 31621, 29602, 27574, 25505, 23419, 21310, 19185, 17051, 14910, 
-    12746, 10571, 8383, 6193, 3997, 1817, -365, -2521, -4668, -6793, -8874, -10939, -12947, -14932, -16857, -18749, 
-    -20577, -22374, -24107, -25801, -27452, -29050, -30625, -32148, -32753, -32760, -32754, -32760, -32755, -32758, -32753, -32762, 
-    -32751, -32762, -32753, -32756, -32758, -32755, -32759, -32753, -32761, -32751, -32761, -32751, -32761, -32752, -32759, -32756, 
-    -32753, -32762, -32747, -32763, -32751, -32761, -32756, -32754, -32760, -32751, -32761, -32753, -32756, -32754, -32756, -32755, 
-    -32755, -32760, -32753, -32762, -32752, -32760, -32754, -32759, -32753, -32759, -32751, -32760, -32755, -32755, -32758, -32754, 
-    -32756, -32758, -32756, -32759, -32754, -32758, -32756, -32756, -32759, -32753, -32759, -32751, -32762, -32750, -32764, -32746, 
-    -32765, -32747, -32761, -32752, -32756, -32758, -32756, -32758, -32755, -32759, -32752, -32759, -32754, -32759, -32754, -32759, 
-    -32752, -30924, -28096, -25259, -22382, -19495, -16597, -13678, -10785, -7870, -4995, -2118, 713, 3523, 6298, 9029, 
-    11739, 14387, 17007, 19571, 22087, 24549, 26963, 29314, 31618, 32698, 32689, 32700, 32691, 32696, 32698, 32688, 
-    32703, 32688, 32698, 32695, 32691, 32699, 32690, 32697, 32695, 32694, 32695, 32696, 32690, 32699, 32692, 32695, 
-    32697, 32691, 32697, 32694, 32695, 32696, 32694, 32696, 32696, 32691, 32698, 32694, 32695, 32696, 32692, 32698, 
-    32691, 32698, 32694, 32694, 32698, 32690, 32699, 32692, 32696, 32695, 32696, 32691, 32700, 32688, 32703, 32689, 
-    32698, 32692, 32695, 32694, 32694, 32694, 32695, 32695, 32692, 32697, 32690, 32698, 32695, 32694, 32696, 32695, 
-    32694, 32697, 32695, 32691, 32697, 32695, 32694, 32698, 32692, 32695, 32696, 32694, 32696, 32696, 32692, 32696, 
-    32695, 32692, 32697, 32691, 32697, 32694, 30061, 27385, 24650, 21910, 19123, 16333, 13518, 10699, 7870, 5050, 
-    2222, -572, -3369, -6120, -8862, -11560, -14238, -16868, -19477, -22028, -24564, -27021, -29474, -31843, -32761, -32754, 
-    -32755, -32760, -32752, -32761, -32754, -32758, -32758, -32755, -32756, -32758, -32755, -32758, -32756, -32755, -32758, -32758, 
-    -32752, -32762, -32752, -32760, -32756, -32755, -32758, -32754, -32759, -32758, -32755, -32758, -32756, -32754, -32761, -32754, 
-    -32759, -32756, -32756, -32758, -32755, -32760, -32753, -32759, -32754, -32752, -32760, -32747, -32762, -32751, -32759, -32758, 
-    -32755, -32756, -32754, -32756, -32756, -32758, -32756, -32758, -32754, -32758, -32755, -32755, -32756, -32752, -32759, -32751, 
-    -32761, -32750, -32762, -32752, -32755, -32758, -32754, -32759, -32753, -32760, -32747, -32762, -32749, -32761, -32753, -32762, 
-    -32751, -32762, -32751, -32762, -32751, -32760, -32751, -32758, -32756, -32756, -32758, -32756, -32645, -30304, -27927, -25489, 
-    -23029, -20514, -17985, -15421, -12844, -10257, -7656, -5066, -2483, 81, 2628, 5131, 7623, 10056, 12473, 14831, 
-    17170, 19446, 21709, 23893, 26085, 28189, 30301, 32349, 32697, 32695, 32692, 32699, 32690, 32699, 32691, 32698, 
-    32692, 32696, 32695, 32694, 32697, 32695, 32692, 32698, 32691, 32698, 32692, 32695, 32695, 32692, 32697, 32692, 
-    32694, 32695, 32692, 32696, 32694, 32691, 32696, 32690, 32695, 32696, 32689, 32697, 32692, 32695, 32692, 32696, 
-    32690, 32698, 32692, 32696, 32695, 32695, 32695, 32696, 32692, 32698, 32690, 32698, 32691, 32695, 32695, 32695, 
-    32691, 32699, 32691, 32695, 32697, 32692, 32697, 32691, 32698, 32689, 32700, 32689, 32700, 32689, 32697, 32694, 
-    32695, 32695, 32690, 32697, 32692, 32697, 32695, 32692, 32696, 32697, 32690, 32698, 32689, 32696, 32692, 32694, 
-    32696, 32691, 32681, 30541, 28395, 26218, 24027, 21810, 19580, 17312, 15045, 12729, 10414, 8053, 5691, 3285, 
-    879, -1564, -4013, -6487, -8962, -11466, -13961, -16483, -18996, -21516, -24032, -26537, -29039, -31510, -32763, -32751, 
-    -32761, -32754, -32754, -32758, -32755, -32759, -32754, -32755, -32753, -32760, -32750, -32760, -32755, -32753, -32760, -32750, 
-    -32758, -32754, -32758, -32756, -32754, -32760, -32747, -32764, -32749, -32759, -32758, -32753, -32762, -32752, -32761, -32753, 
-    -32761, -32755, -32756, -32756, -32756, -32755, -32755, -32758, -32753, -32759, -32756, -32758, -32756, -32758, -32756, -32758, 
-    -32758, -32753, -32759, -32754, -32756, -32756, -32756, -32754, -32756, -32756, -32755, -32761, -32752, -32760, -32754, -32758, 
-    -32758, -32755, -32758, -32756, -32756, -32755, -32759, -32755, -32758, -32759, -32754, -32760, -32755, -32758, -32754, -32760, 
-    -32750, -32762, -32751, -31046, -28733, -26410, -24067, -21708, -19329, -16948, -14538, -12139, -9719, -7304, -4885, -2473, 
-    -77, 2316, 4672, 7026, 9332, 11625, 13880, 16095, 18288, 20424, 22529, 24591, 26594, 28573, 30478, 32362, 
-    32694, 32692, 32698, 32688, 32700, 32689, 32698, 32694, 32692, 32697, 32694, 32696, 32696, 32690, 32700, 32688, 
-    32700, 32690, 32696, 32696, 32689, 32701, 32687, 32703, 32685, 32701, 32687, 32698, 32690, 32697, 32690, 32699, 
-    32689, 32698, 32694, 32695, 32691, 32700, 32688, 32701, 32689, 32697, 32690, 32697, 32691, 32695, 32697, 32690, 
-    32701, 32688, 32700, 32689, 32698, 32691, 32697, 32695, 32695, 32695, 32692, 32696, 32691, 32698, 32692, 32696, 
-    32696, 32692, 32696, 32696, 32692, 32698, 32691, 32698, 32690, 32697, 32695, 32695, 32695, 32695, 32691, 32699, 
-    32692, 32696, 32694, 32692, 32698, 32691, 30605, 28287, 25996, 23715, 21451, 19202, 16977, 14759, 12567, 10383, 
-    8212, 6044, 3894, 1737, -403, -2558, -4699, -6860, -9004, -11173, -13330, -15503, -17670, -19833, -21996, -24140, 
-    -26280, -28388, -30482, -32530, -32761, -32753, -32761, -32754, -32759, -32754, -32760, -32756, -32755, -32758, -32754, -32755, 
-    -32761, -32751, -32763, -32750, -32760, -32756, -32756, -32756, -32752, -32760, -32750, -32761, -32749, -32760, -32754, -32758, 
-    -32754, -32758, -32756, -32756, -32758, -32754, -32758, -32758, -32754, -32759, -32756, -32756, -32755, -32760, -32752, -32761, 
-    -32753, -32760, -32753, -32759, -32754, -32755, -32760, -32753, -32759, -32754, -32759, -32755, -32758, -32756, -32755, -32756, 
-    -32759, -32754, -32760, -32755, -32754, -32759, -32753, -32758, -32756, -32755, -32758, -32756, -32756, -32755, -32759, -32755, 
-    -32756, -32758, -32754, -32759, -32756, -32754, -32761, -32752, -32760, -32755, -32755, -31075, -29145, -27166, -25163, -23121, 
-    -21041, -18944, -16804, -14653, -12463, -10264, -8028, -5795, -3522, -1254, 1048, 3361, 5685, 8041, 10391, 12773, 
-    15152, 17542, 19937, 22327, 24726, 27103, 29496, 31849, 32698, 32695, 32694, 32697, 32692, 32696, 32691, 32697, 
-    32691, 32699, 32689, 32699, 32688, 32701, 32686, 32704, 32687, 32703, 32687, 32700, 32689, 32698, 32690, 32697, 
-    32690, 32697, 32690, 32698, 32692, 32695, 32696, 32690, 32698, 32691, 32697, 32694, 32695, 32694, 32698, 32692, 
-    32697, 32691, 32695, 32696, 32694, 32692, 32697, 32689, 32697, 32691, 32696, 32694, 32694, 32698, 32689, 32699, 
-    32690, 32697, 32691, 32694, 32694, 32692, 32697, 32690, 32699, 32688, 32233, 31007, 29804, 28583, 27380, 26167, 
-    24986, 23790, 22637, 21467, 20343, 19210, 18113, 17016, 15944, 14881, 13819, 12781, 11722, 10689, 9626, 8585, 
-    7500, 6425, 5308, 4183, 3015, 1822, 589, -683, -1988, -3343, -4730, -6161, -7629, -9125, -10677, -12231, 
-    -13843, -15468, -17117, -18788, -20483, -22174, -23892, -25592, -27295, -28995, -30662, -32332, -32750, -32759, -32752, -32760, 
-    -32751, -32762, -32753, -32755, -32760, -32753, -32760, -32755, -32754, -32759, -32755, -32756, -32758, -32755, -32755, -32756, 
-    -32754, -32754, -32755, -32754, -32754, -32756, -32759, -32753, -32760, -32754, -32758, -32758, -32755, -32756, -32756, -32758, 
-    -32753, -32758, -32753, -32756, -32755, -32758, -32755, -32758, -32754, -32755, -32758, -32751, -32762, -32747, -32764, -32750, 
-    -32762, -32753, -32755, -32758, -32052, -30567, -29053, -27546, -26028, -24509, -22990, -21470, -19962, -18447, -16950, -15460, 
-    -13974, -12519, -11057, -9633, -8213, -6825, -5447, -4108, -2773, -1492, -214, 1015, 2227, 3404, 4544, 5663, 
-    6735, 7780, 8792, 9769, 10719, 11639, 12534, 13404, 14259, 15091, 15912, 16727, 17527, 18327, 19125, 19919, 
-    20719, 21529, 22329, 23164, 23981, 24834, 25669, 26542, 27396, 28280, 29160, 30046, 30944, 31827, 32691, 32700, 
-    32689, 32699, 32692, 32696, 32695, 32696, 32691, 32695, 32694, 32692, 32696, 32692, 32697, 32694, 32694, 32697, 
-    32689, 32700, 32688, 32700, 32690, 32701, 32688, 32700, 32691, 32695, 32696, 32690, 32697, 32692, 32696, 32692, 
-    32698, 32690, 32699, 32690, 32697, 32694, 32695, 32696, 32694, 32696, 32475, 31781, 31060, 30300, 29513, 28676, 
-    27801, 26877, 25910, 24887, 23825, 22697, 21538, 20317, 19065, 17763, 16423, 15056, 13639, 12224, 10764, 9313, 
-    7839, 6375, 4912, 3470, 2044, 637, -733, -2077, -3382, -4639, -5865, -7038, -8173, -9252, -10303, -11292, 
-    -12266, -13179, -14089, -14943, -15803, -16617, -17435, -18234, -19022, -19816, -20585, -21381, -22146, -22939, -23705, -24488, 
-    -25258, -26030, -26796, -27556, -28299, -29039, -29753, -30453, -31127, -31775, -32399, -32753, -32756, -32756, -32755, -32759, 
-    -32752, -32759, -32753, -32758, -32756, -32754, -32756, -32754, -32756, -32755, -32758, -32756, -32756, -32756, -32756, -32759, 
-    -32755, -32756, -32756, -32755, -32759, -32756, -32756, -32756, -32756, -32756, -32759, -32754, -32758, -32685, -32220, -31744, 
-    -31212, -30676, -30089, -29478, -28828, -28149, -27423, -26665, -25866, -25027, -24152, -23235, -22280, -21291, -20263, -19201, 
-    -18113, -16988, -15850, -14681, -13504, -12310, -11106, -9899, -8686, -7479, -6265, -5073, -3876, -2702, -1541, -386, 
-    734, 1852, 2948, 4023, 5091, 6129, 7166, 8172, 9178, 10155, 11136, 12084, 13047, 13976, 14914, 15826, 
-    16742, 17635, 18520, 19392, 20244, 21084, 21899, 22700, 23468, 24224, 24941, 25635, 26301, 26934, 27533, 28102, 
-    28626, 29127, 29583, 30000, 30393, 30730, 31053, 31313, 31566, 31758, 31944, 32072, 32190, 32260, 32318, 32332, 
-    32331, 32297, 32236, 32154, 32037, 31913, 31747, 31574, 31380, 31152, 30931, 30661, 30396, 30096, 29786, 29456, 
-    29107, 28745, 28365, 27965, 27565, 27134, 26707, 26255, 25803, 25331, 24860, 24363, 23877, 23359, 22853, 22315, 
-    21783, 21228, 20669, 20086, 19498, 18888, 18268, 17634, 16971, 16307, 15608, 14913, 14178, 13445, 12676, 11900, 
-    11099, 10274, 9439, 8571, 7697, 6793, 5871, 4936, 3976, 3011, 2021, 1024, 10, -999, -2035, -3057, 
-    -4097, -5133, -6161, -7198, -8215, -9230, -10231, -11214, -12184, -13127, -14052, -14953, -15825, -16671, -17486, -18272, 
-    -19025, -19754, -20436, -21103, -21728, -22326, -22897, -23429, -23951, -24426, -24904, -25336, -25758, -26164, -26539, -26908, 
-    -27256, -27584, -27901, -28198, -28476, -28741, -28979, -29199, -29388, -29561, -29693, -29808, -29877, -29920, -29923, -29884, 
-    -29813, -29694, -29541, -29342, -29110, -28832, -28528, -28183, -27812, -27409, -26987, -26541, -26069, -25595, -25097, -24597, 
-    -24096, -23589, -23081, -22596, -22089, -21625, -21142, -20692, -20233, -19806, -19365, -18951, -18527, -18114, -17696, -17278, 
-    -16851, -16404, -15956, -15476, -14984, -14466, -13918, -13341, -12739, -12098, -11424, -10726, -9987, -9227, -8438, -7628, 
-    -6790, -5942, -5071, -4193, -3306, -2413, -1519, -625, 255, 1137, 2001, 2847, 3683, 4487, 5276, 6051, 
-    6782, 7517, 8211, 8889, 9557, 10184, 10815, 11405, 12002, 12552, 13125, 13646, 14181, 14693, 15193, 15693, 
-    16177, 16649, 17129, 17580, 18051, 18483, 18939, 19356, 19788, 20193, 20593, 20982, 21363, 21724, 22084, 22416, 
-    22741, 23048, 23326, 23594, 23827, 24036, 24217, 24371, 24483, 24574, 24617, 24638, 24610, 24558, 24455, 24338, 
-    24165, 23978, 23745, 23488, 23208, 22890, 22567, 22206, 21836, 21441, 21034, 20616, 20178, 19736, 19277, 18820, 
-    18344, 17882, 17394, 16931, 16444, 15983, 15499, 15041, 14560, 14104, 13635, 13176, 12716, 12259, 11806, 11348, 
-    10901, 10448, 10007, 9555, 9117, 8673, 8238, 7807, 7373, 6944, 6525, 6097, 5687, 5269, 4857, 4446, 
-    4040, 3621, 3220, 2800, 2392, 1976, 1557, 1139, 716, 291, -134, -576, -1002, -1458, -1883, -2349, 
-    -2776, -3250, -3681, -4151, -4599, -5057, -5520, -5979, -6440, -6903, -7364, -7826, -8295, -8755, -9224, -9682, 
-    -10148, -10600, -11062, -11502, -11950, -12381, -12807, -13224, -13623, -14016, -14384, -14749, -15073, -15401, -15685, -15965, 
-    -16203, -16432, -16620, -16796, -16937, -17060, -17151, -17220, -17270, -17285, -17295, -17265, -17238, -17169, -17110, -17013, 
-    -16912, -16809, -16670, -16554, -16405, -16261, -16119, -15955, -15807, -15642, -15472, -15315, -15126, -14962, -14767, -14578, 
-    -14371, -14159, -13926, -13681, -13420, -13133, -12841, -12510, -12177, -11814, -11442, -11048, -10637, -10222, -9787, -9353, 
-    -8905, -8459, -8010, -7564, -7120, -6690, -6258, -5859, -5457, -5093, -4735, -4410, -4107, -3830, -3579, -3366, 
-    -3163, -3008, -2856, -2753, -2651, -2593, -2527, -2501, -2464, -2457, -2435, -2429, -2413, -2393, -2367, -2328, 
-    -2278, -2210, -2131, -2027, -1919, -1775, -1628, -1454, -1261, -1065, -831, -603, -340, -86, 192, 472, 
-    766, 1061, 1371, 1670, 1988, 2297, 2613, 2924, 3241, 3539, 3859, 4147, 4460, 4744, 5048, 5331, 
-    5627, 5908, 6200, 6489, 6775, 7072, 7363, 7656, 7958, 8254, 8553, 8853, 9153, 9445, 9735, 10026, 
-    10292, 10567, 10813, 11047, 11273, 11462, 11640, 11790, 11910, 12010, 12073, 12109, 12117, 12089, 12044, 11957, 
-    11853, 11721, 11565, 11392, 11198, 10994, 10779, 10557, 10330, 10100, 9875, 9658, 9439, 9246, 9051, 8884, 
-    8725, 8591, 8469, 8374, 8296, 8232, 8202, 8175, 8174, 8188, 8204, 8243, 8278, 8320, 8370, 8400, 
-    8448, 8465, 8486, 8489, 8470, 8444, 8390, 8321, 8223, 8108, 7961, 7803, 7609, 7401, 7169, 6918, 
-    6649, 6363, 6063, 5747, 5428, 5091, 4758, 4415, 4066, 3737, 3382, 3072, 2736, 2437, 2144, 1864, 
-    1608, 1366, 1145, 944, 762, 603, 459, 336, 227, 130, 50, -26, -91, -152, -215, -270, 
-    -330, -394, -462, -546, -633, -735, -853, -982, -1126, -1295, -1458, -1665, -1860, -2086, -2317, -2559, 
-    -2806, -3073, -3321, -3590, -3842, -4092, -4345, -4568, -4797, -4996, -5195, -5362, -5524, -5654, -5786, -5873, 
-    -5979, -6023, -6099, -6119, -6162, -6171, -6196, -6192, -6212, -6208, -6229, -6242, -6267, -6303, -6339, -6400, 
-    -6462, -6538, -6633, -6727, -6849, -6973, -7107, -7261, -7405, -7572, -7733, -7896, -8064, -8228, -8379, -8535, 
-    -8674, -8800, -8928, -9024, -9115, -9190, -9241, -9280, -9305, -9300, -9303, -9268, -9241, -9191, -9133, -9084, 
-    -9003, -8946, -8864, -8796, -8727, -8647, -8587, -8524, -8457, -8420, -8351, -8330, -8281, -8265, -8227, -8222, 
-    -8195, -8194, -8186, -8175, -8183, -8171, -8175, -8170, -8161, -8153, -8133, -8112, -8084, -8043, -8003, -7942, 
-    -7886, -7801, -7731, -7611, -7519, -7374, -7250, -7082, -6922, -6722, -6534, -6303, -6077, -5822, -5557, -5276, 
-    -4981, -4673, -4349, -4017, -3667, -3307, -2940, -2561, -2178, -1789, -1394, -993, -600, -194, 197, 591, 
-    980, 1356, 1732, 2089, 2446, 2780, 3113, 3428, 3728, 4025, 4301, 4566, 4833, 5069, 5321, 5547, 
-    5777, 6003, 6219, 6443, 6657, 6884, 7101, 7327, 7552, 7785, 8010, 8254, 8483, 8726, 8968, 9206, 
-    9451, 9685, 9922, 10158, 10383, 10615, 10825, 11049, 11245, 11452, 11643, 11825, 12008, 12172, 12335, 12490, 
-    12633, 12777, 12905, 13041, 13161, 13284, 13401, 13510, 13627, 13729, 13836, 13935, 14034, 14126, 14218, 14297, 
-    14374, 14440, 14499, 14541, 14569, 14590, 14575, 14568, 14516, 14464, 14379, 14273, 14148, 13987, 13812, 13603, 
-    13367, 13114, 12825, 12519, 12186, 11827, 11461, 11046, 10647, 10194, 9756, 9278, 8807, 8307, 7819, 7298, 
-    6793, 6271, 5750, 5234, 4709, 4205, 3691, 3194, 2698, 2211, 1739, 1273, 819, 372, -52, -475, 
-    -881, -1273, -1655, -2021, -2372, -2716, -3038, -3357, -3649, -3941, -4209, -4475, -4721, -4957, -5184, -5397, 
-    -5607, -5805, -5993, -6185, -6351, -6535, -6698, -6857, -7021, -7169, -7317, -7465, -7599, -7739, -7867, -7992, 
-    -8111, -8218, -8338, -8424, -8534, -8617, -8704, -8790, -8857, -8937, -8995, -9066, -9120, -9181, -9237, -9292, 
-    -9351, -9399, -9466, -9513, -9577, -9639, -9694, -9776, -9831, -9909, -9981, -10054, -10135, -10210, -10286, -10366, 
-    -10438, -10513, -10579, -10643, -10705, -10756, -10808, -10847, -10880, -10908, -10919, -10931, -10919, -10921, -10885, -10864, 
-    -10824, -10766, -10726, -10643, -10585, -10499, -10415, -10327, -10221, -10128, -10011, -9901, -9787, -9659, -9543, -9403, 
-    -9282, -9129, -9009, -8844, -8707, -8545, -8381, -8218, -8036, -7857, -7660, -7466, -7254, -7045, -6812, -6584, 
-    -6325, -6077, -5787, -5517, -5206, -4905, -4576, -4242, -3893, -3539, -3169, -2799, -2420, -2034, -1649, -1255, 
-    -867, -478, -91, 283, 659, 1020, 1371, 1715, 2031, 2348, 2631, 2909, 3165, 3396, 3618, 3810, 
-    3989, 4149, 4281, 4413, 4506, 4606, 4672, 4735, 4793, 4826, 4871, 4894, 4924, 4947, 4979, 4999, 
-    5040, 5066, 5115, 5161, 5217, 5281, 5353, 5433, 5521, 5622, 5724, 5844, 5959, 6084, 6218, 6348, 
-    6484, 6624, 6752, 6891, 7023, 7149, 7275, 7398, 7509, 7630, 7733, 7839, 7941, 8026, 8128, 8198, 
-    8295, 8360, 8449, 8513, 8598, 8664, 8745, 8828, 8902, 9000, 9084, 9189, 9288, 9400, 9516, 9638, 
-    9768, 9900, 10039, 10181, 10327, 10467, 10617, 10747, 10894, 11018, 11142, 11258, 11352, 11445, 11516, 11574, 
-    11611, 11632, 11633, 11617, 11572, 11510, 11424, 11317, 11191, 11039, 10871, 10680, 10474, 10245, 10007, 9742, 
-    9475, 9184, 8890, 8575, 8262, 7929, 7591, 7253, 6899, 6554, 6194, 5843, 5480, 5131, 4767, 4423, 
-    4063, 3729, 3385, 3055, 2736, 2418, 2119, 1826, 1545, 1279, 1022, 782, 554, 343, 142, -38, 
-    -211, -365, -510, -637, -755, -865, -960, -1052, -1139, -1212, -1302, -1369, -1458, -1534, -1625, -1717, 
-    -1820, -1925, -2045, -2171, -2312, -2463, -2626, -2808, -2993, -3204, -3410, -3650, -3879, -4137, -4394, -4663, 
-    -4945, -5225, -5519, -5811, -6117, -6413, -6722, -7029, -7328, -7647, -7940, -8254, -8545, -8849, -9144, -9438, 
-    -9733, -10011, -10308, -10572, -10861, -11117, -11392, -11639, -11894, -12131, -12356, -12586, -12779, -12988, -13159, -13332, 
-    -13484, -13621, -13741, -13847, -13930, -14003, -14061, -14092, -14121, -14122, -14117, -14098, -14057, -14011, -13948, -13873, 
-    -13787, -13693, -13583, -13471, -13343, -13213, -13070, -12924, -12767, -12611, -12444, -12268, -12101, -11907, -11737, -11537, 
-    -11351, -11158, -10963, -10765, -10578, -10367, -10190, -9980, -9798, -9601, -9418, -9225, -9049, -8862, -8689, -8514, 
-    -8347, -8179, -8020, -7853, -7700, -7544, -7389, -7235, -7082, -6920, -6770, -6602, -6440, -6264, -6084, -5895, 
-    -5702, -5495, -5279, -5051, -4814, -4562, -4302, -4024, -3742, -3433, -3129, -2788, -2458, -2097, -1730, -1351, 
-    -951, -552, -122, 299, 754, 1205, 1674, 2156, 2641, 3142, 3642, 4163, 4676, 5208, 5732, 6272, 
-    6807, 7345, 7888, 8420, 8959, 9489, 10014, 10542, 11048, 11567, 12054, 12559, 13034, 13509, 13972, 14422, 
-    14865, 15294, 15716, 16123, 16525, 16907, 17288, 17659, 18007, 18359, 18684, 19017, 19321, 19629, 19911, 20189, 
-    20460, 20709, 20951, 21181, 21394, 21596, 21790, 21957, 22124, 22260, 22395, 22499, 22595, 22668, 22720, 22759, 
-    22765, 22758, 22728, 22666, 22592, 22480, 22359, 22194, 22023, 21802, 21579, 21304, 21027, 20703, 20373, 20001, 
-    19615, 19209, 18769, 18325, 17845, 17365, 16861, 16344, 15824, 15279, 14744, 14193, 13631, 13084, 12514, 11956, 
-    11399, 10829, 10279, 9713, 9160, 8606, 8049, 7502, 6948, 6401, 5847, 5304, 4750, 4210, 3646, 3110, 
-    2545, 1997, 1435, 870, 311, -265, -831, -1417, -1996, -2596, -3182, -3803, -4401, -5030, -5659, -6294, 
-    -6946, -7599, -8266, -8938, -9624, -10310, -11010, -11707, -12422, -13122, -13842, -14550, -15257, -15966, -16665, -17357, 
-    -18038, -18707, -19362, -19996, -20621, -21217, -21798, -22352, -22884, -23389, -23872, -24329, -24761, -25163, -25543, -25894, 
-    -26223, -26535, -26805, -27079, -27311, -27538, -27746, -27930, -28107, -28262, -28404, -28531, -28644, -28732, -28817, -28864, 
-    -28916, -28923, -28927, -28891, -28842, -28754, -28648, -28504, -28325, -28118, -27864, -27584, -27257, -26897, -26486, -26049, 
-    -25560, -25041, -24480, -23881, -23254, -22584, -21899, -21164, -20426, -19652, -18866, -18069, -17245, -16435, -15601, -14783, 
-    -13946, -13142, -12307, -11528, -10711, -9945, -9169, -8414, -7677, -6944, -6240, -5530, -4852, -4162, -3501, -2828, 
-    -2176, -1507, -853, -186, 481, 1154, 1841, 2532, 3240, 3960, 4691, 5437, 6205, 6971, 7770, 8561, 
-    9380, 10195, 11027, 11852, 12685, 13511, 14338, 15143, 15958, 16735, 17513, 18266, 18988, 19705, 20378, 21038, 
-    21659, 22261, 22826, 23365, 23881, 24350, 24814, 25231, 25638, 26010, 26367, 26690, 27010, 27292, 27569, 27817, 
-    28061, 28274, 28492, 28677, 28858, 29024, 29177, 29311, 29443, 29545, 29651, 29717, 29791, 29820, 29852, 29845, 
-    29823, 29771, 29699, 29589, 29458, 29290, 29095, 28865, 28607, 28306, 27987, 27614, 27230, 26794, 26336, 25845, 
-    25319, 24770, 24190, 23585, 22960, 22304, 21637, 20937, 20235, 19505, 18768, 18017, 17255, 16485, 15706, 14930, 
-    14132, 13354, 12551, 11768, 10970, 10186, 9389, 8606, 7816, 7029, 6245, 5462, 4672, 3897, 3102, 2320, 
-    1534, 736, -50, -861, -1656, -2472, -3287, -4105, -4938, -5770, -6604, -7459, -8296, -9158, -10006, -10865, 
-    -11715, -12572, -13418, -14263, -15097, -15926, -16734, -17541, -18316, -19089, -19834, -20559, -21252, -21935, -22570, -23191, 
-    -23776, -24326, -24851, -25340, -25793, -26216, -26609, -26956, -27291, -27575, -27841, -28079, -28274, -28468, -28604, -28754, 
-    -28838, -28939, -28987, -29039, -29052, -29059, -29037, -29007, -28951, -28884, -28797, -28697, -28580, -28446, -28299, -28139, 
-    -27955, -27765, -27546, -27324, -27074, -26809, -26527, -26210, -25899, -25537, -25176, -24778, -24363, -23924, -23463, -22977, 
-    -22465, -21929, -21372, -20782, -20176, -19532, -18874, -18180, -17467, -16729, -15960, -15179, -14363, -13537, -12684, -11817, 
-    -10932, -10035, -9124, -8204, -7275, -6346, -5408, -4470, -3539, -2601, -1680, -753, 157, 1065, 1955, 2841, 
-    3709, 4564, 5399, 6229, 7029, 7826, 8597, 9345, 10090, 10794, 11510, 12180, 12855, 13496, 14132, 14753, 
-    15353, 15945, 16520, 17082, 17639, 18167, 18704, 19205, 19715, 20194, 20667, 21129, 21571, 22001, 22420, 22808, 
-    23200, 23552, 23907, 24219, 24531, 24807, 25064, 25301, 25508, 25697, 25858, 25997, 26103, 26205, 26255, 26311, 
-    26316, 26324, 26287, 26252, 26173, 26094, 25978, 25863, 25707, 25558, 25369, 25184, 24965, 24746, 24500, 24243, 
-    23970, 23675, 23367, 23043, 22691, 22329, 21938, 21529, 21097, 20641, 20158, 19653, 19124, 18563, 17981, 17373, 
-    16734, 16080, 15388, 14675, 13950, 13181, 12417, 11611, 10800, 9968, 9122, 8262, 7392, 6510, 5621, 4723, 
-    3823, 2912, 2010, 1092, 195, -722, -1616, -2523, -3412, -4297, -5184, -6041, -6919, -7754, -8607, -9428, 
-    -10250, -11050, -11842, -12615, -13378, -14116, -14845, -15547, -16237, -16901, -17543, -18160, -18755, -19321, -19861, -20370, 
-    -20852, -21300, -21722, -22104, -22458, -22779, -23066, -23326, -23544, -23737, -23900, -24031, -24135, -24216, -24263, -24297, 
-    -24296, -24285, -24244, -24188, -24116, -24024, -23920, -23803, -23669, -23533, -23373, -23213, -23031, -22851, -22645, -22445, 
-    -22206, -21982, -21717, -21452, -21164, -20852, -20531, -20174, -19803, -19402, -18976, -18530, -18044, -17547, -17002, -16453, 
-    -15864, -15259, -14626, -13974, -13299, -12617, -11903, -11191, -10457, -9714, -8973, -8213, -7461, -6705, -5940, -5198, 
-    -4433, -3704, -2953, -2233, -1505, -793, -91, 603, 1285, 1961, 2622, 3284, 3926, 4569, 5208, 5829, 
-    6461, 7076, 7693, 8307, 8916, 9519, 10122, 10716, 11313, 11901, 12477, 13057, 13614, 14178, 14721, 15256, 
-    15777, 16285, 16776, 17254, 17707, 18155, 18565, 18969, 19345, 19692, 20030, 20325, 20614, 20858, 21098, 21284, 
-    21475, 21610, 21741, 21834, 21907, 21948, 21973, 21966, 21940, 21893, 21814, 21729, 21603, 21479, 21315, 21145, 
-    20948, 20736, 20511, 20259, 20010, 19715, 19445, 19114, 18813, 18456, 18117, 17741, 17362, 16965, 16547, 16124, 
-    15679, 15227, 14752, 14266, 13764, 13246, 12719, 12169, 11609, 11037, 10447, 9848, 9233, 8604, 7968, 7316, 
-    6654, 5984, 5298, 4616, 3911, 3222, 2500, 1810, 1084, 386, -332, -1033, -1743, -2441, -3136, -3829, 
-    -4506, -5188, -5847, -6514, -7148, -7796, -8407, -9028, -9619, -10209, -10780, -11332, -11880, -12399, -12915, -13407, 
-    -13889, -14352, -14798, -15239, -15648, -16064, -16444, -16829, -17188, -17543, -17883, -18206, -18524, -18825, -19110, -19394, 
-    -19652, -19913, -20146, -20383, -20591, -20800, -20990, -21158, -21332, -21461, -21609, -21711, -21815, -21893, -21945, -22000, 
-    -22002, -22014, -21981, -21936, -21865, -21762, -21643, -21494, -21315, -21116, -20881, -20623, -20336, -20026, -19676, -19310, 
-    -18906, -18471, -18025, -17531, -17023, -16485, -15923, -15330, -14728, -14081, -13439, -12762, -12075, -11372, -10656, -9931, 
-    -9199, -8455, -7720, -6968, -6228, -5491, -4745, -4035, -3299, -2603, -1896, -1214, -533, 118, 778, 1408, 
-    2036, 2651, 3248, 3840, 4422, 4992, 5558, 6115, 6670, 7216, 7767, 8304, 8849, 9382, 9923, 10451, 
-    10993, 11504, 12042, 12553, 13060, 13574, 14048, 14547, 15002, 15467, 15898, 16322, 16721, 17103, 17461, 17799, 
-    18117, 18406, 18676, 18917, 19144, 19336, 19521, 19666, 19803, 19912, 19998, 20079, 20123, 20171, 20188, 20199, 
-    20201, 20180, 20164, 20120, 20088, 20021, 19981, 19897, 19838, 19751, 19672, 19581, 19486, 19388, 19277, 19171, 
-    19046, 18922, 18791, 18638, 18495, 18325, 18151, 17966, 17759, 17549, 17310, 17062, 16794, 16504, 16201, 15866, 
-    15514, 15141, 14738, 14316, 13864, 13392, 12893, 12369, 11824, 11251, 10661, 10042, 9412, 8751, 8086, 7391, 
-    6690, 5975, 5244, 4513, 3764, 3019, 2267, 1511, 763, 13, -730, -1472, -2195, -2927, -3630, -4343, 
-    -5022, -5708, -6362, -7021, -7649, -8272, -8880, -9464, -10044, -10597, -11145, -11668, -12181, -12674, -13155, -13621, 
-    -14074, -14500, -14933, -15327, -15733, -16103, -16478, -16822, -17177, -17491, -17822, -18111, -18413, -18681, -18954, -19199, 
-    -19436, -19663, -19857, -20063, -20225, -20387, -20531, -20647, -20765, -20841, -20926, -20966, -21009, -21024, -21015, -21001, 
-    -20946, -20890, -20802, -20697, -20571, -20427, -20253, -20081, -19864, -19649, -19410, -19144, -18886, -18584, -18289, -17972, 
-    -17633, -17298, -16930, -16560, -16175, -15775, -15365, -14943, -14504, -14062, -13603, -13141, -12668, -12189, -11700, -11213, 
-    -10708, -10222, -9703, -9214, -8695, -8194, -7678, -7178, -6660, -6160, -5648, -5139, -4639, -4124, -3628, -3114, 
-    -2619, -2106, -1606, -1102, -592, -95, 416, 919, 1424, 1931, 2432, 2939, 3442, 3940, 4440, 4929, 
-    5423, 5899, 6382, 6845, 7310, 7760, 8201, 8635, 9055, 9469, 9864, 10249, 10627, 10984, 11334, 11673, 
-    11991, 12306, 12608, 12892, 13179, 13445, 13707, 13964, 14203, 14446, 14674, 14900, 15114, 15327, 15521, 15722, 
-    15902, 16080, 16255, 16397, 16559, 16686, 16812, 16926, 17021, 17099, 17179, 17215, 17263, 17269, 17269, 17252, 
-    17200, 17156, 17058, 16970, 16840, 16702, 16535, 16356, 16146, 15928, 15683, 15427, 15149, 14863, 14555, 14247, 
-    13916, 13590, 13238, 12903, 12537, 12190, 11829, 11465, 11112, 10744, 10389, 10029, 9672, 9322, 8963, 8615, 
-    8259, 7913, 7565, 7212, 6862, 6510, 6156, 5803, 5438, 5076, 4709, 4337, 3958, 3574, 3185, 2792, 
-    2385, 1988, 1570, 1163, 739, 323, -104, -515, -943, -1352, -1768, -2170, -2569, -2957, -3336, -3707, 
-    -4059, -4408, -4737, -5057, -5358, -5654, -5923, -6193, -6436, -6680, -6893, -7113, -7303, -7491, -7672, -7830, 
-    -7988, -8136, -8265, -8407, -8518, -8640, -8744, -8847, -8941, -9036, -9112, -9194, -9264, -9327, -9390, -9434, 
-    -9484, -9518, -9548, -9567, -9583, -9583, -9590, -9573, -9559, -9534, -9507, -9469, -9435, -9383, -9343, -9286, 
-    -9240, -9181, -9130, -9075, -9015, -8965, -8898, -8853, -8780, -8733, -8668, -8600, -8550, -8474, -8411, -8348, 
-    -8266, -8202, -8119, -8037, -7955, -7866, -7775, -7677, -7581, -7471, -7373, -7254, -7148, -7030, -6910, -6792, 
-    -6669, -6543, -6424, -6294, -6171, -6046, -5920, -5796, -5673, -5547, -5428, -5302, -5189, -5063, -4949, -4830, 
-    -4715, -4599, -4485, -4365, -4254, -4131, -4016, -3889, -3772, -3639, -3514, -3377, -3238, -3101, -2951, -2807, 
-    -2647, -2496, -2325, -2170, -1987, -1823, -1635, -1461, -1270, -1082, -889, -695, -496, -300, -99, 102, 
-    294, 498, 688, 884, 1067, 1255, 1430, 1603, 1769, 1923, 2086, 2218, 2372, 2491, 2621, 2737, 
-    2845, 2952, 3046, 3138, 3222, 3302, 3378, 3449, 3517, 3584, 3645, 3711, 3771, 3830, 3892, 3949, 
-    4013, 4070, 4135, 4192, 4260, 4319, 4386, 4450, 4514, 4585, 4642, 4716, 4768, 4846, 4891, 4964, 
-    5018, 5073, 5138, 5183, 5244, 5297, 5346, 5400, 5446, 5507, 5543, 5612, 5637, 5712, 5747, 5806, 
-    5859, 5910, 5976, 6026, 6100, 6162, 6235, 6314, 6391, 6484, 6574, 6668, 6779, 6880, 7002, 7114, 
-    7242, 7367, 7496, 7622, 7754, 7880, 8005, 8125, 8243, 8356, 8452, 8560, 8632, 8726, 8778, 8845, 
-    8879, 8918, 8922, 8939, 8911, 8898, 8852, 8789, 8735, 8633, 8549, 8432, 8307, 8176, 8024, 7869, 
-    7700, 7517, 7332, 7131, 6926, 6719, 6488, 6277, 6034, 5807, 5563, 5320, 5074, 4814, 4569, 4298, 
-    4050, 3777, 3518, 3249, 2982, 2714, 2442, 2179, 1903, 1644, 1366, 1112, 841, 583, 325, 66, 
-    -181, -435, -680, -925, -1165, -1398, -1636, -1856, -2091, -2296, -2519, -2721, -2927, -3124, -3312, -3506, 
-    -3679, -3861, -4030, -4191, -4356, -4504, -4658, -4797, -4938, -5068, -5194, -5322, -5434, -5552, -5662, -5764, 
-    -5876, -5967, -6078, -6166, -6274, -6366, -6470, -6571, -6674, -6781, -6894, -7005, -7128, -7257, -7374, -7525, 
-    -7653, -7807, -7952, -8115, -8266, -8440, -8601, -8772, -8953, -9121, -9305, -9476, -9654, -9833, -9997, -10177, 
-    -10328, -10498, -10641, -10797, -10924, -11064, -11173, -11290, -11389, -11479, -11556, -11621, -11674, -11714, -11741, -11754, 
-    -11748, -11735, -11697, -11655, -11585, -11509, -11408, -11297, -11164, -11015, -10849, -10665, -10463, -10248, -10006, -9765, 
-    -9490, -9215, -8914, -8603, -8289, -7945, -7607, -7244, -6885, -6513, -6139, -5760, 
-};
-const unsigned int drum_v2_p0_short_len = 5292;
@@ -1,741 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v2_p1_long[] PROGMEM = {
-    12, -7, 15, 19, 28, 32, 37, 35, 37, 31, 26, 27, 13, 13, 0, -6, 
-    -14, -27, -33, -51, -54, -72, -79, -96, -109, -119, -138, -148, -166, -181, -195, -216, 
-    -229, -249, -267, -283, -307, -320, -344, -360, -382, -401, -420, -439, -457, -479, -493, -518, 
-    -527, -554, -562, -586, -597, -617, -629, -646, -660, -675, -686, -705, -712, -733, -738, -754, 
-    -767, -777, -794, -800, -817, -827, -840, -851, -864, -876, -889, -901, -913, -926, -939, -950, 
-    -965, -974, -987, -999, -1011, -1021, -1032, -1042, -1052, -1060, -1069, -1080, -1080, -1096, -1088, -1106, 
-    -1100, -1108, -1106, -1107, -1109, -1107, -1104, -1101, -1098, -1093, -1088, -1081, -1075, -1067, -1056, -1051, 
-    -1036, -1031, -1015, -1005, -992, -979, -962, -954, -929, -924, -896, -889, -858, -852, -818, -811, 
-    -773, -764, -730, -717, -682, -661, -635, -607, -584, -552, -526, -500, -468, -444, -410, -389, 
-    -355, -329, -297, -274, -242, -215, -185, -162, -129, -108, -72, -55, -19, -2, 31, 52, 
-    82, 103, 130, 155, 178, 206, 223, 255, 273, 301, 321, 348, 371, 394, 419, 443, 
-    466, 493, 515, 541, 565, 591, 615, 639, 665, 689, 713, 737, 761, 785, 805, 831, 
-    848, 875, 887, 913, 927, 947, 962, 978, 994, 1008, 1020, 1034, 1045, 1057, 1067, 1078, 
-    1087, 1095, 1106, 1111, 1122, 1126, 1136, 1141, 1146, 1150, 1158, 1160, 1164, 1168, 1166, 1170, 
-    1166, 1168, 1165, 1159, 1157, 1148, 1142, 1131, 1123, 1105, 1099, 1074, 1069, 1039, 1029, 1002, 
-    985, 958, 938, 911, 886, 859, 831, 806, 775, 748, 717, 687, 657, 628, 593, 564, 
-    527, 496, 462, 425, 391, 352, 314, 274, 237, 192, 154, 103, 67, 14, -27, -77, 
-    -124, -172, -222, -274, -321, -375, -424, -476, -527, -578, -628, -682, -727, -782, -829, -878, 
-    -926, -970, -1020, -1063, -1109, -1150, -1192, -1235, -1273, -1314, -1348, -1385, -1421, -1453, -1488, -1516, 
-    -1547, -1574, -1603, -1628, -1653, -1675, -1698, -1719, -1737, -1755, -1771, -1786, -1800, -1811, -1822, -1827, 
-    -1838, -1838, -1846, -1842, -1844, -1841, -1833, -1830, -1818, -1812, -1792, -1780, -1761, -1742, -1719, -1695, 
-    -1668, -1640, -1607, -1576, -1540, -1504, -1466, -1420, -1384, -1331, -1296, -1234, -1197, -1134, -1090, -1029, 
-    -976, -916, -858, -795, -734, -669, -605, -537, -472, -398, -334, -257, -188, -113, -40, 37, 
-    109, 191, 262, 345, 423, 500, 583, 662, 740, 825, 901, 986, 1065, 1145, 1227, 1308, 
-    1387, 1466, 1547, 1624, 1704, 1776, 1856, 1928, 2005, 2073, 2147, 2211, 2284, 2343, 2411, 2469, 
-    2527, 2590, 2636, 2696, 2738, 2789, 2833, 2873, 2911, 2950, 2977, 3013, 3035, 3061, 3082, 3097, 
-    3112, 3123, 3128, 3135, 3131, 3129, 3123, 3110, 3098, 3074, 3058, 3023, 3002, 2957, 2926, 2880, 
-    2834, 2783, 2728, 2672, 2606, 2545, 2470, 2403, 2320, 2242, 2158, 2069, 1982, 1885, 1789, 1689, 
-    1586, 1479, 1373, 1258, 1147, 1029, 912, 791, 664, 544, 411, 286, 154, 19, -112, -251, 
-    -389, -526, -668, -810, -951, -1096, -1240, -1383, -1535, -1673, -1828, -1968, -2120, -2265, -2413, -2556, 
-    -2705, -2848, -2992, -3135, -3274, -3418, -3553, -3691, -3825, -3957, -4089, -4218, -4344, -4471, -4590, -4711, 
-    -4829, -4945, -5054, -5168, -5268, -5382, -5475, -5579, -5670, -5765, -5852, -5937, -6018, -6096, -6170, -6237, 
-    -6303, -6359, -6418, -6463, -6510, -6544, -6576, -6601, -6618, -6631, -6630, -6631, -6614, -6600, -6566, -6535, 
-    -6485, -6440, -6370, -6305, -6223, -6135, -6038, -5932, -5817, -5693, -5559, -5418, -5266, -5107, -4939, -4759, 
-    -4576, -4374, -4177, -3958, -3742, -3509, -3271, -3029, -2767, -2514, -2235, -1969, -1676, -1393, -1089, -793, 
-    -481, -169, 148, 473, 796, 1129, 1459, 1795, 2132, 2466, 2811, 3142, 3486, 3819, 4156, 4491, 
-    4821, 5147, 5477, 5789, 6115, 6415, 6730, 7021, 7322, 7600, 7887, 8154, 8422, 8677, 8928, 9165, 
-    9399, 9620, 9835, 10039, 10235, 10420, 10598, 10762, 10922, 11069, 11206, 11335, 11452, 11561, 11661, 11747, 
-    11834, 11894, 11965, 12006, 12058, 12080, 12111, 12120, 12128, 12122, 12107, 12088, 12057, 12016, 11969, 11912, 
-    11848, 11776, 11693, 11608, 11506, 11405, 11290, 11171, 11045, 10902, 10766, 10604, 10456, 10277, 10104, 9917, 
-    9725, 9520, 9309, 9084, 8857, 8612, 8360, 8099, 7820, 7539, 7237, 6931, 6607, 6268, 5925, 5558, 
-    5188, 4793, 4393, 3977, 3545, 3101, 2646, 2174, 1689, 1195, 682, 166, -373, -913, -1469, -2038, 
-    -2608, -3201, -3787, -4396, -5000, -5619, -6238, -6869, -7494, -8139, -8765, -9413, -10043, -10691, -11320, -11959, 
-    -12584, -13214, -13825, -14439, -15037, -15626, -16205, -16765, -17317, -17846, -18364, -18857, -19332, -19791, -20215, -20635, 
-    -21010, -21376, -21706, -22016, -22297, -22554, -22773, -22985, -23145, -23303, -23413, -23513, -23576, -23621, -23641, -23636, 
-    -23612, -23564, -23499, -23417, -23313, -23199, -23063, -22923, -22760, -22592, -22411, -22221, -22019, -21809, -21587, -21361, 
-    -21115, -20870, -20605, -20333, -20043, -19743, -19422, -19094, -18730, -18369, -17963, -17562, -17112, -16665, -16176, -15681, 
-    -15151, -14615, -14050, -13480, -12884, -12291, -11678, -11073, -10457, -9848, -9242, -8646, -8061, -7487, -6926, -6382, 
-    -5844, -5332, -4815, -4319, -3812, -3317, -2802, -2283, -1727, -1161, -538, 106, 834, 1586, 2439, 3330, 
-    4328, 5380, 6538, 7752, 9095, 10506, 11987, 13520, 15125, 16757, 18436, 20114, 21830, 23502, 25196, 26799, 
-    28456, 29960, 31572, 32602, 32536, 32591, 32555, 32580, 32564, 32575, 32566, 32574, 32567, 32575, 32566, 32573, 
-    32568, 32572, 32571, 32568, 32574, 32566, 32575, 32565, 32576, 32565, 32573, 32566, 32573, 32567, 32572, 32563, 
-    32573, 32564, 32573, 32567, 32572, 32569, 32572, 32569, 32572, 32567, 32576, 32563, 32578, 32559, 32585, 32550, 
-    32597, 32526, 32653, 32249, 30249, 28405, 26420, 24529, 22563, 20644, 18702, 16826, 14937, 13113, 11289, 9566, 
-    7882, 6300, 4763, 3333, 1978, 733, -440, -1533, -2586, -3582, -4563, -5508, -6439, -7338, -8263, -9181, 
-    -10138, -11091, -12077, -13064, -14085, -15134, -16255, -17406, -18612, -19824, -21075, -22326, -23604, -24865, -26138, -27397, 
-    -28660, -29902, -31124, -32258, -32657, -32620, -32640, -32625, -32638, -32628, -32636, -32627, -32635, -32628, -32634, -32628, 
-    -32634, -32627, -32634, -32627, -32635, -32628, -32635, -32627, -32634, -32628, -32636, -32629, -32633, -32631, -32634, -32630, 
-    -32634, -32630, -32633, -32632, -32632, -32631, -32632, -32631, -32630, -32629, -32629, -32632, -32630, -32631, -32633, -32630, 
-    -32635, -32629, -32634, -32632, -32629, -32636, -32627, -32637, -32627, -32634, -32629, -32635, -32627, -32635, -32626, -32638, 
-    -32624, -32643, -32614, -32670, -32313, -30252, -28233, -26134, -24045, -21903, -19777, -17626, -15507, -13397, -11339, -9310, 
-    -7347, -5403, -3525, -1657, 150, 1943, 3673, 5385, 7043, 8688, 10291, 11886, 13437, 14972, 16468, 17952, 
-    19394, 20847, 22249, 23692, 25072, 26530, 27901, 29381, 30727, 32250, 32643, 32535, 32593, 32554, 32584, 32559, 
-    32579, 32563, 32575, 32565, 32576, 32565, 32575, 32566, 32575, 32567, 32574, 32567, 32573, 32567, 32575, 32566, 
-    32575, 32566, 32575, 32568, 32572, 32568, 32573, 32568, 32574, 32566, 32573, 32568, 32573, 32569, 32571, 32570, 
-    32570, 32572, 32567, 32573, 32567, 32573, 32568, 32571, 32571, 32567, 32574, 32566, 32574, 32567, 32574, 32567, 
-    32572, 32567, 32572, 32570, 32572, 32568, 32573, 32567, 32575, 32565, 32574, 32566, 32574, 32566, 32577, 32560, 
-    32587, 32544, 32632, 31954, 29838, 27556, 25245, 22910, 20544, 18166, 15773, 13367, 10933, 8493, 6038, 3590, 
-    1146, -1281, -3687, -6076, -8417, -10724, -12979, -15186, -17334, -19424, -21450, -23423, -25321, -27185, -28961, -30751, 
-    -32286, -32654, -32627, -32634, -32633, -32630, -32632, -32633, -32631, -32634, -32630, -32632, -32632, -32632, -32632, -32632, 
-    -32631, -32631, -32632, -32631, -32631, -32633, -32630, -32634, -32627, -32636, -32628, -32637, -32627, -32636, -32627, -32635, 
-    -32629, -32632, -32630, -32632, -32630, -32635, -32630, -32635, -32629, -32634, -32631, -32632, -32631, -32630, -32632, -32633, 
-    -32629, -32634, -32628, -32635, -32630, -32636, -32629, -32634, -32630, -32635, -32630, -32633, -32628, -32634, -32629, -32635, 
-    -32627, -32636, -32625, -32636, -32625, -32637, -32628, -32636, -32628, -32637, -32624, -32639, -32623, -32643, -32617, -32644, 
-    -30650, -27440, -24288, -21040, -17827, -14553, -11322, -8060, -4845, -1630, 1525, 4661, 7735, 10778, 13761, 16690, 
-    19568, 22364, 25125, 27768, 30453, 32375, 32586, 32572, 32565, 32577, 32565, 32573, 32569, 32570, 32571, 32569, 
-    32572, 32569, 32570, 32572, 32567, 32574, 32564, 32575, 32567, 32573, 32569, 32570, 32570, 32570, 32570, 32571, 
-    32570, 32573, 32566, 32576, 32566, 32575, 32566, 32575, 32565, 32576, 32566, 32574, 32567, 32572, 32570, 32571, 
-    32571, 32571, 32569, 32573, 32567, 32576, 32564, 32576, 32564, 32575, 32564, 32575, 32566, 32574, 32566, 32574, 
-    32565, 32578, 32562, 32579, 32562, 32579, 32564, 32576, 32562, 32581, 32559, 32585, 32555, 32586, 32554, 32588, 
-    32552, 32591, 32545, 32602, 32529, 32627, 32479, 32767, 30608, 27386, 24466, 21302, 18252, 15069, 11961, 8766, 
-    5639, 2453, -655, -3793, -6853, -9916, -12911, -15885, -18802, -21671, -24506, -27238, -30032, -32273, -32652, -32632, 
-    -32628, -32637, -32627, -32638, -32625, -32640, -32624, -32640, -32625, -32639, -32626, -32636, -32629, -32635, -32627, -32638, 
-    -32625, -32640, -32624, -32639, -32624, -32641, -32626, -32637, -32627, -32635, -32630, -32635, -32629, -32636, -32629, -32635, 
-    -32630, -32634, -32629, -32633, -32626, -32635, -32623, -32639, -32623, -32641, -32624, -32638, -32624, -32638, -32626, -32638, 
-    -32627, -32636, -32627, -32636, -32626, -32635, -32625, -32636, -32626, -32636, -32626, -32637, -32622, -32640, -32623, -32640, 
-    -32623, -32637, -32621, -32640, -32620, -32646, -32619, -32646, -32617, -32648, -32613, -32651, -32606, -32659, -32599, -32677, 
-    -32564, -32734, -30802, -27947, -25341, -22501, -19745, -16856, -14020, -11096, -8224, -5293, -2436, 462, 3268, 6094, 
-    8825, 11559, 14194, 16835, 19363, 21913, 24319, 26800, 29056, 31577, 32619, 32530, 32598, 32551, 32586, 32558, 
-    32581, 32561, 32578, 32564, 32576, 32567, 32575, 32565, 32576, 32565, 32577, 32563, 32577, 32563, 32578, 32562, 
-    32576, 32563, 32576, 32565, 32572, 32566, 32571, 32568, 32572, 32564, 32576, 32563, 32575, 32564, 32573, 32567, 
-    32574, 32567, 32575, 32566, 32576, 32564, 32577, 32563, 32578, 32561, 32578, 32564, 32574, 32567, 32574, 32565, 
-    32578, 32563, 32577, 32563, 32577, 32563, 32578, 32563, 32577, 32562, 32579, 32560, 32578, 32559, 32583, 32558, 
-    32585, 32551, 32593, 32546, 32596, 32538, 32604, 32526, 32628, 32481, 32749, 31317, 28669, 26381, 23832, 21428, 
-    18864, 16378, 13778, 11220, 8571, 5948, 3247, 566, -2181, -4915, -7696, -10467, -13278, -16073, -18905, -21701, 
-    -24538, -27301, -30170, -32345, -32673, -32617, -32641, -32623, -32638, -32628, -32636, -32626, -32632, -32631, -32629, -32632, 
-    -32631, -32630, -32633, -32626, -32634, -32630, -32634, -32629, -32633, -32626, -32637, -32623, -32639, -32625, -32639, -32626, 
-    -32637, -32628, -32638, -32627, -32635, -32629, -32633, -32629, -32634, -32627, -32636, -32630, -32635, -32630, -32634, -32631, 
-    -32634, -32628, -32635, -32627, -32635, -32629, -32632, -32629, -32633, -32630, -32636, -32627, -32637, -32627, -32638, -32626, 
-    -32637, -32627, -32636, -32627, -32638, -32625, -32641, -32622, -32643, -32621, -32644, -32616, -32653, -32594, -32716, -31153, 
-    -28520, -25959, -23307, -20682, -18003, -15338, -12635, -9949, -7233, -4541, -1837, 833, 3501, 6123, 8733, 11285, 
-    13824, 16287, 18742, 21102, 23456, 25707, 27945, 30082, 32179, 32585, 32564, 32573, 32567, 32572, 32568, 32573, 
-    32566, 32574, 32567, 32574, 32566, 32573, 32567, 32572, 32568, 32571, 32570, 32569, 32572, 32568, 32571, 32567, 
-    32572, 32565, 32574, 32565, 32574, 32567, 32572, 32570, 32570, 32568, 32574, 32566, 32576, 32564, 32573, 32566, 
-    32573, 32566, 32575, 32565, 32577, 32563, 32577, 32563, 32577, 32564, 32578, 32563, 32577, 32562, 32577, 32563, 
-    32579, 32561, 32582, 32558, 32584, 32558, 32583, 32557, 32584, 32555, 32585, 32556, 32586, 32553, 32588, 32548, 
-    32600, 32534, 32619, 32494, 32719, 31909, 29198, 26721, 24103, 21615, 19064, 16603, 14107, 11678, 9227, 6814, 
-    4393, 1993, -412, -2812, -5215, -7625, -10030, -12459, -14867, -17313, -19707, -22156, -24510, -26955, -29207, -31726, 
-    -32722, -32572, -32675, -32600, -32659, -32609, -32655, -32612, -32650, -32614, -32646, -32621, -32642, -32623, -32638, -32626, 
-    -32640, -32623, -32637, -32624, -32636, -32625, -32634, -32627, -32637, -32626, -32637, -32627, -32637, -32627, -32635, -32629, 
-    -32635, -32627, -32638, -32625, -32638, -32627, -32636, -32628, -32636, -32627, -32636, -32627, -32635, -32630, -32634, -32629, 
-    -32635, -32630, -32634, -32630, -32633, -32630, -32635, -32629, -32637, -32625, -32638, -32625, -32637, -32627, -32636, -32628, 
-    -32636, -32626, -32638, -32626, -32638, -32626, -32637, -32627, -32639, -32623, -32646, -32608, -32681, -32446, -30421, -28266, 
-    -26020, -23773, -21445, -19113, -16718, -14312, -11858, -9389, -6885, -4370, -1821, 733, 3330, 5922, 8564, 11190, 
-    13870, 16518, 19216, 21867, 24577, 27194, 29953, 32196, 32594, 32567, 32571, 32572, 32568, 32571, 32568, 32572, 
-    32569, 32571, 32568, 32572, 32568, 32573, 32569, 32572, 32568, 32572, 32568, 32571, 32568, 32570, 32569, 32569, 
-    32572, 32568, 32572, 32567, 32572, 32569, 32571, 32570, 32569, 32572, 32571, 32570, 32569, 32568, 32573, 32566, 
-    32572, 32567, 32570, 32568, 32571, 32569, 32571, 32570, 32569, 32571, 32569, 32570, 32568, 32569, 32570, 32570, 
-    32568, 32582, 32408, 31311, 29894, 28572, 27193, 25868, 24520, 23218, 21907, 20637, 19369, 18139, 16910, 15717, 
-    14521, 13352, 12174, 11010, 9832, 8659, 7457, 6246, 4997, 3725, 2403, 1049, -364, -1813, -3328, -4877, 
-    -6492, -8135, -9842, -11576, -13355, -15175, -17013, -18886, -20779, -22677, -24598, -26490, -28405, -30268, -32135, -32648, 
-    -32620, -32639, -32625, -32636, -32630, -32631, -32634, -32630, -32634, -32630, -32631, -32634, -32630, -32634, -32630, -32632, 
-    -32630, -32630, -32629, -32631, -32628, -32632, -32633, -32631, -32633, -32631, -32633, -32632, -32630, -32633, -32631, -32631, 
-    -32631, -32630, -32630, -32633, -32630, -32633, -32629, -32632, -32630, -32631, -32631, -32630, -32635, -32629, -32636, -32626, 
-    -32614, -31661, -29942, -28273, -26570, -24879, -23174, -21481, -19787, -18100, -16426, -14762, -13115, -11489, -9875, -8299, 
-    -6731, -5210, -3700, -2238, -802, 593, 1955, 3276, 4556, 5798, 6994, 8148, 9265, 10335, 11379, 12379, 
-    13361, 14307, 15242, 16151, 17063, 17946, 18852, 19727, 20635, 21523, 22443, 23353, 24299, 25228, 26203, 27150, 
-    28150, 29112, 30140, 31087, 32170, 32650, 32530, 32596, 32552, 32584, 32560, 32580, 32559, 32579, 32560, 32578, 
-    32562, 32579, 32562, 32577, 32563, 32576, 32565, 32574, 32567, 32576, 32564, 32577, 32564, 32575, 32565, 32573, 
-    32568, 32572, 32568, 32573, 32567, 32574, 32565, 32576, 32564, 32578, 32562, 32565, 32137, 31309, 30499, 29615, 
-    28704, 27718, 26694, 25594, 24447, 23223, 21948, 20604, 19214, 17762, 16268, 14725, 13146, 11543, 9912, 8276, 
-    6632, 4999, 3383, 1792, 226, -1293, -2779, -4205, -5583, -6909, -8173, -9384, -10537, -11642, -12697, -13715, 
-    -14692, -15645, -16566, -17475, -18366, -19251, -20125, -21000, -21871, -22743, -23613, -24479, -25347, -26203, -27062, -27898, 
-    -28729, -29534, -30317, -31070, -31794, -32443, -32652, -32623, -32636, -32629, -32632, -32630, -32631, -32632, -32632, -32630, 
-    -32632, -32630, -32632, -32632, -32633, -32631, -32632, -32633, -32632, -32631, -32632, -32631, -32634, -32632, -32631, -32633, 
-    -32629, -32637, -32625, -32642, -32508, -31972, -31428, -30822, -30202, -29515, -28808, -28040, -27235, -26373, -25472, -24511, 
-    -23513, -22452, -21360, -20209, -19027, -17797, -16540, -15248, -13939, -12608, -11266, -9913, -8561, -7206, -5858, -4521, 
-    -3193, -1893, -598, 661, 1909, 3131, 4332, 5515, 6672, 7815, 8933, 10040, 11125, 12197, 13258, 14305, 
-    15338, 16361, 17369, 18358, 19334, 20287, 21219, 22126, 23006, 23856, 24675, 25451, 26202, 26903, 27571, 28189, 
-    28766, 29299, 29780, 30221, 30610, 30958, 31256, 31515, 31728, 31904, 32035, 32130, 32190, 32212, 32203, 32156, 
-    32081, 31968, 31832, 31659, 31464, 31247, 30995, 30735, 30430, 30122, 29771, 29417, 29021, 28624, 28189, 27748, 
-    27285, 26806, 26314, 25805, 25285, 24751, 24204, 23648, 23075, 22494, 21893, 21285, 20656, 20011, 19348, 18665, 
-    17968, 17244, 16501, 15735, 14952, 14141, 13312, 12455, 11579, 10671, 9742, 8786, 7807, 6803, 5770, 4721, 
-    3644, 2557, 1441, 317, -816, -1965, -3115, -4274, -5433, -6583, -7737, -8866, -9998, -11094, -12183, -13231, 
-    -14264, -15257, -16221, -17144, -18035, -18880, -19697, -20457, -21198, -21880, -22542, -23148, -23740, -24279, -24810, -25293, 
-    -25765, -26206, -26621, -27023, -27396, -27753, -28086, -28398, -28688, -28949, -29180, -29382, -29547, -29677, -29764, -29807, 
-    -29805, -29750, -29652, -29496, -29296, -29041, -28740, -28394, -28010, -27582, -27125, -26638, -26123, -25588, -25041, -24476, 
-    -23922, -23345, -22795, -22236, -21697, -21167, -20651, -20148, -19661, -19178, -18711, -18242, -17779, -17310, -16836, -16338, 
-    -15834, -15293, -14736, -14142, -13511, -12846, -12140, -11387, -10605, -9773, -8915, -8021, -7100, -6152, -5187, -4202, 
-    -3213, -2212, -1214, -217, 764, 1744, 2689, 3630, 4524, 5412, 6259, 7081, 7882, 8643, 9394, 10106, 
-    10800, 11470, 12119, 12745, 13362, 13944, 14535, 15087, 15653, 16185, 16724, 17242, 17761, 18262, 18759, 19241, 
-    19714, 20173, 20613, 21051, 21462, 21868, 22249, 22613, 22958, 23269, 23562, 23814, 24035, 24222, 24364, 24467, 
-    24526, 24540, 24511, 24431, 24314, 24149, 23943, 23698, 23410, 23096, 22741, 22370, 21959, 21534, 21080, 20618, 
-    20131, 19635, 19124, 18605, 18080, 17550, 17016, 16487, 15956, 15429, 14903, 14378, 13861, 13343, 12827, 12317, 
-    11808, 11300, 10795, 10294, 9795, 9297, 8805, 8312, 7833, 7345, 6869, 6396, 5924, 5464, 4998, 4539, 
-    4082, 3619, 3165, 2699, 2242, 1773, 1307, 834, 362, -118, -603, -1094, -1587, -2084, -2584, -3088, 
-    -3594, -4098, -4615, -5117, -5643, -6148, -6673, -7182, -7705, -8221, -8745, -9259, -9781, -10290, -10807, -11306, 
-    -11805, -12290, -12768, -13229, -13679, -14104, -14519, -14900, -15263, -15595, -15901, -16173, -16416, -16625, -16804, -16950, 
-    -17065, -17146, -17202, -17223, -17224, -17192, -17144, -17067, -16982, -16860, -16752, -16594, -16466, -16290, -16142, -15961, 
-    -15794, -15611, -15426, -15240, -15041, -14846, -14631, -14409, -14176, -13920, -13651, -13355, -13038, -12698, -12329, -11941, 
-    -11527, -11095, -10638, -10172, -9688, -9198, -8698, -8197, -7697, -7199, -6715, -6235, -5785, -5344, -4941, -4551, 
-    -4207, -3882, -3601, -3352, -3137, -2956, -2809, -2691, -2604, -2536, -2491, -2459, -2443, -2425, -2415, -2396, 
-    -2370, -2333, -2278, -2207, -2115, -2002, -1869, -1705, -1530, -1318, -1102, -847, -587, -297, -6, 307, 
-    625, 957, 1296, 1638, 1985, 2338, 2684, 3041, 3380, 3731, 4065, 4405, 4732, 5063, 5386, 5711, 
-    6029, 6357, 6675, 7005, 7331, 7660, 7996, 8328, 8663, 9000, 9329, 9654, 9978, 10278, 10581, 10850, 
-    11111, 11343, 11543, 11723, 11858, 11971, 12034, 12071, 12060, 12022, 11943, 11830, 11687, 11513, 11317, 11096, 
-    10864, 10618, 10368, 10110, 9858, 9613, 9374, 9156, 8948, 8767, 8603, 8465, 8350, 8265, 8194, 8165, 
-    8138, 8152, 8163, 8203, 8240, 8291, 8339, 8381, 8423, 8442, 8459, 8445, 8416, 8361, 8279, 8171, 
-    8028, 7862, 7663, 7436, 7183, 6904, 6602, 6282, 5939, 5587, 5218, 4844, 4464, 4075, 3700, 3315, 
-    2961, 2595, 2271, 1946, 1655, 1380, 1134, 910, 713, 541, 391, 264, 150, 58, -27, -99, 
-    -168, -235, -298, -369, -442, -532, -631, -745, -881, -1026, -1203, -1386, -1599, -1827, -2068, -2335, 
-    -2599, -2889, -3175, -3465, -3757, -4034, -4317, -4570, -4819, -5043, -5253, -5433, -5596, -5737, -5852, -5952, 
-    -6019, -6081, -6115, -6145, -6163, -6172, -6183, -6188, -6206, -6224, -6257, -6297, -6351, -6425, -6503, -6610, 
-    -6716, -6858, -6993, -7160, -7322, -7501, -7685, -7865, -8054, -8234, -8404, -8574, -8717, -8862, -8978, -9078, 
-    -9163, -9214, -9258, -9267, -9268, -9245, -9209, -9160, -9094, -9035, -8947, -8881, -8785, -8721, -8624, -8562, 
-    -8482, -8423, -8362, -8311, -8271, -8237, -8205, -8188, -8166, -8162, -8151, -8147, -8147, -8140, -8143, -8129, 
-    -8123, -8098, -8077, -8037, -7993, -7935, -7869, -7785, -7695, -7576, -7454, -7303, -7143, -6957, -6753, -6532, 
-    -6288, -6025, -5743, -5438, -5120, -4780, -4426, -4055, -3668, -3263, -2853, -2425, -1996, -1556, -1111, -667, 
-    -218, 223, 661, 1093, 1513, 1926, 2321, 2707, 3073, 3432, 3761, 4095, 4390, 4696, 4968, 5246, 
-    5505, 5762, 6011, 6257, 6501, 6748, 6996, 7244, 7498, 7755, 8012, 8280, 8538, 8815, 9079, 9353, 
-    9616, 9882, 10142, 10399, 10648, 10890, 11127, 11348, 11572, 11772, 11979, 12158, 12344, 12506, 12670, 12818, 
-    12968, 13105, 13243, 13370, 13496, 13620, 13736, 13852, 13960, 14066, 14167, 14257, 14339, 14411, 14469, 14504, 
-    14532, 14523, 14509, 14455, 14390, 14283, 14158, 13994, 13802, 13577, 13314, 13028, 12699, 12352, 11962, 11560, 
-    11112, 10657, 10166, 9662, 9137, 8594, 8044, 7478, 6905, 6329, 5743, 5166, 4582, 4017, 3446, 2896, 
-    2343, 1815, 1290, 784, 286, -185, -655, -1097, -1532, -1943, -2340, -2721, -3085, -3431, -3759, -4073, 
-    -4370, -4653, -4916, -5172, -5408, -5643, -5856, -6072, -6270, -6466, -6658, -6831, -7017, -7177, -7349, -7503, 
-    -7658, -7805, -7947, -8078, -8203, -8326, -8431, -8546, -8633, -8736, -8813, -8900, -8968, -9044, -9104, -9175, 
-    -9232, -9301, -9354, -9427, -9481, -9556, -9616, -9694, -9771, -9844, -9932, -10009, -10102, -10183, -10272, -10357, 
-    -10439, -10518, -10588, -10660, -10717, -10775, -10814, -10853, -10871, -10888, -10880, -10879, -10844, -10819, -10765, -10713, 
-    -10645, -10563, -10485, -10383, -10289, -10170, -10065, -9930, -9813, -9670, -9539, -9389, -9247, -9085, -8939, -8761, 
-    -8604, -8413, -8236, -8035, -7834, -7617, -7396, -7160, -6916, -6657, -6384, -6097, -5790, -5472, -5136, -4785, 
-    -4419, -4034, -3644, -3233, -2820, -2394, -1966, -1531, -1092, -658, -225, 199, 618, 1024, 1415, 1793, 
-    2146, 2488, 2794, 3096, 3352, 3607, 3814, 4019, 4179, 4335, 4453, 4564, 4646, 4717, 4777, 4819, 
-    4861, 4889, 4919, 4951, 4977, 5018, 5052, 5105, 5159, 5226, 5301, 5388, 5483, 5595, 5710, 5844, 
-    5972, 6120, 6265, 6415, 6570, 6718, 6868, 7020, 7155, 7302, 7426, 7562, 7680, 7801, 7909, 8015, 
-    8113, 8206, 8298, 8384, 8467, 8553, 8634, 8722, 8812, 8903, 9008, 9111, 9229, 9346, 9479, 9613, 
-    9762, 9910, 10068, 10228, 10388, 10552, 10704, 10862, 11002, 11139, 11260, 11362, 11454, 11519, 11567, 11587, 
-    11590, 11559, 11504, 11420, 11311, 11174, 11011, 10819, 10608, 10367, 10111, 9828, 9531, 9214, 8884, 8535, 
-    8182, 7806, 7431, 7044, 6652, 6258, 5859, 5460, 5062, 4664, 4271, 3880, 3504, 3125, 2770, 2412, 
-    2080, 1751, 1445, 1150, 874, 613, 373, 148, -54, -245, -413, -569, -702, -833, -938, -1045, 
-    -1137, -1227, -1317, -1402, -1496, -1588, -1693, -1804, -1925, -2058, -2203, -2365, -2539, -2735, -2942, -3170, 
-    -3407, -3670, -3933, -4224, -4514, -4827, -5139, -5465, -5792, -6134, -6465, -6815, -7148, -7500, -7836, -8180, 
-    -8512, -8849, -9178, -9510, -9828, -10152, -10462, -10773, -11072, -11370, -11650, -11931, -12188, -12444, -12676, -12901, 
-    -13105, -13289, -13463, -13606, -13740, -13842, -13929, -13997, -14038, -14066, -14069, -14059, -14030, -13979, -13920, -13835, 
-    -13744, -13635, -13516, -13383, -13242, -13088, -12928, -12754, -12582, -12393, -12201, -12004, -11796, -11595, -11373, -11168, 
-    -10942, -10730, -10509, -10288, -10075, -9852, -9644, -9429, -9221, -9016, -8814, -8616, -8426, -8235, -8056, -7872, 
-    -7695, -7523, -7348, -7179, -7002, -6828, -6650, -6464, -6275, -6072, -5863, -5643, -5410, -5164, -4904, -4629, 
-    -4340, -4034, -3715, -3374, -3022, -2644, -2264, -1850, -1435, -989, -542, -63, 414, 927, 1433, 1972, 
-    2509, 3069, 3627, 4209, 4785, 5381, 5969, 6577, 7170, 7783, 8374, 8982, 9566, 10162, 10735, 11315, 
-    11869, 12428, 12966, 13495, 14010, 14512, 15001, 15478, 15938, 16390, 16819, 17247, 17654, 18048, 18428, 18797, 
-    19151, 19491, 19815, 20123, 20424, 20699, 20968, 21215, 21445, 21665, 21859, 22041, 22196, 22339, 22451, 22551, 
-    22615, 22666, 22678, 22672, 22633, 22565, 22467, 22338, 22177, 21985, 21756, 21496, 21200, 20874, 20513, 20125, 
-    19697, 19254, 18770, 18272, 17738, 17197, 16628, 16050, 15453, 14847, 14241, 13610, 12999, 12359, 11743, 11108, 
-    10485, 9859, 9234, 8616, 7994, 7381, 6764, 6148, 5535, 4921, 4311, 3690, 3080, 2456, 1839, 1208, 
-    580, -54, -695, -1339, -1997, -2656, -3326, -4010, -4691, -5399, -6104, -6830, -7561, -8305, -9062, -9827, 
-    -10602, -11382, -12175, -12963, -13763, -14557, -15348, -16139, -16916, -17685, -18437, -19174, -19887, -20584, -21248, -21891, 
-    -22500, -23081, -23630, -24149, -24636, -25086, -25508, -25892, -26257, -26581, -26884, -27161, -27410, -27648, -27849, -28046, 
-    -28210, -28365, -28495, -28606, -28695, -28760, -28804, -28819, -28805, -28761, -28680, -28569, -28416, -28221, -27983, -27698, 
-    -27366, -26988, -26552, -26075, -25540, -24962, -24332, -23661, -22942, -22190, -21392, -20567, -19713, -18835, -17940, -17024, 
-    -16109, -15184, -14258, -13343, -12424, -11533, -10636, -9770, -8910, -8072, -7251, -6448, -5662, -4889, -4130, -3380, 
-    -2640, -1900, -1162, -422, 324, 1075, 1842, 2617, 3411, 4221, 5043, 5894, 6750, 7635, 8526, 9435, 
-    10354, 11280, 12208, 13135, 14060, 14966, 15874, 16745, 17613, 18442, 19250, 20026, 20768, 21475, 22147, 22781, 
-    23381, 23943, 24463, 24961, 25413, 25847, 26239, 26612, 26955, 27275, 27568, 27847, 28098, 28338, 28554, 28752, 
-    28940, 29103, 29255, 29386, 29502, 29592, 29667, 29712, 29736, 29730, 29691, 29626, 29520, 29380, 29203, 28984, 
-    28728, 28428, 28087, 27705, 27277, 26816, 26301, 25761, 25167, 24554, 23890, 23211, 22488, 21750, 20974, 20189, 
-    19373, 18548, 17702, 16849, 15979, 15114, 14227, 13351, 12459, 11578, 10691, 9810, 8922, 8048, 7161, 6288, 
-    5408, 4532, 3657, 2772, 1899, 1010, 126, -772, -1668, -2576, -3491, -4407, -5345, -6269, -7222, -8162, 
-    -9122, -10072, -11032, -11983, -12940, -13880, -14822, -15745, -16658, -17551, -18423, -19274, -20104, -20890, -21661, -22383, 
-    -23078, -23732, -24344, -24919, -25452, -25938, -26394, -26791, -27169, -27486, -27785, -28031, -28256, -28437, -28598, -28718, 
-    -28816, -28884, -28929, -28947, -28941, -28913, -28862, -28790, -28698, -28584, -28455, -28298, -28133, -27938, -27731, -27495, 
-    -27248, -26970, -26675, -26347, -25998, -25627, -25218, -24793, -24326, -23843, -23322, -22777, -22193, -21588, -20941, -20273, 
-    -19561, -18826, -18051, -17250, -16413, -15549, -14657, -13734, -12791, -11820, -10833, -9825, -8807, -7771, -6733, -5688, 
-    -4639, -3595, -2550, -1516, -486, 532, 1538, 2529, 3508, 4464, 5402, 6325, 7218, 8104, 8949, 9788, 
-    10588, 11382, 12141, 12888, 13606, 14312, 14995, 15661, 16311, 16942, 17563, 18158, 18750, 19311, 19873, 20397, 
-    20926, 21419, 21906, 22367, 22809, 23229, 23627, 24000, 24346, 24669, 24954, 25220, 25449, 25652, 25824, 25960, 
-    26074, 26151, 26202, 26223, 26214, 26181, 26121, 26034, 25921, 25789, 25627, 25451, 25247, 25029, 24784, 24528, 
-    24242, 23946, 23618, 23276, 22909, 22515, 22100, 21653, 21182, 20681, 20146, 19583, 18990, 18357, 17700, 17003, 
-    16280, 15522, 14728, 13917, 13061, 12200, 11293, 10381, 9438, 8486, 7511, 6531, 5531, 4533, 3517, 2508, 
-    1484, 476, -544, -1549, -2562, -3552, -4548, -5523, -6495, -7450, -8392, -9325, -10235, -11135, -12011, -12876, 
-    -13713, -14534, -15328, -16101, -16846, -17562, -18247, -18902, -19522, -20106, -20655, -21164, -21636, -22063, -22453, -22799, 
-    -23108, -23374, -23596, -23788, -23935, -24054, -24135, -24186, -24207, -24198, -24167, -24105, -24029, -23924, -23809, -23669, 
-    -23521, -23355, -23174, -22980, -22773, -22551, -22316, -22056, -21790, -21489, -21184, -20837, -20483, -20083, -19668, -19208, 
-    -18730, -18206, -17657, -17064, -16447, -15796, -15112, -14404, -13663, -12907, -12123, -11323, -10511, -9677, -8850, -7997, 
-    -7162, -6303, -5468, -4620, -3793, -2961, -2150, -1340, -548, 233, 1003, 1762, 2504, 3243, 3963, 4683, 
-    5390, 6089, 6789, 7473, 8164, 8843, 9520, 10192, 10857, 11523, 12172, 12819, 13451, 14077, 14689, 15282, 
-    15865, 16423, 16969, 17484, 17988, 18454, 18905, 19321, 19710, 20071, 20397, 20694, 20959, 21187, 21387, 21550, 
-    21680, 21783, 21844, 21885, 21885, 21864, 21807, 21727, 21617, 21481, 21323, 21136, 20925, 20693, 20439, 20166, 
-    19870, 19556, 19223, 18868, 18500, 18105, 17700, 17267, 16826, 16353, 15876, 15369, 14853, 14307, 13754, 13171, 
-    12583, 11960, 11334, 10681, 10017, 9333, 8634, 7921, 7192, 6450, 5694, 4929, 4153, 3372, 2580, 1792, 
-    996, 203, -589, -1380, -2165, -2946, -3717, -4483, -5235, -5982, -6711, -7430, -8132, -8820, -9492, -10149, 
-    -10788, -11405, -12009, -12587, -13152, -13692, -14218, -14717, -15209, -15668, -16124, -16547, -16969, -17361, -17753, -18110, 
-    -18471, -18799, -19125, -19426, -19721, -19990, -20256, -20493, -20727, -20934, -21129, -21303, -21457, -21598, -21705, -21804, 
-    -21862, -21918, -21921, -21925, -21873, -21816, -21705, -21580, -21412, -21216, -20982, -20715, -20409, -20079, -19699, -19295, 
-    -18846, -18363, -17853, -17296, -16716, -16100, -15449, -14777, -14063, -13339, -12583, -11808, -11018, -10210, -9397, -8565, 
-    -7743, -6903, -6079, -5246, -4431, -3624, -2821, -2043, -1266, -515, 223, 949, 1654, 2350, 3026, 3687, 
-    4343, 4979, 5613, 6233, 6852, 7463, 8074, 8676, 9281, 9876, 10478, 11070, 11653, 12245, 12809, 13384, 
-    13927, 14473, 14993, 15501, 15984, 16445, 16884, 17291, 17678, 18031, 18360, 18651, 18923, 19156, 19371, 19547, 
-    19704, 19829, 19928, 20011, 20063, 20105, 20118, 20125, 20110, 20086, 20047, 19998, 19937, 19872, 19789, 19710, 
-    19613, 19519, 19409, 19301, 19176, 19054, 18909, 18772, 18604, 18443, 18256, 18062, 17849, 17617, 17370, 17094, 
-    16806, 16483, 16148, 15771, 15377, 14947, 14490, 13999, 13480, 12928, 12347, 11733, 11094, 10421, 9728, 9003, 
-    8261, 7494, 6709, 5909, 5094, 4270, 3433, 2598, 1753, 913, 77, -758, -1581, -2396, -3201, -3993, 
-    -4770, -5531, -6273, -7004, -7709, -8402, -9073, -9723, -10357, -10968, -11563, -12132, -12687, -13218, -13739, -14228, 
-    -14711, -15168, -15612, -16040, -16445, -16843, -17218, -17582, -17926, -18257, -18569, -18870, -19146, -19411, -19653, -19875, 
-    -20084, -20258, -20431, -20562, -20690, -20778, -20863, -20902, -20945, -20936, -20928, -20872, -20807, -20707, -20584, -20437, 
-    -20259, -20065, -19840, -19594, -19331, -19033, -18739, -18395, -18065, -17686, -17317, -16909, -16497, -16063, -15615, -15152, 
-    -14673, -14176, -13675, -13152, -12631, -12087, -11549, -10990, -10442, -9875, -9315, -8747, -8178, -7609, -7042, -6469, 
-    -5907, -5332, -4773, -4200, -3641, -3071, -2513, -1941, -1385, -813, -254, 312, 878, 1442, 2008, 2570, 
-    3137, 3694, 4254, 4805, 5354, 5891, 6426, 6945, 7461, 7958, 8448, 8921, 9385, 9830, 10259, 10678, 
-    11072, 11462, 11825, 12179, 12520, 12840, 13158, 13454, 13748, 14025, 14294, 14558, 14807, 15051, 15284, 15506, 
-    15724, 15922, 16122, 16294, 16465, 16621, 16752, 16886, 16976, 17076, 17133, 17184, 17204, 17204, 17182, 17130, 
-    17064, 16957, 16842, 16684, 16513, 16307, 16082, 15829, 15556, 15258, 14946, 14610, 14265, 13902, 13532, 13146, 
-    12762, 12357, 11967, 11555, 11161, 10751, 10354, 9950, 9554, 9158, 8762, 8369, 7976, 7590, 7194, 6804, 
-    6408, 6015, 5614, 5207, 4800, 4384, 3963, 3531, 3098, 2652, 2203, 1748, 1284, 820, 347, -122, 
-    -591, -1060, -1523, -1980, -2427, -2865, -3291, -3704, -4099, -4483, -4849, -5196, -5529, -5841, -6139, -6417, 
-    -6683, -6925, -7161, -7368, -7579, -7760, -7939, -8102, -8252, -8402, -8529, -8659, -8773, -8883, -8987, -9077, 
-    -9165, -9243, -9314, -9376, -9426, -9475, -9505, -9533, -9544, -9550, -9548, -9531, -9509, -9479, -9441, -9400, 
-    -9347, -9297, -9237, -9181, -9117, -9060, -8993, -8935, -8863, -8808, -8730, -8678, -8595, -8538, -8459, -8385, 
-    -8314, -8226, -8151, -8056, -7966, -7870, -7767, -7662, -7550, -7432, -7317, -7187, -7066, -6929, -6799, -6661, 
-    -6522, -6387, -6242, -6105, -5964, -5824, -5687, -5547, -5411, -5274, -5144, -5006, -4879, -4745, -4618, -4488, 
-    -4358, -4228, -4096, -3961, -3825, -3685, -3541, -3393, -3237, -3082, -2917, -2751, -2576, -2397, -2214, -2024, 
-    -1829, -1630, -1425, -1219, -1001, -790, -565, -349, -121, 98, 321, 540, 760, 969, 1180, 1377, 
-    1575, 1757, 1936, 2106, 2265, 2421, 2556, 2697, 2816, 2937, 3042, 3144, 3236, 3324, 3407, 3482, 
-    3560, 3627, 3702, 3766, 3836, 3900, 3970, 4035, 4107, 4172, 4246, 4312, 4390, 4457, 4537, 4603, 
-    4682, 4746, 4827, 4882, 4963, 5016, 5090, 5145, 5210, 5270, 5329, 5382, 5445, 5495, 5559, 5606, 
-    5667, 5725, 5779, 5844, 5901, 5972, 6034, 6118, 6186, 6281, 6361, 6470, 6564, 6681, 6797, 6923, 
-    7054, 7190, 7333, 7474, 7619, 7763, 7906, 8040, 8175, 8301, 8416, 8527, 8619, 8708, 8773, 8832, 
-    8871, 8890, 8901, 8880, 8858, 8800, 8737, 8653, 8543, 8434, 8286, 8147, 7971, 7801, 7600, 7400, 
-    7180, 6953, 6720, 6470, 6225, 5959, 5700, 5425, 5154, 4867, 4588, 4293, 4007, 3709, 3415, 3115, 
-    2816, 2514, 2215, 1912, 1615, 1312, 1023, 723, 438, 145, -132, -415, -690, -965, -1228, -1494, 
-    -1748, -2005, -2246, -2486, -2719, -2946, -3165, -3376, -3585, -3779, -3979, -4155, -4342, -4506, -4678, -4830, 
-    -4989, -5124, -5273, -5397, -5532, -5649, -5772, -5884, -5998, -6109, -6219, -6330, -6441, -6557, -6671, -6794, 
-    -6919, -7048, -7192, -7327, -7486, -7637, -7804, -7974, -8150, -8331, -8521, -8703, -8908, -9095, -9302, -9490, 
-    -9696, -9883, -10080, -10259, -10440, -10610, -10774, -10924, -11067, -11191, -11314, -11414, -11506, -11576, -11637, -11676, 
-    -11705, -11707, -11698, -11664, -11616, -11543, -11454, -11339, -11209, -11051, -10876, -10675, -10455, -10213, -9946, -9668, 
-    -9360, -9045, -8697, -8350, -7973, -7591, -7190, -6785, -6368, -5949, -5520, -5091, -4661, -4229, -3807, -3379, 
-    -2966, -2550, -2155, -1760, -1376, -999, -636, -281, 67, 407, 738, 1063, 1381, 1693, 2004, 2310, 
-    2613, 2919, 3214, 3521, 3815, 4120, 4417, 4716, 5014, 5308, 5603, 5892, 6179, 6459, 6734, 7000, 
-    7262, 7507, 7754, 7973, 8202, 8399, 8598, 8783, 8949, 9116, 9261, 9406, 9539, 9663, 9786, 9900, 
-    10012, 10125, 10228, 10340, 10444, 10558, 10660, 10779, 10883, 11000, 11109, 11220, 11334, 11441, 11550, 11652, 
-    11757, 11851, 11942, 12022, 12102, 12166, 12223, 12269, 12299, 12320, 12321, 12310, 12280, 12231, 12166, 12080, 
-    11974, 11851, 11703, 11542, 11347, 11147, 10911, 10665, 10394, 10097, 9792, 9454, 9111, 8739, 8362, 7956, 
-    7551, 7120, 6691, 6240, 5792, 5326, 4867, 4390, 3920, 3443, 2965, 2492, 2011, 1538, 1069, 600, 
-    137, -317, -769, -1208, -1646, -2066, -2483, -2882, -3278, -3650, -4021, -4364, -4707, -5023, -5334, -5617, 
-    -5896, -6146, -6393, -6607, -6819, -7005, -7173, -7334, -7467, -7600, -7705, -7802, -7889, -7962, -8026, -8081, 
-    -8125, -8168, -8199, -8230, -8255, -8277, -8297, -8313, -8328, -8346, -8352, -8369, -8372, -8386, -8389, -8394, 
-    -8396, -8394, -8394, -8383, -8378, -8352, -8340, -8305, -8276, -8232, -8181, -8121, -8055, -7975, -7886, -7789, 
-    -7679, -7562, -7435, -7295, -7159, -6998, -6847, -6684, -6518, -6353, -6180, -6018, -5847, -5691, -5521, -5374, 
-    -5216, -5077, -4932, -4803, -4668, -4553, -4425, -4320, -4199, -4099, -3982, -3882, -3763, -3662, -3537, -3422, 
-    -3290, -3156, -3014, -2859, -2695, -2520, -2337, -2139, -1933, -1716, -1495, -1259, -1027, -778, -541, -289, 
-    -54, 194, 424, 659, 880, 1096, 1301, 1495, 1673, 1848, 2001, 2145, 2273, 2388, 2495, 2582, 
-    2660, 2727, 2780, 2830, 2858, 2892, 2903, 2918, 2922, 2919, 2918, 2900, 2891, 2867, 2848, 2820, 
-    2794, 2762, 2732, 2698, 2666, 2632, 2599, 2570, 2540, 2518, 2494, 2476, 2466, 2456, 2458, 2461, 
-    2469, 2489, 2511, 2538, 2581, 2610, 2671, 2711, 2776, 2834, 2898, 2969, 3033, 3108, 3179, 3250, 
-    3323, 3386, 3460, 3516, 3581, 3636, 3686, 3740, 3776, 3827, 3859, 3903, 3932, 3974, 4004, 4046, 
-    4080, 4125, 4165, 4218, 4266, 4326, 4389, 4456, 4529, 4607, 4687, 4778, 4862, 4956, 5046, 5137, 
-    5229, 5309, 5395, 5469, 5539, 5596, 5649, 5689, 5720, 5740, 5743, 5748, 5723, 5708, 5665, 5626, 
-    5572, 5510, 5442, 5367, 5286, 5200, 5113, 5018, 4929, 4829, 4740, 4640, 4556, 4457, 4374, 4284, 
-    4197, 4117, 4029, 3961, 3873, 3808, 3724, 3660, 3584, 3516, 3447, 3374, 3305, 3232, 3155, 3084, 
-    2998, 2921, 2828, 2741, 2644, 2539, 2438, 2314, 2203, 2062, 1934, 1781, 1633, 1467, 1293, 1114, 
-    919, 725, 508, 291, 58, -175, -430, -680, -953, -1217, -1505, -1790, -2081, -2382, -2679, -2990, 
-    -3290, -3600, -3907, -4212, -4520, -4818, -5123, -5415, -5713, -5997, -6289, -6564, -6841, -7109, -7371, -7629, 
-    -7873, -8116, -8349, -8572, -8791, -8997, -9204, -9391, -9583, -9758, -9937, -10096, -10264, -10408, -10569, -10694, 
-    -10848, -10962, -11097, -11206, -11318, -11423, -11516, -11603, -11683, -11750, -11810, -11853, -11890, -11909, -11915, -11901, 
-    -11878, -11830, -11770, -11685, -11586, -11462, -11318, -11158, -10971, -10772, -10541, -10306, -10038, -9765, -9465, -9159, 
-    -8836, -8499, -8160, -7800, -7447, -7077, -6713, -6341, -5969, -5597, -5228, -4856, -4496, -4126, -3774, -3413, 
-    -3068, -2718, -2380, -2042, -1715, -1385, -1068, -748, -440, -129, 174, 476, 778, 1072, 1376, 1666, 
-    1972, 2264, 2570, 2872, 3181, 3500, 3814, 4151, 4479, 4834, 5185, 5551, 5934, 6318, 6724, 7135, 
-    7555, 7993, 8425, 8883, 9328, 9790, 10250, 10705, 11169, 11615, 12069, 12505, 12932, 13352, 13751, 14145, 
-    14511, 14870, 15201, 15522, 15815, 16092, 16342, 16577, 16778, 16977, 17130, 17284, 17397, 17499, 17574, 17628, 
-    17664, 17674, 17664, 17635, 17581, 17511, 17412, 17301, 17162, 17005, 16827, 16625, 16407, 16165, 15905, 15630, 
-    15329, 15019, 14685, 14340, 13972, 13596, 13198, 12789, 12364, 11920, 11472, 10993, 10523, 10014, 9514, 8981, 
-    8456, 7903, 7345, 6777, 6194, 5611, 5009, 4411, 3799, 3187, 2570, 1955, 1331, 719, 97, -503, 
-    -1120, -1713, -2313, -2891, -3476, -4037, -4602, -5147, -5688, -6218, -6735, -7249, -7750, -8240, -8730, -9200, 
-    -9678, -10135, -10596, -11049, -11492, -11935, -12371, -12797, -13224, -13632, -14053, -14438, -14840, -15209, -15590, -15940, 
-    -16288, -16616, -16935, -17233, -17518, -17781, -18031, -18259, -18468, -18656, -18826, -18977, -19100, -19211, -19293, -19361, 
-    -19404, -19425, -19431, -19405, -19371, -19305, -19227, -19126, -19003, -18864, -18701, -18524, -18321, -18103, -17863, -17604, 
-    -17329, -17026, -16714, -16376, -16026, -15653, -15266, -14861, -14441, -14004, -13556, -13092, -12614, -12125, -11620, -11109, 
-    -10582, -10044, -9500, -8936, -8376, -7789, -7208, -6607, -6003, -5387, -4760, -4128, -3487, -2834, -2179, -1510, 
-    -840, -162, 521, 1210, 1902, 2601, 3290, 3997, 4684, 5387, 6077, 6762, 7447, 8119, 8788, 9442, 
-    10088, 10716, 11336, 11935, 12522, 13087, 13636, 14167, 14675, 15167, 15631, 16081, 16506, 16909, 17289, 17646, 
-    17981, 18296, 18579, 18847, 19085, 19302, 19496, 19660, 19809, 19925, 20027, 20098, 20149, 20180, 20184, 20175, 
-    20133, 20086, 20002, 19917, 19794, 19670, 19509, 19349, 19152, 18954, 18725, 18483, 18227, 17941, 17651, 17330, 
-    17000, 16648, 16275, 15891, 15477, 15060, 14610, 14155, 13675, 13188, 12679, 12159, 11626, 11084, 10528, 9967, 
-    9395, 8823, 8240, 7660, 7068, 6488, 5896, 5314, 4726, 4142, 3562, 2978, 2402, 1824, 1247, 671, 
-    98, -479, -1044, -1629, -2193, -2775, -3342, -3922, -4490, -5063, -5630, -6196, -6759, -7310, -7860, -8398, 
-    -8930, -9450, -9956, -10452, -10925, -11397, -11835, -12268, -12674, -13062, -13437, -13779, -14115, -14416, -14712, -14975, 
-    -15229, -15455, -15672, -15862, -16042, -16201, -16345, -16476, -16586, -16690, -16770, -16841, -16896, -16938, -16963, -16973, 
-    -16967, -16947, -16909, -16851, -16779, -16686, -16572, -16444, -16283, -16116, -15914, -15699, -15460, -15197, -14920, -14614, 
-    -14294, -13952, -13590, -13215, -12818, -12409, -11985, -11545, -11097, -10637, -10165, -9687, -9199, -8711, -8213, -7709, 
-    -7205, -6698, -6185, -5679, -5161, -4657, -4138, -3633, -3122, -2617, -2111, -1615, -1114, -627, -135, 339, 
-    819, 1283, 1751, 2198, 2653, 3085, 3525, 3941, 4362, 4766, 5168, 5559, 5945, 6320, 6693, 7050, 
-    7407, 7751, 8090, 8423, 8739, 9058, 9356, 9661, 9944, 10226, 10491, 10754, 10996, 11238, 11456, 11669, 
-    11863, 12046, 12208, 12363, 12488, 12610, 12704, 12787, 12846, 12892, 12913, 12926, 12912, 12885, 12841, 12776, 
-    12700, 12607, 12495, 12373, 12230, 12084, 11915, 11739, 11550, 11351, 11143, 10923, 10692, 10458, 10207, 9957, 
-    9689, 9423, 9140, 8859, 8560, 8267, 7951, 7645, 7315, 6998, 6657, 6323, 5973, 5626, 5267, 4906, 
-    4536, 4166, 3781, 3401, 3006, 2614, 2212, 1809, 1400, 993, 573, 167, -252, -660, -1074, -1482, 
-    -1883, -2283, -2669, -3053, -3422, -3783, -4133, -4463, -4787, -5085, -5378, -5639, -5901, -6124, -6349, -6540, 
-    -6725, -6881, -7031, -7154, -7268, -7359, -7439, -7504, -7558, -7594, -7627, -7637, -7656, -7649, -7644, -7629, 
-    -7609, -7583, -7552, -7518, -7479, -7437, -7391, -7340, -7294, -7232, -7185, -7114, -7061, -6983, -6918, -6837, 
-    -6759, -6668, -6576, -6469, -6364, -6239, -6117, -5970, -5826, -5662, -5494, -5309, -5115, -4912, -4697, -4474, 
-    -4242, -4001, -3761, -3506, -3257, -2999, -2748, -2493, -2240, -1993, -1747, -1510, -1275, -1051, -829, -621, 
-    -414, -222, -31, 150, 318, 493, 648, 809, 958, 1107, 1254, 1397, 1536, 1684, 1821, 1969, 
-    2108, 2260, 2400, 2556, 2701, 2851, 3005, 3152, 3308, 3455, 3604, 3748, 3892, 4024, 4158, 4279, 
-    4393, 4501, 4592, 4681, 4746, 4807, 4846, 4878, 4887, 4886, 4865, 4831, 4782, 4714, 4641, 4540, 
-    4443, 4315, 4197, 4050, 3914, 3751, 3603, 3432, 3270, 3098, 2930, 2759, 2590, 2419, 2249, 2086, 
-    1920, 1762, 1598, 1445, 1287, 1138, 986, 834, 694, 538, 402, 250, 112, -31, -173, -310, 
-    -448, -587, -717, -851, -973, -1103, -1219, -1335, -1444, -1548, -1649, -1740, -1827, -1911, -1981, -2057, 
-    -2112, -2176, -2221, -2269, -2307, -2343, -2371, -2394, -2412, -2426, -2436, -2438, -2438, -2432, -2424, -2410, 
-    -2394, -2371, -2350, -2318, -2291, -2251, -2216, -2169, -2129, -2073, -2025, -1963, -1903, -1837, -1765, -1689, 
-    -1611, -1525, -1436, -1341, -1244, -1142, -1034, -929, -812, -702, -578, -469, -338, -226, -93, 19, 
-    146, 267, 387, 511, 625, 747, 859, 977, 1089, 1202, 1312, 1422, 1533, 1644, 1753, 1865, 
-    1972, 2084, 2191, 2299, 2404, 2510, 2609, 2708, 2800, 2885, 2970, 3037, 3106, 3162, 3205, 3247, 
-    3267, 3288, 3290, 3292, 3271, 3258, 3217, 3190, 3141, 3093, 3039, 2985, 2925, 2869, 2804, 2750, 
-    2693, 2633, 2584, 2526, 2484, 2430, 2390, 2337, 2296, 2245, 2198, 2144, 2086, 2023, 1953, 1878, 
-    1788, 1694, 1589, 1470, 1348, 1204, 1067, 900, 742, 560, 386, 192, 6, -193, -389, -588, 
-    -791, -987, -1185, -1377, -1568, -1753, -1934, -2105, -2275, -2432, -2590, -2735, -2879, -3009, -3142, -3259, 
-    -3381, -3487, -3597, -3692, -3797, -3883, -3982, -4059, -4153, -4227, -4308, -4378, -4451, -4511, -4579, -4622, 
-    -4682, -4715, -4754, -4784, -4798, -4816, -4815, -4813, -4796, -4777, -4739, -4700, -4648, -4580, -4517, -4422, 
-    -4341, -4231, -4122, -3996, -3867, -3726, -3581, -3424, -3259, -3095, -2913, -2737, -2548, -2357, -2163, -1961, 
-    -1760, -1555, -1347, -1136, -926, -709, -498, -278, -64, 153, 368, 583, 802, 1010, 1229, 1433, 
-    1649, 1849, 2065, 2258, 2467, 2659, 2859, 3047, 3237, 3416, 3600, 3769, 3942, 4105, 4262, 4419, 
-    4560, 4705, 4836, 4968, 5085, 5201, 5308, 5407, 5502, 5586, 5665, 5734, 5799, 5850, 5900, 5934, 
-    5968, 5984, 6001, 5999, 5998, 5982, 5959, 5927, 5888, 5836, 5786, 5712, 5647, 5562, 5479, 5384, 
-    5283, 5181, 5065, 4953, 4830, 4703, 4576, 4436, 4303, 4152, 4012, 3855, 3705, 3543, 3387, 3220, 
-    3055, 2886, 2715, 2544, 2366, 2192, 2013, 1829, 1650, 1460, 1277, 1082, 886, 693, 484, 283, 
-    63, -144, -374, -592, -832, -1059, -1308, -1545, -1800, -2049, -2308, -2568, -2828, -3095, -3358, -3623, 
-    -3886, -4145, -4409, -4657, -4912, -5151, -5392, -5618, -5840, -6049, -6252, -6440, -6624, -6785, -6950, -7085, 
-    -7232, -7340, -7462, -7553, -7649, -7720, -7790, -7843, -7894, -7919, -7952, -7956, -7968, -7947, -7938, -7899, 
-    -7861, -7807, -7740, -7670, -7577, -7481, -7373, -7249, -7118, -6974, -6816, -6653, -6466, -6277, -6070, -5852, 
-    -5621, -5380, -5122, -4859, -4580, -4292, -3996, -3686, -3375, -3051, -2725, -2392, -2055, -1717, -1376, -1036, 
-    -698, -358, -27, 302, 626, 939, 1254, 1548, 1849, 2128, 2408, 2672, 2931, 3189, 3428, 3672, 
-    3904, 4134, 4364, 4582, 4811, 5019, 5246, 5454, 5673, 5882, 6090, 6301, 6503, 6705, 6906, 7093, 
-    7292, 7465, 7649, 7815, 7979, 8135, 8276, 8416, 8534, 8655, 8745, 8845, 8908, 8981, 9022, 9058, 
-    9078, 9082, 9074, 9049, 9011, 8961, 8891, 8812, 8717, 8613, 8490, 8361, 8215, 8066, 7899, 7729, 
-    7548, 7360, 7165, 6967, 6756, 6554, 6331, 6121, 5895, 5672, 5447, 5216, 4983, 4749, 4505, 4268, 
-    4017, 3765, 3507, 3245, 2974, 2697, 2411, 2121, 1819, 1509, 1196, 865, 537, 191, -152, -507, 
-    -869, -1235, -1605, -1980, -2352, -2733, -3103, -3486, -3850, -4227, -4586, -4947, -5296, -5644, -5976, -6305, 
-    -6616, -6928, -7215, -7501, -7765, -8024, -8262, -8494, -8703, -8911, -9090, -9270, -9422, -9573, -9699, -9818, 
-    -9922, -10010, -10086, -10152, -10201, -10243, -10266, -10285, -10286, -10282, -10259, -10234, -10188, -10139, -10073, -10001, 
-    -9913, -9813, -9703, -9577, -9443, -9289, -9125, -8944, -8756, -8541, -8326, -8081, -7839, -7569, -7293, -6998, 
-    -6697, -6375, -6052, -5708, -5361, -5007, -4636, -4272, -3890, -3512, -3129, -2740, -2360, -1966, -1590, -1199, 
-    -825, -447, -72, 292, 658, 1013, 1369, 1714, 2056, 2390, 2719, 3048, 3358, 3679, 3982, 4291, 
-    4591, 4886, 5181, 5469, 5758, 6039, 6318, 6597, 6866, 7140, 7397, 7664, 7912, 8164, 8406, 8637, 
-    8867, 9079, 9288, 9483, 9664, 9837, 9990, 10136, 10259, 10375, 10468, 10548, 10612, 10657, 10690, 10703, 
-    10703, 10686, 10656, 10606, 10547, 10470, 10379, 10279, 10154, 10028, 9879, 9721, 9552, 9364, 9176, 8962, 
-    8748, 8516, 8277, 8027, 7766, 7495, 7218, 6929, 6634, 6330, 6014, 5705, 5369, 5046, 4700, 4359, 
-    4005, 3648, 3286, 2917, 2539, 2160, 1775, 1384, 989, 584, 184, -228, -636, -1058, -1471, -1897, 
-    -2307, -2736, -3143, -3562, -3965, -4366, -4759, -5141, -5516, -5874, -6225, -6554, -6879, -7175, -7467, -7730, 
-    -7986, -8212, -8431, -8623, -8808, -8963, -9110, -9240, -9348, -9453, -9527, -9604, -9659, -9704, -9741, -9761, 
-    -9781, -9781, -9783, -9768, -9751, -9723, -9687, -9642, -9590, -9526, -9460, -9373, -9289, -9178, -9073, -8940, 
-    -8810, -8653, -8499, -8319, -8138, -7934, -7732, -7504, -7281, -7031, -6787, -6524, -6255, -5981, -5697, -5408, 
-    -5115, -4815, -4511, -4207, -3895, -3585, -3267, -2956, -2634, -2317, -1993, -1671, -1345, -1019, -686, -355, 
-    -13, 319, 667, 1009, 1358, 1710, 2061, 2417, 2768, 3128, 3477, 3837, 4182, 4535, 4878, 5215, 
-    5553, 5873, 6200, 6499, 6811, 7095, 7381, 7652, 7905, 8163, 8389, 8620, 8825, 9025, 9209, 9381, 
-    9535, 9681, 9807, 9922, 10023, 10103, 10176, 10225, 10265, 10278, 10285, 10262, 10238, 10174, 10112, 10011, 
-    9910, 9774, 9629, 9458, 9277, 9071, 8851, 8617, 8363, 8105, 7820, 7539, 7236, 6931, 6614, 6291, 
-    5963, 5626, 5291, 4946, 4607, 4257, 3912, 3562, 3215, 2864, 2521, 2167, 1825, 1472, 1132, 782, 
-    444, 94, -236, -583, -915, -1252, -1584, -1913, -2241, -2567, -2883, -3203, -3508, -3818, -4114, -4412, 
-    -4697, -4980, -5253, -5523, -5785, -6034, -6285, -6518, -6758, -6973, -7194, -7398, -7600, -7791, -7974, -8148, 
-    -8315, -8469, -8621, -8757, -8887, -9007, -9116, -9221, -9305, -9390, -9458, -9519, -9568, -9605, -9635, -9649, 
-    -9654, -9646, -9625, -9596, -9546, -9494, -9418, -9340, -9235, -9129, -8994, -8862, -8699, -8537, -8344, -8152, 
-    -7933, -7710, -7457, -7211, -6925, -6651, -6340, -6032, -5698, -5361, -5003, -4640, -4258, -3874, -3470, -3064, 
-    -2644, -2220, -1788, -1347, -907, -457, -6, 444, 898, 1353, 1803, 2255, 2698, 3145, 3577, 4011, 
-    4432, 4851, 5253, 5658, 6038, 6423, 6782, 7143, 7479, 7817, 8126, 8439, 8723, 9007, 9270, 9520, 
-    9762, 9981, 10195, 10387, 10572, 10735, 10887, 11026, 11143, 11258, 11342, 11428, 11482, 11537, 11567, 11588, 
-    11585, 11579, 11545, 11509, 11443, 11371, 11280, 11172, 11052, 10909, 10757, 10584, 10395, 10192, 9969, 9735, 
-    9482, 9214, 8935, 8636, 8330, 8006, 7676, 7330, 6979, 6615, 6245, 5871, 5487, 5101, 4707, 4315, 
-    3920, 3522, 3119, 2724, 2321, 1922, 1520, 1119, 721, 311, -87, -495, -901, -1312, -1726, -2139, 
-    -2559, -2978, -3403, -3825, -4251, -4677, -5101, -5525, -5945, -6362, -6767, -7175, -7563, -7951, -8320, -8676, 
-    -9023, -9348, -9664, -9953, -10236, -10492, -10739, -10958, -11172, -11361, -11540, -11699, -11848, -11985, -12107, -12220, 
-    -12321, -12414, -12496, -12573, -12638, -12699, -12745, -12789, -12816, -12836, -12847, -12842, -12822, -12792, -12736, -12679, 
-    -12581, -12484, -12354, -12207, -12035, -11841, -11630, -11389, -11132, -10846, -10550, -10220, -9882, -9517, -9143, -8747, 
-    -8338, -7920, -7482, -7042, -6585, -6126, -5656, -5183, -4703, -4219, -3731, -3239, -2744, -2244, -1749, -1236, 
-    -738, -222, 282, 800, 1315, 1833, 2353, 2872, 3397, 3912, 4441, 4951, 5476, 5977, 6496, 6985, 
-    7489, 7963, 8444, 8898, 9354, 9784, 10208, 10609, 10998, 11366, 11722, 12052, 12369, 12664, 12940, 13203, 
-    13435, 13663, 13862, 14047, 14216, 14359, 14502, 14606, 14716, 14787, 14864, 14907, 14944, 14956, 14958, 14940, 
-    14905, 14849, 14782, 14687, 14582, 14449, 14305, 14137, 13951, 13742, 13518, 13269, 13008, 12719, 12417, 12095, 
-    11756, 11400, 11025, 10642, 10236, 9826, 9392, 8962, 8507, 8056, 7582, 7120, 6628, 6154, 5654, 5169, 
-    4666, 4167, 3663, 3160, 2649, 2143, 1629, 1119, 605, 90, -426, -939, -1462, -1975, -2495, -3011, 
-    -3526, -4041, -4552, -5057, -5566, -6061, -6556, -7039, -7520, -7987, -8447, -8895, -9330, -9755, -10163, -10556, 
-    -10940, -11297, -11651, -11974, -12294, -12584, -12867, -13126, -13370, -13594, -13806, -13994, -14173, -14325, -14471, -14591, 
-    -14703, -14792, -14871, -14928, -14972, -15002, -15013, -15009, -14993, -14955, -14911, -14840, -14769, -14666, -14563, -14435, 
-    -14299, -14143, -13975, -13788, -13595, -13375, -13151, -12903, -12647, -12372, -12082, -11779, -11458, -11126, -10774, -10413, 
-    -10029, -9641, -9228, -8812, -8371, -7926, -7461, -6990, -6501, -6002, -5496, -4971, -4448, -3900, -3362, -2799, 
-    -2245, -1675, -1106, -532, 44, 619, 1200, 1776, 2356, 2927, 3501, 4066, 4632, 5189, 5743, 6285, 
-    6825, 7355, 7876, 8390, 8889, 9382, 9863, 10332, 10789, 11230, 11663, 12074, 12480, 12860, 13230, 13583, 
-    13915, 14230, 14524, 14798, 15052, 15283, 15489, 15675, 15834, 15972, 16078, 16168, 16222, 16259, 16264, 16244, 
-    16201, 16127, 16033, 15914, 15769, 15605, 15415, 15209, 14982, 14734, 14470, 14192, 13894, 13586, 13262, 12929, 
-    12579, 12226, 11852, 11484, 11091, 10701, 10293, 9886, 9462, 9037, 8597, 8157, 7699, 7240, 6770, 6291, 
-    5805, 5309, 4809, 4299, 3782, 3261, 2733, 2203, 1669, 1132, 597, 59, -470, -1002, -1526, -2048, 
-    -2556, -3064, -3556, -4042, -4516, -4977, -5429, -5866, -6290, -6706, -7103, -7491, -7869, -8229, -8588, -8924, 
-    -9264, -9581, -9901, -10204, -10506, -10796, -11077, -11362, -11622, -11891, -12141, -12387, -12624, -12847, -13068, -13265, 
-    -13463, -13636, -13803, -13948, -14080, -14195, -14288, -14366, -14425, -14461, -14477, -14472, -14449, -14399, -14335, -14239, 
-    -14135, -13997, -13853, -13673, -13485, -13272, -13044, -12796, -12526, -12249, -11942, -11635, -11297, -10958, -10595, -10225, 
-    -9839, -9442, -9032, -8613, -8180, -7741, -7287, -6829, -6358, -5882, -5397, -4908, -4407, -3904, -3397, -2883, 
-    -2367, -1847, -1322, -801, -275, 252, 772, 1302, 1818, 2337, 2850, 3356, 3860, 4351, 4837, 5312, 
-    5778, 6233, 6672, 7109, 7517, 7929, 8311, 8692, 9045, 9396, 9719, 10037, 10328, 10613, 10872, 11120, 
-    11345, 11556, 11752, 11920, 12079, 12213, 12335, 12432, 12514, 12578, 12622, 12648, 12660, 12648, 12630, 12584, 
-    12531, 12460, 12374, 12277, 12166, 12044, 11909, 11764, 11609, 11447, 11271, 11093, 10901, 10706, 10499, 10290, 
-    10065, 9842, 9600, 9360, 9105, 8840, 8573, 8286, 7997, 7692, 7380, 7060, 6724, 6386, 6032, 5676, 
-    5308, 4934, 4556, 4170, 3780, 3386, 2989, 2590, 2192, 1789, 1390, 986, 590, 189, -207, -606, 
-    -997, -1396, -1781, -2183, -2566, -2965, -3346, -3745, -4125, -4523, -4900, -5296, -5672, -6059, -6437, -6809, 
-    -7184, -7543, -7902, -8250, -8585, -8918, -9226, -9529, -9813, -10080, -10333, -10561, -10777, -10962, -11138, -11279, 
-    -11412, -11510, -11594, -11652, -11692, -11703, -11704, -11671, -11636, -11564, -11486, -11386, -11272, -11139, -10997, -10833, 
-    -10668, -10478, -10285, -10079, -9860, -9636, -9396, -9151, -8895, -8627, -8356, -8069, -7779, -7475, -7168, -6848, 
-    -6529, -6190, -5858, -5507, -5161, -4803, -4448, -4077, -3717, -3340, -2973, -2595, -2222, -1846, -1470, -1097, 
-    -721, -350, 22, 388, 755, 1117, 1479, 1833, 2187, 2536, 2881, 3222, 3560, 3889, 4222, 4537, 
-    4861, 5161, 5470, 5759, 6048, 6323, 6590, 6844, 7089, 7317, 7543, 7742, 7941, 8116, 8283, 8436, 
-    8569, 8695, 8802, 8901, 8980, 9050, 9103, 9150, 9178, 9200, 9204, 9206, 9185, 9169, 9128, 9093, 
-    9031, 8978, 8900, 8826, 8731, 8635, 8528, 8408, 8283, 8145, 7999, 7841, 7675, 7496, 7309, 7110, 
-    6901, 6686, 6451, 6216, 5963, 5707, 5442, 5160, 4887, 4585, 4303, 3991, 3691, 3381, 3067, 2758, 
-    2437, 2128, 1809, 1500, 1187, 882, 575, 278, -18, -310, -593, -877, -1151, -1423, -1690, -1953, 
-    -2213, -2468, -2722, -2973, -3225, -3470, -3721, -3963, -4215, -4452, -4701, -4941, -5180, -5422, -5648, -5885, 
-    -6104, -6325, -6536, -6736, -6930, -7113, -7279, -7439, -7576, -7710, -7812, -7913, -7984, -8046, -8083, -8110, 
-    -8111, -8104, -8069, -8033, -7968, -7898, -7809, -7712, -7602, -7483, -7352, -7219, -7071, -6925, -6765, -6606, 
-    -6437, -6269, -6093, -5914, -5730, -5543, -5349, -5156, -4950, -4750, -4532, -4322, -4095, -3871, -3635, -3398, 
-    -3149, -2898, -2642, -2375, -2113, -1830, -1561, -1272, -993, -702, -417, -126, 158, 450, 733, 1017, 
-    1292, 1571, 1838, 2102, 2354, 2605, 2842, 3077, 3294, 3512, 3711, 3910, 4090, 4267, 4430, 4588, 
-    4733, 4872, 4995, 5124, 5223, 5338, 5422, 5518, 5592, 5668, 5730, 5793, 5841, 5889, 5923, 5956, 
-    5978, 5996, 6003, 6006, 6000, 5986, 5964, 5933, 5897, 5850, 5795, 5734, 5661, 5585, 5494, 5400, 
-    5298, 5183, 5068, 4935, 4809, 4655, 4516, 4350, 4193, 4020, 3845, 3666, 3476, 3289, 3089, 2892, 
-    2686, 2484, 2268, 2062, 1840, 1632, 1411, 1195, 979, 762, 547, 332, 121, -89, -294, -502, 
-    -701, -899, -1092, -1282, -1470, -1648, -1830, -2002, -2174, -2337, -2502, -2658, -2815, -2959, -3110, -3248, 
-    -3387, -3521, -3645, -3772, -3885, -4005, -4106, -4215, -4302, -4395, -4473, -4546, -4616, -4670, -4720, -4757, 
-    -4793, -4810, -4826, -4826, -4821, -4802, -4779, -4737, -4699, -4632, -4579, -4496, -4420, -4324, -4230, -4121, 
-    -4011, -3889, -3766, -3634, -3498, -3360, -3212, -3068, -2913, -2762, -2604, -2444, -2287, -2124, -1959, -1798, 
-    -1628, -1466, -1298, -1130, -967, -794, -632, -461, -293, -127, 43, 209, 384, 547, 722, 885, 
-    1061, 1224, 1398, 1558, 1733, 1887, 2058, 2210, 2374, 2525, 2677, 2825, 2965, 3109, 3238, 3375, 
-    3492, 3620, 3726, 3839, 3941, 4036, 4126, 4207, 4284, 4352, 4414, 4464, 4515, 4545, 4583, 4599, 
-    4612, 4618, 4612, 4601, 4583, 4548, 4517, 4464, 4416, 4350, 4283, 4205, 4120, 4033, 3932, 3832, 
-    3723, 3605, 3490, 3363, 3241, 3100, 2973, 2829, 2689, 2543, 2393, 2244, 2090, 1929, 1768, 1604, 
-    1432, 1262, 1081, 900, 712, 518, 326, 123, -82, -291, -508, -720, -944, -1164, -1390, -1616, 
-    -1838, -2070, -2287, -2516, -2732, -2947, -3163, -3365, -3571, -3760, -3951, -4129, -4303, -4462, -4622, -4766, 
-    -4908, -5033, -5162, -5266, -5383, -5468, -5570, -5645, -5728, -5789, -5863, -5909, -5974, -6001, -6058, -6070, 
-    -6117, -6115, -6144, -6133, -6140, -6126, -6101, -6078, -6032, -5991, -5923, -5858, -5771, -5681, -5570, -5456, 
-    -5318, -5180, -5015, -4849, -4662, -4467, -4258, -4038, -3804, -3567, -3308, -3056, -2779, -2513, -2222, -1945, 
-    -1646, -1357, -1058, -756, -463, -158, 139, 439, 730, 1028, 1319, 1608, 1893, 2173, 2454, 2724, 
-    2995, 3259, 3521, 3773, 4026, 4271, 4509, 4749, 4973, 5204, 5415, 5632, 5836, 6036, 6230, 6413, 
-    6594, 6764, 6925, 7082, 7225, 7364, 7488, 7609, 7715, 7813, 7902, 7978, 8049, 8103, 8151, 8184, 
-    8212, 8224, 8230, 8217, 8200, 8167, 8129, 8072, 8011, 7931, 7852, 7751, 7646, 7530, 7398, 7269, 
-    7113, 6968, 6794, 6627, 6441, 6254, 6056, 5850, 5640, 5420, 5194, 4960, 4725, 4482, 4230, 3977, 
-    3713, 3457, 3179, 2911, 2627, 2349, 2056, 1770, 1468, 1176, 867, 564, 250, -54, -378, -690, 
-    -1014, -1334, -1655, -1986, -2301, -2635, -2950, -3282, -3598, -3918, -4235, -4546, -4858, -5163, -5459, -5760, 
-    -6041, -6329, -6597, -6873, -7124, -7383, -7619, -7857, -8080, -8294, -8502, -8694, -8883, -9051, -9219, -9362, 
-    -9510, -9630, -9749, -9847, -9934, -10013, -10066, -10121, -10142, -10165, -10161, -10149, -10119, -10071, -10012, -9934, 
-    -9842, -9738, -9613, -9484, -9328, -9175, -8991, -8814, -8610, -8409, -8184, -7964, -7723, -7487, -7229, -6974, 
-    -6707, -6435, -6157, -5872, -5579, -5284, -4978, -4670, -4353, -4033, -3706, -3372, -3037, -2690, -2344, -1985, 
-    -1634, -1269, -905, -534, -163, 204, 582, 950, 1329, 1694, 2068, 2429, 2795, 3148, 3504, 3846, 
-    4189, 4519, 4844, 5163, 5470, 5776, 6066, 6353, 6630, 6900, 7159, 7417, 7657, 7899, 8124, 8349, 
-    8562, 8767, 8962, 9153, 9326, 9501, 9652, 9806, 9938, 10064, 10177, 10273, 10362, 10428, 10492, 10527, 
-    10559, 10568, 10566, 10547, 10512, 10464, 10401, 10322, 10234, 10126, 10014, 9881, 9749, 9594, 9439, 9268, 
-    9092, 8913, 8713, 8523, 8310, 8107, 7882, 7664, 7432, 7199, 6958, 6707, 6461, 6192, 5933, 5653, 
-    5375, 5086, 4786, 4481, 4168, 3845, 3514, 3174, 2829, 2470, 2113, 1735, 1371, 978, 602, 202, 
-    -182, -581, -976, -1369, -1769, -2153, -2549, -2923, -3309, -3671, -4041, -4387, -4736, -5064, -5387, -5697, 
-    -5993, -6276, -6552, -6804, -7057, -7283, -7508, -7713, -7909, -8095, -8266, -8432, -8579, -8727, -8857, -8984, 
-    -9103, -9205, -9315, -9397, -9495, -9565, -9638, -9700, -9752, -9802, -9833, -9868, -9877, -9893, -9882, -9870, 
-    -9844, -9798, -9751, -9676, -9601, -9498, -9396, -9254, -9132, -8955, -8803, -8602, -8408, -8194, -7962, -7728, 
-    -7471, -7208, -6937, -6648, -6360, -6055, -5753, -5438, -5119, -4797, -4470, -4146, -3813, -3483, -3153, -2817, 
-    -2495, -2154, -1833, -1500, -1176, -852, -526, -205, 112, 432, 741, 1063, 1368, 1682, 1986, 2289, 
-    2594, 2891, 3189, 3481, 3769, 4055, 4334, 4609, 4881, 5139, 5403, 5645, 5893, 6120, 6350, 6562, 
-    6768, 6959, 7141, 7312, 7469, 7614, 7747, 7862, 7971, 8060, 8144, 8202, 8262, 8293, 8328, 8336, 
-    8344, 8331, 8316, 8281, 8247, 8193, 8137, 8071, 7994, 7917, 7823, 7731, 7626, 7519, 7402, 7282, 
-    7152, 7023, 6876, 6736, 6577, 6423, 6253, 6082, 5902, 5715, 5525, 5322, 5116, 4899, 4683, 4453, 
-    4222, 3977, 3735, 3483, 3227, 2964, 2702, 2430, 2161, 1884, 1608, 1330, 1049, 768, 487, 206, 
-    -78, -354, -642, -916, -1197, -1472, -1750, -2021, -2297, -2556, -2835, -3087, -3355, -3606, -3858, -4108, 
-    -4347, -4587, -4813, -5040, -5253, -5463, -5659, -5850, -6029, -6196, -6353, -6496, -6632, -6744, -6857, -6939, 
-    -7023, -7079, -7132, -7161, -7181, -7184, -7173, -7147, -7111, -7053, -6995, -6909, -6829, -6720, -6616, -6492, 
-    -6364, -6225, -6079, -5928, -5768, -5599, -5430, -5247, -5071, -4877, -4687, -4487, -4284, -4078, -3867, -3648, 
-    -3430, -3202, -2975, -2739, -2503, -2258, -2015, -1766, -1514, -1257, -1003, -742, -482, -222, 40, 296, 
-    560, 814, 1067, 1321, 1565, 1814, 2045, 2285, 2509, 2730, 2949, 3153, 3361, 3552, 3741, 3921, 
-    4099, 4259, 4426, 4570, 4721, 4856, 4984, 5108, 5220, 5330, 5424, 5523, 5598, 5681, 5742, 5807, 
-    5851, 5900, 5928, 5958, 5970, 5977, 5973, 5962, 5938, 5908, 5861, 5813, 5748, 5677, 5595, 5501, 
-    5399, 5290, 5167, 5039, 4901, 4755, 4605, 4442, 4276, 4106, 3923, 3749, 3555, 3367, 3173, 2972, 
-    2782, 2575, 2377, 2175, 1967, 1770, 1559, 1363, 1149, 950, 740, 536, 327, 115, -91, -308, 
-    -518, -738, -951, -1174, -1393, -1616, -1837, -2063, -2284, -2509, -2731, -2954, -3175, -3393, -3607, -3820, 
-    -4032, -4233, -4434, -4626, -4814, -4997, -5166, -5336, -5491, -5647, -5783, -5920, -6040, -6158, -6263, -6358, 
-    -6446, -6524, -6588, -6650, -6692, -6736, -6763, -6782, -6791, -6790, -6783, -6762, -6733, -6692, -6644, -6584, 
-    -6515, -6436, -6344, -6247, -6133, -6020, -5881, -5747, -5594, -5432, -5266, -5082, -4896, -4698, -4486, -4278, 
-    -4048, -3824, -3578, -3335, -3083, -2823, -2559, -2288, -2013, -1734, -1449, -1162, -870, -577, -284, 18, 
-    311, 619, 914, 1218, 1521, 1822, 2124, 2425, 2718, 3023, 3309, 3607, 3889, 4179, 4456, 4732, 
-    5000, 5263, 5522, 5767, 6009, 6241, 6461, 6675, 6874, 7066, 7243, 7410, 7559, 7706, 7825, 7947, 
-    8038, 8133, 8200, 8265, 8308, 8347, 8367, 8381, 8380, 8372, 8352, 8323, 8286, 8242, 8188, 8129, 
-    8063, 7988, 7915, 7822, 7737, 7636, 7533, 7423, 7301, 7179, 7043, 6904, 6749, 6594, 6421, 6243, 
-    6051, 5854, 5640, 5423, 5186, 4948, 4694, 4428, 4162, 3875, 3589, 3291, 2986, 2681, 2362, 2049, 
-    1725, 1408, 1082, 760, 440, 118, -193, -513, -816, -1128, -1425, -1723, -2016, -2302, -2586, -2860, 
-    -3138, -3402, -3671, -3926, -4187, -4441, -4692, -4941, -5187, -5430, -5673, -5912, -6153, -6384, -6621, -6846, 
-    -7077, -7299, -7515, -7729, -7934, -8133, -8328, -8504, -8684, -8843, -8997, -9134, -9265, -9375, -9478, -9557, 
-    -9634, -9683, -9724, -9744, -9755, -9743, -9720, -9677, -9622, -9550, -9464, -9370, -9248, -9133, -8985, -8845, 
-    -8678, -8514, -8327, -8146, -7938, -7741, -7519, -7301, -7069, -6831, -6588, -6335, -6072, -5809, -5532, -5251, 
-    -4964, -4662, -4368, -4048, -3741, -3412, -3088, -2752, -2413, -2072, -1720, -1374, -1015, -665, -304, 51, 
-    409, 768, 1120, 1476, 1826, 2171, 2517, 2850, 3185, 3510, 3831, 4142, 4449, 4748, 5037, 5323, 
-    5596, 5867, 6124, 6378, 6620, 6857, 7083, 7304, 7515, 7715, 7912, 8094, 8274, 8437, 8597, 8744, 
-    8882, 9013, 9129, 9240, 9334, 9424, 9496, 9563, 9613, 9656, 9682, 9703, 9699, 9701, 9670, 9649, 
-    9592, 9546, 9468, 9395, 9298, 9200, 9082, 8965, 8824, 8689, 8528, 8378, 8198, 8028, 7838, 7646, 
-    7445, 7230, 7024, 6787, 6569, 6317, 6085, 5819, 5573, 5297, 5033, 4750, 4471, 4178, 3889, 3587, 
-    3289, 2977, 2671, 2360, 2043, 1732, 1410, 1097, 779, 461, 149, -166, -478, -787, -1102, -1399, 
-    -1708, -2006, -2304, -2602, -2884, -3181, -3460, -3742, -4019, -4291, -4562, -4822, -5085, -5337, -5588, -5831, 
-    -6064, -6298, -6515, -6736, -6934, -7140, -7316, -7501, -7661, -7820, -7962, -8091, -8211, -8314, -8410, -8484, 
-    -8553, -8604, -8643, -8670, -8681, -8682, -8668, -8643, -8608, -8558, -8501, -8425, -8352, -8255, -8162, -8049, 
-    -7937, -7809, -7677, -7538, -7393, -7239, -7076, -6913, -6733, -6563, -6364, -6182, -5976, -5774, -5561, -5341, 
-    -5119, -4885, -4652, -4406, -4163, -3904, -3651, -3384, -3122, -2845, -2576, -2296, -2019, -1739, -1453, -1177, 
-    -892, -614, -334, -57, 212, 485, 748, 1012, 1263, 1519, 1756, 1997, 2227, 2450, 2668, 2873, 
-    3075, 3268, 3453, 3631, 3798, 3959, 4113, 4260, 4400, 4530, 4654, 4774, 4885, 4988, 5092, 5179, 
-    5276, 5352, 5435, 5505, 5575, 5639, 5700, 5753, 5803, 5849, 5890, 5928, 5959, 5982, 6008, 6014, 
-    6031, 6022, 6025, 6004, 5988, 5953, 5917, 5867, 5812, 5745, 5669, 5584, 5491, 5386, 5274, 5152, 
-    5023, 4888, 4741, 4590, 4432, 4268, 4099, 3924, 3748, 3564, 3379, 3195, 3002, 2813, 2616, 2425, 
-    2227, 2039, 1834, 1648, 1443, 1255, 1058, 864, 670, 475, 287, 97, -96, -277, -472, -646, 
-    -838, -1006, -1191, -1358, -1530, -1695, -1850, -2015, -2156, -2308, -2443, -2576, -2706, -2822, -2939, -3041, 
-    -3142, -3229, -3314, -3387, -3456, -3513, -3563, -3607, -3637, -3665, -3681, -3687, -3691, -3675, -3669, -3637, 
-    -3610, -3570, -3522, -3475, -3411, -3352, -3278, -3207, -3127, -3041, -2957, -2861, -2772, -2668, -2572, -2463, 
-    -2361, -2245, -2139, -2020, -1906, -1785, -1662, -1537, -1414, -1278, -1155, -1016, -882, -750, -604, -477, 
-    -329, -198, -52, 75, 223, 344, 487, 609, 739, 863, 977, 1098, 1205, 1313, 1415, 1513, 
-    1605, 1701, 1777, 1869, 1937, 2022, 2085, 2158, 2226, 2284, 2352, 2401, 2468, 2513, 2568, 2611, 
-    2660, 2698, 2735, 2768, 2792, 2819, 2832, 2847, 2844, 2847, 2832, 2818, 2794, 2755, 2722, 2668, 
-    2614, 2551, 2479, 2402, 2316, 2222, 2128, 2018, 1911, 1791, 1670, 1545, 1408, 1275, 1128, 982, 
-    834, 676, 520, 353, 193, 20, -146, -323, -493, -674, -849, -1026, -1202, -1381, -1552, -1726, 
-    -1893, -2062, -2218, -2379, -2529, -2678, -2817, -2950, -3084, -3198, -3323, -3423, -3534, -3622, -3718, -3797, 
-    -3880, -3946, -4015, -4077, -4132, -4184, -4230, -4271, -4309, -4339, -4371, -4388, -4416, -4416, -4438, -4432, 
-    -4437, -4426, -4415, -4397, -4372, -4342, -4307, -4263, -4214, -4158, -4097, -4028, -3948, -3873, -3778, -3692, 
-    -3586, -3482, -3371, -3252, -3135, -3005, -2873, -2740, -2597, -2456, -2304, -2155, -1996, -1839, -1672, -1507, 
-    -1337, -1163, -986, -803, -624, -432, -247, -50, 143, 339, 549, 740, 962, 1152, 1381, 1575, 
-    1803, 2006, 2228, 2440, 2657, 2869, 3088, 3294, 3510, 3715, 3923, 4125, 4323, 4519, 4711, 4898, 
-    5076, 5256, 5423, 5592, 5746, 5901, 6044, 6181, 6314, 6435, 6550, 6656, 6755, 6845, 6925, 6998, 
-    7059, 7117, 7156, 7196, 7218, 7237, 7240, 7239, 7221, 7201, 7162, 7120, 7063, 6996, 6922, 6831, 
-    6742, 6628, 6517, 6389, 6257, 6114, 5964, 5804, 5641, 5465, 5290, 5104, 4918, 4723, 4523, 4326, 
-    4115, 3916, 3700, 3489, 3276, 3058, 2844, 2619, 2401, 2176, 1953, 1723, 1497, 1262, 1032, 792, 
-    556, 310, 68, -185, -431, -690, -944, -1205, -1467, -1727, -1996, -2254, -2522, -2784, -3045, -3305, 
-    -3561, -3812, -4064, -4304, -4545, -4775, -5003, -5224, -5435, -5643, -5839, -6033, -6218, -6391, -6564, -6721, 
-    -6881, -7025, -7165, -7297, -7424, -7539, -7652, -7749, -7851, -7929, -8014, -8077, -8140, -8191, -8229, -8261, 
-    -8281, -8288, -8286, -8270, -8244, -8207, -8156, -8090, -8019, -7928, -7832, -7719, -7598, -7463, -7320, -7165, 
-    -7002, -6829, -6646, -6457, -6262, -6055, -5849, -5629, -5410, -5181, -4951, -4714, -4474, -4229, -3983, -3731, 
-    -3477, -3218, -2958, -2694, -2426, -2160, -1885, -1613, -1330, -1063, -772, -500, -207, 66, 355, 636, 
-    919, 1200, 1480, 1758, 2030, 2302, 2570, 2833, 3091, 3342, 3591, 3832, 4067, 4297, 4516, 4732, 
-    4936, 5138, 5327, 5513, 5685, 5852, 6012, 6158, 6307, 6430, 6566, 6672, 6788, 6882, 6978, 7060, 
-    7138, 7203, 7268, 7319, 7367, 7404, 7434, 7462, 7474, 7487, 7486, 7483, 7470, 7447, 7423, 7384, 
-    7344, 7291, 7233, 7165, 7089, 7006, 6913, 6812, 6701, 6580, 6455, 6314, 6173, 6014, 5853, 5679, 
-    5500, 5311, 5113, 4908, 4697, 4474, 4253, 4015, 3778, 3532, 3281, 3028, 2762, 2504, 2232, 1967, 
-    1690, 1417, 1141, 867, 591, 318, 44, -224, -497, -757, -1025, -1276, -1538, -1782, -2031, -2267, 
-    -2505, -2735, -2959, -3175, -3390, -3596, -3796, -3995, -4177, -4369, -4533, -4713, -4866, -5030, -5167, -5314, 
-    -5442, -5568, -5681, -5784, -5880, -5969, -6040, -6107, -6159, -6201, -6237, -6249, -6266, -6255, -6251, -6215, 
-    -6187, -6135, -6080, -6012, -5933, -5851, -5754, -5652, -5542, -5424, -5301, -5170, -5036, -4892, -4751, -4594, 
-    -4445, -4285, -4122, -3962, -3786, -3625, -3442, -3275, -3090, -2912, -2730, -2541, -2358, -2164, -1976, -1782, 
-    -1587, -1390, -1198, -994, -803, -598, -404, -205, -9, 185, 380, 575, 763, 954, 1137, 1324, 
-    1501, 1683, 1853, 2028, 2192, 2359, 2518, 2675, 2830, 2977, 3124, 3264, 3409, 3535, 3675, 3789, 
-    3924, 4032, 4150, 4253, 4359, 4452, 4547, 4626, 4709, 4776, 4845, 4894, 4946, 4981, 5016, 5033, 
-    5047, 5047, 5041, 5024, 4994, 4964, 4912, 4861, 4791, 4723, 4636, 4548, 4446, 4340, 4222, 4103, 
-    3968, 3839, 3685, 3545, 3378, 3227, 3050, 2886, 2699, 2522, 2331, 2140, 1942, 1740, 1537, 1326, 
-    1116, 898, 681, 461, 237, 11, -211, -439, -664, -892, -1117, -1340, -1561, -1782, -1994, -2210, 
-    -2412, -2617, -2812, -3003, -3186, -3365, -3533, -3701, -3851, -4005, -4142, -4279, -4401, -4522, -4634, -4737, 
-    -4832, -4921, -5007, -5079, -5151, -5208, -5270, -5314, -5362, -5397, -5425, -5453, -5465, -5481, -5482, -5479, 
-    -5468, -5452, -5423, -5394, -5344, -5302, -5233, -5173, -5086, -5007, -4904, -4802, -4686, -4563, -4429, -4289, 
-    -4139, -3985, -3819, -3649, -3475, -3291, -3107, -2913, -2719, -2524, -2320, -2122, -1911, -1712, -1501, -1295, 
-    -1086, -878, -673, -459, -255, -42, 165, 372, 592, 794, 1015, 1223, 1444, 1660, 1880, 2102, 
-    2326, 2548, 2777, 3004, 3234, 3462, 3692, 3918, 4152, 4373, 4598, 4822, 5036, 5255, 5458, 5664, 
-    5859, 6048, 6230, 6402, 6568, 6719, 6868, 6996, 7128, 7231, 7342, 7426, 7508, 7575, 7631, 7675, 
-    7711, 7728, 7745, 7738, 7732, 7706, 7673, 7628, 7575, 7507, 7433, 7342, 7251, 7141, 7026, 6900, 
-    6763, 6619, 6465, 6300, 6130, 5946, 5760, 5561, 5355, 5144, 4919, 4692, 4453, 4212, 3959, 3705, 
-    3433, 3172, 2885, 2611, 2315, 2024, 1723, 1422, 1112, 800, 484, 166, -153, -476, -798, -1122, 
-    -1448, -1765, -2093, -2401, -2725, -3025, -3339, -3632, -3927, -4211, -4490, -4759, -5020, -5267, -5515, -5743, 
-    -5971, -6181, -6386, -6581, -6765, -6945, -7109, -7274, -7421, -7570, -7703, -7837, -7956, -8078, -8178, -8292, 
-    -8376, -8476, -8549, -8632, -8692, -8757, -8805, -8850, -8884, -8907, -8926, -8927, -8925, -8909, -8884, -8845, 
-    -8795, -8738, -8665, -8580, -8486, -8378, -8264, -8130, -7992, -7840, -7676, -7505, -7320, -7128, -6924, -6713, 
-    -6489, -6264, -6016, -5777, -5519, -5257, -4988, -4709, -4429, -4137, -3844, -3541, -3235, -2923, -2608, -2284, 
-    -1964, -1629, -1302, -962, -627, -285, 54, 400, 741, 1088, 1432, 1780, 2119, 2466, 2801, 3147, 
-    3478, 3813, 4139, 4466, 4782, 5096, 5399, 5701, 5992, 6272, 6551, 6810, 7070, 7312, 7545, 7770, 
-    7976, 8183, 8364, 8543, 8703, 8857, 8992, 9124, 9230, 9342, 9422, 9510, 9571, 9633, 9674, 9708, 
-    9739, 9745, 9762, 9743, 9740, 9709, 9681, 9638, 9584, 9531, 9453, 9382, 9289, 9198, 9087, 8976, 
-    8844, 8718, 8563, 8418, 8244, 8076, 7884, 7692, 7484, 7269, 7042, 6804, 6558, 6299, 6034, 5758, 
-    5475, 5177, 4881, 4563, 4258, 3922, 3603, 3260, 2928, 2577, 2237, 1880, 1538, 1175, 832, 469, 
-    127, -229, -573, -920, -1261, -1597, -1934, -2261, -2586, -2906, -3220, -3528, -3834, -4127, -4425, -4708, 
-    -4992, -5264, -5536, -5797, -6058, -6307, -6552, -6794, -7018, -7252, -7457, -7674, -7867, -8061, -8237, -8409, 
-    -8566, -8715, -8850, -8970, -9084, -9177, -9266, -9330, -9389, -9431, -9456, -9474, -9467, -9460, -9427, -9390, 
-    -9333, -9273, -9189, -9107, -9001, -8893, -8774, -8642, -8508, -8352, -8206, -8037, -7873, -7688, -7510, -7315, 
-    -7120, -6916, -6706, -6493, -6268, -6046, -5811, -5576, -5330, -5084, -4830, -4573, -4308, -4045, -3768, -3500, 
-    -3214, -2939, -2647, -2367, -2069, -1784, -1480, -1192, -889, -592, -294, 10, 305, 611, 905, 1208, 
-    1504, 1800, 2096, 2385, 2677, 2961, 3244, 3521, 3795, 4063, 4326, 4581, 4832, 5070, 5310, 5531, 
-    5751, 5954, 6153, 6339, 6515, 6681, 6834, 6978, 7106, 7229, 7332, 7433, 7513, 7594, 7647, 7708, 
-    7740, 7780, 7796, 7810, 7814, 7801, 7793, 7762, 7736, 7688, 7645, 7585, 7524, 7448, 7371, 7280, 
-    7187, 7082, 6968, 6850, 6716, 6586, 6434, 6283, 6117, 5949, 5766, 5586, 5382, 5188, 4970, 4761, 
-    4537, 4308, 4078, 3834, 3602, 3349, 3110, 2852, 2610, 2350, 2104, 1848, 1600, 1347, 1098, 851, 
-    604, 363, 120, -119, -353, -590, -817, -1050, -1273, -1496, -1717, -1934, -2147, -2360, -2566, -2774, 
-    -2971, -3173, -3363, -3555, -3738, -3921, -4095, -4265, -4428, -4588, -4737, -4884, -5018, -5150, -5266, -5384, 
-    -5481, -5581, -5661, -5737, -5806, -5856, -5905, -5941, -5963, -5984, -5984, -5988, -5970, -5949, -5917, -5879, 
-    -5832, -5772, -5710, -5637, -5557, -5474, -5376, -5276, -5170, -5055, -4936, -4809, -4673, -4541, -4389, -4244, 
-    -4084, -3923, -3758, -3582, -3407, -3223, -3035, -2844, -2648, -2447, -2242, -2037, -1826, -1612, -1401, -1181, 
-    -969, -746, -530, -313, -95, 119, 335, 543, 760, 959, 1174, 1364, 1572, 1756, 1952, 2130, 
-    2316, 2482, 2657, 2814, 2973, 3124, 3265, 3405, 3528, 3660, 3768, 3884, 3978, 4075, 4162, 4235, 
-    4313, 4368, 4431, 4468, 4519, 4542, 4573, 4586, 4600, 4601, 4601, 4591, 4574, 4554, 4526, 4496, 
-    4454, 4414, 4364, 4312, 4253, 4190, 4126, 4048, 3977, 3891, 3807, 3715, 3616, 3518, 3404, 3298, 
-    3175, 3056, 2920, 2789, 2645, 2500, 2345, 2191, 2022, 1856, 1681, 1503, 1321, 1133, 945, 752, 
-    557, 362, 161, -30, -234, -427, -625, -820, -1009, -1202, -1387, -1571, -1750, -1929, -2096, -2270, 
-    -2427, -2592, -2744, -2894, -3042, -3180, -3320, -3448, -3579, -3700, -3819, -3933, -4042, -4148, -4248, -4343, 
-    -4431, -4519, -4594, -4669, -4734, -4797, -4846, -4895, -4928, -4964, -4980, -4997, -5003, -4994, -4989, -4961, 
-    -4936, -4894, -4848, -4793, -4727, -4656, -4576, -4486, -4392, -4289, -4179, -4063, -3940, -3810, -3677, -3534, 
-    -3393, -3237, -3090, -2921, -2770, -2592, -2428, -2253, -2073, -1899, -1709, -1530, -1338, -1150, -957, -761, 
-    -565, -366, -165, 36, 238, 445, 648, 859, 1061, 1271, 1478, 1687, 1896, 2099, 2306, 2511, 
-    2715, 2917, 3113, 3310, 3503, 3692, 3881, 4056, 4240, 4407, 4576, 4736, 4889, 5039, 5178, 5313, 
-    5440, 5558, 5670, 5774, 5869, 5957, 6035, 6108, 6169, 6225, 6268, 6310, 6335, 6363, 6367, 6380, 
-    6370, 6365, 6340, 6317, 6281, 6237, 6188, 6129, 6061, 5990, 5906, 5821, 5721, 5616, 5505, 5386, 
-    5259, 5122, 4982, 4832, 4674, 4513, 4337, 4168, 3976, 3793, 3593, 3393, 3187, 2974, 2759, 2536, 
-    2314, 2085, 1855, 1619, 1384, 1146, 909, 666, 426, 185, -55, -292, -533, -769, -1003, -1238, 
-    -1467, -1699, -1920, -2145, -2362, -2585, -2791, -3007, -3209, -3418, -3612, -3815, -4000, -4199, -4373, -4568, 
-    -4733, -4918, -5075, -5252, -5402, -5563, -5707, -5855, -5990, -6120, -6245, -6360, -6473, -6572, -6665, -6752, 
-    -6823, -6896, -6948, -6999, -7037, -7064, -7087, -7094, -7096, -7086, -7068, -7040, -7004, -6957, -6906, -6840, 
-    -6768, -6693, -6600, -6511, -6402, -6294, -6178, -6047, -5922, -5772, -5634, -5474, -5315, -5148, -4970, -4793, 
-    -4604, -4412, -4214, -4006, -3803, -3582, -3372, -3140, -2920, -2689, -2453, -2222, -1979, -1744, -1502, -1257, 
-    -1020, -769, -537, -282, -53, 200, 428, 674, 906, 1147, 1376, 1609, 1838, 2067, 2294, 2512, 
-    2737, 2951, 3168, 3377, 3587, 3787, 3990, 4180, 4373, 4556, 4733, 4909, 5066, 5235, 5377, 5528, 
-    5658, 5786, 5909, 6012, 6121, 6206, 6297, 6366, 6438, 6492, 6546, 6584, 6622, 6647, 6667, 6679, 
-    6683, 6686, 6670, 6668, 6634, 6619, 6576, 6545, 6495, 6444, 6384, 6320, 6247, 6168, 6081, 5987, 
-    5884, 5774, 5657, 5532, 5396, 5254, 5105, 4942, 4780, 4603, 4425, 4235, 4040, 3845, 3631, 3431, 
-    3209, 2997, 2774, 2552, 2327, 2104, 1876, 1654, 1427, 1203, 983, 763, 543, 327, 115, -98, 
-    -302, -514, -708, -916, -1107, -1306, -1494, -1685, -1868, -2052, -2231, -2407, -2580, -2748, -2915, -3079, 
-    -3233, -3391, -3536, -3683, -3825, -3952, -4090, -4203, -4331, -4431, -4545, -4636, -4730, -4814, -4888, -4963, 
-    -5020, -5082, -5122, -5169, -5196, -5228, -5240, -5256, -5258, -5257, -5246, -5230, -5212, -5175, -5148, -5099, 
-    -5056, -5002, -4941, -4882, -4805, -4737, -4651, -4572, -4475, -4389, -4281, -4185, -4071, -3963, -3844, -3728, 
-    -3598, -3479, -3339, -3214, -3070, -2935, -2787, -2647, -2492, -2348, -2191, -2039, -1882, -1723, -1567, -1402, 
-    -1247, -1079, -918, -755, -591, -430, -261, -103, 64, 221, 384, 543, 699, 858, 1010, 1163, 
-    1311, 1458, 1599, 1740, 1873, 2009, 2129, 2257, 2371, 2487, 2592, 2692, 2793, 2880, 2968, 3043, 
-    3120, 3184, 3247, 3303, 3350, 3397, 3430, 3468, 3491, 3513, 3530, 3539, 3547, 3546, 3542, 3534, 
-    3518, 3500, 3480, 3445, 3422, 3375, 3339, 3292, 3238, 3189, 3120, 3065, 2990, 2922, 2843, 2759, 
-    2681, 2584, 2502, 2397, 2305, 2199, 2097, 1993, 1881, 1770, 1663, 1543, 1438, 1317, 1206, 1090, 
-    975, 862, 745, 637, 521, 414, 300, 194, 89, -18, -117, -224, -318, -420, -512, -611, 
-    -698, -794, -875, -969, -1044, -1136, -1206, -1291, -1363, -1436, -1508, -1573, -1642, -1704, -1762, -1821, 
-    -1873, -1928, -1972, -2021, -2058, -2098, -2134, -2159, -2194, -2209, -2235, -2244, -2260, -2264, -2271, -2264, 
-    -2262, -2250, -2240, -2217, -2199, -2168, -2142, -2102, -2068, -2021, -1978, -1921, -1874, -1806, -1754, -1678, 
-    -1617, -1537, -1466, -1384, -1303, -1216, -1132, -1036, -949, -849, -758, -654, -560, -451, -355, -244, 
-    -147, -35, 66, 178, 278, 390, 494, 602, 710, 810, 917, 1022, 1123, 1224, 1321, 1423, 
-    1515, 1613, 1699, 1794, 1878, 1959, 2046, 2119, 2198, 2266, 2336, 2400, 2462, 2516, 2571, 2618, 
-    2665, 2701, 2741, 2767, 2797, 2815, 2833, 2843, 2849, 2848, 2845, 2831, 2818, 2790, 2768, 2727, 
-    2692, 2642, 2589, 2533, 2465, 2398, 2317, 2239, 2150, 2057, 1959, 1856, 1751, 1638, 1524, 1404, 
-    1283, 1160, 1027, 904, 766, 639, 501, 366, 229, 94, -43, -178, -317, -447, -589, -714, 
-    -854, -977, -1110, -1236, -1359, -1483, -1601, -1719, -1832, -1943, -2051, -2154, -2259, -2350, -2446, -2534, 
-    -2619, -2701, -2776, -2848, -2919, -2979, -3041, -3093, -3147, -3194, -3236, -3276, -3307, -3342, -3366, -3392, 
-    -3409, -3425, -3439, -3447, -3452, -3454, -3454, -3449, -3441, -3431, -3417, -3399, -3378, -3355, -3327, -3296, 
-    -3262, -3225, -3185, -3134, -3091, -3033, -2981, -2916, -2851, -2782, -2707, -2630, -2545, -2459, -2368, -2268, 
-    -2169, -2062, -1953, -1838, -1717, -1592, -1467, -1331, -1199, -1052, -914, -760, -618, -455, -308, -140, 
-    9, 181, 334, 510, 664, 838, 995, 1167, 1322, 1493, 1646, 1813, 1962, 2119, 2271, 2418, 
-    2565, 2702, 2844, 2973, 3106, 3228, 3353, 3465, 3583, 3683, 3794, 3882, 3987, 4065, 4158, 4227, 
-    4308, 4368, 4437, 4490, 4538, 4587, 4619, 4656, 4675, 4694, 4702, 4709, 4700, 4690, 4669, 4639, 
-    4608, 4560, 4515, 4451, 4392, 4315, 4239, 4153, 4061, 3966, 3861, 3754, 3643, 3526, 3403, 3282, 
-    3152, 3026, 2891, 2756, 2621, 2481, 2343, 2200, 2061, 1914, 1772, 1625, 1481, 1332, 1185, 1035, 
-    888, 738, 586, 435, 283, 132, -17, -174, -322, -475, -628, -774, -932, -1071, -1230, -1363, 
-    -1522, -1649, -1807, -1925, -2080, -2197, -2340, -2456, -2591, -2704, -2830, -2939, -3057, -3165, -3271, -3378, 
-    -3475, -3577, -3668, -3762, -3849, -3937, -4018, -4096, -4171, -4243, -4307, -4376, -4427, -4490, -4529, -4582, 
-    -4613, -4655, -4675, -4703, -4713, -4727, -4725, -4728, -4709, -4700, -4668, -4647, -4599, -4563, -4504, -4453, 
-    -4381, -4314, -4234, -4148, -4062, -3959, -3860, -3749, -3637, -3517, -3393, -3263, -3130, -2991, -2849, -2702, 
-    -2553, -2398, -2238, -2081, -1913, -1751, -1576, -1409, -1232, -1057, -882, -700, -524, -342, -164, 18, 
-    193, 378, 549, 730, 901, 1071, 1247, 1407, 1575, 1732, 1891, 2041, 2194, 2334, 2481, 2613, 
-    2751, 2872, 3006, 3117, 3243, 3344, 3462, 3557, 3660, 3755, 3842, 3931, 4005, 4088, 4151, 4225, 
-    4274, 4342, 4377, 4433, 4459, 4500, 4515, 4541, 4548, 4556, 4554, 4545, 4533, 4509, 4486, 4444, 
-    4414, 4359, 4312, 4250, 4187, 4120, 4041, 3965, 3879, 3791, 3696, 3598, 3499, 3394, 3285, 3170, 
-    3058, 2940, 2820, 2695, 2570, 2444, 2312, 2183, 2046, 1913, 1774, 1640, 1497, 1362, 1216, 1076, 
-    935, 788, 647, 500, 358, 211, 68, -78, -220, -367, -508, -653, -794, -936, -1075, -1216, 
-    -1352, -1490, -1622, -1758, -1887, -2019, -2142, -2272, -2388, -2514, -2627, -2746, -2850, -2965, -3063, -3173, 
-    -3262, -3364, -3447, -3538, -3616, -3696, -3769, -3833, -3900, -3956, -4011, -4055, -4099, -4133, -4165, -4190, 
-    -4203, -4225, -4219, -4232, -4215, -4210, -4188, -4165, -4134, -4099, -4057, -4010, -3951, -3900, -3827, -3766, 
-    -3682, -3605, -3520, -3428, -3332, -3233, -3125, -3019, -2901, -2785, -2663, -2534, -2409, -2269, -2137, -1994, 
-    -1849, -1707, -1554, -1404, -1251, -1091, -941, -773, -620, -454, -294, -129, 31, 198, 355, 524, 
-    681, 846, 1004, 1162, 1321, 1475, 1627, 1780, 1926, 2072, 2215, 2349, 2490, 2614, 2746, 2864, 
-    2983, 3097, 3201, 3308, 3400, 3497, 3576, 3663, 3731, 3806, 3860, 3923, 3968, 4014, 4052, 4082, 
-    4108, 4127, 4142, 4148, 4147, 4147, 4130, 4120, 4091, 4070, 4031, 3994, 3946, 3898, 3842, 3779, 
-    3715, 3636, 3567, 3475, 3398, 3296, 3205, 3102, 2997, 2889, 2773, 2662, 2535, 2419, 2289, 2166, 
-    2034, 1903, 1770, 1636, 1503, 1363, 1234, 1089, 959, 818, 686, 546, 411, 276, 143, 6, 
-    -124, -261, -390, -524, -655, -787, -915, -1048, -1170, -1308, -1421, -1563, -1671, -1807, -1920, -2043, 
-    -2161, -2275, -2386, -2502, -2605, -2712, -2812, -2910, -3008, -3096, -3183, -3268, -3345, -3421, -3489, -3554, 
-    -3617, -3669, -3724, -3763, -3808, -3841, -3871, -3892, -3914, -3920, -3936, -3925, -3933, -3910, -3905, -3872, 
-    -3856, -3813, -3783, -3730, -3691, -3625, -3577, -3502, -3441, -3361, -3284, -3201, -3113, -3023, -2927, -2825, 
-    -2727, -2617, -2511, -2394, -2283, -2162, -2043, -1921, -1792, -1670, -1538, -1407, -1279, -1139, -1011, -870, 
-    -738, -600, -463, -325, -187, -51, 84, 219, 358, 486, 626, 752, 888, 1009, 1141, 1262, 
-    1389, 1504, 1626, 1738, 1852, 1964, 2065, 2178, 2269, 2379, 2466, 2562, 2650, 2736, 2822, 2895, 
-    2979, 3041, 3121, 3176, 3245, 3299, 3354, 3404, 3447, 3494, 3522, 3563, 3584, 3612, 3627, 3642, 
-    3651, 3655, 3653, 3648, 3636, 3620, 3597, 3574, 3541, 3504, 3462, 3416, 3367, 3307, 3249, 3182, 
-    3112, 3040, 2959, 2877, 2792, 2699, 2608, 2511, 2412, 2311, 2203, 2097, 1989, 1878, 1765, 1650, 
-    1537, 1419, 1304, 1184, 1069, 946, 833, 704, 602, 
-};
-const unsigned int drum_v2_p1_long_len = 11753;
@@ -1,557 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v2_p3_long[] PROGMEM = {
-    76, -22, 33, 17, 42, 30, 41, 25, 30, 13, 10, -7, -12, -31, -42, -61, 
-    -71, -93, -107, -128, -144, -167, -185, -210, -230, -256, -278, -306, -329, -356, -381, -410, 
-    -432, -460, -483, -510, -531, -557, -577, -602, -620, -642, -661, -681, -697, -717, -733, -750, 
-    -766, -784, -799, -817, -833, -849, -864, -882, -897, -914, -931, -948, -964, -980, -996, -1012, 
-    -1025, -1041, -1052, -1065, -1075, -1085, -1092, -1099, -1104, -1106, -1107, -1109, -1106, -1101, -1098, -1091, 
-    -1083, -1074, -1062, -1051, -1037, -1024, -1006, -991, -971, -954, -931, -911, -886, -862, -836, -808, 
-    -776, -747, -717, -682, -647, -614, -578, -540, -504, -466, -427, -391, -352, -313, -277, -238, 
-    -201, -164, -127, -90, -54, -19, 14, 50, 85, 117, 151, 183, 216, 248, 281, 310, 
-    344, 375, 408, 439, 472, 505, 537, 570, 604, 636, 670, 702, 734, 766, 797, 826, 
-    856, 882, 907, 933, 955, 977, 997, 1015, 1032, 1048, 1062, 1077, 1088, 1101, 1112, 1122, 
-    1131, 1141, 1146, 1155, 1160, 1165, 1167, 1168, 1168, 1167, 1160, 1154, 1144, 1133, 1117, 1100, 
-    1080, 1059, 1032, 1007, 976, 946, 914, 878, 842, 807, 768, 729, 688, 649, 607, 564, 
-    519, 475, 428, 380, 329, 276, 223, 167, 109, 50, -11, -75, -139, -204, -272, -338, 
-    -407, -475, -543, -611, -679, -745, -813, -877, -940, -1002, -1064, -1121, -1178, -1233, -1287, -1337, 
-    -1385, -1432, -1476, -1517, -1556, -1593, -1629, -1661, -1690, -1719, -1744, -1766, -1786, -1804, -1818, -1829, 
-    -1837, -1843, -1843, -1843, -1837, -1827, -1817, -1799, -1778, -1755, -1726, -1694, -1658, -1617, -1573, -1527, 
-    -1476, -1421, -1363, -1304, -1238, -1171, -1101, -1029, -951, -874, -792, -709, -622, -535, -442, -351, 
-    -254, -158, -58, 40, 143, 244, 350, 454, 561, 668, 775, 883, 992, 1099, 1207, 1315, 
-    1420, 1527, 1632, 1735, 1836, 1937, 2034, 2129, 2220, 2310, 2395, 2476, 2554, 2629, 2697, 2762, 
-    2824, 2878, 2929, 2973, 3014, 3047, 3077, 3100, 3117, 3128, 3134, 3131, 3124, 3109, 3087, 3058, 
-    3023, 2980, 2930, 2875, 2809, 2739, 2662, 2577, 2485, 2389, 2283, 2173, 2056, 1935, 1805, 1673, 
-    1534, 1391, 1241, 1088, 931, 769, 604, 434, 262, 85, -92, -275, -459, -646, -835, -1026, 
-    -1218, -1412, -1608, -1803, -2000, -2196, -2392, -2586, -2781, -2972, -3163, -3350, -3537, -3718, -3897, -4072, 
-    -4244, -4413, -4577, -4736, -4893, -5042, -5189, -5330, -5468, -5596, -5724, -5842, -5956, -6062, -6163, -6252, 
-    -6337, -6410, -6477, -6530, -6574, -6605, -6627, -6631, -6627, -6605, -6573, -6521, -6460, -6377, -6284, -6172, 
-    -6046, -5902, -5745, -5569, -5379, -5171, -4950, -4711, -4457, -4186, -3903, -3600, -3286, -2956, -2613, -2254, 
-    -1886, -1501, -1108, -703, -288, 135, 565, 1004, 1446, 1894, 2343, 2796, 3246, 3698, 4145, 4592, 
-    5029, 5465, 5890, 6311, 6717, 7118, 7502, 7880, 8240, 8590, 8922, 9242, 9544, 9833, 10103, 10359, 
-    10595, 10817, 11019, 11206, 11374, 11526, 11659, 11778, 11877, 11960, 12026, 12076, 12107, 12125, 12124, 12108, 
-    12077, 12030, 11966, 11891, 11798, 11693, 11571, 11436, 11287, 11126, 10947, 10756, 10551, 10332, 10094, 9848, 
-    9580, 9299, 8999, 8684, 8346, 7995, 7617, 7224, 6805, 6365, 5900, 5417, 4901, 4369, 3807, 3223, 
-    2614, 1983, 1325, 649, -52, -771, -1512, -2269, -3047, -3837, -4645, -5461, -6293, -7128, -7978, -8825, 
-    -9679, -10530, -11383, -12224, -13064, -13885, -14699, -15488, -16262, -17005, -17728, -18413, -19070, -19685, -20267, -20802, 
-    -21297, -21742, -22146, -22497, -22804, -23059, -23269, -23428, -23544, -23612, -23642, -23626, -23577, -23487, -23372, -23219, 
-    -23048, -22845, -22626, -22383, -22127, -21846, -21557, -21242, -20916, -20564, -20196, -19795, -19376, -18916, -18431, -17903, 
-    -17344, -16737, -16102, -15416, -14706, -13954, -13184, -12383, -11578, -10757, -9947, -9134, -8349, -7571, -6830, -6100, 
-    -5409, -4721, -4059, -3383, -2711, -1990, -1243, -416, 479, 1491, 2600, 3858, 5235, 6780, 8453, 10333, 
-    12288, 14393, 16546, 18799, 21035, 23330, 25515, 27737, 29780, 31895, 32641, 32531, 32592, 32553, 32582, 32559, 
-    32577, 32564, 32574, 32565, 32573, 32567, 32571, 32568, 32570, 32570, 32568, 32569, 32568, 32571, 32565, 32570, 
-    32564, 32573, 32564, 32575, 32563, 32577, 32559, 32581, 32553, 32588, 32544, 32604, 32512, 32684, 31157, 28421, 
-    25946, 23294, 20759, 18150, 15677, 13173, 10805, 8497, 6373, 4327, 2485, 766, -758, -2211, -3542, -4858, 
-    -6092, -7324, -8530, -9798, -11062, -12387, -13708, -15122, -16602, -18191, -19799, -21478, -23148, -24863, -26529, -28244, 
-    -29869, -31553, -32598, -32627, -32635, -32628, -32634, -32629, -32631, -32630, -32630, -32630, -32629, -32630, -32629, -32632, 
-    -32629, -32630, -32629, -32633, -32628, -32633, -32630, -32632, -32629, -32632, -32630, -32631, -32630, -32631, -32627, -32630, 
-    -32629, -32631, -32631, -32631, -32630, -32631, -32630, -32631, -32631, -32630, -32630, -32630, -32631, -32628, -32633, -32628, 
-    -32633, -32635, -32498, -30192, -27358, -24611, -21741, -18911, -16040, -13250, -10490, -7846, -5248, -2750, -287, 2080, 
-    4404, 6635, 8835, 10965, 13074, 15104, 17114, 19051, 20986, 22866, 24771, 26643, 28560, 30435, 32302, 32619, 
-    32547, 32582, 32561, 32575, 32564, 32572, 32567, 32571, 32568, 32571, 32569, 32570, 32568, 32570, 32569, 32569, 
-    32569, 32570, 32569, 32569, 32570, 32570, 32569, 32569, 32570, 32569, 32569, 32569, 32569, 32568, 32569, 32569, 
-    32569, 32570, 32568, 32569, 32569, 32570, 32568, 32569, 32568, 32571, 32568, 32571, 32567, 32571, 32566, 32572, 
-    32566, 32573, 32565, 32574, 32573, 32442, 30222, 27083, 24039, 20859, 17709, 14488, 11271, 7992, 4735, 1456, 
-    -1768, -4985, -8120, -11204, -14180, -17083, -19855, -22544, -25100, -27577, -29949, -32136, -32673, -32615, -32641, -32624, 
-    -32635, -32629, -32633, -32629, -32632, -32630, -32631, -32630, -32630, -32630, -32630, -32631, -32630, -32630, -32630, -32632, 
-    -32631, -32630, -32630, -32631, -32629, -32630, -32630, -32632, -32631, -32631, -32631, -32631, -32630, -32629, -32631, -32630, 
-    -32631, -32629, -32633, -32630, -32632, -32630, -32633, -32628, -32632, -32628, -32634, -32626, -32635, -32623, -32637, -32623, 
-    -32642, -32617, -32648, -32605, -32667, -32572, -32751, -30758, -26410, -22242, -17839, -13570, -9172, -4913, -592, 3556, 
-    7732, 11722, 15728, 19513, 23320, 26839, 30493, 32557, 32550, 32583, 32561, 32575, 32566, 32571, 32568, 32569, 
-    32570, 32568, 32571, 32567, 32571, 32567, 32572, 32566, 32572, 32566, 32573, 32566, 32572, 32566, 32574, 32565, 
-    32574, 32565, 32574, 32564, 32575, 32564, 32575, 32564, 32575, 32563, 32576, 32563, 32576, 32562, 32575, 32561, 
-    32577, 32561, 32577, 32561, 32579, 32559, 32580, 32558, 32581, 32555, 32585, 32553, 32588, 32548, 32595, 32540, 
-    32604, 32524, 32631, 32472, 32767, 30395, 26064, 22144, 17873, 13778, 9487, 5339, 1070, -3038, -7212, -11206, 
-    -15248, -19081, -22977, -26590, -30398, -32603, -32607, -32649, -32617, -32642, -32623, -32638, -32625, -32636, -32626, -32635, 
-    -32628, -32633, -32628, -32634, -32629, -32632, -32629, -32634, -32628, -32633, -32629, -32634, -32628, -32634, -32628, -32634, 
-    -32628, -32632, -32626, -32632, -32626, -32634, -32628, -32633, -32626, -32634, -32628, -32635, -32626, -32635, -32625, -32633, 
-    -32625, -32634, -32625, -32635, -32623, -32637, -32624, -32637, -32620, -32639, -32620, -32643, -32618, -32645, -32614, -32650, 
-    -32603, -32667, -32575, -32745, -31915, -28304, -24747, -20979, -17235, -13365, -9529, -5628, -1800, 2036, 5762, 9461, 
-    13027, 16558, 19943, 23302, 26482, 29734, 32360, 32574, 32574, 32565, 32574, 32565, 32573, 32565, 32573, 32566, 
-    32572, 32567, 32572, 32566, 32572, 32566, 32572, 32565, 32572, 32565, 32571, 32564, 32573, 32564, 32572, 32565, 
-    32572, 32564, 32574, 32565, 32574, 32565, 32574, 32564, 32574, 32563, 32575, 32563, 32575, 32563, 32575, 32563, 
-    32576, 32561, 32577, 32561, 32578, 32558, 32581, 32556, 32581, 32554, 32587, 32549, 32592, 32543, 32599, 32528, 
-    32623, 32484, 32741, 31343, 27878, 24761, 21365, 18087, 14629, 11227, 7679, 4164, 525, -3087, -6802, -10482, 
-    -14253, -17972, -21773, -25465, -29303, -32309, -32667, -32618, -32636, -32626, -32635, -32625, -32633, -32627, -32633, -32628, 
-    -32631, -32627, -32632, -32629, -32632, -32628, -32631, -32629, -32632, -32631, -32632, -32631, -32632, -32631, -32631, -32630, 
-    -32629, -32631, -32630, -32633, -32629, -32633, -32629, -32633, -32627, -32633, -32627, -32634, -32625, -32636, -32626, -32636, 
-    -32624, -32639, -32623, -32640, -32620, -32643, -32618, -32647, -32613, -32654, -32602, -32670, -32569, -32748, -30938, -27358, 
-    -23954, -20364, -16849, -13228, -9655, -6022, -2439, 1151, 4681, 8173, 11596, 14945, 18229, 21394, 24515, 27443, 
-    30455, 32531, 32535, 32598, 32544, 32590, 32550, 32585, 32555, 32584, 32555, 32582, 32557, 32580, 32558, 32579, 
-    32559, 32578, 32559, 32577, 32559, 32577, 32561, 32577, 32562, 32575, 32563, 32576, 32562, 32574, 32562, 32575, 
-    32563, 32575, 32564, 32574, 32563, 32574, 32565, 32574, 32563, 32573, 32565, 32574, 32565, 32573, 32566, 32573, 
-    32567, 32571, 32567, 32572, 32568, 32569, 32570, 32569, 32569, 32574, 32481, 29637, 26086, 22754, 19341, 16058, 
-    12735, 9514, 6247, 3061, -175, -3352, -6590, -9778, -13036, -16242, -19507, -22694, -25924, -29039, -32104, -32691, 
-    -32607, -32643, -32624, -32636, -32629, -32630, -32631, -32630, -32632, -32628, -32635, -32627, -32632, -32626, -32633, -32625, 
-    -32635, -32626, -32635, -32627, -32635, -32626, -32636, -32625, -32637, -32625, -32637, -32624, -32637, -32624, -32637, -32623, 
-    -32638, -32623, -32638, -32624, -32638, -32623, -32638, -32624, -32639, -32622, -32639, -32621, -32640, -32621, -32641, -32619, 
-    -32643, -32618, -32644, -32615, -32648, -32610, -32656, -32600, -32651, -30509, -27487, -24540, -21437, -18313, -15100, -11846, 
-    -8536, -5183, -1801, 1635, 5087, 8605, 12117, 15703, 19235, 22861, 26346, 30062, 32492, 32547, 32591, 32551, 
-    32583, 32556, 32580, 32559, 32577, 32561, 32576, 32564, 32574, 32564, 32573, 32564, 32572, 32564, 32573, 32566, 
-    32572, 32565, 32572, 32567, 32571, 32567, 32572, 32566, 32570, 32568, 32569, 32567, 32568, 32568, 32569, 32569, 
-    32569, 32569, 32569, 32568, 32566, 32572, 32562, 32591, 32321, 30716, 28874, 27079, 25282, 23521, 21782, 20083, 
-    18417, 16789, 15190, 13614, 12050, 10488, 8919, 7324, 5690, 4004, 2248, 416, -1503, -3510, -5610, -7789, 
-    -10057, -12390, -14800, -17256, -19764, -22297, -24852, -27383, -29931, -32236, -32665, -32615, -32639, -32625, -32635, -32626, 
-    -32636, -32626, -32634, -32627, -32634, -32627, -32633, -32625, -32632, -32625, -32633, -32628, -32634, -32627, -32635, -32626, 
-    -32635, -32626, -32634, -32625, -32635, -32625, -32637, -32623, -32638, -32620, -32641, -32616, -32650, -32600, -32687, -31852, 
-    -29606, -27379, -25092, -22841, -20565, -18322, -16077, -13873, -11685, -9546, -7440, -5389, -3384, -1445, 434, 2247, 
-    3990, 5662, 7255, 8776, 10224, 11609, 12933, 14215, 15451, 16670, 17862, 19058, 20240, 21448, 22652, 23901, 
-    25143, 26439, 27713, 29059, 30340, 31756, 32626, 32539, 32590, 32554, 32582, 32557, 32577, 32560, 32576, 32563, 
-    32575, 32563, 32574, 32564, 32575, 32565, 32573, 32565, 32573, 32564, 32573, 32565, 32573, 32565, 32574, 32563, 
-    32577, 32559, 32590, 32351, 31352, 30235, 29042, 27753, 26364, 24867, 23259, 21538, 19717, 17796, 15790, 13706, 
-    11571, 9395, 7205, 5020, 2870, 761, -1281, -3248, -5120, -6902, -8578, -10157, -11640, -13042, -14372, -15647, 
-    -16875, -18076, -19256, -20425, -21590, -22753, -23914, -25069, -26220, -27356, -28470, -29550, -30588, -31574, -32443, -32653, 
-    -32620, -32637, -32625, -32634, -32627, -32633, -32627, -32632, -32628, -32633, -32628, -32633, -32630, -32632, -32629, -32633, 
-    -32630, -32632, -32630, -32632, -32633, -32571, -31955, -31186, -30371, -29473, -28504, -27451, -26312, -25088, -23774, -22375, 
-    -20892, -19332, -17699, -16008, -14268, -12497, -10700, -8895, -7086, -5291, -3515, -1770, -57, 1613, 3249, 4844, 
-    6405, 7927, 9418, 10877, 12310, 13720, 15107, 16472, 17811, 19119, 20395, 21629, 22818, 23954, 25031, 26044, 
-    26990, 27858, 28650, 29361, 29989, 30535, 30998, 31381, 31689, 31922, 32083, 32180, 32212, 32184, 32095, 31950, 
-    31751, 31501, 31208, 30870, 30490, 30064, 29600, 29094, 28553, 27972, 27365, 26725, 26061, 25371, 24660, 23924, 
-    23170, 22389, 21587, 20756, 19895, 19000, 18075, 17111, 16108, 15069, 13990, 12868, 11706, 10497, 9243, 7946, 
-    6604, 5216, 3793, 2335, 844, -667, -2197, -3739, -5284, -6825, -8352, -9856, -11329, -12759, -14141, -15469, 
-    -16734, -17933, -19065, -20124, -21114, -22034, -22886, -23674, -24406, -25086, -25716, -26305, -26851, -27362, -27832, -28268, 
-    -28660, -29008, -29299, -29535, -29700, -29794, -29804, -29730, -29566, -29311, -28967, -28540, -28038, -27465, -26837, -26159, 
-    -25444, -24704, -23953, -23198, -22455, -21728, -21024, -20342, -19686, -19047, -18423, -17801, -17178, -16530, -15855, -15137, 
-    -14370, -13538, -12644, -11673, -10633, -9523, -8354, -7131, -5864, -4563, -3241, -1907, -575, 742, 2038, 3296, 
-    4511, 5679, 6797, 7865, 8886, 9861, 10791, 11681, 12534, 13353, 14140, 14904, 15645, 16366, 17070, 17759, 
-    18430, 19083, 19716, 20324, 20908, 21468, 21999, 22499, 22960, 23375, 23738, 24038, 24276, 24438, 24526, 24534, 
-    24460, 24307, 24079, 23774, 23402, 22968, 22481, 21945, 21366, 20754, 20111, 19443, 18755, 18055, 17346, 16637, 
-    15930, 15226, 14525, 13832, 13141, 12457, 11778, 11100, 10430, 9763, 9101, 8444, 7798, 7153, 6519, 5892, 
-    5274, 4657, 4046, 3432, 2819, 2201, 1581, 952, 321, -322, -973, -1632, -2295, -2967, -3640, -4320, 
-    -5001, -5689, -6376, -7066, -7756, -8451, -9143, -9834, -10519, -11196, -11858, -12505, -13130, -13728, -14293, -14822, 
-    -15302, -15738, -16118, -16444, -16710, -16923, -17075, -17176, -17221, -17220, -17171, -17086, -16962, -16810, -16631, -16434, 
-    -16220, -15997, -15765, -15523, -15272, -15014, -14741, -14450, -14136, -13790, -13408, -12985, -12518, -12007, -11457, -10868, 
-    -10249, -9606, -8946, -8278, -7609, -6950, -6310, -5702, -5133, -4611, -4143, -3732, -3386, -3101, -2875, -2706, 
-    -2589, -2510, -2464, -2438, -2420, -2399, -2363, -2306, -2217, -2094, -1932, -1730, -1485, -1202, -882, -524, 
-    -139, 269, 697, 1144, 1600, 2064, 2532, 2999, 3463, 3919, 4369, 4809, 5247, 5677, 6108, 6538, 
-    6973, 7409, 7853, 8298, 8746, 9191, 9627, 10052, 10456, 10831, 11171, 11465, 11707, 11893, 12013, 12067, 
-    12054, 11979, 11838, 11643, 11396, 11112, 10797, 10467, 10125, 9790, 9466, 9166, 8895, 8663, 8470, 8324, 
-    8219, 8161, 8142, 8158, 8197, 8256, 8320, 8382, 8429, 8454, 8447, 8401, 8313, 8173, 7980, 7738, 
-    7441, 7099, 6712, 6287, 5830, 5348, 4849, 4340, 3827, 3325, 2838, 2378, 1951, 1561, 1214, 910, 
-    653, 438, 262, 118, 0, -101, -191, -279, -368, -473, -598, -748, -929, -1144, -1393, -1678, 
-    -1993, -2337, -2704, -3087, -3474, -3858, -4231, -4581, -4903, -5193, -5441, -5651, -5821, -5952, -6045, -6108, 
-    -6145, -6167, -6179, -6191, -6211, -6247, -6299, -6378, -6481, -6612, -6771, -6957, -7166, -7394, -7634, -7880, 
-    -8126, -8362, -8582, -8779, -8950, -9086, -9186, -9246, -9270, -9259, -9220, -9153, -9070, -8972, -8865, -8759, 
-    -8651, -8549, -8457, -8375, -8307, -8255, -8213, -8183, -8164, -8153, -8147, -8144, -8140, -8131, -8111, -8081, 
-    -8033, -7968, -7883, -7776, -7642, -7479, -7285, -7059, -6796, -6501, -6168, -5800, -5397, -4962, -4496, -4001, 
-    -3477, -2930, -2365, -1785, -1194, -599, -4, 583, 1158, 1716, 2253, 2765, 3251, 3709, 4140, 4544, 
-    4926, 5288, 5635, 5970, 6299, 6626, 6956, 7288, 7628, 7973, 8324, 8680, 9041, 9400, 9754, 10104, 
-    10446, 10776, 11092, 11393, 11680, 11947, 12198, 12431, 12647, 12849, 13042, 13224, 13396, 13563, 13722, 13874, 
-    14018, 14154, 14275, 14380, 14462, 14512, 14531, 14507, 14445, 14333, 14172, 13952, 13679, 13343, 12953, 12504, 
-    12004, 11452, 10854, 10214, 9536, 8825, 8092, 7338, 6569, 5794, 5018, 4250, 3494, 2752, 2029, 1331, 
-    652, 3, -620, -1214, -1780, -2314, -2820, -3296, -3740, -4155, -4543, -4903, -5238, -5552, -5848, -6127, 
-    -6392, -6646, -6886, -7118, -7338, -7550, -7750, -7941, -8114, -8281, -8430, -8571, -8697, -8815, -8918, -9017, 
-    -9104, -9192, -9274, -9357, -9441, -9528, -9617, -9718, -9819, -9928, -10040, -10156, -10270, -10384, -10490, -10590, 
-    -10678, -10756, -10815, -10860, -10881, -10885, -10866, -10827, -10767, -10690, -10591, -10480, -10352, -10210, -10057, -9891, 
-    -9716, -9532, -9339, -9137, -8928, -8706, -8474, -8226, -7964, -7682, -7387, -7071, -6735, -6372, -5983, -5565, 
-    -5121, -4648, -4146, -3622, -3076, -2515, -1943, -1360, -778, -201, 365, 914, 1440, 1936, 2396, 2819, 
-    3201, 3539, 3835, 4086, 4294, 4465, 4599, 4701, 4780, 4838, 4883, 4921, 4962, 5005, 5059, 5126, 
-    5209, 5308, 5428, 5565, 5725, 5897, 6084, 6280, 6483, 6684, 6885, 7080, 7266, 7445, 7614, 7774, 
-    7922, 8060, 8186, 8308, 8421, 8534, 8645, 8763, 8884, 9019, 9165, 9323, 9495, 9682, 9880, 10089, 
-    10304, 10519, 10728, 10930, 11114, 11275, 11408, 11510, 11569, 11591, 11567, 11493, 11369, 11200, 10981, 10717, 
-    10410, 10065, 9682, 9268, 8824, 8358, 7869, 7363, 6846, 6320, 5788, 5255, 4725, 4199, 3684, 3183, 
-    2700, 2237, 1799, 1386, 1003, 649, 327, 38, -219, -446, -642, -815, -962, -1095, -1216, -1334, 
-    -1452, -1577, -1715, -1870, -2041, -2238, -2459, -2711, -2992, -3301, -3638, -4000, -4385, -4792, -5214, -5650, 
-    -6097, -6549, -7005, -7463, -7920, -8371, -8817, -9260, -9695, -10122, -10540, -10948, -11344, -11723, -12084, -12422, 
-    -12737, -13022, -13278, -13501, -13688, -13836, -13949, -14024, -14063, -14068, -14042, -13983, -13897, -13781, -13642, -13479, 
-    -13297, -13097, -12879, -12647, -12403, -12144, -11876, -11599, -11315, -11026, -10736, -10443, -10152, -9862, -9577, -9296, 
-    -9021, -8752, -8492, -8242, -7997, -7757, -7525, -7295, -7064, -6830, -6591, -6341, -6075, -5793, -5491, -5165, 
-    -4815, -4439, -4035, -3603, -3140, -2646, -2125, -1571, -990, -379, 259, 928, 1619, 2338, 3074, 3831, 
-    4604, 5389, 6185, 6988, 7793, 8594, 9389, 10174, 10948, 11703, 12444, 13162, 13858, 14531, 15180, 15805, 
-    16406, 16981, 17538, 18065, 18570, 19051, 19507, 19934, 20340, 20715, 21065, 21383, 21675, 21932, 22157, 22344, 
-    22494, 22601, 22665, 22679, 22646, 22558, 22417, 22221, 21967, 21652, 21277, 20844, 20355, 19807, 19210, 18563, 
-    17871, 17143, 16384, 15596, 14791, 13970, 13139, 12303, 11465, 10628, 9793, 8963, 8135, 7313, 6491, 5670, 
-    4853, 4033, 3211, 2386, 1553, 715, -132, -988, -1859, -2740, -3640, -4553, -5489, -6440, -7415, -8406, 
-    -9421, -10449, -11494, -12548, -13609, -14671, -15726, -16773, -17796, -18795, -19758, -20686, -21564, -22394, -23168, -23889, 
-    -24553, -25157, -25702, -26195, -26633, -27024, -27372, -27681, -27950, -28186, -28387, -28554, -28681, -28770, -28813, -28809, 
-    -28747, -28627, -28440, -28179, -27838, -27416, -26906, -26305, -25617, -24840, -23980, -23041, -22031, -20953, -19824, -18652, 
-    -17446, -16221, -14989, -13757, -12537, -11336, -10158, -9009, -7890, -6804, -5749, -4718, -3710, -2718, -1732, -745, 
-    246, 1254, 2279, 3333, 4413, 5527, 6671, 7847, 9048, 10272, 11507, 12747, 13979, 15196, 16386, 17541, 
-    18651, 19710, 20712, 21652, 22528, 23338, 24082, 24763, 25386, 25952, 26466, 26934, 27356, 27739, 28084, 28398, 
-    28677, 28928, 29147, 29337, 29495, 29615, 29697, 29734, 29721, 29652, 29526, 29330, 29070, 28736, 28331, 27847, 
-    27293, 26661, 25960, 25186, 24351, 23454, 22508, 21508, 20468, 19389, 18281, 17146, 15994, 14827, 13651, 12469, 
-    11289, 10108, 8929, 7753, 6580, 5409, 4239, 3066, 1892, 712, -478, -1677, -2888, -4113, -5352, -6601, 
-    -7864, -9135, -10411, -11686, -12957, -14218, -15462, -16681, -17867, -19018, -20125, -21176, -22171, -23100, -23962, -24752, 
-    -25471, -26112, -26682, -27177, -27605, -27964, -28262, -28501, -28687, -28818, -28905, -28943, -28940, -28894, -28811, -28689, 
-    -28535, -28341, -28118, -27856, -27560, -27225, -26854, -26434, -25972, -25462, -24902, -24291, -23630, -22915, -22144, -21320, 
-    -20438, -19499, -18501, -17446, -16334, -15170, -13956, -12696, -11396, -10062, -8700, -7319, -5927, -4529, -3134, -1747, 
-    -373, 982, 2312, 3619, 4888, 6126, 7327, 8491, 9609, 10690, 11732, 12734, 13698, 14631, 15527, 16395, 
-    17233, 18044, 18824, 19578, 20299, 20993, 21653, 22281, 22870, 23423, 23931, 24397, 24810, 25173, 25482, 25740, 
-    25938, 26087, 26179, 26221, 26210, 26154, 26048, 25900, 25709, 25479, 25212, 24907, 24567, 24192, 23780, 23329, 
-    22838, 22303, 21721, 21090, 20406, 19666, 18871, 18015, 17103, 16134, 15106, 14025, 12895, 11718, 10500, 9247, 
-    7963, 6654, 5326, 3983, 2629, 1272, -81, -1433, -2775, -4102, -5414, -6706, -7975, -9222, -10440, -11628, 
-    -12784, -13904, -14985, -16023, -17016, -17955, -18840, -19664, -20425, -21119, -21742, -22292, -22770, -23177, -23508, -23771, 
-    -23968, -24105, -24182, -24206, -24182, -24111, -24002, -23856, -23680, -23477, -23248, -22992, -22714, -22409, -22074, -21707, 
-    -21304, -20860, -20371, -19831, -19235, -18583, -17870, -17094, -16262, -15374, -14432, -13445, -12417, -11355, -10264, -9154, 
-    -8031, -6901, -5771, -4648, -3536, -2441, -1361, -304, 731, 1745, 2738, 3712, 4670, 5613, 6545, 7468, 
-    8382, 9290, 10185, 11076, 11954, 12815, 13659, 14486, 15283, 16054, 16790, 17490, 18148, 18761, 19325, 19838, 
-    20296, 20698, 21041, 21326, 21552, 21720, 21829, 21881, 21881, 21827, 21723, 21570, 21373, 21129, 20842, 20516, 
-    20154, 19755, 19322, 18854, 18353, 17817, 17250, 16647, 16012, 15346, 14644, 13909, 13142, 12341, 11507, 10643, 
-    9749, 8825, 7874, 6898, 5897, 4876, 3839, 2789, 1734, 674, -385, -1440, -2487, -3522, -4544, -5547, 
-    -6531, -7489, -8424, -9328, -10207, -11051, -11865, -12642, -13386, -14094, -14769, -15409, -16018, -16594, -17142, -17663, 
-    -18153, -18617, -19052, -19461, -19842, -20197, -20523, -20821, -21088, -21322, -21522, -21686, -21809, -21890, -21926, -21914, 
-    -21851, -21731, -21557, -21324, -21030, -20673, -20257, -19775, -19231, -18619, -17949, -17214, -16421, -15572, -14667, -13713, 
-    -12719, -11685, -10623, -9536, -8435, -7326, -6216, -5112, -4025, -2955, -1908, -886, 106, 1072, 2011, 2921, 
-    3806, 4671, 5516, 6348, 7169, 7983, 8790, 9592, 10391, 11181, 11964, 12735, 13488, 14219, 14925, 15599, 
-    16233, 16827, 17372, 17872, 18318, 18712, 19053, 19344, 19584, 19775, 19918, 20022, 20087, 20118, 20121, 20097, 
-    20051, 19984, 19900, 19800, 19686, 19560, 19421, 19270, 19105, 18926, 18729, 18512, 18275, 18010, 17717, 17390, 
-    17025, 16620, 16173, 15674, 15127, 14525, 13868, 13156, 12388, 11568, 10695, 9774, 8807, 7802, 6759, 5689, 
-    4594, 3484, 2364, 1240, 121, -989, -2084, -3161, -4216, -5243, -6241, -7209, -8144, -9045, -9911, -10743, 
-    -11540, -12299, -13026, -13719, -14377, -15003, -15600, -16165, -16701, -17210, -17690, -18141, -18564, -18958, -19320, -19648, 
-    -19944, -20201, -20423, -20607, -20752, -20857, -20920, -20943, -20921, -20855, -20742, -20584, -20378, -20130, -19838, -19505, 
-    -19134, -18727, -18285, -17810, -17305, -16767, -16200, -15605, -14983, -14332, -13659, -12966, -12255, -11528, -10792, -10046, 
-    -9294, -8537, -7778, -7018, -6259, -5502, -4744, -3989, -3236, -2483, -1729, -976, -223, 530, 1286, 2038, 
-    2792, 3542, 4287, 5023, 5748, 6458, 7153, 7828, 8480, 9111, 9715, 10292, 10841, 11362, 11855, 12321, 
-    12762, 13180, 13579, 13957, 14318, 14663, 14992, 15304, 15599, 15877, 16136, 16369, 16584, 16769, 16927, 17050, 
-    17143, 17193, 17207, 17175, 17105, 16984, 16822, 16610, 16355, 16051, 15708, 15323, 14904, 14453, 13979, 13481, 
-    12969, 12441, 11909, 11371, 10834, 10296, 9764, 9234, 8707, 8181, 7663, 7138, 6614, 6088, 5554, 5009, 
-    4461, 3895, 3321, 2731, 2131, 1519, 900, 270, -355, -982, -1599, -2206, -2794, -3363, -3905, -4423, 
-    -4911, -5368, -5794, -6190, -6555, -6892, -7198, -7479, -7736, -7969, -8183, -8379, -8557, -8719, -8869, -9004, 
-    -9124, -9233, -9327, -9404, -9467, -9513, -9539, -9550, -9545, -9520, -9483, -9432, -9372, -9300, -9226, -9145, 
-    -9065, -8980, -8896, -8809, -8722, -8631, -8540, -8443, -8343, -8238, -8126, -8005, -7878, -7743, -7597, -7444, 
-    -7283, -7117, -6942, -6764, -6580, -6396, -6208, -6022, -5834, -5650, -5465, -5285, -5106, -4929, -4755, -4583, 
-    -4409, -4236, -4059, -3879, -3693, -3500, -3298, -3089, -2871, -2643, -2406, -2160, -1903, -1638, -1366, -1083, 
-    -795, -502, -206, 92, 386, 680, 964, 1240, 1504, 1754, 1989, 2210, 2415, 2602, 2776, 2933, 
-    3076, 3204, 3323, 3431, 3533, 3628, 3722, 3812, 3901, 3991, 4082, 4174, 4267, 4363, 4460, 4559, 
-    4655, 4751, 4844, 4935, 5023, 5108, 5189, 5271, 5348, 5423, 5500, 5574, 5648, 5726, 5802, 5884, 
-    5971, 6065, 6167, 6278, 6402, 6537, 6683, 6844, 7015, 7197, 7386, 7577, 7771, 7957, 8137, 8307, 
-    8460, 8596, 8709, 8799, 8861, 8893, 8894, 8864, 8799, 8704, 8576, 8419, 8232, 8020, 7782, 7520, 
-    7236, 6935, 6617, 6285, 5940, 5584, 5220, 4844, 4463, 4075, 3683, 3285, 2887, 2484, 2085, 1682, 
-    1285, 891, 501, 117, -258, -630, -992, -1348, -1693, -2032, -2354, -2670, -2972, -3262, -3540, -3807, 
-    -4060, -4302, -4531, -4749, -4954, -5147, -5331, -5504, -5668, -5825, -5976, -6125, -6271, -6421, -6572, -6730, 
-    -6894, -7071, -7256, -7454, -7664, -7886, -8119, -8361, -8611, -8869, -9133, -9395, -9659, -9918, -10171, -10410, 
-    -10639, -10851, -11044, -11215, -11367, -11491, -11590, -11659, -11701, -11707, -11682, -11622, -11528, -11395, -11227, -11019, 
-    -10772, -10486, -10161, -9799, -9404, -8972, -8511, -8023, -7507, -6971, -6420, -5857, -5285, -4711, -4137, -3571, 
-    -3010, -2463, -1934, -1417, -916, -436, 31, 484, 922, 1350, 1767, 2179, 2585, 2989, 3390, 3791, 
-    4191, 4591, 4988, 5382, 5772, 6155, 6529, 6892, 7240, 7573, 7885, 8182, 8453, 8708, 8940, 9154, 
-    9349, 9530, 9697, 9856, 10005, 10153, 10295, 10441, 10584, 10732, 10880, 11029, 11178, 11327, 11473, 11614, 
-    11751, 11878, 11993, 12097, 12184, 12252, 12299, 12321, 12316, 12280, 12213, 12113, 11977, 11806, 11600, 11354, 
-    11073, 10753, 10397, 10002, 9575, 9111, 8620, 8096, 7551, 6980, 6394, 5789, 5176, 4549, 3918, 3282, 
-    2647, 2008, 1377, 751, 132, -474, -1070, -1650, -2214, -2759, -3283, -3784, -4261, -4712, -5138, -5533, 
-    -5900, -6239, -6546, -6823, -7069, -7286, -7476, -7639, -7775, -7891, -7988, -8065, -8129, -8180, -8222, -8256, 
-    -8285, -8308, -8330, -8347, -8363, -8375, -8386, -8393, -8396, -8394, -8388, -8373, -8348, -8316, -8271, -8213, 
-    -8137, -8049, -7939, -7814, -7670, -7510, -7331, -7142, -6935, -6724, -6503, -6280, -6053, -5835, -5616, -5406, 
-    -5204, -5013, -4830, -4659, -4496, -4341, -4192, -4047, -3901, -3756, -3605, -3446, -3275, -3092, -2893, -2674, 
-    -2438, -2181, -1906, -1615, -1309, -992, -668, -342, -17, 302, 613, 911, 1195, 1458, 1700, 1923, 
-    2119, 2291, 2441, 2568, 2670, 2755, 2819, 2866, 2898, 2916, 2922, 2919, 2905, 2885, 2858, 2825, 
-    2788, 2747, 2704, 2659, 2615, 2573, 2537, 2504, 2479, 2463, 2457, 2460, 2473, 2499, 2536, 2583, 
-    2641, 2710, 2785, 2869, 2957, 3050, 3145, 3242, 3334, 3427, 3510, 3592, 3664, 3731, 3789, 3846, 
-    3895, 3943, 3991, 4040, 4090, 4147, 4210, 4280, 4361, 4449, 4547, 4652, 4767, 4885, 5007, 5129, 
-    5248, 5358, 5463, 5553, 5628, 5686, 5726, 5744, 5744, 5722, 5684, 5628, 5557, 5469, 5373, 5263, 
-    5149, 5025, 4902, 4774, 4650, 4527, 4406, 4289, 4175, 4064, 3960, 3857, 3757, 3661, 3566, 3473, 
-    3378, 3283, 3185, 3084, 2977, 2863, 2743, 2613, 2474, 2322, 2159, 1980, 1788, 1581, 1357, 1116, 
-    860, 586, 293, -14, -339, -681, -1035, -1405, -1788, -2178, -2579, -2986, -3394, -3804, -4213, -4619, 
-    -5021, -5418, -5808, -6193, -6568, -6933, -7288, -7630, -7959, -8275, -8576, -8864, -9139, -9398, -9646, -9881, 
-    -10104, -10316, -10518, -10706, -10888, -11055, -11212, -11357, -11490, -11606, -11709, -11792, -11856, -11898, -11914, -11900, 
-    -11862, -11787, -11682, -11539, -11361, -11146, -10896, -10607, -10287, -9932, -9547, -9136, -8702, -8248, -7778, -7296, 
-    -6807, -6313, -5816, -5321, -4829, -4342, -3860, -3386, -2920, -2462, -2014, -1575, -1143, -721, -306, 102, 
-    506, 905, 1303, 1700, 2099, 2499, 2906, 3320, 3746, 4183, 4637, 5107, 5595, 6105, 6635, 7185, 
-    7752, 8336, 8934, 9540, 10153, 10767, 11376, 11976, 12562, 13129, 13675, 14193, 14683, 15139, 15563, 15949, 
-    16298, 16605, 16876, 17106, 17298, 17450, 17562, 17635, 17670, 17667, 17627, 17549, 17431, 17278, 17086, 16857, 
-    16590, 16287, 15949, 15578, 15172, 14740, 14274, 13781, 13260, 12712, 12137, 11536, 10910, 10261, 9583, 8885, 
-    8166, 7424, 6663, 5886, 5093, 4289, 3472, 2652, 1827, 1001, 179, -634, -1443, -2237, -3018, -3784, 
-    -4534, -5266, -5982, -6677, -7360, -8024, -8674, -9310, -9934, -10547, -11151, -11743, -12327, -12898, -13458, -14007, 
-    -14538, -15053, -15552, -16027, -16479, -16907, -17305, -17673, -18010, -18314, -18579, -18813, -19009, -19167, -19289, -19373, 
-    -19419, -19428, -19399, -19333, -19231, -19095, -18920, -18712, -18469, -18190, -17876, -17529, -17145, -16728, -16279, -15797, 
-    -15284, -14741, -14171, -13574, -12953, -12308, -11641, -10953, -10244, -9516, -8769, -8005, -7222, -6424, -5609, -4776, 
-    -3930, -3068, -2191, -1300, -400, 510, 1431, 2357, 3286, 4217, 5146, 6072, 6987, 7894, 8784, 9659, 
-    10508, 11336, 12134, 12903, 13639, 14342, 15009, 15637, 16230, 16782, 17294, 17765, 18198, 18586, 18933, 19237, 
-    19498, 19716, 19893, 20027, 20119, 20172, 20186, 20161, 20099, 20003, 19871, 19706, 19507, 19275, 19012, 18715, 
-    18387, 18026, 17632, 17206, 16747, 16256, 15731, 15175, 14586, 13967, 13320, 12647, 11947, 11229, 10490, 9737, 
-    8972, 8199, 7418, 6636, 5853, 5071, 4290, 3514, 2738, 1968, 1197, 430, -336, -1100, -1869, -2633, 
-    -3400, -4165, -4928, -5686, -6441, -7184, -7915, -8633, -9332, -10011, -10664, -11290, -11887, -12450, -12980, -13475, 
-    -13933, -14355, -14742, -15093, -15410, -15694, -15947, -16169, -16363, -16529, -16669, -16781, -16868, -16930, -16965, -16971, 
-    -16952, -16901, -16819, -16704, -16555, -16368, -16145, -15884, -15584, -15246, -14871, -14459, -14012, -13532, -13019, -12479, 
-    -11912, -11322, -10713, -10084, -9441, -8789, -8125, -7452, -6777, -6095, -5413, -4731, -4047, -3368, -2691, -2018, 
-    -1354, -694, -45, 593, 1221, 1838, 2440, 3031, 3606, 4168, 4714, 5249, 5768, 6275, 6767, 7246, 
-    7710, 8162, 8597, 9019, 9425, 9819, 10193, 10552, 10889, 11211, 11506, 11780, 12026, 12247, 12435, 12596, 
-    12726, 12822, 12886, 12919, 12919, 12888, 12826, 12734, 12615, 12466, 12291, 12094, 11872, 11628, 11367, 11086, 
-    10787, 10473, 10143, 9798, 9439, 9066, 8680, 8282, 7870, 7446, 7012, 6567, 6110, 5644, 5166, 4679, 
-    4182, 3674, 3157, 2631, 2096, 1554, 1007, 455, -95, -647, -1195, -1737, -2268, -2787, -3290, -3774, 
-    -4236, -4672, -5081, -5459, -5809, -6124, -6410, -6662, -6882, -7071, -7230, -7359, -7461, -7540, -7596, -7630, 
-    -7649, -7652, -7639, -7617, -7582, -7541, -7492, -7437, -7373, -7308, -7235, -7159, -7076, -6986, -6888, -6784, 
-    -6667, -6538, -6395, -6239, -6064, -5870, -5659, -5427, -5174, -4904, -4615, -4311, -3993, -3665, -3329, -2990, 
-    -2651, -2312, -1980, -1656, -1342, -1038, -748, -471, -210, 40, 274, 500, 713, 919, 1116, 1312, 
-    1499, 1692, 1881, 2073, 2267, 2465, 2664, 2864, 3066, 3268, 3469, 3664, 3856, 4037, 4210, 4366, 
-    4509, 4631, 4733, 4809, 4862, 4887, 4883, 4852, 4794, 4708, 4598, 4463, 4307, 4132, 3942, 3738, 
-    3526, 3303, 3080, 2851, 2626, 2397, 2174, 1955, 1740, 1527, 1320, 1117, 916, 719, 523, 330, 
-    138, -51, -238, -422, -605, -781, -952, -1119, -1276, -1424, -1565, -1694, -1813, -1921, -2019, -2105, 
-    -2181, -2246, -2301, -2348, -2383, -2410, -2428, -2438, -2438, -2432, -2417, -2396, -2367, -2334, -2293, -2246, 
-    -2192, -2134, -2065, -1993, -1911, -1824, -1725, -1622, -1508, -1386, -1256, -1121, -977, -829, -674, -519, 
-    -358, -195, -31, 129, 294, 454, 615, 770, 925, 1076, 1227, 1373, 1522, 1668, 1817, 1961, 
-    2109, 2251, 2395, 2533, 2667, 2791, 2908, 3009, 3100, 3173, 3230, 3268, 3288, 3291, 3277, 3245, 
-    3201, 3147, 3078, 3007, 2930, 2851, 2771, 2696, 2620, 2550, 2483, 2420, 2358, 2297, 2233, 2165, 
-    2090, 2004, 1907, 1793, 1665, 1517, 1351, 1167, 965, 744, 512, 265, 11, -251, -515, -784, 
-    -1048, -1309, -1562, -1810, -2045, -2270, -2483, -2686, -2874, -3053, -3219, -3377, -3523, -3662, -3791, -3918, 
-    -4034, -4149, -4254, -4356, -4448, -4536, -4609, -4678, -4730, -4775, -4800, -4816, -4813, -4798, -4763, -4714, 
-    -4645, -4560, -4454, -4334, -4194, -4036, -3863, -3675, -3472, -3255, -3029, -2789, -2542, -2285, -2022, -1751, 
-    -1478, -1197, -915, -629, -342, -52, 235, 524, 812, 1096, 1379, 1657, 1936, 2208, 2476, 2739, 
-    2998, 3247, 3490, 3726, 3952, 4170, 4377, 4574, 4758, 4934, 5095, 5246, 5383, 5509, 5620, 5718, 
-    5802, 5872, 5927, 5968, 5993, 6001, 5996, 5973, 5935, 5882, 5815, 5732, 5635, 5527, 5405, 5273, 
-    5129, 4977, 4815, 4646, 4468, 4282, 4089, 3890, 3683, 3472, 3255, 3033, 2807, 2578, 2344, 2108, 
-    1866, 1623, 1374, 1120, 859, 594, 318, 36, -254, -554, -863, -1180, -1505, -1836, -2176, -2522, 
-    -2872, -3224, -3578, -3929, -4277, -4618, -4951, -5274, -5582, -5876, -6153, -6412, -6652, -6870, -7069, -7249, 
-    -7404, -7543, -7661, -7757, -7837, -7898, -7936, -7960, -7961, -7944, -7907, -7850, -7772, -7678, -7559, -7424, 
-    -7266, -7089, -6889, -6672, -6428, -6165, -5878, -5570, -5239, -4888, -4517, -4127, -3721, -3301, -2869, -2426, 
-    -1977, -1524, -1070, -617, -169, 271, 702, 1120, 1525, 1916, 2292, 2650, 2997, 3330, 3651, 3964, 
-    4269, 4568, 4863, 5153, 5441, 5726, 6006, 6285, 6558, 6825, 7085, 7337, 7577, 7807, 8022, 8223, 
-    8406, 8570, 8713, 8835, 8933, 9008, 9056, 9080, 9079, 9050, 8997, 8919, 8814, 8687, 8537, 8364, 
-    8172, 7961, 7733, 7491, 7236, 6970, 6695, 6411, 6122, 5826, 5525, 5220, 4908, 4591, 4268, 3937, 
-    3595, 3247, 2884, 2509, 2120, 1717, 1300, 867, 420, -39, -509, -993, -1486, -1983, -2485, -2986, 
-    -3488, -3984, -4474, -4952, -5421, -5875, -6311, -6730, -7130, -7506, -7861, -8192, -8499, -8781, -9040, -9272, 
-    -9481, -9663, -9822, -9956, -10066, -10153, -10219, -10261, -10284, -10286, -10267, -10229, -10171, -10092, -9995, -9875, 
-    -9734, -9569, -9383, -9169, -8933, -8670, -8382, -8066, -7730, -7364, -6976, -6565, -6134, -5681, -5213, -4730, 
-    -4236, -3732, -3221, -2707, -2191, -1678, -1166, -662, -160, 330, 813, 1286, 1751, 2202, 2646, 3080, 
-    3502, 3917, 4324, 4724, 5115, 5505, 5884, 6259, 6628, 6992, 7346, 7693, 8029, 8356, 8669, 8967, 
-    9246, 9509, 9746, 9963, 10152, 10316, 10451, 10558, 10635, 10684, 10704, 10697, 10661, 10599, 10511, 10397, 
-    10258, 10093, 9906, 9694, 9461, 9206, 8929, 8632, 8317, 7983, 7630, 7261, 6879, 6479, 6066, 5642, 
-    5204, 4754, 4293, 3820, 3339, 2846, 2341, 1829, 1308, 776, 237, -307, -860, -1419, -1977, -2537, 
-    -3093, -3643, -4184, -4710, -5221, -5713, -6182, -6626, -7045, -7432, -7789, -8113, -8405, -8668, -8896, -9094, 
-    -9265, -9407, -9524, -9615, -9687, -9735, -9768, -9782, -9782, -9764, -9736, -9689, -9630, -9553, -9464, -9353, 
-    -9226, -9077, -8910, -8718, -8508, -8274, -8019, -7742, -7448, -7132, -6802, -6453, -6090, -5714, -5329, -4933, 
-    -4529, -4120, -3705, -3286, -2864, -2439, -2010, -1578, -1142, -702, -256, 194, 651, 1113, 1578, 2050, 
-    2521, 2996, 3469, 3941, 4407, 4870, 5319, 5762, 6187, 6601, 6995, 7375, 7732, 8073, 8389, 8686, 
-    8957, 9208, 9432, 9632, 9807, 9957, 10078, 10173, 10240, 10277, 10281, 10257, 10198, 10106, 9979, 9820, 
-    9624, 9397, 9138, 8847, 8529, 8186, 7817, 7431, 7025, 6606, 6173, 5730, 5279, 4823, 4362, 3898, 
-    3434, 2969, 2505, 2039, 1576, 1113, 655, 196, -257, -710, -1157, -1602, -2041, -2476, -2903, -3323, 
-    -3733, -4135, -4525, -4904, -5272, -5629, -5970, -6299, -6617, -6920, -7207, -7482, -7743, -7988, -8218, -8432, 
-    -8631, -8813, -8977, -9127, -9257, -9369, -9465, -9540, -9597, -9635, -9652, -9648, -9623, -9576, -9505, -9412, 
-    -9295, -9151, -8983, -8790, -8571, -8325, -8055, -7757, -7432, -7082, -6706, -6306, -5879, -5431, -4958, -4465, 
-    -3950, -3418, -2867, -2305, -1727, -1140, -544, 57, 660, 1267, 1870, 2468, 3062, 3644, 4217, 4775, 
-    5319, 5845, 6354, 6842, 7311, 7757, 8181, 8582, 8959, 9313, 9642, 9948, 10227, 10483, 10711, 10912, 
-    11088, 11238, 11362, 11457, 11527, 11574, 11588, 11578, 11541, 11475, 11381, 11260, 11110, 10930, 10722, 10485, 
-    10218, 9923, 9600, 9249, 8873, 8471, 8047, 7602, 7139, 6658, 6164, 5660, 5144, 4621, 4095, 3564, 
-    3030, 2498, 1962, 1428, 894, 355, -184, -725, -1273, -1824, -2380, -2940, -3505, -4071, -4640, -5206, 
-    -5771, -6326, -6872, -7404, -7920, -8413, -8882, -9327, -9739, -10123, -10476, -10797, -11087, -11351, -11583, -11791, 
-    -11976, -12139, -12282, -12408, -12518, -12614, -12694, -12759, -12806, -12835, -12846, -12832, -12791, -12722, -12621, -12484, 
-    -12314, -12099, -11849, -11559, -11227, -10856, -10450, -10004, -9528, -9020, -8486, -7926, -7346, -6746, -6132, -5505, 
-    -4870, -4223, -3573, -2912, -2250, -1580, -905, -226, 455, 1143, 1834, 2528, 3223, 3919, 4614, 5304, 
-    5988, 6664, 7327, 7974, 8602, 9211, 9794, 10351, 10878, 11376, 11841, 12274, 12671, 13037, 13368, 13667, 
-    13932, 14165, 14368, 14541, 14682, 14795, 14880, 14934, 14957, 14953, 14916, 14847, 14747, 14612, 14443, 14241, 
-    14004, 13730, 13422, 13079, 12701, 12290, 11848, 11373, 10872, 10344, 9792, 9218, 8627, 8015, 7393, 6756, 
-    6109, 5453, 4793, 4122, 3452, 2774, 2096, 1412, 729, 39, -645, -1338, -2028, -2719, -3407, -4094, 
-    -4774, -5450, -6116, -6770, -7413, -8039, -8649, -9236, -9803, -10342, -10858, -11343, -11800, -12227, -12622, -12988, 
-    -13320, -13623, -13895, -14136, -14347, -14529, -14681, -14805, -14900, -14965, -15004, -15013, -14995, -14951, -14879, -14780, 
-    -14654, -14502, -14323, -14118, -13884, -13627, -13341, -13029, -12690, -12325, -11932, -11512, -11066, -10593, -10093, -9568, 
-    -9017, -8442, -7842, -7221, -6576, -5910, -5226, -4522, -3802, -3068, -2322, -1567, -804, -35, 734, 1506, 
-    2277, 3044, 3805, 4558, 5304, 6036, 6758, 7465, 8157, 8830, 9485, 10123, 10735, 11327, 11892, 12433, 
-    12945, 13429, 13881, 14298, 14680, 15027, 15332, 15596, 15820, 15998, 16132, 16219, 16261, 16255, 16204, 16106, 
-    15966, 15782, 15559, 15296, 15000, 14668, 14308, 13918, 13502, 13065, 12606, 12127, 11632, 11120, 10591, 10048, 
-    9490, 8918, 8330, 7727, 7109, 6478, 5830, 5170, 4495, 3808, 3110, 2405, 1692, 977, 261, -450, 
-    -1156, -1855, -2539, -3211, -3865, -4501, -5115, -5709, -6279, -6829, -7353, -7859, -8342, -8807, -9254, -9684, 
-    -10099, -10501, -10886, -11263, -11623, -11971, -12304, -12621, -12921, -13201, -13460, -13695, -13901, -14081, -14228, -14342, 
-    -14425, -14468, -14476, -14447, -14379, -14272, -14129, -13949, -13733, -13478, -13194, -12873, -12521, -12139, -11729, -11290, 
-    -10826, -10337, -9825, -9291, -8737, -8163, -7572, -6962, -6338, -5698, -5049, -4383, -3711, -3028, -2340, -1643, 
-    -946, -244, 456, 1156, 1852, 2540, 3222, 3891, 4547, 5186, 5811, 6412, 6995, 7551, 8087, 8594, 
-    9076, 9531, 9957, 10354, 10723, 11059, 11365, 11641, 11882, 12090, 12268, 12410, 12521, 12598, 12644, 12657, 
-    12643, 12596, 12523, 12424, 12299, 12153, 11985, 11796, 11591, 11369, 11131, 10879, 10613, 10333, 10040, 9731, 
-    9410, 9071, 8717, 8346, 7955, 7548, 7122, 6680, 6219, 5746, 5256, 4755, 4243, 3723, 3196, 2664, 
-    2130, 1596, 1059, 528, -4, -534, -1062, -1586, -2111, -2634, -3155, -3675, -4195, -4712, -5228, -5741, 
-    -6250, -6752, -7246, -7728, -8196, -8647, -9078, -9483, -9864, -10212, -10531, -10811, -11057, -11262, -11431, -11556, 
-    -11646, -11695, -11705, -11679, -11620, -11524, -11400, -11245, -11063, -10856, -10627, -10374, -10104, -9813, -9505, -9179, 
-    -8836, -8477, -8102, -7710, -7304, -6884, -6450, -6003, -5545, -5076, -4601, -4114, -3626, -3129, -2632, -2130, 
-    -1629, -1128, -630, -133, 358, 846, 1330, 1806, 2276, 2741, 3197, 3646, 4086, 4518, 4938, 5347, 
-    5742, 6123, 6485, 6830, 7152, 7456, 7734, 7990, 8220, 8427, 8606, 8763, 8895, 9002, 9084, 9147, 
-    9186, 9204, 9202, 9183, 9145, 9090, 9017, 8930, 8825, 8703, 8567, 8412, 8240, 8052, 7844, 7620, 
-    7376, 7114, 6833, 6535, 6216, 5883, 5532, 5166, 4786, 4397, 3996, 3587, 3173, 2755, 2334, 1915, 
-    1496, 1084, 674, 274, -119, -503, -880, -1247, -1606, -1958, -2304, -2643, -2979, -3313, -3643, -3973, 
-    -4300, -4626, -4949, -5269, -5583, -5890, -6188, -6474, -6745, -6999, -7234, -7443, -7630, -7786, -7914, -8010, 
-    -8076, -8108, -8111, -8081, -8027, -7942, -7835, -7704, -7556, -7388, -7208, -7013, -6809, -6592, -6369, -6138, 
-    -5900, -5652, -5399, -5137, -4868, -4588, -4301, -4001, -3694, -3374, -3044, -2703, -2353, -1991, -1623, -1247, 
-    -866, -482, -98, 286, 670, 1045, 1416, 1779, 2129, 2467, 2792, 3101, 3393, 3671, 3931, 4172, 
-    4397, 4607, 4797, 4973, 5133, 5277, 5409, 5525, 5629, 5719, 5799, 5864, 5918, 5958, 5988, 6003, 
-    6005, 5994, 5968, 5929, 5875, 5805, 5723, 5625, 5511, 5384, 5243, 5085, 4917, 4733, 4536, 4327, 
-    4106, 3874, 3632, 3381, 3122, 2854, 2583, 2303, 2019, 1732, 1445, 1154, 866, 577, 292, 9, 
-    -267, -541, -806, -1066, -1321, -1566, -1805, -2038, -2262, -2480, -2692, -2894, -3090, -3279, -3460, -3633, 
-    -3796, -3952, -4097, -4233, -4355, -4465, -4562, -4649, -4713, -4768, -4803, -4824, -4826, -4812, -4779, -4730, 
-    -4662, -4580, -4481, -4365, -4237, -4094, -3941, -3775, -3600, -3416, -3225, -3027, -2824, -2615, -2403, -2190, 
-    -1971, -1752, -1530, -1309, -1086, -863, -639, -416, -190, 31, 259, 484, 711, 936, 1164, 1387, 
-    1611, 1830, 2048, 2260, 2469, 2671, 2867, 3055, 3237, 3409, 3574, 3725, 3870, 4002, 4123, 4232, 
-    4329, 4411, 4482, 4535, 4579, 4604, 4617, 4613, 4596, 4562, 4513, 4450, 4373, 4283, 4177, 4062, 
-    3933, 3795, 3645, 3486, 3322, 3147, 2968, 2781, 2590, 2391, 2191, 1980, 1765, 1543, 1314, 1078, 
-    832, 579, 318, 49, -229, -513, -803, -1098, -1399, -1698, -2001, -2300, -2597, -2886, -3171, -3445, 
-    -3708, -3958, -4199, -4419, -4629, -4823, -5001, -5164, -5314, -5448, -5571, -5680, -5775, -5862, -5937, -5999, 
-    -6051, -6092, -6120, -6136, -6139, -6129, -6101, -6059, -6000, -5920, -5822, -5703, -5561, -5398, -5212, -5002, 
-    -4769, -4513, -4236, -3937, -3621, -3285, -2935, -2571, -2196, -1812, -1420, -1024, -624, -226, 176, 570, 
-    965, 1355, 1739, 2115, 2488, 2849, 3207, 3553, 3892, 4222, 4543, 4855, 5157, 5448, 5729, 5998, 
-    6256, 6501, 6733, 6949, 7153, 7338, 7509, 7661, 7796, 7914, 8014, 8095, 8156, 8199, 8224, 8227, 
-    8210, 8174, 8119, 8042, 7946, 7833, 7699, 7547, 7377, 7190, 6987, 6767, 6531, 6281, 6017, 5740, 
-    5452, 5148, 4836, 4515, 4181, 3837, 3489, 3127, 2759, 2383, 1999, 1607, 1210, 805, 393, -20, 
-    -443, -868, -1297, -1728, -2162, -2594, -3027, -3458, -3884, -4306, -4722, -5131, -5530, -5921, -6298, -6665, 
-    -7018, -7356, -7679, -7987, -8276, -8550, -8804, -9040, -9254, -9449, -9624, -9774, -9901, -10004, -10083, -10136, 
-    -10161, -10160, -10132, -10076, -9991, -9880, -9743, -9579, -9391, -9180, -8945, -8691, -8417, -8124, -7817, -7496, 
-    -7157, -6809, -6447, -6074, -5690, -5294, -4888, -4471, -4044, -3606, -3160, -2702, -2234, -1760, -1280, -790, 
-    -296, 199, 696, 1195, 1690, 2182, 2667, 3146, 3613, 4072, 4516, 4949, 5367, 5773, 6162, 6538, 
-    6898, 7247, 7579, 7898, 8201, 8493, 8768, 9029, 9273, 9500, 9708, 9898, 10065, 10213, 10334, 10433, 
-    10505, 10550, 10569, 10560, 10524, 10462, 10373, 10260, 10124, 9966, 9787, 9590, 9375, 9144, 8901, 8642, 
-    8373, 8092, 7800, 7497, 7186, 6861, 6528, 6181, 5823, 5451, 5067, 4665, 4253, 3823, 3379, 2920, 
-    2447, 1960, 1462, 955, 436, -84, -611, -1139, -1668, -2189, -2706, -3212, -3708, -4187, -4652, -5095, 
-    -5521, -5923, -6305, -6662, -6998, -7309, -7599, -7866, -8113, -8340, -8548, -8740, -8915, -9076, -9221, -9352, 
-    -9471, -9576, -9666, -9744, -9804, -9851, -9878, -9889, -9878, -9849, -9794, -9718, -9614, -9488, -9330, -9150, 
-    -8941, -8707, -8444, -8160, -7850, -7519, -7167, -6799, -6410, -6011, -5598, -5176, -4744, -4311, -3870, -3428, 
-    -2985, -2545, -2102, -1664, -1228, -795, -363, 63, 486, 906, 1324, 1735, 2144, 2548, 2948, 3341, 
-    3728, 4108, 4480, 4841, 5192, 5533, 5858, 6168, 6464, 6741, 6997, 7235, 7450, 7643, 7812, 7957, 
-    8080, 8177, 8253, 8304, 8334, 8341, 8329, 8297, 8249, 8181, 8100, 8004, 7894, 7771, 7637, 7491, 
-    7334, 7166, 6987, 6796, 6594, 6381, 6155, 5917, 5668, 5408, 5132, 4846, 4549, 4238, 3916, 3587, 
-    3245, 2897, 2540, 2179, 1811, 1441, 1067, 692, 316, -59, -434, -810, -1180, -1550, -1917, -2280, 
-    -2637, -2993, -3338, -3681, -4013, -4340, -4652, -4956, -5246, -5522, -5780, -6023, -6244, -6446, -6625, -6781, 
-    -6912, -7018, -7098, -7153, -7180, -7181, -7158, -7110, -7036, -6942, -6825, -6689, -6535, -6365, -6178, -5980, 
-    -5767, -5544, -5309, -5068, -4814, -4553, -4282, -4007, -3720, -3426, -3124, -2816, -2498, -2174, -1845, -1508, 
-    -1167, -823, -475, -128, 219, 565, 908, 1243, 1576, 1898, 2213, 2518, 2813, 3094, 3367, 3624, 
-    3871, 4104, 4324, 4531, 4725, 4907, 5073, 5228, 5366, 5496, 5605, 5705, 5788, 5858, 5911, 5950, 
-    5971, 5976, 5965, 5937, 5890, 5826, 5744, 5645, 5525, 5390, 5240, 5071, 4888, 4693, 4483, 4261, 
-    4028, 3789, 3540, 3283, 3021, 2759, 2490, 2221, 1948, 1677, 1405, 1131, 856, 581, 303, 22, 
-    -259, -546, -834, -1126, -1421, -1716, -2015, -2313, -2611, -2908, -3204, -3493, -3778, -4059, -4327, -4589, 
-    -4840, -5079, -5302, -5516, -5712, -5894, -6058, -6210, -6341, -6458, -6556, -6638, -6701, -6750, -6779, -6791, 
-    -6787, -6767, -6726, -6669, -6595, -6502, -6391, -6261, -6116, -5950, -5767, -5567, -5347, -5112, -4860, -4590, 
-    -4305, -4009, -3695, -3369, -3033, -2684, -2325, -1958, -1583, -1200, -812, -420, -22, 376, 779, 1179, 
-    1585, 1986, 2388, 2785, 3182, 3569, 3956, 4332, 4702, 5058, 5409, 5741, 6062, 6366, 6653, 6919, 
-    7168, 7393, 7596, 7776, 7933, 8064, 8173, 8257, 8320, 8360, 8379, 8379, 8362, 8325, 8276, 8210, 
-    8134, 8044, 7945, 7831, 7710, 7575, 7430, 7270, 7098, 6911, 6708, 6490, 6253, 5998, 5725, 5433, 
-    5121, 4792, 4443, 4080, 3698, 3305, 2898, 2483, 2059, 1634, 1203, 772, 343, -80, -500, -912, 
-    -1319, -1715, -2105, -2484, -2856, -3219, -3576, -3923, -4267, -4605, -4937, -5265, -5588, -5911, -6228, -6540, 
-    -6847, -7150, -7443, -7728, -8001, -8263, -8507, -8738, -8947, -9136, -9304, -9444, -9561, -9652, -9712, -9745, 
-    -9752, -9728, -9677, -9597, -9493, -9363, -9209, -9033, -8836, -8620, -8385, -8135, -7867, -7587, -7291, -6981, 
-    -6659, -6323, -5973, -5612, -5237, -4849, -4449, -4037, -3613, -3178, -2733, -2280, -1818, -1350, -877, -401, 
-    75, 553, 1028, 1499, 1967, 2426, 2877, 3318, 3750, 4166, 4574, 4965, 5345, 5710, 6062, 6398, 
-    6722, 7028, 7324, 7601, 7865, 8113, 8345, 8560, 8759, 8939, 9104, 9249, 9375, 9481, 9568, 9633, 
-    9679, 9700, 9701, 9681, 9638, 9573, 9488, 9380, 9255, 9108, 8945, 8762, 8565, 8350, 8120, 7876, 
-    7618, 7344, 7061, 6761, 6450, 6124, 5789, 5440, 5080, 4710, 4330, 3939, 3543, 3136, 2725, 2309, 
-    1889, 1466, 1045, 621, 200, -218, -634, -1048, -1455, -1859, -2258, -2650, -3036, -3419, -3791, -4161, 
-    -4520, -4873, -5216, -5552, -5875, -6187, -6487, -6773, -7043, -7296, -7530, -7748, -7944, -8117, -8268, -8397, 
-    -8500, -8582, -8638, -8673, -8682, -8671, -8636, -8582, -8505, -8412, -8299, -8170, -8025, -7866, -7690, -7506, 
-    -7306, -7094, -6870, -6636, -6387, -6131, -5861, -5580, -5287, -4985, -4671, -4348, -4013, -3670, -3320, -2960, 
-    -2595, -2226, -1853, -1476, -1102, -726, -353, 14, 376, 733, 1079, 1418, 1744, 2060, 2364, 2654, 
-    2931, 3194, 3444, 3679, 3899, 4106, 4301, 4481, 4649, 4807, 4951, 5085, 5210, 5325, 5430, 5527, 
-    5616, 5697, 5769, 5833, 5890, 5938, 5975, 6004, 6022, 6028, 6021, 6002, 5967, 5916, 5850, 5769, 
-    5669, 5554, 5422, 5274, 5110, 4933, 4741, 4537, 4323, 4097, 3865, 3624, 3378, 3128, 2873, 2615, 
-    2356, 2097, 1835, 1574, 1313, 1054, 795, 535, 281, 26, -225, -473, -718, -958, -1193, -1424, 
-    -1646, -1860, -2067, -2263, -2451, -2626, -2791, -2942, -3081, -3205, -3317, -3415, -3498, -3566, -3619, -3658, 
-    -3682, -3689, -3682, -3663, -3628, -3580, -3520, -3449, -3367, -3274, -3174, -3064, -2948, -2824, -2695, -2560, 
-    -2422, -2275, -2126, -1972, -1815, -1650, -1485, -1311, -1140, -959, -779, -594, -412, -225, -43, 142, 
-    320, 497, 668, 835, 993, 1146, 1290, 1427, 1555, 1679, 1792, 1900, 2002, 2097, 2189, 2276, 
-    2355, 2433, 2506, 2572, 2635, 2691, 2740, 2781, 2812, 2836, 2846, 2846, 2832, 2807, 2764, 2712, 
-    2643, 2562, 2468, 2360, 2239, 2109, 1965, 1812, 1649, 1476, 1295, 1104, 907, 703, 489, 271, 
-    48, -180, -411, -646, -883, -1117, -1355, -1585, -1815, -2037, -2252, -2459, -2658, -2844, -3022, -3187, 
-    -3341, -3483, -3614, -3733, -3843, -3940, -4028, -4108, -4177, -4239, -4291, -4338, -4373, -4403, -4421, -4434, 
-    -4435, -4428, -4411, -4384, -4345, -4297, -4235, -4163, -4081, -3984, -3877, -3760, -3630, -3491, -3342, -3184, 
-    -3016, -2840, -2657, -2465, -2267, -2061, -1849, -1629, -1406, -1175, -937, -695, -447, -192, 66, 329, 
-    600, 872, 1150, 1430, 1714, 2000, 2287, 2574, 2861, 3147, 3428, 3708, 3982, 4250, 4511, 4768, 
-    5012, 5248, 5476, 5691, 5896, 6087, 6267, 6433, 6583, 6721, 6843, 6949, 7039, 7114, 7170, 7212, 
-    7235, 7242, 7228, 7199, 7150, 7083, 6997, 6892, 6771, 6631, 6473, 6301, 6112, 5910, 5693, 5465, 
-    5225, 4978, 4719, 4455, 4183, 3909, 3626, 3342, 3054, 2762, 2467, 2171, 1869, 1565, 1256, 944, 
-    625, 303, -26, -360, -699, -1043, -1391, -1741, -2094, -2446, -2798, -3145, -3490, -3827, -4158, -4478, 
-    -4790, -5090, -5379, -5654, -5918, -6169, -6405, -6628, -6839, -7036, -7219, -7392, -7549, -7692, -7824, -7939, 
-    -8040, -8125, -8195, -8243, -8277, -8288, -8281, -8250, -8203, -8128, -8036, -7919, -7784, -7626, -7449, -7252, 
-    -7039, -6809, -6563, -6304, -6033, -5750, -5457, -5155, -4844, -4525, -4199, -3868, -3530, -3185, -2836, -2481, 
-    -2123, -1758, -1389, -1020, -644, -267, 109, 488, 865, 1240, 1614, 1980, 2342, 2698, 3044, 3381, 
-    3710, 4026, 4331, 4623, 4903, 5168, 5420, 5657, 5879, 6087, 6280, 6457, 6620, 6767, 6901, 7021, 
-    7126, 7216, 7295, 7360, 7410, 7449, 7474, 7486, 7486, 7471, 7444, 7404, 7349, 7280, 7198, 7099, 
-    6987, 6859, 6715, 6555, 6380, 6189, 5982, 5758, 5522, 5268, 5001, 4720, 4427, 4121, 3803, 3476, 
-    3139, 2792, 2441, 2083, 1719, 1352, 986, 618, 253, -110, -470, -824, -1170, -1513, -1846, -2169, 
-    -2484, -2792, -3086, -3373, -3647, -3914, -4167, -4410, -4639, -4860, -5064, -5256, -5435, -5599, -5744, -5875, 
-    -5989, -6081, -6157, -6212, -6248, -6260, -6258, -6230, -6185, -6121, -6038, -5937, -5823, -5691, -5546, -5388, 
-    -5219, -5039, -4851, -4652, -4447, -4237, -4018, -3795, -3566, -3335, -3095, -2855, -2608, -2359, -2105, -1850, 
-    -1589, -1329, -1065, -802, -536, -272, -9, 250, 510, 764, 1015, 1262, 1504, 1740, 1970, 2195, 
-    2414, 2625, 2832, 3029, 3221, 3408, 3586, 3756, 3921, 4076, 4222, 4360, 4487, 4604, 4708, 4803, 
-    4881, 4945, 4995, 5029, 5046, 5047, 5029, 4995, 4945, 4875, 4790, 4690, 4573, 4441, 4295, 4136, 
-    3963, 3779, 3581, 3374, 3156, 2929, 2690, 2445, 2191, 1927, 1658, 1381, 1098, 809, 517, 219, 
-    -81, -381, -684, -987, -1285, -1581, -1872, -2157, -2433, -2700, -2958, -3204, -3439, -3661, -3869, -4065, 
-    -4248, -4414, -4572, -4714, -4842, -4959, -5066, -5156, -5237, -5306, -5365, -5410, -5446, -5469, -5482, -5480, 
-    -5467, -5439, -5399, -5341, -5271, -5183, -5079, -4958, -4822, -4669, -4501, -4315, -4118, -3905, -3681, -3446, 
-    -3202, -2949, -2689, -2425, -2155, -1881, -1608, -1330, -1052, -775, -496, -217, 61, 341, 624, 906, 
-    1192, 1481, 1773, 2068, 2366, 2666, 2970, 3276, 3581, 3887, 4193, 4492, 4790, 5080, 5364, 5635, 
-    5898, 6146, 6381, 6598, 6800, 6983, 7148, 7292, 7418, 7522, 7607, 7670, 7715, 7738, 7742, 7725, 
-    7689, 7633, 7561, 7466, 7354, 7225, 7078, 6912, 6730, 6531, 6317, 6086, 5840, 5579, 5304, 5015, 
-    4711, 4394, 4066, 3723, 3369, 3005, 2629, 2242, 1846, 1444, 1031, 612, 188, -239, -669, -1102, 
-    -1534, -1963, -2387, -2805, -3217, -3618, -4006, -4383, -4746, -5091, -5421, -5735, -6031, -6310, -6572, -6819, 
-    -7049, -7266, -7467, -7655, -7830, -7994, -8144, -8283, -8410, -8525, -8626, -8714, -8788, -8849, -8892, -8919, 
-    -8929, -8920, -8894, -8845, -8778, -8691, -8581, -8451, -8303, -8131, -7942, -7732, -7504, -7256, -6992, -6710, 
-    -6414, -6098, -5771, -5431, -5074, -4707, -4327, -3937, -3535, -3125, -2705, -2278, -1843, -1401, -955, -502, 
-    -48, 411, 869, 1331, 1791, 2249, 2705, 3159, 3605, 4046, 4479, 4903, 5314, 5716, 6102, 6472, 
-    6827, 7164, 7483, 7780, 8060, 8317, 8552, 8766, 8958, 9129, 9277, 9405, 9510, 9599, 9664, 9712, 
-    9742, 9755, 9748, 9726, 9689, 9632, 9563, 9475, 9371, 9252, 9116, 8961, 8791, 8603, 8396, 8173, 
-    7930, 7670, 7391, 7094, 6778, 6445, 6093, 5727, 5342, 4943, 4531, 4106, 3668, 3223, 2767, 2306, 
-    1839, 1371, 898, 429, -39, -505, -966, -1419, -1868, -2306, -2739, -3160, -3573, -3975, -4369, -4751, 
-    -5124, -5486, -5838, -6180, -6509, -6828, -7134, -7425, -7703, -7965, -8208, -8435, -8642, -8828, -8991, -9133, 
-    -9250, -9343, -9411, -9454, -9471, -9465, -9434, -9379, -9302, -9204, -9086, -8946, -8790, -8618, -8427, -8223, 
-    -8007, -7775, -7532, -7277, -7011, -6734, -6446, -6148, -5842, -5523, -5196, -4861, -4516, -4163, -3802, -3436, 
-    -3061, -2682, -2298, -1910, -1515, -1121, -722, -323, 77, 478, 878, 1277, 1674, 2067, 2457, 2841, 
-    3219, 3589, 3952, 4303, 4645, 4972, 5289, 5588, 5872, 6138, 6386, 6614, 6824, 7012, 7180, 7327, 
-    7454, 7562, 7648, 7716, 7764, 7797, 7811, 7808, 7789, 7758, 7707, 7646, 7569, 7479, 7373, 7255, 
-    7122, 6974, 6810, 6634, 6442, 6233, 6011, 5774, 5523, 5258, 4979, 4691, 4391, 4080, 3763, 3440, 
-    3110, 2777, 2442, 2104, 1769, 1434, 1101, 770, 444, 122, -196, -510, -819, -1124, -1422, -1718, 
-    -2006, -2290, -2570, -2841, -3108, -3367, -3618, -3863, -4098, -4322, -4539, -4741, -4932, -5108, -5272, -5419, 
-    -5551, -5664, -5763, -5843, -5905, -5951, -5977, -5988, -5981, -5956, -5915, -5863, -5790, -5706, -5607, -5498, 
-    -5371, -5236, -5087, -4929, -4756, -4576, -4383, -4180, -3966, -3746, -3512, -3272, -3021, -2765, -2499, -2228, 
-    -1951, -1667, -1382, -1094, -803, -511, -222, 67, 352, 636, 913, 1188, 1454, 1715, 1966, 2212, 
-    2445, 2671, 2885, 3089, 3281, 3460, 3628, 3784, 3925, 4054, 4170, 4270, 4359, 4432, 4493, 4540, 
-    4573, 4594, 4601, 4600, 4584, 4558, 4523, 4477, 4421, 4358, 4284, 4204, 4114, 4015, 3909, 3793, 
-    3669, 3535, 3391, 3239, 3076, 2901, 2719, 2525, 2322, 2108, 1883, 1653, 1412, 1166, 912, 655, 
-    392, 130, -134, -397, -659, -917, -1172, -1421, -1664, -1902, -2130, -2353, -2567, -2774, -2971, -3163, 
-    -3343, -3518, -3684, -3842, -3991, -4134, -4267, -4391, -4507, -4611, -4705, -4788, -4858, -4914, -4958, -4986, 
-    -5000, -4998, -4981, -4948, -4900, -4836, -4757, -4663, -4556, -4433, -4300, -4152, -3994, -3823, -3643, -3453, 
-    -3255, -3046, -2833, -2611, -2383, -2150, -1910, -1666, -1417, -1164, -907, -645, -381, -113, 156, 429, 
-    705, 981, 1256, 1535, 1813, 2088, 2361, 2636, 2904, 3169, 3428, 3684, 3930, 4170, 4401, 4622, 
-    4833, 5031, 5219, 5392, 5554, 5701, 5835, 5953, 6058, 6148, 6222, 6282, 6328, 6359, 6374, 6375, 
-    6363, 6334, 6294, 6237, 6170, 6085, 5989, 5880, 5757, 5616, 5467, 5302, 5124, 4932, 4728, 4510, 
-    4282, 4041, 3788, 3526, 3253, 2973, 2682, 2385, 2082, 1773, 1458, 1142, 822, 501, 179, -140, 
-    -459, -776, -1088, -1398, -1704, -2003, -2298, -2591, -2872, -3151, -3423, -3690, -3949, -4202, -4448, -4689, 
-    -4920, -5146, -5362, -5568, -5766, -5954, -6128, -6291, -6443, -6579, -6700, -6806, -6897, -6971, -7027, -7067, 
-    -7090, -7096, -7085, -7057, -7013, -6954, -6878, -6787, -6683, -6564, -6430, -6283, -6123, -5950, -5763, -5565, 
-    -5353, -5130, -4894, -4649, -4391, -4124, -3847, -3563, -3269, -2969, -2663, -2350, -2034, -1714, -1392, -1068, 
-    -745, -420, -98, 224, 542, 860, 1175, 1485, 1792, 2098, 2397, 2692, 2983, 3267, 3546, 3817, 
-    4081, 4336, 4583, 4818, 5041, 5253, 5453, 5635, 5806, 5961, 6100, 6224, 6332, 6425, 6503, 6566, 
-    6615, 6652, 6673, 6684, 6682, 6669, 6644, 6607, 6561, 6504, 6433, 6352, 6258, 6152, 6033, 5899, 
-    5752, 5592, 5416, 5225, 5020, 4800, 4569, 4323, 4067, 3799, 3523, 3239, 2949, 2653, 2355, 2055, 
-    1754, 1454, 1155, 861, 567, 279, -3, -282, -556, -825, -1090, -1349, -1602, -1851, -2094, -2332, 
-    -2564, -2789, -3009, -3221, -3426, -3622, -3811, -3988, -4158, -4316, -4463, -4599, -4722, -4834, -4932, -5019, 
-    -5091, -5150, -5197, -5231, -5250, -5259, -5254, -5238, -5210, -5170, -5119, -5058, -4986, -4904, -4812, -4711, 
-    -4602, -4483, -4356, -4220, -4078, -3928, -3771, -3606, -3436, -3259, -3078, -2888, -2697, -2499, -2299, -2093, 
-    -1886, -1674, -1462, -1247, -1029, -811, -594, -375, -157, 59, 275, 489, 699, 908, 1112, 1311, 
-    1505, 1693, 1876, 2049, 2214, 2374, 2523, 2661, 2792, 2912, 3020, 3119, 3207, 3286, 3353, 3409, 
-    3456, 3493, 3520, 3537, 3546, 3545, 3536, 3517, 3493, 3458, 3415, 3363, 3305, 3238, 3163, 3079, 
-    2990, 2891, 2785, 2672, 2554, 2428, 2297, 2160, 2022, 1874, 1728, 1578, 1427, 1273, 1120, 968, 
-    814, 664, 515, 367, 221, 80, -59, -196, -329, -458, -586, -708, -829, -944, -1057, -1165, 
-    -1270, -1371, -1467, -1559, -1647, -1731, -1807, -1880, -1947, -2009, -2063, -2114, -2155, -2193, -2221, -2244, 
-    -2258, -2268, -2266, -2260, -2246, -2224, -2193, -2157, -2112, -2061, -2001, -1935, -1862, -1782, -1696, -1603, 
-    -1504, -1400, -1290, -1176, -1056, -932, -805, -675, -541, -404, -266, -127, 14, 157, 298, 442, 
-    584, 727, 863, 1005, 1140, 1274, 1405, 1535, 1656, 1779, 1893, 2004, 2110, 2210, 2303, 2391, 
-    2472, 2545, 2613, 2671, 2723, 2765, 2799, 2825, 2842, 2849, 2846, 2835, 2811, 2778, 2734, 2680, 
-    2614, 2539, 2452, 2354, 2248, 2131, 2003, 1868, 1726, 1574, 1417, 1255, 1086, 914, 738, 560, 
-    379, 197, 16, -167, -348, -528, -706, -883, -1054, -1226, -1390, -1553, -1709, -1862, -2006, -2148, 
-    -2282, -2408, -2528, -2641, -2747, -2843, -2935, -3016, -3092, -3159, -3221, -3272, -3318, -3358, -3390, -3414, 
-    -3433, -3447, -3453, -3454, -3449, -3438, -3423, -3399, -3371, -3338, -3297, -3251, -3199, -3138, -3073, -3000, 
-    -2918, -2830, -2735, -2631, -2519, -2400, -2271, -2135, -1991, -1839, -1677, -1510, -1334, -1151, -960, -765, 
-    -563, -356, -145, 69, 285, 506, 724, 946, 1165, 1383, 1598, 1811, 2018, 2223, 2422, 2613, 
-    2799, 2978, 3150, 3314, 3471, 3619, 3759, 3890, 4015, 4128, 4234, 4329, 4417, 4492, 4557, 4612, 
-    4654, 4684, 4700, 4707, 4697, 4676, 4638, 4590, 4526, 4451, 4362, 4261, 4147, 4024, 3890, 3747, 
-    3596, 3436, 3272, 3101, 2927, 2745, 2564, 2377, 2190, 1999, 1807, 1614, 1418, 1221, 1022, 824, 
-    623, 420, 219, 17, -187, -388, -592, -792, -993, -1190, -1386, -1578, -1767, -1950, -2131, -2305, 
-    -2476, -2641, -2802, -2955, -3106, -3249, -3389, -3523, -3651, -3772, -3891, -4001, -4106, -4204, -4296, -4381, 
-    -4457, -4525, -4583, -4634, -4674, -4702, -4720, -4728, -4723, -4705, -4677, -4637, -4582, -4517, -4439, -4349, 
-    -4248, -4135, -4011, -3875, -3731, -3576, -3414, -3240, -3060, -2870, -2677, -2473, -2264, -2049, -1830, -1604, 
-    -1375, -1141, -907, -667, -429, -187, 51, 291, 528, 763, 992, 1222, 1443, 1660, 1870, 2074, 
-    2271, 2461, 2645, 2818, 2987, 3148, 3299, 3445, 3582, 3713, 3834, 3946, 4052, 4148, 4234, 4312, 
-    4379, 4435, 4483, 4516, 4542, 4553, 4555, 4542, 4521, 4485, 4440, 4383, 4314, 4235, 4148, 4049, 
-    3942, 3827, 3703, 3572, 3437, 3292, 3141, 2988, 2827, 2661, 2493, 2320, 2145, 1964, 1783, 1599, 
-    1414, 1224, 1036, 845, 652, 460, 267, 73, -119, -312, -503, -695, -884, -1071, -1257, -1439, 
-    -1620, -1797, -1972, -2141, -2307, -2468, -2627, -2778, -2924, -3065, -3200, -3328, -3449, -3562, -3670, -3768, 
-    -3856, -3938, -4009, -4071, -4122, -4165, -4195, -4216, -4225, -4225, -4212, -4190, -4154, -4111, -4056, -3990, 
-    -3915, -3830, -3735, -3629, -3518, -3394, -3263, -3124, -2976, -2820, -2658, -2488, -2312, -2130, -1941, -1748, 
-    -1549, -1345, -1139, -929, -716, -502, -285, -67, 150, 367, 585, 800, 1014, 1225, 1433, 1638, 
-    1838, 2034, 2223, 2406, 2584, 2752, 2914, 3067, 3211, 3346, 3472, 3586, 3691, 3786, 3869, 3942, 
-    4003, 4055, 4094, 4123, 4142, 4148, 4146, 4132, 4108, 4074, 4029, 3973, 3909, 3835, 3751, 3655, 
-    3554, 3442, 3321, 3191, 3056, 2910, 2761, 2604, 2442, 2275, 2105, 1929, 1753, 1573, 1393, 1212, 
-    1028, 847, 665, 482, 302, 123, -57, -234, -411, -587, -763, -936, -1109, -1279, -1449, -1616, 
-    -1781, -1942, -2102, -2256, -2406, -2554, -2694, -2830, -2959, -3083, -3197, -3309, -3408, -3502, -3586, -3664, 
-    -3729, -3787, -3836, -3875, -3903, -3922, -3931, -3929, -3917, -3896, -3864, -3822, -3770, -3710, -3637, -3559, 
-    -3469, -3373, -3266, -3154, -3033, -2905, -2770, -2632, -2484, -2333, -2176, -2016, -1849, -1682, -1508, -1334, 
-    -1155, -977, -795, -614, -430, -247, -63, 116, 299, 477, 656, 830, 1002, 1170, 1337, 1497, 
-    1654, 1806, 1954, 2096, 2234, 2366, 2494, 2613, 2732, 2840, 2945, 3041, 3135, 3217, 3298, 3366, 
-    3432, 3487, 3537, 3576, 3610, 3632, 3649, 3654, 3653, 3640, 3621, 3590, 3555, 3504, 3449, 3384, 
-    3311, 3227, 3139, 3039, 2936, 2821, 2704, 2575, 2449, 2310, 2172, 2024, 1883, 1724, 1580, 1416, 
-    1270, 1100, 958, 776, 654, 
-};
-const unsigned int drum_v2_p3_long_len = 8805;
@@ -1,419 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v2_p4_long[] PROGMEM = {
-    125, -26, 44, 21, 47, 24, 31, 8, 3, -20, -30, -57, -70, -100, -118, -148, 
-    -170, -204, -230, -266, -295, -333, -363, -402, -432, -470, -500, -535, -563, -595, -621, -650, 
-    -673, -699, -722, -746, -766, -791, -810, -834, -853, -877, -897, -921, -942, -966, -985, -1008, 
-    -1026, -1045, -1060, -1076, -1087, -1097, -1103, -1106, -1107, -1105, -1099, -1092, -1081, -1069, -1052, -1036, 
-    -1015, -994, -969, -944, -914, -884, -849, -815, -772, -734, -689, -643, -597, -548, -499, -448, 
-    -398, -347, -295, -246, -195, -147, -97, -50, -3, 43, 89, 132, 178, 219, 264, 305, 
-    349, 390, 434, 477, 520, 564, 609, 652, 697, 738, 782, 820, 860, 894, 929, 958, 
-    987, 1011, 1035, 1055, 1074, 1090, 1107, 1119, 1134, 1143, 1153, 1160, 1166, 1167, 1168, 1163, 
-    1154, 1141, 1124, 1102, 1076, 1044, 1009, 970, 928, 882, 834, 785, 733, 679, 626, 568, 
-    509, 448, 385, 316, 247, 173, 95, 15, -69, -154, -243, -332, -423, -514, -605, -695, 
-    -784, -872, -955, -1038, -1117, -1192, -1265, -1333, -1397, -1458, -1513, -1565, -1614, -1658, -1697, -1734, 
-    -1764, -1790, -1812, -1827, -1838, -1842, -1842, -1833, -1820, -1799, -1770, -1736, -1694, -1645, -1588, -1528, 
-    -1459, -1384, -1304, -1217, -1126, -1030, -927, -821, -710, -595, -474, -351, -223, -93, 40, 175, 
-    314, 454, 596, 739, 882, 1027, 1170, 1314, 1455, 1597, 1735, 1870, 2002, 2129, 2250, 2367, 
-    2476, 2580, 2675, 2762, 2842, 2911, 2973, 3024, 3067, 3099, 3120, 3130, 3129, 3117, 3092, 3055, 
-    3006, 2943, 2870, 2781, 2683, 2571, 2448, 2312, 2165, 2009, 1841, 1663, 1477, 1281, 1077, 867, 
-    647, 422, 191, -45, -288, -535, -786, -1041, -1297, -1558, -1818, -2080, -2342, -2602, -2861, -3115, 
-    -3366, -3612, -3852, -4087, -4315, -4536, -4749, -4956, -5152, -5342, -5522, -5692, -5852, -6000, -6137, -6259, 
-    -6367, -6458, -6532, -6585, -6619, -6627, -6615, -6575, -6511, -6419, -6300, -6152, -5977, -5773, -5540, -5279, 
-    -4990, -4672, -4326, -3954, -3552, -3126, -2674, -2197, -1698, -1177, -638, -80, 490, 1075, 1668, 2267, 
-    2869, 3471, 4070, 4664, 5248, 5821, 6378, 6920, 7440, 7941, 8417, 8869, 9293, 9691, 10059, 10399, 
-    10707, 10986, 11233, 11450, 11635, 11792, 11915, 12011, 12075, 12112, 12117, 12095, 12046, 11968, 11864, 11734, 
-    11579, 11397, 11192, 10961, 10704, 10424, 10114, 9781, 9417, 9025, 8601, 8144, 7650, 7122, 6551, 5941, 
-    5290, 4593, 3855, 3072, 2247, 1380, 473, -472, -1453, -2467, -3511, -4582, -5675, -6786, -7914, -9047, 
-    -10185, -11320, -12445, -13555, -14640, -15695, -16709, -17677, -18590, -19441, -20225, -20935, -21564, -22114, -22577, -22954, 
-    -23246, -23453, -23577, -23625, -23600, -23509, -23359, -23155, -22907, -22616, -22292, -21935, -21548, -21129, -20677, -20187, 
-    -19652, -19068, -18423, -17716, -16939, -16094, -15178, -14204, -13175, -12110, -11024, -9937, -8861, -7821, -6816, -5860, 
-    -4939, -4047, -3149, -2227, -1222, -117, 1164, 2623, 4333, 6273, 8511, 11009, 13737, 16603, 19613, 22603, 
-    25625, 28436, 31319, 32645, 32491, 32588, 32518, 32574, 32526, 32569, 32529, 32567, 32531, 32566, 32532, 32565, 
-    32530, 32566, 32528, 32565, 32528, 32569, 32526, 32573, 32520, 32581, 32508, 32601, 32469, 32696, 30944, 27323, 
-    23993, 20467, 17117, 13760, 10584, 7562, 4815, 2293, 100, -1879, -3678, -5400, -7032, -8665, -10343, -12074, 
-    -13859, -15756, -17825, -19978, -22220, -24462, -26744, -28943, -31212, -32604, -32589, -32627, -32597, -32620, -32600, -32617, 
-    -32602, -32615, -32603, -32615, -32604, -32614, -32606, -32613, -32607, -32613, -32608, -32612, -32608, -32611, -32606, -32610, 
-    -32608, -32611, -32610, -32609, -32610, -32609, -32612, -32605, -32615, -32600, -32624, -32584, -32673, -32132, -28719, -24997, 
-    -21209, -17407, -13631, -9983, -6465, -3092, 177, 3316, 6339, 9253, 12091, 14838, 17497, 20086, 22618, 25148, 
-    27650, 30239, 32416, 32558, 32550, 32544, 32552, 32543, 32553, 32544, 32553, 32545, 32552, 32545, 32552, 32545, 
-    32552, 32545, 32552, 32546, 32551, 32546, 32551, 32546, 32551, 32546, 32550, 32547, 32550, 32546, 32550, 32548, 
-    32549, 32547, 32549, 32549, 32547, 32550, 32545, 32552, 32543, 32555, 32549, 32400, 29395, 25151, 21056, 16752, 
-    12515, 8123, 3801, -580, -4824, -9053, -13055, -16987, -20628, -24199, -27423, -30731, -32618, -32583, -32630, -32596, 
-    -32621, -32601, -32616, -32605, -32614, -32606, -32612, -32607, -32612, -32607, -32611, -32610, -32610, -32609, -32609, -32609, 
-    -32610, -32611, -32610, -32610, -32609, -32609, -32610, -32609, -32609, -32611, -32609, -32610, -32610, -32608, -32610, -32609, 
-    -32610, -32608, -32610, -32609, -32611, -32608, -32607, -32635, -32298, -27807, -21940, -16262, -10408, -4701, 1020, 6525, 
-    11974, 17170, 22264, 27068, 31554, 32653, 32505, 32573, 32533, 32559, 32541, 32554, 32545, 32551, 32546, 32550, 
-    32548, 32548, 32549, 32548, 32549, 32547, 32550, 32546, 32551, 32546, 32552, 32545, 32553, 32544, 32553, 32544, 
-    32554, 32542, 32554, 32541, 32556, 32539, 32559, 32537, 32562, 32534, 32565, 32530, 32571, 32520, 32584, 32502, 
-    32614, 32443, 32760, 29889, 24115, 18828, 13077, 7589, 1851, -3598, -9175, -14403, -19742, -24624, -29771, -32632, 
-    -32568, -32637, -32592, -32623, -32601, -32617, -32605, -32613, -32607, -32612, -32609, -32610, -32611, -32610, -32610, -32610, 
-    -32611, -32609, -32612, -32609, -32610, -32606, -32610, -32608, -32612, -32607, -32612, -32608, -32611, -32607, -32610, -32606, 
-    -32611, -32608, -32610, -32608, -32610, -32607, -32609, -32611, -32608, -32613, -32602, -32621, -32582, -32688, -32018, -27519, 
-    -22639, -17582, -12500, -7295, -2188, 2938, 7848, 12731, 17322, 21924, 26130, 30563, 32669, 32477, 32596, 32514, 
-    32576, 32526, 32568, 32532, 32563, 32536, 32559, 32538, 32556, 32540, 32555, 32539, 32554, 32541, 32554, 32542, 
-    32553, 32544, 32553, 32544, 32552, 32544, 32551, 32544, 32552, 32545, 32552, 32545, 32551, 32545, 32551, 32545, 
-    32552, 32542, 32554, 32542, 32556, 32538, 32563, 32518, 32622, 32059, 28002, 23644, 19192, 14691, 10049, 5371, 
-    541, -4291, -9271, -14193, -19282, -24175, -29372, -32603, -32563, -32645, -32581, -32633, -32588, -32627, -32594, -32623, 
-    -32595, -32622, -32598, -32619, -32599, -32619, -32602, -32618, -32603, -32617, -32602, -32616, -32603, -32617, -32604, -32616, 
-    -32604, -32614, -32605, -32614, -32604, -32615, -32606, -32614, -32607, -32613, -32607, -32613, -32609, -32611, -32613, -32599, 
-    -32648, -32262, -28360, -23612, -18939, -14138, -9360, -4523, 240, 4992, 9592, 14144, 18470, 22753, 26690, 30737, 
-    32664, 32473, 32600, 32507, 32582, 32519, 32575, 32523, 32571, 32526, 32569, 32528, 32567, 32528, 32566, 32529, 
-    32566, 32530, 32566, 32531, 32566, 32529, 32566, 32529, 32568, 32528, 32568, 32528, 32570, 32525, 32572, 32524, 
-    32575, 32521, 32579, 32516, 32584, 32508, 32595, 32491, 32623, 32441, 32742, 30289, 25469, 21076, 16547, 12212, 
-    7849, 3566, -716, -5001, -9272, -13608, -17879, -22253, -26398, -30791, -32767, -32522, -32670, -32565, -32647, -32577, 
-    -32638, -32585, -32632, -32590, -32627, -32592, -32624, -32595, -32623, -32597, -32622, -32598, -32622, -32599, -32621, -32599, 
-    -32620, -32600, -32619, -32601, -32619, -32601, -32619, -32600, -32620, -32601, -32619, -32599, -32620, -32599, -32621, -32598, 
-    -32624, -32594, -32631, -32579, -32675, -32215, -28753, -24719, -20645, -16389, -12087, -7638, -3179, 1417, 6002, 10743, 
-    15418, 20266, 24904, 29878, 32618, 32482, 32596, 32510, 32579, 32522, 32570, 32528, 32567, 32531, 32564, 32532, 
-    32562, 32534, 32562, 32534, 32561, 32536, 32561, 32537, 32561, 32535, 32562, 32533, 32562, 32532, 32565, 32530, 
-    32568, 32523, 32576, 32507, 32624, 31859, 29463, 27066, 24673, 22342, 20065, 17850, 15703, 13588, 11512, 9414, 
-    7306, 5099, 2821, 373, -2187, -4952, -7821, -10891, -14021, -17337, -20634, -24100, -27392, -30920, -32683, -32558, 
-    -32643, -32585, -32628, -32596, -32621, -32601, -32618, -32603, -32613, -32604, -32612, -32608, -32611, -32610, -32609, -32612, 
-    -32606, -32612, -32604, -32617, -32599, -32621, -32592, -32635, -32569, -32694, -31664, -28642, -25680, -22612, -19630, -16608, 
-    -13679, -10759, -7951, -5188, -2554, 0, 2412, 4724, 6882, 8925, 10826, 12631, 14334, 15984, 17585, 19176, 
-    20764, 22376, 24025, 25705, 27436, 29169, 30989, 32483, 32548, 32553, 32544, 32552, 32543, 32552, 32545, 32551, 
-    32545, 32550, 32547, 32550, 32547, 32548, 32548, 32547, 32551, 32544, 32555, 32535, 32581, 32196, 30778, 29245, 
-    27508, 25624, 23513, 21233, 18745, 16116, 13328, 10468, 7541, 4638, 1778, -970, -3596, -6046, -8334, -10430, 
-    -12376, -14173, -15877, -17496, -19084, -20638, -22196, -23741, -25286, -26813, -28309, -29749, -31107, -32322, -32646, -32591, 
-    -32622, -32598, -32619, -32600, -32618, -32602, -32618, -32602, -32618, -32600, -32621, -32599, -32623, -32594, -32625, -32023, 
-    -30968, -29853, -28573, -27168, -25596, -23879, -22000, -19980, -17825, -15562, -13223, -10833, -8424, -6017, -3642, -1316, 
-    942, 3137, 5260, 7321, 9317, 11262, 13158, 15017, 16832, 18603, 20312, 21955, 23508, 24964, 26303, 27521, 
-    28596, 29534, 30319, 30963, 31458, 31825, 32057, 32177, 32180, 32080, 31873, 31578, 31195, 30739, 30201, 29592, 
-    28909, 28164, 27356, 26501, 25596, 24653, 23667, 22646, 21577, 20466, 19292, 18067, 16770, 15410, 13977, 12475, 
-    10891, 9229, 7487, 5667, 3773, 1821, -184, -2219, -4280, -6337, -8379, -10377, -12315, -14166, -15923, -17563, 
-    -19087, -20480, -21753, -22899, -23937, -24873, -25726, -26496, -27200, -27834, -28404, -28894, -29295, -29587, -29757, -29783, 
-    -29659, -29371, -28927, -28332, -27610, -26777, -25862, -24886, -23887, -22882, -21904, -20959, -20060, -19198, -18364, -17533, 
-    -16687, -15786, -14816, -13742, -12555, -11235, -9794, -8238, -6592, -4872, -3112, -1331, 434, 2166, 3828, 5412, 
-    6907, 8316, 9639, 10885, 12057, 13168, 14219, 15231, 16201, 17143, 18054, 18936, 19779, 20583, 21341, 22053, 
-    22703, 23282, 23765, 24144, 24396, 24517, 24493, 24328, 24024, 23590, 23038, 22391, 21656, 20855, 19998, 19098, 
-    18168, 17224, 16278, 15338, 14403, 13480, 12563, 11658, 10755, 9867, 8981, 8112, 7250, 6404, 5571, 4750, 
-    3932, 3115, 2292, 1464, 624, -227, -1098, -1977, -2871, -3769, -4678, -5591, -6511, -7429, -8355, -9278, 
-    -10198, -11104, -11988, -12839, -13648, -14400, -15082, -15679, -16185, -16587, -16891, -17091, -17197, -17210, -17145, -17009, 
-    -16816, -16576, -16304, -16008, -15699, -15370, -15029, -14663, -14264, -13813, -13299, -12710, -12044, -11305, -10502, -9651, 
-    -8770, -7877, -6995, -6144, -5355, -4642, -4026, -3514, -3116, -2821, -2629, -2512, -2454, -2425, -2399, -2348, 
-    -2254, -2099, -1878, -1581, -1216, -781, -287, 251, 826, 1429, 2045, 2671, 3291, 3903, 4499, 5086, 
-    5662, 6236, 6812, 7396, 7986, 8583, 9176, 9758, 10311, 10820, 11263, 11623, 11883, 12031, 12058, 11971, 
-    11771, 11477, 11103, 10682, 10231, 9781, 9354, 8974, 8655, 8410, 8242, 8155, 8139, 8178, 8251, 8338, 
-    8410, 8449, 8429, 8340, 8163, 7893, 7531, 7082, 6555, 5965, 5326, 4657, 3974, 3301, 2658, 2068, 
-    1542, 1092, 720, 428, 202, 30, -106, -225, -343, -479, -654, -876, -1159, -1502, -1907, -2361, 
-    -2857, -3372, -3885, -4375, -4821, -5210, -5530, -5779, -5958, -6071, -6134, -6164, -6180, -6201, -6247, -6326, 
-    -6451, -6622, -6845, -7112, -7414, -7737, -8066, -8381, -8667, -8909, -9094, -9212, -9262, -9250, -9186, -9083, 
-    -8954, -8811, -8668, -8530, -8413, -8314, -8244, -8192, -8162, -8147, -8140, -8136, -8124, -8093, -8039, -7951, 
-    -7830, -7664, -7447, -7175, -6842, -6447, -5988, -5466, -4886, -4252, -3566, -2836, -2075, -1291, -497, 293, 
-    1066, 1811, 2515, 3176, 3786, 4348, 4866, 5350, 5806, 6247, 6683, 7126, 7574, 8036, 8505, 8986, 
-    9464, 9936, 10394, 10834, 11249, 11637, 11993, 12319, 12613, 12883, 13134, 13368, 13589, 13798, 13994, 14174, 
-    14326, 14445, 14510, 14514, 14443, 14292, 14045, 13699, 13248, 12696, 12045, 11306, 10483, 9592, 8642, 7652, 
-    6630, 5597, 4564, 3552, 2564, 1614, 702, -160, -976, -1739, -2449, -3107, -3709, -4259, -4761, -5214, 
-    -5632, -6015, -6374, -6709, -7025, -7322, -7602, -7864, -8103, -8319, -8514, -8687, -8841, -8975, -9096, -9210, 
-    -9321, -9432, -9548, -9674, -9811, -9954, -10108, -10260, -10412, -10548, -10670, -10769, -10840, -10874, -10874, -10836, 
-    -10762, -10652, -10513, -10346, -10154, -9941, -9710, -9462, -9199, -8921, -8624, -8303, -7956, -7577, -7170, -6725, 
-    -6236, -5696, -5110, -4470, -3785, -3061, -2310, -1538, -761, 6, 750, 1456, 2108, 2696, 3212, 3652, 
-    4014, 4300, 4517, 4671, 4779, 4853, 4907, 4961, 5021, 5102, 5210, 5349, 5522, 5731, 5966, 6223, 
-    6491, 6761, 7025, 7275, 7509, 7729, 7927, 8108, 8271, 8426, 8574, 8727, 8890, 9073, 9277, 9505, 
-    9758, 10032, 10317, 10603, 10876, 11124, 11329, 11482, 11566, 11579, 11506, 11347, 11102, 10772, 10367, 9892, 
-    9354, 8766, 8134, 7467, 6778, 6074, 5363, 4655, 3957, 3282, 2636, 2029, 1465, 952, 493, 92, 
-    -253, -542, -783, -982, -1153, -1311, -1469, -1641, -1839, -2069, -2341, -2663, -3037, -3462, -3934, -4448, 
-    -4998, -5573, -6169, -6774, -7385, -7993, -8593, -9185, -9766, -10331, -10880, -11407, -11905, -12365, -12784, -13151, 
-    -13463, -13710, -13891, -14007, -14058, -14049, -13985, -13866, -13701, -13492, -13249, -12972, -12669, -12341, -11991, -11625, 
-    -11246, -10860, -10470, -10081, -9697, -9321, -8954, -8600, -8263, -7936, -7621, -7313, -7005, -6691, -6362, -6005, 
-    -5619, -5192, -4723, -4206, -3639, -3018, -2344, -1617, -837, -6, 874, 1802, 2770, 3773, 4806, 5860, 
-    6929, 8002, 9068, 10120, 11148, 12148, 13113, 14038, 14921, 15763, 16559, 17316, 18029, 18698, 19326, 19904, 
-    20439, 20924, 21358, 21740, 22064, 22324, 22516, 22632, 22665, 22610, 22460, 22212, 21862, 21403, 20841, 20175, 
-    19412, 18562, 17631, 16639, 15595, 14517, 13414, 12300, 11182, 10067, 8958, 7856, 6759, 5664, 4573, 3478, 
-    2378, 1266, 141, -998, -2162, -3350, -4567, -5818, -7103, -8424, -9779, -11163, -12568, -13984, -15397, -16794, 
-    -18154, -19462, -20704, -21864, -22932, -23902, -24771, -25533, -26199, -26770, -27260, -27677, -28027, -28316, -28544, -28702, 
-    -28788, -28788, -28689, -28479, -28142, -27662, -27034, -26244, -25298, -24196, -22954, -21584, -20105, -18546, -16931, -15290, 
-    -13646, -12024, -10440, -8903, -7422, -5998, -4621, -3283, -1965, -649, 679, 2037, 3439, 4893, 6403, 7969, 
-    9580, 11223, 12876, 14516, 16118, 17661, 19123, 20490, 21747, 22891, 23916, 24829, 25637, 26348, 26974, 27521, 
-    28000, 28419, 28780, 29088, 29342, 29538, 29665, 29717, 29676, 29535, 29277, 28899, 28391, 27750, 26976, 26072, 
-    25042, 23901, 22659, 21328, 19922, 18456, 16943, 15399, 13834, 12258, 10683, 9109, 7541, 5976, 4415, 2851, 
-    1282, -300, -1901, -3523, -5170, -6837, -8527, -10226, -11928, -13619, -15286, -16910, -18477, -19971, -21372, -22666, 
-    -23843, -24894, -25813, -26600, -27257, -27793, -28213, -28529, -28748, -28878, -28928, -28900, -28803, -28639, -28412, -28123, 
-    -27773, -27357, -26874, -26311, -25669, -24940, -24120, -23209, -22200, -21094, -19886, -18573, -17160, -15647, -14044, -12357, 
-    -10604, -8795, -6951, -5090, -3227, -1378, 443, 2228, 3963, 5639, 7253, 8798, 10267, 11669, 12999, 14267, 
-    15474, 16626, 17728, 18778, 19777, 20723, 21614, 22444, 23208, 23899, 24510, 25030, 25457, 25789, 26022, 26162, 
-    26205, 26163, 26035, 25828, 25548, 25200, 24787, 24311, 23770, 23160, 22477, 21712, 20859, 19909, 18861, 17707, 
-    16453, 15094, 13641, 12102, 10485, 8806, 7076, 5307, 3512, 1704, -104, -1904, -3684, -5437, -7156, -8833, 
-    -10464, -12040, -13558, -15007, -16381, -17667, -18857, -19940, -20908, -21751, -22465, -23051, -23506, -23838, -24057, -24169, 
-    -24187, -24120, -23980, -23776, -23521, -23218, -22871, -22481, -22038, -21538, -20969, -20324, -19585, -18748, -17804, -16751, 
-    -15598, -14348, -13018, -11619, -10168, -8682, -7177, -5670, -4175, -2704, -1263, 139, 1504, 2830, 4124, 5390, 
-    6634, 7862, 9076, 10274, 11457, 12615, 13743, 14835, 15876, 16862, 17779, 18621, 19377, 20040, 20605, 21067, 
-    21423, 21676, 21825, 21874, 21828, 21691, 21469, 21167, 20785, 20337, 19822, 19245, 18607, 17909, 17152, 16334, 
-    15460, 14525, 13530, 12478, 11365, 10201, 8981, 7714, 6399, 5046, 3663, 2259, 847, -565, -1970, -3357, 
-    -4718, -6048, -7339, -8583, -9779, -10921, -12003, -13025, -13985, -14883, -15723, -16504, -17234, -17914, -18544, -19124, 
-    -19656, -20139, -20573, -20956, -21280, -21546, -21744, -21869, -21914, -21872, -21734, -21497, -21156, -20703, -20142, -19467, 
-    -18676, -17775, -16764, -15651, -14440, -13146, -11781, -10360, -8903, -7425, -5945, -4480, -3047, -1652, -305, 991, 
-    2240, 3440, 4600, 5727, 6829, 7918, 8993, 10062, 11120, 12162, 13181, 14163, 15101, 15977, 16781, 17503, 
-    18138, 18679, 19127, 19485, 19753, 19939, 20054, 20105, 20104, 20058, 19975, 19859, 19717, 19552, 19365, 19155, 
-    18920, 18654, 18352, 18006, 17608, 17149, 16619, 16012, 15316, 14527, 13639, 12654, 11572, 10397, 9138, 7805, 
-    6409, 4964, 3486, 1990, 494, -989, -2446, -3869, -5245, -6570, -7839, -9048, -10196, -11282, -12303, -13264, 
-    -14164, -15005, -15794, -16527, -17211, -17844, -18426, -18956, -19431, -19846, -20197, -20482, -20700, -20846, -20921, -20919, 
-    -20837, -20674, -20429, -20104, -19703, -19230, -18693, -18093, -17437, -16724, -15960, -15146, -14282, -13377, -12440, -11472, 
-    -10487, -9487, -8478, -7464, -6452, -5440, -4431, -3425, -2420, -1415, -411, 595, 1601, 2606, 3607, 4597, 
-    5571, 6521, 7441, 8323, 9166, 9962, 10710, 11407, 12055, 12656, 13216, 13740, 14230, 14692, 15125, 15527, 
-    15899, 16234, 16529, 16780, 16976, 17116, 17187, 17186, 17111, 16955, 16718, 16398, 15997, 15521, 14978, 14379, 
-    13735, 13058, 12356, 11643, 10925, 10209, 9499, 8795, 8096, 7401, 6701, 5999, 5281, 4551, 3799, 3026, 
-    2229, 1414, 582, -255, -1089, -1909, -2702, -3460, -4172, -4836, -5445, -5999, -6500, -6947, -7343, -7696, 
-    -8007, -8283, -8529, -8744, -8937, -9103, -9248, -9364, -9454, -9514, -9541, -9540, -9507, -9451, -9373, -9279, 
-    -9176, -9068, -8956, -8842, -8726, -8606, -8481, -8348, -8208, -8053, -7886, -7704, -7506, -7294, -7070, -6835, 
-    -6593, -6346, -6096, -5847, -5600, -5356, -5117, -4881, -4650, -4420, -4188, -3950, -3704, -3445, -3172, -2884, 
-    -2579, -2257, -1918, -1564, -1194, -811, -420, -23, 371, 761, 1135, 1491, 1821, 2127, 2405, 2653, 
-    2874, 3068, 3239, 3390, 3527, 3655, 3777, 3896, 4017, 4138, 4263, 4390, 4521, 4650, 4778, 4900, 
-    5018, 5130, 5240, 5343, 5445, 5546, 5644, 5747, 5852, 5967, 6094, 6236, 6398, 6581, 6786, 7012, 
-    7257, 7511, 7767, 8016, 8249, 8458, 8632, 8768, 8856, 8892, 8870, 8792, 8655, 8464, 8220, 7931, 
-    7595, 7221, 6814, 6380, 5921, 5445, 4950, 4442, 3923, 3397, 2864, 2329, 1793, 1262, 738, 222, 
-    -281, -774, -1252, -1715, -2161, -2585, -2991, -3374, -3736, -4076, -4395, -4692, -4967, -5221, -5458, -5677, 
-    -5885, -6084, -6281, -6480, -6687, -6906, -7145, -7401, -7681, -7980, -8299, -8631, -8978, -9330, -9681, -10025, 
-    -10351, -10657, -10933, -11172, -11375, -11531, -11639, -11695, -11692, -11631, -11506, -11315, -11058, -10729, -10333, -9867, 
-    -9341, -8753, -8115, -7428, -6706, -5960, -5199, -4432, -3673, -2925, -2203, -1508, -840, -205, 405, 990, 
-    1556, 2107, 2650, 3187, 3722, 4256, 4788, 5315, 5835, 6343, 6831, 7296, 7731, 8132, 8497, 8825, 
-    9118, 9378, 9613, 9827, 10028, 10221, 10413, 10607, 10803, 11002, 11201, 11399, 11589, 11771, 11934, 12077, 
-    12192, 12273, 12312, 12303, 12239, 12118, 11935, 11689, 11376, 10997, 10551, 10039, 9465, 8832, 8146, 7414, 
-    6644, 5844, 5023, 4185, 3338, 2489, 1641, 804, -19, -823, -1603, -2352, -3068, -3744, -4376, -4964, 
-    -5502, -5988, -6422, -6801, -7126, -7398, -7625, -7804, -7947, -8056, -8139, -8201, -8249, -8286, -8316, -8342, 
-    -8361, -8377, -8388, -8390, -8385, -8368, -8335, -8284, -8209, -8107, -7977, -7812, -7618, -7393, -7142, -6866, 
-    -6579, -6280, -5981, -5689, -5405, -5139, -4889, -4657, -4442, -4239, -4045, -3851, -3655, -3444, -3214, -2959, 
-    -2672, -2352, -1997, -1611, -1201, -772, -338, 94, 515, 915, 1289, 1625, 1926, 2181, 2396, 2569, 
-    2701, 2800, 2865, 2904, 2919, 2917, 2897, 2865, 2822, 2771, 2715, 2655, 2597, 2545, 2501, 2470, 
-    2456, 2459, 2480, 2523, 2584, 2665, 2762, 2872, 2992, 3118, 3246, 3370, 3487, 3594, 3690, 3772, 
-    3847, 3913, 3976, 4041, 4111, 4191, 4284, 4394, 4519, 4660, 4814, 4974, 5138, 5293, 5436, 5558, 
-    5652, 5715, 5741, 5734, 5690, 5618, 5516, 5391, 5248, 5090, 4925, 4756, 4591, 4428, 4272, 4121, 
-    3978, 3842, 3709, 3583, 3457, 3332, 3202, 3068, 2922, 2765, 2593, 2401, 2189, 1951, 1689, 1398, 
-    1077, 729, 346, -64, -506, -973, -1466, -1980, -2510, -3052, -3597, -4144, -4686, -5220, -5743, -6256, 
-    -6752, -7230, -7686, -8119, -8527, -8911, -9270, -9604, -9919, -10210, -10483, -10736, -10972, -11184, -11378, -11546, 
-    -11689, -11800, -11875, -11906, -11888, -11818, -11688, -11497, -11240, -10919, -10533, -10088, -9585, -9035, -8446, -7824, 
-    -7180, -6525, -5863, -5202, -4549, -3904, -3273, -2655, -2054, -1468, -897, -342, 203, 738, 1270, 1799, 
-    2332, 2871, 3426, 4000, 4600, 5230, 5893, 6594, 7329, 8096, 8889, 9700, 10519, 11333, 12132, 12902, 
-    13637, 14325, 14958, 15532, 16042, 16482, 16853, 17155, 17386, 17547, 17638, 17661, 17618, 17506, 17328, 17082, 
-    16769, 16390, 15948, 15446, 14888, 14275, 13612, 12900, 12140, 11332, 10482, 9585, 8650, 7676, 6665, 5625, 
-    4558, 3473, 2377, 1275, 177, -907, -1977, -3021, -4040, -5028, -5985, -6911, -7809, -8679, -9525, -10349, 
-    -11156, -11944, -12715, -13464, -14192, -14888, -15556, -16184, -16770, -17307, -17790, -18216, -18578, -18879, -19113, -19281, 
-    -19383, -19417, -19385, -19286, -19124, -18898, -18610, -18259, -17846, -17371, -16834, -16239, -15587, -14879, -14122, -13318, 
-    -12472, -11584, -10660, -9699, -8706, -7679, -6624, -5538, -4423, -3281, -2113, -922, 287, 1514, 2751, 3992, 
-    5232, 6463, 7677, 8868, 10025, 11141, 12209, 13222, 14178, 15070, 15895, 16654, 17338, 17953, 18495, 18959, 
-    19349, 19661, 19899, 20062, 20151, 20172, 20124, 20012, 19838, 19604, 19311, 18960, 18552, 18086, 17562, 16980, 
-    16340, 15641, 14885, 14073, 13211, 12301, 11351, 10367, 9356, 8329, 7287, 6243, 5199, 4159, 3122, 2092, 
-    1065, 42, -978, -2001, -3023, -4045, -5062, -6072, -7069, -8044, -8993, -9907, -10778, -11600, -12365, -13071, 
-    -13714, -14291, -14806, -15257, -15649, -15984, -16267, -16499, -16684, -16820, -16913, -16958, -16953, -16898, -16786, -16615, 
-    -16381, -16080, -15711, -15274, -14771, -14203, -13574, -12888, -12153, -11373, -10559, -9712, -8845, -7958, -7059, -6152, 
-    -5242, -4331, -3422, -2520, -1627, -746, 118, 965, 1791, 2593, 3373, 4126, 4854, 5558, 6238, 6893, 
-    7523, 8129, 8709, 9262, 9791, 10289, 10755, 11187, 11579, 11928, 12229, 12477, 12673, 12811, 12891, 12915, 
-    12881, 12793, 12654, 12463, 12226, 11948, 11628, 11276, 10889, 10474, 10031, 9561, 9067, 8550, 8010, 7447, 
-    6866, 6264, 5644, 5005, 4349, 3674, 2982, 2274, 1553, 822, 85, -649, -1380, -2095, -2791, -3457, 
-    -4088, -4675, -5213, -5698, -6127, -6498, -6813, -7071, -7275, -7428, -7538, -7605, -7640, -7646, -7627, -7589, 
-    -7534, -7468, -7388, -7300, -7202, -7096, -6977, -6845, -6697, -6527, -6333, -6111, -5854, -5567, -5242, -4884, 
-    -4494, -4077, -3641, -3191, -2739, -2287, -1846, -1421, -1015, -632, -275, 59, 369, 661, 934, 1199, 
-    1453, 1707, 1961, 2219, 2482, 2748, 3016, 3286, 3551, 3809, 4053, 4277, 4475, 4641, 4766, 4849, 
-    4885, 4870, 4806, 4694, 4537, 4339, 4107, 3848, 3568, 3274, 2972, 2670, 2366, 2070, 1781, 1498, 
-    1223, 954, 690, 430, 174, -79, -327, -572, -807, -1033, -1248, -1446, -1629, -1792, -1936, -2062, 
-    -2168, -2254, -2324, -2376, -2412, -2433, -2437, -2428, -2406, -2371, -2326, -2269, -2200, -2120, -2027, -1923, 
-    -1804, -1671, -1524, -1361, -1185, -997, -798, -591, -380, -161, 54, 272, 488, 699, 905, 1108, 
-    1307, 1503, 1700, 1895, 2090, 2283, 2471, 2650, 2817, 2965, 3089, 3186, 3251, 3285, 3287, 3258, 
-    3204, 3129, 3036, 2936, 2829, 2726, 2625, 2531, 2444, 2362, 2279, 2193, 2094, 1979, 1840, 1673, 
-    1474, 1242, 978, 683, 364, 26, -322, -678, -1033, -1379, -1714, -2032, -2330, -2608, -2864, -3099, 
-    -3316, -3515, -3697, -3869, -4028, -4178, -4316, -4443, -4556, -4651, -4727, -4780, -4809, -4811, -4786, -4730, 
-    -4644, -4525, -4375, -4194, -3979, -3739, -3472, -3181, -2870, -2541, -2198, -1841, -1476, -1103, -724, -340, 
-    45, 430, 813, 1193, 1567, 1938, 2300, 2655, 3001, 3332, 3651, 3955, 4242, 4511, 4761, 4991, 
-    5198, 5384, 5547, 5687, 5802, 5891, 5954, 5990, 5997, 5978, 5929, 5855, 5753, 5627, 5478, 5308, 
-    5118, 4912, 4690, 4454, 4204, 3942, 3667, 3384, 3090, 2790, 2482, 2168, 1847, 1521, 1185, 838, 
-    481, 107, -279, -683, -1100, -1533, -1978, -2436, -2903, -3374, -3843, -4308, -4761, -5196, -5610, -5996, 
-    -6351, -6672, -6956, -7206, -7416, -7594, -7733, -7840, -7912, -7951, -7955, -7924, -7858, -7757, -7620, -7448, 
-    -7240, -6994, -6712, -6390, -6029, -5628, -5188, -4711, -4200, -3658, -3093, -2507, -1908, -1303, -698, -100, 
-    483, 1047, 1587, 2103, 2588, 3050, 3489, 3910, 4317, 4714, 5103, 5488, 5865, 6238, 6602, 6954, 
-    7294, 7615, 7915, 8189, 8433, 8642, 8813, 8944, 9031, 9073, 9069, 9019, 8925, 8785, 8604, 8382, 
-    8125, 7834, 7517, 7176, 6816, 6441, 6055, 5657, 5252, 4835, 4410, 3971, 3516, 3043, 2547, 2028, 
-    1482, 911, 313, -305, -946, -1603, -2269, -2939, -3607, -4266, -4909, -5532, -6128, -6692, -7223, -7712, 
-    -8163, -8568, -8932, -9251, -9525, -9755, -9942, -10085, -10189, -10252, -10280, -10270, -10226, -10145, -10029, -9876, 
-    -9683, -9451, -9174, -8854, -8489, -8076, -7621, -7119, -6578, -5998, -5385, -4744, -4083, -3406, -2721, -2034, 
-    -1349, -673, -8, 642, 1276, 1893, 2490, 3071, 3632, 4182, 4716, 5239, 5752, 6253, 6744, 7223, 
-    7687, 8135, 8561, 8961, 9331, 9665, 9957, 10205, 10404, 10552, 10649, 10694, 10689, 10636, 10534, 10388, 
-    10195, 9960, 9682, 9365, 9009, 8617, 8192, 7732, 7243, 6728, 6185, 5621, 5033, 4425, 3796, 3151, 
-    2484, 1803, 1104, 388, -336, -1077, -1822, -2568, -3309, -4036, -4740, -5417, -6056, -6652, -7200, -7694, 
-    -8131, -8511, -8835, -9103, -9322, -9490, -9617, -9703, -9755, -9777, -9770, -9737, -9679, -9593, -9480, -9336, 
-    -9158, -8945, -8693, -8403, -8074, -7708, -7306, -6872, -6410, -5920, -5411, -4883, -4343, -3792, -3233, -2669, 
-    -2099, -1523, -940, -347, 253, 864, 1484, 2111, 2742, 3375, 4003, 4624, 5231, 5819, 6383, 6919, 
-    7424, 7894, 8329, 8723, 9077, 9389, 9655, 9878, 10053, 10180, 10256, 10276, 10243, 10150, 9996, 9783, 
-    9507, 9175, 8787, 8351, 7871, 7353, 6806, 6234, 5642, 5039, 4426, 3807, 3187, 2567, 1947, 1329, 
-    715, 105, -499, -1099, -1691, -2275, -2848, -3407, -3950, -4476, -4980, -5466, -5928, -6365, -6782, -7171, 
-    -7537, -7877, -8189, -8473, -8731, -8956, -9153, -9317, -9450, -9550, -9615, -9646, -9638, -9593, -9506, -9380, 
-    -9208, -8992, -8732, -8424, -8072, -7671, -7223, -6731, -6192, -5611, -4988, -4327, -3630, -2902, -2148, -1372, 
-    -579, 222, 1030, 1836, 2634, 3419, 4185, 4929, 5643, 6327, 6976, 7587, 8158, 8690, 9179, 9625, 
-    10027, 10385, 10697, 10961, 11180, 11352, 11474, 11553, 11581, 11562, 11495, 11375, 11209, 10988, 10718, 10396, 
-    10021, 9596, 9123, 8604, 8043, 7446, 6816, 6159, 5484, 4790, 4090, 3380, 2669, 1955, 1242, 527, 
-    -192, -916, -1650, -2389, -3139, -3893, -4651, -5406, -6154, -6883, -7590, -8262, -8893, -9477, -10006, -10483, 
-    -10902, -11270, -11586, -11856, -12087, -12281, -12444, -12580, -12689, -12771, -12821, -12838, -12810, -12736, -12605, -12413, 
-    -12153, -11823, -11423, -10950, -10412, -9808, -9149, -8438, -7685, -6895, -6078, -5239, -4383, -3513, -2632, -1743, 
-    -843, 63, 978, 1899, 2825, 3754, 4680, 5599, 6505, 7391, 8248, 9070, 9851, 10582, 11261, 11885, 
-    12448, 12953, 13397, 13783, 14110, 14382, 14600, 14765, 14879, 14939, 14946, 14899, 14795, 14632, 14408, 14125, 
-    13776, 13367, 12894, 12362, 11772, 11128, 10436, 9699, 8927, 8121, 7289, 6435, 5564, 4681, 3787, 2888, 
-    1980, 1070, 153, -764, -1686, -2607, -3526, -4439, -5342, -6231, -7098, -7942, -8753, -9528, -10259, -10945, 
-    -11579, -12160, -12688, -13159, -13575, -13937, -14243, -14497, -14699, -14850, -14949, -14998, -14997, -14948, -14850, -14705, 
-    -14511, -14272, -13983, -13648, -13266, -12835, -12358, -11831, -11258, -10636, -9967, -9253, -8494, -7692, -6850, -5969, 
-    -5054, -4106, -3132, -2136, -1124, -100, 927, 1957, 2981, 3995, 4997, 5979, 6938, 7874, 8778, 9650, 
-    10486, 11281, 12033, 12738, 13392, 13990, 14526, 14999, 15400, 15728, 15980, 16151, 16240, 16246, 16170, 16014, 
-    15781, 15475, 15105, 14672, 14186, 13649, 13071, 12455, 11805, 11127, 10419, 9685, 8925, 8138, 7325, 6485, 
-    5619, 4729, 3815, 2882, 1937, 983, 28, -917, -1850, -2762, -3646, -4498, -5314, -6090, -6827, -7523, 
-    -8182, -8806, -9398, -9962, -10499, -11013, -11504, -11970, -12411, -12822, -13199, -13538, -13832, -14076, -14264, -14394, 
-    -14460, -14460, -14395, -14258, -14057, -13791, -13459, -13068, -12617, -12112, -11557, -10952, -10304, -9615, -8888, -8125, 
-    -7331, -6506, -5656, -4783, -3889, -2982, -2059, -1129, -195, 740, 1671, 2590, 3496, 4379, 5234, 6059, 
-    6847, 7593, 8297, 8954, 9564, 10123, 10630, 11083, 11479, 11821, 12101, 12326, 12489, 12597, 12645, 12641, 
-    12581, 12475, 12321, 12127, 11895, 11630, 11334, 11012, 10663, 10292, 9894, 9472, 9021, 8542, 8031, 7488, 
-    6914, 6308, 5676, 5018, 4340, 3647, 2941, 2230, 1516, 803, 93, -614, -1316, -2016, -2713, -3408, 
-    -4101, -4792, -5479, -6160, -6830, -7484, -8115, -8717, -9280, -9798, -10264, -10671, -11014, -11289, -11493, -11627, 
-    -11692, -11688, -11624, -11496, -11316, -11083, -10807, -10489, -10135, -9747, -9327, -8877, -8397, -7888, -7352, -6790, 
-    -6205, -5598, -4974, -4333, -3681, -3020, -2354, -1685, -1017, -353, 305, 955, 1597, 2226, 2845, 3450, 
-    4041, 4615, 5170, 5702, 6207, 6681, 7119, 7521, 7880, 8196, 8469, 8695, 8880, 9019, 9118, 9178, 
-    9200, 9187, 9143, 9067, 8961, 8827, 8663, 8471, 8246, 7992, 7705, 7386, 7033, 6649, 6229, 5782, 
-    5304, 4802, 4280, 3740, 3189, 2631, 2070, 1512, 961, 420, -106, -617, -1114, -1594, -2063, -2520, 
-    -2969, -3414, -3853, -4291, -4725, -5154, -5575, -5983, -6373, -6738, -7073, -7370, -7623, -7827, -7977, -8070, 
-    -8108, -8089, -8021, -7903, -7744, -7549, -7323, -7072, -6801, -6511, -6208, -5892, -5560, -5217, -4858, -4484, 
-    -4092, -3683, -3254, -2806, -2340, -1856, -1359, -852, -339, 173, 685, 1185, 1674, 2144, 2591, 3013, 
-    3406, 3771, 4104, 4406, 4680, 4923, 5139, 5327, 5492, 5632, 5749, 5845, 5917, 5968, 5996, 6001, 
-    5981, 5936, 5866, 5769, 5647, 5497, 5323, 5122, 4898, 4648, 4376, 4082, 3769, 3440, 3094, 2736, 
-    2367, 1988, 1606, 1220, 834, 450, 72, -298, -660, -1009, -1349, -1674, -1988, -2287, -2576, -2851, 
-    -3112, -3362, -3596, -3814, -4018, -4204, -4368, -4510, -4630, -4719, -4784, -4818, -4822, -4795, -4737, -4648, 
-    -4531, -4384, -4213, -4018, -3803, -3569, -3321, -3060, -2788, -2508, -2224, -1933, -1639, -1344, -1047, -749, 
-    -450, -151, 148, 450, 751, 1053, 1353, 1651, 1943, 2228, 2507, 2773, 3028, 3269, 3495, 3704, 
-    3895, 4066, 4216, 4345, 4448, 4527, 4582, 4610, 4611, 4587, 4534, 4455, 4351, 4223, 4072, 3901, 
-    3710, 3502, 3280, 3044, 2799, 2542, 2276, 1999, 1711, 1412, 1099, 771, 429, 73, -299, -681, 
-    -1074, -1473, -1875, -2276, -2670, -3053, -3424, -3772, -4101, -4402, -4679, -4928, -5151, -5348, -5521, -5670, 
-    -5797, -5905, -5992, -6059, -6107, -6131, -6134, -6110, -6057, -5975, -5857, -5704, -5512, -5280, -5007, -4692, 
-    -4337, -3944, -3518, -3061, -2579, -2076, -1560, -1031, -500, 35, 564, 1089, 1606, 2110, 2604, 3083, 
-    3549, 3999, 4433, 4851, 5252, 5633, 5996, 6336, 6654, 6946, 7213, 7450, 7658, 7834, 7979, 8091, 
-    8168, 8213, 8222, 8194, 8133, 8034, 7903, 7737, 7537, 7306, 7045, 6754, 6436, 6092, 5725, 5336, 
-    4924, 4498, 4048, 3587, 3107, 2614, 2106, 1585, 1052, 507, -45, -610, -1179, -1755, -2333, -2910, 
-    -3485, -4052, -4611, -5157, -5688, -6199, -6689, -7155, -7594, -8006, -8387, -8738, -9053, -9333, -9577, -9781, 
-    -9941, -10061, -10133, -10158, -10134, -10062, -9940, -9771, -9554, -9295, -8993, -8656, -8283, -7880, -7452, -6997, 
-    -6522, -6025, -5508, -4971, -4415, -3841, -3250, -2641, -2013, -1376, -723, -64, 598, 1263, 1923, 2573, 
-    3211, 3832, 4432, 5008, 5562, 6089, 6590, 7065, 7517, 7941, 8342, 8716, 9063, 9382, 9668, 9921, 
-    10136, 10310, 10440, 10524, 10561, 10549, 10488, 10382, 10230, 10038, 9809, 9545, 9251, 8931, 8586, 8222, 
-    7836, 7433, 7010, 6569, 6106, 5622, 5114, 4580, 4021, 3433, 2820, 2182, 1522, 844, 150, -549, 
-    -1254, -1956, -2647, -3322, -3975, -4600, -5191, -5747, -6263, -6738, -7173, -7567, -7921, -8240, -8525, -8778, 
-    -9004, -9203, -9377, -9528, -9653, -9754, -9827, -9871, -9881, -9857, -9793, -9686, -9536, -9337, -9091, -8798, 
-    -8457, -8073, -7648, -7184, -6689, -6163, -5618, -5052, -4475, -3890, -3300, -2711, -2122, -1537, -957, -381, 
-    188, 750, 1308, 1857, 2399, 2933, 3457, 3969, 4467, 4947, 5409, 5847, 6259, 6642, 6989, 7301, 
-    7574, 7805, 7994, 8142, 8246, 8311, 8336, 8324, 8278, 8201, 8094, 7964, 7808, 7632, 7434, 7217, 
-    6980, 6723, 6446, 6148, 5827, 5488, 5123, 4739, 4333, 3906, 3463, 3002, 2528, 2044, 1552, 1054, 
-    553, 51, -449, -948, -1442, -1932, -2414, -2889, -3354, -3806, -4246, -4666, -5067, -5444, -5791, -6108, 
-    -6389, -6632, -6832, -6988, -7098, -7163, -7179, -7151, -7078, -6963, -6811, -6623, -6405, -6158, -5889, -5596, 
-    -5286, -4959, -4614, -4256, -3883, -3495, -3093, -2678, -2249, -1810, -1360, -902, -439, 24, 487, 944, 
-    1391, 1827, 2247, 2650, 3033, 3396, 3735, 4054, 4348, 4619, 4867, 5091, 5290, 5467, 5617, 5742, 
-    5841, 5914, 5958, 5972, 5959, 5913, 5835, 5727, 5586, 5413, 5212, 4980, 4725, 4446, 4145, 3828, 
-    3497, 3151, 2801, 2444, 2083, 1721, 1358, 991, 625, 254, -121, -501, -886, -1277, -1671, -2069, 
-    -2467, -2863, -3257, -3640, -4017, -4376, -4720, -5044, -5342, -5619, -5867, -6087, -6279, -6440, -6571, -6670, 
-    -6741, -6779, -6787, -6766, -6711, -6626, -6510, -6359, -6179, -5965, -5720, -5442, -5133, -4796, -4427, -4036, 
-    -3617, -3177, -2716, -2236, -1742, -1234, -715, -189, 343, 878, 1415, 1954, 2487, 3017, 3539, 4051, 
-    4550, 5031, 5495, 5931, 6343, 6722, 7068, 7375, 7643, 7869, 8052, 8194, 8293, 8353, 8375, 8365, 
-    8322, 8253, 8158, 8043, 7907, 7751, 7576, 7378, 7158, 6913, 6640, 6337, 6001, 5634, 5231, 4796, 
-    4329, 3833, 3309, 2767, 2206, 1638, 1064, 490, -76, -635, -1181, -1712, -2230, -2730, -3218, -3691, 
-    -4152, -4603, -5046, -5480, -5910, -6332, -6744, -7150, -7539, -7911, -8262, -8586, -8879, -9134, -9351, -9522, 
-    -9648, -9721, -9747, -9721, -9644, -9520, -9352, -9140, -8890, -8605, -8288, -7941, -7568, -7169, -6747, -6301, 
-    -5831, -5339, -4824, -4286, -3727, -3149, -2553, -1942, -1318, -686, -50, 586, 1219, 1845, 2459, 3057, 
-    3638, 4197, 4735, 5248, 5737, 6201, 6639, 7052, 7438, 7797, 8130, 8434, 8708, 8951, 9164, 9342, 
-    9485, 9593, 9664, 9696, 9689, 9643, 9558, 9436, 9277, 9085, 8858, 8602, 8318, 8005, 7668, 7305, 
-    6920, 6509, 6077, 5624, 5149, 4655, 4144, 3618, 3077, 2526, 1967, 1404, 841, 276, -280, -835, 
-    -1381, -1920, -2449, -2967, -3477, -3972, -4457, -4926, -5382, -5819, -6235, -6629, -6997, -7333, -7638, -7910, 
-    -8140, -8332, -8481, -8589, -8654, -8677, -8660, -8605, -8512, -8386, -8228, -8041, -7827, -7588, -7329, -7044, 
-    -6741, -6416, -6072, -5706, -5321, -4916, -4493, -4050, -3592, -3120, -2635, -2143, -1642, -1142, -641, -146, 
-    338, 813, 1271, 1711, 2131, 2530, 2903, 3253, 3578, 3877, 4152, 4405, 4632, 4841, 5027, 5197, 
-    5349, 5485, 5606, 5713, 5804, 5882, 5945, 5990, 6017, 6023, 6007, 5966, 5896, 5800, 5672, 5516, 
-    5330, 5116, 4877, 4614, 4330, 4029, 3714, 3386, 3052, 2709, 2364, 2018, 1669, 1321, 975, 629, 
-    288, -50, -384, -711, -1031, -1342, -1641, -1925, -2195, -2446, -2678, -2889, -3078, -3241, -3381, -3495, 
-    -3583, -3644, -3679, -3686, -3668, -3626, -3559, -3472, -3364, -3239, -3099, -2944, -2779, -2602, -2417, -2221, 
-    -2020, -1809, -1591, -1364, -1133, -893, -650, -405, -158, 86, 327, 561, 786, 999, 1201, 1387, 
-    1561, 1722, 1869, 2006, 2132, 2251, 2358, 2461, 2553, 2637, 2710, 2769, 2813, 2840, 2845, 2829, 
-    2789, 2725, 2636, 2523, 2387, 2228, 2049, 1850, 1634, 1401, 1151, 889, 612, 324, 27, -278, 
-    -590, -905, -1219, -1532, -1836, -2131, -2411, -2677, -2922, -3149, -3355, -3541, -3705, -3852, -3978, -4089, 
-    -4183, -4262, -4325, -4375, -4410, -4429, -4432, -4419, -4387, -4337, -4266, -4175, -4065, -3932, -3780, -3609, 
-    -3418, -3212, -2988, -2750, -2499, -2234, -1957, -1667, -1369, -1058, -736, -406, -64, 285, 645, 1011, 
-    1384, 1762, 2144, 2527, 2910, 3290, 3663, 4029, 4383, 4727, 5054, 5365, 5658, 5929, 6179, 6407, 
-    6607, 6783, 6931, 7051, 7142, 7203, 7234, 7232, 7199, 7133, 7034, 6901, 6738, 6542, 6317, 6065, 
-    5787, 5487, 5167, 4831, 4479, 4118, 3747, 3368, 2985, 2593, 2198, 1796, 1387, 972, 547, 113, 
-    -330, -783, -1245, -1712, -2181, -2651, -3117, -3575, -4022, -4453, -4867, -5261, -5633, -5982, -6309, -6610, 
-    -6890, -7144, -7377, -7585, -7770, -7929, -8060, -8165, -8236, -8277, -8280, -8248, -8178, -8067, -7920, -7734, 
-    -7512, -7255, -6967, -6651, -6308, -5944, -5560, -5159, -4743, -4313, -3873, -3420, -2958, -2486, -2006, -1516, 
-    -1023, -522, -19, 485, 988, 1487, 1979, 2460, 2928, 3380, 3815, 4230, 4622, 4992, 5337, 5656, 
-    5949, 6216, 6456, 6669, 6856, 7019, 7155, 7267, 7356, 7420, 7463, 7481, 7477, 7449, 7397, 7320, 
-    7219, 7091, 6937, 6754, 6543, 6306, 6039, 5744, 5422, 5075, 4702, 4307, 3889, 3455, 3002, 2535, 
-    2059, 1572, 1083, 593, 106, -376, -849, -1310, -1760, -2192, -2611, -3011, -3393, -3757, -4103, -4427, 
-    -4731, -5013, -5269, -5504, -5707, -5883, -6027, -6136, -6213, -6251, -6256, -6223, -6155, -6054, -5922, -5762, 
-    -5575, -5366, -5136, -4889, -4625, -4349, -4062, -3764, -3458, -3143, -2821, -2491, -2155, -1813, -1466, -1116, 
-    -764, -411, -60, 288, 632, 968, 1298, 1618, 1928, 2228, 2516, 2793, 3058, 3312, 3553, 3781, 
-    3997, 4195, 4379, 4544, 4689, 4814, 4912, 4985, 5030, 5045, 5030, 4984, 4908, 4800, 4667, 4503, 
-    4314, 4101, 3866, 3607, 3330, 3035, 2721, 2393, 2050, 1692, 1324, 942, 554, 156, -244, -647, 
-    -1050, -1447, -1838, -2217, -2580, -2928, -3255, -3562, -3845, -4106, -4340, -4554, -4742, -4907, -5053, -5173, 
-    -5275, -5356, -5417, -5457, -5478, -5474, -5449, -5399, -5322, -5218, -5084, -4922, -4730, -4510, -4262, -3991, 
-    -3694, -3381, -3049, -2704, -2351, -1988, -1623, -1253, -883, -511, -139, 232, 610, 986, 1370, 1758, 
-    2153, 2551, 2956, 3364, 3771, 4179, 4579, 4972, 5351, 5712, 6054, 6370, 6658, 6916, 7140, 7329, 
-    7483, 7600, 7682, 7727, 7737, 7711, 7650, 7556, 7427, 7266, 7074, 6849, 6596, 6312, 6001, 5663, 
-    5299, 4909, 4495, 4060, 3600, 3120, 2622, 2103, 1570, 1022, 462, -106, -680, -1257, -1831, -2398, 
-    -2955, -3497, -4016, -4516, -4987, -5430, -5844, -6226, -6579, -6904, -7200, -7472, -7719, -7944, -8147, -8328, 
-    -8489, -8627, -8739, -8828, -8888, -8920, -8918, -8885, -8814, -8711, -8567, -8388, -8173, -7921, -7635, -7316, 
-    -6965, -6585, -6174, -5739, -5279, -4794, -4289, -3765, -3222, -2663, -2091, -1504, -909, -305, 304, 917, 
-    1532, 2145, 2753, 3356, 3946, 4525, 5085, 5626, 6143, 6631, 7090, 7516, 7906, 8260, 8575, 8852, 
-    9090, 9289, 9450, 9577, 9666, 9722, 9748, 9740, 9704, 9638, 9545, 9420, 9269, 9088, 8874, 8632, 
-    8357, 8051, 7711, 7340, 6935, 6498, 6030, 5533, 5007, 4457, 3884, 3292, 2686, 2067, 1442, 813, 
-    187, -435, -1050, -1652, -2242, -2817, -3376, -3916, -4441, -4947, -5434, -5903, -6353, -6782, -7189, -7571, 
-    -7928, -8252, -8545, -8801, -9017, -9194, -9327, -9417, -9461, -9461, -9418, -9333, -9210, -9049, -8855, -8631, 
-    -8375, -8097, -7793, -7468, -7122, -6756, -6371, -5969, -5549, -5111, -4659, -4190, -3709, -3215, -2711, -2198, 
-    -1676, -1149, -619, -84, 450, 983, 1514, 2041, 2559, 3068, 3565, 4046, 4510, 4952, 5370, 5761, 
-    6121, 6448, 6742, 6999, 7220, 7404, 7553, 7665, 7743, 7791, 7807, 7793, 7753, 7686, 7594, 7476, 
-    7333, 7167, 6973, 6753, 6507, 6233, 5934, 5609, 5258, 4885, 4493, 4081, 3656, 3220, 2777, 2329, 
-    1880, 1433, 988, 551, 120, -303, -719, -1126, -1524, -1913, -2293, -2663, -3022, -3370, -3704, -4024, 
-    -4325, -4610, -4872, -5110, -5323, -5509, -5665, -5791, -5885, -5948, -5979, -5981, -5950, -5894, -5809, -5697, 
-    -5564, -5405, -5224, -5025, -4802, -4562, -4302, -4024, -3729, -3416, -3088, -2746, -2389, -2023, -1646, -1264, 
-    -878, -489, -103, 280, 657, 1027, 1387, 1735, 2069, 2388, 2688, 2971, 3234, 3475, 3695, 3891, 
-    4063, 4213, 4337, 4436, 4512, 4564, 4592, 4600, 4585, 4552, 4501, 4431, 4347, 4246, 4131, 4000, 
-    3854, 3693, 3515, 3320, 3108, 2876, 2628, 2361, 2076, 1775, 1459, 1129, 789, 442, 91, -261, 
-    -611, -955, -1293, -1620, -1936, -2239, -2528, -2804, -3065, -3311, -3543, -3762, -3965, -4155, -4328, -4486, 
-    -4625, -4746, -4845, -4920, -4971, -4995, -4993, -4963, -4905, -4819, -4707, -4569, -4406, -4220, -4014, -3786, 
-    -3541, -3279, -3002, -2713, -2411, -2099, -1777, -1447, -1109, -764, -412, -54, 306, 673, 1041, 1410, 
-    1782, 2148, 2514, 2875, 3226, 3571, 3903, 4222, 4525, 4810, 5074, 5317, 5537, 5732, 5901, 6046, 
-    6164, 6255, 6321, 6360, 6372, 6360, 6321, 6258, 6171, 6058, 5922, 5761, 5574, 5366, 5131, 4875, 
-    4594, 4293, 3969, 3627, 3266, 2890, 2498, 2096, 1681, 1261, 836, 407, -20, -446, -868, -1283, 
-    -1693, -2091, -2483, -2862, -3233, -3592, -3940, -4276, -4602, -4912, -5212, -5493, -5760, -6007, -6232, -6437, 
-    -6615, -6767, -6892, -6987, -7051, -7086, -7090, -7064, -7009, -6926, -6814, -6678, -6515, -6328, -6118, -5882, 
-    -5625, -5346, -5045, -4723, -4383, -4023, -3649, -3259, -2857, -2443, -2022, -1596, -1164, -732, -300, 130, 
-    555, 978, 1395, 1805, 2211, 2607, 2995, 3373, 3740, 4093, 4431, 4752, 5050, 5330, 5584, 5813, 
-    6014, 6189, 6335, 6454, 6546, 6614, 6657, 6678, 6677, 6656, 6613, 6553, 6471, 6369, 6245, 6099, 
-    5929, 5734, 5515, 5268, 4996, 4699, 4379, 4037, 3677, 3302, 2916, 2520, 2120, 1720, 1319, 924, 
-    533, 151, -223, -589, -945, -1294, -1633, -1962, -2283, -2592, -2890, -3177, -3450, -3710, -3952, -4178, 
-    -4384, -4571, -4736, -4879, -5001, -5097, -5171, -5222, -5249, -5255, -5238, -5201, -5143, -5066, -4970, -4856, 
-    -4726, -4580, -4417, -4241, -4050, -3847, -3630, -3403, -3165, -2916, -2659, -2395, -2123, -1845, -1562, -1277, 
-    -986, -697, -405, -114, 174, 460, 741, 1017, 1285, 1543, 1792, 2027, 2247, 2455, 2643, 2817, 
-    2971, 3106, 3223, 3322, 3401, 3463, 3507, 3534, 3544, 3539, 3518, 3483, 3432, 3367, 3288, 3194, 
-    3085, 2965, 2829, 2681, 2522, 2350, 2171, 1983, 1787, 1589, 1386, 1182, 978, 774, 574, 376, 
-    183, -4, -187, -364, -536, -701, -860, -1013, -1159, -1298, -1430, -1553, -1671, -1777, -1875, -1965, 
-    -2043, -2110, -2166, -2210, -2241, -2261, -2267, -2258, -2239, -2204, -2156, -2095, -2022, -1935, -1837, -1726, 
-    -1604, -1471, -1328, -1176, -1016, -848, -675, -496, -313, -127, 62, 251, 441, 632, 818, 1005, 
-    1186, 1362, 1534, 1698, 1856, 2004, 2145, 2273, 2392, 2497, 2591, 2671, 2737, 2788, 2824, 2844, 
-    2846, 2832, 2799, 2747, 2676, 2586, 2477, 2348, 2203, 2039, 1860, 1668, 1461, 1245, 1019, 787, 
-    549, 307, 65, -178, -420, -659, -894, -1123, -1347, -1563, -1771, -1968, -2157, -2333, -2496, -2649, 
-    -2786, -2911, -3022, -3119, -3204, -3275, -3333, -3381, -3414, -3438, -3450, -3452, -3443, -3424, -3394, -3355, 
-    -3305, -3244, -3171, -3085, -2989, -2877, -2754, -2616, -2464, -2297, -2116, -1921, -1710, -1486, -1249, -998, 
-    -738, -466, -186, 98, 389, 682, 976, 1269, 1557, 1841, 2116, 2384, 2640, 2886, 3118, 3337, 
-    3542, 3733, 3908, 4070, 4214, 4342, 4453, 4544, 4617, 4668, 4696, 4703, 4684, 4642, 4576, 4486, 
-    4373, 4238, 4082, 3907, 3716, 3511, 3292, 3066, 2829, 2587, 2339, 2087, 1831, 1573, 1311, 1046, 
-    782, 512, 243, -26, -298, -567, -836, -1102, -1363, -1619, -1868, -2110, -2343, -2568, -2784, -2989, 
-    -3187, -3373, -3552, -3718, -3877, -4025, -4161, -4285, -4398, -4494, -4576, -4642, -4689, -4716, -4725, -4711, 
-    -4677, -4621, -4542, -4442, -4321, -4178, -4017, -3835, -3637, -3421, -3190, -2943, -2685, -2414, -2131, -1839, 
-    -1538, -1230, -916, -598, -278, 41, 361, 676, 984, 1288, 1580, 1863, 2133, 2392, 2638, 2869, 
-    3089, 3295, 3486, 3665, 3830, 3978, 4113, 4231, 4331, 4415, 4479, 4523, 4548, 4552, 4534, 4496, 
-    4437, 4359, 4259, 4144, 4010, 3863, 3699, 3524, 3337, 3137, 2931, 2712, 2488, 2257, 2019, 1777, 
-    1532, 1282, 1029, 775, 517, 260, 1, -255, -511, -765, -1016, -1264, -1507, -1745, -1979, -2204, 
-    -2422, -2633, -2833, -3024, -3206, -3374, -3530, -3673, -3802, -3914, -4012, -4090, -4152, -4194, -4218, -4222, 
-    -4208, -4173, -4120, -4049, -3957, -3850, -3724, -3581, -3424, -3248, -3061, -2856, -2641, -2411, -2172, -1920, 
-    -1661, -1391, -1117, -835, -550, -260, 29, 319, 609, 896, 1179, 1457, 1728, 1992, 2244, 2487, 
-    2716, 2933, 3133, 3318, 3485, 3634, 3765, 3877, 3969, 4043, 4096, 4131, 4145, 4142, 4118, 4078, 
-    4018, 3941, 3847, 3734, 3604, 3460, 3297, 3124, 2934, 2734, 2521, 2302, 2073, 1840, 1601, 1361, 
-    1117, 874, 631, 389, 150, -89, -326, -561, -795, -1026, -1255, -1480, -1703, -1918, -2132, -2334, 
-    -2533, -2720, -2899, -3065, -3220, -3361, -3488, -3601, -3699, -3778, -3844, -3889, -3919, -3929, -3922, -3895, 
-    -3853, -3791, -3714, -3617, -3508, -3380, -3239, -3084, -2916, -2736, -2547, -2344, -2137, -1918, -1695, -1463, 
-    -1230, -989, -749, -505, -260, -16, 224, 465, 701, 934, 1157, 1380, 1590, 1797, 1991, 2180, 
-    2357, 2527, 2684, 2835, 2969, 3099, 3211, 3317, 3404, 3485, 3545, 3598, 3628, 3651, 3650, 3641, 
-    3607, 3568, 3502, 3430, 3334, 3230, 3104, 2974, 2819, 2665, 2488, 2316, 2118, 1935, 1722, 1532, 
-    1307, 1119, 878, 714, 
-};
-const unsigned int drum_v2_p4_long_len = 6596;
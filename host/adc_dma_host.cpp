@@ -0,0 +1,139 @@
+/* adc_dma_host.cpp
+   Host stand-in for src/adc_dma.cpp
+
+   A timer at the frame rate plays the PIT: every frame converts the
+   scan's pins (through the input hook, so a trace is sampled at the
+   frame's instant) and the handler runs when a block is full, as the DMA
+   interrupt would. Multiplexed pins read the input the select lines are
+   on for that frame, stepped in the same Gray order as the mux DMA. The
+   conversion time of the ADC chains is not modelled. Frames go into a
+   ring of two blocks as on the device, which adcDmaPoll() reads in
+   polled mode.
+*/
+
+#include "adc_dma.h"
+
+#include <Arduino.h>
+#include "host_sim.h"
+
+static AdcScan frameScan;
+static uint16_t ring[2 * ADC_DMA_MAX_FRAMES * ADC_DMA_MAX_VALUES];
+static AdcBlockHandler blockHandler = nullptr;
+static unsigned int framesPerBlock = 0;
+static unsigned int muxPhase = 0;
+static uint32_t ticksPerFrame = 0;
+static uint32_t startStamp = 0;      // frame k is converted at startStamp + (k + 1) * ticksPerFrame
+static uint64_t framesWritten = 0;
+static uint64_t framesRead = 0;      // polled mode
+static bool polling = false;
+static uint32_t overruns = 0;
+static int pit; // timer owner
+
+static void handOver(uint64_t frame, unsigned int count, AdcBlockHandler handler)
+{
+  SensorBlock block;
+  block.frames = ring + (frame % (2 * framesPerBlock)) * frameScan.values;
+  block.count = count;
+  block.time = startStamp + (uint32_t)(frame + 1) * ticksPerFrame;
+  block.ticksPerFrame = ticksPerFrame;
+  sensorBlockLayout(block);
+  block.stride = frameScan.values;
+  handler(block);
+}
+
+static void frameTick()
+{
+  uint16_t *f = ring + (framesWritten % (2 * framesPerBlock)) * frameScan.values;
+  unsigned int input = adcMuxInput(muxPhase);
+  for (unsigned int s = 0; s < frameScan.values; ++s)
+    f[s] = hostAnalogMuxRead(frameScan.pins[s], input);
+  muxPhase = (muxPhase + 1) & ((1u << frameScan.muxBits) - 1);
+  if (++framesWritten % framesPerBlock || polling)
+    return;
+  handOver(framesWritten - framesPerBlock, framesPerBlock, blockHandler);
+}
+
+static bool beginScan(const AdcScan &scan, uint32_t frameRateHz, unsigned int blockFrames, AdcBlockHandler handler,
+                      bool polled)
+{
+  if (scan.values < 2 || scan.values > ADC_DMA_MAX_VALUES || (scan.values & 1) || scan.muxBits > ADC_MUX_MAX_BITS)
+    return false;
+  for (unsigned int s = 0; s < scan.values; ++s)
+    if (scan.pins[s] < A0 || scan.pins[s] > A0 + 9)
+      return false;
+  if (blockFrames == 0 || blockFrames > ADC_DMA_MAX_FRAMES || blockFrames % (1u << scan.muxBits) ||
+      frameRateHz == 0 || frameRateHz > 100000 || (handler == nullptr && !polled))
+    return false;
+  frameScan = scan;
+  blockHandler = handler;
+  framesPerBlock = blockFrames;
+  muxPhase = 0;
+  ticksPerFrame = F_CPU_ACTUAL / frameRateHz;
+  framesWritten = 0;
+  framesRead = 0;
+  polling = polled;
+  overruns = 0;
+  startStamp = ARM_DWT_CYCCNT;
+  hostTimerAdd(frameTick, ticksPerFrame, &pit);
+  return true;
+}
+
+bool adcDmaBeginScan(const AdcScan &scan, uint32_t frameRateHz, unsigned int blockFrames, AdcBlockHandler handler)
+{
+  return beginScan(scan, frameRateHz, blockFrames, handler, false);
+}
+
+bool adcDmaBeginPolled(const AdcScan &scan, uint32_t frameRateHz, unsigned int blockFrames)
+{
+  return beginScan(scan, frameRateHz, blockFrames, nullptr, true);
+}
+
+unsigned int adcDmaPoll(AdcBlockHandler handler)
+{
+  if (!polling || handler == nullptr)
+    return 0;
+  unsigned int ringFrames = 2 * framesPerBlock;
+  unsigned int cycle = 1u << frameScan.muxBits;
+  if (framesWritten - framesRead > ringFrames)
+  {
+    ++overruns;
+    framesRead = (framesWritten - ringFrames + cycle - 1) & ~(uint64_t)(cycle - 1);
+  }
+  uint64_t end = framesWritten & ~(uint64_t)(cycle - 1);
+  unsigned int n = 0;
+  while (framesRead < end)
+  {
+    unsigned int first = (unsigned int)(framesRead % ringFrames);
+    unsigned int count = ringFrames - first;
+    if (count > end - framesRead)
+      count = (unsigned int)(end - framesRead);
+    if (count > ADC_DMA_MAX_FRAMES)
+      count = ADC_DMA_MAX_FRAMES;
+    handOver(framesRead, count, handler);
+    framesRead += count;
+    n += count;
+  }
+  return n;
+}
+
+bool adcDmaBegin(const uint8_t pins[SENSOR_CHANNELS], uint32_t frameRateHz, unsigned int blockFrames,
+                 AdcBlockHandler handler)
+{
+  AdcScan scan;
+  for (int c = 0; c < SENSOR_CHANNELS; ++c)
+    scan.pins[c] = pins[c];
+  scan.values = SENSOR_CHANNELS;
+  scan.muxBits = 0;
+  return adcDmaBeginScan(scan, frameRateHz, blockFrames, handler);
+}
+
+void adcDmaEnd()
+{
+  hostTimerRemove(&pit);
+  polling = false;
+}
+
+uint32_t adcDmaOverruns()
+{
+  return overruns; // polled mode only: the handler always finishes before the next frame
+}
@@ -0,0 +1,178 @@
+#include <Audio.h>
+#include <string.h>
+#include <vector>
+
+AudioStream *AudioStream::first_update = NULL;
+uint16_t AudioStream::memory_used = 0;
+uint16_t AudioStream::memory_used_max = 0;
+
+static std::vector<audio_block_t *> freeBlocks;
+
+static inline int16_t saturate16(int32_t x)
+{
+  if (x > 32767)
+    return 32767;
+  if (x < -32768)
+    return -32768;
+  return (int16_t)x;
+}
+
+AudioStream::AudioStream(unsigned char ninput, audio_block_t **iqueue)
+    : num_inputs(ninput), inputQueue(iqueue), destination_list(NULL), next_update(NULL)
+{
+  for (int i = 0; i < num_inputs; ++i)
+    inputQueue[i] = NULL;
+  // update order is construction order, as on the Teensy
+  AudioStream **p = &first_update;
+  while (*p)
+    p = &(*p)->next_update;
+  *p = this;
+}
+
+AudioConnection::AudioConnection(AudioStream &source, unsigned char sourceOutput, AudioStream &destination,
+                                 unsigned char destinationInput)
+    : src(source), dst(destination), src_index(sourceOutput), dest_index(destinationInput), next_dest(NULL)
+{
+  AudioConnection **p = &src.destination_list;
+  while (*p)
+    p = &(*p)->next_dest;
+  *p = this;
+}
+
+void AudioStream::initialize_memory(audio_block_t *data, unsigned int num)
+{
+  freeBlocks.clear();
+  for (unsigned int i = num; i > 0; --i)
+  {
+    data[i - 1].ref_count = 0;
+    data[i - 1].memory_pool_index = (uint16_t)(i - 1);
+    freeBlocks.push_back(&data[i - 1]);
+  }
+  memory_used = 0;
+  memory_used_max = 0;
+}
+
+void AudioStream::update_all()
+{
+  for (AudioStream *p = first_update; p; p = p->next_update)
+    p->update();
+}
+
+audio_block_t *AudioStream::allocate(void)
+{
+  if (freeBlocks.empty())
+    return NULL;
+  audio_block_t *block = freeBlocks.back();
+  freeBlocks.pop_back();
+  block->ref_count = 1;
+  if (++memory_used > memory_used_max)
+    memory_used_max = memory_used;
+  return block;
+}
+
+void AudioStream::release(audio_block_t *block)
+{
+  if (block == NULL || block->ref_count == 0)
+    return;
+  if (--block->ref_count == 0)
+  {
+    freeBlocks.push_back(block);
+    --memory_used;
+  }
+}
+
+void AudioStream::transmit(audio_block_t *block, unsigned char index)
+{
+  for (AudioConnection *c = destination_list; c != NULL; c = c->next_dest)
+  {
+    if (c->src_index == index && c->dst.inputQueue[c->dest_index] == NULL)
+    {
+      c->dst.inputQueue[c->dest_index] = block;
+      ++block->ref_count;
+    }
+  }
+}
+
+audio_block_t *AudioStream::receiveReadOnly(unsigned int index)
+{
+  if (index >= num_inputs)
+    return NULL;
+  audio_block_t *in = inputQueue[index];
+  inputQueue[index] = NULL;
+  return in;
+}
+
+audio_block_t *AudioStream::receiveWritable(unsigned int index)
+{
+  audio_block_t *in = receiveReadOnly(index);
+  if (in && in->ref_count > 1)
+  {
+    audio_block_t *p = allocate();
+    if (p)
+      memcpy(p->data, in->data, sizeof(p->data));
+    --in->ref_count;
+    in = p;
+  }
+  return in;
+}
+
+// ------------------- AudioMixer4 -------------------
+// Same arithmetic as the library: 16.16 gain, product >> 16, saturated,
+// then a saturating add into the first connected input.
+void AudioMixer4::gain(unsigned int channel, float gain)
+{
+  if (channel >= 4)
+    return;
+  if (gain > 32767.0f)
+    gain = 32767.0f;
+  else if (gain < -32767.0f)
+    gain = -32767.0f;
+  multiplier[channel] = (int32_t)(gain * 65536.0f);
+}
+
+void AudioMixer4::update(void)
+{
+  audio_block_t *out = NULL;
+  for (unsigned int channel = 0; channel < 4; ++channel)
+  {
+    int32_t mult = multiplier[channel];
+    if (out == NULL)
+    {
+      out = receiveWritable(channel);
+      if (out && mult != 65536)
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; ++i)
+          out->data[i] = saturate16((int32_t)(((int64_t)mult * out->data[i]) >> 16));
+    }
+    else
+    {
+      audio_block_t *in = receiveReadOnly(channel);
+      if (in)
+      {
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; ++i)
+        {
+          int32_t x = in->data[i];
+          if (mult != 65536)
+            x = saturate16((int32_t)(((int64_t)mult * x) >> 16));
+          out->data[i] = saturate16(out->data[i] + x);
+        }
+        release(in);
+      }
+    }
+  }
+  if (out)
+  {
+    transmit(out);
+    release(out);
+  }
+}
+
+// ------------------- AudioOutputI2S -------------------
+void AudioOutputI2S::update(void)
+{
+  static const int16_t silence[AUDIO_BLOCK_SAMPLES] = {0};
+  audio_block_t *left = receiveReadOnly(0);
+  audio_block_t *right = receiveReadOnly(1);
+  hostAudioOutput(left ? left->data : silence, right ? right->data : silence, AUDIO_BLOCK_SAMPLES);
+  release(left);
+  release(right);
+}
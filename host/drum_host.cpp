@@ -0,0 +1,641 @@
+/* drum_host.cpp
+   Runs the firmware (src/main.cpp) on the host stand-ins and measures it
+
+   A deterministic stream of synthetic strikes is fed to the piezo, flex
+   and FSR inputs on the virtual clock. Reported:
+   - throughput: simulated seconds per wall second
+   - latency in samples from a strike to its first sample handed to the
+     I2S output (only strikes that begin in silence can be timed), and
+     the firmware's own per-stage trace (LATENCY_TRACE) in virtual time
+   - detection: strikes detected once, missed or doubled, and hits with
+     no strike (at --roll rates, with --body ringing and --noise, this is
+     the retrigger mask / adaptive threshold check); every strike peaks
+     STRIKE_MIN_OVER over PIEZO_THRESHOLD, so a miss is the detector's
+   - zone: each detected strike's HitEvent::zone against the piezo it was
+     struck on
+   - pitch: each detected strike's HitEvent::pitch against the pitch of
+     the flex position it was struck at
+   - velocity error: each detected hit against the true peak of the
+     strike that caused it (the firmware's PEAK_WINDOW_US trade-off), and
+     with early fire on ("p") the error of the velocity it was fired with
+   - wall time per sensor tick and per audio update on this machine
+   - with more than one pad (PAD_COUNT in src/main.cpp) strikes land on a
+     random pad; a hit only matches a strike on its own pad, and the scan
+     rate each pad gets and the detection per pad are reported
+
+   drum_host [--seconds S] [--rate HITS_PER_S] [--seed N] [--serial] [--trace FILE]
+             [--send TEXT] [--roll HITS_PER_S] [--body FRACTION] [--noise COUNTS]
+             [--xtalk FRACTION] [--calibrate N] [--learn]
+
+   --trace writes the synthetic sensor stream as a trace (CSV, or binary
+   for a .bin name) that drum_render can replay.
+   --send is serial input given to the firmware at boot (e.g. "w" for
+   the next peak window).
+   --roll strikes evenly at this rate (3 % jitter) instead of at random
+   --body adds a drum shell ring (BODY_FREQ_HZ, BODY_TAU_US) at this
+   fraction of the strike, the ringing a retrigger mask has to ignore
+   --noise adds uniform 0..COUNTS noise to both piezos and +-COUNTS/2 to
+   the flex
+   --xtalk makes center strikes reach the rim piezo at this fraction
+   (XTALK_SPREAD either way per strike, a shell-mounted rim piezo hears
+   the head well) and the other piezo XTALK_DELAY_US late; without it
+   both piezos see STRIKE_CROSSTALK of the other's strikes at once
+   --calibrate N starts with N center and N rim strikes and the 'x'
+   commands around them, so the firmware measures the crosstalk first
+   --learn then runs the 'c' sensor calibration: a quiet pad, LEARN_STRIKES
+   hard strikes, a flex sweep end to end and FSR presses, one step per
+   'c', so the rest of the run plays on the learned profile
+   Only pad 0 goes to the trace, the other pads are not recorded.
+*/
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <deque>
+#include <utility>
+#include <vector>
+#include "drum_mapping.h"
+#include "adc_dma.h"
+#include "hit_detector.h"
+#include "latency_trace.h"
+#include "host_sim.h"
+#include "pad_array.h"
+#include "sensor_trace.h"
+
+#define STRIKE_TAU_US 1500.0  // piezo ring-down
+#define STRIKE_FREQ_HZ 700.0  // piezo ring frequency
+#define STRIKE_MIN_GAP_MS 30  // random strikes; --roll goes closer
+#define STRIKE_CROSSTALK 0.35 // other piezo sees this fraction
+#define STRIKE_PEAK_MAX 4000  // random strikes' amplitude, up to
+#define STRIKE_MIN_OVER 1.1   // the weakest strike peaks this far over PIEZO_THRESHOLD
+#define SILENCE_BEFORE 32     // samples of silence needed before a strike to time it
+#define MATCH_WINDOW_US 5000  // a hit this long after a strike's start belongs to it
+#define BODY_FREQ_HZ 180.0    // --body shell mode
+#define BODY_TAU_US 40000.0
+#define ROLL_JITTER 0.03
+#define XTALK_SPREAD 0.25    // --xtalk: per-strike crosstalk varies this much either way
+#define XTALK_DELAY_US 100.0 // --xtalk: the wave reaches the other piezo this late
+#define CAL_RATE 4.0         // --calibrate strikes per second
+#define CAL_GAP_S 2.5        // between the phases (loop() reads serial every 2 s)
+#define LEARN_STRIKES 8      // --learn: hard strikes in the strike step
+#define LEARN_STEP_S 2.0     // --learn: length of each step's activity
+#define LEARN_PRESS_S 0.25   // --learn: FSR pressed / released this long each
+
+extern HitDetector &detector; // src/main.cpp
+extern PadArray pads;
+extern AdcScan sensorScan;
+extern const uint32_t sensorFrameRateHz;
+extern LatencyTrace latencyTrace;
+
+struct Strike
+{
+  uint64_t at; // cycles
+  uint16_t peak;
+  uint8_t rim;
+  uint8_t pad;
+  uint16_t flex;
+  bool damped;
+  bool calibration; // --calibrate strike, zone forced by the firmware
+  double xtalk;     // fraction the other piezo sees
+};
+
+struct LatencyStats
+{
+  uint32_t count;
+  double min, max, sum;
+};
+
+struct VelocityStats
+{
+  uint32_t count;
+  uint32_t hidden; // several hits in one sensor block: only the last is visible
+  double sum, sumAbs, sumRel, maxAbs;
+
+  void add(double err, double truth)
+  {
+    sum += err;
+    sumAbs += fabs(err);
+    sumRel += fabs(err) / truth;
+    if (fabs(err) > maxAbs)
+      maxAbs = fabs(err);
+    ++count;
+  }
+  void print(const char *name) const
+  {
+    printf("%s: n=%u bias=%+.1f mean|err|=%.1f (%.1f%%) max|err|=%.0f", name, count, sum / count, sumAbs / count,
+           100.0 * sumRel / count, maxAbs);
+  }
+};
+
+struct Sim
+{
+  std::vector<Strike> strikes;
+  size_t next;                 // first strike not yet over
+  std::deque<size_t> pending;  // strikes waiting for their first output sample
+  uint64_t samplesOut;
+  uint64_t zeroRun; // consecutive silent output samples
+  LatencyStats latency;
+  uint32_t untimed;
+  uint32_t hitsSeen[PAD_MAX];
+  size_t matched[PAD_MAX]; // latest strike on the pad that started before its last hit
+  double peakFactor;  // max of exp(-t / tau) * |sin(w t)|
+  VelocityStats velocity;
+  VelocityStats estimate; // velocity the hit was fired with, early fire only
+  std::vector<uint8_t> hitsPerStrike;
+  uint32_t falseHits; // hits with no strike just before them
+  uint32_t zoneRight;
+  uint32_t zoneWrong[2]; // per struck zone
+  uint32_t pitchRight;
+  uint32_t pitchWrong;
+  double xtalk;          // --xtalk, 0 = symmetric STRIKE_CROSSTALK
+  std::vector<std::pair<uint64_t, const char *>> commands; // serial input at a time
+  uint64_t sweepStart, sweepEnd; // --learn: flex swept end to end and back
+  uint64_t pressStart, pressEnd; // --learn: FSR pressed and released
+  double body;
+  double noise;
+  uint32_t noiseState;
+  bool record;
+  std::vector<TraceFrame> trace;
+};
+
+static uint32_t rngState;
+
+static uint32_t rng()
+{
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+static double rngUniform()
+{
+  return (rng() >> 8) / 16777216.0;
+}
+
+static double strikeCrosstalk(const Sim &sim, bool rim)
+{
+  if (sim.xtalk <= 0)
+    return STRIKE_CROSSTALK;
+  double x = rim ? STRIKE_CROSSTALK : sim.xtalk;
+  return x * (1.0 + XTALK_SPREAD * (2.0 * rngUniform() - 1.0));
+}
+
+static double strikeShape(double us)
+{
+  return exp(-us / STRIKE_TAU_US) * fabs(sin(2 * M_PI * STRIKE_FREQ_HZ * us * 1e-6));
+}
+
+// A random strike amplitude whose piezo peak (amplitude * peakFactor)
+// clears PIEZO_THRESHOLD, so a strike missed is the detector's miss
+static uint16_t strikePeak(const Sim &sim)
+{
+  uint16_t weakest = (uint16_t)ceil(PIEZO_THRESHOLD * STRIKE_MIN_OVER / sim.peakFactor);
+  return (uint16_t)(weakest + rng() % (STRIKE_PEAK_MAX - weakest));
+}
+
+// `calibrate` strikes on the center, then on the rim, each phase
+// bracketed by the 'x' that starts and ends it
+static double makeCalibration(Sim &sim, int calibrate)
+{
+  double t = CAL_GAP_S;
+  sim.commands.push_back(std::make_pair(0, "x"));
+  for (uint8_t rim = 0; rim < 2; ++rim)
+  {
+    for (int i = 0; i < calibrate; ++i, t += 1.0 / CAL_RATE)
+    {
+      Strike s;
+      s.at = hostUsToCycles(t * 1e6);
+      s.peak = strikePeak(sim);
+      s.rim = rim;
+      s.pad = 0;
+      s.flex = 250;
+      s.damped = false;
+      s.calibration = true;
+      s.xtalk = strikeCrosstalk(sim, rim);
+      sim.strikes.push_back(s);
+    }
+    sim.commands.push_back(std::make_pair(hostUsToCycles(t * 1e6), "x"));
+    t += CAL_GAP_S;
+  }
+  return t;
+}
+
+// The four steps of the 'c' sensor calibration from `t`, each one's
+// activity CAL_GAP_S after the 'c' that starts it
+static double makeLearn(Sim &sim, double t)
+{
+  sim.commands.push_back(std::make_pair(hostUsToCycles(t * 1e6), "c")); // quiet
+  t += CAL_GAP_S + LEARN_STEP_S;
+  sim.commands.push_back(std::make_pair(hostUsToCycles(t * 1e6), "c")); // strikes
+  t += CAL_GAP_S;
+  for (int i = 0; i < LEARN_STRIKES; ++i)
+  {
+    Strike s;
+    s.at = hostUsToCycles((t + i * LEARN_STEP_S / LEARN_STRIKES) * 1e6);
+    s.peak = (uint16_t)(3000 + rng() % 1000);
+    s.rim = i & 1;
+    s.pad = 0;
+    s.flex = 250;
+    s.damped = false;
+    s.calibration = true;
+    s.xtalk = strikeCrosstalk(sim, s.rim);
+    sim.strikes.push_back(s);
+  }
+  t += LEARN_STEP_S;
+  sim.commands.push_back(std::make_pair(hostUsToCycles(t * 1e6), "c")); // flex
+  t += CAL_GAP_S;
+  sim.sweepStart = hostUsToCycles(t * 1e6);
+  sim.sweepEnd = hostUsToCycles((t + LEARN_STEP_S) * 1e6);
+  t += LEARN_STEP_S;
+  sim.commands.push_back(std::make_pair(hostUsToCycles(t * 1e6), "c")); // FSR
+  t += CAL_GAP_S;
+  sim.pressStart = hostUsToCycles(t * 1e6);
+  sim.pressEnd = hostUsToCycles((t + LEARN_STEP_S) * 1e6);
+  t += LEARN_STEP_S;
+  sim.commands.push_back(std::make_pair(hostUsToCycles(t * 1e6), "c")); // learn and save
+  return t + CAL_GAP_S;
+}
+
+static void makeStrikes(Sim &sim, double seconds, double rate, bool roll, int calibrate, bool learn,
+                        unsigned int padCount)
+{
+  double t = calibrate > 0 ? makeCalibration(sim, calibrate) : 0.1;
+  if (learn)
+    t = makeLearn(sim, t);
+  for (;;)
+  {
+    double gap = -log(1.0 - rngUniform()) / rate;
+    if (roll)
+      gap = (1.0 + ROLL_JITTER * (2.0 * rngUniform() - 1.0)) / rate;
+    else if (gap < STRIKE_MIN_GAP_MS * 0.001)
+      gap = STRIKE_MIN_GAP_MS * 0.001;
+    t += gap;
+    if (t > seconds - 0.05)
+      break;
+    Strike s;
+    s.at = hostUsToCycles(t * 1e6);
+    s.peak = strikePeak(sim);
+    s.rim = (rng() % 4) == 0;
+    s.flex = (uint16_t)(250 + rng() % 3550);
+    s.damped = (rng() % 5) == 0;
+    s.pad = padCount > 1 ? (uint8_t)(rng() % padCount) : 0;
+    s.calibration = false;
+    s.xtalk = strikeCrosstalk(sim, s.rim);
+    sim.strikes.push_back(s);
+  }
+  // calibration strikes the run ends before (or too close after) are not played
+  uint64_t last = hostUsToCycles((seconds - 0.05) * 1e6);
+  while (!sim.strikes.empty() && sim.strikes.back().at > last)
+    sim.strikes.pop_back();
+  sim.hitsPerStrike.assign(sim.strikes.size(), 0);
+}
+
+// A hit reported since the last call: compare its velocity with the peak
+// of the strike it belongs to on the strike's own piezo
+static void checkPadHits(Sim &sim, uint64_t cycles, unsigned int pad)
+{
+  const HitDetector &d = pads.pad(pad);
+  uint32_t count = d.hitCount();
+  if (count == sim.hitsSeen[pad])
+    return;
+  VelocityStats &v = sim.velocity;
+  v.hidden += count - sim.hitsSeen[pad] - 1;
+  sim.hitsSeen[pad] = count;
+  const HitEvent &hit = d.lastHit();
+  uint64_t at = cycles - (uint32_t)((uint32_t)cycles - hit.time);
+  size_t &m = sim.matched[pad];
+  for (size_t j = m + 1; j < sim.strikes.size() && sim.strikes[j].at <= at; ++j)
+    if (sim.strikes[j].pad == pad)
+      m = j;
+  const Strike &s = sim.strikes[m];
+  if (s.pad != pad || s.at > at || at - s.at > hostUsToCycles(MATCH_WINDOW_US))
+  {
+    ++sim.falseHits;
+    return;
+  }
+  if (sim.hitsPerStrike[m]++ != 0)
+    return;
+  if (!s.calibration)
+  {
+    if (hit.zone == s.rim)
+      ++sim.zoneRight;
+    else
+      ++sim.zoneWrong[s.rim];
+    if (hit.pitch == flexToPitchQ8(s.flex))
+      ++sim.pitchRight;
+    else
+      ++sim.pitchWrong;
+  }
+  double truth = s.peak * sim.peakFactor;
+  if (truth > 4095)
+    truth = 4095;
+  v.add(hit.velocity - truth, truth);
+  if (hit.flags & HIT_FLAG_CORRECTION)
+    sim.estimate.add(d.lastEstimate() - truth, truth);
+}
+
+// A pad's piezo: on its own pin, or on its mux input of a shared one
+static void setPadInput(unsigned int pad, uint8_t slot, double value)
+{
+  const PadInput &in = pads.padLayout().input[pad];
+  uint16_t v = (uint16_t)(value > 4095 ? 4095 : value);
+  if (in.phase == PAD_EVERY_FRAME)
+    hostSetAnalog(sensorScan.pins[slot], v);
+  else
+    hostSetAnalogMux(sensorScan.pins[slot], adcMuxInput(in.phase), v);
+}
+
+// Sensor values at `cycles`: sum of the ringing strikes
+static void inputHook(uint64_t cycles, void *ctx)
+{
+  Sim &sim = *(Sim *)ctx;
+  unsigned int padCount = pads.pads();
+  for (unsigned int p = 0; p < padCount; ++p)
+    checkPadHits(sim, cycles, p);
+  double centers[PAD_MAX] = {}, rims[PAD_MAX] = {};
+  uint16_t flex = 250;
+  bool damped = false;
+  while (sim.next < sim.strikes.size() &&
+         cycles > sim.strikes[sim.next].at + hostUsToCycles((sim.body > 0 ? BODY_TAU_US : STRIKE_TAU_US) * 12))
+    ++sim.next;
+  for (size_t i = sim.next; i < sim.strikes.size() && sim.strikes[i].at <= cycles; ++i)
+  {
+    const Strike &s = sim.strikes[i];
+    double us = (cycles - s.at) * 1e6 / F_CPU;
+    double v = s.peak * strikeShape(us);
+    if (sim.body > 0)
+      v += s.peak * sim.body * exp(-us / BODY_TAU_US) * fabs(sin(2 * M_PI * BODY_FREQ_HZ * us * 1e-6));
+    double far = v;
+    if (sim.xtalk > 0)
+    {
+      far = 0;
+      if (us > XTALK_DELAY_US)
+        far = s.peak * strikeShape(us - XTALK_DELAY_US);
+    }
+    centers[s.pad] += s.rim ? far * s.xtalk : v;
+    rims[s.pad] += s.rim ? v : far * s.xtalk;
+  }
+  double &center = centers[0], &rim = rims[0];
+  // flex and FSR hold the state of the latest strike
+  for (size_t i = sim.next; i < sim.strikes.size() && sim.strikes[i].at <= cycles + hostUsToCycles(50000); ++i)
+  {
+    flex = sim.strikes[i].flex;
+    damped = sim.strikes[i].damped;
+  }
+  if (cycles >= sim.sweepStart && cycles < sim.sweepEnd)
+  {
+    double phase = (double)(cycles - sim.sweepStart) / (sim.sweepEnd - sim.sweepStart);
+    flex = (uint16_t)(250 + 3550 * (1.0 - fabs(2.0 * phase - 1.0)));
+  }
+  if (cycles >= sim.pressStart && cycles < sim.pressEnd)
+    damped = (cycles - sim.pressStart) / hostUsToCycles(LEARN_PRESS_S * 1e6) % 2 == 0;
+  double flexIn = flex - 0.5 * sim.noise; // centred, the piezos' is rectified
+  if (sim.noise > 0)
+  {
+    for (double *ch : {&center, &rim, &flexIn})
+    {
+      sim.noiseState ^= sim.noiseState << 13;
+      sim.noiseState ^= sim.noiseState >> 17;
+      sim.noiseState ^= sim.noiseState << 5;
+      *ch += sim.noise * ((sim.noiseState >> 8) / 16777216.0);
+    }
+  }
+  TraceFrame fr;
+  fr.timeUs = (uint32_t)(cycles / (F_CPU / 1000000));
+  fr.value[SENSOR_PIEZO_CENTER] = (uint16_t)(center > 4095 ? 4095 : center);
+  fr.value[SENSOR_PIEZO_RIM] = (uint16_t)(rim > 4095 ? 4095 : rim);
+  fr.value[SENSOR_FLEX] = (uint16_t)(flexIn > 4095 ? 4095 : flexIn);
+  fr.value[SENSOR_FSR] = damped ? 2000 : 100;
+  traceApply(fr);
+  if (sim.record)
+    sim.trace.push_back(fr);
+
+  // the other pads after pad 0, which shares their pins behind a mux
+  for (unsigned int p = 1; p < padCount; ++p)
+  {
+    const PadInput &in = pads.padLayout().input[p];
+    for (double *ch : {&centers[p], &rims[p]})
+    {
+      if (sim.noise <= 0)
+        break;
+      sim.noiseState ^= sim.noiseState << 13;
+      sim.noiseState ^= sim.noiseState >> 17;
+      sim.noiseState ^= sim.noiseState << 5;
+      *ch += sim.noise * ((sim.noiseState >> 8) / 16777216.0);
+    }
+    setPadInput(p, in.center, centers[p]);
+    if (in.rim != SENSOR_NO_SLOT)
+      setPadInput(p, in.rim, rims[p]);
+  }
+}
+
+// First non-zero output sample after a strike that began in silence;
+// strikes over a ringing voice are only counted
+static void audioSink(const int16_t *left, const int16_t *right, unsigned int n, uint64_t cycles, void *ctx)
+{
+  (void)right;
+  (void)cycles;
+  Sim &sim = *(Sim *)ctx;
+  for (unsigned int i = 0; i < n; ++i, ++sim.samplesOut)
+  {
+    while (!sim.pending.empty())
+    {
+      const Strike &s = sim.strikes[sim.pending.front()];
+      double at = hostCyclesToSamples(s.at);
+      if (sim.samplesOut < at)
+        break;
+      bool superseded = sim.pending.size() > 1 && sim.samplesOut >= hostCyclesToSamples(sim.strikes[sim.pending[1]].at);
+      bool silent = sim.zeroRun >= sim.samplesOut - (uint64_t)at + SILENCE_BEFORE;
+      if (superseded || !silent)
+      {
+        ++sim.untimed;
+        sim.pending.pop_front();
+        continue;
+      }
+      if (left[i] == 0)
+        break;
+      double lat = sim.samplesOut - at;
+      LatencyStats &l = sim.latency;
+      if (l.count == 0 || lat < l.min)
+        l.min = lat;
+      if (l.count == 0 || lat > l.max)
+        l.max = lat;
+      l.sum += lat;
+      ++l.count;
+      sim.pending.pop_front();
+    }
+    sim.zeroRun = left[i] == 0 ? sim.zeroRun + 1 : 0;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  double seconds = 60.0;
+  double rate = 2.0;
+  bool serial = false;
+  const char *tracePath = NULL;
+  const char *send = NULL;
+  bool roll = false;
+  int calibrate = 0;
+  bool learn = false;
+  static Sim sim;
+  sim.noiseState = 0x9e3779b9u;
+  rngState = 12345;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (!strcmp(argv[i], "--seconds") && i + 1 < argc)
+      seconds = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--rate") && i + 1 < argc)
+      rate = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--seed") && i + 1 < argc)
+      rngState = (uint32_t)strtoul(argv[++i], NULL, 0) | 1;
+    else if (!strcmp(argv[i], "--serial"))
+      serial = true;
+    else if (!strcmp(argv[i], "--trace") && i + 1 < argc)
+      tracePath = argv[++i];
+    else if (!strcmp(argv[i], "--send") && i + 1 < argc)
+      send = argv[++i];
+    else if (!strcmp(argv[i], "--roll") && i + 1 < argc)
+      rate = atof(argv[++i]), roll = true;
+    else if (!strcmp(argv[i], "--body") && i + 1 < argc)
+      sim.body = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--noise") && i + 1 < argc)
+      sim.noise = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--xtalk") && i + 1 < argc)
+      sim.xtalk = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--calibrate") && i + 1 < argc)
+      calibrate = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--learn"))
+      learn = true;
+    else
+    {
+      fprintf(stderr,
+              "usage: %s [--seconds S] [--rate HITS_PER_S] [--seed N] [--serial] [--trace FILE] [--send TEXT]\n"
+              "          [--roll HITS_PER_S] [--body FRACTION] [--noise COUNTS] [--xtalk FRACTION]\n"
+              "          [--calibrate N] [--learn]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+
+  sim.record = tracePath != NULL;
+  hostSetSerialEcho(serial);
+  hostSetInputHook(inputHook, &sim);
+  hostSetAudioSink(audioSink, &sim);
+  if (send)
+    hostSerialInput(send);
+
+  // strikes after boot: they are spread over the pads the firmware has
+  // (the boot frame is the idle pad)
+  auto t0 = std::chrono::steady_clock::now();
+  hostBoot();
+  for (double us = 0; us < STRIKE_TAU_US * 2; us += 0.5)
+    sim.peakFactor = fmax(sim.peakFactor, strikeShape(us));
+  makeStrikes(sim, seconds, rate > 0 ? rate : 1.0, roll, calibrate, learn, pads.pads());
+  size_t queued = 0;
+  size_t command = 0;
+  uint64_t end = hostUsToCycles(seconds * 1e6);
+  while (hostNow() < end)
+  {
+    uint64_t step = hostNow() + hostUsToCycles(10000);
+    while (queued < sim.strikes.size() && sim.strikes[queued].at < step)
+      sim.pending.push_back(queued++);
+    while (command < sim.commands.size() && sim.commands[command].first < step)
+      hostSerialInput(sim.commands[command++].second);
+    hostRun(step < end ? step : end);
+  }
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+  const HostStats &st = hostStats();
+  printf("simulated %.1f s in %.3f s wall (%.1fx real time)\n", seconds, wall, seconds / wall);
+  // one per hit on every pad (the estimate's correction, not the estimate);
+  // not the LogTask notifications, which the bare-metal build has none of
+  unsigned long long detected = 0;
+  for (unsigned int p = 0; p < pads.pads(); ++p)
+    detected += pads.pad(p).hitCount();
+  printf("strikes %zu, hits detected %llu\n", sim.strikes.size(), detected);
+  uint32_t once = 0, missed = 0, doubled = 0, extra = 0;
+  for (uint8_t n : sim.hitsPerStrike)
+  {
+    once += n == 1;
+    missed += n == 0;
+    doubled += n > 1;
+    extra += n > 1 ? n - 1 : 0;
+  }
+  printf("detection: once %u, missed %u, doubled %u (%u extra hits), false hits %u\n", once, missed, doubled, extra,
+         sim.falseHits);
+  if (pads.droppedHits() || adcDmaOverruns())
+    printf("sensor DMA overruns %lu, hits dropped (block hit buffer full) %lu\n", (unsigned long)adcDmaOverruns(),
+           (unsigned long)pads.droppedHits());
+  if (pads.pads() > 1)
+  {
+    const PadLayout &pl = pads.padLayout();
+    printf("pads %u, %u values per frame, %u-way mux: each piezo scanned at %u Hz\n", pl.pads, pl.frameValues,
+           pl.muxWays, (unsigned)pads.padRate(pl.pads - 1, sensorFrameRateHz));
+    printf("per pad (detected once / strikes):");
+    for (unsigned int p = 0; p < pl.pads; ++p)
+    {
+      uint32_t struck = 0, hit = 0;
+      for (size_t i = 0; i < sim.strikes.size(); ++i)
+        if (sim.strikes[i].pad == p)
+          ++struck, hit += sim.hitsPerStrike[i] == 1;
+      printf(" %u/%u", hit, struck);
+    }
+    printf("\n");
+  }
+  uint32_t zoned = sim.zoneRight + sim.zoneWrong[0] + sim.zoneWrong[1];
+  if (zoned)
+    printf("zone: %u of %u right (%.1f%%), center strikes called rim %u, rim strikes called center %u\n", sim.zoneRight, zoned,
+           100.0 * sim.zoneRight / zoned, sim.zoneWrong[0], sim.zoneWrong[1]);
+  if (zoned)
+    printf("pitch: %u of %u at the strike's flex position (%.1f%%)\n", sim.pitchRight, zoned,
+           100.0 * sim.pitchRight / zoned);
+  const LatencyStats &l = sim.latency;
+  if (l.count)
+    printf("strike -> I2S latency (samples): n=%u min=%.1f mean=%.1f max=%.1f (%u overlapping strikes untimed)\n",
+           l.count, l.min, l.sum / l.count, l.max, sim.untimed);
+  // the virtual clock stands still inside an audio update, so dequeue,
+  // lookup and rendered coincide here; on the Teensy they split the update
+  if (latencyTrace.stage[TRACE_I2S].count)
+  {
+    printf("firmware latency trace (us from the crossing, min/p50/p99/max):\n");
+    for (int s = 0; s < TRACE_STAGES; ++s)
+    {
+      const TraceHistogram &h = latencyTrace.stage[s];
+      double us = 1e6 / F_CPU;
+      printf("  %-9s n=%u %.1f/%.1f/%.1f/%.1f\n", traceStageName((TraceStage)s), h.count, h.min * us,
+             tracePercentile(h, 500) * us, tracePercentile(h, 990) * us, h.max * us);
+    }
+  }
+  const VelocityStats &v = sim.velocity;
+  printf("peak window %u us, early fire %s: ", (unsigned)detector.peakWindow(),
+         detector.predictSamples() ? "on" : "off");
+  if (v.count)
+    v.print("velocity - true peak");
+  printf(" (%u hits hidden)\n", v.hidden);
+  if (sim.estimate.count)
+  {
+    sim.estimate.print("  fired with (estimate) - true peak");
+    printf("\n");
+  }
+  double blockUs = AUDIO_BLOCK_SAMPLES * 1e6 / AUDIO_SAMPLE_RATE_EXACT;
+  if (st.audioUpdates)
+    printf("audio update: mean %.2f us, max %.2f us per %d-sample block (%.2f%% of %.0f us)\n",
+           st.audioNs * 1e-3 / st.audioUpdates, st.audioMaxNs * 1e-3, AUDIO_BLOCK_SAMPLES,
+           100.0 * st.audioNs * 1e-3 / st.audioUpdates / blockUs, blockUs);
+  if (st.timerInterrupts)
+    printf("sensor tick: mean %.3f us, max %.2f us (%.3f%% of the simulated time)\n",
+           st.timerNs * 1e-3 / st.timerInterrupts, st.timerMaxNs * 1e-3, 100.0 * st.timerNs * 1e-9 / seconds);
+  if (tracePath && !traceSave(tracePath, sim.trace))
+  {
+    fprintf(stderr, "cannot write %s\n", tracePath);
+    return 1;
+  }
+  fflush(stdout);
+  return 0;
+}
@@ -0,0 +1,166 @@
+/* drum_render.cpp
+   Offline renderer: a recorded sensor trace through the firmware to a WAV
+
+   The trace (see sensor_trace.h) is presented to the ADC pins and
+   src/main.cpp runs unchanged on the host stand-ins: sensor frames at
+   SENSOR_FRAME_RATE_HZ, LogTask, the audio update. The WAV is the
+   stereo stream handed to the I2S output, sample for sample what the
+   device would play for the same input.
+
+   drum_render TRACE [-o OUT.wav] [--tail SECONDS] [--serial] [--send TEXT]
+                     [--compare GOLDEN.wav]
+
+   --send     serial input given to the firmware at boot (e.g. "i" to
+              render with the next interpolation mode)
+   --compare  golden-file check: exit status 1 unless the render matches
+              GOLDEN.wav exactly
+
+   Golden files are renders of a trace from a known-good build; re-render
+   after a change and --compare to see whether the output moved.
+*/
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "host_sim.h"
+#include "pad_array.h"
+#include "sensor_trace.h"
+#include "wav_file.h"
+
+extern PadArray pads; // src/main.cpp
+
+struct Render
+{
+  std::vector<TraceFrame> frames;
+  size_t frame;
+  WavData wav;
+};
+
+static void inputHook(uint64_t cycles, void *ctx)
+{
+  Render &r = *(Render *)ctx;
+  while (r.frame + 1 < r.frames.size() && hostUsToCycles(r.frames[r.frame + 1].timeUs) <= cycles)
+    ++r.frame;
+  traceApply(r.frames[r.frame]);
+}
+
+static void audioSink(const int16_t *left, const int16_t *right, unsigned int n, uint64_t cycles, void *ctx)
+{
+  (void)cycles;
+  Render &r = *(Render *)ctx;
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    r.wav.samples.push_back(left[i]);
+    r.wav.samples.push_back(right[i]);
+  }
+}
+
+static int compareGolden(const WavData &out, const char *path)
+{
+  WavData golden;
+  if (!wavRead(path, golden))
+  {
+    fprintf(stderr, "cannot read %s\n", path);
+    return 1;
+  }
+  if (golden.channels != out.channels || golden.sampleRate != out.sampleRate)
+  {
+    printf("golden: FAIL (format %u ch %u Hz, render %u ch %u Hz)\n", golden.channels, golden.sampleRate,
+           out.channels, out.sampleRate);
+    return 1;
+  }
+  size_t n = golden.samples.size() < out.samples.size() ? golden.samples.size() : out.samples.size();
+  size_t diffs = 0, first = 0;
+  int maxDiff = 0;
+  for (size_t i = 0; i < n; ++i)
+  {
+    int d = abs(golden.samples[i] - out.samples[i]);
+    if (d == 0)
+      continue;
+    if (diffs++ == 0)
+      first = i;
+    if (d > maxDiff)
+      maxDiff = d;
+  }
+  if (diffs == 0 && golden.samples.size() == out.samples.size())
+  {
+    printf("golden: match (%zu frames)\n", n / out.channels);
+    return 0;
+  }
+  printf("golden: FAIL, %zu samples differ (first at frame %zu, max diff %d), length %zu vs %zu frames\n", diffs,
+         first / out.channels, maxDiff, out.samples.size() / out.channels, golden.samples.size() / golden.channels);
+  return 1;
+}
+
+int main(int argc, char **argv)
+{
+  const char *tracePath = NULL;
+  const char *outPath = "render.wav";
+  const char *golden = NULL;
+  const char *send = NULL;
+  double tail = 1.0;
+  bool serial = false;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (!strcmp(argv[i], "-o") && i + 1 < argc)
+      outPath = argv[++i];
+    else if (!strcmp(argv[i], "--tail") && i + 1 < argc)
+      tail = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--compare") && i + 1 < argc)
+      golden = argv[++i];
+    else if (!strcmp(argv[i], "--send") && i + 1 < argc)
+      send = argv[++i];
+    else if (!strcmp(argv[i], "--serial"))
+      serial = true;
+    else if (argv[i][0] != '-' && tracePath == NULL)
+      tracePath = argv[i];
+    else
+      tracePath = NULL, i = argc;
+  }
+  if (tracePath == NULL)
+  {
+    fprintf(stderr,
+            "usage: %s TRACE [-o OUT.wav] [--tail SECONDS] [--serial] [--send TEXT] [--compare GOLDEN.wav]\n",
+            argv[0]);
+    return 2;
+  }
+
+  static Render r;
+  std::string error;
+  if (!traceLoad(tracePath, r.frames, error))
+  {
+    fprintf(stderr, "%s: %s\n", tracePath, error.c_str());
+    return 2;
+  }
+  r.frame = 0;
+  r.wav.sampleRate = (uint32_t)AUDIO_SAMPLE_RATE_EXACT;
+  r.wav.channels = 2;
+
+  hostSetSerialEcho(serial);
+  hostSetInputHook(inputHook, &r);
+  hostSetAudioSink(audioSink, &r);
+  if (send)
+    hostSerialInput(send);
+
+  double seconds = r.frames.back().timeUs * 1e-6 + tail;
+  auto t0 = std::chrono::steady_clock::now();
+  hostBoot();
+  hostRun(hostUsToCycles(seconds * 1e6));
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+  if (!wavWrite(outPath, r.wav))
+  {
+    fprintf(stderr, "cannot write %s\n", outPath);
+    return 2;
+  }
+  unsigned long long hits = 0;
+  for (unsigned int p = 0; p < pads.pads(); ++p)
+    hits += pads.pad(p).hitCount();
+  printf("%s: %zu frames, %.2f s -> %s, %llu hits, rendered %.1fx real time\n", tracePath, r.frames.size(), seconds,
+         outPath, hits, seconds / (wall > 0 ? wall : 1e-9));
+  fflush(stdout);
+  return golden ? compareGolden(r.wav, golden) : 0;
+}
@@ -0,0 +1,188 @@
+#include <FreeRTOS.h>
+#include <task.h>
+#include <Arduino.h>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "host_tasks.h"
+
+enum HostTaskState
+{
+  TASK_READY,
+  TASK_WAIT_NOTIFY,
+  TASK_DELAYED,
+  TASK_DONE
+};
+
+struct HostTask
+{
+  TaskFunction_t code;
+  void *parameters;
+  UBaseType_t priority;
+  std::string name;
+  HostTaskState state;
+  uint32_t notify;
+  uint64_t wakeAt;
+};
+
+#define CYCLES_PER_TICK (F_CPU / configTICK_RATE_HZ)
+
+// Never destroyed: blocked task threads still reference them at exit.
+static std::mutex &baton = *new std::mutex;
+static std::condition_variable &turn = *new std::condition_variable;
+static std::vector<HostTask *> tasks;
+static HostTask *running = nullptr; // nullptr: the scheduler (interrupts, setup) has control
+static thread_local HostTask *self = nullptr;
+static uint64_t switches = 0;
+static uint64_t notifications = 0;
+
+// Give control back to the scheduler and sleep until it picks this task again
+static void suspendSelf()
+{
+  std::unique_lock<std::mutex> lock(baton);
+  running = nullptr;
+  turn.notify_all();
+  turn.wait(lock, [] { return running == self; });
+}
+
+static void taskEntry(HostTask *task)
+{
+  self = task;
+  {
+    std::unique_lock<std::mutex> lock(baton);
+    turn.wait(lock, [task] { return running == task; });
+  }
+  task->code(task->parameters);
+  // FreeRTOS tasks must not return; park it for good
+  task->state = TASK_DONE;
+  suspendSelf();
+}
+
+static bool isReady(const HostTask *task, uint64_t now)
+{
+  switch (task->state)
+  {
+  case TASK_READY:
+    return true;
+  case TASK_WAIT_NOTIFY:
+    return task->notify > 0 || now >= task->wakeAt;
+  case TASK_DELAYED:
+    return now >= task->wakeAt;
+  default:
+    return false;
+  }
+}
+
+void hostTasksRun(uint64_t now)
+{
+  for (;;)
+  {
+    HostTask *best = nullptr;
+    for (HostTask *t : tasks)
+      if (isReady(t, now) && (best == nullptr || t->priority > best->priority))
+        best = t;
+    if (best == nullptr)
+      return;
+
+    ++switches;
+    std::unique_lock<std::mutex> lock(baton);
+    running = best;
+    turn.notify_all();
+    turn.wait(lock, [] { return running == nullptr; });
+  }
+}
+
+uint64_t hostTaskNextWake()
+{
+  uint64_t wake = HOST_NEVER;
+  for (HostTask *t : tasks)
+    if ((t->state == TASK_DELAYED || t->state == TASK_WAIT_NOTIFY) && t->wakeAt < wake)
+      wake = t->wakeAt;
+  return wake;
+}
+
+bool hostInTask()
+{
+  return self != nullptr;
+}
+
+uint64_t hostTaskSwitches()
+{
+  return switches;
+}
+
+uint64_t hostTaskNotifications()
+{
+  return notifications;
+}
+
+// ------------------- task.h -------------------
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stackDepth, void *parameters,
+                       UBaseType_t priority, TaskHandle_t *created)
+{
+  (void)stackDepth;
+  HostTask *task = new HostTask;
+  task->code = code;
+  task->parameters = parameters;
+  task->priority = priority;
+  task->name = name ? name : "";
+  task->state = TASK_READY;
+  task->notify = 0;
+  task->wakeAt = HOST_NEVER;
+  tasks.push_back(task);
+  std::thread(taskEntry, task).detach();
+  if (created)
+    *created = task;
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken)
+{
+  if (task == nullptr)
+    return;
+  ++task->notify;
+  ++notifications;
+  if (higherPriorityTaskWoken)
+    *higherPriorityTaskWoken = pdTRUE;
+}
+
+void xTaskNotifyGive(TaskHandle_t task)
+{
+  vTaskNotifyGiveFromISR(task, nullptr);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait)
+{
+  if (self == nullptr)
+    return 0;
+  if (self->notify == 0 && ticksToWait != 0)
+  {
+    self->state = TASK_WAIT_NOTIFY;
+    self->wakeAt = ticksToWait == portMAX_DELAY ? HOST_NEVER : hostNow() + (uint64_t)ticksToWait * CYCLES_PER_TICK;
+    suspendSelf();
+    self->state = TASK_READY;
+    self->wakeAt = HOST_NEVER;
+  }
+  uint32_t count = self->notify;
+  if (count > 0)
+    self->notify = clearCountOnExit ? 0 : count - 1;
+  return count;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  if (self == nullptr)
+    return;
+  self->state = TASK_DELAYED;
+  self->wakeAt = hostNow() + (uint64_t)(ticks ? ticks : 1) * CYCLES_PER_TICK;
+  suspendSelf();
+  self->state = TASK_READY;
+  self->wakeAt = HOST_NEVER;
+}
+
+TickType_t xTaskGetTickCount()
+{
+  return (TickType_t)(hostNow() / CYCLES_PER_TICK);
+}
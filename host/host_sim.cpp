@@ -0,0 +1,407 @@
+#include "host_sim.h"
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include <FreeRTOS.h>
+#include <task.h>
+#include <stdarg.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "host_tasks.h"
+
+void setup();
+void loop();
+
+uint32_t F_CPU_ACTUAL = F_CPU;
+HostSerial Serial;
+
+struct HostTimer
+{
+  void (*fn)();
+  uint64_t period;
+  uint64_t next;
+  void *owner;
+};
+
+static uint64_t now = 0;
+static uint64_t nextBlock = 0;
+static bool booted = false;
+static std::vector<HostTimer> timers;
+static uint16_t analogValues[HOST_ANALOG_PINS][HOST_MUX_INPUTS]; // [pin][mux input]
+static uint8_t pinStates[HOST_ANALOG_PINS];
+static HostInputHook inputHook = nullptr;
+static void *inputCtx = nullptr;
+static HostAudioSink audioSink = nullptr;
+static void *audioCtx = nullptr;
+static std::string serialIn;
+static size_t serialPos = 0;
+static bool serialEcho = true;
+static HostStats stats;
+
+static uint64_t wallNs()
+{
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// ------------------- harness API -------------------
+void hostSetAnalog(uint8_t pin, uint16_t value)
+{
+  if (pin < HOST_ANALOG_PINS)
+    for (unsigned int i = 0; i < HOST_MUX_INPUTS; ++i)
+      analogValues[pin][i] = value;
+}
+
+void hostSetAnalogMux(uint8_t pin, unsigned int input, uint16_t value)
+{
+  if (pin < HOST_ANALOG_PINS && input < HOST_MUX_INPUTS)
+    analogValues[pin][input] = value;
+}
+
+void hostSetInputHook(HostInputHook hook, void *ctx)
+{
+  inputHook = hook;
+  inputCtx = ctx;
+}
+
+void hostSetAudioSink(HostAudioSink sink, void *ctx)
+{
+  audioSink = sink;
+  audioCtx = ctx;
+}
+
+void hostSerialInput(const char *text)
+{
+  serialIn.append(text);
+}
+
+void hostSetSerialEcho(bool echo)
+{
+  serialEcho = echo;
+}
+
+static void loopTask(void *)
+{
+  for (;;)
+  {
+    loop();
+    // a loop() that never blocks would otherwise spin in zero virtual time
+    vTaskDelay(1);
+  }
+}
+
+void hostBoot()
+{
+  if (booted)
+    return;
+  booted = true;
+  if (inputHook)
+    inputHook(now, inputCtx);
+  setup();
+  xTaskCreate(loopTask, "loop", 8192, nullptr, tskIDLE_PRIORITY, nullptr);
+  hostTasksRun(now);
+}
+
+uint64_t hostUsToCycles(double us)
+{
+  return (uint64_t)(us * (F_CPU / 1000000.0) + 0.5);
+}
+
+double hostCyclesToSamples(uint64_t cycles)
+{
+  return (double)cycles * AUDIO_SAMPLE_RATE_EXACT / F_CPU;
+}
+
+uint64_t hostBlockCycles(uint64_t block)
+{
+  return (uint64_t)((double)block * AUDIO_BLOCK_SAMPLES * F_CPU / AUDIO_SAMPLE_RATE_EXACT);
+}
+
+void hostRun(uint64_t until)
+{
+  if (until < now)
+    until = now;
+  for (;;)
+  {
+    // next event: timer interrupt, audio interrupt or a task waking up;
+    // ties go timer, then audio, then tasks
+    uint64_t when = until + 1;
+    HostTimer *timer = nullptr;
+    for (HostTimer &t : timers)
+    {
+      if (t.next < when)
+      {
+        when = t.next;
+        timer = &t;
+      }
+    }
+    uint64_t blockAt = hostBlockCycles(nextBlock);
+    bool audio = false;
+    if (blockAt < when)
+    {
+      when = blockAt;
+      timer = nullptr;
+      audio = true;
+    }
+    uint64_t wake = hostTaskNextWake();
+    if (wake < when)
+    {
+      when = wake;
+      timer = nullptr;
+      audio = false;
+    }
+    if (when > until)
+      break;
+
+    now = when;
+    if (timer)
+    {
+      timer->next += timer->period;
+      void (*fn)() = timer->fn;
+      if (inputHook)
+        inputHook(now, inputCtx);
+      uint64_t t0 = wallNs();
+      fn();
+      uint64_t ns = wallNs() - t0;
+      ++stats.timerInterrupts;
+      stats.timerNs += ns;
+      if (ns > stats.timerMaxNs)
+        stats.timerMaxNs = ns;
+    }
+    else if (audio)
+    {
+      ++nextBlock;
+      uint64_t t0 = wallNs();
+      hostAudioUpdate();
+      uint64_t ns = wallNs() - t0;
+      ++stats.audioUpdates;
+      stats.audioNs += ns;
+      if (ns > stats.audioMaxNs)
+        stats.audioMaxNs = ns;
+    }
+    hostTasksRun(now);
+  }
+  now = until;
+  hostTasksRun(now);
+}
+
+uint64_t hostNow()
+{
+  return now;
+}
+
+const HostStats &hostStats()
+{
+  stats.taskSwitches = hostTaskSwitches();
+  stats.notifications = hostTaskNotifications();
+  return stats;
+}
+
+// ------------------- stand-in internals -------------------
+uint32_t hostCycleCount()
+{
+  return (uint32_t)now;
+}
+
+uint16_t hostAnalogMuxRead(uint8_t pin, unsigned int input)
+{
+  return pin < HOST_ANALOG_PINS && input < HOST_MUX_INPUTS ? analogValues[pin][input] : 0;
+}
+
+void hostTimerAdd(void (*fn)(), uint64_t periodCycles, void *owner)
+{
+  hostTimerRemove(owner);
+  HostTimer t;
+  t.fn = fn;
+  t.period = periodCycles ? periodCycles : 1;
+  t.next = now + t.period;
+  t.owner = owner;
+  timers.push_back(t);
+}
+
+void hostTimerRemove(void *owner)
+{
+  for (size_t i = 0; i < timers.size(); ++i)
+  {
+    if (timers[i].owner == owner)
+    {
+      timers.erase(timers.begin() + i);
+      return;
+    }
+  }
+}
+
+void hostAudioUpdate()
+{
+  AudioStream::update_all();
+}
+
+void hostAudioOutput(const int16_t *left, const int16_t *right, unsigned int n)
+{
+  if (audioSink)
+    audioSink(left, right, n, now, audioCtx);
+}
+
+// ------------------- Arduino core -------------------
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  if (pin < HOST_ANALOG_PINS)
+    pinStates[pin] = value;
+}
+
+int digitalRead(uint8_t pin)
+{
+  return pin < HOST_ANALOG_PINS ? pinStates[pin] : 0;
+}
+
+int analogRead(uint8_t pin)
+{
+  return hostAnalogMuxRead(pin, 0);
+}
+
+void analogReadResolution(unsigned int bits)
+{
+  (void)bits;
+}
+
+void analogReadAveraging(unsigned int num)
+{
+  (void)num;
+}
+
+uint32_t millis()
+{
+  return (uint32_t)(now / (F_CPU / 1000));
+}
+
+uint32_t micros()
+{
+  return (uint32_t)(now / (F_CPU / 1000000));
+}
+
+// Busy waits let virtual time (and interrupts) run on; inside a task they block it instead.
+void delay(uint32_t ms)
+{
+  if (hostInTask())
+    vTaskDelay(pdMS_TO_TICKS(ms));
+  else
+    hostRun(now + (uint64_t)ms * (F_CPU / 1000));
+}
+
+void delayMicroseconds(uint32_t us)
+{
+  if (!hostInTask())
+    hostRun(now + (uint64_t)us * (F_CPU / 1000000));
+}
+
+void yield() {}
+
+bool IntervalTimer::begin(void (*funct)(), unsigned int microseconds)
+{
+  hostTimerAdd(funct, (uint64_t)microseconds * (F_CPU / 1000000), this);
+  return true;
+}
+
+bool IntervalTimer::begin(void (*funct)(), float microseconds)
+{
+  hostTimerAdd(funct, hostUsToCycles(microseconds), this);
+  return true;
+}
+
+void IntervalTimer::end()
+{
+  hostTimerRemove(this);
+}
+
+// ------------------- Serial -------------------
+int HostSerial::available()
+{
+  return (int)(serialIn.size() - serialPos);
+}
+
+int HostSerial::read()
+{
+  if (serialPos >= serialIn.size())
+    return -1;
+  return (unsigned char)serialIn[serialPos++];
+}
+
+size_t HostSerial::write(uint8_t c)
+{
+  if (serialEcho)
+    fputc(c, stdout);
+  return 1;
+}
+
+size_t HostSerial::write(const char *s)
+{
+  size_t n = strlen(s);
+  if (serialEcho)
+    fwrite(s, 1, n, stdout);
+  return n;
+}
+
+size_t HostSerial::write(const uint8_t *buf, size_t n)
+{
+  if (serialEcho)
+    fwrite(buf, 1, n, stdout);
+  return n;
+}
+
+size_t HostSerial::print(long v)
+{
+  char buf[24];
+  snprintf(buf, sizeof(buf), "%ld", v);
+  return write(buf);
+}
+
+size_t HostSerial::print(unsigned long v)
+{
+  char buf[24];
+  snprintf(buf, sizeof(buf), "%lu", v);
+  return write(buf);
+}
+
+size_t HostSerial::print(double v, int digits)
+{
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%.*f", digits, v);
+  return write(buf);
+}
+
+size_t HostSerial::printf(const char *format, ...)
+{
+  // drop a single 'l' length modifier: on the target long is 32 bits
+  std::string fmt;
+  for (const char *p = format; *p; ++p)
+  {
+    fmt.push_back(*p);
+    if (*p != '%')
+      continue;
+    ++p;
+    while (*p && strchr("-+ #0123456789.*", *p))
+      fmt.push_back(*p++);
+    if (*p == 'l' && p[1] != 'l')
+      ++p;
+    if (!*p)
+      break;
+    fmt.push_back(*p);
+  }
+
+  char buf[512];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buf, sizeof(buf), fmt.c_str(), args);
+  va_end(args);
+  if (n < 0)
+    return 0;
+  return write(buf);
+}
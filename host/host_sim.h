@@ -0,0 +1,72 @@
+/* host_sim.h
+   Deterministic Teensy stand-in for running the firmware on a host
+
+   - one virtual clock in CPU cycles (F_CPU): millis(), micros() and
+     ARM_DWT_CYCCNT all derive from it, nothing reads the wall clock
+   - hostRun() advances it event by event: IntervalTimer callbacks, the
+     audio update every AUDIO_BLOCK_SAMPLES and FreeRTOS tasks; tasks run
+     one at a time, highest priority first, whenever they are ready, and
+     take no virtual time
+   - the harness sets the ADC inputs and Serial input; the I2S output is
+     handed to a sink callback
+   - the same inputs always give the same output, sample for sample
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#define HOST_ANALOG_PINS 42
+#define HOST_MUX_INPUTS 16 // behind each analog pin, for adcDmaBeginScan() multiplexers
+
+// Called before every timer interrupt with the virtual time, so the
+// harness can present the sensor values for that instant.
+typedef void (*HostInputHook)(uint64_t cycles, void *ctx);
+
+// Called with every stereo block the I2S output receives; `cycles` is the
+// time of the audio update that produced it.
+typedef void (*HostAudioSink)(const int16_t *left, const int16_t *right, unsigned int n, uint64_t cycles,
+                              void *ctx);
+
+// A pin's value whatever the mux select lines say; hostSetAnalogMux()
+// sets one input of an analog multiplexer in front of it
+void hostSetAnalog(uint8_t pin, uint16_t value);
+void hostSetAnalogMux(uint8_t pin, unsigned int input, uint16_t value);
+void hostSetInputHook(HostInputHook hook, void *ctx);
+void hostSetAudioSink(HostAudioSink sink, void *ctx);
+void hostSerialInput(const char *text);
+void hostSetSerialEcho(bool echo);
+
+// setup(), then loop() as the lowest priority task
+void hostBoot();
+
+// Process every interrupt and task switch up to `cycles`
+void hostRun(uint64_t cycles);
+
+uint64_t hostNow();
+uint64_t hostUsToCycles(double us);
+double hostCyclesToSamples(uint64_t cycles);
+uint64_t hostBlockCycles(uint64_t block); // start of audio update `block`
+
+struct HostStats
+{
+  uint64_t timerInterrupts;
+  uint64_t audioUpdates;
+  uint64_t taskSwitches;
+  uint64_t notifications; // task notifications given (one per hit for LogTask)
+  uint64_t timerNs; // wall time spent in timer callbacks
+  uint64_t timerMaxNs;
+  uint64_t audioNs; // wall time spent in audio updates
+  uint64_t audioMaxNs;
+};
+
+const HostStats &hostStats();
+
+// ------------------- stand-in internals -------------------
+// used by the Arduino/Audio/FreeRTOS stand-in headers
+uint32_t hostCycleCount();
+uint16_t hostAnalogMuxRead(uint8_t pin, unsigned int input);
+void hostTimerAdd(void (*fn)(), uint64_t periodCycles, void *owner);
+void hostTimerRemove(void *owner);
+void hostAudioUpdate();
+void hostAudioOutput(const int16_t *left, const int16_t *right, unsigned int n);
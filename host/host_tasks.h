@@ -0,0 +1,21 @@
+/* host_tasks.h
+   Scheduler side of the FreeRTOS stand-in (task.h), used by host_sim.cpp
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#define HOST_NEVER UINT64_MAX
+
+// Run ready tasks, highest priority first, until every task is blocked
+void hostTasksRun(uint64_t now);
+
+// Earliest time a delayed task becomes ready, HOST_NEVER if none
+uint64_t hostTaskNextWake();
+
+// True when called from a task rather than from an interrupt or setup()
+bool hostInTask();
+
+uint64_t hostTaskSwitches();
+uint64_t hostTaskNotifications();
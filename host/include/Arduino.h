@@ -0,0 +1,125 @@
+/* Arduino.h (host stand-in)
+   The subset of the Teensy 4 core the firmware uses, on the virtual clock
+   of host_sim.h. Built for the host target only.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "host_sim.h"
+
+#define PROGMEM
+#define DMAMEM
+#define FASTRUN
+#define FLASHMEM
+
+#define F_CPU 600000000
+extern uint32_t F_CPU_ACTUAL;
+
+#define ARM_DWT_CYCCNT (hostCycleCount())
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+// Teensy 4.1 analog pin numbers
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+#define A8 22
+#define A9 23
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+template <class A, class B>
+static inline auto min(A a, B b) -> decltype(a < b ? a : b)
+{
+  return a < b ? a : b;
+}
+
+template <class A, class B>
+static inline auto max(A a, B b) -> decltype(a > b ? a : b)
+{
+  return a > b ? a : b;
+}
+
+static inline void __disable_irq() {}
+static inline void __enable_irq() {}
+static inline void noInterrupts() {}
+static inline void interrupts() {}
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+static inline void digitalWriteFast(uint8_t pin, uint8_t value) { digitalWrite(pin, value); }
+int digitalRead(uint8_t pin);
+
+int analogRead(uint8_t pin);
+void analogReadResolution(unsigned int bits);
+void analogReadAveraging(unsigned int num);
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+class IntervalTimer
+{
+public:
+  ~IntervalTimer() { end(); }
+  bool begin(void (*funct)(), unsigned int microseconds);
+  bool begin(void (*funct)(), float microseconds);
+  bool begin(void (*funct)(), int microseconds) { return microseconds > 0 && begin(funct, (unsigned int)microseconds); }
+  void end();
+  void priority(uint8_t n) { (void)n; }
+};
+
+// Serial: output goes to stdout (if echo is on), input comes from hostSerialInput()
+class HostSerial
+{
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  int available();
+  int read();
+  size_t write(uint8_t c);
+  size_t write(const char *s);
+  size_t write(const uint8_t *buf, size_t n);
+  void flush() {}
+  operator bool() const { return true; }
+
+  size_t print(const char *s) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return print((long)v); }
+  size_t print(unsigned int v) { return print((unsigned long)v); }
+  size_t print(long v);
+  size_t print(unsigned long v);
+  size_t print(double v, int digits = 2);
+
+  size_t println() { return write("\n"); }
+  template <class T>
+  size_t println(T v)
+  {
+    size_t n = print(v);
+    return n + println();
+  }
+  size_t println(double v, int digits) { return print(v, digits) + println(); }
+
+  // Format strings are written for the 32-bit target, where long is
+  // 32 bits; the 'l' length modifier is dropped so they read the same
+  // arguments on a 64-bit host.
+  size_t printf(const char *format, ...);
+};
+
+extern HostSerial Serial;
@@ -0,0 +1,47 @@
+/* Audio.h (host stand-in)
+   The Teensy Audio objects the firmware uses. The mixer does the same
+   fixed-point gain and saturation as the library; the I2S output hands
+   its blocks to the host audio sink instead of the codec.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include "AudioStream.h"
+
+class AudioMixer4 : public AudioStream
+{
+public:
+  AudioMixer4() : AudioStream(4, inputQueueArray)
+  {
+    for (int i = 0; i < 4; ++i)
+      multiplier[i] = 65536;
+  }
+  void gain(unsigned int channel, float gain);
+  virtual void update(void);
+
+private:
+  int32_t multiplier[4];
+  audio_block_t *inputQueueArray[4];
+};
+
+class AudioOutputI2S : public AudioStream
+{
+public:
+  AudioOutputI2S() : AudioStream(2, inputQueueArray) {}
+  virtual void update(void);
+
+private:
+  audio_block_t *inputQueueArray[2];
+};
+
+class AudioControlSGTL5000
+{
+public:
+  bool enable() { return true; }
+  bool volume(float n)
+  {
+    (void)n;
+    return true;
+  }
+};
@@ -0,0 +1,88 @@
+/* AudioStream.h (host stand-in)
+   Block pool, connections and update order of the Teensy Audio library.
+   Streams update in construction order, once per audio block, driven by
+   the virtual clock of host_sim.h.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef AUDIO_BLOCK_SAMPLES
+#define AUDIO_BLOCK_SAMPLES 128
+#endif
+
+#ifndef AUDIO_SAMPLE_RATE_EXACT
+#define AUDIO_SAMPLE_RATE_EXACT 44100.0f
+#endif
+
+#define AUDIO_SAMPLE_RATE AUDIO_SAMPLE_RATE_EXACT
+
+typedef struct audio_block_struct
+{
+  uint8_t ref_count;
+  uint8_t reserved1;
+  uint16_t memory_pool_index;
+  int16_t data[AUDIO_BLOCK_SAMPLES];
+} audio_block_t;
+
+class AudioStream;
+
+class AudioConnection
+{
+public:
+  AudioConnection(AudioStream &source, unsigned char sourceOutput, AudioStream &destination,
+                  unsigned char destinationInput);
+
+private:
+  AudioStream &src;
+  AudioStream &dst;
+  unsigned char src_index;
+  unsigned char dest_index;
+  AudioConnection *next_dest;
+  friend class AudioStream;
+};
+
+#define AudioMemory(num)                                       \
+  ({                                                           \
+    static audio_block_t data[num];                            \
+    AudioStream::initialize_memory(data, num);                 \
+  })
+
+class AudioStream
+{
+public:
+  AudioStream(unsigned char ninput, audio_block_t **iqueue);
+  virtual ~AudioStream() {}
+
+  static void initialize_memory(audio_block_t *data, unsigned int num);
+  static void update_all();
+
+  static uint16_t memory_used;
+  static uint16_t memory_used_max;
+
+protected:
+  virtual void update(void) = 0;
+
+  static audio_block_t *allocate(void);
+  static void release(audio_block_t *block);
+  void transmit(audio_block_t *block, unsigned char index = 0);
+  audio_block_t *receiveReadOnly(unsigned int index = 0);
+  audio_block_t *receiveWritable(unsigned int index = 0);
+
+private:
+  unsigned char num_inputs;
+  audio_block_t **inputQueue;
+  AudioConnection *destination_list;
+  AudioStream *next_update;
+  static AudioStream *first_update;
+  friend class AudioConnection;
+};
+
+#define AudioMemoryUsage() (AudioStream::memory_used)
+#define AudioMemoryUsageMax() (AudioStream::memory_used_max)
+// the virtual clock stands still inside an update (drum_host reports the
+// wall time updates take instead)
+#define AudioProcessorUsage() 0.0f
+#define AudioProcessorUsageMax() 0.0f
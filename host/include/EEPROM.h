@@ -0,0 +1,37 @@
+/* EEPROM.h (host stand-in)
+   The get()/put() subset of the Teensy EEPROM library over E2END + 1
+   bytes of RAM. Every run starts blank (all 0xFF, as erased flash reads),
+   so the firmware boots on its defaults unless the run saves something.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#define E2END 0x10BB // Teensy 4.1: 4284 bytes
+
+class EEPROMClass
+{
+public:
+  EEPROMClass() { memset(bytes, 0xFF, sizeof(bytes)); }
+
+  template <typename T> T &get(int idx, T &t)
+  {
+    if (idx >= 0 && idx + sizeof(T) <= sizeof(bytes))
+      memcpy(&t, bytes + idx, sizeof(T));
+    return t;
+  }
+  template <typename T> const T &put(int idx, const T &t)
+  {
+    if (idx >= 0 && idx + sizeof(T) <= sizeof(bytes))
+      memcpy(bytes + idx, &t, sizeof(T));
+    return t;
+  }
+  uint16_t length() const { return E2END + 1; }
+
+private:
+  uint8_t bytes[E2END + 1];
+};
+
+static EEPROMClass EEPROM;
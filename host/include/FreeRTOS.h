@@ -0,0 +1,24 @@
+/* FreeRTOS.h (host stand-in)
+   Types and constants of the FreeRTOS port, see task.h for the scheduler
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+
+#define configMAX_PRIORITIES 10
+#define configTICK_RATE_HZ 1000
+#define tskIDLE_PRIORITY 0
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000))
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
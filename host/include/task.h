@@ -0,0 +1,21 @@
+/* task.h (host stand-in)
+   Tasks are host threads, but only one ever runs: the host_sim scheduler
+   hands control to the highest priority ready task and waits until it
+   blocks again, so task interleaving is deterministic.
+*/
+
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void *);
+typedef struct HostTask *TaskHandle_t;
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stackDepth, void *parameters,
+                       UBaseType_t priority, TaskHandle_t *created);
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken);
+void xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
@@ -0,0 +1,99 @@
+/* log_decode.cpp
+   Host decoder for the firmware's binary event log (LOG_BINARY 1)
+
+   Reads a serial capture, prints the text in it as it is and every log
+   frame (event_log.h) as the line the firmware's text drain would have
+   printed. A frame that fails its checksum is passed through as bytes,
+   so a capture that starts mid-frame or lost bytes still decodes from
+   the next good frame on.
+
+   log_decode [CAPTURE] [--clock HZ] [--summary]
+
+   CAPTURE    serial capture (default: stdin), e.g. drum_host --serial
+   --clock    the engine clock the ticks in the records count (default F_CPU)
+   --summary  after the log, the records per event and the drops reported
+*/
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "event_log.h"
+
+int main(int argc, char **argv)
+{
+  const char *path = NULL;
+  uint32_t clockHz = F_CPU;
+  bool summary = false;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (!strcmp(argv[i], "--clock") && i + 1 < argc)
+      clockHz = (uint32_t)strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--summary"))
+      summary = true;
+    else if (argv[i][0] != '-' && path == NULL)
+      path = argv[i];
+    else
+    {
+      fprintf(stderr, "usage: %s [CAPTURE] [--clock HZ] [--summary]\n", argv[0]);
+      return 2;
+    }
+  }
+  FILE *in = path ? fopen(path, "rb") : stdin;
+  if (in == NULL)
+  {
+    fprintf(stderr, "cannot read %s\n", path);
+    return 2;
+  }
+
+  uint32_t counts[LOG_EVENTS] = {};
+  uint32_t bad = 0, dropped = 0;
+  uint8_t frame[LOG_FRAME_BYTES];
+  size_t have = 0; // bytes of a frame collected, from LOG_SYNC on
+  int c;
+  while ((c = fgetc(in)) != EOF)
+  {
+    if (have == 0 && c != LOG_SYNC)
+    {
+      fputc(c, stdout);
+      continue;
+    }
+    frame[have++] = (uint8_t)c;
+    if (have < LOG_FRAME_BYTES)
+      continue;
+
+    LogRecord r;
+    if (decodeLogFrame(frame, &r))
+    {
+      char line[160];
+      formatLogRecord(r, clockHz, line, sizeof(line));
+      puts(line);
+      ++counts[r.id];
+      if (r.id == LOG_DROPPED)
+        dropped += r.a;
+      have = 0;
+      continue;
+    }
+    // not a frame: the sync byte goes out as it is, look again after it
+    ++bad;
+    fputc(frame[0], stdout);
+    size_t next = 1;
+    while (next < have && frame[next] != LOG_SYNC)
+      fputc(frame[next++], stdout);
+    memmove(frame, frame + next, have - next);
+    have -= next;
+  }
+  fwrite(frame, 1, have, stdout); // a frame cut off by the end of the capture
+  if (in != stdin)
+    fclose(in);
+
+  if (summary)
+  {
+    static const char *const names[LOG_EVENTS] = {"hit", "dropped", "overrun"};
+    printf("log records:");
+    for (int e = 0; e < LOG_EVENTS; ++e)
+      printf(" %s %u", names[e], counts[e]);
+    printf(", %u records dropped by the firmware, %u bad frames\n", dropped, bad);
+  }
+  return 0;
+}
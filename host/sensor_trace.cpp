@@ -0,0 +1,136 @@
+#include "sensor_trace.h"
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// as wired in src/main.cpp
+static const uint8_t tracePins[SENSOR_CHANNELS] = {A0, A3, A1, A2};
+
+#define TRACE_FRAME_BYTES 12
+
+static bool hasSuffix(const char *s, const char *suffix)
+{
+  size_t n = strlen(s), m = strlen(suffix);
+  return n >= m && strcmp(s + n - m, suffix) == 0;
+}
+
+static bool loadBinary(FILE *f, std::vector<TraceFrame> &frames, std::string &error)
+{
+  uint8_t rec[TRACE_FRAME_BYTES];
+  size_t got;
+  while ((got = fread(rec, 1, sizeof(rec), f)) == sizeof(rec))
+  {
+    TraceFrame fr;
+    fr.timeUs = rec[0] | (rec[1] << 8) | (rec[2] << 16) | ((uint32_t)rec[3] << 24);
+    for (int c = 0; c < SENSOR_CHANNELS; ++c)
+      fr.value[c] = (uint16_t)(rec[4 + 2 * c] | (rec[5 + 2 * c] << 8));
+    frames.push_back(fr);
+  }
+  if (got != 0)
+  {
+    error = "truncated binary frame";
+    return false;
+  }
+  return true;
+}
+
+static bool loadCsv(FILE *f, std::vector<TraceFrame> &frames, std::string &error)
+{
+  char line[256];
+  unsigned int lineNo = 0;
+  while (fgets(line, sizeof(line), f))
+  {
+    ++lineNo;
+    char *p = line;
+    while (*p == ' ' || *p == '\t')
+      ++p;
+    if (*p == '#' || *p == '\n' || *p == '\r' || *p == 0)
+      continue;
+    unsigned long v[1 + SENSOR_CHANNELS];
+    int n = sscanf(p, "%lu ,%lu ,%lu ,%lu ,%lu", &v[0], &v[1], &v[2], &v[3], &v[4]);
+    if (n != 1 + SENSOR_CHANNELS)
+    {
+      if (frames.empty() && lineNo == 1)
+        continue; // header
+      error = "bad CSV line " + std::to_string(lineNo);
+      return false;
+    }
+    TraceFrame fr;
+    fr.timeUs = (uint32_t)v[0];
+    for (int c = 0; c < SENSOR_CHANNELS; ++c)
+      fr.value[c] = (uint16_t)(v[1 + c] > 4095 ? 4095 : v[1 + c]);
+    frames.push_back(fr);
+  }
+  return true;
+}
+
+bool traceLoad(const char *path, std::vector<TraceFrame> &frames, std::string &error)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+  {
+    error = std::string("cannot open ") + path;
+    return false;
+  }
+  char magic[sizeof(TRACE_MAGIC) - 1];
+  bool binary = fread(magic, 1, sizeof(magic), f) == sizeof(magic) && memcmp(magic, TRACE_MAGIC, sizeof(magic)) == 0;
+  if (!binary)
+    rewind(f);
+  frames.clear();
+  bool ok = binary ? loadBinary(f, frames, error) : loadCsv(f, frames, error);
+  fclose(f);
+  if (ok && frames.empty())
+  {
+    error = "trace is empty";
+    return false;
+  }
+  for (size_t i = 1; ok && i < frames.size(); ++i)
+  {
+    if (frames[i].timeUs < frames[i - 1].timeUs)
+    {
+      error = "timestamps go backwards at frame " + std::to_string(i);
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+bool traceSave(const char *path, const std::vector<TraceFrame> &frames)
+{
+  bool binary = hasSuffix(path, ".bin");
+  FILE *f = fopen(path, binary ? "wb" : "w");
+  if (f == NULL)
+    return false;
+  if (binary)
+  {
+    fwrite(TRACE_MAGIC, 1, sizeof(TRACE_MAGIC) - 1, f);
+    for (const TraceFrame &fr : frames)
+    {
+      uint8_t rec[TRACE_FRAME_BYTES];
+      for (int b = 0; b < 4; ++b)
+        rec[b] = (uint8_t)(fr.timeUs >> (8 * b));
+      for (int c = 0; c < SENSOR_CHANNELS; ++c)
+      {
+        rec[4 + 2 * c] = (uint8_t)fr.value[c];
+        rec[5 + 2 * c] = (uint8_t)(fr.value[c] >> 8);
+      }
+      fwrite(rec, 1, sizeof(rec), f);
+    }
+  }
+  else
+  {
+    fprintf(f, "time_us,center,rim,flex,fsr\n");
+    for (const TraceFrame &fr : frames)
+      fprintf(f, "%u,%u,%u,%u,%u\n", (unsigned)fr.timeUs, fr.value[SENSOR_PIEZO_CENTER], fr.value[SENSOR_PIEZO_RIM],
+              fr.value[SENSOR_FLEX], fr.value[SENSOR_FSR]);
+  }
+  return fclose(f) == 0;
+}
+
+void traceApply(const TraceFrame &frame)
+{
+  for (int c = 0; c < SENSOR_CHANNELS; ++c)
+    hostSetAnalog(tracePins[c], frame.value[c]);
+}
@@ -0,0 +1,34 @@
+/* sensor_trace.h
+   Recorded sensor streams for the host harnesses
+
+   - one frame per sensor tick: time in us from the start of the capture
+     plus the raw ADC value of every SensorChannel
+   - CSV: "time_us,center,rim,flex,fsr" per line, '#' starts a comment,
+     a non-numeric first line is taken as a header
+   - binary: TRACE_MAGIC, then little-endian uint32 time + 4 x uint16
+     per frame (12 bytes); chosen on save by a ".bin" extension, detected
+     by the magic on load
+   - frames are sample-and-hold: the ISR sees the last frame at or
+     before its tick
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "hit_detector.h"
+
+#define TRACE_MAGIC "DTRC0001"
+
+struct TraceFrame
+{
+  uint32_t timeUs;
+  uint16_t value[SENSOR_CHANNELS];
+};
+
+bool traceLoad(const char *path, std::vector<TraceFrame> &frames, std::string &error);
+bool traceSave(const char *path, const std::vector<TraceFrame> &frames);
+
+// Present a frame on the analog pins src/main.cpp reads
+void traceApply(const TraceFrame &frame);
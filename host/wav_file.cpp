@@ -0,0 +1,97 @@
+#include "wav_file.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static void put16(uint8_t *p, uint16_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+  put16(p, (uint16_t)v);
+  put16(p + 2, (uint16_t)(v >> 16));
+}
+
+static uint16_t get16(const uint8_t *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+  return get16(p) | ((uint32_t)get16(p + 2) << 16);
+}
+
+bool wavWrite(const char *path, const WavData &wav)
+{
+  FILE *f = fopen(path, "wb");
+  if (f == NULL)
+    return false;
+  uint32_t dataBytes = (uint32_t)(wav.samples.size() * 2);
+  uint8_t h[44];
+  memcpy(h, "RIFF", 4);
+  put32(h + 4, 36 + dataBytes);
+  memcpy(h + 8, "WAVEfmt ", 8);
+  put32(h + 16, 16);
+  put16(h + 20, 1); // PCM
+  put16(h + 22, wav.channels);
+  put32(h + 24, wav.sampleRate);
+  put32(h + 28, wav.sampleRate * wav.channels * 2);
+  put16(h + 32, (uint16_t)(wav.channels * 2));
+  put16(h + 34, 16);
+  memcpy(h + 36, "data", 4);
+  put32(h + 40, dataBytes);
+  fwrite(h, 1, sizeof(h), f);
+  for (int16_t s : wav.samples)
+  {
+    uint8_t b[2];
+    put16(b, (uint16_t)s);
+    fwrite(b, 1, 2, f);
+  }
+  return fclose(f) == 0;
+}
+
+bool wavRead(const char *path, WavData &wav)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+    return false;
+  uint8_t h[12];
+  bool ok = fread(h, 1, 12, f) == 12 && !memcmp(h, "RIFF", 4) && !memcmp(h + 8, "WAVE", 4);
+  bool haveFmt = false;
+  wav.samples.clear();
+  while (ok)
+  {
+    uint8_t ch[8];
+    if (fread(ch, 1, 8, f) != 8)
+      break;
+    uint32_t size = get32(ch + 4);
+    if (!memcmp(ch, "fmt ", 4) && size >= 16)
+    {
+      uint8_t fmt[16];
+      ok = fread(fmt, 1, 16, f) == 16 && get16(fmt) == 1 && get16(fmt + 14) == 16;
+      wav.channels = get16(fmt + 2);
+      wav.sampleRate = get32(fmt + 4);
+      haveFmt = true;
+      fseek(f, (long)(size - 16 + (size & 1)), SEEK_CUR);
+    }
+    else if (!memcmp(ch, "data", 4) && haveFmt)
+    {
+      wav.samples.resize(size / 2);
+      for (size_t i = 0; i < wav.samples.size() && ok; ++i)
+      {
+        uint8_t b[2];
+        ok = fread(b, 1, 2, f) == 2;
+        wav.samples[i] = (int16_t)get16(b);
+      }
+      break;
+    }
+    else
+      fseek(f, (long)(size + (size & 1)), SEEK_CUR);
+  }
+  fclose(f);
+  return ok && haveFmt;
+}
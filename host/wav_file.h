@@ -0,0 +1,18 @@
+/* wav_file.h
+   Minimal 16-bit PCM WAV reader/writer for the host harnesses
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+struct WavData
+{
+  uint32_t sampleRate;
+  uint16_t channels;
+  std::vector<int16_t> samples; // interleaved
+};
+
+bool wavWrite(const char *path, const WavData &wav);
+bool wavRead(const char *path, WavData &wav);
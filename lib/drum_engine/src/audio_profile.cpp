@@ -0,0 +1,44 @@
+#include "audio_profile.h"
+
+#include "resampler.h"
+
+const uint16_t audioProfileBlockSizes[AUDIO_PROFILE_BLOCK_SIZES] = {16, 32, 64, 128};
+const uint32_t audioProfileRates[AUDIO_PROFILE_RATES] = {44100, 48000, 96000};
+
+float audioPathLatencyUs(unsigned int blockSamples, uint32_t sampleRate)
+{
+  return 2.5f * blockSamples * 1e6f / sampleRate;
+}
+
+AudioProfileLoad audioProfileBench(const HitSample &sample, unsigned int blockSamples, uint32_t sampleRate,
+                                   unsigned int blocks, uint32_t clockHz, ProfileCycleCounter cycles)
+{
+  static VoiceEngine engine;
+  static int16_t out[DRUM_BLOCK_SAMPLES];
+  if (blockSamples > DRUM_BLOCK_SAMPLES)
+    blockSamples = DRUM_BLOCK_SAMPLES;
+
+  engine.begin(nullptr, sampleRate, clockHz);
+  AudioProfileLoad load = {};
+  load.budget = (uint32_t)((uint64_t)clockHz * blockSamples / sampleRate);
+  uint64_t total = 0;
+  for (unsigned int b = 0; b < blocks; ++b)
+  {
+    // off-root pitches, so every voice interpolates
+    do
+      engine.trigger(sample, pitchToStepQ16((int32_t)((b * 7 + engine.activeVoices() * 5) % 25) * 256 - 12 * 256));
+    while (engine.activeVoices() < DRUM_MAX_VOICES);
+
+    uint32_t t0 = cycles();
+    engine.render(out, blockSamples, 0);
+    uint32_t c = cycles() - t0;
+    total += c;
+    if (c > load.cyclesMax)
+      load.cyclesMax = c;
+    if (c > load.budget)
+      ++load.overruns;
+  }
+  load.blocks = blocks;
+  load.cyclesMean = blocks ? (uint32_t)(total / blocks) : 0;
+  return load;
+}
@@ -0,0 +1,46 @@
+/* audio_profile.h
+   Audio block size / sample rate trade-off (hardware independent)
+
+   - the output path holds a hit for 2.5 blocks: one block from capture to
+     the render that starts it (sample-accurate onsets), then the rendered
+     block waits one block for the I2S interrupt to copy it and half a
+     block for the DMA to reach it; smaller blocks and higher rates shrink
+     all of it
+   - audioProfileBench() renders a private VoiceEngine at full polyphony
+     (every voice busy, one stolen per block like a roll) at any block
+     size and rate, so one firmware build measures the whole matrix; the
+     live engine is not touched
+   - the build's own block size and rate are AUDIO_BLOCK_SAMPLES and
+     AUDIO_SAMPLE_RATE_EXACT (platformio.ini profiles, CMake cache)
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "voice_engine.h"
+
+#define AUDIO_PROFILE_BLOCK_SIZES 4
+#define AUDIO_PROFILE_RATES 3
+
+extern const uint16_t audioProfileBlockSizes[AUDIO_PROFILE_BLOCK_SIZES]; // 16, 32, 64, 128
+extern const uint32_t audioProfileRates[AUDIO_PROFILE_RATES];             // 44100, 48000, 96000
+
+typedef uint32_t (*ProfileCycleCounter)();
+
+struct AudioProfileLoad
+{
+  uint32_t budget;     // cycles per block period
+  uint32_t cyclesMean; // render() cycles per block
+  uint32_t cyclesMax;
+  uint32_t overruns; // blocks whose render() alone took longer than the period
+  uint32_t blocks;
+};
+
+// Capture to codec through the output path, in microseconds (2.5 blocks)
+float audioPathLatencyUs(unsigned int blockSamples, uint32_t sampleRate);
+
+// Render `blocks` blocks of `blockSamples` at `sampleRate` with every
+// voice playing `sample`, timed with `cycles` (clockHz per second).
+// Not reentrant (one static engine).
+AudioProfileLoad audioProfileBench(const HitSample &sample, unsigned int blockSamples, uint32_t sampleRate,
+                                   unsigned int blocks, uint32_t clockHz, ProfileCycleCounter cycles);
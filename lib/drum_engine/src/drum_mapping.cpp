@@ -0,0 +1,233 @@
+#include "drum_mapping.h"
+
+#include <math.h>
+#include <atomic>
+
+// semitones above the root sample for each flex step (was PITCH_STEPS in gen.py)
+static const uint8_t pitchStepSemitones[FLEX_NOTES] = {0, 2, 4, 7, 12};
+
+static inline float clampf(float v, float lo, float hi)
+{
+  if (v < lo)
+    return lo;
+  if (v > hi)
+    return hi;
+  return v;
+}
+
+int flexToPitchIndex(const SensorCurveConfig &config, float flexValue)
+{
+  float clamped = clampf(flexValue, config.flexMin, config.flexMax);
+  float norm = (clamped - config.flexMin) / (config.flexMax - config.flexMin); // 0–1 linear
+
+  // Apply exponential curve (feel curve)
+  float curved = powf(norm, config.flexExponent); // try 1.6–2.2 for typical flex sensors
+
+  int idx = (int)(curved * (FLEX_NOTES - 1) + 0.5f);
+  if (idx < 0)
+    return 0;
+  if (idx > FLEX_NOTES - 1)
+    return FLEX_NOTES - 1;
+  return idx;
+}
+
+/*
+const int flexThresholds[5] = {410, 460, 530, 620, 750}; // example ADCs for each note
+
+int flexToPitchIndex(float flexValue)
+{
+  for (int i = 4; i >= 0; --i)
+    if (flexValue >= flexThresholds[i])
+      return i;
+  return 0;
+}
+
+*/
+
+int16_t flexToPitchQ8Ref(const SensorCurveConfig &config, float flexValue)
+{
+#if PITCH_CONTINUOUS
+  float clamped = clampf(flexValue, config.flexMin, config.flexMax);
+  float norm = (clamped - config.flexMin) / (config.flexMax - config.flexMin);
+  float curved = powf(norm, config.flexExponent);
+  return (int16_t)(curved * PITCH_RANGE_SEMITONES * 256.0f + 0.5f);
+#else
+  return (int16_t)(pitchStepSemitones[flexToPitchIndex(config, flexValue)] << 8);
+#endif
+}
+
+// Rounded integer division, which the table build can repeat exactly
+uint16_t piezoToVelocityQ15Ref(const SensorCurveConfig &config, uint16_t piezoVal)
+{
+  if (piezoVal <= config.piezoThreshold)
+    return 0;
+  if (piezoVal >= config.piezoMax)
+    return GAIN_UNITY;
+  uint32_t span = config.piezoMax - config.piezoThreshold;
+  return (uint16_t)(((uint32_t)(piezoVal - config.piezoThreshold) * (2 * GAIN_UNITY) + span) / (2 * span));
+}
+
+// ------------------- Curve tables -------------------
+// Two tables: the one `activeCurves` points at is read by the interrupts,
+// the other is rebuilt. Once published, a table is not written again
+// until the next setSensorCurves(), and no interrupt holds the pointer
+// across two calls.
+static SensorCurves curveTables[2];
+static std::atomic<const SensorCurves *> activeCurves(&curveTables[0]);
+static SensorCurveConfig activeConfig = {0, 0, 0.0f, 0, 0};
+
+#define CURVE_KNOT_SPACING 8 // continuous pitch: flex readings per powf
+
+SensorCurveConfig sensorCurveDefaults()
+{
+  SensorCurveConfig config;
+  config.flexMin = FLEX_MIN;
+  config.flexMax = FLEX_MAX;
+  config.flexExponent = FLEX_EXPONENT;
+  config.piezoThreshold = PIEZO_THRESHOLD;
+  config.piezoMax = ADC_MAX;
+  return config;
+}
+
+bool sensorCurvesValid(const SensorCurveConfig &config)
+{
+  return config.flexMin < config.flexMax && config.flexMax <= ADC_MAX && config.piezoThreshold < config.piezoMax &&
+         config.piezoMax <= ADC_MAX && config.flexExponent > 0.0f && config.flexExponent < 16.0f;
+}
+
+static void buildPitchCurve(const SensorCurveConfig &config, int16_t *pitchQ8)
+{
+#if PITCH_CONTINUOUS
+  // the curve at every knot, straight lines in between; flat outside the range
+  unsigned int lo = config.flexMin, hi = config.flexMax;
+  for (unsigned int i = 0; i < lo; ++i)
+    pitchQ8[i] = 0;
+  int32_t prev = flexToPitchQ8Ref(config, (float)lo);
+  for (unsigned int k = lo; k < hi; k += CURVE_KNOT_SPACING)
+  {
+    unsigned int n = hi - k < CURVE_KNOT_SPACING ? hi - k : CURVE_KNOT_SPACING;
+    int32_t next = flexToPitchQ8Ref(config, (float)(k + n));
+    for (unsigned int j = 0; j < n; ++j)
+      pitchQ8[k + j] = (int16_t)(prev + ((next - prev) * (int32_t)j * 2 + (int32_t)n) / (2 * (int32_t)n));
+    prev = next;
+  }
+  for (unsigned int i = hi; i < SENSOR_CURVE_SIZE; ++i)
+    pitchQ8[i] = (int16_t)prev;
+#else
+  // the step index only grows with the flex: search each step's first reading
+  unsigned int from = 0;
+  for (int step = 1; step <= FLEX_NOTES; ++step)
+  {
+    unsigned int lo = from, hi = SENSOR_CURVE_SIZE;
+    while (step < FLEX_NOTES && lo < hi)
+    {
+      unsigned int mid = (lo + hi) / 2;
+      if (flexToPitchIndex(config, (float)mid) >= step)
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+    if (step == FLEX_NOTES)
+      lo = SENSOR_CURVE_SIZE;
+    int16_t pitch = (int16_t)(pitchStepSemitones[step - 1] << 8);
+    for (unsigned int i = from; i < lo; ++i)
+      pitchQ8[i] = pitch;
+    from = lo;
+  }
+#endif
+}
+
+void buildSensorCurves(const SensorCurveConfig &config, SensorCurves *curves)
+{
+  buildPitchCurve(config, curves->pitchQ8);
+  for (unsigned int i = 0; i < SENSOR_CURVE_SIZE; ++i)
+    curves->velocityQ15[i] = piezoToVelocityQ15Ref(config, (uint16_t)i);
+}
+
+void setSensorCurves(const SensorCurveConfig &config)
+{
+  const SensorCurves *active = activeCurves.load(std::memory_order_relaxed);
+  SensorCurves *idle = &curveTables[active == &curveTables[0] ? 1 : 0];
+  buildSensorCurves(config, idle);
+  activeConfig = config;
+  activeCurves.store(idle, std::memory_order_release);
+}
+
+const SensorCurveConfig &sensorCurveConfig()
+{
+  return activeConfig;
+}
+
+int16_t flexToPitchQ8(uint16_t flex)
+{
+  return activeCurves.load(std::memory_order_acquire)->pitchQ8[flex < ADC_MAX ? flex : ADC_MAX];
+}
+
+uint16_t piezoToVelocityQ15(uint16_t piezoVal)
+{
+  return activeCurves.load(std::memory_order_acquire)->velocityQ15[piezoVal < ADC_MAX ? piezoVal : ADC_MAX];
+}
+
+uint16_t velocityToGainQ15(uint16_t velQ15)
+{
+  const uint32_t minGain = (uint32_t)(VEL_GAIN_MIN * GAIN_UNITY);
+  return (uint16_t)(minGain + (((GAIN_UNITY - minGain) * velQ15) >> 15));
+}
+
+// ------------------- Notes and choke groups -------------------
+// Notes that share a non-zero choke group fade each other out; by default
+// a damped hit chokes the open notes of the same zone and vice versa. The
+// table is one pad's; pad p uses its groups + 2p.
+static const uint8_t chokeGroups[4] = {
+    1, // center, open
+    2, // rim, open
+    1, // center, damped
+    2, // rim, damped
+};
+
+uint8_t hitNote(const HitEvent &ev)
+{
+  return (uint8_t)((ev.pad << 2) | ev.zone | (ev.release << 1));
+}
+
+uint8_t noteChokeGroup(uint8_t note)
+{
+  uint8_t group = chokeGroups[note & 3];
+  return group ? (uint8_t)(group + 2 * (note >> 2)) : 0;
+}
+
+// ------------------- Sample lookup -------------------
+// called from the audio update for every queued hit
+bool lookupBankSample(const DrumSampleDesc *bank, unsigned int pads, unsigned int zones, unsigned int velLayers,
+                      const HitEvent &ev, HitSample *hs)
+{
+  if (pads == 0 || zones == 0 || velLayers == 0)
+    return false;
+  bank += ((ev.pad < pads ? ev.pad : 0) * zones + (ev.zone < zones ? ev.zone : 0)) * velLayers;
+
+  uint16_t vel = piezoToVelocityQ15(ev.velocity);
+  uint32_t gain = velocityToGainQ15(vel);
+
+  uint32_t layerPos = (uint32_t)vel * (velLayers - 1); // Q15
+  unsigned int lo = layerPos >> 15;
+  uint32_t mix = layerPos & 0x7FFF;
+
+  const DrumSampleDesc &a = bank[lo];
+  hs->buf[0] = a.ptr;
+  hs->len[0] = a.len;
+  hs->gain[0] = (uint16_t)((((gain * (32768 - mix)) >> 15) * a.gain) >> 15);
+  hs->rootPitch = a.rootPitch;
+  hs->layers = 1;
+  hs->note = hitNote(ev);
+  hs->chokeGroup = noteChokeGroup(hs->note);
+
+  if (mix != 0)
+  {
+    const DrumSampleDesc &b = bank[lo + 1];
+    hs->buf[1] = b.ptr;
+    hs->len[1] = b.len;
+    hs->gain[1] = (uint16_t)((((gain * mix) >> 15) * b.gain) >> 15);
+    hs->layers = 2;
+  }
+  return true;
+}
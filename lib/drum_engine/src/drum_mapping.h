@@ -0,0 +1,122 @@
+/* drum_mapping.h
+   Sensor-to-sound mapping (hardware independent)
+
+   - flex -> pitch, in FLEX_NOTES fixed steps or continuously
+   - piezo peak -> continuous velocity -> voice gain
+   - the flex and piezo curves are tables with one entry per 12-bit
+     reading, built from a SensorCurveConfig at calibration time, so
+     mapping a hit is two loads instead of powf, a divide and a few float
+     compares. setSensorCurves() builds into the idle one of two tables
+     and publishes it with one atomic store; the *Ref functions are the
+     float curves the tables are built from. A build is a few dozen powf
+     calls (step pitch: a search for each step's edge; continuous: one per
+     CURVE_KNOT_SPACING readings, linear in between) and one integer
+     divide per piezo reading, cheap enough to redo at every boot
+   - hit -> note and choke group, per pad
+   - hit -> bank sample(s): the hit's pad and zone pick a sample set
+     (center or rim of that pad), whose velocity layers are spread evenly
+     over the velocity range; a hit between two of them crossfades both
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "hit_event.h"
+#include "sample_bank.h"
+#include "voice_engine.h"
+
+#ifndef ADC_MAX
+#define ADC_MAX 4095 // 12-bit readings
+#endif
+
+#ifndef PIEZO_THRESHOLD
+#define PIEZO_THRESHOLD 600
+#endif
+
+#ifndef FLEX_MIN
+#define FLEX_MIN 250
+#endif
+
+#ifndef FLEX_MAX
+#define FLEX_MAX 3800
+#endif
+
+#ifndef FLEX_NOTES
+#define FLEX_NOTES 5
+#endif
+
+#ifndef FLEX_EXPONENT
+#define FLEX_EXPONENT 1.8f // >1 = exponential, <1 = logarithmic feel
+#endif
+
+#ifndef PITCH_CONTINUOUS
+#define PITCH_CONTINUOUS 0 // 1 = flex sets pitch continuously, 0 = FLEX_NOTES fixed steps
+#endif
+
+#ifndef PITCH_RANGE_SEMITONES
+#define PITCH_RANGE_SEMITONES 12
+#endif
+
+#ifndef VEL_GAIN_MIN
+#define VEL_GAIN_MIN 0.6f // voice gain of a hit right at PIEZO_THRESHOLD
+#endif
+
+#define SENSOR_CURVE_SIZE (ADC_MAX + 1) // one entry per reading
+
+struct SensorCurveConfig
+{
+  uint16_t flexMin;        // flex reading at the lowest pitch
+  uint16_t flexMax;        // ...and at the highest
+  float flexExponent;      // feel curve between them
+  uint16_t piezoThreshold; // piezo reading at velocity 0
+  uint16_t piezoMax;       // ...and at velocity 1 (the hardest strike)
+};
+
+struct SensorCurves
+{
+  int16_t pitchQ8[SENSOR_CURVE_SIZE];      // flex reading -> flexToPitchQ8Ref()
+  uint16_t velocityQ15[SENSOR_CURVE_SIZE]; // piezo reading -> piezoToVelocityQ15Ref()
+};
+
+// FLEX_MIN, FLEX_MAX, FLEX_EXPONENT, PIEZO_THRESHOLD, ADC_MAX
+SensorCurveConfig sensorCurveDefaults();
+
+// flexMin < flexMax, piezoThreshold < piezoMax, all within ADC_MAX, and a
+// positive exponent
+bool sensorCurvesValid(const SensorCurveConfig &config);
+
+// Continuous pitch is within 1 LSB of flexToPitchQ8Ref() (interpolated),
+// step pitch and velocity are exact
+void buildSensorCurves(const SensorCurveConfig &config, SensorCurves *curves);
+
+// Build the tables for `config` and swap them in. Lookups from interrupts
+// see the old tables or the new ones, never a mix; call it from one
+// context at a time (setup, the loop), not from an interrupt. Until the
+// first call every reading maps to pitch 0 and velocity 0.
+void setSensorCurves(const SensorCurveConfig &config);
+const SensorCurveConfig &sensorCurveConfig();
+
+// pitch of a hit in semitones above the root sample, Q8; `flex` in ADC counts
+int16_t flexToPitchQ8(uint16_t flex);
+
+// piezo ADC reading to a continuous velocity 0..1 (Q15)
+uint16_t piezoToVelocityQ15(uint16_t piezoVal);
+
+// The float curves the tables hold
+int flexToPitchIndex(const SensorCurveConfig &config, float flexValue);
+int16_t flexToPitchQ8Ref(const SensorCurveConfig &config, float flexValue);
+uint16_t piezoToVelocityQ15Ref(const SensorCurveConfig &config, uint16_t piezoVal);
+
+// voice gain for a velocity: VEL_GAIN_MIN at the threshold up to 1.0 (Q15)
+uint16_t velocityToGainQ15(uint16_t velQ15);
+
+// A hit's note is its pad, its zone and whether it was damped (FSR
+// pressed); each pad has choke groups of its own.
+uint8_t hitNote(const HitEvent &ev);
+uint8_t noteChokeGroup(uint8_t note);
+
+// Resolve a hit against a bank of `pads` x `zones` sample sets (pad by
+// pad, HitZone order) of velLayers velocity layers each (softest first).
+// A pad or zone the bank does not have plays its first set.
+bool lookupBankSample(const DrumSampleDesc *bank, unsigned int pads, unsigned int zones, unsigned int velLayers,
+                      const HitEvent &ev, HitSample *hs);
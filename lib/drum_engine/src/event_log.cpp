@@ -0,0 +1,103 @@
+#include "event_log.h"
+
+#include <stdio.h>
+
+static uint32_t ticksPerUs(uint32_t clockHz)
+{
+  return clockHz >= 1000000 ? clockHz / 1000000 : 1;
+}
+
+LogRecord logHit(const HitEvent &ev, uint32_t nowTicks, uint32_t nowUs, uint32_t clockHz)
+{
+  LogRecord r;
+  r.time = nowUs - (nowTicks - ev.time) / ticksPerUs(clockHz);
+  r.id = LOG_HIT;
+  r.pad = ev.pad;
+  r.value = ev.velocity;
+  r.a = (uint16_t)ev.pitch | (uint32_t)(ev.zone & 0xF) << 16 | (uint32_t)(ev.release & 0xF) << 20 |
+        (uint32_t)ev.flags << 24;
+  r.b = nowTicks - ev.time;
+  return r;
+}
+
+size_t formatLogRecord(const LogRecord &r, uint32_t clockHz, char *out, size_t size)
+{
+  uint32_t perUs = ticksPerUs(clockHz);
+  unsigned long s = r.time / 1000000, us = r.time % 1000000;
+  int n = 0;
+  switch (r.id)
+  {
+  case LOG_HIT:
+  {
+    int16_t pitch = (int16_t)(r.a & 0xFFFF);
+    unsigned int semis = (unsigned int)(pitch < 0 ? -pitch : pitch);
+    unsigned int zone = (r.a >> 16) & 0xF, release = (r.a >> 20) & 0xF, flags = r.a >> 24;
+    const char *kind = flags & HIT_FLAG_CORRECTION ? "correction" : flags & HIT_FLAG_ESTIMATE ? "estimate" : "hit";
+    n = snprintf(out, size, "%5lu.%06lu %s pad %u %s velocity %u pitch %c%u.%02u %s, posted %lu us later", s, us, kind,
+                 r.pad, zone == HIT_ZONE_RIM ? "rim" : "center", r.value, pitch < 0 ? '-' : '+',
+                 semis / 256, semis % 256 * 100 / 256, release == HIT_RELEASE_SHORT ? "short" : "long",
+                 (unsigned long)(r.b / perUs));
+    break;
+  }
+  case LOG_DROPPED:
+    n = snprintf(out, size, "log: %lu records dropped (%lu in all)", (unsigned long)r.a, (unsigned long)r.b);
+    break;
+  case LOG_OVERRUN:
+    n = snprintf(out, size, "%5lu.%06lu sensor DMA overrun (%lu in all)", s, us, (unsigned long)r.a);
+    break;
+  default:
+    n = snprintf(out, size, "%5lu.%06lu event %u", s, us, r.id);
+    break;
+  }
+  return n < 0 ? 0 : (size_t)n < size ? (size_t)n : size - 1;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+  return p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// sum of the record bytes, so a shifted or cut frame does not decode
+static uint8_t frameChecksum(const uint8_t *record)
+{
+  uint8_t sum = 0x5A;
+  for (size_t i = 0; i < sizeof(LogRecord); ++i)
+    sum = (uint8_t)((sum << 1 | sum >> 7) + record[i]);
+  return sum;
+}
+
+void encodeLogFrame(const LogRecord &r, uint8_t frame[LOG_FRAME_BYTES])
+{
+  uint8_t *p = frame + 1;
+  frame[0] = LOG_SYNC;
+  put32(p, r.time);
+  p[4] = r.id;
+  p[5] = r.pad;
+  p[6] = (uint8_t)r.value;
+  p[7] = (uint8_t)(r.value >> 8);
+  put32(p + 8, r.a);
+  put32(p + 12, r.b);
+  frame[LOG_FRAME_BYTES - 1] = frameChecksum(p);
+}
+
+bool decodeLogFrame(const uint8_t frame[LOG_FRAME_BYTES], LogRecord *r)
+{
+  const uint8_t *p = frame + 1;
+  if (frame[0] != LOG_SYNC || frame[LOG_FRAME_BYTES - 1] != frameChecksum(p) || p[4] >= LOG_EVENTS)
+    return false;
+  r->time = get32(p);
+  r->id = p[4];
+  r->pad = p[5];
+  r->value = (uint16_t)(p[6] | p[7] << 8);
+  r->a = get32(p + 8);
+  r->b = get32(p + 12);
+  return true;
+}
@@ -0,0 +1,142 @@
+/* event_log.h
+   Binary event log: fixed-size records, formatted long after the fact
+   (hardware independent)
+
+   - push() from any context, ISRs and tasks alike, without locks or
+     formatting: a slot is claimed with a compare-and-swap on the head and
+     published by writing its sequence number last, so an ISR that preempts
+     a half-written record just claims the next slot
+   - drain() from one context only, the lowest-priority one: records come
+     out in claim order, and it stops at a slot still being written
+   - a full log drops the new record and counts it; the drain follows what
+     the log held with a LOG_DROPPED record, and the counters show whether
+     it keeps up
+   - formatLogRecord() is the one formatter, for the firmware's text drain
+     and for the host decoder (host/log_decode.cpp); encodeLogFrame() /
+     decodeLogFrame() frame a record for a serial stream it shares with
+     ordinary text (LOG_SYNC never occurs in ASCII)
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "hit_event.h"
+
+enum LogEventId : uint8_t
+{
+  LOG_HIT,     // pad, velocity; a = pitch (Q8) | zone << 16 | release << 20 | flags << 24, b = ticks to post
+  LOG_DROPPED, // a = records dropped before this point, b = total so far
+  LOG_OVERRUN, // sensor DMA ring overrun: a = total
+  LOG_EVENTS
+};
+
+struct LogRecord
+{
+  uint32_t time; // microseconds (micros() on Teensy: 71 minutes before it wraps)
+  uint8_t id;    // LogEventId
+  uint8_t pad;
+  uint16_t value;
+  uint32_t a;
+  uint32_t b;
+};
+
+static_assert(sizeof(LogRecord) == 16, "LogRecord is a 16-byte wire record");
+
+#define LOG_SYNC 0xA5
+#define LOG_FRAME_BYTES (2 + sizeof(LogRecord)) // sync, record (little endian), checksum
+
+// A hit posted at `nowTicks` (engine ticks) = `nowUs`: stamped with the
+// microsecond its threshold crossing was captured
+LogRecord logHit(const HitEvent &ev, uint32_t nowTicks, uint32_t nowUs, uint32_t clockHz);
+
+// One line, no newline. `clockHz` turns ticks (LOG_HIT b) into microseconds.
+size_t formatLogRecord(const LogRecord &r, uint32_t clockHz, char *out, size_t size);
+
+void encodeLogFrame(const LogRecord &r, uint8_t frame[LOG_FRAME_BYTES]);
+// false on a bad checksum or unknown event
+bool decodeLogFrame(const uint8_t frame[LOG_FRAME_BYTES], LogRecord *r);
+
+template <uint32_t N>
+class EventLog
+{
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "EventLog size must be a power of two");
+
+public:
+  // any context: false (and a drop counted) when full
+  bool push(const LogRecord &record)
+  {
+    uint32_t h;
+    for (;;)
+    {
+      // tail first: the head read after it is never behind it
+      uint32_t t = tail.load(std::memory_order_acquire);
+      h = head.load(std::memory_order_relaxed);
+      if (h - t >= N)
+      {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      if (head.compare_exchange_weak(h, h + 1, std::memory_order_relaxed))
+        break;
+    }
+
+    Slot &s = slots[h & (N - 1)];
+    s.record = record;
+    s.seq.store(h + 1, std::memory_order_release);
+    uint32_t used = h + 1 - tail.load(std::memory_order_relaxed);
+    if (used > highWaterMark.load(std::memory_order_relaxed))
+      highWaterMark.store(used, std::memory_order_relaxed);
+    return true;
+  }
+
+  // consumer only: every published record, in order, to `sink`, then a
+  // LOG_DROPPED record if the log was full since the last drain (the
+  // records lost were newer than the ones it held). Returns the count.
+  template <typename Sink>
+  unsigned int drain(Sink sink)
+  {
+    unsigned int n = 0;
+    uint32_t dropped = droppedCount.load(std::memory_order_relaxed);
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    for (;; ++t, ++n)
+    {
+      Slot &s = slots[t & (N - 1)];
+      if (s.seq.load(std::memory_order_acquire) != t + 1)
+        break; // empty, or claimed and not written yet
+      LogRecord r = s.record;
+      tail.store(t + 1, std::memory_order_release);
+      sink(r);
+    }
+    if (dropped != droppedSeen)
+    {
+      LogRecord r = {};
+      r.id = LOG_DROPPED;
+      r.a = dropped - droppedSeen;
+      r.b = dropped;
+      droppedSeen = dropped;
+      sink(r);
+      ++n;
+    }
+    return n;
+  }
+
+  static constexpr uint32_t capacity() { return N; }
+  uint32_t dropped() const { return droppedCount.load(std::memory_order_relaxed); }
+  uint32_t highWater() const { return highWaterMark.load(std::memory_order_relaxed); }
+
+private:
+  struct Slot
+  {
+    LogRecord record;
+    std::atomic<uint32_t> seq{0}; // claim index + 1 once the record is written
+  };
+
+  Slot slots[N];
+  std::atomic<uint32_t> head{0}; // claimed by producers
+  std::atomic<uint32_t> tail{0}; // written by the consumer only
+  uint32_t droppedSeen = 0;      // consumer only
+  std::atomic<uint32_t> droppedCount{0};
+  std::atomic<uint32_t> highWaterMark{0};
+};
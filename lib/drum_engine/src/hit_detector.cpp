@@ -0,0 +1,482 @@
+#include "hit_detector.h"
+
+#include <math.h>
+#include <string.h>
+#include "drum_mapping.h"
+
+void HitDetector::begin(const DetectorConfig &config, float initialFlex, uint32_t clockHz)
+{
+  cfg = config;
+  if (cfg.fsrPollDivider == 0)
+    cfg.fsrPollDivider = 1;
+  tickHz = clockHz;
+  flexQ16 = (int32_t)(initialFlex * 65536.0f);
+  fsrQ16 = 0;
+  flexCoef = 0;
+  fsrCoef = 0;
+  controlSpacing = 0;
+  controlStamp = 0;
+  controls.store((uint32_t)flexQ16 >> 12, std::memory_order_relaxed);
+  memset(track, 0, sizeof(track));
+  holdTicks = (uint32_t)((uint64_t)cfg.maskHoldUs * tickHz / 1000000);
+  float level = cfg.maskLevel < 0.0f ? 0.0f : cfg.maskLevel > 1.0f ? 1.0f : cfg.maskLevel;
+  maskLevel = (uint16_t)(level * 32767.0f);
+  ringFactor = (uint16_t)((cfg.ringFactor < 0.0f ? 0.0f : cfg.ringFactor > 16.0f ? 16.0f : cfg.ringFactor) * 256.0f);
+  rateSpacing = 0;
+  maskDecay = 0;
+  floorShift = 1;
+  setCrosstalk(HIT_ZONE_CENTER, cfg.crosstalk[HIT_ZONE_CENTER]);
+  setCrosstalk(HIT_ZONE_RIM, cfg.crosstalk[HIT_ZONE_RIM]);
+  zoneMarginQ8 = (uint16_t)((cfg.zoneMargin < 1.0f ? 1.0f : cfg.zoneMargin > 255.0f ? 255.0f : cfg.zoneMargin) * 256.0f);
+  calZone.store(CAL_NONE, std::memory_order_relaxed);
+  calHits = 0;
+  calOwn = 0;
+  calOther = 0;
+  capturing.store(false, std::memory_order_relaxed);
+  setPeakWindow(cfg.peakWindowUs);
+  setPredict(cfg.predictSamples);
+  onsetTime = 0;
+  holding = false;
+  scanning = false;
+  fired = false;
+  sinceOnset = 0;
+  prevStamp = 0;
+  sampleTicks = 0;
+  hitTotal = 0;
+  dropped = 0;
+  fire = HitEvent();
+  last = HitEvent();
+  fsrTick = 0;
+  pressed = false;
+  center = 0;
+  rim = 0;
+  zone = HIT_ZONE_CENTER;
+  padIndex = 0;
+  controlSource = this;
+}
+
+void HitDetector::setPad(uint8_t pad, const HitDetector *controls)
+{
+  padIndex = pad;
+  controlSource = controls ? controls : this;
+}
+
+void HitDetector::setPeakWindow(uint32_t us)
+{
+  cfg.peakWindowUs = us;
+  windowTicks = (uint32_t)((uint64_t)us * tickHz / 1000000);
+}
+
+void HitDetector::setPredict(uint8_t samples)
+{
+  cfg.predictSamples = (samples == 1) ? 2 : samples; // three points for a curvature
+}
+
+void HitDetector::setCrosstalk(HitZone struck, float amplitude)
+{
+  // the matrix has to stay invertible, so no piezo hears more of the
+  // other zone than of its own
+  if (amplitude < 0.0f)
+    amplitude = 0.0f;
+  if (amplitude > 0.99f)
+    amplitude = 0.99f;
+  cfg.crosstalk[struck] = amplitude;
+  xtalkQ12[struck] = (uint16_t)(amplitude * amplitude * 4096.0f + 0.5f);
+}
+
+void HitDetector::startCrosstalkCalibration(HitZone struck)
+{
+  calHits = 0;
+  calOwn = 0;
+  calOther = 0;
+  // release: the sums are zero before the ISR sees the zone and adds
+  calZone.store(struck, std::memory_order_release);
+}
+
+unsigned int HitDetector::finishCrosstalkCalibration()
+{
+  // acquire: the sums are read after the ISR has stopped adding to them
+  uint8_t struck = calZone.exchange(CAL_NONE, std::memory_order_acq_rel);
+  if (struck == CAL_NONE || calHits == 0 || calOwn == 0)
+    return 0;
+  setCrosstalk((HitZone)struck, sqrtf((float)calOther / (float)calOwn));
+  return calHits;
+}
+
+void HitDetector::startRangeCapture()
+{
+  for (int c = 0; c < SENSOR_CHANNELS; ++c)
+  {
+    ranges.min[c] = 0xFFFF;
+    ranges.max[c] = 0;
+  }
+  // release: the ranges are reset before the ISR sees this and widens them
+  capturing.store(true, std::memory_order_release);
+}
+
+void HitDetector::finishRangeCapture(SensorRanges *out)
+{
+  // acquire: the copy is taken after the ISR has stopped widening
+  capturing.exchange(false, std::memory_order_acq_rel);
+  *out = ranges;
+}
+
+void HitDetector::captureRange(SensorChannel channel, uint16_t x)
+{
+  if (x < ranges.min[channel])
+    ranges.min[channel] = x;
+  if (x > ranges.max[channel])
+    ranges.max[channel] = x;
+}
+
+void HitDetector::setThresholds(uint16_t piezo, uint16_t fsr)
+{
+  cfg.piezoThreshold = piezo;
+  cfg.fsrThreshold = fsr;
+}
+
+// True (and `spacing` taken as the new reference) when a sample spacing
+// is more than 1/16 off the one rates were last computed for, so timer
+// jitter does not recompute them
+static bool respaced(uint32_t spacing, uint32_t &ref)
+{
+  if (spacing == 0 || (ref && spacing + ref / 16 >= ref && spacing <= ref + ref / 16))
+    return false;
+  ref = spacing;
+  return true;
+}
+
+// Per-sample mask decay and floor tracking rate for a sample spacing
+void HitDetector::setRates(uint32_t spacing)
+{
+  if (!respaced(spacing, rateSpacing))
+    return;
+  float decayTicks = (float)cfg.maskDecayUs * ((float)tickHz * 1e-6f);
+  maskDecay = decayTicks > 0.0f ? (uint16_t)(expf(-(float)spacing / decayTicks) * 32767.0f) : 0;
+  uint64_t floorTicks = (uint64_t)cfg.floorTauMs * tickHz / 1000;
+  floorShift = 1;
+  while (floorShift < 20 && ((uint64_t)spacing << floorShift) < floorTicks)
+    ++floorShift;
+}
+
+// One-pole coefficient (Q15) for a time constant at a reading spacing
+uint16_t HitDetector::onePole(float tauMs, uint32_t spacing) const
+{
+  float tauTicks = tauMs * ((float)tickHz * 1e-3f);
+  if (tauTicks <= 0.0f)
+    return 32768; // unfiltered
+  return (uint16_t)((1.0f - expf(-(float)spacing / tauTicks)) * 32768.0f + 0.5f);
+}
+
+// One reading of flex and FSR. The first reading after begin() is far
+// from the (zero) last stamp, which makes it the filters' start value.
+void HitDetector::filterControls(uint16_t flexRaw, uint16_t fsrRaw, uint32_t stamp)
+{
+  if (respaced(stamp - controlStamp, controlSpacing))
+  {
+    flexCoef = onePole(cfg.flexTauMs, controlSpacing);
+    fsrCoef = onePole(cfg.fsrTauMs, controlSpacing);
+  }
+  controlStamp = stamp;
+  flexQ16 += (int32_t)(((int64_t)(((int32_t)flexRaw << 16) - flexQ16) * flexCoef) >> 15);
+  fsrQ16 += (int32_t)(((int64_t)(((int32_t)fsrRaw << 16) - fsrQ16) * fsrCoef) >> 15);
+  pressed = fsrQ16 > ((int32_t)cfg.fsrThreshold << 16);
+  controls.store(((uint32_t)flexQ16 >> 12) | (((uint32_t)fsrQ16 >> 12) << 16), std::memory_order_relaxed);
+  if (capturing.load(std::memory_order_acquire))
+  {
+    captureRange(SENSOR_FLEX, (uint16_t)(flexQ16 >> 16));
+    captureRange(SENSOR_FSR, (uint16_t)(fsrQ16 >> 16));
+  }
+}
+
+uint32_t HitDetector::thresholdQ4(const PiezoTrack &t) const
+{
+  uint32_t rise = (uint32_t)cfg.piezoThreshold << 4;
+  uint32_t noise = cfg.noiseFactor * t.devQ4;
+  if (noise > rise)
+    rise = noise;
+  if (t.maskQ4 > rise)
+    rise = t.maskQ4;
+  return t.floorQ4 + rise;
+}
+
+// One sample of a piezo outside a hit: decay its mask, test the
+// threshold, lift the mask to ringFactor times each ringing lobe that
+// stays under it (at the lobe's top, so the rising edge of a new hit does
+// not lift it), and track the noise floor once the mask no longer dominates
+bool HitDetector::quiet(PiezoTrack &t, uint16_t x)
+{
+  t.maskQ4 = (uint32_t)(((uint64_t)t.maskQ4 * maskDecay) >> 15);
+  int32_t xQ4 = (int32_t)x << 4;
+  if ((uint32_t)xQ4 > thresholdQ4(t))
+    return false;
+  uint16_t prev = t.hist[2];
+  t.hist[2] = x;
+  if (x < prev && ((uint32_t)prev << 4) > t.floorQ4)
+  {
+    uint32_t ring = ((((uint32_t)prev << 4) - t.floorQ4) * ringFactor) >> 8;
+    if (ring > t.maskQ4)
+      t.maskQ4 = ring;
+  }
+  if (t.maskQ4 <= ((uint32_t)cfg.piezoThreshold << 4))
+  {
+    int32_t d = xQ4 - (int32_t)t.floorQ4;
+    t.floorQ4 = (uint32_t)((int32_t)t.floorQ4 + (d >> floorShift));
+    int32_t a = d < 0 ? -d : d;
+    t.devQ4 = (uint32_t)((int32_t)t.devQ4 + ((a - (int32_t)t.devQ4) >> floorShift));
+  }
+  return true;
+}
+
+// Hit measured: each piezo masks its own retriggers from its peak
+void HitDetector::endScan()
+{
+  scanning = false;
+  uint8_t cal = calZone.load(std::memory_order_acquire);
+  if (cal != CAL_NONE)
+  {
+    calOwn += track[cal].energy;
+    calOther += track[cal ^ 1].energy;
+    ++calHits;
+  }
+  for (PiezoTrack &t : track)
+  {
+    uint32_t mask = (((uint32_t)level(t) << 4) * maskLevel) >> 15;
+    if (mask > t.maskQ4)
+      t.maskQ4 = mask;
+  }
+}
+
+// Peak of a piezo above its noise floor
+uint16_t HitDetector::level(const PiezoTrack &t) const
+{
+  uint16_t floor = (uint16_t)(t.floorQ4 >> 4);
+  return t.peak > floor ? t.peak - floor : 0;
+}
+
+// One sample of a hit on a piezo: energy above the floor, and the
+// arrival of the wave (half the trigger level) `n` samples in
+static void measure(PiezoTrack &t, uint16_t x, uint8_t n, uint16_t arrivalLevel)
+{
+  uint16_t floor = (uint16_t)(t.floorQ4 >> 4);
+  uint32_t lv = x > floor ? x - floor : 0;
+  t.energy += (lv * lv) >> 4;
+  if (t.arrival == 0xFF && lv >= arrivalLevel)
+    t.arrival = n;
+}
+
+// Zone of the hit so far. The piezos see E = X S for strike energies S
+// and X = [1 x_rim; x_center 1] (crosstalk amplitudes squared); the
+// inverse gives S up to the common factor 1 / (1 - x_center x_rim),
+// which does not change the comparison.
+uint8_t HitDetector::classify() const
+{
+  uint8_t cal = calZone.load(std::memory_order_acquire);
+  if (cal != CAL_NONE)
+    return cal;
+  const PiezoTrack &c = track[SENSOR_PIEZO_CENTER];
+  const PiezoTrack &r = track[SENSOR_PIEZO_RIM];
+  int64_t sc = ((int64_t)c.energy << 12) - (int64_t)xtalkQ12[HIT_ZONE_RIM] * r.energy;
+  int64_t sr = ((int64_t)r.energy << 12) - (int64_t)xtalkQ12[HIT_ZONE_CENTER] * c.energy;
+  if (sc < 0)
+    sc = 0;
+  if (sr < 0)
+    sr = 0;
+  if (sr * 256 > sc * zoneMarginQ8)
+    return HIT_ZONE_RIM;
+  if (sc * 256 > sr * zoneMarginQ8)
+    return HIT_ZONE_CENTER;
+  if (r.arrival != c.arrival)
+    return r.arrival < c.arrival ? HIT_ZONE_RIM : HIT_ZONE_CENTER;
+  return sr > sc ? HIT_ZONE_RIM : HIT_ZONE_CENTER;
+}
+
+// One sample of both piezos. A crossing on either outside the hold time
+// starts a hit; it completes on the first sample past the peak window
+// (at once with no window), with an estimate predictSamples in when early
+// fire is on. The hold is released as soon as a sample past it is seen,
+// so a capture clock that wraps (DWT CYCCNT every ~7 s) cannot reopen it.
+uint8_t HitDetector::scan(uint16_t c, uint16_t r, uint32_t stamp)
+{
+  const uint16_t x[2] = {c, r};
+  center = c;
+  rim = r;
+  if (capturing.load(std::memory_order_acquire))
+  {
+    captureRange(SENSOR_PIEZO_CENTER, c);
+    captureRange(SENSOR_PIEZO_RIM, r);
+  }
+  uint32_t spacing = stamp - prevStamp;
+  prevStamp = stamp;
+  if (scanning)
+  {
+    sampleTicks = spacing;
+    if (sinceOnset < 254)
+      ++sinceOnset;
+    for (int i = 0; i < 2; ++i)
+    {
+      PiezoTrack &t = track[i];
+      if (x[i] > t.peak)
+        t.peak = x[i];
+      t.hist[0] = t.hist[1];
+      t.hist[1] = t.hist[2];
+      t.hist[2] = x[i];
+      measure(t, x[i], sinceOnset, cfg.piezoThreshold / 2);
+    }
+
+    if (stamp - onsetTime >= windowTicks)
+    {
+      endScan();
+      return fired ? SCAN_CORRECTION : SCAN_HIT;
+    }
+    if (!fired && sinceOnset == cfg.predictSamples)
+    {
+      fired = true;
+      return SCAN_ESTIMATE;
+    }
+    return SCAN_NONE;
+  }
+
+  setRates(spacing);
+  bool crossed = !quiet(track[0], c);
+  crossed = !quiet(track[1], r) || crossed;
+  if (holding && stamp - onsetTime > holdTicks)
+    holding = false;
+  if (!crossed || holding)
+    return SCAN_NONE;
+  onsetTime = stamp;
+  holding = true;
+  fired = false;
+  for (int i = 0; i < 2; ++i)
+  {
+    PiezoTrack &t = track[i];
+    t.peak = x[i];
+    t.hist[0] = t.hist[1] = t.hist[2] = x[i];
+    t.energy = 0;
+    t.arrival = 0xFF;
+    measure(t, x[i], 0, cfg.piezoThreshold / 2);
+  }
+  sinceOnset = 0;
+  scanning = windowTicks != 0;
+  if (scanning)
+    return SCAN_NONE;
+  endScan();
+  return SCAN_HIT;
+}
+
+// Peak of a piezo from its last three samples, modelled as
+// y = A sin(wt) sampled every dt: the curvature gives the frequency,
+// y0 + y2 = 2 y1 cos(w dt), the slope the phase, (y2 - y0) / 2 =
+// A cos(wt) sin(w dt), so A^2 = y1^2 + (slope / sin(w dt))^2. An attack
+// too straight to show curvature (or clipped) assumes ringHz.
+uint16_t HitDetector::predictPeak(const PiezoTrack &t) const
+{
+  const uint16_t *y = t.hist;
+  float peak = t.peak;
+  if (y[1] > 0)
+  {
+    float cosNominal = cosf(6.2831853f * cfg.ringHz * (float)sampleTicks / (float)tickHz);
+    float cosW = (float)(y[0] + y[2]) / (2.0f * y[1]);
+    if (cosW > cosNominal)
+      cosW = cosNominal;
+    if (cosW < 0.0f)
+      cosW = 0.0f;
+    float slope = 0.5f * ((float)y[2] - (float)y[0]);
+    float sin2 = 1.0f - cosW * cosW;
+    float a = sin2 > 1e-6f ? sqrtf((float)y[1] * y[1] + slope * slope / sin2) : (float)ADC_MAX;
+    if (a > peak)
+      peak = a;
+  }
+  peak -= (float)(t.floorQ4 >> 4);
+  uint16_t measured = level(t);
+  if (peak < measured)
+    return measured;
+  return (uint16_t)(peak < ADC_MAX ? peak + 0.5f : ADC_MAX);
+}
+
+void HitDetector::makeHit(uint8_t result, HitEvent *ev)
+{
+  ev->zone = classify();
+  const PiezoTrack &struck = track[ev->zone];
+  ev->time = onsetTime;
+  ev->velocity = result == SCAN_ESTIMATE ? predictPeak(struck) : level(struck);
+  ev->pitch = flexToPitchQ8((uint16_t)((controlSource->flexQ16 + 0x8000) >> 16));
+  ev->release = controlSource->pressed ? HIT_RELEASE_SHORT : HIT_RELEASE_LONG;
+  ev->flags = result == SCAN_ESTIMATE ? HIT_FLAG_ESTIMATE : 0;
+  ev->pad = padIndex;
+  zone = ev->zone;
+  fire = *ev;
+  if (result == SCAN_HIT)
+  {
+    last = *ev;
+    ++hitTotal;
+  }
+}
+
+// Same hit as the estimate (and zone: the voice has started), with the
+// velocity measured over the window
+void HitDetector::makeCorrection(HitEvent *ev)
+{
+  *ev = fire;
+  ev->velocity = level(track[fire.zone]);
+  ev->flags = HIT_FLAG_CORRECTION;
+  last = *ev;
+  ++hitTotal;
+}
+
+uint8_t HitDetector::tick(SensorRead read, uint32_t stamp, HitEvent *ev)
+{
+  uint8_t result = DETECT_NONE;
+  uint16_t c = read(SENSOR_PIEZO_CENTER);
+  uint16_t r = read(SENSOR_PIEZO_RIM);
+
+  // flex and FSR are filtered continuously: a press damps notes that are
+  // already ringing, and a hit finds both current without reading them
+  if (++fsrTick >= cfg.fsrPollDivider)
+  {
+    fsrTick = 0;
+    filterControls(read(SENSOR_FLEX), read(SENSOR_FSR), stamp);
+    result |= DETECT_FSR;
+  }
+
+  uint8_t hit = scan(c, r, stamp);
+  if (hit == SCAN_NONE)
+    return result;
+  if (hit == SCAN_CORRECTION)
+  {
+    makeCorrection(ev);
+    return result | DETECT_HIT;
+  }
+  makeHit(hit, ev);
+  return result | DETECT_HIT;
+}
+
+unsigned int HitDetector::processBlock(const SensorBlock &block, HitEvent *hits, unsigned int maxHits)
+{
+  unsigned int found = 0;
+  const uint16_t *f = block.frames;
+  uint32_t stamp = block.time;
+  const uint8_t *slot = block.slot;
+  bool controls = slot[SENSOR_FLEX] != SENSOR_NO_SLOT && slot[SENSOR_FSR] != SENSOR_NO_SLOT;
+  bool hasRim = slot[SENSOR_PIEZO_RIM] != SENSOR_NO_SLOT;
+  for (unsigned int i = 0; i < block.count; ++i, f += block.stride, stamp += block.ticksPerFrame)
+  {
+    if (controls)
+      filterControls(f[slot[SENSOR_FLEX]], f[slot[SENSOR_FSR]], stamp);
+    uint8_t hit = scan(f[slot[SENSOR_PIEZO_CENTER]], hasRim ? f[slot[SENSOR_PIEZO_RIM]] : 0, stamp);
+    if (hit == SCAN_NONE)
+      continue;
+    if (found == maxHits)
+    {
+      ++dropped;
+      continue;
+    }
+    if (hit == SCAN_CORRECTION)
+    {
+      makeCorrection(&hits[found++]);
+      continue;
+    }
+    makeHit(hit, &hits[found++]);
+  }
+  return found;
+}
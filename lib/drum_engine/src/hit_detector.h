@@ -0,0 +1,267 @@
+/* hit_detector.h
+   Piezo hit detection for one pad (hardware independent)
+
+   - tick() is the body of the sensor ISR: called every
+     FLEX_SAMPLE_INTERVAL_US with the capture timestamp, it reads the two
+     piezos through a callback and turns a threshold crossing into a
+     HitEvent
+   - each piezo has its own threshold: a tracked noise floor plus the
+     larger of piezoThreshold, noiseFactor mean deviations of the noise,
+     and a retrigger mask that starts at maskLevel of that piezo's last
+     peak, decays with maskDecayUs and is lifted to ringFactor times each
+     ringing lobe that stays under it. Ringing after a loud hit (and the
+     shell ring of a roll) stays under the mask while a soft follow-up
+     hit clears it, which a flat debounce cannot do; only maskHoldUs
+     after a crossing is fully blocked
+   - zone: each piezo's energy over the scan window, less what the
+     crosstalk matrix says the other piezo's strike puts on it, picks the
+     struck piezo; when the two are within zoneMargin of each other the
+     piezo the wave reached first decides. The matrix is measured by
+     striking one zone at a time (startCrosstalkCalibration())
+   - range capture (startRangeCapture()) keeps the lowest and highest
+     reading of every channel, piezos raw and flex / FSR filtered, for a
+     guided sensor calibration (sensor_profile.h)
+   - velocity is the peak of the struck piezo over peakWindowUs from the
+     crossing, not the crossing sample, which is early on the attack and
+     biased low; the hit is reported when the window closes and keeps the
+     crossing as its time. Longer windows find the peak of slower attacks
+     at the cost of that much latency; 0 reports the crossing sample
+   - early fire (predictSamples > 0): predictSamples after the crossing
+     the peak is predicted from the slope and curvature of the attack and
+     the hit is reported at once (HIT_FLAG_ESTIMATE); when the window
+     closes the measured peak follows as a HIT_FLAG_CORRECTION event
+   - flex and FSR are filtered continuously (one-pole, flexTauMs /
+     fsrTauMs whatever the reading rate): on every frame in block form,
+     every fsrPollDivider ticks through the callback. The filtered pair
+     is published as one atomic word, so a hit (or any other context)
+     reads a current value without a read or an interrupt mask
+   - processBlock() is the block form for DMA-fed acquisition: every
+     channel is converted on every frame, the detector walks the frames in
+     order and reports the hits they contain. The block's stride and slots
+     say where in a frame each channel is, so a detector can walk its own
+     pad's values in a frame of many pads (pad_array.h); a pad without a
+     rim piezo or flex / FSR slot skips them
+   - all timing (mask, window, hit timestamps) is in the capture clock's
+     ticks, so both forms behave the same at any sample rate
+   - the binding decides what to do with the result (post the hit, set
+     the damping state), so the same code runs on the Teensy and on a host
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include "hit_event.h"
+
+enum SensorChannel : uint8_t
+{
+  SENSOR_PIEZO_CENTER = 0,
+  SENSOR_PIEZO_RIM = 1,
+  SENSOR_FLEX = 2,
+  SENSOR_FSR = 3,
+  SENSOR_CHANNELS
+};
+
+// One ADC conversion of a sensor channel
+typedef uint16_t (*SensorRead)(SensorChannel channel);
+
+#define SENSOR_NO_SLOT 0xFF
+
+// A block of frames converted back to back at a fixed rate, each frame
+// `stride` values; slot[c] is where SensorChannel c is in a frame
+struct SensorBlock
+{
+  const uint16_t *frames; // count * stride values
+  unsigned int count;
+  uint32_t time;          // capture tick of frames[0]
+  uint32_t ticksPerFrame;
+  unsigned int stride;
+  uint8_t slot[SENSOR_CHANNELS]; // SENSOR_NO_SLOT: channel not in this block
+};
+
+// One value per SensorChannel per frame, in SensorChannel order
+static inline void sensorBlockLayout(SensorBlock &block)
+{
+  block.stride = SENSOR_CHANNELS;
+  for (int c = 0; c < SENSOR_CHANNELS; ++c)
+    block.slot[c] = (uint8_t)c;
+}
+
+// Lowest and highest reading of each channel over a capture
+struct SensorRanges
+{
+  uint16_t min[SENSOR_CHANNELS];
+  uint16_t max[SENSOR_CHANNELS];
+};
+
+struct DetectorConfig
+{
+  uint16_t piezoThreshold; // least trigger level above the noise floor
+  uint8_t noiseFactor;     // ...and at least this many mean deviations of the noise
+  uint32_t floorTauMs;     // noise floor / deviation tracking time constant
+  uint32_t maskHoldUs;     // no new hit at all this long after a crossing
+  float maskLevel;         // retrigger mask after a hit, fraction of its peak
+  uint32_t maskDecayUs;    // retrigger mask time constant
+  float ringFactor;        // a new hit must rise this far above the last ringing lobe
+  uint16_t fsrThreshold;
+  uint8_t fsrPollDivider; // tick(): flex and FSR read every Nth tick
+  float flexTauMs;        // flex filter time constant
+  float fsrTauMs;         // FSR filter time constant
+  uint32_t peakWindowUs;  // velocity scan after the crossing, 0 = none
+  uint8_t predictSamples; // early fire this many samples after the crossing (>= 2), 0 = off
+  float ringHz;           // nominal piezo ring frequency, for attacks with no curvature yet
+  float crosstalk[2];     // per HitZone: amplitude the other piezo sees from a strike there (< 1)
+  float zoneMargin;       // energy ratio under which arrival order decides the zone
+};
+
+enum DetectResult : uint8_t
+{
+  DETECT_NONE = 0,
+  DETECT_HIT = 1 << 0, // *ev holds a new hit
+  DETECT_FSR = 1 << 1  // FSR was read, fsrPressed() is fresh
+};
+
+// Trigger state of one piezo, levels in Q4 ADC counts
+struct PiezoTrack
+{
+  uint32_t floorQ4; // tracked noise floor (mean while quiet)
+  uint32_t devQ4;   // mean absolute deviation around it
+  uint32_t maskQ4;  // retrigger mask above the floor, decaying
+  uint16_t peak;    // max since the crossing
+  uint32_t energy;  // sum of squared levels since the crossing, >> 4
+  uint8_t arrival;  // samples from the crossing to the first half-threshold level, 255 = none yet
+  uint16_t hist[3]; // last three samples, oldest first (only the last while quiet)
+};
+
+class HitDetector
+{
+public:
+  // `clockHz` is the rate of the capture clock the stamps come from
+  void begin(const DetectorConfig &config, float initialFlex, uint32_t clockHz);
+
+  // Pad `pad` of an array: its hits carry the index, and with `controls`
+  // set their pitch and damping come from that detector's flex and FSR
+  // (the pad's own blocks then need no flex / FSR slots)
+  void setPad(uint8_t pad, const HitDetector *controls);
+
+  // One sensor tick. `stamp` (capture clock) becomes HitEvent::time.
+  // Returns DetectResult flags.
+  uint8_t tick(SensorRead read, uint32_t stamp, HitEvent *ev);
+
+  // Every frame of `block` in order; up to `maxHits` hits go to `hits`,
+  // the rest are counted in droppedHits(). Returns the hit count.
+  unsigned int processBlock(const SensorBlock &block, HitEvent *hits, unsigned int maxHits);
+
+  // Takes effect from the next crossing; safe to call while ticking
+  void setPeakWindow(uint32_t us);
+  uint32_t peakWindow() const { return cfg.peakWindowUs; }
+  void setPredict(uint8_t samples);
+  uint8_t predictSamples() const { return cfg.predictSamples; }
+
+  bool fsrPressed() const { return pressed; }
+  // Filtered flex and FSR (Q4 ADC counts), safe from any context
+  uint16_t flexQ4() const { return (uint16_t)controls.load(std::memory_order_relaxed); }
+  uint16_t fsrQ4() const { return (uint16_t)(controls.load(std::memory_order_relaxed) >> 16); }
+  float flex() const { return flexQ4() / 16.0f; }
+  uint16_t lastCenter() const { return center; }
+  uint16_t lastRim() const { return rim; }
+  uint8_t lastZone() const { return zone; }
+  // tracked noise floor and current trigger level of a piezo (ADC counts)
+  uint16_t noiseFloor(SensorChannel piezo) const { return (uint16_t)(track[piezo].floorQ4 >> 4); }
+  uint16_t threshold(SensorChannel piezo) const { return (uint16_t)(thresholdQ4(track[piezo]) >> 4); }
+  // Completed hits (velocity measured): plain hits and corrections.
+  // lastEstimate() is the velocity the last hit was fired with.
+  uint32_t hitCount() const { return hitTotal; }
+  // Hits processBlock() had no room for (detection state moved on anyway)
+  uint32_t droppedHits() const { return dropped; }
+  const HitEvent &lastHit() const { return last; }
+  uint16_t lastEstimate() const { return fire.velocity; }
+
+  // Crosstalk calibration: until finishCrosstalkCalibration() every hit
+  // is taken to be on `struck` and the energy the other piezo sees is
+  // averaged. Finishing stores the measured amplitude as
+  // crosstalk(struck) and returns the hits it came from (0: unchanged).
+  void startCrosstalkCalibration(HitZone struck);
+  unsigned int finishCrosstalkCalibration();
+  bool calibrating() const { return calZone.load(std::memory_order_relaxed) != CAL_NONE; }
+  float crosstalk(HitZone struck) const { return cfg.crosstalk[struck]; }
+
+  // Range capture: from start to finish every reading widens `ranges`
+  void startRangeCapture();
+  void finishRangeCapture(SensorRanges *ranges);
+
+  // A new sensor profile while running: takes effect from the next reading
+  void setThresholds(uint16_t piezo, uint16_t fsr);
+  void setCrosstalk(HitZone struck, float amplitude);
+  uint16_t piezoThreshold() const { return cfg.piezoThreshold; }
+  uint16_t fsrThreshold() const { return cfg.fsrThreshold; }
+
+private:
+  enum ScanResult : uint8_t
+  {
+    SCAN_NONE,
+    SCAN_HIT,
+    SCAN_ESTIMATE,
+    SCAN_CORRECTION
+  };
+
+  uint8_t scan(uint16_t c, uint16_t r, uint32_t stamp);
+  void setRates(uint32_t spacing);
+  uint16_t onePole(float tauMs, uint32_t spacing) const;
+  void filterControls(uint16_t flexRaw, uint16_t fsrRaw, uint32_t stamp);
+  void captureRange(SensorChannel channel, uint16_t x);
+  uint32_t thresholdQ4(const PiezoTrack &t) const;
+  bool quiet(PiezoTrack &t, uint16_t x);
+  void endScan();
+  uint8_t classify() const;
+  uint16_t predictPeak(const PiezoTrack &t) const;
+  uint16_t level(const PiezoTrack &t) const;
+  void makeHit(uint8_t result, HitEvent *ev);
+  void makeCorrection(HitEvent *ev);
+
+  DetectorConfig cfg;
+  uint32_t tickHz;
+  int32_t flexQ16; // filter states
+  int32_t fsrQ16;
+  uint16_t flexCoef; // Q15 per reading
+  uint16_t fsrCoef;
+  uint32_t controlSpacing; // reading spacing the coefficients were computed for
+  uint32_t controlStamp;
+  std::atomic<uint32_t> controls; // published flexQ4 | fsrQ4 << 16
+  PiezoTrack track[2]; // SENSOR_PIEZO_CENTER, SENSOR_PIEZO_RIM
+  uint32_t holdTicks;
+  uint32_t windowTicks;
+  uint32_t rateSpacing; // sample spacing maskDecay/floorShift were computed for
+  uint16_t maskDecay;   // Q15 per-sample mask multiplier
+  uint16_t maskLevel;   // Q15
+  uint16_t ringFactor;  // Q8
+  uint8_t floorShift;   // per-sample floor tracking rate, 2^-floorShift
+  uint16_t xtalkQ12[2]; // crosstalk energy coupling per struck zone, Q12
+  uint16_t zoneMarginQ8;
+  uint32_t onsetTime;
+  bool holding;
+  bool scanning;
+  bool fired; // estimate reported, correction pending
+  uint8_t sinceOnset;
+  uint32_t prevStamp;
+  uint32_t sampleTicks; // spacing of the last two samples
+  uint32_t hitTotal;
+  uint32_t dropped;
+  HitEvent fire; // as the last hit was reported (estimate or measured)
+  HitEvent last;
+  uint8_t fsrTick;
+  bool pressed;
+  uint16_t center;
+  uint16_t rim;
+  uint8_t zone;
+  uint8_t padIndex;
+  const HitDetector *controlSource; // flex / FSR of the hits: this, or the array's controls pad
+
+  static const uint8_t CAL_NONE = 0xFF;
+  std::atomic<uint8_t> calZone; // HitZone being calibrated, CAL_NONE; publishes the sums below
+  uint32_t calHits;
+  uint64_t calOwn;   // energy sums over the calibration hits
+  uint64_t calOther;
+  std::atomic<bool> capturing; // publishes `ranges`
+  SensorRanges ranges;
+};
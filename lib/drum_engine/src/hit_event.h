@@ -0,0 +1,40 @@
+/* hit_event.h
+   One detected drum hit, as handed from the sensor ISR to the audio update
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#ifndef PAD_MAX
+#define PAD_MAX 16 // pads of a PadArray (HitEvent::pad)
+#endif
+
+enum HitZone : uint8_t
+{
+  HIT_ZONE_CENTER = 0,
+  HIT_ZONE_RIM = 1
+};
+
+enum HitRelease : uint8_t
+{
+  HIT_RELEASE_LONG = 0,
+  HIT_RELEASE_SHORT = 1
+};
+
+enum HitFlags : uint8_t
+{
+  HIT_FLAG_ESTIMATE = 1 << 0,  // velocity is predicted, a correction follows
+  HIT_FLAG_CORRECTION = 1 << 1 // not a new hit: measured velocity of the last estimate
+};
+
+struct HitEvent
+{
+  uint32_t time;     // capture timestamp in engine ticks (DWT cycles on Teensy)
+  uint16_t velocity; // raw piezo ADC value of the hit
+  int16_t pitch;     // semitones above the root sample, Q8
+  uint8_t zone;      // HitZone
+  uint8_t release;   // HitRelease
+  uint8_t flags;     // HitFlags
+  uint8_t pad;       // pad of a PadArray, 0 for a single pad
+};
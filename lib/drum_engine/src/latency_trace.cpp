@@ -0,0 +1,65 @@
+#include "latency_trace.h"
+
+#include <string.h>
+
+static const char *const stageNames[TRACE_STAGES] = {"isr exit", "dequeue", "lookup", "rendered", "i2s"};
+
+const char *traceStageName(TraceStage stage)
+{
+  return stage < TRACE_STAGES ? stageNames[stage] : "";
+}
+
+void traceClear(LatencyTrace &trace)
+{
+  memset(&trace, 0, sizeof(trace));
+}
+
+unsigned int traceBucket(uint32_t ticks)
+{
+  if (ticks < TRACE_EXACT)
+    return ticks;
+  unsigned int octave = 31 - __builtin_clz(ticks); // >= 4
+  unsigned int sub = (ticks >> (octave - TRACE_SUB_BITS)) & ((1u << TRACE_SUB_BITS) - 1);
+  return TRACE_EXACT + ((octave - 4) << TRACE_SUB_BITS) + sub;
+}
+
+uint32_t traceBucketFloor(unsigned int bucket)
+{
+  if (bucket < TRACE_EXACT)
+    return bucket;
+  unsigned int octave = 4 + ((bucket - TRACE_EXACT) >> TRACE_SUB_BITS);
+  uint32_t sub = (bucket - TRACE_EXACT) & ((1u << TRACE_SUB_BITS) - 1);
+  return ((1u << TRACE_SUB_BITS) | sub) << (octave - TRACE_SUB_BITS);
+}
+
+void traceRecord(TraceHistogram &h, uint32_t ticks)
+{
+  if (h.count == 0 || ticks < h.min)
+    h.min = ticks;
+  if (h.count == 0 || ticks > h.max)
+    h.max = ticks;
+  ++h.count;
+  h.sum += ticks;
+  ++h.buckets[traceBucket(ticks)];
+}
+
+uint32_t tracePercentile(const TraceHistogram &h, unsigned int permille)
+{
+  if (h.count == 0)
+    return 0;
+  uint64_t rank = ((uint64_t)h.count * permille + 999) / 1000; // 1-based
+  if (rank == 0)
+    rank = 1;
+  uint64_t seen = 0;
+  for (unsigned int b = 0; b < TRACE_BUCKETS; ++b)
+  {
+    seen += h.buckets[b];
+    if (seen < rank)
+      continue;
+    uint32_t top = b + 1 < TRACE_BUCKETS ? traceBucketFloor(b + 1) - 1 : 0xFFFFFFFFu;
+    if (top > h.max)
+      top = h.max;
+    return top < h.min ? h.min : top;
+  }
+  return h.max;
+}
@@ -0,0 +1,61 @@
+/* latency_trace.h
+   Hit-to-sound latency per pipeline stage, aggregated on the device
+   (hardware independent)
+
+   - every stage is measured from the hit's threshold crossing
+     (HitEvent::time) in engine ticks (DWT cycles on Teensy), so the
+     stages of one hit share a reference and add up
+   - each stage has a fixed-bucket histogram: exact below 16 ticks, then
+     8 buckets per octave (12.5 % wide), 240 buckets to 2^32 ticks, so
+     min / p50 / p99 / max come out of a few KB with no allocation and no
+     sorting
+   - a stage is only ever recorded from one context (the sensor ISR or the
+     bare-metal sensor poll for TRACE_ISR_EXIT, the audio update for the
+     rest), so recording takes no lock; the binding copies or clears it
+     with interrupts off
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+enum TraceStage : uint8_t
+{
+  TRACE_ISR_EXIT,  // sensor ISR (bare metal: the poll) done with the block the hit was found in
+  TRACE_DEQUEUE,   // audio update takes the hit off the queue
+  TRACE_LOOKUP,    // bank lookup done
+  TRACE_RENDERED,  // first audio block the hit's voice sounds in mixed (+ its offset in the block)
+  TRACE_I2S,       // that block handed to the I2S DMA (the next update starts, + the offset)
+  TRACE_STAGES
+};
+
+#define TRACE_EXACT 16
+#define TRACE_SUB_BITS 3 // 8 buckets per octave
+#define TRACE_BUCKETS (TRACE_EXACT + (32 - 4) * (1 << TRACE_SUB_BITS))
+
+struct TraceHistogram
+{
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t sum;
+  uint32_t buckets[TRACE_BUCKETS];
+};
+
+struct LatencyTrace
+{
+  TraceHistogram stage[TRACE_STAGES];
+};
+
+const char *traceStageName(TraceStage stage);
+
+void traceClear(LatencyTrace &trace);
+void traceRecord(TraceHistogram &h, uint32_t ticks);
+
+// Lowest value of a bucket, and the bucket of a value
+uint32_t traceBucketFloor(unsigned int bucket);
+unsigned int traceBucket(uint32_t ticks);
+
+// Ticks at or below which `permille` of the samples lie: the upper edge
+// of the bucket holding that rank, within min..max
+uint32_t tracePercentile(const TraceHistogram &h, unsigned int permille);
@@ -0,0 +1,318 @@
+#include "mix_kernel.h"
+
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP)
+
+static inline uint32_t smlad(uint32_t x, uint32_t y, uint32_t acc)
+{
+  uint32_t r;
+  asm("smlad %0, %1, %2, %3" : "=r"(r) : "r"(x), "r"(y), "r"(acc));
+  return r;
+}
+
+static inline uint32_t sadd16(uint32_t a, uint32_t b)
+{
+  uint32_t r;
+  asm("sadd16 %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+}
+
+// low halves of a and b -> (a.lo, b.lo)
+static inline uint32_t packLow(uint32_t a, uint32_t b)
+{
+  uint32_t r;
+  asm("pkhbt %0, %1, %2, lsl #16" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+}
+
+// high halves of a and b -> (a.hi, b.hi)
+static inline uint32_t packHigh(uint32_t a, uint32_t b)
+{
+  uint32_t r;
+  asm("pkhtb %0, %1, %2, asr #16" : "=r"(r) : "r"(b), "r"(a));
+  return r;
+}
+
+static inline int32_t sat16Shift(int32_t x)
+{
+  int32_t r;
+  asm("ssat %0, #16, %1, asr %2" : "=r"(r) : "r"(x), "I"(MIX_GAIN_SHIFT));
+  return r;
+}
+
+#else
+
+// Same arithmetic as the Cortex-M7 instructions, so the packed kernel below
+// can be built and checked on a host.
+static inline uint32_t smlad(uint32_t x, uint32_t y, uint32_t acc)
+{
+  int32_t lo = (int32_t)(int16_t)x * (int16_t)y;
+  int32_t hi = (int32_t)(int16_t)(x >> 16) * (int16_t)(y >> 16);
+  return acc + (uint32_t)lo + (uint32_t)hi;
+}
+
+static inline uint32_t sadd16(uint32_t a, uint32_t b)
+{
+  uint32_t lo = (a + b) & 0xFFFF;
+  uint32_t hi = ((a >> 16) + (b >> 16)) & 0xFFFF;
+  return lo | (hi << 16);
+}
+
+static inline uint32_t packLow(uint32_t a, uint32_t b)
+{
+  return (a & 0xFFFF) | (b << 16);
+}
+
+static inline uint32_t packHigh(uint32_t a, uint32_t b)
+{
+  return (a >> 16) | (b & 0xFFFF0000);
+}
+
+static inline int32_t sat16Shift(int32_t x)
+{
+  x >>= MIX_GAIN_SHIFT;
+  if (x > 32767)
+    return 32767;
+  if (x < -32768)
+    return -32768;
+  return x;
+}
+
+#endif
+
+static inline uint32_t pack16(int16_t lo, int16_t hi)
+{
+  return (uint16_t)lo | ((uint32_t)(uint16_t)hi << 16);
+}
+
+// steps that carry one more of the ramp's remainder
+static inline unsigned int carrySteps(const MixInput &in, unsigned int n)
+{
+  unsigned int c = in.gainCarry < 0 ? -in.gainCarry : in.gainCarry;
+  return c < n ? c : n;
+}
+
+static inline int16_t carriedStep(const MixInput &in)
+{
+  return (int16_t)(in.gainStep + (in.gainCarry < 0 ? -1 : 1));
+}
+
+static void accumulateOne(int32_t *acc, const MixInput &in, unsigned int n)
+{
+  const int16_t *a = in.src;
+  int32_t g = in.gain;
+  unsigned int carry = carrySteps(in, n);
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    acc[i] = (int32_t)((uint32_t)acc[i] + (uint32_t)(a[i] * g));
+    g = (int16_t)(g + (i < carry ? carriedStep(in) : in.gainStep));
+  }
+}
+
+void mixAccumulateRef(int32_t *acc, const MixInput *in, unsigned int count, unsigned int n)
+{
+  for (unsigned int k = 0; k < count; ++k)
+    accumulateOne(acc, in[k], n);
+}
+
+// Samples [from, to) of a pair, both gains advancing by dg after each.
+// Each word of a and b holds two samples, repacked into (a[i], b[i]) so
+// one SMLAD applies both gains to output sample i.
+static void accumulatePair(uint32_t *dst, const uint32_t *a, const uint32_t *b, uint32_t &g, uint32_t dg,
+                           unsigned int from, unsigned int to)
+{
+  unsigned int i = from;
+  if (i < to && (i & 1))
+  {
+    dst[i] = smlad(packHigh(a[i / 2], b[i / 2]), g, dst[i]);
+    g = sadd16(g, dg);
+    ++i;
+  }
+  for (; i + 1 < to; i += 2)
+  {
+    uint32_t wa = a[i / 2];
+    uint32_t wb = b[i / 2];
+    dst[i] = smlad(packLow(wa, wb), g, dst[i]);
+    g = sadd16(g, dg);
+    dst[i + 1] = smlad(packHigh(wa, wb), g, dst[i + 1]);
+    g = sadd16(g, dg);
+  }
+  if (i < to)
+  {
+    dst[i] = smlad(packLow(a[i / 2], b[i / 2]), g, dst[i]);
+    g = sadd16(g, dg);
+  }
+}
+
+void mixAccumulate(int32_t *acc, const MixInput *in, unsigned int count, unsigned int n)
+{
+  unsigned int k = 0;
+  for (; k + 1 < count; k += 2)
+  {
+    // two inputs per pass, in up to three runs: both still carrying their
+    // remainder, one of them, neither
+    const MixInput &x = in[k];
+    const MixInput &y = in[k + 1];
+    unsigned int cx = carrySteps(x, n);
+    unsigned int cy = carrySteps(y, n);
+    unsigned int c0 = cx < cy ? cx : cy;
+    unsigned int c1 = cx < cy ? cy : cx;
+    uint32_t g = pack16(x.gain, y.gain);
+    uint32_t *dst = (uint32_t *)acc;
+    const uint32_t *a = (const uint32_t *)x.src;
+    const uint32_t *b = (const uint32_t *)y.src;
+    accumulatePair(dst, a, b, g, pack16(carriedStep(x), carriedStep(y)), 0, c0);
+    accumulatePair(dst, a, b, g, cx > cy ? pack16(carriedStep(x), y.gainStep) : pack16(x.gainStep, carriedStep(y)),
+                   c0, c1);
+    accumulatePair(dst, a, b, g, pack16(x.gainStep, y.gainStep), c1, n);
+  }
+  if (k < count)
+    accumulateOne(acc, in[k], n);
+}
+
+void mixSaturateRef(int16_t *out, const int32_t *acc, unsigned int n)
+{
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    int32_t x = acc[i] >> MIX_GAIN_SHIFT;
+    if (x > 32767)
+      x = 32767;
+    else if (x < -32768)
+      x = -32768;
+    out[i] = (int16_t)x;
+  }
+}
+
+void mixSaturate(int16_t *out, const int32_t *acc, unsigned int n)
+{
+  uint32_t *dst = (uint32_t *)out;
+  for (unsigned int i = 0; i < n / 2; ++i)
+    dst[i] = pack16((int16_t)sat16Shift(acc[2 * i]), (int16_t)sat16Shift(acc[2 * i + 1]));
+}
+
+// ------------------- verification -------------------
+#define MIX_TEST_SOURCES 4
+#define MIX_TEST_VOICES 16
+#define MIX_TEST_SAMPLES 128
+
+static int16_t testSrc[MIX_TEST_SOURCES][MIX_TEST_SAMPLES] __attribute__((aligned(4)));
+static int32_t testAcc[2][MIX_TEST_SAMPLES] __attribute__((aligned(4)));
+static int16_t testOut[2][MIX_TEST_SAMPLES] __attribute__((aligned(4)));
+
+static uint32_t nextRandom(uint32_t &state)
+{
+  state = state * 1664525u + 1013904223u;
+  return state >> 8;
+}
+
+// Sources cover full scale (including -32768) so the saturation path and
+// the sign handling of the packed products are both exercised.
+static void makeInputs(MixInput *in, unsigned int voices, unsigned int n, uint32_t &seed)
+{
+  for (int s = 0; s < MIX_TEST_SOURCES; ++s)
+    for (unsigned int i = 0; i < n; ++i)
+      testSrc[s][i] = (int16_t)(nextRandom(seed) & 0xFFFF);
+  for (unsigned int k = 0; k < voices; ++k)
+  {
+    int32_t g0 = (int32_t)(nextRandom(seed) % (MIX_GAIN_UNITY + 1));
+    int32_t g1 = (int32_t)(nextRandom(seed) % (MIX_GAIN_UNITY + 1));
+    in[k].src = testSrc[k % MIX_TEST_SOURCES];
+    mixSetRamp(in[k], g0, g1, n);
+  }
+}
+
+uint32_t mixSelfTest(unsigned int voices, unsigned int n, uint32_t seed)
+{
+  if (voices > MIX_TEST_VOICES)
+    voices = MIX_TEST_VOICES;
+  if (n > MIX_TEST_SAMPLES)
+    n = MIX_TEST_SAMPLES;
+  n &= ~1u;
+
+  MixInput in[MIX_TEST_VOICES] = {};
+  makeInputs(in, voices, n, seed);
+  memset(testAcc, 0, sizeof(testAcc));
+  mixAccumulateRef(testAcc[0], in, voices, n);
+  mixAccumulate(testAcc[1], in, voices, n);
+  mixSaturateRef(testOut[0], testAcc[0], n);
+  mixSaturate(testOut[1], testAcc[1], n);
+
+  uint32_t errors = 0;
+  for (unsigned int i = 0; i < n; ++i)
+    if (testAcc[0][i] != testAcc[1][i] || testOut[0][i] != testOut[1][i])
+      ++errors;
+  return errors;
+}
+
+// Every ramp between these gains, alone and in either lane of a pair (the
+// other lane on silence, ramping the other way): with a source of 1 the
+// accumulator is the gain itself, which must start on g0, end on g1 and
+// stay between them.
+uint32_t mixRampTest(unsigned int n)
+{
+  static const int16_t ends[] = {0, 1, 158, 2047, 4095, MIX_GAIN_UNITY};
+  const unsigned int count = sizeof(ends) / sizeof(ends[0]);
+  if (n > MIX_TEST_SAMPLES)
+    n = MIX_TEST_SAMPLES;
+  n &= ~1u;
+  if (n < 2)
+    return 0;
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    testSrc[0][i] = 1;
+    testSrc[1][i] = 0;
+  }
+
+  uint32_t bad = 0;
+  for (unsigned int e0 = 0; e0 < count; ++e0)
+    for (unsigned int e1 = 0; e1 < count; ++e1)
+    {
+      int32_t g0 = ends[e0], g1 = ends[e1];
+      int32_t lo = g0 < g1 ? g0 : g1, hi = g0 < g1 ? g1 : g0;
+      MixInput ramp, other;
+      mixSetRamp(ramp, g0, g1, n);
+      mixSetRamp(other, g1, g0, n);
+      ramp.src = testSrc[0];
+      other.src = testSrc[1];
+      const MixInput runs[3][2] = {{ramp, other}, {other, ramp}, {ramp, ramp}};
+      const unsigned int runInputs[3] = {2, 2, 1};
+      for (int r = 0; r < 3; ++r)
+      {
+        memset(testAcc[0], 0, n * sizeof(testAcc[0][0]));
+        mixAccumulate(testAcc[0], runs[r], runInputs[r], n);
+        bool ok = testAcc[0][0] == g0 && testAcc[0][n - 1] == g1;
+        for (unsigned int i = 0; i < n; ++i)
+          ok = ok && testAcc[0][i] >= lo && testAcc[0][i] <= hi;
+        if (!ok)
+          ++bad;
+      }
+    }
+  return bad;
+}
+
+uint32_t mixBenchCycles(unsigned int voices, unsigned int n, unsigned int reps, MixCycleCounter cycles)
+{
+  if (voices > MIX_TEST_VOICES)
+    voices = MIX_TEST_VOICES;
+  if (n > MIX_TEST_SAMPLES)
+    n = MIX_TEST_SAMPLES;
+  n &= ~1u;
+  if (reps == 0)
+    reps = 1;
+
+  MixInput in[MIX_TEST_VOICES] = {};
+  uint32_t seed = 1;
+  makeInputs(in, voices, n, seed);
+
+  uint32_t total = 0;
+  for (unsigned int r = 0; r < reps; ++r)
+  {
+    uint32_t t0 = cycles();
+    memset(testAcc[0], 0, n * sizeof(testAcc[0][0]));
+    mixAccumulate(testAcc[0], in, voices, n);
+    mixSaturate(testOut[0], testAcc[0], n);
+    total += cycles() - t0;
+  }
+  return total / reps;
+}
@@ -0,0 +1,65 @@
+/* mix_kernel.h
+   Voice summation kernel: N gain-ramped int16 inputs into one block
+
+   - inputs are processed in pairs; on Cortex-M7 each output sample of a
+     pair is one SMLAD (two 16x16 products + 32-bit accumulate), the two
+     gains advance together with one SADD16
+   - the gain advance wraps (SADD16, not the saturating QADD16): a ramp
+     only moves between its two ends, both in [0, MIX_GAIN_UNITY], so a
+     lane never overflows and the wrap is never taken; the C reference
+     does the same int16 add
+   - accumulation is 32-bit with MIX_GAIN_SHIFT (12) bits of gain, which
+     leaves 16x full scale of headroom: the whole voice pool at unity gain,
+     in phase, cannot wrap; the block saturates once at the end (SSAT)
+   - mixAccumulateRef()/mixSaturateRef() are the plain C reference; the
+     packed kernel is bit-exact with it and builds on any host (the DSP
+     instructions are emulated when __ARM_FEATURE_DSP is not available)
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#define MIX_GAIN_SHIFT 12
+#define MIX_GAIN_UNITY (1 << MIX_GAIN_SHIFT)
+
+struct MixInput
+{
+  const int16_t *src; // n samples, 4-byte aligned
+  int16_t gain;       // gain at sample 0, Q12
+  int16_t gainStep;   // added to the gain after every sample (linear ramp)
+  int16_t gainCarry;  // the first |gainCarry| steps are one more in its direction
+};
+
+// acc[i] += sum over inputs of src[i] * (gain + i * gainStep + min(i, |gainCarry|) * sign(gainCarry));
+// n must be even
+void mixAccumulate(int32_t *acc, const MixInput *in, unsigned int count, unsigned int n);
+void mixAccumulateRef(int32_t *acc, const MixInput *in, unsigned int count, unsigned int n);
+
+// out[i] = saturate16(acc[i] >> MIX_GAIN_SHIFT); n must be even
+void mixSaturate(int16_t *out, const int32_t *acc, unsigned int n);
+void mixSaturateRef(int16_t *out, const int32_t *acc, unsigned int n);
+
+// Ramp from g0 (Q12) at sample 0 to g1 at sample n - 1: the remainder of
+// the step is carried, so a fade to 0 ends on 0 and no gain passes g1
+static inline void mixSetRamp(MixInput &in, int32_t g0, int32_t g1, unsigned int n)
+{
+  int32_t d = g1 - g0;
+  int32_t steps = n > 1 ? (int32_t)n - 1 : 1;
+  in.gain = (int16_t)g0;
+  in.gainStep = (int16_t)(d / steps);
+  in.gainCarry = (int16_t)(d % steps);
+}
+
+// ------------------- verification -------------------
+typedef uint32_t (*MixCycleCounter)();
+
+// Random inputs through both kernels; returns the number of differing samples
+uint32_t mixSelfTest(unsigned int voices, unsigned int n, uint32_t seed);
+
+// Fades and ramps between the gain extremes through the packed kernel;
+// returns the number that do not end exactly on their target gain
+uint32_t mixRampTest(unsigned int n);
+
+// Average cycles of mixAccumulate + mixSaturate for one block
+uint32_t mixBenchCycles(unsigned int voices, unsigned int n, unsigned int reps, MixCycleCounter cycles);
@@ -0,0 +1,100 @@
+#include "pad_array.h"
+
+bool PadArray::begin(const PadLayout &config, const DetectorConfig &detect, float initialFlex, uint32_t clockHz)
+{
+  if (config.pads == 0 || config.pads > PAD_MAX || config.muxWays == 0 || config.flex >= config.frameValues ||
+      config.fsr >= config.frameValues)
+    return false;
+  for (unsigned int p = 0; p < config.pads; ++p)
+  {
+    const PadInput &in = config.input[p];
+    if (in.center >= config.frameValues || (in.rim != SENSOR_NO_SLOT && in.rim >= config.frameValues) ||
+        (in.phase != PAD_EVERY_FRAME && in.phase >= config.muxWays))
+      return false;
+  }
+  layout = config;
+  for (unsigned int p = 0; p < layout.pads; ++p)
+  {
+    detectors[p].begin(detect, initialFlex, clockHz);
+    detectors[p].setPad((uint8_t)p, p == 0 ? nullptr : &detectors[0]);
+  }
+  return true;
+}
+
+uint32_t PadArray::padRate(unsigned int pad, uint32_t frameRateHz) const
+{
+  return layout.input[pad].phase == PAD_EVERY_FRAME ? frameRateHz : frameRateHz / layout.muxWays;
+}
+
+void PadArray::setThresholds(uint16_t piezo, uint16_t fsr)
+{
+  for (unsigned int p = 0; p < layout.pads; ++p)
+    detectors[p].setThresholds(piezo, fsr);
+}
+
+void PadArray::setCrosstalk(HitZone struck, float amplitude)
+{
+  for (unsigned int p = 0; p < layout.pads; ++p)
+    detectors[p].setCrosstalk(struck, amplitude);
+}
+
+void PadArray::setPeakWindow(uint32_t us)
+{
+  for (unsigned int p = 0; p < layout.pads; ++p)
+    detectors[p].setPeakWindow(us);
+}
+
+void PadArray::setPredict(uint8_t samples)
+{
+  for (unsigned int p = 0; p < layout.pads; ++p)
+    detectors[p].setPredict(samples);
+}
+
+unsigned int PadArray::processBlock(const SensorBlock &block, HitEvent *hits, unsigned int maxHits)
+{
+  unsigned int found = 0;
+  for (unsigned int p = 0; p < layout.pads; ++p)
+  {
+    // this pad's samples of the block, in place
+    const PadInput &in = layout.input[p];
+    SensorBlock view;
+    view.frames = block.frames;
+    view.count = block.count;
+    view.time = block.time;
+    view.ticksPerFrame = block.ticksPerFrame;
+    view.stride = block.stride;
+    if (in.phase != PAD_EVERY_FRAME)
+    {
+      view.frames += in.phase * block.stride;
+      view.count /= layout.muxWays;
+      view.time += in.phase * block.ticksPerFrame;
+      view.ticksPerFrame *= layout.muxWays;
+      view.stride *= layout.muxWays;
+    }
+    view.slot[SENSOR_PIEZO_CENTER] = in.center;
+    view.slot[SENSOR_PIEZO_RIM] = in.rim;
+    view.slot[SENSOR_FLEX] = p == 0 ? layout.flex : SENSOR_NO_SLOT;
+    view.slot[SENSOR_FSR] = p == 0 ? layout.fsr : SENSOR_NO_SLOT;
+
+    unsigned int n = detectors[p].processBlock(view, hits + found, maxHits - found);
+    // merge into time order (a block holds a handful of hits at most)
+    for (unsigned int i = found; i < found + n; ++i)
+    {
+      HitEvent ev = hits[i];
+      unsigned int j = i;
+      for (; j > 0 && (int32_t)(hits[j - 1].time - ev.time) > 0; --j)
+        hits[j] = hits[j - 1];
+      hits[j] = ev;
+    }
+    found += n;
+  }
+  return found;
+}
+
+uint32_t PadArray::droppedHits() const
+{
+  uint32_t n = 0;
+  for (unsigned int p = 0; p < layout.pads; ++p)
+    n += detectors[p].droppedHits();
+  return n;
+}
@@ -0,0 +1,77 @@
+/* pad_array.h
+   Hit detection for up to PAD_MAX pads from one sensor scan
+   (hardware independent)
+
+   - every pad is a HitDetector of its own (noise floor, retrigger mask,
+     zone), with a center piezo and optionally a rim piezo; its hits carry
+     its index, which picks its sample set and choke groups
+   - one frame holds `frameValues` conversions. Piezos on their own ADC
+     pins are in every frame; piezos behind analog multiplexers are in one
+     frame of every `muxWays` (their phase), so a block of whole mux
+     cycles gives each pad count / muxWays samples
+   - a pad's samples are walked in place through a strided SensorBlock,
+     nothing is copied
+   - flex and FSR are filtered by pad 0 only (which needs the flex and FSR
+     slots); the other pads take pitch and damping from it
+   - hits come back in time order across pads
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "hit_detector.h"
+
+#define PAD_EVERY_FRAME 0xFF
+
+struct PadInput
+{
+  uint8_t center; // slot of the center piezo in a frame
+  uint8_t rim;    // slot of the rim piezo, SENSOR_NO_SLOT for a one-zone pad
+  uint8_t phase;  // frame of the mux cycle both are converted in, PAD_EVERY_FRAME off a mux
+};
+
+struct PadLayout
+{
+  uint8_t pads;
+  uint8_t frameValues; // conversions per frame
+  uint8_t muxWays;     // frames per mux cycle, 1 without multiplexers
+  uint8_t flex;        // slots of flex and FSR, converted every frame
+  uint8_t fsr;
+  PadInput input[PAD_MAX];
+};
+
+class PadArray
+{
+public:
+  // false for a layout that does not fit its frames
+  bool begin(const PadLayout &layout, const DetectorConfig &config, float initialFlex, uint32_t clockHz);
+
+  // Every pad's samples in `block` (frameValues per frame, a whole number
+  // of mux cycles); up to `maxHits` hits to `hits`, oldest first. Every
+  // pad runs even when `hits` is full; what does not fit is counted in
+  // droppedHits(). Returns the hit count.
+  unsigned int processBlock(const SensorBlock &block, HitEvent *hits, unsigned int maxHits);
+
+  // Hits of all pads that did not fit processBlock()'s buffer
+  uint32_t droppedHits() const;
+
+  unsigned int pads() const { return layout.pads; }
+  HitDetector &pad(unsigned int i) { return detectors[i]; }
+  const HitDetector &pad(unsigned int i) const { return detectors[i]; }
+  const PadLayout &padLayout() const { return layout; }
+
+  // Samples per second each piezo of `pad` gets at a frame rate
+  uint32_t padRate(unsigned int pad, uint32_t frameRateHz) const;
+
+  // Sensor profile for every pad
+  void setThresholds(uint16_t piezo, uint16_t fsr);
+  void setCrosstalk(HitZone struck, float amplitude);
+  // Peak window and early fire for every pad (HitDetector::setPeakWindow,
+  // setPredict); safe to call while blocks are processed
+  void setPeakWindow(uint32_t us);
+  void setPredict(uint8_t samples);
+
+private:
+  PadLayout layout;
+  HitDetector detectors[PAD_MAX];
+};
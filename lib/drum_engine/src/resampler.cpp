@@ -0,0 +1,179 @@
+#include "resampler.h"
+
+#include <math.h>
+
+#define PITCH_TABLE_STEPS 192 // per octave, 1/16 semitone
+
+static uint32_t pitchTable[PITCH_TABLE_STEPS + 1]; // 2^(i/192) in Q16
+static int16_t sincTable[SINC_PHASES][SINC_TAPS];  // Q14, each phase sums to 1.0
+static bool tablesReady = false;
+
+void resamplerInit()
+{
+  if (tablesReady)
+    return;
+
+  for (int i = 0; i <= PITCH_TABLE_STEPS; ++i)
+    pitchTable[i] = (uint32_t)lroundf(65536.0f * exp2f((float)i / PITCH_TABLE_STEPS));
+
+  // Blackman-windowed sinc, cutoff slightly below Nyquist. The kernel is
+  // fixed, so pitching up by more than that margin will alias a little.
+  const float cutoff = 0.9f;
+  const float half = SINC_TAPS / 2;
+  for (int p = 0; p < SINC_PHASES; ++p)
+  {
+    float x = (float)p / SINC_PHASES;
+    float h[SINC_TAPS];
+    float sum = 0.0f;
+    for (int k = 0; k < SINC_TAPS; ++k)
+    {
+      float t = (float)(k - (SINC_TAPS / 2 - 1)) - x;
+      float s = (t == 0.0f) ? 1.0f : sinf((float)M_PI * cutoff * t) / ((float)M_PI * cutoff * t);
+      float w = 0.42f + 0.5f * cosf((float)M_PI * t / half) + 0.08f * cosf(2.0f * (float)M_PI * t / half);
+      h[k] = s * w;
+      sum += h[k];
+    }
+    int32_t total = 0;
+    for (int k = 0; k < SINC_TAPS; ++k)
+    {
+      sincTable[p][k] = (int16_t)lroundf(h[k] / sum * 16384.0f);
+      total += sincTable[p][k];
+    }
+    // put the rounding error on the largest tap so DC gain is exact
+    int centre = (x < 0.5f) ? SINC_TAPS / 2 - 1 : SINC_TAPS / 2;
+    sincTable[p][centre] += (int16_t)(16384 - total);
+  }
+
+  tablesReady = true;
+}
+
+uint32_t pitchToStepQ16(int32_t semisQ8)
+{
+  const int32_t octave = 12 * 256;
+  int32_t oct = (semisQ8 >= 0) ? semisQ8 / octave : -((-semisQ8 + octave - 1) / octave);
+  if (oct > 4)
+    oct = 4;
+  if (oct < -8)
+    oct = -8;
+  int32_t rem = semisQ8 - oct * octave;
+  if (rem < 0)
+    rem = 0;
+  if (rem >= octave)
+    rem = octave - 1;
+
+  uint32_t idx = (uint32_t)rem >> 4;
+  uint32_t f = (uint32_t)rem & 15;
+  uint32_t a = pitchTable[idx];
+  uint32_t b = pitchTable[idx + 1];
+  uint32_t r = a + (((b - a) * f) >> 4);
+  return (oct >= 0) ? (r << oct) : (r >> -oct);
+}
+
+template <bool Checked>
+static inline int32_t tap(const int16_t *s, uint32_t len, int32_t i)
+{
+  if (Checked && (i < 0 || (uint32_t)i >= len))
+    return 0;
+  return s[i];
+}
+
+static inline int16_t sat16(int32_t x)
+{
+  if (x > 32767)
+    return 32767;
+  if (x < -32768)
+    return -32768;
+  return (int16_t)x;
+}
+
+template <InterpMode Mode, bool Checked>
+static unsigned int resampleBlock(ResampleState &st, int16_t *dst, unsigned int n)
+{
+  const int16_t *s = st.buf;
+  const uint32_t len = st.len;
+  const uint32_t step = st.step;
+  uint32_t pos = st.pos;
+  uint32_t frac = st.frac;
+
+  unsigned int i = 0;
+  for (; i < n && pos < len; ++i)
+  {
+    const int32_t p = (int32_t)pos;
+    int32_t y;
+    if (Mode == INTERP_LINEAR)
+    {
+      int32_t a = tap<Checked>(s, len, p);
+      int32_t b = tap<Checked>(s, len, p + 1);
+      y = a + (((b - a) * (int32_t)(frac >> 1)) >> 15);
+    }
+    else if (Mode == INTERP_HERMITE)
+    {
+      // Catmull-Rom, coefficients kept doubled to stay in integers
+      int32_t xm1 = tap<Checked>(s, len, p - 1);
+      int32_t x0 = tap<Checked>(s, len, p);
+      int32_t x1 = tap<Checked>(s, len, p + 1);
+      int32_t x2 = tap<Checked>(s, len, p + 2);
+      int32_t t = (int32_t)(frac >> 1); // Q15
+      int32_t c1 = x1 - xm1;
+      int32_t c2 = 2 * xm1 - 5 * x0 + 4 * x1 - x2;
+      int32_t c3 = (x2 - xm1) + 3 * (x0 - x1);
+      int32_t v = (int32_t)(((int64_t)c3 * t) >> 15) + c2;
+      v = (int32_t)(((int64_t)v * t) >> 15) + c1;
+      v = (int32_t)(((int64_t)v * t) >> 15);
+      y = sat16(x0 + (v >> 1));
+    }
+    else
+    {
+      const int16_t *h = sincTable[frac >> (16 - SINC_PHASE_BITS)];
+      int32_t a = 0;
+      for (int k = 0; k < SINC_TAPS; ++k)
+        a += tap<Checked>(s, len, p - (SINC_TAPS / 2 - 1) + k) * h[k];
+      y = sat16((a + (1 << 13)) >> 14);
+    }
+    dst[i] = (int16_t)y;
+
+    frac += step;
+    pos += frac >> 16;
+    frac &= 0xFFFF;
+  }
+
+  st.pos = pos;
+  st.frac = frac;
+  return i;
+}
+
+template <InterpMode Mode>
+static unsigned int resampleMode(ResampleState &st, int16_t *dst, unsigned int n)
+{
+  // bounds checks are only needed near either end of the sample
+  uint64_t last = st.pos + (((uint64_t)st.frac + (uint64_t)st.step * n) >> 16);
+  if (st.pos >= SINC_TAPS / 2 && last + SINC_TAPS / 2 < st.len)
+    return resampleBlock<Mode, false>(st, dst, n);
+  return resampleBlock<Mode, true>(st, dst, n);
+}
+
+unsigned int resample(ResampleState &st, int16_t *dst, unsigned int n, InterpMode mode)
+{
+  switch (mode)
+  {
+  case INTERP_LINEAR:
+    return resampleMode<INTERP_LINEAR>(st, dst, n);
+  case INTERP_SINC:
+    return resampleMode<INTERP_SINC>(st, dst, n);
+  default:
+    return resampleMode<INTERP_HERMITE>(st, dst, n);
+  }
+}
+
+const char *interpModeName(InterpMode mode)
+{
+  switch (mode)
+  {
+  case INTERP_LINEAR:
+    return "linear";
+  case INTERP_SINC:
+    return "sinc";
+  default:
+    return "hermite";
+  }
+}
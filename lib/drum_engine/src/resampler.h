@@ -0,0 +1,48 @@
+/* resampler.h
+   Fractional-rate sample playback for the voice engine
+
+   - one root sample is played at any pitch, the ratio comes from
+     pitchToStepQ16() (semitones in Q8 -> phase increment in Q16.16)
+   - fixed-point phase accumulator: integer sample index + 16-bit fraction
+   - three qualities: linear, 4-point Hermite (Catmull-Rom) and an
+     8-tap, 64-phase windowed-sinc polyphase filter
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+enum InterpMode : uint8_t
+{
+  INTERP_LINEAR = 0,
+  INTERP_HERMITE = 1,
+  INTERP_SINC = 2,
+  INTERP_MODES
+};
+
+#define RESAMPLE_UNITY (1UL << 16) // step for playback at the root pitch
+
+#define SINC_TAPS 8
+#define SINC_PHASE_BITS 6
+#define SINC_PHASES (1 << SINC_PHASE_BITS)
+
+struct ResampleState
+{
+  const int16_t *buf; // root sample in flash
+  uint32_t len;       // number of int16_t samples
+  uint32_t pos;       // integer read position
+  uint32_t frac;      // fractional read position, Q16
+  uint32_t step;      // phase increment per output sample, Q16.16
+};
+
+// Build the pitch and sinc tables. Call once before rendering.
+void resamplerInit();
+
+// Semitones above the root (Q8, may be negative) to a Q16.16 step.
+uint32_t pitchToStepQ16(int32_t semisQ8);
+
+// Produce up to n output samples into dst. Returns the number written;
+// fewer than n means the sample has ended.
+unsigned int resample(ResampleState &st, int16_t *dst, unsigned int n, InterpMode mode);
+
+const char *interpModeName(InterpMode mode);
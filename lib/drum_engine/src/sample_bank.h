@@ -0,0 +1,25 @@
+/* sample_bank.h
+   Descriptor type for the generated sample bank (drum_bank.h)
+
+   gen.py writes drum_bank.h as one flat constexpr array of these, plus the
+   bank dimensions, so selecting a sample is a single indexed load and the
+   layout never has to be edited by hand.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+enum DrumSampleFlags : uint8_t
+{
+  DRUM_SAMPLE_LOOP = 1 << 0 // reserved: sample may be looped by the engine
+};
+
+struct DrumSampleDesc
+{
+  const int16_t *ptr; // int16_t data in flash
+  uint32_t len;       // number of samples
+  int16_t rootPitch;  // semitones of the recording above the instrument root, Q8
+  uint16_t gain;      // Q15 level trim
+  uint8_t flags;      // DrumSampleFlags
+};
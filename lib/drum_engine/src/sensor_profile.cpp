@@ -0,0 +1,97 @@
+#include "sensor_profile.h"
+
+#include <string.h>
+
+#define CAL_NOISE_MARGIN 2       // piezo threshold: at least this many times the quiet pad's loudest reading
+#define CAL_THRESHOLD_DIVISOR 32 // ...and at least this fraction of the hardest strike
+#define CAL_MIN_STRIKE_RATIO 4   // the hardest strike must reach this many thresholds
+#define CAL_MIN_SPAN 200         // a flex or FSR that moved less than this did not move
+#define CAL_FLEX_INSET 32        // flex ends 1/32 of the span in, so both are reachable
+
+static const char *const stepPrompts[CAL_STEPS] = {
+    "leave the pad alone",
+    "strike as hard as you will play, center and rim, a few times",
+    "bend the flex from one end to the other and back",
+    "press and release the FSR a few times",
+};
+
+const char *calibrationStepPrompt(CalibrationStep step)
+{
+  return step < CAL_STEPS ? stepPrompts[step] : "";
+}
+
+static uint16_t piezoMax(const SensorRanges &r)
+{
+  uint16_t c = r.max[SENSOR_PIEZO_CENTER], m = r.max[SENSOR_PIEZO_RIM];
+  return c > m ? c : m;
+}
+
+bool learnSensorProfile(const SensorRanges steps[CAL_STEPS], SensorProfile *profile)
+{
+  SensorProfile p = *profile;
+
+  uint32_t noise = piezoMax(steps[CAL_STEP_QUIET]);
+  uint32_t strike = piezoMax(steps[CAL_STEP_STRIKES]);
+  uint32_t threshold = noise * CAL_NOISE_MARGIN;
+  if (threshold < strike / CAL_THRESHOLD_DIVISOR)
+    threshold = strike / CAL_THRESHOLD_DIVISOR;
+  if (threshold == 0 || strike < threshold * CAL_MIN_STRIKE_RATIO)
+    return false;
+  p.curves.piezoThreshold = (uint16_t)threshold;
+  p.curves.piezoMax = (uint16_t)(strike < ADC_MAX ? strike : ADC_MAX);
+
+  const SensorRanges &flex = steps[CAL_STEP_FLEX];
+  if (flex.max[SENSOR_FLEX] < flex.min[SENSOR_FLEX] + CAL_MIN_SPAN)
+    return false;
+  uint16_t inset = (uint16_t)((flex.max[SENSOR_FLEX] - flex.min[SENSOR_FLEX]) / CAL_FLEX_INSET);
+  p.curves.flexMin = flex.min[SENSOR_FLEX] + inset;
+  p.curves.flexMax = flex.max[SENSOR_FLEX] - inset;
+
+  const SensorRanges &fsr = steps[CAL_STEP_FSR];
+  if (fsr.max[SENSOR_FSR] < fsr.min[SENSOR_FSR] + CAL_MIN_SPAN)
+    return false;
+  p.fsrThreshold = (uint16_t)((fsr.min[SENSOR_FSR] + fsr.max[SENSOR_FSR]) / 2);
+
+  if (!sensorCurvesValid(p.curves))
+    return false;
+  *profile = p;
+  return true;
+}
+
+uint32_t crc32(const void *data, size_t len)
+{
+  const uint8_t *b = (const uint8_t *)data;
+  uint32_t crc = 0xFFFFFFFFu;
+  while (len--)
+  {
+    crc ^= *b++;
+    for (int k = 0; k < 8; ++k)
+      crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+void packSensorProfile(const SensorProfile &profile, StoredSensorProfile *stored)
+{
+  memset(stored, 0, sizeof(*stored));
+  stored->magic = SENSOR_PROFILE_MAGIC;
+  stored->version = SENSOR_PROFILE_VERSION;
+  stored->size = sizeof(SensorProfile);
+  stored->profile = profile;
+  stored->crc = crc32(stored, offsetof(StoredSensorProfile, crc));
+}
+
+bool unpackSensorProfile(const StoredSensorProfile &stored, SensorProfile *profile)
+{
+  if (stored.magic != SENSOR_PROFILE_MAGIC || stored.version != SENSOR_PROFILE_VERSION ||
+      stored.size != sizeof(SensorProfile) || stored.crc != crc32(&stored, offsetof(StoredSensorProfile, crc)))
+    return false;
+  const SensorProfile &p = stored.profile;
+  if (!sensorCurvesValid(p.curves) || p.fsrThreshold > ADC_MAX)
+    return false;
+  for (int z = 0; z < 2; ++z)
+    if (!(p.crosstalk[z] >= 0.0f && p.crosstalk[z] < 1.0f))
+      return false;
+  *profile = p;
+  return true;
+}
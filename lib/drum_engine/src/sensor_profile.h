@@ -0,0 +1,66 @@
+/* sensor_profile.h
+   Per-pad sensor tuning, learned and stored (hardware independent)
+
+   - a SensorProfile is everything a pad's sensors are tuned by: the flex
+     range and feel curve, the piezo threshold and hardest strike, the FSR
+     threshold and the crosstalk matrix
+   - learnSensorProfile() turns the ranges a guided session captured
+     (quiet pad, hardest strikes, flex bent end to end, FSR pressed and
+     released; one HitDetector range capture per CalibrationStep) into a
+     profile, so retuning for a new pad or sensor needs no reflash
+   - packSensorProfile() wraps a profile with a magic, a version and a
+     CRC-32 for storage (EEPROM on the Teensy); unpackSensorProfile()
+     refuses a blank, stale, corrupt or implausible copy, and the caller
+     keeps its defaults
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "drum_mapping.h"
+#include "hit_detector.h"
+
+#define SENSOR_PROFILE_MAGIC 0x44525053u // "SPRD"
+#define SENSOR_PROFILE_VERSION 1
+
+struct SensorProfile
+{
+  SensorCurveConfig curves; // flex range and exponent, piezo threshold and max
+  uint16_t fsrThreshold;
+  float crosstalk[2]; // DetectorConfig::crosstalk
+};
+
+// The stored form; the CRC covers everything before it
+struct StoredSensorProfile
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size; // sizeof(SensorProfile)
+  SensorProfile profile;
+  uint32_t crc;
+};
+
+enum CalibrationStep : uint8_t
+{
+  CAL_STEP_QUIET,   // pad untouched: the piezos' noise
+  CAL_STEP_STRIKES, // a few of the hardest strikes that will be played
+  CAL_STEP_FLEX,    // flex bent over its whole range
+  CAL_STEP_FSR,     // FSR pressed and released a few times
+  CAL_STEPS
+};
+
+// What the player does during a step
+const char *calibrationStepPrompt(CalibrationStep step);
+
+// Profile from the ranges captured over each step. `profile` keeps its
+// flex exponent and crosstalk. False, with `profile` unchanged, when a
+// step did not show what it asks for (strikes no louder than the noise,
+// a flex or FSR that did not move).
+bool learnSensorProfile(const SensorRanges steps[CAL_STEPS], SensorProfile *profile);
+
+// CRC-32 (IEEE 802.3, reflected)
+uint32_t crc32(const void *data, size_t len);
+
+void packSensorProfile(const SensorProfile &profile, StoredSensorProfile *stored);
+bool unpackSensorProfile(const StoredSensorProfile &stored, SensorProfile *profile);
@@ -0,0 +1,63 @@
+/* spsc_ring.h
+   Wait-free single-producer / single-consumer ring buffer
+
+   - push() only from the producer context (e.g. an ISR)
+   - pop() only from the consumer context (e.g. the audio update)
+   - N must be a power of two; indices run free and wrap naturally
+   - overflow and high-water counters are kept by the producer so the
+     ring can be sized from field data
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+template <typename T, uint32_t N>
+class SpscRing
+{
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+public:
+  // producer side: returns false (and counts an overflow) when full
+  bool push(const T &item)
+  {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t used = h - tail.load(std::memory_order_acquire);
+    if (used >= N)
+    {
+      overflowCount.store(overflowCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      return false;
+    }
+    items[h & (N - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    if (used + 1 > highWaterMark.load(std::memory_order_relaxed))
+      highWaterMark.store(used + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // consumer side: returns false when empty
+  bool pop(T &item)
+  {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire))
+      return false;
+    item = items[t & (N - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  uint32_t size() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+  static constexpr uint32_t capacity() { return N; }
+
+  // counters, safe to read from any context
+  uint32_t overflows() const { return overflowCount.load(std::memory_order_relaxed); }
+  uint32_t highWater() const { return highWaterMark.load(std::memory_order_relaxed); }
+
+private:
+  T items[N];
+  std::atomic<uint32_t> head{0}; // written by the producer only
+  std::atomic<uint32_t> tail{0}; // written by the consumer only
+  std::atomic<uint32_t> overflowCount{0};
+  std::atomic<uint32_t> highWaterMark{0};
+};
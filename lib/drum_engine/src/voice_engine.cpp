@@ -0,0 +1,483 @@
+#include "voice_engine.h"
+
+#include <math.h>
+#include <string.h>
+
+// a voice's layer gains sum to at most unity (velocity crossfade), so the
+// whole pool in phase at full scale must fit the mix accumulator
+static_assert((int64_t)(DRUM_MAX_VOICES + DRUM_FADE_VOICES) * 32768 * MIX_GAIN_UNITY <= 2147483648LL,
+              "voice pool can wrap the mix accumulator: lower MIX_GAIN_SHIFT");
+
+static void onsetRecord(OnsetHistogram &h, uint32_t latQ4, uint32_t binWidthQ4)
+{
+  if (h.count == 0 || latQ4 < h.minQ4)
+    h.minQ4 = latQ4;
+  if (h.count == 0 || latQ4 > h.maxQ4)
+    h.maxQ4 = latQ4;
+  ++h.count;
+  h.sumQ4 += latQ4;
+  h.sumSqQ4 += (uint64_t)latQ4 * latQ4;
+  uint32_t bin = binWidthQ4 ? latQ4 / binWidthQ4 : 0;
+  if (bin >= ONSET_HIST_BINS)
+    bin = ONSET_HIST_BINS - 1;
+  ++h.bins[bin];
+}
+
+void VoiceEngine::begin(HitSampleLookup lookupFn, uint32_t sampleRate, uint32_t tickHz)
+{
+  resamplerInit();
+  lookup = lookupFn;
+  livePitch = nullptr;
+  samplesPerTickQ32 = tickHz ? ((uint64_t)sampleRate << 32) / tickHz : 0;
+  lastBlockTime = 0;
+  detectionDelay = 0;
+  haveBlockTime = false;
+  measureOnsets = false;
+  interp = INTERP_HERMITE;
+  damped.store(false, std::memory_order_relaxed);
+  this->sampleRate = sampleRate;
+  releaseBlock = 0;
+  setReleaseTime(20.0f);
+  glideBlock = 0;
+  setGlideTime(15.0f);
+  memset(&onset, 0, sizeof(onset));
+  trace = nullptr;
+  traceClock = nullptr;
+  tracedCount = 0;
+  memset(voices, 0, sizeof(voices));
+  for (int i = 0; i < DRUM_MAX_VOICES; ++i)
+    freeList[i] = (uint8_t)(DRUM_MAX_VOICES - 1 - i);
+  freeCount = DRUM_MAX_VOICES;
+  triggerCount = 0;
+  lastTriggered = -1;
+  for (int p = 0; p < PAD_MAX; ++p)
+  {
+    estimateVoice[p] = -1;
+    estimateAge[p] = 0;
+  }
+  stealPolicy = STEAL_OLDEST;
+  stealFadeSamples = msToSamples(3.0f);
+  chokeFadeSamples = msToSamples(10.0f);
+  stealCount.store(0, std::memory_order_relaxed);
+  chokeCount.store(0, std::memory_order_relaxed);
+}
+
+void VoiceEngine::setOnsetStats(bool enable)
+{
+  memset(&onset, 0, sizeof(onset));
+  measureOnsets = enable;
+}
+
+void VoiceEngine::setLatencyTrace(LatencyTrace *t, TraceClock clock)
+{
+  trace = clock ? t : nullptr;
+  traceClock = clock;
+  tracedCount = 0;
+  for (int i = 0; i < DRUM_MAX_VOICES + DRUM_FADE_VOICES; ++i)
+    voices[i].traced = false;
+}
+
+void VoiceEngine::setReleaseTime(float tauMs)
+{
+  releaseTauMs = tauMs > 0.1f ? tauMs : 0.1f;
+  releaseBlock = 0; // recomputed for the next block size
+}
+
+void VoiceEngine::setGlideTime(float tauMs)
+{
+  glideTauMs = tauMs > 0.0f ? tauMs : 0.0f;
+  glideBlock = 0; // recomputed for the next block size
+}
+
+uint32_t VoiceEngine::msToSamples(float ms) const
+{
+  uint32_t samples = (uint32_t)(ms * 0.001f * sampleRate + 0.5f);
+  return samples ? samples : 1;
+}
+
+// Bounded scans over the fixed pool: cost does not depend on sample
+// length or on how many hits came before.
+int VoiceEngine::oldestVoice(int note) const
+{
+  int best = -1;
+  for (int i = 0; i < DRUM_MAX_VOICES; ++i)
+  {
+    const DrumVoice &v = voices[i];
+    if (!v.active || (note >= 0 && v.note != note))
+      continue;
+    if (best < 0 || (int32_t)(v.age - voices[best].age) < 0)
+      best = i;
+  }
+  return best;
+}
+
+int VoiceEngine::quietestVoice() const
+{
+  int best = -1;
+  uint32_t bestLevel = 0;
+  for (int i = 0; i < DRUM_MAX_VOICES; ++i)
+  {
+    const DrumVoice &v = voices[i];
+    if (!v.active)
+      continue;
+    uint32_t g = v.gain[0];
+    if (v.layers > 1 && v.gain[1] > g)
+      g = v.gain[1];
+    uint32_t level = g * v.env;
+    if (best < 0 || level < bestLevel)
+    {
+      best = i;
+      bestLevel = level;
+    }
+  }
+  return best;
+}
+
+void VoiceEngine::startFade(DrumVoice &v, uint32_t samples)
+{
+  if (v.fading && v.fadeLeft <= samples)
+    return;
+  v.fading = true;
+  v.fadeLeft = samples;
+}
+
+// Move a stolen voice out of the pool so it can fade while its slot is reused
+void VoiceEngine::moveToFadePool(int index)
+{
+  DrumVoice *dst = nullptr;
+  for (int i = DRUM_MAX_VOICES; i < DRUM_MAX_VOICES + DRUM_FADE_VOICES; ++i)
+  {
+    DrumVoice *f = &voices[i];
+    if (!f->active)
+    {
+      dst = f;
+      break;
+    }
+    // all busy: cut the fade that is closest to done
+    if (dst == nullptr || f->fadeLeft < dst->fadeLeft)
+      dst = f;
+  }
+  if (dst == nullptr)
+    return;
+  *dst = voices[index];
+  startFade(*dst, stealFadeSamples);
+}
+
+int VoiceEngine::allocVoice(uint8_t note)
+{
+  if (freeCount > 0)
+    return freeList[--freeCount];
+
+  int victim = -1;
+  if (stealPolicy == STEAL_QUIETEST)
+    victim = quietestVoice();
+  else if (stealPolicy == STEAL_SAME_NOTE)
+    victim = oldestVoice(note);
+  if (victim < 0)
+    victim = oldestVoice(-1);
+  if (victim < 0)
+    return -1;
+
+  if (DRUM_FADE_VOICES > 0)
+    moveToFadePool(victim);
+  stealCount.store(stealCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  return victim;
+}
+
+void VoiceEngine::trigger(const HitSample &sample, uint32_t step, uint32_t delay, bool released)
+{
+  lastTriggered = -1;
+  if (sample.layers == 0 || sample.layers > VOICE_LAYERS)
+    return;
+
+  // choke: other notes of the same group fade out quickly
+  if (sample.chokeGroup != 0)
+  {
+    for (int i = 0; i < DRUM_MAX_VOICES; ++i)
+    {
+      DrumVoice &v = voices[i];
+      if (v.active && v.chokeGroup == sample.chokeGroup && v.note != sample.note)
+      {
+        startFade(v, chokeFadeSamples);
+        chokeCount.store(chokeCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  int index = allocVoice(sample.note);
+  if (index < 0)
+    return;
+  DrumVoice *slot = &voices[index];
+
+  slot->pitch = 0;
+  slot->rootPitch = sample.rootPitch;
+  for (int l = 0; l < sample.layers; ++l)
+  {
+    slot->src[l].buf = sample.buf[l];
+    slot->src[l].len = sample.buf[l] ? sample.len[l] : 0;
+    slot->src[l].pos = 0;
+    slot->src[l].frac = 0;
+    slot->src[l].step = step;
+    slot->gain[l] = sample.gain[l];
+    slot->target[l] = sample.gain[l];
+  }
+  slot->layers = sample.layers;
+  slot->env = GAIN_UNITY;
+  slot->releasing = released;
+  slot->fading = false;
+  slot->fadeLeft = 0;
+  slot->note = sample.note;
+  slot->chokeGroup = sample.chokeGroup;
+  slot->age = triggerCount++;
+  slot->delay = delay;
+  slot->traced = false;
+  slot->fresh = true;
+  slot->active = true;
+  lastTriggered = index;
+}
+
+// The measured velocity of the last estimated hit on the same pad: rescale
+// its voice. The same layers take the lookup's gains as they are; if the
+// estimate picked other layers, the voice keeps them and its total gain is
+// scaled instead.
+void VoiceEngine::correctGain(const HitEvent &ev)
+{
+  if (ev.pad >= PAD_MAX)
+    return;
+  int index = estimateVoice[ev.pad];
+  estimateVoice[ev.pad] = -1;
+  if (index < 0)
+    return;
+  DrumVoice &v = voices[index];
+  if (!v.active || v.fading || v.age != estimateAge[ev.pad])
+    return; // stolen or choked meanwhile
+
+  HitSample fix;
+  fix.rootPitch = 0;
+  fix.note = 0;
+  fix.chokeGroup = 0;
+  if (lookup == nullptr || !lookup(ev, &fix) || fix.layers == 0 || fix.layers > VOICE_LAYERS)
+    return;
+  bool same = fix.layers == v.layers;
+  uint32_t oldSum = 0, newSum = 0;
+  for (int l = 0; l < fix.layers; ++l)
+    newSum += fix.gain[l];
+  for (int l = 0; l < v.layers; ++l)
+  {
+    oldSum += v.target[l];
+    same = same && fix.buf[l] == v.src[l].buf;
+  }
+  for (int l = 0; l < v.layers; ++l)
+  {
+    uint32_t g = same ? fix.gain[l] : oldSum ? (uint32_t)(((uint64_t)v.target[l] * newSum) / oldSum) : 0;
+    v.target[l] = (uint16_t)(g > GAIN_UNITY ? GAIN_UNITY : g);
+    if (v.fresh)
+      v.gain[l] = v.target[l];
+  }
+}
+
+void VoiceEngine::mixPending(unsigned int n)
+{
+  mixAccumulate(acc, pending, pendingCount, n);
+  pendingCount = 0;
+}
+
+unsigned int VoiceEngine::render(int16_t *out, unsigned int n, uint32_t now)
+{
+  if (n > DRUM_BLOCK_SAMPLES)
+    n = DRUM_BLOCK_SAMPLES;
+  n &= ~1u; // the mix kernel works on sample pairs
+
+  // the block the last render() mixed is being played out now
+  LatencyTrace *tr = trace;
+  if (tr)
+  {
+    for (unsigned int i = 0; i < tracedCount; ++i)
+      traceRecord(tr->stage[TRACE_I2S], now - tracedTime[i]);
+    tracedCount = 0;
+  }
+
+  // A hit starts one block after its timestamp + the detection delay, at
+  // the same offset (in this block, or a later one when it was detected
+  // sooner than the delay): latency is exactly the detection delay + one
+  // block for every hit.
+  unsigned int started = 0;
+  HitEvent ev;
+  while (hits.pop(ev))
+  {
+    uint32_t dequeued = tr ? traceClock() : 0;
+    if (ev.flags & HIT_FLAG_CORRECTION)
+    {
+      correctGain(ev);
+      continue;
+    }
+
+    uint32_t offset = 0;
+    uint32_t at = ev.time + detectionDelay;
+    if (haveBlockTime && (int32_t)(at - lastBlockTime) > 0)
+    {
+      // a hit detected faster than the delay waits into a later block
+      uint64_t s = ((uint64_t)(at - lastBlockTime) * samplesPerTickQ32) >> 32;
+      uint64_t latest = n - 1 + (((uint64_t)detectionDelay * samplesPerTickQ32) >> 32);
+      offset = (uint32_t)(s < latest ? s : latest);
+    }
+
+    if (measureOnsets)
+    {
+      uint32_t latQ4 = 0;
+      if ((int32_t)(now - ev.time) > 0)
+        latQ4 = (uint32_t)(((uint64_t)(now - ev.time) * samplesPerTickQ32) >> 28);
+      // both latencies stay within the detection delay + two blocks
+      uint64_t rangeQ4 = ((((uint64_t)detectionDelay * samplesPerTickQ32) >> 32) + 2 * n) * 16;
+      onset.binWidthQ4 = (uint32_t)((rangeQ4 + ONSET_HIST_BINS - 1) / ONSET_HIST_BINS);
+      onsetRecord(onset.blockStart, latQ4, onset.binWidthQ4);
+      onsetRecord(onset.sampleAccurate, latQ4 + offset * 16, onset.binWidthQ4);
+    }
+
+    if (ev.pad < PAD_MAX)
+      estimateVoice[ev.pad] = -1; // a correction only ever follows its pad's last hit
+    HitSample sample;
+    sample.rootPitch = 0;
+    sample.note = 0;
+    sample.chokeGroup = 0;
+    if (lookup == nullptr || !lookup(ev, &sample))
+      continue;
+    if (tr)
+    {
+      traceRecord(tr->stage[TRACE_DEQUEUE], dequeued - ev.time);
+      traceRecord(tr->stage[TRACE_LOOKUP], traceClock() - ev.time);
+    }
+    trigger(sample, pitchToStepQ16(ev.pitch - sample.rootPitch), offset, ev.release == HIT_RELEASE_SHORT);
+    if (lastTriggered >= 0)
+    {
+      voices[lastTriggered].pitch = ev.pitch;
+      // RENDERED / I2S follow the block the voice first sounds in
+      voices[lastTriggered].traced = tr != nullptr;
+      voices[lastTriggered].tracedAt = ev.time;
+    }
+    if ((ev.flags & HIT_FLAG_ESTIMATE) && ev.pad < PAD_MAX)
+    {
+      estimateVoice[ev.pad] = lastTriggered;
+      estimateAge[ev.pad] = lastTriggered >= 0 ? voices[lastTriggered].age : 0;
+    }
+    ++started;
+  }
+  lastBlockTime = now;
+  haveBlockTime = true;
+
+  if (releaseBlock != n)
+  {
+    float decay = expf(-(float)n / ((float)sampleRate * releaseTauMs * 0.001f));
+    releaseDecay = (uint16_t)(decay * GAIN_UNITY);
+    releaseBlock = n;
+  }
+  bool damp = damped.load(std::memory_order_relaxed);
+
+  // live pitch: read once, every voice moves glideCoef of the way there
+  LivePitchSource source = livePitch;
+  int32_t live = source ? source() : 0;
+  if (source && glideBlock != n)
+  {
+    float k = glideTauMs > 0.0f ? 1.0f - expf(-(float)n / ((float)sampleRate * glideTauMs * 0.001f)) : 1.0f;
+    glideCoef = (uint16_t)(k * 32768.0f + 0.5f);
+    glideBlock = n;
+  }
+
+  memset(acc, 0, n * sizeof(acc[0]));
+  pendingCount = 0;
+
+  for (int i = 0; i < DRUM_MAX_VOICES + DRUM_FADE_VOICES; ++i)
+  {
+    DrumVoice *v = &voices[i];
+    if (!v->active)
+      continue;
+
+    unsigned int first = v->delay < n ? v->delay : n;
+    v->delay -= first;
+    unsigned int count = n - first;
+    if (count == 0)
+      continue;
+    v->fresh = false;
+    if (v->traced)
+    {
+      v->traced = false;
+      // stamped as of its first sample: the block's stamps plus its offset
+      if (tr)
+        tracedTime[tracedCount++] = v->tracedAt - (uint32_t)(((uint64_t)first << 32) / samplesPerTickQ32);
+    }
+
+    if (source && v->pitch != live)
+    {
+      int32_t d = live - v->pitch;
+      int32_t move = (d * glideCoef) >> 15;
+      if (move == 0)
+        move = d > 0 ? 1 : -1; // settle on the target, not 1/256 semitone short
+      v->pitch = (int16_t)(v->pitch + move);
+      uint32_t step = pitchToStepQ16(v->pitch - v->rootPitch);
+      for (int l = 0; l < v->layers; ++l)
+        v->src[l].step = step;
+    }
+
+    // envelope steps once per block, the gain ramps linearly across it
+    if (damp)
+      v->releasing = true;
+    int32_t envStart = v->env;
+    if (v->releasing)
+      v->env = (uint16_t)((v->env * (uint32_t)releaseDecay) >> 15);
+    if (v->fading)
+    {
+      uint32_t left = v->fadeLeft > count ? v->fadeLeft - count : 0;
+      v->env = (uint16_t)(((uint64_t)v->env * left) / v->fadeLeft);
+      v->fadeLeft = left;
+    }
+    int32_t envEnd = v->env;
+
+    // The layer is rendered at its place in a full block (silence around
+    // it) so every kernel input covers [0, n) and pairs line up.
+    bool playing = false;
+    for (int l = 0; l < v->layers; ++l)
+    {
+      int16_t *buf = scratch[pendingCount];
+      memset(buf, 0, first * sizeof(buf[0]));
+      unsigned int produced = resample(v->src[l], buf + first, count, interp);
+      memset(buf + first + produced, 0, (count - produced) * sizeof(buf[0]));
+      int32_t g0 = (v->gain[l] * envStart) >> (30 - MIX_GAIN_SHIFT);
+      int32_t g1 = (v->target[l] * envEnd) >> (30 - MIX_GAIN_SHIFT);
+      v->gain[l] = v->target[l];
+      MixInput &in = pending[pendingCount++];
+      in.src = buf;
+      mixSetRamp(in, g0, g1, n);
+      if (pendingCount == 2)
+        mixPending(n);
+      if (produced == count)
+        playing = true;
+    }
+
+    if (!playing || (v->releasing && v->env < ENV_SILENCE) || (v->fading && v->fadeLeft == 0))
+    {
+      v->active = false;
+      if (i < DRUM_MAX_VOICES)
+        freeList[freeCount++] = (uint8_t)i;
+    }
+  }
+
+  mixPending(n);
+  // saturate once, after all voices are summed
+  mixSaturate(out, acc, n);
+  if (tr && tracedCount)
+  {
+    uint32_t t = traceClock();
+    for (unsigned int i = 0; i < tracedCount; ++i)
+      traceRecord(tr->stage[TRACE_RENDERED], t - tracedTime[i]);
+  }
+  return started;
+}
+
+unsigned int VoiceEngine::activeVoices() const
+{
+  unsigned int count = 0;
+  for (int i = 0; i < DRUM_MAX_VOICES; ++i)
+    if (voices[i].active)
+      ++count;
+  return count;
+}
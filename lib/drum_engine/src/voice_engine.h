@@ -0,0 +1,264 @@
+/* voice_engine.h
+   Polyphonic sample voice engine (hardware independent)
+
+   - Fixed pool of DRUM_MAX_VOICES voices, no allocation after begin()
+   - Each voice reads its int16_t sample straight from flash (PROGMEM),
+     nothing is copied when a hit starts, so trigger() is O(1) in sample length
+   - Pitch is applied at playback time by resampling one root sample;
+     with a live pitch source set, ringing voices glide after it block by
+     block (one table lookup per voice per block, no per-sample maths)
+   - Loudness is a per-voice Q15 gain; a voice can crossfade two velocity
+     layers (one multiply-accumulate per sample per layer)
+   - Damping is an exponential release envelope, stepped once per block and
+     ramped linearly across it so it never clicks
+   - When the pool is full a voice is stolen (oldest / quietest /
+     same-note) and handed to a small fade pool so it ramps out over a few
+     ms instead of being cut; choke groups fade each other out the same way
+   - render() first drains the hit queue, then sums every active voice
+     into one output block through the packed mix kernel (mix_kernel.h),
+     two layers per pass, saturating once at the end
+   - hits carry a capture timestamp; each one starts at the sample offset
+     its timestamp plus the detection delay fell at during the previous
+     block, so hit-to-sound latency is a constant detection delay + one
+     block instead of 0..1 block of jitter. The detection delay must cover
+     the time from the timestamp to postHit(): without it, whenever that
+     exceeds the block (always at 16 and 32 samples) the offset is 0 and
+     onsets are quantized to the block again
+   - a hit fired on an estimated velocity (HIT_FLAG_ESTIMATE) is followed
+     by a HIT_FLAG_CORRECTION event from the same pad; its voice's gain is
+     set to the corrected value if it has not sounded yet, else ramped
+     there across the next block (each pad keeps its own estimate)
+   - with a LatencyTrace set, every started hit is stamped at dequeue,
+     bank lookup, end of the first block its voice sounds in (which can be
+     a later render() than the dequeue, see setDetectionDelay()) and the
+     hand-off of that block (the render() after it), see latency_trace.h
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "hit_event.h"
+#include "latency_trace.h"
+#include "mix_kernel.h"
+#include "resampler.h"
+#include "spsc_ring.h"
+
+#ifndef DRUM_MAX_VOICES
+#define DRUM_MAX_VOICES 12 // 8..16 is a sensible range for rolls/flams
+#endif
+
+#ifndef DRUM_FADE_VOICES
+#define DRUM_FADE_VOICES 4 // stolen voices fading out alongside the pool
+#endif
+
+#ifndef HIT_QUEUE_SIZE
+#define HIT_QUEUE_SIZE 32 // power of two, see hitQueue().highWater()
+#endif
+
+#ifndef DRUM_BLOCK_SAMPLES
+#define DRUM_BLOCK_SAMPLES 128 // largest block render() is asked for
+#endif
+
+#define ONSET_HIST_BINS 16 // histogram over 0..detection delay + 2 blocks of latency
+
+#define VOICE_LAYERS 2   // velocity layers crossfaded by one voice
+#define GAIN_UNITY 32767 // Q15 gain of 1.0
+#define ENV_SILENCE 16   // Q15 envelope level (~-66 dB) where a released voice stops
+
+// What one hit plays: up to VOICE_LAYERS samples, each with its own gain
+struct HitSample
+{
+  const int16_t *buf[VOICE_LAYERS];
+  uint32_t len[VOICE_LAYERS];
+  uint16_t gain[VOICE_LAYERS]; // Q15
+  int16_t rootPitch;           // semitones of the samples above the root, Q8
+  uint8_t layers;              // 1..VOICE_LAYERS
+  uint8_t note;                // identity for same-note stealing / choking
+  uint8_t chokeGroup;          // 0 = none, else fades other notes of the group
+};
+
+enum StealPolicy : uint8_t
+{
+  STEAL_OLDEST = 0,    // voice started longest ago
+  STEAL_QUIETEST = 1,  // lowest current envelope x gain
+  STEAL_SAME_NOTE = 2, // oldest voice of the same note, else oldest
+  STEAL_POLICIES
+};
+
+struct DrumVoice
+{
+  ResampleState src[VOICE_LAYERS]; // samples in flash (never copied) + read phase
+  int16_t pitch;                   // semitones above the root now playing, Q8
+  int16_t rootPitch;               // of the samples, Q8
+  uint16_t gain[VOICE_LAYERS];     // Q15
+  uint16_t target[VOICE_LAYERS];   // Q15, gain ramps here across the next block
+  uint8_t layers;
+  uint16_t env;                    // Q15 release envelope level
+  bool releasing;                  // envelope is decaying
+  bool fading;                     // linear fade-out (steal / choke) running
+  uint32_t fadeLeft;               // samples until the fade reaches zero
+  uint8_t note;
+  uint8_t chokeGroup;
+  uint32_t age;      // trigger sequence number, used to find the oldest voice
+  uint32_t delay;    // samples to wait in the current block before starting
+  uint32_t tracedAt; // crossing of its hit, while traced
+  bool traced;       // latency trace: RENDERED not stamped yet
+  bool fresh;        // nothing rendered yet
+  bool active;
+};
+
+// Hit-to-block latency in 1/16 sample units (Q4)
+struct OnsetHistogram
+{
+  uint32_t count;
+  uint32_t minQ4;
+  uint32_t maxQ4;
+  uint64_t sumQ4;
+  uint64_t sumSqQ4;
+  uint32_t bins[ONSET_HIST_BINS];
+};
+
+// Measurement mode: the same hits scored with block-quantized onsets
+// (what a plain "start at the next block" engine does) and with the
+// sample-accurate onsets render() actually uses.
+struct OnsetStats
+{
+  OnsetHistogram blockStart;
+  OnsetHistogram sampleAccurate;
+  uint32_t binWidthQ4;
+};
+
+typedef SpscRing<HitEvent, HIT_QUEUE_SIZE> HitQueue;
+
+// Resolve a hit to the sample(s) and gain(s) it should play. Called from render().
+typedef bool (*HitSampleLookup)(const HitEvent &ev, HitSample *sample);
+
+// Current pitch for ringing voices, semitones above the root in Q8. Called
+// once per render().
+typedef int16_t (*LivePitchSource)();
+
+// Engine tick count right now (the clock of HitEvent::time), for the
+// latency stamps taken inside render()
+typedef uint32_t (*TraceClock)();
+
+class VoiceEngine
+{
+public:
+  // tickHz is the rate of HitEvent::time and of the render() timestamp
+  void begin(HitSampleLookup lookup, uint32_t sampleRate, uint32_t tickHz);
+
+  // Producer side (sensor ISR): wait-free, never blocks, never loses a
+  // hit unless the queue overflows (counted in hitQueue().overflows()).
+  bool postHit(const HitEvent &ev) { return hits.push(ev); }
+
+  // Start a new voice `delay` samples into the next rendered block, playing
+  // the sample's layers at `step` (Q16.16, see pitchToStepQ16()). If the
+  // pool is full a voice is stolen according to the steal policy.
+  // Not reentrant with render(): callers must serialize the two.
+  void trigger(const HitSample &sample, uint32_t step = RESAMPLE_UNITY, uint32_t delay = 0,
+               bool released = false);
+
+  // Damping input (e.g. FSR pressed), safe to call from any ISR. While set,
+  // every sounding voice decays with the release time constant, including
+  // voices already mid-note.
+  void setDamped(bool on) { damped.store(on, std::memory_order_relaxed); }
+  bool isDamped() const { return damped.load(std::memory_order_relaxed); }
+
+  // Release envelope time constant in ms (level falls to 1/e per tau)
+  void setReleaseTime(float tauMs);
+
+  void setStealPolicy(StealPolicy policy) { stealPolicy = policy; }
+  StealPolicy getStealPolicy() const { return stealPolicy; }
+
+  // Live pitch (talking drum): while a source is set, every sounding
+  // voice glides from the pitch of its hit towards source() with the
+  // glide time constant. nullptr (the default) keeps the hit's pitch.
+  void setLivePitch(LivePitchSource source) { livePitch = source; }
+  LivePitchSource getLivePitch() const { return livePitch; }
+  void setGlideTime(float tauMs);
+
+  // Longest time from a hit's timestamp to its postHit(), in ticks (peak
+  // window + sensor block): hits are placed that long after their
+  // timestamp. 0 (the default) places them at the timestamp itself.
+  void setDetectionDelay(uint32_t ticks) { detectionDelay = ticks; }
+  uint32_t getDetectionDelay() const { return detectionDelay; }
+
+  // Fade-out lengths for stolen and choked voices
+  void setStealFade(float ms) { stealFadeSamples = msToSamples(ms); }
+  void setChokeFade(float ms) { chokeFadeSamples = msToSamples(ms); }
+
+  // running totals, divide deltas by elapsed time for a per-second rate
+  uint32_t steals() const { return stealCount.load(std::memory_order_relaxed); }
+  uint32_t chokes() const { return chokeCount.load(std::memory_order_relaxed); }
+
+  // Start all queued hits, then mix all active voices into out[0..n-1],
+  // n <= DRUM_BLOCK_SAMPLES and even. `now` is the tick count at the start of this
+  // block. Returns the number of hits started.
+  unsigned int render(int16_t *out, unsigned int n, uint32_t now);
+
+  unsigned int activeVoices() const;
+  const HitQueue &hitQueue() const { return hits; }
+
+  void setInterpolation(InterpMode mode) { interp = mode; }
+  InterpMode interpolation() const { return interp; }
+
+  // onset latency measurement mode (off by default)
+  void setOnsetStats(bool enable);
+  const OnsetStats &onsetStats() const { return onset; }
+
+  // latency tracing (off by default): render() records TRACE_DEQUEUE ..
+  // TRACE_I2S of every hit it starts into `trace`, reading `clock` at the
+  // dequeue, after the lookup and after the mix of the block the voice
+  // first sounds in. Not reentrant with render().
+  void setLatencyTrace(LatencyTrace *trace, TraceClock clock);
+
+private:
+  int allocVoice(uint8_t note);
+  int oldestVoice(int note) const;
+  int quietestVoice() const;
+  void startFade(DrumVoice &v, uint32_t samples);
+  void moveToFadePool(int index);
+  void correctGain(const HitEvent &ev);
+  uint32_t msToSamples(float ms) const;
+  void mixPending(unsigned int n);
+
+  HitQueue hits;
+  HitSampleLookup lookup;
+  LivePitchSource livePitch;
+  uint64_t samplesPerTickQ32;
+  uint32_t lastBlockTime;
+  uint32_t detectionDelay; // ticks from a hit's timestamp to where it is placed
+  bool haveBlockTime;
+  bool measureOnsets;
+  InterpMode interp;
+  std::atomic<bool> damped;
+  uint32_t sampleRate;
+  float releaseTauMs;
+  unsigned int releaseBlock; // block size releaseDecay was computed for
+  uint16_t releaseDecay;     // Q15 per-block envelope multiplier
+  float glideTauMs;
+  unsigned int glideBlock; // block size glideCoef was computed for
+  uint16_t glideCoef;      // Q15 share of the way to the live pitch per block
+  OnsetStats onset;
+  LatencyTrace *trace;
+  TraceClock traceClock;
+  uint32_t tracedTime[DRUM_MAX_VOICES + DRUM_FADE_VOICES]; // crossings of the voices first sounding in the last block
+  unsigned int tracedCount;
+  StealPolicy stealPolicy;
+  uint32_t stealFadeSamples;
+  uint32_t chokeFadeSamples;
+  std::atomic<uint32_t> stealCount;
+  std::atomic<uint32_t> chokeCount;
+  // [0, DRUM_MAX_VOICES) is the playable pool, the rest only fade out
+  DrumVoice voices[DRUM_MAX_VOICES + DRUM_FADE_VOICES];
+  uint8_t freeList[DRUM_MAX_VOICES]; // stack of idle pool voices
+  uint8_t freeCount;
+  uint32_t triggerCount;
+  int lastTriggered;   // voice of the last trigger(), -1 if it was dropped
+  int estimateVoice[PAD_MAX]; // voice started by each pad's last estimated hit, -1 if none
+  uint32_t estimateAge[PAD_MAX];
+  int32_t acc[DRUM_BLOCK_SAMPLES] __attribute__((aligned(4)));
+  int16_t scratch[2][DRUM_BLOCK_SAMPLES] __attribute__((aligned(4)));
+  MixInput pending[2]; // resampled layers waiting for the mix kernel
+  unsigned int pendingCount;
+};
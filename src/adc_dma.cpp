@@ -0,0 +1,354 @@
+#include "adc_dma.h"
+
+#include <Arduino.h>
+#include <DMAChannel.h>
+
+// ADC1 converts the even slots of a frame, ADC2 the odd ones. A0..A9
+// reach both ADCs on the same input, so any of them can be in any slot.
+// Input of A0..A9 (pins 14..23), as in the core's analog.c
+static const uint8_t analogPinInput[10] = {7, 8, 12, 11, 6, 5, 15, 0, 13, 14};
+
+// 16 in ADC_HC: the conversion channel comes from ADC_ETC
+#define ADC_HC_EXTERNAL 16
+
+#define RESULT_WORDS (ADC_DMA_MAX_CHAIN / 2) // two 12-bit results per register
+
+static DMAChannel dmaAdc1; // ADC_ETC TRIG0 results: the even slots
+static DMAChannel dmaAdc2; // ADC_ETC TRIG4 results: the odd slots, linked to dmaAdc1
+static DMAChannel dmaMux;  // select line toggles, linked to dmaAdc2
+
+// Ordinary statics live in DTCM, which the DMA reaches and the data cache
+// does not cover, so the ISR reads them without cache maintenance
+static uint32_t ringAdc1[2 * ADC_DMA_MAX_FRAMES * RESULT_WORDS] __attribute__((aligned(32)));
+static uint32_t ringAdc2[2 * ADC_DMA_MAX_FRAMES * RESULT_WORDS] __attribute__((aligned(32)));
+static uint32_t muxToggles[1 << ADC_MUX_MAX_BITS];
+static uint16_t frames[ADC_DMA_MAX_FRAMES * ADC_DMA_MAX_VALUES];
+
+static AdcBlockHandler blockHandler = nullptr;
+static unsigned int framesPerBlock = 0;
+static unsigned int chainLength = 0; // conversions per ADC per frame
+static unsigned int resultWords = 0; // result registers copied per ADC per frame
+static uint32_t ticksPerFrame = 0;
+static unsigned int lastHalf = 1;
+static volatile uint32_t overruns = 0;
+static bool muxing = false;
+static unsigned int muxCycle = 1; // frames per mux cycle
+
+// polled mode: frames are counted from the PIT start, which the DWT
+// follows exactly (both run from the 24 MHz crystal)
+static bool polling = false;
+static uint32_t startStamp = 0; // DWT when the PIT started
+static uint32_t lastPoll = 0;
+static uint32_t pollTicks = 0;       // DWT ticks not yet a whole frame
+static uint64_t framesTriggered = 0; // by the PIT, up to the last poll
+static uint64_t framesRead = 0;      // handed to the handler
+
+static int adcInput(uint8_t pin)
+{
+  if (pin < A0 || pin > A0 + 9)
+    return -1;
+  return analogPinInput[pin - A0];
+}
+
+static void xbarConnect(unsigned int input, unsigned int output)
+{
+  volatile uint16_t *sel = &XBARA1_SEL0 + (output >> 1);
+  if (output & 1)
+    *sel = (*sel & 0x00FF) | (input << 8);
+  else
+    *sel = (*sel & 0xFF00) | input;
+}
+
+// Frames [first, first + count) of the ring, unpacked, to the handler.
+// `time` is the trigger of the first one.
+static void deliver(unsigned int first, unsigned int count, uint32_t time, AdcBlockHandler handler)
+{
+  const uint32_t *a = ringAdc1 + first * resultWords;
+  const uint32_t *b = ringAdc2 + first * resultWords;
+  uint16_t *f = frames;
+  for (unsigned int i = 0; i < count; ++i, a += resultWords, b += resultWords)
+  {
+    for (unsigned int k = 0; k < chainLength; ++k)
+    {
+      unsigned int shift = (k & 1) * 16;
+      *f++ = (a[k >> 1] >> shift) & 0xFFF;
+      *f++ = (b[k >> 1] >> shift) & 0xFFF;
+    }
+  }
+
+  SensorBlock block;
+  block.frames = frames;
+  block.count = count;
+  block.ticksPerFrame = ticksPerFrame;
+  sensorBlockLayout(block);
+  block.stride = 2 * chainLength;
+  block.time = time;
+  handler(block);
+}
+
+static void adcDmaISR()
+{
+  uint32_t now = ARM_DWT_CYCCNT;
+  dmaAdc2.clearInterrupt();
+
+  // CITER counts down from 2 * framesPerBlock and reloads at completion:
+  // at or below the half point the first block is the one that finished.
+  // Only its low 9 bits count; with the mux linked the rest is the link.
+  unsigned int half = (dmaAdc2.TCD->CITER & 0x1FF) > framesPerBlock ? 1 : 0;
+  if (half == lastHalf)
+    ++overruns; // an interrupt was missed, this block was overwritten once
+  lastHalf = half;
+
+  // the last frame was triggered one conversion chain before this interrupt
+  deliver(half * framesPerBlock, framesPerBlock, now - (framesPerBlock - 1) * ticksPerFrame, blockHandler);
+  asm volatile("dsb"); // interrupt flag cleared before returning
+}
+
+// ADC_ETC chain of `n` segments from `chain` (TRIGx_CHAIN_1_0 on):
+// segment k converts input in[k] through the ADC's HCk, back to back
+static void chainConfig(volatile uint32_t *chain, const int *in, unsigned int n)
+{
+  for (unsigned int k = 0; k < n; k += 2)
+  {
+    uint32_t v = ADC_ETC_TRIG_CHAIN_CSEL0(in[k]) | ADC_ETC_TRIG_CHAIN_HWTS0(1 << k) | ADC_ETC_TRIG_CHAIN_B2B0;
+    if (k + 1 < n)
+      v |= ADC_ETC_TRIG_CHAIN_CSEL1(in[k + 1]) | ADC_ETC_TRIG_CHAIN_HWTS1(1 << (k + 1)) | ADC_ETC_TRIG_CHAIN_B2B1;
+    chain[k / 2] = v;
+  }
+}
+
+// One minor loop per frame: `words` result registers from `results`,
+// rewound after each frame, into a destination ring of two blocks
+static void resultCopy(DMAChannel &dma, volatile uint32_t *results, uint32_t *ring, unsigned int words,
+                       unsigned int blockFrames)
+{
+  dma.begin(true);
+  dma.TCD->SADDR = results;
+  dma.TCD->SOFF = 4;
+  dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2);
+  dma.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_SMLOE | DMA_TCD_NBYTES_MLOFFYES_MLOFF(-(int32_t)(words * 4)) |
+                             DMA_TCD_NBYTES_MLOFFYES_NBYTES(words * 4);
+  dma.TCD->SLAST = 0;
+  dma.TCD->DADDR = ring;
+  dma.TCD->DOFF = 4;
+  dma.TCD->CITER_ELINKNO = 2 * blockFrames;
+  dma.TCD->BITER_ELINKNO = 2 * blockFrames;
+  dma.TCD->DLASTSGA = -(int32_t)(2 * blockFrames * words * 4);
+  dma.TCD->CSR = 0;
+}
+
+// Select lines go through the port's normal GPIO (GPIO1..4): the fast
+// GPIO6..9 the core drives pins with are not on the DMA's bus. Input 0 to
+// start, then one toggle mask per frame along the Gray sequence.
+static bool muxBegin(const AdcScan &scan)
+{
+  unsigned int ways = 1u << scan.muxBits;
+  volatile uint32_t *fast = portOutputRegister(scan.muxPins[0]);
+  uint32_t port = ((uint32_t)fast - IMXRT_GPIO6_ADDRESS) / 0x4000;
+  if (port > 3)
+    return false;
+  uint32_t mask[ADC_MUX_MAX_BITS];
+  uint32_t all = 0;
+  for (unsigned int b = 0; b < scan.muxBits; ++b)
+  {
+    if (portOutputRegister(scan.muxPins[b]) != fast)
+      return false;
+    mask[b] = digitalPinToBitMask(scan.muxPins[b]);
+    all |= mask[b];
+  }
+  for (unsigned int k = 0; k < ways; ++k)
+  {
+    unsigned int change = adcMuxInput(k) ^ adcMuxInput((k + 1) % ways);
+    muxToggles[k] = 0;
+    for (unsigned int b = 0; b < scan.muxBits; ++b)
+      if (change & (1u << b))
+        muxToggles[k] |= mask[b];
+  }
+
+  volatile uint32_t *gpio = (volatile uint32_t *)(IMXRT_GPIO1_ADDRESS + port * 0x4000);
+  gpio[0x88 / 4] = all;  // DR_CLEAR: input 0
+  gpio[0x04 / 4] |= all; // GDIR: outputs
+  (&IOMUXC_GPR_GPR26)[port] &= ~all;
+
+  dmaMux.begin(true);
+  dmaMux.sourceBuffer(muxToggles, ways * sizeof(uint32_t));
+  dmaMux.destination(gpio[0x8C / 4]); // DR_TOGGLE
+  dmaMux.transferSize(4);
+  dmaMux.transferCount(ways);
+  return true;
+}
+
+static bool beginScan(const AdcScan &scan, uint32_t frameRateHz, unsigned int blockFrames, AdcBlockHandler handler,
+                      bool polled)
+{
+  int in[ADC_DMA_MAX_VALUES];
+  if (scan.values < 2 || scan.values > ADC_DMA_MAX_VALUES || (scan.values & 1) || scan.muxBits > ADC_MUX_MAX_BITS)
+    return false;
+  for (unsigned int s = 0; s < scan.values; ++s)
+    if ((in[s] = adcInput(scan.pins[s])) < 0)
+      return false;
+  if (blockFrames == 0 || blockFrames > ADC_DMA_MAX_FRAMES || blockFrames % (1u << scan.muxBits) ||
+      frameRateHz == 0 || frameRateHz > 100000 || (handler == nullptr && !polled))
+    return false;
+
+  blockHandler = handler;
+  framesPerBlock = blockFrames;
+  chainLength = scan.values / 2;
+  resultWords = (chainLength + 1) / 2;
+  ticksPerFrame = F_CPU_ACTUAL / frameRateHz;
+  lastHalf = 1;
+  overruns = 0;
+  muxCycle = 1u << scan.muxBits;
+  polling = polled;
+  framesTriggered = 0;
+  framesRead = 0;
+  pollTicks = 0;
+
+  int in1[ADC_DMA_MAX_CHAIN], in2[ADC_DMA_MAX_CHAIN];
+  for (unsigned int k = 0; k < chainLength; ++k)
+  {
+    in1[k] = in[2 * k];
+    in2[k] = in[2 * k + 1];
+  }
+
+  muxing = scan.muxBits > 0;
+  if (muxing && !muxBegin(scan))
+    return false;
+
+  // ADCs: hardware trigger, HC0..HCn driven by ADC_ETC. Resolution and
+  // averaging are whatever analogReadResolution/Averaging set.
+  ADC1_CFG |= ADC_CFG_ADTRG;
+  ADC2_CFG |= ADC_CFG_ADTRG;
+  for (unsigned int k = 0; k < chainLength; ++k)
+  {
+    (&ADC1_HC0)[k] = ADC_HC_ADCH(ADC_HC_EXTERNAL);
+    (&ADC2_HC0)[k] = ADC_HC_ADCH(ADC_HC_EXTERNAL);
+  }
+
+  // ADC_ETC: TRIG0 runs its chain on ADC1 and, in sync mode, TRIG4's
+  // chain of the same length on ADC2 at the same time. TSC_BYPASS gives
+  // ADC2 to ADC_ETC instead of the touch screen controller.
+  ADC_ETC_CTRL = ADC_ETC_CTRL_SOFTRST;
+  ADC_ETC_CTRL = ADC_ETC_CTRL_TSC_BYPASS | ADC_ETC_CTRL_TRIG_ENABLE(1 << 0);
+  ADC_ETC_TRIG0_CTRL = ADC_ETC_TRIG_CTRL_TRIG_CHAIN(chainLength - 1) | ADC_ETC_TRIG_CTRL_SYNC_MODE;
+  chainConfig(&ADC_ETC_TRIG0_CHAIN_1_0, in1, chainLength);
+  ADC_ETC_TRIG4_CTRL = ADC_ETC_TRIG_CTRL_TRIG_CHAIN(chainLength - 1);
+  chainConfig(&ADC_ETC_TRIG4_CHAIN_1_0, in2, chainLength);
+  ADC_ETC_DMA_CTRL = ADC_ETC_DMA_CTRL_TRIQ_ENABLE(1 << 4); // request when ADC2's chain is done
+
+  // DMA: one frame per request, the ADC2 copy chained to the ADC1 copy
+  // (and the mux step to the ADC2 copy) after every frame, the last of
+  // the ring included, each destination wrapping around its two-block ring
+  resultCopy(dmaAdc1, &ADC_ETC_TRIG0_RESULT_1_0, ringAdc1, resultWords, blockFrames);
+  dmaAdc1.triggerAtHardwareEvent(DMAMUX_SOURCE_ADC_ETC);
+  resultCopy(dmaAdc2, &ADC_ETC_TRIG4_RESULT_1_0, ringAdc2, resultWords, blockFrames);
+  dmaAdc2.triggerAtTransfersOf(dmaAdc1);
+  dmaAdc2.triggerAtCompletionOf(dmaAdc1);
+  if (!polled)
+  {
+    dmaAdc2.interruptAtHalf();
+    dmaAdc2.interruptAtCompletion();
+    dmaAdc2.attachInterrupt(adcDmaISR);
+  }
+  if (muxing)
+  {
+    dmaMux.triggerAtTransfersOf(dmaAdc2);
+    dmaMux.triggerAtCompletionOf(dmaAdc2);
+    dmaMux.enable();
+  }
+  dmaAdc2.enable();
+  dmaAdc1.enable();
+
+  // PIT -> XBAR1 -> ADC_ETC TRIG0. The PIT runs from the 24 MHz oscillator.
+  CCM_CCGR2 |= CCM_CCGR2_XBAR1(CCM_CCGR_ON);
+  xbarConnect(XBARA1_IN_PIT_TRIGGER0 + ADC_DMA_PIT, XBARA1_OUT_ADC_ETC_TRIG00);
+  CCM_CCGR1 |= CCM_CCGR1_PIT(CCM_CCGR_ON);
+  PIT_MCR = 0;
+  IMXRT_PIT_CHANNELS[ADC_DMA_PIT].TCTRL = 0;
+  IMXRT_PIT_CHANNELS[ADC_DMA_PIT].LDVAL = 24000000 / frameRateHz - 1;
+  startStamp = ARM_DWT_CYCCNT;
+  lastPoll = startStamp;
+  IMXRT_PIT_CHANNELS[ADC_DMA_PIT].TCTRL = PIT_TCTRL_TEN;
+  return true;
+}
+
+bool adcDmaBeginScan(const AdcScan &scan, uint32_t frameRateHz, unsigned int blockFrames, AdcBlockHandler handler)
+{
+  return beginScan(scan, frameRateHz, blockFrames, handler, false);
+}
+
+bool adcDmaBeginPolled(const AdcScan &scan, uint32_t frameRateHz, unsigned int blockFrames)
+{
+  return beginScan(scan, frameRateHz, blockFrames, nullptr, true);
+}
+
+unsigned int adcDmaPoll(AdcBlockHandler handler)
+{
+  if (!polling || handler == nullptr)
+    return 0;
+
+  // DMA position first: every frame it has copied was triggered by `now`
+  unsigned int ringFrames = 2 * framesPerBlock;
+  unsigned int pos = ringFrames - (dmaAdc2.TCD->CITER & 0x1FF);
+  uint32_t now = ARM_DWT_CYCCNT;
+  pollTicks += now - lastPoll;
+  lastPoll = now;
+  framesTriggered += pollTicks / ticksPerFrame;
+  pollTicks %= ticksPerFrame;
+
+  // the newest frame at that ring position that is not in the future
+  uint64_t done = framesTriggered - (framesTriggered + ringFrames - pos) % ringFrames;
+  if (done - framesRead >= ringFrames)
+  {
+    ++overruns; // the DMA came round to frames not read yet
+    framesRead = (done - ringFrames + 1 + muxCycle - 1) & ~(uint64_t)(muxCycle - 1);
+  }
+
+  uint64_t end = done & ~(uint64_t)(muxCycle - 1); // whole mux cycles only
+  unsigned int n = 0;
+  while (framesRead < end)
+  {
+    unsigned int first = (unsigned int)(framesRead % ringFrames);
+    unsigned int count = ringFrames - first;
+    if (count > end - framesRead)
+      count = (unsigned int)(end - framesRead);
+    if (count > ADC_DMA_MAX_FRAMES)
+      count = ADC_DMA_MAX_FRAMES;
+    // frame k is triggered k + 1 periods after the PIT starts
+    deliver(first, count, startStamp + (uint32_t)(framesRead + 1) * ticksPerFrame, handler);
+    framesRead += count;
+    n += count;
+  }
+  return n;
+}
+
+bool adcDmaBegin(const uint8_t pins[SENSOR_CHANNELS], uint32_t frameRateHz, unsigned int blockFrames,
+                 AdcBlockHandler handler)
+{
+  AdcScan scan;
+  for (int c = 0; c < SENSOR_CHANNELS; ++c)
+    scan.pins[c] = pins[c];
+  scan.values = SENSOR_CHANNELS;
+  scan.muxBits = 0;
+  return adcDmaBeginScan(scan, frameRateHz, blockFrames, handler);
+}
+
+void adcDmaEnd()
+{
+  IMXRT_PIT_CHANNELS[ADC_DMA_PIT].TCTRL = 0;
+  polling = false;
+  dmaAdc1.disable();
+  dmaAdc2.disable();
+  if (muxing)
+    dmaMux.disable();
+  ADC_ETC_DMA_CTRL = 0;
+  ADC_ETC_CTRL = 0;
+  // back to software triggers for analogRead()
+  ADC1_CFG &= ~ADC_CFG_ADTRG;
+  ADC2_CFG &= ~ADC_CFG_ADTRG;
+}
+
+uint32_t adcDmaOverruns()
+{
+  return overruns;
+}
@@ -0,0 +1,88 @@
+/* adc_dma.h
+   Hardware-triggered sensor acquisition (Teensy 4.x)
+
+   - PIT channel ADC_DMA_PIT fires at the frame rate and, through XBAR1,
+     triggers ADC_ETC chains on ADC1 and ADC2 together: a frame of n
+     values alternates the two ADCs (even slots ADC1, odd slots ADC2), so
+     it is n / 2 conversion times long, not n. The single-pad frame is
+     center, rim, flex, FSR (SensorChannel order)
+   - two linked DMA channels copy the ADC_ETC result registers into a
+     ring of two blocks; the half/complete interrupt hands the block that
+     just finished to the handler while the DMA fills the other one
+   - optional analog multiplexers: 2^muxBits inputs behind each muxed
+     pin, all sharing muxBits select lines on one GPIO port. A third DMA
+     channel, linked to the result copy, steps the select lines after
+     every frame in Gray code order (one line toggles, one write to
+     DR_TOGGLE), so a mux cycle is 2^muxBits frames and mux input i is
+     converted in frame adcMuxPhase(i) of it; blocks are whole cycles
+   - nothing blocks on a conversion: the CPU only sees whole blocks
+   - polled mode (DRUM_BARE_METAL) runs the same acquisition without the
+     DMA interrupt: adcDmaPoll() hands over every frame copied since the
+     last call, read off the DMA's position in the ring
+   - host/adc_dma_host.cpp is the stand-in used by the host build
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "hit_detector.h"
+
+#define ADC_DMA_MAX_FRAMES 64 // per block
+#define ADC_DMA_MAX_CHAIN 8   // conversions per ADC per frame (ADC_ETC chain length)
+#define ADC_DMA_MAX_VALUES (2 * ADC_DMA_MAX_CHAIN)
+#define ADC_MUX_MAX_BITS 4
+#ifndef ADC_DMA_PIT
+#define ADC_DMA_PIT 3 // IntervalTimer allocates PIT channels from 0
+#endif
+
+// One frame of conversions. Pins are A0..A9, which reach both ADCs.
+struct AdcScan
+{
+  uint8_t pins[ADC_DMA_MAX_VALUES];  // in frame order
+  uint8_t values;                    // even, 2..ADC_DMA_MAX_VALUES
+  uint8_t muxPins[ADC_MUX_MAX_BITS]; // select lines, least significant first
+  uint8_t muxBits;                   // 0: no multiplexers
+};
+
+// Runs in the DMA interrupt once per block (in polled mode, from
+// adcDmaPoll()); frames are only valid during the call. block.stride is the scan's value count.
+typedef void (*AdcBlockHandler)(const SensorBlock &block);
+
+// Mux input converted in frame `phase` of a cycle, and the other way round
+static inline unsigned int adcMuxInput(unsigned int phase)
+{
+  return phase ^ (phase >> 1);
+}
+
+static inline unsigned int adcMuxPhase(unsigned int input)
+{
+  unsigned int phase = input;
+  for (unsigned int s = input >> 1; s; s >>= 1)
+    phase ^= s;
+  return phase;
+}
+
+// Frame timestamps are ARM_DWT_CYCCNT ticks. Returns false for an
+// unsupported pin, value count or block size (a whole number of mux
+// cycles), or select lines not on one port.
+bool adcDmaBeginScan(const AdcScan &scan, uint32_t frameRateHz, unsigned int blockFrames, AdcBlockHandler handler);
+
+// One pad: `pins` in SensorChannel order, one frame of four
+bool adcDmaBegin(const uint8_t pins[SENSOR_CHANNELS], uint32_t frameRateHz, unsigned int blockFrames,
+                 AdcBlockHandler handler);
+void adcDmaEnd();
+
+// Polled mode: the ring is 2 * blockFrames frames and nothing runs when a
+// block completes. Each adcDmaPoll() hands the frames copied since the
+// last one to `handler`, in chunks of whole mux cycles (at most
+// ADC_DMA_MAX_FRAMES each, so more than one call per poll after a long
+// gap), timed from the PIT start. Poll at least once per ring, or the
+// frames the DMA came round to again are lost (counted as overruns).
+// Returns the frames handed over.
+bool adcDmaBeginPolled(const AdcScan &scan, uint32_t frameRateHz, unsigned int blockFrames);
+unsigned int adcDmaPoll(AdcBlockHandler handler);
+
+// Blocks that completed while the handler for the previous one was
+// still running, or polls that came too late (the ring was overrun and
+// frames were lost)
+uint32_t adcDmaOverruns();
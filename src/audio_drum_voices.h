@@ -0,0 +1,174 @@
+/* audio_drum_voices.h
+   Teensy Audio library binding for VoiceEngine
+
+   AudioDrumVoices is a source-only AudioStream (no inputs, one output).
+   postHit() is called straight from the sensor ISR; update() runs in the
+   audio software interrupt, starts the queued hits and mixes every
+   active voice into one block.
+
+   Time base is the DWT cycle counter (ARM_DWT_CYCCNT): stamp hits with it
+   in the ISR so the engine can place them sample-accurately.
+
+   An update hook (setUpdateHook) runs at the start of every update, before
+   the queued hits are started: the bare-metal build detects hits there,
+   so they start in the same update with no other context in between.
+
+   The output is watched for underruns: an update more than 1.5 block
+   periods after the one before means the I2S DMA ran out of blocks, an
+   update with no free audio block means AudioMemory() is too small.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "voice_engine.h"
+
+static_assert(AUDIO_BLOCK_SAMPLES <= DRUM_BLOCK_SAMPLES, "DRUM_BLOCK_SAMPLES too small for AUDIO_BLOCK_SAMPLES");
+
+class AudioDrumVoices : public AudioStream
+{
+public:
+  AudioDrumVoices() : AudioStream(0, NULL), startPin(-1), updateHook(nullptr), lateGap(0), lastUpdate(0), late(0), starved(0)
+  {
+    engine.begin(nullptr, AUDIO_SAMPLE_RATE_EXACT, F_CPU);
+  }
+
+  // call once from setup(), before hits are posted
+  void begin(HitSampleLookup lookup)
+  {
+    __disable_irq();
+    engine.begin(lookup, AUDIO_SAMPLE_RATE_EXACT, F_CPU_ACTUAL);
+    lateGap = (uint32_t)(1.5f * AUDIO_BLOCK_SAMPLES * F_CPU_ACTUAL / AUDIO_SAMPLE_RATE_EXACT);
+    __enable_irq();
+  }
+
+  // optional scope pin, held high while update() starts new voices
+  void setStartPin(int pin) { startPin = pin; }
+
+  // called from update() before it starts the queued hits (nullptr: none);
+  // hits it posts start in this update
+  void setUpdateHook(void (*hook)())
+  {
+    __disable_irq();
+    updateHook = hook;
+    __enable_irq();
+  }
+
+  // ISR safe: wait-free push into the SPSC hit queue
+  bool postHit(const HitEvent &ev) { return engine.postHit(ev); }
+
+  unsigned int activeVoices() const { return engine.activeVoices(); }
+
+  // ISR safe: FSR damping state, see VoiceEngine::setDamped()
+  void setDamped(bool on) { engine.setDamped(on); }
+  bool isDamped() const { return engine.isDamped(); }
+
+  void setReleaseTime(float tauMs)
+  {
+    __disable_irq();
+    engine.setReleaseTime(tauMs);
+    __enable_irq();
+  }
+
+  void setStealPolicy(StealPolicy policy) { engine.setStealPolicy(policy); }
+  StealPolicy getStealPolicy() const { return engine.getStealPolicy(); }
+
+  void setFadeTimes(float stealMs, float chokeMs)
+  {
+    __disable_irq();
+    engine.setStealFade(stealMs);
+    engine.setChokeFade(chokeMs);
+    __enable_irq();
+  }
+
+  uint32_t steals() const { return engine.steals(); }
+  uint32_t chokes() const { return engine.chokes(); }
+
+  // longest crossing -> postHit() time, see VoiceEngine::setDetectionDelay()
+  void setDetectionDelay(uint32_t us)
+  {
+    __disable_irq();
+    engine.setDetectionDelay((uint32_t)((uint64_t)us * F_CPU_ACTUAL / 1000000));
+    __enable_irq();
+  }
+
+  // takes effect from the next block
+  void setInterpolation(InterpMode mode) { engine.setInterpolation(mode); }
+
+  // live pitch source for ringing voices (nullptr: pitch fixed at the
+  // hit), called from update(); see VoiceEngine::setLivePitch()
+  void setLivePitch(LivePitchSource source) { engine.setLivePitch(source); }
+  LivePitchSource getLivePitch() const { return engine.getLivePitch(); }
+
+  void setGlideTime(float tauMs)
+  {
+    __disable_irq();
+    engine.setGlideTime(tauMs);
+    __enable_irq();
+  }
+  InterpMode interpolation() const { return engine.interpolation(); }
+  const HitQueue &hitQueue() const { return engine.hitQueue(); }
+
+  // onset jitter measurement mode; enabling it clears the statistics
+  void setOnsetStats(bool enable)
+  {
+    __disable_irq();
+    engine.setOnsetStats(enable);
+    __enable_irq();
+  }
+
+  void getOnsetStats(OnsetStats &stats)
+  {
+    __disable_irq();
+    stats = engine.onsetStats();
+    __enable_irq();
+  }
+
+  // underruns so far: late updates, updates without a free block
+  uint32_t lateUpdates() const { return late; }
+  uint32_t starvedUpdates() const { return starved; }
+
+  // per-stage hit latency into `trace` (nullptr: off), stamped with the
+  // DWT; see VoiceEngine::setLatencyTrace()
+  void setLatencyTrace(LatencyTrace *trace)
+  {
+    __disable_irq();
+    engine.setLatencyTrace(trace, dwtNow);
+    __enable_irq();
+  }
+
+  virtual void update(void)
+  {
+    uint32_t now = ARM_DWT_CYCCNT;
+    if (lateGap && lastUpdate && now - lastUpdate > lateGap)
+      ++late;
+    lastUpdate = now;
+    if (updateHook)
+      updateHook();
+    audio_block_t *block = allocate();
+    if (block == NULL)
+    {
+      ++starved;
+      return;
+    }
+    if (startPin >= 0 && engine.hitQueue().size() > 0)
+      digitalWriteFast(startPin, HIGH);
+    engine.render(block->data, AUDIO_BLOCK_SAMPLES, now);
+    if (startPin >= 0)
+      digitalWriteFast(startPin, LOW);
+    transmit(block);
+    release(block);
+  }
+
+private:
+  static uint32_t dwtNow() { return ARM_DWT_CYCCNT; }
+
+  VoiceEngine engine;
+  int startPin;
+  void (*updateHook)();
+  uint32_t lateGap; // DWT cycles between updates that count as an underrun
+  uint32_t lastUpdate;
+  volatile uint32_t late;
+  volatile uint32_t starved;
+};
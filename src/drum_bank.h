@@ -0,0 +1,21 @@
+// Auto-generated by gen.py, do not edit
+#pragma once
+#include "sample_bank.h"
+#include "drum_v0.h"
+
+#define DRUM_BANK_PADS 1
+#define DRUM_BANK_ZONES 2
+#define DRUM_BANK_VEL_LAYERS 1
+#define DRUM_BANK_SAMPLE_RATE 44100 // recording rate; the firmware corrects for its output rate
+
+// index = (pad * DRUM_BANK_ZONES + zone (HitZone)) * DRUM_BANK_VEL_LAYERS + velocity layer (softest first)
+constexpr DrumSampleDesc drumBank[] = {
+    {drum_v0, drum_v0_len, 0, 32767, 0},
+    {drum_v0, drum_v0_len, -1280, 26214, 0},
+};
+constexpr unsigned int drumBankSize = sizeof(drumBank) / sizeof(drumBank[0]);
+
+static_assert(DRUM_BANK_VEL_LAYERS >= 1, "bank needs at least one velocity layer");
+static_assert(DRUM_BANK_ZONES >= 1, "bank needs at least one zone");
+static_assert(DRUM_BANK_PADS >= 1, "bank needs at least one pad");
+static_assert(drumBankSize == DRUM_BANK_PADS * DRUM_BANK_ZONES * DRUM_BANK_VEL_LAYERS, "bank size does not match its dimensions");
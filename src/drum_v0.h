@@ -1,7 +1,7 @@
 // Auto-generated from base.wav
 #pragma once
 #include <Arduino.h>
-const int16_t drum_v2_p0_long[] PROGMEM = {
+const int16_t drum_v0[] PROGMEM = {
     -16, -1, 11, 14, 31, 21, 44, 26, 45, 28, 41, 19, 34, 15, 13, 11, 
     -6, -3, -19, -23, -34, -44, -56, -60, -79, -80, -102, -108, -120, -135, -146, -158, 
     -177, -186, -203, -220, -229, -251, -264, -281, -298, -318, -328, -353, -364, -384, -406, -413, 
@@ -828,4 +828,4 @@ const int16_t drum_v2_p0_long[] PROGMEM = {
     2908, 2838, 2753, 2675, 2588, 2504, 2411, 2327, 2224, 2135, 2034, 1940, 1837, 1736, 1635, 1531, 
     1428, 1321, 1220, 1110, 1008, 899, 794, 686, 582, 
 };
-const unsigned int drum_v2_p0_long_len = 13193;
+const unsigned int drum_v0_len = 13193;
@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v0_p1_short[] PROGMEM = {
-    7, -4, 9, 11, 16, 19, 22, 21, 22, 18, 15, 16, 7, 8, 0, -3, 
-    -8, -16, -20, -30, -32, -43, -47, -58, -65, -71, -83, -88, -100, -108, -117, -130, 
-    -137, -149, -160, -170, -184, -192, -206, -216, -229, -241, -252, -263, -274, -287, -296, -310, 
-    -316, -332, -337, -352, -358, -370, -377, -388, -396, -405, -411, -423, -427, -440, -443, -452, 
-    -460, -466, -476, -480, -490, -496, -504, -510, -518, -526, -533, -540, -548, -556, -563, -570, 
-    -579, -584, -592, -599, -606, -612, -619, -625, -631, -636, -641, -648, -648, -657, -653, -663, 
-    -660, -665, -663, -664, -665, -664, -662, -660, -659, -656, -652, -649, -645, -640, -634, -630, 
-    -621, -618, -609, -603, -595, -587, -577, -572, -557, -554, -537, -533, -514, -511, -491, -486, 
-    -464, -458, -438, -430, -409, -397, -381, -364, -350, -331, -316, -300, -281, -266, -246, -233, 
-    -213, -197, -178, -164, -145, -129, -111, -97, -77, -65, -43, -33, -11, -1, 18, 31, 
-    49, 61, 78, 93, 106, 123, 134, 153, 164, 181, 192, 209, 222, 236, 251, 266, 
-    280, 296, 309, 324, 339, 354, 369, 383, 399, 413, 428, 442, 457, 471, 483, 498, 
-    509, 525, 532, 547, 556, 568, 577, 587, 596, 605, 612, 620, 627, 634, 640, 646, 
-    652, 657, 664, 666, 673, 675, 681, 685, 687, 690, 695, 696, 698, 700, 699, 702, 
-    700, 701, 699, 695, 694, 688, 685, 678, 673, 663, 659, 644, 641, 623, 617, 601, 
-    591, 574, 563, 547, 531, 515, 498, 483, 465, 448, 430, 412, 394, 376, 355, 338, 
-    316, 298, 277, 255, 235, 211, 188, 164, 142, 115, 92, 62, 40, 8, -16, -46, 
-    -74, -103, -133, -164, -193, -225, -254, -285, -316, -347, -377, -409, -436, -469, -497, -526, 
-    -555, -582, -612, -638, -665, -690, -715, -741, -763, -788, -809, -831, -852, -872, -892, -909, 
-    -928, -944, -961, -977, -992, -1005, -1018, -1031, -1042, -1053, -1062, -1071, -1080, -1086, -1093, -1096, 
-    -1103, -1103, -1107, -1105, -1106, -1105, -1100, -1098, -1091, -1087, -1075, -1068, -1056, -1045, -1031, -1017, 
-    -1000, -984, -964, -945, -924, -902, -880, -852, -830, -798, -778, -740, -718, -680, -654, -617, 
-    -585, -549, -515, -477, -440, -401, -363, -322, -283, -238, -200, -154, -113, -67, -24, 22, 
-    65, 114, 157, 207, 253, 300, 350, 397, 444, 495, 540, 592, 639, 687, 736, 784, 
-    832, 879, 928, 974, 1022, 1066, 1114, 1156, 1203, 1244, 1288, 1326, 1370, 1406, 1446, 1481, 
-    1516, 1554, 1582, 1617, 1642, 1673, 1699, 1724, 1746, 1770, 1786, 1808, 1821, 1836, 1849, 1858, 
-    1867, 1874, 1876, 1881, 1878, 1877, 1873, 1866, 1859, 1844, 1835, 1813, 1801, 1774, 1755, 1728, 
-    1700, 1670, 1637, 1603, 1564, 1527, 1482, 1441, 1392, 1345, 1295, 1241, 1189, 1131, 1073, 1013, 
-    952, 887, 824, 755, 688, 617, 547, 475, 398, 326, 247, 171, 92, 11, -67, -150, 
-    -233, -315, -400, -486, -570, -658, -744, -830, -921, -1004, -1097, -1181, -1272, -1359, -1448, -1533, 
-    -1623, -1708, -1795, -1881, -1964, -2050, -2131, -2214, -2295, -2374, -2453, -2530, -2606, -2682, -2754, -2826, 
-    -2897, -2967, -3032, -3101, -3161, -3229, -3285, -3347, -3402, -3459, -3511, -3562, -3611, -3657, -3702, -3742, 
-    -3782, -3815, -3851, -3878, -3906, -3926, -3946, -3961, -3971, -3979, -3978, -3978, -3968, -3960, -3940, -3921, 
-    -3891, -3864, -3822, -3783, -3734, -3681, -3623, -3559, -3490, -3415, -3335, -3251, -3159, -3064, -2963, -2855, 
-    -2745, -2624, -2506, -2375, -2245, -2105, -1962, -1817, -1660, -1508, -1341, -1181, -1006, -836, -653, -476, 
-    -288, -101, 89, 283, 477, 677, 875, 1077, 1279, 1480, 1686, 1885, 2091, 2291, 2494, 2694, 
-    2893, 3088, 3286, 3473, 3669, 3849, 4038, 4212, 4393, 4560, 4732, 4892, 5053, 5206, 5357, 5499, 
-    5639, 5772, 5901, 6023, 6141, 6252, 6359, 6457, 6553, 6641, 6723, 6801, 6871, 6936, 6997, 7048, 
-    7100, 7136, 7179, 7203, 7235, 7248, 7267, 7272, 7277, 7273, 7264, 7253, 7234, 7209, 7181, 7147, 
-    7109, 7066, 7016, 6965, 6904, 6843, 6774, 6703, 6627, 6541, 6459, 6362, 6273, 6166, 6062, 5950, 
-    5835, 5712, 5585, 5450, 5314, 5167, 5016, 4859, 4692, 4523, 4342, 4159, 3964, 3760, 3555, 3335, 
-    3113, 2876, 2636, 2386, 2127, 1861, 1587, 1304, 1013, 717, 409, 100, -224, -548, -881, -1223, 
-    -1565, -1920, -2272, -2637, -3000, -3371, -3743, -4121, -4496, -4883, -5259, -5648, -6025, -6414, -6792, -7175, 
-    -7550, -7928, -8295, -8663, -9022, -9375, -9723, -10059, -10390, -10707, -11018, -11314, -11599, -11874, -12129, -12381, 
-    -12606, -12825, -13024, -13209, -13378, -13532, -13664, -13791, -13887, -13981, -14048, -14107, -14146, -14172, -14185, -14181, 
-    -14167, -14138, -14099, -14050, -13988, -13919, -13838, -13754, -13656, -13555, -13446, -13332, -13211, -13085, -12952, -12816, 
-    -12669, -12522, -12363, -12200, -12026, -11846, -11653, -11456, -11238, -11021, -10778, -10537, -10267, -9999, -9705, -9408, 
-    -9090, -8769, -8430, -8088, -7730, -7374, -7006, -6644, -6274, -5909, -5545, -5188, -4836, -4492, -4155, -3829, 
-    -3506, -3199, -2889, -2591, -2287, -1990, -1681, -1369, -1036, -697, -323, 63, 500, 951, 1463, 1998, 
-    2597, 3228, 3923, 4651, 5457, 6303, 7192, 8112, 9075, 10054, 11062, 12068, 13098, 14101, 15117, 16079, 
-    17073, 17976, 18943, 19561, 19521, 19555, 19533, 19548, 19538, 19545, 19540, 19544, 19540, 19545, 19540, 19544, 
-    19541, 19543, 19543, 19541, 19544, 19540, 19545, 19539, 19545, 19539, 19544, 19540, 19544, 19540, 19543, 19538, 
-    19544, 19538, 19544, 19540, 19543, 19541, 19543, 19541, 19543, 19540, 19545, 19537, 19547, 19535, 19551, 19530, 
-    19558, 19515, 19592, 19349, 18149, 17043, 15852, 14717, 13538, 12386, 11221, 10095, 8962, 7868, 6773, 5739, 
-    4729, 3780, 2858, 1999, 1187, 440, -264, -919, -1551, -2149, -2738, -3305, -3863, -4403, -4958, -5509, 
-    -6083, -6654, -7246, -7838, -8451, -9080, -9753, -10444, -11167, -11894, -12645, -13395, -14162, -14919, -15683, -16438, 
-    -17196, -17941, -18674, -19355, -19594, -19572, -19584, -19575, -19582, -19577, -19581, -19576, -19581, -19577, -19580, -19576, 
-    -19580, -19576, -19580, -19576, -19581, -19577, -19581, -19576, -19580, -19576, -19582, -19577, -19580, -19578, -19580, -19578, 
-    -19580, -19578, -19580, -19579, -19579, -19578, -19579, -19579, -19578, -19577, -19577, -19579, -19578, -19578, -19580, -19578, 
-    -19581, -19577, -19580, -19579, -19577, -19582, -19576, -19582, -19576, -19580, -19577, -19581, -19576, -19581, -19576, -19583, 
-    -19574, -19585, -19568, -19602, -19387, -18151, -16939, -15680, -14427, -13142, -11866, -10575, -9304, -8038, -6803, -5586, 
-    -4408, -3242, -2115, -994, 90, 1166, 2204, 3231, 4225, 5213, 6174, 7131, 8062, 8983, 9881, 10771, 
-    11636, 12508, 13349, 14215, 15043, 15918, 16741, 17628, 18436, 19350, 19585, 19521, 19556, 19532, 19550, 19535, 
-    19547, 19537, 19545, 19539, 19545, 19539, 19545, 19539, 19545, 19540, 19544, 19540, 19543, 19540, 19545, 19539, 
-    19545, 19539, 19545, 19541, 19543, 19541, 19544, 19540, 19544, 19539, 19544, 19541, 19544, 19541, 19542, 19542, 
-    19542, 19543, 19540, 19543, 19540, 19544, 19541, 19543, 19543, 19540, 19544, 19539, 19544, 19540, 19544, 19540, 
-    19543, 19540, 19543, 19542, 19543, 19541, 19544, 19540, 19545, 19539, 19544, 19539, 19544, 19539, 19546, 19536, 
-    19552, 19526, 19579, 19172, 17903, 16534, 15147, 13746, 12326, 10899, 9464, 8020, 6560, 5095, 3623, 2154, 
-    688, -769, -2212, -3645, -5050, -6434, -7787, -9111, -10400, -11654, -12870, -14054, -15192, -16311, -17376, -18451, 
-    -19372, -19592, -19576, -19580, -19580, -19578, -19579, -19579, -19578, -19580, -19578, -19579, -19579, -19579, -19579, -19579, 
-    -19579, -19578, -19579, -19579, -19578, -19579, -19578, -19580, -19576, -19581, -19577, -19582, -19576, -19581, -19576, -19581, 
-    -19577, -19579, -19578, -19579, -19578, -19581, -19578, -19581, -19577, -19580, -19578, -19579, -19578, -19578, -19579, -19580, 
-    -19577, -19580, -19577, -19581, -19578, -19581, -19577, -19580, -19578, -19581, -19578, -19579, -19577, -19580, -19577, -19581, 
-    -19576, -19582, -19575, -19581, -19575, -19582, -19577, -19581, -19576, -19582, -19574, -19583, -19574, -19586, -19570, -19586, 
-    -18390, -16464, -14573, -12624, -10696, -8732, -6793, -4836, -2907, -978, 915, 2796, 4641, 6466, 8256, 10014, 
-    11741, 13418, 15075, 16661, 18272, 19425, 19551, 19543, 19539, 19546, 19539, 19544, 19541, 19542, 19543, 19541, 
-    19543, 19541, 19542, 19543, 19540, 19544, 19538, 19545, 19540, 19544, 19541, 19542, 19542, 19542, 19542, 19542, 
-    19542, 19543, 19539, 19545, 19539, 19545, 19539, 19545, 19539, 19545, 19539, 19544, 19540, 19543, 19542, 19542, 
-    19542, 19542, 19541, 19544, 19540, 19545, 19538, 19545, 19538, 19545, 19538, 19545, 19539, 19544, 19539, 19544, 
-    19539, 19547, 19537, 19547, 19537, 19547, 19538, 19545, 19537, 19548, 19535, 19551, 19533, 19551, 19532, 19553, 
-    19531, 19554, 19527, 19561, 19517, 19576, 19487, 19660, 18365, 16431, 14679, 12781, 10951, 9041, 7176, 5259, 
-    3383, 1472, -393, -2276, -4112, -5950, -7747, -9531, -11281, -13002, -14703, -16343, -18019, -19364, -19591, -19579, 
-    -19577, -19582, -19576, -19583, -19575, -19584, -19574, -19584, -19575, -19583, -19576, -19581, -19577, -19581, -19576, -19583, 
-    -19575, -19584, -19574, -19583, -19574, -19584, -19575, -19582, -19576, -19581, -19578, -19581, -19577, -19581, -19577, -19581, 
-    -19578, -19580, -19577, -19580, -19575, -19581, -19574, -19583, -19574, -19585, -19574, -19583, -19574, -19583, -19576, -19583, 
-    -19576, -19581, -19576, -19582, -19575, -19581, -19575, -19581, -19575, -19581, -19576, -19582, -19573, -19584, -19573, -19584, 
-    -19574, -19582, -19573, -19584, -19572, -19587, -19571, -19587, -19570, -19589, -19568, -19590, -19564, -19595, -19559, -19606, 
-    -19538, -19640, -18481, -16768, -15204, -13500, -11847, -10113, -8412, -6657, -4934, -3175, -1461, 277, 1961, 3656, 
-    5295, 6935, 8516, 10101, 11617, 13148, 14591, 16080, 17433, 18946, 19571, 19518, 19558, 19530, 19551, 19535, 
-    19549, 19537, 19547, 19538, 19545, 19540, 19545, 19539, 19545, 19539, 19546, 19538, 19546, 19537, 19547, 19537, 
-    19545, 19538, 19545, 19539, 19543, 19540, 19542, 19540, 19543, 19538, 19545, 19538, 19545, 19538, 19544, 19540, 
-    19544, 19540, 19545, 19539, 19545, 19538, 19546, 19537, 19546, 19537, 19546, 19538, 19544, 19540, 19544, 19539, 
-    19546, 19537, 19546, 19537, 19546, 19538, 19547, 19537, 19546, 19537, 19547, 19536, 19547, 19535, 19549, 19534, 
-    19551, 19531, 19556, 19527, 19557, 19523, 19562, 19515, 19577, 19488, 19649, 18790, 17201, 15828, 14299, 12857, 
-    11318, 9827, 8267, 6732, 5142, 3569, 1948, 339, -1309, -2949, -4617, -6280, -7966, -9643, -11343, -13021, 
-    -14722, -16380, -18102, -19407, -19603, -19570, -19584, -19573, -19582, -19576, -19581, -19576, -19579, -19578, -19577, -19579, 
-    -19579, -19578, -19579, -19576, -19580, -19578, -19580, -19577, -19580, -19576, -19582, -19574, -19583, -19575, -19583, -19576, 
-    -19582, -19576, -19583, -19576, -19581, -19577, -19580, -19577, -19580, -19576, -19581, -19578, -19581, -19578, -19580, -19578, 
-    -19580, -19576, -19581, -19576, -19581, -19577, -19579, -19577, -19580, -19578, -19581, -19576, -19582, -19576, -19583, -19576, 
-    -19582, -19576, -19581, -19576, -19583, -19575, -19585, -19573, -19586, -19572, -19586, -19569, -19592, -19556, -19629, -18691, 
-    -17112, -15575, -13984, -12409, -10802, -9202, -7581, -5969, -4339, -2724, -1102, 499, 2101, 3674, 5239, 6771, 
-    8294, 9772, 11245, 12661, 14074, 15424, 16767, 18049, 19307, 19551, 19538, 19543, 19540, 19543, 19540, 19544, 
-    19539, 19544, 19540, 19544, 19539, 19544, 19540, 19543, 19541, 19542, 19542, 19541, 19543, 19541, 19542, 19540, 
-    19543, 19539, 19544, 19539, 19544, 19540, 19543, 19542, 19542, 19541, 19544, 19539, 19545, 19538, 19544, 19539, 
-    19543, 19540, 19545, 19539, 19546, 19538, 19546, 19537, 19546, 19538, 19547, 19538, 19546, 19537, 19546, 19537, 
-    19547, 19536, 19549, 19534, 19550, 19534, 19550, 19534, 19550, 19533, 19551, 19533, 19552, 19532, 19553, 19529, 
-    19560, 19520, 19571, 19496, 19631, 19145, 17519, 16032, 14461, 12969, 11438, 9962, 8464, 7006, 5536, 4088, 
-    2635, 1196, -247, -1687, -3129, -4575, -6018, -7475, -8920, -10387, -11824, -13293, -14706, -16173, -17524, -19036, 
-    -19633, -19543, -19605, -19560, -19595, -19565, -19593, -19567, -19590, -19568, -19587, -19572, -19585, -19574, -19583, -19575, 
-    -19584, -19574, -19582, -19574, -19582, -19575, -19580, -19576, -19582, -19575, -19582, -19576, -19582, -19576, -19581, -19577, 
-    -19581, -19576, -19583, -19575, -19583, -19576, -19581, -19577, -19582, -19576, -19581, -19576, -19581, -19578, -19580, -19577, 
-    -19581, -19578, -19580, -19578, -19580, -19578, -19581, -19577, -19582, -19575, -19582, -19575, -19582, -19576, -19581, -19577, 
-    -19582, -19575, -19583, -19575, -19582, -19575, -19582, -19576, -19583, -19573, -19587, -19565, -19608, -19467, -18252, -16960, 
-    -15612, -14264, -12867, -11467, -10031, -8587, -7115, -5633, -4131, -2622, -1093, 440, 1998, 3553, 5138, 6714, 
-    8322, 9911, 11529, 13120, 14746, 16316, 17971, 19317, 19556, 19540, 19542, 19543, 19540, 19543, 19541, 19543, 
-    19541, 19542, 19541, 19543, 19540, 19544, 19541, 19543, 19540, 19543, 19541, 19542, 19541, 19542, 19541, 19541, 
-    19543, 19541, 19543, 19540, 19543, 19541, 19542, 19542, 19541, 19543, 19542, 19542, 19541, 19541, 19544, 19540, 
-    19543, 19540, 19542, 19541, 19542, 19541, 19543, 19542, 19541, 19542, 19541, 19542, 19541, 19541, 19542, 19542, 
-    19540, 19549, 19445, 18786, 17936, 17143, 16316, 15520, 14712, 13931, 13144, 12382, 11621, 10883, 10146, 9430, 
-    8713, 8011, 7304, 6606, 5899, 5195, 4474, 3747, 2998, 2235, 1441, 629, -218, -1088, -1997, -2926, 
-    -3895, -4881, -5905, -6946, -8013, -9105, -10207, -11331, -12467, -13606, -14758, -15894, -17043, -18161, -19281, -19589, 
-    -19572, -19583, -19575, -19581, -19578, -19578, -19580, -19578, -19580, -19578, -19578, -19580, -19578, -19580, -19578, -19579, 
-    -19578, -19578, -19577, -19579, -19577, -19579, -19579, -19578, -19580, -19578, -19580, -19579, -19578, -19580, -19579, -19578, 
-    -19578, -19578, -19578, -19580, -19578, -19580, -19577, -19579, -19578, -19578, -19579, -19578, -19581, -19577, -19581, -19576, 
-    -19568, -18997, -17965, -16964, -15942, -14927, -13904, -12888, -11872, -10860, -9855, -8857, -7869, -6893, -5925, -4979, 
-    -4039, -3126, -2220, -1343, -481, 355, 1173, 1965, 2734, 3479, 4196, 4889, 5559, 6201, 6827, 7427, 
-    8016, 8584, 9145, 9690, 10237, 10768, 11311, 11836, 12381, 12913, 13466, 14012, 14579, 15137, 15722, 16290, 
-    16890, 17467, 18084, 18652, 19302, 19590, 19518, 19558, 19531, 19550, 19536, 19548, 19535, 19547, 19536, 19547, 
-    19537, 19547, 19537, 19546, 19538, 19545, 19539, 19544, 19540, 19545, 19538, 19546, 19538, 19545, 19539, 19544, 
-    19540, 19543, 19541, 19544, 19540, 19544, 19539, 19546, 19538, 19547, 19537, 19539, 19282, 18785, 18299, 17769, 
-    17222, 16631, 16016, 15356, 14668, 13933, 13168, 12362, 11528, 10657, 9760, 8835, 7887, 6925, 5947, 4966, 
-    3979, 2999, 2030, 1075, 135, -776, -1667, -2523, -3350, -4145, -4903, -5630, -6322, -6985, -7618, -8229, 
-    -8815, -9387, -9939, -10485, -11019, -11550, -12075, -12600, -13123, -13646, -14168, -14687, -15208, -15722, -16237, -16739, 
-    -17237, -17720, -18190, -18642, -19076, -19465, -19591, -19574, -19582, -19577, -19579, -19578, -19579, -19579, -19579, -19578, 
-    -19579, -19578, -19579, -19579, -19579, -19579, -19579, -19580, -19579, -19578, -19579, -19578, -19580, -19579, -19578, -19580, 
-    -19577, -19582, -19575, -19585, -19505, -19183, -18857, -18493, -18121, -17709, -17285, -16824, -16341, -15823, -15283, -14706, 
-    -14108, -13471, -12816, -12125, -11416, -10678, -9924, -9149, -8363, -7565, -6759, -5948, -5136, -4323, -3514, -2713, 
-    -1916, -1135, -359, 396, 1145, 1879, 2599, 3309, 4003, 4689, 5360, 6024, 6675, 7318, 7955, 8583, 
-    9203, 9816, 10421, 11015, 11600, 12172, 12731, 13276, 13803, 14313, 14805, 15270, 15721, 16142, 16543, 16913, 
-    17259, 17579, 17868, 18133, 18366, 18575, 18753, 18909, 19037, 19142, 19221, 19278, 19314, 19327, 19322, 19294, 
-    19248, 19180, 19099, 18995, 18878, 18748, 18597, 18441, 18258, 18073, 17862, 17650, 17413, 17174, 16913, 16649, 
-    16371, 16083, 15788, 15483, 15171, 14850, 14522, 14189, 13845, 13496, 13136, 12771, 12394, 12006, 11609, 11199, 
-    10781, 10346, 9901, 9441, 8971, 8485, 7987, 7473, 6947, 6402, 5845, 5271, 4684, 4082, 3462, 2832, 
-    2186, 1534, 865, 190, -489, -1179, -1869, -2564, -3259, -3950, -4642, -5320, -5998, -6656, -7310, -7938, 
-    -8558, -9154, -9733, -10286, -10821, -11328, -11818, -12274, -12718, -13128, -13525, -13889, -14244, -14567, -14886, -15176, 
-    -15459, -15723, -15973, -16214, -16437, -16651, -16852, -17038, -17213, -17369, -17508, -17629, -17728, -17806, -17858, -17884, 
-    -17883, -17850, -17791, -17697, -17577, -17424, -17244, -17036, -16806, -16549, -16275, -15983, -15673, -15353, -15025, -14685, 
-    -14353, -14007, -13677, -13341, -13018, -12700, -12390, -12088, -11796, -11507, -11227, -10945, -10667, -10386, -10102, -9802, 
-    -9500, -9176, -8841, -8485, -8106, -7708, -7284, -6832, -6363, -5864, -5349, -4812, -4260, -3691, -3112, -2521, 
-    -1928, -1327, -728, -130, 458, 1046, 1613, 2178, 2714, 3247, 3755, 4248, 4729, 5186, 5636, 6063, 
-    6480, 6882, 7271, 7647, 8017, 8366, 8721, 9052, 9392, 9711, 10034, 10345, 10657, 10957, 11255, 11545, 
-    11828, 12104, 12368, 12630, 12877, 13121, 13349, 13568, 13775, 13961, 14137, 14288, 14421, 14533, 14618, 14680, 
-    14715, 14724, 14706, 14659, 14588, 14489, 14366, 14219, 14046, 13858, 13644, 13422, 13175, 12920, 12648, 12370, 
-    12078, 11781, 11474, 11163, 10848, 10530, 10210, 9892, 9573, 9257, 8942, 8627, 8317, 8005, 7696, 7390, 
-    7084, 6780, 6477, 6176, 5877, 5578, 5283, 4987, 4700, 4407, 4121, 3838, 3554, 3278, 2998, 2723, 
-    2449, 2171, 1899, 1619, 1345, 1063, 784, 500, 217, -71, -362, -656, -952, -1250, -1550, -1852, 
-    -2156, -2459, -2769, -3070, -3386, -3689, -4004, -4309, -4623, -4932, -5247, -5555, -5869, -6174, -6484, -6783, 
-    -7083, -7374, -7661, -7937, -8207, -8462, -8711, -8940, -9157, -9357, -9540, -9704, -9850, -9975, -10082, -10170, 
-    -10239, -10287, -10321, -10334, -10334, -10315, -10286, -10240, -10189, -10116, -10051, -9956, -9879, -9774, -9685, -9576, 
-    -9476, -9367, -9255, -9144, -9025, -8907, -8778, -8645, -8506, -8352, -8190, -8013, -7823, -7619, -7397, -7164, 
-    -6916, -6657, -6383, -6103, -5812, -5519, -5218, -4918, -4618, -4319, -4029, -3741, -3471, -3206, -2964, -2731, 
-    -2524, -2329, -2160, -2011, -1882, -1774, -1685, -1614, -1562, -1521, -1495, -1475, -1466, -1455, -1449, -1437, 
-    -1422, -1400, -1367, -1324, -1269, -1201, -1121, -1023, -918, -790, -661, -508, -352, -178, -3, 184, 
-    375, 574, 778, 983, 1191, 1403, 1610, 1824, 2028, 2238, 2439, 2643, 2839, 3038, 3231, 3427, 
-    3617, 3814, 4005, 4203, 4398, 4596, 4797, 4997, 5197, 5400, 5597, 5792, 5987, 6167, 6349, 6510, 
-    6667, 6806, 6926, 7034, 7115, 7183, 7220, 7242, 7236, 7213, 7165, 7098, 7012, 6907, 6790, 6658, 
-    6518, 6371, 6220, 6066, 5915, 5768, 5624, 5494, 5368, 5260, 5161, 5079, 5010, 4959, 4916, 4899, 
-    4883, 4891, 4897, 4921, 4944, 4974, 5003, 5028, 5054, 5065, 5075, 5067, 5050, 5017, 4967, 4903, 
-    4817, 4717, 4598, 4461, 4310, 4142, 3961, 3769, 3563, 3352, 3131, 2906, 2678, 2445, 2220, 1989, 
-    1776, 1557, 1362, 1167, 993, 828, 680, 546, 428, 324, 234, 158, 90, 34, -16, -59, 
-    -101, -141, -179, -221, -265, -319, -379, -447, -528, -615, -722, -832, -959, -1096, -1241, -1401, 
-    -1559, -1733, -1905, -2079, -2254, -2420, -2590, -2742, -2891, -3025, -3152, -3260, -3358, -3442, -3511, -3571, 
-    -3611, -3649, -3669, -3687, -3698, -3703, -3710, -3713, -3723, -3734, -3754, -3778, -3810, -3855, -3901, -3966, 
-    -4030, -4114, -4196, -4296, -4393, -4500, -4611, -4719, -4832, -4940, -5042, -5144, -5230, -5317, -5387, -5446, 
-    -5497, -5528, -5555, -5560, -5561, -5547, -5525, -5496, -5456, -5421, -5368, -5328, -5271, -5232, -5174, -5137, 
-    -5089, -5054, -5017, -4986, -4962, -4942, -4923, -4913, -4900, -4897, -4890, -4888, -4888, -4884, -4886, -4877, 
-    -4873, -4858, -4846, -4822, -4796, -4761, -4721, -4671, -4617, -4545, -4472, -4381, -4285, -4174, -4052, -3919, 
-    -3773, -3615, -3446, -3263, -3072, -2868, -2656, -2433, -2201, -1958, -1711, -1455, -1197, -933, -666, -400, 
-    -130, 133, 397, 656, 908, 1155, 1392, 1624, 1844, 2059, 2256, 2457, 2634, 2817, 2981, 3148, 
-    3303, 3457, 3606, 3754, 3901, 4048, 4198, 4346, 4499, 4653, 4807, 4968, 5123, 5289, 5447, 5611, 
-    5769, 5929, 6085, 6239, 6389, 6534, 6676, 6809, 6943, 7063, 7187, 7295, 7406, 7503, 7602, 7690, 
-    7781, 7863, 7945, 8022, 8097, 8172, 8241, 8311, 8376, 8440, 8500, 8554, 8603, 8646, 8681, 8702, 
-    8719, 8714, 8705, 8673, 8634, 8570, 8495, 8396, 8281, 8146, 7988, 7817, 7619, 7411, 7177, 6936, 
-    6667, 6394, 6100, 5797, 5482, 5156, 4826, 4487, 4143, 3797, 3446, 3100, 2749, 2410, 2068, 1737, 
-    1406, 1089, 774, 470, 171, -111, -393, -658, -919, -1165, -1404, -1632, -1851, -2058, -2255, -2443, 
-    -2622, -2792, -2950, -3103, -3245, -3386, -3514, -3643, -3762, -3880, -3994, -4099, -4210, -4306, -4409, -4501, 
-    -4595, -4683, -4768, -4846, -4922, -4996, -5058, -5127, -5180, -5242, -5288, -5340, -5381, -5426, -5462, -5505, 
-    -5539, -5580, -5612, -5656, -5688, -5733, -5770, -5816, -5862, -5906, -5959, -6005, -6061, -6110, -6163, -6214, 
-    -6263, -6311, -6353, -6396, -6430, -6465, -6488, -6511, -6523, -6533, -6528, -6527, -6506, -6491, -6459, -6427, 
-    -6387, -6338, -6291, -6230, -6173, -6102, -6039, -5958, -5887, -5802, -5723, -5633, -5548, -5451, -5363, -5256, 
-    -5162, -5048, -4942, -4821, -4700, -4570, -4437, -4296, -4150, -3994, -3830, -3658, -3474, -3283, -3081, -2871, 
-    -2651, -2420, -2186, -1939, -1692, -1436, -1179, -918, -655, -395, -135, 119, 370, 614, 849, 1076, 
-    1287, 1493, 1676, 1858, 2011, 2164, 2288, 2411, 2507, 2601, 2672, 2738, 2787, 2830, 2866, 2891, 
-    2917, 2933, 2951, 2970, 2986, 3010, 3031, 3063, 3095, 3135, 3180, 3232, 3290, 3357, 3426, 3506, 
-    3583, 3672, 3759, 3849, 3942, 4031, 4121, 4212, 4293, 4381, 4455, 4537, 4608, 4680, 4745, 4809, 
-    4868, 4924, 4978, 5030, 5080, 5132, 5180, 5233, 5287, 5342, 5405, 5466, 5537, 5607, 5687, 5768, 
-    5857, 5946, 6041, 6137, 6233, 6331, 6422, 6517, 6601, 6683, 6756, 6817, 6872, 6911, 6940, 6952, 
-    6954, 6935, 6902, 6852, 6786, 6704, 6606, 6491, 6364, 6220, 6067, 5897, 5719, 5528, 5330, 5121, 
-    4909, 4684, 4458, 4226, 3991, 3755, 3515, 3276, 3037, 2798, 2563, 2328, 2102, 1875, 1662, 1447, 
-    1248, 1051, 867, 690, 524, 368, 224, 88, -32, -147, -247, -341, -421, -499, -563, -627, 
-    -682, -736, -790, -841, -897, -952, -1016, -1082, -1155, -1235, -1322, -1419, -1523, -1641, -1765, -1902, 
-    -2044, -2202, -2360, -2534, -2708, -2896, -3083, -3279, -3475, -3680, -3879, -4089, -4289, -4500, -4701, -4908, 
-    -5107, -5309, -5506, -5706, -5897, -6091, -6277, -6464, -6643, -6822, -6990, -7158, -7312, -7466, -7605, -7740, 
-    -7863, -7973, -8078, -8164, -8244, -8305, -8357, -8398, -8423, -8440, -8441, -8435, -8418, -8387, -8352, -8301, 
-    -8246, -8181, -8109, -8030, -7945, -7853, -7757, -7652, -7549, -7435, -7321, -7202, -7078, -6957, -6824, -6700, 
-    -6565, -6438, -6305, -6172, -6045, -5911, -5786, -5657, -5532, -5409, -5288, -5169, -5055, -4941, -4833, -4723, 
-    -4617, -4514, -4409, -4307, -4201, -4097, -3990, -3878, -3765, -3643, -3518, -3386, -3246, -3098, -2942, -2777, 
-    -2604, -2420, -2229, -2024, -1813, -1586, -1358, -1110, -861, -593, -325, -37, 248, 556, 860, 1183, 
-    1505, 1841, 2176, 2525, 2871, 3229, 3581, 3946, 4302, 4670, 5024, 5389, 5739, 6097, 6441, 6789, 
-    7121, 7457, 7780, 8097, 8406, 8707, 9000, 9287, 9562, 9834, 10091, 10348, 10592, 10829, 11057, 11278, 
-    11491, 11694, 11889, 12073, 12254, 12419, 12580, 12729, 12867, 12999, 13115, 13224, 13318, 13403, 13471, 13530, 
-    13569, 13600, 13607, 13603, 13580, 13539, 13480, 13403, 13306, 13191, 13053, 12897, 12720, 12524, 12308, 12075, 
-    11818, 11552, 11262, 10963, 10642, 10318, 9976, 9630, 9272, 8908, 8545, 8166, 7799, 7415, 7045, 6664, 
-    6291, 5915, 5540, 5170, 4796, 4428, 4058, 3689, 3321, 2953, 2587, 2214, 1848, 1473, 1103, 725, 
-    348, -32, -417, -803, -1198, -1593, -1996, -2406, -2815, -3239, -3662, -4098, -4537, -4983, -5437, -5896, 
-    -6361, -6829, -7305, -7778, -8257, -8734, -9208, -9683, -10149, -10611, -11062, -11504, -11932, -12350, -12749, -13134, 
-    -13500, -13849, -14178, -14489, -14781, -15051, -15305, -15535, -15754, -15948, -16130, -16297, -16446, -16588, -16709, -16828, 
-    -16926, -17019, -17097, -17163, -17217, -17256, -17282, -17291, -17283, -17257, -17208, -17141, -17049, -16932, -16790, -16618, 
-    -16420, -16193, -15931, -15645, -15324, -14977, -14599, -14196, -13765, -13314, -12835, -12340, -11828, -11301, -10764, -10214, 
-    -9665, -9110, -8555, -8006, -7454, -6919, -6381, -5862, -5346, -4843, -4350, -3869, -3397, -2933, -2478, -2028, 
-    -1584, -1140, -697, -253, 194, 645, 1105, 1570, 2046, 2532, 3026, 3536, 4050, 4581, 5115, 5661, 
-    6212, 6768, 7325, 7881, 8436, 8979, 9524, 10047, 10568, 11065, 11550, 12016, 12460, 12885, 13288, 13668, 
-    14028, 14365, 14678, 14976, 15248, 15508, 15743, 15967, 16173, 16365, 16541, 16708, 16858, 17003, 17132, 17251, 
-    17364, 17462, 17553, 17631, 17701, 17755, 17800, 17827, 17842, 17838, 17815, 17775, 17712, 17628, 17522, 17390, 
-    17237, 17056, 16852, 16623, 16366, 16089, 15780, 15457, 15100, 14732, 14334, 13926, 13493, 13050, 12584, 12113, 
-    11624, 11129, 10621, 10109, 9587, 9068, 8536, 8010, 7475, 6947, 6414, 5886, 5353, 4828, 4296, 3773, 
-    3244, 2719, 2194, 1663, 1139, 606, 75, -463, -1001, -1545, -2094, -2644, -3207, -3761, -4333, -4897, 
-    -5473, -6043, -6619, -7190, -7764, -8328, -8893, -9447, -9994, -10530, -11054, -11564, -12062, -12534, -12997, -13429, 
-    -13847, -14239, -14606, -14951, -15271, -15562, -15836, -16074, -16301, -16491, -16671, -16818, -16953, -17062, -17158, -17230, 
-    -17290, -17330, -17357, -17368, -17364, -17347, -17317, -17274, -17219, -17150, -17073, -16979, -16880, -16762, -16639, -16497, 
-    -16348, -16182, -16005, -15808, -15599, -15376, -15131, -14876, -14596, -14306, -13993, -13666, -13315, -12953, -12565, -12163, 
-    -11737, -11295, -10830, -10350, -9848, -9329, -8794, -8240, -7674, -7092, -6500, -5895, -5284, -4662, -4040, -3412, 
-    -2783, -2157, -1530, -909, -291, 319, 923, 1517, 2104, 2678, 3241, 3795, 4331, 4862, 5369, 5872, 
-    6352, 6829, 7284, 7733, 8163, 8587, 8997, 9396, 9787, 10165, 10538, 10895, 11250, 11586, 11923, 12238, 
-    12555, 12851, 13144, 13420, 13685, 13937, 14176, 14400, 14607, 14801, 14972, 15132, 15269, 15391, 15494, 15576, 
-    15644, 15690, 15721, 15733, 15728, 15709, 15672, 15620, 15552, 15473, 15376, 15271, 15148, 15017, 14870, 14716, 
-    14545, 14367, 14171, 13965, 13745, 13509, 13260, 12991, 12709, 12408, 12088, 11750, 11394, 11014, 10620, 10202, 
-    9768, 9313, 8836, 8350, 7837, 7320, 6776, 6229, 5662, 5091, 4507, 3918, 3319, 2720, 2110, 1505, 
-    890, 285, -326, -929, -1537, -2131, -2729, -3313, -3897, -4470, -5035, -5595, -6141, -6681, -7206, -7725, 
-    -8227, -8720, -9196, -9660, -10107, -10537, -10948, -11341, -11713, -12064, -12393, -12698, -12981, -13238, -13471, -13679, 
-    -13864, -14024, -14158, -14273, -14361, -14432, -14481, -14511, -14524, -14519, -14500, -14463, -14417, -14354, -14285, -14201, 
-    -14112, -14013, -13904, -13788, -13664, -13530, -13389, -13233, -13074, -12893, -12710, -12502, -12289, -12049, -11801, -11525, 
-    -11238, -10923, -10594, -10238, -9868, -9477, -9067, -8642, -8197, -7744, -7274, -6794, -6307, -5806, -5310, -4798, 
-    -4297, -3782, -3281, -2772, -2276, -1776, -1290, -804, -328, 140, 601, 1057, 1502, 1946, 2377, 2809, 
-    3234, 3653, 4073, 4484, 4898, 5306, 5712, 6115, 6514, 6913, 7303, 7691, 8070, 8446, 8813, 9169, 
-    9519, 9854, 10181, 10490, 10793, 11072, 11343, 11592, 11826, 12042, 12238, 12416, 12575, 12712, 12832, 12930, 
-    13008, 13070, 13106, 13131, 13131, 13118, 13084, 13036, 12970, 12889, 12793, 12681, 12555, 12416, 12263, 12100, 
-    11922, 11733, 11534, 11321, 11100, 10863, 10620, 10360, 10095, 9812, 9525, 9221, 8912, 8584, 8252, 7902, 
-    7549, 7176, 6800, 6408, 6010, 5600, 5180, 4752, 4315, 3870, 3416, 2957, 2492, 2023, 1548, 1075, 
-    598, 122, -353, -828, -1299, -1767, -2230, -2690, -3141, -3589, -4026, -4458, -4879, -5292, -5695, -6089, 
-    -6472, -6843, -7205, -7552, -7891, -8215, -8531, -8830, -9125, -9401, -9674, -9928, -10181, -10416, -10652, -10866, 
-    -11083, -11279, -11475, -11655, -11832, -11994, -12154, -12296, -12436, -12560, -12677, -12781, -12874, -12958, -13023, -13082, 
-    -13117, -13151, -13152, -13155, -13123, -13089, -13023, -12948, -12847, -12729, -12589, -12429, -12245, -12047, -11819, -11577, 
-    -11308, -11017, -10712, -10378, -10029, -9660, -9269, -8866, -8438, -8003, -7549, -7085, -6611, -6126, -5638, -5139, 
-    -4646, -4141, -3647, -3148, -2658, -2174, -1692, -1226, -759, -309, 134, 569, 992, 1410, 1816, 2212, 
-    2606, 2987, 3368, 3740, 4111, 4478, 4844, 5205, 5568, 5925, 6286, 6642, 6992, 7347, 7685, 8030, 
-    8356, 8684, 8996, 9300, 9590, 9867, 10130, 10374, 10606, 10818, 11016, 11191, 11354, 11493, 11622, 11728, 
-    11822, 11897, 11957, 12006, 12037, 12063, 12070, 12075, 12066, 12051, 12028, 11999, 11962, 11923, 11873, 11826, 
-    11767, 11711, 11645, 11580, 11505, 11432, 11345, 11263, 11162, 11066, 10954, 10837, 10709, 10570, 10422, 10256, 
-    10083, 9890, 9688, 9463, 9226, 8968, 8694, 8399, 8088, 7756, 7408, 7040, 6656, 6253, 5836, 5402, 
-    4956, 4496, 4025, 3545, 3056, 2562, 2059, 1559, 1052, 547, 46, -455, -948, -1438, -1920, -2396, 
-    -2862, -3318, -3764, -4202, -4625, -5041, -5443, -5834, -6214, -6581, -6937, -7279, -7612, -7931, -8243, -8537, 
-    -8826, -9101, -9367, -9624, -9867, -10106, -10331, -10549, -10756, -10954, -11141, -11322, -11487, -11646, -11791, -11925, 
-    -12050, -12155, -12258, -12337, -12414, -12467, -12518, -12541, -12567, -12561, -12556, -12523, -12484, -12424, -12350, -12262, 
-    -12155, -12039, -11904, -11756, -11599, -11420, -11243, -11037, -10839, -10611, -10390, -10145, -9898, -9637, -9369, -9091, 
-    -8804, -8506, -8205, -7891, -7578, -7252, -6929, -6594, -6265, -5925, -5589, -5248, -4907, -4565, -4225, -3881, 
-    -3544, -3199, -2863, -2520, -2184, -1842, -1508, -1164, -831, -488, -152, 187, 527, 865, 1205, 1542, 
-    1882, 2216, 2552, 2883, 3212, 3535, 3855, 4167, 4476, 4775, 5068, 5353, 5631, 5898, 6155, 6407, 
-    6643, 6877, 7095, 7307, 7512, 7704, 7895, 8072, 8248, 8415, 8576, 8734, 8884, 9031, 9170, 9303, 
-    9434, 9553, 9673, 9776, 9879, 9972, 10051, 10131, 10186, 10245, 10280, 10310, 10322, 10322, 10309, 10278, 
-    10238, 10174, 10105, 10010, 9908, 9784, 9649, 9497, 9334, 9155, 8967, 8766, 8559, 8341, 8119, 7887, 
-    7657, 7414, 7180, 6933, 6696, 6450, 6212, 5970, 5732, 5494, 5257, 5021, 4785, 4554, 4316, 4082, 
-    3845, 3609, 3368, 3124, 2880, 2630, 2377, 2119, 1859, 1591, 1321, 1048, 770, 492, 208, -73, 
-    -354, -636, -913, -1188, -1456, -1719, -1974, -2222, -2459, -2690, -2909, -3117, -3317, -3504, -3683, -3850, 
-    -4009, -4155, -4297, -4420, -4547, -4656, -4763, -4861, -4951, -5041, -5117, -5195, -5263, -5330, -5392, -5446, 
-    -5499, -5546, -5588, -5625, -5656, -5685, -5703, -5720, -5726, -5730, -5729, -5719, -5705, -5687, -5664, -5640, 
-    -5608, -5578, -5542, -5508, -5470, -5436, -5395, -5361, -5318, -5284, -5238, -5207, -5157, -5122, -5075, -5031, 
-    -4988, -4936, -4890, -4833, -4779, -4722, -4660, -4597, -4530, -4459, -4390, -4312, -4239, -4157, -4079, -3997, 
-    -3913, -3832, -3745, -3663, -3578, -3494, -3412, -3328, -3247, -3164, -3086, -3003, -2927, -2847, -2771, -2693, 
-    -2614, -2537, -2457, -2377, -2295, -2211, -2124, -2036, -1942, -1849, -1750, -1650, -1545, -1438, -1328, -1214, 
-    -1097, -978, -855, -731, -600, -474, -339, -209, -72, 59, 193, 324, 456, 581, 708, 826, 
-    945, 1054, 1162, 1263, 1359, 1452, 1534, 1618, 1690, 1762, 1825, 1886, 1942, 1994, 2044, 2089, 
-    2136, 2176, 2221, 2259, 2301, 2340, 2382, 2421, 2464, 2503, 2548, 2587, 2634, 2674, 2722, 2762, 
-    2809, 2847, 2896, 2929, 2978, 3009, 3054, 3087, 3126, 3162, 3197, 3229, 3267, 3297, 3335, 3364, 
-    3400, 3435, 3467, 3506, 3540, 3583, 3620, 3670, 3711, 3768, 3816, 3882, 3938, 4009, 4078, 4154, 
-    4232, 4314, 4400, 4484, 4571, 4658, 4743, 4824, 4905, 4980, 5050, 5116, 5171, 5224, 5264, 5299, 
-    5322, 5334, 5341, 5328, 5315, 5280, 5242, 5192, 5126, 5060, 4971, 4888, 4782, 4680, 4560, 4440, 
-    4308, 4172, 4032, 3882, 3735, 3575, 3420, 3255, 3092, 2920, 2752, 2576, 2404, 2225, 2049, 1869, 
-    1689, 1508, 1329, 1147, 969, 787, 614, 433, 263, 87, -79, -249, -414, -579, -737, -896, 
-    -1048, -1203, -1347, -1492, -1631, -1767, -1899, -2026, -2151, -2267, -2387, -2493, -2605, -2703, -2807, -2898, 
-    -2993, -3074, -3163, -3238, -3319, -3389, -3463, -3530, -3599, -3665, -3731, -3798, -3864, -3934, -4002, -4076, 
-    -4151, -4229, -4315, -4396, -4491, -4582, -4682, -4784, -4890, -4998, -5112, -5222, -5344, -5457, -5581, -5694, 
-    -5817, -5929, -6048, -6155, -6264, -6366, -6464, -6554, -6640, -6714, -6788, -6848, -6903, -6946, -6982, -7006, 
-    -7023, -7024, -7019, -6998, -6969, -6925, -6872, -6803, -6725, -6631, -6525, -6405, -6273, -6128, -5968, -5801, 
-    -5616, -5427, -5218, -5010, -4784, -4555, -4314, -4071, -3821, -3569, -3312, -3055, -2797, -2537, -2284, -2027, 
-    -1779, -1530, -1293, -1056, -826, -599, -381, -168, 40, 244, 442, 637, 829, 1016, 1202, 1386, 
-    1568, 1751, 1928, 2113, 2289, 2472, 2650, 2830, 3008, 3184, 3362, 3535, 3707, 3875, 4040, 4200, 
-    4357, 4504, 4652, 4783, 4921, 5039, 5158, 5269, 5369, 5469, 5557, 5643, 5723, 5797, 5871, 5940, 
-    6007, 6075, 6137, 6204, 6266, 6335, 6396, 6467, 6529, 6600, 6665, 6732, 6800, 6865, 6930, 6991, 
-    7054, 7110, 7165, 7213, 7261, 7299, 7333, 7361, 7379, 7392, 7393, 7386, 7368, 7338, 7300, 7248, 
-    7184, 7110, 7021, 6925, 6808, 6688, 6546, 6399, 6236, 6058, 5875, 5672, 5467, 5243, 5017, 4774, 
-    4531, 4272, 4014, 3744, 3475, 3195, 2920, 2634, 2352, 2066, 1779, 1495, 1206, 923, 641, 360, 
-    82, -190, -461, -725, -987, -1240, -1490, -1729, -1967, -2190, -2412, -2618, -2824, -3014, -3200, -3370, 
-    -3538, -3687, -3836, -3964, -4091, -4203, -4304, -4400, -4480, -4560, -4623, -4681, -4733, -4777, -4816, -4848, 
-    -4875, -4901, -4919, -4938, -4953, -4966, -4978, -4987, -4997, -5007, -5011, -5021, -5023, -5031, -5033, -5036, 
-    -5038, -5036, -5036, -5029, -5027, -5011, -5004, -4983, -4966, -4939, -4908, -4872, -4833, -4785, -4732, -4673, 
-    -4607, -4537, -4461, -4377, -4295, -4199, -4108, -4010, -3911, -3812, -3708, -3610, -3508, -3415, -3312, -3224, 
-    -3129, -3046, -2959, -2882, -2800, -2732, -2655, -2592, -2519, -2459, -2389, -2329, -2258, -2197, -2122, -2053, 
-    -1974, -1894, -1808, -1715, -1617, -1512, -1402, -1283, -1160, -1030, -897, -755, -616, -467, -325, -173, 
-    -32, 116, 254, 395, 528, 657, 780, 897, 1004, 1109, 1200, 1287, 1364, 1433, 1497, 1549, 
-    1596, 1636, 1668, 1698, 1714, 1735, 1742, 1751, 1753, 1751, 1750, 1740, 1734, 1720, 1708, 1692, 
-    1676, 1657, 1639, 1618, 1599, 1579, 1559, 1542, 1524, 1510, 1496, 1486, 1479, 1473, 1475, 1476, 
-    1481, 1493, 1506, 1523, 1548, 1566, 1602, 1627, 1666, 1700, 1738, 1781, 1820, 1865, 1907, 1950, 
-    1993, 2032, 2076, 2109, 2148, 2181, 2211, 2244, 2265, 2296, 2315, 2342, 2359, 2384, 2402, 2428, 
-    2448, 2475, 2499, 2531, 2559, 2596, 2633, 2673, 2717, 2764, 2812, 2866, 2917, 2973, 3028, 3082, 
-    3137, 3185, 3237, 3281, 3323, 3358, 3389, 3413, 3432, 3444, 3446, 3449, 3434, 3424, 3399, 3375, 
-    3343, 3306, 3265, 3220, 3172, 3120, 3068, 3010, 2957, 2897, 2844, 2784, 2733, 2674, 2624, 2570, 
-    2518, 2470, 2417, 2377, 2324, 2285, 2234, 2196, 2150, 2109, 2068, 2024, 1983, 1939, 1893, 1850, 
-    1799, 1752, 1696, 1644, 1586, 1523, 1463, 1388, 1322, 1237, 1160, 1068, 980, 880, 776, 668, 
-    551, 435, 304, 174, 35, -105, -258, -408, -572, -730, -903, -1074, -1248, -1429, -1607, -1794, 
-    -1974, -2160, -2344, -2527, -2712, -2891, -3074, -3249, -3428, -3598, -3773, -3938, -4104, -4265, -4422, -4577, 
-    -4724, -4869, -5009, -5143, -5274, -5398, -5522, -5635, -5750, -5855, -5962, -6058, -6158, -6245, -6341, -6416, 
-    -6508, -6577, -6658, -6723, -6791, -6853, -6909, -6962, -7010, -7050, -7086, -7112, -7134, -7145, -7149, -7140, 
-    -7127, -7098, -7062, -7011, -6951, -6877, -6791, -6695, -6582, -6463, -6324, -6183, -6023, -5859, -5679, -5495, 
-    -5301, -5099, -4896, -4680, -4468, -4246, -4028, -3804, -3581, -3358, -3136, -2914, -2697, -2475, -2264, -2048, 
-    -1840, -1631, -1428, -1225, -1029, -831, -640, -449, -264, -77, 104, 285, 467, 643, 826, 999, 
-    1183, 1358, 1542, 1723, 1908, 2100, 2288, 2490, 2687, 2900, 3111, 3331, 3560, 3791, 4034, 4281, 
-    4533, 4795, 5055, 5329, 5597, 5874, 6150, 6423, 6701, 6969, 7241, 7503, 7759, 8011, 8250, 8487, 
-    8707, 8922, 9121, 9313, 9489, 9655, 9805, 9946, 10067, 10186, 10278, 10370, 10438, 10499, 10544, 10576, 
-    10598, 10604, 10598, 10581, 10548, 10507, 10447, 10381, 10297, 10203, 10096, 9975, 9844, 9699, 9543, 9378, 
-    9197, 9011, 8811, 8604, 8383, 8157, 7919, 7673, 7418, 7152, 6883, 6596, 
-};
-const unsigned int drum_v0_p1_short_len = 5292;
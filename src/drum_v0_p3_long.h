@@ -1,557 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v0_p3_long[] PROGMEM = {
-    46, -13, 19, 10, 25, 18, 25, 15, 18, 7, 6, -4, -7, -19, -25, -36, 
-    -43, -56, -64, -77, -86, -100, -111, -126, -138, -154, -167, -184, -197, -214, -228, -246, 
-    -259, -276, -290, -306, -319, -334, -346, -361, -372, -385, -396, -408, -418, -430, -440, -450, 
-    -460, -470, -479, -490, -499, -509, -518, -529, -538, -548, -558, -569, -578, -588, -597, -607, 
-    -615, -624, -631, -639, -645, -651, -655, -659, -662, -663, -664, -665, -663, -661, -658, -654, 
-    -649, -644, -637, -630, -622, -614, -604, -594, -582, -572, -559, -547, -531, -517, -501, -485, 
-    -466, -448, -430, -409, -388, -368, -346, -324, -302, -279, -256, -234, -211, -187, -166, -143, 
-    -120, -98, -76, -54, -32, -11, 8, 30, 51, 70, 90, 110, 129, 148, 168, 186, 
-    206, 225, 244, 263, 283, 303, 322, 342, 362, 381, 402, 421, 440, 459, 478, 495, 
-    513, 529, 544, 559, 573, 586, 598, 609, 619, 629, 637, 646, 653, 661, 667, 673, 
-    679, 685, 688, 693, 696, 699, 700, 701, 701, 700, 696, 692, 686, 679, 670, 660, 
-    648, 635, 619, 604, 586, 567, 548, 527, 505, 484, 461, 437, 413, 389, 364, 338, 
-    311, 285, 256, 228, 197, 166, 134, 100, 65, 30, -7, -45, -83, -122, -163, -203, 
-    -244, -285, -325, -366, -407, -447, -487, -526, -564, -601, -638, -673, -707, -740, -772, -802, 
-    -831, -859, -885, -910, -933, -956, -977, -996, -1014, -1031, -1046, -1060, -1071, -1082, -1090, -1097, 
-    -1102, -1106, -1106, -1106, -1102, -1096, -1090, -1079, -1067, -1053, -1035, -1016, -994, -970, -944, -916, 
-    -885, -852, -818, -782, -743, -703, -660, -617, -571, -524, -475, -425, -373, -321, -265, -210, 
-    -152, -95, -35, 24, 86, 146, 210, 272, 337, 401, 465, 530, 595, 659, 724, 789, 
-    852, 916, 979, 1041, 1102, 1162, 1220, 1277, 1332, 1386, 1437, 1485, 1532, 1577, 1618, 1657, 
-    1694, 1726, 1757, 1784, 1808, 1828, 1846, 1860, 1870, 1876, 1880, 1878, 1874, 1865, 1852, 1835, 
-    1814, 1788, 1758, 1725, 1685, 1643, 1597, 1546, 1491, 1433, 1370, 1304, 1234, 1161, 1083, 1004, 
-    920, 834, 744, 653, 559, 461, 362, 260, 157, 51, -55, -165, -275, -387, -501, -616, 
-    -731, -847, -965, -1081, -1200, -1317, -1435, -1551, -1669, -1783, -1898, -2010, -2122, -2230, -2338, -2443, 
-    -2546, -2647, -2746, -2841, -2936, -3025, -3113, -3198, -3281, -3358, -3434, -3505, -3574, -3637, -3697, -3751, 
-    -3802, -3846, -3886, -3918, -3944, -3963, -3976, -3978, -3976, -3963, -3943, -3912, -3876, -3826, -3770, -3703, 
-    -3627, -3541, -3447, -3341, -3227, -3102, -2970, -2826, -2674, -2511, -2341, -2160, -1972, -1773, -1567, -1352, 
-    -1131, -901, -664, -421, -173, 81, 339, 602, 867, 1136, 1405, 1677, 1947, 2218, 2487, 2755, 
-    3017, 3279, 3534, 3786, 4030, 4271, 4501, 4728, 4944, 5154, 5353, 5545, 5726, 5900, 6062, 6215, 
-    6357, 6490, 6611, 6724, 6824, 6916, 6995, 7067, 7126, 7176, 7215, 7245, 7264, 7275, 7274, 7264, 
-    7246, 7218, 7180, 7134, 7079, 7015, 6942, 6862, 6772, 6675, 6568, 6453, 6330, 6199, 6056, 5908, 
-    5748, 5579, 5399, 5210, 5008, 4797, 4570, 4334, 4083, 3819, 3540, 3250, 2941, 2621, 2284, 1934, 
-    1568, 1189, 795, 389, -31, -462, -907, -1361, -1828, -2302, -2787, -3276, -3776, -4277, -4787, -5295, 
-    -5807, -6318, -6829, -7334, -7838, -8331, -8819, -9292, -9757, -10203, -10637, -11048, -11442, -11811, -12160, -12481, 
-    -12778, -13045, -13288, -13498, -13682, -13835, -13961, -14057, -14126, -14167, -14185, -14175, -14146, -14092, -14023, -13931, 
-    -13828, -13707, -13575, -13429, -13276, -13107, -12934, -12745, -12549, -12338, -12117, -11877, -11625, -11349, -11058, -10742, 
-    -10406, -10042, -9661, -9249, -8823, -8372, -7910, -7429, -6947, -6454, -5968, -5480, -5009, -4542, -4098, -3660, 
-    -3245, -2833, -2435, -2029, -1626, -1194, -746, -250, 287, 895, 1560, 2314, 3141, 4068, 5072, 6200, 
-    7373, 8636, 9927, 11279, 12621, 13998, 15309, 16642, 17868, 19137, 19585, 19518, 19555, 19531, 19549, 19535, 
-    19546, 19538, 19544, 19539, 19544, 19540, 19542, 19541, 19542, 19542, 19541, 19541, 19540, 19542, 19539, 19542, 
-    19538, 19544, 19538, 19545, 19538, 19546, 19535, 19549, 19532, 19553, 19526, 19562, 19507, 19610, 18694, 17052, 
-    15567, 13976, 12455, 10890, 9406, 7904, 6483, 5098, 3824, 2596, 1491, 459, -455, -1327, -2125, -2914, 
-    -3655, -4394, -5118, -5879, -6637, -7432, -8225, -9073, -9961, -10915, -11879, -12886, -13889, -14918, -15917, -16946, 
-    -17921, -18932, -19559, -19576, -19581, -19577, -19580, -19577, -19578, -19578, -19578, -19578, -19577, -19578, -19577, -19579, 
-    -19577, -19578, -19577, -19580, -19577, -19579, -19578, -19579, -19577, -19579, -19578, -19578, -19578, -19578, -19576, -19578, 
-    -19577, -19578, -19578, -19579, -19578, -19579, -19578, -19578, -19579, -19578, -19578, -19578, -19579, -19576, -19580, -19576, 
-    -19580, -19581, -19499, -18115, -16415, -14767, -13044, -11346, -9624, -7950, -6294, -4708, -3149, -1650, -172, 1248, 
-    2642, 3981, 5301, 6579, 7844, 9062, 10268, 11430, 12591, 13719, 14863, 15985, 17136, 18261, 19381, 19571, 
-    19528, 19549, 19536, 19545, 19538, 19543, 19540, 19542, 19540, 19542, 19541, 19542, 19540, 19542, 19541, 19541, 
-    19541, 19542, 19541, 19541, 19542, 19542, 19541, 19541, 19542, 19541, 19541, 19541, 19541, 19541, 19541, 19541, 
-    19541, 19542, 19541, 19541, 19541, 19542, 19541, 19541, 19540, 19542, 19541, 19542, 19540, 19543, 19540, 19543, 
-    19539, 19544, 19539, 19544, 19544, 19465, 18133, 16250, 14423, 12515, 10625, 8693, 6763, 4795, 2841, 873, 
-    -1061, -2991, -4872, -6722, -8508, -10249, -11913, -13526, -15060, -16546, -17969, -19281, -19604, -19569, -19584, -19574, 
-    -19581, -19577, -19579, -19577, -19579, -19578, -19579, -19578, -19578, -19578, -19578, -19578, -19578, -19578, -19578, -19579, 
-    -19578, -19578, -19578, -19578, -19577, -19578, -19578, -19579, -19578, -19578, -19578, -19578, -19578, -19577, -19579, -19578, 
-    -19578, -19577, -19580, -19578, -19579, -19578, -19580, -19577, -19579, -19576, -19580, -19575, -19581, -19574, -19582, -19573, 
-    -19585, -19570, -19589, -19563, -19600, -19543, -19651, -18455, -15846, -13345, -10703, -8142, -5503, -2948, -355, 2133, 
-    4639, 7033, 9437, 11707, 13992, 16103, 18296, 19534, 19530, 19550, 19536, 19545, 19539, 19542, 19541, 19541, 
-    19542, 19541, 19542, 19540, 19543, 19540, 19543, 19539, 19543, 19540, 19543, 19540, 19543, 19539, 19544, 19539, 
-    19544, 19539, 19544, 19538, 19545, 19538, 19545, 19538, 19545, 19538, 19546, 19538, 19545, 19537, 19545, 19536, 
-    19546, 19536, 19546, 19536, 19547, 19535, 19548, 19535, 19548, 19533, 19551, 19531, 19553, 19528, 19557, 19524, 
-    19562, 19514, 19578, 19483, 19660, 18237, 15638, 13286, 10723, 8267, 5692, 3203, 642, -1823, -4327, -6723, 
-    -9149, -11448, -13786, -15954, -18238, -19562, -19564, -19589, -19570, -19585, -19573, -19582, -19575, -19581, -19576, -19581, 
-    -19576, -19580, -19577, -19580, -19577, -19579, -19577, -19580, -19577, -19580, -19577, -19580, -19577, -19580, -19577, -19580, 
-    -19576, -19579, -19575, -19579, -19576, -19580, -19577, -19580, -19576, -19580, -19577, -19581, -19575, -19581, -19575, -19580, 
-    -19575, -19580, -19575, -19581, -19574, -19582, -19574, -19582, -19572, -19583, -19572, -19586, -19570, -19587, -19568, -19590, 
-    -19561, -19600, -19545, -19647, -19149, -16982, -14848, -12587, -10341, -8019, -5717, -3377, -1080, 1221, 3457, 5676, 
-    7816, 9934, 11965, 13981, 15889, 17840, 19416, 19544, 19544, 19539, 19544, 19539, 19544, 19539, 19544, 19540, 
-    19543, 19540, 19543, 19539, 19543, 19540, 19543, 19539, 19543, 19539, 19543, 19538, 19543, 19538, 19543, 19539, 
-    19543, 19538, 19544, 19539, 19544, 19539, 19544, 19538, 19544, 19537, 19545, 19537, 19545, 19538, 19545, 19538, 
-    19545, 19537, 19546, 19536, 19547, 19535, 19548, 19533, 19548, 19532, 19552, 19529, 19555, 19526, 19559, 19517, 
-    19573, 19490, 19644, 18805, 16727, 14857, 12819, 10852, 8777, 6736, 4607, 2498, 315, -1852, -4081, -6289, 
-    -8551, -10783, -13063, -15279, -17582, -19385, -19600, -19571, -19581, -19576, -19581, -19575, -19579, -19576, -19579, -19577, 
-    -19579, -19576, -19579, -19577, -19579, -19577, -19578, -19577, -19579, -19578, -19579, -19578, -19579, -19578, -19578, -19578, 
-    -19577, -19578, -19578, -19580, -19577, -19580, -19577, -19579, -19576, -19580, -19576, -19580, -19575, -19581, -19575, -19582, 
-    -19574, -19583, -19573, -19584, -19572, -19585, -19570, -19588, -19567, -19592, -19561, -19602, -19541, -19648, -18562, -16414, 
-    -14372, -12218, -10109, -7937, -5793, -3613, -1463, 690, 2808, 4903, 6958, 8967, 10937, 12836, 14709, 16465, 
-    18273, 19518, 19521, 19558, 19526, 19554, 19530, 19551, 19533, 19550, 19533, 19549, 19534, 19548, 19534, 19547, 
-    19535, 19546, 19535, 19546, 19535, 19546, 19536, 19546, 19537, 19545, 19537, 19546, 19537, 19544, 19537, 19545, 
-    19538, 19545, 19538, 19544, 19538, 19544, 19539, 19544, 19538, 19544, 19539, 19544, 19539, 19543, 19539, 19543, 
-    19540, 19542, 19540, 19543, 19540, 19541, 19542, 19541, 19541, 19544, 19488, 17782, 15651, 13652, 11605, 9635, 
-    7641, 5708, 3748, 1836, -105, -2011, -3954, -5867, -7821, -9745, -11704, -13616, -15554, -17423, -19262, -19614, 
-    -19564, -19586, -19574, -19581, -19577, -19578, -19578, -19578, -19579, -19576, -19581, -19576, -19579, -19576, -19579, -19575, 
-    -19581, -19575, -19581, -19576, -19581, -19575, -19581, -19575, -19582, -19575, -19582, -19574, -19582, -19574, -19582, -19574, 
-    -19583, -19574, -19582, -19574, -19583, -19574, -19583, -19574, -19583, -19573, -19583, -19573, -19584, -19572, -19585, -19571, 
-    -19586, -19571, -19586, -19569, -19589, -19566, -19593, -19560, -19590, -18305, -16492, -14724, -12862, -10988, -9060, -7107, 
-    -5122, -3110, -1080, 981, 3052, 5163, 7270, 9422, 11541, 13716, 15807, 18037, 19495, 19528, 19554, 19531, 
-    19549, 19534, 19548, 19535, 19546, 19536, 19545, 19538, 19544, 19538, 19544, 19538, 19543, 19538, 19543, 19539, 
-    19543, 19539, 19543, 19540, 19542, 19540, 19543, 19540, 19542, 19541, 19541, 19540, 19541, 19541, 19541, 19541, 
-    19541, 19541, 19541, 19541, 19540, 19543, 19537, 19554, 19392, 18429, 17324, 16247, 15169, 14112, 13069, 12050, 
-    11050, 10073, 9114, 8168, 7230, 6293, 5351, 4394, 3414, 2402, 1349, 250, -902, -2106, -3366, -4673, 
-    -6034, -7434, -8880, -10353, -11858, -13378, -14911, -16430, -17959, -19342, -19599, -19569, -19583, -19575, -19581, -19576, 
-    -19581, -19576, -19580, -19576, -19580, -19576, -19580, -19575, -19579, -19575, -19580, -19576, -19580, -19576, -19581, -19576, 
-    -19581, -19576, -19580, -19575, -19581, -19575, -19582, -19573, -19582, -19572, -19584, -19570, -19590, -19560, -19612, -19111, 
-    -17763, -16427, -15055, -13704, -12339, -10993, -9646, -8324, -7011, -5727, -4464, -3233, -2030, -867, 260, 1348, 
-    2394, 3397, 4353, 5266, 6134, 6965, 7759, 8529, 9270, 10002, 10717, 11434, 12144, 12869, 13591, 14340, 
-    15085, 15863, 16627, 17435, 18204, 19053, 19575, 19523, 19554, 19532, 19549, 19534, 19546, 19536, 19545, 19538, 
-    19545, 19538, 19544, 19538, 19545, 19539, 19544, 19539, 19543, 19538, 19544, 19539, 19544, 19539, 19544, 19538, 
-    19546, 19535, 19554, 19410, 18811, 18141, 17425, 16652, 15818, 14920, 13955, 12923, 11830, 10678, 9474, 8224, 
-    6942, 5637, 4323, 3012, 1722, 456, -768, -1949, -3072, -4141, -5146, -6094, -6984, -7825, -8623, -9388, 
-    -10125, -10845, -11554, -12255, -12954, -13652, -14348, -15041, -15732, -16413, -17082, -17730, -18353, -18944, -19466, -19592, 
-    -19572, -19582, -19575, -19580, -19576, -19579, -19576, -19579, -19577, -19580, -19577, -19580, -19578, -19579, -19577, -19580, 
-    -19578, -19579, -19578, -19579, -19580, -19542, -19173, -18711, -18222, -17684, -17102, -16471, -15787, -15052, -14264, -13425, 
-    -12535, -11599, -10619, -9604, -8561, -7498, -6420, -5337, -4252, -3174, -2109, -1062, -34, 967, 1949, 2906, 
-    3843, 4756, 5651, 6526, 7386, 8232, 9064, 9883, 10686, 11471, 12237, 12977, 13690, 14372, 15018, 15626, 
-    16194, 16714, 17190, 17616, 17993, 18321, 18599, 18828, 19013, 19153, 19250, 19308, 19327, 19310, 19257, 19170, 
-    19050, 18901, 18725, 18522, 18294, 18038, 17760, 17456, 17132, 16783, 16419, 16035, 15637, 15222, 14796, 14354, 
-    13902, 13433, 12952, 12453, 11937, 11400, 10845, 10266, 9665, 9041, 8394, 7721, 7023, 6298, 5546, 4767, 
-    3962, 3130, 2276, 1401, 506, -400, -1318, -2243, -3170, -4095, -5011, -5913, -6797, -7655, -8485, -9281, 
-    -10040, -10760, -11439, -12074, -12668, -13220, -13731, -14204, -14643, -15051, -15430, -15783, -16110, -16417, -16699, -16960, 
-    -17196, -17404, -17579, -17721, -17820, -17876, -17882, -17838, -17739, -17587, -17380, -17124, -16822, -16479, -16102, -15695, 
-    -15266, -14822, -14371, -13919, -13473, -13036, -12614, -12205, -11812, -11428, -11054, -10680, -10306, -9918, -9513, -9082, 
-    -8622, -8123, -7586, -7003, -6380, -5713, -5012, -4278, -3518, -2737, -1945, -1144, -345, 445, 1222, 1978, 
-    2706, 3407, 4078, 4719, 5332, 5917, 6475, 7009, 7520, 8011, 8484, 8942, 9387, 9819, 10242, 10655, 
-    11058, 11450, 11829, 12194, 12545, 12881, 13199, 13499, 13776, 14025, 14242, 14423, 14565, 14663, 14715, 14720, 
-    14676, 14584, 14447, 14264, 14041, 13780, 13488, 13167, 12819, 12452, 12067, 11666, 11253, 10833, 10408, 9982, 
-    9558, 9135, 8715, 8299, 7885, 7474, 7067, 6660, 6258, 5858, 5460, 5066, 4678, 4292, 3911, 3535, 
-    3164, 2794, 2427, 2059, 1691, 1321, 948, 571, 192, -193, -583, -979, -1377, -1780, -2184, -2592, 
-    -3000, -3413, -3825, -4239, -4653, -5070, -5486, -5900, -6311, -6718, -7115, -7503, -7878, -8236, -8576, -8893, 
-    -9181, -9443, -9670, -9866, -10026, -10154, -10245, -10305, -10332, -10332, -10302, -10251, -10177, -10086, -9978, -9860, 
-    -9732, -9598, -9459, -9314, -9163, -9008, -8845, -8670, -8481, -8274, -8044, -7791, -7511, -7204, -6874, -6521, 
-    -6149, -5763, -5367, -4966, -4565, -4170, -3786, -3421, -3080, -2766, -2486, -2239, -2031, -1860, -1725, -1624, 
-    -1553, -1506, -1478, -1463, -1452, -1439, -1418, -1383, -1330, -1256, -1159, -1038, -891, -721, -529, -314, 
-    -83, 161, 418, 686, 960, 1238, 1519, 1799, 2077, 2351, 2621, 2885, 3148, 3406, 3665, 3922, 
-    4184, 4445, 4712, 4979, 5247, 5514, 5776, 6031, 6273, 6499, 6702, 6879, 7024, 7135, 7208, 7240, 
-    7232, 7187, 7102, 6985, 6838, 6667, 6478, 6280, 6075, 5874, 5679, 5499, 5337, 5198, 5082, 4994, 
-    4931, 4897, 4885, 4895, 4918, 4953, 4992, 5029, 5057, 5072, 5068, 5041, 4987, 4904, 4788, 4642, 
-    4464, 4259, 4027, 3772, 3498, 3209, 2909, 2604, 2296, 1995, 1702, 1426, 1170, 936, 728, 546, 
-    392, 263, 157, 70, 0, -60, -114, -167, -221, -283, -358, -449, -557, -686, -836, -1006, 
-    -1196, -1402, -1622, -1852, -2084, -2315, -2539, -2749, -2941, -3115, -3264, -3390, -3493, -3571, -3627, -3664, 
-    -3687, -3700, -3707, -3714, -3726, -3748, -3779, -3827, -3889, -3967, -4062, -4174, -4300, -4436, -4580, -4728, 
-    -4876, -5017, -5149, -5267, -5370, -5451, -5511, -5548, -5562, -5555, -5532, -5492, -5442, -5383, -5319, -5255, 
-    -5190, -5129, -5074, -5025, -4984, -4953, -4927, -4910, -4898, -4892, -4888, -4886, -4884, -4879, -4866, -4848, 
-    -4820, -4781, -4729, -4666, -4585, -4487, -4371, -4235, -4078, -3900, -3701, -3480, -3238, -2977, -2698, -2401, 
-    -2086, -1758, -1419, -1071, -716, -359, -2, 349, 694, 1030, 1351, 1659, 1951, 2225, 2484, 2726, 
-    2955, 3172, 3381, 3582, 3779, 3975, 4174, 4373, 4577, 4784, 4994, 5208, 5424, 5640, 5852, 6062, 
-    6267, 6465, 6655, 6836, 7008, 7168, 7318, 7458, 7588, 7709, 7825, 7934, 8038, 8137, 8233, 8324, 
-    8411, 8492, 8565, 8628, 8677, 8707, 8718, 8704, 8667, 8599, 8503, 8371, 8207, 8006, 7772, 7502, 
-    7202, 6871, 6512, 6128, 5721, 5295, 4855, 4402, 3941, 3476, 3010, 2550, 2096, 1651, 1217, 798, 
-    391, 2, -372, -728, -1068, -1388, -1692, -1977, -2244, -2493, -2726, -2942, -3142, -3331, -3509, -3676, 
-    -3835, -3988, -4132, -4271, -4402, -4530, -4650, -4765, -4868, -4968, -5058, -5143, -5218, -5289, -5351, -5410, 
-    -5462, -5515, -5564, -5614, -5664, -5717, -5770, -5830, -5891, -5956, -6024, -6093, -6162, -6230, -6294, -6354, 
-    -6406, -6453, -6489, -6516, -6529, -6531, -6520, -6496, -6460, -6414, -6355, -6288, -6211, -6126, -6034, -5934, 
-    -5830, -5719, -5603, -5482, -5357, -5224, -5084, -4935, -4778, -4609, -4432, -4242, -4041, -3823, -3590, -3339, 
-    -3073, -2789, -2488, -2173, -1845, -1509, -1165, -816, -467, -120, 219, 548, 864, 1161, 1438, 1691, 
-    1920, 2123, 2301, 2451, 2576, 2679, 2759, 2820, 2868, 2902, 2930, 2952, 2977, 3003, 3035, 3075, 
-    3125, 3185, 3256, 3339, 3435, 3538, 3650, 3768, 3890, 4010, 4131, 4248, 4359, 4467, 4568, 4664, 
-    4753, 4836, 4912, 4985, 5053, 5120, 5187, 5257, 5330, 5411, 5499, 5594, 5697, 5809, 5928, 6053, 
-    6182, 6311, 6437, 6558, 6668, 6765, 6844, 6906, 6941, 6955, 6940, 6895, 6821, 6720, 6588, 6430, 
-    6246, 6039, 5809, 5561, 5294, 5015, 4721, 4418, 4107, 3792, 3473, 3153, 2835, 2519, 2210, 1909, 
-    1620, 1342, 1079, 832, 602, 389, 196, 23, -131, -268, -385, -489, -577, -657, -729, -800, 
-    -871, -946, -1029, -1122, -1224, -1342, -1475, -1627, -1795, -1980, -2182, -2400, -2631, -2875, -3128, -3390, 
-    -3658, -3929, -4203, -4478, -4752, -5022, -5290, -5556, -5817, -6073, -6324, -6568, -6806, -7034, -7250, -7453, 
-    -7642, -7813, -7967, -8100, -8213, -8302, -8369, -8414, -8438, -8441, -8425, -8390, -8338, -8268, -8185, -8087, 
-    -7978, -7858, -7727, -7588, -7441, -7286, -7126, -6959, -6789, -6616, -6441, -6266, -6091, -5917, -5746, -5578, 
-    -5412, -5251, -5095, -4945, -4798, -4654, -4515, -4377, -4238, -4098, -3955, -3805, -3645, -3475, -3295, -3099, 
-    -2889, -2663, -2421, -2162, -1884, -1588, -1275, -943, -594, -227, 155, 556, 971, 1403, 1844, 2298, 
-    2762, 3233, 3711, 4192, 4675, 5156, 5633, 6104, 6569, 7022, 7466, 7897, 8315, 8718, 9108, 9483, 
-    9843, 10189, 10523, 10839, 11142, 11431, 11704, 11960, 12204, 12429, 12639, 12830, 13005, 13159, 13294, 13406, 
-    13496, 13560, 13599, 13607, 13587, 13535, 13450, 13332, 13180, 12991, 12766, 12506, 12213, 11884, 11526, 11137, 
-    10722, 10286, 9830, 9357, 8875, 8382, 7883, 7381, 6879, 6377, 5876, 5377, 4881, 4388, 3894, 3402, 
-    2912, 2420, 1926, 1432, 932, 429, -79, -592, -1115, -1644, -2184, -2732, -3293, -3864, -4449, -5044, 
-    -5652, -6269, -6896, -7529, -8165, -8802, -9436, -10064, -10677, -11277, -11855, -12411, -12938, -13436, -13901, -14333, 
-    -14731, -15094, -15421, -15717, -15980, -16214, -16423, -16608, -16770, -16912, -17032, -17132, -17208, -17262, -17288, -17285, 
-    -17248, -17176, -17064, -16907, -16703, -16449, -16144, -15783, -15370, -14904, -14388, -13824, -13218, -12572, -11894, -11191, 
-    -10467, -9733, -8993, -8254, -7522, -6801, -6094, -5405, -4734, -4082, -3449, -2831, -2226, -1630, -1039, -447, 
-    147, 752, 1367, 2000, 2648, 3316, 4002, 4708, 5428, 6163, 6904, 7648, 8387, 9118, 9832, 10525, 
-    11190, 11826, 12427, 12991, 13516, 14003, 14449, 14858, 15231, 15571, 15880, 16160, 16413, 16643, 16850, 17039, 
-    17206, 17356, 17488, 17602, 17697, 17769, 17818, 17840, 17832, 17791, 17715, 17598, 17442, 17241, 16998, 16708, 
-    16376, 15996, 15576, 15111, 14610, 14072, 13504, 12904, 12281, 11633, 10968, 10287, 9596, 8896, 8191, 7481, 
-    6773, 6064, 5357, 4652, 3948, 3245, 2543, 1839, 1135, 427, -286, -1006, -1733, -2468, -3211, -3961, 
-    -4718, -5481, -6246, -7011, -7774, -8530, -9277, -10008, -10720, -11411, -12075, -12705, -13302, -13860, -14377, -14851, 
-    -15282, -15667, -16009, -16306, -16563, -16778, -16957, -17101, -17212, -17291, -17343, -17366, -17364, -17336, -17287, -17213, 
-    -17121, -17005, -16871, -16714, -16536, -16335, -16112, -15860, -15583, -15277, -14941, -14574, -14178, -13749, -13286, -12792, 
-    -12263, -11699, -11100, -10468, -9800, -9102, -8373, -7618, -6837, -6037, -5220, -4391, -3556, -2717, -1880, -1048, 
-    -224, 589, 1387, 2171, 2933, 3676, 4396, 5094, 5765, 6414, 7039, 7640, 8218, 8778, 9316, 9837, 
-    10340, 10826, 11294, 11747, 12179, 12596, 12992, 13369, 13722, 14054, 14358, 14638, 14886, 15104, 15289, 15444, 
-    15563, 15652, 15707, 15732, 15726, 15692, 15629, 15540, 15425, 15287, 15127, 14944, 14740, 14515, 14268, 13997, 
-    13703, 13382, 13032, 12654, 12243, 11799, 11322, 10809, 10262, 9680, 9063, 8415, 7737, 7031, 6300, 5548, 
-    4778, 3992, 3195, 2389, 1577, 763, -49, -860, -1665, -2461, -3248, -4023, -4785, -5533, -6264, -6976, 
-    -7670, -8342, -8991, -9614, -10209, -10773, -11304, -11798, -12255, -12671, -13045, -13375, -13662, -13906, -14104, -14263, 
-    -14381, -14463, -14509, -14524, -14509, -14467, -14401, -14314, -14208, -14086, -13948, -13795, -13628, -13445, -13244, -13024, 
-    -12782, -12516, -12223, -11898, -11541, -11150, -10722, -10256, -9757, -9224, -8659, -8067, -7450, -6813, -6158, -5492, 
-    -4818, -4140, -3462, -2789, -2122, -1464, -816, -182, 438, 1047, 1643, 2227, 2802, 3368, 3927, 4481, 
-    5029, 5574, 6111, 6645, 7172, 7689, 8195, 8692, 9170, 9632, 10074, 10494, 10889, 11256, 11595, 11902, 
-    12177, 12419, 12625, 12796, 12931, 13032, 13097, 13129, 13128, 13096, 13034, 12942, 12823, 12677, 12505, 12310, 
-    12092, 11853, 11593, 11312, 11011, 10690, 10350, 9988, 9607, 9207, 8786, 8345, 7885, 7405, 6904, 6386, 
-    5849, 5295, 4724, 4139, 3538, 2925, 2303, 1673, 1040, 404, -231, -864, -1492, -2113, -2726, -3328, 
-    -3918, -4493, -5054, -5597, -6124, -6630, -7119, -7585, -8032, -8456, -8861, -9245, -9610, -9956, -10285, -10597, 
-    -10891, -11170, -11431, -11676, -11905, -12118, -12314, -12493, -12653, -12793, -12913, -13012, -13085, -13134, -13156, -13148, 
-    -13110, -13038, -12934, -12794, -12618, -12404, -12154, -11865, -11538, -11171, -10769, -10328, -9852, -9343, -8800, -8228, 
-    -7631, -7011, -6373, -5722, -5061, -4396, -3729, -3067, -2415, -1773, -1144, -531, 63, 643, 1206, 1752, 
-    2283, 2802, 3309, 3808, 4301, 4790, 5274, 5755, 6235, 6709, 7178, 7641, 8092, 8531, 8955, 9359, 
-    9740, 10096, 10423, 10723, 10991, 11227, 11432, 11606, 11750, 11865, 11951, 12013, 12052, 12071, 12072, 12058, 
-    12030, 11990, 11940, 11880, 11811, 11736, 11653, 11562, 11463, 11355, 11237, 11107, 10965, 10806, 10630, 10434, 
-    10215, 9972, 9703, 9404, 9076, 8715, 8320, 7893, 7433, 6941, 6417, 5864, 5284, 4681, 4055, 3413, 
-    2756, 2090, 1418, 744, 73, -593, -1250, -1896, -2530, -3145, -3744, -4325, -4886, -5427, -5947, -6446, 
-    -6924, -7379, -7815, -8231, -8626, -9002, -9360, -9699, -10021, -10326, -10614, -10884, -11138, -11374, -11592, -11789, 
-    -11966, -12121, -12254, -12364, -12451, -12514, -12552, -12566, -12553, -12513, -12445, -12350, -12227, -12078, -11903, -11703, 
-    -11480, -11236, -10971, -10686, -10383, -10060, -9720, -9363, -8990, -8599, -8195, -7779, -7353, -6917, -6475, -6027, 
-    -5576, -5122, -4666, -4211, -3755, -3301, -2846, -2393, -1941, -1489, -1037, -586, -133, 318, 771, 1223, 
-    1675, 2125, 2572, 3013, 3448, 3875, 4292, 4697, 5088, 5466, 5829, 6175, 6504, 6817, 7113, 7392, 
-    7657, 7908, 8147, 8374, 8591, 8798, 8995, 9182, 9359, 9526, 9681, 9821, 9950, 10061, 10156, 10230, 
-    10286, 10316, 10324, 10305, 10263, 10190, 10093, 9966, 9813, 9631, 9425, 9194, 8942, 8672, 8387, 8088, 
-    7781, 7465, 7145, 6822, 6500, 6177, 5858, 5540, 5224, 4909, 4597, 4283, 3968, 3652, 3332, 3005, 
-    2677, 2337, 1993, 1638, 1279, 911, 540, 162, -213, -589, -959, -1323, -1676, -2018, -2343, -2654, 
-    -2946, -3221, -3476, -3714, -3933, -4135, -4318, -4487, -4642, -4781, -4909, -5027, -5134, -5231, -5321, -5402, 
-    -5474, -5540, -5596, -5642, -5680, -5707, -5723, -5730, -5727, -5712, -5689, -5659, -5623, -5580, -5535, -5487, 
-    -5439, -5388, -5337, -5285, -5233, -5179, -5124, -5066, -5006, -4943, -4875, -4803, -4727, -4645, -4558, -4466, 
-    -4370, -4270, -4165, -4058, -3948, -3837, -3724, -3613, -3500, -3390, -3279, -3171, -3063, -2957, -2853, -2749, 
-    -2645, -2541, -2435, -2327, -2216, -2100, -1979, -1853, -1722, -1586, -1443, -1296, -1142, -983, -819, -650, 
-    -477, -301, -123, 55, 232, 408, 578, 744, 902, 1052, 1193, 1326, 1449, 1561, 1665, 1759, 
-    1845, 1922, 1994, 2058, 2119, 2177, 2233, 2287, 2340, 2394, 2449, 2504, 2560, 2618, 2676, 2735, 
-    2793, 2850, 2906, 2961, 3013, 3064, 3113, 3163, 3208, 3254, 3300, 3344, 3389, 3435, 3481, 3530, 
-    3582, 3639, 3700, 3767, 3841, 3922, 4010, 4106, 4209, 4318, 4432, 4546, 4662, 4774, 4882, 4984, 
-    5076, 5157, 5225, 5279, 5316, 5336, 5336, 5318, 5279, 5222, 5145, 5051, 4939, 4812, 4669, 4512, 
-    4342, 4161, 3970, 3771, 3564, 3350, 3132, 2906, 2678, 2445, 2210, 1971, 1732, 1490, 1251, 1009, 
-    771, 534, 301, 70, -154, -378, -595, -809, -1016, -1219, -1412, -1602, -1783, -1957, -2124, -2284, 
-    -2436, -2581, -2719, -2849, -2972, -3088, -3198, -3302, -3400, -3495, -3585, -3675, -3763, -3852, -3943, -4038, 
-    -4136, -4242, -4354, -4472, -4598, -4731, -4871, -5016, -5166, -5321, -5479, -5637, -5795, -5951, -6102, -6246, 
-    -6383, -6510, -6626, -6729, -6820, -6894, -6954, -6995, -7020, -7024, -7009, -6973, -6917, -6837, -6736, -6611, 
-    -6463, -6291, -6096, -5879, -5642, -5383, -5107, -4814, -4504, -4182, -3852, -3514, -3171, -2826, -2482, -2142, 
-    -1806, -1478, -1160, -850, -549, -261, 18, 290, 553, 810, 1060, 1307, 1551, 1793, 2034, 2275, 
-    2514, 2755, 2992, 3229, 3463, 3693, 3917, 4135, 4344, 4544, 4731, 4909, 5072, 5225, 5364, 5492, 
-    5609, 5718, 5818, 5913, 6003, 6091, 6177, 6264, 6350, 6439, 6528, 6617, 6706, 6796, 6884, 6968, 
-    7050, 7127, 7196, 7258, 7310, 7351, 7379, 7392, 7389, 7368, 7327, 7267, 7186, 7084, 6960, 6812, 
-    6644, 6451, 6238, 6001, 5745, 5467, 5172, 4858, 4530, 4188, 3836, 3473, 3105, 2729, 2351, 1969, 
-    1588, 1205, 826, 450, 79, -284, -642, -990, -1328, -1655, -1970, -2270, -2556, -2827, -3082, -3320, 
-    -3540, -3743, -3927, -4094, -4241, -4371, -4485, -4583, -4665, -4735, -4793, -4839, -4877, -4908, -4933, -4953, 
-    -4971, -4984, -4998, -5008, -5017, -5025, -5032, -5035, -5037, -5036, -5032, -5024, -5009, -4990, -4962, -4927, 
-    -4882, -4829, -4763, -4688, -4602, -4506, -4399, -4285, -4161, -4034, -3902, -3768, -3632, -3501, -3369, -3243, 
-    -3122, -3008, -2898, -2795, -2697, -2604, -2515, -2428, -2341, -2253, -2163, -2068, -1965, -1855, -1736, -1604, 
-    -1463, -1309, -1143, -969, -785, -595, -400, -205, -10, 181, 368, 546, 717, 875, 1020, 1154, 
-    1271, 1374, 1465, 1541, 1602, 1653, 1691, 1720, 1738, 1749, 1753, 1751, 1743, 1731, 1715, 1695, 
-    1673, 1648, 1622, 1595, 1569, 1544, 1522, 1502, 1487, 1477, 1474, 1476, 1484, 1499, 1521, 1550, 
-    1584, 1626, 1671, 1721, 1774, 1830, 1887, 1945, 2000, 2056, 2106, 2155, 2198, 2238, 2273, 2307, 
-    2337, 2366, 2394, 2424, 2454, 2488, 2526, 2568, 2616, 2669, 2728, 2791, 2860, 2931, 3004, 3077, 
-    3148, 3215, 3278, 3332, 3377, 3411, 3435, 3446, 3446, 3433, 3410, 3376, 3334, 3281, 3224, 3158, 
-    3089, 3015, 2941, 2864, 2790, 2716, 2643, 2573, 2505, 2438, 2376, 2314, 2254, 2196, 2139, 2083, 
-    2027, 1970, 1911, 1850, 1786, 1717, 1646, 1568, 1484, 1393, 1295, 1188, 1073, 949, 814, 669, 
-    516, 351, 176, -8, -203, -408, -621, -843, -1073, -1307, -1547, -1791, -2036, -2282, -2528, -2771, 
-    -3013, -3251, -3485, -3716, -3941, -4160, -4372, -4578, -4775, -4965, -5146, -5318, -5483, -5638, -5787, -5929, 
-    -6062, -6189, -6310, -6424, -6532, -6633, -6727, -6814, -6894, -6963, -7025, -7075, -7114, -7139, -7148, -7140, 
-    -7117, -7072, -7009, -6923, -6816, -6687, -6537, -6364, -6172, -5959, -5728, -5482, -5221, -4949, -4667, -4377, 
-    -4084, -3787, -3490, -3192, -2897, -2605, -2316, -2032, -1752, -1477, -1208, -945, -685, -433, -184, 61, 
-    303, 543, 782, 1020, 1259, 1499, 1743, 1992, 2247, 2509, 2782, 3064, 3357, 3663, 3981, 4311, 
-    4651, 5001, 5360, 5724, 6092, 6460, 6825, 7186, 7537, 7877, 8205, 8516, 8810, 9083, 9338, 9569, 
-    9778, 9963, 10125, 10264, 10379, 10470, 10537, 10581, 10602, 10600, 10576, 10529, 10459, 10367, 10252, 10114, 
-    9954, 9772, 9569, 9346, 9103, 8844, 8564, 8269, 7956, 7627, 7282, 6922, 6546, 6156, 5749, 5331, 
-    4899, 4454, 3998, 3532, 3055, 2573, 2083, 1591, 1096, 600, 107, -380, -866, -1342, -1811, -2270, 
-    -2720, -3159, -3589, -4006, -4416, -4814, -5204, -5586, -5960, -6328, -6691, -7045, -7396, -7739, -8075, -8404, 
-    -8723, -9031, -9331, -9616, -9887, -10144, -10383, -10604, -10806, -10988, -11147, -11288, -11405, -11500, -11573, -11624, 
-    -11651, -11657, -11639, -11600, -11538, -11457, -11352, -11227, -11081, -10914, -10725, -10517, -10287, -10037, -9767, -9478, 
-    -9170, -8845, -8502, -8144, -7772, -7385, -6984, -6571, -6146, -5709, -5261, -4803, -4333, -3854, -3365, -2866, 
-    -2358, -1840, -1314, -780, -240, 306, 858, 1414, 1971, 2530, 3087, 3643, 4192, 4736, 5270, 5795, 
-    6305, 6801, 7280, 7741, 8183, 8605, 9005, 9382, 9738, 10069, 10376, 10659, 10919, 11152, 11359, 11542, 
-    11699, 11830, 11935, 12016, 12071, 12103, 12111, 12096, 12059, 12001, 11923, 11823, 11704, 11565, 11407, 11229, 
-    11032, 10815, 10579, 10323, 10048, 9753, 9438, 9105, 8751, 8380, 7992, 7588, 7168, 6737, 6294, 5842, 
-    5383, 4919, 4451, 3981, 3511, 3042, 2574, 2108, 1643, 1180, 718, 258, -201, -660, -1121, -1579, 
-    -2040, -2499, -2957, -3412, -3864, -4310, -4749, -5179, -5599, -6006, -6398, -6774, -7132, -7470, -7788, -8085, 
-    -8360, -8613, -8845, -9056, -9246, -9416, -9568, -9701, -9818, -9917, -10001, -10069, -10121, -10158, -10179, -10183, 
-    -10171, -10140, -10091, -10022, -9933, -9821, -9687, -9530, -9350, -9148, -8922, -8675, -8407, -8119, -7811, -7487, 
-    -7147, -6793, -6427, -6050, -5665, -5273, -4875, -4471, -4066, -3657, -3248, -2838, -2428, -2020, -1614, -1211, 
-    -812, -416, -27, 356, 732, 1103, 1464, 1818, 2164, 2501, 2828, 3149, 3461, 3765, 4060, 4347, 
-    4626, 4897, 5158, 5411, 5655, 5891, 6115, 6331, 6533, 6726, 6903, 7068, 7215, 7348, 7461, 7558, 
-    7635, 7693, 7731, 7751, 7751, 7732, 7695, 7640, 7569, 7479, 7374, 7256, 7123, 6977, 6820, 6651, 
-    6472, 6284, 6086, 5879, 5663, 5440, 5208, 4969, 4722, 4468, 4207, 3940, 3666, 3386, 3100, 2807, 
-    2509, 2204, 1894, 1578, 1257, 932, 604, 273, -57, -388, -717, -1042, -1361, -1672, -1974, -2264, 
-    -2541, -2803, -3049, -3275, -3485, -3674, -3846, -3997, -4129, -4242, -4338, -4415, -4477, -4524, -4557, -4578, 
-    -4589, -4591, -4583, -4570, -4549, -4525, -4495, -4462, -4424, -4384, -4341, -4295, -4245, -4192, -4133, -4070, 
-    -4000, -3923, -3837, -3743, -3638, -3522, -3395, -3256, -3104, -2942, -2769, -2586, -2396, -2199, -1997, -1794, 
-    -1590, -1387, -1188, -993, -805, -623, -448, -282, -126, 24, 164, 300, 428, 551, 670, 787, 
-    899, 1015, 1128, 1244, 1360, 1479, 1598, 1718, 1839, 1961, 2081, 2198, 2314, 2422, 2526, 2619, 
-    2705, 2778, 2840, 2885, 2917, 2932, 2930, 2911, 2876, 2825, 2759, 2678, 2584, 2479, 2365, 2243, 
-    2116, 1982, 1848, 1711, 1575, 1438, 1304, 1173, 1044, 916, 792, 670, 549, 431, 313, 198, 
-    83, -30, -143, -253, -363, -469, -571, -671, -766, -854, -939, -1016, -1087, -1153, -1211, -1263, 
-    -1309, -1347, -1381, -1408, -1430, -1446, -1457, -1463, -1462, -1459, -1450, -1437, -1420, -1400, -1376, -1348, 
-    -1315, -1280, -1239, -1196, -1146, -1094, -1035, -973, -904, -832, -754, -672, -586, -497, -404, -311, 
-    -215, -117, -19, 77, 176, 272, 369, 462, 555, 646, 736, 824, 913, 1001, 1090, 1176, 
-    1265, 1351, 1437, 1519, 1600, 1674, 1745, 1805, 1860, 1904, 1938, 1960, 1973, 1975, 1966, 1947, 
-    1921, 1888, 1847, 1804, 1758, 1710, 1662, 1617, 1572, 1530, 1490, 1452, 1415, 1378, 1340, 1299, 
-    1254, 1202, 1144, 1076, 999, 910, 810, 700, 579, 446, 307, 159, 6, -150, -309, -470, 
-    -628, -785, -937, -1086, -1227, -1362, -1489, -1611, -1724, -1832, -1931, -2026, -2114, -2197, -2275, -2350, 
-    -2420, -2489, -2552, -2613, -2669, -2722, -2765, -2807, -2838, -2865, -2880, -2890, -2887, -2879, -2858, -2828, 
-    -2787, -2736, -2672, -2600, -2516, -2421, -2317, -2205, -2083, -1953, -1817, -1673, -1525, -1371, -1213, -1050, 
-    -886, -718, -549, -377, -205, -31, 141, 314, 487, 657, 827, 994, 1161, 1324, 1485, 1643, 
-    1799, 1948, 2094, 2235, 2371, 2502, 2626, 2744, 2855, 2960, 3057, 3148, 3230, 3305, 3372, 3431, 
-    3481, 3523, 3556, 3580, 3596, 3600, 3597, 3584, 3561, 3529, 3489, 3439, 3381, 3316, 3243, 3164, 
-    3077, 2986, 2889, 2787, 2681, 2569, 2453, 2334, 2210, 2083, 1953, 1819, 1684, 1546, 1406, 1264, 
-    1120, 973, 824, 672, 515, 356, 191, 21, -152, -332, -518, -708, -903, -1102, -1306, -1513, 
-    -1723, -1934, -2146, -2357, -2566, -2771, -2971, -3164, -3349, -3526, -3691, -3847, -3991, -4122, -4241, -4349, 
-    -4442, -4526, -4596, -4654, -4702, -4738, -4761, -4776, -4776, -4766, -4744, -4710, -4663, -4606, -4535, -4454, 
-    -4359, -4253, -4133, -4003, -3856, -3699, -3527, -3342, -3143, -2933, -2710, -2476, -2232, -1980, -1721, -1456, 
-    -1186, -914, -642, -370, -101, 162, 421, 672, 915, 1150, 1375, 1590, 1798, 1998, 2190, 2378, 
-    2561, 2741, 2917, 3091, 3265, 3436, 3604, 3771, 3934, 4095, 4251, 4402, 4546, 4684, 4813, 4934, 
-    5043, 5142, 5228, 5301, 5359, 5405, 5433, 5448, 5447, 5430, 5398, 5351, 5288, 5212, 5122, 5018, 
-    4903, 4776, 4640, 4494, 4342, 4182, 4017, 3846, 3673, 3495, 3315, 3132, 2945, 2754, 2561, 2362, 
-    2157, 1948, 1730, 1505, 1272, 1030, 780, 520, 252, -23, -305, -596, -891, -1190, -1491, -1791, 
-    -2093, -2390, -2684, -2971, -3253, -3525, -3787, -4038, -4278, -4503, -4717, -4915, -5099, -5268, -5424, -5563, 
-    -5688, -5798, -5893, -5973, -6039, -6092, -6131, -6156, -6170, -6171, -6160, -6137, -6102, -6055, -5997, -5925, 
-    -5840, -5741, -5630, -5501, -5360, -5202, -5029, -4840, -4638, -4418, -4186, -3939, -3680, -3408, -3128, -2838, 
-    -2541, -2239, -1933, -1624, -1315, -1006, -699, -397, -96, 198, 488, 772, 1050, 1321, 1587, 1848, 
-    2101, 2350, 2594, 2834, 3069, 3303, 3530, 3755, 3977, 4195, 4407, 4616, 4817, 5014, 5201, 5380, 
-    5547, 5705, 5847, 5978, 6091, 6190, 6270, 6335, 6381, 6410, 6422, 6418, 6397, 6359, 6306, 6238, 
-    6155, 6056, 5943, 5816, 5676, 5523, 5357, 5179, 4990, 4789, 4578, 4357, 4127, 3887, 3639, 3385, 
-    3122, 2852, 2575, 2292, 2003, 1707, 1404, 1097, 785, 465, 142, -184, -516, -851, -1186, -1522, 
-    -1856, -2186, -2510, -2826, -3133, -3428, -3709, -3976, -4227, -4459, -4673, -4868, -5043, -5200, -5338, -5456, 
-    -5559, -5644, -5714, -5769, -5812, -5841, -5861, -5869, -5869, -5858, -5841, -5813, -5778, -5732, -5678, -5612, 
-    -5535, -5446, -5346, -5231, -5105, -4964, -4811, -4645, -4469, -4279, -4081, -3871, -3654, -3428, -3197, -2960, 
-    -2717, -2472, -2223, -1971, -1718, -1463, -1206, -947, -685, -421, -153, 116, 390, 668, 947, 1230, 
-    1512, 1797, 2081, 2365, 2644, 2922, 3191, 3457, 3712, 3960, 4197, 4425, 4639, 4844, 5033, 5211, 
-    5374, 5525, 5659, 5779, 5884, 5974, 6047, 6104, 6144, 6166, 6168, 6154, 6119, 6063, 5987, 5892, 
-    5774, 5638, 5483, 5308, 5117, 4911, 4690, 4458, 4215, 3963, 3704, 3438, 3167, 2893, 2617, 2339, 
-    2060, 1781, 1503, 1223, 945, 668, 393, 117, -154, -426, -694, -961, -1224, -1486, -1742, -1994, 
-    -2239, -2481, -2715, -2942, -3163, -3377, -3582, -3779, -3970, -4152, -4324, -4489, -4645, -4793, -4930, -5059, 
-    -5179, -5288, -5386, -5476, -5554, -5621, -5679, -5724, -5758, -5781, -5791, -5789, -5774, -5745, -5703, -5647, 
-    -5577, -5490, -5390, -5274, -5142, -4995, -4833, -4654, -4459, -4249, -4023, -3783, -3527, -3258, -2974, -2679, 
-    -2370, -2051, -1720, -1383, -1036, -684, -326, 34, 396, 760, 1122, 1481, 1837, 2186, 2530, 2865, 
-    3191, 3507, 3812, 4105, 4386, 4654, 4908, 5149, 5375, 5588, 5785, 5969, 6136, 6289, 6426, 6547, 
-    6652, 6743, 6817, 6874, 6916, 6944, 6952, 6946, 6924, 6885, 6828, 6756, 6666, 6558, 6433, 6291, 
-    6131, 5954, 5760, 5549, 5323, 5082, 4828, 4561, 4283, 3995, 3698, 3396, 3086, 2772, 2457, 2138, 
-    1818, 1499, 1177, 856, 536, 213, -110, -435, -764, -1094, -1428, -1764, -2103, -2443, -2784, -3123, 
-    -3462, -3796, -4123, -4442, -4752, -5047, -5329, -5596, -5843, -6074, -6286, -6478, -6652, -6810, -6950, -7074, 
-    -7185, -7283, -7369, -7445, -7511, -7568, -7616, -7655, -7684, -7701, -7708, -7699, -7674, -7633, -7573, -7490, 
-    -7388, -7259, -7109, -6935, -6736, -6513, -6270, -6002, -5717, -5412, -5091, -4755, -4407, -4047, -3679, -3303, 
-    -2922, -2534, -2143, -1747, -1350, -948, -543, -136, 273, 686, 1100, 1516, 1934, 2351, 2768, 3182, 
-    3593, 3998, 4396, 4784, 5161, 5526, 5876, 6210, 6526, 6825, 7104, 7364, 7603, 7822, 8021, 8200, 
-    8359, 8499, 8621, 8724, 8809, 8877, 8928, 8960, 8974, 8972, 8949, 8908, 8848, 8767, 8665, 8545, 
-    8402, 8238, 8053, 7847, 7620, 7374, 7109, 6824, 6523, 6206, 5875, 5531, 5176, 4809, 4436, 4053, 
-    3665, 3272, 2876, 2473, 2071, 1664, 1257, 847, 437, 23, -387, -803, -1217, -1631, -2044, -2456, 
-    -2864, -3270, -3669, -4062, -4448, -4823, -5189, -5542, -5881, -6205, -6514, -6806, -7080, -7336, -7573, -7792, 
-    -7992, -8174, -8337, -8482, -8608, -8717, -8808, -8883, -8940, -8979, -9002, -9008, -8997, -8970, -8927, -8868, 
-    -8792, -8701, -8594, -8470, -8330, -8176, -8005, -7817, -7614, -7395, -7159, -6907, -6640, -6355, -6056, -5741, 
-    -5410, -5065, -4705, -4332, -3945, -3546, -3135, -2713, -2281, -1841, -1393, -940, -482, -21, 440, 903, 
-    1366, 1826, 2283, 2735, 3182, 3622, 4054, 4479, 4894, 5298, 5691, 6073, 6441, 6796, 7135, 7460, 
-    7767, 8057, 8328, 8579, 8808, 9016, 9199, 9357, 9492, 9598, 9679, 9731, 9756, 9753, 9722, 9663, 
-    9580, 9469, 9335, 9177, 9000, 8800, 8585, 8350, 8101, 7839, 7564, 7276, 6979, 6672, 6354, 6029, 
-    5694, 5350, 4998, 4636, 4265, 3887, 3498, 3102, 2697, 2285, 1866, 1443, 1015, 586, 156, -270, 
-    -694, -1113, -1523, -1926, -2319, -2700, -3069, -3425, -3767, -4097, -4412, -4715, -5005, -5284, -5552, -5810, 
-    -6059, -6300, -6532, -6758, -6973, -7183, -7382, -7573, -7753, -7921, -8076, -8217, -8340, -8448, -8537, -8605, 
-    -8655, -8680, -8685, -8668, -8627, -8563, -8477, -8369, -8239, -8087, -7916, -7724, -7512, -7283, -7037, -6774, 
-    -6495, -6202, -5895, -5575, -5242, -4898, -4543, -4177, -3803, -3419, -3029, -2630, -2226, -1817, -1404, -986, 
-    -568, -146, 273, 693, 1111, 1524, 1933, 2334, 2728, 3112, 3486, 3847, 4197, 4530, 4852, 5156, 
-    5445, 5718, 5974, 6212, 6434, 6635, 6819, 6984, 7129, 7254, 7361, 7446, 7512, 7559, 7586, 7594, 
-    7585, 7558, 7514, 7454, 7379, 7291, 7191, 7078, 6955, 6821, 6678, 6527, 6367, 6200, 6024, 5839, 
-    5646, 5443, 5230, 5007, 4773, 4528, 4273, 4008, 3731, 3447, 3153, 2853, 2546, 2234, 1917, 1598, 
-    1278, 957, 635, 316, -2, -320, -637, -952, -1266, -1580, -1893, -2205, -2517, -2827, -3137, -3445, 
-    -3750, -4051, -4348, -4637, -4918, -5188, -5447, -5690, -5918, -6127, -6318, -6486, -6634, -6757, -6859, -6934, 
-    -6987, -7017, -7023, -7007, -6972, -6914, -6840, -6747, -6638, -6513, -6376, -6224, -6062, -5888, -5703, -5507, 
-    -5302, -5086, -4861, -4626, -4382, -4130, -3870, -3601, -3327, -3046, -2761, -2468, -2176, -1877, -1579, -1278, 
-    -977, -677, -378, -79, 215, 507, 798, 1084, 1366, 1644, 1918, 2188, 2452, 2711, 2963, 3208, 
-    3445, 3674, 3891, 4098, 4291, 4473, 4640, 4794, 4932, 5056, 5164, 5258, 5337, 5401, 5450, 5488, 
-    5511, 5522, 5521, 5509, 5487, 5454, 5410, 5358, 5295, 5222, 5140, 5047, 4944, 4831, 4706, 4572, 
-    4425, 4268, 4100, 3921, 3729, 3529, 3319, 3100, 2872, 2638, 2397, 2152, 1904, 1653, 1400, 1149, 
-    898, 650, 404, 164, -71, -302, -528, -748, -963, -1174, -1382, -1585, -1787, -1988, -2185, -2383, 
-    -2580, -2775, -2969, -3161, -3349, -3534, -3713, -3884, -4047, -4199, -4340, -4465, -4578, -4671, -4748, -4806, 
-    -4845, -4865, -4866, -4849, -4816, -4765, -4701, -4622, -4533, -4432, -4324, -4207, -4085, -3955, -3821, -3683, 
-    -3540, -3391, -3239, -3082, -2921, -2752, -2580, -2401, -2216, -2024, -1826, -1622, -1412, -1195, -973, -748, 
-    -520, -289, -58, 172, 402, 627, 849, 1067, 1277, 1480, 1675, 1861, 2036, 2202, 2358, 2503, 
-    2638, 2764, 2878, 2983, 3080, 3166, 3245, 3315, 3377, 3431, 3479, 3518, 3551, 3575, 3593, 3601, 
-    3603, 3596, 3581, 3557, 3525, 3483, 3433, 3375, 3306, 3230, 3145, 3051, 2950, 2839, 2722, 2596, 
-    2463, 2324, 2179, 2029, 1873, 1712, 1549, 1382, 1211, 1039, 867, 692, 520, 346, 175, 5, 
-    -160, -324, -484, -640, -792, -940, -1083, -1223, -1357, -1488, -1615, -1736, -1854, -1967, -2076, -2179, 
-    -2277, -2371, -2458, -2539, -2613, -2679, -2737, -2789, -2828, -2860, -2882, -2894, -2895, -2887, -2867, -2838, 
-    -2797, -2748, -2688, -2619, -2542, -2456, -2364, -2265, -2160, -2050, -1935, -1816, -1694, -1569, -1442, -1314, 
-    -1182, -1051, -918, -785, -651, -517, -383, -249, -114, 19, 155, 290, 426, 561, 698, 832, 
-    966, 1098, 1228, 1356, 1481, 1602, 1720, 1833, 1942, 2045, 2144, 2235, 2322, 2401, 2474, 2539, 
-    2597, 2647, 2689, 2721, 2747, 2762, 2770, 2768, 2757, 2737, 2708, 2670, 2624, 2569, 2506, 2437, 
-    2359, 2277, 2187, 2092, 1993, 1888, 1781, 1669, 1554, 1434, 1314, 1188, 1059, 926, 788, 647, 
-    499, 347, 191, 29, -137, -307, -482, -659, -839, -1019, -1200, -1380, -1558, -1731, -1903, -2067, 
-    -2225, -2375, -2519, -2651, -2777, -2893, -3000, -3098, -3188, -3269, -3342, -3408, -3465, -3517, -3562, -3599, 
-    -3630, -3655, -3672, -3681, -3683, -3677, -3661, -3635, -3600, -3552, -3493, -3421, -3337, -3239, -3127, -3001, 
-    -2861, -2708, -2542, -2362, -2172, -1971, -1761, -1542, -1317, -1087, -852, -614, -374, -136, 106, 342, 
-    579, 813, 1043, 1269, 1492, 1709, 1924, 2132, 2335, 2533, 2725, 2913, 3094, 3268, 3437, 3599, 
-    3753, 3900, 4040, 4169, 4291, 4402, 4505, 4596, 4678, 4748, 4808, 4857, 4894, 4919, 4934, 4936, 
-    4926, 4904, 4871, 4825, 4767, 4700, 4619, 4528, 4426, 4314, 4192, 4060, 3918, 3769, 3610, 3444, 
-    3271, 3089, 2902, 2709, 2508, 2302, 2093, 1876, 1655, 1430, 1199, 964, 726, 483, 236, -12, 
-    -266, -521, -778, -1037, -1297, -1556, -1816, -2075, -2330, -2583, -2833, -3078, -3318, -3553, -3778, -3999, 
-    -4210, -4413, -4607, -4792, -4966, -5130, -5282, -5424, -5552, -5669, -5774, -5864, -5940, -6002, -6050, -6081, 
-    -6096, -6096, -6079, -6045, -5995, -5928, -5846, -5747, -5635, -5508, -5367, -5214, -5050, -4874, -4690, -4497, 
-    -4294, -4085, -3868, -3644, -3414, -3176, -2933, -2682, -2426, -2163, -1896, -1621, -1340, -1056, -768, -474, 
-    -178, 119, 417, 717, 1014, 1309, 1600, 1887, 2168, 2443, 2710, 2969, 3220, 3464, 3697, 3923, 
-    4139, 4348, 4547, 4739, 4921, 5096, 5260, 5417, 5563, 5700, 5824, 5939, 6039, 6128, 6200, 6260, 
-    6303, 6330, 6341, 6336, 6314, 6277, 6224, 6156, 6074, 5979, 5872, 5754, 5625, 5486, 5341, 5185, 
-    5024, 4855, 4680, 4498, 4311, 4116, 3917, 3708, 3493, 3270, 3040, 2799, 2552, 2294, 2027, 1752, 
-    1468, 1176, 877, 573, 262, -50, -367, -683, -1000, -1313, -1624, -1927, -2225, -2512, -2791, -3057, 
-    -3312, -3554, -3783, -3997, -4198, -4385, -4559, -4719, -4867, -5004, -5129, -5244, -5349, -5445, -5532, -5611, 
-    -5683, -5746, -5799, -5846, -5882, -5910, -5926, -5933, -5927, -5909, -5876, -5830, -5768, -5692, -5598, -5490, 
-    -5364, -5224, -5066, -4896, -4710, -4511, -4300, -4079, -3846, -3606, -3359, -3105, -2846, -2586, -2322, -2057, 
-    -1791, -1527, -1261, -998, -737, -477, -218, 38, 291, 543, 794, 1041, 1286, 1528, 1768, 2004, 
-    2237, 2464, 2688, 2905, 3115, 3319, 3514, 3701, 3878, 4044, 4198, 4341, 4470, 4586, 4687, 4774, 
-    4848, 4906, 4951, 4982, 5000, 5004, 4997, 4978, 4949, 4909, 4860, 4802, 4736, 4663, 4582, 4495, 
-    4400, 4299, 4192, 4077, 3956, 3828, 3693, 3550, 3401, 3245, 3079, 2907, 2729, 2543, 2349, 2152, 
-    1947, 1738, 1524, 1307, 1086, 865, 640, 415, 189, -35, -260, -486, -708, -930, -1150, -1368, 
-    -1582, -1795, -2003, -2208, -2407, -2604, -2791, -2973, -3147, -3313, -3468, -3614, -3746, -3868, -3975, -4068, 
-    -4147, -4210, -4259, -4291, -4308, -4309, -4295, -4266, -4221, -4165, -4095, -4013, -3921, -3819, -3706, -3588, 
-    -3460, -3326, -3185, -3040, -2888, -2732, -2569, -2404, -2232, -2056, -1874, -1689, -1499, -1304, -1107, -905, 
-    -700, -494, -285, -77, 131, 339, 544, 746, 946, 1139, 1328, 1510, 1687, 1856, 2020, 2174, 
-    2322, 2462, 2594, 2719, 2835, 2944, 3043, 3137, 3220, 3297, 3363, 3423, 3473, 3514, 3546, 3570, 
-    3582, 3585, 3579, 3562, 3534, 3495, 3446, 3387, 3315, 3234, 3144, 3043, 2933, 2815, 2689, 2557, 
-    2417, 2273, 2124, 1969, 1813, 1655, 1494, 1332, 1169, 1006, 843, 678, 513, 348, 182, 13, 
-    -155, -327, -500, -675, -852, -1030, -1209, -1388, -1566, -1745, -1922, -2096, -2266, -2435, -2596, -2753, 
-    -2904, -3047, -3181, -3309, -3427, -3536, -3635, -3726, -3804, -3875, -3934, -3982, -4020, -4050, -4067, -4075, 
-    -4072, -4060, -4036, -4001, -3957, -3901, -3834, -3756, -3669, -3570, -3460, -3340, -3208, -3067, -2916, -2754, 
-    -2583, -2405, -2217, -2021, -1820, -1610, -1395, -1175, -949, -720, -487, -252, -13, 225, 467, 707, 
-    951, 1192, 1433, 1671, 1909, 2141, 2373, 2599, 2821, 3035, 3245, 3445, 3637, 3819, 3992, 4151, 
-    4301, 4435, 4558, 4665, 4759, 4838, 4904, 4954, 4992, 5016, 5027, 5027, 5017, 4995, 4965, 4926, 
-    4880, 4826, 4767, 4698, 4626, 4545, 4458, 4362, 4259, 4146, 4025, 3894, 3751, 3599, 3435, 3259, 
-    3072, 2875, 2665, 2448, 2219, 1983, 1739, 1490, 1235, 980, 722, 463, 206, -48, -300, -547, 
-    -791, -1029, -1263, -1490, -1713, -1931, -2145, -2354, -2560, -2763, -2962, -3159, -3353, -3546, -3736, -3924, 
-    -4108, -4290, -4466, -4636, -4801, -4958, -5104, -5243, -5368, -5481, -5582, -5666, -5737, -5791, -5827, -5847, 
-    -5851, -5836, -5806, -5758, -5695, -5618, -5525, -5419, -5302, -5172, -5031, -4881, -4720, -4552, -4374, -4188, 
-    -3995, -3794, -3584, -3367, -3142, -2909, -2669, -2422, -2167, -1907, -1639, -1368, -1091, -810, -526, -241, 
-    45, 332, 617, 899, 1180, 1455, 1726, 1990, 2250, 2499, 2744, 2979, 3207, 3426, 3637, 3839, 
-    4033, 4217, 4394, 4560, 4719, 4867, 5007, 5136, 5255, 5363, 5462, 5549, 5625, 5688, 5741, 5780, 
-    5807, 5820, 5821, 5808, 5783, 5743, 5692, 5628, 5553, 5465, 5367, 5257, 5139, 5010, 4872, 4726, 
-    4571, 4406, 4236, 4056, 3870, 3674, 3473, 3264, 3048, 2826, 2598, 2363, 2126, 1881, 1635, 1385, 
-    1133, 880, 627, 372, 120, -130, -380, -629, -873, -1115, -1354, -1590, -1821, -2051, -2275, -2496, 
-    -2712, -2924, -3129, -3331, -3525, -3712, -3892, -4063, -4226, -4377, -4518, -4649, -4766, -4870, -4960, -5038, 
-    -5100, -5149, -5183, -5204, -5209, -5202, -5181, -5149, -5103, -5047, -4979, -4902, -4815, -4720, -4614, -4503, 
-    -4383, -4256, -4122, -3981, -3832, -3678, -3516, -3348, -3172, -2991, -2802, -2608, -2407, -2202, -1992, -1776, 
-    -1557, -1336, -1111, -885, -661, -435, -212, 8, 225, 440, 647, 850, 1046, 1236, 1418, 1592, 
-    1758, 1916, 2066, 2207, 2339, 2463, 2581, 2688, 2789, 2884, 2970, 3051, 3126, 3195, 3258, 3316, 
-    3369, 3418, 3461, 3500, 3534, 3563, 3585, 3602, 3613, 3616, 3612, 3601, 3580, 3549, 3510, 3461, 
-    3401, 3332, 3253, 3164, 3066, 2960, 2845, 2722, 2594, 2458, 2319, 2174, 2027, 1876, 1724, 1569, 
-    1413, 1258, 1101, 944, 787, 632, 477, 321, 168, 16, -135, -284, -431, -575, -716, -854, 
-    -987, -1116, -1240, -1358, -1470, -1575, -1674, -1765, -1848, -1923, -1990, -2049, -2099, -2139, -2171, -2194, 
-    -2209, -2213, -2209, -2198, -2177, -2148, -2112, -2069, -2020, -1964, -1904, -1838, -1768, -1694, -1617, -1536, 
-    -1453, -1365, -1276, -1183, -1089, -990, -891, -786, -684, -575, -467, -356, -247, -135, -25, 85, 
-    192, 298, 401, 501, 596, 688, 774, 856, 933, 1007, 1075, 1140, 1201, 1258, 1313, 1365, 
-    1413, 1460, 1504, 1543, 1581, 1615, 1644, 1668, 1687, 1702, 1708, 1707, 1699, 1684, 1658, 1627, 
-    1585, 1537, 1480, 1416, 1343, 1265, 1179, 1087, 989, 886, 777, 662, 544, 421, 293, 163, 
-    29, -108, -246, -388, -530, -670, -813, -951, -1089, -1222, -1351, -1475, -1595, -1706, -1813, -1912, 
-    -2005, -2090, -2168, -2240, -2305, -2364, -2416, -2465, -2506, -2543, -2575, -2602, -2624, -2642, -2652, -2660, 
-    -2661, -2657, -2646, -2630, -2607, -2578, -2541, -2498, -2448, -2390, -2326, -2256, -2178, -2094, -2005, -1910, 
-    -1810, -1704, -1594, -1479, -1360, -1237, -1109, -977, -843, -705, -562, -417, -268, -115, 39, 197, 
-    360, 523, 690, 858, 1028, 1200, 1372, 1544, 1716, 1888, 2057, 2224, 2389, 2550, 2706, 2860, 
-    3007, 3149, 3285, 3415, 3537, 3652, 3760, 3860, 3950, 4032, 4105, 4169, 4223, 4268, 4302, 4327, 
-    4341, 4345, 4337, 4319, 4290, 4250, 4198, 4135, 4062, 3978, 3884, 3780, 3667, 3546, 3416, 3279, 
-    3135, 2986, 2831, 2673, 2509, 2345, 2175, 2005, 1832, 1657, 1480, 1303, 1121, 939, 753, 566, 
-    375, 181, -15, -216, -419, -626, -834, -1045, -1256, -1467, -1679, -1887, -2094, -2296, -2495, -2687, 
-    -2874, -3054, -3227, -3392, -3550, -3701, -3843, -3976, -4103, -4222, -4331, -4435, -4529, -4615, -4694, -4763, 
-    -4824, -4875, -4917, -4945, -4966, -4973, -4968, -4950, -4922, -4877, -4821, -4751, -4670, -4575, -4469, -4351, 
-    -4223, -4085, -3938, -3782, -3619, -3450, -3274, -3093, -2906, -2715, -2519, -2321, -2118, -1911, -1702, -1488, 
-    -1274, -1055, -833, -612, -386, -160, 65, 292, 519, 744, 968, 1188, 1405, 1618, 1826, 2028, 
-    2226, 2415, 2599, 2774, 2941, 3101, 3252, 3394, 3527, 3652, 3768, 3874, 3972, 4060, 4140, 4212, 
-    4275, 4330, 4377, 4416, 4446, 4469, 4484, 4491, 4491, 4483, 4466, 4442, 4409, 4368, 4319, 4259, 
-    4192, 4115, 4029, 3933, 3828, 3713, 3589, 3455, 3313, 3161, 3001, 2832, 2656, 2473, 2282, 2086, 
-    1883, 1675, 1464, 1250, 1031, 811, 591, 371, 151, -66, -282, -494, -702, -907, -1107, -1301, 
-    -1490, -1675, -1851, -2023, -2188, -2348, -2500, -2646, -2783, -2916, -3038, -3153, -3261, -3359, -3446, -3525, 
-    -3593, -3649, -3694, -3727, -3748, -3756, -3754, -3738, -3711, -3672, -3623, -3562, -3494, -3414, -3327, -3233, 
-    -3131, -3023, -2910, -2791, -2668, -2542, -2411, -2277, -2140, -2001, -1857, -1713, -1565, -1415, -1263, -1110, 
-    -953, -797, -639, -481, -321, -163, -5, 150, 306, 458, 609, 757, 902, 1044, 1182, 1317, 
-    1448, 1575, 1699, 1817, 1933, 2045, 2151, 2253, 2353, 2445, 2533, 2616, 2692, 2762, 2825, 2882, 
-    2928, 2967, 2997, 3017, 3027, 3028, 3017, 2997, 2967, 2925, 2874, 2814, 2744, 2665, 2577, 2481, 
-    2378, 2267, 2148, 2024, 1893, 1757, 1614, 1467, 1314, 1156, 995, 829, 659, 485, 310, 131, 
-    -48, -229, -410, -592, -771, -948, -1123, -1294, -1460, -1620, -1775, -1922, -2063, -2196, -2321, -2439, 
-    -2549, -2648, -2743, -2828, -2905, -2975, -3039, -3093, -3142, -3183, -3219, -3246, -3268, -3281, -3289, -3288, 
-    -3280, -3263, -3239, -3204, -3162, -3109, -3047, -2975, -2893, -2801, -2700, -2589, -2471, -2343, -2209, -2068, 
-    -1921, -1769, -1613, -1455, -1293, -1128, -964, -798, -631, -465, -297, -130, 36, 204, 374, 543, 
-    715, 888, 1064, 1240, 1419, 1599, 1782, 1965, 2149, 2332, 2516, 2695, 2874, 3048, 3218, 3381, 
-    3538, 3687, 3828, 3959, 4080, 4190, 4289, 4375, 4451, 4513, 4564, 4602, 4629, 4642, 4645, 4635, 
-    4613, 4580, 4536, 4479, 4412, 4335, 4246, 4147, 4038, 3919, 3790, 3651, 3504, 3347, 3182, 3009, 
-    2826, 2636, 2439, 2234, 2021, 1803, 1577, 1345, 1107, 866, 618, 367, 112, -143, -401, -661, 
-    -920, -1177, -1432, -1683, -1930, -2171, -2403, -2629, -2847, -3054, -3252, -3441, -3619, -3786, -3943, -4091, 
-    -4229, -4359, -4480, -4593, -4698, -4796, -4886, -4970, -5046, -5115, -5176, -5228, -5273, -5309, -5335, -5351, 
-    -5357, -5352, -5336, -5307, -5266, -5215, -5148, -5071, -4982, -4879, -4765, -4639, -4502, -4354, -4195, -4026, 
-    -3848, -3659, -3463, -3258, -3044, -2824, -2596, -2362, -2121, -1875, -1623, -1367, -1106, -840, -573, -301, 
-    -29, 246, 521, 798, 1074, 1349, 1623, 1895, 2163, 2427, 2687, 2941, 3188, 3429, 3661, 3883, 
-    4096, 4298, 4490, 4668, 4836, 4990, 5131, 5260, 5375, 5477, 5566, 5643, 5706, 5759, 5798, 5827, 
-    5845, 5853, 5849, 5835, 5813, 5779, 5737, 5685, 5622, 5551, 5469, 5376, 5274, 5161, 5038, 4904, 
-    4758, 4602, 4434, 4256, 4067, 3867, 3656, 3436, 3205, 2966, 2718, 2464, 2201, 1934, 1660, 1384, 
-    1103, 822, 539, 257, -23, -303, -580, -851, -1121, -1384, -1643, -1896, -2144, -2385, -2621, -2851, 
-    -3074, -3291, -3503, -3708, -3905, -4097, -4280, -4455, -4621, -4779, -4925, -5061, -5185, -5297, -5394, -5480, 
-    -5550, -5606, -5646, -5672, -5683, -5679, -5660, -5627, -5581, -5522, -5451, -5367, -5274, -5170, -5056, -4934, 
-    -4804, -4665, -4519, -4366, -4206, -4040, -3867, -3688, -3505, -3314, -3117, -2916, -2709, -2498, -2281, -2062, 
-    -1836, -1609, -1379, -1146, -909, -672, -433, -194, 46, 287, 527, 766, 1004, 1240, 1474, 1704, 
-    1931, 2153, 2371, 2582, 2787, 2983, 3173, 3353, 3523, 3682, 3831, 3968, 4094, 4207, 4308, 4396, 
-    4472, 4537, 4589, 4629, 4658, 4678, 4686, 4685, 4673, 4654, 4624, 4587, 4541, 4487, 4423, 4353, 
-    4273, 4184, 4086, 3980, 3865, 3740, 3606, 3464, 3314, 3155, 2987, 2814, 2635, 2448, 2258, 2064, 
-    1866, 1666, 1465, 1262, 1061, 860, 660, 462, 266, 73, -118, -306, -491, -674, -853, -1031, 
-    -1204, -1374, -1542, -1704, -1864, -2020, -2171, -2318, -2459, -2593, -2723, -2844, -2959, -3065, -3163, -3251, 
-    -3330, -3398, -3458, -3506, -3543, -3570, -3586, -3592, -3588, -3574, -3549, -3518, -3474, -3423, -3364, -3299, 
-    -3223, -3141, -3052, -2957, -2853, -2746, -2629, -2508, -2380, -2247, -2107, -1963, -1812, -1659, -1499, -1336, 
-    -1170, -1000, -829, -656, -482, -307, -133, 40, 211, 381, 548, 712, 872, 1029, 1179, 1327, 
-    1467, 1602, 1731, 1853, 1968, 2076, 2177, 2270, 2355, 2432, 2502, 2562, 2615, 2659, 2695, 2724, 
-    2743, 2756, 2761, 2760, 2750, 2735, 2713, 2686, 2652, 2615, 2570, 2522, 2468, 2409, 2345, 2276, 
-    2201, 2121, 2034, 1943, 1845, 1740, 1631, 1515, 1393, 1265, 1130, 992, 847, 699, 547, 393, 
-    235, 78, -80, -238, -395, -550, -703, -853, -998, -1141, -1278, -1412, -1540, -1664, -1782, -1897, 
-    -2006, -2111, -2210, -2305, -2395, -2480, -2560, -2634, -2704, -2766, -2823, -2873, -2914, -2948, -2975, -2991, 
-    -3000, -2998, -2989, -2969, -2940, -2901, -2854, -2798, -2733, -2660, -2580, -2491, -2396, -2293, -2186, -2071, 
-    -1953, -1828, -1700, -1566, -1430, -1290, -1146, -999, -850, -698, -544, -387, -228, -67, 94, 257, 
-    423, 588, 754, 921, 1088, 1253, 1417, 1581, 1742, 1901, 2057, 2210, 2358, 2502, 2640, 2773, 
-    2899, 3019, 3131, 3235, 3332, 3421, 3501, 3572, 3635, 3689, 3733, 3769, 3797, 3815, 3824, 3825, 
-    3818, 3800, 3776, 3742, 3702, 3651, 3593, 3528, 3454, 3369, 3280, 3181, 3074, 2959, 2837, 2706, 
-    2569, 2424, 2273, 2116, 1952, 1783, 1609, 1431, 1249, 1063, 874, 685, 493, 300, 107, -84, 
-    -275, -465, -653, -839, -1022, -1202, -1379, -1554, -1723, -1891, -2054, -2214, -2369, -2521, -2669, -2813, 
-    -2952, -3087, -3217, -3341, -3460, -3572, -3676, -3775, -3865, -3947, -4020, -4084, -4138, -4182, -4216, -4240, 
-    -4254, -4258, -4251, -4234, -4208, -4172, -4127, -4072, -4010, -3938, -3858, -3770, -3674, -3570, -3457, -3339, 
-    -3211, -3078, -2936, -2789, -2634, -2474, -2308, -2138, -1961, -1781, -1597, -1410, -1220, -1028, -835, -640, 
-    -447, -252, -58, 134, 325, 516, 705, 891, 1075, 1259, 1438, 1615, 1789, 1960, 2128, 2290, 
-    2449, 2601, 2750, 2890, 3024, 3152, 3271, 3381, 3483, 3576, 3660, 3734, 3799, 3855, 3901, 3939, 
-    3969, 3991, 4004, 4010, 4009, 4001, 3986, 3964, 3937, 3902, 3859, 3811, 3755, 3691, 3620, 3539, 
-    3451, 3355, 3249, 3135, 3012, 2880, 2741, 2593, 2440, 2279, 2114, 1943, 1769, 1592, 1413, 1233, 
-    1052, 872, 693, 516, 340, 167, -1, -169, -334, -495, -654, -809, -961, -1110, -1256, -1399, 
-    -1538, -1673, -1805, -1932, -2055, -2173, -2286, -2393, -2495, -2589, -2678, -2759, -2833, -2900, -2959, -3011, 
-    -3054, -3090, -3118, -3138, -3150, -3155, -3152, -3143, -3126, -3102, -3071, -3034, -2991, -2942, -2887, -2827, 
-    -2761, -2689, -2613, -2532, -2447, -2356, -2262, -2163, -2061, -1955, -1846, -1733, -1618, -1499, -1379, -1256, 
-    -1131, -1004, -877, -748, -617, -486, -356, -225, -94, 35, 165, 293, 419, 545, 667, 786, 
-    903, 1016, 1125, 1229, 1328, 1424, 1513, 1596, 1675, 1747, 1812, 1871, 1924, 1971, 2011, 2045, 
-    2074, 2096, 2112, 2122, 2127, 2127, 2122, 2110, 2095, 2074, 2049, 2018, 1983, 1943, 1898, 1847, 
-    1794, 1734, 1671, 1603, 1532, 1456, 1378, 1296, 1213, 1124, 1037, 946, 856, 764, 672, 580, 
-    488, 398, 309, 220, 132, 48, -35, -117, -197, -275, -351, -425, -497, -566, -634, -699, 
-    -762, -823, -880, -935, -988, -1038, -1084, -1128, -1168, -1205, -1238, -1268, -1293, -1316, -1333, -1346, 
-    -1355, -1361, -1360, -1356, -1347, -1334, -1316, -1294, -1267, -1236, -1201, -1161, -1117, -1069, -1017, -962, 
-    -902, -840, -774, -705, -633, -559, -483, -405, -324, -242, -159, -76, 8, 94, 178, 265, 
-    350, 436, 518, 603, 684, 764, 843, 921, 993, 1067, 1135, 1202, 1266, 1326, 1382, 1435, 
-    1483, 1527, 1568, 1602, 1633, 1659, 1679, 1695, 1705, 1709, 1707, 1701, 1687, 1667, 1640, 1608, 
-    1568, 1523, 1471, 1412, 1348, 1278, 1202, 1121, 1035, 944, 850, 753, 651, 548, 443, 336, 
-    227, 118, 9, -100, -208, -317, -423, -529, -632, -735, -834, -931, -1025, -1117, -1204, -1288, 
-    -1369, -1444, -1517, -1585, -1648, -1706, -1761, -1810, -1855, -1895, -1932, -1963, -1990, -2014, -2034, -2048, 
-    -2060, -2068, -2071, -2072, -2069, -2063, -2053, -2039, -2023, -2003, -1978, -1951, -1919, -1883, -1843, -1800, 
-    -1751, -1698, -1641, -1578, -1511, -1440, -1362, -1281, -1195, -1103, -1006, -906, -800, -690, -576, -459, 
-    -338, -213, -87, 41, 171, 303, 434, 567, 699, 829, 959, 1087, 1211, 1333, 1453, 1568, 
-    1679, 1786, 1890, 1988, 2082, 2171, 2255, 2334, 2409, 2477, 2540, 2597, 2650, 2695, 2734, 2767, 
-    2792, 2810, 2820, 2824, 2818, 2805, 2783, 2754, 2716, 2670, 2617, 2556, 2488, 2414, 2334, 2248, 
-    2158, 2061, 1963, 1860, 1756, 1647, 1538, 1426, 1314, 1199, 1084, 968, 851, 732, 613, 494, 
-    374, 252, 131, 10, -112, -233, -355, -475, -596, -714, -831, -946, -1060, -1170, -1278, -1383, 
-    -1486, -1585, -1681, -1773, -1864, -1949, -2033, -2113, -2190, -2263, -2334, -2401, -2464, -2522, -2577, -2628, 
-    -2674, -2715, -2750, -2780, -2804, -2821, -2832, -2837, -2834, -2823, -2806, -2782, -2749, -2710, -2663, -2609, 
-    -2548, -2481, -2407, -2325, -2239, -2146, -2048, -1944, -1836, -1722, -1606, -1484, -1358, -1229, -1098, -962, 
-    -825, -684, -544, -400, -257, -112, 30, 175, 317, 458, 595, 733, 866, 996, 1122, 1244, 
-    1362, 1477, 1587, 1691, 1792, 1889, 1979, 2067, 2149, 2227, 2300, 2368, 2431, 2489, 2540, 2587, 
-    2627, 2661, 2690, 2710, 2725, 2732, 2733, 2725, 2712, 2691, 2664, 2629, 2588, 2541, 2488, 2429, 
-    2365, 2296, 2222, 2143, 2062, 1975, 1884, 1793, 1696, 1596, 1496, 1392, 1287, 1178, 1070, 959, 
-    848, 734, 621, 507, 391, 276, 160, 44, -71, -187, -302, -417, -530, -642, -754, -863, 
-    -972, -1078, -1183, -1284, -1384, -1481, -1576, -1666, -1754, -1839, -1920, -1996, -2069, -2137, -2202, -2260, 
-    -2313, -2363, -2405, -2442, -2473, -2499, -2517, -2530, -2535, -2535, -2527, -2514, -2492, -2466, -2434, -2394, 
-    -2349, -2298, -2241, -2177, -2110, -2036, -1958, -1874, -1785, -1692, -1595, -1493, -1387, -1278, -1164, -1048, 
-    -929, -807, -683, -557, -429, -301, -171, -40, 90, 220, 351, 480, 608, 735, 860, 982, 
-    1103, 1220, 1334, 1444, 1550, 1651, 1748, 1840, 1927, 2008, 2083, 2151, 2215, 2271, 2321, 2365, 
-    2402, 2433, 2456, 2474, 2485, 2489, 2487, 2479, 2464, 2444, 2417, 2384, 2345, 2301, 2250, 2193, 
-    2132, 2065, 1992, 1914, 1834, 1746, 1657, 1562, 1465, 1365, 1263, 1157, 1051, 944, 835, 727, 
-    617, 508, 399, 289, 181, 74, -34, -140, -246, -352, -458, -561, -665, -767, -869, -969, 
-    -1068, -1165, -1261, -1353, -1443, -1532, -1616, -1698, -1775, -1850, -1918, -1985, -2045, -2101, -2151, -2198, 
-    -2237, -2272, -2302, -2325, -2342, -2353, -2359, -2357, -2350, -2337, -2318, -2293, -2262, -2226, -2182, -2135, 
-    -2081, -2024, -1959, -1892, -1820, -1743, -1662, -1579, -1490, -1400, -1305, -1210, -1109, -1009, -904, -800, 
-    -693, -586, -477, -368, -258, -148, -38, 70, 179, 286, 393, 498, 601, 702, 802, 898, 
-    992, 1083, 1172, 1257, 1340, 1420, 1496, 1568, 1639, 1704, 1767, 1824, 1881, 1930, 1979, 2020, 
-    2059, 2092, 2122, 2146, 2166, 2179, 2189, 2192, 2191, 2184, 2172, 2154, 2133, 2102, 2069, 2030, 
-    1987, 1936, 1883, 1823, 1761, 1692, 1622, 1545, 1469, 1386, 1303, 1214, 1129, 1034, 948, 849, 
-    762, 660, 575, 466, 392, 
-};
-const unsigned int drum_v0_p3_long_len = 8805;
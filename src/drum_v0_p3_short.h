@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v0_p3_short[] PROGMEM = {
-    46, -13, 19, 10, 25, 18, 25, 15, 18, 7, 6, -4, -7, -19, -25, -36, 
-    -43, -56, -64, -77, -86, -100, -111, -126, -138, -154, -167, -184, -197, -214, -228, -246, 
-    -259, -276, -290, -306, -319, -334, -346, -361, -372, -385, -396, -408, -418, -430, -440, -450, 
-    -460, -470, -479, -490, -499, -509, -518, -529, -538, -548, -558, -569, -578, -588, -597, -607, 
-    -615, -624, -631, -639, -645, -651, -655, -659, -662, -663, -664, -665, -663, -661, -658, -654, 
-    -649, -644, -637, -630, -622, -614, -604, -594, -582, -572, -559, -547, -531, -517, -501, -485, 
-    -466, -448, -430, -409, -388, -368, -346, -324, -302, -279, -256, -234, -211, -187, -166, -143, 
-    -120, -98, -76, -54, -32, -11, 8, 30, 51, 70, 90, 110, 129, 148, 168, 186, 
-    206, 225, 244, 263, 283, 303, 322, 342, 362, 381, 402, 421, 440, 459, 478, 495, 
-    513, 529, 544, 559, 573, 586, 598, 609, 619, 629, 637, 646, 653, 661, 667, 673, 
-    679, 685, 688, 693, 696, 699, 700, 701, 701, 700, 696, 692, 686, 679, 670, 660, 
-    648, 635, 619, 604, 586, 567, 548, 527, 505, 484, 461, 437, 413, 389, 364, 338, 
-    311, 285, 256, 228, 197, 166, 134, 100, 65, 30, -7, -45, -83, -122, -163, -203, 
-    -244, -285, -325, -366, -407, -447, -487, -526, -564, -601, -638, -673, -707, -740, -772, -802, 
-    -831, -859, -885, -910, -933, -956, -977, -996, -1014, -1031, -1046, -1060, -1071, -1082, -1090, -1097, 
-    -1102, -1106, -1106, -1106, -1102, -1096, -1090, -1079, -1067, -1053, -1035, -1016, -994, -970, -944, -916, 
-    -885, -852, -818, -782, -743, -703, -660, -617, -571, -524, -475, -425, -373, -321, -265, -210, 
-    -152, -95, -35, 24, 86, 146, 210, 272, 337, 401, 465, 530, 595, 659, 724, 789, 
-    852, 916, 979, 1041, 1102, 1162, 1220, 1277, 1332, 1386, 1437, 1485, 1532, 1577, 1618, 1657, 
-    1694, 1726, 1757, 1784, 1808, 1828, 1846, 1860, 1870, 1876, 1880, 1878, 1874, 1865, 1852, 1835, 
-    1814, 1788, 1758, 1725, 1685, 1643, 1597, 1546, 1491, 1433, 1370, 1304, 1234, 1161, 1083, 1004, 
-    920, 834, 744, 653, 559, 461, 362, 260, 157, 51, -55, -165, -275, -387, -501, -616, 
-    -731, -847, -965, -1081, -1200, -1317, -1435, -1551, -1669, -1783, -1898, -2010, -2122, -2230, -2338, -2443, 
-    -2546, -2647, -2746, -2841, -2936, -3025, -3113, -3198, -3281, -3358, -3434, -3505, -3574, -3637, -3697, -3751, 
-    -3802, -3846, -3886, -3918, -3944, -3963, -3976, -3978, -3976, -3963, -3943, -3912, -3876, -3826, -3770, -3703, 
-    -3627, -3541, -3447, -3341, -3227, -3102, -2970, -2826, -2674, -2511, -2341, -2160, -1972, -1773, -1567, -1352, 
-    -1131, -901, -664, -421, -173, 81, 339, 602, 867, 1136, 1405, 1677, 1947, 2218, 2487, 2755, 
-    3017, 3279, 3534, 3786, 4030, 4271, 4501, 4728, 4944, 5154, 5353, 5545, 5726, 5900, 6062, 6215, 
-    6357, 6490, 6611, 6724, 6824, 6916, 6995, 7067, 7126, 7176, 7215, 7245, 7264, 7275, 7274, 7264, 
-    7246, 7218, 7180, 7134, 7079, 7015, 6942, 6862, 6772, 6675, 6568, 6453, 6330, 6199, 6056, 5908, 
-    5748, 5579, 5399, 5210, 5008, 4797, 4570, 4334, 4083, 3819, 3540, 3250, 2941, 2621, 2284, 1934, 
-    1568, 1189, 795, 389, -31, -462, -907, -1361, -1828, -2302, -2787, -3276, -3776, -4277, -4787, -5295, 
-    -5807, -6318, -6829, -7334, -7838, -8331, -8819, -9292, -9757, -10203, -10637, -11048, -11442, -11811, -12160, -12481, 
-    -12778, -13045, -13288, -13498, -13682, -13835, -13961, -14057, -14126, -14167, -14185, -14175, -14146, -14092, -14023, -13931, 
-    -13828, -13707, -13575, -13429, -13276, -13107, -12934, -12745, -12549, -12338, -12117, -11877, -11625, -11349, -11058, -10742, 
-    -10406, -10042, -9661, -9249, -8823, -8372, -7910, -7429, -6947, -6454, -5968, -5480, -5009, -4542, -4098, -3660, 
-    -3245, -2833, -2435, -2029, -1626, -1194, -746, -250, 287, 895, 1560, 2314, 3141, 4068, 5072, 6200, 
-    7373, 8636, 9927, 11279, 12621, 13998, 15309, 16642, 17868, 19137, 19585, 19518, 19555, 19531, 19549, 19535, 
-    19546, 19538, 19544, 19539, 19544, 19540, 19542, 19541, 19542, 19542, 19541, 19541, 19540, 19542, 19539, 19542, 
-    19538, 19544, 19538, 19545, 19538, 19546, 19535, 19549, 19532, 19553, 19526, 19562, 19507, 19610, 18694, 17052, 
-    15567, 13976, 12455, 10890, 9406, 7904, 6483, 5098, 3824, 2596, 1491, 459, -455, -1327, -2125, -2914, 
-    -3655, -4394, -5118, -5879, -6637, -7432, -8225, -9073, -9961, -10915, -11879, -12886, -13889, -14918, -15917, -16946, 
-    -17921, -18932, -19559, -19576, -19581, -19577, -19580, -19577, -19578, -19578, -19578, -19578, -19577, -19578, -19577, -19579, 
-    -19577, -19578, -19577, -19580, -19577, -19579, -19578, -19579, -19577, -19579, -19578, -19578, -19578, -19578, -19576, -19578, 
-    -19577, -19578, -19578, -19579, -19578, -19579, -19578, -19578, -19579, -19578, -19578, -19578, -19579, -19576, -19580, -19576, 
-    -19580, -19581, -19499, -18115, -16415, -14767, -13044, -11346, -9624, -7950, -6294, -4708, -3149, -1650, -172, 1248, 
-    2642, 3981, 5301, 6579, 7844, 9062, 10268, 11430, 12591, 13719, 14863, 15985, 17136, 18261, 19381, 19571, 
-    19528, 19549, 19536, 19545, 19538, 19543, 19540, 19542, 19540, 19542, 19541, 19542, 19540, 19542, 19541, 19541, 
-    19541, 19542, 19541, 19541, 19542, 19542, 19541, 19541, 19542, 19541, 19541, 19541, 19541, 19541, 19541, 19541, 
-    19541, 19542, 19541, 19541, 19541, 19542, 19541, 19541, 19540, 19542, 19541, 19542, 19540, 19543, 19540, 19543, 
-    19539, 19544, 19539, 19544, 19544, 19465, 18133, 16250, 14423, 12515, 10625, 8693, 6763, 4795, 2841, 873, 
-    -1061, -2991, -4872, -6722, -8508, -10249, -11913, -13526, -15060, -16546, -17969, -19281, -19604, -19569, -19584, -19574, 
-    -19581, -19577, -19579, -19577, -19579, -19578, -19579, -19578, -19578, -19578, -19578, -19578, -19578, -19578, -19578, -19579, 
-    -19578, -19578, -19578, -19578, -19577, -19578, -19578, -19579, -19578, -19578, -19578, -19578, -19578, -19577, -19579, -19578, 
-    -19578, -19577, -19580, -19578, -19579, -19578, -19580, -19577, -19579, -19576, -19580, -19575, -19581, -19574, -19582, -19573, 
-    -19585, -19570, -19589, -19563, -19600, -19543, -19651, -18455, -15846, -13345, -10703, -8142, -5503, -2948, -355, 2133, 
-    4639, 7033, 9437, 11707, 13992, 16103, 18296, 19534, 19530, 19550, 19536, 19545, 19539, 19542, 19541, 19541, 
-    19542, 19541, 19542, 19540, 19543, 19540, 19543, 19539, 19543, 19540, 19543, 19540, 19543, 19539, 19544, 19539, 
-    19544, 19539, 19544, 19538, 19545, 19538, 19545, 19538, 19545, 19538, 19546, 19538, 19545, 19537, 19545, 19536, 
-    19546, 19536, 19546, 19536, 19547, 19535, 19548, 19535, 19548, 19533, 19551, 19531, 19553, 19528, 19557, 19524, 
-    19562, 19514, 19578, 19483, 19660, 18237, 15638, 13286, 10723, 8267, 5692, 3203, 642, -1823, -4327, -6723, 
-    -9149, -11448, -13786, -15954, -18238, -19562, -19564, -19589, -19570, -19585, -19573, -19582, -19575, -19581, -19576, -19581, 
-    -19576, -19580, -19577, -19580, -19577, -19579, -19577, -19580, -19577, -19580, -19577, -19580, -19577, -19580, -19577, -19580, 
-    -19576, -19579, -19575, -19579, -19576, -19580, -19577, -19580, -19576, -19580, -19577, -19581, -19575, -19581, -19575, -19580, 
-    -19575, -19580, -19575, -19581, -19574, -19582, -19574, -19582, -19572, -19583, -19572, -19586, -19570, -19587, -19568, -19590, 
-    -19561, -19600, -19545, -19647, -19149, -16982, -14848, -12587, -10341, -8019, -5717, -3377, -1080, 1221, 3457, 5676, 
-    7816, 9934, 11965, 13981, 15889, 17840, 19416, 19544, 19544, 19539, 19544, 19539, 19544, 19539, 19544, 19540, 
-    19543, 19540, 19543, 19539, 19543, 19540, 19543, 19539, 19543, 19539, 19543, 19538, 19543, 19538, 19543, 19539, 
-    19543, 19538, 19544, 19539, 19544, 19539, 19544, 19538, 19544, 19537, 19545, 19537, 19545, 19538, 19545, 19538, 
-    19545, 19537, 19546, 19536, 19547, 19535, 19548, 19533, 19548, 19532, 19552, 19529, 19555, 19526, 19559, 19517, 
-    19573, 19490, 19644, 18805, 16727, 14857, 12819, 10852, 8777, 6736, 4607, 2498, 315, -1852, -4081, -6289, 
-    -8551, -10783, -13063, -15279, -17582, -19385, -19600, -19571, -19581, -19576, -19581, -19575, -19579, -19576, -19579, -19577, 
-    -19579, -19576, -19579, -19577, -19579, -19577, -19578, -19577, -19579, -19578, -19579, -19578, -19579, -19578, -19578, -19578, 
-    -19577, -19578, -19578, -19580, -19577, -19580, -19577, -19579, -19576, -19580, -19576, -19580, -19575, -19581, -19575, -19582, 
-    -19574, -19583, -19573, -19584, -19572, -19585, -19570, -19588, -19567, -19592, -19561, -19602, -19541, -19648, -18562, -16414, 
-    -14372, -12218, -10109, -7937, -5793, -3613, -1463, 690, 2808, 4903, 6958, 8967, 10937, 12836, 14709, 16465, 
-    18273, 19518, 19521, 19558, 19526, 19554, 19530, 19551, 19533, 19550, 19533, 19549, 19534, 19548, 19534, 19547, 
-    19535, 19546, 19535, 19546, 19535, 19546, 19536, 19546, 19537, 19545, 19537, 19546, 19537, 19544, 19537, 19545, 
-    19538, 19545, 19538, 19544, 19538, 19544, 19539, 19544, 19538, 19544, 19539, 19544, 19539, 19543, 19539, 19543, 
-    19540, 19542, 19540, 19543, 19540, 19541, 19542, 19541, 19541, 19544, 19488, 17782, 15651, 13652, 11605, 9635, 
-    7641, 5708, 3748, 1836, -105, -2011, -3954, -5867, -7821, -9745, -11704, -13616, -15554, -17423, -19262, -19614, 
-    -19564, -19586, -19574, -19581, -19577, -19578, -19578, -19578, -19579, -19576, -19581, -19576, -19579, -19576, -19579, -19575, 
-    -19581, -19575, -19581, -19576, -19581, -19575, -19581, -19575, -19582, -19575, -19582, -19574, -19582, -19574, -19582, -19574, 
-    -19583, -19574, -19582, -19574, -19583, -19574, -19583, -19574, -19583, -19573, -19583, -19573, -19584, -19572, -19585, -19571, 
-    -19586, -19571, -19586, -19569, -19589, -19566, -19593, -19560, -19590, -18305, -16492, -14724, -12862, -10988, -9060, -7107, 
-    -5122, -3110, -1080, 981, 3052, 5163, 7270, 9422, 11541, 13716, 15807, 18037, 19495, 19528, 19554, 19531, 
-    19549, 19534, 19548, 19535, 19546, 19536, 19545, 19538, 19544, 19538, 19544, 19538, 19543, 19538, 19543, 19539, 
-    19543, 19539, 19543, 19540, 19542, 19540, 19543, 19540, 19542, 19541, 19541, 19540, 19541, 19541, 19541, 19541, 
-    19541, 19541, 19541, 19541, 19540, 19543, 19537, 19554, 19392, 18429, 17324, 16247, 15169, 14112, 13069, 12050, 
-    11050, 10073, 9114, 8168, 7230, 6293, 5351, 4394, 3414, 2402, 1349, 250, -902, -2106, -3366, -4673, 
-    -6034, -7434, -8880, -10353, -11858, -13378, -14911, -16430, -17959, -19342, -19599, -19569, -19583, -19575, -19581, -19576, 
-    -19581, -19576, -19580, -19576, -19580, -19576, -19580, -19575, -19579, -19575, -19580, -19576, -19580, -19576, -19581, -19576, 
-    -19581, -19576, -19580, -19575, -19581, -19575, -19582, -19573, -19582, -19572, -19584, -19570, -19590, -19560, -19612, -19111, 
-    -17763, -16427, -15055, -13704, -12339, -10993, -9646, -8324, -7011, -5727, -4464, -3233, -2030, -867, 260, 1348, 
-    2394, 3397, 4353, 5266, 6134, 6965, 7759, 8529, 9270, 10002, 10717, 11434, 12144, 12869, 13591, 14340, 
-    15085, 15863, 16627, 17435, 18204, 19053, 19575, 19523, 19554, 19532, 19549, 19534, 19546, 19536, 19545, 19538, 
-    19545, 19538, 19544, 19538, 19545, 19539, 19544, 19539, 19543, 19538, 19544, 19539, 19544, 19539, 19544, 19538, 
-    19546, 19535, 19554, 19410, 18811, 18141, 17425, 16652, 15818, 14920, 13955, 12923, 11830, 10678, 9474, 8224, 
-    6942, 5637, 4323, 3012, 1722, 456, -768, -1949, -3072, -4141, -5146, -6094, -6984, -7825, -8623, -9388, 
-    -10125, -10845, -11554, -12255, -12954, -13652, -14348, -15041, -15732, -16413, -17082, -17730, -18353, -18944, -19466, -19592, 
-    -19572, -19582, -19575, -19580, -19576, -19579, -19576, -19579, -19577, -19580, -19577, -19580, -19578, -19579, -19577, -19580, 
-    -19578, -19579, -19578, -19579, -19580, -19542, -19173, -18711, -18222, -17684, -17102, -16471, -15787, -15052, -14264, -13425, 
-    -12535, -11599, -10619, -9604, -8561, -7498, -6420, -5337, -4252, -3174, -2109, -1062, -34, 967, 1949, 2906, 
-    3843, 4756, 5651, 6526, 7386, 8232, 9064, 9883, 10686, 11471, 12237, 12977, 13690, 14372, 15018, 15626, 
-    16194, 16714, 17190, 17616, 17993, 18321, 18599, 18828, 19013, 19153, 19250, 19308, 19327, 19310, 19257, 19170, 
-    19050, 18901, 18725, 18522, 18294, 18038, 17760, 17456, 17132, 16783, 16419, 16035, 15637, 15222, 14796, 14354, 
-    13902, 13433, 12952, 12453, 11937, 11400, 10845, 10266, 9665, 9041, 8394, 7721, 7023, 6298, 5546, 4767, 
-    3962, 3130, 2276, 1401, 506, -400, -1318, -2243, -3170, -4095, -5011, -5913, -6797, -7655, -8485, -9281, 
-    -10040, -10760, -11439, -12074, -12668, -13220, -13731, -14204, -14643, -15051, -15430, -15783, -16110, -16417, -16699, -16960, 
-    -17196, -17404, -17579, -17721, -17820, -17876, -17882, -17838, -17739, -17587, -17380, -17124, -16822, -16479, -16102, -15695, 
-    -15266, -14822, -14371, -13919, -13473, -13036, -12614, -12205, -11812, -11428, -11054, -10680, -10306, -9918, -9513, -9082, 
-    -8622, -8123, -7586, -7003, -6380, -5713, -5012, -4278, -3518, -2737, -1945, -1144, -345, 445, 1222, 1978, 
-    2706, 3407, 4078, 4719, 5332, 5917, 6475, 7009, 7520, 8011, 8484, 8942, 9387, 9819, 10242, 10655, 
-    11058, 11450, 11829, 12194, 12545, 12881, 13199, 13499, 13776, 14025, 14242, 14423, 14565, 14663, 14715, 14720, 
-    14676, 14584, 14447, 14264, 14041, 13780, 13488, 13167, 12819, 12452, 12067, 11666, 11253, 10833, 10408, 9982, 
-    9558, 9135, 8715, 8299, 7885, 7474, 7067, 6660, 6258, 5858, 5460, 5066, 4678, 4292, 3911, 3535, 
-    3164, 2794, 2427, 2059, 1691, 1321, 948, 571, 192, -193, -583, -979, -1377, -1780, -2184, -2592, 
-    -3000, -3413, -3825, -4239, -4653, -5070, -5486, -5900, -6311, -6718, -7115, -7503, -7878, -8236, -8576, -8893, 
-    -9181, -9443, -9670, -9866, -10026, -10154, -10245, -10305, -10332, -10332, -10302, -10251, -10177, -10086, -9978, -9860, 
-    -9732, -9598, -9459, -9314, -9163, -9008, -8845, -8670, -8481, -8274, -8044, -7791, -7511, -7204, -6874, -6521, 
-    -6149, -5763, -5367, -4966, -4565, -4170, -3786, -3421, -3080, -2766, -2486, -2239, -2031, -1860, -1725, -1624, 
-    -1553, -1506, -1478, -1463, -1452, -1439, -1418, -1383, -1330, -1256, -1159, -1038, -891, -721, -529, -314, 
-    -83, 161, 418, 686, 960, 1238, 1519, 1799, 2077, 2351, 2621, 2885, 3148, 3406, 3665, 3922, 
-    4184, 4445, 4712, 4979, 5247, 5514, 5776, 6031, 6273, 6499, 6702, 6879, 7024, 7135, 7208, 7240, 
-    7232, 7187, 7102, 6985, 6838, 6667, 6478, 6280, 6075, 5874, 5679, 5499, 5337, 5198, 5082, 4994, 
-    4931, 4897, 4885, 4895, 4918, 4953, 4992, 5029, 5057, 5072, 5068, 5041, 4987, 4904, 4788, 4642, 
-    4464, 4259, 4027, 3772, 3498, 3209, 2909, 2604, 2296, 1995, 1702, 1426, 1170, 936, 728, 546, 
-    392, 263, 157, 70, 0, -60, -114, -167, -221, -283, -358, -449, -557, -686, -836, -1006, 
-    -1196, -1402, -1622, -1852, -2084, -2315, -2539, -2749, -2941, -3115, -3264, -3390, -3493, -3571, -3627, -3664, 
-    -3687, -3700, -3707, -3714, -3726, -3748, -3779, -3827, -3889, -3967, -4062, -4174, -4300, -4436, -4580, -4728, 
-    -4876, -5017, -5149, -5267, -5370, -5451, -5511, -5548, -5562, -5555, -5532, -5492, -5442, -5383, -5319, -5255, 
-    -5190, -5129, -5074, -5025, -4984, -4953, -4927, -4910, -4898, -4892, -4888, -4886, -4884, -4879, -4866, -4848, 
-    -4820, -4781, -4729, -4666, -4585, -4487, -4371, -4235, -4078, -3900, -3701, -3480, -3238, -2977, -2698, -2401, 
-    -2086, -1758, -1419, -1071, -716, -359, -2, 349, 694, 1030, 1351, 1659, 1951, 2225, 2484, 2726, 
-    2955, 3172, 3381, 3582, 3779, 3975, 4174, 4373, 4577, 4784, 4994, 5208, 5424, 5640, 5852, 6062, 
-    6267, 6465, 6655, 6836, 7008, 7168, 7318, 7458, 7588, 7709, 7825, 7934, 8038, 8137, 8233, 8324, 
-    8411, 8492, 8565, 8628, 8677, 8707, 8718, 8704, 8667, 8599, 8503, 8371, 8207, 8006, 7772, 7502, 
-    7202, 6871, 6512, 6128, 5721, 5295, 4855, 4402, 3941, 3476, 3010, 2550, 2096, 1651, 1217, 798, 
-    391, 2, -372, -728, -1068, -1388, -1692, -1977, -2244, -2493, -2726, -2942, -3142, -3331, -3509, -3676, 
-    -3835, -3988, -4132, -4271, -4402, -4530, -4650, -4765, -4868, -4968, -5058, -5143, -5218, -5289, -5351, -5410, 
-    -5462, -5515, -5564, -5614, -5664, -5717, -5770, -5830, -5891, -5956, -6024, -6093, -6162, -6230, -6294, -6354, 
-    -6406, -6453, -6489, -6516, -6529, -6531, -6520, -6496, -6460, -6414, -6355, -6288, -6211, -6126, -6034, -5934, 
-    -5830, -5719, -5603, -5482, -5357, -5224, -5084, -4935, -4778, -4609, -4432, -4242, -4041, -3823, -3590, -3339, 
-    -3073, -2789, -2488, -2173, -1845, -1509, -1165, -816, -467, -120, 219, 548, 864, 1161, 1438, 1691, 
-    1920, 2123, 2301, 2451, 2576, 2679, 2759, 2820, 2868, 2902, 2930, 2952, 2977, 3003, 3035, 3075, 
-    3125, 3185, 3256, 3339, 3435, 3538, 3650, 3768, 3890, 4010, 4131, 4248, 4359, 4467, 4568, 4664, 
-    4753, 4836, 4912, 4985, 5053, 5120, 5187, 5257, 5330, 5411, 5499, 5594, 5697, 5809, 5928, 6053, 
-    6182, 6311, 6437, 6558, 6668, 6765, 6844, 6906, 6941, 6955, 6940, 6895, 6821, 6720, 6588, 6430, 
-    6246, 6039, 5809, 5561, 5294, 5015, 4721, 4418, 4107, 3792, 3473, 3153, 2835, 2519, 2210, 1909, 
-    1620, 1342, 1079, 832, 602, 389, 196, 23, -131, -268, -385, -489, -577, -657, -729, -800, 
-    -871, -946, -1029, -1122, -1224, -1342, -1475, -1627, -1795, -1980, -2182, -2400, -2631, -2875, -3128, -3390, 
-    -3658, -3929, -4203, -4478, -4752, -5022, -5290, -5556, -5817, -6073, -6324, -6568, -6806, -7034, -7250, -7453, 
-    -7642, -7813, -7967, -8100, -8213, -8302, -8369, -8414, -8438, -8441, -8425, -8390, -8338, -8268, -8185, -8087, 
-    -7978, -7858, -7727, -7588, -7441, -7286, -7126, -6959, -6789, -6616, -6441, -6266, -6091, -5917, -5746, -5578, 
-    -5412, -5251, -5095, -4945, -4798, -4654, -4515, -4377, -4238, -4098, -3955, -3805, -3645, -3475, -3295, -3099, 
-    -2889, -2663, -2421, -2162, -1884, -1588, -1275, -943, -594, -227, 155, 556, 971, 1403, 1844, 2298, 
-    2762, 3233, 3711, 4192, 4675, 5156, 5633, 6104, 6569, 7022, 7466, 7897, 8315, 8718, 9108, 9483, 
-    9843, 10189, 10523, 10839, 11142, 11431, 11704, 11960, 12204, 12429, 12639, 12830, 13005, 13159, 13294, 13406, 
-    13496, 13560, 13599, 13607, 13587, 13535, 13450, 13332, 13180, 12991, 12766, 12506, 12213, 11884, 11526, 11137, 
-    10722, 10286, 9830, 9357, 8875, 8382, 7883, 7381, 6879, 6377, 5876, 5377, 4881, 4388, 3894, 3402, 
-    2912, 2420, 1926, 1432, 932, 429, -79, -592, -1115, -1644, -2184, -2732, -3293, -3864, -4449, -5044, 
-    -5652, -6269, -6896, -7529, -8165, -8802, -9436, -10064, -10677, -11277, -11855, -12411, -12938, -13436, -13901, -14333, 
-    -14731, -15094, -15421, -15717, -15980, -16214, -16423, -16608, -16770, -16912, -17032, -17132, -17208, -17262, -17288, -17285, 
-    -17248, -17176, -17064, -16907, -16703, -16449, -16144, -15783, -15370, -14904, -14388, -13824, -13218, -12572, -11894, -11191, 
-    -10467, -9733, -8993, -8254, -7522, -6801, -6094, -5405, -4734, -4082, -3449, -2831, -2226, -1630, -1039, -447, 
-    147, 752, 1367, 2000, 2648, 3316, 4002, 4708, 5428, 6163, 6904, 7648, 8387, 9118, 9832, 10525, 
-    11190, 11826, 12427, 12991, 13516, 14003, 14449, 14858, 15231, 15571, 15880, 16160, 16413, 16643, 16850, 17039, 
-    17206, 17356, 17488, 17602, 17697, 17769, 17818, 17840, 17832, 17791, 17715, 17598, 17442, 17241, 16998, 16708, 
-    16376, 15996, 15576, 15111, 14610, 14072, 13504, 12904, 12281, 11633, 10968, 10287, 9596, 8896, 8191, 7481, 
-    6773, 6064, 5357, 4652, 3948, 3245, 2543, 1839, 1135, 427, -286, -1006, -1733, -2468, -3211, -3961, 
-    -4718, -5481, -6246, -7011, -7774, -8530, -9277, -10008, -10720, -11411, -12075, -12705, -13302, -13860, -14377, -14851, 
-    -15282, -15667, -16009, -16306, -16563, -16778, -16957, -17101, -17212, -17291, -17343, -17366, -17364, -17336, -17287, -17213, 
-    -17121, -17005, -16871, -16714, -16536, -16335, -16112, -15860, -15583, -15277, -14941, -14574, -14178, -13749, -13286, -12792, 
-    -12263, -11699, -11100, -10468, -9800, -9102, -8373, -7618, -6837, -6037, -5220, -4391, -3556, -2717, -1880, -1048, 
-    -224, 589, 1387, 2171, 2933, 3676, 4396, 5094, 5765, 6414, 7039, 7640, 8218, 8778, 9316, 9837, 
-    10340, 10826, 11294, 11747, 12179, 12596, 12992, 13369, 13722, 14054, 14358, 14638, 14886, 15104, 15289, 15444, 
-    15563, 15652, 15707, 15732, 15726, 15692, 15629, 15540, 15425, 15287, 15127, 14944, 14740, 14515, 14268, 13997, 
-    13703, 13382, 13032, 12654, 12243, 11799, 11322, 10809, 10262, 9680, 9063, 8415, 7737, 7031, 6300, 5548, 
-    4778, 3992, 3195, 2389, 1577, 763, -49, -860, -1665, -2461, -3248, -4023, -4785, -5533, -6264, -6976, 
-    -7670, -8342, -8991, -9614, -10209, -10773, -11304, -11798, -12255, -12671, -13045, -13375, -13662, -13906, -14104, -14263, 
-    -14381, -14463, -14509, -14524, -14509, -14467, -14401, -14314, -14208, -14086, -13948, -13795, -13628, -13445, -13244, -13024, 
-    -12782, -12516, -12223, -11898, -11541, -11150, -10722, -10256, -9757, -9224, -8659, -8067, -7450, -6813, -6158, -5492, 
-    -4818, -4140, -3462, -2789, -2122, -1464, -816, -182, 438, 1047, 1643, 2227, 2802, 3368, 3927, 4481, 
-    5029, 5574, 6111, 6645, 7172, 7689, 8195, 8692, 9170, 9632, 10074, 10494, 10889, 11256, 11595, 11902, 
-    12177, 12419, 12625, 12796, 12931, 13032, 13097, 13129, 13128, 13096, 13034, 12942, 12823, 12677, 12505, 12310, 
-    12092, 11853, 11593, 11312, 11011, 10690, 10350, 9988, 9607, 9207, 8786, 8345, 7885, 7405, 6904, 6386, 
-    5849, 5295, 4724, 4139, 3538, 2925, 2303, 1673, 1040, 404, -231, -864, -1492, -2113, -2726, -3328, 
-    -3918, -4493, -5054, -5597, -6124, -6630, -7119, -7585, -8032, -8456, -8861, -9245, -9610, -9956, -10285, -10597, 
-    -10891, -11170, -11431, -11676, -11905, -12118, -12314, -12493, -12653, -12793, -12913, -13012, -13085, -13134, -13156, -13148, 
-    -13110, -13038, -12934, -12794, -12618, -12404, -12154, -11865, -11538, -11171, -10769, -10328, -9852, -9343, -8800, -8228, 
-    -7631, -7011, -6373, -5722, -5061, -4396, -3729, -3067, -2415, -1773, -1144, -531, 63, 643, 1206, 1752, 
-    2283, 2802, 3309, 3808, 4301, 4790, 5274, 5755, 6235, 6709, 7178, 7641, 8092, 8531, 8955, 9359, 
-    9740, 10096, 10423, 10723, 10991, 11227, 11432, 11606, 11750, 11865, 11951, 12013, 12052, 12071, 12072, 12058, 
-    12030, 11990, 11940, 11880, 11811, 11736, 11653, 11562, 11463, 11355, 11237, 11107, 10965, 10806, 10630, 10434, 
-    10215, 9972, 9703, 9404, 9076, 8715, 8320, 7893, 7433, 6941, 6417, 5864, 5284, 4681, 4055, 3413, 
-    2756, 2090, 1418, 744, 73, -593, -1250, -1896, -2530, -3145, -3744, -4325, -4886, -5427, -5947, -6446, 
-    -6924, -7379, -7815, -8231, -8626, -9002, -9360, -9699, -10021, -10326, -10614, -10884, -11138, -11374, -11592, -11789, 
-    -11966, -12121, -12254, -12364, -12451, -12514, -12552, -12566, -12553, -12513, -12445, -12350, -12227, -12078, -11903, -11703, 
-    -11480, -11236, -10971, -10686, -10383, -10060, -9720, -9363, -8990, -8599, -8195, -7779, -7353, -6917, -6475, -6027, 
-    -5576, -5122, -4666, -4211, -3755, -3301, -2846, -2393, -1941, -1489, -1037, -586, -133, 318, 771, 1223, 
-    1675, 2125, 2572, 3013, 3448, 3875, 4292, 4697, 5088, 5466, 5829, 6175, 6504, 6817, 7113, 7392, 
-    7657, 7908, 8147, 8374, 8591, 8798, 8995, 9182, 9359, 9526, 9681, 9821, 9950, 10061, 10156, 10230, 
-    10286, 10316, 10324, 10305, 10263, 10190, 10093, 9966, 9813, 9631, 9425, 9194, 8942, 8672, 8387, 8088, 
-    7781, 7465, 7145, 6822, 6500, 6177, 5858, 5540, 5224, 4909, 4597, 4283, 3968, 3652, 3332, 3005, 
-    2677, 2337, 1993, 1638, 1279, 911, 540, 162, -213, -589, -959, -1323, -1676, -2018, -2343, -2654, 
-    -2946, -3221, -3476, -3714, -3933, -4135, -4318, -4487, -4642, -4781, -4909, -5027, -5134, -5231, -5321, -5402, 
-    -5474, -5540, -5596, -5642, -5680, -5707, -5723, -5730, -5727, -5712, -5689, -5659, -5623, -5580, -5535, -5487, 
-    -5439, -5388, -5337, -5285, -5233, -5179, -5124, -5066, -5006, -4943, -4875, -4803, -4727, -4645, -4558, -4466, 
-    -4370, -4270, -4165, -4058, -3948, -3837, -3724, -3613, -3500, -3390, -3279, -3171, -3063, -2957, -2853, -2749, 
-    -2645, -2541, -2435, -2327, -2216, -2100, -1979, -1853, -1722, -1586, -1443, -1296, -1142, -983, -819, -650, 
-    -477, -301, -123, 55, 232, 408, 578, 744, 902, 1052, 1193, 1326, 1449, 1561, 1665, 1759, 
-    1845, 1922, 1994, 2058, 2119, 2177, 2233, 2287, 2340, 2394, 2449, 2504, 2560, 2618, 2676, 2735, 
-    2793, 2850, 2906, 2961, 3013, 3064, 3113, 3163, 3208, 3254, 3300, 3344, 3389, 3435, 3481, 3530, 
-    3582, 3639, 3700, 3767, 3841, 3922, 4010, 4106, 4209, 4318, 4432, 4546, 4662, 4774, 4882, 4984, 
-    5076, 5157, 5225, 5279, 5316, 5336, 5336, 5318, 5279, 5222, 5145, 5051, 4939, 4812, 4669, 4512, 
-    4342, 4161, 3970, 3771, 3564, 3350, 3132, 2906, 2678, 2445, 2210, 1971, 1732, 1490, 1251, 1009, 
-    771, 534, 301, 70, -154, -378, -595, -809, -1016, -1219, -1412, -1602, -1783, -1957, -2124, -2284, 
-    -2436, -2581, -2719, -2849, -2972, -3088, -3198, -3302, -3400, -3495, -3585, -3675, -3763, -3852, -3943, -4038, 
-    -4136, -4242, -4354, -4472, -4598, -4731, -4871, -5016, -5166, -5321, -5479, -5637, -5795, -5951, -6102, -6246, 
-    -6383, -6510, -6626, -6729, -6820, -6894, -6954, -6995, -7020, -7024, -7009, -6973, -6917, -6837, -6736, -6611, 
-    -6463, -6291, -6096, -5879, -5642, -5383, -5107, -4814, -4504, -4182, -3852, -3514, -3171, -2826, -2482, -2142, 
-    -1806, -1478, -1160, -850, -549, -261, 18, 290, 553, 810, 1060, 1307, 1551, 1793, 2034, 2275, 
-    2514, 2755, 2992, 3229, 3463, 3693, 3917, 4135, 4344, 4544, 4731, 4909, 5072, 5225, 5364, 5492, 
-    5609, 5718, 5818, 5913, 6003, 6091, 6177, 6264, 6350, 6439, 6528, 6617, 6706, 6796, 6884, 6968, 
-    7050, 7127, 7196, 7258, 7310, 7351, 7379, 7392, 7389, 7368, 7327, 7267, 7186, 7084, 6960, 6812, 
-    6644, 6451, 6238, 6001, 5745, 5467, 5172, 4858, 4530, 4188, 3836, 3473, 3105, 2729, 2351, 1969, 
-    1588, 1205, 826, 450, 79, -284, -642, -990, -1328, -1655, -1970, -2270, -2556, -2827, -3082, -3320, 
-    -3540, -3743, -3927, -4094, -4241, -4371, -4485, -4583, -4665, -4735, -4793, -4839, -4877, -4908, -4933, -4953, 
-    -4971, -4984, -4998, -5008, -5017, -5025, -5032, -5035, -5037, -5036, -5032, -5024, -5009, -4990, -4962, -4927, 
-    -4882, -4829, -4763, -4688, -4602, -4506, -4399, -4285, -4161, -4034, -3902, -3768, -3632, -3501, -3369, -3243, 
-    -3122, -3008, -2898, -2795, -2697, -2604, -2515, -2428, -2341, -2253, -2163, -2068, -1965, -1855, -1736, -1604, 
-    -1463, -1309, -1143, -969, -785, -595, -400, -205, -10, 181, 368, 546, 717, 875, 1020, 1154, 
-    1271, 1374, 1465, 1541, 1602, 1653, 1691, 1720, 1738, 1749, 1753, 1751, 1743, 1731, 1715, 1695, 
-    1673, 1648, 1622, 1595, 1569, 1544, 1522, 1502, 1487, 1477, 1474, 1476, 1484, 1499, 1521, 1550, 
-    1584, 1626, 1671, 1721, 1774, 1830, 1887, 1945, 2000, 2056, 2106, 2155, 2198, 2238, 2273, 2307, 
-    2337, 2366, 2394, 2424, 2454, 2488, 2526, 2568, 2616, 2669, 2728, 2791, 2860, 2931, 3004, 3077, 
-    3148, 3215, 3278, 3332, 3377, 3411, 3435, 3446, 3446, 3433, 3410, 3376, 3334, 3281, 3224, 3158, 
-    3089, 3015, 2941, 2864, 2790, 2716, 2643, 2573, 2505, 2438, 2376, 2314, 2254, 2196, 2139, 2083, 
-    2027, 1970, 1911, 1850, 1786, 1717, 1646, 1568, 1484, 1393, 1295, 1188, 1073, 949, 814, 669, 
-    516, 351, 176, -8, -203, -408, -621, -843, -1073, -1307, -1547, -1791, -2036, -2282, -2528, -2771, 
-    -3013, -3251, -3485, -3716, -3941, -4160, -4372, -4578, -4775, -4965, -5146, -5318, -5483, -5638, -5787, -5929, 
-    -6062, -6189, -6310, -6424, -6532, -6633, -6727, -6814, -6894, -6963, -7025, -7075, -7114, -7139, -7148, -7140, 
-    -7117, -7072, -7009, -6923, -6816, -6687, -6537, -6364, -6172, -5959, -5728, -5482, -5221, -4949, -4667, -4377, 
-    -4084, -3787, -3490, -3192, -2897, -2605, -2316, -2032, -1752, -1477, -1208, -945, -685, -433, -184, 61, 
-    303, 543, 782, 1020, 1259, 1499, 1743, 1992, 2247, 2509, 2782, 3064, 3357, 3663, 3981, 4311, 
-    4651, 5001, 5360, 5724, 6092, 6460, 6825, 7186, 7537, 7877, 8205, 8516, 8810, 9083, 9338, 9569, 
-    9778, 9963, 10125, 10264, 10379, 10470, 10537, 10581, 10602, 10600, 10576, 10529, 10459, 10367, 10252, 10114, 
-    9954, 9772, 9569, 9346, 9103, 8844, 8564, 8269, 7956, 7627, 7282, 6922, 6546, 6156, 5749, 5331, 
-    4899, 4454, 3998, 3532, 3055, 2573, 2083, 1591, 1096, 600, 107, -380, -866, -1342, -1811, -2270, 
-    -2720, -3159, -3589, -4006, -4416, -4814, -5204, -5586, -5960, -6328, -6691, -7045, -7396, -7739, -8075, -8404, 
-    -8723, -9031, -9331, -9616, -9887, -10144, -10383, -10604, -10806, -10988, -11147, -11288, -11405, -11500, -11573, -11624, 
-    -11651, -11657, -11639, -11600, -11538, -11457, -11352, -11227, -11081, -10914, -10725, -10517, -10287, -10037, -9767, -9478, 
-    -9170, -8845, -8502, -8144, -7772, -7385, -6984, -6571, -6146, -5709, -5261, -4803, -4333, -3854, -3365, -2866, 
-    -2358, -1840, -1314, -780, -240, 306, 858, 1414, 1971, 2530, 3087, 3643, 4192, 4736, 5270, 5795, 
-    6305, 6801, 7280, 7741, 8183, 8605, 9005, 9382, 9738, 10069, 10376, 10659, 10919, 11152, 11359, 11542, 
-    11699, 11830, 11935, 12016, 12071, 12103, 12111, 12096, 12059, 12001, 11923, 11823, 11704, 11565, 11407, 11229, 
-    11032, 10815, 10579, 10323, 10048, 9753, 9438, 9105, 8751, 8380, 7992, 7588, 7168, 6737, 6294, 5842, 
-    5383, 4919, 4451, 3981, 3511, 3042, 2574, 2108, 1643, 1180, 718, 258, -201, -660, -1121, -1579, 
-    -2040, -2499, -2957, -3412, -3864, -4310, -4749, -5179, -5599, -6006, -6398, -6774, -7132, -7470, -7788, -8085, 
-    -8360, -8613, -8845, -9056, -9246, -9416, -9568, -9701, -9818, -9917, -10001, -10069, -10121, -10158, -10179, -10183, 
-    -10171, -10140, -10091, -10022, -9933, -9821, -9687, -9530, -9350, -9148, -8922, -8675, -8407, -8119, -7811, -7487, 
-    -7147, -6793, -6427, -6050, -5665, -5273, -4875, -4471, -4066, -3657, -3248, -2838, -2428, -2020, -1614, -1211, 
-    -812, -416, -27, 356, 732, 1103, 1464, 1818, 2164, 2501, 2828, 3149, 3461, 3765, 4060, 4347, 
-    4626, 4897, 5158, 5411, 5655, 5891, 6115, 6331, 6533, 6726, 6903, 7068, 7215, 7348, 7461, 7558, 
-    7635, 7693, 7731, 7751, 7751, 7732, 7695, 7640, 7569, 7479, 7374, 7256, 7123, 6977, 6820, 6651, 
-    6472, 6284, 6086, 5879, 5663, 5440, 5208, 4969, 4722, 4468, 4207, 3940, 3666, 3386, 3100, 2807, 
-    2509, 2204, 1894, 1578, 1257, 932, 604, 273, -57, -388, -717, -1042, -1361, -1672, -1974, -2264, 
-    -2541, -2803, -3049, -3275, -3485, -3674, -3846, -3997, -4129, -4242, -4338, -4415, -4477, -4524, -4557, -4578, 
-    -4589, -4591, -4583, -4570, -4549, -4525, -4495, -4462, -4424, -4384, -4341, -4295, -4245, -4192, -4133, -4070, 
-    -4000, -3923, -3837, -3743, -3638, -3522, -3395, -3256, -3104, -2942, -2769, -2586, -2396, -2199, -1997, -1794, 
-    -1590, -1387, -1188, -993, -805, -623, -448, -282, -126, 24, 164, 300, 428, 551, 670, 787, 
-    899, 1015, 1128, 1244, 1360, 1479, 1598, 1718, 1839, 1961, 2081, 2198, 2314, 2422, 2526, 2619, 
-    2705, 2778, 2840, 2885, 2917, 2932, 2930, 2911, 2876, 2825, 2759, 2678, 2584, 2479, 2365, 2243, 
-    2116, 1982, 1848, 1711, 1575, 1438, 1304, 1173, 1044, 916, 792, 670, 549, 431, 313, 198, 
-    83, -30, -143, -253, -363, -469, -571, -671, -766, -854, -939, -1016, -1087, -1153, -1211, -1263, 
-    -1309, -1347, -1381, -1408, -1430, -1446, -1457, -1463, -1462, -1459, -1450, -1437, -1420, -1400, -1376, -1348, 
-    -1315, -1280, -1239, -1196, -1146, -1094, -1035, -973, -904, -832, -754, -672, -586, -497, -404, -311, 
-    -215, -117, -19, 77, 176, 272, 369, 462, 555, 646, 736, 824, 913, 1001, 1090, 1176, 
-    1265, 1351, 1437, 1519, 1600, 1674, 1745, 1805, 1860, 1904, 1938, 1960, 1973, 1975, 1966, 1947, 
-    1921, 1888, 1847, 1804, 1758, 1710, 1662, 1617, 1572, 1530, 1490, 1452, 1415, 1378, 1340, 1299, 
-    1254, 1202, 1144, 1076, 999, 910, 810, 700, 579, 446, 307, 159, 6, -150, -309, -470, 
-    -628, -785, -937, -1086, -1227, -1362, -1489, -1611, -1724, -1832, -1931, -2026, -2114, -2197, -2275, -2350, 
-    -2420, -2489, -2552, -2613, -2669, -2722, -2765, -2807, -2838, -2865, -2880, -2890, -2887, -2879, -2858, -2828, 
-    -2787, -2736, -2672, -2600, -2516, -2421, -2317, -2205, -2083, -1953, -1817, -1673, -1525, -1371, -1213, -1050, 
-    -886, -718, -549, -377, -205, -31, 141, 314, 487, 657, 827, 994, 1161, 1324, 1485, 1643, 
-    1799, 1948, 2094, 2235, 2371, 2502, 2626, 2744, 2855, 2960, 3057, 3148, 3230, 3305, 3372, 3431, 
-    3481, 3523, 3556, 3580, 3596, 3600, 3597, 3584, 3561, 3529, 3489, 3439, 3381, 3316, 3243, 3164, 
-    3077, 2986, 2889, 2787, 2681, 2569, 2453, 2334, 2210, 2083, 1953, 1819, 1684, 1546, 1406, 1264, 
-    1120, 973, 824, 672, 515, 356, 191, 21, -152, -332, -518, -708, -903, -1102, -1306, -1513, 
-    -1723, -1934, -2146, -2357, -2566, -2771, -2971, -3164, -3349, -3526, -3691, -3847, -3991, -4122, -4241, -4349, 
-    -4442, -4526, -4596, -4654, -4702, -4738, -4761, -4776, -4776, -4766, -4744, -4710, -4663, -4606, -4535, -4454, 
-    -4359, -4253, -4133, -4003, -3856, -3699, -3527, -3342, -3143, -2933, -2710, -2476, -2232, -1980, -1721, -1456, 
-    -1186, -914, -642, -370, -101, 162, 421, 672, 915, 1150, 1375, 1590, 1798, 1998, 2190, 2378, 
-    2561, 2741, 2917, 3091, 3265, 3436, 3604, 3771, 3934, 4095, 4251, 4402, 4546, 4684, 4813, 4934, 
-    5043, 5142, 5228, 5301, 5359, 5405, 5433, 5448, 5447, 5430, 5398, 5351, 5288, 5212, 5122, 5018, 
-    4903, 4776, 4640, 4494, 4342, 4182, 4017, 3846, 3673, 3495, 3315, 3132, 2945, 2754, 2561, 2362, 
-    2157, 1948, 1730, 1505, 1272, 1030, 780, 520, 252, -23, -305, -596, -891, -1190, -1491, -1791, 
-    -2093, -2390, -2684, -2971, -3253, -3525, -3787, -4038, -4278, -4503, -4717, -4915, -5099, -5268, -5424, -5563, 
-    -5688, -5798, -5893, -5973, -6039, -6092, -6131, -6156, -6170, -6171, -6160, -6137, -6102, -6055, -5997, -5925, 
-    -5840, -5741, -5630, -5501, -5360, -5202, -5029, -4840, -4638, -4418, -4186, -3939, -3680, -3408, -3128, -2838, 
-    -2541, -2239, -1933, -1624, -1315, -1006, -699, -397, -96, 198, 488, 772, 1050, 1321, 1587, 1848, 
-    2101, 2350, 2594, 2834, 3069, 3303, 3530, 3755, 3977, 4195, 4407, 4616, 4817, 5014, 5201, 5380, 
-    5547, 5705, 5847, 5978, 6091, 6190, 6270, 6335, 6381, 6410, 6422, 6418, 6397, 6359, 6306, 6238, 
-    6155, 6056, 5943, 5816, 5676, 5523, 5357, 5179, 4990, 4789, 4578, 4357, 4127, 3887, 3639, 3385, 
-    3122, 2852, 2575, 2292, 2003, 1707, 1404, 1097, 785, 465, 142, -184, -516, -851, -1186, -1522, 
-    -1856, -2186, -2510, -2826, -3133, -3428, -3709, -3976, -4227, -4459, -4673, -4868, -5043, -5200, -5338, -5456, 
-    -5559, -5644, -5714, -5769, -5812, -5841, -5861, -5869, -5869, -5858, -5841, -5813, -5778, -5732, -5678, -5612, 
-    -5535, -5446, -5346, -5231, -5105, -4964, -4811, -4645, -4469, -4279, -4081, -3871, -3654, -3428, -3197, -2960, 
-    -2717, -2472, -2223, -1971, -1718, -1463, -1206, -947, -685, -421, -153, 116, 390, 668, 947, 1230, 
-    1512, 1797, 2081, 2365, 2644, 2922, 3191, 3457, 3712, 3960, 4197, 4425, 4639, 4844, 5033, 5211, 
-    5374, 5525, 5659, 5779, 5884, 5974, 6047, 6104, 6144, 6166, 6168, 6154, 6119, 6063, 5987, 5892, 
-    5774, 5638, 5483, 5308, 5117, 4911, 4690, 4458, 4215, 3963, 3704, 3438, 3167, 2893, 2617, 2339, 
-    2060, 1781, 1503, 1223, 945, 668, 393, 117, -154, -426, -694, -961, -1224, -1486, -1742, -1994, 
-    -2239, -2481, -2715, -2942, -3163, -3377, -3582, -3779, -3970, -4152, -4324, -4489, -4645, -4793, -4930, -5059, 
-    -5179, -5288, -5386, -5476, -5554, -5621, -5679, -5724, -5758, -5781, -5791, -5789, -5774, -5745, -5703, -5647, 
-    -5577, -5490, -5390, -5274, -5142, -4995, -4833, -4654, -4459, -4249, -4023, -3783, -3527, -3258, -2974, -2679, 
-    -2370, -2051, -1720, -1383, -1036, -684, -326, 34, 396, 760, 1122, 1481, 1837, 2186, 2530, 2865, 
-    3191, 3507, 3812, 4105, 4386, 4654, 4908, 5149, 5375, 5588, 5785, 5969, 6136, 6289, 6426, 6547, 
-    6652, 6743, 6817, 6874, 6916, 6944, 6952, 6946, 6924, 6885, 6828, 6756, 6666, 6558, 6433, 6291, 
-    6131, 5954, 5760, 5549, 5323, 5082, 4828, 4561, 4283, 3995, 3698, 3396, 3086, 2772, 2457, 2138, 
-    1818, 1499, 1177, 856, 536, 213, -110, -435, -764, -1094, -1428, -1764, -2103, -2443, -2784, -3123, 
-    -3462, -3796, -4123, -4442, -4752, -5047, -5329, -5596, -5843, -6074, -6286, -6478, -6652, -6810, -6950, -7074, 
-    -7185, -7283, -7369, -7445, -7511, -7568, -7616, -7655, -7684, -7701, -7708, -7699, -7674, -7633, -7573, -7490, 
-    -7388, -7259, -7109, -6935, -6736, -6513, -6270, -6002, -5717, -5412, -5091, -4755, -4407, -4047, -3679, -3303, 
-    -2922, -2534, -2143, -1747, -1350, -948, -543, -136, 273, 686, 1100, 1516, 1934, 2351, 2768, 3182, 
-    3593, 3998, 4396, 4784, 5161, 5526, 5876, 6210, 6526, 6825, 7104, 7364, 7603, 7822, 8021, 8200, 
-    8359, 8499, 8621, 8724, 8809, 8877, 8928, 8960, 8974, 8972, 8949, 8908, 8848, 8767, 8665, 8545, 
-    8402, 8238, 8053, 7847, 7620, 7374, 7109, 6824, 6523, 6206, 5875, 5531, 5176, 4809, 4436, 4053, 
-    3665, 3272, 2876, 2473, 2071, 1664, 1257, 847, 437, 23, -387, -803, -1217, -1631, -2044, -2456, 
-    -2864, -3270, -3669, -4062, -4448, -4823, -5189, -5542, -5881, -6205, -6514, -6806, -7080, -7336, -7573, -7792, 
-    -7992, -8174, -8337, -8482, -8608, -8717, -8808, -8883, -8940, -8979, -9002, -9008, 
-};
-const unsigned int drum_v0_p3_short_len = 5292;
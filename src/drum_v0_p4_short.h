@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v0_p4_short[] PROGMEM = {
-    75, -15, 26, 12, 28, 14, 19, 5, 2, -12, -18, -34, -42, -60, -70, -89, 
-    -102, -122, -138, -159, -177, -199, -218, -241, -259, -282, -300, -321, -337, -357, -372, -390, 
-    -404, -419, -433, -447, -460, -474, -486, -500, -512, -526, -538, -553, -565, -579, -591, -604, 
-    -615, -627, -636, -646, -652, -658, -662, -664, -664, -663, -659, -655, -648, -641, -631, -621, 
-    -609, -596, -581, -566, -548, -530, -509, -489, -463, -440, -413, -386, -358, -329, -299, -269, 
-    -238, -208, -177, -148, -117, -88, -58, -30, -1, 25, 53, 79, 107, 131, 158, 183, 
-    209, 234, 260, 286, 312, 338, 365, 391, 418, 443, 469, 492, 516, 536, 557, 574, 
-    592, 606, 621, 633, 644, 654, 664, 671, 680, 686, 692, 696, 699, 700, 700, 697, 
-    692, 685, 674, 661, 645, 626, 605, 582, 557, 529, 500, 471, 440, 407, 375, 341, 
-    305, 269, 231, 190, 148, 103, 57, 9, -41, -92, -145, -199, -253, -308, -363, -417, 
-    -470, -523, -573, -623, -670, -715, -759, -799, -838, -874, -908, -939, -968, -994, -1018, -1040, 
-    -1058, -1074, -1087, -1096, -1103, -1105, -1105, -1100, -1092, -1079, -1062, -1042, -1016, -987, -953, -917, 
-    -875, -830, -782, -730, -675, -618, -556, -493, -426, -357, -284, -211, -134, -56, 24, 105, 
-    188, 272, 358, 443, 529, 616, 702, 788, 873, 958, 1041, 1122, 1201, 1277, 1350, 1420, 
-    1485, 1548, 1605, 1657, 1705, 1747, 1784, 1814, 1840, 1859, 1872, 1878, 1877, 1870, 1855, 1833, 
-    1803, 1766, 1722, 1669, 1610, 1542, 1468, 1387, 1299, 1205, 1104, 998, 886, 768, 646, 520, 
-    388, 253, 114, -27, -173, -321, -471, -624, -778, -934, -1091, -1248, -1405, -1561, -1716, -1869, 
-    -2019, -2167, -2311, -2452, -2589, -2721, -2849, -2973, -3091, -3205, -3313, -3415, -3511, -3600, -3682, -3755, 
-    -3820, -3875, -3919, -3951, -3971, -3976, -3969, -3945, -3906, -3851, -3780, -3691, -3586, -3463, -3324, -3167, 
-    -2994, -2803, -2595, -2372, -2131, -1875, -1604, -1318, -1019, -706, -382, -48, 294, 645, 1000, 1360, 
-    1721, 2082, 2442, 2798, 3149, 3492, 3827, 4152, 4464, 4764, 5050, 5321, 5576, 5814, 6035, 6239, 
-    6424, 6591, 6740, 6870, 6981, 7075, 7149, 7207, 7245, 7267, 7270, 7257, 7227, 7180, 7118, 7040, 
-    6947, 6838, 6715, 6576, 6422, 6254, 6068, 5869, 5650, 5415, 5160, 4886, 4590, 4273, 3930, 3565, 
-    3174, 2756, 2313, 1843, 1348, 828, 284, -283, -871, -1480, -2106, -2749, -3405, -4072, -4748, -5428, 
-    -6111, -6792, -7467, -8133, -8784, -9417, -10025, -10606, -11154, -11665, -12135, -12561, -12938, -13268, -13546, -13772, 
-    -13947, -14071, -14146, -14175, -14160, -14105, -14015, -13893, -13744, -13569, -13375, -13161, -12928, -12677, -12406, -12112, 
-    -11791, -11441, -11053, -10630, -10163, -9656, -9106, -8522, -7905, -7266, -6614, -5962, -5316, -4692, -4089, -3516, 
-    -2963, -2428, -1889, -1336, -733, -70, 698, 1574, 2600, 3764, 5106, 6605, 8242, 9962, 11767, 13562, 
-    15375, 17061, 18791, 19587, 19494, 19552, 19510, 19544, 19516, 19541, 19517, 19540, 19518, 19539, 19519, 19539, 
-    19518, 19539, 19517, 19539, 19517, 19541, 19515, 19544, 19512, 19548, 19505, 19561, 19481, 19617, 18566, 16394, 
-    14395, 12280, 10270, 8256, 6350, 4537, 2889, 1376, 60, -1127, -2207, -3240, -4219, -5199, -6206, -7244, 
-    -8315, -9453, -10695, -11987, -13332, -14677, -16046, -17366, -18727, -19562, -19553, -19576, -19558, -19572, -19560, -19570, 
-    -19561, -19569, -19562, -19569, -19562, -19568, -19564, -19568, -19564, -19567, -19565, -19567, -19565, -19566, -19563, -19566, 
-    -19565, -19566, -19566, -19565, -19566, -19565, -19567, -19563, -19569, -19560, -19574, -19550, -19603, -19279, -17231, -14998, 
-    -12725, -10444, -8178, -5990, -3879, -1855, 106, 1989, 3803, 5551, 7254, 8903, 10498, 12051, 13570, 15089, 
-    16590, 18143, 19449, 19534, 19530, 19526, 19531, 19526, 19532, 19526, 19532, 19527, 19531, 19527, 19531, 19527, 
-    19531, 19527, 19531, 19527, 19530, 19528, 19530, 19527, 19530, 19527, 19530, 19528, 19530, 19528, 19530, 19528, 
-    19529, 19528, 19529, 19529, 19528, 19530, 19527, 19531, 19526, 19533, 19529, 19440, 17637, 15090, 12633, 10051, 
-    7509, 4873, 2280, -348, -2894, -5431, -7833, -10192, -12377, -14519, -16454, -18439, -19571, -19549, -19578, -19557, 
-    -19572, -19561, -19570, -19563, -19568, -19563, -19567, -19564, -19567, -19564, -19567, -19566, -19566, -19565, -19565, -19565, 
-    -19566, -19566, -19566, -19566, -19565, -19565, -19566, -19565, -19565, -19566, -19565, -19566, -19566, -19565, -19566, -19565, 
-    -19566, -19564, -19566, -19565, -19566, -19565, -19564, -19581, -19379, -16684, -13164, -9757, -6245, -2820, 612, 3915, 
-    7184, 10302, 13358, 16241, 18932, 19591, 19503, 19544, 19519, 19535, 19524, 19532, 19527, 19530, 19527, 19530, 
-    19528, 19529, 19529, 19529, 19529, 19528, 19530, 19527, 19531, 19527, 19531, 19527, 19531, 19526, 19532, 19526, 
-    19532, 19525, 19532, 19524, 19533, 19523, 19535, 19522, 19537, 19520, 19539, 19518, 19543, 19512, 19550, 19501, 
-    19568, 19466, 19656, 17933, 14469, 11296, 7846, 4553, 1110, -2159, -5505, -8642, -11845, -14774, -17862, -19579, 
-    -19541, -19582, -19555, -19573, -19560, -19570, -19563, -19568, -19564, -19567, -19565, -19566, -19566, -19566, -19566, -19566, 
-    -19567, -19565, -19567, -19565, -19566, -19564, -19566, -19565, -19567, -19564, -19567, -19565, -19567, -19564, -19566, -19564, 
-    -19566, -19564, -19566, -19565, -19566, -19564, -19565, -19566, -19565, -19568, -19561, -19573, -19549, -19612, -19210, -16511, 
-    -13583, -10549, -7500, -4377, -1312, 1763, 4709, 7638, 10393, 13154, 15678, 18338, 19601, 19486, 19558, 19508, 
-    19545, 19516, 19540, 19519, 19537, 19521, 19535, 19523, 19534, 19524, 19533, 19523, 19532, 19524, 19532, 19525, 
-    19531, 19526, 19532, 19526, 19531, 19526, 19531, 19526, 19531, 19527, 19531, 19527, 19530, 19527, 19531, 19527, 
-    19531, 19525, 19532, 19525, 19533, 19522, 19537, 19511, 19573, 19235, 16801, 14186, 11515, 8815, 6029, 3222, 
-    325, -2575, -5563, -8515, -11569, -14505, -17623, -19562, -19538, -19587, -19549, -19579, -19553, -19576, -19556, -19573, 
-    -19557, -19573, -19559, -19571, -19559, -19571, -19561, -19571, -19562, -19570, -19561, -19569, -19561, -19570, -19562, -19570, 
-    -19562, -19568, -19563, -19568, -19562, -19569, -19563, -19568, -19564, -19568, -19564, -19567, -19565, -19566, -19568, -19559, 
-    -19588, -19357, -17016, -14167, -11363, -8483, -5616, -2714, 144, 2995, 5755, 8486, 11082, 13651, 16014, 18442, 
-    19598, 19484, 19560, 19504, 19549, 19511, 19545, 19514, 19543, 19515, 19541, 19517, 19540, 19517, 19539, 19517, 
-    19540, 19518, 19539, 19518, 19539, 19517, 19540, 19517, 19541, 19517, 19541, 19517, 19542, 19515, 19543, 19514, 
-    19545, 19512, 19547, 19509, 19550, 19505, 19557, 19494, 19574, 19464, 19645, 18173, 15281, 12646, 9928, 7327, 
-    4709, 2140, -430, -3000, -5563, -8165, -10727, -13351, -15839, -18474, -19660, -19513, -19602, -19539, -19588, -19546, 
-    -19583, -19551, -19579, -19554, -19576, -19555, -19574, -19557, -19574, -19558, -19573, -19558, -19573, -19559, -19572, -19559, 
-    -19572, -19560, -19571, -19560, -19571, -19560, -19571, -19560, -19572, -19560, -19571, -19559, -19572, -19559, -19572, -19559, 
-    -19574, -19556, -19578, -19547, -19605, -19329, -17251, -14831, -12387, -9833, -7252, -4583, -1907, 850, 3601, 6446, 
-    9251, 12160, 14942, 17926, 19570, 19489, 19557, 19506, 19547, 19513, 19542, 19517, 19540, 19518, 19538, 19519, 
-    19537, 19520, 19537, 19520, 19536, 19521, 19536, 19522, 19536, 19521, 19537, 19520, 19537, 19519, 19539, 19518, 
-    19541, 19514, 19546, 19504, 19574, 19115, 17677, 16239, 14804, 13405, 12039, 10710, 9421, 8153, 6907, 5648, 
-    4383, 3059, 1693, 223, -1312, -2971, -4692, -6534, -8413, -10402, -12380, -14460, -16435, -18552, -19609, -19535, 
-    -19586, -19551, -19577, -19557, -19572, -19560, -19570, -19561, -19568, -19562, -19567, -19565, -19566, -19566, -19565, -19567, 
-    -19563, -19567, -19562, -19570, -19559, -19573, -19555, -19581, -19541, -19616, -18998, -17185, -15408, -13567, -11778, -9964, 
-    -8207, -6455, -4770, -3113, -1532, 0, 1447, 2834, 4129, 5355, 6495, 7579, 8600, 9590, 10551, 11505, 
-    12458, 13425, 14415, 15423, 16461, 17501, 18593, 19490, 19529, 19532, 19526, 19531, 19525, 19531, 19527, 19530, 
-    19527, 19530, 19528, 19530, 19528, 19529, 19529, 19528, 19530, 19526, 19533, 19521, 19549, 19318, 18467, 17547, 
-    16504, 15374, 14108, 12739, 11247, 9669, 7997, 6281, 4524, 2783, 1067, -582, -2157, -3627, -5000, -6258, 
-    -7425, -8504, -9526, -10498, -11450, -12383, -13317, -14245, -15171, -16088, -16985, -17849, -18664, -19393, -19587, -19554, 
-    -19573, -19559, -19571, -19560, -19570, -19561, -19570, -19561, -19571, -19560, -19572, -19559, -19574, -19556, -19575, -19214, 
-    -18581, -17912, -17144, -16301, -15358, -14327, -13200, -11988, -10695, -9337, -7933, -6500, -5054, -3610, -2185, -790, 
-    565, 1882, 3156, 4392, 5590, 6757, 7895, 9010, 10099, 11161, 12187, 13173, 14105, 14978, 15782, 16512, 
-    17158, 17720, 18191, 18577, 18875, 19095, 19234, 19306, 19308, 19248, 19124, 18947, 18717, 18443, 18120, 17755, 
-    17345, 16898, 16413, 15900, 15357, 14792, 14200, 13588, 12946, 12279, 11575, 10840, 10062, 9246, 8386, 7485, 
-    6534, 5537, 4492, 3400, 2264, 1092, -110, -1331, -2568, -3802, -5027, -6226, -7389, -8499, -9554, -10537, 
-    -11452, -12288, -13051, -13739, -14362, -14924, -15435, -15897, -16320, -16700, -17042, -17336, -17577, -17752, -17854, -17870, 
-    -17795, -17622, -17356, -16999, -16566, -16066, -15517, -14931, -14332, -13729, -13142, -12575, -12036, -11518, -11018, -10520, 
-    -10012, -9472, -8889, -8245, -7533, -6741, -5876, -4943, -3955, -2923, -1867, -798, 260, 1299, 2297, 3247, 
-    4144, 4989, 5783, 6531, 7234, 7900, 8531, 9138, 9720, 10286, 10832, 11361, 11867, 12349, 12804, 13231, 
-    13621, 13969, 14259, 14486, 14638, 14710, 14696, 14597, 14414, 14154, 13823, 13435, 12993, 12513, 11998, 11459, 
-    10901, 10334, 9766, 9203, 8642, 8088, 7538, 6994, 6453, 5920, 5388, 4867, 4350, 3842, 3343, 2850, 
-    2359, 1869, 1375, 878, 374, -136, -659, -1186, -1722, -2261, -2806, -3354, -3906, -4457, -5013, -5567, 
-    -6119, -6662, -7192, -7703, -8189, -8640, -9049, -9407, -9711, -9952, -10135, -10255, -10318, -10326, -10287, -10205, 
-    -10089, -9945, -9782, -9605, -9419, -9222, -9017, -8797, -8558, -8288, -7979, -7626, -7226, -6783, -6301, -5790, 
-    -5262, -4726, -4197, -3686, -3213, -2785, -2415, -2108, -1869, -1693, -1577, -1507, -1472, -1455, -1439, -1409, 
-    -1352, -1259, -1127, -949, -729, -468, -172, 151, 495, 857, 1227, 1602, 1974, 2341, 2699, 3052, 
-    3397, 3741, 4087, 4437, 4791, 5149, 5505, 5855, 6187, 6492, 6758, 6974, 7130, 7218, 7234, 7183, 
-    7063, 6886, 6662, 6409, 6138, 5869, 5612, 5384, 5193, 5046, 4945, 4893, 4883, 4907, 4951, 5003, 
-    5046, 5069, 5057, 5004, 4897, 4736, 4518, 4249, 3933, 3579, 3195, 2794, 2384, 1980, 1595, 1241, 
-    925, 655, 432, 257, 121, 18, -63, -135, -206, -287, -392, -526, -695, -901, -1144, -1416, 
-    -1714, -2023, -2331, -2625, -2893, -3126, -3318, -3467, -3575, -3642, -3680, -3698, -3708, -3720, -3748, -3795, 
-    -3871, -3973, -4107, -4267, -4448, -4642, -4840, -5029, -5200, -5345, -5456, -5527, -5557, -5550, -5512, -5449, 
-    -5372, -5286, -5200, -5118, -5048, -4988, -4946, -4915, -4897, -4888, -4884, -4881, -4874, -4855, -4823, -4771, 
-    -4698, -4598, -4468, -4305, -4105, -3868, -3593, -3279, -2931, -2551, -2139, -1701, -1245, -774, -298, 176, 
-    639, 1086, 1509, 1905, 2271, 2609, 2919, 3210, 3483, 3748, 4010, 4275, 4544, 4821, 5103, 5391, 
-    5678, 5961, 6236, 6500, 6749, 6982, 7196, 7391, 7568, 7730, 7880, 8021, 8153, 8279, 8396, 8504, 
-    8595, 8667, 8706, 8708, 8666, 8575, 8427, 8219, 7949, 7617, 7227, 6783, 6290, 5755, 5185, 4591, 
-    3978, 3358, 2738, 2131, 1538, 968, 421, -96, -586, -1043, -1469, -1864, -2225, -2555, -2856, -3128, 
-    -3379, -3609, -3824, -4025, -4215, -4393, -4561, -4718, -4861, -4991, -5108, -5212, -5304, -5385, -5458, -5526, 
-    -5592, -5659, -5729, -5804, -5886, -5972, -6065, -6156, -6247, -6329, -6402, -6461, -6504, -6524, -6524, -6501, 
-    -6457, -6391, -6308, -6207, -6092, -5964, -5826, -5677, -5519, -5352, -5174, -4981, -4774, -4546, -4302, -4035, 
-    -3742, -3418, -3066, -2682, -2271, -1836, -1386, -923, -457, 3, 450, 873, 1264, 1617, 1927, 2191, 
-    2408, 2580, 2710, 2803, 2867, 2912, 2944, 2976, 3012, 3061, 3126, 3209, 3313, 3439, 3579, 3734, 
-    3895, 4056, 4215, 4365, 4505, 4637, 4756, 4864, 4963, 5055, 5144, 5236, 5334, 5444, 5566, 5703, 
-    5855, 6019, 6190, 6362, 6525, 6674, 6797, 6889, 6940, 6947, 6904, 6808, 6661, 6463, 6220, 5935, 
-    5612, 5259, 4880, 4480, 4066, 3644, 3217, 2793, 2374, 1969, 1581, 1217, 879, 571, 295, 55, 
-    -152, -325, -469, -589, -692, -787, -881, -985, -1103, -1241, -1404, -1598, -1822, -2077, -2360, -2668, 
-    -2999, -3343, -3701, -4064, -4431, -4796, -5155, -5511, -5859, -6198, -6528, -6844, -7143, -7419, -7670, -7891, 
-    -8078, -8226, -8335, -8404, -8435, -8429, -8391, -8319, -8220, -8095, -7949, -7783, -7601, -7404, -7195, -6975, 
-    -6747, -6516, -6282, -6048, -5818, -5592, -5372, -5160, -4957, -4761, -4572, -4388, -4203, -4014, -3817, -3603, 
-    -3371, -3115, -2834, -2523, -2183, -1810, -1406, -970, -502, -3, 524, 1081, 1662, 2264, 2884, 3516, 
-    4157, 4801, 5440, 6072, 6689, 7288, 7868, 8422, 8952, 9457, 9935, 10390, 10817, 11219, 11595, 11942, 
-    12263, 12554, 12815, 13044, 13238, 13394, 13509, 13579, 13599, 13566, 13476, 13327, 13117, 12842, 12504, 12105, 
-    11647, 11137, 10578, 9983, 9357, 8710, 8048, 7380, 6709, 6040, 5374, 4713, 4055, 3398, 2744, 2086, 
-    1427, 759, 84, -599, -1297, -2010, -2740, -3490, -4262, -5054, -5867, -6697, -7541, -8390, -9238, -10076, 
-    -10892, -11677, -12422, -13118, -13759, -14341, -14862, -15320, -15719, -16062, -16356, -16606, -16816, -16990, -17126, -17221, 
-    -17273, -17272, -17213, -17087, -16885, -16597, -16220, -15746, -15178, -14518, -13772, -12950, -12063, -11128, -10158, -9174, 
-    -8187, -7214, -6264, -5342, -4453, -3599, -2773, -1969, -1179, -389, 407, 1222, 2063, 2935, 3842, 4781, 
-    5748, 6734, 7725, 8709, 9671, 10596, 11473, 12294, 13048, 13734, 14350, 14897, 15382, 15809, 16184, 16512, 
-    16800, 17051, 17268, 17453, 17605, 17723, 17799, 17830, 17805, 17721, 17566, 17339, 17034, 16650, 16185, 15643, 
-    15025, 14340, 13595, 12797, 11953, 11074, 10166, 9239, 8300, 7354, 6409, 5465, 4524, 3586, 2649, 1710, 
-    769, -180, -1140, -2113, -3102, -4102, -5116, -6136, -7157, -8171, -9171, -10146, -11086, -11983, -12823, -13600, 
-    -14306, -14936, -15488, -15960, -16354, -16675, -16927, -17117, -17248, -17327, -17356, -17340, -17282, -17183, -17047, -16874, 
-    -16664, -16414, -16124, -15786, -15401, -14964, -14472, -13925, -13320, -12656, -11931, -11144, -10296, -9388, -8426, -7414, 
-    -6362, -5277, -4171, -3054, -1936, -827, 266, 1336, 2378, 3383, 4352, 5278, 6160, 7001, 7799, 8560, 
-    9284, 9976, 10636, 11267, 11866, 12433, 12968, 13466, 13925, 14339, 14706, 15018, 15274, 15473, 15613, 15697, 
-    15723, 15697, 15621, 15497, 15329, 15120, 14872, 14586, 14262, 13896, 13486, 13027, 12515, 11945, 11316, 10624, 
-    9871, 9056, 8184, 7261, 6291, 5283, 4245, 3184, 2107, 1022, -62, -1142, -2210, -3262, -4293, -5299, 
-    -6278, -7224, -8135, -9004, -9829, -10600, -11314, -11964, -12544, -13051, -13479, -13831, -14104, -14303, -14434, -14501, 
-    -14512, -14472, -14388, -14265, -14112, -13931, -13722, -13488, -13222, -12922, -12581, -12194, -11751, -11249, -10682, -10050, 
-    -9359, -8609, -7810, -6971, -6100, -5209, -4306, -3402, -2505, -1622, -758, 83, 902, 1698, 2474, 3234, 
-    3980, 4717, 5446, 6164, 6874, 7569, 8246, 8901, 9526, 10117, 10667, 11173, 11626, 12024, 12363, 12640, 
-    12854, 13005, 13095, 13124, 13097, 13015, 12881, 12700, 12471, 12202, 11893, 11547, 11164, 10745, 10291, 9800, 
-    9276, 8715, 8118, 7487, 6819, 6120, 5388, 4628, 3839, 3027, 2197, 1355, 508, -339, -1182, -2014, 
-    -2831, -3629, -4403, -5150, -5867, -6552, -7202, -7815, -8391, -8930, -9433, -9902, -10340, -10748, -11126, -11474, 
-    -11793, -12083, -12344, -12573, -12768, -12928, -13046, -13121, -13148, -13123, -13040, -12898, -12693, -12422, -12085, -11680, 
-    -11206, -10665, -10058, -9391, -8664, -7887, -7068, -6216, -5341, -4455, -3567, -2688, -1828, -991, -183, 595, 
-    1344, 2064, 2760, 3436, 4097, 4751, 5396, 6037, 6672, 7297, 7908, 8498, 9060, 9586, 10069, 10502, 
-    10883, 11207, 11476, 11691, 11852, 11963, 12032, 12063, 12062, 12035, 11985, 11915, 11830, 11731, 11619, 11493, 
-    11352, 11192, 11011, 10804, 10565, 10289, 9971, 9607, 9189, 8716, 8183, 7592, 6943, 6238, 5483, 4683, 
-    3845, 2978, 2091, 1194, 296, -593, -1467, -2321, -3147, -3942, -4703, -5429, -6117, -6769, -7381, -7958, 
-    -8498, -9003, -9476, -9916, -10327, -10706, -11055, -11374, -11658, -11907, -12118, -12289, -12420, -12507, -12552, -12551, 
-    -12502, -12404, -12257, -12062, -11822, -11538, -11215, -10856, -10462, -10034, -9576, -9087, -8569, -8026, -7464, -6883, 
-    -6292, -5692, -5086, -4478, -3871, -3264, -2659, -2055, -1452, -849, -246, 357, 960, 1563, 2164, 2758, 
-    3343, 3912, 4464, 4994, 5499, 5977, 6426, 6844, 7233, 7593, 7929, 8244, 8538, 8815, 9075, 9316, 
-    9539, 9740, 9917, 10068, 10186, 10269, 10312, 10311, 10266, 10173, 10030, 9839, 9598, 9313, 8986, 8627, 
-    8241, 7835, 7414, 6986, 6555, 6125, 5699, 5277, 4857, 4441, 4020, 3599, 3169, 2731, 2279, 1815, 
-    1337, 848, 349, -153, -653, -1145, -1621, -2076, -2503, -2902, -3267, -3599, -3900, -4168, -4406, -4618, 
-    -4804, -4970, -5117, -5246, -5362, -5462, -5549, -5618, -5672, -5708, -5724, -5724, -5704, -5670, -5624, -5567, 
-    -5505, -5440, -5374, -5305, -5235, -5163, -5088, -5009, -4925, -4832, -4731, -4622, -4503, -4376, -4242, -4101, 
-    -3955, -3807, -3657, -3508, -3360, -3213, -3070, -2928, -2790, -2652, -2512, -2370, -2222, -2067, -1903, -1730, 
-    -1547, -1354, -1151, -938, -716, -486, -252, -13, 223, 456, 681, 894, 1093, 1276, 1443, 1592, 
-    1724, 1841, 1943, 2034, 2116, 2193, 2266, 2337, 2410, 2482, 2557, 2634, 2712, 2790, 2867, 2940, 
-    3011, 3078, 3144, 3206, 3267, 3327, 3386, 3448, 3511, 3580, 3656, 3742, 3839, 3948, 4071, 4207, 
-    4354, 4506, 4660, 4810, 4949, 5074, 5179, 5261, 5313, 5335, 5322, 5275, 5193, 5078, 4932, 4758, 
-    4557, 4332, 4088, 3828, 3553, 3267, 2970, 2665, 2354, 2038, 1718, 1397, 1076, 757, 442, 133, 
-    -168, -464, -751, -1029, -1296, -1551, -1795, -2024, -2242, -2446, -2637, -2815, -2980, -3133, -3275, -3406, 
-    -3531, -3650, -3768, -3888, -4012, -4143, -4287, -4441, -4608, -4788, -4979, -5179, -5387, -5598, -5808, -6015, 
-    -6211, -6394, -6560, -6703, -6825, -6919, -6983, -7017, -7015, -6978, -6903, -6789, -6634, -6437, -6199, -5920, 
-    -5605, -5251, -4869, -4456, -4024, -3576, -3119, -2659, -2203, -1755, -1322, -905, -504, -123, 243, 594, 
-    933, 1264, 1590, 1912, 2233, 2554, 2873, 3189, 3501, 3805, 4099, 4377, 4638, 4879, 5098, 5295, 
-    5470, 5627, 5767, 5896, 6017, 6133, 6248, 6364, 6482, 6601, 6720, 6839, 6953, 7062, 7160, 7246, 
-    7315, 7363, 7387, 7382, 7343, 7271, 7161, 7013, 6826, 6598, 6331, 6023, 5679, 5299, 4887, 4448, 
-    3986, 3506, 3014, 2511, 2003, 1493, 985, 482, -11, -493, -961, -1411, -1840, -2246, -2626, -2978, 
-    -3301, -3593, -3853, -4080, -4275, -4439, -4575, -4682, -4768, -4833, -4883, -4920, -4949, -4971, -4990, -5005, 
-    -5016, -5026, -5032, -5034, -5031, -5021, -5001, -4970, -4925, -4864, -4786, -4687, -4571, -4436, -4285, -4119, 
-    -3947, -3768, -3588, -3413, -3243, -3083, -2933, -2794, -2665, -2543, -2427, -2311, -2193, -2066, -1928, -1775, 
-    -1603, -1411, -1198, -967, -720, -463, -202, 56, 309, 549, 773, 975, 1155, 1309, 1437, 1541, 
-    1621, 1680, 1719, 1742, 1751, 1750, 1738, 1719, 1693, 1662, 1629, 1593, 1558, 1527, 1501, 1482, 
-    1473, 1475, 1488, 1514, 1550, 1599, 1657, 1723, 1795, 1871, 1947, 2022, 2092, 2156, 2214, 2263, 
-    2308, 2347, 2385, 2424, 2466, 2515, 2570, 2636, 2711, 2796, 2888, 2984, 3083, 3176, 3261, 3335, 
-    3391, 3429, 3445, 3440, 3414, 3370, 3309, 3234, 3148, 3054, 2955, 2854, 2754, 2657, 2563, 2472, 
-    2387, 2305, 2225, 2149, 2074, 1999, 1921, 1840, 1753, 1659, 1555, 1441, 1313, 1170, 1013, 839, 
-    646, 437, 207, -38, -303, -583, -879, -1188, -1506, -1831, -2158, -2486, -2811, -3132, -3446, -3754, 
-    -4051, -4338, -4611, -4871, -5116, -5346, -5562, -5762, -5951, -6126, -6290, -6441, -6583, -6710, -6826, -6927, 
-    -7013, -7080, -7125, -7143, -7132, -7090, -7013, -6898, -6744, -6551, -6319, -6053, -5751, -5421, -5067, -4694, 
-    -4308, -3915, -3518, -3121, -2729, -2342, -1963, -1593, -1232, -881, -538, -205, 121, 443, 762, 1079, 
-    1399, 1723, 2056, 2400, 2760, 3138, 3536, 3956, 4397, 4857, 5333, 5820, 6311, 6799, 7279, 7741, 
-    8182, 8595, 8975, 9319, 9625, 9889, 10112, 10293, 10432, 10528, 10583, 10597, 10570, 10503, 10396, 10249, 
-    10061, 9834, 9569, 9267, 8932, 8565, 8167, 7740, 7284, 6799, 6289, 5751, 5190, 4605, 3999, 3375, 
-    2735, 2084, 1426, 765, 106, -544, -1186, -1812, -2424, -3016, -3591, -4146, -4685, -5207, -5715, -6209, 
-    -6693, -7166, -7629, -8078, -8515, -8932, -9334, -9710, -10062, -10384, -10674, -10929, -11147, -11327, -11468, -11568, 
-    -11629, -11650, -11631, -11571, -11474, -11338, -11166, -10955, -10707, -10423, -10100, -9743, -9352, -8927, -8473, -7991, 
-    -7483, -6950, -6396, -5819, -5223, -4607, -3974, -3322, -2653, -1969, -1267, -553, 172, 908, 1650, 2395, 
-    3139, 3878, 4606, 5321, 6015, 6684, 7325, 7933, 8506, 9042, 9537, 9992, 10403, 10772, 11097, 11375, 
-    11609, 11797, 11939, 12037, 12090, 12103, 12074, 12007, 11903, 11762, 11586, 11376, 11131, 10852, 10537, 10188, 
-    9804, 9384, 8931, 8444, 7926, 7380, 6810, 6220, 5613, 4997, 4372, 3746, 3119, 2495, 1873, 1255, 
-    639, 25, -587, -1201, -1813, -2427, -3037, -3643, -4241, -4826, -5396, -5944, -6467, -6960, -7419, -7842, 
-    -8228, -8574, -8883, -9154, -9389, -9590, -9760, -9899, -10010, -10092, -10148, -10174, -10172, -10139, -10071, -9969, 
-    -9828, -9648, -9427, -9164, -8863, -8521, -8144, -7733, -7291, -6824, -6335, -5827, -5307, -4774, -4235, -3691, 
-    -3145, -2598, -2053, -1512, -976, -447, 71, 579, 1074, 1556, 2024, 2476, 2912, 3335, 3743, 4136, 
-    4514, 4877, 5225, 5557, 5874, 6173, 6453, 6712, 6947, 7156, 7337, 7486, 7603, 7686, 7734, 7749, 
-    7729, 7676, 7592, 7478, 7335, 7168, 6976, 6765, 6533, 6284, 6018, 5736, 5440, 5130, 4806, 4468, 
-    4119, 3758, 3386, 3003, 2609, 2204, 1789, 1364, 932, 493, 51, -389, -828, -1257, -1674, -2074, 
-    -2452, -2805, -3128, -3418, -3676, -3899, -4087, -4242, -4365, -4456, -4522, -4563, -4584, -4588, -4576, -4553, 
-    -4520, -4480, -4432, -4380, -4321, -4257, -4186, -4107, -4018, -3916, -3800, -3666, -3512, -3340, -3145, -2930, 
-    -2696, -2446, -2184, -1914, -1643, -1372, -1108, -853, -609, -379, -165, 35, 221, 396, 560, 719, 
-    872, 1024, 1177, 1331, 1489, 1648, 1809, 1972, 2131, 2285, 2432, 2566, 2685, 2784, 2860, 2909, 
-    2931, 2922, 2883, 2816, 2722, 2603, 2464, 2308, 2141, 1964, 1783, 1602, 1420, 1242, 1068, 898, 
-    734, 572, 414, 258, 104, -47, -196, -343, -484, -620, -749, -867, -977, -1075, -1162, -1237, 
-    -1301, -1352, -1394, -1426, -1447, -1459, -1462, -1457, -1443, -1422, -1395, -1361, -1320, -1272, -1216, -1153, 
-    -1082, -1002, -914, -816, -711, -598, -479, -355, -228, -97, 32, 163, 293, 419, 543, 665, 
-    784, 901, 1020, 1137, 1254, 1369, 1482, 1590, 1690, 1779, 1853, 1912, 1951, 1971, 1972, 1955, 
-    1922, 1877, 1821, 1762, 1697, 1635, 1575, 1519, 1466, 1417, 1367, 1316, 1256, 1187, 1104, 1004, 
-    884, 745, 587, 409, 218, 15, -193, -407, -619, -827, -1028, -1219, -1398, -1564, -1718, -1859, 
-    -1990, -2109, -2218, -2321, -2416, -2507, -2590, -2666, -2734, -2790, -2836, -2868, -2885, -2886, -2871, -2838, 
-    -2786, -2715, -2625, -2516, -2387, -2243, -2083, -1908, -1722, -1525, -1318, -1104, -886, -661, -434, -204, 
-    27, 258, 488, 715, 940, 1162, 1380, 1593, 1800, 1999, 2190, 2373, 2545, 2707, 2856, 2994, 
-    3119, 3230, 3328, 3412, 3481, 3534, 3572, 3594, 3598, 3587, 3557, 3513, 3452, 3376, 3287, 3184, 
-    3071, 2947, 2814, 2672, 2522, 2365, 2200, 2030, 1854, 1674, 1489, 1301, 1108, 912, 711, 503, 
-    288, 64, -167, -409, -660, -919, -1187, -1462, -1741, -2024, -2306, -2585, -2856, -3118, -3366, -3597, 
-    -3810, -4003, -4173, -4323, -4449, -4556, -4639, -4704, -4747, -4770, -4773, -4754, -4715, -4654, -4572, -4468, 
-    -4344, -4196, -4027, -3834, -3617, -3376, -3112, -2826, -2520, -2195, -1856, -1504, -1145, -782, -419, -60, 
-    289, 628, 952, 1261, 1552, 1830, 2093, 2346, 2590, 2828, 3061, 3292, 3519, 3742, 3961, 4172, 
-    4376, 4569, 4749, 4913, 5059, 5185, 5287, 5366, 5418, 5443, 5441, 5411, 5355, 5271, 5162, 5029, 
-    4875, 4700, 4510, 4305, 4090, 3865, 3633, 3394, 3151, 2901, 2646, 2382, 2109, 1826, 1528, 1216, 
-    889, 547, 187, -183, -567, -962, -1361, -1763, -2164, -2559, -2945, -3319, -3676, -4015, -4333, -4627, 
-    -4897, -5141, -5359, -5550, -5715, -5853, -5965, -6051, -6113, -6151, -6168, -6162, -6135, -6087, -6017, -5925, 
-    -5810, -5670, -5504, -5312, -5093, -4846, -4572, -4271, -3947, -3598, -3231, -2846, -2449, -2043, -1632, -1220, 
-    -809, -404, -4, 385, 766, 1135, 1494, 1842, 2179, 2509, 2830, 3143, 3451, 3751, 4046, 4333, 
-    4612, 4881, 5137, 5377, 5599, 5799, 5974, 6123, 6242, 6331, 6389, 6416, 6413, 6381, 6320, 6232, 
-    6117, 5976, 5809, 5619, 5405, 5170, 4915, 4639, 4346, 4037, 3711, 3372, 3020, 2655, 2278, 1890, 
-    1490, 1081, 662, 233, -202, -646, -1093, -1541, -1985, -2421, -2844, -3250, -3633, -3991, -4320, -4616, 
-    -4878, -5106, -5301, -5461, -5593, -5694, -5770, -5822, -5853, -5866, -5862, -5842, -5807, -5756, -5688, -5602, 
-    -5495, -5367, -5216, -5042, -4844, -4624, -4384, -4123, -3846, -3552, -3246, -2930, -2605, -2275, -1940, -1601, 
-    -1259, -913, -564, -208, 152, 518, 890, 1267, 1645, 2025, 2402, 2774, 3138, 3491, 3830, 4151, 
-    4454, 4736, 4997, 5233, 5446, 5633, 5793, 5927, 6032, 6108, 6153, 6165, 6146, 6090, 5997, 5869, 
-    5704, 5505, 5272, 5010, 4722, 4412, 4083, 3740, 3385, 3023, 2655, 2284, 1912, 1540, 1168, 797, 
-    429, 63, -299, -659, -1014, -1365, -1709, -2044, -2370, -2685, -2988, -3279, -3556, -3819, -4069, -4303, 
-    -4522, -4726, -4913, -5084, -5238, -5373, -5492, -5590, -5670, -5730, -5769, -5787, -5782, -5755, -5703, -5628, 
-    -5525, -5395, -5239, -5054, -4843, -4602, -4334, -4038, -3715, -3366, -2993, -2596, -2178, -1741, -1288, -823, 
-    -347, 133, 618, 1101, 1580, 2051, 2511, 2957, 3386, 3796, 4185, 4552, 4895, 5214, 5507, 5775, 
-    6016, 6231, 6418, 6577, 6708, 6811, 6884, 6931, 6948, 6937, 6897, 6825, 6725, 6593, 6431, 6237, 
-    6012, 5757, 5474, 5162, 4826, 4467, 4089, 3695, 3290, 2874, 2454, 2028, 1601, 1173, 745, 316, 
-    -115, -549, -990, -1433, -1883, -2336, -2790, -3244, -3692, -4130, -4554, -4957, -5335, -5686, -6003, -6290, 
-    -6541, -6762, -6951, -7113, -7252, -7368, -7466, -7548, -7613, -7662, -7692, -7703, -7686, -7641, -7563, -7448, 
-    -7292, -7094, -6854, -6570, -6247, -5885, -5489, -5062, -4611, -4137, -3646, -3143, -2629, -2108, -1579, -1045, 
-    -506, 37, 586, 1139, 1695, 2252, 2808, 3359, 3903, 4434, 4948, 5442, 5910, 6349, 6756, 7131, 
-    7469, 7772, 8038, 8269, 8466, 8629, 8760, 8859, 8927, 8963, 8968, 8939, 8877, 8779, 8644, 8475, 
-    8266, 8020, 7736, 7417, 7063, 6676, 6262, 5819, 5356, 4872, 4373, 3861, 3338, 2809, 2272, 1732, 
-    1188, 642, 92, -458, -1012, -1564, -2116, -2663, -3205, -3738, -4259, -4765, -5252, -5716, -6155, -6567, 
-    -6947, -7296, -7612, -7895, -8145, -8362, -8546, -8698, -8819, -8910, -8969, -8999, -8998, -8969, -8910, -8823, 
-    -8707, -8563, -8390, -8189, -7959, -7701, -7414, -7098, -6754, -6381, -5980, -5552, -5096, -4615, -4110, -3581, 
-    -3032, -2464, -1879, -1281, -674, -60, 556, 1174, 1789, 2397, 2998, 3587, 4163, 4724, 5267, 5790, 
-    6291, 6768, 7220, 7642, 8035, 8394, 8715, 8999, 9240, 9437, 9588, 9691, 9744, 9748, 9702, 9608, 
-    9469, 9285, 9063, 8803, 8511, 8189, 7843, 7473, 7083, 6676, 6251, 5811, 5355, 4883, 4395, 3891, 
-    3371, 2837, 2289, 1729, 1162, 589, 17, -550, -1110, -1657, -2187, -2699, -3188, -3654, -4096, -4514, 
-    -4909, -5283, -5639, -5977, -6299, -6607, -6902, -7182, -7446, -7693, -7919, -8123, -8299, -8445, -8558, -8636, 
-    -8676, -8676, -8637, -8555, -8434, -8274, -8075, -7841, -7570, -7267, -6934, -6571, -6182, -5769, -5332, -4875, 
-    -4398, -3903, -3393, -2870, -2333, -1789, -1235, -677, -117, 444, 1002, 1554, 2097, 2627, 3140, 3635, 
-    4108, 4556, 4978, 5372, 5738, 6073, 6378, 6649, 6887, 7092, 7261, 7396, 7493, 7558, 7587, 7584, 
-    7549, 7485, 7392, 7276, 7137, 6978, 6800, 6607, 6398, 6175, 5936, 5683, 5412, 5125, 4818, 4492, 
-    4148, 3785, 3405, 3010, 2604, 2188, 1764, 1338, 909, 481, 56, -368, -789, -1209, -1628, -2045, 
-    -2461, -2875, -3287, -3696, -4098, -4490, -4869, -5230, -5568, -5879, -6158, -6403, -6608, -6773, -6896, -6976, 
-    -7015, -7013, -6974, -6897, -6789, -6649, -6484, -6293, -6081, -5848, -5596, -5326, -5038, -4733, -4411, -4074, 
-    -3723, -3358, -2984, -2600, -2208, -1812, -1412, -1011, -610, -211, 183, 573, 958, 1336, 1707, 2070, 
-    2424, 2769, 3102, 3421, 3724, 4009, 4271, 4512, 4728, 4918, 5081, 5217, 5328, 5411, 5470, 5506, 
-    5520, 5512, 5485, 5440, 5377, 5296, 5198, 5082, 4947, 4795, 4623, 4431, 4219, 3989, 3737, 3469, 
-    3182, 2881, 2568, 2244, 1913, 1578, 1242, 907, 576, 252, -63, -370, -668, -956, -1238, -1512, 
-    -1781, -2048, -2312, -2574, -2835, -3092, -3345, -3589, -3823, -4043, -4244, -4422, -4574, -4696, -4786, -4842, 
-    -4864, -4853, -4812, -4742, -4646, -4529, -4393, -4243, -4080, -3907, -3725, -3535, -3336, -3130, -2915, -2690, 
-    -2455, -2210, -1952, -1683, -1404, -1113, -815, -511, -203, 104, 411, 711, 1004, 1286, 1554, 1808, 
-    2043, 2262, 2462, 2644, 2808, 2953, 3083, 3196, 3295, 3379, 3449, 3507, 3550, 3581, 3598, 3600, 
-    3589, 3562, 3519, 3461, 3388, 3298, 3194, 3073, 2938, 2789, 2625, 2449, 2261, 2064, 1856, 1641, 
-    1420, 1193, 964, 732, 500, 270, 43, -178, -396, -605, -809, -1004, -1193, -1372, -1546, -1710, 
-    -1867, -2017, -2157, -2288, -2411, -2522, -2621, -2706, -2778, -2831, -2870, -2891, -2893, -2877, -2842, -2789, 
-    -2718, -2630, -2528, -2411, -2282, -2141, -1992, -1836, -1673, -1505, -1334, -1160, -983, -806, -628, -449, 
-    -270, -90, 88, 270, 450, 632, 812, 990, 1166, 1337, 1504, 1664, 1817, 1961, 2097, 2222, 
-    2337, 2440, 2529, 2607, 2669, 2716, 2749, 2766, 2767, 2752, 2720, 2673, 2611, 2534, 2443, 2340, 
-    2226, 2101, 1968, 1826, 1679, 1525, 1366, 1199, 1026, 847, 659, 462, 257, 44, -179, -408, 
-    -644, -884, -1125, -1365, -1602, -1832, -2054, -2263, -2460, -2641, -2807, -2957, -3091, -3209, -3312, -3402, 
-    -3478, -3543, -3595, -3635, -3664, -3679, -3680, -3666, -3634, -3585, -3514, -3422, -3307, -3168, -3004, -2815, 
-    -2602, -2366, -2110, -1836, -1547, -1246, -936, -618, -300, 21, 338, 653, 963, 1266, 1562, 1850, 
-    2129, 2399, 2660, 2911, 3151, 3380, 3597, 3801, 3992, 4168, 4328, 4470, 4595, 4700, 4787, 4854, 
-    4901, 4927, 4933, 4916, 4880, 4820, 4741, 4642, 4522, 4383, 4227, 4052, 3861, 3655, 3435, 3202, 
-    2954, 2698, 2429, 2152, 1864, 1568, 1263, 951, 631, 304, -27, -366, -707, -1053, -1400, -1746, 
-    -2091, -2431, -2766, -3094, -3412, -3719, -4013, -4293, -4556, -4803, -5032, -5242, -5432, -5600, -5746, -5868, 
-    -5965, -6036, -6079, -6094, -6080, -6037, -5964, -5862, -5732, -5577, -5396, -5193, -4970, -4728, -4471, -4198, 
-    -3913, -3615, -3304, -2983, -2649, -2305, -1950, -1584, -1208, -826, -434, -38, 359, 758, 1153, 1544, 
-    1927, 2299, 2659, 3005, 3337, 3653, 3954, 4239, 4510, 4764, 5005, 5230, 5438, 5629, 5801, 5952, 
-    6081, 6186, 6264, 6314, 6336, 6329, 6293, 6229, 6138, 6023, 5885, 5727, 5550, 5359, 5151, 4933, 
-    4701, 4460, 4206, 3941, 3664, 3373, 3068, 2748, 2412, 2059, 1692, 1309, 913, 506, 90, -329, 
-    -752, -1173, -1588, -1993, -2385, -2760, -3114, -3448, -3757, -4043, -4303, -4540, -4752, -4944, -5115, -5266, 
-    -5402, -5522, -5626, -5717, -5792, -5852, -5896, -5922, -5929, -5914, -5876, -5812, -5721, -5602, -5454, -5279, 
-    -5074, -4844, -4588, -4310, -4013, -3698, -3371, -3031, -2685, -2334, -1980, -1626, -1273, -922, -574, -228, 
-    112, 450, 784, 1114, 1439, 1760, 2074, 2381, 2680, 2968, 3245, 3508, 3755, 3985, 4193, 4380, 
-    4544, 4683, 4796, 4885, 4948, 4986, 5001, 4994, 4967, 4920, 4856, 4778, 4684, 4579, 4460, 4330, 
-    4188, 4034, 3867, 3688, 3496, 3293, 3073, 2843, 2600, 2343, 2077, 1801, 1517, 1226, 931, 632, 
-    332, 31, -269, -569, -865, -1159, -1448, -1733, -2012, -2283, -2547, -2799, -3040, -3266, -3475, -3665, 
-    -3833, -3979, -4099, -4192, -4259, -4297, -4307, -4290, -4247, -4178, -4086, -3974, -3843, -3695, -3533, -3358, 
-    -3171, -2975, -2768, -2553, -2330, -2097, -1856, -1607, -1349, -1086, -816, -541, -263, 14, 292, 566, 
-    834, 1096, 1348, 1590, 1819, 2037, 2241, 2432, 2608, 2771, 2920, 3054, 3174, 3280, 3370, 3445, 
-    3505, 3548, 3575, 3583, 3575, 3548, 3501, 3436, 3351, 3247, 3127, 2988, 2835, 2667, 2487, 2297, 
-    2098, 1891, 1681, 1466, 1250, 1032, 815, 594, 375, 152, -72, -300, -531, -766, -1002, -1241, 
-    -1480, -1718, -1954, -2184, -2410, -2626, -2832, -3026, -3205, -3371, -3520, -3652, -3767, -3864, -3942, -4002, 
-    -4044, -4067, -4072, -4059, -4026, -3975, -3906, -3815, -3707, -3579, -3432, -3265, -3080, -2877, -2656, -2422, 
-    -2170, -1906, -1629, -1341, -1045, -740, -429, -113, 205, 527, 849, 1172, 1492, 1810, 2123, 2431, 
-    2730, 3019, 3297, 3559, 3806, 4033, 4240, 4425, 4585, 4721, 4831, 4916, 4975, 5012, 5025, 5019, 
-    4993, 4952, 4895, 4826, 4744, 4650, 4545, 4427, 4295, 4147, 3984, 3802, 3601, 3380, 3139, 2878, 
-    2597, 2299, 1985, 1660, 1323, 983, 638, 294, -45, -381, -708, -1027, -1338, -1638, -1931, -2214, 
-    -2491, -2762, -3027, -3288, -3546, -3799, -4046, -4290, -4523, -4747, -4957, -5151, -5327, -5480, -5611, -5713, 
-    -5788, -5832, -5848, -5832, -5786, -5712, -5611, -5484, -5334, -5163, -4972, -4764, -4541, -4301, -4048, -3780, 
-    -3499, -3203, -2894, -2572, -2236, -1889, -1531, -1165, -791, -412, -30, 352, 731, 1107, 1475, 1834, 
-    2183, 2518, 2841, 3149, 3442, 3720, 3983, 4231, 4463, 4678, 4878, 5060, 5224, 5370, 5498, 5605, 
-    5691, 5755, 5798, 5817, 5813, 5786, 5735, 5662, 5566, 5451, 5315, 5161, 4990, 4803, 4601, 4383, 
-    4152, 3905, 3646, 3374, 3089, 2793, 2486, 2170, 1846, 1515, 1180, 842, 504, 166, -168, -501, 
-    -829, -1152, -1469, -1780, -2086, -2383, -2674, -2956, -3229, -3491, -3741, -3977, -4198, -4400, -4583, -4746, 
-    -4884, -4999, -5088, -5153, -5192, -5206, -5196, -5163, -5107, -5031, -4936, -4825, -4696, -4553, -4397, -4226, 
-    -4045, -3849, -3643, -3424, -3192, -2949, -2695, -2430, -2155, -1872, -1581, -1286, -985, -685, -385, -88, 
-    203, 487, 762, 1026, 1278, 1518, 1742, 1952, 2147, 2326, 2491, 2643, 2779, 2904, 3016, 3118, 
-    3209, 3291, 3363, 3428, 3482, 3529, 3567, 3594, 3610, 3614, 3604, 3579, 3537, 3480, 3403, 3309, 
-    3198, 3070, 2926, 2768, 2598, 2417, 2228, 2032, 1831, 1625, 1418, 1211, 1001, 792, 585, 377, 
-    172, -30, -230, -427, -618, -805, -984, -1155, -1317, -1467, -1607, -1733, -1846, -1944, -2029, -2097, 
-    -2150, -2186, -2207, -2211, -2201, -2175, -2135, -2083, -2018, -1943, -1859, -1766, -1667, -1561, -1450, -1333, 
-    -1212, -1085, -954, -818, -680, -536, -390, -243, -95, 52, 196, 336, 472, 599, 720, 832, 
-    936, 1033, 1121, 1204, 1279, 1350, 1414, 1476, 1531, 1582, 1626, 1661, 1687, 1704, 1707, 1697, 
-    1673, 1635, 1581, 1514, 1432, 1337, 1229, 1110, 980, 840, 690, 533, 367, 194, 16, -167, 
-    -354, -543, -731, -919, -1102, -1278, -1446, -1606, -1753, -1889, -2013, -2124, -2223, -2311, -2386, -2453, 
-    -2509, -2557, -2595, -2625, -2646, -2657, -2659, -2651, -2632, -2602, -2560, -2505, -2439, -2359, -2268, -2165, 
-    -2050, -1927, -1793, -1650, -1499, -1340, -1174, -1000, -821, -634, -442, -243, -38, 171, 387, 606, 
-    830, 1057, 1286, 1516, 1746, 1974, 2197, 2417, 2629, 2836, 3032, 3219, 3395, 3557, 3707, 3844, 
-    3964, 4070, 4158, 4230, 4285, 4321, 4340, 4339, 4319, 4279, 4220, 4141, 4043, 3925, 3790, 3639, 
-    3472, 3292, 3100, 2898, 2687, 2471, 2248, 2021, 1791, 1555, 1319, 1077, 832, 583, 328, 67, 
-    -198, -470, -747, -1027, -1309, -1591, -1870, -2145, -2413, -2671, -2920, -3156, -3379, -3589, -3785, -3966, 
-    -4134, -4286, -4426, -4551, -4662, -4757, -4836, -4899, -4941, -4966, -4968, -4948, 
-};
-const unsigned int drum_v0_p4_short_len = 5292;
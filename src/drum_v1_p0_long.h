@@ -1,831 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v1_p0_long[] PROGMEM = {
-    -14, 0, 9, 12, 26, 18, 38, 22, 39, 23, 35, 16, 29, 13, 11, 9, 
-    -5, -2, -16, -20, -29, -38, -47, -51, -67, -68, -86, -92, -102, -115, -124, -134, 
-    -150, -158, -172, -187, -195, -213, -225, -239, -253, -270, -279, -300, -309, -327, -345, -351, 
-    -377, -377, -409, -406, -434, -438, -455, -470, -479, -496, -505, -521, -529, -545, -551, -569, 
-    -573, -586, -598, -604, -619, -626, -636, -643, -660, -657, -682, -676, -696, -700, -712, -721, 
-    -727, -741, -745, -761, -763, -779, -782, -799, -801, -818, -821, -836, -838, -856, -854, -875, 
-    -869, -892, -884, -906, -900, -916, -919, -920, -933, -929, -937, -941, -942, -941, -948, -940, 
-    -951, -941, -946, -939, -940, -936, -932, -928, -923, -918, -915, -902, -902, -889, -885, -876, 
-    -868, -857, -849, -839, -824, -821, -803, -794, -783, -765, -758, -736, -730, -708, -696, -678, 
-    -658, -644, -627, -606, -594, -559, -560, -520, -517, -486, -469, -447, -427, -405, -382, -364, 
-    -335, -326, -289, -281, -246, -238, -205, -192, -163, -150, -122, -106, -83, -61, -43, -23, 
-    0, 10, 44, 48, 84, 86, 119, 130, 150, 173, 183, 210, 222, 245, 258, 281, 
-    294, 319, 329, 354, 368, 388, 407, 426, 444, 461, 484, 497, 523, 533, 560, 572, 
-    597, 610, 633, 647, 669, 681, 702, 716, 733, 753, 757, 783, 788, 808, 817, 831, 
-    841, 854, 863, 873, 883, 892, 900, 909, 916, 925, 929, 939, 944, 949, 957, 961, 
-    967, 973, 976, 980, 983, 990, 988, 995, 994, 998, 994, 1002, 990, 1002, 987, 993, 
-    983, 982, 975, 966, 963, 946, 945, 927, 920, 906, 892, 875, 866, 840, 834, 805, 
-    798, 771, 755, 734, 711, 695, 669, 650, 626, 604, 580, 557, 536, 508, 488, 460, 
-    434, 411, 382, 357, 328, 301, 270, 241, 212, 179, 149, 115, 81, 50, 12, -22, 
-    -55, -98, -127, -170, -204, -246, -281, -322, -361, -397, -440, -474, -517, -552, -595, -627, 
-    -671, -706, -741, -782, -811, -853, -883, -921, -951, -986, -1015, -1050, -1078, -1108, -1139, -1162, 
-    -1195, -1215, -1247, -1266, -1294, -1310, -1340, -1352, -1382, -1392, -1419, -1428, -1452, -1462, -1482, -1491, 
-    -1508, -1515, -1530, -1537, -1547, -1555, -1558, -1567, -1569, -1571, -1576, -1568, -1577, -1566, -1568, -1557, 
-    -1556, -1544, -1540, -1519, -1517, -1493, -1487, -1462, -1450, -1425, -1407, -1381, -1357, -1332, -1305, -1276, 
-    -1249, -1209, -1189, -1142, -1121, -1075, -1040, -1005, -958, -926, -878, -838, -794, -747, -704, -654, 
-    -610, -556, -511, -455, -410, -350, -304, -247, -191, -139, -80, -26, 34, 87, 150, 206, 
-    264, 329, 383, 447, 507, 570, 626, 693, 750, 813, 877, 934, 998, 1059, 1120, 1182, 
-    1238, 1305, 1357, 1426, 1474, 1541, 1591, 1656, 1703, 1766, 1812, 1872, 1915, 1976, 2013, 2071, 
-    2110, 2155, 2206, 2237, 2287, 2317, 2358, 2390, 2429, 2452, 2488, 2511, 2538, 2558, 2585, 2597, 
-    2620, 2632, 2644, 2657, 2662, 2670, 2671, 2677, 2667, 2672, 2660, 2653, 2643, 2621, 2616, 2583, 
-    2573, 2539, 2515, 2484, 2453, 2413, 2379, 2332, 2295, 2244, 2197, 2147, 2088, 2040, 1972, 1917, 
-    1851, 1784, 1718, 1647, 1575, 1498, 1425, 1343, 1265, 1182, 1097, 1010, 924, 833, 744, 652, 
-    553, 465, 361, 267, 167, 65, -35, -137, -243, -347, -451, -559, -668, -774, -885, -993, 
-    -1105, -1210, -1332, -1428, -1556, -1653, -1777, -1880, -1999, -2103, -2219, -2326, -2440, -2543, -2660, -2758, 
-    -2873, -2973, -3081, -3182, -3286, -3384, -3486, -3583, -3679, -3777, -3868, -3960, -4051, -4140, -4229, -4309, 
-    -4400, -4472, -4562, -4635, -4710, -4787, -4855, -4928, -4993, -5058, -5120, -5180, -5238, -5291, -5341, -5390, 
-    -5433, -5476, -5513, -5545, -5580, -5595, -5627, -5633, -5655, -5655, -5659, -5657, -5646, -5637, -5613, -5592, 
-    -5559, -5525, -5484, -5433, -5381, -5323, -5254, -5186, -5105, -5024, -4932, -4838, -4733, -4629, -4510, -4395, 
-    -4264, -4137, -3992, -3856, -3694, -3552, -3377, -3218, -3042, -2859, -2682, -2484, -2293, -2092, -1883, -1678, 
-    -1458, -1241, -1016, -785, -559, -315, -83, 164, 405, 657, 901, 1164, 1404, 1675, 1916, 2184, 
-    2436, 2693, 2953, 3205, 3466, 3712, 3978, 4211, 4478, 4708, 4961, 5197, 5436, 5666, 5899, 6118, 
-    6345, 6553, 6773, 6973, 7179, 7370, 7566, 7744, 7930, 8094, 8271, 8420, 8588, 8723, 8877, 9003, 
-    9138, 9256, 9374, 9485, 9582, 9687, 9766, 9859, 9928, 10002, 10065, 10122, 10170, 10218, 10251, 10287, 
-    10309, 10325, 10345, 10341, 10352, 10336, 10328, 10312, 10285, 10258, 10217, 10183, 10129, 10084, 10020, 9959, 
-    9892, 9812, 9739, 9649, 9561, 9467, 9363, 9257, 9147, 9025, 8911, 8777, 8641, 8508, 8355, 8211, 
-    8046, 7888, 7712, 7541, 7353, 7161, 6968, 6754, 6547, 6322, 6093, 5855, 5609, 5347, 5093, 4810, 
-    4536, 4238, 3939, 3628, 3312, 2978, 2643, 2294, 1941, 1572, 1201, 818, 424, 32, -385, -791, 
-    -1216, -1647, -2078, -2526, -2970, -3426, -3886, -4350, -4817, -5292, -5767, -6245, -6729, -7215, -7692, -8188, 
-    -8660, -9161, -9631, -10124, -10594, -11078, -11543, -12013, -12472, -12930, -13370, -13817, -14236, -14665, -15066, -15467, 
-    -15851, -16220, -16578, -16924, -17244, -17567, -17854, -18137, -18396, -18642, -18866, -19079, -19266, -19434, -19595, -19721, 
-    -19843, -19940, -20018, -20084, -20128, -20156, -20174, -20167, -20153, -20121, -20073, -20023, -19944, -19873, -19771, -19680, 
-    -19562, -19450, -19314, -19187, -19041, -18893, -18740, -18574, -18411, -18233, -18052, -17862, -17669, -17462, -17250, -17028, 
-    -16793, -16553, -16298, -16026, -15751, -15453, -15145, -14826, -14481, -14136, -13763, -13383, -12986, -12574, -12156, -11719, 
-    -11280, -10825, -10371, -9906, -9442, -8981, -8509, -8057, -7591, -7150, -6703, -6273, -5847, -5436, -5024, -4637, 
-    -4239, -3863, -3476, -3101, -2713, -2330, -1924, -1510, -1077, -615, -133, 393, 952, 1550, 2202, 2893, 
-    3642, 4447, 5301, 6218, 7186, 8241, 9332, 10460, 11646, 12850, 14107, 15360, 16651, 17934, 19230, 20508, 
-    21772, 23010, 24238, 25431, 26582, 27684, 27793, 27786, 27793, 27788, 27790, 27792, 27789, 27791, 27790, 27789, 
-    27792, 27790, 27789, 27791, 27789, 27790, 27792, 27789, 27791, 27791, 27788, 27795, 27785, 27796, 27787, 27789, 
-    27792, 27786, 27796, 27784, 27795, 27781, 27796, 27784, 27792, 27790, 27789, 27792, 27789, 27790, 27792, 27788, 
-    27792, 27789, 27790, 27789, 27790, 27790, 27791, 27788, 27793, 27784, 27796, 27785, 26412, 24957, 23495, 22022, 
-    20557, 19086, 17603, 16148, 14698, 13278, 11863, 10481, 9116, 7821, 6551, 5352, 4184, 3082, 2040, 1061, 
-    147, -720, -1536, -2332, -3083, -3835, -4548, -5269, -5947, -6650, -7342, -8056, -8778, -9508, -10255, -11005, 
-    -11777, -12560, -13395, -14252, -15148, -16062, -16991, -17937, -18891, -19857, -20823, -21783, -22750, -23705, -24664, -25606, 
-    -26530, -27425, -27844, -27842, -27844, -27843, -27842, -27845, -27842, -27845, -27840, -27845, -27841, -27844, -27841, -27843, 
-    -27842, -27841, -27844, -27839, -27845, -27840, -27846, -27840, -27844, -27840, -27844, -27843, -27845, -27840, -27845, -27843, 
-    -27843, -27844, -27842, -27845, -27840, -27848, -27838, -27847, -27839, -27846, -27841, -27841, -27842, -27838, -27847, -27837, 
-    -27846, -27840, -27846, -27840, -27847, -27839, -27845, -27845, -27836, -27851, -27835, -27850, -27839, -27845, -27840, -27845, 
-    -27841, -27843, -27842, -27841, -27845, -27840, -27847, -27838, -27848, -27842, -27710, -26187, -24638, -23062, -21478, -19863, 
-    -18249, -16616, -14995, -13373, -11774, -10197, -8644, -7136, -5642, -4189, -2755, -1348, 35, 1392, 2723, 4027, 
-    5304, 6563, 7796, 9023, 10218, 11413, 12566, 13721, 14845, 15956, 17058, 18143, 19222, 20304, 21367, 22459, 
-    23524, 24613, 25692, 26768, 27793, 27786, 27795, 27786, 27794, 27788, 27793, 27787, 27793, 27788, 27790, 27790, 
-    27791, 27789, 27790, 27790, 27790, 27791, 27790, 27790, 27790, 27789, 27790, 27791, 27790, 27789, 27792, 27788, 
-    27794, 27789, 27791, 27789, 27791, 27790, 27790, 27792, 27787, 27794, 27788, 27793, 27789, 27789, 27792, 27788, 
-    27793, 27789, 27789, 27792, 27787, 27794, 27788, 27791, 27791, 27789, 27789, 27794, 27784, 27798, 27783, 27798, 
-    27784, 27795, 27786, 27793, 27788, 27794, 27788, 27792, 27789, 27790, 27790, 27791, 27788, 27793, 27788, 27792, 
-    27789, 27793, 27787, 27795, 27788, 27791, 27789, 26878, 25162, 23438, 21679, 19906, 18113, 16308, 14493, 12673, 
-    10834, 8985, 7125, 5264, 3397, 1544, -310, -2143, -3968, -5774, -7543, -9298, -11005, -12692, -14328, -15937, 
-    -17491, -19018, -20491, -21931, -23334, -24693, -26031, -27326, -27840, -27846, -27841, -27846, -27842, -27844, -27840, -27848, 
-    -27838, -27848, -27840, -27843, -27844, -27842, -27845, -27840, -27847, -27838, -27847, -27838, -27847, -27839, -27845, -27843, 
-    -27840, -27848, -27835, -27849, -27838, -27847, -27843, -27841, -27846, -27838, -27847, -27840, -27843, -27841, -27843, -27842, 
-    -27842, -27846, -27840, -27848, -27839, -27846, -27841, -27845, -27840, -27845, -27838, -27846, -27842, -27842, -27844, -27841, 
-    -27843, -27844, -27843, -27845, -27841, -27844, -27843, -27843, -27845, -27840, -27845, -27838, -27848, -27837, -27850, -27834, 
-    -27850, -27835, -27847, -27839, -27843, -27844, -27843, -27844, -27842, -27845, -27839, -27845, -27841, -27845, -27841, -27845, 
-    -27839, -26285, -23881, -21470, -19025, -16571, -14107, -11626, -9167, -6690, -4246, -1800, 606, 2994, 5353, 7674, 
-    9978, 12229, 14456, 16636, 18774, 20867, 22919, 24917, 26875, 27793, 27786, 27795, 27788, 27791, 27793, 27785, 
-    27797, 27785, 27793, 27790, 27788, 27794, 27787, 27792, 27790, 27789, 27790, 27791, 27787, 27794, 27789, 27790, 
-    27792, 27788, 27792, 27789, 27790, 27791, 27789, 27791, 27791, 27788, 27793, 27789, 27790, 27791, 27789, 27793, 
-    27788, 27793, 27789, 27789, 27793, 27787, 27794, 27789, 27791, 27790, 27791, 27788, 27795, 27785, 27797, 27786, 
-    27793, 27789, 27790, 27789, 27789, 27789, 27790, 27790, 27789, 27792, 27787, 27793, 27790, 27789, 27791, 27790, 
-    27789, 27792, 27790, 27788, 27792, 27790, 27789, 27793, 27789, 27790, 27791, 27789, 27791, 27791, 27789, 27791, 
-    27790, 27789, 27792, 27788, 27792, 27789, 25552, 23277, 20953, 18623, 16254, 13883, 11490, 9094, 6690, 4293, 
-    1888, -486, -2864, -5202, -7532, -9826, -12102, -14338, -16555, -18724, -20879, -22968, -25053, -27067, -27847, -27841, 
-    -27842, -27846, -27839, -27847, -27841, -27844, -27844, -27842, -27843, -27844, -27842, -27844, -27843, -27842, -27844, -27844, 
-    -27839, -27848, -27839, -27846, -27843, -27842, -27844, -27841, -27845, -27844, -27842, -27844, -27843, -27841, -27847, -27841, 
-    -27845, -27843, -27843, -27844, -27842, -27846, -27840, -27845, -27841, -27839, -27846, -27835, -27848, -27838, -27845, -27844, 
-    -27842, -27843, -27841, -27843, -27843, -27844, -27843, -27844, -27841, -27844, -27842, -27842, -27843, -27839, -27845, -27838, 
-    -27847, -27837, -27848, -27839, -27842, -27844, -27841, -27845, -27840, -27846, -27835, -27848, -27836, -27847, -27840, -27848, 
-    -27838, -27848, -27838, -27848, -27838, -27846, -27838, -27844, -27843, -27843, -27844, -27843, -27748, -25759, -23737, -21666, 
-    -19575, -17436, -15287, -13108, -10917, -8718, -6507, -4306, -2110, 69, 2233, 4361, 6480, 8548, 10602, 12606, 
-    14594, 16529, 18453, 20309, 22172, 23961, 25756, 27497, 27792, 27790, 27789, 27794, 27787, 27794, 27788, 27793, 
-    27789, 27791, 27790, 27789, 27792, 27790, 27789, 27793, 27788, 27793, 27789, 27790, 27790, 27789, 27792, 27789, 
-    27789, 27790, 27789, 27791, 27789, 27788, 27791, 27787, 27790, 27791, 27786, 27792, 27789, 27790, 27789, 27791, 
-    27787, 27793, 27789, 27791, 27790, 27790, 27790, 27791, 27789, 27793, 27787, 27793, 27788, 27790, 27790, 27790, 
-    27788, 27794, 27788, 27790, 27792, 27789, 27792, 27788, 27793, 27786, 27795, 27786, 27795, 27786, 27792, 27789, 
-    27790, 27790, 27787, 27792, 27789, 27792, 27790, 27789, 27791, 27792, 27787, 27793, 27786, 27791, 27789, 27789, 
-    27791, 27788, 27779, 25960, 24136, 22285, 20422, 18539, 16643, 14715, 12789, 10820, 8852, 6845, 4837, 2792, 
-    747, -1330, -3411, -5514, -7617, -9746, -11867, -14011, -16146, -18289, -20427, -22556, -24683, -26784, -27849, -27838, 
-    -27847, -27841, -27841, -27844, -27842, -27845, -27841, -27842, -27840, -27846, -27837, -27846, -27842, -27840, -27846, -27837, 
-    -27844, -27841, -27844, -27843, -27841, -27846, -27835, -27850, -27836, -27845, -27844, -27840, -27848, -27839, -27847, -27840, 
-    -27847, -27842, -27843, -27843, -27843, -27842, -27842, -27844, -27840, -27845, -27843, -27844, -27843, -27844, -27843, -27844, 
-    -27844, -27840, -27845, -27841, -27843, -27843, -27843, -27841, -27843, -27843, -27842, -27847, -27839, -27846, -27841, -27844, 
-    -27844, -27842, -27844, -27843, -27843, -27842, -27845, -27842, -27844, -27845, -27841, -27846, -27842, -27844, -27841, -27846, 
-    -27837, -27848, -27838, -26389, -24423, -22448, -20457, -18452, -16430, -14406, -12358, -10318, -8261, -6208, -4153, -2102, 
-    -65, 1968, 3971, 5972, 7932, 9882, 11798, 13681, 15545, 17360, 19150, 20902, 22605, 24287, 25906, 27507, 
-    27789, 27789, 27793, 27785, 27795, 27786, 27793, 27789, 27789, 27792, 27789, 27791, 27791, 27787, 27795, 27785, 
-    27795, 27787, 27791, 27791, 27786, 27796, 27784, 27797, 27782, 27796, 27784, 27793, 27787, 27792, 27787, 27794, 
-    27786, 27793, 27789, 27790, 27788, 27795, 27785, 27796, 27786, 27792, 27787, 27792, 27788, 27790, 27792, 27787, 
-    27796, 27785, 27795, 27786, 27793, 27788, 27792, 27790, 27790, 27790, 27789, 27791, 27788, 27793, 27789, 27791, 
-    27791, 27789, 27791, 27791, 27789, 27793, 27788, 27793, 27787, 27792, 27790, 27790, 27790, 27790, 27788, 27794, 
-    27789, 27791, 27789, 27789, 27793, 27788, 26014, 24044, 22097, 20157, 18233, 16322, 14430, 12545, 10681, 8825, 
-    6980, 5137, 3310, 1476, -343, -2174, -3994, -5831, -7653, -9497, -11331, -13178, -15020, -16858, -18697, -20519, 
-    -22338, -24129, -25909, -27650, -27847, -27840, -27847, -27841, -27845, -27841, -27846, -27843, -27842, -27844, -27841, -27842, 
-    -27847, -27838, -27849, -27837, -27846, -27843, -27843, -27843, -27839, -27846, -27837, -27847, -27836, -27846, -27841, -27844, 
-    -27841, -27844, -27843, -27843, -27844, -27841, -27844, -27844, -27841, -27845, -27843, -27843, -27842, -27846, -27839, -27847, 
-    -27840, -27846, -27840, -27845, -27841, -27842, -27846, -27840, -27845, -27841, -27845, -27842, -27844, -27843, -27842, -27843, 
-    -27845, -27841, -27846, -27842, -27841, -27845, -27840, -27844, -27843, -27842, -27844, -27843, -27843, -27842, -27845, -27842, 
-    -27843, -27844, -27841, -27845, -27843, -27841, -27847, -27839, -27846, -27842, -27842, -26414, -24773, -23091, -21388, -19653, 
-    -17885, -16103, -14283, -12455, -10594, -8724, -6824, -4926, -2993, -1065, 891, 2857, 4832, 6834, 8832, 10857, 
-    12879, 14911, 16946, 18978, 21017, 23038, 25071, 27072, 27793, 27790, 27789, 27792, 27789, 27791, 27788, 27792, 
-    27788, 27794, 27786, 27794, 27785, 27796, 27783, 27798, 27784, 27797, 27784, 27795, 27786, 27793, 27787, 27792, 
-    27787, 27792, 27787, 27793, 27789, 27790, 27791, 27787, 27793, 27788, 27792, 27789, 27790, 27789, 27793, 27789, 
-    27792, 27788, 27790, 27791, 27789, 27789, 27792, 27786, 27792, 27788, 27791, 27789, 27789, 27793, 27786, 27794, 
-    27787, 27792, 27788, 27789, 27789, 27789, 27792, 27787, 27794, 27785, 27398, 26356, 25333, 24295, 23273, 22242, 
-    21238, 20221, 19241, 18247, 17291, 16329, 15396, 14464, 13552, 12648, 11746, 10864, 9964, 9085, 8182, 7297, 
-    6375, 5462, 4512, 3556, 2562, 1549, 501, -580, -1690, -2842, -4020, -5237, -6485, -7756, -9075, -10396, 
-    -11766, -13148, -14549, -15970, -17411, -18847, -20308, -21753, -23201, -24646, -26063, -27482, -27837, -27845, -27839, -27846, 
-    -27838, -27848, -27840, -27842, -27846, -27840, -27846, -27842, -27841, -27845, -27842, -27843, -27844, -27842, -27842, -27843, 
-    -27841, -27841, -27842, -27841, -27841, -27843, -27845, -27840, -27846, -27841, -27844, -27844, -27842, -27843, -27843, -27844, 
-    -27840, -27844, -27840, -27843, -27842, -27844, -27842, -27844, -27841, -27842, -27844, -27838, -27848, -27835, -27850, -27837, 
-    -27848, -27840, -27842, -27844, -27244, -25982, -24695, -23414, -22123, -20832, -19542, -18250, -16967, -15680, -14407, -13141, 
-    -11878, -10641, -9398, -8188, -6981, -5801, -4630, -3492, -2357, -1268, -182, 862, 1893, 2893, 3863, 4813, 
-    5725, 6613, 7473, 8304, 9111, 9893, 10654, 11394, 12120, 12828, 13526, 14218, 14897, 15578, 16256, 16931, 
-    17611, 18299, 18980, 19689, 20383, 21109, 21818, 22561, 23287, 24038, 24786, 25539, 26302, 27052, 27788, 27795, 
-    27786, 27794, 27789, 27791, 27790, 27791, 27788, 27790, 27789, 27789, 27791, 27789, 27792, 27789, 27789, 27792, 
-    27786, 27795, 27785, 27795, 27787, 27796, 27785, 27795, 27788, 27790, 27791, 27787, 27792, 27789, 27791, 27789, 
-    27793, 27787, 27794, 27787, 27792, 27789, 27790, 27791, 27789, 27791, 27604, 27013, 26401, 25755, 25086, 24374, 
-    23631, 22845, 22023, 21154, 20251, 19293, 18307, 17270, 16206, 15099, 13959, 12797, 11593, 10391, 9149, 7916, 
-    6663, 5419, 4175, 2949, 1738, 541, -623, -1765, -2875, -3943, -4985, -5982, -6947, -7864, -8758, -9598, 
-    -10426, -11202, -11975, -12702, -13432, -14124, -14819, -15499, -16168, -16843, -17497, -18173, -18824, -19498, -20149, -20814, 
-    -21469, -22125, -22776, -23423, -24054, -24683, -25290, -25885, -26458, -27009, -27539, -27840, -27843, -27843, -27842, -27845, 
-    -27839, -27845, -27840, -27844, -27843, -27841, -27843, -27841, -27843, -27842, -27844, -27843, -27843, -27843, -27843, -27845, 
-    -27842, -27843, -27843, -27842, -27845, -27843, -27843, -27843, -27843, -27843, -27845, -27841, -27844, -27782, -27387, -26982, 
-    -26530, -26074, -25576, -25056, -24504, -23926, -23309, -22665, -21986, -21273, -20529, -19749, -18938, -18097, -17224, -16321, 
-    -15396, -14440, -13472, -12479, -11479, -10463, -9440, -8414, -7383, -6357, -5325, -4312, -3294, -2296, -1309, -328, 
-    624, 1575, 2506, 3419, 4327, 5210, 6091, 6946, 7801, 8632, 9466, 10272, 11090, 11880, 12677, 13452, 
-    14231, 14990, 15742, 16483, 17208, 17922, 18614, 19295, 19948, 20590, 21200, 21790, 22356, 22894, 23403, 23886, 
-    24332, 24758, 25146, 25500, 25834, 26120, 26395, 26616, 26831, 26994, 27153, 27261, 27361, 27421, 27470, 27482, 
-    27482, 27452, 27400, 27331, 27232, 27126, 26985, 26838, 26673, 26479, 26292, 26062, 25837, 25581, 25318, 25038, 
-    24740, 24433, 24110, 23770, 23430, 23063, 22701, 22317, 21933, 21531, 21131, 20709, 20296, 19855, 19425, 18968, 
-    18516, 18044, 17569, 17073, 16574, 16055, 15528, 14989, 14426, 13861, 13267, 12676, 12052, 11428, 10775, 10115, 
-    9434, 8733, 8023, 7285, 6543, 5774, 4991, 4195, 3379, 2559, 1718, 870, 8, -849, -1730, -2598, 
-    -3482, -4363, -5237, -6118, -6982, -7845, -8697, -9532, -10356, -11158, -11944, -12710, -13451, -14170, -14863, -15531, 
-    -16171, -16791, -17371, -17938, -18469, -18977, -19462, -19914, -20359, -20762, -21168, -21535, -21895, -22240, -22558, -22872, 
-    -23167, -23447, -23716, -23968, -24205, -24430, -24632, -24819, -24980, -25127, -25239, -25336, -25395, -25432, -25435, -25401, 
-    -25341, -25240, -25109, -24941, -24743, -24507, -24249, -23956, -23640, -23298, -22939, -22560, -22159, -21755, -21332, -20908, 
-    -20482, -20051, -19619, -19207, -18776, -18381, -17970, -17588, -17198, -16835, -16460, -16108, -15748, -15397, -15041, -14686, 
-    -14324, -13943, -13563, -13155, -12736, -12296, -11830, -11339, -10828, -10283, -9710, -9117, -8489, -7843, -7172, -6484, 
-    -5771, -5051, -4310, -3564, -2810, -2051, -1291, -532, 217, 966, 1700, 2420, 3130, 3814, 4484, 5143, 
-    5765, 6389, 6979, 7555, 8124, 8656, 9192, 9694, 10202, 10669, 11156, 11599, 12053, 12489, 12914, 13339, 
-    13751, 14152, 14560, 14943, 15344, 15711, 16098, 16452, 16820, 17164, 17504, 17835, 18158, 18465, 18771, 19053, 
-    19330, 19591, 19827, 20054, 20253, 20430, 20585, 20715, 20811, 20888, 20924, 20942, 20918, 20874, 20787, 20688, 
-    20540, 20381, 20183, 19965, 19726, 19457, 19182, 18875, 18560, 18225, 17879, 17523, 17151, 16776, 16386, 15997, 
-    15593, 15200, 14785, 14391, 13977, 13586, 13174, 12785, 12376, 11989, 11590, 11199, 10808, 10420, 10035, 9646, 
-    9266, 8881, 8506, 8122, 7750, 7372, 7002, 6636, 6267, 5902, 5546, 5182, 4834, 4479, 4129, 3779, 
-    3434, 3078, 2737, 2380, 2033, 1679, 1324, 968, 609, 247, -114, -490, -852, -1239, -1600, -1997, 
-    -2359, -2762, -3129, -3528, -3909, -4298, -4692, -5082, -5474, -5868, -6260, -6652, -7051, -7442, -7840, -8229, 
-    -8626, -9010, -9403, -9777, -10157, -10524, -10886, -11240, -11580, -11913, -12226, -12537, -12812, -13091, -13332, -13570, 
-    -13772, -13967, -14127, -14277, -14396, -14501, -14578, -14637, -14679, -14692, -14701, -14675, -14652, -14593, -14544, -14461, 
-    -14375, -14287, -14169, -14071, -13944, -13822, -13701, -13562, -13436, -13296, -13151, -13017, -12857, -12718, -12552, -12391, 
-    -12216, -12035, -11837, -11629, -11407, -11163, -10915, -10634, -10351, -10042, -9725, -9391, -9042, -8689, -8319, -7950, 
-    -7570, -7190, -6809, -6429, -6052, -5687, -5320, -4980, -4639, -4329, -4025, -3748, -3491, -3255, -3042, -2861, 
-    -2688, -2557, -2428, -2340, -2253, -2204, -2148, -2126, -2094, -2088, -2069, -2065, -2051, -2034, -2012, -1979, 
-    -1936, -1879, -1811, -1723, -1631, -1509, -1384, -1236, -1072, -905, -706, -512, -289, -73, 163, 401, 
-    651, 901, 1166, 1419, 1690, 1952, 2221, 2485, 2755, 3008, 3280, 3525, 3791, 4032, 4291, 4531, 
-    4783, 5022, 5270, 5516, 5759, 6011, 6259, 6507, 6764, 7016, 7270, 7525, 7780, 8028, 8275, 8522, 
-    8748, 8982, 9191, 9390, 9582, 9742, 9894, 10022, 10124, 10209, 10262, 10293, 10299, 10275, 10237, 10164, 
-    10075, 9963, 9830, 9683, 9518, 9345, 9162, 8973, 8780, 8585, 8393, 8209, 8023, 7859, 7694, 7551, 
-    7416, 7303, 7199, 7118, 7052, 6998, 6972, 6949, 6948, 6959, 6974, 7006, 7037, 7072, 7115, 7140, 
-    7181, 7195, 7213, 7216, 7200, 7178, 7131, 7073, 6990, 6892, 6767, 6632, 6467, 6291, 6094, 5880, 
-    5651, 5408, 5154, 4885, 4614, 4327, 4044, 3753, 3456, 3176, 2875, 2611, 2326, 2071, 1822, 1584, 
-    1367, 1161, 973, 802, 648, 512, 390, 286, 193, 110, 42, -22, -78, -129, -183, -229, 
-    -281, -335, -392, -464, -538, -625, -725, -835, -957, -1101, -1239, -1415, -1581, -1773, -1969, -2175, 
-    -2385, -2612, -2823, -3051, -3266, -3478, -3693, -3883, -4077, -4247, -4416, -4558, -4695, -4806, -4918, -4992, 
-    -5082, -5119, -5184, -5201, -5238, -5245, -5266, -5263, -5280, -5277, -5295, -5305, -5327, -5358, -5388, -5440, 
-    -5493, -5557, -5638, -5718, -5822, -5927, -6041, -6172, -6294, -6436, -6573, -6712, -6855, -6994, -7122, -7255, 
-    -7373, -7480, -7589, -7671, -7748, -7812, -7855, -7888, -7909, -7905, -7907, -7878, -7855, -7813, -7763, -7721, 
-    -7653, -7604, -7534, -7476, -7418, -7350, -7299, -7245, -7188, -7157, -7099, -7080, -7039, -7025, -6993, -6989, 
-    -6966, -6965, -6958, -6949, -6956, -6945, -6949, -6944, -6937, -6930, -6913, -6896, -6872, -6836, -6802, -6751, 
-    -6703, -6630, -6571, -6469, -6391, -6268, -6162, -6019, -5884, -5713, -5554, -5358, -5165, -4949, -4724, -4484, 
-    -4234, -3972, -3697, -3415, -3117, -2811, -2499, -2177, -1851, -1520, -1185, -844, -510, -164, 167, 502, 
-    833, 1152, 1473, 1776, 2079, 2363, 2646, 2914, 3169, 3421, 3656, 3881, 4108, 4309, 4522, 4715, 
-    4911, 5102, 5286, 5477, 5658, 5852, 6036, 6228, 6419, 6617, 6809, 7016, 7210, 7417, 7623, 7825, 
-    8033, 8232, 8433, 8635, 8825, 9023, 9201, 9392, 9558, 9734, 9897, 10051, 10207, 10346, 10485, 10617, 
-    10738, 10861, 10969, 11085, 11187, 11292, 11391, 11483, 11582, 11669, 11761, 11845, 11929, 12007, 12085, 12153, 
-    12217, 12274, 12324, 12359, 12383, 12401, 12389, 12382, 12339, 12295, 12222, 12132, 12026, 11889, 11740, 11562, 
-    11362, 11147, 10901, 10641, 10358, 10053, 9741, 9389, 9050, 8665, 8292, 7886, 7486, 7060, 6646, 6203, 
-    5774, 5330, 4888, 4449, 4003, 3574, 3137, 2715, 2293, 1880, 1478, 1082, 696, 316, -44, -404, 
-    -749, -1082, -1407, -1718, -2016, -2309, -2582, -2853, -3102, -3350, -3578, -3804, -4012, -4214, -4406, -4587, 
-    -4766, -4934, -5094, -5258, -5399, -5555, -5693, -5829, -5968, -6094, -6220, -6345, -6459, -6578, -6687, -6793, 
-    -6895, -6985, -7087, -7161, -7254, -7325, -7398, -7471, -7529, -7596, -7646, -7706, -7752, -7804, -7852, -7898, 
-    -7948, -7989, -8046, -8086, -8141, -8193, -8240, -8309, -8356, -8423, -8484, -8546, -8615, -8678, -8743, -8811, 
-    -8872, -8936, -8992, -9046, -9099, -9143, -9187, -9220, -9248, -9271, -9281, -9291, -9281, -9283, -9252, -9234, 
-    -9200, -9151, -9117, -9046, -8997, -8924, -8853, -8778, -8688, -8609, -8510, -8416, -8319, -8210, -8111, -7993, 
-    -7890, -7759, -7657, -7517, -7401, -7264, -7123, -6985, -6831, -6678, -6511, -6346, -6166, -5988, -5791, -5596, 
-    -5376, -5165, -4919, -4689, -4425, -4169, -3889, -3605, -3309, -3008, -2694, -2379, -2057, -1729, -1402, -1066, 
-    -736, -407, -78, 241, 560, 867, 1166, 1457, 1726, 1996, 2236, 2473, 2690, 2886, 3075, 3238, 
-    3391, 3526, 3639, 3751, 3830, 3915, 3971, 4025, 4074, 4102, 4140, 4160, 4185, 4205, 4232, 4249, 
-    4284, 4306, 4348, 4387, 4435, 4489, 4550, 4618, 4693, 4779, 4866, 4968, 5065, 5172, 5285, 5396, 
-    5511, 5630, 5739, 5857, 5970, 6077, 6183, 6288, 6383, 6486, 6573, 6663, 6750, 6822, 6909, 6968, 
-    7051, 7106, 7182, 7236, 7308, 7365, 7433, 7504, 7567, 7650, 7721, 7811, 7895, 7990, 8088, 8192, 
-    8303, 8415, 8533, 8654, 8778, 8897, 9024, 9135, 9260, 9365, 9471, 9569, 9649, 9728, 9788, 9838, 
-    9869, 9887, 9888, 9874, 9836, 9783, 9710, 9619, 9513, 9383, 9240, 9078, 8902, 8708, 8506, 8281, 
-    8054, 7806, 7556, 7288, 7022, 6739, 6452, 6165, 5864, 5571, 5265, 4967, 4658, 4361, 4051, 3760, 
-    3454, 3170, 2877, 2597, 2326, 2055, 1801, 1552, 1313, 1087, 869, 665, 470, 291, 121, -32, 
-    -180, -310, -433, -541, -642, -736, -816, -894, -968, -1030, -1106, -1164, -1239, -1304, -1381, -1459, 
-    -1547, -1637, -1739, -1845, -1965, -2093, -2232, -2387, -2544, -2723, -2899, -3103, -3297, -3517, -3735, -3964, 
-    -4203, -4441, -4691, -4939, -5199, -5451, -5713, -5975, -6229, -6500, -6749, -7016, -7264, -7522, -7773, -8022, 
-    -8273, -8510, -8761, -8986, -9231, -9450, -9683, -9893, -10109, -10312, -10502, -10698, -10862, -11040, -11185, -11332, 
-    -11461, -11578, -11680, -11770, -11841, -11903, -11951, -11978, -12003, -12004, -11999, -11983, -11949, -11909, -11856, -11792, 
-    -11719, -11639, -11545, -11450, -11341, -11231, -11110, -10986, -10852, -10720, -10578, -10428, -10286, -10121, -9976, -9806, 
-    -9648, -9484, -9318, -9150, -8991, -8812, -8661, -8483, -8328, -8161, -8005, -7841, -7692, -7532, -7386, -7237, 
-    -7095, -6952, -6817, -6675, -6545, -6412, -6281, -6150, -6019, -5882, -5754, -5611, -5474, -5324, -5172, -5011, 
-    -4847, -4670, -4487, -4294, -4092, -3878, -3657, -3420, -3181, -2918, -2660, -2370, -2089, -1782, -1471, -1148, 
-    -808, -470, -103, 254, 641, 1024, 1423, 1833, 2245, 2671, 3095, 3539, 3974, 4427, 4872, 5331, 
-    5786, 6243, 6705, 7157, 7615, 8065, 8512, 8961, 9391, 9832, 10246, 10675, 11079, 11482, 11876, 12258, 
-    12635, 13000, 13359, 13705, 14046, 14371, 14694, 15010, 15306, 15605, 15881, 16165, 16423, 16684, 16924, 17161, 
-    17391, 17602, 17808, 18004, 18185, 18356, 18521, 18663, 18806, 18921, 19035, 19124, 19206, 19268, 19312, 19345, 
-    19350, 19344, 19318, 19266, 19203, 19108, 19005, 18865, 18720, 18532, 18342, 18109, 17873, 17598, 17317, 17001, 
-    16673, 16328, 15954, 15576, 15168, 14760, 14332, 13893, 13450, 12987, 12532, 12064, 11586, 11121, 10637, 10163, 
-    9689, 9205, 8737, 8256, 7786, 7315, 6841, 6377, 5906, 5441, 4970, 4508, 4037, 3579, 3099, 2643, 
-    2163, 1698, 1220, 739, 265, -225, -706, -1205, -1697, -2207, -2704, -3233, -3741, -4276, -4810, -5350, 
-    -5904, -6459, -7026, -7597, -8181, -8763, -9358, -9951, -10559, -11153, -11766, -12367, -12969, -13571, -14165, -14754, 
-    -15332, -15900, -16457, -16997, -17528, -18034, -18528, -18999, -19451, -19881, -20291, -20680, -21047, -21388, -21711, -22010, 
-    -22289, -22554, -22784, -23017, -23214, -23408, -23584, -23740, -23891, -24023, -24144, -24251, -24348, -24422, -24494, -24535, 
-    -24578, -24584, -24588, -24557, -24515, -24441, -24351, -24228, -24076, -23901, -23684, -23447, -23168, -22862, -22513, -22141, 
-    -21726, -21284, -20808, -20299, -19766, -19196, -18614, -17989, -17362, -16704, -16036, -15359, -14658, -13970, -13260, -12565, 
-    -11854, -11171, -10461, -9799, -9105, -8453, -7794, -7152, -6526, -5902, -5304, -4701, -4124, -3538, -2976, -2404, 
-    -1849, -1281, -725, -158, 409, 981, 1565, 2152, 2754, 3366, 3988, 4622, 5274, 5925, 6605, 7277, 
-    7973, 8666, 9372, 10074, 10783, 11484, 12187, 12871, 13565, 14224, 14886, 15526, 16140, 16749, 17321, 17883, 
-    18410, 18922, 19402, 19860, 20299, 20697, 21092, 21446, 21793, 22108, 22412, 22687, 22959, 23198, 23433, 23644, 
-    23852, 24033, 24218, 24375, 24529, 24670, 24801, 24914, 25026, 25113, 25203, 25259, 25322, 25347, 25374, 25368, 
-    25350, 25305, 25244, 25150, 25039, 24897, 24731, 24535, 24316, 24060, 23789, 23471, 23145, 22775, 22386, 21968, 
-    21521, 21055, 20562, 20047, 19516, 18958, 18392, 17797, 17200, 16579, 15953, 15314, 14667, 14012, 13350, 12690, 
-    12012, 11351, 10668, 10003, 9325, 8658, 7980, 7315, 6644, 5975, 5308, 4643, 3971, 3313, 2637, 1972, 
-    1304, 626, -42, -732, -1408, -2101, -2794, -3489, -4197, -4905, -5613, -6340, -7052, -7784, -8505, -9235, 
-    -9958, -10686, -11405, -12123, -12832, -13537, -14223, -14910, -15569, -16226, -16859, -17475, -18064, -18644, -19184, -19712, 
-    -20210, -20677, -21123, -21539, -21924, -22284, -22617, -22913, -23197, -23439, -23665, -23867, -24033, -24198, -24313, -24441, 
-    -24513, -24598, -24638, -24683, -24694, -24700, -24681, -24656, -24608, -24552, -24477, -24392, -24293, -24179, -24054, -23918, 
-    -23761, -23600, -23414, -23226, -23013, -22788, -22548, -22279, -22014, -21707, -21400, -21061, -20709, -20336, -19944, -19530, 
-    -19095, -18640, -18166, -17664, -17149, -16602, -16043, -15453, -14847, -14220, -13566, -12902, -12209, -11506, -10782, -10045, 
-    -9292, -8530, -7755, -6974, -6183, -5394, -4597, -3800, -3008, -2210, -1428, -640, 133, 905, 1661, 2414, 
-    3152, 3879, 4589, 5295, 5975, 6652, 7307, 7943, 8576, 9175, 9783, 10353, 10927, 11472, 12012, 12540, 
-    13050, 13553, 14042, 14520, 14993, 15442, 15899, 16324, 16758, 17165, 17567, 17960, 18335, 18701, 19057, 19387, 
-    19720, 20019, 20320, 20586, 20852, 21086, 21304, 21506, 21682, 21842, 21979, 22098, 22187, 22274, 22317, 22365, 
-    22368, 22375, 22344, 22314, 22247, 22180, 22081, 21983, 21851, 21724, 21564, 21406, 21220, 21034, 20825, 20606, 
-    20375, 20124, 19862, 19586, 19287, 18980, 18647, 18299, 17932, 17545, 17134, 16705, 16255, 15778, 15284, 14767, 
-    14223, 13668, 13079, 12474, 11857, 11204, 10555, 9869, 9180, 8472, 7754, 7022, 6283, 5533, 4778, 4014, 
-    3250, 2476, 1708, 928, 165, -613, -1373, -2145, -2900, -3652, -4406, -5135, -5881, -6590, -7316, -8014, 
-    -8713, -9392, -10066, -10722, -11371, -11998, -12618, -13215, -13801, -14365, -14912, -15436, -15941, -16423, -16882, -17314, 
-    -17724, -18105, -18463, -18788, -19090, -19362, -19606, -19827, -20013, -20177, -20315, -20426, -20515, -20584, -20624, -20652, 
-    -20651, -20642, -20607, -20560, -20499, -20421, -20332, -20233, -20118, -20003, -19867, -19731, -19576, -19423, -19248, -19078, 
-    -18875, -18684, -18459, -18234, -17989, -17724, -17452, -17148, -16833, -16492, -16129, -15751, -15337, -14915, -14451, -13985, 
-    -13485, -12970, -12432, -11878, -11304, -10724, -10117, -9513, -8888, -8257, -7627, -6981, -6342, -5699, -5049, -4419, 
-    -3768, -3149, -2510, -1898, -1279, -674, -78, 512, 1092, 1667, 2229, 2791, 3337, 3884, 4427, 4954, 
-    5492, 6015, 6539, 7060, 7578, 8091, 8604, 9108, 9616, 10116, 10605, 11098, 11572, 12052, 12513, 12968, 
-    13410, 13842, 14260, 14666, 15051, 15431, 15780, 16124, 16443, 16739, 17025, 17276, 17522, 17729, 17933, 18091, 
-    18253, 18369, 18479, 18559, 18621, 18656, 18677, 18671, 18649, 18609, 18541, 18470, 18362, 18257, 18118, 17973, 
-    17805, 17625, 17434, 17220, 17008, 16758, 16528, 16247, 15991, 15688, 15399, 15080, 14757, 14420, 14065, 13706, 
-    13327, 12943, 12539, 12126, 11700, 11259, 10811, 10344, 9867, 9381, 8880, 8370, 7848, 7313, 6773, 6219, 
-    5656, 5086, 4503, 3924, 3324, 2739, 2125, 1538, 921, 328, -282, -878, -1481, -2075, -2665, -3254, 
-    -3830, -4410, -4970, -5537, -6076, -6627, -7146, -7673, -8176, -8677, -9163, -9632, -10098, -10539, -10978, -11396, 
-    -11806, -12199, -12578, -12953, -13301, -13654, -13977, -14304, -14610, -14912, -15201, -15475, -15745, -16002, -16244, -16485, 
-    -16704, -16926, -17124, -17326, -17502, -17680, -17842, -17985, -18132, -18242, -18368, -18455, -18542, -18609, -18653, -18700, 
-    -18702, -18712, -18683, -18645, -18585, -18498, -18396, -18270, -18118, -17948, -17749, -17530, -17286, -17022, -16724, -16413, 
-    -16070, -15700, -15321, -14901, -14469, -14012, -13534, -13031, -12519, -11969, -11423, -10847, -10264, -9666, -9058, -8441, 
-    -7819, -7186, -6562, -5923, -5294, -4667, -4033, -3430, -2804, -2212, -1612, -1032, -453, 101, 661, 1197, 
-    1731, 2253, 2761, 3264, 3759, 4243, 4725, 5197, 5669, 6134, 6602, 7059, 7522, 7975, 8434, 8883, 
-    9344, 9779, 10235, 10670, 11101, 11538, 11941, 12365, 12751, 13147, 13513, 13874, 14213, 14537, 14842, 15129, 
-    15399, 15645, 15875, 16080, 16272, 16435, 16593, 16716, 16833, 16925, 16998, 17067, 17105, 17146, 17160, 17169, 
-    17170, 17153, 17139, 17102, 17075, 17018, 16984, 16912, 16862, 16788, 16721, 16644, 16563, 16480, 16386, 16295, 
-    16189, 16084, 15972, 15842, 15720, 15576, 15429, 15271, 15095, 14917, 14713, 14503, 14275, 14028, 13771, 13486, 
-    13187, 12870, 12527, 12169, 11785, 11383, 10959, 10514, 10050, 9563, 9062, 8535, 8001, 7438, 6873, 6282, 
-    5687, 5078, 4458, 3836, 3199, 2566, 1927, 1285, 649, 11, -620, -1251, -1865, -2488, -3086, -3691, 
-    -4269, -4851, -5407, -5968, -6502, -7031, -7548, -8044, -8537, -9007, -9474, -9918, -10354, -10773, -11182, -11578, 
-    -11963, -12325, -12693, -13028, -13373, -13688, -14006, -14299, -14600, -14867, -15148, -15394, -15651, -15879, -16111, -16319, 
-    -16520, -16714, -16879, -17053, -17191, -17329, -17452, -17550, -17650, -17715, -17787, -17821, -17858, -17870, -17863, -17851, 
-    -17804, -17757, -17681, -17593, -17485, -17363, -17215, -17068, -16884, -16701, -16498, -16272, -16053, -15797, -15546, -15276, 
-    -14988, -14703, -14390, -14076, -13749, -13408, -13060, -12702, -12328, -11952, -11562, -11170, -10767, -10360, -9945, -9531, 
-    -9102, -8689, -8247, -7832, -7390, -6965, -6527, -6101, -5661, -5236, -4801, -4368, -3943, -3505, -3084, -2647, 
-    -2226, -1790, -1365, -937, -503, -81, 353, 781, 1210, 1641, 2067, 2498, 2926, 3349, 3774, 4190, 
-    4609, 5014, 5424, 5818, 6214, 6596, 6971, 7340, 7696, 8048, 8385, 8712, 9033, 9336, 9634, 9922, 
-    10192, 10460, 10717, 10958, 11202, 11428, 11651, 11869, 12073, 12279, 12473, 12665, 12847, 13028, 13193, 13363, 
-    13517, 13668, 13816, 13937, 14075, 14183, 14290, 14387, 14467, 14534, 14602, 14632, 14673, 14678, 14678, 14664, 
-    14620, 14583, 14499, 14425, 14314, 14197, 14055, 13902, 13724, 13539, 13330, 13113, 12876, 12633, 12372, 12110, 
-    11828, 11551, 11253, 10968, 10657, 10361, 10054, 9745, 9445, 9132, 8831, 8525, 8221, 7923, 7618, 7323, 
-    7020, 6726, 6430, 6130, 5832, 5533, 5233, 4932, 4623, 4315, 4003, 3686, 3364, 3038, 2707, 2373, 
-    2027, 1690, 1334, 988, 628, 274, -88, -438, -801, -1149, -1503, -1844, -2184, -2514, -2836, -3151, 
-    -3450, -3746, -4027, -4298, -4554, -4806, -5034, -5264, -5470, -5678, -5859, -6046, -6207, -6367, -6521, -6655, 
-    -6790, -6916, -7025, -7146, -7241, -7344, -7432, -7520, -7600, -7680, -7745, -7815, -7875, -7928, -7981, -8019, 
-    -8062, -8090, -8116, -8132, -8145, -8145, -8151, -8137, -8125, -8103, -8081, -8048, -8020, -7976, -7941, -7893, 
-    -7854, -7804, -7760, -7714, -7663, -7620, -7563, -7525, -7463, -7423, -7367, -7310, -7267, -7203, -7149, -7096, 
-    -7026, -6972, -6901, -6832, -6762, -6686, -6609, -6526, -6444, -6350, -6267, -6166, -6076, -5975, -5873, -5773, 
-    -5668, -5562, -5461, -5350, -5245, -5139, -5032, -4927, -4822, -4715, -4614, -4506, -4411, -4303, -4207, -4106, 
-    -4008, -3909, -3812, -3710, -3616, -3511, -3414, -3306, -3206, -3093, -2987, -2870, -2752, -2636, -2508, -2386, 
-    -2250, -2122, -1976, -1844, -1689, -1550, -1390, -1242, -1080, -920, -756, -591, -422, -255, -84, 86, 
-    250, 423, 585, 752, 907, 1066, 1215, 1363, 1504, 1635, 1773, 1885, 2016, 2117, 2228, 2327, 
-    2418, 2509, 2589, 2667, 2739, 2806, 2871, 2931, 2989, 3047, 3098, 3154, 3205, 3255, 3308, 3356, 
-    3411, 3459, 3515, 3563, 3621, 3671, 3728, 3783, 3837, 3897, 3946, 4009, 4052, 4119, 4157, 4219, 
-    4265, 4312, 4367, 4405, 4458, 4502, 4544, 4590, 4629, 4681, 4711, 4770, 4791, 4855, 4885, 4935, 
-    4980, 5023, 5079, 5122, 5185, 5238, 5300, 5367, 5432, 5511, 5587, 5668, 5762, 5848, 5952, 6047, 
-    6156, 6261, 6371, 6479, 6590, 6698, 6804, 6906, 7006, 7102, 7184, 7276, 7337, 7417, 7461, 7518, 
-    7547, 7580, 7584, 7598, 7574, 7563, 7524, 7470, 7425, 7338, 7266, 7167, 7060, 6950, 6820, 6689, 
-    6545, 6389, 6232, 6061, 5887, 5711, 5515, 5336, 5129, 4936, 4728, 4522, 4313, 4092, 3884, 3653, 
-    3442, 3211, 2990, 2762, 2535, 2307, 2076, 1852, 1617, 1397, 1161, 945, 715, 495, 276, 56, 
-    -154, -369, -578, -786, -990, -1188, -1391, -1577, -1778, -1951, -2141, -2312, -2488, -2656, -2815, -2980, 
-    -3127, -3282, -3425, -3562, -3703, -3828, -3959, -4077, -4197, -4308, -4415, -4523, -4619, -4719, -4812, -4899, 
-    -4994, -5072, -5166, -5241, -5333, -5411, -5500, -5586, -5673, -5764, -5860, -5954, -6058, -6168, -6268, -6396, 
-    -6505, -6636, -6759, -6897, -7026, -7174, -7311, -7456, -7610, -7753, -7909, -8055, -8205, -8358, -8497, -8651, 
-    -8778, -8923, -9044, -9177, -9286, -9404, -9497, -9597, -9680, -9757, -9822, -9878, -9923, -9957, -9980, -9991, 
-    -9986, -9975, -9943, -9906, -9847, -9782, -9697, -9602, -9490, -9363, -9222, -9065, -8894, -8711, -8505, -8300, 
-    -8066, -7833, -7577, -7312, -7045, -6753, -6466, -6158, -5852, -5536, -5218, -4896, -4568, -4244, -3915, -3587, 
-    -3268, -2941, -2626, -2310, -2002, -1703, -1404, -1115, -829, -552, -284, -16, 242, 499, 744, 994, 
-    1230, 1472, 1703, 1941, 2167, 2403, 2627, 2856, 3089, 3309, 3547, 3765, 4000, 4220, 4450, 4668, 
-    4896, 5110, 5331, 5541, 5750, 5953, 6152, 6343, 6527, 6710, 6869, 7049, 7185, 7346, 7481, 7611, 
-    7738, 7853, 7964, 8068, 8171, 8259, 8358, 8440, 8528, 8613, 8693, 8777, 8857, 8941, 9024, 9104, 
-    9191, 9274, 9357, 9448, 9525, 9617, 9698, 9781, 9863, 9941, 10020, 10093, 10162, 10230, 10285, 10349, 
-    10387, 10438, 10463, 10497, 10504, 10519, 10504, 10498, 10461, 10427, 10371, 10307, 10225, 10135, 10026, 9908, 
-    9773, 9620, 9465, 9279, 9092, 8888, 8660, 8437, 8182, 7929, 7653, 7373, 7079, 6773, 6463, 6138, 
-    5811, 5474, 5131, 4786, 4432, 4081, 3720, 3358, 3003, 2631, 2279, 1908, 1551, 1188, 835, 477, 
-    125, -217, -567, -897, -1237, -1556, -1882, -2189, -2496, -2794, -3078, -3362, -3626, -3889, -4137, -4379, 
-    -4606, -4825, -5031, -5227, -5409, -5586, -5737, -5901, -6024, -6159, -6272, -6376, -6475, -6559, -6632, -6703, 
-    -6763, -6814, -6862, -6901, -6935, -6968, -6991, -7016, -7036, -7054, -7068, -7084, -7094, -7108, -7120, -7125, 
-    -7137, -7143, -7147, -7159, -7158, -7163, -7164, -7161, -7165, -7151, -7155, -7134, -7124, -7106, -7082, -7057, 
-    -7026, -6983, -6944, -6890, -6839, -6769, -6705, -6623, -6543, -6449, -6358, -6247, -6148, -6030, -5911, -5794, 
-    -5668, -5543, -5418, -5283, -5163, -5030, -4912, -4785, -4663, -4551, -4430, -4328, -4215, -4118, -4013, -3924, 
-    -3830, -3739, -3659, -3566, -3493, -3401, -3326, -3239, -3154, -3074, -2973, -2892, -2782, -2686, -2574, -2458, 
-    -2336, -2203, -2070, -1921, -1773, -1610, -1448, -1277, -1098, -923, -735, -553, -367, -179, 0, 190, 
-    362, 543, 710, 878, 1034, 1189, 1328, 1466, 1594, 1712, 1819, 1921, 2007, 2093, 2167, 2228, 
-    2287, 2333, 2374, 2412, 2435, 2459, 2476, 2482, 2494, 2493, 2490, 2491, 2473, 2471, 2450, 2438, 
-    2416, 2398, 2375, 2352, 2330, 2302, 2279, 2251, 2229, 2203, 2184, 2158, 2147, 2124, 2115, 2104, 
-    2098, 2095, 2099, 2102, 2110, 2129, 2143, 2168, 2197, 2222, 2259, 2303, 2332, 2393, 2425, 2484, 
-    2532, 2585, 2638, 2696, 2746, 2803, 2855, 2905, 2961, 3001, 3051, 3095, 3130, 3175, 3205, 3238, 
-    3274, 3297, 3334, 3352, 3387, 3408, 3439, 3467, 3495, 3531, 3560, 3604, 3636, 3686, 3728, 3784, 
-    3831, 3895, 3949, 4017, 4081, 4149, 4216, 4290, 4354, 4428, 4491, 4554, 4618, 4672, 4727, 4769, 
-    4811, 4844, 4870, 4890, 4899, 4901, 4905, 4881, 4873, 4841, 4810, 4777, 4727, 4684, 4624, 4573, 
-    4504, 4446, 4374, 4308, 4234, 4167, 4089, 4024, 3946, 3884, 3808, 3741, 3681, 3603, 3553, 3478, 
-    3424, 3365, 3301, 3252, 3188, 3137, 3083, 3027, 2976, 2923, 2866, 2815, 2759, 2701, 2646, 2584, 
-    2521, 2461, 2385, 2326, 2243, 2170, 2087, 2001, 1908, 1819, 1704, 1613, 1485, 1380, 1248, 1116, 
-    986, 831, 695, 527, 373, 194, 26, -160, -347, -541, -743, -947, -1156, -1376, -1594, -1814, 
-    -2047, -2268, -2509, -2735, -2969, -3205, -3436, -3669, -3902, -4128, -4361, -4581, -4810, -5026, -5248, -5463, 
-    -5672, -5882, -6085, -6283, -6480, -6669, -6851, -7035, -7204, -7375, -7539, -7694, -7855, -7990, -8146, -8270, 
-    -8419, -8533, -8670, -8781, -8901, -9016, -9116, -9228, -9326, -9416, -9516, -9593, -9681, -9758, -9827, -9896, 
-    -9955, -10010, -10056, -10097, -10126, -10151, -10163, -10166, -10155, -10139, -10108, -10064, -10009, -9938, -9859, -9760, 
-    -9649, -9528, -9386, -9238, -9069, -8890, -8705, -8492, -8288, -8051, -7825, -7575, -7325, -7065, -6800, -6525, 
-    -6258, -5970, -5700, -5410, -5134, -4845, -4570, -4281, -4010, -3728, -3453, -3184, -2910, -2647, -2382, -2122, 
-    -1866, -1612, -1366, -1112, -878, -628, -402, -157, 66, 305, 525, 762, 976, 1219, 1426, 1671, 
-    1883, 2121, 2348, 2581, 2819, 3062, 3300, 3561, 3805, 4079, 4341, 4620, 4901, 5198, 5488, 5807, 
-    6113, 6437, 6767, 7096, 7438, 7783, 8123, 8479, 8823, 9174, 9522, 9868, 10203, 10552, 10862, 11203, 
-    11498, 11817, 12098, 12389, 12652, 12914, 13156, 13388, 13606, 13805, 13997, 14165, 14323, 14469, 14593, 14707, 
-    14809, 14885, 14958, 15009, 15044, 15075, 15077, 15078, 15054, 15023, 14972, 14913, 14831, 14745, 14636, 14516, 
-    14385, 14233, 14072, 13896, 13704, 13505, 13288, 13061, 12822, 12573, 12309, 12038, 11751, 11461, 11152, 10840, 
-    10517, 10174, 9842, 9472, 9123, 8740, 8360, 7970, 7564, 7164, 6743, 6317, 5892, 5444, 5009, 4552, 
-    4099, 3640, 3175, 2709, 2239, 1776, 1296, 836, 358, -101, -566, -1027, -1483, -1934, -2380, -2819, 
-    -3257, -3679, -4109, -4515, -4931, -5328, -5724, -6112, -6500, -6868, -7248, -7607, -7971, -8327, -8678, -9024, 
-    -9374, -9707, -10047, -10380, -10707, -11032, -11354, -11663, -11985, -12275, -12584, -12868, -13155, -13434, -13698, -13958, 
-    -14209, -14447, -14679, -14892, -15102, -15290, -15478, -15640, -15798, -15936, -16065, -16181, -16277, -16364, -16436, -16489, 
-    -16538, -16559, -16578, -16577, -16560, -16534, -16491, -16433, -16365, -16284, -16180, -16080, -15943, -15820, -15657, -15503, 
-    -15320, -15133, -14929, -14713, -14482, -14241, -13987, -13717, -13443, -13146, -12849, -12532, -12210, -11876, -11530, -11183, 
-    -10813, -10452, -10063, -9683, -9284, -8883, -8471, -8056, -7628, -7201, -6761, -6312, -5870, -5402, -4949, -4470, 
-    -3998, -3515, -3028, -2534, -2035, -1533, -1020, -512, 7, 526, 1050, 1576, 2107, 2633, 3163, 3699, 
-    4216, 4758, 5274, 5799, 6319, 6829, 7342, 7837, 8338, 8816, 9298, 9760, 10220, 10660, 11096, 11511, 
-    11924, 12314, 12697, 13062, 13412, 13752, 14075, 14382, 14675, 14950, 15213, 15458, 15694, 15899, 16106, 16279, 
-    16452, 16596, 16733, 16845, 16952, 17029, 17107, 17153, 17192, 17219, 17219, 17224, 17190, 17167, 17110, 17054, 
-    16977, 16890, 16789, 16677, 16548, 16417, 16256, 16107, 15920, 15740, 15541, 15324, 15106, 14865, 14617, 14358, 
-    14082, 13795, 13501, 13182, 12869, 12525, 12183, 11823, 11455, 11077, 10687, 10289, 9884, 9469, 9051, 8621, 
-    8193, 7754, 7320, 6872, 6434, 5980, 5543, 5091, 4647, 4204, 3755, 3317, 2871, 2432, 1991, 1554, 
-    1114, 676, 242, -198, -630, -1065, -1509, -1935, -2381, -2809, -3251, -3685, -4116, -4555, -4979, -5415, 
-    -5835, -6260, -6672, -7087, -7489, -7891, -8277, -8660, -9033, -9388, -9750, -10076, -10413, -10721, -11023, -11311, 
-    -11586, -11841, -12095, -12319, -12546, -12746, -12942, -13119, -13286, -13444, -13583, -13717, -13836, -13943, -14048, -14128, 
-    -14215, -14278, -14339, -14385, -14426, -14456, -14472, -14484, -14477, -14469, -14441, -14410, -14355, -14303, -14222, -14140, 
-    -14040, -13921, -13796, -13653, -13492, -13323, -13136, -12932, -12722, -12487, -12247, -11991, -11721, -11439, -11149, -10841, 
-    -10530, -10204, -9872, -9529, -9186, -8824, -8469, -8097, -7730, -7353, -6978, -6591, -6210, -5826, -5435, -5051, 
-    -4660, -4271, -3885, -3492, -3106, -2721, -2332, -1953, -1567, -1195, -810, -448, -66, 286, 658, 1005, 
-    1367, 1708, 2053, 2392, 2721, 3053, 3370, 3687, 4001, 4299, 4609, 4894, 5195, 5468, 5760, 6022, 
-    6301, 6559, 6818, 7075, 7318, 7562, 7798, 8025, 8257, 8471, 8687, 8889, 9092, 9280, 9466, 9643, 
-    9808, 9968, 10115, 10257, 10380, 10504, 10604, 10702, 10784, 10856, 10913, 10962, 10993, 11017, 11025, 11027, 
-    11007, 10985, 10946, 10894, 10838, 10765, 10684, 10592, 10492, 10377, 10266, 10129, 9999, 9851, 9703, 9543, 
-    9381, 9206, 9031, 8847, 8656, 8466, 8258, 8061, 7840, 7634, 7404, 7186, 6950, 6716, 6478, 6229, 
-    5986, 5730, 5473, 5215, 4946, 4682, 4405, 4132, 3848, 3569, 3274, 2987, 2689, 2392, 2088, 1785, 
-    1473, 1167, 853, 539, 224, -85, -407, -711, -1032, -1334, -1643, -1944, -2240, -2532, -2817, -3091, 
-    -3364, -3622, -3872, -4117, -4339, -4567, -4763, -4969, -5144, -5317, -5478, -5620, -5758, -5875, -5990, -6085, 
-    -6174, -6249, -6314, -6368, -6418, -6452, -6484, -6504, -6518, -6526, -6534, -6520, -6523, -6502, -6491, -6467, 
-    -6446, -6420, -6390, -6360, -6325, -6289, -6250, -6216, -6164, -6135, -6075, -6038, -5981, -5929, -5874, -5812, 
-    -5752, -5681, -5612, -5529, -5453, -5358, -5269, -5163, -5054, -4938, -4818, -4683, -4551, -4395, -4253, -4083, 
-    -3924, -3745, -3572, -3385, -3204, -3009, -2820, -2627, -2431, -2243, -2045, -1857, -1668, -1481, -1303, -1122, 
-    -952, -780, -617, -462, -304, -165, -13, 117, 253, 377, 510, 617, 749, 850, 972, 1077, 
-    1190, 1292, 1406, 1513, 1619, 1733, 1836, 1956, 2058, 2180, 2290, 2401, 2522, 2630, 2751, 2863, 
-    2978, 3088, 3199, 3308, 3409, 3512, 3607, 3697, 3780, 3863, 3926, 3998, 4042, 4094, 4124, 4153, 
-    4168, 4170, 4167, 4146, 4122, 4083, 4033, 3979, 3909, 3833, 3753, 3651, 3565, 3445, 3349, 3221, 
-    3110, 2986, 2854, 2736, 2597, 2477, 2339, 2218, 2082, 1957, 1829, 1704, 1582, 1458, 1339, 1218, 
-    1104, 982, 878, 750, 652, 531, 421, 316, 199, 97, -15, -120, -228, -329, -438, -539, 
-    -638, -741, -830, -934, -1018, -1111, -1192, -1276, -1351, -1429, -1495, -1561, -1627, -1678, -1739, -1783, 
-    -1828, -1875, -1903, -1945, -1966, -2002, -2015, -2042, -2049, -2067, -2071, -2082, -2079, -2081, -2076, -2068, 
-    -2062, -2046, -2035, -2012, -2001, -1969, -1956, -1918, -1898, -1859, -1830, -1791, -1750, -1713, -1662, -1618, 
-    -1568, -1512, -1458, -1393, -1338, -1263, -1203, -1121, -1054, -971, -892, -812, -721, -642, -545, -464, 
-    -368, -279, -184, -95, 6, 82, 197, 267, 380, 454, 557, 636, 733, 812, 907, 984, 
-    1077, 1154, 1243, 1323, 1411, 1491, 1578, 1657, 1743, 1826, 1907, 1989, 2068, 2150, 2223, 2301, 
-    2369, 2439, 2498, 2564, 2605, 2667, 2697, 2740, 2762, 2788, 2797, 2810, 2806, 2806, 2786, 2778, 
-    2744, 2723, 2692, 2648, 2618, 2567, 2534, 2479, 2444, 2389, 2351, 2308, 2259, 2225, 2178, 2144, 
-    2106, 2068, 2036, 1998, 1964, 1929, 1890, 1854, 1810, 1765, 1717, 1661, 1606, 1537, 1467, 1391, 
-    1303, 1213, 1114, 1004, 900, 770, 654, 515, 383, 242, 95, -46, -201, -348, -500, -655, 
-    -803, -956, -1102, -1248, -1391, -1531, -1669, -1796, -1929, -2045, -2171, -2278, -2394, -2494, -2598, -2693, 
-    -2784, -2876, -2958, -3042, -3117, -3193, -3268, -3335, -3409, -3466, -3539, -3596, -3656, -3713, -3766, -3819, 
-    -3866, -3914, -3948, -3990, -4023, -4042, -4080, -4082, -4107, -4105, -4113, -4102, -4095, -4076, -4054, -4020, 
-    -3990, -3940, -3892, -3840, -3764, -3706, -3621, -3540, -3447, -3349, -3249, -3137, -3028, -2905, -2780, -2656, 
-    -2518, -2384, -2245, -2099, -1953, -1804, -1650, -1498, -1341, -1185, -1023, -864, -702, -537, -378, -207, 
-    -48, 119, 282, 445, 612, 773, 933, 1100, 1250, 1421, 1565, 1738, 1879, 2041, 2188, 2339, 
-    2486, 2632, 2772, 2911, 3048, 3183, 3307, 3442, 3555, 3683, 3792, 3906, 4010, 4115, 4210, 4309, 
-    4390, 4482, 4555, 4634, 4702, 4767, 4828, 4879, 4932, 4972, 5013, 5044, 5071, 5095, 5106, 5120, 
-    5118, 5120, 5110, 5097, 5073, 5052, 5015, 4980, 4938, 4887, 4833, 4778, 4708, 4647, 4569, 4494, 
-    4416, 4326, 4242, 4150, 4053, 3959, 3856, 3752, 3648, 3535, 3426, 3311, 3192, 3077, 2949, 2835, 
-    2700, 2581, 2447, 2320, 2189, 2054, 1923, 1786, 1650, 1510, 1374, 1228, 1088, 944, 788, 652, 
-    485, 341, 172, 16, -150, -320, -490, -668, -844, -1025, -1213, -1394, -1592, -1779, -1978, -2174, 
-    -2373, -2574, -2776, -2974, -3178, -3376, -3573, -3775, -3959, -4160, -4335, -4528, -4693, -4876, -5029, -5199, 
-    -5340, -5494, -5627, -5756, -5880, -5991, -6099, -6200, -6285, -6371, -6447, -6511, -6579, -6621, -6677, -6708, 
-    -6747, -6760, -6788, -6788, -6798, -6787, -6773, -6760, -6722, -6695, -6649, -6594, -6548, -6466, -6407, -6314, 
-    -6239, -6126, -6037, -5913, -5799, -5671, -5528, -5389, -5229, -5074, -4893, -4726, -4527, -4339, -4131, -3925, 
-    -3702, -3481, -3248, -3010, -2774, -2521, -2278, -2019, -1768, -1506, -1252, -988, -736, -473, -221, 33, 
-    279, 532, 761, 1011, 1228, 1464, 1679, 1894, 2103, 2303, 2500, 2695, 2882, 3061, 3249, 3415, 
-    3599, 3764, 3934, 4107, 4264, 4438, 4596, 4762, 4923, 5083, 5238, 5403, 5551, 5709, 5860, 6004, 
-    6153, 6296, 6425, 6568, 6688, 6816, 6932, 7042, 7147, 7245, 7331, 7421, 7481, 7564, 7599, 7665, 
-    7691, 7722, 7742, 7747, 7751, 7735, 7719, 7681, 7652, 7591, 7540, 7465, 7393, 7305, 7210, 7110, 
-    6996, 6885, 6755, 6630, 6492, 6353, 6206, 6057, 5905, 5743, 5592, 5419, 5262, 5092, 4921, 4751, 
-    4579, 4401, 4225, 4047, 3861, 3682, 3493, 3301, 3108, 2910, 2708, 2503, 2290, 2075, 1851, 1629, 
-    1389, 1159, 910, 661, 409, 144, -115, -386, -656, -939, -1213, -1502, -1781, -2069, -2356, -2638, 
-    -2930, -3207, -3493, -3770, -4044, -4316, -4581, -4844, -5095, -5347, -5584, -5823, -6047, -6265, -6476, -6675, 
-    -6871, -7050, -7228, -7387, -7548, -7692, -7827, -7959, -8069, -8185, -8277, -8369, -8449, -8520, -8579, -8635, 
-    -8677, -8716, -8742, -8761, -8774, -8778, -8775, -8762, -8744, -8718, -8682, -8642, -8593, -8534, -8473, -8394, 
-    -8319, -8223, -8128, -8019, -7901, -7775, -7636, -7495, -7334, -7172, -6997, -6806, -6623, -6406, -6204, -5970, 
-    -5752, -5500, -5263, -5002, -4743, -4474, -4205, -3919, -3645, -3354, -3066, -2779, -2479, -2192, -1896, -1601, 
-    -1313, -1018, -731, -449, -156, 116, 401, 670, 944, 1209, 1475, 1731, 1990, 2236, 2491, 2732, 
-    2967, 3215, 3436, 3682, 3898, 4133, 4346, 4579, 4787, 5014, 5218, 5437, 5645, 5849, 6061, 6252, 
-    6461, 6649, 6844, 7027, 7216, 7384, 7566, 7721, 7884, 8036, 8175, 8313, 8435, 8554, 8657, 8757, 
-    8839, 8919, 8976, 9035, 9072, 9105, 9126, 9131, 9134, 9117, 9102, 9061, 9024, 8968, 8908, 8834, 
-    8758, 8659, 8565, 8454, 8332, 8213, 8070, 7933, 7779, 7619, 7452, 7281, 7094, 6912, 6711, 6512, 
-    6300, 6091, 5866, 5644, 5412, 5170, 4939, 4686, 4438, 4185, 3920, 3662, 3390, 3120, 2844, 2566, 
-    2278, 1993, 1699, 1410, 1105, 813, 494, 202, -122, -421, -749, -1057, -1382, -1698, -2015, -2336, 
-    -2651, -2962, -3281, -3575, -3889, -4172, -4473, -4745, -5026, -5285, -5543, -5787, -6023, -6243, -6458, -6655, 
-    -6844, -7019, -7180, -7335, -7468, -7605, -7704, -7826, -7905, -7997, -8067, -8129, -8183, -8233, -8264, -8300, 
-    -8318, -8335, -8347, -8346, -8348, -8336, -8324, -8306, -8280, -8249, -8214, -8171, -8123, -8072, -8006, -7942, 
-    -7864, -7780, -7695, -7588, -7491, -7365, -7252, -7112, -6978, -6826, -6671, -6510, -6332, -6165, -5967, -5788, 
-    -5584, -5381, -5175, -4959, -4744, -4521, -4298, -4068, -3837, -3607, -3367, -3137, -2890, -2659, -2412, -2175, 
-    -1926, -1687, -1435, -1194, -941, -694, -438, -186, 75, 326, 594, 852, 1118, 1385, 1651, 1922, 
-    2189, 2459, 2731, 2997, 3270, 3535, 3797, 4069, 4316, 4583, 4825, 5078, 5317, 5551, 5781, 6008, 
-    6214, 6438, 6623, 6828, 7010, 7186, 7357, 7518, 7665, 7815, 7942, 8072, 8179, 8293, 8380, 8472, 
-    8545, 8610, 8666, 8709, 8743, 8764, 8773, 8774, 8755, 8737, 8690, 8643, 8578, 8495, 8415, 8300, 
-    8194, 8055, 7922, 7765, 7599, 7428, 7236, 7047, 6838, 6627, 6405, 6181, 5941, 5712, 5457, 5220, 
-    4957, 4709, 4448, 4188, 3930, 3662, 3404, 3131, 2877, 2600, 2348, 2073, 1816, 1545, 1288, 1018, 
-    763, 493, 243, -29, -270, -547, -786, -1053, -1297, -1555, -1798, -2053, -2291, -2537, -2776, -3008, 
-    -3244, -3470, -3696, -3916, -4131, -4344, -4549, -4754, -4952, -5140, -5334, -5509, -5694, -5864, -6029, -6194, 
-    -6347, -6499, -6647, -6782, -6920, -7043, -7171, -7279, -7401, -7491, -7599, -7681, -7772, -7846, -7919, -7978, 
-    -8043, -8085, -8136, -8165, -8198, -8217, -8233, -8234, -8237, -8221, -8206, -8178, -8139, -8100, -8039, -7985, 
-    -7903, -7830, -7732, -7634, -7525, -7400, -7276, -7128, -6985, -6819, -6655, -6468, -6282, -6083, -5867, -5656, 
-    -5421, -5184, -4938, -4678, -4418, -4139, -3862, -3568, -3275, -2968, -2658, -2345, -2017, -1698, -1360, -1029, 
-    -691, -349, -6, 336, 679, 1028, 1368, 1714, 2053, 2391, 2731, 3055, 3391, 3705, 4032, 4335, 
-    4648, 4944, 5235, 5525, 5795, 6074, 6326, 6589, 6826, 7065, 7294, 7508, 7723, 7920, 8110, 8296, 
-    8465, 8630, 8783, 8925, 9063, 9184, 9296, 9406, 9489, 9587, 9648, 9721, 9769, 9814, 9848, 9873, 
-    9886, 9885, 9883, 9862, 9836, 9798, 9744, 9687, 9617, 9532, 9444, 9335, 9223, 9099, 8959, 8814, 
-    8653, 8484, 8302, 8114, 7908, 7701, 7478, 7247, 7012, 6759, 6512, 6242, 5982, 5701, 5425, 5137, 
-    4853, 4557, 4265, 3963, 3667, 3364, 3065, 2756, 2457, 2150, 1848, 1540, 1240, 929, 634, 315, 
-    18, -294, -601, -911, -1227, -1537, -1858, -2169, -2497, -2808, -3143, -3452, -3789, -4100, -4433, -4747, 
-    -5072, -5385, -5696, -6005, -6307, -6600, -6893, -7167, -7439, -7701, -7949, -8190, -8415, -8632, -8838, -9027, 
-    -9210, -9375, -9535, -9684, -9813, -9949, -10050, -10175, -10257, -10364, -10434, -10522, -10582, -10654, -10708, -10763, 
-    -10810, -10850, -10886, -10915, -10938, -10950, -10962, -10960, -10947, -10931, -10894, -10856, -10803, -10731, -10651, -10561, 
-    -10443, -10329, -10178, -10033, -9859, -9675, -9475, -9256, -9035, -8784, -8533, -8261, -7981, -7690, -7387, -7072, 
-    -6758, -6420, -6093, -5742, -5400, -5040, -4688, -4320, -3963, -3585, -3224, -2841, -2476, -2086, -1718, -1328, 
-    -947, -562, -174, 214, 600, 1001, 1384, 1788, 2174, 2578, 2970, 3365, 3767, 4153, 4555, 4936, 
-    5329, 5711, 6087, 6466, 6826, 7190, 7539, 7882, 8220, 8539, 8858, 9155, 9450, 9726, 9997, 10249, 
-    10492, 10722, 10936, 11140, 11336, 11502, 11684, 11822, 11974, 12095, 12217, 12319, 12421, 12491, 12577, 12623, 
-    12685, 12717, 12743, 12764, 12759, 12763, 12733, 12711, 12659, 12612, 12537, 12459, 12366, 12252, 12143, 11998, 
-    11862, 11690, 11527, 11331, 11137, 10922, 10692, 10460, 10202, 9947, 9666, 9386, 9091, 8784, 8475, 8147, 
-    7823, 7485, 7141, 6793, 6432, 6084, 5707, 5350, 4971, 4600, 4224, 3843, 3461, 3079, 2697, 2307, 
-    1925, 1532, 1148, 753, 369, -31, -414, -812, -1204, -1599, -1989, -2385, -2777, -3166, -3561, -3943, 
-    -4333, -4714, -5095, -5469, -5841, -6207, -6568, -6923, -7267, -7612, -7937, -8267, -8575, -8880, -9175, -9456, 
-    -9728, -9990, -10238, -10477, -10704, -10914, -11124, -11307, -11491, -11654, -11814, -11953, -12090, -12207, -12318, -12418, 
-    -12501, -12583, -12642, -12703, -12741, -12775, -12798, -12809, -12810, -12800, -12780, -12748, -12711, -12654, -12601, -12523, 
-    -12444, -12354, -12249, -12142, -12015, -11888, -11740, -11596, -11426, -11258, -11073, -10881, -10679, -10466, -10239, -10011, 
-    -9759, -9516, -9238, -8979, -8679, -8398, -8084, -7776, -7451, -7119, -6778, -6427, -6070, -5703, -5326, -4944, 
-    -4557, -4153, -3760, -3335, -2934, -2503, -2084, -1655, -1221, -788, -350, 88, 524, 967, 1403, 1845, 
-    2281, 2717, 3151, 3579, 4011, 4430, 4856, 5264, 5680, 6082, 6485, 6875, 7266, 7641, 8018, 8382, 
-    8740, 9090, 9429, 9761, 10085, 10393, 10702, 10986, 11271, 11538, 11796, 12037, 12271, 12484, 12690, 12878, 
-    13052, 13208, 13351, 13476, 13587, 13678, 13751, 13813, 13848, 13874, 13877, 13862, 13836, 13783, 13722, 13637, 
-    13545, 13424, 13303, 13152, 13001, 12827, 12646, 12447, 12244, 12026, 11796, 11561, 11312, 11064, 10794, 10533, 
-    10248, 9970, 9680, 9383, 9085, 8775, 8464, 8144, 7821, 7491, 7156, 6816, 6467, 6116, 5761, 5392, 
-    5030, 4647, 4276, 3885, 3500, 3102, 2707, 2305, 1900, 1499, 1084, 687, 266, -126, -542, -933, 
-    -1342, -1729, -2124, -2504, -2886, -3254, -3621, -3980, -4322, -4673, -4995, -5328, -5635, -5952, -6239, -6539, 
-    -6814, -7090, -7362, -7612, -7878, -8113, -8365, -8592, -8829, -9047, -9274, -9478, -9704, -9892, -10105, -10293, 
-    -10483, -10666, -10843, -11009, -11178, -11323, -11479, -11607, -11740, -11851, -11960, -12052, -12138, -12200, -12264, -12303, 
-    -12337, -12349, -12352, -12340, -12314, -12272, -12217, -12143, -12064, -11960, -11853, -11725, -11582, -11433, -11265, -11088, 
-    -10900, -10688, -10486, -10249, -10022, -9771, -9513, -9252, -8968, -8693, -8390, -8099, -7777, -7472, -7136, -6814, 
-    -6468, -6128, -5774, -5418, -5056, -4686, -4319, -3937, -3560, -3171, -2790, -2394, -2005, -1607, -1210, -813, 
-    -415, -13, 385, 780, 1185, 1574, 1970, 2360, 2745, 3130, 3506, 3880, 4244, 4606, 4955, 5307, 
-    5634, 5976, 6283, 6603, 6900, 7195, 7474, 7748, 8007, 8263, 8495, 8734, 8939, 9162, 9339, 9537, 
-    9695, 9863, 10007, 10141, 10263, 10373, 10470, 10555, 10625, 10684, 10733, 10767, 10787, 10803, 10795, 10789, 
-    10762, 10729, 10681, 10633, 10560, 10496, 10406, 10322, 10219, 10117, 10002, 9884, 9760, 9626, 9491, 9348, 
-    9199, 9048, 8885, 8730, 8550, 8389, 8195, 8022, 7822, 7630, 7421, 7219, 6991, 6777, 6537, 6305, 
-    6058, 5809, 5549, 5288, 5015, 4745, 4461, 4177, 3888, 3596, 3300, 3002, 2701, 2398, 2093, 1793, 
-    1482, 1186, 870, 578, 264, -26, -342, -630, -941, -1232, -1534, -1833, -2129, -2427, -2724, -3018, 
-    -3319, -3607, -3911, -4196, -4497, -4788, -5074, -5373, -5647, -5940, -6215, -6491, -6761, -7027, -7282, -7535, 
-    -7777, -8004, -8236, -8439, -8646, -8831, -9007, -9171, -9315, -9454, -9570, -9675, -9766, -9838, -9897, -9943, 
-    -9972, -9986, -9987, -9974, -9945, -9913, -9850, -9793, -9714, -9628, -9530, -9422, -9306, -9177, -9049, -8898, 
-    -8755, -8594, -8429, -8261, -8078, -7897, -7702, -7509, -7297, -7098, -6869, -6658, -6419, -6196, -5947, -5711, 
-    -5457, -5203, -4948, -4681, -4418, -4147, -3875, -3599, -3317, -3046, -2751, -2481, -2185, -1909, -1617, -1335, 
-    -1048, -765, -480, -199, 83, 362, 640, 916, 1191, 1462, 1731, 1998, 2263, 2523, 2783, 3039, 
-    3289, 3543, 3784, 4030, 4266, 4497, 4727, 4949, 5163, 5380, 5574, 5780, 5958, 6148, 6310, 6487, 
-    6627, 6786, 6914, 7042, 7164, 7264, 7370, 7451, 7539, 7602, 7671, 7714, 7764, 7795, 7825, 7840, 
-    7854, 7853, 7854, 7835, 7826, 7792, 7769, 7724, 7683, 7633, 7574, 7514, 7444, 7366, 7292, 7195, 
-    7108, 7001, 6897, 6781, 6659, 6533, 6394, 6256, 6102, 5949, 5784, 5616, 5433, 5255, 5059, 4864, 
-    4667, 4445, 4248, 4015, 3801, 3575, 3339, 3110, 2876, 2634, 2403, 2157, 1922, 1682, 1441, 1207, 
-    969, 738, 505, 277, 54, -172, -386, -605, -816, -1025, -1230, -1434, -1633, -1833, -2026, -2221, 
-    -2411, -2604, -2793, -2982, -3170, -3356, -3543, -3733, -3909, -4107, -4277, -4468, -4645, -4820, -5000, -5167, 
-    -5337, -5497, -5658, -5802, -5954, -6084, -6216, -6334, -6442, -6545, -6630, -6708, -6776, -6826, -6872, -6897, 
-    -6919, -6920, -6919, -6897, -6872, -6834, -6783, -6727, -6660, -6584, -6504, -6413, -6317, -6216, -6111, -5996, 
-    -5886, -5762, -5643, -5513, -5386, -5254, -5120, -4980, -4842, -4695, -4551, -4401, -4248, -4092, -3934, -3767, 
-    -3608, -3429, -3263, -3078, -2902, -2710, -2521, -2328, -2128, -1925, -1723, -1504, -1307, -1078, -874, -647, 
-    -434, -211, 5, 224, 447, 656, 879, 1081, 1300, 1497, 1706, 1896, 2091, 2277, 2456, 2637, 
-    2797, 2969, 3116, 3275, 3412, 3553, 3679, 3806, 3922, 4033, 4140, 4233, 4335, 4415, 4498, 4578, 
-    4642, 4714, 4770, 4828, 4877, 4924, 4967, 5001, 5035, 5060, 5083, 5102, 5113, 5124, 5121, 5125, 
-    5113, 5103, 5083, 5058, 5034, 4993, 4958, 4906, 4863, 4795, 4745, 4663, 4601, 4515, 4432, 4343, 
-    4244, 4149, 4040, 3928, 3818, 3690, 3571, 3440, 3305, 3173, 3028, 2886, 2742, 2586, 2440, 2278, 
-    2130, 1961, 1808, 1639, 1477, 1318, 1146, 986, 818, 656, 491, 327, 168, 4, -148, -310, 
-    -461, -618, -761, -917, -1053, -1205, -1336, -1476, -1612, -1739, -1874, -1991, -2125, -2235, -2364, -2469, 
-    -2587, -2695, -2801, -2905, -3007, -3102, -3197, -3288, -3374, -3462, -3534, -3621, -3680, -3755, -3812, -3867, 
-    -3926, -3964, -4010, -4036, -4072, -4090, -4108, -4115, -4119, -4115, -4103, -4091, -4061, -4035, -3997, -3951, 
-    -3906, -3850, -3784, -3724, -3642, -3576, -3482, -3405, -3306, -3216, -3114, -3011, -2908, -2797, -2687, -2575, 
-    -2456, -2342, -2221, -2100, -1980, -1859, -1731, -1609, -1484, -1354, -1234, -1103, -979, -850, -725, -593, 
-    -474, -336, -217, -84, 41, 167, 303, 424, 559, 682, 815, 942, 1070, 1200, 1323, 1454, 
-    1575, 1699, 1825, 1939, 2066, 2176, 2294, 2406, 2512, 2624, 2721, 2826, 2922, 3013, 3109, 3188, 
-    3274, 3354, 3422, 3498, 3556, 3622, 3672, 3728, 3769, 3810, 3847, 3872, 3900, 3920, 3929, 3938, 
-    3941, 3933, 3927, 3911, 3887, 3863, 3829, 3788, 3750, 3696, 3646, 3585, 3520, 3456, 3380, 3303, 
-    3226, 3137, 3050, 2960, 2864, 2771, 2664, 2566, 2462, 2352, 2247, 2132, 2019, 1906, 1787, 1667, 
-    1542, 1422, 1290, 1162, 1030, 891, 755, 610, 465, 316, 167, 8, -145, -308, -472, -634, 
-    -806, -971, -1144, -1315, -1485, -1657, -1832, -1995, -2171, -2333, -2496, -2663, -2817, -2974, -3124, -3266, 
-    -3412, -3542, -3680, -3793, -3924, -4026, -4146, -4235, -4341, -4425, -4512, -4595, -4663, -4738, -4800, -4861, 
-    -4914, -4965, -5015, -5051, -5100, -5118, -5163, -5177, -5201, -5226, -5218, -5251, -5225, -5244, -5224, -5209, 
-    -5194, -5157, -5133, -5084, -5040, -4979, -4921, -4843, -4768, -4674, -4582, -4469, -4362, -4227, -4107, -3953, 
-    -3813, -3646, -3489, -3304, -3135, -2937, -2750, -2547, -2342, -2135, -1918, -1702, -1484, -1254, -1039, -803, 
-    -580, -354, -122, 102, 331, 553, 777, 1004, 1220, 1445, 1654, 1873, 2080, 2292, 2492, 2701, 
-    2895, 3095, 3283, 3477, 3662, 3840, 4028, 4194, 4374, 4536, 4700, 4863, 5014, 5168, 5313, 5456, 
-    5589, 5727, 5845, 5972, 6083, 6193, 6296, 6390, 6483, 6564, 6641, 6711, 6773, 6829, 6880, 6919, 
-    6956, 6982, 7001, 7018, 7019, 7021, 7003, 6994, 6961, 6937, 6890, 6845, 6789, 6724, 6663, 6573, 
-    6503, 6402, 6309, 6205, 6091, 5978, 5854, 5723, 5592, 5448, 5304, 5155, 4994, 4839, 4670, 4502, 
-    4325, 4147, 3968, 3779, 3590, 3395, 3196, 3000, 2795, 2584, 2380, 2160, 1951, 1724, 1510, 1279, 
-    1056, 826, 591, 361, 119, -109, -361, -593, -841, -1086, -1326, -1581, -1821, -2069, -2319, -2557, 
-    -2813, -3049, -3296, -3534, -3778, -4006, -4252, -4470, -4706, -4925, -5146, -5359, -5570, -5773, -5978, -6164, 
-    -6364, -6536, -6721, -6888, -7051, -7212, -7359, -7506, -7641, -7768, -7894, -7999, -8114, -8204, -8296, -8376, 
-    -8442, -8509, -8559, -8599, -8639, -8654, -8672, -8673, -8662, -8649, -8615, -8579, -8526, -8469, -8393, -8321, 
-    -8220, -8131, -8012, -7900, -7772, -7632, -7497, -7339, -7189, -7017, -6852, -6671, -6491, -6305, -6108, -5913, 
-    -5710, -5503, -5293, -5076, -4856, -4632, -4405, -4171, -3936, -3694, -3451, -3203, -2949, -2696, -2436, -2170, 
-    -1908, -1631, -1369, -1086, -813, -531, -247, 30, 316, 598, 881, 1167, 1447, 1728, 2006, 2281, 
-    2557, 2823, 3092, 3350, 3610, 3862, 4106, 4354, 4584, 4822, 5045, 5265, 5482, 5689, 5896, 6090, 
-    6291, 6471, 6659, 6834, 7004, 7175, 7332, 7491, 7634, 7787, 7914, 8054, 8171, 8289, 8401, 8499, 
-    8594, 8680, 8754, 8823, 8879, 8927, 8968, 8989, 9014, 9017, 9015, 9003, 8976, 8945, 8900, 8848, 
-    8782, 8715, 8629, 8546, 8444, 8344, 8232, 8110, 7993, 7854, 7725, 7584, 7431, 7289, 7126, 6973, 
-    6807, 6638, 6469, 6291, 6114, 5931, 5738, 5554, 5351, 5152, 4949, 4732, 4522, 4298, 4072, 3839, 
-    3602, 3358, 3109, 2853, 2593, 2328, 2053, 1783, 1492, 1219, 920, 633, 338, 34, -255, -562, 
-    -861, -1157, -1469, -1752, -2062, -2343, -2639, -2921, -3201, -3478, -3742, -4007, -4258, -4505, -4744, -4977, 
-    -5194, -5413, -5614, -5811, -5998, -6179, -6343, -6513, -6655, -6811, -6939, -7077, -7195, -7313, -7420, -7529, 
-    -7617, -7720, -7797, -7880, -7960, -8021, -8098, -8150, -8206, -8257, -8300, -8338, -8373, -8393, -8423, -8426, 
-    -8440, -8436, -8424, -8414, -8383, -8349, -8309, -8249, -8197, -8112, -8045, -7935, -7845, -7729, -7598, -7480, 
-    -7322, -7176, -7015, -6838, -6663, -6474, -6274, -6075, -5864, -5644, -5424, -5194, -4962, -4728, -4482, -4244, 
-    -3991, -3750, -3496, -3251, -2989, -2751, -2482, -2249, -1984, -1739, -1487, -1240, -989, -747, -496, -253, 
-    -11, 233, 470, 709, 952, 1183, 1422, 1654, 1884, 2115, 2346, 2567, 2799, 3012, 3239, 3448, 
-    3669, 3870, 4086, 4279, 4481, 4677, 4858, 5051, 5216, 5399, 5554, 5719, 5863, 6010, 6140, 6272, 
-    6385, 6499, 6598, 6689, 6773, 6846, 6911, 6969, 7009, 7057, 7075, 7105, 7111, 7119, 7114, 7102, 
-    7086, 7058, 7031, 6989, 6944, 6900, 6836, 6786, 6712, 6648, 6570, 6493, 6409, 6321, 6232, 6130, 
-    6038, 5925, 5823, 5706, 5590, 5467, 5343, 5208, 5077, 4932, 4791, 4644, 4484, 4332, 4158, 4004, 
-    3819, 3654, 3461, 3284, 3091, 2902, 2704, 2504, 2306, 2097, 1896, 1683, 1476, 1263, 1053, 837, 
-    626, 409, 199, -20, -227, -446, -659, -867, -1084, -1289, -1504, -1704, -1922, -2112, -2327, -2524, 
-    -2721, -2922, -3112, -3302, -3496, -3673, -3862, -4031, -4208, -4372, -4537, -4690, -4843, -4983, -5125, -5248, 
-    -5377, -5483, -5595, -5688, -5774, -5858, -5918, -5986, -6028, -6073, -6099, -6120, -6128, -6130, -6117, -6099, 
-    -6072, -6028, -5988, -5927, -5866, -5795, -5714, -5630, -5541, -5437, -5340, -5222, -5116, -4992, -4872, -4739, 
-    -4613, -4471, -4338, -4193, -4045, -3901, -3741, -3593, -3428, -3274, -3100, -2941, -2762, -2595, -2414, -2237, 
-    -2052, -1868, -1681, -1493, -1300, -1106, -911, -716, -515, -321, -121, 77, 271, 473, 666, 859, 
-    1052, 1240, 1427, 1614, 1786, 1971, 2139, 2308, 2476, 2631, 2791, 2941, 3088, 3227, 3366, 3498, 
-    3622, 3746, 3864, 3970, 4087, 4179, 4282, 4371, 4457, 4542, 4611, 4691, 4748, 4813, 4866, 4916, 
-    4960, 4996, 5030, 5056, 5074, 5094, 5095, 5101, 5094, 5085, 5065, 5042, 5009, 4970, 4929, 4871, 
-    4819, 4748, 4679, 4598, 4517, 4423, 4326, 4225, 4113, 4005, 3884, 3763, 3632, 3507, 3362, 3235, 
-    3088, 2946, 2799, 2651, 2496, 2356, 2192, 2047, 1890, 1736, 1580, 1430, 1268, 1123, 954, 808, 
-    645, 490, 335, 169, 16, -149, -307, -473, -635, -802, -966, -1138, -1302, -1474, -1640, -1815, 
-    -1981, -2153, -2321, -2491, -2660, -2825, -2990, -3151, -3314, -3474, -3624, -3779, -3924, -4069, -4209, -4342, 
-    -4469, -4597, -4711, -4831, -4931, -5038, -5131, -5219, -5307, -5379, -5452, -5514, -5575, -5620, -5670, -5702, 
-    -5736, -5763, -5777, -5792, -5793, -5794, -5787, -5771, -5751, -5720, -5688, -5644, -5600, -5539, -5484, -5404, 
-    -5341, -5245, -5170, -5062, -4964, -4854, -4736, -4611, -4484, -4344, -4203, -4056, -3895, -3738, -3572, -3396, 
-    -3226, -3036, -2852, -2662, -2463, -2267, -2059, -1856, -1640, -1433, -1209, -999, -771, -552, -327, -101, 
-    125, 351, 584, 810, 1038, 1273, 1496, 1731, 1956, 2186, 2407, 2641, 2853, 3085, 3296, 3517, 
-    3732, 3937, 4151, 4345, 4551, 4741, 4931, 5111, 5291, 5459, 5624, 5781, 5927, 6074, 6201, 6334, 
-    6439, 6561, 6645, 6747, 6819, 6894, 6957, 7008, 7054, 7089, 7116, 7139, 7144, 7155, 7145, 7141, 
-    7121, 7100, 7071, 7037, 6999, 6951, 6910, 6849, 6799, 6734, 6668, 6600, 6527, 6446, 6366, 6276, 
-    6182, 6088, 5979, 5877, 5753, 5641, 5507, 5376, 5233, 5084, 4931, 4764, 4602, 4415, 4239, 4044, 
-    3846, 3642, 3434, 3212, 2995, 2766, 2534, 2304, 2059, 1822, 1578, 1333, 1094, 840, 602, 353, 
-    114, -127, -366, -605, -833, -1072, -1291, -1521, -1742, -1957, -2178, -2380, -2599, -2796, -3006, -3201, 
-    -3399, -3595, -3788, -3980, -4167, -4359, -4538, -4731, -4905, -5097, -5270, -5454, -5627, -5806, -5974, -6152, 
-    -6312, -6479, -6639, -6793, -6945, -7093, -7228, -7365, -7492, -7610, -7722, -7824, -7920, -8004, -8081, -8145, 
-    -8202, -8250, -8278, -8308, -8315, -8325, -8311, -8294, -8265, -8221, -8177, -8106, -8048, -7961, -7875, -7781, 
-    -7671, -7563, -7441, -7313, -7182, -7037, -6898, -6733, -6590, -6414, -6254, -6076, -5897, -5713, -5525, -5330, 
-    -5129, -4930, -4716, -4504, -4287, -4059, -3834, -3602, -3358, -3127, -2870, -2628, -2371, -2113, -1857, -1589, 
-    -1327, -1058, -787, -520, -245, 24, 296, 570, 839, 1106, 1378, 1640, 1904, 2166, 2419, 2674, 
-    2922, 3168, 3406, 3642, 3872, 4100, 4317, 4537, 4742, 4951, 5148, 5341, 5533, 5710, 5895, 6058, 
-    6234, 6387, 6548, 6691, 6841, 6972, 7110, 7228, 7351, 7463, 7565, 7671, 7755, 7849, 7919, 7996, 
-    8054, 8113, 8159, 8200, 8233, 8254, 8275, 8277, 8278, 8272, 8247, 8232, 8186, 8153, 8099, 8041, 
-    7978, 7900, 7824, 7732, 7643, 7534, 7433, 7314, 7196, 7074, 6932, 6807, 6654, 6511, 6359, 6191, 
-    6043, 5858, 5698, 5510, 5331, 5143, 4949, 4753, 4554, 4340, 4143, 3914, 3713, 3476, 3268, 3026, 
-    2809, 2565, 2336, 2100, 1859, 1622, 1381, 1139, 900, 659, 416, 179, -59, -300, -531, -773, 
-    -1004, -1234, -1466, -1697, -1917, -2151, -2362, -2588, -2806, -3019, -3233, -3443, -3648, -3857, -4054, -4255, 
-    -4450, -4640, -4830, -5012, -5189, -5368, -5531, -5702, -5855, -6010, -6159, -6289, -6431, -6548, -6671, -6779, 
-    -6877, -6974, -7054, -7132, -7198, -7252, -7304, -7341, -7372, -7392, -7407, -7407, -7407, -7387, -7371, -7337, 
-    -7303, -7257, -7203, -7146, -7080, -7005, -6932, -6842, -6758, -6658, -6559, -6454, -6343, -6231, -6107, -5986, 
-    -5857, -5720, -5592, -5438, -5301, -5148, -4991, -4837, -4668, -4503, -4332, -4154, -3978, -3788, -3608, -3409, 
-    -3220, -3019, -2820, -2617, -2407, -2202, -1990, -1779, -1567, -1351, -1135, -929, -705, -502, -282, -78, 
-    133, 335, 543, 738, 940, 1126, 1324, 1500, 1686, 1861, 2032, 2198, 2361, 2512, 2669, 2808, 
-    2954, 3084, 3218, 3335, 3460, 3569, 3683, 3784, 3883, 3976, 4067, 4154, 4230, 4314, 4381, 4453, 
-    4522, 4579, 4642, 4695, 4747, 4798, 4844, 4889, 4926, 4965, 4997, 5030, 5056, 5083, 5097, 5121, 
-    5129, 5138, 5146, 5137, 5140, 5123, 5111, 5089, 5056, 5030, 4981, 4946, 4883, 4832, 4760, 4695, 
-    4613, 4531, 4442, 4343, 4248, 4137, 4030, 3910, 3794, 3667, 3540, 3411, 3273, 3144, 2994, 2864, 
-    2713, 2576, 2424, 2282, 2130, 1985, 1837, 1691, 1536, 1394, 1240, 1093, 949, 796, 654, 502, 
-    356, 214, 68, -78, -215, -364, -498, -639, -777, -908, -1046, -1176, -1300, -1436, -1541, -1680, 
-    -1780, -1902, -2006, -2113, -2210, -2312, -2396, -2488, -2567, -2644, -2717, -2781, -2844, -2898, -2949, -2995, 
-    -3030, -3069, -3092, -3115, -3134, -3141, -3149, -3147, -3139, -3129, -3116, -3084, -3070, -3025, -2999, -2953, 
-    -2909, -2862, -2807, -2752, -2695, -2630, -2566, -2499, -2426, -2358, -2279, -2205, -2127, -2044, -1965, -1873, 
-    -1798, -1699, -1619, -1522, -1432, -1336, -1242, -1144, -1041, -951, -838, -741, -639, -526, -434, -317, 
-    -221, -108, -9, 97, 203, 298, 404, 502, 593, 696, 781, 872, 962, 1040, 1127, 1198, 
-    1281, 1342, 1425, 1479, 1550, 1610, 1666, 1727, 1780, 1827, 1890, 1924, 1984, 2020, 2067, 2112, 
-    2148, 2189, 2224, 2257, 2293, 2316, 2349, 2367, 2389, 2405, 2417, 2427, 2430, 2426, 2428, 2406, 
-    2404, 2373, 2352, 2319, 2285, 2237, 2198, 2140, 2087, 2024, 1958, 1885, 1814, 1731, 1647, 1563, 
-    1464, 1379, 1271, 1176, 1065, 962, 841, 741, 610, 503, 368, 253, 122, -3, -135, -266, 
-    -398, -532, -669, -801, -936, -1070, -1205, -1335, -1467, -1596, -1722, -1846, -1964, -2087, -2195, -2312, 
-    -2414, -2515, -2619, -2703, -2802, -2881, -2964, -3040, -3109, -3180, -3240, -3302, -3356, -3405, -3458, -3499, 
-    -3541, -3580, -3613, -3645, -3673, -3698, -3722, -3738, -3755, -3771, -3769, -3790, -3779, -3787, -3778, -3770, 
-    -3759, -3743, -3720, -3700, -3665, -3640, -3592, -3562, -3502, -3469, -3395, -3351, -3276, -3214, -3141, -3065, 
-    -2983, -2902, -2813, -2721, -2633, -2526, -2433, -2325, -2220, -2110, -1997, -1883, -1765, -1646, -1522, -1397, 
-    -1269, -1143, -1007, -877, -736, -600, -460, -313, -174, -20, 124, 271, 435, 575, 744, 895, 
-    1052, 1222, 1369, 1545, 1698, 1864, 2030, 2190, 2356, 2517, 2683, 2840, 3003, 3161, 3315, 3476, 
-    3620, 3777, 3917, 4069, 4205, 4342, 4479, 4604, 4737, 4852, 4975, 5083, 5197, 5292, 5402, 5484, 
-    5581, 5653, 5739, 5802, 5874, 5926, 5986, 6025, 6076, 6099, 6136, 6152, 6170, 6177, 6179, 6174, 
-    6159, 6144, 6115, 6082, 6044, 5993, 5943, 5878, 5811, 5740, 5652, 5569, 5472, 5373, 5267, 5156, 
-    5038, 4915, 4790, 4656, 4523, 4382, 4240, 4096, 3943, 3795, 3641, 3481, 3330, 3166, 3004, 2845, 
-    2677, 2517, 2347, 2179, 2012, 1841, 1672, 1496, 1326, 1147, 973, 793, 613, 429, 245, 58, 
-    -129, -323, -510, -714, -899, -1108, -1298, -1503, -1702, -1903, -2103, -2306, -2502, -2701, -2898, -3090, 
-    -3282, -3473, -3655, -3839, -4015, -4190, -4359, -4525, -4683, -4843, -4988, -5137, -5279, -5411, -5545, -5668, 
-    -5789, -5906, -6016, -6119, -6221, -6318, -6406, -6494, -6571, -6649, -6720, -6778, -6843, -6890, -6938, -6979, 
-    -7011, -7035, -7059, -7065, -7076, -7065, -7060, -7033, -7015, -6973, -6931, -6876, -6817, -6748, -6670, -6589, 
-    -6488, -6400, -6279, -6179, -6043, -5930, -5785, -5654, -5503, -5360, -5199, -5045, -4882, -4712, -4546, -4369, 
-    -4195, -4015, -3829, -3649, -3455, -3274, -3070, -2888, -2679, -2492, -2281, -2085, -1879, -1671, -1467, -1249, 
-    -1046, -832, -617, -406, -188, 26, 236, 461, 666, 889, 1095, 1313, 1520, 1730, 1935, 2140, 
-    2340, 2538, 2732, 2922, 3110, 3292, 3471, 3645, 3813, 3978, 4137, 4291, 4441, 4583, 4724, 4854, 
-    4979, 5106, 5213, 5333, 5429, 5530, 5627, 5707, 5795, 5866, 5940, 6004, 6065, 6118, 6168, 6214, 
-    6252, 6287, 6317, 6337, 6364, 6372, 6384, 6388, 6387, 6383, 6374, 6353, 6340, 6307, 6282, 6241, 
-    6202, 6154, 6102, 6041, 5979, 5909, 5832, 5752, 5661, 5569, 5469, 5361, 5254, 5131, 5011, 4877, 
-    4746, 4601, 4459, 4300, 4149, 3982, 3817, 3644, 3469, 3284, 3105, 2911, 2723, 2526, 2325, 2129, 
-    1922, 1720, 1512, 1302, 1096, 883, 678, 465, 262, 48, -150, -363, -559, -762, -961, -1151, 
-    -1352, -1534, -1726, -1904, -2085, -2263, -2433, -2603, -2763, -2929, -3082, -3235, -3388, -3525, -3673, -3803, 
-    -3934, -4065, -4181, -4305, -4409, -4519, -4622, -4713, -4808, -4886, -4965, -5034, -5101, -5155, -5204, -5250, 
-    -5277, -5315, -5324, -5340, -5343, -5338, -5332, -5306, -5282, -5251, -5204, -5164, -5102, -5046, -4978, -4907, 
-    -4827, -4746, -4656, -4564, -4467, -4366, -4263, -4152, -4047, -3924, -3813, -3692, -3568, -3447, -3319, -3188, 
-    -3066, -2923, -2800, -2657, -2521, -2385, -2243, -2100, -1962, -1809, -1673, -1518, -1377, -1220, -1082, -921, 
-    -777, -626, -472, -325, -173, -24, 124, 270, 422, 563, 711, 851, 994, 1132, 1270, 1405, 
-    1539, 1667, 1800, 1922, 2050, 2169, 2288, 2408, 2517, 2634, 2735, 2851, 2948, 3051, 3152, 3240, 
-    3343, 3426, 3514, 3598, 3675, 3754, 3822, 3895, 3951, 4017, 4066, 4121, 4161, 4200, 4235, 4259, 
-    4284, 4296, 4305, 4309, 4300, 4297, 4270, 4254, 4220, 4182, 4142, 4086, 4039, 3969, 3909, 3827, 
-    3758, 3662, 3584, 3480, 3388, 3281, 3173, 3058, 2946, 2817, 2703, 2561, 2442, 2294, 2163, 2018, 
-    1872, 1725, 1571, 1418, 1263, 1099, 944, 771, 615, 438, 281, 97, -61, -242, -408, -583, 
-    -755, -925, -1098, -1261, -1436, -1594, -1762, -1919, -2077, -2229, -2380, -2524, -2666, -2803, -2934, -3063, 
-    -3187, -3300, -3417, -3522, -3626, -3723, -3813, -3904, -3985, -4062, -4133, -4200, -4266, -4322, -4377, -4425, 
-    -4467, -4514, -4542, -4583, -4604, -4628, -4648, -4661, -4671, -4679, -4676, -4674, -4663, -4652, -4626, -4610, 
-    -4568, -4541, -4494, -4445, -4395, -4325, -4268, -4186, -4112, -4023, -3933, -3833, -3730, -3621, -3505, -3389, 
-    -3259, -3134, -2998, -2865, -2719, -2584, -2427, -2288, -2132, -1981, -1829, -1669, -1517, -1358, -1203, -1042, 
-    -887, -724, -573, -406, -253, -93, 69, 221, 388, 548, 705, 872, 1031, 1197, 1363, 1530, 
-    1695, 1869, 2032, 2210, 2374, 2557, 2721, 2905, 3070, 3252, 3419, 3601, 3764, 3938, 4108, 4269, 
-    4438, 4594, 4749, 4903, 5049, 5192, 5330, 5458, 5588, 5699, 5821, 5916, 6023, 6109, 6193, 6270, 
-    6339, 6396, 6454, 6494, 6534, 6564, 6585, 6599, 6607, 6605, 6595, 6584, 6553, 6528, 6486, 6445, 
-    6390, 6331, 6264, 6190, 6116, 6019, 5937, 5826, 5729, 5609, 5497, 5366, 5240, 5100, 4958, 4813, 
-    4654, 4501, 4334, 4163, 3990, 3806, 3628, 3431, 3246, 3037, 2840, 2632, 2416, 2207, 1982, 1759, 
-    1534, 1303, 1072, 833, 598, 353, 116, -132, -370, -624, -859, -1119, -1351, -1606, -1843, -2085, 
-    -2326, -2558, -2792, -3024, -3241, -3467, -3676, -3890, -4091, -4291, -4477, -4667, -4843, -5015, -5184, -5339, 
-    -5494, -5641, -5777, -5920, -6037, -6173, -6279, -6402, -6499, -6610, -6700, -6799, -6885, -6967, -7049, -7122, 
-    -7190, -7261, -7315, -7376, -7423, -7467, -7512, -7536, -7578, -7584, -7614, -7612, -7622, -7611, -7605, -7580, 
-    -7558, -7517, -7480, -7428, -7371, -7302, -7233, -7144, -7065, -6957, -6861, -6743, -6629, -6496, -6368, -6222, 
-    -6078, -5922, -5763, -5595, -5423, -5246, -5054, -4876, -4673, -4477, -4272, -4058, -3850, -3625, -3409, -3177, 
-    -2951, -2713, -2478, -2238, -1991, -1751, -1494, -1248, -991, -738, -478, -223, 39, 300, 560, 823, 
-    1084, 1350, 1607, 1872, 2129, 2390, 2647, 2905, 3154, 3409, 3654, 3901, 4141, 4377, 4611, 4834, 
-    5066, 5270, 5493, 5688, 5892, 6081, 6267, 6441, 6615, 6771, 6930, 7075, 7208, 7344, 7458, 7578, 
-    7674, 7780, 7858, 7946, 8014, 8075, 8140, 8177, 8230, 8253, 8284, 8306, 8313, 8325, 8324, 8309, 
-    8308, 8277, 8259, 8226, 8182, 8148, 8087, 8037, 7971, 7903, 7829, 7746, 7659, 7560, 7465, 7352, 
-    7239, 7120, 6986, 6856, 6710, 6561, 6408, 6239, 6077, 5891, 5714, 5518, 5322, 5119, 4906, 4698, 
-    4461, 4251, 3999, 3778, 3523, 3281, 3028, 2774, 2517, 2254, 1993, 1725, 1461, 1193, 922, 658, 
-    386, 122, -142, -414, -667, -939, -1187, -1449, -1700, -1949, -2197, -2438, -2682, -2911, -3152, -3373, 
-    -3603, -3822, -4041, -4253, -4464, -4667, -4871, -5066, -5265, -5447, -5637, -5818, -5987, -6168, -6323, -6488, 
-    -6642, -6788, -6932, -7062, -7193, -7311, -7425, -7530, -7622, -7712, -7791, -7857, -7924, -7965, -8016, -8042, 
-    -8067, -8078, -8084, -8072, -8067, -8031, -8010, -7956, -7919, -7849, -7794, -7714, -7634, -7549, -7455, -7352, 
-    -7252, -7130, -7022, -6894, -6770, -6636, -6495, -6361, -6206, -6062, -5904, -5746, -5586, -5414, -5247, -5072, 
-    -4895, -4711, -4527, -4337, -4148, -3949, -3752, -3550, -3346, -3136, -2932, -2712, -2505, -2281, -2069, -1845, 
-    -1624, -1403, -1171, -956, -721, -497, -272, -37, 183, 418, 641, 871, 1097, 1325, 1547, 1775, 
-    1992, 2216, 2433, 2648, 2863, 3070, 3280, 3480, 3683, 3874, 4071, 4249, 4436, 4607, 4778, 4939, 
-    5097, 5243, 5391, 5520, 5655, 5769, 5888, 5988, 6086, 6179, 6253, 6336, 6391, 6463, 6501, 6553, 
-    6585, 6614, 6638, 6655, 6659, 6671, 6656, 6656, 6636, 6616, 6592, 6554, 6523, 6476, 6430, 6376, 
-    6316, 6255, 6179, 6113, 6025, 5943, 5851, 5750, 5651, 5542, 5425, 5307, 5179, 5050, 4911, 4772, 
-    4621, 4469, 4315, 4143, 3991, 3807, 3642, 3460, 3278, 3101, 2910, 2726, 2537, 2344, 2159, 1959, 
-    1776, 1577, 1391, 1198, 1009, 819, 634, 444, 266, 76, -100, -284, -458, -638, -807, -988, 
-    -1149, -1326, -1488, -1657, -1815, -1981, -2135, -2295, -2447, -2598, -2751, -2893, -3041, -3178, -3319, -3452, 
-    -3582, -3708, -3832, -3950, -4064, -4174, -4276, -4376, -4468, -4555, -4641, -4707, -4788, -4838, -4904, -4949, 
-    -4994, -5025, -5064, -5075, -5100, -5104, -5109, -5106, -5096, -5075, -5059, -5024, -4999, -4952, -4911, -4856, 
-    -4805, -4739, -4681, -4604, -4531, -4450, -4368, -4276, -4188, -4087, -3986, -3884, -3772, -3657, -3545, -3416, 
-    -3299, -3166, -3036, -2899, -2762, -2617, -2476, -2325, -2176, -2020, -1866, -1707, -1550, -1382, -1227, -1055, 
-    -899, -727, -565, -395, -237, -62, 89, 266, 411, 590, 732, 900, 1049, 1202, 1354, 1497, 
-    1643, 1783, 1921, 2056, 2181, 2313, 2431, 2550, 2668, 2768, 2885, 2971, 3079, 3163, 3251, 3334, 
-    3404, 3478, 3544, 3601, 3660, 3709, 3750, 3797, 3819, 3864, 3873, 3903, 3910, 3922, 3928, 3924, 
-    3927, 3910, 3903, 3883, 3864, 3841, 3810, 3780, 3744, 3707, 3664, 3621, 3570, 3524, 3462, 3410, 
-    3348, 3281, 3218, 3143, 3069, 2994, 2905, 2828, 2732, 2645, 2543, 2444, 2339, 2231, 2118, 2002, 
-    1883, 1758, 1630, 1501, 1366, 1229, 1090, 946, 804, 656, 509, 362, 208, 61, -89, -241, 
-    -389, -536, -690, -828, -981, -1118, -1263, -1396, -1536, -1668, -1797, -1928, -2049, -2171, -2294, -2403, 
-    -2522, -2627, -2737, -2838, -2940, -3034, -3134, -3218, -3314, -3392, -3478, -3555, -3632, -3703, -3770, -3840, 
-    -3896, -3957, -4006, -4059, -4100, -4141, -4174, -4203, -4228, -4248, -4255, -4270, -4265, -4261, -4255, -4233, 
-    -4214, -4185, -4148, -4113, -4062, -4014, -3954, -3897, -3823, -3757, -3674, -3596, -3506, -3417, -3321, -3219, 
-    -3122, -3006, -2908, -2779, -2679, -2543, -2431, -2304, -2171, -2046, -1912, -1776, -1643, -1501, -1361, -1223, 
-    -1074, -933, -784, -634, -489, -332, -187, -24, 117, 285, 429, 595, 746, 908, 1060, 1225, 
-    1376, 1541, 1694, 1851, 2007, 2163, 2318, 2472, 2620, 2771, 2919, 3064, 3208, 3350, 3480, 3623, 
-    3747, 3877, 4001, 4118, 4234, 4345, 4448, 4551, 4645, 4738, 4820, 4905, 4973, 5049, 5107, 5169, 
-    5220, 5267, 5310, 5340, 5379, 5394, 5422, 5428, 5440, 5440, 5439, 5427, 5418, 5390, 5376, 5335, 
-    5308, 5262, 5220, 5164, 5113, 5048, 4984, 4912, 4830, 4753, 4662, 4574, 4472, 4372, 4261, 4153, 
-    4030, 3913, 3781, 3650, 3519, 3369, 3234, 3078, 2930, 2771, 2615, 2448, 2288, 2111, 1949, 1767, 
-    1599, 1414, 1241, 1056, 879, 695, 511, 329, 145, -36, -218, -398, -582, -757, -939, -1112, 
-    -1289, -1463, -1633, -1802, -1969, -2137, -2301, -2456, -2623, -2770, -2937, -3074, -3240, -3370, -3531, -3660, 
-    -3807, -3944, -4072, -4213, -4330, -4467, -4581, -4703, -4817, -4928, -5036, -5139, -5234, -5334, -5415, -5508, 
-    -5580, -5656, -5722, -5785, -5837, -5892, -5931, -5968, -6001, -6018, -6043, -6049, -6056, -6053, -6044, -6030, 
-    -6007, -5983, -5946, -5911, -5865, -5811, -5759, -5694, -5629, -5553, -5483, -5386, -5318, -5203, -5124, -5008, 
-    -4906, -4791, -4676, -4550, -4428, -4294, -4157, -4023, -3871, -3731, -3575, -3419, -3265, -3096, -2938, -2765, 
-    -2595, -2424, -2249, -2066, -1895, -1706, -1529, -1348, -1157, -981, -790, -608, -426, -235, -59, 129, 
-    311, 487, 676, 846, 1037, 1202, 1387, 1555, 1733, 1903, 2073, 2239, 2411, 2569, 2738, 2892, 
-    3055, 3205, 3360, 3509, 3650, 3801, 3930, 4072, 4198, 4321, 4447, 4561, 4670, 4781, 4872, 4973, 
-    5061, 5138, 5224, 5285, 5359, 5412, 5467, 5515, 5555, 5594, 5622, 5649, 5671, 5683, 5700, 5696, 
-    5709, 5696, 5694, 5684, 5662, 5647, 5619, 5591, 5562, 5520, 5480, 5434, 5381, 5329, 5264, 5205, 
-    5128, 5059, 4971, 4891, 4794, 4703, 4594, 4490, 4374, 4256, 4128, 4005, 3860, 3733, 3576, 3438, 
-    3280, 3127, 2965, 2810, 2636, 2480, 2303, 2139, 1965, 1796, 1625, 1452, 1286, 1107, 945, 773, 
-    609, 441, 275, 120, -51, -196, -368, -510, -673, -818, -972, -1115, -1266, -1403, -1551, -1684, 
-    -1827, -1959, -2094, -2224, -2352, -2478, -2603, -2721, -2841, -2957, -3065, -3178, -3282, -3379, -3485, -3571, 
-    -3666, -3752, -3826, -3917, -3973, -4056, -4108, -4173, -4224, -4273, -4317, -4356, -4387, -4419, -4440, -4461, 
-    -4473, -4481, -4489, -4483, -4484, -4468, -4459, -4441, -4410, -4396, -4351, -4326, -4280, -4242, -4189, -4149, 
-    -4079, -4039, -3960, -3914, -3827, -3773, -3686, -3617, -3533, -3452, -3364, -3278, -3185, -3092, -2994, -2901, 
-    -2790, -2702, -2579, -2490, -2364, -2270, -2143, -2040, -1919, -1802, -1687, -1564, -1446, -1326, -1201, -1083, 
-    -957, -831, -711, -583, -462, -337, -209, -90, 37, 158, 279, 405, 520, 643, 760, 878, 
-    992, 1105, 1217, 1326, 1432, 1538, 1637, 1742, 1827, 1931, 2011, 2106, 2183, 2263, 2337, 2413, 
-    2476, 2543, 2598, 2657, 2709, 2752, 2804, 2834, 2879, 2903, 2936, 2957, 2982, 2991, 3012, 3014, 
-    3026, 3026, 3026, 3021, 3014, 3003, 2987, 2977, 2947, 2931, 2903, 2870, 2841, 2806, 2761, 2731, 
-    2672, 2635, 2579, 2526, 2472, 2411, 2346, 2289, 2212, 2151, 2075, 1999, 1929, 1843, 1771, 1687, 
-    1604, 1518, 1438, 1349, 1263, 1182, 1084, 1008, 912, 831, 741, 654, 571, 484, 399, 317, 
-    230, 151, 71, -11, -85, -166, -242, -314, -392, -459, -537, -599, -676, -735, -808, -868, 
-    -930, -999, -1046, -1119, -1166, -1226, -1278, -1329, -1381, -1430, -1477, -1518, -1566, -1600, -1647, -1677, 
-    -1716, -1747, -1773, -1807, -1826, -1850, -1874, -1884, -1906, -1912, -1925, -1929, -1936, -1935, -1932, -1928, 
-    -1920, -1912, -1895, -1882, -1860, -1841, -1815, -1786, -1759, -1722, -1691, -1646, -1613, -1562, -1519, -1472, 
-    -1416, -1369, -1308, -1252, -1192, -1129, -1065, -1000, -933, -860, -795, -716, -649, -569, -498, -417, 
-    -340, -264, -180, -107, -20, 56, 141, 219, 299, 385, 460, 547, 625, 702, 784, 862, 
-    941, 1017, 1093, 1166, 1245, 1311, 1389, 1451, 1524, 1591, 1648, 1719, 1773, 1837, 1888, 1946, 
-    1992, 2048, 2088, 2138, 2172, 2218, 2247, 2286, 2308, 2343, 2358, 2384, 2397, 2412, 2423, 2428, 
-    2432, 2429, 2427, 2415, 2407, 2387, 2368, 2346, 2311, 2288, 2242, 2207, 2161, 2110, 2060, 2000, 
-    1942, 1877, 1809, 1736, 1662, 1582, 1504, 1418, 1330, 1244, 1147, 1061, 960, 864, 766, 665, 
-    564, 465, 357, 258, 151, 51, -56, -155, -266, -359, -471, -565, -670, -770, -865, -965, 
-    -1062, -1154, -1249, -1339, -1429, -1518, -1600, -1688, -1764, -1847, -1923, -1997, -2065, -2138, -2199, -2266, 
-    -2326, -2380, -2437, -2488, -2538, -2579, -2629, -2660, -2709, -2732, -2774, -2794, -2825, -2845, -2871, -2885, 
-    -2906, -2912, -2929, -2934, -2944, -2945, -2947, -2947, -2944, -2940, -2930, -2926, -2909, -2900, -2879, -2866, 
-    -2842, -2822, -2794, -2768, -2739, -2706, -2667, -2636, -2590, -2551, -2504, -2452, -2405, -2347, -2292, -2230, 
-    -2168, -2098, -2034, -1954, -1884, -1800, -1722, -1635, -1549, -1454, -1359, -1268, -1159, -1067, -949, -852, 
-    -732, -627, -508, -392, -273, -153, -31, 89, 216, 335, 469, 585, 716, 839, 964, 1091, 
-    1209, 1341, 1452, 1584, 1692, 1813, 1931, 2036, 2158, 2253, 2371, 2465, 2571, 2667, 2760, 2858, 
-    2936, 3037, 3103, 3198, 3262, 3343, 3411, 3478, 3542, 3600, 3658, 3710, 3757, 3806, 3844, 3879, 
-    3919, 3938, 3971, 3984, 4001, 4010, 4013, 4019, 4005, 4004, 3980, 3965, 3935, 3908, 3867, 3831, 
-    3778, 3736, 3672, 3617, 3551, 3480, 3411, 3332, 3253, 3169, 3084, 2993, 2900, 2809, 2709, 2614, 
-    2514, 2410, 2309, 2203, 2100, 1990, 1887, 1775, 1672, 1553, 1454, 1331, 1233, 1108, 1007, 883, 
-    779, 660, 550, 430, 319, 201, 89, -27, -143, -261, -369, -496, -597, -724, -830, -945, 
-    -1061, -1163, -1286, -1380, -1500, -1597, -1701, -1811, -1901, -2009, -2099, -2197, -2291, -2376, -2475, -2548, 
-    -2649, -2718, -2808, -2882, -2961, -3035, -3109, -3176, -3249, -3310, -3381, -3435, -3503, -3549, -3617, -3652, 
-    -3719, -3749, -3804, -3838, -3874, -3911, -3934, -3968, -3984, -4006, -4016, -4028, -4032, -4033, -4032, -4019, 
-    -4011, -3990, -3971, -3946, -3908, -3882, -3830, -3797, -3737, -3688, -3629, -3562, -3500, -3426, -3350, -3273, 
-    -3188, -3101, -3012, -2916, -2822, -2718, -2619, -2506, -2403, -2285, -2178, -2053, -1939, -1813, -1694, -1562, 
-    -1443, -1303, -1183, -1042, -913, -778, -640, -507, -368, -233, -95, 40, 175, 315, 447, 581, 
-    716, 842, 976, 1106, 1226, 1357, 1472, 1597, 1708, 1828, 1935, 2046, 2154, 2252, 2360, 2447, 
-    2554, 2637, 2732, 2817, 2894, 2987, 3049, 3138, 3200, 3274, 3336, 3398, 3458, 3515, 3563, 3618, 
-    3652, 3707, 3730, 3774, 3799, 3824, 3850, 3856, 3881, 3879, 3889, 3886, 3879, 3873, 3853, 3841, 
-    3813, 3785, 3760, 3716, 3682, 3636, 3585, 3540, 3479, 3423, 3360, 3297, 3226, 3159, 3079, 3009, 
-    2926, 2849, 2760, 2676, 2589, 2498, 2409, 2311, 2219, 2120, 2025, 1922, 1826, 1718, 1620, 1513, 
-    1411, 1305, 1197, 1095, 978, 880, 764, 659, 548, 438, 329, 218, 110, -2, -110, -221, 
-    -330, -438, -549, -655, -765, -868, -979, -1081, -1187, -1289, -1391, -1495, -1590, -1697, -1783, -1889, 
-    -1974, -2073, -2159, -2252, -2336, -2421, -2504, -2584, -2662, -2741, -2809, -2885, -2948, -3016, -3079, -3135, 
-    -3198, -3244, -3297, -3344, -3385, -3428, -3459, -3494, -3521, -3543, -3570, -3577, -3597, -3601, -3603, -3607, 
-    -3601, -3589, -3585, -3558, -3546, -3514, -3491, -3455, -3420, -3375, -3336, -3284, -3233, -3181, -3114, -3058, 
-    -2991, -2919, -2850, -2769, -2696, -2607, -2530, -2432, -2350, -2251, -2153, -2062, -1949, -1857, -1742, -1640, 
-    -1523, -1421, -1296, -1188, -1069, -947, -836, -707, -590, -467, -344, -220, -95, 25, 155, 270, 
-    403, 520, 647, 766, 891, 1006, 1131, 1245, 1363, 1478, 1591, 1702, 1812, 1920, 2020, 2129, 
-    2222, 2322, 2416, 2501, 2598, 2673, 2760, 2833, 2907, 2978, 3041, 3105, 3162, 3215, 3268, 3308, 
-    3356, 3388, 3423, 3454, 3476, 3499, 3514, 3527, 3537, 3539, 3540, 3538, 3527, 3517, 3502, 3478, 
-    3464, 3424, 3405, 3358, 3330, 3281, 3238, 3188, 3132, 3075, 3020, 2947, 2891, 2810, 2742, 2666, 
-    2584, 2506, 2417, 2332, 2246, 2148, 2063, 1960, 1870, 1767, 1671, 1567, 1470, 1363, 1267, 1154, 
-    1064, 946, 852, 743, 641, 539, 432, 331, 227, 128, 21, -76, -180, -280, -379, -482, 
-    -579, -682, -776, -882, -969, -1079, -1166, -1265, -1366, -1447, -1555, -1636, -1732, -1821, -1910, -1991, 
-    -2083, -2162, -2247, -2320, -2406, -2468, -2557, -2611, -2691, -2743, -2818, -2865, -2930, -2977, -3028, -3078, 
-    -3115, -3162, -3192, -3227, -3256, -3281, -3305, -3317, -3341, -3337, -3360, -3349, -3356, -3348, -3337, -3329, 
-    -3307, -3292, -3264, -3237, -3206, -3169, -3134, -3084, -3048, -2991, -2941, -2889, -2821, -2770, -2695, -2637, 
-    -2558, -2493, -2408, -2340, -2252, -2174, -2088, -1999, -1917, -1819, -1735, -1635, -1544, -1443, -1353, -1243, 
-    -1155, -1045, -948, -844, -742, -636, -537, -428, -328, -219, -119, -12, 88, 192, 298, 394, 
-    501, 598, 699, 798, 891, 992, 1083, 1180, 1268, 1358, 1450, 1530, 1622, 1699, 1780, 1865, 
-    1933, 2017, 2087, 2154, 2230, 2289, 2361, 2417, 2479, 2537, 2591, 2644, 2700, 2736, 2797, 2823, 
-    2877, 2905, 2944, 2976, 3001, 3028, 3052, 3068, 3089, 3096, 3110, 3114, 3119, 3117, 3114, 3108, 
-    3095, 3084, 3061, 3049, 3015, 2997, 2955, 2931, 2885, 2854, 2797, 2762, 2701, 2656, 2594, 2538, 
-    2472, 2413, 2340, 2273, 2200, 2128, 2049, 1978, 1890, 1815, 1729, 1649, 1561, 1475, 1390, 1301, 
-    1214, 1123, 1037, 943, 857, 764, 675, 583, 494, 
-};
-const unsigned int drum_v1_p0_long_len = 13193;
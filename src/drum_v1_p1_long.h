@@ -1,741 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v1_p1_long[] PROGMEM = {
-    10, -6, 13, 16, 23, 27, 32, 29, 32, 26, 22, 23, 11, 11, 0, -5, 
-    -12, -23, -28, -43, -46, -62, -67, -82, -93, -101, -117, -125, -141, -154, -166, -184, 
-    -194, -212, -227, -240, -261, -272, -292, -306, -324, -341, -357, -373, -388, -407, -419, -440, 
-    -448, -471, -478, -498, -507, -525, -535, -549, -561, -574, -583, -599, -605, -623, -627, -641, 
-    -652, -660, -675, -680, -694, -703, -714, -723, -734, -745, -756, -766, -776, -787, -798, -808, 
-    -820, -828, -839, -849, -859, -868, -878, -886, -894, -901, -909, -918, -918, -931, -925, -940, 
-    -935, -942, -940, -941, -943, -941, -938, -936, -933, -929, -925, -919, -914, -907, -898, -893, 
-    -880, -876, -863, -854, -843, -832, -818, -811, -790, -785, -761, -756, -729, -724, -695, -689, 
-    -657, -649, -620, -610, -579, -562, -539, -516, -496, -469, -447, -425, -398, -378, -348, -330, 
-    -301, -280, -253, -232, -205, -183, -158, -137, -109, -92, -61, -47, -16, -2, 26, 44, 
-    70, 87, 110, 132, 151, 175, 190, 217, 232, 256, 272, 296, 315, 335, 356, 377, 
-    396, 419, 437, 460, 480, 502, 523, 543, 565, 586, 606, 626, 647, 667, 685, 706, 
-    721, 744, 754, 776, 788, 805, 818, 831, 845, 857, 867, 879, 888, 898, 907, 916, 
-    924, 931, 940, 944, 953, 957, 965, 970, 974, 978, 984, 986, 989, 993, 991, 995, 
-    991, 993, 991, 985, 983, 975, 971, 961, 954, 939, 934, 913, 909, 883, 875, 852, 
-    838, 814, 797, 775, 753, 730, 706, 685, 659, 635, 610, 584, 558, 534, 504, 479, 
-    448, 422, 392, 361, 332, 299, 267, 233, 201, 163, 131, 88, 57, 12, -23, -66, 
-    -105, -146, -189, -233, -273, -318, -361, -405, -448, -491, -534, -580, -618, -664, -704, -746, 
-    -787, -824, -867, -904, -942, -978, -1013, -1050, -1082, -1117, -1146, -1178, -1208, -1235, -1264, -1288, 
-    -1315, -1338, -1362, -1384, -1405, -1424, -1443, -1461, -1477, -1492, -1505, -1518, -1530, -1539, -1549, -1553, 
-    -1562, -1562, -1569, -1565, -1567, -1565, -1558, -1555, -1545, -1540, -1523, -1513, -1496, -1481, -1461, -1441, 
-    -1417, -1394, -1366, -1339, -1309, -1278, -1246, -1207, -1177, -1131, -1102, -1049, -1017, -964, -927, -874, 
-    -830, -778, -729, -676, -624, -569, -515, -456, -401, -338, -284, -219, -160, -96, -34, 31, 
-    92, 162, 223, 293, 359, 425, 495, 563, 629, 701, 766, 838, 905, 973, 1043, 1111, 
-    1179, 1246, 1315, 1380, 1448, 1510, 1578, 1639, 1704, 1762, 1825, 1879, 1941, 1992, 2049, 2099, 
-    2148, 2201, 2241, 2291, 2327, 2371, 2408, 2442, 2474, 2508, 2531, 2561, 2579, 2602, 2619, 2633, 
-    2645, 2654, 2659, 2665, 2661, 2660, 2654, 2643, 2633, 2612, 2599, 2569, 2551, 2513, 2487, 2448, 
-    2409, 2365, 2319, 2271, 2215, 2163, 2100, 2042, 1972, 1906, 1835, 1759, 1685, 1603, 1520, 1436, 
-    1348, 1257, 1167, 1069, 975, 874, 775, 673, 565, 462, 349, 243, 130, 16, -95, -213, 
-    -330, -447, -567, -688, -808, -932, -1054, -1175, -1305, -1422, -1554, -1673, -1802, -1925, -2051, -2173, 
-    -2299, -2421, -2543, -2665, -2782, -2905, -3020, -3137, -3251, -3363, -3476, -3585, -3692, -3800, -3901, -4004, 
-    -4104, -4203, -4295, -4393, -4478, -4575, -4653, -4742, -4819, -4900, -4974, -5046, -5116, -5181, -5244, -5301, 
-    -5358, -5405, -5455, -5493, -5534, -5563, -5590, -5611, -5626, -5637, -5635, -5636, -5622, -5610, -5581, -5555, 
-    -5512, -5474, -5414, -5359, -5289, -5215, -5132, -5042, -4945, -4839, -4725, -4605, -4476, -4340, -4198, -4045, 
-    -3889, -3718, -3551, -3364, -3181, -2982, -2780, -2574, -2352, -2137, -1900, -1673, -1425, -1184, -926, -674, 
-    -408, -143, 126, 402, 676, 960, 1240, 1525, 1812, 2096, 2389, 2671, 2963, 3246, 3533, 3817, 
-    4098, 4375, 4655, 4920, 5198, 5453, 5721, 5967, 6224, 6460, 6704, 6931, 7159, 7375, 7589, 7791, 
-    7989, 8177, 8360, 8533, 8700, 8857, 9008, 9148, 9284, 9408, 9525, 9635, 9734, 9827, 9912, 9985, 
-    10059, 10110, 10170, 10205, 10250, 10268, 10295, 10302, 10309, 10304, 10291, 10275, 10249, 10214, 10174, 10125, 
-    10071, 10010, 9939, 9867, 9780, 9695, 9597, 9496, 9388, 9267, 9151, 9014, 8887, 8735, 8589, 8430, 
-    8266, 8092, 7912, 7722, 7528, 7320, 7106, 6884, 6647, 6408, 6151, 5891, 5616, 5327, 5036, 4724, 
-    4410, 4074, 3734, 3381, 3014, 2636, 2249, 1848, 1436, 1016, 579, 141, -317, -776, -1249, -1732, 
-    -2217, -2720, -3219, -3736, -4250, -4776, -5302, -5838, -6370, -6918, -7450, -8001, -8536, -9087, -9622, -10165, 
-    -10696, -11232, -11751, -12273, -12781, -13282, -13774, -14250, -14719, -15169, -15609, -16029, -16432, -16822, -17183, -17539, 
-    -17859, -18169, -18450, -18713, -18952, -19171, -19357, -19537, -19673, -19807, -19901, -19986, -20040, -20078, -20095, -20091, 
-    -20070, -20030, -19974, -19904, -19816, -19719, -19604, -19485, -19346, -19203, -19049, -18887, -18716, -18537, -18349, -18157, 
-    -17948, -17740, -17514, -17283, -17036, -16782, -16509, -16230, -15920, -15614, -15268, -14928, -14545, -14165, -13750, -13329, 
-    -12878, -12423, -11942, -11458, -10952, -10447, -9926, -9412, -8888, -8371, -7856, -7349, -6852, -6364, -5887, -5425, 
-    -4968, -4533, -4093, -3671, -3240, -2819, -2381, -1940, -1468, -987, -457, 90, 709, 1348, 2073, 2830, 
-    3679, 4573, 5558, 6589, 7731, 8930, 10189, 11492, 12856, 14243, 15671, 17097, 18555, 19977, 21416, 22779, 
-    24187, 25466, 26836, 27711, 27655, 27703, 27671, 27693, 27679, 27689, 27681, 27688, 27682, 27689, 27681, 27687, 
-    27683, 27686, 27686, 27683, 27688, 27681, 27689, 27680, 27690, 27680, 27687, 27681, 27687, 27682, 27686, 27679, 
-    27687, 27680, 27687, 27682, 27686, 27684, 27686, 27684, 27686, 27682, 27689, 27678, 27692, 27675, 27697, 27668, 
-    27707, 27647, 27755, 27412, 25712, 24144, 22457, 20849, 19178, 17547, 15896, 14302, 12697, 11146, 9595, 8131, 
-    6700, 5355, 4049, 2833, 1681, 623, -374, -1303, -2198, -3045, -3879, -4682, -5473, -6237, -7023, -7804, 
-    -8618, -9427, -10265, -11104, -11972, -12864, -13817, -14795, -15820, -16851, -17914, -18977, -20063, -21135, -22217, -23288, 
-    -24361, -25417, -26456, -27419, -27758, -27727, -27744, -27731, -27742, -27734, -27740, -27733, -27740, -27734, -27739, -27734, 
-    -27739, -27733, -27739, -27733, -27739, -27734, -27740, -27733, -27739, -27734, -27741, -27735, -27738, -27736, -27739, -27735, 
-    -27739, -27735, -27738, -27737, -27737, -27736, -27737, -27737, -27736, -27734, -27735, -27737, -27735, -27736, -27738, -27735, 
-    -27739, -27734, -27739, -27737, -27734, -27741, -27733, -27742, -27733, -27739, -27734, -27739, -27733, -27739, -27732, -27742, 
-    -27730, -27746, -27722, -27769, -27466, -25714, -23998, -22214, -20438, -18618, -16810, -14982, -13181, -11388, -9638, -7914, 
-    -6245, -4593, -2996, -1408, 127, 1651, 3122, 4577, 5986, 7385, 8747, 10103, 11422, 12726, 13998, 15260, 
-    16485, 17720, 18911, 20138, 21311, 22550, 23716, 24974, 26118, 27413, 27746, 27654, 27704, 27671, 27696, 27675, 
-    27692, 27678, 27689, 27681, 27690, 27680, 27688, 27681, 27689, 27682, 27687, 27682, 27687, 27682, 27688, 27681, 
-    27688, 27681, 27688, 27683, 27686, 27683, 27687, 27682, 27688, 27681, 27687, 27683, 27687, 27683, 27685, 27684, 
-    27684, 27686, 27682, 27687, 27682, 27687, 27683, 27686, 27686, 27682, 27688, 27681, 27688, 27682, 27688, 27682, 
-    27687, 27682, 27686, 27684, 27686, 27683, 27687, 27682, 27689, 27680, 27688, 27681, 27688, 27681, 27691, 27676, 
-    27699, 27662, 27737, 27160, 25362, 23423, 21458, 19473, 17462, 15441, 13407, 11362, 9293, 7219, 5132, 3051, 
-    974, -1089, -3134, -5164, -7154, -9116, -11032, -12908, -14734, -16510, -18233, -19910, -21523, -23108, -24617, -26139, 
-    -27443, -27756, -27733, -27739, -27738, -27735, -27737, -27738, -27736, -27739, -27735, -27738, -27737, -27737, -27737, -27737, 
-    -27736, -27736, -27737, -27737, -27736, -27738, -27735, -27739, -27733, -27740, -27734, -27742, -27733, -27740, -27733, -27740, 
-    -27734, -27737, -27735, -27737, -27735, -27739, -27735, -27740, -27735, -27738, -27736, -27737, -27736, -27735, -27737, -27738, 
-    -27735, -27739, -27734, -27740, -27735, -27740, -27734, -27739, -27735, -27739, -27735, -27738, -27734, -27739, -27735, -27740, 
-    -27733, -27741, -27732, -27740, -27731, -27741, -27734, -27741, -27734, -27741, -27730, -27743, -27729, -27746, -27724, -27748, 
-    -26052, -23324, -20645, -17884, -15153, -12370, -9623, -6851, -4118, -1385, 1296, 3961, 6574, 9161, 11697, 14186, 
-    16633, 19010, 21356, 23603, 25885, 27519, 27698, 27686, 27680, 27690, 27681, 27687, 27683, 27685, 27686, 27683, 
-    27686, 27684, 27685, 27686, 27682, 27688, 27680, 27689, 27682, 27687, 27684, 27685, 27685, 27685, 27685, 27685, 
-    27684, 27687, 27681, 27689, 27681, 27689, 27681, 27689, 27680, 27689, 27681, 27688, 27682, 27686, 27685, 27685, 
-    27685, 27685, 27684, 27687, 27682, 27689, 27680, 27689, 27679, 27689, 27679, 27688, 27681, 27688, 27681, 27688, 
-    27680, 27691, 27678, 27692, 27677, 27692, 27679, 27689, 27678, 27693, 27675, 27697, 27672, 27698, 27671, 27700, 
-    27669, 27702, 27663, 27711, 27649, 27733, 27607, 27851, 26017, 23278, 20796, 18106, 15514, 12809, 10166, 7451, 
-    4793, 2085, -557, -3224, -5825, -8429, -10975, -13502, -15981, -18420, -20830, -23152, -25528, -27432, -27754, -27737, 
-    -27734, -27741, -27733, -27742, -27732, -27744, -27730, -27744, -27731, -27743, -27732, -27740, -27734, -27739, -27733, -27742, 
-    -27732, -27744, -27730, -27743, -27730, -27744, -27732, -27742, -27733, -27739, -27736, -27740, -27735, -27740, -27734, -27740, 
-    -27735, -27739, -27735, -27738, -27732, -27740, -27730, -27743, -27729, -27745, -27730, -27742, -27730, -27742, -27732, -27742, 
-    -27733, -27741, -27733, -27741, -27732, -27740, -27731, -27740, -27732, -27741, -27732, -27742, -27729, -27744, -27729, -27744, 
-    -27729, -27742, -27728, -27744, -27727, -27749, -27726, -27749, -27724, -27751, -27721, -27753, -27715, -27760, -27709, -27776, 
-    -27679, -27824, -26182, -23755, -21540, -19126, -16783, -14327, -11917, -9432, -6991, -4499, -2071, 393, 2778, 5180, 
-    7501, 9825, 12065, 14309, 16458, 18626, 20671, 22780, 24698, 26840, 27726, 27651, 27708, 27668, 27698, 27674, 
-    27694, 27677, 27691, 27679, 27689, 27682, 27688, 27680, 27690, 27680, 27690, 27679, 27690, 27678, 27691, 27678, 
-    27690, 27679, 27689, 27680, 27686, 27681, 27685, 27682, 27686, 27679, 27690, 27679, 27689, 27680, 27687, 27682, 
-    27688, 27682, 27689, 27681, 27689, 27680, 27690, 27678, 27691, 27677, 27691, 27679, 27688, 27682, 27688, 27680, 
-    27691, 27678, 27691, 27678, 27690, 27679, 27691, 27678, 27690, 27678, 27692, 27676, 27691, 27675, 27695, 27674, 
-    27697, 27669, 27704, 27664, 27707, 27658, 27714, 27647, 27734, 27608, 27837, 26620, 24368, 22424, 20257, 18214, 
-    16034, 13921, 11712, 9537, 7285, 5056, 2760, 481, -1854, -4178, -6541, -8897, -11286, -13662, -16069, -18446, 
-    -20857, -23206, -25644, -27493, -27772, -27724, -27744, -27729, -27742, -27733, -27741, -27732, -27737, -27736, -27735, -27737, 
-    -27736, -27735, -27738, -27732, -27739, -27735, -27739, -27735, -27738, -27732, -27742, -27730, -27743, -27731, -27743, -27732, 
-    -27741, -27734, -27742, -27733, -27740, -27735, -27738, -27734, -27739, -27733, -27741, -27735, -27740, -27736, -27739, -27736, 
-    -27739, -27733, -27740, -27733, -27740, -27735, -27737, -27735, -27738, -27736, -27740, -27733, -27741, -27733, -27742, -27732, 
-    -27742, -27733, -27741, -27733, -27742, -27731, -27745, -27729, -27747, -27728, -27747, -27723, -27755, -27705, -27808, -26480, 
-    -24242, -22065, -19811, -17580, -15303, -13037, -10739, -8456, -6148, -3859, -1561, 708, 2976, 5204, 7423, 9592, 
-    11750, 13844, 15931, 17937, 19938, 21851, 23753, 25569, 27352, 27697, 27679, 27687, 27682, 27686, 27682, 27687, 
-    27681, 27688, 27682, 27688, 27681, 27687, 27682, 27686, 27683, 27685, 27684, 27683, 27686, 27683, 27685, 27682, 
-    27686, 27680, 27687, 27680, 27688, 27682, 27686, 27684, 27685, 27683, 27688, 27681, 27689, 27680, 27687, 27681, 
-    27687, 27681, 27688, 27680, 27690, 27679, 27690, 27678, 27690, 27679, 27691, 27678, 27690, 27678, 27690, 27678, 
-    27692, 27677, 27694, 27674, 27696, 27674, 27696, 27674, 27696, 27671, 27697, 27672, 27698, 27670, 27700, 27666, 
-    27710, 27653, 27726, 27620, 27811, 27122, 24818, 22713, 20487, 18372, 16205, 14113, 11991, 9926, 7843, 5792, 
-    3734, 1694, -350, -2390, -4433, -6481, -8525, -10590, -12637, -14716, -16750, -18832, -20834, -22912, -24826, -26967, 
-    -27814, -27686, -27774, -27710, -27760, -27717, -27756, -27720, -27752, -27722, -27749, -27727, -27746, -27730, -27742, -27732, 
-    -27744, -27730, -27741, -27731, -27741, -27731, -27739, -27733, -27741, -27732, -27742, -27733, -27742, -27733, -27740, -27735, 
-    -27740, -27733, -27742, -27731, -27742, -27733, -27741, -27734, -27741, -27733, -27741, -27732, -27740, -27735, -27738, -27735, 
-    -27739, -27735, -27739, -27735, -27738, -27736, -27740, -27734, -27742, -27731, -27742, -27731, -27741, -27733, -27740, -27734, 
-    -27741, -27732, -27743, -27732, -27742, -27732, -27742, -27732, -27743, -27729, -27749, -27717, -27779, -27579, -25858, -24026, 
-    -22117, -20207, -18228, -16246, -14210, -12165, -10079, -7980, -5852, -3714, -1548, 623, 2830, 5034, 7280, 9512, 
-    11789, 14041, 16333, 18587, 20890, 23115, 25460, 27366, 27705, 27681, 27685, 27686, 27682, 27686, 27683, 27687, 
-    27683, 27685, 27683, 27686, 27682, 27687, 27683, 27686, 27683, 27686, 27683, 27685, 27683, 27684, 27683, 27684, 
-    27686, 27683, 27686, 27682, 27686, 27684, 27685, 27685, 27684, 27686, 27685, 27685, 27684, 27683, 27687, 27681, 
-    27687, 27682, 27685, 27683, 27685, 27683, 27686, 27684, 27684, 27685, 27684, 27684, 27683, 27684, 27684, 27685, 
-    27682, 27694, 27547, 26614, 25410, 24286, 23114, 21987, 20842, 19735, 18621, 17541, 16464, 15418, 14373, 13360, 
-    12343, 11349, 10348, 9358, 8357, 7360, 6339, 5309, 4247, 3166, 2042, 892, -310, -1541, -2829, -4146, 
-    -5518, -6915, -8365, -9840, -11352, -12899, -14461, -16053, -17662, -19275, -20908, -22517, -24144, -25728, -27315, -27751, 
-    -27727, -27743, -27731, -27741, -27735, -27736, -27739, -27736, -27739, -27736, -27736, -27739, -27735, -27739, -27735, -27737, 
-    -27736, -27736, -27735, -27737, -27734, -27737, -27738, -27736, -27738, -27736, -27738, -27737, -27736, -27738, -27737, -27736, 
-    -27736, -27736, -27736, -27738, -27736, -27738, -27734, -27737, -27735, -27736, -27737, -27735, -27739, -27734, -27741, -27732, 
-    -27722, -26912, -25451, -24032, -22584, -21147, -19698, -18259, -16819, -15385, -13962, -12548, -11147, -9765, -8393, -7054, 
-    -5722, -4428, -3145, -1902, -681, 504, 1661, 2784, 3873, 4928, 5945, 6926, 7875, 8785, 9672, 10522, 
-    11356, 12161, 12956, 13728, 14503, 15254, 16024, 16768, 17540, 18294, 19077, 19850, 20654, 21444, 22272, 23077, 
-    23927, 24745, 25619, 26424, 27344, 27752, 27651, 27707, 27669, 27697, 27676, 27693, 27675, 27692, 27676, 27691, 
-    27678, 27692, 27678, 27691, 27678, 27689, 27680, 27688, 27682, 27689, 27680, 27690, 27679, 27689, 27680, 27687, 
-    27682, 27686, 27683, 27687, 27682, 27688, 27680, 27690, 27679, 27691, 27678, 27681, 27316, 26612, 25924, 25173, 
-    24398, 23561, 22690, 21754, 20780, 19739, 18655, 17513, 16332, 15098, 13828, 12516, 11174, 9811, 8425, 7035, 
-    5637, 4249, 2876, 1523, 192, -1099, -2362, -3574, -4746, -5872, -6947, -7976, -8957, -9896, -10792, -11658, 
-    -12488, -13299, -14081, -14854, -15611, -16363, -17106, -17850, -18591, -19332, -20071, -20807, -21545, -22273, -23003, -23713, 
-    -24420, -25104, -25769, -26410, -27025, -27576, -27754, -27729, -27741, -27735, -27737, -27736, -27737, -27737, -27737, -27735, 
-    -27737, -27735, -27737, -27737, -27738, -27737, -27737, -27738, -27737, -27736, -27737, -27736, -27738, -27737, -27736, -27738, 
-    -27735, -27741, -27731, -27745, -27632, -27176, -26714, -26198, -25672, -25088, -24487, -23834, -23150, -22417, -21651, -20834, 
-    -19986, -19084, -18156, -17177, -16173, -15127, -14059, -12961, -11848, -10717, -9576, -8426, -7277, -6125, -4979, -3843, 
-    -2714, -1609, -508, 561, 1623, 2662, 3682, 4687, 5671, 6643, 7593, 8534, 9456, 10367, 11269, 12159, 
-    13037, 13907, 14763, 15604, 16434, 17244, 18036, 18807, 19555, 20277, 20973, 21633, 22272, 22868, 23436, 23960, 
-    24451, 24904, 25313, 25688, 26019, 26314, 26568, 26787, 26969, 27118, 27230, 27311, 27362, 27380, 27373, 27333, 
-    27269, 27172, 27057, 26910, 26744, 26560, 26345, 26125, 25866, 25604, 25305, 25004, 24668, 24330, 23961, 23586, 
-    23192, 22785, 22366, 21934, 21492, 21038, 20573, 20101, 19614, 19120, 18609, 18092, 17558, 17009, 16446, 15865, 
-    15273, 14657, 14026, 13375, 12709, 12020, 11315, 10586, 9842, 9070, 8281, 7468, 6636, 5783, 4904, 4012, 
-    3097, 2173, 1225, 270, -693, -1670, -2648, -3633, -4618, -5596, -6577, -7536, -8498, -9430, -10356, -11246, 
-    -12124, -12968, -13788, -14572, -15330, -16048, -16743, -17388, -18018, -18598, -19160, -19676, -20179, -20637, -21089, -21499, 
-    -21900, -22275, -22628, -22970, -23286, -23590, -23873, -24138, -24385, -24606, -24803, -24975, -25115, -25225, -25299, -25336, 
-    -25334, -25287, -25205, -25071, -24901, -24684, -24429, -24135, -23808, -23444, -23056, -22642, -22204, -21750, -21285, -20805, 
-    -20334, -19843, -19376, -18900, -18442, -17992, -17553, -17125, -16712, -16301, -15905, -15506, -15112, -14713, -14311, -13887, 
-    -13459, -12999, -12526, -12020, -11484, -10919, -10319, -9679, -9014, -8307, -7578, -6818, -6035, -5229, -4409, -3572, 
-    -2731, -1880, -1032, -184, 650, 1482, 2286, 3086, 3846, 4600, 5320, 6019, 6699, 7346, 7984, 8590, 
-    9180, 9750, 10301, 10833, 11358, 11852, 12355, 12824, 13305, 13757, 14215, 14656, 15097, 15523, 15945, 16355, 
-    16757, 17147, 17521, 17893, 18242, 18588, 18911, 19221, 19515, 19778, 20028, 20241, 20430, 20588, 20709, 20797, 
-    20847, 20859, 20834, 20766, 20666, 20526, 20351, 20143, 19899, 19632, 19329, 19014, 18665, 18304, 17918, 17525, 
-    17111, 16690, 16255, 15814, 15368, 14917, 14464, 14014, 13563, 13115, 12668, 12222, 11782, 11341, 10903, 10469, 
-    10036, 9605, 9175, 8750, 8326, 7902, 7485, 7065, 6658, 6244, 5838, 5437, 5036, 4644, 4248, 3858, 
-    3470, 3076, 2690, 2294, 1905, 1507, 1111, 709, 308, -100, -513, -930, -1349, -1771, -2196, -2624, 
-    -3055, -3483, -3923, -4349, -4797, -5226, -5672, -6105, -6550, -6988, -7433, -7870, -8314, -8747, -9186, -9610, 
-    -10034, -10446, -10853, -11245, -11627, -11988, -12341, -12665, -12973, -13255, -13515, -13747, -13954, -14131, -14284, -14407, 
-    -14505, -14574, -14622, -14640, -14640, -14613, -14572, -14507, -14435, -14331, -14239, -14105, -13996, -13846, -13721, -13566, 
-    -13425, -13269, -13112, -12954, -12785, -12619, -12436, -12248, -12050, -11832, -11603, -11352, -11082, -10794, -10479, -10150, 
-    -9798, -9430, -9042, -8646, -8234, -7818, -7393, -6968, -6542, -6119, -5707, -5299, -4917, -4542, -4199, -3869, 
-    -3576, -3300, -3061, -2849, -2666, -2513, -2387, -2287, -2213, -2155, -2118, -2090, -2076, -2061, -2053, -2036, 
-    -2014, -1983, -1936, -1876, -1797, -1701, -1589, -1449, -1301, -1120, -936, -720, -499, -253, -5, 261, 
-    531, 813, 1102, 1392, 1687, 1987, 2281, 2585, 2873, 3171, 3455, 3744, 4022, 4304, 4578, 4855, 
-    5124, 5403, 5674, 5954, 6231, 6511, 6796, 7079, 7363, 7650, 7930, 8206, 8481, 8736, 8994, 9222, 
-    9445, 9642, 9812, 9965, 10079, 10176, 10229, 10260, 10251, 10219, 10151, 10055, 9934, 9786, 9619, 9432, 
-    9234, 9025, 8812, 8594, 8379, 8171, 7968, 7783, 7605, 7452, 7312, 7196, 7097, 7025, 6965, 6940, 
-    6917, 6929, 6938, 6972, 7004, 7047, 7088, 7124, 7160, 7176, 7190, 7178, 7154, 7107, 7037, 6945, 
-    6824, 6682, 6514, 6320, 6105, 5869, 5612, 5340, 5048, 4749, 4436, 4117, 3794, 3464, 3145, 2818, 
-    2516, 2206, 1930, 1654, 1407, 1173, 964, 773, 606, 460, 332, 224, 127, 49, -23, -84, 
-    -143, -200, -253, -314, -376, -452, -536, -633, -749, -872, -1023, -1178, -1359, -1553, -1758, -1985, 
-    -2209, -2455, -2699, -2945, -3193, -3429, -3669, -3884, -4096, -4286, -4465, -4618, -4757, -4876, -4974, -5059, 
-    -5116, -5169, -5198, -5223, -5238, -5246, -5256, -5260, -5275, -5291, -5319, -5353, -5398, -5461, -5527, -5619, 
-    -5709, -5829, -5944, -6086, -6224, -6375, -6532, -6685, -6846, -6998, -7143, -7288, -7409, -7532, -7631, -7716, 
-    -7788, -7831, -7869, -7877, -7878, -7858, -7827, -7786, -7730, -7679, -7605, -7549, -7467, -7413, -7330, -7278, 
-    -7209, -7160, -7108, -7064, -7030, -7001, -6974, -6960, -6941, -6938, -6928, -6925, -6925, -6919, -6921, -6909, 
-    -6904, -6883, -6865, -6832, -6794, -6745, -6688, -6618, -6541, -6440, -6336, -6207, -6071, -5914, -5740, -5553, 
-    -5345, -5121, -4882, -4622, -4352, -4063, -3762, -3446, -3118, -2773, -2425, -2061, -1696, -1322, -944, -567, 
-    -185, 189, 562, 929, 1286, 1637, 1973, 2300, 2612, 2917, 3197, 3481, 3731, 3991, 4223, 4459, 
-    4679, 4897, 5109, 5318, 5526, 5736, 5947, 6157, 6373, 6591, 6810, 7038, 7258, 7492, 7717, 7950, 
-    8173, 8400, 8621, 8839, 9051, 9257, 9458, 9646, 9837, 10006, 10182, 10334, 10492, 10630, 10770, 10895, 
-    11023, 11139, 11256, 11364, 11471, 11577, 11675, 11774, 11866, 11956, 12042, 12118, 12188, 12249, 12298, 12328, 
-    12352, 12345, 12332, 12286, 12231, 12141, 12034, 11895, 11731, 11541, 11317, 11074, 10794, 10499, 10167, 9826, 
-    9445, 9058, 8641, 8212, 7766, 7305, 6837, 6357, 5869, 5379, 4882, 4391, 3895, 3415, 2929, 2462, 
-    1992, 1542, 1097, 667, 243, -157, -557, -932, -1302, -1651, -1989, -2313, -2622, -2916, -3195, -3462, 
-    -3714, -3955, -4179, -4396, -4597, -4797, -4978, -5162, -5329, -5496, -5659, -5807, -5964, -6101, -6246, -6377, 
-    -6510, -6634, -6755, -6866, -6972, -7077, -7166, -7264, -7338, -7426, -7491, -7565, -7623, -7688, -7738, -7799, 
-    -7847, -7905, -7950, -8013, -8058, -8122, -8174, -8240, -8305, -8367, -8442, -8508, -8586, -8656, -8731, -8803, 
-    -8873, -8940, -9000, -9061, -9109, -9159, -9192, -9225, -9241, -9255, -9248, -9247, -9218, -9196, -9150, -9106, 
-    -9048, -8979, -8912, -8826, -8746, -8644, -8555, -8440, -8341, -8220, -8108, -7981, -7859, -7722, -7598, -7447, 
-    -7313, -7151, -7001, -6830, -6659, -6474, -6286, -6086, -5879, -5658, -5426, -5182, -4921, -4652, -4366, -4068, 
-    -3756, -3429, -3097, -2748, -2397, -2035, -1671, -1301, -928, -560, -191, 169, 525, 870, 1203, 1524, 
-    1824, 2115, 2375, 2632, 2849, 3066, 3242, 3416, 3552, 3685, 3785, 3880, 3949, 4009, 4061, 4096, 
-    4132, 4156, 4181, 4208, 4230, 4265, 4294, 4339, 4385, 4442, 4506, 4580, 4660, 4756, 4853, 4968, 
-    5076, 5202, 5325, 5453, 5584, 5710, 5838, 5967, 6082, 6206, 6312, 6428, 6528, 6631, 6722, 6812, 
-    6896, 6975, 7053, 7126, 7197, 7270, 7338, 7414, 7490, 7568, 7657, 7744, 7845, 7944, 8057, 8171, 
-    8297, 8423, 8558, 8694, 8830, 8969, 9099, 9233, 9352, 9468, 9571, 9658, 9736, 9791, 9832, 9849, 
-    9851, 9825, 9779, 9707, 9614, 9498, 9359, 9196, 9016, 8812, 8594, 8354, 8102, 7832, 7551, 7254, 
-    6954, 6635, 6316, 5987, 5655, 5320, 4980, 4641, 4302, 3964, 3630, 3298, 2978, 2656, 2355, 2050, 
-    1768, 1488, 1228, 977, 743, 521, 317, 126, -45, -208, -351, -483, -597, -708, -798, -888, 
-    -967, -1043, -1120, -1191, -1271, -1349, -1439, -1533, -1636, -1749, -1873, -2010, -2158, -2325, -2500, -2695, 
-    -2896, -3119, -3343, -3591, -3837, -4103, -4368, -4646, -4923, -5214, -5495, -5793, -6076, -6375, -6660, -6953, 
-    -7235, -7522, -7801, -8084, -8354, -8629, -8892, -9157, -9411, -9664, -9903, -10141, -10359, -10578, -10774, -10966, 
-    -11139, -11296, -11444, -11565, -11679, -11766, -11840, -11897, -11932, -11956, -11959, -11950, -11925, -11882, -11832, -11760, 
-    -11683, -11590, -11489, -11376, -11256, -11125, -10989, -10841, -10694, -10534, -10371, -10203, -10027, -9856, -9667, -9492, 
-    -9301, -9120, -8932, -8744, -8564, -8374, -8197, -8014, -7838, -7663, -7491, -7323, -7162, -7000, -6847, -6691, 
-    -6541, -6395, -6246, -6102, -5951, -5804, -5653, -5495, -5334, -5161, -4984, -4796, -4599, -4389, -4169, -3935, 
-    -3689, -3429, -3157, -2868, -2569, -2247, -1924, -1572, -1220, -840, -461, -53, 352, 787, 1218, 1676, 
-    2133, 2608, 3083, 3577, 4067, 4574, 5074, 5590, 6095, 6616, 7118, 7635, 8131, 8638, 9125, 9617, 
-    10089, 10564, 11021, 11471, 11909, 12336, 12751, 13157, 13547, 13932, 14296, 14660, 15006, 15341, 15664, 15977, 
-    16279, 16567, 16842, 17104, 17361, 17594, 17822, 18032, 18228, 18415, 18580, 18735, 18867, 18988, 19084, 19168, 
-    19223, 19266, 19276, 19271, 19238, 19180, 19097, 18987, 18850, 18687, 18492, 18272, 18020, 17743, 17436, 17106, 
-    16742, 16366, 15954, 15531, 15077, 14618, 14133, 13642, 13135, 12620, 12105, 11569, 11049, 10505, 9981, 9441, 
-    8912, 8380, 7849, 7324, 6795, 6274, 5750, 5226, 4705, 4183, 3665, 3136, 2618, 2087, 1563, 1027, 
-    493, -46, -591, -1138, -1697, -2257, -2827, -3408, -3988, -4589, -5189, -5805, -6427, -7059, -7703, -8353, 
-    -9011, -9675, -10349, -11019, -11698, -12374, -13045, -13718, -14379, -15032, -15671, -16298, -16904, -17496, -18061, -18607, 
-    -19125, -19619, -20085, -20527, -20941, -21323, -21682, -22008, -22318, -22594, -22851, -23087, -23299, -23501, -23672, -23839, 
-    -23979, -24111, -24221, -24315, -24391, -24446, -24483, -24496, -24484, -24447, -24378, -24284, -24154, -23988, -23785, -23543, 
-    -23261, -22940, -22569, -22163, -21709, -21218, -20682, -20112, -19501, -18862, -18184, -17482, -16756, -16009, -15249, -14471, 
-    -13693, -12906, -12119, -11342, -10560, -9803, -9041, -8304, -7573, -6861, -6163, -5481, -4813, -4156, -3511, -2873, 
-    -2244, -1615, -987, -359, 275, 914, 1566, 2225, 2899, 3588, 4287, 5010, 5738, 6489, 7247, 8020, 
-    8801, 9588, 10377, 11164, 11951, 12721, 13493, 14233, 14971, 15675, 16362, 17022, 17652, 18254, 18825, 19364, 
-    19873, 20351, 20794, 21217, 21601, 21970, 22303, 22620, 22912, 23184, 23433, 23670, 23883, 24087, 24271, 24439, 
-    24599, 24737, 24867, 24978, 25076, 25153, 25216, 25255, 25276, 25270, 25237, 25182, 25092, 24973, 24822, 24636, 
-    24419, 24163, 23874, 23549, 23186, 22793, 22356, 21897, 21392, 20871, 20307, 19729, 19115, 18488, 17828, 17161, 
-    16467, 15766, 15047, 14322, 13582, 12846, 12093, 11348, 10590, 9841, 9087, 8338, 7584, 6840, 6087, 5345, 
-    4596, 3852, 3108, 2356, 1614, 858, 107, -656, -1418, -2189, -2967, -3746, -4543, -5329, -6139, -6938, 
-    -7753, -8561, -9377, -10185, -10999, -11798, -12599, -13383, -14159, -14918, -15660, -16383, -17088, -17756, -18412, -19025, 
-    -19617, -20172, -20692, -21181, -21634, -22047, -22435, -22772, -23093, -23363, -23617, -23826, -24017, -24171, -24308, -24410, 
-    -24494, -24552, -24589, -24605, -24600, -24576, -24533, -24471, -24393, -24297, -24186, -24053, -23913, -23747, -23572, -23371, 
-    -23160, -22924, -22674, -22395, -22099, -21783, -21435, -21074, -20677, -20267, -19824, -19361, -18864, -18350, -17800, -17232, 
-    -16627, -16002, -15343, -14663, -13951, -13216, -12458, -11674, -10872, -10047, -9208, -8351, -7486, -6605, -5723, -4835, 
-    -3943, -3056, -2167, -1288, -413, 452, 1307, 2150, 2982, 3795, 4591, 5376, 6135, 6889, 7606, 8319, 
-    8999, 9675, 10320, 10955, 11565, 12165, 12746, 13312, 13865, 14401, 14928, 15434, 15937, 16414, 16892, 17338, 
-    17787, 18206, 18620, 19012, 19387, 19745, 20083, 20400, 20694, 20968, 21211, 21437, 21631, 21805, 21950, 22066, 
-    22163, 22228, 22272, 22289, 22282, 22254, 22203, 22128, 22033, 21921, 21783, 21634, 21460, 21275, 21067, 20849, 
-    20606, 20354, 20075, 19785, 19472, 19137, 18785, 18405, 18004, 17579, 17124, 16646, 16141, 15603, 15045, 14452, 
-    13838, 13194, 12518, 11830, 11102, 10370, 9599, 8824, 8022, 7213, 6384, 5551, 4702, 3853, 2989, 2132, 
-    1262, 404, -463, -1316, -2177, -3019, -3866, -4694, -5520, -6332, -7133, -7926, -8699, -9465, -10209, -10944, 
-    -11656, -12354, -13028, -13686, -14319, -14927, -15510, -16067, -16594, -17090, -17557, -17989, -18390, -18753, -19085, -19379, 
-    -19641, -19868, -20057, -20220, -20345, -20446, -20515, -20558, -20576, -20568, -20542, -20489, -20425, -20335, -20237, -20119, 
-    -19993, -19851, -19698, -19533, -19357, -19168, -18968, -18747, -18522, -18265, -18006, -17711, -17410, -17070, -16718, -16327, 
-    -15920, -15475, -15008, -14504, -13980, -13426, -12845, -12243, -11613, -10971, -10304, -9625, -8935, -8226, -7523, -6797, 
-    -6087, -5358, -4648, -3927, -3224, -2517, -1827, -1139, -465, 198, 852, 1497, 2128, 2757, 3368, 3980, 
-    4581, 5175, 5770, 6352, 6939, 7517, 8092, 8663, 9228, 9794, 10346, 10896, 11433, 11965, 12486, 12990, 
-    13485, 13959, 14424, 14861, 15290, 15686, 16069, 16423, 16754, 17060, 17338, 17590, 17815, 18009, 18179, 18317, 
-    18428, 18516, 18567, 18602, 18602, 18584, 18536, 18468, 18374, 18259, 18124, 17966, 17786, 17589, 17373, 17141, 
-    16889, 16622, 16340, 16038, 15725, 15389, 15045, 14677, 14302, 13900, 13494, 13064, 12625, 12161, 11691, 11195, 
-    10695, 10166, 9633, 9078, 8515, 7933, 7339, 6733, 6113, 5482, 4840, 4190, 3530, 2866, 2193, 1523, 
-    847, 172, -500, -1173, -1841, -2504, -3160, -3810, -4450, -5085, -5704, -6315, -6912, -7497, -8068, -8626, 
-    -9169, -9694, -10208, -10699, -11179, -11638, -12085, -12510, -12927, -13318, -13706, -14065, -14424, -14757, -15090, -15394, 
-    -15701, -15979, -16256, -16512, -16763, -16992, -17218, -17419, -17618, -17794, -17960, -18107, -18238, -18358, -18450, -18534, 
-    -18583, -18630, -18633, -18636, -18592, -18544, -18449, -18343, -18200, -18034, -17834, -17608, -17348, -17067, -16744, -16401, 
-    -16019, -15608, -15175, -14702, -14208, -13685, -13132, -12560, -11954, -11338, -10695, -10037, -9365, -8678, -7987, -7280, 
-    -6581, -5867, -5167, -4459, -3766, -3080, -2398, -1736, -1076, -438, 190, 806, 1406, 1997, 2572, 3134, 
-    3692, 4232, 4771, 5298, 5825, 6344, 6863, 7374, 7889, 8395, 8906, 9409, 9905, 10408, 10888, 11376, 
-    11838, 12302, 12744, 13176, 13587, 13978, 14351, 14697, 15026, 15326, 15606, 15854, 16085, 16282, 16465, 16615, 
-    16748, 16855, 16939, 17009, 17053, 17089, 17100, 17106, 17093, 17073, 17040, 16998, 16946, 16891, 16820, 16754, 
-    16671, 16591, 16498, 16406, 16299, 16196, 16072, 15956, 15813, 15677, 15518, 15353, 15171, 14974, 14765, 14530, 
-    14285, 14010, 13725, 13405, 13070, 12705, 12317, 11899, 11458, 10988, 10495, 9973, 9429, 8858, 8269, 7653, 
-    7022, 6370, 5703, 5023, 4329, 3629, 2918, 2208, 1490, 776, 66, -645, -1343, -2037, -2721, -3394, 
-    -4054, -4701, -5332, -5953, -6553, -7142, -7712, -8265, -8803, -9323, -9828, -10312, -10784, -11235, -11678, -12094, 
-    -12504, -12893, -13270, -13634, -13978, -14317, -14635, -14944, -15237, -15518, -15783, -16039, -16274, -16499, -16705, -16893, 
-    -17072, -17219, -17366, -17477, -17587, -17662, -17733, -17767, -17803, -17796, -17788, -17741, -17686, -17601, -17496, -17372, 
-    -17220, -17055, -16864, -16654, -16432, -16178, -15928, -15636, -15355, -15033, -14719, -14372, -14022, -13653, -13273, -12879, 
-    -12472, -12050, -11624, -11179, -10736, -10274, -9817, -9341, -8875, -8394, -7918, -7435, -6951, -6468, -5986, -5498, 
-    -5021, -4532, -4057, -3570, -3095, -2610, -2136, -1650, -1177, -691, -216, 265, 746, 1225, 1707, 2184, 
-    2666, 3140, 3616, 4084, 4551, 5008, 5462, 5904, 6342, 6764, 7180, 7583, 7977, 8355, 8720, 9077, 
-    9411, 9742, 10052, 10352, 10642, 10914, 11184, 11436, 11685, 11922, 12150, 12374, 12586, 12794, 12992, 13180, 
-    13365, 13533, 13704, 13850, 13995, 14128, 14240, 14353, 14430, 14514, 14563, 14607, 14623, 14623, 14605, 14561, 
-    14505, 14413, 14315, 14181, 14036, 13861, 13669, 13455, 13223, 12970, 12704, 12419, 12126, 11817, 11502, 11174, 
-    10848, 10503, 10172, 9822, 9487, 9138, 8801, 8457, 8121, 7784, 7448, 7114, 6780, 6452, 6115, 5783, 
-    5447, 5113, 4772, 4426, 4080, 3726, 3368, 3002, 2634, 2254, 1872, 1485, 1091, 697, 295, -104, 
-    -502, -901, -1294, -1683, -2063, -2435, -2797, -3148, -3484, -3811, -4122, -4416, -4700, -4964, -5218, -5455, 
-    -5680, -5886, -6087, -6262, -6442, -6596, -6748, -6887, -7014, -7142, -7250, -7360, -7457, -7551, -7639, -7715, 
-    -7791, -7857, -7917, -7970, -8012, -8054, -8079, -8103, -8112, -8118, -8116, -8101, -8083, -8057, -8024, -7990, 
-    -7945, -7902, -7851, -7804, -7749, -7701, -7644, -7594, -7534, -7487, -7421, -7377, -7305, -7257, -7190, -7127, 
-    -7067, -6992, -6928, -6848, -6771, -6689, -6602, -6512, -6418, -6318, -6219, -6109, -6006, -5890, -5779, -5662, 
-    -5543, -5429, -5306, -5189, -5069, -4951, -4834, -4715, -4600, -4483, -4372, -4255, -4147, -4033, -3925, -3815, 
-    -3704, -3594, -3481, -3367, -3251, -3132, -3010, -2884, -2751, -2620, -2479, -2338, -2190, -2038, -1882, -1720, 
-    -1554, -1385, -1211, -1036, -851, -671, -480, -297, -103, 84, 273, 459, 646, 824, 1003, 1171, 
-    1339, 1493, 1646, 1790, 1925, 2058, 2173, 2292, 2394, 2496, 2586, 2672, 2751, 2825, 2896, 2960, 
-    3026, 3083, 3146, 3201, 3260, 3315, 3375, 3430, 3491, 3546, 3609, 3666, 3731, 3788, 3856, 3913, 
-    3980, 4034, 4103, 4150, 4219, 4264, 4327, 4373, 4429, 4479, 4530, 4574, 4628, 4671, 4725, 4765, 
-    4817, 4866, 4912, 4967, 5015, 5077, 5129, 5200, 5258, 5339, 5407, 5499, 5580, 5679, 5777, 5885, 
-    5996, 6111, 6233, 6353, 6476, 6598, 6720, 6834, 6949, 7056, 7154, 7248, 7326, 7401, 7457, 7507, 
-    7540, 7557, 7566, 7548, 7530, 7480, 7426, 7355, 7262, 7169, 7043, 6925, 6775, 6631, 6460, 6290, 
-    6103, 5910, 5712, 5499, 5291, 5065, 4845, 4611, 4381, 4137, 3900, 3649, 3406, 3152, 2902, 2647, 
-    2393, 2136, 1883, 1625, 1373, 1115, 870, 614, 372, 123, -112, -353, -586, -820, -1044, -1270, 
-    -1485, -1704, -1909, -2113, -2311, -2504, -2690, -2870, -3047, -3212, -3382, -3532, -3691, -3830, -3977, -4105, 
-    -4240, -4355, -4482, -4587, -4702, -4801, -4906, -5001, -5098, -5192, -5286, -5380, -5475, -5574, -5670, -5775, 
-    -5881, -5991, -6113, -6228, -6363, -6492, -6633, -6778, -6927, -7081, -7243, -7398, -7571, -7731, -7906, -8067, 
-    -8241, -8400, -8568, -8720, -8874, -9018, -9158, -9285, -9407, -9512, -9617, -9701, -9780, -9840, -9891, -9925, 
-    -9949, -9951, -9943, -9914, -9873, -9811, -9735, -9638, -9527, -9394, -9244, -9074, -8887, -8681, -8454, -8218, 
-    -7956, -7688, -7392, -7098, -6777, -6453, -6111, -5767, -5413, -5057, -4692, -4328, -3962, -3594, -3236, -2872, 
-    -2521, -2168, -1831, -1496, -1170, -849, -540, -239, 56, 346, 627, 903, 1174, 1439, 1703, 1964, 
-    2221, 2481, 2732, 2993, 3243, 3502, 3754, 4009, 4262, 4511, 4763, 5008, 5252, 5490, 5724, 5950, 
-    6173, 6380, 6591, 6777, 6972, 7139, 7308, 7465, 7607, 7749, 7872, 7995, 8108, 8213, 8318, 8415, 
-    8510, 8606, 8694, 8789, 8877, 8975, 9061, 9162, 9250, 9350, 9442, 9537, 9634, 9725, 9817, 9904, 
-    9993, 10073, 10151, 10219, 10286, 10341, 10389, 10428, 10454, 10472, 10473, 10463, 10438, 10396, 10341, 10268, 
-    10178, 10073, 9947, 9810, 9645, 9475, 9274, 9065, 8835, 8583, 8323, 8036, 7745, 7428, 7107, 6763, 
-    6419, 6052, 5687, 5304, 4923, 4527, 4137, 3732, 3332, 2927, 2520, 2118, 1709, 1307, 908, 510, 
-    117, -269, -654, -1027, -1399, -1756, -2111, -2450, -2786, -3102, -3418, -3709, -4001, -4270, -4534, -4775, 
-    -5012, -5224, -5434, -5616, -5796, -5954, -6097, -6234, -6347, -6460, -6549, -6632, -6706, -6768, -6822, -6869, 
-    -6907, -6943, -6969, -6996, -7017, -7035, -7052, -7066, -7079, -7094, -7099, -7114, -7116, -7128, -7131, -7135, 
-    -7137, -7135, -7135, -7125, -7122, -7099, -7089, -7059, -7035, -6997, -6954, -6903, -6847, -6779, -6703, -6621, 
-    -6527, -6428, -6320, -6201, -6085, -5949, -5820, -5681, -5541, -5400, -5253, -5115, -4970, -4838, -4692, -4568, 
-    -4433, -4316, -4192, -4082, -3968, -3870, -3761, -3672, -3569, -3484, -3384, -3300, -3199, -3112, -3006, -2909, 
-    -2796, -2683, -2561, -2430, -2291, -2142, -1986, -1818, -1643, -1459, -1271, -1070, -873, -661, -460, -246, 
-    -46, 165, 360, 560, 748, 931, 1105, 1270, 1422, 1571, 1701, 1823, 1932, 2030, 2121, 2195, 
-    2261, 2318, 2363, 2405, 2429, 2458, 2468, 2480, 2484, 2481, 2480, 2465, 2457, 2437, 2420, 2397, 
-    2375, 2347, 2323, 2293, 2266, 2237, 2209, 2185, 2159, 2140, 2120, 2105, 2096, 2088, 2089, 2092, 
-    2099, 2116, 2134, 2157, 2194, 2218, 2270, 2305, 2360, 2409, 2463, 2524, 2578, 2642, 2702, 2762, 
-    2824, 2878, 2941, 2988, 3044, 3090, 3133, 3179, 3209, 3253, 3280, 3318, 3342, 3378, 3404, 3439, 
-    3468, 3506, 3540, 3585, 3626, 3677, 3731, 3788, 3850, 3916, 3984, 4061, 4132, 4213, 4289, 4366, 
-    4445, 4513, 4585, 4648, 4708, 4757, 4802, 4835, 4862, 4879, 4881, 4886, 4865, 4851, 4815, 4782, 
-    4736, 4683, 4626, 4562, 4493, 4420, 4346, 4265, 4190, 4105, 4029, 3944, 3873, 3788, 3717, 3641, 
-    3568, 3500, 3425, 3367, 3292, 3237, 3166, 3111, 3047, 2988, 2930, 2868, 2809, 2747, 2682, 2621, 
-    2548, 2483, 2404, 2330, 2247, 2158, 2072, 1966, 1873, 1753, 1644, 1513, 1388, 1247, 1099, 947, 
-    781, 616, 432, 247, 49, -149, -366, -578, -810, -1035, -1279, -1521, -1768, -2025, -2277, -2542, 
-    -2797, -3060, -3321, -3580, -3842, -4095, -4354, -4602, -4856, -5097, -5346, -5579, -5815, -6043, -6265, -6484, 
-    -6692, -6898, -7096, -7286, -7472, -7648, -7823, -7983, -8146, -8295, -8447, -8582, -8724, -8847, -8984, -9090, 
-    -9220, -9318, -9432, -9525, -9621, -9709, -9789, -9863, -9930, -9987, -10039, -10075, -10106, -10123, -10127, -10115, 
-    -10096, -10056, -10004, -9932, -9848, -9743, -9620, -9485, -9325, -9156, -8960, -8760, -8532, -8300, -8045, -7785, 
-    -7510, -7224, -6936, -6630, -6330, -6015, -5706, -5389, -5073, -4757, -4443, -4128, -3821, -3507, -3208, -2901, 
-    -2608, -2310, -2023, -1736, -1458, -1177, -907, -636, -374, -110, 148, 404, 661, 911, 1170, 1416, 
-    1676, 1924, 2184, 2442, 2704, 2975, 3242, 3528, 3807, 4109, 4407, 4719, 5044, 5371, 5716, 6065, 
-    6422, 6794, 7161, 7550, 7929, 8321, 8713, 9099, 9494, 9873, 10259, 10629, 10992, 11349, 11688, 12023, 
-    12335, 12640, 12921, 13193, 13442, 13678, 13891, 14091, 14262, 14430, 14560, 14691, 14787, 14874, 14938, 14983, 
-    15014, 15023, 15015, 14990, 14944, 14885, 14800, 14706, 14588, 14454, 14303, 14132, 13946, 13740, 13519, 13285, 
-    13029, 12766, 12482, 12189, 11876, 11556, 11218, 10870, 10509, 10132, 9751, 9344, 8945, 8512, 8087, 7633, 
-    7188, 6717, 6243, 5760, 5265, 4770, 4258, 3749, 3229, 2709, 2184, 1662, 1131, 611, 82, -428, 
-    -952, -1456, -1966, -2458, -2954, -3432, -3912, -4375, -4835, -5285, -5724, -6162, -6588, -7004, -7421, -7820, 
-    -8226, -8615, -9007, -9392, -9768, -10145, -10515, -10878, -11241, -11587, -11945, -12272, -12614, -12928, -13251, -13549, 
-    -13845, -14124, -14395, -14648, -14890, -15114, -15327, -15520, -15698, -15857, -16002, -16130, -16235, -16330, -16399, -16457, 
-    -16493, -16511, -16516, -16494, -16465, -16409, -16342, -16257, -16152, -16035, -15896, -15745, -15573, -15387, -15184, -14963, 
-    -14730, -14472, -14207, -13920, -13622, -13305, -12976, -12631, -12275, -11904, -11522, -11128, -10722, -10306, -9877, -9442, 
-    -8995, -8538, -8075, -7595, -7120, -6621, -6127, -5616, -5103, -4579, -4046, -3509, -2964, -2409, -1852, -1283, 
-    -714, -137, 443, 1028, 1617, 2211, 2796, 3397, 3981, 4579, 5165, 5748, 6330, 6901, 7469, 8026, 
-    8575, 9109, 9636, 10145, 10643, 11124, 11591, 12042, 12474, 12892, 13286, 13669, 14030, 14373, 14696, 14999, 
-    15284, 15552, 15792, 16020, 16222, 16406, 16572, 16711, 16838, 16937, 17023, 17083, 17127, 17153, 17156, 17149, 
-    17113, 17073, 17002, 16929, 16825, 16720, 16583, 16447, 16279, 16111, 15916, 15710, 15493, 15250, 15004, 14730, 
-    14450, 14151, 13834, 13507, 13156, 12801, 12419, 12032, 11624, 11209, 10777, 10335, 9882, 9421, 8949, 8472, 
-    7986, 7500, 7004, 6511, 6008, 5514, 5011, 4517, 4017, 3521, 3028, 2531, 2041, 1550, 1060, 571, 
-    83, -407, -888, -1385, -1864, -2359, -2841, -3334, -3817, -4304, -4786, -5266, -5745, -6214, -6681, -7138, 
-    -7591, -8032, -8462, -8885, -9287, -9687, -10059, -10428, -10773, -11103, -11421, -11712, -11998, -12254, -12505, -12729, 
-    -12945, -13136, -13321, -13483, -13636, -13771, -13894, -14005, -14098, -14186, -14255, -14315, -14361, -14398, -14418, -14427, 
-    -14422, -14405, -14373, -14324, -14262, -14183, -14086, -13977, -13840, -13698, -13527, -13344, -13141, -12917, -12682, -12422, 
-    -12150, -11860, -11552, -11233, -10895, -10547, -10187, -9813, -9432, -9041, -8640, -8234, -7819, -7404, -6981, -6552, 
-    -6124, -5694, -5257, -4827, -4387, -3959, -3517, -3088, -2654, -2224, -1795, -1373, -947, -533, -115, 288, 
-    696, 1091, 1488, 1869, 2255, 2622, 2996, 3350, 3708, 4051, 4393, 4725, 5053, 5372, 5689, 5993, 
-    6296, 6588, 6876, 7159, 7428, 7700, 7953, 8212, 8452, 8692, 8918, 9140, 9346, 9552, 9738, 9918, 
-    10083, 10239, 10377, 10508, 10615, 10719, 10798, 10869, 10919, 10958, 10976, 10987, 10975, 10952, 10915, 10860, 
-    10795, 10716, 10620, 10517, 10395, 10271, 10128, 9978, 9818, 9649, 9471, 9284, 9088, 8889, 8676, 8463, 
-    8236, 8009, 7769, 7530, 7276, 7027, 6758, 6498, 6218, 5948, 5658, 5374, 5077, 4782, 4477, 4170, 
-    3856, 3541, 3214, 2891, 2555, 2222, 1880, 1537, 1190, 844, 487, 142, -214, -561, -913, -1259, 
-    -1600, -1940, -2269, -2595, -2909, -3216, -3513, -3794, -4069, -4322, -4571, -4793, -5016, -5205, -5397, -5559, 
-    -5717, -5849, -5977, -6081, -6178, -6255, -6323, -6378, -6424, -6455, -6483, -6492, -6508, -6501, -6498, -6485, 
-    -6468, -6446, -6419, -6391, -6357, -6321, -6282, -6239, -6200, -6147, -6107, -6047, -6001, -5936, -5880, -5812, 
-    -5745, -5668, -5589, -5499, -5409, -5303, -5200, -5074, -4952, -4813, -4670, -4513, -4348, -4175, -3992, -3802, 
-    -3606, -3401, -3196, -2980, -2769, -2549, -2336, -2119, -1904, -1694, -1485, -1284, -1084, -894, -704, -527, 
-    -352, -189, -27, 128, 270, 419, 551, 687, 815, 941, 1066, 1187, 1305, 1431, 1548, 1674, 
-    1792, 1921, 2040, 2172, 2296, 2424, 2554, 2679, 2812, 2937, 3063, 3185, 3308, 3420, 3534, 3637, 
-    3734, 3826, 3903, 3978, 4034, 4086, 4119, 4146, 4154, 4153, 4135, 4107, 4065, 4007, 3944, 3859, 
-    3777, 3668, 3568, 3442, 3327, 3189, 3063, 2917, 2779, 2633, 2490, 2345, 2201, 2056, 1912, 1773, 
-    1632, 1497, 1359, 1229, 1094, 968, 838, 709, 590, 457, 342, 213, 95, -26, -147, -264, 
-    -381, -499, -609, -723, -827, -937, -1036, -1135, -1227, -1316, -1402, -1479, -1553, -1624, -1683, -1749, 
-    -1795, -1850, -1887, -1928, -1961, -1992, -2015, -2035, -2050, -2062, -2071, -2072, -2073, -2067, -2060, -2049, 
-    -2035, -2015, -1997, -1970, -1947, -1913, -1884, -1844, -1810, -1762, -1721, -1668, -1618, -1561, -1501, -1436, 
-    -1369, -1296, -1221, -1140, -1057, -971, -879, -789, -690, -597, -491, -399, -287, -192, -79, 16, 
-    124, 227, 329, 434, 532, 635, 730, 830, 925, 1022, 1116, 1209, 1303, 1397, 1490, 1585, 
-    1676, 1771, 1862, 1954, 2044, 2134, 2218, 2301, 2380, 2453, 2524, 2582, 2640, 2688, 2724, 2760, 
-    2777, 2794, 2796, 2798, 2780, 2769, 2734, 2712, 2670, 2629, 2583, 2537, 2486, 2438, 2384, 2337, 
-    2289, 2238, 2197, 2147, 2111, 2065, 2031, 1987, 1952, 1908, 1868, 1823, 1773, 1720, 1660, 1596, 
-    1520, 1440, 1351, 1249, 1146, 1024, 907, 765, 631, 476, 328, 163, 5, -164, -330, -500, 
-    -672, -839, -1007, -1170, -1333, -1490, -1644, -1789, -1933, -2068, -2202, -2325, -2447, -2557, -2670, -2770, 
-    -2874, -2963, -3058, -3138, -3227, -3300, -3384, -3450, -3530, -3593, -3662, -3721, -3784, -3835, -3892, -3929, 
-    -3979, -4008, -4041, -4066, -4079, -4093, -4093, -4091, -4076, -4060, -4028, -3995, -3950, -3893, -3839, -3758, 
-    -3690, -3596, -3503, -3397, -3287, -3167, -3044, -2910, -2770, -2630, -2476, -2326, -2166, -2003, -1838, -1667, 
-    -1496, -1321, -1145, -965, -787, -602, -423, -236, -54, 130, 313, 496, 682, 859, 1045, 1218, 
-    1402, 1572, 1755, 1919, 2097, 2260, 2430, 2590, 2751, 2903, 3060, 3204, 3350, 3489, 3622, 3756, 
-    3876, 3999, 4110, 4222, 4322, 4421, 4512, 4596, 4676, 4748, 4815, 4874, 4929, 4973, 5015, 5044, 
-    5073, 5087, 5101, 5099, 5099, 5085, 5065, 5038, 5005, 4961, 4918, 4855, 4800, 4727, 4657, 4577, 
-    4490, 4404, 4305, 4210, 4105, 3998, 3889, 3770, 3657, 3530, 3410, 3277, 3149, 3012, 2879, 2737, 
-    2597, 2453, 2308, 2162, 2011, 1863, 1711, 1555, 1403, 1241, 1085, 920, 753, 589, 411, 240, 
-    53, -122, -318, -503, -707, -900, -1112, -1313, -1530, -1742, -1962, -2183, -2404, -2630, -2854, -3079, 
-    -3303, -3523, -3747, -3959, -4176, -4378, -4583, -4775, -4964, -5141, -5314, -5474, -5631, -5767, -5908, -6022, 
-    -6147, -6239, -6343, -6420, -6502, -6562, -6621, -6666, -6709, -6731, -6759, -6762, -6773, -6755, -6747, -6714, 
-    -6682, -6636, -6579, -6519, -6440, -6359, -6267, -6162, -6050, -5928, -5793, -5655, -5496, -5335, -5160, -4974, 
-    -4778, -4573, -4354, -4130, -3893, -3648, -3396, -3133, -2869, -2594, -2316, -2033, -1747, -1459, -1170, -880, 
-    -593, -304, -23, 257, 532, 798, 1066, 1316, 1572, 1809, 2047, 2271, 2492, 2710, 2914, 3121, 
-    3319, 3514, 3709, 3894, 4089, 4266, 4459, 4635, 4822, 4999, 5176, 5356, 5527, 5699, 5870, 6029, 
-    6198, 6345, 6502, 6643, 6782, 6915, 7034, 7154, 7254, 7356, 7434, 7518, 7572, 7634, 7668, 7699, 
-    7716, 7720, 7713, 7692, 7659, 7617, 7557, 7490, 7409, 7321, 7217, 7107, 6983, 6856, 6714, 6570, 
-    6416, 6256, 6090, 5922, 5743, 5570, 5381, 5203, 5011, 4821, 4630, 4433, 4236, 4036, 3829, 3628, 
-    3415, 3201, 2981, 2758, 2528, 2293, 2049, 1803, 1546, 1283, 1017, 735, 456, 162, -130, -431, 
-    -738, -1050, -1364, -1683, -1999, -2323, -2637, -2963, -3273, -3593, -3898, -4205, -4502, -4798, -5080, -5360, 
-    -5624, -5889, -6133, -6375, -6600, -6821, -7022, -7220, -7397, -7574, -7727, -7880, -8009, -8137, -8244, -8345, 
-    -8433, -8509, -8573, -8629, -8671, -8706, -8726, -8742, -8743, -8739, -8720, -8699, -8660, -8618, -8562, -8500, 
-    -8426, -8341, -8248, -8140, -8026, -7896, -7756, -7602, -7442, -7260, -7077, -6869, -6663, -6434, -6199, -5948, 
-    -5693, -5419, -5144, -4852, -4556, -4256, -3940, -3631, -3306, -2985, -2660, -2329, -2006, -1671, -1351, -1019, 
-    -701, -380, -61, 248, 560, 861, 1164, 1457, 1747, 2031, 2311, 2591, 2854, 3127, 3385, 3648, 
-    3903, 4153, 4404, 4649, 4894, 5133, 5370, 5607, 5836, 6069, 6287, 6515, 6725, 6939, 7145, 7342, 
-    7537, 7717, 7895, 8061, 8214, 8362, 8492, 8615, 8720, 8818, 8898, 8966, 9020, 9059, 9086, 9097, 
-    9097, 9083, 9057, 9015, 8965, 8900, 8822, 8737, 8631, 8524, 8397, 8263, 8120, 7960, 7800, 7617, 
-    7436, 7239, 7035, 6823, 6601, 6370, 6135, 5889, 5639, 5381, 5112, 4849, 4564, 4289, 3995, 3705, 
-    3404, 3101, 2793, 2479, 2158, 1836, 1508, 1176, 841, 496, 156, -194, -541, -899, -1250, -1612, 
-    -1961, -2325, -2671, -3027, -3370, -3711, -4045, -4370, -4689, -4993, -5292, -5570, -5847, -6099, -6347, -6570, 
-    -6788, -6980, -7167, -7330, -7487, -7618, -7743, -7854, -7945, -8035, -8098, -8163, -8210, -8248, -8280, -8297, 
-    -8314, -8314, -8316, -8302, -8288, -8264, -8234, -8196, -8151, -8097, -8041, -7967, -7895, -7801, -7712, -7599, 
-    -7488, -7355, -7224, -7071, -6917, -6744, -6572, -6378, -6189, -5976, -5769, -5545, -5317, -5083, -4842, -4597, 
-    -4348, -4093, -3834, -3576, -3311, -3048, -2777, -2512, -2239, -1970, -1694, -1421, -1143, -866, -583, -302, 
-    -11, 271, 567, 858, 1154, 1453, 1752, 2054, 2353, 2659, 2955, 3262, 3554, 3854, 4146, 4432, 
-    4720, 4992, 5270, 5524, 5790, 6030, 6274, 6504, 6719, 6938, 7130, 7327, 7501, 7671, 7828, 7974, 
-    8104, 8229, 8336, 8434, 8519, 8588, 8649, 8691, 8725, 8736, 8742, 8723, 8702, 8648, 8595, 8509, 
-    8423, 8308, 8185, 8039, 7885, 7711, 7523, 7324, 7109, 6889, 6647, 6408, 6150, 5891, 5622, 5348, 
-    5069, 4782, 4498, 4204, 3916, 3618, 3325, 3028, 2733, 2435, 2143, 1842, 1551, 1251, 962, 664, 
-    378, 80, -201, -496, -778, -1064, -1347, -1626, -1905, -2182, -2450, -2722, -2982, -3245, -3497, -3750, 
-    -3992, -4233, -4465, -4694, -4917, -5129, -5342, -5540, -5744, -5927, -6115, -6288, -6460, -6622, -6778, -6926, 
-    -7068, -7198, -7328, -7444, -7554, -7656, -7748, -7838, -7909, -7982, -8039, -8091, -8132, -8164, -8190, -8201, 
-    -8206, -8199, -8181, -8157, -8114, -8070, -8005, -7939, -7849, -7759, -7645, -7533, -7394, -7256, -7093, -6929, 
-    -6743, -6554, -6339, -6129, -5886, -5653, -5389, -5127, -4843, -4557, -4253, -3944, -3620, -3293, -2949, -2604, 
-    -2247, -1887, -1520, -1145, -771, -389, -5, 377, 764, 1150, 1532, 1916, 2293, 2673, 3040, 3409, 
-    3767, 4124, 4465, 4809, 5132, 5459, 5765, 6072, 6357, 6644, 6907, 7173, 7414, 7656, 7880, 8092, 
-    8297, 8484, 8666, 8828, 8986, 9125, 9254, 9372, 9471, 9570, 9641, 9714, 9760, 9806, 9832, 9850, 
-    9847, 9842, 9813, 9782, 9726, 9666, 9588, 9496, 9394, 9272, 9143, 8997, 8836, 8664, 8474, 8274, 
-    8060, 7832, 7594, 7341, 7080, 6805, 6524, 6231, 5932, 5623, 5308, 4990, 4664, 4336, 4001, 3668, 
-    3332, 2993, 2651, 2315, 1973, 1633, 1292, 951, 613, 265, -74, -420, -765, -1115, -1467, -1818, 
-    -2175, -2531, -2892, -3252, -3613, -3976, -4336, -4696, -5053, -5408, -5752, -6098, -6429, -6758, -7072, -7375, 
-    -7670, -7946, -8214, -8460, -8701, -8918, -9128, -9314, -9496, -9657, -9809, -9944, -10071, -10187, -10291, -10387, 
-    -10473, -10552, -10622, -10687, -10742, -10794, -10833, -10870, -10893, -10911, -10920, -10916, -10899, -10873, -10825, -10777, 
-    -10694, -10611, -10500, -10376, -10230, -10065, -9886, -9681, -9462, -9219, -8967, -8687, -8400, -8089, -7771, -7435, 
-    -7087, -6732, -6360, -5986, -5597, -5207, -4808, -4406, -3998, -3586, -3171, -2753, -2332, -1907, -1486, -1051, 
-    -627, -188, 240, 680, 1118, 1558, 2000, 2441, 2888, 3325, 3775, 4208, 4655, 5081, 5522, 5937, 
-    6365, 6768, 7177, 7563, 7951, 8317, 8677, 9017, 9348, 9661, 9963, 10244, 10514, 10764, 10999, 11222, 
-    11420, 11613, 11782, 11940, 12084, 12205, 12326, 12415, 12508, 12569, 12634, 12671, 12702, 12713, 12715, 12699, 
-    12670, 12622, 12565, 12483, 12395, 12282, 12159, 12017, 11858, 11681, 11491, 11278, 11056, 10811, 10554, 10281, 
-    9992, 9690, 9371, 9046, 8700, 8352, 7983, 7618, 7231, 6847, 6444, 6052, 5634, 5231, 4806, 4393, 
-    3966, 3542, 3113, 2686, 2251, 1822, 1385, 951, 514, 76, -362, -798, -1243, -1679, -2121, -2559, 
-    -2997, -3435, -3869, -4299, -4731, -5151, -5572, -5983, -6392, -6789, -7180, -7561, -7930, -8292, -8639, -8973, 
-    -9299, -9602, -9903, -10178, -10450, -10696, -10937, -11157, -11364, -11555, -11735, -11895, -12047, -12176, -12301, -12402, 
-    -12498, -12573, -12641, -12689, -12726, -12751, -12761, -12758, -12744, -12712, -12675, -12614, -12553, -12466, -12379, -12270, 
-    -12154, -12021, -11879, -11719, -11556, -11369, -11178, -10968, -10750, -10517, -10270, -10012, -9739, -9457, -9158, -8851, 
-    -8525, -8195, -7843, -7490, -7115, -6737, -6342, -5941, -5526, -5102, -4672, -4225, -3781, -3315, -2858, -2379, 
-    -1908, -1424, -940, -452, 37, 526, 1020, 1509, 2002, 2488, 2976, 3456, 3938, 4410, 4882, 5342, 
-    5801, 6252, 6695, 7132, 7556, 7975, 8383, 8782, 9170, 9545, 9914, 10263, 10608, 10931, 11246, 11546, 
-    11828, 12096, 12345, 12578, 12795, 12990, 13166, 13323, 13458, 13576, 13666, 13743, 13789, 13820, 13824, 13807, 
-    13770, 13708, 13628, 13527, 13403, 13264, 13103, 12927, 12734, 12524, 12300, 12063, 11810, 11548, 11272, 10990, 
-    10692, 10392, 10074, 9761, 9427, 9096, 8749, 8403, 8043, 7682, 7308, 6933, 6544, 6154, 5754, 5347, 
-    4934, 4513, 4087, 3654, 3215, 2772, 2323, 1872, 1418, 962, 507, 50, -400, -852, -1297, -1741, 
-    -2172, -2604, -3022, -3435, -3839, -4230, -4615, -4986, -5347, -5700, -6038, -6367, -6688, -6994, -7299, -7585, 
-    -7874, -8144, -8416, -8674, -8930, -9177, -9415, -9657, -9878, -10107, -10319, -10529, -10731, -10920, -11108, -11276, 
-    -11444, -11591, -11732, -11855, -11968, -12066, -12145, -12211, -12261, -12292, -12305, -12301, -12282, -12239, -12184, -12103, 
-    -12014, -11897, -11775, -11622, -11463, -11281, -11087, -10877, -10647, -10412, -10151, -9890, -9603, -9314, -9006, -8691, 
-    -8363, -8025, -7677, -7321, -6953, -6580, -6194, -5804, -5404, -4999, -4587, -4171, -3746, -3318, -2887, -2451, 
-    -2012, -1570, -1124, -681, -233, 214, 656, 1106, 1545, 1986, 2423, 2853, 3281, 3698, 4112, 4515, 
-    4911, 5298, 5671, 6043, 6389, 6739, 7065, 7388, 7688, 7987, 8261, 8531, 8778, 9021, 9241, 9452, 
-    9644, 9823, 9989, 10132, 10267, 10381, 10485, 10567, 10637, 10691, 10729, 10751, 10761, 10751, 10735, 10696, 
-    10652, 10591, 10518, 10436, 10341, 10237, 10122, 10000, 9868, 9730, 9580, 9429, 9266, 9100, 8924, 8747, 
-    8555, 8365, 8160, 7956, 7739, 7514, 7287, 7043, 6797, 6538, 6273, 6001, 5716, 5428, 5128, 4825, 
-    4512, 4194, 3872, 3544, 3213, 2878, 2541, 2201, 1863, 1520, 1181, 838, 501, 161, -176, -515, 
-    -847, -1187, -1514, -1856, -2181, -2520, -2844, -3183, -3506, -3844, -4165, -4501, -4821, -5150, -5471, -5788, 
-    -6107, -6411, -6717, -7012, -7298, -7580, -7842, -8100, -8341, -8568, -8783, -8977, -9160, -9318, -9467, -9587, 
-    -9700, -9784, -9854, -9904, -9938, -9947, -9948, -9920, -9891, -9829, -9763, -9678, -9581, -9468, -9347, -9208, 
-    -9068, -8906, -8743, -8567, -8381, -8191, -7986, -7779, -7561, -7333, -7103, -6858, -6612, -6354, -6093, -5821, 
-    -5549, -5261, -4979, -4681, -4387, -4083, -3780, -3465, -3160, -2839, -2527, -2206, -1889, -1569, -1249, -932, 
-    -613, -298, 18, 330, 642, 949, 1257, 1558, 1859, 2156, 2449, 2739, 3026, 3305, 3589, 3856, 
-    4132, 4387, 4650, 4895, 5141, 5375, 5601, 5818, 6026, 6220, 6412, 6581, 6750, 6899, 7040, 7171, 
-    7284, 7391, 7482, 7565, 7633, 7692, 7738, 7777, 7801, 7820, 7823, 7825, 7807, 7794, 7759, 7729, 
-    7676, 7631, 7565, 7502, 7421, 7340, 7249, 7147, 7041, 6923, 6799, 6664, 6524, 6372, 6213, 6044, 
-    5866, 5683, 5483, 5283, 5068, 4851, 4626, 4386, 4154, 3897, 3658, 3392, 3137, 2874, 2607, 2344, 
-    2072, 1809, 1538, 1275, 1009, 750, 489, 236, -15, -263, -504, -745, -978, -1210, -1436, -1660, 
-    -1881, -2098, -2313, -2527, -2742, -2950, -3163, -3368, -3583, -3785, -3996, -4200, -4403, -4608, -4801, -5002, 
-    -5189, -5376, -5555, -5726, -5891, -6046, -6187, -6323, -6440, -6553, -6640, -6726, -6786, -6839, -6871, -6893, 
-    -6894, -6888, -6859, -6828, -6772, -6713, -6638, -6555, -6462, -6361, -6249, -6136, -6010, -5886, -5750, -5615, 
-    -5471, -5328, -5179, -5027, -4870, -4711, -4546, -4383, -4207, -4037, -3852, -3674, -3481, -3290, -3090, -2888, 
-    -2677, -2464, -2246, -2019, -1796, -1555, -1327, -1081, -844, -597, -354, -107, 135, 383, 623, 864, 
-    1099, 1335, 1562, 1786, 2001, 2214, 2416, 2615, 2800, 2985, 3155, 3324, 3477, 3627, 3766, 3900, 
-    4023, 4141, 4245, 4355, 4439, 4537, 4609, 4690, 4753, 4818, 4870, 4924, 4965, 5006, 5035, 5062, 
-    5081, 5097, 5103, 5105, 5100, 5088, 5069, 5043, 5013, 4972, 4926, 4874, 4812, 4747, 4670, 4590, 
-    4504, 4405, 4308, 4194, 4087, 3957, 3839, 3698, 3564, 3417, 3268, 3116, 2954, 2796, 2625, 2458, 
-    2283, 2111, 1928, 1752, 1564, 1387, 1200, 1016, 832, 648, 465, 282, 103, -76, -250, -427, 
-    -596, -764, -928, -1090, -1250, -1401, -1556, -1701, -1848, -1986, -2126, -2259, -2393, -2515, -2644, -2761, 
-    -2879, -2993, -3098, -3206, -3303, -3404, -3490, -3582, -3657, -3736, -3802, -3864, -3924, -3969, -4012, -4043, 
-    -4074, -4089, -4102, -4102, -4098, -4082, -4062, -4026, -3994, -3937, -3892, -3822, -3757, -3676, -3596, -3503, 
-    -3409, -3306, -3201, -3089, -2973, -2856, -2730, -2608, -2476, -2347, -2214, -2077, -1944, -1805, -1665, -1528, 
-    -1384, -1246, -1104, -960, -821, -675, -537, -392, -249, -108, 36, 177, 326, 465, 614, 752, 
-    902, 1040, 1188, 1324, 1473, 1604, 1749, 1878, 2018, 2146, 2275, 2401, 2520, 2643, 2752, 2869, 
-    2968, 3077, 3167, 3263, 3349, 3430, 3507, 3576, 3641, 3699, 3752, 3794, 3837, 3863, 3895, 3909, 
-    3920, 3926, 3920, 3911, 3895, 3865, 3839, 3794, 3753, 3698, 3641, 3574, 3502, 3428, 3342, 3257, 
-    3164, 3064, 2966, 2858, 2754, 2635, 2527, 2404, 2286, 2162, 2034, 1908, 1776, 1639, 1503, 1363, 
-    1217, 1072, 919, 765, 605, 441, 277, 105, -70, -247, -431, -612, -802, -989, -1181, -1374, 
-    -1562, -1759, -1944, -2138, -2322, -2505, -2689, -2860, -3035, -3196, -3358, -3510, -3658, -3793, -3928, -4051, 
-    -4172, -4278, -4387, -4476, -4575, -4648, -4734, -4799, -4869, -4921, -4984, -5023, -5078, -5101, -5150, -5159, 
-    -5199, -5198, -5222, -5213, -5219, -5207, -5186, -5166, -5127, -5092, -5034, -4979, -4906, -4828, -4734, -4637, 
-    -4520, -4403, -4263, -4122, -3962, -3797, -3619, -3432, -3233, -3032, -2812, -2598, -2362, -2136, -1889, -1653, 
-    -1399, -1153, -899, -643, -393, -134, 118, 373, 621, 874, 1121, 1367, 1609, 1847, 2086, 2315, 
-    2546, 2770, 2993, 3207, 3422, 3630, 3832, 4037, 4227, 4423, 4602, 4787, 4961, 5130, 5296, 5451, 
-    5605, 5749, 5886, 6020, 6141, 6259, 6365, 6467, 6557, 6641, 6716, 6781, 6841, 6887, 6929, 6957, 
-    6980, 6991, 6995, 6985, 6970, 6942, 6910, 6861, 6809, 6742, 6674, 6588, 6499, 6401, 6288, 6178, 
-    6046, 5923, 5775, 5633, 5475, 5316, 5147, 4972, 4794, 4607, 4415, 4216, 4016, 3810, 3596, 3381, 
-    3156, 2939, 2702, 2475, 2233, 1997, 1747, 1505, 1248, 999, 737, 480, 212, -46, -321, -586, 
-    -862, -1134, -1407, -1688, -1956, -2240, -2507, -2789, -3058, -3330, -3600, -3864, -4129, -4388, -4640, -4896, 
-    -5135, -5380, -5607, -5842, -6055, -6275, -6476, -6679, -6868, -7050, -7227, -7390, -7551, -7694, -7836, -7958, 
-    -8083, -8186, -8287, -8370, -8444, -8511, -8556, -8603, -8621, -8640, -8637, -8626, -8601, -8561, -8510, -8444, 
-    -8366, -8277, -8171, -8061, -7929, -7799, -7642, -7492, -7319, -7148, -6957, -6769, -6565, -6364, -6145, -5928, 
-    -5701, -5470, -5233, -4991, -4742, -4491, -4231, -3969, -3700, -3428, -3150, -2866, -2582, -2286, -1993, -1687, 
-    -1389, -1079, -769, -454, -138, 174, 495, 807, 1130, 1440, 1757, 2064, 2376, 2676, 2978, 3269, 
-    3560, 3841, 4117, 4389, 4650, 4910, 5156, 5400, 5635, 5865, 6085, 6304, 6508, 6714, 6905, 7096, 
-    7277, 7452, 7618, 7780, 7927, 8076, 8204, 8335, 8447, 8554, 8651, 8732, 8808, 8864, 8918, 8948, 
-    8975, 8983, 8981, 8965, 8935, 8894, 8841, 8773, 8699, 8607, 8512, 8399, 8286, 8155, 8023, 7878, 
-    7728, 7576, 7406, 7245, 7063, 6891, 6700, 6514, 6317, 6119, 5914, 5701, 5492, 5263, 5043, 4805, 
-    4568, 4323, 4068, 3809, 3543, 3268, 2987, 2698, 2405, 2100, 1796, 1474, 1165, 831, 512, 171, 
-    -154, -493, -829, -1163, -1504, -1830, -2167, -2485, -2812, -3121, -3435, -3729, -4025, -4304, -4579, -4842, 
-    -5094, -5335, -5569, -5783, -5999, -6191, -6382, -6556, -6723, -6880, -7026, -7167, -7292, -7418, -7528, -7636, 
-    -7738, -7824, -7918, -7988, -8070, -8130, -8192, -8245, -8290, -8332, -8358, -8388, -8395, -8409, -8400, -8389, 
-    -8368, -8328, -8288, -8225, -8161, -8073, -7986, -7866, -7762, -7612, -7482, -7312, -7146, -6965, -6768, -6568, 
-    -6350, -6126, -5897, -5651, -5406, -5147, -4890, -4622, -4351, -4077, -3800, -3524, -3241, -2960, -2680, -2394, 
-    -2120, -1831, -1558, -1275, -1000, -724, -447, -174, 95, 368, 630, 903, 1162, 1429, 1688, 1946, 
-    2205, 2457, 2711, 2958, 3204, 3446, 3684, 3918, 4148, 4368, 4592, 4798, 5009, 5202, 5398, 5577, 
-    5753, 5915, 6070, 6215, 6349, 6472, 6585, 6683, 6776, 6851, 6923, 6971, 7023, 7049, 7079, 7086, 
-    7092, 7081, 7068, 7039, 7010, 6964, 6916, 6860, 6795, 6729, 6649, 6571, 6482, 6391, 6292, 6190, 
-    6079, 5969, 5845, 5726, 5590, 5460, 5315, 5170, 5016, 4857, 4696, 4524, 4348, 4164, 3980, 3785, 
-    3588, 3381, 3175, 2960, 2743, 2520, 2296, 2066, 1837, 1602, 1367, 1130, 892, 653, 414, 175, 
-    -66, -301, -546, -778, -1018, -1251, -1487, -1718, -1953, -2172, -2410, -2624, -2851, -3065, -3279, -3491, 
-    -3695, -3899, -4091, -4284, -4465, -4643, -4810, -4972, -5124, -5267, -5400, -5521, -5637, -5732, -5828, -5898, 
-    -5970, -6017, -6062, -6087, -6104, -6106, -6097, -6075, -6044, -5995, -5946, -5872, -5804, -5712, -5623, -5518, 
-    -5409, -5291, -5167, -5038, -4903, -4759, -4616, -4460, -4310, -4145, -3984, -3814, -3642, -3466, -3287, -3101, 
-    -2915, -2721, -2529, -2328, -2127, -1920, -1713, -1501, -1287, -1069, -852, -631, -409, -189, 34, 251, 
-    476, 692, 907, 1123, 1330, 1542, 1738, 1942, 2132, 2321, 2506, 2680, 2856, 3019, 3180, 3333, 
-    3484, 3620, 3762, 3885, 4013, 4127, 4237, 4342, 4437, 4530, 4611, 4694, 4758, 4828, 4881, 4936, 
-    4973, 5015, 5039, 5064, 5074, 5080, 5077, 5068, 5047, 5022, 4982, 4941, 4886, 4826, 4756, 4676, 
-    4589, 4496, 4392, 4283, 4165, 4042, 3914, 3776, 3635, 3490, 3334, 3186, 3022, 2862, 2697, 2527, 
-    2365, 2189, 2020, 1849, 1672, 1505, 1325, 1159, 977, 808, 629, 455, 278, 97, -78, -262, 
-    -441, -627, -809, -998, -1184, -1373, -1561, -1753, -1942, -2133, -2321, -2511, -2699, -2884, -3066, -3247, 
-    -3427, -3598, -3768, -3932, -4092, -4248, -4391, -4535, -4667, -4800, -4915, -5032, -5134, -5234, -5324, -5404, 
-    -5479, -5545, -5600, -5652, -5688, -5726, -5748, -5765, -5772, -5772, -5765, -5748, -5723, -5688, -5648, -5597, 
-    -5538, -5471, -5392, -5310, -5213, -5117, -4999, -4885, -4755, -4618, -4476, -4320, -4162, -3993, -3813, -3636, 
-    -3441, -3250, -3041, -2834, -2621, -2399, -2175, -1944, -1711, -1474, -1231, -988, -740, -491, -241, 15, 
-    264, 526, 777, 1035, 1293, 1549, 1805, 2061, 2310, 2570, 2812, 3066, 3306, 3552, 3787, 4022, 
-    4250, 4473, 4694, 4902, 5107, 5304, 5492, 5674, 5843, 6006, 6157, 6299, 6425, 6550, 6651, 6755, 
-    6832, 6913, 6970, 7025, 7061, 7095, 7112, 7123, 7123, 7116, 7099, 7074, 7043, 7006, 6959, 6909, 
-    6854, 6790, 6727, 6649, 6576, 6491, 6403, 6310, 6206, 6102, 5986, 5868, 5736, 5605, 5458, 5307, 
-    5144, 4976, 4794, 4609, 4408, 4205, 3990, 3764, 3538, 3294, 3050, 2798, 2538, 2279, 2007, 1742, 
-    1466, 1197, 920, 646, 374, 100, -164, -436, -694, -959, -1211, -1465, -1714, -1956, -2198, -2431, 
-    -2667, -2891, -3120, -3337, -3559, -3774, -3988, -4200, -4409, -4615, -4822, -5025, -5230, -5426, -5628, -5819, 
-    -6016, -6204, -6387, -6569, -6744, -6913, -7078, -7228, -7381, -7517, -7647, -7764, -7875, -7968, -8056, -8124, 
-    -8189, -8230, -8266, -8282, -8292, -8282, -8262, -8225, -8179, -8118, -8044, -7965, -7861, -7763, -7637, -7519, 
-    -7376, -7237, -7078, -6924, -6747, -6580, -6391, -6206, -6009, -5806, -5599, -5385, -5161, -4937, -4702, -4463, 
-    -4219, -3963, -3713, -3441, -3180, -2900, -2625, -2339, -2051, -1761, -1462, -1168, -863, -565, -258, 43, 
-    347, 653, 952, 1254, 1552, 1845, 2139, 2423, 2707, 2983, 3256, 3520, 3781, 4036, 4282, 4524, 
-    4757, 4987, 5205, 5422, 5627, 5829, 6020, 6208, 6388, 6557, 6725, 6880, 7032, 7171, 7307, 7433, 
-    7550, 7661, 7760, 7854, 7934, 8010, 8072, 8128, 8171, 8208, 8230, 8248, 8244, 8246, 8219, 8202, 
-    8153, 8114, 8048, 7985, 7903, 7820, 7720, 7620, 7500, 7386, 7249, 7121, 6968, 6824, 6662, 6499, 
-    6328, 6145, 5970, 5769, 5584, 5369, 5172, 4946, 4737, 4502, 4278, 4037, 3800, 3551, 3305, 3049, 
-    2795, 2531, 2270, 2006, 1736, 1472, 1198, 933, 662, 392, 126, -141, -406, -669, -936, -1189, 
-    -1452, -1705, -1958, -2211, -2452, -2704, -2941, -3181, -3416, -3647, -3878, -4099, -4322, -4536, -4750, -4956, 
-    -5154, -5354, -5537, -5726, -5894, -6069, -6219, -6375, -6512, -6647, -6768, -6877, -6980, -7066, -7149, -7211, 
-    -7270, -7313, -7346, -7369, -7379, -7380, -7368, -7347, -7316, -7274, -7226, -7161, -7099, -7016, -6938, -6842, 
-    -6747, -6637, -6526, -6407, -6284, -6153, -6014, -5876, -5723, -5578, -5409, -5255, -5079, -4907, -4727, -4540, 
-    -4351, -4153, -3954, -3745, -3538, -3318, -3104, -2876, -2654, -2418, -2189, -1952, -1716, -1478, -1235, -1001, 
-    -758, -521, -284, -48, 180, 412, 636, 860, 1073, 1291, 1493, 1697, 1893, 2082, 2268, 2442, 
-    2614, 2778, 2935, 3086, 3229, 3365, 3496, 3621, 3740, 3850, 3956, 4058, 4152, 4240, 4328, 4402, 
-    4484, 4549, 4619, 4679, 4738, 4793, 4845, 4890, 4933, 4972, 5007, 5039, 5065, 5084, 5107, 5112, 
-    5127, 5119, 5121, 5104, 5090, 5060, 5029, 4987, 4941, 4883, 4818, 4746, 4667, 4578, 4483, 4379, 
-    4270, 4154, 4030, 3902, 3767, 3627, 3484, 3335, 3186, 3030, 2872, 2715, 2551, 2391, 2224, 2061, 
-    1893, 1733, 1559, 1401, 1227, 1066, 899, 734, 570, 403, 244, 82, -82, -236, -401, -549, 
-    -712, -855, -1012, -1154, -1301, -1441, -1573, -1713, -1832, -1962, -2077, -2190, -2300, -2398, -2498, -2584, 
-    -2670, -2744, -2817, -2879, -2937, -2986, -3028, -3066, -3091, -3115, -3129, -3134, -3137, -3124, -3118, -3091, 
-    -3068, -3034, -2994, -2954, -2900, -2849, -2786, -2726, -2658, -2585, -2514, -2432, -2356, -2268, -2186, -2094, 
-    -2007, -1908, -1818, -1717, -1620, -1517, -1413, -1307, -1201, -1086, -982, -864, -750, -637, -514, -406, 
-    -279, -169, -44, 64, 189, 292, 414, 517, 628, 733, 831, 933, 1024, 1116, 1203, 1286, 
-    1364, 1446, 1510, 1589, 1646, 1719, 1772, 1834, 1892, 1942, 1999, 2040, 2098, 2136, 2183, 2219, 
-    2261, 2293, 2325, 2353, 2373, 2396, 2407, 2420, 2418, 2420, 2407, 2395, 2375, 2342, 2314, 2268, 
-    2222, 2168, 2107, 2041, 1969, 1889, 1809, 1715, 1624, 1523, 1419, 1313, 1196, 1083, 959, 835, 
-    709, 574, 442, 300, 164, 17, -124, -275, -419, -573, -722, -872, -1021, -1173, -1319, -1467, 
-    -1609, -1753, -1886, -2022, -2149, -2277, -2395, -2508, -2621, -2718, -2824, -2910, -3003, -3078, -3161, -3227, 
-    -3298, -3354, -3413, -3465, -3512, -3556, -3595, -3630, -3662, -3688, -3715, -3729, -3754, -3754, -3772, -3767, 
-    -3772, -3762, -3753, -3738, -3716, -3691, -3661, -3623, -3582, -3534, -3482, -3424, -3356, -3292, -3211, -3138, 
-    -3048, -2959, -2866, -2764, -2664, -2554, -2442, -2329, -2207, -2087, -1958, -1832, -1697, -1563, -1421, -1281, 
-    -1136, -988, -838, -682, -530, -368, -210, -42, 122, 288, 466, 629, 817, 979, 1174, 1338, 
-    1533, 1705, 1894, 2074, 2258, 2439, 2625, 2800, 2983, 3157, 3334, 3506, 3675, 3841, 4004, 4164, 
-    4315, 4467, 4610, 4753, 4884, 5016, 5137, 5254, 5367, 5470, 5567, 5658, 5742, 5818, 5886, 5948, 
-    6000, 6050, 6083, 6117, 6136, 6151, 6154, 6153, 6138, 6121, 6088, 6052, 6003, 5947, 5884, 5806, 
-    5730, 5634, 5540, 5430, 5318, 5197, 5069, 4933, 4795, 4646, 4497, 4338, 4180, 4014, 3845, 3677, 
-    3498, 3328, 3145, 2966, 2785, 2599, 2417, 2226, 2041, 1850, 1660, 1465, 1273, 1073, 877, 673, 
-    472, 263, 58, -157, -366, -586, -802, -1024, -1247, -1468, -1696, -1916, -2144, -2367, -2588, -2809, 
-    -3027, -3240, -3454, -3658, -3863, -4059, -4252, -4440, -4619, -4797, -4963, -5128, -5285, -5433, -5579, -5713, 
-    -5848, -5971, -6090, -6202, -6310, -6408, -6504, -6587, -6674, -6739, -6812, -6865, -6919, -6962, -6994, -7021, 
-    -7039, -7045, -7043, -7029, -7007, -6976, -6933, -6877, -6816, -6738, -6657, -6561, -6458, -6344, -6222, -6090, 
-    -5951, -5805, -5649, -5488, -5322, -5146, -4972, -4784, -4598, -4404, -4208, -4007, -3803, -3595, -3386, -3171, 
-    -2955, -2736, -2514, -2290, -2062, -1836, -1602, -1371, -1131, -903, -656, -425, -176, 56, 301, 540, 
-    781, 1020, 1258, 1494, 1726, 1957, 2184, 2408, 2627, 2841, 3052, 3257, 3457, 3652, 3838, 4022, 
-    4196, 4368, 4527, 4686, 4832, 4974, 5110, 5234, 5360, 5466, 5581, 5671, 5769, 5850, 5932, 6001, 
-    6067, 6123, 6178, 6221, 6262, 6293, 6319, 6343, 6353, 6364, 6363, 6360, 6349, 6330, 6310, 6277, 
-    6242, 6197, 6148, 6091, 6025, 5955, 5876, 5790, 5696, 5593, 5487, 5367, 5247, 5112, 4975, 4827, 
-    4675, 4514, 4346, 4172, 3993, 3803, 3615, 3412, 3211, 3002, 2789, 2573, 2348, 2128, 1898, 1672, 
-    1436, 1205, 970, 737, 503, 271, 37, -190, -423, -643, -871, -1084, -1307, -1515, -1727, -1927, 
-    -2129, -2324, -2515, -2699, -2881, -3057, -3226, -3396, -3550, -3713, -3853, -4006, -4136, -4276, -4392, -4517, 
-    -4626, -4733, -4829, -4916, -4998, -5073, -5134, -5191, -5235, -5271, -5302, -5312, -5326, -5317, -5313, -5283, 
-    -5259, -5214, -5168, -5110, -5043, -4973, -4891, -4804, -4710, -4610, -4505, -4394, -4280, -4158, -4038, -3905, 
-    -3778, -3642, -3504, -3367, -3218, -3081, -2926, -2784, -2626, -2475, -2321, -2160, -2004, -1839, -1680, -1515, 
-    -1349, -1182, -1018, -845, -683, -509, -343, -174, -7, 158, 323, 488, 648, 811, 967, 1125, 
-    1276, 1430, 1575, 1723, 1863, 2005, 2140, 2273, 2405, 2531, 2656, 2775, 2898, 3005, 3123, 3221, 
-    3335, 3427, 3527, 3615, 3705, 3784, 3865, 3932, 4002, 4059, 4118, 4160, 4204, 4234, 4264, 4278, 
-    4290, 4290, 4285, 4271, 4245, 4219, 4175, 4132, 4072, 4015, 3941, 3866, 3779, 3689, 3589, 3488, 
-    3373, 3263, 3132, 3013, 2872, 2743, 2592, 2453, 2294, 2143, 1981, 1819, 1650, 1479, 1306, 1127, 
-    948, 763, 579, 392, 201, 9, -179, -373, -564, -758, -949, -1139, -1326, -1515, -1695, -1878, 
-    -2050, -2225, -2390, -2553, -2708, -2860, -3003, -3146, -3273, -3404, -3521, -3637, -3741, -3843, -3939, -4026, 
-    -4107, -4182, -4256, -4317, -4378, -4427, -4479, -4517, -4557, -4587, -4611, -4635, -4645, -4659, -4660, -4657, 
-    -4648, -4634, -4610, -4585, -4542, -4507, -4448, -4397, -4323, -4256, -4169, -4081, -3983, -3879, -3765, -3646, 
-    -3518, -3387, -3246, -3102, -2954, -2797, -2641, -2476, -2311, -2146, -1972, -1804, -1625, -1455, -1276, -1101, 
-    -923, -746, -572, -390, -216, -36, 140, 316, 503, 675, 863, 1040, 1227, 1411, 1598, 1786, 
-    1977, 2166, 2360, 2553, 2749, 2943, 3138, 3331, 3529, 3717, 3908, 4099, 4280, 4467, 4639, 4814, 
-    4980, 5141, 5296, 5441, 5582, 5711, 5838, 5947, 6059, 6146, 6240, 6312, 6382, 6438, 6486, 6524, 
-    6554, 6569, 6583, 6577, 6572, 6550, 6522, 6484, 6439, 6381, 6318, 6241, 6163, 6070, 5972, 5865, 
-    5748, 5626, 5495, 5355, 5211, 5054, 4896, 4727, 4551, 4372, 4181, 3988, 3785, 3581, 3365, 3149, 
-    2918, 2696, 2452, 2219, 1968, 1720, 1465, 1208, 945, 680, 411, 141, -130, -404, -678, -954, 
-    -1231, -1501, -1779, -2041, -2316, -2572, -2838, -3087, -3338, -3579, -3816, -4045, -4267, -4477, -4688, -4881, 
-    -5075, -5254, -5428, -5594, -5750, -5904, -6042, -6183, -6308, -6434, -6547, -6661, -6762, -6866, -6951, -7048, 
-    -7120, -7205, -7267, -7337, -7388, -7443, -7484, -7523, -7551, -7571, -7587, -7588, -7586, -7572, -7551, -7519, 
-    -7475, -7428, -7365, -7293, -7213, -7121, -7024, -6910, -6793, -6664, -6525, -6379, -6222, -6059, -5885, -5706, 
-    -5515, -5324, -5114, -4911, -4691, -4469, -4240, -4003, -3765, -3516, -3267, -3010, -2750, -2484, -2217, -1942, 
-    -1669, -1384, -1107, -818, -533, -243, 46, 340, 630, 925, 1218, 1513, 1801, 2096, 2381, 2675, 
-    2956, 3241, 3518, 3796, 4064, 4332, 4589, 4846, 5094, 5331, 5568, 5789, 6009, 6215, 6413, 6605, 
-    6780, 6955, 7109, 7262, 7398, 7529, 7643, 7755, 7845, 7941, 8009, 8084, 8135, 8188, 8223, 8252, 
-    8278, 8283, 8297, 8281, 8279, 8252, 8229, 8192, 8146, 8102, 8035, 7975, 7895, 7818, 7724, 7629, 
-    7517, 7410, 7279, 7155, 7007, 6865, 6702, 6538, 6362, 6178, 5986, 5783, 5575, 5354, 5129, 4894, 
-    4654, 4400, 4149, 3879, 3619, 3334, 3063, 2771, 2489, 2191, 1902, 1598, 1307, 998, 707, 399, 
-    108, -194, -487, -782, -1072, -1357, -1644, -1922, -2198, -2470, -2737, -2999, -3259, -3508, -3761, -4001, 
-    -4243, -4475, -4706, -4927, -5150, -5361, -5569, -5775, -5965, -6164, -6338, -6523, -6687, -6852, -7001, -7148, 
-    -7281, -7408, -7522, -7624, -7722, -7800, -7876, -7931, -7981, -8016, -8037, -8053, -8047, -8041, -8013, -7982, 
-    -7933, -7882, -7811, -7741, -7651, -7559, -7458, -7345, -7232, -7100, -6975, -6831, -6692, -6534, -6384, -6217, 
-    -6052, -5879, -5700, -5519, -5327, -5139, -4940, -4739, -4530, -4321, -4106, -3887, -3662, -3438, -3203, -2975, 
-    -2732, -2498, -2250, -2012, -1758, -1516, -1258, -1013, -756, -503, -250, 8, 259, 519, 769, 1027, 
-    1278, 1530, 1781, 2028, 2276, 2517, 2758, 2993, 3226, 3454, 3677, 3894, 4107, 4310, 4513, 4701, 
-    4888, 5061, 5230, 5388, 5538, 5678, 5809, 5931, 6040, 6144, 6232, 6318, 6386, 6454, 6500, 6552, 
-    6579, 6613, 6627, 6638, 6642, 6631, 6624, 6598, 6576, 6535, 6499, 6447, 6395, 6331, 6266, 6188, 
-    6109, 6019, 5923, 5823, 5708, 5598, 5469, 5341, 5199, 5057, 4901, 4748, 4575, 4410, 4224, 4047, 
-    3856, 3661, 3466, 3259, 3062, 2846, 2643, 2424, 2218, 1997, 1788, 1570, 1360, 1145, 934, 723, 
-    513, 308, 102, -101, -300, -501, -694, -892, -1082, -1271, -1460, -1644, -1825, -2006, -2181, -2358, 
-    -2525, -2697, -2858, -3022, -3177, -3333, -3480, -3625, -3764, -3900, -4027, -4151, -4265, -4377, -4476, -4577, 
-    -4659, -4744, -4812, -4876, -4935, -4978, -5020, -5050, -5068, -5086, -5086, -5090, -5074, -5057, -5030, -4997, 
-    -4958, -4906, -4853, -4792, -4723, -4653, -4569, -4485, -4394, -4297, -4195, -4088, -3972, -3860, -3731, -3607, 
-    -3471, -3334, -3194, -3045, -2896, -2739, -2579, -2418, -2250, -2080, -1906, -1731, -1552, -1370, -1191, -1004, 
-    -823, -634, -451, -266, -81, 101, 285, 462, 646, 815, 998, 1159, 1336, 1492, 1659, 1810, 
-    1969, 2109, 2258, 2392, 2527, 2655, 2775, 2895, 2999, 3111, 3203, 3301, 3381, 3463, 3537, 3600, 
-    3666, 3712, 3766, 3798, 3841, 3861, 3887, 3898, 3910, 3911, 3911, 3902, 3888, 3871, 3847, 3822, 
-    3786, 3751, 3710, 3665, 3615, 3562, 3507, 3441, 3380, 3307, 3236, 3158, 3073, 2991, 2894, 2804, 
-    2698, 2597, 2482, 2370, 2248, 2125, 1993, 1862, 1718, 1577, 1429, 1278, 1122, 963, 803, 639, 
-    473, 308, 137, -26, -199, -363, -531, -697, -858, -1022, -1179, -1335, -1488, -1640, -1782, -1930, 
-    -2063, -2203, -2332, -2459, -2586, -2703, -2822, -2930, -3042, -3145, -3246, -3343, -3435, -3526, -3610, -3691, 
-    -3767, -3841, -3905, -3968, -4024, -4077, -4119, -4161, -4189, -4220, -4233, -4247, -4252, -4245, -4240, -4217, 
-    -4195, -4160, -4120, -4074, -4018, -3958, -3890, -3813, -3733, -3645, -3552, -3454, -3349, -3238, -3126, -3004, 
-    -2884, -2752, -2627, -2482, -2354, -2204, -2063, -1915, -1762, -1614, -1453, -1300, -1137, -977, -813, -647, 
-    -480, -311, -140, 30, 202, 378, 550, 730, 902, 1081, 1256, 1434, 1612, 1784, 1960, 2134, 
-    2308, 2479, 2646, 2814, 2977, 3138, 3299, 3448, 3604, 3746, 3889, 4026, 4155, 4283, 4402, 4516, 
-    4624, 4725, 4820, 4908, 4988, 5064, 5129, 5192, 5244, 5291, 5328, 5364, 5384, 5409, 5412, 5423, 
-    5415, 5410, 5389, 5369, 5338, 5301, 5260, 5210, 5152, 5091, 5020, 4948, 4863, 4774, 4679, 4578, 
-    4470, 4354, 4235, 4107, 3973, 3836, 3686, 3543, 3379, 3224, 3054, 2884, 2709, 2527, 2345, 2155, 
-    1967, 1772, 1577, 1376, 1176, 974, 772, 566, 362, 157, -46, -248, -453, -654, -852, -1052, 
-    -1247, -1444, -1632, -1823, -2008, -2197, -2373, -2555, -2728, -2905, -3070, -3243, -3400, -3569, -3717, -3883, 
-    -4023, -4180, -4314, -4464, -4591, -4729, -4851, -4977, -5092, -5202, -5308, -5406, -5502, -5586, -5665, -5739, 
-    -5800, -5861, -5906, -5949, -5981, -6005, -6024, -6030, -6032, -6023, -6007, -5984, -5953, -5913, -5870, -5814, 
-    -5753, -5689, -5610, -5534, -5442, -5350, -5251, -5140, -5034, -4906, -4788, -4653, -4517, -4376, -4224, -4074, 
-    -3913, -3750, -3582, -3405, -3233, -3044, -2866, -2669, -2482, -2286, -2085, -1889, -1682, -1483, -1277, -1068, 
-    -867, -654, -456, -240, -45, 170, 364, 573, 770, 975, 1169, 1368, 1562, 1757, 1950, 2135, 
-    2327, 2508, 2693, 2870, 3049, 3219, 3392, 3553, 3717, 3873, 4023, 4173, 4306, 4450, 4570, 4699, 
-    4809, 4918, 5022, 5110, 5203, 5275, 5353, 5411, 5472, 5518, 5564, 5596, 5628, 5650, 5667, 5677, 
-    5680, 5683, 5670, 5667, 5639, 5626, 5589, 5563, 5521, 5477, 5426, 5372, 5309, 5243, 5169, 5089, 
-    5001, 4908, 4808, 4702, 4587, 4466, 4339, 4201, 4063, 3912, 3761, 3600, 3434, 3268, 3086, 2916, 
-    2728, 2547, 2358, 2169, 1978, 1788, 1595, 1406, 1213, 1023, 835, 648, 461, 278, 98, -83, 
-    -256, -437, -602, -779, -941, -1110, -1270, -1432, -1588, -1744, -1897, -2046, -2193, -2336, -2478, -2617, 
-    -2748, -2882, -3006, -3130, -3251, -3359, -3477, -3572, -3681, -3766, -3863, -3941, -4021, -4092, -4155, -4218, 
-    -4267, -4320, -4353, -4393, -4417, -4444, -4454, -4468, -4469, -4469, -4459, -4445, -4430, -4399, -4376, -4334, 
-    -4298, -4252, -4200, -4150, -4084, -4026, -3953, -3887, -3803, -3730, -3639, -3557, -3460, -3369, -3267, -3169, 
-    -3058, -2957, -2838, -2732, -2609, -2494, -2368, -2250, -2118, -1996, -1862, -1733, -1599, -1464, -1332, -1192, 
-    -1060, -917, -780, -641, -502, -365, -222, -88, 54, 187, 327, 461, 594, 729, 859, 988, 
-    1114, 1239, 1359, 1479, 1592, 1708, 1809, 1918, 2015, 2114, 2203, 2288, 2374, 2448, 2523, 2586, 
-    2652, 2706, 2760, 2808, 2847, 2887, 2916, 2948, 2968, 2986, 3001, 3008, 3015, 3014, 3011, 3004, 
-    2990, 2975, 2958, 2928, 2908, 2869, 2838, 2798, 2752, 2711, 2652, 2605, 2541, 2483, 2417, 2345, 
-    2279, 2196, 2127, 2037, 1959, 1869, 1783, 1694, 1599, 1505, 1414, 1312, 1222, 1119, 1025, 926, 
-    829, 733, 633, 542, 442, 352, 255, 165, 76, -15, -99, -190, -270, -357, -435, -519, 
-    -593, -675, -744, -824, -887, -966, -1025, -1097, -1159, -1220, -1282, -1337, -1395, -1449, -1498, -1548, 
-    -1592, -1639, -1676, -1718, -1750, -1783, -1814, -1835, -1865, -1877, -1900, -1907, -1921, -1924, -1930, -1924, 
-    -1923, -1912, -1904, -1885, -1869, -1843, -1821, -1787, -1758, -1718, -1682, -1633, -1593, -1535, -1491, -1426, 
-    -1374, -1307, -1246, -1176, -1108, -1033, -962, -881, -807, -721, -644, -556, -476, -383, -302, -207, 
-    -125, -30, 56, 151, 236, 331, 420, 511, 603, 689, 780, 868, 955, 1041, 1123, 1210, 
-    1288, 1371, 1444, 1525, 1596, 1665, 1739, 1801, 1868, 1926, 1986, 2040, 2093, 2139, 2186, 2226, 
-    2265, 2296, 2330, 2352, 2377, 2392, 2408, 2417, 2422, 2420, 2418, 2406, 2395, 2371, 2353, 2318, 
-    2288, 2246, 2201, 2153, 2095, 2038, 1970, 1903, 1827, 1749, 1665, 1578, 1489, 1392, 1295, 1193, 
-    1090, 986, 873, 768, 651, 543, 425, 311, 195, 80, -36, -151, -270, -380, -501, -606, 
-    -726, -831, -943, -1050, -1155, -1260, -1361, -1461, -1558, -1652, -1743, -1831, -1920, -1998, -2079, -2154, 
-    -2226, -2296, -2360, -2420, -2481, -2532, -2585, -2629, -2675, -2715, -2751, -2784, -2811, -2841, -2861, -2883, 
-    -2898, -2911, -2923, -2930, -2934, -2936, -2936, -2931, -2924, -2916, -2904, -2889, -2871, -2852, -2828, -2801, 
-    -2773, -2741, -2707, -2664, -2628, -2578, -2534, -2478, -2423, -2365, -2301, -2236, -2163, -2090, -2012, -1928, 
-    -1844, -1753, -1660, -1562, -1459, -1353, -1247, -1131, -1019, -894, -777, -646, -525, -387, -262, -119, 
-    8, 154, 284, 434, 564, 712, 846, 992, 1124, 1269, 1399, 1541, 1668, 1801, 1930, 2055, 
-    2180, 2297, 2417, 2527, 2640, 2744, 2850, 2945, 3046, 3130, 3225, 3300, 3388, 3456, 3534, 3593, 
-    3662, 3713, 3771, 3816, 3857, 3899, 3926, 3957, 3974, 3990, 3996, 4002, 3995, 3986, 3969, 3943, 
-    3916, 3876, 3838, 3783, 3734, 3668, 3603, 3530, 3452, 3371, 3282, 3191, 3096, 2997, 2893, 2790, 
-    2679, 2572, 2458, 2342, 2228, 2109, 1991, 1870, 1752, 1626, 1506, 1381, 1259, 1132, 1007, 879, 
-    754, 628, 498, 370, 241, 112, -14, -148, -273, -404, -534, -658, -792, -911, -1045, -1159, 
-    -1294, -1402, -1536, -1637, -1768, -1867, -1989, -2088, -2202, -2299, -2405, -2498, -2599, -2690, -2780, -2871, 
-    -2954, -3041, -3118, -3198, -3272, -3346, -3415, -3482, -3545, -3606, -3661, -3719, -3763, -3816, -3850, -3895, 
-    -3921, -3956, -3974, -3997, -4006, -4018, -4016, -4019, -4003, -3995, -3968, -3950, -3909, -3879, -3828, -3785, 
-    -3724, -3667, -3599, -3525, -3452, -3365, -3281, -3187, -3091, -2990, -2884, -2774, -2661, -2542, -2421, -2297, 
-    -2170, -2038, -1903, -1768, -1626, -1489, -1340, -1198, -1047, -899, -750, -595, -446, -290, -139, 15, 
-    164, 321, 467, 620, 766, 910, 1060, 1196, 1339, 1472, 1607, 1735, 1865, 1984, 2109, 2221, 
-    2339, 2441, 2555, 2650, 2757, 2842, 2943, 3023, 3111, 3191, 3266, 3341, 3405, 3475, 3529, 3591, 
-    3633, 3690, 3720, 3768, 3790, 3825, 3837, 3859, 3866, 3873, 3871, 3864, 3853, 3832, 3813, 3778, 
-    3752, 3705, 3666, 3612, 3559, 3502, 3435, 3370, 3297, 3222, 3142, 3058, 2974, 2885, 2792, 2695, 
-    2599, 2499, 2397, 2290, 2184, 2077, 1965, 1855, 1739, 1626, 1508, 1394, 1273, 1157, 1033, 914, 
-    795, 670, 550, 425, 304, 180, 58, -67, -187, -312, -431, -555, -675, -795, -913, -1034, 
-    -1149, -1266, -1379, -1494, -1604, -1716, -1820, -1931, -2030, -2137, -2232, -2334, -2422, -2520, -2603, -2697, 
-    -2772, -2859, -2930, -3007, -3073, -3142, -3204, -3258, -3315, -3362, -3409, -3447, -3484, -3513, -3540, -3562, 
-    -3572, -3591, -3586, -3597, -3583, -3579, -3560, -3540, -3514, -3484, -3448, -3408, -3359, -3315, -3253, -3201, 
-    -3129, -3065, -2992, -2914, -2832, -2748, -2656, -2566, -2466, -2367, -2264, -2154, -2047, -1928, -1817, -1695, 
-    -1572, -1451, -1321, -1193, -1063, -927, -800, -657, -527, -386, -250, -109, 26, 168, 302, 446, 
-    579, 719, 854, 988, 1123, 1254, 1383, 1513, 1637, 1761, 1882, 1996, 2116, 2222, 2334, 2434, 
-    2535, 2633, 2721, 2812, 2890, 2973, 3039, 3113, 3171, 3235, 3281, 3334, 3372, 3412, 3444, 3470, 
-    3492, 3508, 3520, 3526, 3525, 3525, 3511, 3502, 3477, 3460, 3426, 3395, 3354, 3313, 3266, 3212, 
-    3157, 3090, 3032, 2954, 2888, 2802, 2724, 2637, 2547, 2455, 2357, 2263, 2155, 2056, 1946, 1841, 
-    1729, 1617, 1505, 1390, 1277, 1159, 1049, 925, 815, 695, 583, 464, 349, 235, 122, 5, 
-    -106, -221, -331, -446, -557, -669, -778, -891, -995, -1112, -1208, -1329, -1421, -1536, -1632, -1736, 
-    -1837, -1933, -2028, -2126, -2214, -2305, -2390, -2473, -2556, -2632, -2705, -2777, -2843, -2907, -2966, -3020, 
-    -3075, -3119, -3165, -3198, -3237, -3264, -3290, -3308, -3327, -3332, -3346, -3336, -3343, -3323, -3319, -3291, 
-    -3277, -3241, -3216, -3171, -3137, -3081, -3041, -2977, -2925, -2857, -2791, -2721, -2646, -2569, -2488, -2401, 
-    -2318, -2224, -2135, -2035, -1940, -1838, -1736, -1633, -1523, -1419, -1307, -1195, -1087, -968, -859, -740, 
-    -627, -510, -393, -276, -159, -44, 72, 186, 304, 413, 532, 639, 755, 857, 970, 1072, 
-    1181, 1278, 1382, 1477, 1574, 1669, 1755, 1852, 1929, 2022, 2096, 2178, 2253, 2325, 2398, 2460, 
-    2532, 2585, 2653, 2700, 2758, 2804, 2851, 2893, 2930, 2970, 2994, 3028, 3047, 3071, 3083, 3096, 
-    3103, 3107, 3105, 3101, 3091, 3077, 3057, 3038, 3009, 2978, 2942, 2903, 2862, 2811, 2761, 2705, 
-    2645, 2584, 2515, 2446, 2373, 2294, 2217, 2134, 2050, 1965, 1872, 1783, 1691, 1596, 1500, 1403, 
-    1306, 1206, 1108, 1006, 908, 804, 708, 598, 511, 
-};
-const unsigned int drum_v1_p1_long_len = 11753;
@@ -1,661 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v1_p2_long[] PROGMEM = {
-    34, -13, 19, 15, 28, 28, 32, 30, 28, 22, 21, 9, 8, -6, -8, -23, 
-    -27, -44, -48, -65, -71, -91, -96, -116, -124, -143, -155, -173, -188, -204, -222, -238, 
-    -259, -275, -294, -312, -331, -350, -367, -386, -404, -422, -440, -455, -474, -488, -506, -519, 
-    -536, -548, -566, -575, -591, -601, -617, -627, -639, -652, -662, -677, -685, -700, -709, -722, 
-    -732, -746, -757, -769, -780, -794, -804, -817, -828, -839, -851, -861, -872, -882, -892, -900, 
-    -908, -917, -922, -930, -930, -940, -938, -944, -940, -945, -941, -940, -935, -934, -927, -923, 
-    -915, -910, -899, -893, -879, -874, -857, -850, -834, -823, -808, -794, -778, -762, -743, -727, 
-    -706, -688, -663, -644, -621, -600, -571, -551, -522, -502, -471, -447, -420, -393, -365, -338, 
-    -313, -283, -257, -230, -203, -175, -151, -122, -98, -69, -46, -19, 3, 30, 55, 79, 
-    101, 127, 149, 174, 194, 221, 241, 265, 286, 312, 331, 357, 378, 403, 425, 448, 
-    472, 496, 520, 543, 567, 591, 613, 636, 659, 680, 702, 722, 744, 759, 780, 795, 
-    814, 827, 843, 856, 869, 881, 892, 903, 913, 922, 930, 940, 946, 954, 961, 968, 
-    973, 977, 984, 986, 990, 993, 993, 995, 993, 994, 987, 984, 978, 970, 962, 949, 
-    939, 923, 910, 891, 873, 854, 832, 810, 788, 764, 738, 712, 686, 659, 631, 603, 
-    572, 546, 513, 485, 451, 421, 388, 354, 319, 283, 245, 208, 168, 129, 85, 45, 
-    -2, -43, -92, -135, -184, -232, -280, -328, -378, -425, -476, -522, -574, -618, -669, -714, 
-    -762, -804, -851, -894, -937, -977, -1018, -1057, -1094, -1131, -1165, -1200, -1231, -1263, -1292, -1320, 
-    -1347, -1373, -1397, -1419, -1441, -1461, -1479, -1496, -1511, -1525, -1537, -1547, -1554, -1562, -1565, -1569, 
-    -1567, -1569, -1563, -1557, -1550, -1541, -1527, -1511, -1496, -1474, -1454, -1428, -1403, -1371, -1342, -1306, 
-    -1274, -1232, -1196, -1151, -1111, -1061, -1017, -964, -916, -861, -808, -751, -694, -634, -574, -511, 
-    -448, -382, -316, -249, -179, -110, -38, 32, 104, 179, 251, 330, 401, 480, 556, 632, 
-    710, 786, 865, 940, 1018, 1096, 1171, 1247, 1323, 1399, 1472, 1544, 1617, 1687, 1756, 1824, 
-    1888, 1954, 2013, 2076, 2128, 2189, 2237, 2290, 2334, 2380, 2422, 2459, 2496, 2527, 2557, 2582, 
-    2604, 2626, 2638, 2654, 2658, 2667, 2664, 2664, 2655, 2646, 2629, 2612, 2586, 2561, 2526, 2491, 
-    2451, 2405, 2356, 2304, 2246, 2185, 2118, 2051, 1976, 1899, 1819, 1734, 1648, 1554, 1461, 1362, 
-    1262, 1158, 1050, 942, 829, 717, 596, 480, 356, 234, 108, -19, -147, -280, -411, -545, 
-    -681, -815, -956, -1090, -1232, -1370, -1511, -1651, -1791, -1933, -2071, -2211, -2350, -2487, -2625, -2758, 
-    -2894, -3025, -3156, -3284, -3410, -3535, -3656, -3777, -3893, -4007, -4121, -4228, -4336, -4438, -4541, -4638, 
-    -4732, -4824, -4911, -4996, -5075, -5152, -5223, -5291, -5353, -5410, -5462, -5508, -5549, -5581, -5608, -5628, 
-    -5640, -5643, -5639, -5627, -5607, -5577, -5538, -5492, -5434, -5368, -5294, -5207, -5114, -5008, -4897, -4770, 
-    -4640, -4494, -4345, -4180, -4012, -3827, -3639, -3438, -3231, -3012, -2785, -2550, -2305, -2054, -1793, -1527, 
-    -1250, -968, -680, -385, -84, 219, 529, 841, 1160, 1477, 1801, 2120, 2448, 2765, 3094, 3409, 
-    3734, 4046, 4363, 4671, 4977, 5278, 5572, 5862, 6144, 6418, 6687, 6948, 7199, 7444, 7678, 7903, 
-    8119, 8326, 8523, 8711, 8887, 9054, 9209, 9358, 9491, 9618, 9731, 9837, 9929, 10015, 10087, 10150, 
-    10203, 10247, 10279, 10301, 10316, 10318, 10312, 10293, 10273, 10233, 10193, 10137, 10079, 10005, 9929, 9838, 
-    9744, 9638, 9526, 9404, 9273, 9135, 8987, 8834, 8664, 8494, 8309, 8117, 7914, 7700, 7480, 7242, 
-    7000, 6739, 6472, 6187, 5894, 5583, 5260, 4924, 4572, 4207, 3824, 3432, 3020, 2596, 2158, 1703, 
-    1237, 754, 263, -246, -764, -1294, -1838, -2388, -2953, -3521, -4105, -4687, -5285, -5879, -6486, -7092, 
-    -7701, -8310, -8922, -9530, -10135, -10737, -11333, -11919, -12500, -13066, -13624, -14163, -14692, -15198, -15691, -16157, 
-    -16608, -17029, -17431, -17806, -18151, -18475, -18763, -19033, -19261, -19471, -19645, -19794, -19912, -20003, -20066, -20103, 
-    -20117, -20103, -20069, -20011, -19937, -19839, -19729, -19599, -19460, -19300, -19135, -18955, -18766, -18564, -18356, -18134, 
-    -17901, -17660, -17403, -17134, -16848, -16548, -16228, -15887, -15528, -15143, -14740, -14307, -13858, -13378, -12882, -12359, 
-    -11825, -11267, -10702, -10122, -9543, -8956, -8374, -7796, -7229, -6673, -6131, -5604, -5089, -4593, -4105, -3624, 
-    -3147, -2665, -2175, -1660, -1122, -544, 76, 762, 1502, 2323, 3213, 4197, 5260, 6415, 7671, 9032, 
-    10442, 11935, 13470, 15059, 16658, 18290, 19898, 21502, 23049, 24598, 26052, 27474, 27741, 27698, 27722, 27705, 
-    27719, 27708, 27717, 27709, 27718, 27709, 27716, 27710, 27716, 27711, 27715, 27712, 27714, 27712, 27714, 27712, 
-    27712, 27713, 27712, 27713, 27709, 27713, 27710, 27714, 27712, 27714, 27712, 27714, 27712, 27713, 27712, 27713, 
-    27711, 27716, 27709, 27718, 27702, 27734, 27609, 25899, 24063, 22214, 20375, 18518, 16672, 14851, 13060, 11295, 
-    9569, 7913, 6335, 4833, 3412, 2088, 866, -262, -1314, -2311, -3262, -4187, -5084, -5955, -6825, -7709, 
-    -8612, -9532, -10468, -11423, -12403, -13444, -14536, -15674, -16836, -18025, -19227, -20443, -21651, -22863, -24064, -25260, 
-    -26428, -27492, -27789, -27756, -27771, -27761, -27769, -27763, -27767, -27763, -27767, -27763, -27766, -27762, -27766, -27762, 
-    -27766, -27764, -27766, -27763, -27765, -27764, -27768, -27762, -27768, -27764, -27767, -27764, -27766, -27764, -27767, -27763, 
-    -27767, -27763, -27766, -27761, -27766, -27763, -27766, -27764, -27766, -27765, -27766, -27765, -27766, -27763, -27769, -27762, 
-    -27770, -27758, -27772, -27757, -27773, -27754, -27778, -27749, -27788, -27731, -27832, -27251, -25211, -23305, -21266, -19273, 
-    -17207, -15185, -13132, -11146, -9164, -7267, -5385, -3577, -1782, -50, 1664, 3314, 4943, 6515, 8077, 9593, 
-    11101, 12555, 14003, 15400, 16797, 18153, 19521, 20859, 22224, 23566, 24937, 26284, 27596, 27738, 27702, 27719, 
-    27709, 27715, 27710, 27715, 27710, 27715, 27711, 27714, 27712, 27714, 27713, 27713, 27712, 27712, 27713, 27713, 
-    27713, 27713, 27713, 27714, 27711, 27715, 27712, 27715, 27711, 27714, 27712, 27714, 27712, 27714, 27711, 27715, 
-    27711, 27714, 27711, 27715, 27711, 27715, 27711, 27714, 27711, 27714, 27712, 27714, 27711, 27714, 27711, 27715, 
-    27712, 27714, 27711, 27714, 27711, 27715, 27710, 27717, 27708, 27720, 27703, 27728, 27690, 27755, 26751, 24564, 
-    22412, 20161, 17934, 15643, 13378, 11059, 8749, 6399, 4069, 1721, -591, -2904, -5173, -7421, -9602, -11754, 
-    -13826, -15860, -17800, -19710, -21512, -23307, -24972, -26710, -27728, -27762, -27770, -27763, -27767, -27763, -27768, -27764, 
-    -27767, -27762, -27768, -27763, -27767, -27764, -27766, -27764, -27766, -27764, -27766, -27764, -27766, -27763, -27766, -27765, 
-    -27767, -27764, -27766, -27764, -27767, -27762, -27767, -27762, -27767, -27764, -27768, -27764, -27766, -27764, -27766, -27764, 
-    -27764, -27766, -27765, -27765, -27765, -27765, -27767, -27765, -27766, -27764, -27767, -27764, -27766, -27763, -27767, -27764, 
-    -27766, -27763, -27767, -27761, -27768, -27761, -27771, -27760, -27772, -27757, -27772, -27757, -27775, -27757, -27728, -25654, 
-    -22560, -19540, -16433, -13348, -10230, -7139, -4047, -996, 2022, 4993, 7916, 10794, 13601, 16365, 19035, 21671, 
-    24185, 26682, 27758, 27686, 27732, 27699, 27725, 27703, 27722, 27704, 27721, 27705, 27720, 27706, 27720, 27705, 
-    27720, 27705, 27721, 27705, 27721, 27705, 27720, 27706, 27720, 27706, 27720, 27706, 27720, 27707, 27718, 27707, 
-    27719, 27708, 27719, 27707, 27719, 27707, 27720, 27706, 27720, 27706, 27720, 27706, 27720, 27706, 27719, 27706, 
-    27719, 27705, 27719, 27706, 27719, 27706, 27719, 27708, 27718, 27708, 27718, 27708, 27718, 27705, 27722, 27704, 
-    27724, 27701, 27725, 27700, 27728, 27697, 27731, 27691, 27741, 27670, 27796, 27372, 24485, 21637, 18672, 15727, 
-    12717, 9722, 6693, 3686, 670, -2303, -5263, -8170, -11052, -13873, -16658, -19382, -22054, -24674, -27125, -27810, 
-    -27746, -27777, -27757, -27773, -27759, -27771, -27760, -27770, -27761, -27770, -27761, -27769, -27762, -27767, -27764, -27767, 
-    -27764, -27767, -27762, -27768, -27764, -27767, -27764, -27767, -27764, -27768, -27763, -27769, -27762, -27770, -27761, -27769, 
-    -27760, -27768, -27760, -27768, -27761, -27769, -27763, -27768, -27761, -27769, -27762, -27770, -27761, -27769, -27761, -27769, 
-    -27759, -27768, -27759, -27770, -27759, -27772, -27756, -27772, -27758, -27773, -27757, -27771, -27756, -27773, -27757, -27776, 
-    -27753, -27779, -27750, -27782, -27744, -27787, -27737, -27804, -27708, -27851, -26078, -23354, -20843, -18122, -15466, -12697, 
-    -9967, -7175, -4420, -1653, 1072, 3772, 6425, 9030, 11589, 14083, 16544, 18918, 21284, 23523, 25859, 27634, 
-    27690, 27734, 27696, 27728, 27700, 27725, 27702, 27723, 27703, 27723, 27704, 27721, 27706, 27720, 27706, 27719, 
-    27706, 27719, 27706, 27718, 27707, 27718, 27706, 27717, 27706, 27717, 27708, 27715, 27710, 27714, 27710, 27714, 
-    27711, 27715, 27711, 27715, 27711, 27715, 27711, 27715, 27711, 27714, 27710, 27715, 27709, 27717, 27708, 27717, 
-    27709, 27716, 27710, 27715, 27710, 27716, 27710, 27714, 27711, 27715, 27709, 27715, 27711, 27716, 27710, 27715, 
-    27712, 27712, 27713, 27709, 27717, 27702, 27738, 27568, 25346, 23038, 20694, 18340, 15938, 13525, 11063, 8586, 
-    6063, 3524, 940, -1652, -4289, -6920, -9596, -12256, -14961, -17629, -20344, -22978, -25729, -27636, -27775, -27767, 
-    -27761, -27767, -27763, -27768, -27761, -27766, -27764, -27764, -27766, -27764, -27765, -27762, -27765, -27765, -27765, -27765, 
-    -27763, -27766, -27763, -27766, -27765, -27766, -27765, -27765, -27767, -27766, -27765, -27766, -27764, -27765, -27765, -27765, 
-    -27767, -27765, -27766, -27765, -27767, -27765, -27764, -27766, -27764, -27766, -27763, -27765, -27764, -27767, -27765, -27765, 
-    -27765, -27766, -27765, -27765, -27766, -27765, -27765, -27766, -27765, -27768, -27763, -27770, -27759, -27775, -27748, -27802, 
-    -27572, -25476, -22980, -20486, -17963, -15421, -12863, -10291, -7714, -5129, -2554, 13, 2555, 5074, 7555, 10001, 
-    12401, 14754, 17059, 19297, 21495, 23599, 25705, 27511, 27717, 27715, 27709, 27716, 27709, 27716, 27709, 27716, 
-    27711, 27716, 27709, 27716, 27710, 27715, 27710, 27715, 27710, 27716, 27709, 27714, 27710, 27714, 27710, 27714, 
-    27711, 27714, 27711, 27715, 27709, 27717, 27709, 27717, 27708, 27716, 27709, 27715, 27710, 27716, 27711, 27715, 
-    27710, 27715, 27710, 27716, 27710, 27715, 27709, 27715, 27710, 27716, 27710, 27716, 27709, 27717, 27708, 27718, 
-    27707, 27717, 27708, 27720, 27706, 27720, 27703, 27726, 27698, 27731, 27687, 27748, 25815, 23259, 20867, 18411, 
-    16035, 13641, 11301, 8957, 6646, 4330, 2038, -262, -2550, -4851, -7146, -9455, -11765, -14082, -16396, -18700, 
-    -20999, -23256, -25529, -27572, -27775, -27765, -27765, -27766, -27764, -27768, -27763, -27767, -27762, -27768, -27763, -27768, 
-    -27762, -27768, -27764, -27765, -27763, -27765, -27763, -27764, -27765, -27766, -27764, -27767, -27764, -27767, -27763, -27767, 
-    -27764, -27767, -27765, -27765, -27766, -27765, -27766, -27766, -27765, -27766, -27764, -27766, -27765, -27765, -27766, -27765, 
-    -27766, -27765, -27764, -27767, -27765, -27767, -27764, -27765, -27765, -27765, -27766, -27764, -27767, -27763, -27767, -27764, 
-    -27766, -27764, -27766, -27765, -27765, -27767, -27761, -27778, -27690, -25924, -23811, -21693, -19509, -17289, -15029, -12731, 
-    -10402, -8038, -5655, -3240, -811, 1650, 4124, 6632, 9147, 11693, 14235, 16798, 19345, 21909, 24444, 26949, 
-    27759, 27691, 27727, 27703, 27720, 27706, 27718, 27708, 27716, 27709, 27716, 27709, 27716, 27710, 27715, 27710, 
-    27715, 27710, 27714, 27710, 27713, 27711, 27714, 27711, 27713, 27711, 27714, 27711, 27714, 27711, 27716, 27711, 
-    27714, 27710, 27716, 27709, 27715, 27709, 27714, 27711, 27714, 27711, 27715, 27710, 27715, 27710, 27713, 27710, 
-    27713, 27713, 27708, 27729, 27466, 26271, 24963, 23670, 22382, 21106, 19849, 18605, 17387, 16186, 15012, 13852, 
-    12716, 11586, 10471, 9349, 8234, 7101, 5957, 4780, 3579, 2329, 1044, -302, -1690, -3144, -4639, -6198, 
-    -7793, -9451, -11130, -12875, -14621, -16427, -18221, -20059, -21865, -23701, -25480, -27270, -27794, -27748, -27775, -27756, 
-    -27773, -27758, -27771, -27761, -27770, -27761, -27768, -27763, -27767, -27764, -27765, -27764, -27764, -27763, -27764, -27763, 
-    -27767, -27764, -27766, -27765, -27766, -27766, -27764, -27767, -27763, -27765, -27763, -27765, -27765, -27766, -27764, -27765, 
-    -27763, -27765, -27763, -27767, -27762, -27771, -27755, -27791, -27506, -26102, -24465, -22860, -21234, -19613, -17992, -16378, 
-    -14770, -13177, -11596, -10039, -8496, -6988, -5498, -4047, -2619, -1238, 114, 1418, 2690, 3911, 5097, 6225, 
-    7320, 8361, 9372, 10337, 11277, 12184, 13074, 13943, 14805, 15654, 16510, 17355, 18223, 19080, 19972, 20852, 
-    21771, 22675, 23620, 24541, 25516, 26429, 27445, 27768, 27685, 27732, 27699, 27724, 27704, 27719, 27706, 27717, 
-    27708, 27717, 27709, 27716, 27709, 27715, 27710, 27715, 27713, 27714, 27712, 27714, 27711, 27714, 27710, 27715, 
-    27710, 27716, 27710, 27716, 27709, 27716, 27710, 27715, 27715, 27632, 27002, 26208, 25397, 24523, 23596, 22606, 
-    21552, 20433, 19244, 17991, 16676, 15304, 13878, 12405, 10892, 9354, 7792, 6227, 4659, 3116, 1589, 99, 
-    -1352, -2754, -4099, -5390, -6621, -7788, -8900, -9952, -10959, -11918, -12845, -13738, -14611, -15466, -16312, -17147, 
-    -17983, -18814, -19649, -20474, -21305, -22124, -22946, -23745, -24539, -25299, -26045, -26742, -27425, -27774, -27758, -27770, 
-    -27762, -27767, -27762, -27767, -27764, -27765, -27763, -27765, -27764, -27767, -27764, -27766, -27765, -27767, -27763, -27767, 
-    -27763, -27769, -27762, -27769, -27761, -27771, -27758, -27778, -27637, -27125, -26593, -26006, -25389, -24714, -24006, -23234, 
-    -22421, -21547, -20628, -19649, -18626, -17549, -16428, -15262, -14061, -12827, -11572, -10297, -9011, -7718, -6425, -5135, 
-    -3858, -2592, -1350, -123, 1072, 2255, 3405, 4540, 5647, 6738, 7803, 8856, 9885, 10905, 11908, 12900, 
-    13876, 14840, 15782, 16710, 17611, 18492, 19339, 20161, 20944, 21690, 22399, 23064, 23684, 24255, 24781, 25254, 
-    25680, 26056, 26381, 26660, 26890, 27079, 27221, 27323, 27384, 27409, 27396, 27348, 27262, 27146, 26996, 26817, 
-    26611, 26377, 26121, 25834, 25525, 25189, 24830, 24449, 24045, 23620, 23180, 22719, 22246, 21754, 21253, 20732, 
-    20205, 19659, 19104, 18529, 17944, 17336, 16713, 16067, 15405, 14718, 14008, 13275, 12520, 11740, 10935, 10106, 
-    9248, 8363, 7452, 6514, 5549, 4557, 3543, 2508, 1453, 377, -702, -1802, -2899, -4010, -5109, -6214, 
-    -7298, -8378, -9430, -10465, -11465, -12441, -13376, -14278, -15137, -15958, -16735, -17468, -18160, -18811, -19419, -19991, 
-    -20525, -21031, -21502, -21948, -22368, -22760, -23135, -23481, -23811, -24111, -24393, -24641, -24860, -25044, -25191, -25295, 
-    -25353, -25364, -25320, -25226, -25074, -24871, -24613, -24306, -23953, -23558, -23124, -22663, -22167, -21657, -21125, -20593, 
-    -20050, -19514, -18985, -18465, -17963, -17469, -16996, -16531, -16079, -15632, -15188, -14742, -14287, -13812, -13322, -12798, 
-    -12250, -11658, -11033, -10361, -9645, -8890, -8089, -7257, -6389, -5494, -4575, -3639, -2692, -1738, -782, 162, 
-    1101, 2017, 2916, 3781, 4623, 5433, 6213, 6966, 7685, 8386, 9048, 9698, 10312, 10917, 11492, 12056, 
-    12602, 13136, 13657, 14166, 14667, 15158, 15638, 16108, 16564, 17010, 17436, 17853, 18250, 18636, 18997, 19341, 
-    19658, 19945, 20203, 20418, 20603, 20736, 20832, 20874, 20875, 20821, 20724, 20577, 20387, 20151, 19877, 19565, 
-    19221, 18849, 18447, 18023, 17580, 17118, 16641, 16153, 15654, 15152, 14642, 14136, 13629, 13125, 12623, 12123, 
-    11629, 11134, 10646, 10158, 9674, 9190, 8713, 8235, 7763, 7291, 6828, 6366, 5907, 5456, 5006, 4566, 
-    4121, 3687, 3245, 2809, 2368, 1927, 1483, 1035, 585, 130, -330, -797, -1266, -1741, -2218, -2701, 
-    -3181, -3670, -4155, -4648, -5139, -5632, -6126, -6619, -7118, -7612, -8108, -8599, -9090, -9572, -10046, -10511, 
-    -10962, -11401, -11819, -12221, -12596, -12945, -13266, -13555, -13812, -14033, -14221, -14376, -14495, -14580, -14634, -14656, 
-    -14650, -14617, -14559, -14483, -14379, -14268, -14132, -13996, -13839, -13687, -13518, -13354, -13175, -13000, -12811, -12623, 
-    -12417, -12205, -11974, -11723, -11452, -11154, -10833, -10482, -10108, -9710, -9289, -8849, -8394, -7926, -7451, -6972, 
-    -6494, -6022, -5559, -5113, -4689, -4289, -3919, -3581, -3278, -3011, -2785, -2592, -2438, -2314, -2226, -2159, 
-    -2117, -2089, -2074, -2058, -2048, -2022, -1993, -1940, -1875, -1781, -1672, -1531, -1372, -1181, -975, -740, 
-    -487, -213, 70, 373, 681, 1005, 1329, 1661, 1995, 2330, 2665, 2993, 3322, 3642, 3961, 4273, 
-    4586, 4892, 5200, 5509, 5818, 6132, 6444, 6764, 7082, 7401, 7723, 8033, 8347, 8642, 8932, 9197, 
-    9446, 9667, 9856, 10016, 10136, 10222, 10263, 10267, 10230, 10158, 10043, 9902, 9725, 9528, 9307, 9078, 
-    8837, 8594, 8352, 8120, 7897, 7696, 7507, 7352, 7210, 7106, 7019, 6967, 6934, 6929, 6941, 6970, 
-    7008, 7054, 7100, 7141, 7174, 7192, 7193, 7168, 7123, 7046, 6941, 6800, 6634, 6431, 6201, 5944, 
-    5660, 5356, 5029, 4690, 4335, 3977, 3607, 3245, 2880, 2534, 2192, 1878, 1577, 1305, 1055, 834, 
-    638, 471, 327, 207, 103, 19, -58, -122, -189, -247, -316, -385, -476, -571, -693, -825, 
-    -986, -1160, -1362, -1579, -1816, -2068, -2331, -2609, -2882, -3162, -3429, -3695, -3938, -4169, -4377, -4564, 
-    -4724, -4864, -4976, -5069, -5134, -5186, -5214, -5240, -5248, -5260, -5265, -5281, -5300, -5335, -5375, -5438, 
-    -5510, -5604, -5709, -5838, -5974, -6132, -6290, -6466, -6638, -6817, -6991, -7155, -7314, -7450, -7583, -7682, 
-    -7773, -7830, -7873, -7886, -7885, -7859, -7823, -7766, -7708, -7634, -7561, -7481, -7408, -7327, -7261, -7191, 
-    -7137, -7081, -7044, -7008, -6981, -6962, -6947, -6941, -6932, -6933, -6927, -6927, -6918, -6907, -6885, -6859, 
-    -6818, -6770, -6707, -6632, -6542, -6431, -6307, -6159, -5997, -5807, -5602, -5372, -5122, -4850, -4557, -4246, 
-    -3915, -3567, -3202, -2819, -2426, -2018, -1607, -1184, -760, -333, 91, 510, 923, 1324, 1715, 2091, 
-    2451, 2798, 3122, 3437, 3729, 4013, 4278, 4536, 4783, 5024, 5260, 5494, 5729, 5966, 6203, 6447, 
-    6691, 6943, 7194, 7451, 7709, 7965, 8220, 8471, 8720, 8960, 9196, 9422, 9639, 9848, 10045, 10232, 
-    10408, 10574, 10730, 10877, 11018, 11151, 11281, 11402, 11522, 11637, 11748, 11855, 11956, 12052, 12138, 12214, 
-    12281, 12326, 12357, 12362, 12347, 12303, 12235, 12135, 12004, 11837, 11638, 11400, 11131, 10825, 10488, 10118, 
-    9721, 9291, 8841, 8361, 7868, 7350, 6826, 6283, 5736, 5181, 4626, 4071, 3524, 2983, 2452, 1930, 
-    1424, 930, 449, -11, -460, -889, -1301, -1696, -2071, -2431, -2770, -3093, -3395, -3684, -3953, -4207, 
-    -4445, -4673, -4887, -5093, -5288, -5474, -5657, -5827, -5998, -6154, -6313, -6459, -6604, -6740, -6866, -6987, 
-    -7101, -7204, -7305, -7392, -7481, -7554, -7630, -7693, -7760, -7817, -7882, -7935, -8001, -8056, -8123, -8184, 
-    -8258, -8329, -8405, -8484, -8565, -8649, -8730, -8813, -8890, -8965, -9032, -9095, -9148, -9195, -9227, -9253, 
-    -9261, -9261, -9246, -9218, -9181, -9127, -9069, -8991, -8914, -8820, -8722, -8613, -8501, -8377, -8255, -8118, 
-    -7987, -7838, -7696, -7539, -7382, -7213, -7038, -6853, -6657, -6452, -6237, -6009, -5770, -5513, -5244, -4953, 
-    -4652, -4328, -3992, -3634, -3266, -2880, -2487, -2083, -1673, -1257, -840, -424, -14, 388, 779, 1158, 
-    1517, 1858, 2175, 2470, 2739, 2982, 3199, 3390, 3553, 3694, 3811, 3908, 3981, 4045, 4090, 4129, 
-    4159, 4186, 4216, 4244, 4282, 4320, 4376, 4432, 4507, 4585, 4682, 4786, 4905, 5029, 5162, 5304, 
-    5444, 5593, 5733, 5880, 6017, 6152, 6281, 6404, 6525, 6635, 6742, 6839, 6934, 7019, 7107, 7184, 
-    7268, 7343, 7430, 7513, 7607, 7704, 7811, 7923, 8046, 8175, 8316, 8458, 8611, 8762, 8919, 9067, 
-    9218, 9354, 9484, 9596, 9693, 9772, 9826, 9856, 9862, 9839, 9786, 9704, 9593, 9455, 9285, 9091, 
-    8870, 8626, 8359, 8072, 7768, 7445, 7111, 6762, 6402, 6036, 5661, 5285, 4902, 4523, 4141, 3765, 
-    3390, 3027, 2667, 2325, 1989, 1673, 1366, 1081, 809, 559, 325, 113, -81, -255, -413, -549, 
-    -675, -783, -883, -972, -1058, -1142, -1226, -1315, -1409, -1516, -1628, -1756, -1896, -2053, -2226, -2419, 
-    -2627, -2853, -3096, -3353, -3626, -3910, -4207, -4513, -4824, -5146, -5466, -5795, -6119, -6450, -6773, -7098, 
-    -7416, -7735, -8049, -8358, -8662, -8962, -9252, -9541, -9814, -10084, -10334, -10578, -10801, -11014, -11201, -11376, 
-    -11526, -11657, -11763, -11847, -11912, -11950, -11971, -11968, -11951, -11909, -11855, -11780, -11690, -11587, -11469, -11341, 
-    -11198, -11050, -10886, -10722, -10541, -10360, -10166, -9973, -9770, -9567, -9360, -9151, -8943, -8732, -8528, -8317, 
-    -8118, -7913, -7719, -7523, -7336, -7152, -6974, -6801, -6627, -6462, -6295, -6132, -5965, -5798, -5628, -5449, 
-    -5264, -5066, -4862, -4641, -4408, -4159, -3896, -3615, -3320, -3004, -2672, -2319, -1953, -1564, -1160, -737, 
-    -298, 158, 632, 1121, 1625, 2145, 2673, 3216, 3767, 4327, 4892, 5465, 6038, 6616, 7188, 7760, 
-    8324, 8884, 9433, 9974, 10502, 11023, 11523, 12017, 12489, 12955, 13399, 13836, 14249, 14657, 15047, 15422, 
-    15781, 16129, 16460, 16775, 17072, 17362, 17625, 17880, 18110, 18328, 18526, 18704, 18861, 18996, 19108, 19196, 
-    19257, 19293, 19295, 19274, 19215, 19127, 19004, 18849, 18658, 18430, 18167, 17867, 17534, 17166, 16764, 16334, 
-    15872, 15384, 14872, 14341, 13791, 13225, 12648, 12065, 11468, 10876, 10271, 9678, 9073, 8481, 7880, 7293, 
-    6697, 6114, 5521, 4938, 4349, 3768, 3175, 2592, 1996, 1406, 801, 202, -411, -1021, -1651, -2277, 
-    -2923, -3570, -4233, -4907, -5591, -6289, -6997, -7718, -8452, -9190, -9942, -10696, -11455, -12216, -12972, -13726, 
-    -14470, -15200, -15916, -16608, -17283, -17927, -18546, -19131, -19685, -20203, -20693, -21141, -21559, -21937, -22290, -22604, 
-    -22894, -23152, -23390, -23602, -23792, -23962, -24110, -24240, -24343, -24427, -24484, -24517, -24517, -24488, -24420, -24318, 
-    -24173, -23983, -23746, -23458, -23123, -22728, -22284, -21784, -21232, -20629, -19978, -19281, -18544, -17765, -16960, -16123, 
-    -15271, -14395, -13522, -12634, -11757, -10878, -10019, -9165, -8332, -7514, -6716, -5936, -5177, -4432, -3703, -2985, 
-    -2277, -1570, -866, -157, 556, 1281, 2018, 2771, 3543, 4330, 5141, 5966, 6813, 7672, 8547, 9430, 
-    10316, 11203, 12082, 12950, 13805, 14635, 15446, 16219, 16969, 17677, 18352, 18985, 19581, 20138, 20652, 21133, 
-    21576, 21987, 22365, 22713, 23037, 23328, 23603, 23850, 24082, 24290, 24480, 24655, 24808, 24945, 25063, 25159, 
-    25232, 25280, 25302, 25292, 25248, 25173, 25054, 24900, 24699, 24461, 24173, 23845, 23467, 23050, 22583, 22077, 
-    21525, 20938, 20312, 19654, 18964, 18245, 17500, 16734, 15945, 15145, 14326, 13500, 12666, 11823, 10980, 10132, 
-    9290, 8444, 7600, 6761, 5918, 5083, 4242, 3408, 2565, 1728, 883, 36, -820, -1678, -2550, -3422, 
-    -4311, -5199, -6102, -7006, -7917, -8830, -9741, -10654, -11559, -12456, -13343, -14212, -15065, -15891, -16700, -17470, 
-    -18213, -18917, -19582, -20211, -20789, -21334, -21823, -22278, -22679, -23043, -23360, -23641, -23880, -24083, -24251, -24387, 
-    -24489, -24565, -24610, -24630, -24623, -24593, -24538, -24461, -24362, -24243, -24100, -23940, -23757, -23553, -23326, -23078, 
-    -22804, -22503, -22174, -21821, -21433, -21020, -20571, -20097, -19586, -19044, -18469, -17861, -17217, -16539, -15825, -15078, 
-    -14296, -13481, -12636, -11760, -10858, -9931, -8982, -8017, -7036, -6045, -5049, -4048, -3050, -2053, -1066, -86, 
-    882, 1834, 2774, 3690, 4589, 5466, 6321, 7154, 7958, 8741, 9498, 10234, 10944, 11634, 12302, 12952, 
-    13580, 14193, 14787, 15365, 15925, 16468, 16994, 17500, 17991, 18458, 18909, 19335, 19740, 20120, 20472, 20799, 
-    21094, 21358, 21591, 21791, 21961, 22092, 22197, 22265, 22305, 22311, 22289, 22240, 22160, 22055, 21925, 21769, 
-    21592, 21392, 21169, 20927, 20661, 20376, 20065, 19733, 19376, 18991, 18579, 18135, 17665, 17156, 16619, 16044, 
-    15436, 14792, 14113, 13402, 12652, 11877, 11065, 10233, 9366, 8485, 7578, 6657, 5719, 4771, 3812, 2847, 
-    1876, 906, -63, -1029, -1993, -2945, -3892, -4825, -5749, -6657, -7553, -8432, -9293, -10136, -10960, -11761, 
-    -12538, -13292, -14018, -14715, -15378, -16010, -16604, -17161, -17677, -18154, -18587, -18976, -19321, -19623, -19880, -20094, 
-    -20269, -20402, -20502, -20563, -20594, -20592, -20564, -20507, -20430, -20327, -20208, -20069, -19919, -19748, -19566, -19367, 
-    -19156, -18923, -18675, -18405, -18114, -17797, -17454, -17081, -16675, -16237, -15763, -15253, -14704, -14121, -13505, -12854, 
-    -12174, -11464, -10735, -9977, -9209, -8418, -7625, -6817, -6011, -5200, -4396, -3594, -2804, -2019, -1249, -487, 
-    255, 992, 1709, 2420, 3114, 3801, 4481, 5148, 5816, 6471, 7128, 7775, 8421, 9056, 9693, 10316, 
-    10933, 11536, 12132, 12709, 13271, 13814, 14338, 14837, 15315, 15762, 16184, 16573, 16933, 17259, 17550, 17809, 
-    18028, 18218, 18365, 18484, 18563, 18611, 18624, 18606, 18557, 18477, 18369, 18232, 18071, 17878, 17665, 17425, 
-    17167, 16883, 16582, 16257, 15914, 15549, 15165, 14760, 14336, 13889, 13426, 12943, 12437, 11913, 11368, 10805, 
-    10219, 9616, 8994, 8355, 7697, 7021, 6333, 5626, 4908, 4176, 3436, 2686, 1932, 1176, 416, -340, 
-    -1096, -1847, -2590, -3327, -4054, -4771, -5474, -6164, -6839, -7496, -8137, -8762, -9365, -9950, -10515, -11056, 
-    -11581, -12080, -12562, -13022, -13463, -13885, -14288, -14674, -15045, -15396, -15733, -16051, -16352, -16640, -16908, -17164, 
-    -17398, -17620, -17820, -18004, -18165, -18309, -18428, -18525, -18595, -18642, -18657, -18647, -18602, -18528, -18415, -18275, 
-    -18093, -17879, -17623, -17332, -17006, -16636, -16234, -15783, -15307, -14784, -14231, -13640, -13017, -12362, -11675, -10969, 
-    -10233, -9483, -8712, -7934, -7142, -6352, -5554, -4766, -3976, -3207, -2437, -1695, -954, -243, 461, 1141, 
-    1811, 2460, 3095, 3718, 4329, 4929, 5522, 6108, 6693, 7269, 7847, 8415, 8991, 9551, 10115, 10666, 
-    11211, 11741, 12259, 12761, 13241, 13700, 14133, 14540, 14917, 15267, 15583, 15868, 16122, 16344, 16537, 16698, 
-    16832, 16934, 17016, 17070, 17107, 17120, 17121, 17102, 17073, 17028, 16974, 16910, 16835, 16755, 16664, 16568, 
-    16464, 16352, 16232, 16101, 15964, 15809, 15648, 15467, 15274, 15059, 14827, 14570, 14292, 13985, 13655, 13290, 
-    12899, 12473, 12015, 11523, 10999, 10440, 9851, 9229, 8579, 7900, 7196, 6468, 5720, 4955, 4175, 3384, 
-    2585, 1784, 977, 180, -619, -1404, -2182, -2947, -3698, -4432, -5148, -5848, -6526, -7186, -7825, -8441, 
-    -9039, -9614, -10168, -10700, -11213, -11707, -12176, -12630, -13063, -13480, -13876, -14256, -14621, -14965, -15296, -15605, 
-    -15903, -16177, -16436, -16672, -16890, -17087, -17259, -17411, -17539, -17643, -17726, -17779, -17815, -17817, -17801, -17749, 
-    -17678, -17571, -17444, -17282, -17101, -16888, -16655, -16395, -16116, -15814, -15491, -15151, -14788, -14412, -14010, -13600, 
-    -13164, -12721, -12250, -11776, -11281, -10782, -10266, -9748, -9216, -8689, -8146, -7612, -7064, -6525, -5978, -5437, 
-    -4893, -4352, -3811, -3271, -2731, -2194, -1652, -1117, -574, -39, 503, 1041, 1582, 2119, 2659, 3193, 
-    3726, 4252, 4772, 5283, 5786, 6277, 6756, 7221, 7674, 8111, 8530, 8935, 9321, 9692, 10045, 10381, 
-    10705, 11008, 11307, 11584, 11861, 12114, 12371, 12605, 12843, 13057, 13273, 13467, 13662, 13831, 13996, 14142, 
-    14274, 14388, 14480, 14557, 14606, 14637, 14639, 14619, 14571, 14498, 14394, 14268, 14107, 13925, 13710, 13474, 
-    13210, 12925, 12619, 12295, 11956, 11604, 11240, 10869, 10489, 10109, 9722, 9340, 8953, 8572, 8189, 7813, 
-    7434, 7059, 6686, 6314, 5937, 5563, 5186, 4805, 4416, 4027, 3628, 3222, 2809, 2389, 1959, 1527, 
-    1084, 640, 188, -258, -707, -1152, -1590, -2019, -2438, -2844, -3235, -3609, -3970, -4308, -4631, -4934, 
-    -5217, -5485, -5732, -5965, -6177, -6376, -6562, -6729, -6889, -7032, -7173, -7293, -7414, -7516, -7622, -7708, 
-    -7795, -7867, -7937, -7990, -8040, -8077, -8104, -8120, -8126, -8124, -8107, -8085, -8053, -8015, -7970, -7919, 
-    -7866, -7809, -7752, -7692, -7634, -7570, -7512, -7445, -7388, -7316, -7255, -7182, -7113, -7038, -6959, -6879, 
-    -6787, -6700, -6598, -6500, -6388, -6280, -6159, -6042, -5915, -5789, -5658, -5526, -5394, -5259, -5126, -4992, 
-    -4860, -4728, -4596, -4468, -4340, -4213, -4089, -3964, -3842, -3716, -3593, -3466, -3338, -3207, -3071, -2931, 
-    -2784, -2636, -2480, -2319, -2152, -1980, -1802, -1618, -1428, -1235, -1036, -831, -625, -413, -203, 12, 
-    222, 434, 641, 844, 1041, 1231, 1413, 1585, 1751, 1905, 2053, 2186, 2316, 2430, 2540, 2638, 
-    2731, 2814, 2894, 2967, 3039, 3105, 3174, 3236, 3302, 3364, 3431, 3494, 3561, 3627, 3697, 3765, 
-    3836, 3905, 3975, 4042, 4111, 4173, 4241, 4298, 4364, 4416, 4481, 4531, 4589, 4641, 4697, 4748, 
-    4802, 4858, 4912, 4969, 5029, 5091, 5160, 5231, 5310, 5393, 5487, 5584, 5691, 5805, 5926, 6053, 
-    6187, 6322, 6460, 6597, 6734, 6862, 6990, 7104, 7215, 7308, 7395, 7460, 7517, 7550, 7570, 7567, 
-    7548, 7508, 7446, 7371, 7269, 7158, 7021, 6876, 6709, 6533, 6337, 6134, 5916, 5693, 5454, 5216, 
-    4962, 4710, 4445, 4180, 3906, 3631, 3352, 3071, 2786, 2501, 2212, 1927, 1639, 1353, 1067, 788, 
-    505, 232, -42, -306, -574, -831, -1088, -1335, -1582, -1818, -2049, -2272, -2491, -2699, -2903, -3096, 
-    -3286, -3465, -3638, -3805, -3963, -4115, -4258, -4395, -4527, -4650, -4771, -4884, -4996, -5102, -5209, -5314, 
-    -5420, -5528, -5638, -5751, -5872, -5994, -6130, -6262, -6415, -6561, -6727, -6889, -7064, -7240, -7422, -7609, 
-    -7797, -7985, -8174, -8361, -8544, -8721, -8890, -9054, -9205, -9349, -9475, -9593, -9696, -9782, -9853, -9907, 
-    -9944, -9962, -9958, -9937, -9893, -9830, -9743, -9635, -9503, -9348, -9169, -8968, -8743, -8493, -8226, -7935, 
-    -7625, -7294, -6952, -6587, -6212, -5823, -5428, -5026, -4617, -4207, -3794, -3387, -2981, -2581, -2188, -1806, 
-    -1432, -1066, -712, -369, -34, 293, 609, 920, 1223, 1521, 1816, 2106, 2398, 2683, 2972, 3257, 
-    3545, 3830, 4115, 4398, 4678, 4958, 5230, 5501, 5760, 6017, 6258, 6496, 6715, 6930, 7127, 7313, 
-    7491, 7648, 7804, 7938, 8075, 8192, 8312, 8420, 8529, 8633, 8736, 8838, 8944, 9045, 9153, 9257, 
-    9366, 9471, 9578, 9685, 9787, 9888, 9986, 10079, 10164, 10242, 10314, 10373, 10423, 10457, 10480, 10485, 
-    10473, 10443, 10392, 10325, 10232, 10123, 9988, 9836, 9654, 9458, 9230, 8989, 8717, 8431, 8119, 7789, 
-    7440, 7073, 6690, 6293, 5882, 5461, 5031, 4592, 4150, 3698, 3247, 2791, 2336, 1881, 1424, 978, 
-    528, 88, -347, -774, -1194, -1604, -2002, -2390, -2765, -3125, -3473, -3803, -4120, -4420, -4701, -4967, 
-    -5213, -5445, -5651, -5849, -6018, -6177, -6315, -6440, -6548, -6638, -6723, -6788, -6849, -6895, -6938, -6970, 
-    -6999, -7024, -7044, -7063, -7077, -7095, -7104, -7117, -7124, -7133, -7139, -7143, -7143, -7143, -7137, -7130, 
-    -7112, -7094, -7067, -7034, -6992, -6938, -6880, -6808, -6725, -6633, -6528, -6417, -6290, -6159, -6018, -5867, 
-    -5718, -5558, -5401, -5236, -5080, -4921, -4767, -4614, -4472, -4329, -4199, -4067, -3949, -3830, -3721, -3611, 
-    -3509, -3402, -3301, -3194, -3090, -2974, -2860, -2729, -2599, -2452, -2298, -2129, -1953, -1760, -1561, -1350, 
-    -1132, -905, -675, -441, -209, 23, 252, 474, 690, 898, 1095, 1280, 1450, 1614, 1754, 1888, 
-    1998, 2106, 2190, 2267, 2326, 2380, 2417, 2448, 2468, 2480, 2486, 2485, 2480, 2466, 2452, 2431, 
-    2409, 2383, 2354, 2325, 2292, 2261, 2228, 2200, 2170, 2147, 2125, 2108, 2097, 2089, 2092, 2096, 
-    2110, 2131, 2155, 2193, 2225, 2280, 2322, 2386, 2438, 2509, 2569, 2641, 2707, 2778, 2841, 2909, 
-    2969, 3028, 3084, 3133, 3181, 3221, 3263, 3299, 3334, 3368, 3402, 3437, 3473, 3513, 3556, 3604, 
-    3654, 3715, 3776, 3846, 3918, 3998, 4081, 4165, 4254, 4340, 4428, 4508, 4587, 4660, 4723, 4778, 
-    4823, 4857, 4880, 4887, 4889, 4871, 4849, 4810, 4768, 4712, 4648, 4580, 4502, 4423, 4335, 4249, 
-    4157, 4069, 3976, 3892, 3800, 3719, 3632, 3554, 3472, 3398, 3323, 3251, 3179, 3111, 3043, 2976, 
-    2911, 2840, 2775, 2700, 2632, 2552, 2477, 2388, 2305, 2206, 2110, 1998, 1888, 1761, 1632, 1489, 
-    1343, 1181, 1012, 832, 644, 444, 231, 13, -219, -457, -709, -964, -1232, -1506, -1784, -2070, 
-    -2358, -2652, -2941, -3238, -3528, -3821, -4109, -4396, -4678, -4957, -5232, -5503, -5765, -6025, -6273, -6519, 
-    -6751, -6982, -7199, -7410, -7612, -7807, -7991, -8169, -8341, -8503, -8660, -8808, -8955, -9086, -9222, -9341, 
-    -9461, -9567, -9672, -9766, -9851, -9930, -9995, -10051, -10093, -10123, -10137, -10132, -10114, -10076, -10018, -9939, 
-    -9841, -9718, -9576, -9410, -9224, -9013, -8786, -8536, -8270, -7983, -7685, -7370, -7047, -6710, -6369, -6020, 
-    -5669, -5315, -4958, -4606, -4251, -3904, -3553, -3213, -2872, -2540, -2210, -1887, -1570, -1256, -949, -646, 
-    -350, -54, 234, 523, 807, 1094, 1375, 1662, 1946, 2236, 2526, 2825, 3127, 3439, 3757, 4088, 
-    4429, 4778, 5146, 5517, 5912, 6304, 6722, 7133, 7569, 7995, 8439, 8873, 9315, 9747, 10178, 10598, 
-    11007, 11405, 11787, 12154, 12501, 12830, 13137, 13426, 13687, 13930, 14144, 14339, 14510, 14654, 14780, 14875, 
-    14954, 15000, 15035, 15035, 15023, 14979, 14921, 14831, 14727, 14593, 14442, 14265, 14067, 13847, 13606, 13345, 
-    13063, 12763, 12447, 12109, 11757, 11387, 11001, 10599, 10180, 9747, 9297, 8835, 8354, 7862, 7355, 6839, 
-    6303, 5763, 5206, 4646, 4070, 3497, 2908, 2324, 1732, 1142, 551, -34, -615, -1194, -1764, -2325, 
-    -2879, -3422, -3956, -4478, -4992, -5493, -5984, -6469, -6937, -7406, -7856, -8310, -8745, -9187, -9611, -10037, 
-    -10452, -10864, -11266, -11663, -12052, -12428, -12798, -13154, -13502, -13829, -14148, -14447, -14732, -14995, -15242, -15468, 
-    -15673, -15855, -16020, -16161, -16277, -16375, -16446, -16499, -16524, -16534, -16512, -16477, -16411, -16332, -16225, -16101, 
-    -15952, -15786, -15595, -15386, -15153, -14903, -14629, -14335, -14022, -13689, -13337, -12966, -12578, -12172, -11751, -11316, 
-    -10864, -10400, -9920, -9431, -8926, -8413, -7884, -7349, -6799, -6240, -5672, -5092, -4505, -3904, -3300, -2680, 
-    -2056, -1421, -781, -134, 520, 1176, 1842, 2503, 3171, 3836, 4500, 5164, 5816, 6470, 7109, 7744, 
-    8363, 8971, 9562, 10140, 10696, 11236, 11754, 12254, 12729, 13185, 13614, 14027, 14408, 14772, 15103, 15421, 
-    15703, 15967, 16199, 16411, 16594, 16753, 16885, 16993, 17075, 17132, 17165, 17176, 17163, 17128, 17070, 16994, 
-    16894, 16776, 16635, 16479, 16297, 16103, 15881, 15648, 15389, 15115, 14819, 14503, 14170, 13814, 13441, 13046, 
-    12635, 12200, 11753, 11285, 10805, 10305, 9797, 9274, 8743, 8200, 7654, 7100, 6544, 5982, 5424, 4862, 
-    4305, 3744, 3190, 2633, 2080, 1530, 977, 431, -121, -664, -1216, -1762, -2311, -2858, -3408, -3953, 
-    -4498, -5038, -5578, -6108, -6633, -7148, -7656, -8148, -8631, -9093, -9545, -9975, -10387, -10779, -11149, -11501, 
-    -11826, -12135, -12417, -12683, -12923, -13146, -13347, -13531, -13696, -13842, -13973, -14086, -14185, -14267, -14332, -14385, 
-    -14419, -14439, -14440, -14427, -14395, -14343, -14274, -14181, -14071, -13937, -13780, -13603, -13397, -13177, -12924, -12659, 
-    -12361, -12052, -11713, -11363, -10988, -10600, -10195, -9776, -9345, -8902, -8448, -7988, -7519, -7049, -6564, -6086, 
-    -5598, -5113, -4623, -4136, -3646, -3158, -2674, -2188, -1709, -1233, -760, -293, 168, 622, 1072, 1512, 
-    1945, 2370, 2788, 3197, 3595, 3988, 4369, 4746, 5111, 5471, 5820, 6162, 6496, 6820, 7139, 7443, 
-    7744, 8031, 8316, 8584, 8847, 9095, 9334, 9560, 9773, 9969, 10155, 10318, 10471, 10599, 10715, 10809, 
-    10885, 10940, 10977, 10994, 10994, 10970, 10934, 10872, 10802, 10707, 10600, 10473, 10336, 10183, 10015, 9838, 
-    9647, 9447, 9234, 9012, 8782, 8541, 8293, 8033, 7769, 7493, 7214, 6923, 6628, 6322, 6013, 5695, 
-    5371, 5041, 4705, 4362, 4013, 3660, 3297, 2931, 2559, 2180, 1799, 1409, 1022, 624, 233, -164, 
-    -555, -951, -1338, -1722, -2098, -2467, -2824, -3171, -3504, -3823, -4125, -4411, -4677, -4927, -5156, -5366, 
-    -5558, -5729, -5882, -6015, -6131, -6229, -6308, -6375, -6427, -6464, -6490, -6504, -6514, -6505, -6498, -6477, 
-    -6456, -6424, -6393, -6353, -6314, -6266, -6221, -6166, -6117, -6055, -5998, -5929, -5861, -5785, -5705, -5615, 
-    -5519, -5414, -5300, -5177, -5037, -4893, -4733, -4564, -4378, -4187, -3980, -3768, -3542, -3314, -3076, -2836, 
-    -2592, -2351, -2108, -1867, -1631, -1399, -1174, -956, -743, -541, -345, -162, 19, 186, 350, 508, 
-    656, 805, 942, 1087, 1218, 1357, 1492, 1630, 1765, 1906, 2044, 2189, 2329, 2475, 2618, 2763, 
-    2908, 3047, 3188, 3322, 3450, 3575, 3687, 3793, 3887, 3970, 4038, 4091, 4131, 4154, 4160, 4148, 
-    4121, 4077, 4016, 3941, 3851, 3747, 3630, 3504, 3367, 3223, 3073, 2917, 2757, 2596, 2432, 2272, 
-    2107, 1947, 1787, 1632, 1478, 1326, 1177, 1030, 887, 741, 604, 459, 326, 184, 51, -86, 
-    -219, -350, -482, -608, -734, -853, -974, -1083, -1193, -1291, -1391, -1476, -1562, -1637, -1708, -1772, 
-    -1828, -1880, -1922, -1963, -1994, -2022, -2042, -2058, -2069, -2075, -2074, -2071, -2061, -2050, -2030, -2011, 
-    -1985, -1958, -1924, -1888, -1847, -1804, -1753, -1703, -1643, -1585, -1517, -1446, -1370, -1289, -1202, -1111, 
-    -1016, -917, -813, -707, -596, -485, -372, -255, -140, -21, 91, 212, 325, 443, 553, 668, 
-    775, 887, 992, 1101, 1203, 1311, 1414, 1522, 1625, 1730, 1835, 1937, 2038, 2139, 2233, 2328, 
-    2412, 2495, 2565, 2630, 2686, 2729, 2765, 2786, 2799, 2801, 2791, 2774, 2744, 2711, 2670, 2619, 
-    2571, 2513, 2461, 2400, 2347, 2291, 2238, 2186, 2138, 2091, 2047, 2002, 1959, 1913, 1866, 1815, 
-    1758, 1695, 1627, 1546, 1457, 1357, 1246, 1124, 991, 848, 692, 530, 357, 180, -3, -189, 
-    -380, -570, -763, -948, -1136, -1316, -1496, -1665, -1831, -1987, -2139, -2282, -2420, -2547, -2671, -2786, 
-    -2899, -3001, -3101, -3195, -3287, -3373, -3456, -3537, -3614, -3684, -3756, -3816, -3881, -3927, -3981, -4014, 
-    -4052, -4074, -4091, -4098, -4096, -4084, -4066, -4030, -3993, -3936, -3877, -3800, -3715, -3622, -3513, -3398, 
-    -3271, -3137, -2994, -2839, -2682, -2515, -2343, -2167, -1981, -1796, -1602, -1410, -1211, -1012, -809, -605, 
-    -400, -193, 13, 219, 425, 632, 835, 1039, 1240, 1439, 1638, 1834, 2025, 2217, 2402, 2588, 
-    2764, 2939, 3110, 3273, 3434, 3585, 3735, 3873, 4009, 4136, 4258, 4369, 4477, 4573, 4665, 4747, 
-    4822, 4889, 4947, 4996, 5036, 5068, 5091, 5103, 5107, 5101, 5087, 5059, 5028, 4981, 4935, 4868, 
-    4805, 4724, 4644, 4549, 4455, 4348, 4240, 4125, 4005, 3881, 3750, 3617, 3478, 3336, 3189, 3039, 
-    2887, 2729, 2570, 2409, 2246, 2079, 1910, 1742, 1566, 1395, 1214, 1038, 849, 665, 471, 275, 
-    72, -132, -345, -562, -785, -1012, -1245, -1480, -1723, -1966, -2216, -2465, -2720, -2970, -3225, -3471, 
-    -3723, -3962, -4204, -4432, -4659, -4871, -5080, -5272, -5459, -5630, -5791, -5937, -6074, -6198, -6306, -6407, 
-    -6492, -6569, -6629, -6686, -6722, -6753, -6768, -6777, -6767, -6753, -6721, -6680, -6627, -6561, -6485, -6391, 
-    -6295, -6176, -6054, -5912, -5763, -5598, -5418, -5229, -5023, -4805, -4574, -4328, -4074, -3803, -3526, -3235, 
-    -2938, -2632, -2319, -2002, -1679, -1356, -1030, -707, -382, -65, 250, 558, 859, 1153, 1436, 1715, 
-    1978, 2238, 2483, 2730, 2957, 3191, 3407, 3631, 3839, 4057, 4260, 4473, 4673, 4882, 5078, 5281, 
-    5476, 5670, 5860, 6043, 6227, 6396, 6567, 6723, 6876, 7015, 7147, 7265, 7373, 7466, 7547, 7611, 
-    7667, 7698, 7724, 7726, 7720, 7691, 7654, 7597, 7526, 7440, 7342, 7228, 7102, 6963, 6816, 6654, 
-    6488, 6309, 6126, 5935, 5737, 5538, 5329, 5125, 4907, 4696, 4475, 4254, 4028, 3798, 3568, 3328, 
-    3085, 2836, 2580, 2316, 2043, 1765, 1474, 1179, 871, 556, 232, -99, -434, -782, -1131, -1488, 
-    -1843, -2205, -2561, -2923, -3276, -3631, -3976, -4317, -4650, -4975, -5289, -5592, -5886, -6164, -6431, -6684, 
-    -6922, -7147, -7355, -7551, -7729, -7896, -8044, -8181, -8298, -8405, -8495, -8571, -8634, -8683, -8719, -8741, 
-    -8753, -8751, -8737, -8712, -8674, -8624, -8563, -8489, -8402, -8301, -8189, -8060, -7920, -7760, -7591, -7402, 
-    -7201, -6981, -6748, -6500, -6235, -5957, -5667, -5360, -5046, -4713, -4382, -4030, -3682, -3319, -2958, -2589, 
-    -2223, -1853, -1485, -1118, -755, -397, -38, 309, 657, 995, 1332, 1657, 1980, 2294, 2608, 2905, 
-    3209, 3497, 3793, 4072, 4356, 4630, 4908, 5173, 5444, 5703, 5966, 6216, 6469, 6710, 6949, 7179, 
-    7400, 7615, 7814, 8009, 8184, 8351, 8500, 8636, 8753, 8858, 8941, 9010, 9058, 9092, 9107, 9106, 
-    9088, 9054, 9002, 8939, 8854, 8762, 8645, 8524, 8379, 8228, 8058, 7879, 7684, 7478, 7262, 7030, 
-    6793, 6539, 6280, 6009, 5730, 5441, 5142, 4843, 4527, 4213, 3883, 3553, 3211, 2869, 2516, 2157, 
-    1794, 1425, 1051, 669, 284, -103, -498, -894, -1295, -1694, -2095, -2495, -2888, -3281, -3663, -4040, 
-    -4404, -4760, -5101, -5427, -5738, -6034, -6309, -6569, -6807, -7027, -7226, -7409, -7571, -7712, -7842, -7948, 
-    -8046, -8118, -8188, -8234, -8276, -8300, -8319, -8324, -8323, -8309, -8291, -8261, -8223, -8176, -8119, -8055, 
-    -7976, -7890, -7788, -7678, -7552, -7416, -7263, -7102, -6922, -6735, -6531, -6319, -6094, -5858, -5614, -5357, 
-    -5096, -4824, -4549, -4267, -3978, -3688, -3393, -3096, -2794, -2494, -2190, -1885, -1576, -1267, -954, -639, 
-    -322, 1, 323, 654, 982, 1317, 1653, 1991, 2328, 2670, 3006, 3346, 3677, 4012, 4334, 4658, 
-    4967, 5276, 5566, 5858, 6128, 6399, 6644, 6891, 7114, 7331, 7529, 7716, 7890, 8046, 8189, 8316, 
-    8428, 8525, 8603, 8668, 8713, 8741, 8750, 8740, 8714, 8663, 8595, 8504, 8396, 8265, 8113, 7944, 
-    7754, 7545, 7320, 7080, 6825, 6555, 6277, 5984, 5687, 5378, 5066, 4744, 4422, 4093, 3767, 3432, 
-    3102, 2767, 2437, 2103, 1771, 1438, 1108, 778, 451, 121, -199, -527, -846, -1167, -1482, -1796, 
-    -2108, -2412, -2715, -3010, -3302, -3587, -3865, -4137, -4401, -4660, -4910, -5151, -5385, -5611, -5832, -6038, 
-    -6242, -6432, -6619, -6791, -6959, -7113, -7261, -7399, -7525, -7642, -7748, -7847, -7929, -8007, -8069, -8123, 
-    -8161, -8193, -8209, -8214, -8205, -8185, -8150, -8101, -8040, -7964, -7872, -7765, -7644, -7508, -7354, -7187, 
-    -7002, -6804, -6588, -6355, -6111, -5845, -5571, -5275, -4970, -4646, -4313, -3963, -3603, -3230, -2845, -2452, 
-    -2048, -1639, -1220, -799, -371, 60, 490, 926, 1357, 1789, 2214, 2640, 3055, 3467, 3870, 4264, 
-    4649, 5023, 5386, 5739, 6076, 6405, 6716, 7016, 7302, 7573, 7832, 8072, 8302, 8514, 8713, 8895, 
-    9064, 9213, 9350, 9467, 9574, 9660, 9734, 9787, 9830, 9854, 9859, 9853, 9826, 9788, 9725, 9653, 
-    9559, 9451, 9322, 9178, 9018, 8836, 8641, 8425, 8196, 7946, 7684, 7404, 7112, 6805, 6487, 6156, 
-    5817, 5466, 5110, 4747, 4377, 4004, 3627, 3251, 2867, 2487, 2105, 1722, 1339, 957, 575, 186, 
-    -196, -586, -975, -1371, -1764, -2165, -2566, -2971, -3375, -3783, -4188, -4593, -4996, -5393, -5782, -6168, 
-    -6539, -6904, -7249, -7585, -7901, -8202, -8482, -8746, -8991, -9216, -9423, -9614, -9786, -9943, -10084, -10214, 
-    -10328, -10433, -10525, -10608, -10683, -10747, -10804, -10849, -10888, -10912, -10928, -10930, -10916, -10888, -10839, -10779, 
-    -10687, -10586, -10453, -10302, -10123, -9925, -9699, -9450, -9178, -8884, -8567, -8231, -7875, -7504, -7114, -6714, 
-    -6296, -5872, -5433, -4991, -4539, -4084, -3621, -3155, -2685, -2210, -1736, -1254, -772, -287, 201, 690, 
-    1186, 1678, 2176, 2673, 3172, 3669, 4165, 4657, 5146, 5630, 6105, 6572, 7028, 7473, 7904, 8322, 
-    8721, 9105, 9469, 9817, 10143, 10450, 10737, 11002, 11251, 11473, 11685, 11866, 12038, 12182, 12318, 12425, 
-    12523, 12596, 12660, 12698, 12724, 12727, 12717, 12684, 12634, 12564, 12473, 12363, 12230, 12080, 11906, 11711, 
-    11496, 11259, 11003, 10722, 10426, 10109, 9773, 9419, 9052, 8667, 8268, 7856, 7436, 7001, 6558, 6110, 
-    5650, 5188, 4718, 4248, 3769, 3289, 2809, 2323, 1839, 1349, 861, 370, -123, -613, -1109, -1604, 
-    -2096, -2592, -3081, -3575, -4058, -4545, -5021, -5495, -5957, -6416, -6861, -7300, -7722, -8134, -8530, -8910, 
-    -9276, -9622, -9953, -10264, -10559, -10832, -11091, -11326, -11546, -11747, -11928, -12092, -12237, -12366, -12475, -12569, 
-    -12644, -12703, -12741, -12769, -12773, -12767, -12738, -12700, -12638, -12567, -12473, -12369, -12245, -12108, -11953, -11782, 
-    -11597, -11393, -11174, -10940, -10689, -10423, -10138, -9840, -9523, -9193, -8843, -8482, -8101, -7708, -7298, -6875, 
-    -6436, -5988, -5521, -5046, -4556, -4058, -3545, -3027, -2499, -1965, -1425, -879, -331, 219, 770, 1323, 
-    1874, 2424, 2969, 3512, 4049, 4581, 5105, 5621, 6132, 6631, 7123, 7599, 8069, 8524, 8969, 9396, 
-    9813, 10211, 10598, 10963, 11314, 11647, 11957, 12249, 12517, 12766, 12988, 13187, 13360, 13509, 13629, 13724, 
-    13790, 13828, 13840, 13820, 13778, 13701, 13606, 13479, 13331, 13157, 12962, 12747, 12509, 12255, 11984, 11694, 
-    11392, 11075, 10747, 10406, 10054, 9695, 9322, 8943, 8553, 8154, 7748, 7331, 6907, 6471, 6029, 5577, 
-    5116, 4646, 4169, 3684, 3190, 2691, 2186, 1679, 1167, 655, 143, -365, -871, -1373, -1867, -2353, 
-    -2831, -3297, -3754, -4196, -4628, -5044, -5447, -5839, -6213, -6580, -6928, -7270, -7595, -7916, -8219, -8522, 
-    -8808, -9093, -9361, -9634, -9885, -10140, -10377, -10613, -10830, -11045, -11240, -11429, -11598, -11755, -11891, -12015, 
-    -12115, -12197, -12260, -12301, -12316, -12314, -12287, -12238, -12163, -12069, -11949, -11813, -11648, -11466, -11262, -11041, 
-    -10794, -10535, -10254, -9958, -9644, -9315, -8972, -8612, -8242, -7856, -7460, -7050, -6632, -6200, -5761, -5311, 
-    -4853, -4389, -3915, -3435, -2952, -2462, -1968, -1471, -970, -472, 33, 530, 1035, 1530, 2025, 2513, 
-    2997, 3473, 3940, 4397, 4845, 5279, 5702, 6113, 6504, 6888, 7251, 7601, 7933, 8250, 8548, 8830, 
-    9095, 9339, 9565, 9772, 9963, 10129, 10279, 10408, 10519, 10606, 10677, 10728, 10758, 10771, 10763, 10742, 
-    10697, 10642, 10567, 10480, 10378, 10263, 10136, 9996, 9848, 9688, 9520, 9343, 9157, 8963, 8762, 8550, 
-    8332, 8102, 7869, 7618, 7365, 7095, 6819, 6529, 6230, 5920, 5599, 5269, 4929, 4582, 4224, 3863, 
-    3494, 3121, 2744, 2363, 1982, 1600, 1217, 833, 453, 72, -308, -685, -1063, -1436, -1813, -2186, 
-    -2559, -2932, -3304, -3676, -4045, -4415, -4782, -5147, -5510, -5865, -6221, -6560, -6902, -7222, -7543, -7839, 
-    -8129, -8396, -8649, -8880, -9093, -9281, -9450, -9592, -9714, -9809, -9881, -9932, -9955, -9960, -9939, -9902, 
-    -9839, -9759, -9663, -9545, -9416, -9266, -9110, -8933, -8748, -8550, -8340, -8121, -7889, -7651, -7397, -7139, 
-    -6866, -6587, -6298, -6000, -5695, -5380, -5059, -4731, -4395, -4059, -3712, -3364, -3013, -2657, -2301, -1943, 
-    -1585, -1225, -868, -511, -156, 197, 546, 894, 1239, 1578, 1915, 2248, 2575, 2901, 3217, 3534, 
-    3839, 4144, 4435, 4725, 5001, 5272, 5528, 5776, 6010, 6231, 6442, 6633, 6817, 6978, 7133, 7264, 
-    7386, 7489, 7582, 7656, 7718, 7766, 7802, 7823, 7833, 7830, 7817, 7792, 7759, 7712, 7658, 7593, 
-    7519, 7434, 7340, 7237, 7120, 6996, 6860, 6714, 6557, 6388, 6210, 6017, 5818, 5604, 5380, 5145, 
-    4901, 4649, 4383, 4116, 3833, 3556, 3259, 2972, 2668, 2375, 2069, 1773, 1469, 1174, 877, 586, 
-    297, 16, -263, -533, -804, -1063, -1323, -1574, -1824, -2068, -2310, -2551, -2790, -3027, -3262, -3498, 
-    -3732, -3963, -4197, -4423, -4653, -4870, -5094, -5298, -5509, -5698, -5888, -6058, -6221, -6364, -6498, -6609, 
-    -6706, -6783, -6841, -6880, -6901, -6902, -6885, -6850, -6802, -6732, -6655, -6558, -6457, -6336, -6214, -6078, 
-    -5939, -5790, -5638, -5477, -5316, -5148, -4976, -4798, -4616, -4431, -4239, -4043, -3841, -3634, -3420, -3200, 
-    -2976, -2741, -2503, -2257, -2006, -1748, -1484, -1220, -947, -676, -399, -125, 150, 425, 697, 965, 
-    1229, 1490, 1741, 1986, 2223, 2452, 2670, 2879, 3079, 3268, 3447, 3613, 3774, 3920, 4060, 4184, 
-    4307, 4414, 4516, 4608, 4691, 4769, 4834, 4897, 4949, 4996, 5032, 5064, 5086, 5103, 5108, 5110, 
-    5100, 5084, 5056, 5024, 4979, 4928, 4866, 4797, 4718, 4630, 4536, 4430, 4317, 4195, 4067, 3927, 
-    3784, 3628, 3471, 3302, 3133, 2952, 2772, 2581, 2390, 2195, 1995, 1793, 1587, 1384, 1177, 968, 
-    763, 555, 351, 147, -52, -251, -446, -637, -825, -1008, -1188, -1362, -1533, -1701, -1861, -2021, 
-    -2173, -2325, -2467, -2610, -2744, -2877, -3003, -3124, -3240, -3352, -3457, -3557, -3648, -3733, -3810, -3879, 
-    -3943, -3991, -4035, -4067, -4092, -4103, -4109, -4098, -4084, -4051, -4016, -3962, -3906, -3836, -3757, -3670, 
-    -3575, -3471, -3361, -3244, -3121, -2991, -2859, -2719, -2580, -2432, -2286, -2132, -1983, -1828, -1671, -1515, 
-    -1355, -1200, -1037, -881, -718, -560, -399, -238, -79, 82, 243, 406, 566, 729, 889, 1053, 
-    1211, 1373, 1529, 1686, 1838, 1990, 2137, 2282, 2422, 2558, 2689, 2817, 2937, 3054, 3163, 3266, 
-    3365, 3453, 3538, 3613, 3683, 3742, 3794, 3839, 3872, 3903, 3917, 3928, 3928, 3918, 3902, 3871, 
-    3839, 3789, 3740, 3674, 3608, 3526, 3446, 3349, 3255, 3147, 3038, 2921, 2804, 2675, 2549, 2416, 
-    2281, 2142, 1998, 1855, 1703, 1550, 1395, 1232, 1068, 896, 722, 540, 355, 167, -29, -227, 
-    -434, -638, -852, -1062, -1281, -1492, -1712, -1923, -2138, -2345, -2552, -2754, -2948, -3137, -3316, -3493, 
-    -3656, -3812, -3958, -4099, -4225, -4347, -4456, -4562, -4653, -4741, -4820, -4889, -4955, -5012, -5064, -5106, 
-    -5145, -5173, -5200, -5213, -5225, -5221, -5219, -5196, -5173, -5133, -5088, -5025, -4956, -4871, -4774, -4665, 
-    -4540, -4404, -4249, -4086, -3904, -3713, -3506, -3288, -3060, -2819, -2571, -2313, -2049, -1777, -1503, -1220, 
-    -940, -651, -370, -79, 205, 488, 769, 1051, 1326, 1599, 1866, 2133, 2391, 2648, 2899, 3144, 
-    3384, 3620, 3847, 4074, 4290, 4505, 4706, 4910, 5098, 5288, 5461, 5635, 5792, 5948, 6089, 6225, 
-    6347, 6463, 6565, 6659, 6740, 6812, 6873, 6921, 6958, 6984, 6999, 7001, 6990, 6968, 6935, 6889, 
-    6831, 6760, 6682, 6587, 6486, 6369, 6246, 6108, 5964, 5809, 5644, 5471, 5288, 5099, 4898, 4696, 
-    4480, 4260, 4033, 3803, 3562, 3318, 3068, 2816, 2551, 2291, 2017, 1746, 1463, 1183, 894, 605, 
-    306, 15, -291, -589, -900, -1202, -1517, -1822, -2136, -2442, -2754, -3059, -3364, -3666, -3962, -4259, 
-    -4545, -4830, -5106, -5375, -5637, -5892, -6137, -6375, -6601, -6820, -7026, -7224, -7411, -7585, -7749, -7898, 
-    -8038, -8163, -8276, -8374, -8456, -8528, -8580, -8622, -8640, -8650, -8636, -8614, -8567, -8511, -8430, -8342, 
-    -8230, -8110, -7969, -7820, -7651, -7476, -7284, -7084, -6870, -6650, -6421, -6182, -5934, -5683, -5419, -5154, 
-    -4876, -4598, -4307, -4015, -3711, -3407, -3091, -2775, -2448, -2119, -1780, -1442, -1096, -747, -393, -40, 
-    315, 671, 1028, 1383, 1734, 2084, 2429, 2769, 3103, 3430, 3751, 4062, 4368, 4663, 4952, 5229, 
-    5500, 5761, 6013, 6259, 6493, 6722, 6939, 7150, 7352, 7542, 7728, 7898, 8064, 8212, 8357, 8481, 
-    8600, 8699, 8788, 8859, 8919, 8957, 8985, 8993, 8986, 8962, 8922, 8867, 8795, 8711, 8611, 8499, 
-    8374, 8238, 8090, 7934, 7765, 7595, 7406, 7221, 7020, 6820, 6606, 6392, 6167, 5940, 5701, 5464, 
-    5207, 4956, 4685, 4419, 4131, 3844, 3543, 3237, 2915, 2593, 2254, 1915, 1559, 1207, 838, 474, 
-    95, -274, -656, -1029, -1412, -1782, -2156, -2518, -2881, -3229, -3575, -3904, -4229, -4533, -4836, -5114, 
-    -5389, -5641, -5886, -6113, -6329, -6530, -6718, -6894, -7059, -7211, -7353, -7486, -7608, -7724, -7825, -7926, 
-    -8010, -8096, -8163, -8230, -8282, -8331, -8365, -8394, -8407, -8416, -8405, -8389, -8354, -8306, -8245, -8166, 
-    -8077, -7964, -7841, -7700, -7541, -7372, -7176, -6981, -6755, -6532, -6280, -6031, -5759, -5486, -5198, -4909, 
-    -4608, -4304, -3994, -3684, -3370, -3052, -2738, -2419, -2107, -1786, -1477, -1160, -853, -541, -235, 71, 
-    374, 673, 975, 1269, 1566, 1854, 2146, 2431, 2715, 2994, 3268, 3540, 3804, 4066, 4316, 4566, 
-    4802, 5034, 5254, 5468, 5667, 5858, 6033, 6200, 6350, 6490, 6612, 6723, 6818, 6901, 6966, 7020, 
-    7058, 7084, 7096, 7096, 7084, 7060, 7027, 6981, 6926, 6865, 6791, 6714, 6623, 6532, 6428, 6322, 
-    6204, 6085, 5955, 5820, 5678, 5529, 5374, 5210, 5040, 4862, 4679, 4485, 4284, 4078, 3865, 3643, 
-    3414, 3180, 2941, 2694, 2444, 2189, 1931, 1670, 1405, 1140, 871, 603, 335, 64, -202, -471, 
-    -740, -1003, -1271, -1530, -1796, -2048, -2308, -2559, -2808, -3053, -3292, -3530, -3759, -3983, -4199, -4409, 
-    -4609, -4800, -4981, -5151, -5310, -5454, -5588, -5705, -5811, -5899, -5974, -6031, -6075, -6101, -6113, -6108, 
-    -6088, -6055, -6003, -5943, -5864, -5779, -5675, -5569, -5444, -5318, -5176, -5034, -4876, -4718, -4549, -4379, 
-    -4200, -4016, -3828, -3633, -3437, -3232, -3024, -2811, -2593, -2372, -2144, -1913, -1679, -1441, -1198, -954, 
-    -708, -458, -211, 39, 285, 536, 776, 1021, 1256, 1493, 1717, 1944, 2159, 2370, 2574, 2770, 
-    2962, 3140, 3317, 3483, 3641, 3793, 3934, 4072, 4197, 4317, 4427, 4530, 4625, 4712, 4787, 4858, 
-    4918, 4969, 5011, 5045, 5068, 5082, 5084, 5081, 5062, 5037, 4996, 4949, 4889, 4820, 4738, 4645, 
-    4545, 4434, 4311, 4182, 4042, 3899, 3741, 3584, 3412, 3244, 3066, 2883, 2699, 2509, 2324, 2127, 
-    1940, 1740, 1550, 1352, 1161, 961, 768, 568, 373, 170, -28, -232, -436, -642, -849, -1060, 
-    -1271, -1483, -1697, -1910, -2123, -2336, -2549, -2759, -2966, -3169, -3373, -3567, -3759, -3943, -4123, -4294, 
-    -4456, -4611, -4759, -4896, -5024, -5143, -5252, -5352, -5438, -5521, -5585, -5647, -5690, -5731, -5756, -5774, 
-    -5778, -5776, -5761, -5737, -5699, -5654, -5596, -5530, -5449, -5360, -5258, -5150, -5024, -4893, -4749, -4593, 
-    -4431, -4252, -4072, -3871, -3672, -3456, -3240, -3006, -2773, -2528, -2278, -2022, -1760, -1494, -1222, -948, 
-    -668, -390, -104, 179, 467, 755, 1040, 1333, 1617, 1909, 2189, 2478, 2757, 3038, 3311, 3585, 
-    3850, 4112, 4364, 4615, 4853, 5084, 5306, 5517, 5718, 5906, 6084, 6249, 6397, 6536, 6656, 6767, 
-    6858, 6940, 7003, 7055, 7092, 7118, 7129, 7131, 7120, 7101, 7068, 7032, 6981, 6928, 6864, 6796, 
-    6721, 6635, 6549, 6451, 6349, 6236, 6118, 5991, 5855, 5708, 5554, 5387, 5209, 5023, 4822, 4613, 
-    4387, 4159, 3910, 3658, 3392, 3118, 2837, 2546, 2253, 1950, 1648, 1340, 1035, 723, 419, 112, 
-    -187, -490, -781, -1075, -1357, -1641, -1914, -2186, -2448, -2712, -2965, -3218, -3462, -3710, -3947, -4188, 
-    -4421, -4655, -4884, -5116, -5339, -5564, -5783, -6001, -6215, -6420, -6624, -6816, -7006, -7182, -7351, -7510, 
-    -7653, -7787, -7906, -8011, -8098, -8174, -8230, -8268, -8292, -8299, -8287, -8259, -8214, -8152, -8074, -7986, 
-    -7876, -7759, -7623, -7480, -7322, -7155, -6978, -6789, -6594, -6389, -6175, -5955, -5723, -5489, -5238, -4990, 
-    -4725, -4460, -4180, -3897, -3605, -3306, -3002, -2688, -2372, -2047, -1720, -1386, -1051, -711, -373, -28, 
-    309, 655, 989, 1330, 1661, 1993, 2315, 2635, 2947, 3254, 3551, 3844, 4125, 4401, 4667, 4926, 
-    5176, 5418, 5650, 5874, 6088, 6297, 6492, 6681, 6859, 7030, 7188, 7338, 7477, 7606, 7724, 7832, 
-    7928, 8011, 8084, 8143, 8192, 8225, 8250, 8255, 8254, 8233, 8206, 8158, 8105, 8033, 7954, 7858, 
-    7755, 7638, 7512, 7374, 7228, 7072, 6905, 6733, 6549, 6359, 6158, 5954, 5736, 5515, 5282, 5047, 
-    4799, 4550, 4287, 4026, 3751, 3478, 3192, 2909, 2614, 2322, 2023, 1723, 1423, 1119, 818, 514, 
-    213, -86, -385, -680, -979, -1263, -1559, -1838, -2128, -2398, -2681, -2948, -3219, -3479, -3742, -3994, 
-    -4246, -4488, -4730, -4959, -5186, -5402, -5614, -5813, -6008, -6187, -6359, -6517, -6666, -6800, -6921, -7028, 
-    -7124, -7202, -7268, -7320, -7356, -7379, -7388, -7383, -7364, -7334, -7291, -7235, -7167, -7091, -7001, -6904, 
-    -6797, -6681, -6556, -6424, -6286, -6136, -5983, -5819, -5654, -5475, -5294, -5105, -4908, -4706, -4494, -4280, 
-    -4056, -3828, -3592, -3351, -3105, -2854, -2598, -2337, -2076, -1809, -1544, -1271, -1007, -735, -469, -202, 
-    58, 318, 573, 823, 1066, 1307, 1536, 1764, 1980, 2191, 2391, 2585, 2771, 2947, 3116, 3274, 
-    3425, 3569, 3705, 3832, 3950, 4067, 4170, 4271, 4363, 4451, 4533, 4607, 4679, 4743, 4806, 4862, 
-    4912, 4958, 4999, 5037, 5067, 5091, 5112, 5122, 5130, 5125, 5118, 5098, 5072, 5033, 4989, 4932, 
-    4868, 4789, 4706, 4608, 4505, 4388, 4266, 4134, 3993, 3846, 3692, 3533, 3367, 3199, 3024, 2847, 
-    2668, 2486, 2302, 2116, 1931, 1747, 1557, 1373, 1182, 1001, 812, 629, 440, 262, 78, -101, 
-    -281, -458, -632, -804, -973, -1140, -1300, -1458, -1608, -1760, -1895, -2038, -2159, -2288, -2397, -2510, 
-    -2605, -2701, -2780, -2859, -2922, -2984, -3028, -3073, -3097, -3126, -3132, -3143, -3130, -3124, -3096, -3071, 
-    -3029, -2987, -2933, -2876, -2810, -2741, -2666, -2586, -2502, -2414, -2323, -2227, -2129, -2028, -1922, -1816, 
-    -1706, -1594, -1479, -1360, -1243, -1115, -996, -865, -738, -608, -475, -346, -210, -81, 51, 182, 
-    308, 436, 557, 678, 793, 902, 1013, 1110, 1214, 1300, 1396, 1473, 1559, 1629, 1707, 1771, 
-    1841, 1902, 1963, 2018, 2074, 2127, 2174, 2219, 2263, 2301, 2336, 2364, 2388, 2406, 2420, 2421, 
-    2422, 2408, 2394, 2365, 2331, 2289, 2234, 2179, 2108, 2037, 1951, 1863, 1766, 1662, 1553, 1435, 
-    1317, 1186, 1059, 916, 779, 630, 482, 325, 170, 7, -154, -322, -487, -659, -825, -996, 
-    -1163, -1330, -1492, -1656, -1810, -1963, -2109, -2253, -2386, -2516, -2638, -2753, -2862, -2963, -3056, -3144, 
-    -3225, -3301, -3366, -3430, -3487, -3539, -3584, -3626, -3661, -3694, -3718, -3741, -3757, -3766, -3775, -3772, 
-    -3770, -3755, -3741, -3713, -3686, -3647, -3604, -3551, -3496, -3429, -3356, -3279, -3192, -3103, -3000, -2900, 
-    -2785, -2675, -2550, -2426, -2294, -2160, -2019, -1876, -1727, -1576, -1418, -1260, -1096, -930, -756, -586, 
-    -405, -228, -39, 142, 336, 527, 725, 921, 1122, 1323, 1527, 1732, 1936, 2145, 2346, 2556, 
-    2755, 2959, 3156, 3355, 3546, 3736, 3920, 4103, 4275, 4446, 4608, 4768, 4915, 5061, 5194, 5325, 
-    5444, 5555, 5657, 5752, 5836, 5912, 5976, 6035, 6079, 6115, 6142, 6156, 6162, 6155, 6139, 6111, 
-    6071, 6022, 5959, 5888, 5803, 5712, 5604, 5493, 5365, 5235, 5090, 4941, 4781, 4616, 4444, 4267, 
-    4085, 3895, 3706, 3508, 3314, 3109, 2908, 2702, 2495, 2285, 2073, 1863, 1646, 1430, 1209, 989, 
-    763, 536, 304, 71, -167, -405, -652, -895, -1147, -1395, -1649, -1899, -2153, -2404, -2652, -2900, 
-    -3141, -3382, -3615, -3844, -4066, -4282, -4491, -4692, -4886, -5071, -5252, -5419, -5584, -5734, -5885, -6020, 
-    -6152, -6274, -6389, -6495, -6593, -6685, -6763, -6838, -6897, -6954, -6992, -7024, -7045, -7052, -7049, -7030, 
-    -7002, -6960, -6902, -6835, -6752, -6658, -6551, -6431, -6300, -6157, -6005, -5843, -5670, -5489, -5301, -5103, 
-    -4903, -4691, -4479, -4257, -4035, -3803, -3572, -3333, -3094, -2847, -2601, -2348, -2096, -1838, -1580, -1313, 
-    -1053, -785, -517, -246, 22, 292, 565, 833, 1102, 1368, 1632, 1890, 2148, 2399, 2646, 2885, 
-    3122, 3348, 3572, 3784, 3991, 4189, 4380, 4560, 4735, 4897, 5055, 5198, 5339, 5464, 5587, 5694, 
-    5798, 5889, 5975, 6051, 6117, 6178, 6228, 6273, 6306, 6336, 6355, 6366, 6371, 6367, 6356, 6334, 
-    6309, 6271, 6229, 6174, 6115, 6041, 5964, 5873, 5777, 5667, 5551, 5423, 5288, 5142, 4986, 4822, 
-    4648, 4467, 4274, 4077, 3867, 3655, 3431, 3204, 2968, 2729, 2482, 2231, 1979, 1721, 1461, 1197, 
-    936, 672, 411, 148, -108, -369, -620, -872, -1116, -1362, -1597, -1830, -2054, -2278, -2492, -2700, 
-    -2904, -3099, -3292, -3474, -3652, -3820, -3984, -4140, -4288, -4426, -4558, -4681, -4794, -4897, -4988, -5076, 
-    -5142, -5207, -5251, -5293, -5313, -5328, -5325, -5318, -5288, -5257, -5206, -5151, -5079, -5003, -4914, -4818, 
-    -4711, -4600, -4479, -4355, -4220, -4087, -3940, -3797, -3644, -3491, -3332, -3171, -3007, -2840, -2671, -2496, 
-    -2325, -2144, -1968, -1783, -1604, -1416, -1230, -1044, -853, -667, -474, -287, -97, 88, 274, 460, 
-    641, 822, 999, 1174, 1345, 1513, 1678, 1839, 1996, 2149, 2299, 2445, 2586, 2723, 2859, 2986, 
-    3113, 3231, 3351, 3459, 3566, 3666, 3761, 3849, 3931, 4005, 4073, 4132, 4182, 4224, 4257, 4280, 
-    4293, 4295, 4288, 4269, 4241, 4204, 4154, 4095, 4026, 3949, 3861, 3766, 3658, 3548, 3424, 3300, 
-    3160, 3020, 2868, 2716, 2552, 2387, 2211, 2037, 1852, 1666, 1472, 1278, 1075, 873, 663, 457, 
-    242, 28, -186, -402, -618, -835, -1049, -1260, -1472, -1676, -1881, -2075, -2269, -2454, -2634, -2806, 
-    -2970, -3129, -3276, -3419, -3553, -3678, -3794, -3905, -4007, -4098, -4185, -4265, -4336, -4399, -4456, -4507, 
-    -4549, -4588, -4614, -4640, -4653, -4665, -4663, -4659, -4643, -4621, -4590, -4548, -4500, -4440, -4371, -4291, 
-    -4205, -4104, -3998, -3878, -3752, -3615, -3471, -3319, -3157, -2993, -2818, -2643, -2457, -2273, -2082, -1891, 
-    -1695, -1499, -1303, -1104, -905, -707, -508, -307, -110, 93, 288, 497, 692, 902, 1102, 1314, 
-    1519, 1733, 1944, 2160, 2374, 2594, 2811, 3032, 3247, 3470, 3683, 3899, 4111, 4318, 4522, 4717, 
-    4909, 5092, 5267, 5434, 5590, 5738, 5873, 5999, 6112, 6212, 6304, 6379, 6447, 6496, 6541, 6566, 
-    6585, 6587, 6580, 6561, 6528, 6487, 6432, 6367, 6289, 6201, 6104, 5993, 5875, 5743, 5606, 5454, 
-    5296, 5126, 4949, 4762, 4566, 4364, 4149, 3929, 3701, 3465, 3222, 2968, 2714, 2446, 2178, 1898, 
-    1617, 1329, 1037, 739, 438, 134, -171, -479, -787, -1099, -1404, -1714, -2014, -2317, -2610, -2904, 
-    -3184, -3462, -3730, -3991, -4241, -4480, -4713, -4932, -5145, -5342, -5534, -5712, -5886, -6045, -6200, -6342, 
-    -6479, -6606, -6728, -6842, -6946, -7047, -7136, -7222, -7298, -7368, -7427, -7480, -7523, -7557, -7579, -7596, 
-    -7596, -7590, -7569, -7539, -7492, -7441, -7370, -7290, -7196, -7092, -6974, -6843, -6703, -6548, -6385, -6208, 
-    -6022, -5826, -5618, -5404, -5175, -4943, -4701, -4448, -4191, -3923, -3653, -3371, -3088, -2792, -2498, -2194, 
-    -1889, -1576, -1260, -942, -619, -296, 30, 359, 686, 1017, 1347, 1675, 2003, 2328, 2653, 2974, 
-    3289, 3604, 3910, 4213, 4506, 4795, 5074, 5344, 5606, 5855, 6098, 6324, 6543, 6746, 6941, 7119, 
-    7285, 7441, 7578, 7709, 7819, 7925, 8009, 8089, 8150, 8206, 8241, 8275, 8289, 8303, 8295, 8285, 
-    8260, 8230, 8186, 8135, 8073, 8000, 7921, 7828, 7729, 7614, 7495, 7360, 7218, 7064, 6899, 6723, 
-    6536, 6339, 6129, 5910, 5678, 5438, 5183, 4924, 4650, 4370, 4079, 3783, 3477, 3163, 2848, 2522, 
-    2196, 1862, 1530, 1192, 856, 518, 183, -150, -484, -812, -1139, -1458, -1779, -2087, -2398, -2696, 
-    -2994, -3281, -3566, -3844, -4116, -4380, -4642, -4892, -5143, -5378, -5615, -5839, -6059, -6268, -6469, -6663, 
-    -6844, -7016, -7177, -7327, -7464, -7585, -7697, -7792, -7876, -7941, -7995, -8031, -8053, -8060, -8051, -8031, 
-    -7992, -7943, -7879, -7804, -7716, -7614, -7506, -7383, -7254, -7112, -6965, -6808, -6644, -6471, -6293, -6105, 
-    -5914, -5713, -5509, -5294, -5080, -4854, -4626, -4388, -4151, -3902, -3654, -3396, -3138, -2873, -2605, -2333, 
-    -2061, -1783, -1505, -1219, -941, -652, -370, -80, 204, 493, 777, 1064, 1347, 1630, 1910, 2187, 
-    2461, 2731, 2997, 3257, 3513, 3761, 4005, 4236, 4464, 4681, 4888, 5085, 5271, 5447, 5611, 5763, 
-    5903, 6030, 6145, 6248, 6337, 6418, 6482, 6538, 6579, 6613, 6634, 6645, 6647, 6636, 6621, 6592, 
-    6558, 6510, 6461, 6397, 6329, 6249, 6164, 6068, 5964, 5851, 5728, 5598, 5458, 5307, 5152, 4982, 
-    4811, 4622, 4434, 4229, 4028, 3812, 3595, 3367, 3141, 2908, 2673, 2434, 2196, 1953, 1714, 1473, 
-    1234, 994, 759, 522, 292, 60, -166, -392, -613, -832, -1049, -1260, -1473, -1678, -1884, -2083, 
-    -2282, -2473, -2664, -2849, -3030, -3207, -3379, -3544, -3703, -3857, -4003, -4142, -4273, -4395, -4508, -4614, 
-    -4707, -4795, -4864, -4935, -4982, -5031, -5058, -5083, -5092, -5094, -5085, -5064, -5036, -4998, -4952, -4893, 
-    -4831, -4756, -4679, -4589, -4492, -4392, -4280, -4166, -4039, -3913, -3775, -3633, -3484, -3329, -3171, -3002, 
-    -2833, -2653, -2474, -2287, -2097, -1900, -1705, -1501, -1299, -1092, -887, -678, -469, -263, -55, 150, 
-    354, 557, 755, 952, 1144, 1333, 1518, 1695, 1873, 2039, 2204, 2359, 2511, 2654, 2792, 2920, 
-    3043, 3157, 3265, 3363, 3453, 3538, 3610, 3678, 3735, 3785, 3826, 3861, 3884, 3904, 3912, 3916, 
-    3912, 3901, 3883, 3859, 3831, 3794, 3753, 3707, 3655, 3597, 3538, 3468, 3397, 3319, 3237, 3149, 
-    3055, 2957, 2850, 2742, 2623, 2501, 2370, 2238, 2093, 1949, 1793, 1635, 1470, 1301, 1127, 948, 
-    767, 582, 397, 207, 20, -170, -358, -544, -731, -911, -1095, -1269, -1443, -1612, -1776, -1938, 
-    -2092, -2245, -2389, -2532, -2668, -2799, -2926, -3048, -3166, -3277, -3386, -3486, -3586, -3676, -3764, -3844, 
-    -3920, -3986, -4051, -4102, -4151, -4186, -4221, -4237, -4254, -4254, -4249, -4234, -4208, -4175, -4130, -4079, 
-    -4016, -3947, -3868, -3780, -3687, -3582, -3475, -3356, -3234, -3103, -2971, -2827, -2685, -2530, -2380, -2217, 
-    -2056, -1889, -1719, -1547, -1370, -1194, -1010, -829, -640, -454, -263, -71, 121, 316, 512, 711, 
-    907, 1106, 1304, 1504, 1702, 1896, 2094, 2288, 2482, 2668, 2858, 3038, 3222, 3392, 3566, 3730, 
-    3889, 4043, 4188, 4330, 4460, 4585, 4700, 4810, 4909, 5000, 5082, 5156, 5222, 5277, 5323, 5362, 
-    5391, 5413, 5421, 5426, 5419, 5406, 5380, 5352, 5309, 5264, 5205, 5141, 5068, 4988, 4899, 4799, 
-    4695, 4581, 4459, 4327, 4191, 4043, 3893, 3727, 3564, 3385, 3206, 3016, 2824, 2623, 2420, 2210, 
-    1996, 1779, 1558, 1334, 1108, 882, 652, 421, 192, -37, -264, -494, -718, -943, -1164, -1384, 
-    -1599, -1811, -2022, -2230, -2431, -2632, -2827, -3021, -3208, -3393, -3574, -3751, -3924, -4092, -4255, -4415, 
-    -4569, -4717, -4860, -4997, -5127, -5248, -5365, -5472, -5573, -5660, -5745, -5813, -5880, -5927, -5974, -6001, 
-    -6027, -6035, -6038, -6028, -6009, -5980, -5942, -5894, -5838, -5768, -5698, -5609, -5523, -5416, -5315, -5192, 
-    -5074, -4935, -4801, -4650, -4498, -4335, -4166, -3991, -3808, -3621, -3425, -3228, -3020, -2814, -2595, -2384, 
-    -2156, -1937, -1706, -1481, -1248, -1018, -785, -555, -322, -91, 139, 368, 593, 822, 1045, 1268, 
-    1486, 1707, 1922, 2135, 2345, 2553, 2755, 2958, 3150, 3346, 3528, 3714, 3887, 4060, 4218, 4376, 
-    4523, 4664, 4794, 4916, 5032, 5133, 5231, 5314, 5392, 5457, 5516, 5564, 5605, 5637, 5661, 5677, 
-    5685, 5689, 5680, 5672, 5648, 5625, 5589, 5554, 5504, 5452, 5391, 5324, 5248, 5166, 5074, 4974, 
-    4865, 4750, 4623, 4489, 4346, 4193, 4035, 3865, 3692, 3506, 3321, 3121, 2925, 2719, 2512, 2301, 
-    2086, 1873, 1657, 1443, 1227, 1014, 803, 593, 383, 181, -23, -220, -420, -610, -805, -989, 
-    -1177, -1355, -1536, -1708, -1884, -2049, -2217, -2373, -2536, -2684, -2837, -2977, -3119, -3251, -3379, -3501, 
-    -3617, -3726, -3829, -3925, -4012, -4094, -4166, -4233, -4290, -4341, -4381, -4416, -4443, -4460, -4472, -4474, 
-    -4471, -4457, -4443, -4413, -4384, -4343, -4299, -4247, -4190, -4127, -4056, -3984, -3903, -3817, -3728, -3632, 
-    -3533, -3428, -3319, -3207, -3088, -2969, -2842, -2717, -2584, -2448, -2312, -2170, -2029, -1882, -1736, -1585, 
-    -1435, -1283, -1129, -975, -817, -664, -506, -352, -193, -40, 117, 268, 424, 571, 724, 869, 
-    1014, 1155, 1294, 1428, 1559, 1687, 1806, 1924, 2035, 2143, 2241, 2338, 2427, 2509, 2584, 2655, 
-    2718, 2777, 2827, 2872, 2910, 2943, 2970, 2988, 3006, 3012, 3020, 3014, 3011, 2996, 2981, 2960, 
-    2930, 2902, 2860, 2824, 2772, 2726, 2664, 2608, 2539, 2472, 2394, 2318, 2234, 2148, 2057, 1962, 
-    1867, 1765, 1668, 1556, 1458, 1344, 1242, 1127, 1021, 909, 802, 690, 585, 476, 371, 264, 
-    162, 61, -38, -136, -233, -325, -419, -508, -598, -682, -767, -848, -928, -1005, -1078, -1154, 
-    -1219, -1291, -1350, -1418, -1472, -1531, -1580, -1634, -1676, -1723, -1757, -1798, -1824, -1855, -1876, -1897, 
-    -1911, -1922, -1928, -1930, -1926, -1920, -1908, -1892, -1870, -1846, -1816, -1781, -1743, -1701, -1651, -1603, 
-    -1544, -1488, -1421, -1357, -1283, -1212, -1133, -1053, -969, -883, -795, -704, -610, -517, -419, -322, 
-    -222, -124, -22, 80, 181, 282, 386, 485, 591, 686, 789, 887, 986, 1079, 1175, 1266, 
-    1358, 1442, 1531, 1611, 1691, 1769, 1840, 1911, 1975, 2040, 2096, 2150, 2199, 2245, 2284, 2321, 
-    2351, 2376, 2396, 2411, 2422, 2423, 2423, 2413, 2401, 2377, 2353, 2317, 2280, 2231, 2181, 2120, 
-    2055, 1982, 1905, 1821, 1731, 1636, 1537, 1433, 1323, 1210, 1095, 976, 852, 730, 601, 477, 
-    343, 217, 84, -42, -176, -303, -435, -560, -688, -812, -935, -1057, -1174, -1292, -1404, -1516, 
-    -1621, -1726, -1824, -1924, -2012, -2102, -2184, -2265, -2340, -2408, -2477, -2536, -2593, -2643, -2694, -2735, 
-    -2775, -2807, -2839, -2865, -2888, -2904, -2919, -2930, -2936, -2939, -2939, -2934, -2927, -2917, -2903, -2884, 
-    -2863, -2838, -2810, -2776, -2742, -2701, -2656, -2609, -2556, -2500, -2435, -2373, -2300, -2227, -2143, -2061, 
-    -1969, -1875, -1774, -1670, -1561, -1444, -1326, -1202, -1075, -941, -804, -665, -521, -374, -224, -73, 
-    81, 235, 394, 550, 707, 866, 1022, 1178, 1332, 1485, 1636, 1781, 1929, 2068, 2208, 2339, 
-    2471, 2594, 2718, 2832, 2946, 3051, 3155, 3250, 3343, 3430, 3512, 3587, 3659, 3721, 3783, 3832, 
-    3879, 3919, 3950, 3976, 3991, 4002, 4005, 3997, 3984, 3960, 3931, 3891, 3845, 3789, 3728, 3656, 
-    3580, 3496, 3405, 3310, 3206, 3102, 2987, 2873, 2753, 2631, 2506, 2377, 2248, 2116, 1982, 1848, 
-    1712, 1573, 1436, 1296, 1156, 1015, 872, 731, 588, 442, 298, 153, 11, -138, -280, -427, 
-    -570, -715, -857, -999, -1139, -1277, -1413, -1548, -1677, -1808, -1931, -2056, -2175, -2292, -2406, -2515, 
-    -2624, -2727, -2829, -2926, -3021, -3112, -3199, -3284, -3365, -3443, -3516, -3586, -3649, -3713, -3767, -3821, 
-    -3865, -3908, -3941, -3973, -3993, -4011, -4018, -4024, -4017, -4007, -3987, -3963, -3927, -3888, -3838, -3785, 
-    -3719, -3651, -3572, -3491, -3399, -3302, -3201, -3090, -2978, -2856, -2734, -2602, -2469, -2328, -2188, -2038, 
-    -1889, -1733, -1577, -1416, -1253, -1088, -920, -752, -580, -410, -238, -65, 104, 277, 445, 615, 
-    780, 943, 1107, 1261, 1419, 1567, 1716, 1857, 1997, 2131, 2262, 2385, 2507, 2623, 2737, 2841, 
-    2947, 3042, 3138, 3226, 3309, 3388, 3461, 3531, 3592, 3649, 3700, 3744, 3784, 3816, 3841, 3859, 
-    3872, 3876, 3874, 3864, 3847, 3825, 3792, 3758, 3711, 3663, 3604, 3543, 3475, 3399, 3322, 3236, 
-    3149, 3054, 2959, 2857, 2751, 2642, 2533, 2417, 2299, 2179, 2058, 1933, 1807, 1678, 1548, 1417, 
-    1285, 1152, 1015, 880, 744, 606, 469, 330, 194, 53, -83, -222, -358, -496, -632, -767, 
-    -900, -1035, -1165, -1296, -1423, -1551, -1674, -1797, -1916, -2033, -2147, -2261, -2366, -2473, -2572, -2673, 
-    -2764, -2857, -2940, -3024, -3099, -3175, -3238, -3302, -3358, -3410, -3453, -3494, -3525, -3555, -3570, -3590, 
-    -3592, -3598, -3588, -3579, -3559, -3533, -3502, -3465, -3421, -3368, -3315, -3250, -3186, -3106, -3032, -2945, 
-    -2855, -2760, -2660, -2556, -2444, -2332, -2211, -2091, -1962, -1833, -1700, -1560, -1424, -1276, -1135, -982, 
-    -837, -681, -531, -376, -220, -65, 91, 245, 402, 557, 710, 864, 1013, 1166, 1310, 1458, 
-    1598, 1739, 1874, 2006, 2135, 2258, 2378, 2491, 2602, 2705, 2804, 2897, 2984, 3064, 3139, 3208, 
-    3269, 3324, 3373, 3415, 3451, 3479, 3502, 3518, 3528, 3529, 3528, 3516, 3502, 3478, 3452, 3416, 
-    3375, 3329, 3277, 3219, 3153, 3083, 3009, 2927, 2843, 2749, 2657, 2555, 2452, 2342, 2232, 2114, 
-    1998, 1876, 1755, 1627, 1502, 1373, 1244, 1115, 985, 852, 725, 592, 464, 331, 207, 75, 
-    -51, -180, -305, -432, -558, -682, -808, -929, -1054, -1173, -1296, -1413, -1531, -1647, -1759, -1875, 
-    -1977, -2091, -2190, -2294, -2389, -2484, -2574, -2659, -2741, -2819, -2890, -2960, -3020, -3081, -3130, -3180, 
-    -3217, -3258, -3283, -3311, -3325, -3340, -3345, -3345, -3338, -3325, -3306, -3282, -3251, -3214, -3172, -3124, 
-    -3069, -3013, -2945, -2880, -2800, -2726, -2637, -2555, -2456, -2365, -2262, -2161, -2051, -1944, -1828, -1716, 
-    -1595, -1477, -1354, -1228, -1105, -976, -849, -718, -588, -459, -326, -196, -63, 63, 196, 323, 
-    452, 577, 704, 825, 947, 1066, 1185, 1297, 1412, 1517, 1629, 1726, 1833, 1924, 2024, 2110, 
-    2201, 2282, 2367, 2440, 2517, 2582, 2654, 2710, 2773, 2823, 2876, 2918, 2963, 2994, 3030, 3053, 
-    3077, 3091, 3104, 3108, 3110, 3104, 3095, 3078, 3057, 3032, 2999, 2961, 2919, 2872, 2818, 2760, 
-    2697, 2629, 2558, 2478, 2401, 2311, 2227, 2131, 2040, 1939, 1839, 1735, 1633, 1521, 1416, 1303, 
-    1196, 1079, 973, 852, 749, 620, 529, 
-};
-const unsigned int drum_v1_p2_long_len = 10471;
@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v1_p2_short[] PROGMEM = {
-    34, -13, 19, 15, 28, 28, 32, 30, 28, 22, 21, 9, 8, -6, -8, -23, 
-    -27, -44, -48, -65, -71, -91, -96, -116, -124, -143, -155, -173, -188, -204, -222, -238, 
-    -259, -275, -294, -312, -331, -350, -367, -386, -404, -422, -440, -455, -474, -488, -506, -519, 
-    -536, -548, -566, -575, -591, -601, -617, -627, -639, -652, -662, -677, -685, -700, -709, -722, 
-    -732, -746, -757, -769, -780, -794, -804, -817, -828, -839, -851, -861, -872, -882, -892, -900, 
-    -908, -917, -922, -930, -930, -940, -938, -944, -940, -945, -941, -940, -935, -934, -927, -923, 
-    -915, -910, -899, -893, -879, -874, -857, -850, -834, -823, -808, -794, -778, -762, -743, -727, 
-    -706, -688, -663, -644, -621, -600, -571, -551, -522, -502, -471, -447, -420, -393, -365, -338, 
-    -313, -283, -257, -230, -203, -175, -151, -122, -98, -69, -46, -19, 3, 30, 55, 79, 
-    101, 127, 149, 174, 194, 221, 241, 265, 286, 312, 331, 357, 378, 403, 425, 448, 
-    472, 496, 520, 543, 567, 591, 613, 636, 659, 680, 702, 722, 744, 759, 780, 795, 
-    814, 827, 843, 856, 869, 881, 892, 903, 913, 922, 930, 940, 946, 954, 961, 968, 
-    973, 977, 984, 986, 990, 993, 993, 995, 993, 994, 987, 984, 978, 970, 962, 949, 
-    939, 923, 910, 891, 873, 854, 832, 810, 788, 764, 738, 712, 686, 659, 631, 603, 
-    572, 546, 513, 485, 451, 421, 388, 354, 319, 283, 245, 208, 168, 129, 85, 45, 
-    -2, -43, -92, -135, -184, -232, -280, -328, -378, -425, -476, -522, -574, -618, -669, -714, 
-    -762, -804, -851, -894, -937, -977, -1018, -1057, -1094, -1131, -1165, -1200, -1231, -1263, -1292, -1320, 
-    -1347, -1373, -1397, -1419, -1441, -1461, -1479, -1496, -1511, -1525, -1537, -1547, -1554, -1562, -1565, -1569, 
-    -1567, -1569, -1563, -1557, -1550, -1541, -1527, -1511, -1496, -1474, -1454, -1428, -1403, -1371, -1342, -1306, 
-    -1274, -1232, -1196, -1151, -1111, -1061, -1017, -964, -916, -861, -808, -751, -694, -634, -574, -511, 
-    -448, -382, -316, -249, -179, -110, -38, 32, 104, 179, 251, 330, 401, 480, 556, 632, 
-    710, 786, 865, 940, 1018, 1096, 1171, 1247, 1323, 1399, 1472, 1544, 1617, 1687, 1756, 1824, 
-    1888, 1954, 2013, 2076, 2128, 2189, 2237, 2290, 2334, 2380, 2422, 2459, 2496, 2527, 2557, 2582, 
-    2604, 2626, 2638, 2654, 2658, 2667, 2664, 2664, 2655, 2646, 2629, 2612, 2586, 2561, 2526, 2491, 
-    2451, 2405, 2356, 2304, 2246, 2185, 2118, 2051, 1976, 1899, 1819, 1734, 1648, 1554, 1461, 1362, 
-    1262, 1158, 1050, 942, 829, 717, 596, 480, 356, 234, 108, -19, -147, -280, -411, -545, 
-    -681, -815, -956, -1090, -1232, -1370, -1511, -1651, -1791, -1933, -2071, -2211, -2350, -2487, -2625, -2758, 
-    -2894, -3025, -3156, -3284, -3410, -3535, -3656, -3777, -3893, -4007, -4121, -4228, -4336, -4438, -4541, -4638, 
-    -4732, -4824, -4911, -4996, -5075, -5152, -5223, -5291, -5353, -5410, -5462, -5508, -5549, -5581, -5608, -5628, 
-    -5640, -5643, -5639, -5627, -5607, -5577, -5538, -5492, -5434, -5368, -5294, -5207, -5114, -5008, -4897, -4770, 
-    -4640, -4494, -4345, -4180, -4012, -3827, -3639, -3438, -3231, -3012, -2785, -2550, -2305, -2054, -1793, -1527, 
-    -1250, -968, -680, -385, -84, 219, 529, 841, 1160, 1477, 1801, 2120, 2448, 2765, 3094, 3409, 
-    3734, 4046, 4363, 4671, 4977, 5278, 5572, 5862, 6144, 6418, 6687, 6948, 7199, 7444, 7678, 7903, 
-    8119, 8326, 8523, 8711, 8887, 9054, 9209, 9358, 9491, 9618, 9731, 9837, 9929, 10015, 10087, 10150, 
-    10203, 10247, 10279, 10301, 10316, 10318, 10312, 10293, 10273, 10233, 10193, 10137, 10079, 10005, 9929, 9838, 
-    9744, 9638, 9526, 9404, 9273, 9135, 8987, 8834, 8664, 8494, 8309, 8117, 7914, 7700, 7480, 7242, 
-    7000, 6739, 6472, 6187, 5894, 5583, 5260, 4924, 4572, 4207, 3824, 3432, 3020, 2596, 2158, 1703, 
-    1237, 754, 263, -246, -764, -1294, -1838, -2388, -2953, -3521, -4105, -4687, -5285, -5879, -6486, -7092, 
-    -7701, -8310, -8922, -9530, -10135, -10737, -11333, -11919, -12500, -13066, -13624, -14163, -14692, -15198, -15691, -16157, 
-    -16608, -17029, -17431, -17806, -18151, -18475, -18763, -19033, -19261, -19471, -19645, -19794, -19912, -20003, -20066, -20103, 
-    -20117, -20103, -20069, -20011, -19937, -19839, -19729, -19599, -19460, -19300, -19135, -18955, -18766, -18564, -18356, -18134, 
-    -17901, -17660, -17403, -17134, -16848, -16548, -16228, -15887, -15528, -15143, -14740, -14307, -13858, -13378, -12882, -12359, 
-    -11825, -11267, -10702, -10122, -9543, -8956, -8374, -7796, -7229, -6673, -6131, -5604, -5089, -4593, -4105, -3624, 
-    -3147, -2665, -2175, -1660, -1122, -544, 76, 762, 1502, 2323, 3213, 4197, 5260, 6415, 7671, 9032, 
-    10442, 11935, 13470, 15059, 16658, 18290, 19898, 21502, 23049, 24598, 26052, 27474, 27741, 27698, 27722, 27705, 
-    27719, 27708, 27717, 27709, 27718, 27709, 27716, 27710, 27716, 27711, 27715, 27712, 27714, 27712, 27714, 27712, 
-    27712, 27713, 27712, 27713, 27709, 27713, 27710, 27714, 27712, 27714, 27712, 27714, 27712, 27713, 27712, 27713, 
-    27711, 27716, 27709, 27718, 27702, 27734, 27609, 25899, 24063, 22214, 20375, 18518, 16672, 14851, 13060, 11295, 
-    9569, 7913, 6335, 4833, 3412, 2088, 866, -262, -1314, -2311, -3262, -4187, -5084, -5955, -6825, -7709, 
-    -8612, -9532, -10468, -11423, -12403, -13444, -14536, -15674, -16836, -18025, -19227, -20443, -21651, -22863, -24064, -25260, 
-    -26428, -27492, -27789, -27756, -27771, -27761, -27769, -27763, -27767, -27763, -27767, -27763, -27766, -27762, -27766, -27762, 
-    -27766, -27764, -27766, -27763, -27765, -27764, -27768, -27762, -27768, -27764, -27767, -27764, -27766, -27764, -27767, -27763, 
-    -27767, -27763, -27766, -27761, -27766, -27763, -27766, -27764, -27766, -27765, -27766, -27765, -27766, -27763, -27769, -27762, 
-    -27770, -27758, -27772, -27757, -27773, -27754, -27778, -27749, -27788, -27731, -27832, -27251, -25211, -23305, -21266, -19273, 
-    -17207, -15185, -13132, -11146, -9164, -7267, -5385, -3577, -1782, -50, 1664, 3314, 4943, 6515, 8077, 9593, 
-    11101, 12555, 14003, 15400, 16797, 18153, 19521, 20859, 22224, 23566, 24937, 26284, 27596, 27738, 27702, 27719, 
-    27709, 27715, 27710, 27715, 27710, 27715, 27711, 27714, 27712, 27714, 27713, 27713, 27712, 27712, 27713, 27713, 
-    27713, 27713, 27713, 27714, 27711, 27715, 27712, 27715, 27711, 27714, 27712, 27714, 27712, 27714, 27711, 27715, 
-    27711, 27714, 27711, 27715, 27711, 27715, 27711, 27714, 27711, 27714, 27712, 27714, 27711, 27714, 27711, 27715, 
-    27712, 27714, 27711, 27714, 27711, 27715, 27710, 27717, 27708, 27720, 27703, 27728, 27690, 27755, 26751, 24564, 
-    22412, 20161, 17934, 15643, 13378, 11059, 8749, 6399, 4069, 1721, -591, -2904, -5173, -7421, -9602, -11754, 
-    -13826, -15860, -17800, -19710, -21512, -23307, -24972, -26710, -27728, -27762, -27770, -27763, -27767, -27763, -27768, -27764, 
-    -27767, -27762, -27768, -27763, -27767, -27764, -27766, -27764, -27766, -27764, -27766, -27764, -27766, -27763, -27766, -27765, 
-    -27767, -27764, -27766, -27764, -27767, -27762, -27767, -27762, -27767, -27764, -27768, -27764, -27766, -27764, -27766, -27764, 
-    -27764, -27766, -27765, -27765, -27765, -27765, -27767, -27765, -27766, -27764, -27767, -27764, -27766, -27763, -27767, -27764, 
-    -27766, -27763, -27767, -27761, -27768, -27761, -27771, -27760, -27772, -27757, -27772, -27757, -27775, -27757, -27728, -25654, 
-    -22560, -19540, -16433, -13348, -10230, -7139, -4047, -996, 2022, 4993, 7916, 10794, 13601, 16365, 19035, 21671, 
-    24185, 26682, 27758, 27686, 27732, 27699, 27725, 27703, 27722, 27704, 27721, 27705, 27720, 27706, 27720, 27705, 
-    27720, 27705, 27721, 27705, 27721, 27705, 27720, 27706, 27720, 27706, 27720, 27706, 27720, 27707, 27718, 27707, 
-    27719, 27708, 27719, 27707, 27719, 27707, 27720, 27706, 27720, 27706, 27720, 27706, 27720, 27706, 27719, 27706, 
-    27719, 27705, 27719, 27706, 27719, 27706, 27719, 27708, 27718, 27708, 27718, 27708, 27718, 27705, 27722, 27704, 
-    27724, 27701, 27725, 27700, 27728, 27697, 27731, 27691, 27741, 27670, 27796, 27372, 24485, 21637, 18672, 15727, 
-    12717, 9722, 6693, 3686, 670, -2303, -5263, -8170, -11052, -13873, -16658, -19382, -22054, -24674, -27125, -27810, 
-    -27746, -27777, -27757, -27773, -27759, -27771, -27760, -27770, -27761, -27770, -27761, -27769, -27762, -27767, -27764, -27767, 
-    -27764, -27767, -27762, -27768, -27764, -27767, -27764, -27767, -27764, -27768, -27763, -27769, -27762, -27770, -27761, -27769, 
-    -27760, -27768, -27760, -27768, -27761, -27769, -27763, -27768, -27761, -27769, -27762, -27770, -27761, -27769, -27761, -27769, 
-    -27759, -27768, -27759, -27770, -27759, -27772, -27756, -27772, -27758, -27773, -27757, -27771, -27756, -27773, -27757, -27776, 
-    -27753, -27779, -27750, -27782, -27744, -27787, -27737, -27804, -27708, -27851, -26078, -23354, -20843, -18122, -15466, -12697, 
-    -9967, -7175, -4420, -1653, 1072, 3772, 6425, 9030, 11589, 14083, 16544, 18918, 21284, 23523, 25859, 27634, 
-    27690, 27734, 27696, 27728, 27700, 27725, 27702, 27723, 27703, 27723, 27704, 27721, 27706, 27720, 27706, 27719, 
-    27706, 27719, 27706, 27718, 27707, 27718, 27706, 27717, 27706, 27717, 27708, 27715, 27710, 27714, 27710, 27714, 
-    27711, 27715, 27711, 27715, 27711, 27715, 27711, 27715, 27711, 27714, 27710, 27715, 27709, 27717, 27708, 27717, 
-    27709, 27716, 27710, 27715, 27710, 27716, 27710, 27714, 27711, 27715, 27709, 27715, 27711, 27716, 27710, 27715, 
-    27712, 27712, 27713, 27709, 27717, 27702, 27738, 27568, 25346, 23038, 20694, 18340, 15938, 13525, 11063, 8586, 
-    6063, 3524, 940, -1652, -4289, -6920, -9596, -12256, -14961, -17629, -20344, -22978, -25729, -27636, -27775, -27767, 
-    -27761, -27767, -27763, -27768, -27761, -27766, -27764, -27764, -27766, -27764, -27765, -27762, -27765, -27765, -27765, -27765, 
-    -27763, -27766, -27763, -27766, -27765, -27766, -27765, -27765, -27767, -27766, -27765, -27766, -27764, -27765, -27765, -27765, 
-    -27767, -27765, -27766, -27765, -27767, -27765, -27764, -27766, -27764, -27766, -27763, -27765, -27764, -27767, -27765, -27765, 
-    -27765, -27766, -27765, -27765, -27766, -27765, -27765, -27766, -27765, -27768, -27763, -27770, -27759, -27775, -27748, -27802, 
-    -27572, -25476, -22980, -20486, -17963, -15421, -12863, -10291, -7714, -5129, -2554, 13, 2555, 5074, 7555, 10001, 
-    12401, 14754, 17059, 19297, 21495, 23599, 25705, 27511, 27717, 27715, 27709, 27716, 27709, 27716, 27709, 27716, 
-    27711, 27716, 27709, 27716, 27710, 27715, 27710, 27715, 27710, 27716, 27709, 27714, 27710, 27714, 27710, 27714, 
-    27711, 27714, 27711, 27715, 27709, 27717, 27709, 27717, 27708, 27716, 27709, 27715, 27710, 27716, 27711, 27715, 
-    27710, 27715, 27710, 27716, 27710, 27715, 27709, 27715, 27710, 27716, 27710, 27716, 27709, 27717, 27708, 27718, 
-    27707, 27717, 27708, 27720, 27706, 27720, 27703, 27726, 27698, 27731, 27687, 27748, 25815, 23259, 20867, 18411, 
-    16035, 13641, 11301, 8957, 6646, 4330, 2038, -262, -2550, -4851, -7146, -9455, -11765, -14082, -16396, -18700, 
-    -20999, -23256, -25529, -27572, -27775, -27765, -27765, -27766, -27764, -27768, -27763, -27767, -27762, -27768, -27763, -27768, 
-    -27762, -27768, -27764, -27765, -27763, -27765, -27763, -27764, -27765, -27766, -27764, -27767, -27764, -27767, -27763, -27767, 
-    -27764, -27767, -27765, -27765, -27766, -27765, -27766, -27766, -27765, -27766, -27764, -27766, -27765, -27765, -27766, -27765, 
-    -27766, -27765, -27764, -27767, -27765, -27767, -27764, -27765, -27765, -27765, -27766, -27764, -27767, -27763, -27767, -27764, 
-    -27766, -27764, -27766, -27765, -27765, -27767, -27761, -27778, -27690, -25924, -23811, -21693, -19509, -17289, -15029, -12731, 
-    -10402, -8038, -5655, -3240, -811, 1650, 4124, 6632, 9147, 11693, 14235, 16798, 19345, 21909, 24444, 26949, 
-    27759, 27691, 27727, 27703, 27720, 27706, 27718, 27708, 27716, 27709, 27716, 27709, 27716, 27710, 27715, 27710, 
-    27715, 27710, 27714, 27710, 27713, 27711, 27714, 27711, 27713, 27711, 27714, 27711, 27714, 27711, 27716, 27711, 
-    27714, 27710, 27716, 27709, 27715, 27709, 27714, 27711, 27714, 27711, 27715, 27710, 27715, 27710, 27713, 27710, 
-    27713, 27713, 27708, 27729, 27466, 26271, 24963, 23670, 22382, 21106, 19849, 18605, 17387, 16186, 15012, 13852, 
-    12716, 11586, 10471, 9349, 8234, 7101, 5957, 4780, 3579, 2329, 1044, -302, -1690, -3144, -4639, -6198, 
-    -7793, -9451, -11130, -12875, -14621, -16427, -18221, -20059, -21865, -23701, -25480, -27270, -27794, -27748, -27775, -27756, 
-    -27773, -27758, -27771, -27761, -27770, -27761, -27768, -27763, -27767, -27764, -27765, -27764, -27764, -27763, -27764, -27763, 
-    -27767, -27764, -27766, -27765, -27766, -27766, -27764, -27767, -27763, -27765, -27763, -27765, -27765, -27766, -27764, -27765, 
-    -27763, -27765, -27763, -27767, -27762, -27771, -27755, -27791, -27506, -26102, -24465, -22860, -21234, -19613, -17992, -16378, 
-    -14770, -13177, -11596, -10039, -8496, -6988, -5498, -4047, -2619, -1238, 114, 1418, 2690, 3911, 5097, 6225, 
-    7320, 8361, 9372, 10337, 11277, 12184, 13074, 13943, 14805, 15654, 16510, 17355, 18223, 19080, 19972, 20852, 
-    21771, 22675, 23620, 24541, 25516, 26429, 27445, 27768, 27685, 27732, 27699, 27724, 27704, 27719, 27706, 27717, 
-    27708, 27717, 27709, 27716, 27709, 27715, 27710, 27715, 27713, 27714, 27712, 27714, 27711, 27714, 27710, 27715, 
-    27710, 27716, 27710, 27716, 27709, 27716, 27710, 27715, 27715, 27632, 27002, 26208, 25397, 24523, 23596, 22606, 
-    21552, 20433, 19244, 17991, 16676, 15304, 13878, 12405, 10892, 9354, 7792, 6227, 4659, 3116, 1589, 99, 
-    -1352, -2754, -4099, -5390, -6621, -7788, -8900, -9952, -10959, -11918, -12845, -13738, -14611, -15466, -16312, -17147, 
-    -17983, -18814, -19649, -20474, -21305, -22124, -22946, -23745, -24539, -25299, -26045, -26742, -27425, -27774, -27758, -27770, 
-    -27762, -27767, -27762, -27767, -27764, -27765, -27763, -27765, -27764, -27767, -27764, -27766, -27765, -27767, -27763, -27767, 
-    -27763, -27769, -27762, -27769, -27761, -27771, -27758, -27778, -27637, -27125, -26593, -26006, -25389, -24714, -24006, -23234, 
-    -22421, -21547, -20628, -19649, -18626, -17549, -16428, -15262, -14061, -12827, -11572, -10297, -9011, -7718, -6425, -5135, 
-    -3858, -2592, -1350, -123, 1072, 2255, 3405, 4540, 5647, 6738, 7803, 8856, 9885, 10905, 11908, 12900, 
-    13876, 14840, 15782, 16710, 17611, 18492, 19339, 20161, 20944, 21690, 22399, 23064, 23684, 24255, 24781, 25254, 
-    25680, 26056, 26381, 26660, 26890, 27079, 27221, 27323, 27384, 27409, 27396, 27348, 27262, 27146, 26996, 26817, 
-    26611, 26377, 26121, 25834, 25525, 25189, 24830, 24449, 24045, 23620, 23180, 22719, 22246, 21754, 21253, 20732, 
-    20205, 19659, 19104, 18529, 17944, 17336, 16713, 16067, 15405, 14718, 14008, 13275, 12520, 11740, 10935, 10106, 
-    9248, 8363, 7452, 6514, 5549, 4557, 3543, 2508, 1453, 377, -702, -1802, -2899, -4010, -5109, -6214, 
-    -7298, -8378, -9430, -10465, -11465, -12441, -13376, -14278, -15137, -15958, -16735, -17468, -18160, -18811, -19419, -19991, 
-    -20525, -21031, -21502, -21948, -22368, -22760, -23135, -23481, -23811, -24111, -24393, -24641, -24860, -25044, -25191, -25295, 
-    -25353, -25364, -25320, -25226, -25074, -24871, -24613, -24306, -23953, -23558, -23124, -22663, -22167, -21657, -21125, -20593, 
-    -20050, -19514, -18985, -18465, -17963, -17469, -16996, -16531, -16079, -15632, -15188, -14742, -14287, -13812, -13322, -12798, 
-    -12250, -11658, -11033, -10361, -9645, -8890, -8089, -7257, -6389, -5494, -4575, -3639, -2692, -1738, -782, 162, 
-    1101, 2017, 2916, 3781, 4623, 5433, 6213, 6966, 7685, 8386, 9048, 9698, 10312, 10917, 11492, 12056, 
-    12602, 13136, 13657, 14166, 14667, 15158, 15638, 16108, 16564, 17010, 17436, 17853, 18250, 18636, 18997, 19341, 
-    19658, 19945, 20203, 20418, 20603, 20736, 20832, 20874, 20875, 20821, 20724, 20577, 20387, 20151, 19877, 19565, 
-    19221, 18849, 18447, 18023, 17580, 17118, 16641, 16153, 15654, 15152, 14642, 14136, 13629, 13125, 12623, 12123, 
-    11629, 11134, 10646, 10158, 9674, 9190, 8713, 8235, 7763, 7291, 6828, 6366, 5907, 5456, 5006, 4566, 
-    4121, 3687, 3245, 2809, 2368, 1927, 1483, 1035, 585, 130, -330, -797, -1266, -1741, -2218, -2701, 
-    -3181, -3670, -4155, -4648, -5139, -5632, -6126, -6619, -7118, -7612, -8108, -8599, -9090, -9572, -10046, -10511, 
-    -10962, -11401, -11819, -12221, -12596, -12945, -13266, -13555, -13812, -14033, -14221, -14376, -14495, -14580, -14634, -14656, 
-    -14650, -14617, -14559, -14483, -14379, -14268, -14132, -13996, -13839, -13687, -13518, -13354, -13175, -13000, -12811, -12623, 
-    -12417, -12205, -11974, -11723, -11452, -11154, -10833, -10482, -10108, -9710, -9289, -8849, -8394, -7926, -7451, -6972, 
-    -6494, -6022, -5559, -5113, -4689, -4289, -3919, -3581, -3278, -3011, -2785, -2592, -2438, -2314, -2226, -2159, 
-    -2117, -2089, -2074, -2058, -2048, -2022, -1993, -1940, -1875, -1781, -1672, -1531, -1372, -1181, -975, -740, 
-    -487, -213, 70, 373, 681, 1005, 1329, 1661, 1995, 2330, 2665, 2993, 3322, 3642, 3961, 4273, 
-    4586, 4892, 5200, 5509, 5818, 6132, 6444, 6764, 7082, 7401, 7723, 8033, 8347, 8642, 8932, 9197, 
-    9446, 9667, 9856, 10016, 10136, 10222, 10263, 10267, 10230, 10158, 10043, 9902, 9725, 9528, 9307, 9078, 
-    8837, 8594, 8352, 8120, 7897, 7696, 7507, 7352, 7210, 7106, 7019, 6967, 6934, 6929, 6941, 6970, 
-    7008, 7054, 7100, 7141, 7174, 7192, 7193, 7168, 7123, 7046, 6941, 6800, 6634, 6431, 6201, 5944, 
-    5660, 5356, 5029, 4690, 4335, 3977, 3607, 3245, 2880, 2534, 2192, 1878, 1577, 1305, 1055, 834, 
-    638, 471, 327, 207, 103, 19, -58, -122, -189, -247, -316, -385, -476, -571, -693, -825, 
-    -986, -1160, -1362, -1579, -1816, -2068, -2331, -2609, -2882, -3162, -3429, -3695, -3938, -4169, -4377, -4564, 
-    -4724, -4864, -4976, -5069, -5134, -5186, -5214, -5240, -5248, -5260, -5265, -5281, -5300, -5335, -5375, -5438, 
-    -5510, -5604, -5709, -5838, -5974, -6132, -6290, -6466, -6638, -6817, -6991, -7155, -7314, -7450, -7583, -7682, 
-    -7773, -7830, -7873, -7886, -7885, -7859, -7823, -7766, -7708, -7634, -7561, -7481, -7408, -7327, -7261, -7191, 
-    -7137, -7081, -7044, -7008, -6981, -6962, -6947, -6941, -6932, -6933, -6927, -6927, -6918, -6907, -6885, -6859, 
-    -6818, -6770, -6707, -6632, -6542, -6431, -6307, -6159, -5997, -5807, -5602, -5372, -5122, -4850, -4557, -4246, 
-    -3915, -3567, -3202, -2819, -2426, -2018, -1607, -1184, -760, -333, 91, 510, 923, 1324, 1715, 2091, 
-    2451, 2798, 3122, 3437, 3729, 4013, 4278, 4536, 4783, 5024, 5260, 5494, 5729, 5966, 6203, 6447, 
-    6691, 6943, 7194, 7451, 7709, 7965, 8220, 8471, 8720, 8960, 9196, 9422, 9639, 9848, 10045, 10232, 
-    10408, 10574, 10730, 10877, 11018, 11151, 11281, 11402, 11522, 11637, 11748, 11855, 11956, 12052, 12138, 12214, 
-    12281, 12326, 12357, 12362, 12347, 12303, 12235, 12135, 12004, 11837, 11638, 11400, 11131, 10825, 10488, 10118, 
-    9721, 9291, 8841, 8361, 7868, 7350, 6826, 6283, 5736, 5181, 4626, 4071, 3524, 2983, 2452, 1930, 
-    1424, 930, 449, -11, -460, -889, -1301, -1696, -2071, -2431, -2770, -3093, -3395, -3684, -3953, -4207, 
-    -4445, -4673, -4887, -5093, -5288, -5474, -5657, -5827, -5998, -6154, -6313, -6459, -6604, -6740, -6866, -6987, 
-    -7101, -7204, -7305, -7392, -7481, -7554, -7630, -7693, -7760, -7817, -7882, -7935, -8001, -8056, -8123, -8184, 
-    -8258, -8329, -8405, -8484, -8565, -8649, -8730, -8813, -8890, -8965, -9032, -9095, -9148, -9195, -9227, -9253, 
-    -9261, -9261, -9246, -9218, -9181, -9127, -9069, -8991, -8914, -8820, -8722, -8613, -8501, -8377, -8255, -8118, 
-    -7987, -7838, -7696, -7539, -7382, -7213, -7038, -6853, -6657, -6452, -6237, -6009, -5770, -5513, -5244, -4953, 
-    -4652, -4328, -3992, -3634, -3266, -2880, -2487, -2083, -1673, -1257, -840, -424, -14, 388, 779, 1158, 
-    1517, 1858, 2175, 2470, 2739, 2982, 3199, 3390, 3553, 3694, 3811, 3908, 3981, 4045, 4090, 4129, 
-    4159, 4186, 4216, 4244, 4282, 4320, 4376, 4432, 4507, 4585, 4682, 4786, 4905, 5029, 5162, 5304, 
-    5444, 5593, 5733, 5880, 6017, 6152, 6281, 6404, 6525, 6635, 6742, 6839, 6934, 7019, 7107, 7184, 
-    7268, 7343, 7430, 7513, 7607, 7704, 7811, 7923, 8046, 8175, 8316, 8458, 8611, 8762, 8919, 9067, 
-    9218, 9354, 9484, 9596, 9693, 9772, 9826, 9856, 9862, 9839, 9786, 9704, 9593, 9455, 9285, 9091, 
-    8870, 8626, 8359, 8072, 7768, 7445, 7111, 6762, 6402, 6036, 5661, 5285, 4902, 4523, 4141, 3765, 
-    3390, 3027, 2667, 2325, 1989, 1673, 1366, 1081, 809, 559, 325, 113, -81, -255, -413, -549, 
-    -675, -783, -883, -972, -1058, -1142, -1226, -1315, -1409, -1516, -1628, -1756, -1896, -2053, -2226, -2419, 
-    -2627, -2853, -3096, -3353, -3626, -3910, -4207, -4513, -4824, -5146, -5466, -5795, -6119, -6450, -6773, -7098, 
-    -7416, -7735, -8049, -8358, -8662, -8962, -9252, -9541, -9814, -10084, -10334, -10578, -10801, -11014, -11201, -11376, 
-    -11526, -11657, -11763, -11847, -11912, -11950, -11971, -11968, -11951, -11909, -11855, -11780, -11690, -11587, -11469, -11341, 
-    -11198, -11050, -10886, -10722, -10541, -10360, -10166, -9973, -9770, -9567, -9360, -9151, -8943, -8732, -8528, -8317, 
-    -8118, -7913, -7719, -7523, -7336, -7152, -6974, -6801, -6627, -6462, -6295, -6132, -5965, -5798, -5628, -5449, 
-    -5264, -5066, -4862, -4641, -4408, -4159, -3896, -3615, -3320, -3004, -2672, -2319, -1953, -1564, -1160, -737, 
-    -298, 158, 632, 1121, 1625, 2145, 2673, 3216, 3767, 4327, 4892, 5465, 6038, 6616, 7188, 7760, 
-    8324, 8884, 9433, 9974, 10502, 11023, 11523, 12017, 12489, 12955, 13399, 13836, 14249, 14657, 15047, 15422, 
-    15781, 16129, 16460, 16775, 17072, 17362, 17625, 17880, 18110, 18328, 18526, 18704, 18861, 18996, 19108, 19196, 
-    19257, 19293, 19295, 19274, 19215, 19127, 19004, 18849, 18658, 18430, 18167, 17867, 17534, 17166, 16764, 16334, 
-    15872, 15384, 14872, 14341, 13791, 13225, 12648, 12065, 11468, 10876, 10271, 9678, 9073, 8481, 7880, 7293, 
-    6697, 6114, 5521, 4938, 4349, 3768, 3175, 2592, 1996, 1406, 801, 202, -411, -1021, -1651, -2277, 
-    -2923, -3570, -4233, -4907, -5591, -6289, -6997, -7718, -8452, -9190, -9942, -10696, -11455, -12216, -12972, -13726, 
-    -14470, -15200, -15916, -16608, -17283, -17927, -18546, -19131, -19685, -20203, -20693, -21141, -21559, -21937, -22290, -22604, 
-    -22894, -23152, -23390, -23602, -23792, -23962, -24110, -24240, -24343, -24427, -24484, -24517, -24517, -24488, -24420, -24318, 
-    -24173, -23983, -23746, -23458, -23123, -22728, -22284, -21784, -21232, -20629, -19978, -19281, -18544, -17765, -16960, -16123, 
-    -15271, -14395, -13522, -12634, -11757, -10878, -10019, -9165, -8332, -7514, -6716, -5936, -5177, -4432, -3703, -2985, 
-    -2277, -1570, -866, -157, 556, 1281, 2018, 2771, 3543, 4330, 5141, 5966, 6813, 7672, 8547, 9430, 
-    10316, 11203, 12082, 12950, 13805, 14635, 15446, 16219, 16969, 17677, 18352, 18985, 19581, 20138, 20652, 21133, 
-    21576, 21987, 22365, 22713, 23037, 23328, 23603, 23850, 24082, 24290, 24480, 24655, 24808, 24945, 25063, 25159, 
-    25232, 25280, 25302, 25292, 25248, 25173, 25054, 24900, 24699, 24461, 24173, 23845, 23467, 23050, 22583, 22077, 
-    21525, 20938, 20312, 19654, 18964, 18245, 17500, 16734, 15945, 15145, 14326, 13500, 12666, 11823, 10980, 10132, 
-    9290, 8444, 7600, 6761, 5918, 5083, 4242, 3408, 2565, 1728, 883, 36, -820, -1678, -2550, -3422, 
-    -4311, -5199, -6102, -7006, -7917, -8830, -9741, -10654, -11559, -12456, -13343, -14212, -15065, -15891, -16700, -17470, 
-    -18213, -18917, -19582, -20211, -20789, -21334, -21823, -22278, -22679, -23043, -23360, -23641, -23880, -24083, -24251, -24387, 
-    -24489, -24565, -24610, -24630, -24623, -24593, -24538, -24461, -24362, -24243, -24100, -23940, -23757, -23553, -23326, -23078, 
-    -22804, -22503, -22174, -21821, -21433, -21020, -20571, -20097, -19586, -19044, -18469, -17861, -17217, -16539, -15825, -15078, 
-    -14296, -13481, -12636, -11760, -10858, -9931, -8982, -8017, -7036, -6045, -5049, -4048, -3050, -2053, -1066, -86, 
-    882, 1834, 2774, 3690, 4589, 5466, 6321, 7154, 7958, 8741, 9498, 10234, 10944, 11634, 12302, 12952, 
-    13580, 14193, 14787, 15365, 15925, 16468, 16994, 17500, 17991, 18458, 18909, 19335, 19740, 20120, 20472, 20799, 
-    21094, 21358, 21591, 21791, 21961, 22092, 22197, 22265, 22305, 22311, 22289, 22240, 22160, 22055, 21925, 21769, 
-    21592, 21392, 21169, 20927, 20661, 20376, 20065, 19733, 19376, 18991, 18579, 18135, 17665, 17156, 16619, 16044, 
-    15436, 14792, 14113, 13402, 12652, 11877, 11065, 10233, 9366, 8485, 7578, 6657, 5719, 4771, 3812, 2847, 
-    1876, 906, -63, -1029, -1993, -2945, -3892, -4825, -5749, -6657, -7553, -8432, -9293, -10136, -10960, -11761, 
-    -12538, -13292, -14018, -14715, -15378, -16010, -16604, -17161, -17677, -18154, -18587, -18976, -19321, -19623, -19880, -20094, 
-    -20269, -20402, -20502, -20563, -20594, -20592, -20564, -20507, -20430, -20327, -20208, -20069, -19919, -19748, -19566, -19367, 
-    -19156, -18923, -18675, -18405, -18114, -17797, -17454, -17081, -16675, -16237, -15763, -15253, -14704, -14121, -13505, -12854, 
-    -12174, -11464, -10735, -9977, -9209, -8418, -7625, -6817, -6011, -5200, -4396, -3594, -2804, -2019, -1249, -487, 
-    255, 992, 1709, 2420, 3114, 3801, 4481, 5148, 5816, 6471, 7128, 7775, 8421, 9056, 9693, 10316, 
-    10933, 11536, 12132, 12709, 13271, 13814, 14338, 14837, 15315, 15762, 16184, 16573, 16933, 17259, 17550, 17809, 
-    18028, 18218, 18365, 18484, 18563, 18611, 18624, 18606, 18557, 18477, 18369, 18232, 18071, 17878, 17665, 17425, 
-    17167, 16883, 16582, 16257, 15914, 15549, 15165, 14760, 14336, 13889, 13426, 12943, 12437, 11913, 11368, 10805, 
-    10219, 9616, 8994, 8355, 7697, 7021, 6333, 5626, 4908, 4176, 3436, 2686, 1932, 1176, 416, -340, 
-    -1096, -1847, -2590, -3327, -4054, -4771, -5474, -6164, -6839, -7496, -8137, -8762, -9365, -9950, -10515, -11056, 
-    -11581, -12080, -12562, -13022, -13463, -13885, -14288, -14674, -15045, -15396, -15733, -16051, -16352, -16640, -16908, -17164, 
-    -17398, -17620, -17820, -18004, -18165, -18309, -18428, -18525, -18595, -18642, -18657, -18647, -18602, -18528, -18415, -18275, 
-    -18093, -17879, -17623, -17332, -17006, -16636, -16234, -15783, -15307, -14784, -14231, -13640, -13017, -12362, -11675, -10969, 
-    -10233, -9483, -8712, -7934, -7142, -6352, -5554, -4766, -3976, -3207, -2437, -1695, -954, -243, 461, 1141, 
-    1811, 2460, 3095, 3718, 4329, 4929, 5522, 6108, 6693, 7269, 7847, 8415, 8991, 9551, 10115, 10666, 
-    11211, 11741, 12259, 12761, 13241, 13700, 14133, 14540, 14917, 15267, 15583, 15868, 16122, 16344, 16537, 16698, 
-    16832, 16934, 17016, 17070, 17107, 17120, 17121, 17102, 17073, 17028, 16974, 16910, 16835, 16755, 16664, 16568, 
-    16464, 16352, 16232, 16101, 15964, 15809, 15648, 15467, 15274, 15059, 14827, 14570, 14292, 13985, 13655, 13290, 
-    12899, 12473, 12015, 11523, 10999, 10440, 9851, 9229, 8579, 7900, 7196, 6468, 5720, 4955, 4175, 3384, 
-    2585, 1784, 977, 180, -619, -1404, -2182, -2947, -3698, -4432, -5148, -5848, -6526, -7186, -7825, -8441, 
-    -9039, -9614, -10168, -10700, -11213, -11707, -12176, -12630, -13063, -13480, -13876, -14256, -14621, -14965, -15296, -15605, 
-    -15903, -16177, -16436, -16672, -16890, -17087, -17259, -17411, -17539, -17643, -17726, -17779, -17815, -17817, -17801, -17749, 
-    -17678, -17571, -17444, -17282, -17101, -16888, -16655, -16395, -16116, -15814, -15491, -15151, -14788, -14412, -14010, -13600, 
-    -13164, -12721, -12250, -11776, -11281, -10782, -10266, -9748, -9216, -8689, -8146, -7612, -7064, -6525, -5978, -5437, 
-    -4893, -4352, -3811, -3271, -2731, -2194, -1652, -1117, -574, -39, 503, 1041, 1582, 2119, 2659, 3193, 
-    3726, 4252, 4772, 5283, 5786, 6277, 6756, 7221, 7674, 8111, 8530, 8935, 9321, 9692, 10045, 10381, 
-    10705, 11008, 11307, 11584, 11861, 12114, 12371, 12605, 12843, 13057, 13273, 13467, 13662, 13831, 13996, 14142, 
-    14274, 14388, 14480, 14557, 14606, 14637, 14639, 14619, 14571, 14498, 14394, 14268, 14107, 13925, 13710, 13474, 
-    13210, 12925, 12619, 12295, 11956, 11604, 11240, 10869, 10489, 10109, 9722, 9340, 8953, 8572, 8189, 7813, 
-    7434, 7059, 6686, 6314, 5937, 5563, 5186, 4805, 4416, 4027, 3628, 3222, 2809, 2389, 1959, 1527, 
-    1084, 640, 188, -258, -707, -1152, -1590, -2019, -2438, -2844, -3235, -3609, -3970, -4308, -4631, -4934, 
-    -5217, -5485, -5732, -5965, -6177, -6376, -6562, -6729, -6889, -7032, -7173, -7293, -7414, -7516, -7622, -7708, 
-    -7795, -7867, -7937, -7990, -8040, -8077, -8104, -8120, -8126, -8124, -8107, -8085, -8053, -8015, -7970, -7919, 
-    -7866, -7809, -7752, -7692, -7634, -7570, -7512, -7445, -7388, -7316, -7255, -7182, -7113, -7038, -6959, -6879, 
-    -6787, -6700, -6598, -6500, -6388, -6280, -6159, -6042, -5915, -5789, -5658, -5526, -5394, -5259, -5126, -4992, 
-    -4860, -4728, -4596, -4468, -4340, -4213, -4089, -3964, -3842, -3716, -3593, -3466, -3338, -3207, -3071, -2931, 
-    -2784, -2636, -2480, -2319, -2152, -1980, -1802, -1618, -1428, -1235, -1036, -831, -625, -413, -203, 12, 
-    222, 434, 641, 844, 1041, 1231, 1413, 1585, 1751, 1905, 2053, 2186, 2316, 2430, 2540, 2638, 
-    2731, 2814, 2894, 2967, 3039, 3105, 3174, 3236, 3302, 3364, 3431, 3494, 3561, 3627, 3697, 3765, 
-    3836, 3905, 3975, 4042, 4111, 4173, 4241, 4298, 4364, 4416, 4481, 4531, 4589, 4641, 4697, 4748, 
-    4802, 4858, 4912, 4969, 5029, 5091, 5160, 5231, 5310, 5393, 5487, 5584, 5691, 5805, 5926, 6053, 
-    6187, 6322, 6460, 6597, 6734, 6862, 6990, 7104, 7215, 7308, 7395, 7460, 7517, 7550, 7570, 7567, 
-    7548, 7508, 7446, 7371, 7269, 7158, 7021, 6876, 6709, 6533, 6337, 6134, 5916, 5693, 5454, 5216, 
-    4962, 4710, 4445, 4180, 3906, 3631, 3352, 3071, 2786, 2501, 2212, 1927, 1639, 1353, 1067, 788, 
-    505, 232, -42, -306, -574, -831, -1088, -1335, -1582, -1818, -2049, -2272, -2491, -2699, -2903, -3096, 
-    -3286, -3465, -3638, -3805, -3963, -4115, -4258, -4395, -4527, -4650, -4771, -4884, -4996, -5102, -5209, -5314, 
-    -5420, -5528, -5638, -5751, -5872, -5994, -6130, -6262, -6415, -6561, -6727, -6889, -7064, -7240, -7422, -7609, 
-    -7797, -7985, -8174, -8361, -8544, -8721, -8890, -9054, -9205, -9349, -9475, -9593, -9696, -9782, -9853, -9907, 
-    -9944, -9962, -9958, -9937, -9893, -9830, -9743, -9635, -9503, -9348, -9169, -8968, -8743, -8493, -8226, -7935, 
-    -7625, -7294, -6952, -6587, -6212, -5823, -5428, -5026, -4617, -4207, -3794, -3387, -2981, -2581, -2188, -1806, 
-    -1432, -1066, -712, -369, -34, 293, 609, 920, 1223, 1521, 1816, 2106, 2398, 2683, 2972, 3257, 
-    3545, 3830, 4115, 4398, 4678, 4958, 5230, 5501, 5760, 6017, 6258, 6496, 6715, 6930, 7127, 7313, 
-    7491, 7648, 7804, 7938, 8075, 8192, 8312, 8420, 8529, 8633, 8736, 8838, 8944, 9045, 9153, 9257, 
-    9366, 9471, 9578, 9685, 9787, 9888, 9986, 10079, 10164, 10242, 10314, 10373, 10423, 10457, 10480, 10485, 
-    10473, 10443, 10392, 10325, 10232, 10123, 9988, 9836, 9654, 9458, 9230, 8989, 8717, 8431, 8119, 7789, 
-    7440, 7073, 6690, 6293, 5882, 5461, 5031, 4592, 4150, 3698, 3247, 2791, 2336, 1881, 1424, 978, 
-    528, 88, -347, -774, -1194, -1604, -2002, -2390, -2765, -3125, -3473, -3803, -4120, -4420, -4701, -4967, 
-    -5213, -5445, -5651, -5849, -6018, -6177, -6315, -6440, -6548, -6638, -6723, -6788, -6849, -6895, -6938, -6970, 
-    -6999, -7024, -7044, -7063, -7077, -7095, -7104, -7117, -7124, -7133, -7139, -7143, -7143, -7143, -7137, -7130, 
-    -7112, -7094, -7067, -7034, -6992, -6938, -6880, -6808, -6725, -6633, -6528, -6417, -6290, -6159, -6018, -5867, 
-    -5718, -5558, -5401, -5236, -5080, -4921, -4767, -4614, -4472, -4329, -4199, -4067, -3949, -3830, -3721, -3611, 
-    -3509, -3402, -3301, -3194, -3090, -2974, -2860, -2729, -2599, -2452, -2298, -2129, -1953, -1760, -1561, -1350, 
-    -1132, -905, -675, -441, -209, 23, 252, 474, 690, 898, 1095, 1280, 1450, 1614, 1754, 1888, 
-    1998, 2106, 2190, 2267, 2326, 2380, 2417, 2448, 2468, 2480, 2486, 2485, 2480, 2466, 2452, 2431, 
-    2409, 2383, 2354, 2325, 2292, 2261, 2228, 2200, 2170, 2147, 2125, 2108, 2097, 2089, 2092, 2096, 
-    2110, 2131, 2155, 2193, 2225, 2280, 2322, 2386, 2438, 2509, 2569, 2641, 2707, 2778, 2841, 2909, 
-    2969, 3028, 3084, 3133, 3181, 3221, 3263, 3299, 3334, 3368, 3402, 3437, 3473, 3513, 3556, 3604, 
-    3654, 3715, 3776, 3846, 3918, 3998, 4081, 4165, 4254, 4340, 4428, 4508, 4587, 4660, 4723, 4778, 
-    4823, 4857, 4880, 4887, 4889, 4871, 4849, 4810, 4768, 4712, 4648, 4580, 4502, 4423, 4335, 4249, 
-    4157, 4069, 3976, 3892, 3800, 3719, 3632, 3554, 3472, 3398, 3323, 3251, 3179, 3111, 3043, 2976, 
-    2911, 2840, 2775, 2700, 2632, 2552, 2477, 2388, 2305, 2206, 2110, 1998, 1888, 1761, 1632, 1489, 
-    1343, 1181, 1012, 832, 644, 444, 231, 13, -219, -457, -709, -964, -1232, -1506, -1784, -2070, 
-    -2358, -2652, -2941, -3238, -3528, -3821, -4109, -4396, -4678, -4957, -5232, -5503, -5765, -6025, -6273, -6519, 
-    -6751, -6982, -7199, -7410, -7612, -7807, -7991, -8169, -8341, -8503, -8660, -8808, -8955, -9086, -9222, -9341, 
-    -9461, -9567, -9672, -9766, -9851, -9930, -9995, -10051, -10093, -10123, -10137, -10132, -10114, -10076, -10018, -9939, 
-    -9841, -9718, -9576, -9410, -9224, -9013, -8786, -8536, -8270, -7983, -7685, -7370, -7047, -6710, -6369, -6020, 
-    -5669, -5315, -4958, -4606, -4251, -3904, -3553, -3213, -2872, -2540, -2210, -1887, -1570, -1256, -949, -646, 
-    -350, -54, 234, 523, 807, 1094, 1375, 1662, 1946, 2236, 2526, 2825, 3127, 3439, 3757, 4088, 
-    4429, 4778, 5146, 5517, 5912, 6304, 6722, 7133, 7569, 7995, 8439, 8873, 9315, 9747, 10178, 10598, 
-    11007, 11405, 11787, 12154, 12501, 12830, 13137, 13426, 13687, 13930, 14144, 14339, 14510, 14654, 14780, 14875, 
-    14954, 15000, 15035, 15035, 15023, 14979, 14921, 14831, 14727, 14593, 14442, 14265, 14067, 13847, 13606, 13345, 
-    13063, 12763, 12447, 12109, 11757, 11387, 11001, 10599, 10180, 9747, 9297, 8835, 8354, 7862, 7355, 6839, 
-    6303, 5763, 5206, 4646, 4070, 3497, 2908, 2324, 1732, 1142, 551, -34, -615, -1194, -1764, -2325, 
-    -2879, -3422, -3956, -4478, -4992, -5493, -5984, -6469, -6937, -7406, -7856, -8310, -8745, -9187, -9611, -10037, 
-    -10452, -10864, -11266, -11663, -12052, -12428, -12798, -13154, -13502, -13829, -14148, -14447, -14732, -14995, -15242, -15468, 
-    -15673, -15855, -16020, -16161, -16277, -16375, -16446, -16499, -16524, -16534, -16512, -16477, -16411, -16332, -16225, -16101, 
-    -15952, -15786, -15595, -15386, -15153, -14903, -14629, -14335, -14022, -13689, -13337, -12966, -12578, -12172, -11751, -11316, 
-    -10864, -10400, -9920, -9431, -8926, -8413, -7884, -7349, -6799, -6240, -5672, -5092, -4505, -3904, -3300, -2680, 
-    -2056, -1421, -781, -134, 520, 1176, 1842, 2503, 3171, 3836, 4500, 5164, 5816, 6470, 7109, 7744, 
-    8363, 8971, 9562, 10140, 10696, 11236, 11754, 12254, 12729, 13185, 13614, 14027, 14408, 14772, 15103, 15421, 
-    15703, 15967, 16199, 16411, 16594, 16753, 16885, 16993, 17075, 17132, 17165, 17176, 17163, 17128, 17070, 16994, 
-    16894, 16776, 16635, 16479, 16297, 16103, 15881, 15648, 15389, 15115, 14819, 14503, 14170, 13814, 13441, 13046, 
-    12635, 12200, 11753, 11285, 10805, 10305, 9797, 9274, 8743, 8200, 7654, 7100, 6544, 5982, 5424, 4862, 
-    4305, 3744, 3190, 2633, 2080, 1530, 977, 431, -121, -664, -1216, -1762, -2311, -2858, -3408, -3953, 
-    -4498, -5038, -5578, -6108, -6633, -7148, -7656, -8148, -8631, -9093, -9545, -9975, -10387, -10779, -11149, -11501, 
-    -11826, -12135, -12417, -12683, -12923, -13146, -13347, -13531, -13696, -13842, -13973, -14086, -14185, -14267, -14332, -14385, 
-    -14419, -14439, -14440, -14427, -14395, -14343, -14274, -14181, -14071, -13937, -13780, -13603, -13397, -13177, -12924, -12659, 
-    -12361, -12052, -11713, -11363, -10988, -10600, -10195, -9776, -9345, -8902, -8448, -7988, -7519, -7049, -6564, -6086, 
-    -5598, -5113, -4623, -4136, -3646, -3158, -2674, -2188, -1709, -1233, -760, -293, 168, 622, 1072, 1512, 
-    1945, 2370, 2788, 3197, 3595, 3988, 4369, 4746, 5111, 5471, 5820, 6162, 6496, 6820, 7139, 7443, 
-    7744, 8031, 8316, 8584, 8847, 9095, 9334, 9560, 9773, 9969, 10155, 10318, 10471, 10599, 10715, 10809, 
-    10885, 10940, 10977, 10994, 10994, 10970, 10934, 10872, 10802, 10707, 10600, 10473, 10336, 10183, 10015, 9838, 
-    9647, 9447, 9234, 9012, 8782, 8541, 8293, 8033, 7769, 7493, 7214, 6923, 6628, 6322, 6013, 5695, 
-    5371, 5041, 4705, 4362, 4013, 3660, 3297, 2931, 2559, 2180, 1799, 1409, 1022, 624, 233, -164, 
-    -555, -951, -1338, -1722, -2098, -2467, -2824, -3171, -3504, -3823, -4125, -4411, -4677, -4927, -5156, -5366, 
-    -5558, -5729, -5882, -6015, -6131, -6229, -6308, -6375, -6427, -6464, -6490, -6504, -6514, -6505, -6498, -6477, 
-    -6456, -6424, -6393, -6353, -6314, -6266, -6221, -6166, -6117, -6055, -5998, -5929, -5861, -5785, -5705, -5615, 
-    -5519, -5414, -5300, -5177, -5037, -4893, -4733, -4564, -4378, -4187, -3980, -3768, -3542, -3314, -3076, -2836, 
-    -2592, -2351, -2108, -1867, -1631, -1399, -1174, -956, -743, -541, -345, -162, 19, 186, 350, 508, 
-    656, 805, 942, 1087, 1218, 1357, 1492, 1630, 1765, 1906, 2044, 2189, 2329, 2475, 2618, 2763, 
-    2908, 3047, 3188, 3322, 3450, 3575, 3687, 3793, 3887, 3970, 4038, 4091, 4131, 4154, 4160, 4148, 
-    4121, 4077, 4016, 3941, 3851, 3747, 3630, 3504, 3367, 3223, 3073, 2917, 2757, 2596, 2432, 2272, 
-    2107, 1947, 1787, 1632, 1478, 1326, 1177, 1030, 887, 741, 604, 459, 326, 184, 51, -86, 
-    -219, -350, -482, -608, -734, -853, -974, -1083, -1193, -1291, -1391, -1476, -1562, -1637, -1708, -1772, 
-    -1828, -1880, -1922, -1963, -1994, -2022, -2042, -2058, -2069, -2075, -2074, -2071, -2061, -2050, -2030, -2011, 
-    -1985, -1958, -1924, -1888, -1847, -1804, -1753, -1703, -1643, -1585, -1517, -1446, -1370, -1289, -1202, -1111, 
-    -1016, -917, -813, -707, -596, -485, -372, -255, -140, -21, 91, 212, 325, 443, 553, 668, 
-    775, 887, 992, 1101, 1203, 1311, 1414, 1522, 1625, 1730, 1835, 1937, 
-};
-const unsigned int drum_v1_p2_short_len = 5292;
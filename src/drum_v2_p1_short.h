@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v2_p1_short[] PROGMEM = {
-    12, -7, 15, 19, 28, 32, 37, 35, 37, 31, 26, 27, 13, 13, 0, -6, 
-    -14, -27, -33, -51, -54, -72, -79, -96, -109, -119, -138, -148, -166, -181, -195, -216, 
-    -229, -249, -267, -283, -307, -320, -344, -360, -382, -401, -420, -439, -457, -479, -493, -518, 
-    -527, -554, -562, -586, -597, -617, -629, -646, -660, -675, -686, -705, -712, -733, -738, -754, 
-    -767, -777, -794, -800, -817, -827, -840, -851, -864, -876, -889, -901, -913, -926, -939, -950, 
-    -965, -974, -987, -999, -1011, -1021, -1032, -1042, -1052, -1060, -1069, -1080, -1080, -1096, -1088, -1106, 
-    -1100, -1108, -1106, -1107, -1109, -1107, -1104, -1101, -1098, -1093, -1088, -1081, -1075, -1067, -1056, -1051, 
-    -1036, -1031, -1015, -1005, -992, -979, -962, -954, -929, -924, -896, -889, -858, -852, -818, -811, 
-    -773, -764, -730, -717, -682, -661, -635, -607, -584, -552, -526, -500, -468, -444, -410, -389, 
-    -355, -329, -297, -274, -242, -215, -185, -162, -129, -108, -72, -55, -19, -2, 31, 52, 
-    82, 103, 130, 155, 178, 206, 223, 255, 273, 301, 321, 348, 371, 394, 419, 443, 
-    466, 493, 515, 541, 565, 591, 615, 639, 665, 689, 713, 737, 761, 785, 805, 831, 
-    848, 875, 887, 913, 927, 947, 962, 978, 994, 1008, 1020, 1034, 1045, 1057, 1067, 1078, 
-    1087, 1095, 1106, 1111, 1122, 1126, 1136, 1141, 1146, 1150, 1158, 1160, 1164, 1168, 1166, 1170, 
-    1166, 1168, 1165, 1159, 1157, 1148, 1142, 1131, 1123, 1105, 1099, 1074, 1069, 1039, 1029, 1002, 
-    985, 958, 938, 911, 886, 859, 831, 806, 775, 748, 717, 687, 657, 628, 593, 564, 
-    527, 496, 462, 425, 391, 352, 314, 274, 237, 192, 154, 103, 67, 14, -27, -77, 
-    -124, -172, -222, -274, -321, -375, -424, -476, -527, -578, -628, -682, -727, -782, -829, -878, 
-    -926, -970, -1020, -1063, -1109, -1150, -1192, -1235, -1273, -1314, -1348, -1385, -1421, -1453, -1488, -1516, 
-    -1547, -1574, -1603, -1628, -1653, -1675, -1698, -1719, -1737, -1755, -1771, -1786, -1800, -1811, -1822, -1827, 
-    -1838, -1838, -1846, -1842, -1844, -1841, -1833, -1830, -1818, -1812, -1792, -1780, -1761, -1742, -1719, -1695, 
-    -1668, -1640, -1607, -1576, -1540, -1504, -1466, -1420, -1384, -1331, -1296, -1234, -1197, -1134, -1090, -1029, 
-    -976, -916, -858, -795, -734, -669, -605, -537, -472, -398, -334, -257, -188, -113, -40, 37, 
-    109, 191, 262, 345, 423, 500, 583, 662, 740, 825, 901, 986, 1065, 1145, 1227, 1308, 
-    1387, 1466, 1547, 1624, 1704, 1776, 1856, 1928, 2005, 2073, 2147, 2211, 2284, 2343, 2411, 2469, 
-    2527, 2590, 2636, 2696, 2738, 2789, 2833, 2873, 2911, 2950, 2977, 3013, 3035, 3061, 3082, 3097, 
-    3112, 3123, 3128, 3135, 3131, 3129, 3123, 3110, 3098, 3074, 3058, 3023, 3002, 2957, 2926, 2880, 
-    2834, 2783, 2728, 2672, 2606, 2545, 2470, 2403, 2320, 2242, 2158, 2069, 1982, 1885, 1789, 1689, 
-    1586, 1479, 1373, 1258, 1147, 1029, 912, 791, 664, 544, 411, 286, 154, 19, -112, -251, 
-    -389, -526, -668, -810, -951, -1096, -1240, -1383, -1535, -1673, -1828, -1968, -2120, -2265, -2413, -2556, 
-    -2705, -2848, -2992, -3135, -3274, -3418, -3553, -3691, -3825, -3957, -4089, -4218, -4344, -4471, -4590, -4711, 
-    -4829, -4945, -5054, -5168, -5268, -5382, -5475, -5579, -5670, -5765, -5852, -5937, -6018, -6096, -6170, -6237, 
-    -6303, -6359, -6418, -6463, -6510, -6544, -6576, -6601, -6618, -6631, -6630, -6631, -6614, -6600, -6566, -6535, 
-    -6485, -6440, -6370, -6305, -6223, -6135, -6038, -5932, -5817, -5693, -5559, -5418, -5266, -5107, -4939, -4759, 
-    -4576, -4374, -4177, -3958, -3742, -3509, -3271, -3029, -2767, -2514, -2235, -1969, -1676, -1393, -1089, -793, 
-    -481, -169, 148, 473, 796, 1129, 1459, 1795, 2132, 2466, 2811, 3142, 3486, 3819, 4156, 4491, 
-    4821, 5147, 5477, 5789, 6115, 6415, 6730, 7021, 7322, 7600, 7887, 8154, 8422, 8677, 8928, 9165, 
-    9399, 9620, 9835, 10039, 10235, 10420, 10598, 10762, 10922, 11069, 11206, 11335, 11452, 11561, 11661, 11747, 
-    11834, 11894, 11965, 12006, 12058, 12080, 12111, 12120, 12128, 12122, 12107, 12088, 12057, 12016, 11969, 11912, 
-    11848, 11776, 11693, 11608, 11506, 11405, 11290, 11171, 11045, 10902, 10766, 10604, 10456, 10277, 10104, 9917, 
-    9725, 9520, 9309, 9084, 8857, 8612, 8360, 8099, 7820, 7539, 7237, 6931, 6607, 6268, 5925, 5558, 
-    5188, 4793, 4393, 3977, 3545, 3101, 2646, 2174, 1689, 1195, 682, 166, -373, -913, -1469, -2038, 
-    -2608, -3201, -3787, -4396, -5000, -5619, -6238, -6869, -7494, -8139, -8765, -9413, -10043, -10691, -11320, -11959, 
-    -12584, -13214, -13825, -14439, -15037, -15626, -16205, -16765, -17317, -17846, -18364, -18857, -19332, -19791, -20215, -20635, 
-    -21010, -21376, -21706, -22016, -22297, -22554, -22773, -22985, -23145, -23303, -23413, -23513, -23576, -23621, -23641, -23636, 
-    -23612, -23564, -23499, -23417, -23313, -23199, -23063, -22923, -22760, -22592, -22411, -22221, -22019, -21809, -21587, -21361, 
-    -21115, -20870, -20605, -20333, -20043, -19743, -19422, -19094, -18730, -18369, -17963, -17562, -17112, -16665, -16176, -15681, 
-    -15151, -14615, -14050, -13480, -12884, -12291, -11678, -11073, -10457, -9848, -9242, -8646, -8061, -7487, -6926, -6382, 
-    -5844, -5332, -4815, -4319, -3812, -3317, -2802, -2283, -1727, -1161, -538, 106, 834, 1586, 2439, 3330, 
-    4328, 5380, 6538, 7752, 9095, 10506, 11987, 13520, 15125, 16757, 18436, 20114, 21830, 23502, 25196, 26799, 
-    28456, 29960, 31572, 32602, 32536, 32591, 32555, 32580, 32564, 32575, 32566, 32574, 32567, 32575, 32566, 32573, 
-    32568, 32572, 32571, 32568, 32574, 32566, 32575, 32565, 32576, 32565, 32573, 32566, 32573, 32567, 32572, 32563, 
-    32573, 32564, 32573, 32567, 32572, 32569, 32572, 32569, 32572, 32567, 32576, 32563, 32578, 32559, 32585, 32550, 
-    32597, 32526, 32653, 32249, 30249, 28405, 26420, 24529, 22563, 20644, 18702, 16826, 14937, 13113, 11289, 9566, 
-    7882, 6300, 4763, 3333, 1978, 733, -440, -1533, -2586, -3582, -4563, -5508, -6439, -7338, -8263, -9181, 
-    -10138, -11091, -12077, -13064, -14085, -15134, -16255, -17406, -18612, -19824, -21075, -22326, -23604, -24865, -26138, -27397, 
-    -28660, -29902, -31124, -32258, -32657, -32620, -32640, -32625, -32638, -32628, -32636, -32627, -32635, -32628, -32634, -32628, 
-    -32634, -32627, -32634, -32627, -32635, -32628, -32635, -32627, -32634, -32628, -32636, -32629, -32633, -32631, -32634, -32630, 
-    -32634, -32630, -32633, -32632, -32632, -32631, -32632, -32631, -32630, -32629, -32629, -32632, -32630, -32631, -32633, -32630, 
-    -32635, -32629, -32634, -32632, -32629, -32636, -32627, -32637, -32627, -32634, -32629, -32635, -32627, -32635, -32626, -32638, 
-    -32624, -32643, -32614, -32670, -32313, -30252, -28233, -26134, -24045, -21903, -19777, -17626, -15507, -13397, -11339, -9310, 
-    -7347, -5403, -3525, -1657, 150, 1943, 3673, 5385, 7043, 8688, 10291, 11886, 13437, 14972, 16468, 17952, 
-    19394, 20847, 22249, 23692, 25072, 26530, 27901, 29381, 30727, 32250, 32643, 32535, 32593, 32554, 32584, 32559, 
-    32579, 32563, 32575, 32565, 32576, 32565, 32575, 32566, 32575, 32567, 32574, 32567, 32573, 32567, 32575, 32566, 
-    32575, 32566, 32575, 32568, 32572, 32568, 32573, 32568, 32574, 32566, 32573, 32568, 32573, 32569, 32571, 32570, 
-    32570, 32572, 32567, 32573, 32567, 32573, 32568, 32571, 32571, 32567, 32574, 32566, 32574, 32567, 32574, 32567, 
-    32572, 32567, 32572, 32570, 32572, 32568, 32573, 32567, 32575, 32565, 32574, 32566, 32574, 32566, 32577, 32560, 
-    32587, 32544, 32632, 31954, 29838, 27556, 25245, 22910, 20544, 18166, 15773, 13367, 10933, 8493, 6038, 3590, 
-    1146, -1281, -3687, -6076, -8417, -10724, -12979, -15186, -17334, -19424, -21450, -23423, -25321, -27185, -28961, -30751, 
-    -32286, -32654, -32627, -32634, -32633, -32630, -32632, -32633, -32631, -32634, -32630, -32632, -32632, -32632, -32632, -32632, 
-    -32631, -32631, -32632, -32631, -32631, -32633, -32630, -32634, -32627, -32636, -32628, -32637, -32627, -32636, -32627, -32635, 
-    -32629, -32632, -32630, -32632, -32630, -32635, -32630, -32635, -32629, -32634, -32631, -32632, -32631, -32630, -32632, -32633, 
-    -32629, -32634, -32628, -32635, -32630, -32636, -32629, -32634, -32630, -32635, -32630, -32633, -32628, -32634, -32629, -32635, 
-    -32627, -32636, -32625, -32636, -32625, -32637, -32628, -32636, -32628, -32637, -32624, -32639, -32623, -32643, -32617, -32644, 
-    -30650, -27440, -24288, -21040, -17827, -14553, -11322, -8060, -4845, -1630, 1525, 4661, 7735, 10778, 13761, 16690, 
-    19568, 22364, 25125, 27768, 30453, 32375, 32586, 32572, 32565, 32577, 32565, 32573, 32569, 32570, 32571, 32569, 
-    32572, 32569, 32570, 32572, 32567, 32574, 32564, 32575, 32567, 32573, 32569, 32570, 32570, 32570, 32570, 32571, 
-    32570, 32573, 32566, 32576, 32566, 32575, 32566, 32575, 32565, 32576, 32566, 32574, 32567, 32572, 32570, 32571, 
-    32571, 32571, 32569, 32573, 32567, 32576, 32564, 32576, 32564, 32575, 32564, 32575, 32566, 32574, 32566, 32574, 
-    32565, 32578, 32562, 32579, 32562, 32579, 32564, 32576, 32562, 32581, 32559, 32585, 32555, 32586, 32554, 32588, 
-    32552, 32591, 32545, 32602, 32529, 32627, 32479, 32767, 30608, 27386, 24466, 21302, 18252, 15069, 11961, 8766, 
-    5639, 2453, -655, -3793, -6853, -9916, -12911, -15885, -18802, -21671, -24506, -27238, -30032, -32273, -32652, -32632, 
-    -32628, -32637, -32627, -32638, -32625, -32640, -32624, -32640, -32625, -32639, -32626, -32636, -32629, -32635, -32627, -32638, 
-    -32625, -32640, -32624, -32639, -32624, -32641, -32626, -32637, -32627, -32635, -32630, -32635, -32629, -32636, -32629, -32635, 
-    -32630, -32634, -32629, -32633, -32626, -32635, -32623, -32639, -32623, -32641, -32624, -32638, -32624, -32638, -32626, -32638, 
-    -32627, -32636, -32627, -32636, -32626, -32635, -32625, -32636, -32626, -32636, -32626, -32637, -32622, -32640, -32623, -32640, 
-    -32623, -32637, -32621, -32640, -32620, -32646, -32619, -32646, -32617, -32648, -32613, -32651, -32606, -32659, -32599, -32677, 
-    -32564, -32734, -30802, -27947, -25341, -22501, -19745, -16856, -14020, -11096, -8224, -5293, -2436, 462, 3268, 6094, 
-    8825, 11559, 14194, 16835, 19363, 21913, 24319, 26800, 29056, 31577, 32619, 32530, 32598, 32551, 32586, 32558, 
-    32581, 32561, 32578, 32564, 32576, 32567, 32575, 32565, 32576, 32565, 32577, 32563, 32577, 32563, 32578, 32562, 
-    32576, 32563, 32576, 32565, 32572, 32566, 32571, 32568, 32572, 32564, 32576, 32563, 32575, 32564, 32573, 32567, 
-    32574, 32567, 32575, 32566, 32576, 32564, 32577, 32563, 32578, 32561, 32578, 32564, 32574, 32567, 32574, 32565, 
-    32578, 32563, 32577, 32563, 32577, 32563, 32578, 32563, 32577, 32562, 32579, 32560, 32578, 32559, 32583, 32558, 
-    32585, 32551, 32593, 32546, 32596, 32538, 32604, 32526, 32628, 32481, 32749, 31317, 28669, 26381, 23832, 21428, 
-    18864, 16378, 13778, 11220, 8571, 5948, 3247, 566, -2181, -4915, -7696, -10467, -13278, -16073, -18905, -21701, 
-    -24538, -27301, -30170, -32345, -32673, -32617, -32641, -32623, -32638, -32628, -32636, -32626, -32632, -32631, -32629, -32632, 
-    -32631, -32630, -32633, -32626, -32634, -32630, -32634, -32629, -32633, -32626, -32637, -32623, -32639, -32625, -32639, -32626, 
-    -32637, -32628, -32638, -32627, -32635, -32629, -32633, -32629, -32634, -32627, -32636, -32630, -32635, -32630, -32634, -32631, 
-    -32634, -32628, -32635, -32627, -32635, -32629, -32632, -32629, -32633, -32630, -32636, -32627, -32637, -32627, -32638, -32626, 
-    -32637, -32627, -32636, -32627, -32638, -32625, -32641, -32622, -32643, -32621, -32644, -32616, -32653, -32594, -32716, -31153, 
-    -28520, -25959, -23307, -20682, -18003, -15338, -12635, -9949, -7233, -4541, -1837, 833, 3501, 6123, 8733, 11285, 
-    13824, 16287, 18742, 21102, 23456, 25707, 27945, 30082, 32179, 32585, 32564, 32573, 32567, 32572, 32568, 32573, 
-    32566, 32574, 32567, 32574, 32566, 32573, 32567, 32572, 32568, 32571, 32570, 32569, 32572, 32568, 32571, 32567, 
-    32572, 32565, 32574, 32565, 32574, 32567, 32572, 32570, 32570, 32568, 32574, 32566, 32576, 32564, 32573, 32566, 
-    32573, 32566, 32575, 32565, 32577, 32563, 32577, 32563, 32577, 32564, 32578, 32563, 32577, 32562, 32577, 32563, 
-    32579, 32561, 32582, 32558, 32584, 32558, 32583, 32557, 32584, 32555, 32585, 32556, 32586, 32553, 32588, 32548, 
-    32600, 32534, 32619, 32494, 32719, 31909, 29198, 26721, 24103, 21615, 19064, 16603, 14107, 11678, 9227, 6814, 
-    4393, 1993, -412, -2812, -5215, -7625, -10030, -12459, -14867, -17313, -19707, -22156, -24510, -26955, -29207, -31726, 
-    -32722, -32572, -32675, -32600, -32659, -32609, -32655, -32612, -32650, -32614, -32646, -32621, -32642, -32623, -32638, -32626, 
-    -32640, -32623, -32637, -32624, -32636, -32625, -32634, -32627, -32637, -32626, -32637, -32627, -32637, -32627, -32635, -32629, 
-    -32635, -32627, -32638, -32625, -32638, -32627, -32636, -32628, -32636, -32627, -32636, -32627, -32635, -32630, -32634, -32629, 
-    -32635, -32630, -32634, -32630, -32633, -32630, -32635, -32629, -32637, -32625, -32638, -32625, -32637, -32627, -32636, -32628, 
-    -32636, -32626, -32638, -32626, -32638, -32626, -32637, -32627, -32639, -32623, -32646, -32608, -32681, -32446, -30421, -28266, 
-    -26020, -23773, -21445, -19113, -16718, -14312, -11858, -9389, -6885, -4370, -1821, 733, 3330, 5922, 8564, 11190, 
-    13870, 16518, 19216, 21867, 24577, 27194, 29953, 32196, 32594, 32567, 32571, 32572, 32568, 32571, 32568, 32572, 
-    32569, 32571, 32568, 32572, 32568, 32573, 32569, 32572, 32568, 32572, 32568, 32571, 32568, 32570, 32569, 32569, 
-    32572, 32568, 32572, 32567, 32572, 32569, 32571, 32570, 32569, 32572, 32571, 32570, 32569, 32568, 32573, 32566, 
-    32572, 32567, 32570, 32568, 32571, 32569, 32571, 32570, 32569, 32571, 32569, 32570, 32568, 32569, 32570, 32570, 
-    32568, 32582, 32408, 31311, 29894, 28572, 27193, 25868, 24520, 23218, 21907, 20637, 19369, 18139, 16910, 15717, 
-    14521, 13352, 12174, 11010, 9832, 8659, 7457, 6246, 4997, 3725, 2403, 1049, -364, -1813, -3328, -4877, 
-    -6492, -8135, -9842, -11576, -13355, -15175, -17013, -18886, -20779, -22677, -24598, -26490, -28405, -30268, -32135, -32648, 
-    -32620, -32639, -32625, -32636, -32630, -32631, -32634, -32630, -32634, -32630, -32631, -32634, -32630, -32634, -32630, -32632, 
-    -32630, -32630, -32629, -32631, -32628, -32632, -32633, -32631, -32633, -32631, -32633, -32632, -32630, -32633, -32631, -32631, 
-    -32631, -32630, -32630, -32633, -32630, -32633, -32629, -32632, -32630, -32631, -32631, -32630, -32635, -32629, -32636, -32626, 
-    -32614, -31661, -29942, -28273, -26570, -24879, -23174, -21481, -19787, -18100, -16426, -14762, -13115, -11489, -9875, -8299, 
-    -6731, -5210, -3700, -2238, -802, 593, 1955, 3276, 4556, 5798, 6994, 8148, 9265, 10335, 11379, 12379, 
-    13361, 14307, 15242, 16151, 17063, 17946, 18852, 19727, 20635, 21523, 22443, 23353, 24299, 25228, 26203, 27150, 
-    28150, 29112, 30140, 31087, 32170, 32650, 32530, 32596, 32552, 32584, 32560, 32580, 32559, 32579, 32560, 32578, 
-    32562, 32579, 32562, 32577, 32563, 32576, 32565, 32574, 32567, 32576, 32564, 32577, 32564, 32575, 32565, 32573, 
-    32568, 32572, 32568, 32573, 32567, 32574, 32565, 32576, 32564, 32578, 32562, 32565, 32137, 31309, 30499, 29615, 
-    28704, 27718, 26694, 25594, 24447, 23223, 21948, 20604, 19214, 17762, 16268, 14725, 13146, 11543, 9912, 8276, 
-    6632, 4999, 3383, 1792, 226, -1293, -2779, -4205, -5583, -6909, -8173, -9384, -10537, -11642, -12697, -13715, 
-    -14692, -15645, -16566, -17475, -18366, -19251, -20125, -21000, -21871, -22743, -23613, -24479, -25347, -26203, -27062, -27898, 
-    -28729, -29534, -30317, -31070, -31794, -32443, -32652, -32623, -32636, -32629, -32632, -32630, -32631, -32632, -32632, -32630, 
-    -32632, -32630, -32632, -32632, -32633, -32631, -32632, -32633, -32632, -32631, -32632, -32631, -32634, -32632, -32631, -32633, 
-    -32629, -32637, -32625, -32642, -32508, -31972, -31428, -30822, -30202, -29515, -28808, -28040, -27235, -26373, -25472, -24511, 
-    -23513, -22452, -21360, -20209, -19027, -17797, -16540, -15248, -13939, -12608, -11266, -9913, -8561, -7206, -5858, -4521, 
-    -3193, -1893, -598, 661, 1909, 3131, 4332, 5515, 6672, 7815, 8933, 10040, 11125, 12197, 13258, 14305, 
-    15338, 16361, 17369, 18358, 19334, 20287, 21219, 22126, 23006, 23856, 24675, 25451, 26202, 26903, 27571, 28189, 
-    28766, 29299, 29780, 30221, 30610, 30958, 31256, 31515, 31728, 31904, 32035, 32130, 32190, 32212, 32203, 32156, 
-    32081, 31968, 31832, 31659, 31464, 31247, 30995, 30735, 30430, 30122, 29771, 29417, 29021, 28624, 28189, 27748, 
-    27285, 26806, 26314, 25805, 25285, 24751, 24204, 23648, 23075, 22494, 21893, 21285, 20656, 20011, 19348, 18665, 
-    17968, 17244, 16501, 15735, 14952, 14141, 13312, 12455, 11579, 10671, 9742, 8786, 7807, 6803, 5770, 4721, 
-    3644, 2557, 1441, 317, -816, -1965, -3115, -4274, -5433, -6583, -7737, -8866, -9998, -11094, -12183, -13231, 
-    -14264, -15257, -16221, -17144, -18035, -18880, -19697, -20457, -21198, -21880, -22542, -23148, -23740, -24279, -24810, -25293, 
-    -25765, -26206, -26621, -27023, -27396, -27753, -28086, -28398, -28688, -28949, -29180, -29382, -29547, -29677, -29764, -29807, 
-    -29805, -29750, -29652, -29496, -29296, -29041, -28740, -28394, -28010, -27582, -27125, -26638, -26123, -25588, -25041, -24476, 
-    -23922, -23345, -22795, -22236, -21697, -21167, -20651, -20148, -19661, -19178, -18711, -18242, -17779, -17310, -16836, -16338, 
-    -15834, -15293, -14736, -14142, -13511, -12846, -12140, -11387, -10605, -9773, -8915, -8021, -7100, -6152, -5187, -4202, 
-    -3213, -2212, -1214, -217, 764, 1744, 2689, 3630, 4524, 5412, 6259, 7081, 7882, 8643, 9394, 10106, 
-    10800, 11470, 12119, 12745, 13362, 13944, 14535, 15087, 15653, 16185, 16724, 17242, 17761, 18262, 18759, 19241, 
-    19714, 20173, 20613, 21051, 21462, 21868, 22249, 22613, 22958, 23269, 23562, 23814, 24035, 24222, 24364, 24467, 
-    24526, 24540, 24511, 24431, 24314, 24149, 23943, 23698, 23410, 23096, 22741, 22370, 21959, 21534, 21080, 20618, 
-    20131, 19635, 19124, 18605, 18080, 17550, 17016, 16487, 15956, 15429, 14903, 14378, 13861, 13343, 12827, 12317, 
-    11808, 11300, 10795, 10294, 9795, 9297, 8805, 8312, 7833, 7345, 6869, 6396, 5924, 5464, 4998, 4539, 
-    4082, 3619, 3165, 2699, 2242, 1773, 1307, 834, 362, -118, -603, -1094, -1587, -2084, -2584, -3088, 
-    -3594, -4098, -4615, -5117, -5643, -6148, -6673, -7182, -7705, -8221, -8745, -9259, -9781, -10290, -10807, -11306, 
-    -11805, -12290, -12768, -13229, -13679, -14104, -14519, -14900, -15263, -15595, -15901, -16173, -16416, -16625, -16804, -16950, 
-    -17065, -17146, -17202, -17223, -17224, -17192, -17144, -17067, -16982, -16860, -16752, -16594, -16466, -16290, -16142, -15961, 
-    -15794, -15611, -15426, -15240, -15041, -14846, -14631, -14409, -14176, -13920, -13651, -13355, -13038, -12698, -12329, -11941, 
-    -11527, -11095, -10638, -10172, -9688, -9198, -8698, -8197, -7697, -7199, -6715, -6235, -5785, -5344, -4941, -4551, 
-    -4207, -3882, -3601, -3352, -3137, -2956, -2809, -2691, -2604, -2536, -2491, -2459, -2443, -2425, -2415, -2396, 
-    -2370, -2333, -2278, -2207, -2115, -2002, -1869, -1705, -1530, -1318, -1102, -847, -587, -297, -6, 307, 
-    625, 957, 1296, 1638, 1985, 2338, 2684, 3041, 3380, 3731, 4065, 4405, 4732, 5063, 5386, 5711, 
-    6029, 6357, 6675, 7005, 7331, 7660, 7996, 8328, 8663, 9000, 9329, 9654, 9978, 10278, 10581, 10850, 
-    11111, 11343, 11543, 11723, 11858, 11971, 12034, 12071, 12060, 12022, 11943, 11830, 11687, 11513, 11317, 11096, 
-    10864, 10618, 10368, 10110, 9858, 9613, 9374, 9156, 8948, 8767, 8603, 8465, 8350, 8265, 8194, 8165, 
-    8138, 8152, 8163, 8203, 8240, 8291, 8339, 8381, 8423, 8442, 8459, 8445, 8416, 8361, 8279, 8171, 
-    8028, 7862, 7663, 7436, 7183, 6904, 6602, 6282, 5939, 5587, 5218, 4844, 4464, 4075, 3700, 3315, 
-    2961, 2595, 2271, 1946, 1655, 1380, 1134, 910, 713, 541, 391, 264, 150, 58, -27, -99, 
-    -168, -235, -298, -369, -442, -532, -631, -745, -881, -1026, -1203, -1386, -1599, -1827, -2068, -2335, 
-    -2599, -2889, -3175, -3465, -3757, -4034, -4317, -4570, -4819, -5043, -5253, -5433, -5596, -5737, -5852, -5952, 
-    -6019, -6081, -6115, -6145, -6163, -6172, -6183, -6188, -6206, -6224, -6257, -6297, -6351, -6425, -6503, -6610, 
-    -6716, -6858, -6993, -7160, -7322, -7501, -7685, -7865, -8054, -8234, -8404, -8574, -8717, -8862, -8978, -9078, 
-    -9163, -9214, -9258, -9267, -9268, -9245, -9209, -9160, -9094, -9035, -8947, -8881, -8785, -8721, -8624, -8562, 
-    -8482, -8423, -8362, -8311, -8271, -8237, -8205, -8188, -8166, -8162, -8151, -8147, -8147, -8140, -8143, -8129, 
-    -8123, -8098, -8077, -8037, -7993, -7935, -7869, -7785, -7695, -7576, -7454, -7303, -7143, -6957, -6753, -6532, 
-    -6288, -6025, -5743, -5438, -5120, -4780, -4426, -4055, -3668, -3263, -2853, -2425, -1996, -1556, -1111, -667, 
-    -218, 223, 661, 1093, 1513, 1926, 2321, 2707, 3073, 3432, 3761, 4095, 4390, 4696, 4968, 5246, 
-    5505, 5762, 6011, 6257, 6501, 6748, 6996, 7244, 7498, 7755, 8012, 8280, 8538, 8815, 9079, 9353, 
-    9616, 9882, 10142, 10399, 10648, 10890, 11127, 11348, 11572, 11772, 11979, 12158, 12344, 12506, 12670, 12818, 
-    12968, 13105, 13243, 13370, 13496, 13620, 13736, 13852, 13960, 14066, 14167, 14257, 14339, 14411, 14469, 14504, 
-    14532, 14523, 14509, 14455, 14390, 14283, 14158, 13994, 13802, 13577, 13314, 13028, 12699, 12352, 11962, 11560, 
-    11112, 10657, 10166, 9662, 9137, 8594, 8044, 7478, 6905, 6329, 5743, 5166, 4582, 4017, 3446, 2896, 
-    2343, 1815, 1290, 784, 286, -185, -655, -1097, -1532, -1943, -2340, -2721, -3085, -3431, -3759, -4073, 
-    -4370, -4653, -4916, -5172, -5408, -5643, -5856, -6072, -6270, -6466, -6658, -6831, -7017, -7177, -7349, -7503, 
-    -7658, -7805, -7947, -8078, -8203, -8326, -8431, -8546, -8633, -8736, -8813, -8900, -8968, -9044, -9104, -9175, 
-    -9232, -9301, -9354, -9427, -9481, -9556, -9616, -9694, -9771, -9844, -9932, -10009, -10102, -10183, -10272, -10357, 
-    -10439, -10518, -10588, -10660, -10717, -10775, -10814, -10853, -10871, -10888, -10880, -10879, -10844, -10819, -10765, -10713, 
-    -10645, -10563, -10485, -10383, -10289, -10170, -10065, -9930, -9813, -9670, -9539, -9389, -9247, -9085, -8939, -8761, 
-    -8604, -8413, -8236, -8035, -7834, -7617, -7396, -7160, -6916, -6657, -6384, -6097, -5790, -5472, -5136, -4785, 
-    -4419, -4034, -3644, -3233, -2820, -2394, -1966, -1531, -1092, -658, -225, 199, 618, 1024, 1415, 1793, 
-    2146, 2488, 2794, 3096, 3352, 3607, 3814, 4019, 4179, 4335, 4453, 4564, 4646, 4717, 4777, 4819, 
-    4861, 4889, 4919, 4951, 4977, 5018, 5052, 5105, 5159, 5226, 5301, 5388, 5483, 5595, 5710, 5844, 
-    5972, 6120, 6265, 6415, 6570, 6718, 6868, 7020, 7155, 7302, 7426, 7562, 7680, 7801, 7909, 8015, 
-    8113, 8206, 8298, 8384, 8467, 8553, 8634, 8722, 8812, 8903, 9008, 9111, 9229, 9346, 9479, 9613, 
-    9762, 9910, 10068, 10228, 10388, 10552, 10704, 10862, 11002, 11139, 11260, 11362, 11454, 11519, 11567, 11587, 
-    11590, 11559, 11504, 11420, 11311, 11174, 11011, 10819, 10608, 10367, 10111, 9828, 9531, 9214, 8884, 8535, 
-    8182, 7806, 7431, 7044, 6652, 6258, 5859, 5460, 5062, 4664, 4271, 3880, 3504, 3125, 2770, 2412, 
-    2080, 1751, 1445, 1150, 874, 613, 373, 148, -54, -245, -413, -569, -702, -833, -938, -1045, 
-    -1137, -1227, -1317, -1402, -1496, -1588, -1693, -1804, -1925, -2058, -2203, -2365, -2539, -2735, -2942, -3170, 
-    -3407, -3670, -3933, -4224, -4514, -4827, -5139, -5465, -5792, -6134, -6465, -6815, -7148, -7500, -7836, -8180, 
-    -8512, -8849, -9178, -9510, -9828, -10152, -10462, -10773, -11072, -11370, -11650, -11931, -12188, -12444, -12676, -12901, 
-    -13105, -13289, -13463, -13606, -13740, -13842, -13929, -13997, -14038, -14066, -14069, -14059, -14030, -13979, -13920, -13835, 
-    -13744, -13635, -13516, -13383, -13242, -13088, -12928, -12754, -12582, -12393, -12201, -12004, -11796, -11595, -11373, -11168, 
-    -10942, -10730, -10509, -10288, -10075, -9852, -9644, -9429, -9221, -9016, -8814, -8616, -8426, -8235, -8056, -7872, 
-    -7695, -7523, -7348, -7179, -7002, -6828, -6650, -6464, -6275, -6072, -5863, -5643, -5410, -5164, -4904, -4629, 
-    -4340, -4034, -3715, -3374, -3022, -2644, -2264, -1850, -1435, -989, -542, -63, 414, 927, 1433, 1972, 
-    2509, 3069, 3627, 4209, 4785, 5381, 5969, 6577, 7170, 7783, 8374, 8982, 9566, 10162, 10735, 11315, 
-    11869, 12428, 12966, 13495, 14010, 14512, 15001, 15478, 15938, 16390, 16819, 17247, 17654, 18048, 18428, 18797, 
-    19151, 19491, 19815, 20123, 20424, 20699, 20968, 21215, 21445, 21665, 21859, 22041, 22196, 22339, 22451, 22551, 
-    22615, 22666, 22678, 22672, 22633, 22565, 22467, 22338, 22177, 21985, 21756, 21496, 21200, 20874, 20513, 20125, 
-    19697, 19254, 18770, 18272, 17738, 17197, 16628, 16050, 15453, 14847, 14241, 13610, 12999, 12359, 11743, 11108, 
-    10485, 9859, 9234, 8616, 7994, 7381, 6764, 6148, 5535, 4921, 4311, 3690, 3080, 2456, 1839, 1208, 
-    580, -54, -695, -1339, -1997, -2656, -3326, -4010, -4691, -5399, -6104, -6830, -7561, -8305, -9062, -9827, 
-    -10602, -11382, -12175, -12963, -13763, -14557, -15348, -16139, -16916, -17685, -18437, -19174, -19887, -20584, -21248, -21891, 
-    -22500, -23081, -23630, -24149, -24636, -25086, -25508, -25892, -26257, -26581, -26884, -27161, -27410, -27648, -27849, -28046, 
-    -28210, -28365, -28495, -28606, -28695, -28760, -28804, -28819, -28805, -28761, -28680, -28569, -28416, -28221, -27983, -27698, 
-    -27366, -26988, -26552, -26075, -25540, -24962, -24332, -23661, -22942, -22190, -21392, -20567, -19713, -18835, -17940, -17024, 
-    -16109, -15184, -14258, -13343, -12424, -11533, -10636, -9770, -8910, -8072, -7251, -6448, -5662, -4889, -4130, -3380, 
-    -2640, -1900, -1162, -422, 324, 1075, 1842, 2617, 3411, 4221, 5043, 5894, 6750, 7635, 8526, 9435, 
-    10354, 11280, 12208, 13135, 14060, 14966, 15874, 16745, 17613, 18442, 19250, 20026, 20768, 21475, 22147, 22781, 
-    23381, 23943, 24463, 24961, 25413, 25847, 26239, 26612, 26955, 27275, 27568, 27847, 28098, 28338, 28554, 28752, 
-    28940, 29103, 29255, 29386, 29502, 29592, 29667, 29712, 29736, 29730, 29691, 29626, 29520, 29380, 29203, 28984, 
-    28728, 28428, 28087, 27705, 27277, 26816, 26301, 25761, 25167, 24554, 23890, 23211, 22488, 21750, 20974, 20189, 
-    19373, 18548, 17702, 16849, 15979, 15114, 14227, 13351, 12459, 11578, 10691, 9810, 8922, 8048, 7161, 6288, 
-    5408, 4532, 3657, 2772, 1899, 1010, 126, -772, -1668, -2576, -3491, -4407, -5345, -6269, -7222, -8162, 
-    -9122, -10072, -11032, -11983, -12940, -13880, -14822, -15745, -16658, -17551, -18423, -19274, -20104, -20890, -21661, -22383, 
-    -23078, -23732, -24344, -24919, -25452, -25938, -26394, -26791, -27169, -27486, -27785, -28031, -28256, -28437, -28598, -28718, 
-    -28816, -28884, -28929, -28947, -28941, -28913, -28862, -28790, -28698, -28584, -28455, -28298, -28133, -27938, -27731, -27495, 
-    -27248, -26970, -26675, -26347, -25998, -25627, -25218, -24793, -24326, -23843, -23322, -22777, -22193, -21588, -20941, -20273, 
-    -19561, -18826, -18051, -17250, -16413, -15549, -14657, -13734, -12791, -11820, -10833, -9825, -8807, -7771, -6733, -5688, 
-    -4639, -3595, -2550, -1516, -486, 532, 1538, 2529, 3508, 4464, 5402, 6325, 7218, 8104, 8949, 9788, 
-    10588, 11382, 12141, 12888, 13606, 14312, 14995, 15661, 16311, 16942, 17563, 18158, 18750, 19311, 19873, 20397, 
-    20926, 21419, 21906, 22367, 22809, 23229, 23627, 24000, 24346, 24669, 24954, 25220, 25449, 25652, 25824, 25960, 
-    26074, 26151, 26202, 26223, 26214, 26181, 26121, 26034, 25921, 25789, 25627, 25451, 25247, 25029, 24784, 24528, 
-    24242, 23946, 23618, 23276, 22909, 22515, 22100, 21653, 21182, 20681, 20146, 19583, 18990, 18357, 17700, 17003, 
-    16280, 15522, 14728, 13917, 13061, 12200, 11293, 10381, 9438, 8486, 7511, 6531, 5531, 4533, 3517, 2508, 
-    1484, 476, -544, -1549, -2562, -3552, -4548, -5523, -6495, -7450, -8392, -9325, -10235, -11135, -12011, -12876, 
-    -13713, -14534, -15328, -16101, -16846, -17562, -18247, -18902, -19522, -20106, -20655, -21164, -21636, -22063, -22453, -22799, 
-    -23108, -23374, -23596, -23788, -23935, -24054, -24135, -24186, -24207, -24198, -24167, -24105, -24029, -23924, -23809, -23669, 
-    -23521, -23355, -23174, -22980, -22773, -22551, -22316, -22056, -21790, -21489, -21184, -20837, -20483, -20083, -19668, -19208, 
-    -18730, -18206, -17657, -17064, -16447, -15796, -15112, -14404, -13663, -12907, -12123, -11323, -10511, -9677, -8850, -7997, 
-    -7162, -6303, -5468, -4620, -3793, -2961, -2150, -1340, -548, 233, 1003, 1762, 2504, 3243, 3963, 4683, 
-    5390, 6089, 6789, 7473, 8164, 8843, 9520, 10192, 10857, 11523, 12172, 12819, 13451, 14077, 14689, 15282, 
-    15865, 16423, 16969, 17484, 17988, 18454, 18905, 19321, 19710, 20071, 20397, 20694, 20959, 21187, 21387, 21550, 
-    21680, 21783, 21844, 21885, 21885, 21864, 21807, 21727, 21617, 21481, 21323, 21136, 20925, 20693, 20439, 20166, 
-    19870, 19556, 19223, 18868, 18500, 18105, 17700, 17267, 16826, 16353, 15876, 15369, 14853, 14307, 13754, 13171, 
-    12583, 11960, 11334, 10681, 10017, 9333, 8634, 7921, 7192, 6450, 5694, 4929, 4153, 3372, 2580, 1792, 
-    996, 203, -589, -1380, -2165, -2946, -3717, -4483, -5235, -5982, -6711, -7430, -8132, -8820, -9492, -10149, 
-    -10788, -11405, -12009, -12587, -13152, -13692, -14218, -14717, -15209, -15668, -16124, -16547, -16969, -17361, -17753, -18110, 
-    -18471, -18799, -19125, -19426, -19721, -19990, -20256, -20493, -20727, -20934, -21129, -21303, -21457, -21598, -21705, -21804, 
-    -21862, -21918, -21921, -21925, -21873, -21816, -21705, -21580, -21412, -21216, -20982, -20715, -20409, -20079, -19699, -19295, 
-    -18846, -18363, -17853, -17296, -16716, -16100, -15449, -14777, -14063, -13339, -12583, -11808, -11018, -10210, -9397, -8565, 
-    -7743, -6903, -6079, -5246, -4431, -3624, -2821, -2043, -1266, -515, 223, 949, 1654, 2350, 3026, 3687, 
-    4343, 4979, 5613, 6233, 6852, 7463, 8074, 8676, 9281, 9876, 10478, 11070, 11653, 12245, 12809, 13384, 
-    13927, 14473, 14993, 15501, 15984, 16445, 16884, 17291, 17678, 18031, 18360, 18651, 18923, 19156, 19371, 19547, 
-    19704, 19829, 19928, 20011, 20063, 20105, 20118, 20125, 20110, 20086, 20047, 19998, 19937, 19872, 19789, 19710, 
-    19613, 19519, 19409, 19301, 19176, 19054, 18909, 18772, 18604, 18443, 18256, 18062, 17849, 17617, 17370, 17094, 
-    16806, 16483, 16148, 15771, 15377, 14947, 14490, 13999, 13480, 12928, 12347, 11733, 11094, 10421, 9728, 9003, 
-    8261, 7494, 6709, 5909, 5094, 4270, 3433, 2598, 1753, 913, 77, -758, -1581, -2396, -3201, -3993, 
-    -4770, -5531, -6273, -7004, -7709, -8402, -9073, -9723, -10357, -10968, -11563, -12132, -12687, -13218, -13739, -14228, 
-    -14711, -15168, -15612, -16040, -16445, -16843, -17218, -17582, -17926, -18257, -18569, -18870, -19146, -19411, -19653, -19875, 
-    -20084, -20258, -20431, -20562, -20690, -20778, -20863, -20902, -20945, -20936, -20928, -20872, -20807, -20707, -20584, -20437, 
-    -20259, -20065, -19840, -19594, -19331, -19033, -18739, -18395, -18065, -17686, -17317, -16909, -16497, -16063, -15615, -15152, 
-    -14673, -14176, -13675, -13152, -12631, -12087, -11549, -10990, -10442, -9875, -9315, -8747, -8178, -7609, -7042, -6469, 
-    -5907, -5332, -4773, -4200, -3641, -3071, -2513, -1941, -1385, -813, -254, 312, 878, 1442, 2008, 2570, 
-    3137, 3694, 4254, 4805, 5354, 5891, 6426, 6945, 7461, 7958, 8448, 8921, 9385, 9830, 10259, 10678, 
-    11072, 11462, 11825, 12179, 12520, 12840, 13158, 13454, 13748, 14025, 14294, 14558, 14807, 15051, 15284, 15506, 
-    15724, 15922, 16122, 16294, 16465, 16621, 16752, 16886, 16976, 17076, 17133, 17184, 17204, 17204, 17182, 17130, 
-    17064, 16957, 16842, 16684, 16513, 16307, 16082, 15829, 15556, 15258, 14946, 14610, 14265, 13902, 13532, 13146, 
-    12762, 12357, 11967, 11555, 11161, 10751, 10354, 9950, 9554, 9158, 8762, 8369, 7976, 7590, 7194, 6804, 
-    6408, 6015, 5614, 5207, 4800, 4384, 3963, 3531, 3098, 2652, 2203, 1748, 1284, 820, 347, -122, 
-    -591, -1060, -1523, -1980, -2427, -2865, -3291, -3704, -4099, -4483, -4849, -5196, -5529, -5841, -6139, -6417, 
-    -6683, -6925, -7161, -7368, -7579, -7760, -7939, -8102, -8252, -8402, -8529, -8659, -8773, -8883, -8987, -9077, 
-    -9165, -9243, -9314, -9376, -9426, -9475, -9505, -9533, -9544, -9550, -9548, -9531, -9509, -9479, -9441, -9400, 
-    -9347, -9297, -9237, -9181, -9117, -9060, -8993, -8935, -8863, -8808, -8730, -8678, -8595, -8538, -8459, -8385, 
-    -8314, -8226, -8151, -8056, -7966, -7870, -7767, -7662, -7550, -7432, -7317, -7187, -7066, -6929, -6799, -6661, 
-    -6522, -6387, -6242, -6105, -5964, -5824, -5687, -5547, -5411, -5274, -5144, -5006, -4879, -4745, -4618, -4488, 
-    -4358, -4228, -4096, -3961, -3825, -3685, -3541, -3393, -3237, -3082, -2917, -2751, -2576, -2397, -2214, -2024, 
-    -1829, -1630, -1425, -1219, -1001, -790, -565, -349, -121, 98, 321, 540, 760, 969, 1180, 1377, 
-    1575, 1757, 1936, 2106, 2265, 2421, 2556, 2697, 2816, 2937, 3042, 3144, 3236, 3324, 3407, 3482, 
-    3560, 3627, 3702, 3766, 3836, 3900, 3970, 4035, 4107, 4172, 4246, 4312, 4390, 4457, 4537, 4603, 
-    4682, 4746, 4827, 4882, 4963, 5016, 5090, 5145, 5210, 5270, 5329, 5382, 5445, 5495, 5559, 5606, 
-    5667, 5725, 5779, 5844, 5901, 5972, 6034, 6118, 6186, 6281, 6361, 6470, 6564, 6681, 6797, 6923, 
-    7054, 7190, 7333, 7474, 7619, 7763, 7906, 8040, 8175, 8301, 8416, 8527, 8619, 8708, 8773, 8832, 
-    8871, 8890, 8901, 8880, 8858, 8800, 8737, 8653, 8543, 8434, 8286, 8147, 7971, 7801, 7600, 7400, 
-    7180, 6953, 6720, 6470, 6225, 5959, 5700, 5425, 5154, 4867, 4588, 4293, 4007, 3709, 3415, 3115, 
-    2816, 2514, 2215, 1912, 1615, 1312, 1023, 723, 438, 145, -132, -415, -690, -965, -1228, -1494, 
-    -1748, -2005, -2246, -2486, -2719, -2946, -3165, -3376, -3585, -3779, -3979, -4155, -4342, -4506, -4678, -4830, 
-    -4989, -5124, -5273, -5397, -5532, -5649, -5772, -5884, -5998, -6109, -6219, -6330, -6441, -6557, -6671, -6794, 
-    -6919, -7048, -7192, -7327, -7486, -7637, -7804, -7974, -8150, -8331, -8521, -8703, -8908, -9095, -9302, -9490, 
-    -9696, -9883, -10080, -10259, -10440, -10610, -10774, -10924, -11067, -11191, -11314, -11414, -11506, -11576, -11637, -11676, 
-    -11705, -11707, -11698, -11664, -11616, -11543, -11454, -11339, -11209, -11051, -10876, -10675, -10455, -10213, -9946, -9668, 
-    -9360, -9045, -8697, -8350, -7973, -7591, -7190, -6785, -6368, -5949, -5520, -5091, -4661, -4229, -3807, -3379, 
-    -2966, -2550, -2155, -1760, -1376, -999, -636, -281, 67, 407, 738, 1063, 1381, 1693, 2004, 2310, 
-    2613, 2919, 3214, 3521, 3815, 4120, 4417, 4716, 5014, 5308, 5603, 5892, 6179, 6459, 6734, 7000, 
-    7262, 7507, 7754, 7973, 8202, 8399, 8598, 8783, 8949, 9116, 9261, 9406, 9539, 9663, 9786, 9900, 
-    10012, 10125, 10228, 10340, 10444, 10558, 10660, 10779, 10883, 11000, 11109, 11220, 11334, 11441, 11550, 11652, 
-    11757, 11851, 11942, 12022, 12102, 12166, 12223, 12269, 12299, 12320, 12321, 12310, 12280, 12231, 12166, 12080, 
-    11974, 11851, 11703, 11542, 11347, 11147, 10911, 10665, 10394, 10097, 9792, 9454, 9111, 8739, 8362, 7956, 
-    7551, 7120, 6691, 6240, 5792, 5326, 4867, 4390, 3920, 3443, 2965, 2492, 2011, 1538, 1069, 600, 
-    137, -317, -769, -1208, -1646, -2066, -2483, -2882, -3278, -3650, -4021, -4364, -4707, -5023, -5334, -5617, 
-    -5896, -6146, -6393, -6607, -6819, -7005, -7173, -7334, -7467, -7600, -7705, -7802, -7889, -7962, -8026, -8081, 
-    -8125, -8168, -8199, -8230, -8255, -8277, -8297, -8313, -8328, -8346, -8352, -8369, -8372, -8386, -8389, -8394, 
-    -8396, -8394, -8394, -8383, -8378, -8352, -8340, -8305, -8276, -8232, -8181, -8121, -8055, -7975, -7886, -7789, 
-    -7679, -7562, -7435, -7295, -7159, -6998, -6847, -6684, -6518, -6353, -6180, -6018, -5847, -5691, -5521, -5374, 
-    -5216, -5077, -4932, -4803, -4668, -4553, -4425, -4320, -4199, -4099, -3982, -3882, -3763, -3662, -3537, -3422, 
-    -3290, -3156, -3014, -2859, -2695, -2520, -2337, -2139, -1933, -1716, -1495, -1259, -1027, -778, -541, -289, 
-    -54, 194, 424, 659, 880, 1096, 1301, 1495, 1673, 1848, 2001, 2145, 2273, 2388, 2495, 2582, 
-    2660, 2727, 2780, 2830, 2858, 2892, 2903, 2918, 2922, 2919, 2918, 2900, 2891, 2867, 2848, 2820, 
-    2794, 2762, 2732, 2698, 2666, 2632, 2599, 2570, 2540, 2518, 2494, 2476, 2466, 2456, 2458, 2461, 
-    2469, 2489, 2511, 2538, 2581, 2610, 2671, 2711, 2776, 2834, 2898, 2969, 3033, 3108, 3179, 3250, 
-    3323, 3386, 3460, 3516, 3581, 3636, 3686, 3740, 3776, 3827, 3859, 3903, 3932, 3974, 4004, 4046, 
-    4080, 4125, 4165, 4218, 4266, 4326, 4389, 4456, 4529, 4607, 4687, 4778, 4862, 4956, 5046, 5137, 
-    5229, 5309, 5395, 5469, 5539, 5596, 5649, 5689, 5720, 5740, 5743, 5748, 5723, 5708, 5665, 5626, 
-    5572, 5510, 5442, 5367, 5286, 5200, 5113, 5018, 4929, 4829, 4740, 4640, 4556, 4457, 4374, 4284, 
-    4197, 4117, 4029, 3961, 3873, 3808, 3724, 3660, 3584, 3516, 3447, 3374, 3305, 3232, 3155, 3084, 
-    2998, 2921, 2828, 2741, 2644, 2539, 2438, 2314, 2203, 2062, 1934, 1781, 1633, 1467, 1293, 1114, 
-    919, 725, 508, 291, 58, -175, -430, -680, -953, -1217, -1505, -1790, -2081, -2382, -2679, -2990, 
-    -3290, -3600, -3907, -4212, -4520, -4818, -5123, -5415, -5713, -5997, -6289, -6564, -6841, -7109, -7371, -7629, 
-    -7873, -8116, -8349, -8572, -8791, -8997, -9204, -9391, -9583, -9758, -9937, -10096, -10264, -10408, -10569, -10694, 
-    -10848, -10962, -11097, -11206, -11318, -11423, -11516, -11603, -11683, -11750, -11810, -11853, -11890, -11909, -11915, -11901, 
-    -11878, -11830, -11770, -11685, -11586, -11462, -11318, -11158, -10971, -10772, -10541, -10306, -10038, -9765, -9465, -9159, 
-    -8836, -8499, -8160, -7800, -7447, -7077, -6713, -6341, -5969, -5597, -5228, -4856, -4496, -4126, -3774, -3413, 
-    -3068, -2718, -2380, -2042, -1715, -1385, -1068, -748, -440, -129, 174, 476, 778, 1072, 1376, 1666, 
-    1972, 2264, 2570, 2872, 3181, 3500, 3814, 4151, 4479, 4834, 5185, 5551, 5934, 6318, 6724, 7135, 
-    7555, 7993, 8425, 8883, 9328, 9790, 10250, 10705, 11169, 11615, 12069, 12505, 12932, 13352, 13751, 14145, 
-    14511, 14870, 15201, 15522, 15815, 16092, 16342, 16577, 16778, 16977, 17130, 17284, 17397, 17499, 17574, 17628, 
-    17664, 17674, 17664, 17635, 17581, 17511, 17412, 17301, 17162, 17005, 16827, 16625, 16407, 16165, 15905, 15630, 
-    15329, 15019, 14685, 14340, 13972, 13596, 13198, 12789, 12364, 11920, 11472, 10993, 
-};
-const unsigned int drum_v2_p1_short_len = 5292;
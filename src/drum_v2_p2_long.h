@@ -1,661 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v2_p2_long[] PROGMEM = {
-    40, -15, 23, 18, 33, 33, 38, 35, 33, 26, 25, 11, 9, -7, -9, -27, 
-    -32, -52, -57, -77, -84, -107, -113, -137, -146, -169, -182, -203, -221, -240, -262, -280, 
-    -304, -323, -346, -367, -390, -412, -432, -455, -476, -496, -517, -536, -558, -574, -595, -611, 
-    -631, -644, -665, -676, -696, -707, -726, -738, -752, -768, -779, -796, -806, -824, -835, -850, 
-    -862, -878, -890, -905, -918, -934, -946, -962, -974, -987, -1001, -1013, -1026, -1037, -1049, -1058, 
-    -1069, -1079, -1084, -1094, -1094, -1106, -1103, -1110, -1106, -1112, -1107, -1106, -1100, -1099, -1090, -1086, 
-    -1077, -1070, -1057, -1051, -1035, -1028, -1009, -1001, -981, -969, -951, -934, -915, -897, -874, -855, 
-    -831, -810, -780, -758, -730, -706, -672, -649, -615, -590, -554, -526, -494, -463, -430, -398, 
-    -368, -333, -302, -270, -239, -206, -177, -143, -116, -81, -54, -22, 4, 35, 64, 93, 
-    119, 149, 175, 205, 228, 260, 283, 312, 336, 367, 390, 420, 445, 474, 501, 528, 
-    556, 584, 612, 639, 667, 695, 722, 748, 776, 800, 826, 849, 875, 893, 918, 936, 
-    957, 973, 992, 1007, 1022, 1036, 1050, 1062, 1074, 1085, 1094, 1106, 1113, 1123, 1130, 1139, 
-    1145, 1149, 1158, 1161, 1165, 1168, 1169, 1170, 1168, 1169, 1162, 1158, 1150, 1141, 1132, 1116, 
-    1104, 1086, 1070, 1048, 1027, 1005, 979, 954, 927, 898, 868, 838, 807, 775, 742, 710, 
-    674, 643, 604, 571, 531, 496, 456, 416, 376, 333, 288, 245, 198, 151, 100, 53, 
-    -2, -51, -108, -159, -217, -273, -329, -386, -444, -501, -560, -615, -676, -727, -788, -840, 
-    -897, -946, -1001, -1052, -1102, -1149, -1197, -1243, -1288, -1331, -1371, -1412, -1449, -1486, -1520, -1554, 
-    -1585, -1615, -1644, -1670, -1695, -1719, -1740, -1760, -1777, -1794, -1808, -1820, -1828, -1838, -1842, -1846, 
-    -1844, -1846, -1839, -1832, -1824, -1813, -1796, -1778, -1760, -1735, -1710, -1680, -1651, -1612, -1579, -1537, 
-    -1499, -1450, -1407, -1354, -1307, -1248, -1196, -1135, -1078, -1013, -951, -883, -817, -746, -675, -601, 
-    -527, -449, -372, -293, -210, -130, -45, 38, 123, 211, 295, 388, 472, 565, 654, 743, 
-    835, 924, 1018, 1106, 1198, 1289, 1378, 1467, 1556, 1646, 1731, 1817, 1902, 1985, 2066, 2146, 
-    2221, 2299, 2368, 2442, 2504, 2575, 2632, 2694, 2745, 2801, 2849, 2893, 2937, 2972, 3008, 3038, 
-    3064, 3089, 3103, 3122, 3127, 3138, 3134, 3134, 3124, 3114, 3093, 3073, 3042, 3013, 2972, 2931, 
-    2883, 2829, 2772, 2710, 2642, 2570, 2492, 2413, 2325, 2235, 2140, 2040, 1939, 1828, 1719, 1603, 
-    1485, 1363, 1236, 1109, 975, 843, 702, 565, 419, 276, 127, -22, -173, -330, -483, -641, 
-    -801, -959, -1124, -1282, -1450, -1612, -1777, -1942, -2107, -2274, -2437, -2601, -2765, -2926, -3088, -3245, 
-    -3405, -3559, -3713, -3863, -4012, -4159, -4301, -4444, -4580, -4714, -4849, -4974, -5102, -5221, -5342, -5457, 
-    -5567, -5675, -5778, -5878, -5970, -6062, -6145, -6225, -6297, -6365, -6426, -6481, -6528, -6566, -6598, -6621, 
-    -6635, -6639, -6635, -6620, -6597, -6561, -6515, -6462, -6393, -6316, -6228, -6125, -6017, -5892, -5761, -5612, 
-    -5459, -5287, -5111, -4918, -4720, -4503, -4282, -4045, -3801, -3543, -3277, -3001, -2712, -2417, -2109, -1796, 
-    -1470, -1139, -800, -453, -99, 257, 623, 990, 1365, 1737, 2119, 2494, 2880, 3253, 3640, 4010, 
-    4394, 4760, 5133, 5495, 5856, 6209, 6556, 6896, 7228, 7551, 7867, 8174, 8469, 8757, 9033, 9298, 
-    9552, 9796, 10027, 10248, 10455, 10652, 10834, 11009, 11166, 11316, 11448, 11573, 11682, 11782, 11867, 11942, 
-    12004, 12055, 12093, 12119, 12136, 12138, 12132, 12110, 12086, 12039, 11992, 11926, 11857, 11770, 11681, 11575, 
-    11463, 11338, 11207, 11064, 10909, 10747, 10573, 10393, 10193, 9993, 9775, 9550, 9311, 9059, 8800, 8520, 
-    8235, 7928, 7614, 7278, 6935, 6568, 6188, 5793, 5379, 4949, 4499, 4038, 3552, 3054, 2539, 2003, 
-    1455, 888, 309, -289, -899, -1523, -2162, -2810, -3474, -4142, -4829, -5514, -6217, -6917, -7631, -8344, 
-    -9060, -9777, -10496, -11212, -11924, -12631, -13333, -14022, -14706, -15372, -16029, -16663, -17285, -17880, -18460, -19008, 
-    -19539, -20035, -20507, -20948, -21354, -21735, -22074, -22392, -22660, -22908, -23111, -23287, -23426, -23533, -23608, -23651, 
-    -23667, -23651, -23611, -23542, -23455, -23340, -23210, -23058, -22894, -22706, -22512, -22300, -22078, -21840, -21595, -21335, 
-    -21061, -20777, -20474, -20158, -19821, -19468, -19092, -18690, -18268, -17816, -17341, -16832, -16304, -15738, -15155, -14541, 
-    -13912, -13255, -12591, -11909, -11227, -10537, -9852, -9172, -8505, -7851, -7213, -6593, -5988, -5403, -4829, -4264, 
-    -3702, -3136, -2559, -1953, -1321, -640, 90, 897, 1767, 2733, 3780, 4937, 6189, 7547, 9025, 10626, 
-    12284, 14041, 15847, 17717, 19598, 21517, 23409, 25297, 27116, 28939, 30650, 32322, 32637, 32585, 32614, 32595, 
-    32611, 32597, 32609, 32599, 32609, 32599, 32607, 32600, 32607, 32601, 32606, 32602, 32605, 32602, 32605, 32602, 
-    32602, 32604, 32603, 32604, 32599, 32603, 32600, 32604, 32602, 32604, 32603, 32605, 32602, 32604, 32603, 32604, 
-    32601, 32607, 32599, 32609, 32591, 32628, 32481, 30470, 28310, 26135, 23970, 21786, 19614, 17472, 15364, 13288, 
-    11258, 9310, 7453, 5686, 4014, 2456, 1019, -308, -1546, -2719, -3838, -4926, -5981, -7005, -8030, -9070, 
-    -10132, -11214, -12315, -13439, -14592, -15817, -17101, -18440, -19807, -21206, -22621, -24051, -25471, -26898, -28311, -29718, 
-    -31092, -32344, -32693, -32654, -32672, -32660, -32670, -32662, -32667, -32663, -32667, -32662, -32666, -32662, -32666, -32662, 
-    -32666, -32664, -32666, -32662, -32665, -32664, -32668, -32662, -32668, -32663, -32667, -32664, -32666, -32664, -32667, -32662, 
-    -32667, -32663, -32666, -32660, -32666, -32662, -32666, -32664, -32667, -32664, -32666, -32664, -32666, -32663, -32669, -32661, 
-    -32671, -32657, -32673, -32655, -32675, -32651, -32680, -32646, -32691, -32624, -32744, -32060, -29660, -27418, -25019, -22674, 
-    -20243, -17865, -15449, -13113, -10781, -8549, -6335, -4208, -2097, -59, 1957, 3899, 5815, 7665, 9502, 11286, 
-    13060, 14771, 16475, 18118, 19761, 21357, 22966, 24541, 26146, 27725, 29338, 30922, 32466, 32633, 32590, 32611, 
-    32599, 32606, 32600, 32605, 32600, 32606, 32602, 32604, 32602, 32605, 32603, 32604, 32603, 32603, 32604, 32604, 
-    32603, 32604, 32603, 32605, 32601, 32605, 32602, 32606, 32602, 32604, 32603, 32605, 32602, 32605, 32602, 32606, 
-    32601, 32605, 32601, 32606, 32601, 32607, 32601, 32605, 32602, 32605, 32603, 32605, 32602, 32604, 32601, 32606, 
-    32602, 32605, 32602, 32605, 32602, 32605, 32600, 32608, 32597, 32612, 32592, 32622, 32576, 32653, 31471, 28899, 
-    26367, 23719, 21099, 18403, 15738, 13011, 10293, 7528, 4787, 2025, -695, -3416, -6086, -8730, -11297, -13828, 
-    -16266, -18659, -20942, -23188, -25309, -27420, -29379, -31424, -32621, -32661, -32671, -32662, -32668, -32662, -32668, -32663, 
-    -32667, -32662, -32668, -32663, -32667, -32664, -32665, -32664, -32666, -32664, -32666, -32664, -32666, -32662, -32666, -32665, 
-    -32667, -32663, -32666, -32663, -32667, -32661, -32667, -32662, -32668, -32664, -32668, -32663, -32667, -32664, -32666, -32663, 
-    -32664, -32665, -32665, -32664, -32665, -32664, -32667, -32664, -32666, -32664, -32667, -32664, -32666, -32662, -32667, -32663, 
-    -32667, -32662, -32667, -32660, -32668, -32660, -32672, -32659, -32673, -32656, -32673, -32655, -32676, -32655, -32621, -30181, 
-    -26541, -22988, -19333, -15704, -12036, -8399, -4762, -1172, 2379, 5874, 9313, 12699, 16001, 19254, 22394, 25495, 
-    28453, 31391, 32657, 32572, 32626, 32587, 32617, 32591, 32614, 32593, 32613, 32594, 32612, 32595, 32612, 32595, 
-    32612, 32594, 32613, 32594, 32613, 32594, 32612, 32595, 32612, 32596, 32612, 32595, 32612, 32597, 32610, 32597, 
-    32610, 32597, 32611, 32596, 32611, 32596, 32612, 32596, 32612, 32595, 32612, 32596, 32612, 32595, 32611, 32595, 
-    32610, 32595, 32611, 32595, 32611, 32595, 32611, 32598, 32609, 32598, 32609, 32598, 32610, 32595, 32614, 32593, 
-    32616, 32590, 32618, 32589, 32621, 32585, 32625, 32578, 32637, 32553, 32701, 32202, 28806, 25455, 21967, 18503, 
-    14961, 11438, 7874, 4336, 789, -2710, -6192, -9612, -13002, -16322, -19598, -22802, -25946, -29028, -31912, -32717, 
-    -32642, -32679, -32655, -32674, -32658, -32672, -32659, -32671, -32660, -32670, -32660, -32669, -32662, -32667, -32663, -32668, 
-    -32664, -32667, -32662, -32668, -32664, -32667, -32663, -32667, -32664, -32668, -32662, -32669, -32661, -32670, -32661, -32670, 
-    -32659, -32668, -32658, -32668, -32660, -32670, -32662, -32668, -32660, -32669, -32661, -32670, -32660, -32669, -32660, -32669, 
-    -32658, -32669, -32658, -32670, -32657, -32673, -32655, -32673, -32656, -32674, -32655, -32671, -32654, -32674, -32655, -32678, 
-    -32651, -32681, -32648, -32685, -32640, -32691, -32631, -32711, -32598, -32767, -30680, -27475, -24522, -21321, -18196, -14938, 
-    -11726, -8442, -5200, -1945, 1261, 4437, 7559, 10624, 13634, 16568, 19463, 22256, 25040, 27675, 30422, 32510, 
-    32576, 32628, 32584, 32621, 32588, 32618, 32591, 32616, 32592, 32615, 32593, 32613, 32595, 32612, 32595, 32611, 
-    32595, 32611, 32595, 32609, 32596, 32610, 32596, 32608, 32596, 32608, 32598, 32606, 32600, 32605, 32600, 32604, 
-    32601, 32606, 32601, 32606, 32601, 32606, 32601, 32605, 32601, 32605, 32601, 32606, 32599, 32609, 32598, 32609, 
-    32599, 32607, 32600, 32606, 32600, 32607, 32600, 32605, 32601, 32606, 32599, 32605, 32601, 32607, 32600, 32606, 
-    32603, 32602, 32603, 32599, 32608, 32591, 32634, 32433, 29818, 27104, 24345, 21577, 18750, 15912, 13016, 10102, 
-    7133, 4146, 1106, -1943, -5045, -8141, -11290, -14419, -17602, -20740, -23935, -27033, -30269, -32513, -32676, -32667, 
-    -32660, -32667, -32663, -32668, -32661, -32666, -32663, -32664, -32666, -32663, -32665, -32661, -32665, -32665, -32665, -32665, 
-    -32662, -32666, -32662, -32666, -32664, -32666, -32665, -32665, -32667, -32666, -32664, -32666, -32664, -32665, -32664, -32664, 
-    -32667, -32665, -32666, -32665, -32667, -32664, -32664, -32665, -32663, -32667, -32663, -32665, -32664, -32667, -32665, -32665, 
-    -32665, -32666, -32665, -32665, -32666, -32664, -32665, -32666, -32665, -32668, -32662, -32671, -32657, -32676, -32645, -32708, 
-    -32438, -29972, -27035, -24101, -21133, -18142, -15134, -12107, -9076, -6034, -3004, 15, 3006, 5970, 8888, 11765, 
-    14590, 17357, 20069, 22703, 25288, 27763, 30241, 32366, 32608, 32606, 32598, 32607, 32599, 32608, 32599, 32608, 
-    32601, 32607, 32599, 32607, 32600, 32606, 32600, 32606, 32600, 32607, 32599, 32605, 32600, 32604, 32601, 32604, 
-    32602, 32604, 32602, 32606, 32599, 32608, 32599, 32609, 32597, 32607, 32599, 32606, 32600, 32607, 32601, 32606, 
-    32600, 32606, 32600, 32608, 32600, 32606, 32599, 32606, 32601, 32607, 32601, 32607, 32599, 32609, 32598, 32610, 
-    32597, 32609, 32597, 32611, 32595, 32612, 32592, 32618, 32586, 32625, 32573, 32645, 30371, 27363, 24550, 21660, 
-    18865, 16049, 13295, 10538, 7819, 5094, 2397, -308, -3000, -5707, -8408, -11124, -13842, -16567, -19290, -22000, 
-    -24705, -27360, -30035, -32438, -32676, -32665, -32665, -32666, -32664, -32668, -32662, -32667, -32661, -32669, -32662, -32668, 
-    -32661, -32669, -32663, -32665, -32663, -32665, -32663, -32664, -32664, -32666, -32663, -32667, -32664, -32667, -32662, -32668, 
-    -32663, -32667, -32665, -32665, -32666, -32664, -32665, -32666, -32664, -32666, -32663, -32666, -32665, -32664, -32665, -32665, 
-    -32665, -32665, -32664, -32667, -32664, -32667, -32663, -32665, -32664, -32664, -32666, -32664, -32667, -32663, -32667, -32664, 
-    -32666, -32664, -32666, -32665, -32664, -32667, -32660, -32680, -32577, -30499, -28013, -25521, -22952, -20341, -17681, -14978, 
-    -12238, -9457, -6653, -3812, -954, 1942, 4852, 7802, 10761, 13756, 16747, 19762, 22759, 25776, 28758, 31704, 
-    32657, 32577, 32621, 32591, 32612, 32595, 32610, 32598, 32607, 32599, 32607, 32599, 32608, 32600, 32606, 32600, 
-    32605, 32600, 32605, 32600, 32604, 32602, 32605, 32602, 32604, 32601, 32605, 32602, 32605, 32601, 32607, 32601, 
-    32605, 32600, 32607, 32599, 32606, 32599, 32605, 32601, 32605, 32602, 32606, 32600, 32606, 32601, 32604, 32600, 
-    32603, 32604, 32598, 32622, 32313, 30908, 29368, 27848, 26332, 24830, 23351, 21888, 20455, 19043, 17661, 16297, 
-    14961, 13630, 12319, 10999, 9687, 8354, 7008, 5623, 4211, 2740, 1228, -355, -1988, -3698, -5458, -7292, 
-    -9168, -11119, -13094, -15148, -17201, -19326, -21436, -23599, -25724, -27884, -29976, -32083, -32699, -32645, -32677, -32655, 
-    -32674, -32657, -32671, -32660, -32670, -32660, -32668, -32663, -32667, -32664, -32665, -32664, -32663, -32663, -32664, -32662, 
-    -32667, -32664, -32666, -32665, -32666, -32666, -32664, -32667, -32663, -32665, -32663, -32665, -32664, -32666, -32664, -32665, 
-    -32663, -32665, -32662, -32667, -32662, -32671, -32653, -32696, -32360, -30708, -28783, -26894, -24981, -23074, -21167, -19268, 
-    -17376, -15503, -13642, -11810, -9996, -8221, -6468, -4761, -3081, -1457, 134, 1669, 3165, 4601, 5996, 7324, 
-    8612, 9837, 11026, 12161, 13268, 14335, 15381, 16403, 17418, 18417, 19424, 20418, 21439, 22447, 23497, 24532, 
-    25613, 26677, 27789, 28872, 30019, 31093, 32288, 32669, 32570, 32626, 32587, 32617, 32593, 32610, 32595, 32609, 
-    32597, 32609, 32599, 32607, 32599, 32606, 32600, 32605, 32603, 32605, 32602, 32605, 32601, 32605, 32600, 32606, 
-    32600, 32607, 32600, 32607, 32599, 32607, 32601, 32606, 32606, 32509, 31767, 30833, 29879, 28851, 27760, 26596, 
-    25356, 24039, 22640, 21166, 19619, 18005, 16327, 14594, 12814, 11005, 9167, 7326, 5481, 3665, 1870, 116, 
-    -1591, -3240, -4823, -6342, -7790, -9163, -10471, -11708, -12893, -14021, -15112, -16162, -17190, -18195, -19191, -20173, 
-    -21157, -22134, -23116, -24087, -25065, -26029, -26996, -27935, -28870, -29764, -30641, -31461, -32265, -32676, -32657, -32670, 
-    -32661, -32667, -32662, -32667, -32663, -32665, -32663, -32665, -32664, -32667, -32664, -32666, -32664, -32668, -32662, -32667, 
-    -32662, -32669, -32661, -32669, -32660, -32672, -32656, -32680, -32514, -31912, -31286, -30596, -29870, -29075, -28242, -27334, 
-    -26377, -25349, -24269, -23117, -21913, -20646, -19327, -17955, -16542, -15091, -13614, -12115, -10601, -9080, -7559, -6041, 
-    -4539, -3050, -1589, -145, 1261, 2653, 4006, 5342, 6643, 7927, 9180, 10419, 11629, 12830, 14010, 15176, 
-    16325, 17458, 18567, 19658, 20719, 21755, 22752, 23719, 24641, 25518, 26352, 27134, 27863, 28535, 29154, 29711, 
-    30212, 30654, 31037, 31365, 31636, 31858, 32024, 32144, 32217, 32247, 32230, 32174, 32073, 31937, 31760, 31549, 
-    31308, 31032, 30731, 30393, 30029, 29634, 29212, 28763, 28288, 27788, 27271, 26728, 26172, 25593, 25003, 24391, 
-    23771, 23129, 22475, 21798, 21111, 20396, 19663, 18902, 18124, 17315, 16480, 15618, 14730, 13812, 12865, 11889, 
-    10880, 9839, 8767, 7664, 6529, 5361, 4169, 2950, 1710, 444, -826, -2120, -3411, -4718, -6011, -7310, 
-    -8586, -9856, -11095, -12312, -13488, -14637, -15737, -16798, -17808, -18774, -19688, -20550, -21365, -22131, -22846, -23519, 
-    -24147, -24743, -25297, -25822, -26315, -26777, -27218, -27625, -28013, -28366, -28698, -28990, -29248, -29464, -29636, -29759, 
-    -29827, -29840, -29788, -29678, -29499, -29261, -28957, -28596, -28181, -27715, -27205, -26663, -26079, -25479, -24853, -24227, 
-    -23588, -22957, -22336, -21723, -21133, -20551, -19996, -19448, -18917, -18391, -17868, -17344, -16808, -16250, -15673, -15056, 
-    -14412, -13715, -12980, -12190, -11347, -10458, -9517, -8538, -7517, -6464, -5382, -4281, -3167, -2044, -920, 191, 
-    1296, 2373, 3431, 4448, 5439, 6392, 7309, 8195, 9042, 9866, 10645, 11410, 12132, 12844, 13520, 14184, 
-    14825, 15454, 16067, 16666, 17255, 17833, 18398, 18951, 19487, 20012, 20513, 21004, 21471, 21925, 22350, 22755, 
-    23127, 23465, 23768, 24021, 24239, 24396, 24508, 24558, 24559, 24496, 24381, 24209, 23985, 23708, 23385, 23017, 
-    22613, 22175, 21702, 21203, 20682, 20139, 19578, 19004, 18417, 17825, 17226, 16630, 16034, 15441, 14850, 14262, 
-    13682, 13099, 12524, 11951, 11381, 10812, 10251, 9689, 9133, 8578, 8033, 7490, 6949, 6419, 5889, 5372, 
-    4848, 4337, 3818, 3305, 2785, 2268, 1744, 1218, 688, 154, -388, -938, -1490, -2049, -2609, -3178, 
-    -3743, -4318, -4888, -5468, -6046, -6626, -7207, -7787, -8374, -8955, -9539, -10117, -10694, -11261, -11818, -12366, 
-    -12897, -13413, -13905, -14378, -14819, -15229, -15607, -15947, -16249, -16510, -16731, -16913, -17053, -17153, -17217, -17243, 
-    -17236, -17197, -17128, -17039, -16916, -16786, -16626, -16466, -16281, -16102, -15904, -15711, -15500, -15294, -15072, -14851, 
-    -14608, -14358, -14087, -13792, -13472, -13123, -12745, -12332, -11892, -11424, -10928, -10410, -9875, -9325, -8766, -8203, 
-    -7640, -7085, -6540, -6015, -5516, -5047, -4610, -4213, -3856, -3543, -3277, -3049, -2868, -2723, -2619, -2540, 
-    -2491, -2458, -2440, -2422, -2409, -2379, -2345, -2282, -2206, -2095, -1967, -1801, -1614, -1390, -1147, -870, 
-    -573, -250, 83, 438, 801, 1182, 1563, 1954, 2348, 2741, 3135, 3522, 3908, 4285, 4660, 5027, 
-    5395, 5755, 6118, 6481, 6845, 7214, 7581, 7957, 8332, 8707, 9086, 9451, 9820, 10168, 10508, 10821, 
-    11113, 11373, 11595, 11784, 11925, 12026, 12074, 12079, 12035, 11950, 11816, 11649, 11441, 11209, 10950, 10681, 
-    10396, 10110, 9826, 9554, 9290, 9054, 8832, 8649, 8483, 8360, 8257, 8196, 8158, 8152, 8166, 8200, 
-    8245, 8299, 8353, 8402, 8440, 8461, 8462, 8433, 8380, 8289, 8166, 8001, 7804, 7566, 7296, 6993, 
-    6659, 6301, 5916, 5518, 5100, 4679, 4244, 3818, 3389, 2981, 2579, 2210, 1855, 1536, 1241, 981, 
-    751, 555, 385, 244, 121, 22, -68, -143, -222, -291, -372, -453, -560, -672, -815, -970, 
-    -1161, -1365, -1602, -1857, -2136, -2434, -2742, -3069, -3391, -3720, -4035, -4347, -4633, -4905, -5149, -5369, 
-    -5557, -5722, -5854, -5964, -6040, -6102, -6134, -6165, -6175, -6189, -6194, -6213, -6235, -6276, -6323, -6398, 
-    -6482, -6593, -6716, -6868, -7028, -7214, -7400, -7608, -7810, -8020, -8225, -8417, -8604, -8765, -8921, -9038, 
-    -9145, -9212, -9263, -9277, -9276, -9246, -9203, -9137, -9068, -8981, -8896, -8801, -8716, -8620, -8543, -8460, 
-    -8397, -8331, -8287, -8245, -8213, -8191, -8173, -8166, -8155, -8156, -8150, -8150, -8138, -8126, -8100, -8070, 
-    -8021, -7965, -7890, -7802, -7696, -7566, -7420, -7246, -7055, -6831, -6591, -6320, -6025, -5706, -5361, -4995, 
-    -4606, -4197, -3768, -3316, -2855, -2375, -1891, -1393, -895, -392, 107, 600, 1086, 1558, 2018, 2460, 
-    2883, 3291, 3673, 4044, 4387, 4721, 5033, 5337, 5627, 5911, 6188, 6463, 6740, 7019, 7297, 7585, 
-    7872, 8168, 8463, 8766, 9069, 9371, 9671, 9966, 10259, 10542, 10819, 11085, 11340, 11585, 11817, 12038, 
-    12244, 12441, 12623, 12796, 12962, 13119, 13272, 13415, 13556, 13691, 13821, 13947, 14065, 14179, 14280, 14370, 
-    14449, 14501, 14538, 14544, 14526, 14475, 14394, 14276, 14122, 13925, 13692, 13412, 13095, 12736, 12339, 11904, 
-    11436, 10930, 10402, 9837, 9256, 8647, 8030, 7391, 6749, 6095, 5443, 4790, 4147, 3510, 2885, 2271, 
-    1675, 1095, 528, -13, -541, -1046, -1531, -1995, -2436, -2860, -3259, -3638, -3994, -4334, -4650, -4950, 
-    -5229, -5498, -5749, -5991, -6221, -6441, -6656, -6855, -7057, -7241, -7427, -7599, -7769, -7929, -8078, -8220, 
-    -8354, -8475, -8594, -8697, -8801, -8887, -8977, -9051, -9129, -9197, -9273, -9335, -9413, -9478, -9557, -9628, 
-    -9716, -9799, -9889, -9981, -10077, -10175, -10270, -10368, -10459, -10547, -10626, -10700, -10763, -10817, -10856, -10886, 
-    -10895, -10895, -10878, -10845, -10801, -10738, -10669, -10578, -10487, -10376, -10261, -10133, -10001, -9855, -9712, -9551, 
-    -9396, -9221, -9055, -8870, -8685, -8486, -8280, -8063, -7832, -7590, -7337, -7069, -6789, -6486, -6170, -5827, 
-    -5473, -5092, -4697, -4275, -3842, -3389, -2925, -2450, -1969, -1479, -988, -499, -17, 457, 917, 1362, 
-    1785, 2186, 2558, 2905, 3222, 3508, 3763, 3988, 4180, 4347, 4483, 4597, 4683, 4758, 4812, 4858, 
-    4893, 4925, 4960, 4993, 5038, 5083, 5148, 5214, 5302, 5394, 5508, 5630, 5771, 5917, 6073, 6240, 
-    6405, 6580, 6744, 6918, 7079, 7237, 7389, 7534, 7676, 7806, 7932, 8046, 8157, 8258, 8361, 8452, 
-    8551, 8639, 8742, 8839, 8949, 9063, 9190, 9321, 9466, 9618, 9783, 9951, 10131, 10309, 10493, 10668, 
-    10844, 11005, 11158, 11290, 11404, 11496, 11560, 11595, 11602, 11576, 11513, 11417, 11286, 11123, 10923, 10695, 
-    10435, 10148, 9835, 9497, 9139, 8759, 8366, 7955, 7531, 7101, 6660, 6218, 5768, 5321, 4872, 4429, 
-    3988, 3562, 3138, 2736, 2340, 1968, 1607, 1272, 952, 657, 382, 133, -95, -300, -486, -646, 
-    -795, -921, -1038, -1144, -1245, -1344, -1442, -1547, -1658, -1783, -1916, -2065, -2230, -2415, -2619, -2846, 
-    -3090, -3357, -3643, -3945, -4266, -4601, -4950, -5309, -5675, -6054, -6431, -6818, -7199, -7588, -7969, -8351, 
-    -8725, -9100, -9469, -9833, -10191, -10544, -10885, -11224, -11546, -11864, -12158, -12445, -12707, -12957, -13178, -13384, 
-    -13561, -13714, -13839, -13938, -14014, -14059, -14084, -14080, -14060, -14011, -13947, -13859, -13753, -13632, -13492, -13342, 
-    -13174, -13000, -12807, -12614, -12402, -12188, -11961, -11734, -11494, -11255, -11011, -10766, -10522, -10273, -10033, -9785, 
-    -9551, -9310, -9082, -8851, -8631, -8414, -8205, -8001, -7796, -7602, -7406, -7214, -7018, -6821, -6621, -6411, 
-    -6193, -5960, -5720, -5460, -5187, -4893, -4584, -4253, -3905, -3534, -3144, -2728, -2298, -1840, -1365, -867, 
-    -351, 186, 744, 1319, 1912, 2524, 3145, 3783, 4431, 5091, 5755, 6430, 7104, 7784, 8456, 9130, 
-    9793, 10452, 11098, 11734, 12356, 12968, 13557, 14138, 14694, 15241, 15764, 16277, 16764, 17244, 17703, 18143, 
-    18567, 18976, 19364, 19736, 20085, 20425, 20735, 21035, 21306, 21563, 21795, 22004, 22189, 22348, 22480, 22584, 
-    22656, 22698, 22700, 22675, 22606, 22502, 22358, 22176, 21951, 21683, 21373, 21020, 20629, 20196, 19722, 19217, 
-    18673, 18099, 17497, 16872, 16224, 15559, 14880, 14194, 13492, 12795, 12084, 11386, 10674, 9978, 9271, 8580, 
-    7879, 7193, 6496, 5810, 5116, 4434, 3735, 3050, 2348, 1654, 942, 238, -484, -1201, -1942, -2679, 
-    -3439, -4201, -4981, -5773, -6578, -7399, -8232, -9081, -9943, -10812, -11697, -12584, -13477, -14372, -15261, -16149, 
-    -17024, -17883, -18725, -19539, -20333, -21091, -21818, -22507, -23159, -23769, -24345, -24872, -25364, -25808, -26224, -26593, 
-    -26934, -27238, -27518, -27767, -27991, -28191, -28364, -28517, -28639, -28738, -28805, -28844, -28843, -28809, -28729, -28610, 
-    -28439, -28215, -27937, -27598, -27203, -26739, -26216, -25628, -24979, -24269, -23503, -22684, -21817, -20900, -19953, -18968, 
-    -17966, -16936, -15908, -14864, -13832, -12798, -11787, -10782, -9802, -8840, -7901, -6984, -6090, -5215, -4357, -3511, 
-    -2679, -1847, -1019, -184, 654, 1507, 2374, 3260, 4168, 5094, 6048, 7019, 8016, 9026, 10056, 11094, 
-    12136, 13180, 14214, 15236, 16242, 17217, 18171, 19081, 19964, 20796, 21591, 22336, 23036, 23692, 24297, 24862, 
-    25383, 25867, 26312, 26721, 27102, 27445, 27768, 28059, 28332, 28577, 28800, 29006, 29186, 29348, 29486, 29598, 
-    29685, 29741, 29767, 29755, 29704, 29615, 29475, 29294, 29058, 28778, 28439, 28053, 27609, 27118, 26568, 25973, 
-    25324, 24633, 23897, 23122, 22311, 21465, 20588, 19687, 18759, 17817, 16854, 15882, 14901, 13910, 12918, 11921, 
-    10929, 9934, 8942, 7954, 6963, 5980, 4991, 4010, 3018, 2033, 1039, 42, -965, -1975, -3000, -4026, 
-    -5072, -6117, -7178, -8242, -9314, -10388, -11461, -12534, -13598, -14655, -15698, -16720, -17723, -18695, -19647, -20553, 
-    -21427, -22256, -23038, -23777, -24457, -25098, -25674, -26209, -26681, -27110, -27483, -27813, -28094, -28333, -28531, -28691, 
-    -28811, -28900, -28953, -28977, -28968, -28933, -28868, -28778, -28661, -28521, -28353, -28165, -27950, -27710, -27443, -27150, 
-    -26829, -26475, -26087, -25672, -25215, -24730, -24201, -23643, -23043, -22405, -21728, -21013, -20255, -19458, -18618, -17739, 
-    -16819, -15860, -14865, -13835, -12774, -11684, -10568, -9432, -8277, -7112, -5940, -4763, -3588, -2416, -1254, -101, 
-    1038, 2157, 3264, 4341, 5399, 6430, 7437, 8416, 9362, 10283, 11174, 12041, 12875, 13687, 14473, 15237, 
-    15976, 16698, 17397, 18076, 18735, 19375, 19993, 20588, 21166, 21716, 22246, 22747, 23223, 23671, 24085, 24470, 
-    24816, 25127, 25401, 25636, 25836, 25990, 26115, 26194, 26241, 26248, 26223, 26164, 26071, 25947, 25795, 25611, 
-    25403, 25167, 24905, 24620, 24308, 23972, 23606, 23216, 22795, 22342, 21858, 21335, 20783, 20183, 19552, 18876, 
-    18160, 17403, 16604, 15768, 14884, 13973, 13018, 12039, 11019, 9982, 8915, 7832, 6729, 5613, 4485, 3350, 
-    2207, 1066, -74, -1211, -2345, -3465, -4579, -5677, -6764, -7832, -8886, -9920, -10933, -11925, -12894, -13836, 
-    -14751, -15637, -16492, -17312, -18091, -18835, -19534, -20190, -20797, -21358, -21867, -22324, -22730, -23086, -23389, -23640, 
-    -23846, -24003, -24120, -24192, -24228, -24226, -24194, -24126, -24035, -23914, -23775, -23611, -23434, -23233, -23019, -22784, 
-    -22537, -22262, -21971, -21653, -21310, -20938, -20535, -20096, -19618, -19102, -18545, -17945, -17299, -16613, -15889, -15123, 
-    -14323, -13488, -12629, -11738, -10834, -9904, -8970, -8020, -7072, -6117, -5172, -4229, -3298, -2375, -1469, -573, 
-    301, 1167, 2011, 2847, 3664, 4472, 5271, 6057, 6842, 7613, 8386, 9147, 9907, 10655, 11404, 12136, 
-    12862, 13572, 14273, 14952, 15613, 16252, 16868, 17455, 18018, 18543, 19040, 19498, 19921, 20304, 20647, 20952, 
-    21209, 21433, 21606, 21746, 21839, 21895, 21911, 21890, 21832, 21737, 21610, 21450, 21260, 21033, 20782, 20500, 
-    20197, 19863, 19508, 19126, 18723, 18293, 17841, 17365, 16865, 16341, 15795, 15227, 14632, 14015, 13374, 12712, 
-    12022, 11313, 10581, 9829, 9055, 8261, 7451, 6619, 5774, 4913, 4042, 3160, 2273, 1383, 490, -400, 
-    -1289, -2173, -3048, -3915, -4769, -5613, -6441, -7251, -8046, -8819, -9573, -10308, -11018, -11706, -12370, -13008, 
-    -13624, -14212, -14779, -15320, -15839, -16335, -16809, -17264, -17700, -18113, -18509, -18884, -19238, -19577, -19892, -20193, 
-    -20469, -20730, -20965, -21182, -21370, -21540, -21680, -21794, -21876, -21932, -21949, -21938, -21885, -21798, -21665, -21500, 
-    -21286, -21034, -20733, -20391, -20007, -19571, -19099, -18568, -18009, -17393, -16742, -16047, -15314, -14544, -13735, -12905, 
-    -12039, -11156, -10250, -9334, -8403, -7473, -6534, -5607, -4677, -3773, -2868, -1994, -1123, -286, 542, 1342, 
-    2131, 2895, 3642, 4375, 5093, 5798, 6497, 7186, 7875, 8551, 9232, 9900, 10578, 11236, 11900, 12548, 
-    13190, 13813, 14422, 15013, 15578, 16118, 16627, 17106, 17549, 17961, 18333, 18668, 18967, 19228, 19456, 19644, 
-    19803, 19923, 20019, 20083, 20126, 20141, 20143, 20120, 20086, 20034, 19970, 19895, 19806, 19711, 19605, 19492, 
-    19369, 19237, 19097, 18942, 18781, 18598, 18409, 18196, 17969, 17716, 17444, 17141, 16814, 16453, 16065, 15636, 
-    15176, 14674, 14136, 13556, 12940, 12283, 11590, 10858, 10093, 9294, 8466, 7610, 6730, 5829, 4912, 3981, 
-    3041, 2098, 1150, 212, -728, -1652, -2567, -3467, -4351, -5215, -6056, -6880, -7678, -8454, -9206, -9931, 
-    -10634, -11311, -11963, -12588, -13192, -13773, -14325, -14859, -15368, -15859, -16325, -16772, -17201, -17606, -17996, -18358, 
-    -18709, -19032, -19337, -19615, -19871, -20102, -20304, -20484, -20634, -20757, -20854, -20917, -20959, -20962, -20942, -20881, 
-    -20797, -20672, -20522, -20331, -20119, -19868, -19595, -19288, -18960, -18605, -18225, -17825, -17398, -16955, -16482, -16000, 
-    -15487, -14966, -14412, -13854, -13271, -12685, -12077, -11469, -10843, -10222, -9584, -8955, -8310, -7677, -7033, -6397, 
-    -5757, -5120, -4483, -3849, -3213, -2581, -1944, -1314, -676, -46, 592, 1225, 1861, 2493, 3129, 3757, 
-    4383, 5002, 5614, 6215, 6807, 7385, 7948, 8495, 9028, 9542, 10035, 10512, 10966, 11402, 11818, 12212, 
-    12594, 12951, 13303, 13628, 13954, 14252, 14554, 14830, 15109, 15361, 15616, 15844, 16073, 16272, 16466, 16638, 
-    16793, 16927, 17035, 17126, 17184, 17220, 17222, 17199, 17142, 17057, 16934, 16786, 16597, 16383, 16130, 15852, 
-    15541, 15206, 14845, 14465, 14066, 13651, 13224, 12788, 12340, 11893, 11438, 10988, 10533, 10084, 9635, 9191, 
-    8746, 8305, 7866, 7429, 6985, 6545, 6101, 5653, 5195, 4738, 4268, 3791, 3305, 2811, 2305, 1796, 
-    1275, 754, 221, -303, -832, -1355, -1871, -2376, -2868, -3346, -3806, -4246, -4670, -5069, -5448, -5804, 
-    -6138, -6454, -6744, -7017, -7267, -7501, -7720, -7916, -8105, -8273, -8439, -8580, -8722, -8843, -8968, -9068, 
-    -9171, -9256, -9337, -9400, -9459, -9502, -9534, -9553, -9560, -9557, -9538, -9512, -9474, -9429, -9376, -9316, 
-    -9254, -9187, -9120, -9050, -8981, -8906, -8838, -8759, -8691, -8607, -8536, -8449, -8369, -8280, -8187, -8093, 
-    -7985, -7882, -7762, -7647, -7515, -7388, -7246, -7109, -6959, -6811, -6656, -6502, -6346, -6187, -6031, -5873, 
-    -5718, -5562, -5408, -5256, -5106, -4956, -4811, -4664, -4520, -4372, -4228, -4078, -3927, -3773, -3613, -3449, 
-    -3276, -3101, -2917, -2729, -2532, -2329, -2120, -1903, -1681, -1453, -1219, -978, -735, -486, -239, 14, 
-    261, 511, 755, 993, 1225, 1449, 1663, 1865, 2060, 2242, 2416, 2572, 2724, 2859, 2989, 3103, 
-    3212, 3311, 3405, 3491, 3576, 3653, 3734, 3807, 3884, 3958, 4036, 4111, 4190, 4268, 4349, 4429, 
-    4513, 4595, 4676, 4756, 4837, 4910, 4990, 5057, 5134, 5196, 5272, 5330, 5399, 5460, 5526, 5586, 
-    5649, 5715, 5779, 5846, 5917, 5989, 6071, 6154, 6248, 6345, 6456, 6569, 6695, 6829, 6972, 7121, 
-    7279, 7438, 7600, 7762, 7922, 8073, 8224, 8358, 8488, 8597, 8700, 8777, 8844, 8882, 8906, 8902, 
-    8880, 8832, 8760, 8671, 8552, 8421, 8260, 8090, 7893, 7686, 7455, 7217, 6960, 6698, 6417, 6136, 
-    5838, 5541, 5230, 4917, 4596, 4272, 3944, 3613, 3277, 2942, 2603, 2267, 1928, 1592, 1256, 927, 
-    595, 273, -49, -360, -676, -978, -1280, -1571, -1861, -2139, -2410, -2674, -2931, -3175, -3415, -3642, 
-    -3866, -4077, -4281, -4476, -4662, -4841, -5010, -5171, -5326, -5471, -5613, -5746, -5878, -6003, -6129, -6252, 
-    -6377, -6504, -6633, -6766, -6908, -7052, -7212, -7368, -7547, -7719, -7914, -8104, -8311, -8518, -8732, -8952, 
-    -9173, -9395, -9616, -9837, -10052, -10260, -10459, -10652, -10830, -10998, -11147, -11286, -11407, -11509, -11592, -11655, 
-    -11699, -11720, -11716, -11690, -11639, -11564, -11462, -11335, -11180, -10998, -10788, -10550, -10285, -9992, -9677, -9335, 
-    -8970, -8581, -8178, -7749, -7308, -6851, -6386, -5912, -5431, -4949, -4464, -3985, -3507, -3036, -2574, -2124, 
-    -1685, -1254, -838, -434, -41, 345, 716, 1082, 1439, 1789, 2137, 2478, 2821, 3156, 3497, 3832, 
-    4171, 4506, 4841, 5175, 5504, 5833, 6153, 6472, 6776, 7079, 7362, 7642, 7900, 8153, 8385, 8604, 
-    8813, 8998, 9181, 9339, 9500, 9638, 9779, 9906, 10035, 10156, 10278, 10398, 10522, 10641, 10768, 10891, 
-    11018, 11142, 11268, 11394, 11514, 11633, 11748, 11858, 11958, 12050, 12135, 12203, 12262, 12303, 12329, 12335, 
-    12321, 12286, 12226, 12147, 12038, 11909, 11750, 11571, 11357, 11127, 10859, 10576, 10256, 9918, 9552, 9163, 
-    8753, 8321, 7870, 7403, 6921, 6425, 5919, 5402, 4882, 4351, 3820, 3283, 2748, 2213, 1676, 1150, 
-    621, 104, -408, -911, -1405, -1887, -2356, -2812, -3253, -3677, -4086, -4474, -4847, -5200, -5531, -5844, 
-    -6133, -6406, -6649, -6881, -7081, -7267, -7430, -7577, -7704, -7810, -7909, -7986, -8058, -8111, -8162, -8200, 
-    -8235, -8264, -8287, -8310, -8326, -8347, -8357, -8373, -8381, -8392, -8399, -8403, -8404, -8403, -8396, -8388, 
-    -8367, -8346, -8314, -8275, -8226, -8163, -8094, -8009, -7912, -7804, -7680, -7549, -7401, -7246, -7080, -6903, 
-    -6727, -6539, -6354, -6161, -5976, -5790, -5609, -5428, -5261, -5093, -4940, -4784, -4646, -4506, -4377, -4248, 
-    -4128, -4003, -3884, -3757, -3636, -3499, -3364, -3211, -3058, -2885, -2704, -2505, -2298, -2071, -1837, -1588, 
-    -1332, -1065, -795, -519, -246, 27, 296, 558, 812, 1056, 1288, 1506, 1706, 1899, 2064, 2221, 
-    2351, 2478, 2576, 2667, 2737, 2800, 2843, 2880, 2903, 2918, 2925, 2923, 2918, 2901, 2885, 2861, 
-    2834, 2803, 2769, 2735, 2697, 2661, 2622, 2588, 2554, 2526, 2500, 2480, 2467, 2458, 2462, 2466, 
-    2482, 2507, 2535, 2580, 2618, 2682, 2732, 2808, 2869, 2952, 3022, 3108, 3184, 3268, 3343, 3423, 
-    3494, 3563, 3628, 3686, 3743, 3789, 3839, 3881, 3923, 3962, 4003, 4044, 4086, 4133, 4183, 4240, 
-    4299, 4370, 4442, 4525, 4610, 4703, 4802, 4900, 5005, 5106, 5209, 5304, 5396, 5482, 5557, 5622, 
-    5674, 5714, 5741, 5750, 5752, 5730, 5705, 5659, 5610, 5544, 5469, 5388, 5296, 5203, 5100, 4999, 
-    4891, 4787, 4678, 4579, 4471, 4375, 4274, 4181, 4084, 3998, 3909, 3825, 3740, 3660, 3580, 3501, 
-    3424, 3341, 3265, 3177, 3097, 3003, 2914, 2809, 2712, 2595, 2483, 2351, 2221, 2072, 1920, 1752, 
-    1580, 1389, 1191, 979, 758, 522, 272, 16, -257, -538, -834, -1134, -1450, -1772, -2098, -2435, 
-    -2774, -3120, -3460, -3809, -4151, -4496, -4834, -5172, -5503, -5832, -6155, -6474, -6782, -7088, -7380, -7670, 
-    -7943, -8214, -8469, -8718, -8955, -9185, -9401, -9611, -9813, -10004, -10189, -10362, -10535, -10689, -10849, -10990, 
-    -11131, -11256, -11379, -11490, -11590, -11682, -11759, -11825, -11874, -11910, -11926, -11921, -11899, -11854, -11786, -11693, 
-    -11578, -11433, -11266, -11071, -10852, -10604, -10337, -10043, -9729, -9392, -9042, -8670, -8291, -7894, -7493, -7082, 
-    -6670, -6253, -5834, -5419, -5001, -4593, -4180, -3780, -3379, -2988, -2600, -2220, -1847, -1478, -1116, -760, 
-    -412, -64, 275, 616, 949, 1287, 1618, 1956, 2289, 2630, 2972, 3324, 3679, 4046, 4421, 4810, 
-    5211, 5621, 6054, 6490, 6955, 7417, 7908, 8392, 8905, 9406, 9929, 10439, 10959, 11467, 11975, 12468, 
-    12949, 13418, 13867, 14299, 14707, 15095, 15455, 15795, 16103, 16389, 16640, 16870, 17070, 17241, 17388, 17500, 
-    17593, 17648, 17688, 17688, 17674, 17622, 17554, 17448, 17326, 17169, 16991, 16782, 16550, 16290, 16007, 15700, 
-    15369, 15016, 14643, 14246, 13832, 13396, 12943, 12469, 11977, 11467, 10937, 10395, 9829, 9249, 8653, 8046, 
-    7415, 6780, 6124, 5466, 4788, 4114, 3421, 2734, 2038, 1344, 648, -40, -724, -1405, -2075, -2735, 
-    -3387, -4026, -4654, -5268, -5873, -6462, -7040, -7611, -8162, -8713, -9242, -9777, -10288, -10808, -11307, -11808, 
-    -12297, -12782, -13254, -13722, -14179, -14621, -15056, -15475, -15884, -16269, -16645, -16996, -17332, -17641, -17932, -18198, 
-    -18439, -18654, -18847, -19013, -19150, -19265, -19348, -19411, -19440, -19452, -19426, -19385, -19307, -19214, -19088, -18942, 
-    -18767, -18572, -18347, -18101, -17827, -17533, -17211, -16865, -16497, -16105, -15691, -15254, -14798, -14321, -13824, -13312, 
-    -12781, -12235, -11670, -11096, -10501, -9898, -9275, -8645, -7999, -7341, -6673, -5991, -5300, -4592, -3882, -3153, 
-    -2419, -1672, -918, -158, 611, 1384, 2167, 2944, 3731, 4513, 5294, 6075, 6842, 7612, 8363, 9111, 
-    9839, 10554, 11249, 11929, 12583, 13218, 13828, 14417, 14976, 15512, 16017, 16502, 16950, 17379, 17768, 18142, 
-    18474, 18784, 19058, 19307, 19522, 19709, 19864, 19992, 20088, 20155, 20195, 20208, 20192, 20151, 20083, 19993, 
-    19875, 19737, 19570, 19387, 19173, 18945, 18684, 18410, 18105, 17782, 17434, 17063, 16670, 16252, 15813, 15348, 
-    14865, 14354, 13827, 13277, 12712, 12124, 11526, 10910, 10286, 9647, 9005, 8353, 7699, 7038, 6382, 5720, 
-    5065, 4405, 3753, 3098, 2447, 1800, 1150, 507, -142, -781, -1431, -2073, -2719, -3363, -4009, -4650, 
-    -5292, -5928, -6563, -7186, -7804, -8409, -9007, -9586, -10154, -10698, -11230, -11735, -12221, -12681, -13117, -13530, 
-    -13913, -14276, -14608, -14921, -15203, -15466, -15703, -15919, -16113, -16285, -16439, -16572, -16688, -16785, -16861, -16923, 
-    -16964, -16987, -16989, -16973, -16936, -16874, -16793, -16684, -16555, -16396, -16211, -16004, -15762, -15502, -15204, -14893, 
-    -14542, -14179, -13780, -13368, -12927, -12471, -11994, -11501, -10994, -10474, -9939, -9398, -8846, -8293, -7723, -7161, 
-    -6586, -6015, -5438, -4866, -4289, -3716, -3146, -2575, -2011, -1450, -894, -344, 198, 732, 1261, 1779, 
-    2289, 2789, 3280, 3761, 4230, 4692, 5140, 5584, 6013, 6436, 6847, 7249, 7642, 8023, 8398, 8757, 
-    9111, 9449, 9784, 10099, 10408, 10700, 10981, 11247, 11498, 11728, 11947, 12139, 12319, 12469, 12606, 12716, 
-    12806, 12871, 12914, 12934, 12934, 12906, 12864, 12791, 12708, 12596, 12471, 12321, 12160, 11980, 11783, 11574, 
-    11350, 11114, 10863, 10603, 10331, 10048, 9756, 9451, 9140, 8816, 8487, 8144, 7797, 7437, 7074, 6700, 
-    6319, 5930, 5535, 5132, 4721, 4306, 3879, 3448, 3010, 2565, 2117, 1658, 1203, 734, 274, -193, 
-    -654, -1118, -1574, -2026, -2468, -2902, -3322, -3730, -4123, -4497, -4853, -5189, -5502, -5797, -6066, -6313, 
-    -6539, -6740, -6920, -7077, -7213, -7328, -7422, -7500, -7561, -7605, -7636, -7652, -7663, -7653, -7645, -7621, 
-    -7595, -7558, -7522, -7475, -7429, -7371, -7319, -7255, -7196, -7124, -7057, -6975, -6896, -6806, -6712, -6606, 
-    -6493, -6370, -6235, -6090, -5926, -5757, -5569, -5370, -5151, -4926, -4682, -4433, -4167, -3899, -3618, -3337, 
-    -3050, -2766, -2480, -2196, -1919, -1646, -1381, -1124, -875, -637, -407, -191, 22, 219, 412, 597, 
-    772, 947, 1109, 1279, 1433, 1597, 1755, 1917, 2076, 2243, 2404, 2576, 2740, 2912, 3080, 3251, 
-    3421, 3585, 3750, 3908, 4059, 4206, 4337, 4463, 4573, 4671, 4750, 4813, 4860, 4887, 4894, 4880, 
-    4849, 4796, 4725, 4637, 4530, 4408, 4271, 4122, 3961, 3792, 3616, 3432, 3243, 3055, 2862, 2673, 
-    2479, 2290, 2103, 1920, 1739, 1560, 1385, 1212, 1044, 872, 711, 540, 383, 216, 60, -101, 
-    -257, -412, -568, -716, -864, -1003, -1146, -1274, -1403, -1519, -1636, -1737, -1838, -1926, -2010, -2084, 
-    -2151, -2212, -2261, -2309, -2346, -2379, -2402, -2421, -2434, -2441, -2440, -2437, -2425, -2412, -2389, -2366, 
-    -2335, -2303, -2263, -2221, -2173, -2122, -2063, -2004, -1934, -1865, -1784, -1701, -1612, -1517, -1414, -1308, 
-    -1195, -1079, -957, -832, -702, -571, -438, -301, -164, -25, 107, 249, 382, 521, 651, 786, 
-    911, 1044, 1167, 1295, 1416, 1542, 1664, 1790, 1911, 2036, 2158, 2279, 2398, 2517, 2627, 2738, 
-    2837, 2935, 3017, 3094, 3160, 3210, 3253, 3277, 3293, 3296, 3284, 3263, 3229, 3190, 3141, 3081, 
-    3025, 2957, 2896, 2823, 2761, 2695, 2633, 2572, 2515, 2460, 2408, 2356, 2304, 2251, 2196, 2135, 
-    2069, 1994, 1914, 1818, 1714, 1597, 1466, 1322, 1166, 998, 814, 624, 420, 212, -3, -223, 
-    -447, -670, -897, -1116, -1337, -1548, -1760, -1959, -2154, -2337, -2517, -2685, -2847, -2997, -3143, -3278, 
-    -3410, -3531, -3648, -3759, -3867, -3968, -4066, -4161, -4252, -4334, -4419, -4490, -4566, -4620, -4683, -4723, 
-    -4767, -4793, -4813, -4821, -4819, -4804, -4783, -4741, -4698, -4631, -4561, -4470, -4371, -4262, -4133, -3997, 
-    -3848, -3690, -3522, -3340, -3156, -2959, -2757, -2549, -2331, -2113, -1885, -1659, -1425, -1191, -952, -712, 
-    -471, -227, 15, 258, 500, 744, 983, 1222, 1459, 1693, 1927, 2158, 2383, 2608, 2826, 3045, 
-    3252, 3458, 3659, 3850, 4040, 4217, 4394, 4557, 4716, 4865, 5009, 5140, 5267, 5381, 5488, 5585, 
-    5673, 5751, 5820, 5877, 5925, 5962, 5989, 6004, 6008, 6001, 5984, 5952, 5916, 5861, 5806, 5728, 
-    5653, 5558, 5464, 5352, 5241, 5115, 4989, 4853, 4712, 4566, 4412, 4256, 4091, 3925, 3752, 3576, 
-    3396, 3211, 3024, 2834, 2642, 2446, 2248, 2049, 1843, 1641, 1429, 1221, 999, 783, 554, 324, 
-    84, -156, -406, -662, -924, -1191, -1464, -1741, -2027, -2313, -2608, -2900, -3200, -3494, -3794, -4084, 
-    -4380, -4662, -4946, -5214, -5482, -5731, -5976, -6202, -6422, -6623, -6812, -6985, -7146, -7292, -7419, -7538, 
-    -7638, -7729, -7798, -7865, -7908, -7945, -7963, -7974, -7962, -7944, -7907, -7859, -7796, -7718, -7630, -7519, 
-    -7407, -7266, -7122, -6955, -6780, -6586, -6374, -6151, -5909, -5653, -5381, -5092, -4793, -4474, -4148, -3805, 
-    -3457, -3097, -2729, -2356, -1976, -1596, -1211, -832, -449, -76, 295, 657, 1011, 1357, 1690, 2018, 
-    2328, 2633, 2921, 3212, 3479, 3754, 4008, 4272, 4517, 4773, 5011, 5262, 5498, 5744, 5974, 6213, 
-    6442, 6670, 6894, 7110, 7326, 7525, 7726, 7909, 8090, 8254, 8408, 8548, 8674, 8783, 8879, 8954, 
-    9020, 9057, 9088, 9090, 9083, 9049, 9005, 8937, 8854, 8753, 8637, 8503, 8356, 8192, 8019, 7828, 
-    7633, 7423, 7207, 6982, 6750, 6516, 6270, 6030, 5773, 5525, 5264, 5005, 4739, 4469, 4198, 3915, 
-    3629, 3336, 3035, 2725, 2403, 2077, 1734, 1387, 1025, 654, 273, -116, -511, -921, -1331, -1751, 
-    -2169, -2594, -3013, -3439, -3854, -4272, -4678, -5079, -5471, -5853, -6223, -6579, -6924, -7252, -7566, -7863, 
-    -8144, -8408, -8653, -8884, -9094, -9290, -9464, -9624, -9763, -9889, -9994, -10083, -10158, -10215, -10258, -10283, 
-    -10297, -10295, -10279, -10250, -10205, -10146, -10074, -9987, -9885, -9766, -9634, -9483, -9318, -9130, -8931, -8708, 
-    -8471, -8213, -7939, -7648, -7335, -7009, -6667, -6305, -5937, -5545, -5155, -4741, -4332, -3904, -3481, -3046, 
-    -2615, -2180, -1747, -1316, -888, -467, -44, 364, 773, 1171, 1567, 1950, 2330, 2698, 3068, 3418, 
-    3776, 4115, 4462, 4790, 5125, 5448, 5775, 6086, 6405, 6710, 7019, 7313, 7610, 7894, 8175, 8446, 
-    8706, 8959, 9193, 9422, 9628, 9825, 10000, 10161, 10298, 10421, 10518, 10600, 10657, 10697, 10714, 10713, 
-    10692, 10652, 10591, 10516, 10416, 10308, 10171, 10028, 9858, 9680, 9480, 9270, 9040, 8797, 8543, 8271, 
-    7992, 7693, 7388, 7069, 6741, 6402, 6050, 5698, 5326, 4956, 4568, 4180, 3778, 3375, 2960, 2538, 
-    2110, 1677, 1236, 788, 334, -121, -586, -1052, -1524, -1993, -2465, -2935, -3398, -3860, -4309, -4752, 
-    -5182, -5600, -6001, -6385, -6751, -7099, -7423, -7728, -8008, -8267, -8501, -8716, -8907, -9073, -9226, -9350, 
-    -9466, -9551, -9633, -9688, -9736, -9765, -9788, -9792, -9792, -9776, -9754, -9719, -9674, -9619, -9552, -9476, 
-    -9384, -9282, -9162, -9034, -8884, -8724, -8545, -8355, -8144, -7923, -7684, -7434, -7169, -6891, -6605, -6302, 
-    -5996, -5676, -5351, -5020, -4680, -4339, -3991, -3642, -3288, -2935, -2576, -2217, -1854, -1490, -1123, -752, 
-    -378, 1, 380, 769, 1156, 1550, 1944, 2342, 2739, 3141, 3537, 3937, 4326, 4720, 5099, 5480, 
-    5844, 6207, 6549, 6892, 7209, 7528, 7816, 8107, 8369, 8624, 8858, 9078, 9283, 9465, 9634, 9784, 
-    9916, 10030, 10121, 10197, 10251, 10284, 10294, 10282, 10252, 10192, 10112, 10005, 9878, 9723, 9544, 9345, 
-    9122, 8877, 8612, 8329, 8030, 7712, 7385, 7040, 6691, 6327, 5960, 5581, 5203, 4815, 4431, 4038, 
-    3650, 3256, 2867, 2474, 2084, 1692, 1304, 915, 531, 142, -235, -620, -995, -1373, -1744, -2113, 
-    -2480, -2838, -3195, -3541, -3885, -4220, -4548, -4867, -5178, -5482, -5777, -6060, -6336, -6601, -6861, -7103, 
-    -7344, -7567, -7787, -7989, -8187, -8368, -8543, -8705, -8853, -8991, -9116, -9232, -9328, -9420, -9493, -9556, 
-    -9602, -9639, -9657, -9664, -9653, -9629, -9589, -9531, -9459, -9369, -9262, -9136, -8993, -8833, -8652, -8455, 
-    -8238, -8005, -7751, -7477, -7189, -6877, -6555, -6206, -5847, -5466, -5074, -4662, -4238, -3800, -3347, -2884, 
-    -2410, -1929, -1435, -940, -436, 71, 577, 1090, 1596, 2104, 2605, 3106, 3594, 4078, 4553, 5016, 
-    5469, 5910, 6336, 6752, 7149, 7535, 7901, 8255, 8590, 8909, 9214, 9497, 9768, 10016, 10251, 10465, 
-    10663, 10838, 11000, 11138, 11264, 11364, 11451, 11514, 11564, 11593, 11599, 11592, 11561, 11515, 11442, 11357, 
-    11246, 11119, 10968, 10798, 10609, 10396, 10166, 9911, 9642, 9348, 9041, 8711, 8367, 8006, 7632, 7243, 
-    6844, 6431, 6012, 5585, 5150, 4710, 4268, 3825, 3373, 2926, 2477, 2027, 1576, 1126, 677, 219, 
-    -231, -689, -1147, -1613, -2076, -2547, -3019, -3495, -3971, -4450, -4927, -5404, -5877, -6345, -6803, -7256, 
-    -7693, -8122, -8528, -8923, -9296, -9649, -9979, -10290, -10578, -10842, -11085, -11311, -11513, -11697, -11864, -12016, 
-    -12151, -12274, -12382, -12481, -12568, -12644, -12711, -12764, -12810, -12837, -12857, -12859, -12842, -12809, -12752, -12681, 
-    -12573, -12454, -12298, -12120, -11909, -11677, -11411, -11117, -10797, -10452, -10079, -9684, -9265, -8829, -8369, -7899, 
-    -7407, -6908, -6392, -5872, -5340, -4804, -4260, -3711, -3159, -2600, -2042, -1476, -908, -337, 236, 812, 
-    1395, 1975, 2561, 3145, 3731, 4317, 4900, 5479, 6054, 6623, 7183, 7732, 8269, 8792, 9299, 9790, 
-    10260, 10712, 11140, 11549, 11933, 12294, 12632, 12944, 13237, 13498, 13747, 13960, 14163, 14332, 14492, 14618, 
-    14734, 14819, 14895, 14939, 14969, 14973, 14962, 14922, 14864, 14781, 14674, 14544, 14388, 14212, 14007, 13778, 
-    13525, 13246, 12945, 12615, 12266, 11893, 11498, 11082, 10649, 10196, 9727, 9243, 8748, 8236, 7716, 7188, 
-    6648, 6104, 5551, 4997, 4435, 3870, 3305, 2733, 2163, 1587, 1013, 435, -144, -722, -1305, -1887, 
-    -2466, -3050, -3625, -4206, -4774, -5347, -5907, -6464, -7009, -7549, -8072, -8588, -9085, -9569, -10035, -10482, 
-    -10913, -11320, -11710, -12075, -12423, -12744, -13048, -13325, -13583, -13820, -14033, -14226, -14396, -14548, -14676, -14787, 
-    -14875, -14944, -14990, -15022, -15027, -15020, -14986, -14941, -14868, -14785, -14674, -14552, -14406, -14245, -14062, -13861, 
-    -13643, -13404, -13147, -12871, -12575, -12262, -11927, -11577, -11204, -10815, -10404, -9978, -9531, -9069, -8586, -8089, 
-    -7572, -7045, -6495, -5936, -5360, -4774, -4171, -3562, -2940, -2312, -1677, -1035, -390, 258, 906, 1557, 
-    2205, 2852, 3493, 4131, 4764, 5390, 6006, 6613, 7214, 7801, 8380, 8940, 9493, 10028, 10552, 11054, 
-    11545, 12013, 12468, 12898, 13311, 13702, 14067, 14411, 14726, 15019, 15280, 15514, 15718, 15893, 16035, 16146, 
-    16224, 16268, 16282, 16259, 16209, 16119, 16007, 15858, 15684, 15479, 15250, 14996, 14717, 14418, 14099, 13757, 
-    13402, 13030, 12644, 12242, 11828, 11405, 10967, 10521, 10062, 9593, 9115, 8624, 8126, 7612, 7093, 6561, 
-    6019, 5466, 4905, 4334, 3753, 3166, 2572, 1975, 1373, 771, 168, -430, -1024, -1615, -2196, -2768, 
-    -3331, -3878, -4417, -4936, -5445, -5934, -6409, -6870, -7309, -7741, -8150, -8553, -8935, -9313, -9670, -10025, 
-    -10362, -10698, -11013, -11334, -11629, -11930, -12208, -12485, -12741, -12994, -13224, -13445, -13645, -13829, -13990, -14135, 
-    -14254, -14350, -14423, -14471, -14490, -14487, -14455, -14398, -14309, -14199, -14058, -13898, -13703, -13490, -13249, -12989, 
-    -12699, -12394, -12063, -11715, -11346, -10959, -10555, -10132, -9696, -9242, -8777, -8294, -7802, -7295, -6778, -6248, 
-    -5710, -5163, -4606, -4041, -3473, -2896, -2316, -1731, -1142, -556, 39, 624, 1217, 1800, 2382, 2957, 
-    3526, 4086, 4635, 5173, 5700, 6211, 6708, 7191, 7652, 8104, 8531, 8942, 9333, 9706, 10057, 10388, 
-    10700, 10987, 11253, 11496, 11722, 11916, 12093, 12245, 12375, 12478, 12562, 12621, 12656, 12672, 12662, 12638, 
-    12585, 12520, 12432, 12329, 12209, 12074, 11924, 11760, 11586, 11398, 11200, 10992, 10773, 10545, 10308, 10058, 
-    9803, 9532, 9258, 8962, 8665, 8348, 8022, 7681, 7329, 6965, 6587, 6199, 5799, 5390, 4969, 4545, 
-    4110, 3672, 3228, 2781, 2332, 1882, 1431, 980, 533, 85, -362, -806, -1250, -1690, -2133, -2572, 
-    -3011, -3450, -3887, -4324, -4759, -5194, -5627, -6055, -6483, -6900, -7319, -7718, -8120, -8497, -8875, -9222, 
-    -9564, -9877, -10176, -10447, -10698, -10918, -11118, -11284, -11429, -11540, -11624, -11685, -11712, -11718, -11693, -11649, 
-    -11576, -11481, -11368, -11230, -11078, -10902, -10717, -10509, -10292, -10059, -9812, -9555, -9281, -9001, -8702, -8399, 
-    -8078, -7749, -7409, -7059, -6700, -6330, -5952, -5566, -5171, -4776, -4367, -3958, -3544, -3126, -2708, -2285, 
-    -1865, -1441, -1022, -601, -184, 232, 642, 1052, 1457, 1857, 2253, 2645, 3030, 3413, 3785, 4157, 
-    4517, 4875, 5218, 5559, 5883, 6202, 6504, 6795, 7070, 7331, 7579, 7804, 8020, 8209, 8391, 8546, 
-    8689, 8811, 8920, 9007, 9080, 9136, 9179, 9203, 9216, 9211, 9197, 9168, 9128, 9073, 9010, 8933, 
-    8846, 8745, 8635, 8514, 8377, 8231, 8071, 7899, 7714, 7515, 7306, 7079, 6845, 6593, 6330, 6054, 
-    5766, 5470, 5157, 4843, 4510, 4184, 3834, 3497, 3139, 2794, 2434, 2086, 1729, 1381, 1032, 690, 
-    350, 19, -310, -627, -946, -1251, -1556, -1851, -2146, -2434, -2718, -3001, -3283, -3561, -3838, -4115, 
-    -4390, -4663, -4937, -5203, -5474, -5729, -5993, -6234, -6481, -6704, -6928, -7127, -7319, -7487, -7644, -7775, 
-    -7890, -7980, -8048, -8094, -8118, -8120, -8100, -8059, -8002, -7920, -7830, -7715, -7596, -7455, -7311, -7151, 
-    -6987, -6812, -6633, -6444, -6254, -6056, -5854, -5645, -5431, -5213, -4987, -4757, -4519, -4275, -4024, -3765, 
-    -3501, -3224, -2945, -2655, -2360, -2057, -1746, -1435, -1114, -795, -469, -147, 177, 501, 820, 1135, 
-    1446, 1753, 2049, 2336, 2615, 2885, 3141, 3387, 3622, 3845, 4056, 4251, 4440, 4612, 4777, 4923, 
-    5067, 5192, 5313, 5421, 5519, 5610, 5687, 5761, 5822, 5878, 5921, 5957, 5984, 6004, 6010, 6011, 
-    6000, 5981, 5948, 5911, 5857, 5798, 5725, 5644, 5551, 5447, 5336, 5212, 5079, 4936, 4784, 4620, 
-    4452, 4268, 4084, 3885, 3686, 3473, 3261, 3037, 2812, 2583, 2347, 2110, 1868, 1628, 1384, 1139, 
-    898, 653, 413, 173, -61, -295, -525, -750, -970, -1186, -1398, -1603, -1804, -2002, -2190, -2377, 
-    -2557, -2736, -2902, -3070, -3228, -3384, -3533, -3676, -3812, -3944, -4067, -4185, -4292, -4392, -4483, -4563, 
-    -4639, -4696, -4747, -4785, -4815, -4827, -4834, -4821, -4804, -4765, -4725, -4661, -4596, -4513, -4420, -4318, 
-    -4206, -4084, -3954, -3816, -3672, -3519, -3364, -3199, -3035, -2861, -2690, -2509, -2333, -2150, -1965, -1783, 
-    -1594, -1412, -1220, -1036, -845, -659, -470, -281, -93, 96, 286, 478, 666, 858, 1046, 1239, 
-    1424, 1615, 1798, 1983, 2162, 2341, 2515, 2685, 2849, 3010, 3164, 3314, 3455, 3593, 3721, 3843, 
-    3959, 4063, 4163, 4250, 4333, 4403, 4464, 4517, 4555, 4592, 4608, 4621, 4621, 4609, 4591, 4554, 
-    4516, 4458, 4400, 4323, 4245, 4148, 4054, 3940, 3829, 3702, 3574, 3436, 3299, 3148, 2999, 2843, 
-    2683, 2520, 2351, 2183, 2004, 1824, 1641, 1449, 1256, 1054, 849, 635, 418, 196, -34, -268, 
-    -511, -751, -1003, -1249, -1507, -1755, -2014, -2262, -2516, -2759, -3002, -3240, -3468, -3691, -3901, -4109, 
-    -4301, -4484, -4657, -4822, -4970, -5115, -5242, -5367, -5474, -5578, -5670, -5752, -5829, -5896, -5958, -6007, 
-    -6054, -6086, -6118, -6133, -6147, -6142, -6140, -6112, -6086, -6038, -5986, -5912, -5831, -5731, -5617, -5488, 
-    -5341, -5181, -4999, -4807, -4593, -4368, -4125, -3868, -3600, -3317, -3025, -2722, -2411, -2091, -1768, -1436, 
-    -1106, -765, -435, -93, 241, 574, 904, 1236, 1560, 1882, 2196, 2510, 2813, 3115, 3411, 3699, 
-    3981, 4259, 4526, 4793, 5047, 5300, 5537, 5777, 5997, 6221, 6424, 6630, 6814, 6997, 7164, 7323, 
-    7467, 7604, 7723, 7834, 7930, 8014, 8085, 8142, 8186, 8216, 8234, 8236, 8224, 8197, 8159, 8104, 
-    8037, 7953, 7862, 7749, 7631, 7493, 7348, 7187, 7017, 6834, 6640, 6437, 6221, 5998, 5763, 5524, 
-    5270, 5012, 4745, 4474, 4191, 3903, 3609, 3313, 3001, 2695, 2373, 2054, 1722, 1392, 1052, 712, 
-    361, 18, -343, -694, -1059, -1415, -1785, -2144, -2513, -2873, -3240, -3599, -3957, -4313, -4662, -5011, 
-    -5347, -5683, -6007, -6324, -6632, -6932, -7220, -7500, -7767, -8024, -8267, -8499, -8719, -8924, -9117, -9292, 
-    -9456, -9604, -9736, -9851, -9949, -10033, -10094, -10143, -10165, -10177, -10161, -10134, -10079, -10013, -9918, -9815, 
-    -9683, -9542, -9376, -9200, -9001, -8795, -8570, -8334, -8083, -7824, -7554, -7274, -6981, -6686, -6375, -6064, 
-    -5736, -5409, -5067, -4723, -4367, -4009, -3637, -3265, -2880, -2493, -2094, -1696, -1290, -879, -462, -47, 
-    371, 789, 1209, 1627, 2040, 2452, 2858, 3258, 3651, 4036, 4413, 4779, 5139, 5486, 5827, 6152, 
-    6471, 6778, 7074, 7364, 7639, 7908, 8163, 8411, 8650, 8873, 9092, 9292, 9488, 9661, 9831, 9978, 
-    10117, 10234, 10339, 10422, 10493, 10538, 10571, 10580, 10572, 10543, 10496, 10432, 10348, 10248, 10130, 9999, 
-    9851, 9692, 9517, 9334, 9135, 8935, 8714, 8495, 8259, 8023, 7771, 7520, 7255, 6989, 6707, 6428, 
-    6127, 5831, 5512, 5199, 4860, 4523, 4168, 3808, 3430, 3051, 2652, 2253, 1834, 1420, 986, 558, 
-    112, -322, -772, -1211, -1661, -2096, -2537, -2963, -3389, -3799, -4206, -4593, -4975, -5333, -5689, -6016, 
-    -6340, -6636, -6925, -7192, -7446, -7682, -7904, -8110, -8305, -8484, -8651, -8807, -8950, -9088, -9206, -9325, 
-    -9423, -9525, -9603, -9682, -9744, -9801, -9841, -9876, -9891, -9901, -9888, -9869, -9828, -9772, -9700, -9607, 
-    -9502, -9369, -9225, -9058, -8872, -8673, -8443, -8213, -7947, -7685, -7388, -7096, -6776, -6454, -6115, -5775, 
-    -5421, -5064, -4699, -4334, -3964, -3591, -3221, -2845, -2479, -2101, -1738, -1365, -1004, -636, -276, 83, 
-    440, 791, 1147, 1493, 1843, 2181, 2525, 2860, 3194, 3522, 3845, 4165, 4475, 4783, 5078, 5372, 
-    5650, 5923, 6181, 6433, 6667, 6892, 7098, 7295, 7470, 7636, 7779, 7909, 8021, 8119, 8195, 8259, 
-    8303, 8335, 8349, 8348, 8335, 8305, 8267, 8213, 8149, 8076, 7989, 7899, 7792, 7685, 7562, 7438, 
-    7299, 7159, 7006, 6848, 6680, 6505, 6322, 6129, 5929, 5720, 5505, 5277, 5040, 4797, 4547, 4286, 
-    4016, 3741, 3460, 3169, 2876, 2575, 2272, 1964, 1653, 1341, 1025, 710, 394, 76, -238, -554, 
-    -871, -1180, -1496, -1800, -2113, -2409, -2715, -3010, -3304, -3592, -3873, -4153, -4422, -4686, -4940, -5187, 
-    -5423, -5647, -5860, -6060, -6247, -6417, -6575, -6712, -6837, -6940, -7028, -7095, -7148, -7178, -7192, -7186, 
-    -7163, -7124, -7063, -6992, -6899, -6799, -6677, -6552, -6405, -6256, -6089, -5922, -5737, -5551, -5352, -5152, 
-    -4941, -4725, -4504, -4274, -4044, -3803, -3558, -3307, -3051, -2790, -2523, -2251, -1975, -1695, -1409, -1123, 
-    -833, -539, -248, 46, 335, 631, 913, 1201, 1478, 1757, 2021, 2287, 2540, 2789, 3029, 3259, 
-    3485, 3695, 3903, 4098, 4284, 4463, 4629, 4791, 4938, 5079, 5209, 5330, 5441, 5544, 5632, 5715, 
-    5786, 5846, 5896, 5935, 5963, 5979, 5981, 5977, 5955, 5926, 5877, 5823, 5751, 5670, 5574, 5465, 
-    5347, 5216, 5072, 4920, 4755, 4587, 4401, 4216, 4015, 3817, 3607, 3392, 3175, 2951, 2734, 2502, 
-    2282, 2047, 1824, 1591, 1366, 1131, 903, 668, 439, 200, -33, -273, -513, -756, -999, -1247, 
-    -1495, -1744, -1996, -2247, -2498, -2748, -2999, -3246, -3490, -3729, -3969, -4197, -4422, -4639, -4851, -5052, 
-    -5242, -5425, -5599, -5760, -5911, -6051, -6179, -6297, -6398, -6496, -6571, -6643, -6694, -6743, -6772, -6793, 
-    -6798, -6795, -6778, -6749, -6705, -6652, -6584, -6506, -6410, -6306, -6186, -6059, -5911, -5757, -5588, -5404, 
-    -5213, -5003, -4791, -4554, -4321, -4066, -3812, -3536, -3262, -2974, -2680, -2379, -2070, -1758, -1438, -1116, 
-    -786, -459, -122, 211, 549, 888, 1224, 1568, 1903, 2246, 2576, 2916, 3243, 3574, 3896, 4218, 
-    4529, 4837, 5135, 5429, 5709, 5981, 6243, 6491, 6728, 6949, 7158, 7352, 7526, 7690, 7831, 7961, 
-    8068, 8164, 8239, 8300, 8344, 8375, 8387, 8390, 8377, 8354, 8315, 8273, 8213, 8151, 8076, 7995, 
-    7907, 7806, 7705, 7589, 7470, 7337, 7198, 7048, 6888, 6716, 6534, 6338, 6129, 5909, 5673, 5428, 
-    5162, 4893, 4600, 4304, 3991, 3668, 3338, 2996, 2650, 2294, 1938, 1577, 1218, 851, 493, 131, 
-    -220, -576, -919, -1265, -1596, -1931, -2252, -2571, -2881, -3190, -3488, -3786, -4073, -4365, -4644, -4927, 
-    -5201, -5477, -5746, -6019, -6281, -6546, -6803, -7061, -7312, -7553, -7793, -8019, -8243, -8449, -8649, -8835, 
-    -9004, -9162, -9301, -9425, -9528, -9616, -9683, -9728, -9755, -9763, -9750, -9716, -9663, -9591, -9499, -9395, 
-    -9266, -9128, -8968, -8800, -8614, -8417, -8209, -7987, -7758, -7517, -7265, -7005, -6732, -6458, -6163, -5871, 
-    -5558, -5247, -4917, -4585, -4242, -3890, -3531, -3163, -2790, -2408, -2024, -1630, -1237, -837, -439, -33, 
-    364, 770, 1164, 1565, 1954, 2345, 2724, 3100, 3467, 3828, 4177, 4522, 4853, 5178, 5491, 5796, 
-    6089, 6374, 6647, 6911, 7163, 7408, 7637, 7861, 8070, 8270, 8456, 8634, 8796, 8948, 9088, 9214, 
-    9327, 9425, 9511, 9580, 9638, 9677, 9706, 9711, 9710, 9686, 9654, 9598, 9535, 9450, 9357, 9245, 
-    9124, 8986, 8837, 8676, 8503, 8321, 8124, 7922, 7705, 7481, 7244, 7005, 6748, 6489, 6214, 5937, 
-    5646, 5353, 5044, 4737, 4413, 4092, 3755, 3423, 3075, 2731, 2381, 2028, 1674, 1316, 963, 604, 
-    251, -101, -453, -800, -1152, -1487, -1835, -2163, -2504, -2821, -3155, -3468, -3787, -4093, -4403, -4698, 
-    -4995, -5280, -5564, -5834, -6101, -6356, -6605, -6839, -7068, -7278, -7481, -7667, -7843, -8000, -8143, -8269, 
-    -8381, -8473, -8550, -8611, -8654, -8682, -8692, -8686, -8664, -8628, -8577, -8512, -8432, -8342, -8237, -8123, 
-    -7997, -7860, -7713, -7557, -7395, -7219, -7039, -6846, -6651, -6441, -6228, -6006, -5774, -5537, -5287, -5036, 
-    -4771, -4504, -4226, -3943, -3653, -3358, -3057, -2750, -2443, -2129, -1817, -1496, -1184, -865, -552, -238, 
-    68, 374, 674, 969, 1255, 1538, 1807, 2075, 2329, 2578, 2813, 3041, 3260, 3467, 3666, 3852, 
-    4030, 4199, 4359, 4509, 4647, 4784, 4906, 5025, 5133, 5236, 5333, 5420, 5505, 5580, 5654, 5720, 
-    5779, 5833, 5882, 5926, 5961, 5989, 6014, 6026, 6035, 6029, 6021, 5997, 5968, 5921, 5870, 5803, 
-    5727, 5635, 5537, 5422, 5300, 5163, 5019, 4863, 4697, 4525, 4344, 4156, 3961, 3763, 3557, 3350, 
-    3139, 2925, 2709, 2490, 2272, 2055, 1832, 1616, 1391, 1177, 955, 741, 518, 308, 92, -119, 
-    -331, -539, -744, -946, -1144, -1341, -1530, -1716, -1892, -2071, -2230, -2397, -2541, -2692, -2820, -2953, 
-    -3065, -3178, -3271, -3364, -3437, -3510, -3562, -3615, -3644, -3678, -3685, -3697, -3682, -3675, -3643, -3613, 
-    -3563, -3514, -3451, -3384, -3306, -3225, -3137, -3043, -2944, -2840, -2733, -2620, -2505, -2386, -2262, -2137, 
-    -2008, -1876, -1740, -1600, -1463, -1312, -1172, -1018, -868, -715, -559, -407, -247, -95, 60, 214, 
-    362, 513, 655, 797, 933, 1062, 1192, 1306, 1428, 1529, 1642, 1733, 1834, 1917, 2009, 2083, 
-    2165, 2237, 2309, 2374, 2440, 2502, 2558, 2611, 2663, 2707, 2748, 2781, 2810, 2831, 2847, 2849, 
-    2849, 2833, 2816, 2782, 2742, 2694, 2629, 2564, 2481, 2396, 2295, 2192, 2078, 1955, 1827, 1689, 
-    1550, 1396, 1245, 1078, 917, 742, 567, 382, 200, 8, -182, -378, -573, -776, -971, -1172, 
-    -1368, -1565, -1756, -1948, -2129, -2310, -2481, -2651, -2807, -2960, -3104, -3238, -3367, -3486, -3596, -3699, 
-    -3794, -3883, -3961, -4036, -4103, -4163, -4217, -4266, -4307, -4346, -4375, -4402, -4420, -4431, -4442, -4438, 
-    -4435, -4418, -4402, -4369, -4337, -4290, -4240, -4178, -4113, -4035, -3948, -3858, -3755, -3650, -3529, -3412, 
-    -3277, -3147, -3000, -2854, -2699, -2541, -2375, -2207, -2032, -1854, -1668, -1483, -1289, -1095, -890, -689, 
-    -477, -268, -46, 168, 396, 620, 853, 1083, 1321, 1557, 1797, 2038, 2277, 2524, 2760, 3007, 
-    3241, 3482, 3713, 3947, 4172, 4395, 4612, 4827, 5029, 5231, 5421, 5609, 5783, 5955, 6110, 6264, 
-    6404, 6536, 6655, 6767, 6866, 6956, 7031, 7100, 7152, 7195, 7226, 7243, 7250, 7241, 7223, 7189, 
-    7143, 7085, 7011, 6927, 6827, 6720, 6593, 6462, 6312, 6158, 5988, 5813, 5625, 5431, 5228, 5020, 
-    4806, 4582, 4360, 4127, 3899, 3658, 3421, 3179, 2936, 2689, 2439, 2192, 1936, 1682, 1423, 1163, 
-    898, 631, 358, 84, -197, -477, -767, -1053, -1350, -1641, -1941, -2234, -2533, -2828, -3120, -3412, 
-    -3696, -3979, -4253, -4523, -4783, -5038, -5284, -5520, -5749, -5966, -6179, -6375, -6569, -6747, -6923, -7083, 
-    -7237, -7382, -7517, -7641, -7757, -7865, -7957, -8045, -8114, -8181, -8226, -8264, -8289, -8297, -8293, -8271, 
-    -8238, -8189, -8120, -8041, -7943, -7833, -7707, -7566, -7412, -7244, -7064, -6874, -6670, -6458, -6236, -6004, 
-    -5768, -5519, -5270, -5008, -4747, -4474, -4202, -3921, -3640, -3350, -3061, -2763, -2466, -2162, -1859, -1545, 
-    -1238, -923, -608, -290, 26, 344, 664, 980, 1296, 1609, 1920, 2224, 2527, 2822, 3113, 3394, 
-    3673, 3939, 4202, 4452, 4696, 4928, 5153, 5365, 5571, 5761, 5947, 6116, 6281, 6428, 6573, 6699, 
-    6821, 6928, 7029, 7118, 7196, 7268, 7327, 7380, 7419, 7454, 7477, 7490, 7495, 7490, 7478, 7452, 
-    7423, 7377, 7328, 7263, 7194, 7107, 7016, 6910, 6797, 6667, 6531, 6380, 6222, 6049, 5866, 5673, 
-    5469, 5255, 5028, 4796, 4550, 4301, 4036, 3769, 3492, 3211, 2920, 2625, 2328, 2025, 1719, 1409, 
-    1102, 791, 484, 175, -128, -434, -730, -1026, -1313, -1602, -1878, -2153, -2417, -2680, -2932, -3177, 
-    -3417, -3646, -3873, -4087, -4297, -4495, -4687, -4871, -5044, -5207, -5362, -5507, -5640, -5761, -5868, -5972, 
-    -6050, -6127, -6177, -6228, -6250, -6269, -6265, -6256, -6221, -6185, -6125, -6061, -5975, -5886, -5781, -5668, 
-    -5543, -5412, -5269, -5124, -4965, -4808, -4635, -4467, -4287, -4107, -3920, -3731, -3538, -3341, -3143, -2937, 
-    -2736, -2523, -2316, -2098, -1887, -1666, -1447, -1228, -1003, -784, -558, -338, -115, 104, 323, 541, 
-    755, 967, 1176, 1381, 1583, 1780, 1974, 2163, 2348, 2529, 2704, 2877, 3042, 3203, 3364, 3513, 
-    3663, 3801, 3943, 4069, 4196, 4313, 4425, 4529, 4624, 4712, 4792, 4862, 4920, 4969, 5009, 5035, 
-    5050, 5053, 5045, 5023, 4990, 4946, 4887, 4818, 4737, 4646, 4542, 4431, 4304, 4174, 4029, 3882, 
-    3718, 3553, 3375, 3195, 3003, 2808, 2602, 2396, 2179, 1960, 1731, 1503, 1265, 1028, 781, 538, 
-    285, 33, -219, -473, -727, -982, -1234, -1482, -1732, -1972, -2213, -2442, -2670, -2887, -3099, -3301, 
-    -3494, -3681, -3855, -4023, -4180, -4327, -4464, -4595, -4714, -4822, -4924, -5018, -5101, -5175, -5242, -5302, 
-    -5352, -5398, -5429, -5459, -5474, -5489, -5486, -5481, -5462, -5437, -5400, -5350, -5294, -5224, -5143, -5049, 
-    -4947, -4828, -4704, -4563, -4414, -4253, -4084, -3904, -3714, -3521, -3315, -3109, -2891, -2674, -2450, -2225, 
-    -1994, -1764, -1533, -1299, -1065, -832, -598, -361, -129, 109, 339, 585, 814, 1061, 1296, 1546, 
-    1787, 2039, 2287, 2541, 2793, 3052, 3307, 3567, 3820, 4083, 4333, 4587, 4836, 5080, 5320, 5550, 
-    5775, 5991, 6197, 6393, 6577, 6750, 6909, 7058, 7190, 7309, 7417, 7504, 7585, 7643, 7695, 7725, 
-    7747, 7750, 7741, 7719, 7680, 7632, 7567, 7491, 7398, 7296, 7181, 7051, 6912, 6757, 6595, 6416, 
-    6231, 6031, 5823, 5603, 5372, 5134, 4882, 4623, 4354, 4076, 3791, 3492, 3193, 2878, 2563, 2233, 
-    1902, 1564, 1220, 869, 516, 157, -201, -564, -926, -1293, -1652, -2016, -2370, -2726, -3071, -3416, 
-    -3746, -4073, -4388, -4695, -4989, -5270, -5545, -5802, -6053, -6285, -6511, -6720, -6924, -7111, -7294, -7461, 
-    -7622, -7772, -7915, -8049, -8172, -8290, -8396, -8497, -8586, -8668, -8737, -8800, -8850, -8891, -8917, -8936, 
-    -8936, -8930, -8905, -8870, -8815, -8754, -8671, -8577, -8466, -8344, -8205, -8051, -7886, -7704, -7511, -7304, 
-    -7085, -6854, -6609, -6358, -6088, -5815, -5531, -5233, -4931, -4616, -4297, -3965, -3633, -3285, -2939, -2581, 
-    -2222, -1854, -1483, -1108, -729, -348, 35, 423, 807, 1196, 1585, 1970, 2356, 2739, 3121, 3499, 
-    3870, 4240, 4600, 4957, 5301, 5642, 5970, 6287, 6596, 6888, 7174, 7440, 7698, 7936, 8165, 8376, 
-    8570, 8754, 8916, 9070, 9199, 9323, 9422, 9517, 9588, 9654, 9695, 9736, 9752, 9768, 9758, 9748, 
-    9718, 9683, 9630, 9571, 9498, 9411, 9319, 9209, 9094, 8957, 8817, 8659, 8492, 8310, 8117, 7910, 
-    7689, 7458, 7211, 6953, 6680, 6397, 6098, 5794, 5471, 5142, 4799, 4450, 4091, 3722, 3350, 2967, 
-    2584, 2191, 1800, 1403, 1007, 610, 215, -177, -570, -955, -1341, -1716, -2093, -2455, -2821, -3171, 
-    -3522, -3861, -4196, -4522, -4843, -5154, -5461, -5755, -6050, -6328, -6606, -6869, -7128, -7374, -7611, -7839, 
-    -8052, -8255, -8444, -8620, -8781, -8924, -9056, -9167, -9266, -9342, -9405, -9448, -9474, -9482, -9472, -9448, 
-    -9402, -9345, -9270, -9181, -9078, -8958, -8830, -8687, -8535, -8367, -8194, -8010, -7816, -7612, -7403, -7182, 
-    -6957, -6721, -6481, -6228, -5977, -5711, -5442, -5163, -4883, -4591, -4299, -3995, -3692, -3380, -3065, -2745, 
-    -2425, -2097, -1770, -1435, -1107, -767, -435, -94, 240, 580, 914, 1252, 1585, 1918, 2247, 2573, 
-    2896, 3213, 3526, 3832, 4133, 4425, 4711, 4984, 5252, 5507, 5751, 5983, 6202, 6408, 6601, 6781, 
-    6944, 7094, 7229, 7350, 7455, 7551, 7626, 7692, 7740, 7780, 7805, 7818, 7820, 7807, 7790, 7755, 
-    7715, 7659, 7601, 7526, 7447, 7351, 7251, 7139, 7016, 6883, 6739, 6586, 6421, 6244, 6061, 5861, 
-    5660, 5438, 5217, 4976, 4739, 4484, 4229, 3962, 3696, 3421, 3145, 2863, 2583, 2298, 2017, 1733, 
-    1452, 1169, 893, 614, 344, 70, -195, -461, -721, -979, -1235, -1483, -1734, -1974, -2216, -2451, 
-    -2684, -2910, -3135, -3352, -3565, -3773, -3975, -4169, -4356, -4538, -4710, -4873, -5027, -5171, -5304, -5429, 
-    -5537, -5641, -5723, -5806, -5861, -5918, -5951, -5980, -5990, -5993, -5982, -5958, -5924, -5880, -5826, -5757, 
-    -5683, -5596, -5504, -5398, -5285, -5167, -5035, -4902, -4752, -4604, -4441, -4274, -4099, -3916, -3730, -3532, 
-    -3333, -3122, -2911, -2690, -2467, -2236, -2006, -1766, -1528, -1285, -1044, -798, -552, -309, -65, 177, 
-    416, 655, 888, 1120, 1346, 1568, 1786, 1995, 2204, 2399, 2593, 2776, 2954, 3122, 3285, 3435, 
-    3580, 3715, 3841, 3956, 4063, 4162, 4247, 4328, 4394, 4453, 4501, 4543, 4570, 4593, 4603, 4607, 
-    4603, 4589, 4568, 4541, 4507, 4463, 4415, 4361, 4301, 4232, 4162, 4080, 3997, 3905, 3809, 3705, 
-    3595, 3479, 3353, 3226, 3086, 2943, 2789, 2633, 2463, 2293, 2110, 1923, 1730, 1531, 1326, 1116, 
-    903, 685, 467, 244, 24, -200, -421, -640, -860, -1072, -1288, -1493, -1698, -1897, -2090, -2280, 
-    -2461, -2641, -2811, -2978, -3139, -3293, -3442, -3586, -3725, -3855, -3983, -4101, -4219, -4324, -4429, -4523, 
-    -4612, -4689, -4766, -4826, -4884, -4924, -4966, -4985, -5004, -5005, -4999, -4981, -4951, -4912, -4859, -4799, 
-    -4725, -4644, -4551, -4447, -4338, -4214, -4088, -3948, -3805, -3651, -3495, -3326, -3159, -2976, -2800, -2608, 
-    -2419, -2223, -2023, -1821, -1611, -1405, -1188, -975, -753, -535, -309, -84, 143, 372, 603, 837, 
-    1067, 1301, 1535, 1769, 2002, 2231, 2464, 2691, 2920, 3138, 3362, 3574, 3791, 3991, 4196, 4388, 
-    4576, 4757, 4927, 5094, 5247, 5394, 5530, 5658, 5775, 5882, 5979, 6066, 6143, 6208, 6262, 6308, 
-    6342, 6368, 6378, 6384, 6375, 6360, 6330, 6297, 6246, 6194, 6124, 6049, 5962, 5869, 5763, 5646, 
-    5523, 5389, 5246, 5091, 4931, 4756, 4580, 4385, 4194, 3982, 3772, 3549, 3322, 3087, 2847, 2600, 
-    2349, 2093, 1833, 1570, 1303, 1037, 767, 496, 226, -44, -311, -581, -845, -1109, -1369, -1628, 
-    -1881, -2131, -2379, -2624, -2860, -3096, -3326, -3554, -3774, -3992, -4205, -4413, -4617, -4814, -5006, -5195, 
-    -5376, -5549, -5718, -5879, -6032, -6175, -6311, -6438, -6556, -6659, -6759, -6839, -6918, -6973, -7028, -7060, 
-    -7091, -7100, -7104, -7091, -7070, -7035, -6991, -6934, -6868, -6786, -6704, -6599, -6498, -6372, -6253, -6108, 
-    -5970, -5806, -5648, -5471, -5292, -5100, -4901, -4695, -4480, -4261, -4029, -3798, -3553, -3311, -3053, -2805, 
-    -2537, -2279, -2007, -1743, -1468, -1198, -924, -653, -379, -107, 163, 433, 698, 968, 1230, 1492, 
-    1749, 2008, 2261, 2512, 2758, 3004, 3241, 3481, 3707, 3937, 4151, 4370, 4573, 4776, 4963, 5148, 
-    5322, 5487, 5641, 5783, 5920, 6039, 6154, 6252, 6344, 6420, 6490, 6546, 6594, 6632, 6661, 6679, 
-    6688, 6693, 6682, 6672, 6645, 6618, 6576, 6534, 6476, 6414, 6343, 6263, 6174, 6077, 5969, 5852, 
-    5724, 5588, 5439, 5281, 5113, 4933, 4747, 4547, 4343, 4125, 3907, 3672, 3441, 3198, 2955, 2707, 
-    2454, 2204, 1949, 1698, 1444, 1193, 944, 698, 451, 212, -27, -259, -495, -718, -947, -1164, 
-    -1385, -1594, -1807, -2010, -2216, -2410, -2608, -2792, -2984, -3158, -3338, -3502, -3669, -3825, -3976, -4119, 
-    -4256, -4384, -4504, -4618, -4720, -4817, -4901, -4980, -5047, -5107, -5154, -5195, -5227, -5247, -5261, -5264, 
-    -5260, -5244, -5227, -5192, -5158, -5109, -5058, -4997, -4929, -4856, -4772, -4687, -4592, -4491, -4386, -4273, 
-    -4157, -4033, -3905, -3773, -3633, -3493, -3344, -3196, -3040, -2880, -2720, -2553, -2387, -2214, -2042, -1865, 
-    -1688, -1509, -1329, -1148, -961, -781, -596, -414, -227, -47, 138, 315, 499, 672, 852, 1022, 
-    1194, 1359, 1522, 1680, 1834, 1985, 2125, 2264, 2395, 2522, 2637, 2750, 2855, 2952, 3041, 3124, 
-    3198, 3267, 3326, 3378, 3423, 3462, 3494, 3516, 3536, 3544, 3553, 3547, 3543, 3525, 3507, 3482, 
-    3448, 3414, 3365, 3322, 3261, 3207, 3134, 3069, 2987, 2909, 2817, 2727, 2628, 2528, 2420, 2309, 
-    2197, 2077, 1962, 1831, 1715, 1581, 1461, 1326, 1202, 1069, 944, 812, 688, 560, 437, 311, 
-    191, 72, -45, -160, -275, -383, -493, -598, -703, -803, -903, -998, -1091, -1183, -1269, -1358, 
-    -1435, -1518, -1589, -1669, -1732, -1802, -1859, -1923, -1972, -2027, -2067, -2115, -2146, -2183, -2207, -2232, 
-    -2248, -2261, -2269, -2271, -2266, -2259, -2245, -2226, -2201, -2171, -2136, -2096, -2050, -2001, -1943, -1886, 
-    -1816, -1750, -1672, -1597, -1510, -1426, -1333, -1239, -1141, -1039, -935, -828, -718, -608, -493, -379, 
-    -261, -146, -26, 94, 213, 331, 454, 571, 695, 808, 929, 1044, 1160, 1269, 1383, 1490, 
-    1598, 1697, 1802, 1895, 1989, 2081, 2165, 2249, 2324, 2400, 2466, 2530, 2587, 2642, 2687, 2731, 
-    2766, 2796, 2819, 2837, 2849, 2851, 2850, 2839, 2825, 2797, 2769, 2726, 2683, 2624, 2566, 2494, 
-    2418, 2331, 2242, 2142, 2037, 1925, 1809, 1686, 1557, 1424, 1288, 1149, 1002, 859, 707, 561, 
-    404, 255, 99, -50, -208, -356, -511, -659, -810, -956, -1100, -1244, -1382, -1520, -1652, -1783, 
-    -1908, -2031, -2147, -2264, -2367, -2474, -2570, -2665, -2753, -2834, -2914, -2983, -3051, -3110, -3169, -3218, 
-    -3265, -3302, -3341, -3370, -3398, -3417, -3434, -3447, -3454, -3457, -3458, -3452, -3444, -3432, -3415, -3392, 
-    -3369, -3339, -3306, -3266, -3226, -3178, -3125, -3070, -3007, -2941, -2865, -2792, -2705, -2620, -2521, -2425, 
-    -2316, -2206, -2088, -1965, -1837, -1699, -1560, -1415, -1264, -1108, -946, -782, -613, -440, -264, -85, 
-    95, 277, 463, 648, 832, 1019, 1202, 1386, 1567, 1748, 1925, 2096, 2269, 2433, 2597, 2752, 
-    2908, 3052, 3198, 3332, 3466, 3590, 3711, 3824, 3933, 4036, 4132, 4220, 4305, 4378, 4450, 4508, 
-    4564, 4610, 4648, 4678, 4696, 4708, 4712, 4703, 4687, 4659, 4624, 4578, 4524, 4457, 4386, 4302, 
-    4212, 4113, 4006, 3894, 3772, 3649, 3515, 3380, 3239, 3095, 2949, 2796, 2644, 2489, 2332, 2174, 
-    2014, 1851, 1689, 1525, 1360, 1194, 1026, 860, 692, 520, 351, 180, 13, -162, -329, -503, 
-    -670, -841, -1009, -1175, -1340, -1503, -1663, -1821, -1973, -2127, -2272, -2419, -2559, -2697, -2831, -2959, 
-    -3088, -3208, -3328, -3442, -3554, -3661, -3764, -3864, -3959, -4050, -4136, -4219, -4294, -4369, -4432, -4496, 
-    -4547, -4598, -4636, -4674, -4697, -4719, -4727, -4734, -4727, -4714, -4690, -4663, -4621, -4574, -4516, -4453, 
-    -4375, -4296, -4203, -4107, -3999, -3885, -3765, -3636, -3504, -3360, -3216, -3061, -2904, -2739, -2574, -2398, 
-    -2222, -2039, -1856, -1666, -1474, -1280, -1082, -885, -682, -482, -280, -76, 122, 326, 524, 723, 
-    917, 1109, 1303, 1484, 1669, 1843, 2019, 2185, 2349, 2507, 2661, 2805, 2950, 3086, 3220, 3343, 
-    3467, 3579, 3692, 3796, 3893, 3986, 4072, 4154, 4225, 4293, 4353, 4405, 4451, 4490, 4518, 4540, 
-    4555, 4560, 4557, 4546, 4526, 4501, 4461, 4422, 4366, 4309, 4240, 4168, 4088, 3999, 3909, 3808, 
-    3705, 3593, 3481, 3361, 3237, 3108, 2980, 2844, 2705, 2564, 2422, 2274, 2126, 1974, 1822, 1668, 
-    1511, 1355, 1194, 1036, 876, 713, 552, 388, 228, 63, -98, -261, -422, -583, -744, -903, 
-    -1059, -1218, -1371, -1525, -1674, -1825, -1970, -2114, -2254, -2392, -2525, -2660, -2783, -2909, -3026, -3145, 
-    -3252, -3362, -3459, -3558, -3646, -3735, -3809, -3885, -3950, -4012, -4062, -4111, -4147, -4183, -4201, -4223, 
-    -4226, -4233, -4222, -4210, -4187, -4157, -4120, -4076, -4025, -3962, -3900, -3823, -3748, -3655, -3567, -3465, 
-    -3359, -3248, -3129, -3007, -2875, -2744, -2602, -2460, -2308, -2157, -2000, -1835, -1675, -1501, -1335, -1155, 
-    -985, -801, -624, -442, -259, -76, 107, 288, 473, 655, 835, 1017, 1192, 1372, 1541, 1716, 
-    1880, 2046, 2204, 2360, 2512, 2656, 2798, 2931, 3062, 3183, 3299, 3409, 3510, 3605, 3693, 3774, 
-    3845, 3911, 3968, 4018, 4060, 4093, 4120, 4139, 4151, 4152, 4151, 4137, 4120, 4092, 4061, 4018, 
-    3971, 3916, 3855, 3787, 3710, 3627, 3540, 3444, 3345, 3234, 3126, 3006, 2884, 2755, 2626, 2487, 
-    2351, 2207, 2064, 1914, 1767, 1616, 1464, 1311, 1159, 1003, 853, 697, 546, 390, 243, 88, 
-    -60, -211, -359, -508, -657, -802, -951, -1093, -1241, -1380, -1525, -1662, -1801, -1938, -2069, -2206, 
-    -2327, -2460, -2577, -2699, -2810, -2922, -3029, -3129, -3224, -3317, -3401, -3482, -3553, -3625, -3683, -3742, 
-    -3784, -3834, -3863, -3896, -3912, -3929, -3935, -3935, -3927, -3912, -3890, -3861, -3825, -3782, -3732, -3676, 
-    -3611, -3545, -3465, -3388, -3294, -3207, -3103, -3005, -2890, -2782, -2661, -2543, -2413, -2288, -2151, -2019, 
-    -1877, -1737, -1593, -1445, -1300, -1148, -998, -845, -692, -540, -383, -231, -75, 74, 230, 380, 
-    531, 679, 829, 971, 1115, 1254, 1395, 1526, 1661, 1785, 1916, 2031, 2156, 2263, 2382, 2482, 
-    2589, 2685, 2785, 2870, 2961, 3038, 3122, 3189, 3262, 3322, 3384, 3433, 3486, 3523, 3564, 3592, 
-    3620, 3636, 3652, 3657, 3659, 3652, 3641, 3621, 3597, 3567, 3529, 3484, 3434, 3379, 3315, 3247, 
-    3174, 3092, 3010, 2915, 2825, 2719, 2620, 2508, 2400, 2281, 2163, 2041, 1921, 1790, 1666, 1533, 
-    1407, 1270, 1144, 1003, 881, 730, 623, 
-};
-const unsigned int drum_v2_p2_long_len = 10471;
@@ -1,337 +0,0 @@
-// Auto-generated from base.wav
-#pragma once
-#include <Arduino.h>
-const int16_t drum_v2_p2_short[] PROGMEM = {
-    40, -15, 23, 18, 33, 33, 38, 35, 33, 26, 25, 11, 9, -7, -9, -27, 
-    -32, -52, -57, -77, -84, -107, -113, -137, -146, -169, -182, -203, -221, -240, -262, -280, 
-    -304, -323, -346, -367, -390, -412, -432, -455, -476, -496, -517, -536, -558, -574, -595, -611, 
-    -631, -644, -665, -676, -696, -707, -726, -738, -752, -768, -779, -796, -806, -824, -835, -850, 
-    -862, -878, -890, -905, -918, -934, -946, -962, -974, -987, -1001, -1013, -1026, -1037, -1049, -1058, 
-    -1069, -1079, -1084, -1094, -1094, -1106, -1103, -1110, -1106, -1112, -1107, -1106, -1100, -1099, -1090, -1086, 
-    -1077, -1070, -1057, -1051, -1035, -1028, -1009, -1001, -981, -969, -951, -934, -915, -897, -874, -855, 
-    -831, -810, -780, -758, -730, -706, -672, -649, -615, -590, -554, -526, -494, -463, -430, -398, 
-    -368, -333, -302, -270, -239, -206, -177, -143, -116, -81, -54, -22, 4, 35, 64, 93, 
-    119, 149, 175, 205, 228, 260, 283, 312, 336, 367, 390, 420, 445, 474, 501, 528, 
-    556, 584, 612, 639, 667, 695, 722, 748, 776, 800, 826, 849, 875, 893, 918, 936, 
-    957, 973, 992, 1007, 1022, 1036, 1050, 1062, 1074, 1085, 1094, 1106, 1113, 1123, 1130, 1139, 
-    1145, 1149, 1158, 1161, 1165, 1168, 1169, 1170, 1168, 1169, 1162, 1158, 1150, 1141, 1132, 1116, 
-    1104, 1086, 1070, 1048, 1027, 1005, 979, 954, 927, 898, 868, 838, 807, 775, 742, 710, 
-    674, 643, 604, 571, 531, 496, 456, 416, 376, 333, 288, 245, 198, 151, 100, 53, 
-    -2, -51, -108, -159, -217, -273, -329, -386, -444, -501, -560, -615, -676, -727, -788, -840, 
-    -897, -946, -1001, -1052, -1102, -1149, -1197, -1243, -1288, -1331, -1371, -1412, -1449, -1486, -1520, -1554, 
-    -1585, -1615, -1644, -1670, -1695, -1719, -1740, -1760, -1777, -1794, -1808, -1820, -1828, -1838, -1842, -1846, 
-    -1844, -1846, -1839, -1832, -1824, -1813, -1796, -1778, -1760, -1735, -1710, -1680, -1651, -1612, -1579, -1537, 
-    -1499, -1450, -1407, -1354, -1307, -1248, -1196, -1135, -1078, -1013, -951, -883, -817, -746, -675, -601, 
-    -527, -449, -372, -293, -210, -130, -45, 38, 123, 211, 295, 388, 472, 565, 654, 743, 
-    835, 924, 1018, 1106, 1198, 1289, 1378, 1467, 1556, 1646, 1731, 1817, 1902, 1985, 2066, 2146, 
-    2221, 2299, 2368, 2442, 2504, 2575, 2632, 2694, 2745, 2801, 2849, 2893, 2937, 2972, 3008, 3038, 
-    3064, 3089, 3103, 3122, 3127, 3138, 3134, 3134, 3124, 3114, 3093, 3073, 3042, 3013, 2972, 2931, 
-    2883, 2829, 2772, 2710, 2642, 2570, 2492, 2413, 2325, 2235, 2140, 2040, 1939, 1828, 1719, 1603, 
-    1485, 1363, 1236, 1109, 975, 843, 702, 565, 419, 276, 127, -22, -173, -330, -483, -641, 
-    -801, -959, -1124, -1282, -1450, -1612, -1777, -1942, -2107, -2274, -2437, -2601, -2765, -2926, -3088, -3245, 
-    -3405, -3559, -3713, -3863, -4012, -4159, -4301, -4444, -4580, -4714, -4849, -4974, -5102, -5221, -5342, -5457, 
-    -5567, -5675, -5778, -5878, -5970, -6062, -6145, -6225, -6297, -6365, -6426, -6481, -6528, -6566, -6598, -6621, 
-    -6635, -6639, -6635, -6620, -6597, -6561, -6515, -6462, -6393, -6316, -6228, -6125, -6017, -5892, -5761, -5612, 
-    -5459, -5287, -5111, -4918, -4720, -4503, -4282, -4045, -3801, -3543, -3277, -3001, -2712, -2417, -2109, -1796, 
-    -1470, -1139, -800, -453, -99, 257, 623, 990, 1365, 1737, 2119, 2494, 2880, 3253, 3640, 4010, 
-    4394, 4760, 5133, 5495, 5856, 6209, 6556, 6896, 7228, 7551, 7867, 8174, 8469, 8757, 9033, 9298, 
-    9552, 9796, 10027, 10248, 10455, 10652, 10834, 11009, 11166, 11316, 11448, 11573, 11682, 11782, 11867, 11942, 
-    12004, 12055, 12093, 12119, 12136, 12138, 12132, 12110, 12086, 12039, 11992, 11926, 11857, 11770, 11681, 11575, 
-    11463, 11338, 11207, 11064, 10909, 10747, 10573, 10393, 10193, 9993, 9775, 9550, 9311, 9059, 8800, 8520, 
-    8235, 7928, 7614, 7278, 6935, 6568, 6188, 5793, 5379, 4949, 4499, 4038, 3552, 3054, 2539, 2003, 
-    1455, 888, 309, -289, -899, -1523, -2162, -2810, -3474, -4142, -4829, -5514, -6217, -6917, -7631, -8344, 
-    -9060, -9777, -10496, -11212, -11924, -12631, -13333, -14022, -14706, -15372, -16029, -16663, -17285, -17880, -18460, -19008, 
-    -19539, -20035, -20507, -20948, -21354, -21735, -22074, -22392, -22660, -22908, -23111, -23287, -23426, -23533, -23608, -23651, 
-    -23667, -23651, -23611, -23542, -23455, -23340, -23210, -23058, -22894, -22706, -22512, -22300, -22078, -21840, -21595, -21335, 
-    -21061, -20777, -20474, -20158, -19821, -19468, -19092, -18690, -18268, -17816, -17341, -16832, -16304, -15738, -15155, -14541, 
-    -13912, -13255, -12591, -11909, -11227, -10537, -9852, -9172, -8505, -7851, -7213, -6593, -5988, -5403, -4829, -4264, 
-    -3702, -3136, -2559, -1953, -1321, -640, 90, 897, 1767, 2733, 3780, 4937, 6189, 7547, 9025, 10626, 
-    12284, 14041, 15847, 17717, 19598, 21517, 23409, 25297, 27116, 28939, 30650, 32322, 32637, 32585, 32614, 32595, 
-    32611, 32597, 32609, 32599, 32609, 32599, 32607, 32600, 32607, 32601, 32606, 32602, 32605, 32602, 32605, 32602, 
-    32602, 32604, 32603, 32604, 32599, 32603, 32600, 32604, 32602, 32604, 32603, 32605, 32602, 32604, 32603, 32604, 
-    32601, 32607, 32599, 32609, 32591, 32628, 32481, 30470, 28310, 26135, 23970, 21786, 19614, 17472, 15364, 13288, 
-    11258, 9310, 7453, 5686, 4014, 2456, 1019, -308, -1546, -2719, -3838, -4926, -5981, -7005, -8030, -9070, 
-    -10132, -11214, -12315, -13439, -14592, -15817, -17101, -18440, -19807, -21206, -22621, -24051, -25471, -26898, -28311, -29718, 
-    -31092, -32344, -32693, -32654, -32672, -32660, -32670, -32662, -32667, -32663, -32667, -32662, -32666, -32662, -32666, -32662, 
-    -32666, -32664, -32666, -32662, -32665, -32664, -32668, -32662, -32668, -32663, -32667, -32664, -32666, -32664, -32667, -32662, 
-    -32667, -32663, -32666, -32660, -32666, -32662, -32666, -32664, -32667, -32664, -32666, -32664, -32666, -32663, -32669, -32661, 
-    -32671, -32657, -32673, -32655, -32675, -32651, -32680, -32646, -32691, -32624, -32744, -32060, -29660, -27418, -25019, -22674, 
-    -20243, -17865, -15449, -13113, -10781, -8549, -6335, -4208, -2097, -59, 1957, 3899, 5815, 7665, 9502, 11286, 
-    13060, 14771, 16475, 18118, 19761, 21357, 22966, 24541, 26146, 27725, 29338, 30922, 32466, 32633, 32590, 32611, 
-    32599, 32606, 32600, 32605, 32600, 32606, 32602, 32604, 32602, 32605, 32603, 32604, 32603, 32603, 32604, 32604, 
-    32603, 32604, 32603, 32605, 32601, 32605, 32602, 32606, 32602, 32604, 32603, 32605, 32602, 32605, 32602, 32606, 
-    32601, 32605, 32601, 32606, 32601, 32607, 32601, 32605, 32602, 32605, 32603, 32605, 32602, 32604, 32601, 32606, 
-    32602, 32605, 32602, 32605, 32602, 32605, 32600, 32608, 32597, 32612, 32592, 32622, 32576, 32653, 31471, 28899, 
-    26367, 23719, 21099, 18403, 15738, 13011, 10293, 7528, 4787, 2025, -695, -3416, -6086, -8730, -11297, -13828, 
-    -16266, -18659, -20942, -23188, -25309, -27420, -29379, -31424, -32621, -32661, -32671, -32662, -32668, -32662, -32668, -32663, 
-    -32667, -32662, -32668, -32663, -32667, -32664, -32665, -32664, -32666, -32664, -32666, -32664, -32666, -32662, -32666, -32665, 
-    -32667, -32663, -32666, -32663, -32667, -32661, -32667, -32662, -32668, -32664, -32668, -32663, -32667, -32664, -32666, -32663, 
-    -32664, -32665, -32665, -32664, -32665, -32664, -32667, -32664, -32666, -32664, -32667, -32664, -32666, -32662, -32667, -32663, 
-    -32667, -32662, -32667, -32660, -32668, -32660, -32672, -32659, -32673, -32656, -32673, -32655, -32676, -32655, -32621, -30181, 
-    -26541, -22988, -19333, -15704, -12036, -8399, -4762, -1172, 2379, 5874, 9313, 12699, 16001, 19254, 22394, 25495, 
-    28453, 31391, 32657, 32572, 32626, 32587, 32617, 32591, 32614, 32593, 32613, 32594, 32612, 32595, 32612, 32595, 
-    32612, 32594, 32613, 32594, 32613, 32594, 32612, 32595, 32612, 32596, 32612, 32595, 32612, 32597, 32610, 32597, 
-    32610, 32597, 32611, 32596, 32611, 32596, 32612, 32596, 32612, 32595, 32612, 32596, 32612, 32595, 32611, 32595, 
-    32610, 32595, 32611, 32595, 32611, 32595, 32611, 32598, 32609, 32598, 32609, 32598, 32610, 32595, 32614, 32593, 
-    32616, 32590, 32618, 32589, 32621, 32585, 32625, 32578, 32637, 32553, 32701, 32202, 28806, 25455, 21967, 18503, 
-    14961, 11438, 7874, 4336, 789, -2710, -6192, -9612, -13002, -16322, -19598, -22802, -25946, -29028, -31912, -32717, 
-    -32642, -32679, -32655, -32674, -32658, -32672, -32659, -32671, -32660, -32670, -32660, -32669, -32662, -32667, -32663, -32668, 
-    -32664, -32667, -32662, -32668, -32664, -32667, -32663, -32667, -32664, -32668, -32662, -32669, -32661, -32670, -32661, -32670, 
-    -32659, -32668, -32658, -32668, -32660, -32670, -32662, -32668, -32660, -32669, -32661, -32670, -32660, -32669, -32660, -32669, 
-    -32658, -32669, -32658, -32670, -32657, -32673, -32655, -32673, -32656, -32674, -32655, -32671, -32654, -32674, -32655, -32678, 
-    -32651, -32681, -32648, -32685, -32640, -32691, -32631, -32711, -32598, -32767, -30680, -27475, -24522, -21321, -18196, -14938, 
-    -11726, -8442, -5200, -1945, 1261, 4437, 7559, 10624, 13634, 16568, 19463, 22256, 25040, 27675, 30422, 32510, 
-    32576, 32628, 32584, 32621, 32588, 32618, 32591, 32616, 32592, 32615, 32593, 32613, 32595, 32612, 32595, 32611, 
-    32595, 32611, 32595, 32609, 32596, 32610, 32596, 32608, 32596, 32608, 32598, 32606, 32600, 32605, 32600, 32604, 
-    32601, 32606, 32601, 32606, 32601, 32606, 32601, 32605, 32601, 32605, 32601, 32606, 32599, 32609, 32598, 32609, 
-    32599, 32607, 32600, 32606, 32600, 32607, 32600, 32605, 32601, 32606, 32599, 32605, 32601, 32607, 32600, 32606, 
-    32603, 32602, 32603, 32599, 32608, 32591, 32634, 32433, 29818, 27104, 24345, 21577, 18750, 15912, 13016, 10102, 
-    7133, 4146, 1106, -1943, -5045, -8141, -11290, -14419, -17602, -20740, -23935, -27033, -30269, -32513, -32676, -32667, 
-    -32660, -32667, -32663, -32668, -32661, -32666, -32663, -32664, -32666, -32663, -32665, -32661, -32665, -32665, -32665, -32665, 
-    -32662, -32666, -32662, -32666, -32664, -32666, -32665, -32665, -32667, -32666, -32664, -32666, -32664, -32665, -32664, -32664, 
-    -32667, -32665, -32666, -32665, -32667, -32664, -32664, -32665, -32663, -32667, -32663, -32665, -32664, -32667, -32665, -32665, 
-    -32665, -32666, -32665, -32665, -32666, -32664, -32665, -32666, -32665, -32668, -32662, -32671, -32657, -32676, -32645, -32708, 
-    -32438, -29972, -27035, -24101, -21133, -18142, -15134, -12107, -9076, -6034, -3004, 15, 3006, 5970, 8888, 11765, 
-    14590, 17357, 20069, 22703, 25288, 27763, 30241, 32366, 32608, 32606, 32598, 32607, 32599, 32608, 32599, 32608, 
-    32601, 32607, 32599, 32607, 32600, 32606, 32600, 32606, 32600, 32607, 32599, 32605, 32600, 32604, 32601, 32604, 
-    32602, 32604, 32602, 32606, 32599, 32608, 32599, 32609, 32597, 32607, 32599, 32606, 32600, 32607, 32601, 32606, 
-    32600, 32606, 32600, 32608, 32600, 32606, 32599, 32606, 32601, 32607, 32601, 32607, 32599, 32609, 32598, 32610, 
-    32597, 32609, 32597, 32611, 32595, 32612, 32592, 32618, 32586, 32625, 32573, 32645, 30371, 27363, 24550, 21660, 
-    18865, 16049, 13295, 10538, 7819, 5094, 2397, -308, -3000, -5707, -8408, -11124, -13842, -16567, -19290, -22000, 
-    -24705, -27360, -30035, -32438, -32676, -32665, -32665, -32666, -32664, -32668, -32662, -32667, -32661, -32669, -32662, -32668, 
-    -32661, -32669, -32663, -32665, -32663, -32665, -32663, -32664, -32664, -32666, -32663, -32667, -32664, -32667, -32662, -32668, 
-    -32663, -32667, -32665, -32665, -32666, -32664, -32665, -32666, -32664, -32666, -32663, -32666, -32665, -32664, -32665, -32665, 
-    -32665, -32665, -32664, -32667, -32664, -32667, -32663, -32665, -32664, -32664, -32666, -32664, -32667, -32663, -32667, -32664, 
-    -32666, -32664, -32666, -32665, -32664, -32667, -32660, -32680, -32577, -30499, -28013, -25521, -22952, -20341, -17681, -14978, 
-    -12238, -9457, -6653, -3812, -954, 1942, 4852, 7802, 10761, 13756, 16747, 19762, 22759, 25776, 28758, 31704, 
-    32657, 32577, 32621, 32591, 32612, 32595, 32610, 32598, 32607, 32599, 32607, 32599, 32608, 32600, 32606, 32600, 
-    32605, 32600, 32605, 32600, 32604, 32602, 32605, 32602, 32604, 32601, 32605, 32602, 32605, 32601, 32607, 32601, 
-    32605, 32600, 32607, 32599, 32606, 32599, 32605, 32601, 32605, 32602, 32606, 32600, 32606, 32601, 32604, 32600, 
-    32603, 32604, 32598, 32622, 32313, 30908, 29368, 27848, 26332, 24830, 23351, 21888, 20455, 19043, 17661, 16297, 
-    14961, 13630, 12319, 10999, 9687, 8354, 7008, 5623, 4211, 2740, 1228, -355, -1988, -3698, -5458, -7292, 
-    -9168, -11119, -13094, -15148, -17201, -19326, -21436, -23599, -25724, -27884, -29976, -32083, -32699, -32645, -32677, -32655, 
-    -32674, -32657, -32671, -32660, -32670, -32660, -32668, -32663, -32667, -32664, -32665, -32664, -32663, -32663, -32664, -32662, 
-    -32667, -32664, -32666, -32665, -32666, -32666, -32664, -32667, -32663, -32665, -32663, -32665, -32664, -32666, -32664, -32665, 
-    -32663, -32665, -32662, -32667, -32662, -32671, -32653, -32696, -32360, -30708, -28783, -26894, -24981, -23074, -21167, -19268, 
-    -17376, -15503, -13642, -11810, -9996, -8221, -6468, -4761, -3081, -1457, 134, 1669, 3165, 4601, 5996, 7324, 
-    8612, 9837, 11026, 12161, 13268, 14335, 15381, 16403, 17418, 18417, 19424, 20418, 21439, 22447, 23497, 24532, 
-    25613, 26677, 27789, 28872, 30019, 31093, 32288, 32669, 32570, 32626, 32587, 32617, 32593, 32610, 32595, 32609, 
-    32597, 32609, 32599, 32607, 32599, 32606, 32600, 32605, 32603, 32605, 32602, 32605, 32601, 32605, 32600, 32606, 
-    32600, 32607, 32600, 32607, 32599, 32607, 32601, 32606, 32606, 32509, 31767, 30833, 29879, 28851, 27760, 26596, 
-    25356, 24039, 22640, 21166, 19619, 18005, 16327, 14594, 12814, 11005, 9167, 7326, 5481, 3665, 1870, 116, 
-    -1591, -3240, -4823, -6342, -7790, -9163, -10471, -11708, -12893, -14021, -15112, -16162, -17190, -18195, -19191, -20173, 
-    -21157, -22134, -23116, -24087, -25065, -26029, -26996, -27935, -28870, -29764, -30641, -31461, -32265, -32676, -32657, -32670, 
-    -32661, -32667, -32662, -32667, -32663, -32665, -32663, -32665, -32664, -32667, -32664, -32666, -32664, -32668, -32662, -32667, 
-    -32662, -32669, -32661, -32669, -32660, -32672, -32656, -32680, -32514, -31912, -31286, -30596, -29870, -29075, -28242, -27334, 
-    -26377, -25349, -24269, -23117, -21913, -20646, -19327, -17955, -16542, -15091, -13614, -12115, -10601, -9080, -7559, -6041, 
-    -4539, -3050, -1589, -145, 1261, 2653, 4006, 5342, 6643, 7927, 9180, 10419, 11629, 12830, 14010, 15176, 
-    16325, 17458, 18567, 19658, 20719, 21755, 22752, 23719, 24641, 25518, 26352, 27134, 27863, 28535, 29154, 29711, 
-    30212, 30654, 31037, 31365, 31636, 31858, 32024, 32144, 32217, 32247, 32230, 32174, 32073, 31937, 31760, 31549, 
-    31308, 31032, 30731, 30393, 30029, 29634, 29212, 28763, 28288, 27788, 27271, 26728, 26172, 25593, 25003, 24391, 
-    23771, 23129, 22475, 21798, 21111, 20396, 19663, 18902, 18124, 17315, 16480, 15618, 14730, 13812, 12865, 11889, 
-    10880, 9839, 8767, 7664, 6529, 5361, 4169, 2950, 1710, 444, -826, -2120, -3411, -4718, -6011, -7310, 
-    -8586, -9856, -11095, -12312, -13488, -14637, -15737, -16798, -17808, -18774, -19688, -20550, -21365, -22131, -22846, -23519, 
-    -24147, -24743, -25297, -25822, -26315, -26777, -27218, -27625, -28013, -28366, -28698, -28990, -29248, -29464, -29636, -29759, 
-    -29827, -29840, -29788, -29678, -29499, -29261, -28957, -28596, -28181, -27715, -27205, -26663, -26079, -25479, -24853, -24227, 
-    -23588, -22957, -22336, -21723, -21133, -20551, -19996, -19448, -18917, -18391, -17868, -17344, -16808, -16250, -15673, -15056, 
-    -14412, -13715, -12980, -12190, -11347, -10458, -9517, -8538, -7517, -6464, -5382, -4281, -3167, -2044, -920, 191, 
-    1296, 2373, 3431, 4448, 5439, 6392, 7309, 8195, 9042, 9866, 10645, 11410, 12132, 12844, 13520, 14184, 
-    14825, 15454, 16067, 16666, 17255, 17833, 18398, 18951, 19487, 20012, 20513, 21004, 21471, 21925, 22350, 22755, 
-    23127, 23465, 23768, 24021, 24239, 24396, 24508, 24558, 24559, 24496, 24381, 24209, 23985, 23708, 23385, 23017, 
-    22613, 22175, 21702, 21203, 20682, 20139, 19578, 19004, 18417, 17825, 17226, 16630, 16034, 15441, 14850, 14262, 
-    13682, 13099, 12524, 11951, 11381, 10812, 10251, 9689, 9133, 8578, 8033, 7490, 6949, 6419, 5889, 5372, 
-    4848, 4337, 3818, 3305, 2785, 2268, 1744, 1218, 688, 154, -388, -938, -1490, -2049, -2609, -3178, 
-    -3743, -4318, -4888, -5468, -6046, -6626, -7207, -7787, -8374, -8955, -9539, -10117, -10694, -11261, -11818, -12366, 
-    -12897, -13413, -13905, -14378, -14819, -15229, -15607, -15947, -16249, -16510, -16731, -16913, -17053, -17153, -17217, -17243, 
-    -17236, -17197, -17128, -17039, -16916, -16786, -16626, -16466, -16281, -16102, -15904, -15711, -15500, -15294, -15072, -14851, 
-    -14608, -14358, -14087, -13792, -13472, -13123, -12745, -12332, -11892, -11424, -10928, -10410, -9875, -9325, -8766, -8203, 
-    -7640, -7085, -6540, -6015, -5516, -5047, -4610, -4213, -3856, -3543, -3277, -3049, -2868, -2723, -2619, -2540, 
-    -2491, -2458, -2440, -2422, -2409, -2379, -2345, -2282, -2206, -2095, -1967, -1801, -1614, -1390, -1147, -870, 
-    -573, -250, 83, 438, 801, 1182, 1563, 1954, 2348, 2741, 3135, 3522, 3908, 4285, 4660, 5027, 
-    5395, 5755, 6118, 6481, 6845, 7214, 7581, 7957, 8332, 8707, 9086, 9451, 9820, 10168, 10508, 10821, 
-    11113, 11373, 11595, 11784, 11925, 12026, 12074, 12079, 12035, 11950, 11816, 11649, 11441, 11209, 10950, 10681, 
-    10396, 10110, 9826, 9554, 9290, 9054, 8832, 8649, 8483, 8360, 8257, 8196, 8158, 8152, 8166, 8200, 
-    8245, 8299, 8353, 8402, 8440, 8461, 8462, 8433, 8380, 8289, 8166, 8001, 7804, 7566, 7296, 6993, 
-    6659, 6301, 5916, 5518, 5100, 4679, 4244, 3818, 3389, 2981, 2579, 2210, 1855, 1536, 1241, 981, 
-    751, 555, 385, 244, 121, 22, -68, -143, -222, -291, -372, -453, -560, -672, -815, -970, 
-    -1161, -1365, -1602, -1857, -2136, -2434, -2742, -3069, -3391, -3720, -4035, -4347, -4633, -4905, -5149, -5369, 
-    -5557, -5722, -5854, -5964, -6040, -6102, -6134, -6165, -6175, -6189, -6194, -6213, -6235, -6276, -6323, -6398, 
-    -6482, -6593, -6716, -6868, -7028, -7214, -7400, -7608, -7810, -8020, -8225, -8417, -8604, -8765, -8921, -9038, 
-    -9145, -9212, -9263, -9277, -9276, -9246, -9203, -9137, -9068, -8981, -8896, -8801, -8716, -8620, -8543, -8460, 
-    -8397, -8331, -8287, -8245, -8213, -8191, -8173, -8166, -8155, -8156, -8150, -8150, -8138, -8126, -8100, -8070, 
-    -8021, -7965, -7890, -7802, -7696, -7566, -7420, -7246, -7055, -6831, -6591, -6320, -6025, -5706, -5361, -4995, 
-    -4606, -4197, -3768, -3316, -2855, -2375, -1891, -1393, -895, -392, 107, 600, 1086, 1558, 2018, 2460, 
-    2883, 3291, 3673, 4044, 4387, 4721, 5033, 5337, 5627, 5911, 6188, 6463, 6740, 7019, 7297, 7585, 
-    7872, 8168, 8463, 8766, 9069, 9371, 9671, 9966, 10259, 10542, 10819, 11085, 11340, 11585, 11817, 12038, 
-    12244, 12441, 12623, 12796, 12962, 13119, 13272, 13415, 13556, 13691, 13821, 13947, 14065, 14179, 14280, 14370, 
-    14449, 14501, 14538, 14544, 14526, 14475, 14394, 14276, 14122, 13925, 13692, 13412, 13095, 12736, 12339, 11904, 
-    11436, 10930, 10402, 9837, 9256, 8647, 8030, 7391, 6749, 6095, 5443, 4790, 4147, 3510, 2885, 2271, 
-    1675, 1095, 528, -13, -541, -1046, -1531, -1995, -2436, -2860, -3259, -3638, -3994, -4334, -4650, -4950, 
-    -5229, -5498, -5749, -5991, -6221, -6441, -6656, -6855, -7057, -7241, -7427, -7599, -7769, -7929, -8078, -8220, 
-    -8354, -8475, -8594, -8697, -8801, -8887, -8977, -9051, -9129, -9197, -9273, -9335, -9413, -9478, -9557, -9628, 
-    -9716, -9799, -9889, -9981, -10077, -10175, -10270, -10368, -10459, -10547, -10626, -10700, -10763, -10817, -10856, -10886, 
-    -10895, -10895, -10878, -10845, -10801, -10738, -10669, -10578, -10487, -10376, -10261, -10133, -10001, -9855, -9712, -9551, 
-    -9396, -9221, -9055, -8870, -8685, -8486, -8280, -8063, -7832, -7590, -7337, -7069, -6789, -6486, -6170, -5827, 
-    -5473, -5092, -4697, -4275, -3842, -3389, -2925, -2450, -1969, -1479, -988, -499, -17, 457, 917, 1362, 
-    1785, 2186, 2558, 2905, 3222, 3508, 3763, 3988, 4180, 4347, 4483, 4597, 4683, 4758, 4812, 4858, 
-    4893, 4925, 4960, 4993, 5038, 5083, 5148, 5214, 5302, 5394, 5508, 5630, 5771, 5917, 6073, 6240, 
-    6405, 6580, 6744, 6918, 7079, 7237, 7389, 7534, 7676, 7806, 7932, 8046, 8157, 8258, 8361, 8452, 
-    8551, 8639, 8742, 8839, 8949, 9063, 9190, 9321, 9466, 9618, 9783, 9951, 10131, 10309, 10493, 10668, 
-    10844, 11005, 11158, 11290, 11404, 11496, 11560, 11595, 11602, 11576, 11513, 11417, 11286, 11123, 10923, 10695, 
-    10435, 10148, 9835, 9497, 9139, 8759, 8366, 7955, 7531, 7101, 6660, 6218, 5768, 5321, 4872, 4429, 
-    3988, 3562, 3138, 2736, 2340, 1968, 1607, 1272, 952, 657, 382, 133, -95, -300, -486, -646, 
-    -795, -921, -1038, -1144, -1245, -1344, -1442, -1547, -1658, -1783, -1916, -2065, -2230, -2415, -2619, -2846, 
-    -3090, -3357, -3643, -3945, -4266, -4601, -4950, -5309, -5675, -6054, -6431, -6818, -7199, -7588, -7969, -8351, 
-    -8725, -9100, -9469, -9833, -10191, -10544, -10885, -11224, -11546, -11864, -12158, -12445, -12707, -12957, -13178, -13384, 
-    -13561, -13714, -13839, -13938, -14014, -14059, -14084, -14080, -14060, -14011, -13947, -13859, -13753, -13632, -13492, -13342, 
-    -13174, -13000, -12807, -12614, -12402, -12188, -11961, -11734, -11494, -11255, -11011, -10766, -10522, -10273, -10033, -9785, 
-    -9551, -9310, -9082, -8851, -8631, -8414, -8205, -8001, -7796, -7602, -7406, -7214, -7018, -6821, -6621, -6411, 
-    -6193, -5960, -5720, -5460, -5187, -4893, -4584, -4253, -3905, -3534, -3144, -2728, -2298, -1840, -1365, -867, 
-    -351, 186, 744, 1319, 1912, 2524, 3145, 3783, 4431, 5091, 5755, 6430, 7104, 7784, 8456, 9130, 
-    9793, 10452, 11098, 11734, 12356, 12968, 13557, 14138, 14694, 15241, 15764, 16277, 16764, 17244, 17703, 18143, 
-    18567, 18976, 19364, 19736, 20085, 20425, 20735, 21035, 21306, 21563, 21795, 22004, 22189, 22348, 22480, 22584, 
-    22656, 22698, 22700, 22675, 22606, 22502, 22358, 22176, 21951, 21683, 21373, 21020, 20629, 20196, 19722, 19217, 
-    18673, 18099, 17497, 16872, 16224, 15559, 14880, 14194, 13492, 12795, 12084, 11386, 10674, 9978, 9271, 8580, 
-    7879, 7193, 6496, 5810, 5116, 4434, 3735, 3050, 2348, 1654, 942, 238, -484, -1201, -1942, -2679, 
-    -3439, -4201, -4981, -5773, -6578, -7399, -8232, -9081, -9943, -10812, -11697, -12584, -13477, -14372, -15261, -16149, 
-    -17024, -17883, -18725, -19539, -20333, -21091, -21818, -22507, -23159, -23769, -24345, -24872, -25364, -25808, -26224, -26593, 
-    -26934, -27238, -27518, -27767, -27991, -28191, -28364, -28517, -28639, -28738, -28805, -28844, -28843, -28809, -28729, -28610, 
-    -28439, -28215, -27937, -27598, -27203, -26739, -26216, -25628, -24979, -24269, -23503, -22684, -21817, -20900, -19953, -18968, 
-    -17966, -16936, -15908, -14864, -13832, -12798, -11787, -10782, -9802, -8840, -7901, -6984, -6090, -5215, -4357, -3511, 
-    -2679, -1847, -1019, -184, 654, 1507, 2374, 3260, 4168, 5094, 6048, 7019, 8016, 9026, 10056, 11094, 
-    12136, 13180, 14214, 15236, 16242, 17217, 18171, 19081, 19964, 20796, 21591, 22336, 23036, 23692, 24297, 24862, 
-    25383, 25867, 26312, 26721, 27102, 27445, 27768, 28059, 28332, 28577, 28800, 29006, 29186, 29348, 29486, 29598, 
-    29685, 29741, 29767, 29755, 29704, 29615, 29475, 29294, 29058, 28778, 28439, 28053, 27609, 27118, 26568, 25973, 
-    25324, 24633, 23897, 23122, 22311, 21465, 20588, 19687, 18759, 17817, 16854, 15882, 14901, 13910, 12918, 11921, 
-    10929, 9934, 8942, 7954, 6963, 5980, 4991, 4010, 3018, 2033, 1039, 42, -965, -1975, -3000, -4026, 
-    -5072, -6117, -7178, -8242, -9314, -10388, -11461, -12534, -13598, -14655, -15698, -16720, -17723, -18695, -19647, -20553, 
-    -21427, -22256, -23038, -23777, -24457, -25098, -25674, -26209, -26681, -27110, -27483, -27813, -28094, -28333, -28531, -28691, 
-    -28811, -28900, -28953, -28977, -28968, -28933, -28868, -28778, -28661, -28521, -28353, -28165, -27950, -27710, -27443, -27150, 
-    -26829, -26475, -26087, -25672, -25215, -24730, -24201, -23643, -23043, -22405, -21728, -21013, -20255, -19458, -18618, -17739, 
-    -16819, -15860, -14865, -13835, -12774, -11684, -10568, -9432, -8277, -7112, -5940, -4763, -3588, -2416, -1254, -101, 
-    1038, 2157, 3264, 4341, 5399, 6430, 7437, 8416, 9362, 10283, 11174, 12041, 12875, 13687, 14473, 15237, 
-    15976, 16698, 17397, 18076, 18735, 19375, 19993, 20588, 21166, 21716, 22246, 22747, 23223, 23671, 24085, 24470, 
-    24816, 25127, 25401, 25636, 25836, 25990, 26115, 26194, 26241, 26248, 26223, 26164, 26071, 25947, 25795, 25611, 
-    25403, 25167, 24905, 24620, 24308, 23972, 23606, 23216, 22795, 22342, 21858, 21335, 20783, 20183, 19552, 18876, 
-    18160, 17403, 16604, 15768, 14884, 13973, 13018, 12039, 11019, 9982, 8915, 7832, 6729, 5613, 4485, 3350, 
-    2207, 1066, -74, -1211, -2345, -3465, -4579, -5677, -6764, -7832, -8886, -9920, -10933, -11925, -12894, -13836, 
-    -14751, -15637, -16492, -17312, -18091, -18835, -19534, -20190, -20797, -21358, -21867, -22324, -22730, -23086, -23389, -23640, 
-    -23846, -24003, -24120, -24192, -24228, -24226, -24194, -24126, -24035, -23914, -23775, -23611, -23434, -23233, -23019, -22784, 
-    -22537, -22262, -21971, -21653, -21310, -20938, -20535, -20096, -19618, -19102, -18545, -17945, -17299, -16613, -15889, -15123, 
-    -14323, -13488, -12629, -11738, -10834, -9904, -8970, -8020, -7072, -6117, -5172, -4229, -3298, -2375, -1469, -573, 
-    301, 1167, 2011, 2847, 3664, 4472, 5271, 6057, 6842, 7613, 8386, 9147, 9907, 10655, 11404, 12136, 
-    12862, 13572, 14273, 14952, 15613, 16252, 16868, 17455, 18018, 18543, 19040, 19498, 19921, 20304, 20647, 20952, 
-    21209, 21433, 21606, 21746, 21839, 21895, 21911, 21890, 21832, 21737, 21610, 21450, 21260, 21033, 20782, 20500, 
-    20197, 19863, 19508, 19126, 18723, 18293, 17841, 17365, 16865, 16341, 15795, 15227, 14632, 14015, 13374, 12712, 
-    12022, 11313, 10581, 9829, 9055, 8261, 7451, 6619, 5774, 4913, 4042, 3160, 2273, 1383, 490, -400, 
-    -1289, -2173, -3048, -3915, -4769, -5613, -6441, -7251, -8046, -8819, -9573, -10308, -11018, -11706, -12370, -13008, 
-    -13624, -14212, -14779, -15320, -15839, -16335, -16809, -17264, -17700, -18113, -18509, -18884, -19238, -19577, -19892, -20193, 
-    -20469, -20730, -20965, -21182, -21370, -21540, -21680, -21794, -21876, -21932, -21949, -21938, -21885, -21798, -21665, -21500, 
-    -21286, -21034, -20733, -20391, -20007, -19571, -19099, -18568, -18009, -17393, -16742, -16047, -15314, -14544, -13735, -12905, 
-    -12039, -11156, -10250, -9334, -8403, -7473, -6534, -5607, -4677, -3773, -2868, -1994, -1123, -286, 542, 1342, 
-    2131, 2895, 3642, 4375, 5093, 5798, 6497, 7186, 7875, 8551, 9232, 9900, 10578, 11236, 11900, 12548, 
-    13190, 13813, 14422, 15013, 15578, 16118, 16627, 17106, 17549, 17961, 18333, 18668, 18967, 19228, 19456, 19644, 
-    19803, 19923, 20019, 20083, 20126, 20141, 20143, 20120, 20086, 20034, 19970, 19895, 19806, 19711, 19605, 19492, 
-    19369, 19237, 19097, 18942, 18781, 18598, 18409, 18196, 17969, 17716, 17444, 17141, 16814, 16453, 16065, 15636, 
-    15176, 14674, 14136, 13556, 12940, 12283, 11590, 10858, 10093, 9294, 8466, 7610, 6730, 5829, 4912, 3981, 
-    3041, 2098, 1150, 212, -728, -1652, -2567, -3467, -4351, -5215, -6056, -6880, -7678, -8454, -9206, -9931, 
-    -10634, -11311, -11963, -12588, -13192, -13773, -14325, -14859, -15368, -15859, -16325, -16772, -17201, -17606, -17996, -18358, 
-    -18709, -19032, -19337, -19615, -19871, -20102, -20304, -20484, -20634, -20757, -20854, -20917, -20959, -20962, -20942, -20881, 
-    -20797, -20672, -20522, -20331, -20119, -19868, -19595, -19288, -18960, -18605, -18225, -17825, -17398, -16955, -16482, -16000, 
-    -15487, -14966, -14412, -13854, -13271, -12685, -12077, -11469, -10843, -10222, -9584, -8955, -8310, -7677, -7033, -6397, 
-    -5757, -5120, -4483, -3849, -3213, -2581, -1944, -1314, -676, -46, 592, 1225, 1861, 2493, 3129, 3757, 
-    4383, 5002, 5614, 6215, 6807, 7385, 7948, 8495, 9028, 9542, 10035, 10512, 10966, 11402, 11818, 12212, 
-    12594, 12951, 13303, 13628, 13954, 14252, 14554, 14830, 15109, 15361, 15616, 15844, 16073, 16272, 16466, 16638, 
-    16793, 16927, 17035, 17126, 17184, 17220, 17222, 17199, 17142, 17057, 16934, 16786, 16597, 16383, 16130, 15852, 
-    15541, 15206, 14845, 14465, 14066, 13651, 13224, 12788, 12340, 11893, 11438, 10988, 10533, 10084, 9635, 9191, 
-    8746, 8305, 7866, 7429, 6985, 6545, 6101, 5653, 5195, 4738, 4268, 3791, 3305, 2811, 2305, 1796, 
-    1275, 754, 221, -303, -832, -1355, -1871, -2376, -2868, -3346, -3806, -4246, -4670, -5069, -5448, -5804, 
-    -6138, -6454, -6744, -7017, -7267, -7501, -7720, -7916, -8105, -8273, -8439, -8580, -8722, -8843, -8968, -9068, 
-    -9171, -9256, -9337, -9400, -9459, -9502, -9534, -9553, -9560, -9557, -9538, -9512, -9474, -9429, -9376, -9316, 
-    -9254, -9187, -9120, -9050, -8981, -8906, -8838, -8759, -8691, -8607, -8536, -8449, -8369, -8280, -8187, -8093, 
-    -7985, -7882, -7762, -7647, -7515, -7388, -7246, -7109, -6959, -6811, -6656, -6502, -6346, -6187, -6031, -5873, 
-    -5718, -5562, -5408, -5256, -5106, -4956, -4811, -4664, -4520, -4372, -4228, -4078, -3927, -3773, -3613, -3449, 
-    -3276, -3101, -2917, -2729, -2532, -2329, -2120, -1903, -1681, -1453, -1219, -978, -735, -486, -239, 14, 
-    261, 511, 755, 993, 1225, 1449, 1663, 1865, 2060, 2242, 2416, 2572, 2724, 2859, 2989, 3103, 
-    3212, 3311, 3405, 3491, 3576, 3653, 3734, 3807, 3884, 3958, 4036, 4111, 4190, 4268, 4349, 4429, 
-    4513, 4595, 4676, 4756, 4837, 4910, 4990, 5057, 5134, 5196, 5272, 5330, 5399, 5460, 5526, 5586, 
-    5649, 5715, 5779, 5846, 5917, 5989, 6071, 6154, 6248, 6345, 6456, 6569, 6695, 6829, 6972, 7121, 
-    7279, 7438, 7600, 7762, 7922, 8073, 8224, 8358, 8488, 8597, 8700, 8777, 8844, 8882, 8906, 8902, 
-    8880, 8832, 8760, 8671, 8552, 8421, 8260, 8090, 7893, 7686, 7455, 7217, 6960, 6698, 6417, 6136, 
-    5838, 5541, 5230, 4917, 4596, 4272, 3944, 3613, 3277, 2942, 2603, 2267, 1928, 1592, 1256, 927, 
-    595, 273, -49, -360, -676, -978, -1280, -1571, -1861, -2139, -2410, -2674, -2931, -3175, -3415, -3642, 
-    -3866, -4077, -4281, -4476, -4662, -4841, -5010, -5171, -5326, -5471, -5613, -5746, -5878, -6003, -6129, -6252, 
-    -6377, -6504, -6633, -6766, -6908, -7052, -7212, -7368, -7547, -7719, -7914, -8104, -8311, -8518, -8732, -8952, 
-    -9173, -9395, -9616, -9837, -10052, -10260, -10459, -10652, -10830, -10998, -11147, -11286, -11407, -11509, -11592, -11655, 
-    -11699, -11720, -11716, -11690, -11639, -11564, -11462, -11335, -11180, -10998, -10788, -10550, -10285, -9992, -9677, -9335, 
-    -8970, -8581, -8178, -7749, -7308, -6851, -6386, -5912, -5431, -4949, -4464, -3985, -3507, -3036, -2574, -2124, 
-    -1685, -1254, -838, -434, -41, 345, 716, 1082, 1439, 1789, 2137, 2478, 2821, 3156, 3497, 3832, 
-    4171, 4506, 4841, 5175, 5504, 5833, 6153, 6472, 6776, 7079, 7362, 7642, 7900, 8153, 8385, 8604, 
-    8813, 8998, 9181, 9339, 9500, 9638, 9779, 9906, 10035, 10156, 10278, 10398, 10522, 10641, 10768, 10891, 
-    11018, 11142, 11268, 11394, 11514, 11633, 11748, 11858, 11958, 12050, 12135, 12203, 12262, 12303, 12329, 12335, 
-    12321, 12286, 12226, 12147, 12038, 11909, 11750, 11571, 11357, 11127, 10859, 10576, 10256, 9918, 9552, 9163, 
-    8753, 8321, 7870, 7403, 6921, 6425, 5919, 5402, 4882, 4351, 3820, 3283, 2748, 2213, 1676, 1150, 
-    621, 104, -408, -911, -1405, -1887, -2356, -2812, -3253, -3677, -4086, -4474, -4847, -5200, -5531, -5844, 
-    -6133, -6406, -6649, -6881, -7081, -7267, -7430, -7577, -7704, -7810, -7909, -7986, -8058, -8111, -8162, -8200, 
-    -8235, -8264, -8287, -8310, -8326, -8347, -8357, -8373, -8381, -8392, -8399, -8403, -8404, -8403, -8396, -8388, 
-    -8367, -8346, -8314, -8275, -8226, -8163, -8094, -8009, -7912, -7804, -7680, -7549, -7401, -7246, -7080, -6903, 
-    -6727, -6539, -6354, -6161, -5976, -5790, -5609, -5428, -5261, -5093, -4940, -4784, -4646, -4506, -4377, -4248, 
-    -4128, -4003, -3884, -3757, -3636, -3499, -3364, -3211, -3058, -2885, -2704, -2505, -2298, -2071, -1837, -1588, 
-    -1332, -1065, -795, -519, -246, 27, 296, 558, 812, 1056, 1288, 1506, 1706, 1899, 2064, 2221, 
-    2351, 2478, 2576, 2667, 2737, 2800, 2843, 2880, 2903, 2918, 2925, 2923, 2918, 2901, 2885, 2861, 
-    2834, 2803, 2769, 2735, 2697, 2661, 2622, 2588, 2554, 2526, 2500, 2480, 2467, 2458, 2462, 2466, 
-    2482, 2507, 2535, 2580, 2618, 2682, 2732, 2808, 2869, 2952, 3022, 3108, 3184, 3268, 3343, 3423, 
-    3494, 3563, 3628, 3686, 3743, 3789, 3839, 3881, 3923, 3962, 4003, 4044, 4086, 4133, 4183, 4240, 
-    4299, 4370, 4442, 4525, 4610, 4703, 4802, 4900, 5005, 5106, 5209, 5304, 5396, 5482, 5557, 5622, 
-    5674, 5714, 5741, 5750, 5752, 5730, 5705, 5659, 5610, 5544, 5469, 5388, 5296, 5203, 5100, 4999, 
-    4891, 4787, 4678, 4579, 4471, 4375, 4274, 4181, 4084, 3998, 3909, 3825, 3740, 3660, 3580, 3501, 
-    3424, 3341, 3265, 3177, 3097, 3003, 2914, 2809, 2712, 2595, 2483, 2351, 2221, 2072, 1920, 1752, 
-    1580, 1389, 1191, 979, 758, 522, 272, 16, -257, -538, -834, -1134, -1450, -1772, -2098, -2435, 
-    -2774, -3120, -3460, -3809, -4151, -4496, -4834, -5172, -5503, -5832, -6155, -6474, -6782, -7088, -7380, -7670, 
-    -7943, -8214, -8469, -8718, -8955, -9185, -9401, -9611, -9813, -10004, -10189, -10362, -10535, -10689, -10849, -10990, 
-    -11131, -11256, -11379, -11490, -11590, -11682, -11759, -11825, -11874, -11910, -11926, -11921, -11899, -11854, -11786, -11693, 
-    -11578, -11433, -11266, -11071, -10852, -10604, -10337, -10043, -9729, -9392, -9042, -8670, -8291, -7894, -7493, -7082, 
-    -6670, -6253, -5834, -5419, -5001, -4593, -4180, -3780, -3379, -2988, -2600, -2220, -1847, -1478, -1116, -760, 
-    -412, -64, 275, 616, 949, 1287, 1618, 1956, 2289, 2630, 2972, 3324, 3679, 4046, 4421, 4810, 
-    5211, 5621, 6054, 6490, 6955, 7417, 7908, 8392, 8905, 9406, 9929, 10439, 10959, 11467, 11975, 12468, 
-    12949, 13418, 13867, 14299, 14707, 15095, 15455, 15795, 16103, 16389, 16640, 16870, 17070, 17241, 17388, 17500, 
-    17593, 17648, 17688, 17688, 17674, 17622, 17554, 17448, 17326, 17169, 16991, 16782, 16550, 16290, 16007, 15700, 
-    15369, 15016, 14643, 14246, 13832, 13396, 12943, 12469, 11977, 11467, 10937, 10395, 9829, 9249, 8653, 8046, 
-    7415, 6780, 6124, 5466, 4788, 4114, 3421, 2734, 2038, 1344, 648, -40, -724, -1405, -2075, -2735, 
-    -3387, -4026, -4654, -5268, -5873, -6462, -7040, -7611, -8162, -8713, -9242, -9777, -10288, -10808, -11307, -11808, 
-    -12297, -12782, -13254, -13722, -14179, -14621, -15056, -15475, -15884, -16269, -16645, -16996, -17332, -17641, -17932, -18198, 
-    -18439, -18654, -18847, -19013, -19150, -19265, -19348, -19411, -19440, -19452, -19426, -19385, -19307, -19214, -19088, -18942, 
-    -18767, -18572, -18347, -18101, -17827, -17533, -17211, -16865, -16497, -16105, -15691, -15254, -14798, -14321, -13824, -13312, 
-    -12781, -12235, -11670, -11096, -10501, -9898, -9275, -8645, -7999, -7341, -6673, -5991, -5300, -4592, -3882, -3153, 
-    -2419, -1672, -918, -158, 611, 1384, 2167, 2944, 3731, 4513, 5294, 6075, 6842, 7612, 8363, 9111, 
-    9839, 10554, 11249, 11929, 12583, 13218, 13828, 14417, 14976, 15512, 16017, 16502, 16950, 17379, 17768, 18142, 
-    18474, 18784, 19058, 19307, 19522, 19709, 19864, 19992, 20088, 20155, 20195, 20208, 20192, 20151, 20083, 19993, 
-    19875, 19737, 19570, 19387, 19173, 18945, 18684, 18410, 18105, 17782, 17434, 17063, 16670, 16252, 15813, 15348, 
-    14865, 14354, 13827, 13277, 12712, 12124, 11526, 10910, 10286, 9647, 9005, 8353, 7699, 7038, 6382, 5720, 
-    5065, 4405, 3753, 3098, 2447, 1800, 1150, 507, -142, -781, -1431, -2073, -2719, -3363, -4009, -4650, 
-    -5292, -5928, -6563, -7186, -7804, -8409, -9007, -9586, -10154, -10698, -11230, -11735, -12221, -12681, -13117, -13530, 
-    -13913, -14276, -14608, -14921, -15203, -15466, -15703, -15919, -16113, -16285, -16439, -16572, -16688, -16785, -16861, -16923, 
-    -16964, -16987, -16989, -16973, -16936, -16874, -16793, -16684, -16555, -16396, -16211, -16004, -15762, -15502, -15204, -14893, 
-    -14542, -14179, -13780, -13368, -12927, -12471, -11994, -11501, -10994, -10474, -9939, -9398, -8846, -8293, -7723, -7161, 
-    -6586, -6015, -5438, -4866, -4289, -3716, -3146, -2575, -2011, -1450, -894, -344, 198, 732, 1261, 1779, 
-    2289, 2789, 3280, 3761, 4230, 4692, 5140, 5584, 6013, 6436, 6847, 7249, 7642, 8023, 8398, 8757, 
-    9111, 9449, 9784, 10099, 10408, 10700, 10981, 11247, 11498, 11728, 11947, 12139, 12319, 12469, 12606, 12716, 
-    12806, 12871, 12914, 12934, 12934, 12906, 12864, 12791, 12708, 12596, 12471, 12321, 12160, 11980, 11783, 11574, 
-    11350, 11114, 10863, 10603, 10331, 10048, 9756, 9451, 9140, 8816, 8487, 8144, 7797, 7437, 7074, 6700, 
-    6319, 5930, 5535, 5132, 4721, 4306, 3879, 3448, 3010, 2565, 2117, 1658, 1203, 734, 274, -193, 
-    -654, -1118, -1574, -2026, -2468, -2902, -3322, -3730, -4123, -4497, -4853, -5189, -5502, -5797, -6066, -6313, 
-    -6539, -6740, -6920, -7077, -7213, -7328, -7422, -7500, -7561, -7605, -7636, -7652, -7663, -7653, -7645, -7621, 
-    -7595, -7558, -7522, -7475, -7429, -7371, -7319, -7255, -7196, -7124, -7057, -6975, -6896, -6806, -6712, -6606, 
-    -6493, -6370, -6235, -6090, -5926, -5757, -5569, -5370, -5151, -4926, -4682, -4433, -4167, -3899, -3618, -3337, 
-    -3050, -2766, -2480, -2196, -1919, -1646, -1381, -1124, -875, -637, -407, -191, 22, 219, 412, 597, 
-    772, 947, 1109, 1279, 1433, 1597, 1755, 1917, 2076, 2243, 2404, 2576, 2740, 2912, 3080, 3251, 
-    3421, 3585, 3750, 3908, 4059, 4206, 4337, 4463, 4573, 4671, 4750, 4813, 4860, 4887, 4894, 4880, 
-    4849, 4796, 4725, 4637, 4530, 4408, 4271, 4122, 3961, 3792, 3616, 3432, 3243, 3055, 2862, 2673, 
-    2479, 2290, 2103, 1920, 1739, 1560, 1385, 1212, 1044, 872, 711, 540, 383, 216, 60, -101, 
-    -257, -412, -568, -716, -864, -1003, -1146, -1274, -1403, -1519, -1636, -1737, -1838, -1926, -2010, -2084, 
-    -2151, -2212, -2261, -2309, -2346, -2379, -2402, -2421, -2434, -2441, -2440, -2437, -2425, -2412, -2389, -2366, 
-    -2335, -2303, -2263, -2221, -2173, -2122, -2063, -2004, -1934, -1865, -1784, -1701, -1612, -1517, -1414, -1308, 
-    -1195, -1079, -957, -832, -702, -571, -438, -301, -164, -25, 107, 249, 382, 521, 651, 786, 
-    911, 1044, 1167, 1295, 1416, 1542, 1664, 1790, 1911, 2036, 2158, 2279, 
-};
-const unsigned int drum_v2_p2_short_len = 5292;
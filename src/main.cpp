@@ -1,60 +1,66 @@
 /* Drum_Teensy4_LowLatency_Full_fixed_for_Teensy.ino
    Adapted for Teensy 4.1 (Arduino/PlatformIO)
 
-   - Uses AudioPlayQueue (int16_t buffers)
-   - Uses xTaskCreate (Teensy FreeRTOS)
-   - Uses analogReadFast() inside ISR
-   - Uses noInterrupts()/interrupts() for small critical sections
-   - Assumes 30 int16_t headers exist and "drum_buffers.h" externs them
+   - Uses AudioDrumVoices (polyphonic, plays int16_t buffers in place from flash)
+   - Uses xTaskCreate (Teensy FreeRTOS); DRUM_BARE_METAL 1 builds without
+     it: the audio update polls the sensor DMA and detects the hits it
+     starts, loop() prints the log
+   - Sensors are sampled by ADC_ETC + DMA (adc_dma.h) and detected a block
+     at a time in the DMA interrupt (SENSOR_DMA 0: analogReadFast() in an
+     IntervalTimer ISR)
+   - Up to PAD_MAX pads (pad_array.h), on their own ADC pins or behind
+     analog multiplexers stepped by DMA; pad 0 also has the flex and FSR
+   - Hits go from the ISR to the audio update through a wait-free SPSC queue
+   - Hits and faults are logged as binary records (event_log.h) and only
+     formatted by LogTask, below every other task: nothing on the hit path
+     touches Serial (LOG_BINARY 1 sends the records raw, for host/log_decode)
+   - Samples come from drum_bank.h, the constexpr bank manifest gen.py writes
+   - LATENCY_TRACE stamps every hit with the DWT from threshold crossing
+     to I2S hand-off and keeps a histogram per stage ('t' prints them)
+   - Audio block size and rate are build profiles (platformio.ini); 'a'
+     measures the voice engine at all of them, the status line shows the
+     running one's CPU, underruns and block pool
+   - Pitch, loudness and FSR damping are applied at playback time by the
+     voice engine
+   - Sensor tuning (flex range, piezo and FSR thresholds, crosstalk) is a
+     profile learned by the 'c' / 'x' calibrations and kept in EEPROM;
+     boot loads it and rebuilds the mapping tables, the defines below are
+     only the defaults for a blank EEPROM
+   - Detection, mapping and the voice engine are the hardware-independent
+     lib/drum_engine; this file only binds them to the ADC, the timer, the
+     audio graph and FreeRTOS (host/ runs it unchanged on a Linux box)
 */
 
+#ifndef DRUM_BARE_METAL
+#define DRUM_BARE_METAL 0 // 1: no FreeRTOS, detection inside the audio update (env:teensy41_bare)
+#endif
+
 #include <Arduino.h>
 #include <Audio.h>
+#if !DRUM_BARE_METAL
 #include <FreeRTOS.h>
 #include <task.h>
-#include <drum_v0_p0_long.h>
-#include <drum_v0_p0_short.h>
-#include <drum_v0_p1_long.h>
-#include <drum_v0_p1_short.h>
-#include <drum_v0_p2_long.h>
-#include <drum_v0_p2_short.h>
-#include <drum_v0_p3_long.h>
-#include <drum_v0_p3_short.h>
-#include <drum_v0_p4_long.h>
-#include <drum_v0_p4_short.h>
-
-#include <drum_v1_p0_long.h>
-#include <drum_v1_p0_short.h>
-#include <drum_v1_p1_long.h>
-#include <drum_v1_p1_short.h>
-#include <drum_v1_p2_long.h>
-#include <drum_v1_p2_short.h>
-#include <drum_v1_p3_long.h>
-#include <drum_v1_p3_short.h>
-#include <drum_v1_p4_long.h>
-#include <drum_v1_p4_short.h>
-
-#include <drum_v2_p0_long.h>
-#include <drum_v2_p0_short.h>
-#include <drum_v2_p1_long.h>
-#include <drum_v2_p1_short.h>
-#include <drum_v2_p2_long.h>
-#include <drum_v2_p2_short.h>
-#include <drum_v2_p3_long.h>
-#include <drum_v2_p3_short.h>
-#include <drum_v2_p4_long.h>
-#include <drum_v2_p4_short.h>
-
-// Include the headers you generated earlier (int16_t arrays)
-#include "drum_buffers.h"
+#endif
+#include <EEPROM.h>
+// Sample bank generated by gen.py (descriptors + the int16_t arrays)
+#include "drum_bank.h"
+#include "audio_drum_voices.h"
+#include "audio_profile.h"
+#include "drum_mapping.h"
+#include "event_log.h"
+#include "hit_detector.h"
+#include "latency_trace.h"
+#include "pad_array.h"
+#include "sensor_profile.h"
+#include "adc_dma.h"
 void piezoISR();
 #define analogReadFast(pin) analogRead(pin)
 
 // ------------------- Audio objects -------------------
-AudioPlayQueue queue1; // single queue object, accepts int16_t buffers
+AudioDrumVoices voices; // DRUM_MAX_VOICES voices summed into one block
 AudioMixer4 mixer;
 AudioOutputI2S out;
-AudioConnection patchQueueToMixer(queue1, 0, mixer, 0);
+AudioConnection patchVoicesToMixer(voices, 0, mixer, 0);
 AudioConnection patchMixerToOutL(mixer, 0, out, 0);
 AudioConnection patchMixerToOutR(mixer, 0, out, 1);
 AudioControlSGTL5000 audioShield;
@@ -64,202 +70,230 @@ AudioControlSGTL5000 audioShield;
 #define PIEZO_RIM_PIN A3
 #define FLEX_PIN A1
 #define FSR_PIN A2
+#define PAD_COUNT 1    // SENSOR_DMA: pads scanned, pad 0 on the pins above
+#define PAD_MUX_BITS 0 // 0: each pad on its own pins (padPins); n: 2^n pads behind each padPins pair
+#define PAD_MUX_SEL0 6 // mux select lines, least significant first, all on one GPIO port
+#define PAD_MUX_SEL1 7
+#define PAD_MUX_SEL2 8
+#define PAD_MUX_SEL3 9
 
 #define PIN_LATENCY_ISR 2
 #define PIN_LATENCY_PLAY 3
 #define PIN_STATUS_LED 13
 
 #define ANALOG_RESOLUTION_BITS 12
-#define ADC_MAX 4095
 
-#define PIEZO_THRESHOLD 600
-#define PIEZO_DEBOUNCE_MS 20
-
-#define FLEX_MIN 250
-#define FLEX_MAX 3800
-#define NOTE_STEPS 5
-#define VEL_LAYERS 3
+#define NOISE_FACTOR 6         // piezo threshold: at least this many noise deviations above the floor
+#define NOISE_FLOOR_TAU_MS 500 // noise floor tracking
+#define MASK_HOLD_US 2000      // no retrigger at all this long after a crossing
+#define MASK_LEVEL 1.0f        // retrigger mask starts at the hit's peak
+#define MASK_DECAY_US 15000    // and decays with this time constant
+#define MASK_RING_FACTOR 1.5f  // and is lifted to this many times each ringing lobe under it
+#define PEAK_WINDOW_US 500 // velocity = piezo peak this long after the crossing (0: crossing sample)
+#define EARLY_FIRE_SAMPLES 0 // >= 2: fire on a predicted peak this many samples in, correct it at the window end
+#define PIEZO_RING_HZ 700.0f // nominal piezo ring frequency for the prediction
+#define ONSET_FIXED_DELAY 1  // 1: every hit sounds the worst-case detection delay + one block after its crossing, 0: as soon as detected (jitter)
+#define CROSSTALK_CENTER 0.35f // rim piezo level from a center strike, as a fraction of the center's ('x' measures it)
+#define CROSSTALK_RIM 0.35f    // center piezo level from a rim strike
+#define ZONE_MARGIN 2.0f       // compensated energies closer than this: the piezo hit first is the zone
 
 #define FSR_THRESHOLD 500
-#define RELEASE_LONG_MS 900
-#define RELEASE_SHORT_MS 140
-
-#define FLEX_SMOOTH_ALPHA 0.22f
-#define FLEX_SAMPLE_INTERVAL_US 200 // 5 kHz
-#define PLAY_TASK_PRIORITY (configMAX_PRIORITIES - 1)
-
-#define AUDIO_MEMORY_BLOCKS 18
+#define FSR_POLL_DIVIDER 8 // !SENSOR_DMA: flex and FSR read every 8th ISR tick (625 Hz)
+#define FSR_TAU_MS 2.0f    // FSR filter, run on every reading
+#define RELEASE_SHORT_MS 140 // FSR damping: ~-60 dB after this long
+#define RELEASE_TAU_MS (RELEASE_SHORT_MS / 6.9f)
+
+#define FLEX_TAU_MS 10.0f // flex filter, run on every reading (pitch is taken from it at the hit)
+#define PITCH_LIVE 0          // 1: ringing voices follow the flex (talking drum), 'b' toggles
+#define PITCH_GLIDE_MS 15.0f  // live pitch: glide time constant, per audio block
+#define SENSOR_DMA 1                // 1: ADC_ETC/DMA blocks, 0: analogRead in a timer ISR
+#define SENSOR_FRAME_RATE_HZ 20000  // SENSOR_DMA: all four channels per frame
+#define SENSOR_BLOCK_FRAMES 16      // SENSOR_DMA: 0.8 ms per block at 20 kHz
+#define SENSOR_MAX_HITS_PER_BLOCK (2 * PAD_MAX) // a hit and its correction from every pad
+#define FLEX_SAMPLE_INTERVAL_US 200 // !SENSOR_DMA: 5 kHz
+#define LOG_TASK_PRIORITY tskIDLE_PRIORITY // with loop(), below every other task
+#define LOG_RECORDS 256   // event log ring, 16 bytes a record
+#define LOG_DRAIN_MS 50   // LogTask drains at least this often, and on every hit (bare metal: loop())
+#define LOG_BINARY 0      // 1: framed binary records on Serial (host/log_decode), 0: text lines
+
+#define STEAL_POLICY STEAL_OLDEST // when all DRUM_MAX_VOICES are busy
+#define STEAL_FADE_MS 3.0f        // declick ramp for a stolen voice
+#define CHOKE_FADE_MS 10.0f       // fade of voices cut by their choke group
+
+#define PROFILE_EEPROM_ADDR 0 // StoredSensorProfile, written by 'c' and 'x'
+
+// Audio block size and rate are build flags (platformio.ini profiles): AUDIO_BLOCK_SAMPLES
+// (default 128) and AUDIO_SAMPLE_RATE_EXACT (44100); 'a' measures every combination
+#define AUDIO_MEMORY_SAMPLES (18 * 128) // audio block pool: the same RAM at every block size
+#define AUDIO_MEMORY_BLOCKS (AUDIO_MEMORY_SAMPLES / AUDIO_BLOCK_SAMPLES)
+#ifndef DRUM_BANK_SAMPLE_RATE
+#define DRUM_BANK_SAMPLE_RATE 44100 // banks from before gen.py wrote the rate
+#endif
 #define ENABLE_LATENCY_DEBUG 1
+#define LATENCY_TRACE 1 // per-stage hit latency histograms, 't' prints them
 
 // ------------------- Globals -------------------
 IntervalTimer piezoTimer;
-TaskHandle_t PlayTaskHandle = NULL;
-volatile uint32_t lastHitMs = 0;
-volatile float smoothedFlex = 0.0f;
-const float flexAlpha = FLEX_SMOOTH_ALPHA;
-volatile uint16_t lastPiezoCenterSample = 0;
-volatile uint16_t lastPiezoRimSample = 0;
-
-// mutex substitute: use noInterrupts/interrupts or a light spinlock if needed
-// We'll use noInterrupts/interrupts for short critical regions.
+#if !DRUM_BARE_METAL
+TaskHandle_t LogTaskHandle = NULL;
+#endif
+EventLog<LOG_RECORDS> eventLog;
+LatencyTrace latencyTrace; // TRACE_ISR_EXIT here, the other stages in the audio update
+PadArray pads;
+HitDetector &detector = pads.pad(0); // the pad with the flex and FSR
+static SensorProfile profile;        // as loaded, or as last calibrated
+
+static const uint8_t sensorPins[SENSOR_CHANNELS] = {PIEZO_CENTER_PIN, PIEZO_RIM_PIN, FLEX_PIN, FSR_PIN};
+
+// Center and rim pins of pad 0, 1, ... or, with multiplexers, of the muxes
+// in front of pads 0..2^PAD_MUX_BITS-1, the next 2^PAD_MUX_BITS, ...
+static const uint8_t padPins[][2] = {{PIEZO_CENTER_PIN, PIEZO_RIM_PIN}, {A4, A5}, {A6, A7}, {A8, A9}};
+static const uint8_t padMuxPins[ADC_MUX_MAX_BITS] = {PAD_MUX_SEL0, PAD_MUX_SEL1, PAD_MUX_SEL2, PAD_MUX_SEL3};
+#define PAD_GROUPS ((PAD_COUNT + (1 << PAD_MUX_BITS) - 1) >> PAD_MUX_BITS)
+static_assert(PAD_COUNT >= 1 && PAD_COUNT <= PAD_MAX && PAD_MUX_BITS <= ADC_MUX_MAX_BITS, "PAD_COUNT / PAD_MUX_BITS");
+static_assert(PAD_GROUPS <= sizeof(padPins) / sizeof(padPins[0]), "not enough padPins for PAD_COUNT");
+static_assert(SENSOR_BLOCK_FRAMES % (1 << PAD_MUX_BITS) == 0, "a sensor block must be whole mux cycles");
+#if !SENSOR_DMA && PAD_COUNT > 1
+#error "more than one pad needs SENSOR_DMA"
+#endif
+#if DRUM_BARE_METAL
+#if !SENSOR_DMA
+#error "DRUM_BARE_METAL polls the sensor DMA from the audio update"
+#endif
+// the sensor ring (2 * ADC_DMA_MAX_FRAMES frames) must outlast 1.5 audio blocks
+static_assert(SENSOR_FRAME_RATE_HZ * 1.5f * AUDIO_BLOCK_SAMPLES < 2 * ADC_DMA_MAX_FRAMES * AUDIO_SAMPLE_RATE_EXACT,
+              "SENSOR_FRAME_RATE_HZ too high to poll the sensor ring once per audio block");
+#endif
 
-#define FLEX_NOTES 5
-#define FLEX_EXPONENT 1.8f // >1 = exponential, <1 = logarithmic feel
+AdcScan sensorScan;
+extern const uint32_t sensorFrameRateHz = SENSOR_FRAME_RATE_HZ; // for host/drum_host
+static volatile uint32_t sensorIsrCycles = 0; // DWT cycles spent in sensorBlockISR
 
-int flexToPitchIndex(float flexValue)
+static uint16_t readSensor(SensorChannel channel)
 {
-  float clamped = constrain(flexValue, FLEX_MIN, FLEX_MAX);
-  float norm = (clamped - FLEX_MIN) / (FLEX_MAX - FLEX_MIN); // 0–1 linear
-
-  // Apply exponential curve (feel curve)
-  float curved = powf(norm, FLEX_EXPONENT); // try 1.6–2.2 for typical flex sensors
+  return analogReadFast(sensorPins[channel]);
+}
 
-  int idx = (int)(curved * (FLEX_NOTES - 1) + 0.5f);
-  return constrain(idx, 0, FLEX_NOTES - 1);
+static void postHit(const HitEvent &ev)
+{
+  voices.postHit(ev); // started by the next audio update, no task hop
+  eventLog.push(logHit(ev, ARM_DWT_CYCCNT, micros(), F_CPU_ACTUAL));
+#if !DRUM_BARE_METAL
+  if (ev.flags & HIT_FLAG_CORRECTION)
+    return; // gain fix for a hit already reported
+
+  // LogTask reports the hit when nothing else wants the CPU; it is below
+  // this context, so there is nothing to yield to
+  vTaskNotifyGiveFromISR(LogTaskHandle, NULL);
+#endif
 }
-/*
-const int flexThresholds[5] = {410, 460, 530, 620, 750}; // example ADCs for each note
 
-int flexToPitchIndex(float flexValue)
+// the sensor ISR is done with these hits
+static void traceIsrExit(const HitEvent *hits, unsigned int n)
 {
-  for (int i = 4; i >= 0; --i)
-    if (flexValue >= flexThresholds[i])
-      return i;
-  return 0;
+#if LATENCY_TRACE
+  uint32_t now = ARM_DWT_CYCCNT;
+  for (unsigned int i = 0; i < n; ++i)
+    if (!(hits[i].flags & HIT_FLAG_CORRECTION))
+      traceRecord(latencyTrace.stage[TRACE_ISR_EXIT], now - hits[i].time);
+#endif
 }
 
-*/
-// ------------------- Buffer descriptor -------------------
-// must match the headers you generated
-struct BufInfo
+// ------------------- ISR: sensor block (SENSOR_DMA) -------------------
+// DMA interrupt, once per SENSOR_BLOCK_FRAMES frames (DRUM_BARE_METAL:
+// called by sensorPoll() with the frames since the last audio update).
+// Hits carry the timestamp of the frame that crossed the threshold.
+static void sensorBlockISR(const SensorBlock &block)
 {
-  const int16_t *buf;
-  unsigned int len; // number of int16_t samples
-};
+#if ENABLE_LATENCY_DEBUG
+  digitalWriteFast(PIN_LATENCY_ISR, HIGH);
+#endif
 
-// forward declaration
-static inline BufInfo getBufferForVariant(int velIdx, int pitchIdx, bool shortRelease);
+  uint32_t t0 = ARM_DWT_CYCCNT;
+  HitEvent hits[SENSOR_MAX_HITS_PER_BLOCK];
+  unsigned int n = pads.processBlock(block, hits, SENSOR_MAX_HITS_PER_BLOCK);
+  voices.setDamped(detector.fsrPressed());
+  for (unsigned int i = 0; i < n; ++i)
+    postHit(hits[i]);
+  sensorIsrCycles += ARM_DWT_CYCCNT - t0;
+
+  static uint32_t overrunsSeen = 0;
+  uint32_t overruns = adcDmaOverruns();
+  if (overruns != overrunsSeen)
+  {
+    overrunsSeen = overruns;
+    LogRecord r = {};
+    r.time = micros();
+    r.id = LOG_OVERRUN;
+    r.a = overruns;
+    eventLog.push(r);
+  }
+  traceIsrExit(hits, n);
 
-// clamp helper
-static inline int clampi(int v, int lo, int hi)
-{
-  if (v < lo)
-    return lo;
-  if (v > hi)
-    return hi;
-  return v;
+#if ENABLE_LATENCY_DEBUG
+  digitalWriteFast(PIN_LATENCY_ISR, LOW);
+#endif
 }
 
-// Convert piezo ADC reading to velocity layer 0..2
-static inline int piezoToVelocityLayer(uint16_t piezoVal)
+// ------------------- Detection delay -------------------
+// Longest time from a hit's crossing to postHit(): the peak window (or the
+// early-fire samples), the pad sample that closes it, and the sensor block
+// it ends in (bare metal: the frames the poll cannot see yet). The voices
+// start every hit that long + one audio block after its crossing, so
+// onsets keep their spacing even when this is longer than the audio block;
+// a hit later than that starts at offset 0, block-quantized again.
+static void updateDetectionDelay()
 {
-  if (piezoVal <= PIEZO_THRESHOLD)
-    return 0;
-  float normalized = (float)(piezoVal - PIEZO_THRESHOLD) / (float)(ADC_MAX - PIEZO_THRESHOLD);
-  int layer = (int)floorf(normalized * (float)VEL_LAYERS);
-  if (layer < 0)
-    layer = 0;
-  if (layer >= VEL_LAYERS)
-    layer = VEL_LAYERS - 1;
-  return layer;
+  uint32_t us = 0;
+#if ONSET_FIXED_DELAY
+#if SENSOR_DMA
+  uint32_t rate = pads.padRate(pads.pads() - 1, SENSOR_FRAME_RATE_HZ);
+#else
+  uint32_t rate = 1000000 / FLEX_SAMPLE_INTERVAL_US;
+#endif
+  us = detector.peakWindow();
+  if (us && detector.predictSamples())
+    us = (detector.predictSamples() * 1000000u + rate - 1) / rate;
+  us += (1000000u + rate - 1) / rate; // the window closes on the next pad sample
+#if SENSOR_DMA && !DRUM_BARE_METAL
+  us += SENSOR_BLOCK_FRAMES * 1000000u / SENSOR_FRAME_RATE_HZ;
+#elif SENSOR_DMA
+  // the poll hands over whole mux cycles, behind the frame the DMA is on
+  us += ((1u << PAD_MUX_BITS) + 1) * 1000000u / SENSOR_FRAME_RATE_HZ;
+#endif
+#endif
+  voices.setDetectionDelay(us);
 }
 
-// convert smoothed flex to pitch index 0..4
-// static inline int flexToPitchIndex(float flex)
-// {
-//   int idx = map((int)roundf(flex), FLEX_MIN, FLEX_MAX, 0, NOTE_STEPS - 1);
-//   idx = clampi(idx, 0, NOTE_STEPS - 1);
-//   return idx;
-// }
-
-// ------------------- Buffer mapping implementation -------------------
-// same big switch as earlier, returning pointer + length from drum_buffers.h
-static inline BufInfo getBufferForVariant(int velIdx, int pitchIdx, bool shortRelease)
+#if DRUM_BARE_METAL
+// ------------------- Sensor poll (DRUM_BARE_METAL) -------------------
+// Audio update hook: detection over every frame the DMA copied since the
+// last update, so the hits start in the block this update renders, with
+// no interrupt or task in between
+static void sensorPoll()
 {
-  if (velIdx < 0)
-    velIdx = 0;
-  if (velIdx >= VEL_LAYERS)
-    velIdx = VEL_LAYERS - 1;
-  if (pitchIdx < 0)
-    pitchIdx = 0;
-  if (pitchIdx >= NOTE_STEPS)
-    pitchIdx = NOTE_STEPS - 1;
-
-  switch (velIdx)
-  {
-  case 0:
-    switch (pitchIdx)
-    {
-    case 0:
-      return shortRelease ? BufInfo{drum_v0_p0_short, drum_v0_p0_short_len} : BufInfo{drum_v0_p0_long, drum_v0_p0_long_len};
-    case 1:
-      return shortRelease ? BufInfo{drum_v0_p1_short, drum_v0_p1_short_len} : BufInfo{drum_v0_p1_long, drum_v0_p1_long_len};
-    case 2:
-      return shortRelease ? BufInfo{drum_v0_p2_short, drum_v0_p2_short_len} : BufInfo{drum_v0_p2_long, drum_v0_p2_long_len};
-    case 3:
-      return shortRelease ? BufInfo{drum_v0_p3_short, drum_v0_p3_short_len} : BufInfo{drum_v0_p3_long, drum_v0_p3_long_len};
-    default:
-      return shortRelease ? BufInfo{drum_v0_p4_short, drum_v0_p4_short_len} : BufInfo{drum_v0_p4_long, drum_v0_p4_long_len};
-    }
-  case 1:
-    switch (pitchIdx)
-    {
-    case 0:
-      return shortRelease ? BufInfo{drum_v1_p0_short, drum_v1_p0_short_len} : BufInfo{drum_v1_p0_long, drum_v1_p0_long_len};
-    case 1:
-      return shortRelease ? BufInfo{drum_v1_p1_short, drum_v1_p1_short_len} : BufInfo{drum_v1_p1_long, drum_v1_p1_long_len};
-    case 2:
-      return shortRelease ? BufInfo{drum_v1_p2_short, drum_v1_p2_short_len} : BufInfo{drum_v1_p2_long, drum_v1_p2_long_len};
-    case 3:
-      return shortRelease ? BufInfo{drum_v1_p3_short, drum_v1_p3_short_len} : BufInfo{drum_v1_p3_long, drum_v1_p3_long_len};
-    default:
-      return shortRelease ? BufInfo{drum_v1_p4_short, drum_v1_p4_short_len} : BufInfo{drum_v1_p4_long, drum_v1_p4_long_len};
-    }
-  case 2:
-    switch (pitchIdx)
-    {
-    case 0:
-      return shortRelease ? BufInfo{drum_v2_p0_short, drum_v2_p0_short_len} : BufInfo{drum_v2_p0_long, drum_v2_p0_long_len};
-    case 1:
-      return shortRelease ? BufInfo{drum_v2_p1_short, drum_v2_p1_short_len} : BufInfo{drum_v2_p1_long, drum_v2_p1_long_len};
-    case 2:
-      return shortRelease ? BufInfo{drum_v2_p2_short, drum_v2_p2_short_len} : BufInfo{drum_v2_p2_long, drum_v2_p2_long_len};
-    case 3:
-      return shortRelease ? BufInfo{drum_v2_p3_short, drum_v2_p3_short_len} : BufInfo{drum_v2_p3_long, drum_v2_p3_long_len};
-    default:
-      return shortRelease ? BufInfo{drum_v2_p4_short, drum_v2_p4_short_len} : BufInfo{drum_v2_p4_long, drum_v2_p4_long_len};
-    }
-  default:
-    return BufInfo{drum_v1_p2_long, drum_v1_p2_long_len};
-  }
+  adcDmaPoll(sensorBlockISR);
 }
+#endif
 
-// ------------------- ISR: piezo sampling -------------------
+// ------------------- ISR: piezo sampling (!SENSOR_DMA) -------------------
 // keep minimal and fast. Use analogReadFast() for Teensy.
 void piezoISR()
 {
+  uint32_t stamp = ARM_DWT_CYCCNT; // sample instant, before the ADC reads
+
 #if ENABLE_LATENCY_DEBUG
   digitalWriteFast(PIN_LATENCY_ISR, HIGH);
 #endif
 
-  uint16_t c = analogReadFast(PIEZO_CENTER_PIN);
-  uint16_t r = analogReadFast(PIEZO_RIM_PIN);
-  lastPiezoCenterSample = c;
-  lastPiezoRimSample = r;
-
-  uint32_t now = millis();
-  bool hitDetected = false;
-  if ((c > PIEZO_THRESHOLD || r > PIEZO_THRESHOLD) && (now - lastHitMs > PIEZO_DEBOUNCE_MS))
-  {
-    hitDetected = true;
-    lastHitMs = now;
-  }
-
-  if (hitDetected)
+  HitEvent ev;
+  uint8_t result = detector.tick(readSensor, stamp, &ev);
+  if (result & DETECT_FSR)
+    voices.setDamped(detector.fsrPressed());
+  if (result & DETECT_HIT)
   {
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    vTaskNotifyGiveFromISR(PlayTaskHandle, &xHigherPriorityTaskWoken);
-    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+    postHit(ev);
+    traceIsrExit(&ev, 1);
   }
 
 #if ENABLE_LATENCY_DEBUG
@@ -267,61 +301,145 @@ void piezoISR()
 #endif
 }
 
-// ------------------- PlayTask -------------------
-void PlayTask(void *pvParameters)
+// ------------------- Sample lookup -------------------
+// semitones the output rate is above the bank's recording rate, Q8: the
+// bank's samples count as that much higher, so a 44.1 kHz bank still
+// sounds at its own pitch at 96 kHz (set once in setup())
+static int16_t bankRatePitchQ8 = 0;
+
+// called from the audio update for every queued hit
+static bool lookupHitSample(const HitEvent &ev, HitSample *hs)
 {
-  (void)pvParameters;
-  for (;;)
+  if (!lookupBankSample(drumBank, DRUM_BANK_PADS, DRUM_BANK_ZONES, DRUM_BANK_VEL_LAYERS, ev, hs))
+    return false;
+  hs->rootPitch = (int16_t)(hs->rootPitch + bankRatePitchQ8);
+  return true;
+}
+
+// called from the audio update once per block while live pitch is on;
+// the filtered flex is one atomic load, whatever the sensor ISR is doing
+static int16_t livePitch()
+{
+  return flexToPitchQ8((detector.flexQ4() + 8) >> 4);
+}
+
+// ------------------- Sensor profile -------------------
+static void loadProfile()
+{
+  profile.curves = sensorCurveDefaults();
+  profile.fsrThreshold = FSR_THRESHOLD;
+  profile.crosstalk[HIT_ZONE_CENTER] = CROSSTALK_CENTER;
+  profile.crosstalk[HIT_ZONE_RIM] = CROSSTALK_RIM;
+
+  StoredSensorProfile stored;
+  EEPROM.get(PROFILE_EEPROM_ADDR, stored);
+  bool found = unpackSensorProfile(stored, &profile);
+
+  uint32_t t0 = ARM_DWT_CYCCNT;
+  setSensorCurves(profile.curves);
+  uint32_t us = (ARM_DWT_CYCCNT - t0) / (F_CPU_ACTUAL / 1000000);
+  Serial.printf("sensor profile: %s, tables built in %lu us\n", found ? "from EEPROM" : "defaults", us);
+}
+
+// Flash-backed on the Teensy 4: a write can hold interrupts off for a
+// few ms, so only a finished calibration saves
+static void saveProfile()
+{
+  StoredSensorProfile stored;
+  packSensorProfile(profile, &stored);
+  EEPROM.put(PROFILE_EEPROM_ADDR, stored);
+}
+
+static void printRanges(const char *name, const SensorRanges &r)
+{
+  Serial.printf("  %-8s center %u..%u rim %u..%u flex %u..%u fsr %u..%u\n", name, r.min[SENSOR_PIEZO_CENTER],
+                r.max[SENSOR_PIEZO_CENTER], r.min[SENSOR_PIEZO_RIM], r.max[SENSOR_PIEZO_RIM], r.min[SENSOR_FLEX],
+                r.max[SENSOR_FLEX], r.min[SENSOR_FSR], r.max[SENSOR_FSR]);
+}
+
+// End of the 'c' session: learn, apply while running, save
+static void finishSensorCalibration(const SensorRanges steps[CAL_STEPS])
+{
+  static const char *const names[CAL_STEPS] = {"quiet", "strikes", "flex", "fsr"};
+  for (int s = 0; s < CAL_STEPS; ++s)
+    printRanges(names[s], steps[s]);
+  if (!learnSensorProfile(steps, &profile))
+  {
+    Serial.println("sensor calibration rejected (a step did not show its sensor moving), profile unchanged");
+    return;
+  }
+  setSensorCurves(profile.curves);
+  pads.setThresholds(profile.curves.piezoThreshold, profile.fsrThreshold);
+  saveProfile();
+  Serial.printf("sensor profile saved: flex %u..%u piezo threshold %u max %u fsr threshold %u\n",
+                profile.curves.flexMin, profile.curves.flexMax, profile.curves.piezoThreshold,
+                profile.curves.piezoMax, profile.fsrThreshold);
+}
+
+// Frame layout: pad 0's pair, flex, FSR, then the other pairs. Frames
+// alternate ADC1 and ADC2, so a pair is converted at the same instant.
+static void buildPadScan(PadLayout *layout, AdcScan *scan)
+{
+  scan->values = 0;
+  for (unsigned int g = 0; g < PAD_GROUPS; ++g)
   {
-    // Wait (clears notification)
-    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-
-    // Fast sensor snapshot (ISR may have already filled lastPiezo*)
-    uint16_t piezoC = analogReadFast(PIEZO_CENTER_PIN);
-    uint16_t piezoR = analogReadFast(PIEZO_RIM_PIN);
-    uint16_t fsr = analogReadFast(FSR_PIN);
-    uint16_t flexRaw = analogReadFast(FLEX_PIN);
-
-    // Smooth flex: protect with interrupts disabled briefly
-    noInterrupts();
-    float localSmoothed = smoothedFlex;
-    localSmoothed = localSmoothed + flexAlpha * ((float)flexRaw - localSmoothed);
-    smoothedFlex = localSmoothed;
-    interrupts();
-
-    bool rimHit = (piezoR > piezoC);
-    Serial.println(rimHit ? "Rim hit" : "Center hit");
-
-    int velIdx = piezoToVelocityLayer(max(piezoC, piezoR));
-    int pitchIdx = flexToPitchIndex(smoothedFlex);
-    bool shortRelease = (fsr > FSR_THRESHOLD);
-
-    // Lookup precomputed buffer
-    BufInfo bi = getBufferForVariant(velIdx, pitchIdx, shortRelease);
-    if (bi.buf == nullptr || bi.len == 0)
+    scan->pins[scan->values++] = padPins[g][0];
+    scan->pins[scan->values++] = padPins[g][1];
+    if (g == 0)
     {
-      // no buffer
-      continue;
+      scan->pins[scan->values++] = FLEX_PIN;
+      scan->pins[scan->values++] = FSR_PIN;
     }
+  }
+  scan->muxBits = PAD_MUX_BITS;
+  for (unsigned int b = 0; b < ADC_MUX_MAX_BITS; ++b)
+    scan->muxPins[b] = padMuxPins[b];
+
+  layout->pads = PAD_COUNT;
+  layout->frameValues = scan->values;
+  layout->muxWays = 1 << PAD_MUX_BITS;
+  layout->flex = SENSOR_FLEX;
+  layout->fsr = SENSOR_FSR;
+  for (unsigned int p = 0; p < PAD_COUNT; ++p)
+  {
+    unsigned int g = p >> PAD_MUX_BITS;
+    PadInput &in = layout->input[p];
+    in.center = g == 0 ? (uint8_t)SENSOR_PIEZO_CENTER : 2 + 2 * g;
+    in.rim = in.center + 1;
+    in.phase = PAD_MUX_BITS ? adcMuxPhase(p & ((1 << PAD_MUX_BITS) - 1)) : PAD_EVERY_FRAME;
+  }
+}
 
-// Latency debug toggle
-#if ENABLE_LATENCY_DEBUG
-    digitalWriteFast(PIN_LATENCY_PLAY, HIGH);
-#endif
-
-    // play buffer via AudioPlayQueue (expects int16_t and sample count)
-    // queue1.play takes pointer to int16_t data and number of samples (frames)
-    // If your Audio library uses a different signature, adapt accordingly.
-    queue1.play(bi.buf, bi.len);
-
-#if ENABLE_LATENCY_DEBUG
-    digitalWriteFast(PIN_LATENCY_PLAY, LOW);
+// ------------------- LogTask -------------------
+// Hits are started by the audio update straight from the ISR queue and
+// logged without formatting. This task, below everything else, is the
+// only one that formats the records and waits on Serial (bare metal:
+// loop() drains the log instead).
+static void writeLogRecord(const LogRecord &r)
+{
+#if LOG_BINARY
+  uint8_t frame[LOG_FRAME_BYTES];
+  encodeLogFrame(r, frame);
+  Serial.write(frame, sizeof(frame));
+#else
+  char line[128];
+  formatLogRecord(r, F_CPU_ACTUAL, line, sizeof(line));
+  Serial.println(line);
 #endif
+}
 
-    // Small yield to allow scheduler to run other tasks
-    vTaskDelay(pdMS_TO_TICKS(1));
+#if !DRUM_BARE_METAL
+void LogTask(void *pvParameters)
+{
+  (void)pvParameters;
+  for (;;)
+  {
+    // a hit, or LOG_DRAIN_MS for anything else (clears notification)
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_DRAIN_MS));
+    eventLog.drain(writeLogRecord);
   }
 }
+#endif
 
 // ------------------- Setup -------------------
 void setup()
@@ -337,11 +455,34 @@ void setup()
   pinMode(PIEZO_RIM_PIN, INPUT);
   pinMode(FLEX_PIN, INPUT);
   pinMode(FSR_PIN, INPUT);
+  for (unsigned int g = 1; g < PAD_GROUPS; ++g)
+  {
+    pinMode(padPins[g][0], INPUT);
+    pinMode(padPins[g][1], INPUT);
+  }
 
   Serial.begin(115200);
   Serial.println("Drum_Teensy4_LowLatency_Fixed starting...");
 
+  bankRatePitchQ8 = (int16_t)lroundf(12 * 256 * log2f(AUDIO_SAMPLE_RATE_EXACT / DRUM_BANK_SAMPLE_RATE));
+  voices.begin(lookupHitSample);
+  voices.setReleaseTime(RELEASE_TAU_MS);
+  voices.setStealPolicy(STEAL_POLICY);
+  voices.setFadeTimes(STEAL_FADE_MS, CHOKE_FADE_MS);
+  voices.setGlideTime(PITCH_GLIDE_MS);
+#if PITCH_LIVE
+  voices.setLivePitch(livePitch);
+#endif
+#if ENABLE_LATENCY_DEBUG
+  voices.setStartPin(PIN_LATENCY_PLAY);
+#endif
+#if LATENCY_TRACE
+  voices.setLatencyTrace(&latencyTrace);
+#endif
   AudioMemory(AUDIO_MEMORY_BLOCKS);
+  Serial.printf("audio: %u samples at %.0f Hz, %.0f us per block, %.0f us capture to codec, %u blocks\n",
+                AUDIO_BLOCK_SAMPLES, AUDIO_SAMPLE_RATE_EXACT, AUDIO_BLOCK_SAMPLES * 1e6f / AUDIO_SAMPLE_RATE_EXACT,
+                audioPathLatencyUs(AUDIO_BLOCK_SAMPLES, AUDIO_SAMPLE_RATE_EXACT), AUDIO_MEMORY_BLOCKS);
   audioShield.enable();
   audioShield.volume(0.9f);
   mixer.gain(0, 0.95f);
@@ -350,33 +491,321 @@ void setup()
   analogReadResolution(ANALOG_RESOLUTION_BITS);
   analogReadAveraging(1); // no averaging (faster reads)
 
-  // initialize smoothing value to current flex reading
-  smoothedFlex = analogRead(FLEX_PIN);
+  // flex and piezo curves: tables built here, before the first hit
+  loadProfile();
+
+  // detectors from the loaded sensor profile; the flex filter starts at
+  // the current reading
+  DetectorConfig detect;
+  detect.piezoThreshold = profile.curves.piezoThreshold;
+  detect.noiseFactor = NOISE_FACTOR;
+  detect.floorTauMs = NOISE_FLOOR_TAU_MS;
+  detect.maskHoldUs = MASK_HOLD_US;
+  detect.maskLevel = MASK_LEVEL;
+  detect.maskDecayUs = MASK_DECAY_US;
+  detect.ringFactor = MASK_RING_FACTOR;
+  detect.fsrThreshold = profile.fsrThreshold;
+  detect.fsrPollDivider = FSR_POLL_DIVIDER;
+  detect.flexTauMs = FLEX_TAU_MS;
+  detect.fsrTauMs = FSR_TAU_MS;
+  detect.peakWindowUs = PEAK_WINDOW_US;
+  detect.predictSamples = EARLY_FIRE_SAMPLES;
+  detect.ringHz = PIEZO_RING_HZ;
+  detect.crosstalk[HIT_ZONE_CENTER] = profile.crosstalk[HIT_ZONE_CENTER];
+  detect.crosstalk[HIT_ZONE_RIM] = profile.crosstalk[HIT_ZONE_RIM];
+  detect.zoneMargin = ZONE_MARGIN;
+  PadLayout layout;
+  buildPadScan(&layout, &sensorScan);
+  if (!pads.begin(layout, detect, analogRead(FLEX_PIN), F_CPU_ACTUAL))
+  {
+    Serial.println("ERROR: pad layout does not fit the sensor frame");
+    while (1)
+      delay(1000);
+  }
+  updateDetectionDelay();
 
-  // create PlayTask (highest practical priority)
-  BaseType_t res = xTaskCreate(PlayTask, "PlayTask", 4096, NULL, PLAY_TASK_PRIORITY, &PlayTaskHandle);
+#if !DRUM_BARE_METAL
+  // create LogTask (lowest priority)
+  BaseType_t res = xTaskCreate(LogTask, "LogTask", 4096, NULL, LOG_TASK_PRIORITY, &LogTaskHandle);
   if (res != pdPASS)
   {
-    Serial.println("ERROR: PlayTask creation failed");
+    Serial.println("ERROR: LogTask creation failed");
     while (1)
       delay(1000);
   }
+#endif
 
+#if DRUM_BARE_METAL
+  // ADC1/ADC2 run from here on, no DMA interrupt: every audio update
+  // takes the frames captured since the one before
+  if (!adcDmaBeginPolled(sensorScan, SENSOR_FRAME_RATE_HZ, ADC_DMA_MAX_FRAMES))
+  {
+    Serial.println("ERROR: sensor DMA setup failed");
+    while (1)
+      delay(1000);
+  }
+  voices.setUpdateHook(sensorPoll);
+#elif SENSOR_DMA
+  // ADC1/ADC2 run from here on; no analogRead() after this point
+  if (!adcDmaBeginScan(sensorScan, SENSOR_FRAME_RATE_HZ, SENSOR_BLOCK_FRAMES, sensorBlockISR))
+  {
+    Serial.println("ERROR: sensor DMA setup failed");
+    while (1)
+      delay(1000);
+  }
+#else
   // start piezo sampling ISR via IntervalTimer
   piezoTimer.begin(piezoISR, FLEX_SAMPLE_INTERVAL_US);
+#endif
 
   Serial.println("Setup complete. System online.");
 }
 
+// ------------------- Onset jitter report -------------------
+static void printOnsetHistogram(const char *name, const OnsetHistogram &h, uint32_t binWidthQ4)
+{
+  if (h.count == 0)
+  {
+    Serial.printf("%s: no hits\n", name);
+    return;
+  }
+  float mean = (float)h.sumQ4 / h.count;
+  float var = (float)h.sumSqQ4 / h.count - mean * mean;
+  Serial.printf("%s: n=%lu min=%.2f max=%.2f mean=%.2f sd=%.2f jitter=%.2f (samples)\n", name, h.count,
+                h.minQ4 / 16.0f, h.maxQ4 / 16.0f, mean / 16.0f, sqrtf(var > 0 ? var : 0) / 16.0f,
+                (h.maxQ4 - h.minQ4) / 16.0f);
+  for (int i = 0; i < ONSET_HIST_BINS; ++i)
+    if (h.bins[i])
+      Serial.printf("  [%6.1f..%6.1f) %lu\n", i * binWidthQ4 / 16.0f, (i + 1) * binWidthQ4 / 16.0f, h.bins[i]);
+}
+
+static void printOnsetReport()
+{
+  OnsetStats stats;
+  voices.getOnsetStats(stats);
+  Serial.println("hit-to-block latency, before = start at next block, after = sample-accurate");
+  printOnsetHistogram("before", stats.blockStart, stats.binWidthQ4);
+  printOnsetHistogram("after ", stats.sampleAccurate, stats.binWidthQ4);
+}
+
+// ------------------- Latency trace report -------------------
+// min / p50 / p99 / max of every stage since the last report, in us from
+// the threshold crossing; clears the histograms
+#if LATENCY_TRACE
+static void printLatencyReport()
+{
+  static LatencyTrace snapshot; // 5 KB, off the loop task's stack
+  __disable_irq();
+  snapshot = latencyTrace;
+  traceClear(latencyTrace);
+  __enable_irq();
+
+  float usPerTick = 1e6f / F_CPU_ACTUAL;
+  Serial.println("hit latency from threshold crossing (us)");
+  Serial.println("  stage         n      min      p50      p99      max");
+  for (int s = 0; s < TRACE_STAGES; ++s)
+  {
+    const TraceHistogram &h = snapshot.stage[s];
+    Serial.printf("  %-9s %5lu %8.1f %8.1f %8.1f %8.1f\n", traceStageName((TraceStage)s), h.count, h.min * usPerTick,
+                  tracePercentile(h, 500) * usPerTick, tracePercentile(h, 990) * usPerTick, h.max * usPerTick);
+  }
+}
+#endif
+
+// ------------------- Mix kernel check -------------------
+static uint32_t dwtCycles() { return ARM_DWT_CYCCNT; }
+
+static void printMixReport()
+{
+  uint32_t errors = 0;
+  for (unsigned int v = 1; v <= 16; ++v)
+    errors += mixSelfTest(v, AUDIO_BLOCK_SAMPLES, 0x1234u + v);
+  Serial.printf("mix kernel bit-exact: %s (%lu differing samples)\n", errors ? "FAIL" : "ok", errors);
+  uint32_t ramps = mixRampTest(AUDIO_BLOCK_SAMPLES);
+  Serial.printf("mix ramp ends: %s (%lu ramps off their end gain)\n", ramps ? "FAIL" : "ok", ramps);
+  static const unsigned int counts[] = {1, 4, 8, 16};
+  for (unsigned int v : counts)
+    Serial.printf("  %2u voices: %lu cycles/block\n", v, mixBenchCycles(v, AUDIO_BLOCK_SAMPLES, 64, dwtCycles));
+}
+
+// ------------------- Audio profile matrix -------------------
+// the voice engine at full polyphony at every block size and rate, timed
+// on this CPU with whatever interrupts are running (0.25 s of audio each)
+static void printAudioProfiles()
+{
+  HitSample hs = {};
+  for (int l = 0; l < VOICE_LAYERS; ++l)
+  {
+    hs.buf[l] = drumBank[0].ptr;
+    hs.len[l] = drumBank[0].len;
+    hs.gain[l] = 16384;
+  }
+  hs.layers = VOICE_LAYERS; // worst case: every voice crossfades two layers
+
+  Serial.printf("audio profiles: %u voices, one stolen per block (* this build)\n", DRUM_MAX_VOICES);
+  Serial.println("  block   rate  period  load mean    max  overruns  capture->codec  memory");
+  for (unsigned int b = 0; b < AUDIO_PROFILE_BLOCK_SIZES; ++b)
+    for (unsigned int r = 0; r < AUDIO_PROFILE_RATES; ++r)
+    {
+      unsigned int n = audioProfileBlockSizes[b];
+      uint32_t rate = audioProfileRates[r];
+      AudioProfileLoad load = audioProfileBench(hs, n, rate, rate / n / 4, F_CPU_ACTUAL, dwtCycles);
+      bool built = n == AUDIO_BLOCK_SAMPLES && rate == (uint32_t)AUDIO_SAMPLE_RATE_EXACT;
+      Serial.printf("%c %5u %6lu %5.0fus %8.1f%% %5.1f%% %9lu %12.0f us %3u blocks\n", built ? '*' : ' ', n, rate,
+                    n * 1e6f / rate, 100.0f * load.cyclesMean / load.budget, 100.0f * load.cyclesMax / load.budget,
+                    load.overruns, audioPathLatencyUs(n, rate), AUDIO_MEMORY_SAMPLES / n);
+    }
+}
+
 // ------------------- Loop -------------------
+// Serial commands:
+//   j  start onset jitter measurement / print the report and stop
+//   i  cycle resampler quality (linear / hermite / sinc)
+//   s  cycle voice steal policy (oldest / quietest / same note)
+//   m  check the mix kernel against the C reference and time it
+//   w  cycle the velocity peak window (0 / 0.5 / 1 / 2 / 3 ms)
+//   p  early fire on / off (predicted velocity, corrected at the window end)
+//   x  crosstalk calibration: center strikes, 'x', rim strikes, 'x' (saved)
+//   c  sensor calibration: four guided steps, each ended by 'c' (saved)
+//   b  live pitch on / off (ringing voices follow the flex)
+//   a  measure the voice engine at every audio block size and sample rate
+//   t  print the per-stage latency histograms (LATENCY_TRACE) and clear them
 void loop()
 {
   static uint32_t lastPrint = 0;
+  static bool measuringOnsets = false;
+  static uint8_t calibrating = 0; // zone being calibrated + 1
+  static uint8_t sensorStep = 0;  // CalibrationStep being captured + 1
+  static SensorRanges captured[CAL_STEPS];
+  while (Serial.available())
+  {
+    int cmd = Serial.read();
+    if (cmd == 'i')
+    {
+      InterpMode next = (InterpMode)((voices.interpolation() + 1) % INTERP_MODES);
+      voices.setInterpolation(next);
+      Serial.printf("interpolation: %s\n", interpModeName(next));
+    }
+    else if (cmd == 's')
+    {
+      static const char *const names[STEAL_POLICIES] = {"oldest", "quietest", "same note"};
+      StealPolicy next = (StealPolicy)((voices.getStealPolicy() + 1) % STEAL_POLICIES);
+      voices.setStealPolicy(next);
+      Serial.printf("steal policy: %s\n", names[next]);
+    }
+    else if (cmd == 'j')
+    {
+      if (measuringOnsets)
+        printOnsetReport();
+      else
+        Serial.println("onset measurement started, hit the pad then send 'j' again");
+      measuringOnsets = !measuringOnsets;
+      voices.setOnsetStats(measuringOnsets);
+    }
+    else if (cmd == 'm')
+      printMixReport();
+    else if (cmd == 'a')
+      printAudioProfiles();
+    else if (cmd == 't')
+    {
+#if LATENCY_TRACE
+      printLatencyReport();
+#else
+      Serial.println("latency trace: built with LATENCY_TRACE 0");
+#endif
+    }
+    else if (cmd == 'w')
+    {
+      static const uint32_t windows[] = {0, 500, 1000, 2000, 3000};
+      unsigned int i = 0;
+      while (i < 5 && windows[i] != detector.peakWindow())
+        ++i;
+      pads.setPeakWindow(windows[(i + 1) % 5]);
+      updateDetectionDelay();
+      Serial.printf("peak window: %lu us\n", detector.peakWindow());
+    }
+    else if (cmd == 'p')
+    {
+      pads.setPredict(detector.predictSamples() ? 0 : 2);
+      updateDetectionDelay();
+      Serial.printf("early fire: %s\n", detector.predictSamples() ? "on" : "off");
+    }
+    else if (cmd == 'b')
+    {
+      voices.setLivePitch(voices.getLivePitch() ? nullptr : livePitch);
+      Serial.printf("live pitch: %s\n", voices.getLivePitch() ? "on" : "off");
+    }
+    else if (cmd == 'x')
+    {
+      static const char *const zones[2] = {"center", "rim"};
+      if (calibrating)
+      {
+        HitZone struck = (HitZone)(calibrating - 1);
+        unsigned int n = detector.finishCrosstalkCalibration();
+        Serial.printf("crosstalk from %s strikes: %.3f (%u hits)\n", zones[struck], detector.crosstalk(struck), n);
+      }
+      calibrating = (calibrating + 1) % 3;
+      if (calibrating)
+      {
+        detector.startCrosstalkCalibration((HitZone)(calibrating - 1));
+        Serial.printf("crosstalk calibration: hit the %s only, then send 'x'\n", zones[calibrating - 1]);
+      }
+      else
+      {
+        profile.crosstalk[HIT_ZONE_CENTER] = detector.crosstalk(HIT_ZONE_CENTER);
+        profile.crosstalk[HIT_ZONE_RIM] = detector.crosstalk(HIT_ZONE_RIM);
+        pads.setCrosstalk(HIT_ZONE_CENTER, profile.crosstalk[HIT_ZONE_CENTER]);
+        pads.setCrosstalk(HIT_ZONE_RIM, profile.crosstalk[HIT_ZONE_RIM]);
+        saveProfile();
+        Serial.printf("crosstalk saved: center %.3f rim %.3f\n", profile.crosstalk[HIT_ZONE_CENTER],
+                      profile.crosstalk[HIT_ZONE_RIM]);
+      }
+    }
+    else if (cmd == 'c')
+    {
+      if (sensorStep)
+        detector.finishRangeCapture(&captured[sensorStep - 1]);
+      sensorStep = (sensorStep + 1) % (CAL_STEPS + 1);
+      if (sensorStep)
+      {
+        detector.startRangeCapture();
+        Serial.printf("sensor calibration %u/%u: %s, then send 'c'\n", sensorStep, CAL_STEPS,
+                      calibrationStepPrompt((CalibrationStep)(sensorStep - 1)));
+      }
+      else
+        finishSensorCalibration(captured);
+    }
+  }
+
   if (millis() - lastPrint > 5000)
   {
+    static uint32_t lastSteals = 0;
+    uint32_t steals = voices.steals();
+    float elapsed = (millis() - lastPrint) * 0.001f;
     lastPrint = millis();
     // minor status print
-    Serial.printf("smoothedFlex=%.1f lastPiezoC=%u lastPiezoR=%u\n", smoothedFlex, lastPiezoCenterSample, lastPiezoRimSample);
+    Serial.printf("flex=%.1f fsr=%.1f lastPiezoC=%u lastPiezoR=%u voices=%u\n", detector.flex(), detector.fsrQ4() / 16.0f, detector.lastCenter(), detector.lastRim(), voices.activeVoices());
+    Serial.printf("piezo floor/threshold C=%u/%u R=%u/%u\n", detector.noiseFloor(SENSOR_PIEZO_CENTER), detector.threshold(SENSOR_PIEZO_CENTER), detector.noiseFloor(SENSOR_PIEZO_RIM), detector.threshold(SENSOR_PIEZO_RIM));
+    Serial.printf("steals/s=%.2f steals=%lu chokes=%lu\n", (steals - lastSteals) / elapsed, steals, voices.chokes());
+    lastSteals = steals;
+    Serial.printf("hitQueue highWater=%lu/%lu overflows=%lu\n", voices.hitQueue().highWater(), voices.hitQueue().capacity(), voices.hitQueue().overflows());
+    Serial.printf("audio CPU=%.1f%% max=%.1f%% underruns: late=%lu starved=%lu memory=%u/%u blocks\n",
+                  AudioProcessorUsage(), AudioProcessorUsageMax(), voices.lateUpdates(), voices.starvedUpdates(),
+                  AudioMemoryUsageMax(), AUDIO_MEMORY_BLOCKS);
+    Serial.printf("log highWater=%lu/%lu dropped=%lu\n", eventLog.highWater(), eventLog.capacity(), eventLog.dropped());
+#if SENSOR_DMA
+    static uint32_t lastIsrCycles = 0;
+    uint32_t isrCycles = sensorIsrCycles;
+    Serial.printf("sensor DMA overruns=%lu hits dropped=%lu pads=%u scan=%lu Hz/pad sensor ISR=%.2f%% CPU\n",
+                  adcDmaOverruns(), pads.droppedHits(), pads.pads(), pads.padRate(pads.pads() - 1, SENSOR_FRAME_RATE_HZ),
+                  100.0f * (isrCycles - lastIsrCycles) / (elapsed * F_CPU_ACTUAL));
+    lastIsrCycles = isrCycles;
+#endif
   }
+#if DRUM_BARE_METAL
+  eventLog.drain(writeLogRecord);
+  delay(LOG_DRAIN_MS); // interrupts run on, the next pass drains what they logged
+#else
   vTaskDelay(pdMS_TO_TICKS(2000));
+#endif
 }